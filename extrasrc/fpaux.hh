@@ -1859,7 +1859,7 @@ template<> inline int fp_value_precision_decimal_digits<MpfrFloat>()
     template<typename T>
     struct IsComplexType<std::complex<T> >: public std::true_type { };
   #endif
-#line 1865 "extrasrc/fpaux.hh"
+#line 1863 "extrasrc/fpaux.hh"
 //$PLACEMENT_END
 
 } // namespace FUNCTIONPARSERTYPES
@@ -128,6 +128,43 @@ namespace FUNCTIONPARSERTYPES
         VarBegin
     };
 
+    /* The pairs of opcodes which the threaded interpreter runs as a single
+       instruction, its superinstructions (see createThreadedCode() in
+       fparser.cc). VarBegin stands for the push of any variable. Only
+       opcodes without operands in the bytecode can be paired. The pairs
+       are the most frequent ones found by util/bytecode_ngrams in the
+       functions under tests/. Optimized functions run register code
+       instead, whose fused instructions are made when it is synthesized
+       (see fpoptimizer/registercode.hh).
+    */
+#define FP_LIST_THREADED_SUPERINSTRUCTIONS(o) \
+        o(variableVariable, VarBegin, VarBegin) \
+        o(variableImmed,    VarBegin, cImmed) \
+        o(immedAdd,         cImmed,   cAdd) \
+        o(immedMul,         cImmed,   cMul)
+
+#ifdef FP_SUPPORT_OPTIMIZER
+    /* An instruction of the register code made by Optimize(). The operands
+       are register numbers, except where noted:
+         unary and binary opcodes: result = op(a) or op(a, b)
+         cFma, cFms:               result = op(a, b, c)
+         cFmma, cFmms:             result = op(a, b, c, d)
+         cLog2by:                  result = log2(a) * b
+         cSinCos, cSinhCosh:       result = sin(a), b = cos(a)
+         cDup:                     result = a
+         cIf, cAbsIf:              if a is false, jump to instruction b
+         cJump:                    jump to instruction a
+         cFCall, cPCall:           result = function number a, called with
+                                   the registers starting from b
+       cRDiv and cRSub don't occur; they become cDiv and cSub with the
+       operands swapped.
+    */
+    struct RegisterInstruction
+    {
+        unsigned opcode, result, a, b, c, d;
+    };
+#endif
+
 #ifdef ONCE_FPARSER_H_
     /* NamePtr is essentially the same as std::string_view,
      * but std::string_view requires c++17 while fparser
@@ -180,18 +217,20 @@ namespace FUNCTIONPARSERTYPES
 
 #ifdef ONCE_FPARSER_H_
 #include <vector>
+#include <atomic>
 
 template<typename Value_t>
 struct FunctionParserBase<Value_t>::Data
 {
-    unsigned mReferenceCounter = 1;
+    // The parsers sharing the data, which may be in different threads
+    std::atomic<unsigned> mReferenceCounter {1};
 
     char mDelimiterChar = '\0';
     FunctionParserErrorType mParseErrorType =
         FunctionParserErrorType::no_function_parsed_yet;
-    int mEvalErrorType = 0;
     bool mUseDegreeConversion = false;
     bool mHasByteCodeFlags = false;
+    bool mPropagateNaN = false; // see setNaNPropagation()
     const char* mErrorLocation = nullptr;
 
     unsigned mVariablesAmount = 0;
@@ -237,14 +276,67 @@ struct FunctionParserBase<Value_t>::Data
     std::vector<unsigned> mByteCode {};
     std::vector<Value_t> mImmed {};
 
-#if !defined(FP_USE_THREAD_SAFE_EVAL) && \
-    !defined(FP_USE_THREAD_SAFE_EVAL_WITH_ALLOCA)
-    std::vector<Value_t> mStack {};
-    // Note: When mStack exists,
-    //       mStack.size() and mStackSize are mutually redundant.
+    unsigned mStackSize = 0;
+
+    /* The stack positions of the results, if the bytecode computes more
+       than one (see EvalAll()). Empty if the only result is the topmost
+       value of the stack, as is normally the case.
+    */
+    std::vector<unsigned> mResultPositions {};
+
+#ifdef FP_SUPPORT_THREADED_EVAL
+    /* The bytecode translated for EvalThreaded(): the address of the code
+       of each opcode, followed by its operands. Empty if the bytecode could
+       not be translated, in which case the switch interpreter is used.
+    */
+    union ThreadedCodeWord
+    {
+        const void* label;
+        unsigned operand;
+    };
+    std::vector<ThreadedCodeWord> mThreadedCode {};
 #endif
 
-    unsigned mStackSize = 0;
+#ifdef FP_SUPPORT_OPTIMIZER
+    /* The register code made by Optimize(), which Eval() prefers over the
+       bytecode. Empty if the bytecode could not be translated. The
+       registers are kept in the evaluation stack, so mStackSize is at
+       least the number of registers when this isn't empty.
+    */
+    std::vector<FUNCTIONPARSERTYPES::RegisterInstruction> mRegisterCode {};
+    unsigned mRegisterResult = 0;
+    std::vector<unsigned> mResultRegisters {}; // for mResultPositions
+    /* The register code run by EvalIncremental(). Unlike mRegisterCode, it
+       gives every value a register of its own, so that the registers kept
+       by an EvalContext hold the results of all instructions from their
+       last run. mIncrementalSets has the instructions to run again when
+       each variable changes (see FindIncrementalSets()), and the version
+       is different for each code made, telling an EvalContext whether its
+       registers are from this code.
+    */
+    std::vector<FUNCTIONPARSERTYPES::RegisterInstruction> mIncrementalCode {};
+    unsigned mIncrementalRegisterCount = 0, mIncrementalResult = 0;
+    std::vector<unsigned long long> mIncrementalSets {};
+    unsigned long long mIncrementalCodeVersion = 0;
+#ifdef FP_SUPPORT_THREADED_EVAL
+    // The address of the code of each instruction, for EvalRegisters().
+    std::vector<const void*> mRegisterCodeLabels {};
+#endif
+#endif
+
+    /* The key of the parse cache entry which has the same code, if the code
+       was made by Parse() or Optimize() with the cache enabled (see
+       setParseCacheSize()). Cleared by CopyOnWrite(), as the code may be
+       about to change.
+    */
+    std::string mParseCacheKey {};
+
+    /* Machine code created by CreateJIT(), or null. It's released when the
+       bytecode changes, and it's not copied along with the rest of the data.
+    */
+    JITFunctionPtr mJITFunction = nullptr;
+    void* mJITCode = nullptr;
+    std::size_t mJITCodeSize = 0;
 
     Data();
     Data(const Data&);
@@ -12,12 +12,22 @@
 #include "fparser.hh"
 
 #include <set>
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
 #include <cmath>
 #include <cassert>
 #include <limits>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+#include <list>
+#include <unordered_map>
+#include <sstream>
+#include <type_traits>
 
 #include "extrasrc/fptypes.hh"
 #include "extrasrc/fpaux.hh"
@@ -29,6 +39,21 @@ using namespace FUNCTIONPARSERTYPES;
 #endif
 #endif
 
+#if !defined(FP_DISABLE_JIT) && !defined(FP_DISABLE_DOUBLE_TYPE) && \
+    defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#define FP_SUPPORT_X86_64_JIT
+#include <sys/mman.h>
+#include <cstdint>
+#endif
+
+/* -ffinite-math-only, which -ffast-math turns on, lets the compiler assume
+   that there are no infinities or NaNs, which EvalInterval() and the NaN
+   propagation mode need with the IEEE types.
+*/
+#if defined(__FINITE_MATH_ONLY__) && __FINITE_MATH_ONLY__
+#define FP_FINITE_MATH_ONLY
+#endif
+
 //=========================================================================
 // Opcode analysis functions
 //=========================================================================
@@ -626,6 +651,46 @@ namespace
         namePtrs.insert(nameIter, std::move(newName));
         return true;
     }
+
+    template<typename Data_t>
+    void releaseJITCode(Data_t& data)
+    {
+#ifdef FP_SUPPORT_X86_64_JIT
+        if(data.mJITCode)
+            munmap(data.mJITCode, data.mJITCodeSize);
+#endif
+        data.mJITFunction = nullptr;
+        data.mJITCode = nullptr;
+        data.mJITCodeSize = 0;
+    }
+
+    /* The data is shared by the copies of a parser, which may be made and
+       destroyed by different threads. Taking a reference needs no ordering,
+       as the data doesn't change while it's shared, but whoever releases the
+       last reference must see the other threads' uses of the data before
+       deleting it. releaseReference() returns true for the last reference.
+    */
+    template<typename Shared_t>
+    inline void addReference(Shared_t& counter)
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template<typename Shared_t>
+    inline bool releaseReference(Shared_t& counter)
+    {
+        return counter.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    // Marks the scratch memory kept by a thread as being in use for as
+    // long as it exists, so that nested evaluations use memory of their own
+    struct ScratchReservation
+    {
+        bool& mInUse;
+        explicit ScratchReservation(bool& inUse): mInUse(inUse)
+        { mInUse = true; }
+        ~ScratchReservation() { mInUse = false; }
+    };
 }
 
 
@@ -641,8 +706,8 @@ FunctionParserBase<Value_t>::Data::Data(const Data& rhs):
     mReferenceCounter(0),
     mDelimiterChar(rhs.mDelimiterChar),
     mParseErrorType(rhs.mParseErrorType),
-    mEvalErrorType(rhs.mEvalErrorType),
     mUseDegreeConversion(rhs.mUseDegreeConversion),
+    mPropagateNaN(rhs.mPropagateNaN),
     mErrorLocation(rhs.mErrorLocation),
     mVariablesAmount(rhs.mVariablesAmount),
     mVariablesString(rhs.mVariablesString),
@@ -651,10 +716,25 @@ FunctionParserBase<Value_t>::Data::Data(const Data& rhs):
     mFuncParsers(rhs.mFuncParsers),
     mByteCode(rhs.mByteCode),
     mImmed(rhs.mImmed),
-#ifndef FP_USE_THREAD_SAFE_EVAL
-    mStack(rhs.mStackSize),
+    mStackSize(rhs.mStackSize),
+    mResultPositions(rhs.mResultPositions)
+#ifdef FP_SUPPORT_THREADED_EVAL
+    , mThreadedCode(rhs.mThreadedCode)
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    , mRegisterCode(rhs.mRegisterCode)
+    , mRegisterResult(rhs.mRegisterResult)
+    , mResultRegisters(rhs.mResultRegisters)
+    , mIncrementalCode(rhs.mIncrementalCode)
+    , mIncrementalRegisterCount(rhs.mIncrementalRegisterCount)
+    , mIncrementalResult(rhs.mIncrementalResult)
+    , mIncrementalSets(rhs.mIncrementalSets)
+    , mIncrementalCodeVersion(rhs.mIncrementalCodeVersion)
+#ifdef FP_SUPPORT_THREADED_EVAL
+    , mRegisterCodeLabels(rhs.mRegisterCodeLabels)
+#endif
 #endif
-    mStackSize(rhs.mStackSize)
+    , mParseCacheKey(rhs.mParseCacheKey)
 {
     for(typename NamePtrsMap<Value_t>::const_iterator i = rhs.mNamePtrs.begin();
         i != rhs.mNamePtrs.end();
@@ -692,20 +772,22 @@ FunctionParserBase<Value_t>::Data::~Data()
         if(i->second.type != NameData<Value_t>::VARIABLE)
             delete[] i->first.name;
     }
+    releaseJITCode(*this);
 }
 
 template<typename Value_t>
 void FunctionParserBase<Value_t>::incFuncWrapperRefCount
 (FunctionWrapper* wrapper)
 {
-    ++wrapper->mReferenceCount;
+    addReference(wrapper->mReferenceCount);
 }
 
 template<typename Value_t>
 unsigned FunctionParserBase<Value_t>::decFuncWrapperRefCount
 (FunctionWrapper* wrapper)
 {
-    return --wrapper->mReferenceCount;
+    return wrapper->mReferenceCount.fetch_sub(1, std::memory_order_acq_rel)
+        - 1;
 }
 
 template<typename Value_t>
@@ -784,23 +866,28 @@ FunctionParserBase<Value_t>::Data::FuncWrapperPtrData::operator=
 template<typename Value_t>
 FunctionParserBase<Value_t>::FunctionParserBase():
     mData(new Data),
-    mStackPtr(0)
+    mStackPtr(0),
+    mEvalErrorType(0)
 {
 }
 
 template<typename Value_t>
 FunctionParserBase<Value_t>::~FunctionParserBase()
 {
-    if(--(mData->mReferenceCounter) == 0)
+    if(releaseReference(mData->mReferenceCounter))
         delete mData;
 }
 
+/* The copy shares the data, but not the evaluation stack, so that the copy
+   can be given to another thread.
+*/
 template<typename Value_t>
 FunctionParserBase<Value_t>::FunctionParserBase(const FunctionParserBase& cpy):
     mData(cpy.mData),
-    mStackPtr(0)
+    mStackPtr(0),
+    mEvalErrorType(cpy.mEvalErrorType)
 {
-    ++(mData->mReferenceCounter);
+    addReference(mData->mReferenceCounter);
 }
 
 template<typename Value_t>
@@ -809,11 +896,11 @@ FunctionParserBase<Value_t>::operator=(const FunctionParserBase& cpy)
 {
     if(mData != cpy.mData)
     {
-        if(--(mData->mReferenceCounter) == 0) delete mData;
-
+        addReference(cpy.mData->mReferenceCounter);
+        if(releaseReference(mData->mReferenceCounter)) delete mData;
         mData = cpy.mData;
-        ++(mData->mReferenceCounter);
     }
+    mEvalErrorType = cpy.mEvalErrorType;
     return *this;
 }
 
@@ -827,6 +914,8 @@ FunctionParserBase<Value_t>::getParserData()
 template<typename Value_t>
 void FunctionParserBase<Value_t>::setDelimiterChar(char c)
 {
+    if(mData->mDelimiterChar == c) return;
+    CopyOnWrite();
     mData->mDelimiterChar = c;
 }
 
@@ -837,13 +926,23 @@ void FunctionParserBase<Value_t>::setDelimiterChar(char c)
 template<typename Value_t>
 void FunctionParserBase<Value_t>::CopyOnWrite()
 {
-    if(mData->mReferenceCounter > 1)
+    /* The other parsers sharing the data may be copying or releasing it at
+       the same time. If they release it after the check, the last one
+       deletes it, which may be this one.
+    */
+    if(mData->mReferenceCounter.load(std::memory_order_acquire) > 1)
     {
         Data* oldData = mData;
         mData = new Data(*oldData);
-        --(oldData->mReferenceCounter);
         mData->mReferenceCounter = 1;
+        if(releaseReference(oldData->mReferenceCounter)) delete oldData;
     }
+    else
+    {
+        // The data is about to change, so the machine code would be stale
+        releaseJITCode(*mData);
+    }
+    mData->mParseCacheKey.clear();
 }
 
 template<typename Value_t>
@@ -869,6 +968,39 @@ void FunctionParserBase<Value_t>::setEpsilon(Value_t value)
 }
 
 
+//=========================================================================
+// NaN propagation
+//=========================================================================
+/* Only the types which have a NaN value can propagate it, and only if the
+   compiler keeps the IEEE semantics for it; otherwise the setting stays
+   off. The threaded code and the machine code are made for one evaluation
+   mode, so they are made again.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::setNaNPropagation(bool enabled)
+{
+    enabled = enabled && std::numeric_limits<Value_t>::has_quiet_NaN;
+#ifdef FP_FINITE_MATH_ONLY
+    enabled = false;
+#endif
+    if(mData->mPropagateNaN == enabled) return;
+
+    const bool hadJIT = mData->mJITFunction != nullptr;
+    CopyOnWrite();
+    mData->mPropagateNaN = enabled;
+    if(mData->mParseErrorType == FunctionParserErrorType::no_error)
+        CreateThreadedCode();
+    releaseJITCode(*mData);
+    if(hadJIT) CreateJIT();
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::nanPropagation() const
+{
+    return mData->mPropagateNaN;
+}
+
+
 //=========================================================================
 // User-defined identifier addition functions
 //=========================================================================
@@ -921,6 +1053,63 @@ bool FunctionParserBase<Value_t>::AddFunction
     return success;
 }
 
+namespace
+{
+    /* The wrapper of a function added with a BatchFunctionPtr. The scalar
+       evaluation calls it with blocks of one row.
+    */
+    template<typename Value_t>
+    class BatchFunctionWrapper:
+        public FunctionParserBase<Value_t>::FunctionWrapper
+    {
+        typename FunctionParserBase<Value_t>::BatchFunctionPtr mFuncPtr;
+        unsigned mParamsAmount;
+
+     public:
+        BatchFunctionWrapper
+        (typename FunctionParserBase<Value_t>::BatchFunctionPtr funcPtr,
+         unsigned paramsAmount):
+            mFuncPtr(funcPtr), mParamsAmount(paramsAmount) {}
+
+        virtual Value_t callFunction(const Value_t* values)
+        {
+            enum { MaxParamsOnStack = 8 };
+            const Value_t* paramsOnStack[MaxParamsOnStack];
+            std::vector<const Value_t*> paramsOnHeap;
+            const Value_t** params = paramsOnStack;
+            if(mParamsAmount > MaxParamsOnStack)
+            {
+                paramsOnHeap.resize(mParamsAmount);
+                params = &paramsOnHeap[0];
+            }
+            for(unsigned p = 0; p < mParamsAmount; ++p)
+                params[p] = values + p;
+
+            Value_t result = Value_t();
+            mFuncPtr(params, 1, &result);
+            return result;
+        }
+
+        virtual bool callFunctionBatch(const Value_t* const* params,
+                                       std::size_t n, Value_t* results)
+        {
+            mFuncPtr(params, n, results);
+            return true;
+        }
+    };
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::AddFunction
+(const std::string& name, BatchFunctionPtr ptr, unsigned paramsAmount)
+{
+    FunctionWrapper* wrapper =
+        new BatchFunctionWrapper<Value_t>(ptr, paramsAmount);
+    if(addFunctionWrapperPtr(name, wrapper, paramsAmount)) return true;
+    delete wrapper;
+    return false;
+}
+
 template<typename Value_t>
 bool FunctionParserBase<Value_t>::addFunctionWrapperPtr
 (const std::string& name, FunctionWrapper* wrapper, unsigned paramsAmount)
@@ -1229,7 +1418,7 @@ FunctionParserErrorType FunctionParserBase<Value_t>::ParseError() const
 template<typename Value_t>
 int FunctionParserBase<Value_t>::EvalError() const
 {
-    return mData->mEvalErrorType;
+    return mEvalErrorType;
 }
 
 
@@ -1290,6 +1479,273 @@ bool FunctionParserBase<Value_t>::ParseVariables
     return true;
 }
 
+// ---------------------------------------------------------------------------
+// Parse cache
+// ---------------------------------------------------------------------------
+namespace
+{
+    inline bool isAsciiSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v';
+    }
+
+    inline bool isWordChar(unsigned char c)
+    {
+        return std::isalnum(c) || c == '_' || c == '.' || c >= 0x80;
+    }
+
+    inline bool isGroupingChar(char c)
+    {
+        return c == '(' || c == ')' || c == ',';
+    }
+
+    inline bool isExponentChar(char c)
+    {
+        return c == 'e' || c == 'E' || c == 'p' || c == 'P';
+    }
+
+    /* The function string with the spaces which can't change its meaning
+       removed, so that differently spaced copies of a function share their
+       parse cache entry. Spaces are kept between identifiers and literals,
+       between two operator characters (like "< ="), and around the sign
+       after a literal ending in an exponent character (like "1e -3").
+    */
+    std::string normalizedFunctionString(const char* function)
+    {
+        std::string result;
+        bool numericWord = false;
+        for(const char* ptr = function; *ptr; )
+        {
+            if(isAsciiSpace(*ptr))
+            {
+                while(isAsciiSpace(*ptr)) ++ptr;
+                if(result.empty() || !*ptr) continue;
+                const char prev = result[result.size() - 1], next = *ptr;
+                const bool prevWord = isWordChar(prev), nextWord = isWordChar(next);
+                if((prevWord && nextWord)
+                || (!prevWord && !nextWord &&
+                    !isGroupingChar(prev) && !isGroupingChar(next))
+                || (numericWord && (next == '+' || next == '-') &&
+                    isExponentChar(prev))
+                || (numericWord && (prev == '+' || prev == '-') &&
+                    isExponentChar(result[result.size() - 2])))
+                    result += ' ';
+                continue;
+            }
+            if(isWordChar(*ptr) &&
+               (result.empty() || !isWordChar(result[result.size() - 1])))
+                numericWord = std::isdigit((unsigned char)*ptr) || *ptr == '.';
+            result += *ptr++;
+        }
+        return result;
+    }
+}
+
+/* The process-wide cache of the code made by Parse() and Optimize(), one
+   for each Value_t. The entries are in the order of their last use, and
+   the least recently used ones are removed to keep the size within
+   mMaxEntries. The entries hold a reference to their data, which they
+   share with the parsers taking it. The code made by Optimize() is also kept in the files of
+   mDirectory, if it's set (see setParseCacheDirectory()).
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::ParseCache
+{
+    struct Entry
+    {
+        const std::string* mKey; // the key in mIndex
+        Data* mData;
+    };
+    typedef std::list<Entry> EntryList;
+
+    std::mutex mMutex;
+    std::atomic<std::size_t> mMaxEntries;
+    EntryList mEntries; // the most recently used first
+    std::unordered_map<std::string, typename EntryList::iterator> mIndex;
+    ParseCacheStatistics mStatistics;
+    std::string mDirectory;
+
+    ParseCache(): mMaxEntries(0), mStatistics(), mDirectory() {}
+    ~ParseCache() { evict(0); }
+
+    void evict(std::size_t maxEntries)
+    {
+        while(mEntries.size() > maxEntries)
+        {
+            if(releaseReference(mEntries.back().mData->mReferenceCounter))
+                delete mEntries.back().mData;
+            mIndex.erase(mIndex.find(*mEntries.back().mKey));
+            mEntries.pop_back();
+            ++mStatistics.evictions;
+        }
+    }
+
+    static ParseCache& instance()
+    {
+        static ParseCache cache;
+        return cache;
+    }
+};
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::setParseCacheSize(std::size_t maxEntries)
+{
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    cache.mMaxEntries = maxEntries;
+    cache.evict(maxEntries);
+}
+
+template<typename Value_t>
+std::size_t FunctionParserBase<Value_t>::parseCacheSize()
+{
+    return ParseCache::instance().mMaxEntries;
+}
+
+template<typename Value_t>
+typename FunctionParserBase<Value_t>::ParseCacheStatistics
+FunctionParserBase<Value_t>::parseCacheStatistics()
+{
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    ParseCacheStatistics statistics = cache.mStatistics;
+    statistics.entries = cache.mEntries.size();
+    return statistics;
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::clearParseCache()
+{
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    cache.evict(0);
+    cache.mStatistics = ParseCacheStatistics();
+}
+
+/* The key of the code Parse() would make of the function, or an empty
+   string if it isn't to be cached. The key tells everything the code
+   depends on: the function, the variables, the settings and the
+   identifiers added to the parser.
+*/
+template<typename Value_t>
+std::string FunctionParserBase<Value_t>::ParseCacheKey
+(const char* function, const std::string& vars, bool useDegrees) const
+{
+    // Only the types whose values can be written out exactly are cached,
+    // and a delimiter would make the result depend on the rest of the string
+    if(ParseCache::instance().mMaxEntries == 0 || mData->mDelimiterChar
+    || !std::is_trivially_copyable<Value_t>::value)
+        return std::string();
+
+    std::ostringstream key;
+    key << std::hexfloat << normalizedFunctionString(function) << '\0'
+        << vars << '\0' << useDegrees << mData->mPropagateNaN << ' '
+        << epsilon();
+
+    for(typename NamePtrsMap<Value_t>::const_iterator
+            i = mData->mNamePtrs.begin(); i != mData->mNamePtrs.end(); ++i)
+    {
+        const NameData<Value_t>& data = i->second;
+        if(data.type == NameData<Value_t>::VARIABLE) continue;
+
+        key << '\0';
+        key.write(i->first.name, i->first.nameLength);
+        key << ' ' << int(data.type) << ' ';
+        switch(data.type)
+        {
+          case NameData<Value_t>::CONSTANT:
+          case NameData<Value_t>::UNIT:
+              key << data.value;
+              break;
+          case NameData<Value_t>::FUNC_PTR:
+              {
+                  const typename Data::FuncWrapperPtrData& func =
+                      mData->mFuncPtrs[data.index];
+                  key << data.index << ' ' << func.mNumParams << ' '
+                      << static_cast<const void*>(func.mFuncWrapperPtr) << ' ';
+                  key.write(reinterpret_cast<const char*>(&func.mRawFuncPtr),
+                            sizeof(func.mRawFuncPtr));
+                  break;
+              }
+          case NameData<Value_t>::PARSER_PTR:
+              key << data.index << ' '
+                  << mData->mFuncParsers[data.index].mNumParams << ' '
+                  << static_cast<const void*>
+                     (mData->mFuncParsers[data.index].mParserPtr);
+              break;
+          case NameData<Value_t>::VARIABLE:
+              break;
+        }
+    }
+    return key.str();
+}
+
+/* Replaces the data with the data of the cache entry of the given key,
+   returning false if there is no such entry.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::TakeFromParseCache(const std::string& key)
+{
+    if(key.empty()) return false;
+
+    ParseCache& cache = ParseCache::instance();
+    Data* data;
+    {
+        std::lock_guard<std::mutex> lock(cache.mMutex);
+        typename std::unordered_map<std::string,
+                                    typename ParseCache::EntryList::iterator>
+            ::iterator iter = cache.mIndex.find(key);
+        if(iter == cache.mIndex.end())
+        {
+            ++cache.mStatistics.misses;
+            return false;
+        }
+        ++cache.mStatistics.hits;
+        cache.mEntries.splice(cache.mEntries.begin(), cache.mEntries,
+                              iter->second);
+        data = iter->second->mData;
+        addReference(data->mReferenceCounter);
+    }
+
+    if(releaseReference(mData->mReferenceCounter)) delete mData;
+    mData = data;
+    return true;
+}
+
+/* Adds the data to the cache with the given key (unless the key is empty),
+   and marks the data as being the same as the entry. The data is then
+   shared with the cache.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::PutInParseCache(const std::string& key)
+{
+    if(key.empty()) return;
+
+    mData->mParseCacheKey = key;
+    Data* const data = mData;
+
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    const std::size_t maxEntries = cache.mMaxEntries;
+    if(maxEntries == 0 || cache.mIndex.count(key))
+    {
+        // Disabled, or another thread added the same code meanwhile
+        return;
+    }
+    addReference(data->mReferenceCounter);
+
+    const typename ParseCache::Entry entry =
+    {
+        &cache.mIndex.insert
+        (std::make_pair(key, cache.mEntries.end())).first->first,
+        data
+    };
+    cache.mEntries.push_front(entry);
+    cache.mIndex.find(key)->second = cache.mEntries.begin();
+    cache.evict(maxEntries);
+}
+
+
 // ---------------------------------------------------------------------------
 // Parse() public interface functions
 // ---------------------------------------------------------------------------
@@ -1298,6 +1754,9 @@ int FunctionParserBase<Value_t>::Parse(const char* Function,
                                        const std::string& Vars,
                                        bool useDegrees)
 {
+    const std::string cacheKey = ParseCacheKey(Function, Vars, useDegrees);
+    if(TakeFromParseCache(cacheKey)) return -1;
+
     CopyOnWrite();
 
     if(!ParseVariables(Vars))
@@ -1306,7 +1765,9 @@ int FunctionParserBase<Value_t>::Parse(const char* Function,
         return static_cast<int>(std::strlen(Function));
     }
 
-    return ParseFunction(Function, useDegrees);
+    const int result = ParseFunction(Function, useDegrees);
+    if(result < 0) PutInParseCache(cacheKey);
+    return result;
 }
 
 template<typename Value_t>
@@ -1314,6 +1775,10 @@ int FunctionParserBase<Value_t>::Parse(const std::string& Function,
                                        const std::string& Vars,
                                        bool useDegrees)
 {
+    const std::string cacheKey =
+        ParseCacheKey(Function.c_str(), Vars, useDegrees);
+    if(TakeFromParseCache(cacheKey)) return -1;
+
     CopyOnWrite();
 
     if(!ParseVariables(Vars))
@@ -1322,7 +1787,9 @@ int FunctionParserBase<Value_t>::Parse(const std::string& Function,
         return static_cast<int>(Function.size());
     }
 
-    return ParseFunction(Function.c_str(), useDegrees);
+    const int result = ParseFunction(Function.c_str(), useDegrees);
+    if(result < 0) PutInParseCache(cacheKey);
+    return result;
 }
 
 
@@ -1340,6 +1807,14 @@ int FunctionParserBase<Value_t>::ParseFunction(const char* function,
     mData->mByteCode.clear(); mData->mByteCode.reserve(128);
     mData->mImmed.clear(); mData->mImmed.reserve(128);
     mData->mStackSize = mStackPtr = 0;
+    mData->mResultPositions.clear();
+#ifdef FP_SUPPORT_THREADED_EVAL
+    mData->mThreadedCode.clear();
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    mData->mRegisterCode.clear();
+    mData->mIncrementalCode.clear();
+#endif
 
     mData->mHasByteCodeFlags = false;
 
@@ -1363,10 +1838,7 @@ int FunctionParserBase<Value_t>::ParseFunction(const char* function,
         return static_cast<int>(ptr - function);
     }
 
-#ifndef FP_USE_THREAD_SAFE_EVAL
-    mData->mStack.resize(mData->mStackSize);
-#endif
-
+    CreateThreadedCode();
     return -1;
 }
 
@@ -2609,16 +3081,30 @@ inline void FunctionParserBase<Value_t>::PutOpcodeParamAt
 //===========================================================================
 // Function evaluation
 //===========================================================================
+namespace
+{
+    /* In the NaN propagation mode the evaluation goes on after an error,
+       and the error code is a bitmask with the bit 1 << (code-1) set for
+       each kind of error which occurred. Converts the error of a parser
+       called by another one into the form used by the caller.
+    */
+    inline int convertEvalError(int error, bool fromBitmask, bool toBitmask)
+    {
+        if(fromBitmask == toBitmask || error == 0) return error;
+        if(toBitmask) return 1 << (error - 1);
+        int code = 1;
+        for(; !(error & 1); error >>= 1) ++code;
+        return code;
+    }
+}
+
 template<typename Value_t>
 Value_t FunctionParserBase<Value_t>::Eval(const Value_t* Vars)
 {
     if(mData->mParseErrorType != FunctionParserErrorType::no_error) return Value_t(0);
 
-    const unsigned* const byteCode = &(mData->mByteCode[0]);
-    const Value_t* const immed = mData->mImmed.empty() ? 0 : &(mData->mImmed[0]);
-    const unsigned byteCodeSize = unsigned(mData->mByteCode.size());
-    unsigned IP, DP=0;
-    int SP=-1;
+    if(mData->mJITFunction)
+        return mData->mJITFunction(Vars, &mEvalErrorType);
 
 #ifdef FP_USE_THREAD_SAFE_EVAL
     /* If Eval() may be called by multiple threads simultaneously,
@@ -2641,172 +3127,576 @@ Value_t FunctionParserBase<Value_t>::Eval(const Value_t* Vars)
     Value_t*& Stack = AutoDeallocStack.ptr;
   #endif
 #else
-    /* No thread safety, so use a global stack. */
-    std::vector<Value_t>& Stack = mData->mStack;
+    /* No thread safety, so use the stack of this instance. It grows to the
+     * size needed by the data, which may have come from a copy or the parse
+     * cache.
+     */
+    if(mStack.size() < mData->mStackSize) mStack.resize(mData->mStackSize);
+    Value_t* const Stack = mStack.data();
 #endif
 
-    //PrintByteCode(std::cout, true);
+    return EvalWithStack(Stack, Vars, mEvalErrorType, 0);
+}
 
-    for(IP=0; IP<byteCodeSize; ++IP)
+/* Unlike Eval(), this allocates nothing once the context has grown to the
+   size needed by the parser (and the parsers it calls), and writes nothing
+   to the parser data, so any number of threads can evaluate the same
+   parser simultaneously as long as each one has its own context.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::Eval(EvalContext& context,
+                                          const Value_t* Vars) const
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
     {
-        switch(byteCode[IP])
-        {
-// Functions:
-          case   cAbs: Stack[SP] = fp_abs(Stack[SP]); break;
+        context.mEvalErrorType = 0;
+        return Value_t(0);
+    }
 
-          case  cAcos:
-              if(IsComplexType<Value_t>::value == false
-              && (Stack[SP] < Value_t(-1) || Stack[SP] > Value_t(1)))
-              { mData->mEvalErrorType=4; return Value_t(0); }
-              Stack[SP] = fp_acos(Stack[SP]); break;
+    if(mData->mJITFunction)
+        return mData->mJITFunction(Vars, &context.mEvalErrorType);
 
-          case cAcosh:
-              if(IsComplexType<Value_t>::value == false
-              && Stack[SP] < Value_t(1))
-              { mData->mEvalErrorType=4; return Value_t(0); }
-              Stack[SP] = fp_acosh(Stack[SP]); break;
+    if(context.mStack.size() < mData->mStackSize)
+        context.mStack.resize(mData->mStackSize);
+    return EvalWithStack(&context.mStack[0], Vars, context.mEvalErrorType,
+                         &context);
+}
 
-          case  cAsin:
-              if(IsComplexType<Value_t>::value == false
-              && (Stack[SP] < Value_t(-1) || Stack[SP] > Value_t(1)))
-              { mData->mEvalErrorType=4; return Value_t(0); }
-              Stack[SP] = fp_asin(Stack[SP]); break;
+/* Evaluates with a context owned by the calling thread, so the parser data
+   is only read and the error code goes only to the caller. The context is
+   in use while a user-defined function runs, so evaluations made by such
+   a function get a context of their own.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::Eval(const Value_t* Vars,
+                                          int* evalError) const
+{
+    static thread_local EvalContext threadContext;
+    static thread_local bool threadContextInUse = false;
 
-          case cAsinh: Stack[SP] = fp_asinh(Stack[SP]); break;
+    struct ContextReservation
+    {
+        bool& inUse;
+        explicit ContextReservation(bool& flag): inUse(flag) { inUse = true; }
+        ~ContextReservation() { inUse = false; }
+    };
 
-          case  cAtan: Stack[SP] = fp_atan(Stack[SP]); break;
+    Value_t result;
+    int error;
+    if(threadContextInUse)
+    {
+        EvalContext context;
+        result = Eval(context, Vars);
+        error = context.mEvalErrorType;
+    }
+    else
+    {
+        ContextReservation reservation(threadContextInUse);
+        result = Eval(threadContext, Vars);
+        error = threadContext.mEvalErrorType;
+    }
+    if(evalError) *evalError = error;
+    return result;
+}
 
-          case cAtan2: Stack[SP-1] = fp_atan2(Stack[SP-1], Stack[SP]);
-                       --SP; break;
+// The number of values EvalAll() stores; 1 unless made by Gradient() or
+// Combine().
+template<typename Value_t>
+unsigned FunctionParserBase<Value_t>::GetResultAmount() const
+{
+    return mData->mResultPositions.empty() ?
+        1 : unsigned(mData->mResultPositions.size());
+}
 
-          case cAtanh:
-              if(IsComplexType<Value_t>::value
-              ?  (Stack[SP] == Value_t(-1) || Stack[SP] == Value_t(1))
-              :  (Stack[SP] <= Value_t(-1) || Stack[SP] >= Value_t(1)))
-              { mData->mEvalErrorType=4; return Value_t(0); }
-              Stack[SP] = fp_atanh(Stack[SP]); break;
+/* Evaluates all the results computed by the bytecode, such as the value
+   and the partial derivatives made by Gradient(), into 'results', which
+   must have room for GetResultAmount() values. The error code is set like
+   in Eval(); the results are all zero if there was an error, unless the
+   NaN propagation mode is on.
+*/
 
-          case  cCbrt: Stack[SP] = fp_cbrt(Stack[SP]); break;
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalAll(const Value_t* Vars,
+                                          Value_t* results)
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+    {
+        StoreResults(0, Value_t(0), -1, results);
+        return;
+    }
 
-          case  cCeil: Stack[SP] = fp_ceil(Stack[SP]); break;
+    // The stack is allocated in the same way as in Eval()
+#ifdef FP_USE_THREAD_SAFE_EVAL
+  #ifdef FP_USE_THREAD_SAFE_EVAL_WITH_ALLOCA
+    Value_t* const Stack = (Value_t*)alloca(mData->mStackSize*sizeof(Value_t));
+  #else
+    struct AutoDealloc
+    {
+        Value_t* ptr;
+        ~AutoDealloc() { delete[] ptr; }
+    } AutoDeallocStack = { new Value_t[mData->mStackSize] };
+    Value_t*& Stack = AutoDeallocStack.ptr;
+  #endif
+#else
+    if(mStack.size() < mData->mStackSize) mStack.resize(mData->mStackSize);
+    Value_t* const Stack = mStack.data();
+#endif
 
-          case   cCos: Stack[SP] = fp_cos(Stack[SP]); break;
+    const Value_t topmost =
+        EvalWithStack(Stack, Vars, mEvalErrorType, 0);
+    StoreResults(Stack, topmost, mEvalErrorType, results);
+}
 
-          case  cCosh: Stack[SP] = fp_cosh(Stack[SP]); break;
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalAll(EvalContext& context,
+                                          const Value_t* Vars,
+                                          Value_t* results) const
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+    {
+        context.mEvalErrorType = 0;
+        StoreResults(0, Value_t(0), -1, results);
+        return;
+    }
 
-          case   cCot:
+    if(context.mStack.size() < mData->mStackSize)
+        context.mStack.resize(mData->mStackSize);
+    const Value_t topmost = EvalWithStack(&context.mStack[0], Vars,
+                                          context.mEvalErrorType, &context);
+    StoreResults(&context.mStack[0], topmost, context.mEvalErrorType,
+                 results);
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::StoreResults
+(const Value_t* Stack, const Value_t& topmost, int evalError,
+ Value_t* results) const
+{
+    const unsigned amount = GetResultAmount();
+    if(evalError < 0 || (evalError && !mData->mPropagateNaN))
+    {
+        for(unsigned i = 0; i < amount; ++i) results[i] = Value_t(0);
+        return;
+    }
+    if(mData->mResultPositions.empty())
+    {
+        results[0] = topmost;
+        return;
+    }
+
+    const unsigned* positions = &mData->mResultPositions[0];
+#ifdef FP_SUPPORT_OPTIMIZER
+    if(!mData->mRegisterCode.empty())
+        positions = &mData->mResultRegisters[0];
+#endif
+    for(unsigned i = 0; i < amount; ++i)
+        results[i] = Stack[positions[i]];
+}
+
+//===========================================================================
+// Reverse-mode differentiation
+//===========================================================================
+/* The record of one evaluation made by EvalWithGradient(). Every computed
+   value which depends on the variables gets a node number; the variables
+   are the nodes 1 to mVariablesAmount and 0 stands for a value which
+   doesn't depend on them. Each edge tells how much the value of a node
+   changes with one of the values it was computed from. The nodes are
+   numbered in the order they were computed, so going through the edges
+   backwards visits every node only after all the nodes using it.
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::GradientTape
+{
+    struct Edge
+    {
+        unsigned result, argument;
+        Value_t partial;
+    };
+
+    std::vector<Edge> mEdges; // only grows; mEdgeAmount of them are used
+    std::vector<Value_t> mStack;
+    std::vector<unsigned> mNodes; // the node of each value in mStack
+    std::vector<Value_t> mAdjoints;
+    std::size_t mEdgeAmount = 0;
+    unsigned mNodeAmount = 0;
+    bool mInUse = false;
+};
+
+/* Evaluates the function and stores its partial derivatives with respect
+   to each variable into 'gradient'. The forward pass records the partial
+   derivatives of every operation on a tape, and a backward pass over the
+   tape then gives all the derivatives at once, so the cost doesn't depend
+   on the amount of variables. The tape is kept by the calling thread and
+   reused, so nothing is allocated once it has grown large enough.
+
+   The error code is set like in Eval(); the gradient is all zero if there
+   was an error. The derivatives of functions added with AddFunction() as
+   C++ functions aren't known, so calling one with parameters depending on
+   the variables is error 6, as are the integral types and, for the complex
+   types, the functions which aren't complex differentiable.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::EvalWithGradient(const Value_t* Vars,
+                                                      Value_t* gradient)
+{
+    const unsigned variablesAmount = mData->mVariablesAmount;
+    for(unsigned i = 0; i < variablesAmount; ++i) gradient[i] = Value_t(0);
+
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+        return Value_t(0);
+    if(IsIntType<Value_t>::value)
+    {
+        mEvalErrorType = 6;
+        return Value_t(0);
+    }
+
+    // A C++ function called by this one may need a tape of its own
+    static thread_local GradientTape threadTape;
+    GradientTape localTape;
+    GradientTape& tape = threadTape.mInUse ? localTape : threadTape;
+    const ScratchReservation reservation(tape.mInUse);
+
+    tape.mEdgeAmount = 0;
+    tape.mNodeAmount = variablesAmount;
+    if(tape.mStack.size() < variablesAmount)
+    {
+        tape.mStack.resize(variablesAmount);
+        tape.mNodes.resize(variablesAmount);
+    }
+    for(unsigned i = 0; i < variablesAmount; ++i)
+    {
+        tape.mStack[i] = Vars[i];
+        tape.mNodes[i] = i + 1;
+    }
+
+    const Value_t value =
+        RecordTape(tape, 0, variablesAmount, mEvalErrorType);
+    const unsigned resultNode = tape.mNodes[variablesAmount];
+    if(mEvalErrorType || resultNode == 0) return value;
+
+    tape.mAdjoints.assign(tape.mNodeAmount + 1, Value_t(0));
+    Value_t* const adjoints = &tape.mAdjoints[0];
+    adjoints[resultNode] = Value_t(1);
+    for(std::size_t i = tape.mEdgeAmount; i-- > 0; )
+    {
+        // An unused value adds nothing, even if its partial is NaN
+        const typename GradientTape::Edge& edge = tape.mEdges[i];
+        if(adjoints[edge.result] == Value_t(0)) continue;
+        adjoints[edge.argument] += edge.partial * adjoints[edge.result];
+    }
+    for(unsigned i = 0; i < variablesAmount; ++i)
+        gradient[i] = adjoints[i + 1];
+    return value;
+}
+
+/* Evaluates the bytecode like EvalBySwitch(), recording the partial
+   derivatives on the tape. The variables are the values of the tape stack
+   starting from varBase, and the evaluation uses the tape stack from
+   stackBase on, leaving the result (and its node) at stackBase. Functions
+   defined as other parsers are recorded on the same tape, with their
+   parameters as their variables.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::RecordTape
+(GradientTape& tape, unsigned varBase, unsigned stackBase,
+ int& evalError) const
+{
+    typedef typename GradientTape::Edge Edge;
+
+    // No opcode adds more than four edges, and the jumps only go forward
+    const std::size_t maxEdgeAmount =
+        tape.mEdgeAmount + 4 * mData->mByteCode.size();
+    if(tape.mEdges.size() < maxEdgeAmount)
+        tape.mEdges.resize(maxEdgeAmount);
+    if(tape.mStack.size() < stackBase + mData->mStackSize + 1)
+    {
+        tape.mStack.resize(stackBase + mData->mStackSize + 1);
+        tape.mNodes.resize(stackBase + mData->mStackSize + 1);
+    }
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+    {
+        tape.mStack[stackBase] = Value_t(0);
+        tape.mNodes[stackBase] = 0;
+        evalError = 0;
+        return Value_t(0);
+    }
+
+    const unsigned* const byteCode = &(mData->mByteCode[0]);
+    const Value_t* const immed = mData->mImmed.empty() ? 0 : &(mData->mImmed[0]);
+    const unsigned byteCodeSize = unsigned(mData->mByteCode.size());
+    const Value_t* Vars = &tape.mStack[varBase];
+    const unsigned* VarNodes = &tape.mNodes[varBase];
+    Value_t* Stack = &tape.mStack[stackBase];
+    unsigned* Nodes = &tape.mNodes[stackBase];
+    // Kept in local variables, which the compiler can keep in registers
+    Edge* edge = tape.mEdges.data() + tape.mEdgeAmount;
+    unsigned nodeAmount = tape.mNodeAmount;
+    unsigned IP, DP=0;
+    int SP=-1;
+
+// Records that the value of 'node' changes by 'partial' times the change
+// of the value of 'argumentNode'. The partial is only evaluated if needed.
+#define FP_TAPE_EDGE(resultNode, argumentNode, partialValue) \
+    do { if(argumentNode) \
+         { edge->result = resultNode; edge->argument = argumentNode; \
+           edge->partial = partialValue; ++edge; } } while(0)
+
+// Replaces the node of the topmost value, before the value is replaced
+#define FP_TAPE_UNARY(partial) \
+    do { if(Nodes[SP]) \
+         { const unsigned node = ++nodeAmount; \
+           FP_TAPE_EDGE(node, Nodes[SP], partial); Nodes[SP] = node; } } \
+    while(0)
+
+// The same for an operator replacing the two topmost values
+#define FP_TAPE_BINARY(partial1, partial2) \
+    do { if(Nodes[SP-1] | Nodes[SP]) \
+         { const unsigned node = ++nodeAmount; \
+           FP_TAPE_EDGE(node, Nodes[SP-1], partial1); \
+           FP_TAPE_EDGE(node, Nodes[SP], partial2); Nodes[SP-1] = node; } } \
+    while(0)
+
+// The function can't be differentiated if its parameter isn't a constant
+#define FP_TAPE_NOT_DIFFERENTIABLE(params) \
+    for(unsigned param = 0; param < (params); ++param) \
+        if(Nodes[SP-param]) { evalError=6; return Value_t(0); }
+
+    for(IP=0; IP<byteCodeSize; ++IP)
+    {
+        switch(byteCode[IP])
+        {
+// Functions:
+          case cAbs:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(1)
+              FP_TAPE_UNARY(fp_less(Stack[SP], Value_t(0)) ?
+                            Value_t(-1) : Value_t(1));
+              Stack[SP] = fp_abs(Stack[SP]); break;
+
+          case cAcos:
+              if(IsComplexType<Value_t>::value == false
+              && (Stack[SP] < Value_t(-1) || Stack[SP] > Value_t(1)))
+              { evalError=4; return Value_t(0); }
+              FP_TAPE_UNARY(Value_t(-1) /
+                            fp_sqrt(Value_t(1) - Stack[SP]*Stack[SP]));
+              Stack[SP] = fp_acos(Stack[SP]); break;
+
+          case cAcosh:
+              if(IsComplexType<Value_t>::value == false
+              && Stack[SP] < Value_t(1))
+              { evalError=4; return Value_t(0); }
+              FP_TAPE_UNARY(Value_t(1) / (fp_sqrt(Stack[SP] - Value_t(1)) *
+                                          fp_sqrt(Stack[SP] + Value_t(1))));
+              Stack[SP] = fp_acosh(Stack[SP]); break;
+
+          case cAsin:
+              if(IsComplexType<Value_t>::value == false
+              && (Stack[SP] < Value_t(-1) || Stack[SP] > Value_t(1)))
+              { evalError=4; return Value_t(0); }
+              FP_TAPE_UNARY(Value_t(1) /
+                            fp_sqrt(Value_t(1) - Stack[SP]*Stack[SP]));
+              Stack[SP] = fp_asin(Stack[SP]); break;
+
+          case cAsinh:
+              FP_TAPE_UNARY(Value_t(1) /
+                            fp_sqrt(Stack[SP]*Stack[SP] + Value_t(1)));
+              Stack[SP] = fp_asinh(Stack[SP]); break;
+
+          case cAtan:
+              FP_TAPE_UNARY(Value_t(1) / (Value_t(1) + Stack[SP]*Stack[SP]));
+              Stack[SP] = fp_atan(Stack[SP]); break;
+
+          case cAtan2:
+              {
+                  const Value_t& y = Stack[SP-1], & x = Stack[SP];
+                  const Value_t r2 = x*x + y*y;
+                  FP_TAPE_BINARY(x / r2, -y / r2);
+                  Stack[SP-1] = fp_atan2(y, x); --SP; break;
+              }
+
+          case cAtanh:
+              if(IsComplexType<Value_t>::value
+              ?  (Stack[SP] == Value_t(-1) || Stack[SP] == Value_t(1))
+              :  (Stack[SP] <= Value_t(-1) || Stack[SP] >= Value_t(1)))
+              { evalError=4; return Value_t(0); }
+              FP_TAPE_UNARY(Value_t(1) / (Value_t(1) - Stack[SP]*Stack[SP]));
+              Stack[SP] = fp_atanh(Stack[SP]); break;
+
+          case cCbrt:
+              {
+                  const Value_t r = fp_cbrt(Stack[SP]);
+                  FP_TAPE_UNARY(Value_t(1) / (Value_t(3)*r*r));
+                  Stack[SP] = r; break;
+              }
+
+          case cCeil: Stack[SP] = fp_ceil(Stack[SP]); Nodes[SP] = 0; break;
+
+          // The derivative comes at little extra cost with fp_sinCos()
+          case cCos:
+              if(Nodes[SP])
+              {
+                  const Value_t x = Stack[SP];
+                  Value_t s = Value_t();
+                  fp_sinCos(s, Stack[SP], x);
+                  FP_TAPE_UNARY(-s);
+              }
+              else Stack[SP] = fp_cos(Stack[SP]);
+              break;
+
+          case cCosh:
+              FP_TAPE_UNARY(fp_sinh(Stack[SP]));
+              Stack[SP] = fp_cosh(Stack[SP]); break;
+
+          case cCot:
               {
                   const Value_t t = fp_tan(Stack[SP]);
                   if(t == Value_t(0))
-                  { mData->mEvalErrorType=1; return Value_t(0); }
-                  Stack[SP] = fp_inv(t); break;
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = fp_inv(t);
+                  FP_TAPE_UNARY(-(Value_t(1) + r*r));
+                  Stack[SP] = r; break;
               }
 
-          case   cCsc:
+          case cCsc:
               {
                   const Value_t s = fp_sin(Stack[SP]);
                   if(s == Value_t(0))
-                  { mData->mEvalErrorType=1; return Value_t(0); }
-                  Stack[SP] = fp_inv(s); break;
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = fp_inv(s);
+                  FP_TAPE_UNARY(-r*r*fp_cos(Stack[SP]));
+                  Stack[SP] = r; break;
               }
 
+          case cExp:
+              Stack[SP] = fp_exp(Stack[SP]);
+              FP_TAPE_UNARY(Stack[SP]); break;
 
-          case   cExp: Stack[SP] = fp_exp(Stack[SP]); break;
+          case cExp2:
+              Stack[SP] = fp_exp2(Stack[SP]);
+              FP_TAPE_UNARY(Stack[SP] * fp_const_log2<Value_t>()); break;
 
-          case   cExp2: Stack[SP] = fp_exp2(Stack[SP]); break;
-
-          case cFloor: Stack[SP] = fp_floor(Stack[SP]); break;
+          case cFloor: Stack[SP] = fp_floor(Stack[SP]); Nodes[SP] = 0; break;
 
           case cHypot:
-              Stack[SP-1] = fp_hypot(Stack[SP-1], Stack[SP]);
-              --SP; break;
+              {
+                  const Value_t r = fp_hypot(Stack[SP-1], Stack[SP]);
+                  FP_TAPE_BINARY(Stack[SP-1] / r, Stack[SP] / r);
+                  Stack[SP-1] = r; --SP; break;
+              }
 
-          case    cIf:
-                  if(fp_truth(Stack[SP--]))
-                      IP += 2;
-                  else
-                  {
-                      const unsigned* buf = &byteCode[IP+1];
-                      IP = buf[0];
-                      DP = buf[1];
-                  }
-                  break;
+          case cIf:
+              if(fp_truth(Stack[SP--]))
+                  IP += 2;
+              else
+              {
+                  const unsigned* buf = &byteCode[IP+1];
+                  IP = buf[0];
+                  DP = buf[1];
+              }
+              break;
 
-          case   cInt: Stack[SP] = fp_int(Stack[SP]); break;
+          case cInt: Stack[SP] = fp_int(Stack[SP]); Nodes[SP] = 0; break;
 
-          case   cLog:
+          case cLog:
               if(IsComplexType<Value_t>::value
                ?   Stack[SP] == Value_t(0)
                :   !(Stack[SP] > Value_t(0)))
-              { mData->mEvalErrorType=3; return Value_t(0); }
+              { evalError=3; return Value_t(0); }
+              FP_TAPE_UNARY(Value_t(1) / Stack[SP]);
               Stack[SP] = fp_log(Stack[SP]); break;
 
           case cLog10:
               if(IsComplexType<Value_t>::value
                ?   Stack[SP] == Value_t(0)
                :   !(Stack[SP] > Value_t(0)))
-              { mData->mEvalErrorType=3; return Value_t(0); }
-              Stack[SP] = fp_log10(Stack[SP]);
-              break;
+              { evalError=3; return Value_t(0); }
+              FP_TAPE_UNARY(fp_const_log10inv<Value_t>() / Stack[SP]);
+              Stack[SP] = fp_log10(Stack[SP]); break;
 
-          case  cLog2:
+          case cLog2:
               if(IsComplexType<Value_t>::value
                ?   Stack[SP] == Value_t(0)
                :   !(Stack[SP] > Value_t(0)))
-              { mData->mEvalErrorType=3; return Value_t(0); }
-              Stack[SP] = fp_log2(Stack[SP]);
-              break;
+              { evalError=3; return Value_t(0); }
+              FP_TAPE_UNARY(fp_const_log2inv<Value_t>() / Stack[SP]);
+              Stack[SP] = fp_log2(Stack[SP]); break;
 
-          case   cMax: Stack[SP-1] = fp_max(Stack[SP-1], Stack[SP]);
-                       --SP; break;
+          // The result is one of the parameters, and so is its node
+          case cMax:
+              {
+                  const Value_t r = fp_max(Stack[SP-1], Stack[SP]);
+                  if(!(r == Stack[SP-1])) Nodes[SP-1] = Nodes[SP];
+                  Stack[SP-1] = r; --SP; break;
+              }
 
-          case   cMin: Stack[SP-1] = fp_min(Stack[SP-1], Stack[SP]);
-                       --SP; break;
+          case cMin:
+              {
+                  const Value_t r = fp_min(Stack[SP-1], Stack[SP]);
+                  if(!(r == Stack[SP-1])) Nodes[SP-1] = Nodes[SP];
+                  Stack[SP-1] = r; --SP; break;
+              }
 
-          case   cPow:
-              // x:Negative ^ y:NonInteger is failure,
-              // except when the reciprocal of y forms an integer
-              /*if(IsComplexType<Value_t>::value == false
-              && Stack[SP-1] < Value_t(0) &&
-                 !isInteger(Stack[SP]) &&
-                 !isInteger(1.0 / Stack[SP]))
-              { mEvalErrorType=3; return Value_t(0); }*/
-              // x:0 ^ y:negative is failure
-              if(Stack[SP-1] == Value_t(0) &&
-                 Stack[SP] < Value_t(0))
-              { mData->mEvalErrorType=3; return Value_t(0); }
-              Stack[SP-1] = fp_pow(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case cPow:
+              {
+                  const Value_t& x = Stack[SP-1], & y = Stack[SP];
+                  if(x == Value_t(0) && y < Value_t(0))
+                  { evalError=3; return Value_t(0); }
+                  const Value_t r = fp_pow(x, y);
+                  // fp_pow() gives -(|x|^y) for a negative real x and a
+                  // non-integral y
+                  FP_TAPE_BINARY(x == Value_t(0) ?
+                                 y * fp_pow(x, y - Value_t(1)) : y * r / x,
+                                 r == Value_t(0) ? Value_t(0) :
+                                 r * fp_log(IsComplexType<Value_t>::value ?
+                                            x : fp_abs(x)));
+                  Stack[SP-1] = r; --SP; break;
+              }
 
-          case  cTrunc: Stack[SP] = fp_trunc(Stack[SP]); break;
+          case cTrunc: Stack[SP] = fp_trunc(Stack[SP]); Nodes[SP] = 0; break;
 
-          case   cSec:
+          case cSec:
               {
                   const Value_t c = fp_cos(Stack[SP]);
                   if(c == Value_t(0))
-                  { mData->mEvalErrorType=1; return Value_t(0); }
-                  Stack[SP] = fp_inv(c); break;
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = fp_inv(c);
+                  FP_TAPE_UNARY(r*r*fp_sin(Stack[SP]));
+                  Stack[SP] = r; break;
               }
 
-          case   cSin: Stack[SP] = fp_sin(Stack[SP]); break;
+          case cSin:
+              if(Nodes[SP])
+              {
+                  const Value_t x = Stack[SP];
+                  Value_t c = Value_t();
+                  fp_sinCos(Stack[SP], c, x);
+                  FP_TAPE_UNARY(c);
+              }
+              else Stack[SP] = fp_sin(Stack[SP]);
+              break;
 
-          case  cSinh: Stack[SP] = fp_sinh(Stack[SP]); break;
+          case cSinh:
+              FP_TAPE_UNARY(fp_cosh(Stack[SP]));
+              Stack[SP] = fp_sinh(Stack[SP]); break;
 
-          case  cSqrt:
+          case cSqrt:
               if(IsComplexType<Value_t>::value == false &&
                  Stack[SP] < Value_t(0))
-              { mData->mEvalErrorType=2; return Value_t(0); }
-              Stack[SP] = fp_sqrt(Stack[SP]); break;
-
-          case   cTan: Stack[SP] = fp_tan(Stack[SP]); break;
+              { evalError=2; return Value_t(0); }
+              Stack[SP] = fp_sqrt(Stack[SP]);
+              FP_TAPE_UNARY(Value_t(1) / (Stack[SP] + Stack[SP])); break;
 
-          case  cTanh: Stack[SP] = fp_tanh(Stack[SP]); break;
+          case cTan:
+              Stack[SP] = fp_tan(Stack[SP]);
+              FP_TAPE_UNARY(Value_t(1) + Stack[SP]*Stack[SP]); break;
 
+          case cTanh:
+              Stack[SP] = fp_tanh(Stack[SP]);
+              FP_TAPE_UNARY(Value_t(1) - Stack[SP]*Stack[SP]); break;
 
 // Misc:
-          case cImmed: Stack[++SP] = immed[DP++]; break;
+          case cImmed: Stack[++SP] = immed[DP++]; Nodes[SP] = 0; break;
 
-          case  cJump:
+          case cJump:
               {
                   const unsigned* buf = &byteCode[IP+1];
                   IP = buf[0];
@@ -2815,206 +3705,3999 @@ Value_t FunctionParserBase<Value_t>::Eval(const Value_t* Vars)
               }
 
 // Operators:
-          case   cNeg: Stack[SP] = -Stack[SP]; break;
-          case   cAdd: Stack[SP-1] += Stack[SP]; --SP; break;
-          case   cSub: Stack[SP-1] -= Stack[SP]; --SP; break;
-          case   cMul: Stack[SP-1] *= Stack[SP]; --SP; break;
+          case cNeg:
+              FP_TAPE_UNARY(Value_t(-1));
+              Stack[SP] = -Stack[SP]; break;
 
-          case   cFma: Stack[SP-2] = fp_fma(Stack[SP-2], Stack[SP-1], Stack[SP]); SP -= 2; break;
-          case   cFms: Stack[SP-2] = fp_fms(Stack[SP-2], Stack[SP-1], Stack[SP]); SP -= 2; break;
-          case   cFmma: Stack[SP-3] = fp_fmma(Stack[SP-3], Stack[SP-2], Stack[SP-1], Stack[SP]); SP -= 3; break;
-          case   cFmms: Stack[SP-3] = fp_fmms(Stack[SP-3], Stack[SP-2], Stack[SP-1], Stack[SP]); SP -= 3; break;
+          case cAdd:
+              FP_TAPE_BINARY(Value_t(1), Value_t(1));
+              Stack[SP-1] += Stack[SP]; --SP; break;
 
-          case   cDiv:
-              if(Stack[SP] == Value_t(0))
-              { mData->mEvalErrorType=1; return Value_t(0); }
-              Stack[SP-1] /= Stack[SP]; --SP; break;
+          case cSub:
+              FP_TAPE_BINARY(Value_t(1), Value_t(-1));
+              Stack[SP-1] -= Stack[SP]; --SP; break;
 
-          case   cMod:
-              if(Stack[SP] == Value_t(0))
-              { mData->mEvalErrorType=1; return Value_t(0); }
-              Stack[SP-1] = fp_mod(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case cMul:
+              FP_TAPE_BINARY(Stack[SP], Stack[SP-1]);
+              Stack[SP-1] *= Stack[SP]; --SP; break;
+
+          case cFma: case cFms:
+              {
+                  const Value_t* const p = &Stack[SP-2];
+                  const unsigned* const n = &Nodes[SP-2];
+                  const bool subtract = byteCode[IP] == cFms;
+                  if(n[0] | n[1] | n[2])
+                  {
+                      const unsigned node = ++nodeAmount;
+                      FP_TAPE_EDGE(node, n[0], p[1]);
+                      FP_TAPE_EDGE(node, n[1], p[0]);
+                      FP_TAPE_EDGE(node, n[2],
+                                   subtract ? Value_t(-1) : Value_t(1));
+                      Nodes[SP-2] = node;
+                  }
+                  Stack[SP-2] = subtract ? fp_fms(p[0], p[1], p[2]) :
+                                           fp_fma(p[0], p[1], p[2]);
+                  SP -= 2; break;
+              }
+
+          case cFmma: case cFmms:
+              {
+                  const Value_t* const p = &Stack[SP-3];
+                  const unsigned* const n = &Nodes[SP-3];
+                  const bool subtract = byteCode[IP] == cFmms;
+                  if(n[0] | n[1] | n[2] | n[3])
+                  {
+                      const unsigned node = ++nodeAmount;
+                      FP_TAPE_EDGE(node, n[0], p[1]);
+                      FP_TAPE_EDGE(node, n[1], p[0]);
+                      FP_TAPE_EDGE(node, n[2], subtract ? -p[3] : p[3]);
+                      FP_TAPE_EDGE(node, n[3], subtract ? -p[2] : p[2]);
+                      Nodes[SP-3] = node;
+                  }
+                  Stack[SP-3] = subtract ? fp_fmms(p[0], p[1], p[2], p[3]) :
+                                           fp_fmma(p[0], p[1], p[2], p[3]);
+                  SP -= 3; break;
+              }
+
+          case cDiv:
+              {
+                  if(Stack[SP] == Value_t(0))
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = Stack[SP-1] / Stack[SP];
+                  FP_TAPE_BINARY(Value_t(1) / Stack[SP], -r / Stack[SP]);
+                  Stack[SP-1] = r; --SP; break;
+              }
+
+          case cMod:
+              {
+                  if(Stack[SP] == Value_t(0))
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = fp_mod(Stack[SP-1], Stack[SP]);
+                  FP_TAPE_BINARY(Value_t(1), (r - Stack[SP-1]) / Stack[SP]);
+                  Stack[SP-1] = r; --SP; break;
+              }
 
+          // Comparisons and logical operators are constant where
+          // they have a derivative
           case cEqual:
               Stack[SP-1] = fp_equal(Stack[SP-1], Stack[SP]);
-              --SP; break;
+              Nodes[--SP] = 0; break;
 
           case cNEqual:
               Stack[SP-1] = fp_nequal(Stack[SP-1], Stack[SP]);
-              --SP; break;
+              Nodes[--SP] = 0; break;
+
+          case cLess:
+              Stack[SP-1] = fp_less(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+
+          case cLessOrEq:
+              Stack[SP-1] = fp_lessOrEq(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+
+          case cGreater:
+              Stack[SP-1] = fp_less(Stack[SP], Stack[SP-1]);
+              Nodes[--SP] = 0; break;
+
+          case cGreaterOrEq:
+              Stack[SP-1] = fp_lessOrEq(Stack[SP], Stack[SP-1]);
+              Nodes[--SP] = 0; break;
+
+          case cNot: Stack[SP] = fp_not(Stack[SP]); Nodes[SP] = 0; break;
+
+          case cNotNot: Stack[SP] = fp_truth(Stack[SP]); Nodes[SP] = 0; break;
+
+          case cAnd:
+              Stack[SP-1] = fp_and(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+
+          case cOr:
+              Stack[SP-1] = fp_or(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+
+// Degrees-radians conversion:
+          case cDeg:
+              FP_TAPE_UNARY(RadiansToDegrees(Value_t(1)));
+              Stack[SP] = RadiansToDegrees(Stack[SP]); break;
+
+          case cRad:
+              FP_TAPE_UNARY(DegreesToRadians(Value_t(1)));
+              Stack[SP] = DegreesToRadians(Stack[SP]); break;
+
+// User-defined function calls:
+          case cFCall:
+              {
+                  const unsigned index = byteCode[++IP];
+                  const unsigned params = mData->mFuncPtrs[index].mNumParams;
+                  FP_TAPE_NOT_DIFFERENTIABLE(params)
+                  const Value_t retVal =
+                      mData->mFuncPtrs[index].mRawFuncPtr ?
+                      mData->mFuncPtrs[index].mRawFuncPtr(&Stack[SP-params+1]) :
+                      mData->mFuncPtrs[index].mFuncWrapperPtr->callFunction
+                      (&Stack[SP-params+1]);
+                  SP -= int(params)-1;
+                  Stack[SP] = retVal;
+                  Nodes[SP] = 0;
+                  break;
+              }
+
+          case cPCall:
+              {
+                  const unsigned index = byteCode[++IP];
+                  const unsigned params = mData->mFuncParsers[index].mNumParams;
+                  const unsigned paramsBase = stackBase + SP - params + 1;
+                  tape.mEdgeAmount = std::size_t(edge - tape.mEdges.data());
+                  tape.mNodeAmount = nodeAmount;
+                  mData->mFuncParsers[index].mParserPtr->RecordTape
+                      (tape, paramsBase, stackBase + SP + 1, evalError);
+                  if(evalError) return Value_t(0);
+
+                  // The tape may have been reallocated
+                  edge = tape.mEdges.data() + tape.mEdgeAmount;
+                  nodeAmount = tape.mNodeAmount;
+                  Vars = &tape.mStack[varBase];
+                  VarNodes = &tape.mNodes[varBase];
+                  Stack = &tape.mStack[stackBase];
+                  Nodes = &tape.mNodes[stackBase];
+                  SP -= int(params)-1;
+                  Stack[SP] = Stack[SP+params];
+                  Nodes[SP] = Nodes[SP+params];
+                  break;
+              }
+
+          case cFetch:
+              {
+                  const unsigned stackOffs = byteCode[++IP];
+                  Stack[SP+1] = Stack[stackOffs];
+                  Nodes[SP+1] = Nodes[stackOffs]; ++SP;
+                  break;
+              }
+
+#ifdef FP_SUPPORT_OPTIMIZER
+          case cPopNMov:
+              {
+                  const unsigned stackOffs_target = byteCode[++IP];
+                  const unsigned stackOffs_source = byteCode[++IP];
+                  Stack[stackOffs_target] = Stack[stackOffs_source];
+                  Nodes[stackOffs_target] = Nodes[stackOffs_source];
+                  SP = stackOffs_target;
+                  break;
+              }
+
+          case cLog2by:
+              {
+                  if(IsComplexType<Value_t>::value
+                   ?   Stack[SP-1] == Value_t(0)
+                   :   !(Stack[SP-1] > Value_t(0)))
+                  { evalError=3; return Value_t(0); }
+                  const Value_t l = fp_log2(Stack[SP-1]);
+                  FP_TAPE_BINARY(Stack[SP] * fp_const_log2inv<Value_t>() /
+                                 Stack[SP-1], l);
+                  Stack[SP-1] = l * Stack[SP]; --SP;
+                  break;
+              }
+
+          case cNop: break;
+#endif // FP_SUPPORT_OPTIMIZER
+
+          case cSinCos: case cSinhCosh:
+              {
+                  const unsigned node = Nodes[SP];
+                  if(byteCode[IP] == cSinCos)
+                      fp_sinCos(Stack[SP], Stack[SP+1], Stack[SP]);
+                  else
+                      fp_sinhCosh(Stack[SP], Stack[SP+1], Stack[SP]);
+                  Nodes[SP+1] = 0;
+                  if(node)
+                  {
+                      Nodes[SP] = ++nodeAmount;
+                      FP_TAPE_EDGE(Nodes[SP], node, Stack[SP+1]);
+                      Nodes[SP+1] = ++nodeAmount;
+                      FP_TAPE_EDGE(Nodes[SP+1], node,
+                                   byteCode[IP] == cSinCos ?
+                                   -Stack[SP] : Stack[SP]);
+                  }
+                  ++SP;
+                  break;
+              }
+
+          case cAbsNot:
+              Stack[SP] = fp_absNot(Stack[SP]); Nodes[SP] = 0; break;
+          case cAbsNotNot:
+              Stack[SP] = fp_absNotNot(Stack[SP]); Nodes[SP] = 0; break;
+          case cAbsAnd:
+              Stack[SP-1] = fp_absAnd(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+          case cAbsOr:
+              Stack[SP-1] = fp_absOr(Stack[SP-1], Stack[SP]);
+              Nodes[--SP] = 0; break;
+          case cAbsIf:
+              if(fp_absTruth(Stack[SP--]))
+                  IP += 2;
+              else
+              {
+                  const unsigned* buf = &byteCode[IP+1];
+                  IP = buf[0];
+                  DP = buf[1];
+              }
+              break;
+
+          case cDup:
+              Stack[SP+1] = Stack[SP]; Nodes[SP+1] = Nodes[SP]; ++SP; break;
+
+          case cInv:
+              if(Stack[SP] == Value_t(0))
+              { evalError=1; return Value_t(0); }
+              Stack[SP] = fp_inv(Stack[SP]);
+              FP_TAPE_UNARY(-Stack[SP]*Stack[SP]); break;
+
+          case cSqr:
+              FP_TAPE_UNARY(Stack[SP] + Stack[SP]);
+              Stack[SP] = Stack[SP]*Stack[SP]; break;
+
+          case cRDiv:
+              {
+                  if(Stack[SP-1] == Value_t(0))
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = Stack[SP] / Stack[SP-1];
+                  FP_TAPE_BINARY(-r / Stack[SP-1], Value_t(1) / Stack[SP-1]);
+                  Stack[SP-1] = r; --SP; break;
+              }
+
+          case cRSub:
+              FP_TAPE_BINARY(Value_t(-1), Value_t(1));
+              Stack[SP-1] = Stack[SP] - Stack[SP-1]; --SP; break;
+
+          case cRSqrt:
+              {
+                  if(Stack[SP] == Value_t(0))
+                  { evalError=1; return Value_t(0); }
+                  const Value_t r = fp_rsqrt(Stack[SP]);
+                  FP_TAPE_UNARY(-r / (Stack[SP] + Stack[SP]));
+                  Stack[SP] = r; break;
+              }
+
+#ifdef FP_SUPPORT_COMPLEX_NUMBERS
+          // For the real types these are simple functions of the real
+          // numbers, but for the complex types they aren't differentiable
+          case cReal:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(1)
+              Stack[SP] = fp_real(Stack[SP]); break;
+          case cImag:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(1)
+              Stack[SP] = fp_imag(Stack[SP]); Nodes[SP] = 0; break;
+          case cArg:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(1)
+              Stack[SP] = fp_arg(Stack[SP]); Nodes[SP] = 0; break;
+          case cConj:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(1)
+              Stack[SP] = fp_conj(Stack[SP]); break;
+          case cPolar:
+              if(IsComplexType<Value_t>::value) FP_TAPE_NOT_DIFFERENTIABLE(2)
+              FP_TAPE_BINARY(fp_cos(Stack[SP]),
+                             -Stack[SP-1] * fp_sin(Stack[SP]));
+              Stack[SP-1] = fp_polar(Stack[SP-1], Stack[SP]);
+              --SP; break;
+#endif
+
+// Variables:
+          default:
+              Stack[++SP] = Vars[byteCode[IP]-VarBegin];
+              Nodes[SP] = VarNodes[byteCode[IP]-VarBegin];
+              break;
+        }
+    }
+
+#undef FP_TAPE_NOT_DIFFERENTIABLE
+#undef FP_TAPE_BINARY
+#undef FP_TAPE_UNARY
+#undef FP_TAPE_EDGE
+
+    tape.mEdgeAmount = std::size_t(edge - tape.mEdges.data());
+    tape.mNodeAmount = nodeAmount;
+    evalError=0;
+    Stack[0] = Stack[SP];
+    Nodes[0] = Nodes[SP];
+    return Stack[0];
+}
+
+/* The copies of the arrays of the parser data kept by a CompiledExpression.
+   The threaded code and the register code are null if there are none.
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::CodeArrays
+{
+    typedef typename Data::FuncWrapperPtrData FuncWrapperPtrData;
+    typedef typename Data::FuncParserPtrData FuncParserPtrData;
+
+    const unsigned* mByteCode;
+    const Value_t* mImmed;
+    const FuncWrapperPtrData* mFuncPtrs;
+    const FuncParserPtrData* mFuncParsers;
+    unsigned mByteCodeSize, mImmedAmount, mFuncPtrsAmount, mFuncParsersAmount;
+    unsigned mVariablesAmount;
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const typename Data::ThreadedCodeWord* mThreadedCode;
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    const RegisterInstruction* mRegisterCode;
+    unsigned mRegisterCodeSize, mRegisterResult;
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const void* const* mRegisterCodeLabels;
+#endif
+#endif
+};
+
+/* Where the interpreters read the code from: the parser data, or the
+   arrays of a CompiledExpression if mData is null. It's small enough to
+   be passed in registers. The threaded code and the register labels are
+   created into mData (see CreateThreadedCode()).
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::EvalCode
+{
+    typedef typename Data::FuncWrapperPtrData FuncWrapperPtrData;
+    typedef typename Data::FuncParserPtrData FuncParserPtrData;
+
+    Data* mData;
+    const CodeArrays* mArrays;
+
+    explicit EvalCode(Data& data): mData(&data), mArrays(nullptr) {}
+    explicit EvalCode(const CodeArrays& arrays):
+        mData(nullptr), mArrays(&arrays) {}
+
+    const unsigned* byteCode() const
+    { return mData ? mData->mByteCode.data() : mArrays->mByteCode; }
+    unsigned byteCodeSize() const
+    {
+        return mData ?
+            unsigned(mData->mByteCode.size()) : mArrays->mByteCodeSize;
+    }
+    const Value_t* immed() const
+    { return mData ? mData->mImmed.data() : mArrays->mImmed; }
+    unsigned immedAmount() const
+    { return mData ? unsigned(mData->mImmed.size()) : mArrays->mImmedAmount; }
+    const FuncWrapperPtrData* funcPtrs() const
+    { return mData ? mData->mFuncPtrs.data() : mArrays->mFuncPtrs; }
+    const FuncParserPtrData* funcParsers() const
+    { return mData ? mData->mFuncParsers.data() : mArrays->mFuncParsers; }
+    unsigned funcParsersAmount() const
+    {
+        return mData ?
+            unsigned(mData->mFuncParsers.size()) : mArrays->mFuncParsersAmount;
+    }
+    unsigned variablesAmount() const
+    { return mData ? mData->mVariablesAmount : mArrays->mVariablesAmount; }
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const typename Data::ThreadedCodeWord* threadedCode() const
+    {
+        if(!mData) return mArrays->mThreadedCode;
+        return mData->mThreadedCode.empty() ? 0 : &mData->mThreadedCode[0];
+    }
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    const RegisterInstruction* registerCode() const
+    {
+        if(!mData) return mArrays->mRegisterCode;
+        return mData->mRegisterCode.empty() ? 0 : &mData->mRegisterCode[0];
+    }
+    unsigned registerCodeSize() const
+    {
+        return mData ?
+            unsigned(mData->mRegisterCode.size()) : mArrays->mRegisterCodeSize;
+    }
+    unsigned registerResult() const
+    { return mData ? mData->mRegisterResult : mArrays->mRegisterResult; }
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const void* const* registerCodeLabels() const
+    {
+        return mData ?
+            mData->mRegisterCodeLabels.data() : mArrays->mRegisterCodeLabels;
+    }
+#endif
+#endif
+};
+
+/* Runs the bytecode using the given stack, which must have room for
+   mStackSize values. The error code (or 0) is written to evalError.
+   Functions defined as other parsers are evaluated with the nested
+   contexts of 'context', if it's not null.
+*/
+template<typename Value_t>
+inline Value_t FunctionParserBase<Value_t>::EvalWithStack
+(Value_t* const Stack, const Value_t* Vars, int& evalError,
+ EvalContext* context) const
+{
+    return EvalCodeWithStack(EvalCode(*mData), mData->mPropagateNaN,
+                             Stack, Vars, evalError, context);
+}
+
+/* Runs the fastest of the codes there are: the register code, the threaded
+   code or the bytecode.
+*/
+template<typename Value_t>
+inline Value_t FunctionParserBase<Value_t>::EvalCodeWithStack
+(EvalCode evalCode, bool propagateNaN,
+ Value_t* const Stack, const Value_t* Vars, int& evalError,
+ EvalContext* context)
+{
+    if(propagateNaN)
+    {
+#ifdef FP_SUPPORT_OPTIMIZER
+        if(evalCode.registerCode())
+            return EvalRegisters<false>(evalCode, Stack, Vars, evalError,
+                                        context);
+#endif
+#ifdef FP_SUPPORT_THREADED_EVAL
+        if(evalCode.threadedCode())
+            return EvalThreaded<false>(evalCode, Stack, Vars, evalError,
+                                       context);
+#endif
+        return EvalBySwitch<false>(evalCode, Stack, Vars, evalError, context);
+    }
+
+#ifdef FP_SUPPORT_OPTIMIZER
+    if(evalCode.registerCode())
+        return EvalRegisters<true>(evalCode, Stack, Vars, evalError, context);
+#endif
+#ifdef FP_SUPPORT_THREADED_EVAL
+    if(evalCode.threadedCode())
+        return EvalThreaded<true>(evalCode, Stack, Vars, evalError, context);
+#endif
+    return EvalBySwitch<true>(evalCode, Stack, Vars, evalError, context);
+}
+
+/* The interpreters are compiled twice: with checkDomain true for the
+   normal evaluation, and false for the NaN propagation mode, in which the
+   domain checks don't end the evaluation but only collect the errors into
+   evalErrors (see convertEvalError()), without branching.
+*/
+#define FP_EVAL_ERROR_IF(error, condition) \
+    do { if(checkDomain) \
+         { if(condition) { evalError = error; return Value_t(0); } } \
+         else evalErrors |= int(bool(condition)) << ((error) - 1); \
+    } while(0)
+
+template<typename Value_t>
+template<bool checkDomain>
+Value_t FunctionParserBase<Value_t>::EvalBySwitch
+(EvalCode evalCode, Value_t* const Stack, const Value_t* Vars,
+ int& evalError, EvalContext* context)
+{
+    const unsigned* const byteCode = evalCode.byteCode();
+    const Value_t* const immed = evalCode.immed();
+    const unsigned byteCodeSize = evalCode.byteCodeSize();
+    unsigned IP, DP=0;
+    int SP=-1;
+    int evalErrors = 0;
+
+    //PrintByteCode(std::cout, true);
+
+#define FP_EVAL_OPCODE(opcode) case opcode:
+#define FP_EVAL_NEXT break
+#define FP_EVAL_OPERAND byteCode[++IP]
+#define FP_EVAL_IMMED immed[DP++]
+#define FP_EVAL_SKIP_JUMP IP += 2
+#define FP_EVAL_JUMP \
+    do { const unsigned* buf = &byteCode[IP+1]; IP = buf[0]; DP = buf[1]; } \
+    while(0)
+#define FP_EVAL_VARIABLE_OPCODE default:
+#define FP_EVAL_VARIABLE_INDEX byteCode[IP]-VarBegin
+#define FP_EVAL_FUNCTION(index) evalCode.funcPtrs()[index]
+#define FP_EVAL_PARSER(index) evalCode.funcParsers()[index]
+#define FP_EVAL_PARSERS_AMOUNT evalCode.funcParsersAmount()
+
+    for(IP=0; IP<byteCodeSize; ++IP)
+    {
+        switch(byteCode[IP])
+        {
+#include "extrasrc/fp_eval_opcodes.inc"
+        }
+        //assert(unsigned(SP+1) <= mData->mStackSize);
+        //std::cout << "Stack top: " << SP << "(" << Stack[SP] << ")\n";
+    }
+
+#undef FP_EVAL_PARSERS_AMOUNT
+#undef FP_EVAL_PARSER
+#undef FP_EVAL_FUNCTION
+#undef FP_EVAL_VARIABLE_INDEX
+#undef FP_EVAL_VARIABLE_OPCODE
+#undef FP_EVAL_JUMP
+#undef FP_EVAL_SKIP_JUMP
+#undef FP_EVAL_IMMED
+#undef FP_EVAL_OPERAND
+#undef FP_EVAL_NEXT
+#undef FP_EVAL_OPCODE
+
+    evalError = evalErrors;
+    return Stack[SP];
+}
+
+#ifdef FP_SUPPORT_THREADED_EVAL
+namespace
+{
+    // A pair of opcodes run as one instruction by the threaded interpreter
+    // (see FP_LIST_THREADED_SUPERINSTRUCTIONS in fptypes.hh).
+    struct ThreadedSuperinstruction
+    {
+        unsigned first, second; // VarBegin for any variable
+        const void* label;
+    };
+
+    inline unsigned superinstructionOpcode(unsigned opcode)
+    {
+        return opcode >= VarBegin ? unsigned(VarBegin) : opcode;
+    }
+
+    /* Translates the bytecode into threaded code: the address of the code
+       of each opcode followed by its operands. The immediates are referred
+       to by index and the jumps by their position in the threaded code,
+       minus one as the dispatch increments it. A pair of opcodes listed in
+       'superinstructions' becomes the address of its code followed by the
+       operands of both, unless the second one is the target of a jump.
+       Leaves the threaded code empty (so that the switch interpreter is
+       used) if an opcode has no label or the bytecode doesn't look as
+       expected.
+    */
+    template<typename Data_t>
+    void createThreadedCode(Data_t& data, const void* const* labels,
+                            const ThreadedSuperinstruction* superinstructions,
+                            unsigned superinstructionsAmount,
+                            const void* variableLabel, const void* endLabel)
+    {
+        typedef typename Data_t::ThreadedCodeWord CodeWord;
+        const std::vector<unsigned>& byteCode = data.mByteCode;
+        const unsigned byteCodeSize = unsigned(byteCode.size());
+        std::vector<CodeWord>& code = data.mThreadedCode;
+        code.clear();
+
+        std::vector<bool> isJumpTarget(byteCodeSize + 1, false);
+        for(unsigned IP = 0; IP < byteCodeSize; ++IP)
+        {
+            switch(byteCode[IP])
+            {
+              case cIf: case cAbsIf: case cJump:
+                  if(IP + 2 < byteCodeSize && byteCode[IP+1] < byteCodeSize)
+                      isJumpTarget[byteCode[IP+1] + 1] = true;
+                  IP += 2;
+                  break;
+              case cFCall: case cPCall: case cFetch: IP += 1; break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov: IP += 2; break;
+#endif
+              default: break;
+            }
+        }
+
+        std::vector<unsigned> position(byteCodeSize + 1, ~0u);
+        std::vector<unsigned> immedIndex(byteCodeSize + 1, 0);
+        std::vector<std::pair<std::size_t, unsigned> > jumps;
+        unsigned DP = 0;
+
+        for(unsigned IP = 0; IP < byteCodeSize; ++IP)
+        {
+            const unsigned opcode = byteCode[IP];
+            position[IP] = unsigned(code.size());
+            immedIndex[IP] = DP;
+
+            CodeWord word;
+            if(IP + 1 < byteCodeSize && !isJumpTarget[IP + 1])
+            {
+                const unsigned first = superinstructionOpcode(opcode);
+                const unsigned second = superinstructionOpcode(byteCode[IP+1]);
+                const ThreadedSuperinstruction* super = superinstructions;
+                const ThreadedSuperinstruction* const superEnd =
+                    superinstructions + superinstructionsAmount;
+                while(super != superEnd &&
+                      (super->first != first || super->second != second))
+                    ++super;
+                if(super != superEnd)
+                {
+                    word.label = super->label;
+                    code.push_back(word);
+                    for(unsigned i = 0; i < 2; ++i)
+                    {
+                        const unsigned pairedOpcode = byteCode[IP + i];
+                        if(pairedOpcode == cImmed)
+                            word.operand = DP++;
+                        else if(pairedOpcode >= VarBegin)
+                            word.operand = pairedOpcode - VarBegin;
+                        else
+                            continue;
+                        code.push_back(word);
+                    }
+                    ++IP;
+                    continue;
+                }
+            }
+
+            word.label = opcode >= VarBegin ? variableLabel : labels[opcode];
+            if(!word.label) { code.clear(); return; }
+            code.push_back(word);
+
+            unsigned operands = 0;
+            switch(opcode)
+            {
+              case cImmed: word.operand = DP++; break;
+              case cIf: case cAbsIf: case cJump:
+                  if(IP + 2 >= byteCodeSize || byteCode[IP+1] + 1 > byteCodeSize)
+                  { code.clear(); return; }
+                  jumps.push_back(std::make_pair(code.size(), IP + 1));
+                  word.operand = 0;
+                  IP += 2;
+                  break;
+              case cFCall: case cPCall: case cFetch: operands = 1; break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov: operands = 2; break;
+#endif
+              default:
+                  if(opcode < VarBegin) continue;
+                  word.operand = opcode - VarBegin;
+            }
+            if(operands == 0)
+                code.push_back(word);
+            for(; operands > 0; --operands)
+            {
+                word.operand = byteCode[++IP];
+                code.push_back(word);
+            }
+        }
+        position[byteCodeSize] = unsigned(code.size());
+        immedIndex[byteCodeSize] = DP;
+
+        CodeWord end;
+        end.label = endLabel;
+        code.push_back(end);
+
+        for(std::size_t i = 0; i < jumps.size(); ++i)
+        {
+            const unsigned* buf = &byteCode[jumps[i].second];
+            const unsigned target = buf[0] + 1;
+            if(position[target] == ~0u || immedIndex[target] != buf[1])
+            { code.clear(); return; }
+            code[jumps[i].first].operand = position[target] - 1;
+        }
+    }
+}
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+/* The same as EvalBySwitch(), but the code of each opcode jumps directly
+   to the code of the next one, which the processor predicts much better
+   than the single indirect jump of a switch statement. When called with a
+   null stack, creates the threaded code instead of evaluating anything,
+   as only this function can take the addresses of its labels.
+*/
+template<typename Value_t>
+template<bool checkDomain>
+Value_t FunctionParserBase<Value_t>::EvalThreaded
+(EvalCode evalCode, Value_t* const Stack, const Value_t* Vars,
+ int& evalError, EvalContext* context)
+{
+    if(!Stack)
+    {
+        const void* labels[VarBegin] = {};
+#define FP_THREADED_LABEL(opcode) labels[opcode] = &&label_##opcode
+        FP_THREADED_LABEL(cAbs); FP_THREADED_LABEL(cAcos);
+        FP_THREADED_LABEL(cAcosh); FP_THREADED_LABEL(cAsin);
+        FP_THREADED_LABEL(cAsinh); FP_THREADED_LABEL(cAtan);
+        FP_THREADED_LABEL(cAtan2); FP_THREADED_LABEL(cAtanh);
+        FP_THREADED_LABEL(cCbrt); FP_THREADED_LABEL(cCeil);
+        FP_THREADED_LABEL(cCos); FP_THREADED_LABEL(cCosh);
+        FP_THREADED_LABEL(cCot); FP_THREADED_LABEL(cCsc);
+        FP_THREADED_LABEL(cExp); FP_THREADED_LABEL(cExp2);
+        FP_THREADED_LABEL(cFloor); FP_THREADED_LABEL(cHypot);
+        FP_THREADED_LABEL(cIf); FP_THREADED_LABEL(cInt);
+        FP_THREADED_LABEL(cLog); FP_THREADED_LABEL(cLog10);
+        FP_THREADED_LABEL(cLog2); FP_THREADED_LABEL(cMax);
+        FP_THREADED_LABEL(cMin); FP_THREADED_LABEL(cPow);
+        FP_THREADED_LABEL(cTrunc); FP_THREADED_LABEL(cSec);
+        FP_THREADED_LABEL(cSin); FP_THREADED_LABEL(cSinh);
+        FP_THREADED_LABEL(cSqrt); FP_THREADED_LABEL(cTan);
+        FP_THREADED_LABEL(cTanh);
+        FP_THREADED_LABEL(cImmed); FP_THREADED_LABEL(cJump);
+        FP_THREADED_LABEL(cNeg); FP_THREADED_LABEL(cAdd);
+        FP_THREADED_LABEL(cSub); FP_THREADED_LABEL(cMul);
+        FP_THREADED_LABEL(cFma); FP_THREADED_LABEL(cFms);
+        FP_THREADED_LABEL(cFmma); FP_THREADED_LABEL(cFmms);
+        FP_THREADED_LABEL(cDiv); FP_THREADED_LABEL(cMod);
+        FP_THREADED_LABEL(cEqual); FP_THREADED_LABEL(cNEqual);
+        FP_THREADED_LABEL(cLess); FP_THREADED_LABEL(cLessOrEq);
+        FP_THREADED_LABEL(cGreater); FP_THREADED_LABEL(cGreaterOrEq);
+        FP_THREADED_LABEL(cNot); FP_THREADED_LABEL(cNotNot);
+        FP_THREADED_LABEL(cAnd); FP_THREADED_LABEL(cOr);
+        FP_THREADED_LABEL(cDeg); FP_THREADED_LABEL(cRad);
+        FP_THREADED_LABEL(cFCall); FP_THREADED_LABEL(cPCall);
+        FP_THREADED_LABEL(cFetch);
+#ifdef FP_SUPPORT_OPTIMIZER
+        FP_THREADED_LABEL(cPopNMov); FP_THREADED_LABEL(cLog2by);
+        FP_THREADED_LABEL(cNop);
+#endif
+        FP_THREADED_LABEL(cSinCos); FP_THREADED_LABEL(cSinhCosh);
+        FP_THREADED_LABEL(cAbsNot); FP_THREADED_LABEL(cAbsNotNot);
+        FP_THREADED_LABEL(cAbsAnd); FP_THREADED_LABEL(cAbsOr);
+        FP_THREADED_LABEL(cAbsIf);
+        FP_THREADED_LABEL(cDup); FP_THREADED_LABEL(cInv);
+        FP_THREADED_LABEL(cSqr); FP_THREADED_LABEL(cRDiv);
+        FP_THREADED_LABEL(cRSub); FP_THREADED_LABEL(cRSqrt);
+#ifdef FP_SUPPORT_COMPLEX_NUMBERS
+        FP_THREADED_LABEL(cReal); FP_THREADED_LABEL(cImag);
+        FP_THREADED_LABEL(cArg); FP_THREADED_LABEL(cConj);
+        FP_THREADED_LABEL(cPolar);
+#endif
+#undef FP_THREADED_LABEL
+        const ThreadedSuperinstruction superinstructions[] =
+        {
+#define o(name, first, second) { first, second, &&label_##name },
+            FP_LIST_THREADED_SUPERINSTRUCTIONS(o)
+#undef o
+        };
+        createThreadedCode(*evalCode.mData, labels, superinstructions,
+                           unsigned(sizeof(superinstructions) /
+                                    sizeof(superinstructions[0])),
+                           &&label_variable, &&label_end);
+        return Value_t(0);
+    }
+
+    const typename Data::ThreadedCodeWord* const code =
+        evalCode.threadedCode();
+    const Value_t* const immed = evalCode.immed();
+    unsigned IP = 0;
+    int SP=-1;
+    int evalErrors = 0;
+
+#define FP_EVAL_OPCODE(opcode) label_##opcode:
+#define FP_EVAL_NEXT goto *code[++IP].label
+#define FP_EVAL_OPERAND code[++IP].operand
+#define FP_EVAL_IMMED immed[code[++IP].operand]
+#define FP_EVAL_SKIP_JUMP ++IP
+#define FP_EVAL_JUMP IP = code[IP+1].operand
+#define FP_EVAL_VARIABLE_OPCODE label_variable:
+#define FP_EVAL_VARIABLE_INDEX code[++IP].operand
+#define FP_EVAL_FUNCTION(index) evalCode.funcPtrs()[index]
+#define FP_EVAL_PARSER(index) evalCode.funcParsers()[index]
+#define FP_EVAL_PARSERS_AMOUNT evalCode.funcParsersAmount()
+
+    goto *code[0].label;
+
+#include "extrasrc/fp_eval_opcodes.inc"
+
+// Superinstructions:
+  label_variableVariable:
+    Stack[SP+1] = Vars[FP_EVAL_OPERAND];
+    Stack[SP+2] = Vars[FP_EVAL_OPERAND];
+    SP += 2;
+    FP_EVAL_NEXT;
+  label_variableImmed:
+    Stack[SP+1] = Vars[FP_EVAL_OPERAND];
+    Stack[SP+2] = FP_EVAL_IMMED;
+    SP += 2;
+    FP_EVAL_NEXT;
+  label_immedAdd: Stack[SP] += FP_EVAL_IMMED; FP_EVAL_NEXT;
+  label_immedMul: Stack[SP] *= FP_EVAL_IMMED; FP_EVAL_NEXT;
+
+#undef FP_EVAL_PARSERS_AMOUNT
+#undef FP_EVAL_PARSER
+#undef FP_EVAL_FUNCTION
+#undef FP_EVAL_VARIABLE_INDEX
+#undef FP_EVAL_VARIABLE_OPCODE
+#undef FP_EVAL_JUMP
+#undef FP_EVAL_SKIP_JUMP
+#undef FP_EVAL_IMMED
+#undef FP_EVAL_OPERAND
+#undef FP_EVAL_NEXT
+#undef FP_EVAL_OPCODE
+
+  label_end:
+    evalError = evalErrors;
+    return Stack[SP];
+}
+
+#pragma GCC diagnostic pop
+#endif
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::CreateThreadedCode()
+{
+#ifdef FP_SUPPORT_THREADED_EVAL
+    // The labels of the interpreter of the evaluation mode are used
+    int unused;
+    if(mData->mPropagateNaN)
+        EvalThreaded<false>(EvalCode(*mData), 0, 0, unused, 0);
+    else
+        EvalThreaded<true>(EvalCode(*mData), 0, 0, unused, 0);
+#ifdef FP_SUPPORT_OPTIMIZER
+    if(!mData->mRegisterCode.empty())
+    {
+        if(mData->mPropagateNaN)
+            EvalRegisters<false>(EvalCode(*mData), 0, 0, unused, 0);
+        else
+            EvalRegisters<true>(EvalCode(*mData), 0, 0, unused, 0);
+    }
+#endif
+#endif
+}
+
+#ifdef FP_SUPPORT_OPTIMIZER
+#ifdef FP_SUPPORT_THREADED_EVAL
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+/* Runs the register code made by Optimize(). The registers are kept in
+   'R': the immediates first, then the variables, then the temporaries and
+   the arguments of function calls. Every instruction reads all of its
+   operands before writing its result, because the register allocator may
+   give the result the same register as one of the operands.
+
+   With FP_SUPPORT_THREADED_EVAL the instructions are dispatched like in
+   EvalThreaded(), and calling this with null registers creates the
+   addresses of the code of each instruction.
+*/
+template<typename Value_t>
+template<bool checkDomain>
+Value_t FunctionParserBase<Value_t>::EvalRegisters
+(EvalCode evalCode, Value_t* const R, const Value_t* Vars,
+ int& evalError, EvalContext* context)
+{
+    const RegisterInstruction* const code = evalCode.registerCode();
+    const unsigned codeSize = evalCode.registerCodeSize();
+
+#ifdef FP_SUPPORT_THREADED_EVAL
+    if(!R)
+    {
+        const void* labels[VarBegin] = {};
+#define FP_THREADED_LABEL(opcode) labels[opcode] = &&label_##opcode
+        FP_THREADED_LABEL(cAbs); FP_THREADED_LABEL(cAcos);
+        FP_THREADED_LABEL(cAcosh); FP_THREADED_LABEL(cAsin);
+        FP_THREADED_LABEL(cAsinh); FP_THREADED_LABEL(cAtan);
+        FP_THREADED_LABEL(cAtan2); FP_THREADED_LABEL(cAtanh);
+        FP_THREADED_LABEL(cCbrt); FP_THREADED_LABEL(cCeil);
+        FP_THREADED_LABEL(cCos); FP_THREADED_LABEL(cCosh);
+        FP_THREADED_LABEL(cCot); FP_THREADED_LABEL(cCsc);
+        FP_THREADED_LABEL(cExp); FP_THREADED_LABEL(cExp2);
+        FP_THREADED_LABEL(cFloor); FP_THREADED_LABEL(cHypot);
+        FP_THREADED_LABEL(cInt); FP_THREADED_LABEL(cLog);
+        FP_THREADED_LABEL(cLog10); FP_THREADED_LABEL(cLog2);
+        FP_THREADED_LABEL(cMax); FP_THREADED_LABEL(cMin);
+        FP_THREADED_LABEL(cPow); FP_THREADED_LABEL(cTrunc);
+        FP_THREADED_LABEL(cSec); FP_THREADED_LABEL(cSin);
+        FP_THREADED_LABEL(cSinh); FP_THREADED_LABEL(cSqrt);
+        FP_THREADED_LABEL(cTan); FP_THREADED_LABEL(cTanh);
+        FP_THREADED_LABEL(cIf); FP_THREADED_LABEL(cAbsIf);
+        FP_THREADED_LABEL(cJump); FP_THREADED_LABEL(cNeg);
+        FP_THREADED_LABEL(cAdd); FP_THREADED_LABEL(cSub);
+        FP_THREADED_LABEL(cMul); FP_THREADED_LABEL(cFma);
+        FP_THREADED_LABEL(cFms); FP_THREADED_LABEL(cFmma);
+        FP_THREADED_LABEL(cFmms); FP_THREADED_LABEL(cDiv);
+        FP_THREADED_LABEL(cMod); FP_THREADED_LABEL(cEqual);
+        FP_THREADED_LABEL(cNEqual); FP_THREADED_LABEL(cLess);
+        FP_THREADED_LABEL(cLessOrEq); FP_THREADED_LABEL(cGreater);
+        FP_THREADED_LABEL(cGreaterOrEq); FP_THREADED_LABEL(cNot);
+        FP_THREADED_LABEL(cNotNot); FP_THREADED_LABEL(cAnd);
+        FP_THREADED_LABEL(cOr); FP_THREADED_LABEL(cDeg);
+        FP_THREADED_LABEL(cRad); FP_THREADED_LABEL(cFCall);
+        FP_THREADED_LABEL(cPCall); FP_THREADED_LABEL(cLog2by);
+        FP_THREADED_LABEL(cSinCos); FP_THREADED_LABEL(cSinhCosh);
+        FP_THREADED_LABEL(cAbsNot); FP_THREADED_LABEL(cAbsNotNot);
+        FP_THREADED_LABEL(cAbsAnd); FP_THREADED_LABEL(cAbsOr);
+        FP_THREADED_LABEL(cDup); FP_THREADED_LABEL(cInv);
+        FP_THREADED_LABEL(cSqr); FP_THREADED_LABEL(cRSqrt);
+#ifdef FP_SUPPORT_COMPLEX_NUMBERS
+        FP_THREADED_LABEL(cReal); FP_THREADED_LABEL(cImag);
+        FP_THREADED_LABEL(cArg); FP_THREADED_LABEL(cConj);
+        FP_THREADED_LABEL(cPolar);
+#endif
+#undef FP_THREADED_LABEL
+        Data& data = *evalCode.mData;
+        std::vector<const void*>& codeLabels = data.mRegisterCodeLabels;
+        codeLabels.clear();
+        for(unsigned i = 0; i < codeSize; ++i)
+        {
+            if(code[i].opcode >= VarBegin || !labels[code[i].opcode])
+            {
+                // Shouldn't happen, but the bytecode still works.
+                data.mRegisterCode.clear();
+                codeLabels.clear();
+                return Value_t(0);
+            }
+            codeLabels.push_back(labels[code[i].opcode]);
+        }
+        codeLabels.push_back(&&label_end);
+        return Value_t(0);
+    }
+#endif
+
+    const unsigned immedAmount = evalCode.immedAmount();
+    const Value_t* const immed = evalCode.immed();
+    for(unsigned i = 0; i < immedAmount; ++i)
+        R[i] = immed[i];
+    const unsigned variablesAmount = evalCode.variablesAmount();
+    for(unsigned i = 0; i < variablesAmount; ++i)
+        R[immedAmount + i] = Vars[i];
+
+    const RegisterInstruction* in = code;
+    int evalErrors = 0;
+
+#define FP_EVAL_FUNCTION(index) evalCode.funcPtrs()[index]
+#define FP_EVAL_PARSER(index) evalCode.funcParsers()[index]
+#define FP_EVAL_PARSERS_AMOUNT evalCode.funcParsersAmount()
+
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const void* const* const codeLabels = evalCode.registerCodeLabels();
+    unsigned IP = 0;
+
+#define FP_REG_OPCODE(opcode) label_##opcode:
+#define FP_REG_NEXT in = code + ++IP; goto *codeLabels[IP]
+
+    goto *codeLabels[0];
+
+#include "extrasrc/fp_register_opcodes.inc"
+
+#undef FP_REG_NEXT
+#undef FP_REG_OPCODE
+
+  label_end:
+#else
+#define FP_REG_OPCODE(opcode) case opcode:
+#define FP_REG_NEXT break
+
+    for(unsigned IP = 0; IP < codeSize; in = code + ++IP)
+    {
+        switch(in->opcode)
+        {
+#include "extrasrc/fp_register_opcodes.inc"
+        }
+    }
+
+#undef FP_REG_NEXT
+#undef FP_REG_OPCODE
+#endif
+
+#undef FP_EVAL_PARSERS_AMOUNT
+#undef FP_EVAL_PARSER
+#undef FP_EVAL_FUNCTION
+
+    evalError = evalErrors;
+    return R[evalCode.registerResult()];
+}
+
+#ifdef FP_SUPPORT_THREADED_EVAL
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+
+//===========================================================================
+// Incremental evaluation
+//===========================================================================
+/* Evaluates like Eval(context, Vars), except that with the register code
+   made by Optimize(), the instructions which don't depend on any of the
+   variables in changedVariables are not run again; their results from the
+   previous evaluations with the same context are used instead. Bit n of
+   changedVariables tells that the variable n has changed since then (the
+   last bit stands for all the variables from the 64th on). The first
+   evaluation with a context, or with one last used for different code,
+   runs everything, and so does every evaluation in the NaN propagation
+   mode, whose errors come from all the instructions.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::EvalIncremental
+(EvalContext& context, const Value_t* Vars,
+ unsigned long long changedVariables) const
+{
+#ifdef FP_SUPPORT_OPTIMIZER
+    if(mData->mParseErrorType == FunctionParserErrorType::no_error
+    && !mData->mIncrementalCode.empty() && !mData->mPropagateNaN)
+    {
+        const std::size_t words = (mData->mIncrementalCode.size() + 63) / 64;
+        if(context.mIncrementalCodeVersion != mData->mIncrementalCodeVersion)
+        {
+            context.mIncrementalCodeVersion = mData->mIncrementalCodeVersion;
+            context.mIncrementalRegisters.assign
+                (mData->mIncrementalRegisterCount, Value_t(0));
+            std::copy(mData->mImmed.begin(), mData->mImmed.end(),
+                      context.mIncrementalRegisters.begin());
+            context.mStaleInstructions.assign(words, ~0ULL);
+        }
+
+        const unsigned long long* sets = &(mData->mIncrementalSets[0]);
+        unsigned long long* const stale = &(context.mStaleInstructions[0]);
+        for(; changedVariables; changedVariables >>= 1, sets += words)
+            if(changedVariables & 1)
+                for(std::size_t w = 0; w < words; ++w)
+                    stale[w] |= sets[w];
+
+        return EvalIncrementalRegisters(context, Vars);
+    }
+#else
+    (void)changedVariables;
+#endif
+    return Eval(context, Vars);
+}
+
+#ifdef FP_SUPPORT_OPTIMIZER
+namespace
+{
+    inline unsigned LowestSetBit(unsigned long long bits)
+    {
+#ifdef __GNUC__
+        return unsigned(__builtin_ctzll(bits));
+#else
+        unsigned bit = 0;
+        for(; !(bits & 1); bits >>= 1) ++bit;
+        return bit;
+#endif
+    }
+}
+
+/* Runs mIncrementalCode in the registers of the context, but only the
+   instructions in its set of stale instructions, that is, the ones whose
+   results in the registers may not be up to date. Each one run is taken
+   out of the set, except for the jumps, which are always run. The
+   instructions of a branch not taken stay in the set, so they are run
+   when the branch is taken again; so do the failed instruction and those
+   after it if evaluation fails.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::EvalIncrementalRegisters
+(EvalContext& incrementalContext, const Value_t* Vars) const
+{
+    EvalContext* const context = &incrementalContext;
+    int& evalError = context->mEvalErrorType;
+    // Not used in the NaN propagation mode (see EvalIncremental())
+    const bool checkDomain = true;
+    int evalErrors = 0;
+    Value_t* const R = &context->mIncrementalRegisters[0];
+
+    const unsigned immedAmount = unsigned(mData->mImmed.size());
+    for(unsigned i = 0; i < mData->mVariablesAmount; ++i)
+        R[immedAmount + i] = Vars[i];
+
+    const RegisterInstruction* const code = &(mData->mIncrementalCode[0]);
+    const unsigned codeSize = unsigned(mData->mIncrementalCode.size());
+    unsigned long long* const stale = &(context->mStaleInstructions[0]);
+
+#define FP_REG_OPCODE(opcode) case opcode:
+#define FP_REG_NEXT break
+#define FP_EVAL_FUNCTION(index) mData->mFuncPtrs[index]
+#define FP_EVAL_PARSER(index) mData->mFuncParsers[index]
+#define FP_EVAL_PARSERS_AMOUNT mData->mFuncParsers.size()
+
+    const unsigned words = (codeSize + 63) / 64;
+    for(unsigned IP = 0; IP < codeSize; ++IP)
+    {
+        // Skip to the next stale instruction
+        unsigned word = IP / 64;
+        unsigned long long bits = stale[word] & (~0ULL << (IP % 64));
+        while(!bits && ++word < words) bits = stale[word];
+        if(!bits) break;
+        IP = word * 64 + LowestSetBit(bits);
+        if(IP >= codeSize) break;
+
+        const RegisterInstruction* const in = code + IP;
+        switch(in->opcode)
+        {
+#include "extrasrc/fp_register_opcodes.inc"
+        }
+
+        if(in->opcode != cIf && in->opcode != cAbsIf && in->opcode != cJump)
+            stale[word] &= ~(1ULL << (IP % 64));
+    }
+
+#undef FP_EVAL_PARSERS_AMOUNT
+#undef FP_EVAL_PARSER
+#undef FP_EVAL_FUNCTION
+#undef FP_REG_NEXT
+#undef FP_REG_OPCODE
+
+    evalError = evalErrors;
+    return R[mData->mIncrementalResult];
+}
+#endif
+
+#undef FP_EVAL_ERROR_IF
+
+
+//===========================================================================
+// Compiled expressions
+//===========================================================================
+#include <new>
+#include <cstdint>
+
+namespace
+{
+    const std::size_t kCacheLineSize = 64;
+
+    inline std::size_t alignedOffset(std::size_t offset, std::size_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+}
+
+/* The header at the beginning of the allocation of a compiled expression.
+   It's followed by the immediates, the functions, the parser functions,
+   the bytecode, the threaded code and the register code with its labels,
+   each aligned as its type requires; mArrays points to them. The allocation
+   itself is made larger by a cache line so that the header can start at
+   a cache line boundary; mAllocation is what was allocated.
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::CompiledExpression::Block
+{
+    std::atomic<unsigned> mReferenceCounter;
+    unsigned char* mAllocation;
+
+    CodeArrays mArrays;
+    unsigned mStackSize;
+    bool mPropagateNaN;
+
+    Block(): mReferenceCounter(1) {}
+};
+
+namespace
+{
+    // Copies the vector to 'start' + 'offset', returning the copy or null
+    template<typename T>
+    const T* copyArray(const std::vector<T>& source, unsigned char* start,
+                       std::size_t offset)
+    {
+        if(source.empty()) return 0;
+        T* const copy = reinterpret_cast<T*>(start + offset);
+        for(std::size_t i = 0; i < source.size(); ++i)
+            new(copy + i) T(source[i]);
+        return copy;
+    }
+
+    template<typename T>
+    std::size_t arrayEnd(std::size_t offset, const std::vector<T>& array)
+    {
+        return offset + array.size() * sizeof(T);
+    }
+}
+
+/* Copies the code of the parser, which is left empty if the parser has no
+   valid function. The threaded code and the register code refer to the
+   code of the interpreters, which is the same for all parsers of the
+   type, so they are copied as they are. The functions defined as other
+   parsers are referred to by pointer, so those parsers must exist as long
+   as the copy is used.
+*/
+template<typename Value_t>
+FunctionParserBase<Value_t>::CompiledExpression::CompiledExpression
+(const FunctionParserBase& parser):
+    mBlock(nullptr)
+{
+    const Data& data = *parser.mData;
+    if(data.mParseErrorType != FunctionParserErrorType::no_error) return;
+
+    const std::size_t immedOffset =
+        alignedOffset(sizeof(Block), alignof(Value_t));
+    const std::size_t funcPtrsOffset =
+        alignedOffset(arrayEnd(immedOffset, data.mImmed),
+                      alignof(typename CodeArrays::FuncWrapperPtrData));
+    const std::size_t funcParsersOffset =
+        alignedOffset(arrayEnd(funcPtrsOffset, data.mFuncPtrs),
+                      alignof(typename CodeArrays::FuncParserPtrData));
+    const std::size_t byteCodeOffset =
+        alignedOffset(arrayEnd(funcParsersOffset, data.mFuncParsers),
+                      alignof(unsigned));
+    std::size_t size = arrayEnd(byteCodeOffset, data.mByteCode);
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const std::size_t threadedCodeOffset =
+        alignedOffset(size, alignof(typename Data::ThreadedCodeWord));
+    size = arrayEnd(threadedCodeOffset, data.mThreadedCode);
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    const std::size_t registerCodeOffset =
+        alignedOffset(size, alignof(RegisterInstruction));
+    size = arrayEnd(registerCodeOffset, data.mRegisterCode);
+#ifdef FP_SUPPORT_THREADED_EVAL
+    const std::size_t registerCodeLabelsOffset =
+        alignedOffset(size, alignof(const void*));
+    size = arrayEnd(registerCodeLabelsOffset, data.mRegisterCodeLabels);
+#endif
+#endif
+
+    unsigned char* const allocation =
+        new unsigned char[size + kCacheLineSize - 1];
+    unsigned char* const start = allocation +
+        (kCacheLineSize - std::uintptr_t(allocation) % kCacheLineSize) %
+        kCacheLineSize;
+
+    Block* const block = new(start) Block;
+    block->mAllocation = allocation;
+    block->mStackSize = data.mStackSize;
+    block->mPropagateNaN = data.mPropagateNaN;
+
+    CodeArrays& code = block->mArrays;
+    code.mImmed = copyArray(data.mImmed, start, immedOffset);
+    code.mFuncPtrs = copyArray(data.mFuncPtrs, start, funcPtrsOffset);
+    code.mFuncParsers = copyArray(data.mFuncParsers, start, funcParsersOffset);
+    code.mByteCode = copyArray(data.mByteCode, start, byteCodeOffset);
+    code.mByteCodeSize = unsigned(data.mByteCode.size());
+    code.mImmedAmount = unsigned(data.mImmed.size());
+    code.mFuncPtrsAmount = unsigned(data.mFuncPtrs.size());
+    code.mFuncParsersAmount = unsigned(data.mFuncParsers.size());
+    code.mVariablesAmount = data.mVariablesAmount;
+#ifdef FP_SUPPORT_THREADED_EVAL
+    code.mThreadedCode =
+        copyArray(data.mThreadedCode, start, threadedCodeOffset);
+#endif
+#ifdef FP_SUPPORT_OPTIMIZER
+    code.mRegisterCode =
+        copyArray(data.mRegisterCode, start, registerCodeOffset);
+    code.mRegisterCodeSize = unsigned(data.mRegisterCode.size());
+    code.mRegisterResult = data.mRegisterResult;
+#ifdef FP_SUPPORT_THREADED_EVAL
+    code.mRegisterCodeLabels =
+        copyArray(data.mRegisterCodeLabels, start, registerCodeLabelsOffset);
+#endif
+#endif
+
+    mBlock = block;
+}
+
+template<typename Value_t>
+FunctionParserBase<Value_t>::CompiledExpression::CompiledExpression
+(const CompiledExpression& rhs):
+    mBlock(rhs.mBlock)
+{
+    if(mBlock) addReference(mBlock->mReferenceCounter);
+}
+
+template<typename Value_t>
+typename FunctionParserBase<Value_t>::CompiledExpression&
+FunctionParserBase<Value_t>::CompiledExpression::operator=
+(const CompiledExpression& rhs)
+{
+    if(mBlock != rhs.mBlock)
+    {
+        if(rhs.mBlock) addReference(rhs.mBlock->mReferenceCounter);
+        ReleaseBlock();
+        mBlock = rhs.mBlock;
+    }
+    return *this;
+}
+
+template<typename Value_t>
+FunctionParserBase<Value_t>::CompiledExpression::~CompiledExpression()
+{
+    ReleaseBlock();
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::CompiledExpression::ReleaseBlock()
+{
+    typedef typename CodeArrays::FuncWrapperPtrData FuncWrapperPtrData;
+    typedef typename CodeArrays::FuncParserPtrData FuncParserPtrData;
+
+    Block* const block = mBlock;
+    mBlock = nullptr;
+    if(!block || !releaseReference(block->mReferenceCounter)) return;
+
+    // The other arrays are of trivial types
+    const CodeArrays& code = block->mArrays;
+    for(unsigned i = 0; i < code.mImmedAmount; ++i)
+        code.mImmed[i].~Value_t();
+    for(unsigned i = 0; i < code.mFuncPtrsAmount; ++i)
+        code.mFuncPtrs[i].~FuncWrapperPtrData();
+    for(unsigned i = 0; i < code.mFuncParsersAmount; ++i)
+        code.mFuncParsers[i].~FuncParserPtrData();
+
+    unsigned char* const allocation = block->mAllocation;
+    block->~Block();
+    delete[] allocation;
+}
+
+/* Like the Eval() of the parser with a context: the register code, the
+   threaded code or the bytecode is run, whichever is the fastest. Only
+   the JIT-compiled code of the parser isn't used, as it belongs to the
+   parser data.
+*/
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::CompiledExpression::Eval
+(EvalContext& context, const Value_t* Vars) const
+{
+    if(!mBlock)
+    {
+        context.mEvalErrorType = 0;
+        return Value_t(0);
+    }
+
+    if(context.mStack.size() < mBlock->mStackSize)
+        context.mStack.resize(mBlock->mStackSize);
+    return EvalCodeWithStack(EvalCode(mBlock->mArrays), mBlock->mPropagateNaN,
+                             &context.mStack[0], Vars,
+                             context.mEvalErrorType, &context);
+}
+
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::CompiledExpression::Eval
+(const Value_t* Vars, int* evalError) const
+{
+    static thread_local EvalContext threadContext;
+    static thread_local bool threadContextInUse = false;
+
+    Value_t result;
+    int error;
+    if(threadContextInUse)
+    {
+        EvalContext context;
+        result = Eval(context, Vars);
+        error = context.mEvalErrorType;
+    }
+    else
+    {
+        const ScratchReservation reservation(threadContextInUse);
+        result = Eval(threadContext, Vars);
+        error = threadContext.mEvalErrorType;
+    }
+    if(evalError) *evalError = error;
+    return result;
+}
+
+
+//===========================================================================
+// Interval evaluation
+//===========================================================================
+namespace
+{
+    /* The rounding of interval bounds. With the IEEE floating point types
+       the bounds are moved outwards after each operation: by one step after
+       the basic operations, which are exactly rounded, and by a few units
+       in the last place after the math library functions, which aren't
+       always. The other types are exact or are used as they are.
+    */
+    template<typename Value_t,
+             bool Rounded = std::numeric_limits<Value_t>::is_iec559>
+    struct IntervalRounding
+    {
+        static Value_t down(const Value_t& x) { return x; }
+        static Value_t up(const Value_t& x) { return x; }
+        static Value_t libraryDown(const Value_t& x) { return x; }
+        static Value_t libraryUp(const Value_t& x) { return x; }
+        static Value_t tolerance() { return Epsilon<Value_t>::defaultValue(); }
+    };
+
+    template<typename Value_t>
+    struct IntervalRounding<Value_t, true>
+    {
+        static Value_t down(const Value_t& x)
+        {
+            return std::nextafter(x, -std::numeric_limits<Value_t>::infinity());
+        }
+        static Value_t up(const Value_t& x)
+        {
+            return std::nextafter(x, std::numeric_limits<Value_t>::infinity());
+        }
+        static Value_t libraryDown(const Value_t& x)
+        {
+            return down(std::isfinite(x) ? x - fp_abs(x) * libraryError() : x);
+        }
+        static Value_t libraryUp(const Value_t& x)
+        {
+            return up(std::isfinite(x) ? x + fp_abs(x) * libraryError() : x);
+        }
+        static Value_t libraryError()
+        {
+            return Value_t(4) * std::numeric_limits<Value_t>::epsilon();
+        }
+        static Value_t tolerance()
+        {
+            return Value_t(64) * std::numeric_limits<Value_t>::epsilon();
+        }
+    };
+
+    // Integral intervals are always bounded
+    template<typename Value_t, bool IsInt = IsIntType<Value_t>::value>
+    struct IntervalInfinity
+    {
+        static Value_t get()
+        {
+            return fp_const_preciseDouble<Value_t>
+                (std::numeric_limits<double>::infinity());
+        }
+    };
+
+    template<typename Value_t>
+    struct IntervalInfinity<Value_t, true>
+    {
+        static Value_t get() { return Value_t(0); }
+    };
+
+    /* Finds the end of the code from IP on which belongs to one branch of
+       an if(), counting its cImmed opcodes into immedIndex. The code ends
+       at 'end' or at a cJump which doesn't belong to an if() within it:
+       the optimizer redirects the jump which ends a then branch to the
+       final target if it pointed to another jump, so an else branch can
+       end at the jump which ends the enclosing then branch.
+    */
+    unsigned skipIfBranch(const unsigned* byteCode, unsigned IP, unsigned end,
+                          unsigned& immedIndex)
+    {
+        while(IP < end)
+        {
+            switch(byteCode[IP])
+            {
+              case cImmed: ++immedIndex; ++IP; break;
+              case cIf: case cAbsIf:
+                  {
+                      const unsigned jumpIP = byteCode[IP+1] - 2;
+                      skipIfBranch(byteCode, IP+3, jumpIP, immedIndex);
+                      IP = skipIfBranch(byteCode, jumpIP+3,
+                                        std::min(byteCode[jumpIP+1]+1, end),
+                                        immedIndex);
+                      break;
+                  }
+              case cJump: return IP;
+              case cFCall: case cPCall: case cFetch: IP += 2; break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov: IP += 3; break;
+#endif
+              default: ++IP; break;
+            }
+        }
+        return IP;
+    }
+
+    // The interval versions of the operations
+    template<typename Value_t>
+    struct IntervalMath
+    {
+        typedef typename FunctionParserBase<Value_t>::Interval Interval;
+        typedef IntervalRounding<Value_t> R;
+
+        static Value_t infinity() { return IntervalInfinity<Value_t>::get(); }
+        static Interval entire() { return Interval(-infinity(), infinity()); }
+
+        static bool isZero(const Interval& x)
+        {
+            return x.lower == Value_t(0) && x.upper == Value_t(0);
+        }
+
+        static bool isInfinite(const Value_t& x)
+        {
+            return std::numeric_limits<Value_t>::has_infinity &&
+                   (x == infinity() || x == -infinity());
+        }
+
+        // A NaN, e.g. an immediate folded from acos(-2.5), fails every test
+        static bool isNaN(const Interval& x)
+        {
+            return !(x.lower == x.lower) || !(x.upper == x.upper);
+        }
+
+        static Interval hull(const Interval& x, const Interval& y)
+        {
+            return Interval(fp_min(x.lower, y.lower), fp_max(x.upper, y.upper));
+        }
+
+        static Interval clamp(const Interval& x,
+                              const Value_t& min, const Value_t& max)
+        {
+            return Interval(fp_max(x.lower, min), fp_min(x.upper, max));
+        }
+
+        // Given the values of a math library function at the bounds
+        static Interval library(const Value_t& lower, const Value_t& upper)
+        {
+            return Interval(R::libraryDown(lower), R::libraryUp(upper));
+        }
+
+        // The results with a zero operand are exact
+        static Value_t sumDown(const Value_t& x, const Value_t& y)
+        {
+            return x == Value_t(0) ? y : y == Value_t(0) ? x : R::down(x + y);
+        }
+        static Value_t sumUp(const Value_t& x, const Value_t& y)
+        {
+            return x == Value_t(0) ? y : y == Value_t(0) ? x : R::up(x + y);
+        }
+        // ...and zero times infinity is zero
+        static Value_t productDown(const Value_t& x, const Value_t& y)
+        {
+            return x == Value_t(0) || y == Value_t(0) ?
+                Value_t(0) : R::down(x * y);
+        }
+        static Value_t productUp(const Value_t& x, const Value_t& y)
+        {
+            return x == Value_t(0) || y == Value_t(0) ?
+                Value_t(0) : R::up(x * y);
+        }
+        // ...and so is a finite number over infinity, while infinity over
+        // infinity can be any quotient of that sign
+        static Value_t quotientDown(const Value_t& x, const Value_t& y)
+        {
+            if(x == Value_t(0)) return Value_t(0);
+            if(isInfinite(y))
+                return isInfinite(x) && (x < Value_t(0)) != (y < Value_t(0)) ?
+                    -infinity() : Value_t(0);
+            return R::down(x / y);
+        }
+        static Value_t quotientUp(const Value_t& x, const Value_t& y)
+        {
+            if(x == Value_t(0)) return Value_t(0);
+            if(isInfinite(y))
+                return isInfinite(x) && (x < Value_t(0)) == (y < Value_t(0)) ?
+                    infinity() : Value_t(0);
+            return R::up(x / y);
+        }
+
+        static Interval neg(const Interval& x)
+        {
+            return Interval(-x.upper, -x.lower);
+        }
+
+        static Interval add(const Interval& x, const Interval& y)
+        {
+            return Interval(sumDown(x.lower, y.lower), sumUp(x.upper, y.upper));
+        }
+
+        static Interval sub(const Interval& x, const Interval& y)
+        {
+            return add(x, neg(y));
+        }
+
+        static Interval mul(const Interval& x, const Interval& y)
+        {
+            return Interval
+                (fp_min(fp_min(productDown(x.lower, y.lower),
+                               productDown(x.lower, y.upper)),
+                        fp_min(productDown(x.upper, y.lower),
+                               productDown(x.upper, y.upper))),
+                 fp_max(fp_max(productUp(x.lower, y.lower),
+                               productUp(x.lower, y.upper)),
+                        fp_max(productUp(x.upper, y.lower),
+                               productUp(x.upper, y.upper))));
+        }
+
+        static Interval abs(const Interval& x)
+        {
+            if(!(x.lower < Value_t(0))) return x;
+            if(!(x.upper > Value_t(0))) return neg(x);
+            return Interval(Value_t(0), fp_max(-x.lower, x.upper));
+        }
+
+        static Interval sqr(const Interval& x)
+        {
+            const Interval a = abs(x);
+            return Interval(fp_max(productDown(a.lower, a.lower), Value_t(0)),
+                            productUp(a.upper, a.upper));
+        }
+
+        // x/y where y doesn't contain zero
+        static Interval divNonZero(const Interval& x, const Interval& y)
+        {
+            return Interval
+                (fp_min(fp_min(quotientDown(x.lower, y.lower),
+                               quotientDown(x.lower, y.upper)),
+                        fp_min(quotientDown(x.upper, y.lower),
+                               quotientDown(x.upper, y.upper))),
+                 fp_max(fp_max(quotientUp(x.lower, y.lower),
+                               quotientUp(x.lower, y.upper)),
+                        fp_max(quotientUp(x.upper, y.lower),
+                               quotientUp(x.upper, y.upper))));
+        }
+
+        // x/y where y isn't only zero
+        static Interval div(const Interval& x, const Interval& y)
+        {
+            if(y.lower > Value_t(0) || y.upper < Value_t(0))
+                return divNonZero(x, y);
+            if(IsIntType<Value_t>::value)
+            {
+                // An integral divisor is at least 1 in magnitude
+                if(!(y.lower < Value_t(0)))
+                    return divNonZero(x, Interval(Value_t(1), y.upper));
+                if(!(y.upper > Value_t(0)))
+                    return divNonZero(x, Interval(y.lower, Value_t(-1)));
+                return hull(divNonZero(x, Interval(y.lower, Value_t(-1))),
+                            divNonZero(x, Interval(Value_t(1), y.upper)));
+            }
+            if(isZero(x)) return x;
+            if(y.lower == Value_t(0))
+            {
+                if(!(x.lower < Value_t(0)))
+                    return Interval(quotientDown(x.lower, y.upper), infinity());
+                if(!(x.upper > Value_t(0)))
+                    return Interval(-infinity(), quotientUp(x.upper, y.upper));
+            }
+            else if(y.upper == Value_t(0))
+            {
+                if(!(x.lower < Value_t(0)))
+                    return Interval(-infinity(), quotientUp(x.lower, y.lower));
+                if(!(x.upper > Value_t(0)))
+                    return Interval(quotientDown(x.upper, y.lower), infinity());
+            }
+            return entire();
+        }
+
+        // The remainder has the sign of x and is smaller than x and y
+        static Interval mod(const Interval& x, const Interval& y)
+        {
+            if(y.lower == y.upper &&
+               (!(x.lower < Value_t(0)) || !(x.upper > Value_t(0))) &&
+               sumUp(x.upper, -x.lower) < fp_abs(y.lower))
+            {
+                // Exact, unless x contains a multiple of y
+                const Value_t lower = fp_mod(x.lower, y.lower);
+                const Value_t upper = fp_mod(x.upper, y.lower);
+                if(!(upper < lower)) return Interval(lower, upper);
+            }
+            const Value_t max = fp_max(fp_abs(y.lower), fp_abs(y.upper));
+            return Interval
+                (x.lower < Value_t(0) ? fp_max(x.lower, -max) : Value_t(0),
+                 x.upper > Value_t(0) ? fp_min(x.upper, max) : Value_t(0));
+        }
+
+        static Interval sqrt(const Interval& x)
+        {
+            return Interval(x.lower > Value_t(0) ?
+                            R::down(fp_sqrt(x.lower)) : Value_t(0),
+                            R::up(fp_sqrt(x.upper)));
+        }
+
+        static Interval exp(const Interval& x)
+        {
+            return clamp(library(fp_exp(x.lower), fp_exp(x.upper)),
+                         Value_t(0), infinity());
+        }
+
+        static Interval log(const Interval& x)
+        {
+            return library(x.lower > Value_t(0) ?
+                           fp_log(x.lower) : -infinity(), fp_log(x.upper));
+        }
+
+        // x^n, with the bounds of the odd powers and the even powers of |x|
+        static Interval powi(const Interval& x, unsigned long n)
+        {
+            if(n % 2 == 0)
+            {
+                const Interval a = abs(x);
+                return Interval(powi(a.lower, n).lower, powi(a.upper, n).upper);
+            }
+            return Interval(powi(x.lower, n).lower, powi(x.upper, n).upper);
+        }
+
+        static Interval powi(const Value_t& x, unsigned long n)
+        {
+            Interval result(Value_t(1)), power(x);
+            while(n)
+            {
+                if(n & 1) result = mul(result, power);
+                n >>= 1;
+                if(n) power = n % 2 ? mul(power, power) : sqr(power);
+            }
+            return result;
+        }
+
+        /* x^y like fp_pow(): for a negative x and an exponent which isn't
+           an integer, it's -(|x|^y). Returns false if there's no x and y
+           for which it's defined, or if either of them is a NaN, which
+           would look like it contained zero.
+        */
+        static bool pow(const Interval& x, const Interval& y, Interval& result)
+        {
+            if(isNaN(x) || isNaN(y)) return false;
+            if(y.lower == y.upper && isLongInteger(y.lower))
+            {
+                const long n = makeLongInteger(y.lower);
+                if(n >= 0)
+                    result = powi(x, (unsigned long)n);
+                else if(isZero(x))
+                    return false;
+                else
+                    result = div(Interval(Value_t(1)),
+                                 powi(x, (unsigned long)-n));
+                return true;
+            }
+
+            bool defined = false;
+            const auto include = [&](const Interval& part)
+            {
+                result = defined ? hull(result, part) : part;
+                defined = true;
+            };
+            // The limits at zero come from these, as the log of 0 is -inf
+            if(x.upper > Value_t(0))
+                include(exp(mul(y, log(Interval(fp_max(x.lower, Value_t(0)),
+                                                x.upper)))));
+            if(x.lower < Value_t(0))
+            {
+                const Interval magnitude =
+                    exp(mul(y, log(Interval(fp_max(-x.upper, Value_t(0)),
+                                            -x.lower))));
+                include(neg(magnitude));
+                // The even integers give positive values
+                if(!(fp_floor(y.upper / Value_t(2)) * Value_t(2) < y.lower))
+                    include(magnitude);
+            }
+            if(!(x.lower > Value_t(0)) && !(x.upper < Value_t(0)))
+            {
+                if(y.upper > Value_t(0)) include(Interval(Value_t(0)));
+                if(!(y.lower > Value_t(0)) && !(y.upper < Value_t(0)))
+                    include(Interval(Value_t(1)));
+            }
+            return defined;
+        }
+
+        /* Whether offset + k*period is in x for some integer k. When the
+           rounding makes it unclear, the answer is yes.
+        */
+        static bool containsPeriodic(const Interval& x, const Value_t& offset,
+                                     const Value_t& period)
+        {
+            const Value_t tolerance =
+                R::tolerance() * (fp_abs(x.lower) + fp_abs(x.upper) + period);
+            const Value_t point =
+                offset + fp_ceil((x.lower - offset) / period) * period;
+            return point - period >= x.lower - tolerance ||
+                   point <= x.upper + tolerance;
+        }
+
+        // sin(x + phase), which is cos(x) with a phase of pi/2
+        static Interval sin(const Interval& x, bool cosine)
+        {
+            const Value_t pi = fp_const_pi<Value_t>();
+            const Value_t twoPi = pi * Value_t(2);
+            if(!(x.upper - x.lower < twoPi))
+                return Interval(Value_t(-1), Value_t(1));
+            const Value_t value1 = cosine ? fp_cos(x.lower) : fp_sin(x.lower);
+            const Value_t value2 = cosine ? fp_cos(x.upper) : fp_sin(x.upper);
+            Interval result =
+                library(fp_min(value1, value2), fp_max(value1, value2));
+            const Value_t maximum = cosine ? Value_t(0) : pi / Value_t(2);
+            if(containsPeriodic(x, maximum, twoPi))
+                result.upper = Value_t(1);
+            if(containsPeriodic(x, maximum - pi, twoPi))
+                result.lower = Value_t(-1);
+            return clamp(result, Value_t(-1), Value_t(1));
+        }
+
+        static Interval tan(const Interval& x)
+        {
+            const Value_t pi = fp_const_pi<Value_t>();
+            if(!(x.upper - x.lower < pi) ||
+               containsPeriodic(x, pi / Value_t(2), pi))
+                return entire();
+            return library(fp_tan(x.lower), fp_tan(x.upper));
+        }
+
+        static Interval cosh(const Interval& x)
+        {
+            const Interval a = abs(x);
+            return clamp(library(fp_cosh(a.lower), fp_cosh(a.upper)),
+                         Value_t(1), infinity());
+        }
+
+        // Within a half plane atan2() is monotonic in both parameters
+        static Interval atan2(const Interval& y, const Interval& x)
+        {
+            const Value_t pi = fp_const_pi<Value_t>();
+            if(!(x.lower > Value_t(0) || y.lower > Value_t(0) ||
+                 y.upper < Value_t(0)))
+                return library(-pi, pi);
+            const Value_t a1 = fp_atan2(y.lower, x.lower);
+            const Value_t a2 = fp_atan2(y.lower, x.upper);
+            const Value_t a3 = fp_atan2(y.upper, x.lower);
+            const Value_t a4 = fp_atan2(y.upper, x.upper);
+            return library(fp_min(fp_min(a1, a2), fp_min(a3, a4)),
+                           fp_max(fp_max(a1, a2), fp_max(a3, a4)));
+        }
+
+        static Interval hypot(const Interval& x, const Interval& y)
+        {
+            const Interval a = abs(x), b = abs(y);
+            return clamp(library(fp_hypot(a.lower, b.lower),
+                                 fp_hypot(a.upper, b.upper)),
+                         Value_t(0), infinity());
+        }
+
+        // The truth values: [0,0] is false, [1,1] true and [0,1] either
+        static Interval truthValue(bool canBeFalse, bool canBeTrue)
+        {
+            return Interval(canBeFalse ? Value_t(0) : Value_t(1),
+                            canBeTrue ? Value_t(1) : Value_t(0));
+        }
+
+        static Interval truth(const Interval& x)
+        {
+            const bool alwaysTrue =
+                (x.lower > Value_t(0) && fp_truth(x.lower)) ||
+                (x.upper < Value_t(0) && fp_truth(x.upper));
+            const bool neverTrue = !fp_truth(x.lower) && !fp_truth(x.upper);
+            return truthValue(!alwaysTrue, !neverTrue);
+        }
+
+        static Interval absTruth(const Interval& x)
+        {
+            return truthValue(!fp_absTruth(x.lower), fp_absTruth(x.upper));
+        }
+
+        static Interval logicalNot(const Interval& truthValue)
+        {
+            return Interval(Value_t(1) - truthValue.upper,
+                            Value_t(1) - truthValue.lower);
+        }
+
+        static Interval logicalAnd(const Interval& x, const Interval& y)
+        {
+            return Interval(fp_min(x.lower, y.lower), fp_min(x.upper, y.upper));
+        }
+
+        static Interval logicalOr(const Interval& x, const Interval& y)
+        {
+            return Interval(fp_max(x.lower, y.lower), fp_max(x.upper, y.upper));
+        }
+
+        // The comparisons are monotonic in both values
+        static Interval less(const Interval& x, const Interval& y)
+        {
+            return truthValue(!fp_less(x.upper, y.lower),
+                              fp_less(x.lower, y.upper));
+        }
+
+        static Interval lessOrEq(const Interval& x, const Interval& y)
+        {
+            return truthValue(!fp_lessOrEq(x.upper, y.lower),
+                              fp_lessOrEq(x.lower, y.upper));
+        }
+
+        // fp_equal() compares the difference, which is monotonic in both
+        static Interval equal(const Interval& x, const Interval& y)
+        {
+            const bool alwaysEqual =
+                fp_equal(x.upper, y.lower) && fp_equal(x.lower, y.upper);
+            const bool neverEqual =
+                (x.upper < y.lower && fp_nequal(x.upper, y.lower)) ||
+                (y.upper < x.lower && fp_nequal(x.lower, y.upper));
+            return truthValue(!alwaysEqual, !neverEqual);
+        }
+    };
+}
+
+/* The stack of EvalInterval(): the variables followed by the evaluation
+   stack, on top of which the functions defined as other parsers are
+   evaluated. Each thread keeps one and reuses it.
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::IntervalStack
+{
+    std::vector<Interval> mStack;
+    std::vector<Value_t> mParams; // for calling C++ functions
+    bool mInUse = false;
+};
+
+/* Evaluates the function over all the values of the variables within the
+   given intervals at once. The result contains the value of the function
+   for all of them at which it can be evaluated; if there are none, the
+   error code tells why, like with Eval(). The intervals of if() conditions
+   which can be either true or false give the hull of both branches.
+   Functions added with AddFunction() as C++ functions can only be called
+   with parameters which are single values; otherwise the error is 6. The
+   error is 6 also with the floating point types if the library is compiled
+   without infinities (-ffinite-math-only).
+*/
+template<typename Value_t>
+typename FunctionParserBase<Value_t>::Interval
+FunctionParserBase<Value_t>::EvalInterval(const Interval* Vars)
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+        return Interval();
+    if(IsComplexType<Value_t>::value)
+    {
+        mEvalErrorType = 6;
+        return Interval();
+    }
+#ifdef FP_FINITE_MATH_ONLY
+    if(std::numeric_limits<Value_t>::is_iec559)
+    {
+        mEvalErrorType = 6;
+        return Interval();
+    }
+#endif
+
+    // A C++ function called by this one may need a stack of its own
+    static thread_local IntervalStack threadStack;
+    IntervalStack localStack;
+    IntervalStack& intervals = threadStack.mInUse ? localStack : threadStack;
+    const ScratchReservation reservation(intervals.mInUse);
+
+    const unsigned variablesAmount = mData->mVariablesAmount;
+    if(intervals.mStack.size() < variablesAmount)
+        intervals.mStack.resize(variablesAmount);
+    std::copy(Vars, Vars + variablesAmount, intervals.mStack.begin());
+
+    mEvalErrorType = EvalIntervalCode(intervals, 0, variablesAmount);
+    if(mEvalErrorType) return Interval();
+    return intervals.mStack[variablesAmount];
+}
+
+/* Evaluates the bytecode over the intervals of the stack starting from
+   varBase, using the stack from stackBase on, and leaves the result at
+   stackBase. Returns the error code.
+*/
+template<typename Value_t>
+int FunctionParserBase<Value_t>::EvalIntervalCode
+(IntervalStack& intervals, unsigned varBase, unsigned stackBase) const
+{
+    if(intervals.mStack.size() < stackBase + mData->mStackSize + 1)
+        intervals.mStack.resize(stackBase + mData->mStackSize + 1);
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+    {
+        intervals.mStack[stackBase] = Interval();
+        return 0;
+    }
+
+    unsigned DP = 0;
+    int SP = -1;
+    const int evalError = EvalIntervalRange
+        (intervals, varBase, stackBase,
+         0, unsigned(mData->mByteCode.size()), DP, SP);
+    if(!evalError)
+        intervals.mStack[stackBase] = intervals.mStack[stackBase + SP];
+    return evalError;
+}
+
+/* Evaluates the bytecode from IP to endIP. An if() whose condition can be
+   either true or false evaluates both of its branches; a branch which
+   can't be evaluated at all is left out.
+*/
+template<typename Value_t>
+int FunctionParserBase<Value_t>::EvalIntervalRange
+(IntervalStack& intervals, unsigned varBase, unsigned stackBase,
+ unsigned IP, unsigned endIP, unsigned& DP, int& SP) const
+{
+    typedef IntervalMath<Value_t> IM;
+
+    const unsigned* const byteCode = &(mData->mByteCode[0]);
+    const Value_t* const immed = mData->mImmed.empty() ? 0 : &(mData->mImmed[0]);
+    const unsigned byteCodeSize = unsigned(mData->mByteCode.size());
+    const Interval* Vars = &intervals.mStack[varBase];
+    Interval* Stack = &intervals.mStack[stackBase];
+
+    for(; IP < endIP; ++IP)
+    {
+        switch(byteCode[IP])
+        {
+// Functions:
+          case cAbs: Stack[SP] = IM::abs(Stack[SP]); break;
+
+          case cAcos:
+              if(Stack[SP].upper < Value_t(-1) || Stack[SP].lower > Value_t(1))
+                  return 4;
+              {
+                  const Interval x =
+                      IM::clamp(Stack[SP], Value_t(-1), Value_t(1));
+                  Stack[SP] = IM::library(fp_acos(x.upper), fp_acos(x.lower));
+                  break;
+              }
+
+          case cAcosh:
+              if(Stack[SP].upper < Value_t(1)) return 4;
+              Stack[SP] = IM::library
+                  (fp_acosh(fp_max(Stack[SP].lower, Value_t(1))),
+                   fp_acosh(Stack[SP].upper));
+              break;
+
+          case cAsin:
+              if(Stack[SP].upper < Value_t(-1) || Stack[SP].lower > Value_t(1))
+                  return 4;
+              {
+                  const Interval x =
+                      IM::clamp(Stack[SP], Value_t(-1), Value_t(1));
+                  Stack[SP] = IM::library(fp_asin(x.lower), fp_asin(x.upper));
+                  break;
+              }
+
+          case cAsinh:
+              Stack[SP] = IM::library(fp_asinh(Stack[SP].lower),
+                                      fp_asinh(Stack[SP].upper));
+              break;
+
+          case cAtan:
+              Stack[SP] = IM::library(fp_atan(Stack[SP].lower),
+                                      fp_atan(Stack[SP].upper));
+              break;
+
+          case cAtan2:
+              Stack[SP-1] = IM::atan2(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cAtanh:
+              if(!(Stack[SP].upper > Value_t(-1)) ||
+                 !(Stack[SP].lower < Value_t(1)))
+                  return 4;
+              Stack[SP] = IM::library
+                  (Stack[SP].lower > Value_t(-1) ?
+                   fp_atanh(Stack[SP].lower) : -IM::infinity(),
+                   Stack[SP].upper < Value_t(1) ?
+                   fp_atanh(Stack[SP].upper) : IM::infinity());
+              break;
+
+          case cCbrt:
+              Stack[SP] = IM::library(fp_cbrt(Stack[SP].lower),
+                                      fp_cbrt(Stack[SP].upper));
+              break;
+
+          case cCeil:
+              Stack[SP] = Interval(fp_ceil(Stack[SP].lower),
+                                   fp_ceil(Stack[SP].upper));
+              break;
+
+          case cCos: Stack[SP] = IM::sin(Stack[SP], true); break;
+
+          case cCosh: Stack[SP] = IM::cosh(Stack[SP]); break;
+
+          case cCot:
+              Stack[SP] = IM::div(Interval(Value_t(1)), IM::tan(Stack[SP]));
+              break;
+
+          case cCsc:
+              Stack[SP] = IM::div(Interval(Value_t(1)),
+                                  IM::sin(Stack[SP], false));
+              break;
+
+          case cExp: Stack[SP] = IM::exp(Stack[SP]); break;
+
+          case cExp2:
+              Stack[SP] = IM::clamp(IM::library(fp_exp2(Stack[SP].lower),
+                                                fp_exp2(Stack[SP].upper)),
+                                    Value_t(0), IM::infinity());
+              break;
+
+          case cFloor:
+              Stack[SP] = Interval(fp_floor(Stack[SP].lower),
+                                   fp_floor(Stack[SP].upper));
+              break;
+
+          case cHypot:
+              Stack[SP-1] = IM::hypot(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cIf: case cAbsIf:
+              {
+                  const Interval condition = byteCode[IP] == cIf ?
+                      IM::truth(Stack[SP]) : IM::absTruth(Stack[SP]);
+                  --SP;
+                  const unsigned jumpIP = byteCode[IP+1] - 2;
+                  unsigned endDP = byteCode[IP+2];
+                  const unsigned elseEnd =
+                      skipIfBranch(byteCode, jumpIP+3,
+                                   std::min(byteCode[jumpIP+1]+1, byteCodeSize),
+                                   endDP);
+
+                  if(condition.lower == Value_t(1))
+                  {
+                      if(const int evalError = EvalIntervalRange
+                         (intervals, varBase, stackBase, IP+3, jumpIP, DP, SP))
+                          return evalError;
+                  }
+                  else if(condition.upper == Value_t(0))
+                  {
+                      DP = byteCode[IP+2];
+                      if(const int evalError = EvalIntervalRange
+                         (intervals, varBase, stackBase,
+                          jumpIP+3, elseEnd, DP, SP))
+                          return evalError;
+                  }
+                  else
+                  {
+                      int thenSP = SP, elseSP = SP;
+                      unsigned elseDP = byteCode[IP+2];
+                      const int thenError = EvalIntervalRange
+                          (intervals, varBase, stackBase,
+                           IP+3, jumpIP, DP, thenSP);
+                      const Interval thenResult =
+                          intervals.mStack[stackBase + SP + 1];
+                      const int elseError = EvalIntervalRange
+                          (intervals, varBase, stackBase,
+                           jumpIP+3, elseEnd, elseDP, elseSP);
+                      if(thenError && elseError) return thenError;
+
+                      Interval& result = intervals.mStack[stackBase + ++SP];
+                      if(elseError) result = thenResult;
+                      else if(!thenError)
+                          result = IM::hull(thenResult, result);
+                  }
+
+                  // The branches may have grown the stack
+                  Vars = &intervals.mStack[varBase];
+                  Stack = &intervals.mStack[stackBase];
+                  DP = endDP;
+                  IP = elseEnd - 1;
+                  break;
+              }
+
+          case cInt:
+              Stack[SP] = Interval(fp_int(Stack[SP].lower),
+                                   fp_int(Stack[SP].upper));
+              break;
+
+          case cLog:
+              if(!(Stack[SP].upper > Value_t(0))) return 3;
+              Stack[SP] = IM::log(Stack[SP]); break;
+
+          case cLog10:
+              if(!(Stack[SP].upper > Value_t(0))) return 3;
+              Stack[SP] = IM::library
+                  (Stack[SP].lower > Value_t(0) ?
+                   fp_log10(Stack[SP].lower) : -IM::infinity(),
+                   fp_log10(Stack[SP].upper));
+              break;
+
+          case cLog2:
+              if(!(Stack[SP].upper > Value_t(0))) return 3;
+              Stack[SP] = IM::library
+                  (Stack[SP].lower > Value_t(0) ?
+                   fp_log2(Stack[SP].lower) : -IM::infinity(),
+                   fp_log2(Stack[SP].upper));
+              break;
+
+          case cMax:
+              Stack[SP-1] = Interval(fp_max(Stack[SP-1].lower, Stack[SP].lower),
+                                     fp_max(Stack[SP-1].upper, Stack[SP].upper));
+              --SP; break;
+
+          case cMin:
+              Stack[SP-1] = Interval(fp_min(Stack[SP-1].lower, Stack[SP].lower),
+                                     fp_min(Stack[SP-1].upper, Stack[SP].upper));
+              --SP; break;
+
+          case cPow:
+              {
+                  Interval result;
+                  if(!IM::pow(Stack[SP-1], Stack[SP], result)) return 3;
+                  Stack[--SP] = result;
+                  break;
+              }
+
+          case cTrunc:
+              Stack[SP] = Interval(fp_trunc(Stack[SP].lower),
+                                   fp_trunc(Stack[SP].upper));
+              break;
+
+          case cSec:
+              Stack[SP] = IM::div(Interval(Value_t(1)),
+                                  IM::sin(Stack[SP], true));
+              break;
+
+          case cSin: Stack[SP] = IM::sin(Stack[SP], false); break;
+
+          case cSinh:
+              Stack[SP] = IM::library(fp_sinh(Stack[SP].lower),
+                                      fp_sinh(Stack[SP].upper));
+              break;
+
+          case cSqrt:
+              if(Stack[SP].upper < Value_t(0)) return 2;
+              Stack[SP] = IM::sqrt(Stack[SP]); break;
+
+          case cTan: Stack[SP] = IM::tan(Stack[SP]); break;
+
+          case cTanh:
+              Stack[SP] = IM::clamp(IM::library(fp_tanh(Stack[SP].lower),
+                                                fp_tanh(Stack[SP].upper)),
+                                    Value_t(-1), Value_t(1));
+              break;
+
+// Misc:
+          case cImmed: Stack[++SP] = Interval(immed[DP++]); break;
+
+          case cJump:
+              {
+                  const unsigned* buf = &byteCode[IP+1];
+                  IP = buf[0];
+                  DP = buf[1];
+                  break;
+              }
+
+// Operators:
+          case cNeg: Stack[SP] = IM::neg(Stack[SP]); break;
+
+          case cAdd:
+              Stack[SP-1] = IM::add(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cSub:
+              Stack[SP-1] = IM::sub(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cMul:
+              Stack[SP-1] = IM::mul(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cFma:
+              Stack[SP-2] = IM::add(IM::mul(Stack[SP-2], Stack[SP-1]),
+                                    Stack[SP]);
+              SP -= 2; break;
+
+          case cFms:
+              Stack[SP-2] = IM::sub(IM::mul(Stack[SP-2], Stack[SP-1]),
+                                    Stack[SP]);
+              SP -= 2; break;
+
+          case cFmma:
+              Stack[SP-3] = IM::add(IM::mul(Stack[SP-3], Stack[SP-2]),
+                                    IM::mul(Stack[SP-1], Stack[SP]));
+              SP -= 3; break;
+
+          case cFmms:
+              Stack[SP-3] = IM::sub(IM::mul(Stack[SP-3], Stack[SP-2]),
+                                    IM::mul(Stack[SP-1], Stack[SP]));
+              SP -= 3; break;
+
+          case cDiv:
+              if(IM::isZero(Stack[SP])) return 1;
+              Stack[SP-1] = IM::div(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cMod:
+              if(IM::isZero(Stack[SP])) return 1;
+              Stack[SP-1] = IM::mod(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cEqual:
+              Stack[SP-1] = IM::equal(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cNEqual:
+              Stack[SP-1] = IM::logicalNot(IM::equal(Stack[SP-1], Stack[SP]));
+              --SP; break;
+
+          case cLess:
+              Stack[SP-1] = IM::less(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cLessOrEq:
+              Stack[SP-1] = IM::lessOrEq(Stack[SP-1], Stack[SP]); --SP; break;
+
+          case cGreater:
+              Stack[SP-1] = IM::less(Stack[SP], Stack[SP-1]); --SP; break;
+
+          case cGreaterOrEq:
+              Stack[SP-1] = IM::lessOrEq(Stack[SP], Stack[SP-1]); --SP; break;
+
+          case cNot:
+              Stack[SP] = IM::logicalNot(IM::truth(Stack[SP])); break;
+
+          case cNotNot: Stack[SP] = IM::truth(Stack[SP]); break;
+
+          case cAnd:
+              Stack[SP-1] = IM::logicalAnd(IM::truth(Stack[SP-1]),
+                                           IM::truth(Stack[SP]));
+              --SP; break;
+
+          case cOr:
+              Stack[SP-1] = IM::logicalOr(IM::truth(Stack[SP-1]),
+                                          IM::truth(Stack[SP]));
+              --SP; break;
+
+// Degrees-radians conversion:
+          case cDeg:
+              Stack[SP] = IM::mul(Stack[SP],
+                                  Interval(fp_const_rad_to_deg<Value_t>()));
+              break;
+
+          case cRad:
+              Stack[SP] = IM::mul(Stack[SP],
+                                  Interval(fp_const_deg_to_rad<Value_t>()));
+              break;
+
+// User-defined function calls:
+          case cFCall:
+              {
+                  const unsigned index = byteCode[++IP];
+                  const unsigned params = mData->mFuncPtrs[index].mNumParams;
+                  if(intervals.mParams.size() < params + 1)
+                      intervals.mParams.resize(params + 1);
+                  Value_t* const paramValues = &intervals.mParams[0];
+                  // Only the values of a C++ function are known
+                  for(unsigned param = 0; param < params; ++param)
+                  {
+                      const Interval& value = Stack[SP-params+1+param];
+                      if(!(value.lower == value.upper)) return 6;
+                      paramValues[param] = value.lower;
+                  }
+                  const Value_t retVal =
+                      mData->mFuncPtrs[index].mRawFuncPtr ?
+                      mData->mFuncPtrs[index].mRawFuncPtr(paramValues) :
+                      mData->mFuncPtrs[index].mFuncWrapperPtr->callFunction
+                      (paramValues);
+                  SP -= int(params)-1;
+                  Stack[SP] = Interval(retVal);
+                  break;
+              }
+
+          case cPCall:
+              {
+                  const unsigned index = byteCode[++IP];
+                  const unsigned params = mData->mFuncParsers[index].mNumParams;
+                  if(const int evalError =
+                     mData->mFuncParsers[index].mParserPtr->EvalIntervalCode
+                     (intervals, stackBase + SP - params + 1,
+                      stackBase + SP + 1))
+                      return evalError;
+
+                  // The stack may have been reallocated
+                  Vars = &intervals.mStack[varBase];
+                  Stack = &intervals.mStack[stackBase];
+                  SP -= int(params)-1;
+                  Stack[SP] = Stack[SP+params];
+                  break;
+              }
+
+          case cFetch:
+              {
+                  const unsigned stackOffs = byteCode[++IP];
+                  Stack[SP+1] = Stack[stackOffs]; ++SP;
+                  break;
+              }
+
+#ifdef FP_SUPPORT_OPTIMIZER
+          case cPopNMov:
+              {
+                  const unsigned stackOffs_target = byteCode[++IP];
+                  const unsigned stackOffs_source = byteCode[++IP];
+                  Stack[stackOffs_target] = Stack[stackOffs_source];
+                  SP = stackOffs_target;
+                  break;
+              }
+
+          case cLog2by:
+              if(!(Stack[SP-1].upper > Value_t(0))) return 3;
+              Stack[SP-1] = IM::mul
+                  (IM::library(Stack[SP-1].lower > Value_t(0) ?
+                               fp_log2(Stack[SP-1].lower) : -IM::infinity(),
+                               fp_log2(Stack[SP-1].upper)),
+                   Stack[SP]);
+              --SP; break;
+
+          case cNop: break;
+#endif // FP_SUPPORT_OPTIMIZER
+
+          case cSinCos:
+              Stack[SP+1] = IM::sin(Stack[SP], true);
+              Stack[SP] = IM::sin(Stack[SP], false);
+              ++SP; break;
+
+          case cSinhCosh:
+              Stack[SP+1] = IM::cosh(Stack[SP]);
+              Stack[SP] = IM::library(fp_sinh(Stack[SP].lower),
+                                      fp_sinh(Stack[SP].upper));
+              ++SP; break;
+
+          case cAbsNot:
+              Stack[SP] = IM::logicalNot(IM::absTruth(Stack[SP])); break;
+
+          case cAbsNotNot: Stack[SP] = IM::absTruth(Stack[SP]); break;
+
+          case cAbsAnd:
+              Stack[SP-1] = IM::logicalAnd(IM::absTruth(Stack[SP-1]),
+                                           IM::absTruth(Stack[SP]));
+              --SP; break;
+
+          case cAbsOr:
+              Stack[SP-1] = IM::logicalOr(IM::absTruth(Stack[SP-1]),
+                                          IM::absTruth(Stack[SP]));
+              --SP; break;
+
+          case cDup: Stack[SP+1] = Stack[SP]; ++SP; break;
+
+          case cInv:
+              if(IM::isZero(Stack[SP])) return 1;
+              Stack[SP] = IM::div(Interval(Value_t(1)), Stack[SP]); break;
+
+          case cSqr: Stack[SP] = IM::sqr(Stack[SP]); break;
+
+          case cRDiv:
+              if(IM::isZero(Stack[SP-1])) return 1;
+              Stack[SP-1] = IM::div(Stack[SP], Stack[SP-1]); --SP; break;
+
+          case cRSub:
+              Stack[SP-1] = IM::sub(Stack[SP], Stack[SP-1]); --SP; break;
+
+          case cRSqrt:
+              if(IM::isZero(Stack[SP])) return 1;
+              if(Stack[SP].upper < Value_t(0)) return 2;
+              Stack[SP] = IM::div(Interval(Value_t(1)), IM::sqrt(Stack[SP]));
+              break;
+
+#ifdef FP_SUPPORT_COMPLEX_NUMBERS
+          // EvalInterval() isn't used with the complex types, so these are
+          // the simple functions of the real numbers
+          case cReal: case cConj: break;
+          case cImag: Stack[SP] = Interval(Value_t(0)); break;
+          case cArg:
+              Stack[SP] = Interval
+                  (Stack[SP].lower < Value_t(0) ?
+                   -fp_const_pi<Value_t>() : Value_t(0),
+                   Stack[SP].upper < Value_t(0) ?
+                   -fp_const_pi<Value_t>() : Value_t(0));
+              break;
+          case cPolar:
+              Stack[SP-1] = IM::mul(Stack[SP-1], IM::sin(Stack[SP], true));
+              --SP; break;
+#endif
+
+// Variables:
+          default:
+              Stack[++SP] = Vars[byteCode[IP]-VarBegin];
+              break;
+        }
+    }
+    return 0;
+}
+
+
+//===========================================================================
+// Batch evaluation
+//===========================================================================
+namespace
+{
+    /* Number of rows which EvalBatch() runs through each opcode at a time.
+       The batch stack holds this many values per stack slot: the value of
+       row i in stack slot s is at Stack[s * FP_EvalBatchBlockSize + i].
+    */
+    const unsigned FP_EvalBatchBlockSize = 64;
+
+    // Only the first error of each row is reported, like in Eval().
+    inline void setBatchEvalError(int& rowError, int error)
+    {
+        if(rowError == 0) rowError = error;
+    }
+
+    /* The estimated cost of evaluating the opcode for one row of a block,
+       relative to an addition. The math library functions have no kernels
+       and are called a row at a time.
+    */
+    unsigned batchOpcodeCost(unsigned opcode)
+    {
+        switch(opcode)
+        {
+          case cAcos: case cAcosh: case cAsin: case cAsinh: case cAtan:
+          case cAtan2: case cAtanh: case cCbrt: case cCos: case cCosh:
+          case cCot: case cCsc: case cExp: case cExp2: case cHypot:
+          case cLog: case cLog10: case cLog2: case cPow: case cSec:
+          case cSin: case cSinh: case cTan: case cTanh:
+          case cSinCos: case cSinhCosh:
+#ifdef FP_SUPPORT_OPTIMIZER
+          case cLog2by:
+#endif
+          case cFCall: case cPCall:
+              return 20;
+          case cDiv: case cMod: case cSqrt: case cInv: case cRDiv:
+          case cRSqrt:
+              return 4;
+          default:
+              return 1;
+        }
+    }
+
+    /* An if() of the bytecode: where it ends, and the estimated cost of
+       its branches per row. 'calls' tells if either branch calls other
+       functions, which then mustn't be called for rows which don't take
+       the branch.
+    */
+    struct BatchBranch
+    {
+        unsigned elseEnd, endDP, thenCost, elseCost;
+        bool calls;
+    };
+
+    /* Records the if()s of the code from IP to end in 'branches' (indexed
+       by the position of the cIf or cAbsIf), and returns the estimated cost
+       of the code. 'calls' is set if the code calls other functions, and
+       'depth' is raised to the nesting depth of the if()s.
+    */
+    unsigned scanBatchBranches(const std::vector<unsigned>& byteCode,
+                               unsigned IP, unsigned end,
+                               std::vector<BatchBranch>& branches,
+                               bool& calls, unsigned& depth)
+    {
+        unsigned cost = 0;
+        while(IP < end)
+        {
+            const unsigned opcode = byteCode[IP];
+            switch(opcode)
+            {
+              case cIf: case cAbsIf:
+                  {
+                      BatchBranch& branch = branches[IP];
+                      const unsigned jumpIP = byteCode[IP+1] - 2;
+                      branch.endDP = byteCode[IP+2];
+                      branch.elseEnd = skipIfBranch
+                          (&byteCode[0], jumpIP+3,
+                           std::min(byteCode[jumpIP+1]+1,
+                                    unsigned(byteCode.size())),
+                           branch.endDP);
+
+                      bool branchCalls = false;
+                      unsigned thenDepth = 0, elseDepth = 0;
+                      branch.thenCost = scanBatchBranches
+                          (byteCode, IP+3, jumpIP, branches,
+                           branchCalls, thenDepth);
+                      branch.elseCost = scanBatchBranches
+                          (byteCode, jumpIP+3, branch.elseEnd, branches,
+                           branchCalls, elseDepth);
+                      branch.calls = branchCalls;
+
+                      calls = calls || branchCalls;
+                      depth = std::max(depth,
+                                       1 + std::max(thenDepth, elseDepth));
+                      cost += 1 + branch.thenCost + branch.elseCost;
+                      IP = branch.elseEnd;
+                      break;
+                  }
+              case cJump: return cost;
+              case cFCall: case cPCall:
+                  calls = true;
+                  cost += batchOpcodeCost(opcode);
+                  IP += 2; break;
+              case cFetch: cost += 1; IP += 2; break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov: cost += 1; IP += 3; break;
+#endif
+              default: cost += batchOpcodeCost(opcode); ++IP; break;
+            }
+        }
+        return cost;
+    }
+
+    /* A kernel evaluates one opcode for a whole block of rows. a, b, c and
+       d point to the topmost stack slot (after popping the operands) and
+       the three slots above it.
+    */
+    template<typename Value_t>
+    struct BatchKernel
+    {
+        void (*function)(Value_t* a, const Value_t* b, const Value_t* c,
+                         const Value_t* d, int* errors);
+        unsigned operands;
+    };
+}
+
+#define FP_BATCH_RESTRICT __restrict
+
+/* The float and double kernels are compiled once for every instruction set
+   supported by the compiler, and the best one for the running processor is
+   picked the first time they are needed.
+*/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FP_BATCH_KERNELS_RUNTIME_DISPATCH
+namespace
+{
+    namespace FP_BatchKernels_avx512
+    {
+#define FP_BATCH_KERNEL_TARGET __attribute__((target("avx512f")))
+#include "extrasrc/fp_batch_kernels.inc"
+#undef FP_BATCH_KERNEL_TARGET
+    }
+
+    namespace FP_BatchKernels_avx2
+    {
+#define FP_BATCH_KERNEL_TARGET __attribute__((target("avx2,fma")))
+#include "extrasrc/fp_batch_kernels.inc"
+#undef FP_BATCH_KERNEL_TARGET
+    }
+}
+#endif
+
+namespace
+{
+    namespace FP_BatchKernels_default
+    {
+#define FP_BATCH_KERNEL_TARGET
+#include "extrasrc/fp_batch_kernels.inc"
+#undef FP_BATCH_KERNEL_TARGET
+    }
+
+    // The kernels of the NaN propagation mode go to tables[1]
+    template<typename Value_t>
+    bool initBatchKernels(BatchKernel<Value_t> (*tables)[VarBegin])
+    {
+#ifdef FP_BATCH_KERNELS_RUNTIME_DISPATCH
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+        {
+            FP_BatchKernels_avx512::fillBatchKernels(tables[0], false);
+            FP_BatchKernels_avx512::fillBatchKernels(tables[1], true);
+            return true;
+        }
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            FP_BatchKernels_avx2::fillBatchKernels(tables[0], false);
+            FP_BatchKernels_avx2::fillBatchKernels(tables[1], true);
+            return true;
+        }
+#endif
+        FP_BatchKernels_default::fillBatchKernels(tables[0], false);
+        FP_BatchKernels_default::fillBatchKernels(tables[1], true);
+        return true;
+    }
+
+    // Indexed by opcode. Opcodes without a kernel have a null function.
+    template<typename Value_t>
+    const BatchKernel<Value_t>* selectBatchKernels(bool propagateNaN)
+    {
+        static BatchKernel<Value_t> tables[2][VarBegin] = {};
+        static const bool initialized = initBatchKernels(tables);
+        (void)initialized;
+        return tables[propagateNaN ? 1 : 0];
+    }
+
+    // Other types than float and double use the generic loops of EvalBlock().
+    template<typename Value_t>
+    inline const BatchKernel<Value_t>* getBatchKernels(bool) { return 0; }
+
+    template<>
+    inline const BatchKernel<double>* getBatchKernels<double>(bool propagateNaN)
+    {
+        return selectBatchKernels<double>(propagateNaN);
+    }
+
+    template<>
+    inline const BatchKernel<float>* getBatchKernels<float>(bool propagateNaN)
+    {
+        return selectBatchKernels<float>(propagateNaN);
+    }
+}
+
+#undef FP_BATCH_KERNELS_RUNTIME_DISPATCH
+#undef FP_BATCH_RESTRICT
+
+namespace
+{
+    /* Hands out the blocks of a batch to the threads evaluating it. Each
+       thread starts with an equal share of the blocks, which it takes from
+       the front. A thread which runs out steals the latter half of the
+       largest remaining share, so that a thread which is slowed down (by
+       the operating system or by expensive rows) doesn't hold up the rest.
+       A share is kept as (begin << 32 | end) in one atomic value.
+    */
+    class BatchBlockScheduler
+    {
+        struct alignas(64) Share
+        {
+            std::atomic<unsigned long long> mBlocks;
+        };
+
+        std::vector<Share> mShares;
+        std::size_t mBlocksAmount, mNextBlock; // for a single thread
+
+        static unsigned long long pack(unsigned long long begin,
+                                       unsigned long long end)
+        { return begin << 32 | end; }
+        static unsigned begin(unsigned long long blocks)
+        { return unsigned(blocks >> 32); }
+        static unsigned end(unsigned long long blocks)
+        { return unsigned(blocks); }
+
+     public:
+        BatchBlockScheduler(std::size_t blocksAmount, unsigned threadsAmount):
+            mShares(threadsAmount > 1 ? threadsAmount : 0),
+            mBlocksAmount(blocksAmount), mNextBlock(0)
+        {
+            for(unsigned thread = 0; thread < mShares.size(); ++thread)
+                mShares[thread].mBlocks.store
+                    (pack(blocksAmount * thread / threadsAmount,
+                          blocksAmount * (thread+1) / threadsAmount),
+                     std::memory_order_relaxed);
+        }
+
+        // Gives the next block for the thread, or false if none are left.
+        bool Next(unsigned thread, std::size_t& block)
+        {
+            if(mShares.empty())
+            {
+                if(mNextBlock == mBlocksAmount) return false;
+                block = mNextBlock++;
+                return true;
+            }
+
+            std::atomic<unsigned long long>& own = mShares[thread].mBlocks;
+            while(true)
+            {
+                unsigned long long blocks = own.load(std::memory_order_relaxed);
+                while(begin(blocks) < end(blocks))
+                {
+                    if(own.compare_exchange_weak(blocks, blocks + pack(1, 0),
+                                                 std::memory_order_relaxed))
+                    {
+                        block = begin(blocks);
+                        return true;
+                    }
+                }
+
+                unsigned victim = 0, largest = 0;
+                for(unsigned other = 0; other < mShares.size(); ++other)
+                {
+                    blocks = mShares[other].mBlocks.load
+                        (std::memory_order_relaxed);
+                    if(end(blocks) > begin(blocks) + largest)
+                    {
+                        victim = other;
+                        largest = end(blocks) - begin(blocks);
+                    }
+                }
+                if(largest == 0) return false;
+
+                /* Only this thread can refill its own share, and only when
+                   it's empty, so no other thread can be stealing from it.
+                */
+                std::atomic<unsigned long long>& share =
+                    mShares[victim].mBlocks;
+                blocks = share.load(std::memory_order_relaxed);
+                const unsigned first = begin(blocks), last = end(blocks);
+                if(first >= last) continue;
+                const unsigned middle = first + (last - first) / 2;
+                if(share.compare_exchange_strong(blocks, pack(first, middle),
+                                                 std::memory_order_relaxed))
+                {
+                    own.store(pack(middle + 1, last), std::memory_order_relaxed);
+                    block = middle;
+                    return true;
+                }
+            }
+        }
+    };
+
+    /* The threads which run EvalBatchParallel(). They are created when
+       first needed and then wait for the next batch until the program
+       exits. One batch runs at a time: a call made while another thread's
+       batch is running, or from inside a batch (by a C++ function called
+       by the parser), runs in the calling thread alone.
+    */
+    class BatchThreadPool
+    {
+     public:
+        typedef void (*Job)(void* data, unsigned thread);
+
+        static BatchThreadPool& Instance()
+        {
+            static BatchThreadPool pool;
+            return pool;
+        }
+
+        static unsigned DefaultSize()
+        {
+            const unsigned processors = std::thread::hardware_concurrency();
+            return processors ? processors : 1;
+        }
+
+        /* Runs job(data, 0) to job(data, threadsAmount-1) at the same time,
+           the first one in the calling thread, or returns false if the
+           pool is not available (and runs nothing).
+        */
+        bool Run(unsigned threadsAmount, Job job, void* data)
+        {
+            bool& insideJob = InsideJob();
+            if(insideJob || !mRunMutex.try_lock()) return false;
+
+            while(mThreads.size() + 1 < threadsAmount)
+            {
+                try
+                {
+                    mThreads.push_back
+                        (std::thread(&BatchThreadPool::Work, this,
+                                     unsigned(mThreads.size() + 1),
+                                     mGeneration));
+                }
+                catch(const std::system_error&)
+                {
+                    // The blocks of the missing threads get stolen
+                    threadsAmount = unsigned(mThreads.size() + 1);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mJob = job;
+                mData = data;
+                mActive = threadsAmount;
+                mRemaining = threadsAmount - 1;
+                ++mGeneration;
+            }
+            mWake.notify_all();
+
+            // The other threads use 'data' until all of them are done
+            struct Completion
+            {
+                BatchThreadPool& pool;
+                bool& insideJob;
+
+                Completion(BatchThreadPool& p, bool& inside):
+                    pool(p), insideJob(inside) { insideJob = true; }
+                ~Completion()
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(pool.mMutex);
+                        while(pool.mRemaining) pool.mDone.wait(lock);
+                    }
+                    insideJob = false;
+                    pool.mRunMutex.unlock();
+                }
+            } completion(*this, insideJob);
+
+            job(data, 0);
+            return true;
+        }
+
+     private:
+        std::vector<std::thread> mThreads;
+        std::mutex mRunMutex, mMutex;
+        std::condition_variable mWake, mDone;
+        unsigned long long mGeneration;
+        unsigned mActive, mRemaining;
+        bool mStop;
+        Job mJob;
+        void* mData;
+
+        BatchThreadPool():
+            mGeneration(0), mActive(0), mRemaining(0), mStop(false),
+            mJob(0), mData(0) {}
+
+        ~BatchThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStop = true;
+            }
+            mWake.notify_all();
+            for(std::size_t i = 0; i < mThreads.size(); ++i)
+                mThreads[i].join();
+        }
+
+        static bool& InsideJob()
+        {
+            static thread_local bool insideJob = false;
+            return insideJob;
+        }
+
+        void Work(unsigned thread, unsigned long long generation)
+        {
+            InsideJob() = true;
+            std::unique_lock<std::mutex> lock(mMutex);
+            while(true)
+            {
+                while(!mStop && mGeneration == generation) mWake.wait(lock);
+                if(mStop) return;
+                generation = mGeneration;
+                if(thread >= mActive) continue;
+
+                const Job job = mJob;
+                void* const data = mData;
+                lock.unlock();
+                job(data, thread);
+                lock.lock();
+                if(--mRemaining == 0) mDone.notify_one();
+            }
+        }
+    };
+}
+
+/* The buffers of one thread running EvalBatch() or EvalBatchParallel().
+   The code is evaluated a block of rows at a time with EvalBlock(), using
+   the stack. The if()s of the code have buffers of their own for each
+   nesting depth.
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::BatchBuffers
+{
+    /* The rows which take the then branch of an if(), and the values of
+       the rows of a branch when it's evaluated apart from the others.
+    */
+    struct Branch
+    {
+        bool mTaken[FP_EvalBatchBlockSize];
+        unsigned mRows[FP_EvalBatchBlockSize];
+        int mErrors[FP_EvalBatchBlockSize], mSavedErrors[FP_EvalBatchBlockSize];
+        std::vector<Value_t> mStack, mVarBlock, mResults;
+        std::vector<const Value_t*> mColumns;
+    };
+
+    std::vector<Value_t> mStack, mVarBlock, mCallParams, mCallResults;
+    std::vector<const Value_t*> mColumns, mCallColumns;
+    int mErrors[FP_EvalBatchBlockSize];
+    std::vector<BatchBranch> mIfs;
+    std::vector<Branch> mBranches;
+    EvalContext mContext;
+
+    BatchBuffers(const Data& data, bool rowInput):
+        // The three spare slots keep the operand pointers of a kernel in range
+        mStack((data.mStackSize + 3) * FP_EvalBatchBlockSize),
+        mVarBlock(rowInput ? data.mVariablesAmount * FP_EvalBatchBlockSize : 0),
+        mCallResults(data.mFuncPtrs.empty() ? 0 : FP_EvalBatchBlockSize),
+        mColumns(data.mVariablesAmount),
+        mIfs(data.mByteCode.size())
+    {
+        bool calls = false;
+        unsigned depth = 0;
+        scanBatchBranches(data.mByteCode, 0, unsigned(data.mByteCode.size()),
+                          mIfs, calls, depth);
+        mBranches.resize(depth);
+        for(unsigned i = 0; i < depth; ++i)
+        {
+            mBranches[i].mStack.resize(mStack.size());
+            mBranches[i].mVarBlock.resize
+                (data.mVariablesAmount * FP_EvalBatchBlockSize);
+            mBranches[i].mResults.resize(FP_EvalBatchBlockSize);
+            mBranches[i].mColumns.resize(data.mVariablesAmount);
+        }
+    }
+};
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBatch(const Value_t* Vars,
+                                            std::size_t stride,
+                                            std::size_t count,
+                                            Value_t* results)
+{
+    EvalBatchImpl(Vars, stride, 0, count, results, 1);
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBatch(const Value_t* const* Vars,
+                                            std::size_t count,
+                                            Value_t* results)
+{
+    EvalBatchImpl(0, 0, Vars, count, results, 1);
+}
+
+/* Evaluates the n rows (at most FP_EvalBatchBlockSize) from firstRow on,
+   and returns the error code of the first of them which fails, if any (or
+   the errors of all of them in the NaN propagation mode).
+   Either rowVars (one row of variables every 'stride' values) or varColumns
+   (one array of values per variable) is used as the input.
+*/
+template<typename Value_t>
+int FunctionParserBase<Value_t>::EvalBatchRows(const Value_t* rowVars,
+                                               std::size_t stride,
+                                               const Value_t* const* varColumns,
+                                               std::size_t firstRow,
+                                               unsigned n,
+                                               Value_t* results,
+                                               BatchBuffers& buffers) const
+{
+    const unsigned B = FP_EvalBatchBlockSize;
+    const unsigned varsAmount = mData->mVariablesAmount;
+    int* const errors = buffers.mErrors;
+
+    for(unsigned v = 0; v < varsAmount; ++v)
+    {
+        if(rowVars)
+        {
+            // Transpose the rows so that each variable is contiguous
+            Value_t* const column = &buffers.mVarBlock[v * B];
+            const Value_t* src = rowVars + firstRow * stride + v;
+            for(unsigned i = 0; i < n; ++i, src += stride)
+                column[i] = *src;
+            buffers.mColumns[v] = column;
+        }
+        else
+            buffers.mColumns[v] = varColumns[v] + firstRow;
+    }
+    EvalBlock(buffers.mColumns.data(), n, results + firstRow, buffers);
+
+    // The errors of all the rows in the NaN propagation mode
+    int blockErrors = 0;
+    for(unsigned i = 0; i < n; ++i)
+    {
+        if(!mData->mPropagateNaN && errors[i]) return errors[i];
+        blockErrors |= errors[i];
+    }
+    return blockErrors;
+}
+
+/* Evaluates the rows in blocks of FP_EvalBatchBlockSize rows, using the
+   given amount of threads (0 for one per processor) if it's more than one.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBatchImpl(const Value_t* rowVars,
+                                                std::size_t stride,
+                                                const Value_t* const* varColumns,
+                                                std::size_t count,
+                                                Value_t* results,
+                                                unsigned threadsAmount)
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+    {
+        for(std::size_t row = 0; row < count; ++row) results[row] = Value_t(0);
+        return;
+    }
+
+    const unsigned B = FP_EvalBatchBlockSize;
+    const std::size_t blocksAmount = (count + B - 1) / B;
+    if(threadsAmount == 0) threadsAmount = BatchThreadPool::DefaultSize();
+    if(threadsAmount > blocksAmount) threadsAmount = unsigned(blocksAmount);
+    if(blocksAmount >> 32) threadsAmount = 1; // beyond BatchBlockScheduler
+
+    // The error of each block is kept so that the first one can be found
+    struct Batch
+    {
+        const FunctionParserBase<Value_t>* parser;
+        const Value_t* rowVars;
+        std::size_t stride;
+        const Value_t* const* varColumns;
+        std::size_t count;
+        Value_t* results;
+        std::vector<int> blockErrors;
+        BatchBlockScheduler scheduler;
+
+        static void Run(void* data, unsigned thread)
+        {
+            Batch& batch = *static_cast<Batch*>(data);
+            BatchBuffers buffers(*batch.parser->mData, batch.rowVars != 0);
+            std::size_t block;
+            while(batch.scheduler.Next(thread, block))
+            {
+                const std::size_t firstRow = block * FP_EvalBatchBlockSize;
+                const unsigned n = unsigned(std::min
+                    (std::size_t(FP_EvalBatchBlockSize), batch.count - firstRow));
+                batch.blockErrors[block] = batch.parser->EvalBatchRows
+                    (batch.rowVars, batch.stride, batch.varColumns,
+                     firstRow, n, batch.results, buffers);
+            }
+        }
+    };
+
+    Batch batch =
+        { this, rowVars, stride, varColumns, count, results,
+          std::vector<int>(blocksAmount, 0),
+          BatchBlockScheduler(blocksAmount, threadsAmount) };
+    if(threadsAmount <= 1
+    || !BatchThreadPool::Instance().Run(threadsAmount, &Batch::Run, &batch))
+    {
+        // The calling thread takes the blocks of all the others
+        Batch::Run(&batch, 0);
+    }
+
+    int evalError = 0;
+    for(std::size_t block = 0; block < blocksAmount; ++block)
+    {
+        if(!mData->mPropagateNaN && evalError) break;
+        evalError |= batch.blockErrors[block];
+    }
+    mEvalErrorType = evalError;
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBatchParallel(const Value_t* Vars,
+                                                    std::size_t stride,
+                                                    std::size_t count,
+                                                    Value_t* results,
+                                                    unsigned threadsAmount)
+{
+    EvalBatchImpl(Vars, stride, 0, count, results, threadsAmount);
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBatchParallel(const Value_t* const* Vars,
+                                                    std::size_t count,
+                                                    Value_t* results,
+                                                    unsigned threadsAmount)
+{
+    EvalBatchImpl(0, 0, Vars, count, results, threadsAmount);
+}
+
+/* Evaluates n (at most FP_EvalBatchBlockSize) rows through the bytecode.
+   Vars[v] points to the n values of variable v.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBlock(const Value_t* const* Vars,
+                                            unsigned n, Value_t* results,
+                                            BatchBuffers& buffers) const
+{
+    const unsigned B = FP_EvalBatchBlockSize;
+    int* const errors = buffers.mErrors;
+    Value_t* const Stack = buffers.mStack.data();
+    unsigned DP = 0;
+    int SP = -1;
+
+    // The kernels process whole blocks, also the rows past n
+    for(unsigned i = 0; i < B; ++i) errors[i] = 0;
+
+    EvalBlockRange(Vars, n, Stack, errors, buffers, 0,
+                   0, unsigned(mData->mByteCode.size()), DP, SP);
+
+    const bool checkDomain = !mData->mPropagateNaN;
+    const Value_t* const top = &Stack[unsigned(SP) * B];
+    for(unsigned i = 0; i < n; ++i)
+        results[i] = errors[i] && checkDomain ? Value_t(0) : top[i];
+}
+
+/* Evaluates the bytecode from IP to endIP for the n rows. When the rows
+   of an if() don't all take the same branch, either both branches are
+   evaluated for all the rows and the results are picked row by row, or
+   each branch is evaluated for its own rows only, copied to the branch
+   buffers of the nesting depth. The former is chosen when the branches
+   are cheap compared to the copying, and they don't call other functions.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::EvalBlockRange
+(const Value_t* const* Vars, unsigned n, Value_t* Stack, int* errors,
+ BatchBuffers& buffers, unsigned depth,
+ unsigned IP, unsigned endIP, unsigned& DP, int& SP) const
+{
+    const unsigned B = FP_EvalBatchBlockSize;
+    const unsigned* const byteCode = &(mData->mByteCode[0]);
+    const Value_t* const immed = mData->mImmed.empty() ? 0 : &(mData->mImmed[0]);
+
+    const bool checkDomain = !mData->mPropagateNaN;
+    const BatchKernel<Value_t>* const kernels =
+        getBatchKernels<Value_t>(!checkDomain);
+    std::vector<Value_t>& callParams = buffers.mCallParams;
+    EvalContext& context = buffers.mContext;
+
+    /* a = the topmost stack slot (after popping the operands),
+       b = the slot above it, c = the slot above that one, etc.
+    */
+#define FP_BATCH_OP(operands, expr) \
+    { SP -= operands-1; \
+      Value_t* const a = &Stack[unsigned(SP) * B]; \
+      const Value_t* const b = a + B; \
+      const Value_t* const c = b + B; \
+      const Value_t* const d = c + B; \
+      (void)b; (void)c; (void)d; \
+      for(unsigned i = 0; i < n; ++i) a[i] = expr; } break
+#define FP_BATCH_CHECKED_OP(operands, failCondition, error, expr) \
+    { SP -= operands-1; \
+      Value_t* const a = &Stack[unsigned(SP) * B]; \
+      const Value_t* const b = a + B; \
+      (void)b; \
+      if(checkDomain) \
+          for(unsigned i = 0; i < n; ++i) \
+          { \
+              if(failCondition) \
+              { setBatchEvalError(errors[i], error); a[i] = Value_t(0); } \
+              else a[i] = expr; \
+          } \
+      else \
+          for(unsigned i = 0; i < n; ++i) \
+          { \
+              errors[i] |= int(bool(failCondition)) << (error-1); \
+              a[i] = expr; \
+          } } break
+
+    for(; IP < endIP; ++IP)
+    {
+        const unsigned opcode = byteCode[IP];
+        if(kernels && opcode < VarBegin && kernels[opcode].function)
+        {
+            SP -= int(kernels[opcode].operands) - 1;
+            Value_t* const a = &Stack[unsigned(SP) * B];
+            kernels[opcode].function(a, a + B, a + 2*B, a + 3*B, errors);
+            continue;
+        }
+
+        switch(opcode)
+        {
+// Functions:
+          case   cAbs: FP_BATCH_OP(1, fp_abs(a[i]));
+
+          case  cAcos:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value == false
+                                  && (a[i] < Value_t(-1) || a[i] > Value_t(1)),
+                                  4, fp_acos(a[i]));
+
+          case cAcosh:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value == false
+                                  && a[i] < Value_t(1),
+                                  4, fp_acosh(a[i]));
+
+          case  cAsin:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value == false
+                                  && (a[i] < Value_t(-1) || a[i] > Value_t(1)),
+                                  4, fp_asin(a[i]));
+
+          case cAsinh: FP_BATCH_OP(1, fp_asinh(a[i]));
+
+          case  cAtan: FP_BATCH_OP(1, fp_atan(a[i]));
+
+          case cAtan2: FP_BATCH_OP(2, fp_atan2(a[i], b[i]));
+
+          case cAtanh:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value
+                                  ?  (a[i] == Value_t(-1) || a[i] == Value_t(1))
+                                  :  (a[i] <= Value_t(-1) || a[i] >= Value_t(1)),
+                                  4, fp_atanh(a[i]));
+
+          case  cCbrt: FP_BATCH_OP(1, fp_cbrt(a[i]));
+
+          case  cCeil: FP_BATCH_OP(1, fp_ceil(a[i]));
+
+          case   cCos: FP_BATCH_OP(1, fp_cos(a[i]));
+
+          case  cCosh: FP_BATCH_OP(1, fp_cosh(a[i]));
+
+          case   cCot:
+              FP_BATCH_CHECKED_OP(1, fp_tan(a[i]) == Value_t(0),
+                                  1, fp_inv(fp_tan(a[i])));
+
+          case   cCsc:
+              FP_BATCH_CHECKED_OP(1, fp_sin(a[i]) == Value_t(0),
+                                  1, fp_inv(fp_sin(a[i])));
+
+          case   cExp: FP_BATCH_OP(1, fp_exp(a[i]));
+
+          case   cExp2: FP_BATCH_OP(1, fp_exp2(a[i]));
+
+          case cFloor: FP_BATCH_OP(1, fp_floor(a[i]));
+
+          case cHypot: FP_BATCH_OP(2, fp_hypot(a[i], b[i]));
+
+          case cIf: case cAbsIf:
+              {
+                  const BatchBranch& info = buffers.mIfs[IP];
+                  typename BatchBuffers::Branch& branch =
+                      buffers.mBranches[depth];
+                  const Value_t* const condition = &Stack[unsigned(SP--) * B];
+                  unsigned taken = 0;
+                  for(unsigned i = 0; i < n; ++i)
+                  {
+                      branch.mTaken[i] = opcode == cIf ?
+                          fp_truth(condition[i]) : fp_absTruth(condition[i]);
+                      taken += branch.mTaken[i];
+                  }
+
+                  const unsigned jumpIP = byteCode[IP+1] - 2;
+                  unsigned elseDP = byteCode[IP+2];
+                  // Per row: the rows of a branch evaluated apart are copied
+                  // there and back, with the variables and the stack
+                  const unsigned copyCost =
+                      mData->mVariablesAmount + unsigned(SP) + 4;
+
+                  if(taken == n)
+                      EvalBlockRange(Vars, n, Stack, errors, buffers, depth+1,
+                                     IP+3, jumpIP, DP, SP);
+                  else if(taken == 0)
+                      EvalBlockRange(Vars, n, Stack, errors, buffers, depth+1,
+                                     jumpIP+3, info.elseEnd, elseDP, SP);
+                  else if(!info.calls &&
+                          (info.thenCost + info.elseCost) * n <=
+                          info.thenCost * taken +
+                          info.elseCost * (n - taken) + copyCost * n)
+                  {
+                      // Both branches for all the rows, the errors and the
+                      // result of the then branch kept for its rows
+                      Value_t* const result = &Stack[unsigned(SP+1) * B];
+                      int thenSP = SP, elseSP = SP;
+                      for(unsigned i = 0; i < n; ++i)
+                          branch.mSavedErrors[i] = errors[i];
+                      EvalBlockRange(Vars, n, Stack, errors, buffers, depth+1,
+                                     IP+3, jumpIP, DP, thenSP);
+                      for(unsigned i = 0; i < n; ++i)
+                      {
+                          branch.mResults[i] = result[i];
+                          branch.mErrors[i] = errors[i];
+                          errors[i] = branch.mSavedErrors[i];
+                      }
+                      EvalBlockRange(Vars, n, Stack, errors, buffers, depth+1,
+                                     jumpIP+3, info.elseEnd, elseDP, elseSP);
+                      for(unsigned i = 0; i < n; ++i)
+                          if(branch.mTaken[i])
+                          {
+                              result[i] = branch.mResults[i];
+                              errors[i] = branch.mErrors[i];
+                          }
+                      ++SP;
+                  }
+                  else
+                  {
+                      // Each branch for its own rows, copied to the branch
+                      // buffers together with the variables and the stack
+                      for(int thenBranch = 1; thenBranch >= 0; --thenBranch)
+                      {
+                          unsigned rows = 0;
+                          for(unsigned i = 0; i < n; ++i)
+                              if(branch.mTaken[i] == bool(thenBranch))
+                                  branch.mRows[rows++] = i;
+
+                          for(unsigned v = 0; v < mData->mVariablesAmount; ++v)
+                          {
+                              Value_t* const column = &branch.mVarBlock[v * B];
+                              for(unsigned r = 0; r < rows; ++r)
+                                  column[r] = Vars[v][branch.mRows[r]];
+                              branch.mColumns[v] = column;
+                          }
+                          for(unsigned slot = 0; int(slot) <= SP; ++slot)
+                              for(unsigned r = 0; r < rows; ++r)
+                                  branch.mStack[slot * B + r] =
+                                      Stack[slot * B + branch.mRows[r]];
+                          for(unsigned r = 0; r < rows; ++r)
+                              branch.mErrors[r] = errors[branch.mRows[r]];
+
+                          int branchSP = SP;
+                          if(thenBranch)
+                              EvalBlockRange(branch.mColumns.data(), rows,
+                                             branch.mStack.data(),
+                                             branch.mErrors, buffers, depth+1,
+                                             IP+3, jumpIP, DP, branchSP);
+                          else
+                              EvalBlockRange(branch.mColumns.data(), rows,
+                                             branch.mStack.data(),
+                                             branch.mErrors, buffers, depth+1,
+                                             jumpIP+3, info.elseEnd, elseDP,
+                                             branchSP);
+
+                          const unsigned slot = unsigned(SP+1);
+                          for(unsigned r = 0; r < rows; ++r)
+                          {
+                              Stack[slot * B + branch.mRows[r]] =
+                                  branch.mStack[slot * B + r];
+                              errors[branch.mRows[r]] = branch.mErrors[r];
+                          }
+                      }
+                      ++SP;
+                  }
+
+                  DP = info.endDP;
+                  IP = info.elseEnd - 1;
+                  break;
+              }
+
+          case   cInt: FP_BATCH_OP(1, fp_int(a[i]));
+
+          case   cLog:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value
+                                  ?   a[i] == Value_t(0)
+                                  :   !(a[i] > Value_t(0)),
+                                  3, fp_log(a[i]));
+
+          case cLog10:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value
+                                  ?   a[i] == Value_t(0)
+                                  :   !(a[i] > Value_t(0)),
+                                  3, fp_log10(a[i]));
+
+          case  cLog2:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value
+                                  ?   a[i] == Value_t(0)
+                                  :   !(a[i] > Value_t(0)),
+                                  3, fp_log2(a[i]));
+
+          case   cMax: FP_BATCH_OP(2, fp_max(a[i], b[i]));
+
+          case   cMin: FP_BATCH_OP(2, fp_min(a[i], b[i]));
+
+          case   cPow:
+              // x:0 ^ y:negative is failure
+              FP_BATCH_CHECKED_OP(2, a[i] == Value_t(0) && b[i] < Value_t(0),
+                                  3, fp_pow(a[i], b[i]));
+
+          case  cTrunc: FP_BATCH_OP(1, fp_trunc(a[i]));
+
+          case   cSec:
+              FP_BATCH_CHECKED_OP(1, fp_cos(a[i]) == Value_t(0),
+                                  1, fp_inv(fp_cos(a[i])));
+
+          case   cSin: FP_BATCH_OP(1, fp_sin(a[i]));
+
+          case  cSinh: FP_BATCH_OP(1, fp_sinh(a[i]));
+
+          case  cSqrt:
+              FP_BATCH_CHECKED_OP(1, IsComplexType<Value_t>::value == false
+                                  && a[i] < Value_t(0),
+                                  2, fp_sqrt(a[i]));
+
+          case   cTan: FP_BATCH_OP(1, fp_tan(a[i]));
+
+          case  cTanh: FP_BATCH_OP(1, fp_tanh(a[i]));
+
+
+// Misc:
+          case cImmed:
+              {
+                  Value_t* const a = &Stack[unsigned(++SP) * B];
+                  const Value_t& value = immed[DP++];
+                  for(unsigned i = 0; i < n; ++i) a[i] = value;
+                  break;
+              }
+
+          case  cJump:
+              {
+                  const unsigned* buf = &byteCode[IP+1];
+                  IP = buf[0];
+                  DP = buf[1];
+                  break;
+              }
+
+// Operators:
+          case   cNeg: FP_BATCH_OP(1, -a[i]);
+          case   cAdd: FP_BATCH_OP(2, a[i] + b[i]);
+          case   cSub: FP_BATCH_OP(2, a[i] - b[i]);
+          case   cMul: FP_BATCH_OP(2, a[i] * b[i]);
 
-          case  cLess:
-              Stack[SP-1] = fp_less(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case   cFma: FP_BATCH_OP(3, fp_fma(a[i], b[i], c[i]));
+          case   cFms: FP_BATCH_OP(3, fp_fms(a[i], b[i], c[i]));
+          case   cFmma: FP_BATCH_OP(4, fp_fmma(a[i], b[i], c[i], d[i]));
+          case   cFmms: FP_BATCH_OP(4, fp_fmms(a[i], b[i], c[i], d[i]));
 
-          case  cLessOrEq:
-              Stack[SP-1] = fp_lessOrEq(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case   cDiv:
+              FP_BATCH_CHECKED_OP(2, b[i] == Value_t(0), 1, a[i] / b[i]);
 
-          case cGreater:
-              Stack[SP-1] = fp_less(Stack[SP], Stack[SP-1]);
-              --SP; break;
+          case   cMod:
+              FP_BATCH_CHECKED_OP(2, b[i] == Value_t(0), 1, fp_mod(a[i], b[i]));
 
-          case cGreaterOrEq:
-              Stack[SP-1] = fp_lessOrEq(Stack[SP], Stack[SP-1]);
-              --SP; break;
+          case cEqual: FP_BATCH_OP(2, fp_equal(a[i], b[i]));
+          case cNEqual: FP_BATCH_OP(2, fp_nequal(a[i], b[i]));
+          case  cLess: FP_BATCH_OP(2, fp_less(a[i], b[i]));
+          case  cLessOrEq: FP_BATCH_OP(2, fp_lessOrEq(a[i], b[i]));
+          case cGreater: FP_BATCH_OP(2, fp_less(b[i], a[i]));
+          case cGreaterOrEq: FP_BATCH_OP(2, fp_lessOrEq(b[i], a[i]));
 
-          case   cNot: Stack[SP] = fp_not(Stack[SP]); break;
+          case   cNot: FP_BATCH_OP(1, fp_not(a[i]));
 
-          case cNotNot: Stack[SP] = fp_truth(Stack[SP]); break;
+          case cNotNot: FP_BATCH_OP(1, fp_truth(a[i]));
 
-          case   cAnd:
-              Stack[SP-1] = fp_and(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case   cAnd: FP_BATCH_OP(2, fp_and(a[i], b[i]));
 
-          case    cOr:
-              Stack[SP-1] = fp_or(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case    cOr: FP_BATCH_OP(2, fp_or(a[i], b[i]));
 
 // Degrees-radians conversion:
-          case   cDeg: Stack[SP] = RadiansToDegrees(Stack[SP]); break;
-          case   cRad: Stack[SP] = DegreesToRadians(Stack[SP]); break;
+          case   cDeg: FP_BATCH_OP(1, RadiansToDegrees(a[i]));
+          case   cRad: FP_BATCH_OP(1, DegreesToRadians(a[i]));
 
 // User-defined function calls:
           case cFCall:
               {
                   const unsigned index = byteCode[++IP];
                   const unsigned params = mData->mFuncPtrs[index].mNumParams;
-                  const Value_t retVal =
-                      mData->mFuncPtrs[index].mRawFuncPtr ?
-                      mData->mFuncPtrs[index].mRawFuncPtr(&Stack[SP-params+1]) :
-                      mData->mFuncPtrs[index].mFuncWrapperPtr->callFunction
-                      (&Stack[SP-params+1]);
-                  SP -= int(params)-1;
-                  Stack[SP] = retVal;
+                  callParams.resize(params);
+                  const unsigned first = unsigned(SP+1-int(params));
+                  Value_t* const result = &Stack[first * B];
+                  FunctionWrapper* const wrapper =
+                      mData->mFuncPtrs[index].mFuncWrapperPtr;
+                  if(wrapper)
+                  {
+                      // The parameters are passed as the stack columns, and
+                      // the results are copied over the first one
+                      buffers.mCallColumns.resize(params);
+                      for(unsigned p = 0; p < params; ++p)
+                          buffers.mCallColumns[p] = &Stack[(first + p) * B];
+                      if(wrapper->callFunctionBatch
+                         (buffers.mCallColumns.data(), n,
+                          buffers.mCallResults.data()))
+                      {
+                          for(unsigned i = 0; i < n; ++i)
+                              result[i] = buffers.mCallResults[i];
+                          SP = int(first);
+                          break;
+                      }
+                  }
+                  for(unsigned i = 0; i < n; ++i)
+                  {
+                      for(unsigned p = 0; p < params; ++p)
+                          callParams[p] = Stack[(first + p) * B + i];
+                      result[i] =
+                          mData->mFuncPtrs[index].mRawFuncPtr ?
+                          mData->mFuncPtrs[index].mRawFuncPtr(callParams.data()) :
+                          mData->mFuncPtrs[index].mFuncWrapperPtr->callFunction
+                          (callParams.data());
+                  }
+                  SP = int(first);
                   break;
               }
 
           case cPCall:
               {
-                  unsigned index = byteCode[++IP];
-                  unsigned params = mData->mFuncParsers[index].mNumParams;
-                  Value_t retVal =
-                      mData->mFuncParsers[index].mParserPtr->Eval
-                      (&Stack[SP-params+1]);
-                  SP -= int(params)-1;
-                  Stack[SP] = retVal;
-                  const int error =
-                      mData->mFuncParsers[index].mParserPtr->EvalError();
-                  if(error)
+                  const unsigned index = byteCode[++IP];
+                  const unsigned params = mData->mFuncParsers[index].mNumParams;
+                  const FunctionParserBase<Value_t>& parser =
+                      *mData->mFuncParsers[index].mParserPtr;
+                  if(context.mNestedContexts.size() <= index)
+                      context.mNestedContexts.resize(mData->mFuncParsers.size());
+                  EvalContext& nested = context.mNestedContexts[index];
+                  callParams.resize(params);
+                  const unsigned first = unsigned(SP+1-int(params));
+                  Value_t* const result = &Stack[first * B];
+                  for(unsigned i = 0; i < n; ++i)
                   {
-                      mData->mEvalErrorType = error;
-                      return 0;
+                      for(unsigned p = 0; p < params; ++p)
+                          callParams[p] = Stack[(first + p) * B + i];
+                      result[i] = parser.Eval(nested, callParams.data());
+                      const int error = convertEvalError
+                          (nested.EvalError(), parser.mData->mPropagateNaN,
+                           !checkDomain);
+                      if(error && checkDomain)
+                      {
+                          setBatchEvalError(errors[i], error);
+                          result[i] = Value_t(0);
+                      }
+                      else
+                          errors[i] |= error;
                   }
+                  SP = int(first);
                   break;
               }
 
 
           case   cFetch:
               {
-                  unsigned stackOffs = byteCode[++IP];
-                  Stack[SP+1] = Stack[stackOffs]; ++SP;
+                  const unsigned stackOffs = byteCode[++IP];
+                  const Value_t* const src = &Stack[stackOffs * B];
+                  Value_t* const a = &Stack[unsigned(++SP) * B];
+                  for(unsigned i = 0; i < n; ++i) a[i] = src[i];
                   break;
               }
 
 #ifdef FP_SUPPORT_OPTIMIZER
           case   cPopNMov:
               {
-                  unsigned stackOffs_target = byteCode[++IP];
-                  unsigned stackOffs_source = byteCode[++IP];
-                  Stack[stackOffs_target] = Stack[stackOffs_source];
-                  SP = stackOffs_target;
+                  const unsigned stackOffs_target = byteCode[++IP];
+                  const unsigned stackOffs_source = byteCode[++IP];
+                  const Value_t* const src = &Stack[stackOffs_source * B];
+                  Value_t* const a = &Stack[stackOffs_target * B];
+                  for(unsigned i = 0; i < n; ++i) a[i] = src[i];
+                  SP = int(stackOffs_target);
                   break;
               }
 
           case  cLog2by:
-              if(IsComplexType<Value_t>::value
-               ?   Stack[SP-1] == Value_t(0)
-               :   !(Stack[SP-1] > Value_t(0)))
-              { mData->mEvalErrorType=3; return Value_t(0); }
-              Stack[SP-1] = fp_log2(Stack[SP-1]) * Stack[SP];
-              --SP;
-              break;
+              FP_BATCH_CHECKED_OP(2, IsComplexType<Value_t>::value
+                                  ?   a[i] == Value_t(0)
+                                  :   !(a[i] > Value_t(0)),
+                                  3, fp_log2(a[i]) * b[i]);
 
           case cNop: break;
 #endif // FP_SUPPORT_OPTIMIZER
 
           case cSinCos:
-              fp_sinCos(Stack[SP], Stack[SP+1], Stack[SP]);
-              ++SP;
-              break;
+              {
+                  Value_t* const a = &Stack[unsigned(SP++) * B];
+                  Value_t* const b = a + B;
+                  for(unsigned i = 0; i < n; ++i)
+                      fp_sinCos(a[i], b[i], a[i]);
+                  break;
+              }
           case cSinhCosh:
-              fp_sinhCosh(Stack[SP], Stack[SP+1], Stack[SP]);
-              ++SP;
-              break;
-
-          case cAbsNot:
-              Stack[SP] = fp_absNot(Stack[SP]); break;
-          case cAbsNotNot:
-              Stack[SP] = fp_absNotNot(Stack[SP]); break;
-          case cAbsAnd:
-              Stack[SP-1] = fp_absAnd(Stack[SP-1], Stack[SP]);
-              --SP; break;
-          case cAbsOr:
-              Stack[SP-1] = fp_absOr(Stack[SP-1], Stack[SP]);
-              --SP; break;
-          case cAbsIf:
-              if(fp_absTruth(Stack[SP--]))
-                  IP += 2;
-              else
               {
-                  const unsigned* buf = &byteCode[IP+1];
-                  IP = buf[0];
-                  DP = buf[1];
+                  Value_t* const a = &Stack[unsigned(SP++) * B];
+                  Value_t* const b = a + B;
+                  for(unsigned i = 0; i < n; ++i)
+                      fp_sinhCosh(a[i], b[i], a[i]);
+                  break;
               }
-              break;
 
-          case   cDup: Stack[SP+1] = Stack[SP]; ++SP; break;
+          case cAbsNot: FP_BATCH_OP(1, fp_absNot(a[i]));
+          case cAbsNotNot: FP_BATCH_OP(1, fp_absNotNot(a[i]));
+          case cAbsAnd: FP_BATCH_OP(2, fp_absAnd(a[i], b[i]));
+          case cAbsOr: FP_BATCH_OP(2, fp_absOr(a[i], b[i]));
+
+          case   cDup:
+              {
+                  const Value_t* const src = &Stack[unsigned(SP) * B];
+                  Value_t* const a = &Stack[unsigned(++SP) * B];
+                  for(unsigned i = 0; i < n; ++i) a[i] = src[i];
+                  break;
+              }
 
           case   cInv:
-              if(Stack[SP] == Value_t(0))
-              { mData->mEvalErrorType=1; return Value_t(0); }
-              Stack[SP] = fp_inv(Stack[SP]);
-              break;
+              FP_BATCH_CHECKED_OP(1, a[i] == Value_t(0), 1, fp_inv(a[i]));
 
-          case   cSqr:
-              Stack[SP] = Stack[SP]*Stack[SP];
-              break;
+          case   cSqr: FP_BATCH_OP(1, a[i] * a[i]);
 
           case   cRDiv:
-              if(Stack[SP-1] == Value_t(0))
-              { mData->mEvalErrorType=1; return Value_t(0); }
-              Stack[SP-1] = Stack[SP] / Stack[SP-1]; --SP; break;
+              FP_BATCH_CHECKED_OP(2, a[i] == Value_t(0), 1, b[i] / a[i]);
 
-          case   cRSub: Stack[SP-1] = Stack[SP] - Stack[SP-1]; --SP; break;
+          case   cRSub: FP_BATCH_OP(2, b[i] - a[i]);
 
           case   cRSqrt:
-              if(Stack[SP] == Value_t(0))
-              { mData->mEvalErrorType=1; return Value_t(0); }
-              Stack[SP] = fp_rsqrt(Stack[SP]); break;
+              FP_BATCH_CHECKED_OP(1, a[i] == Value_t(0), 1, fp_rsqrt(a[i]));
 
 #ifdef FP_SUPPORT_COMPLEX_NUMBERS
-          case   cReal: Stack[SP] = fp_real(Stack[SP]); break;
-          case   cImag: Stack[SP] = fp_imag(Stack[SP]); break;
-          case   cArg:  Stack[SP] = fp_arg(Stack[SP]); break;
-          case   cConj: Stack[SP] = fp_conj(Stack[SP]); break;
-          case   cPolar:
-              Stack[SP-1] = fp_polar(Stack[SP-1], Stack[SP]);
-              --SP; break;
+          case   cReal: FP_BATCH_OP(1, fp_real(a[i]));
+          case   cImag: FP_BATCH_OP(1, fp_imag(a[i]));
+          case   cArg: FP_BATCH_OP(1, fp_arg(a[i]));
+          case   cConj: FP_BATCH_OP(1, fp_conj(a[i]));
+          case   cPolar: FP_BATCH_OP(2, fp_polar(a[i], b[i]));
 #endif
 
 
 // Variables:
           default:
-              Stack[++SP] = Vars[byteCode[IP]-VarBegin];
+              {
+                  const Value_t* const src = Vars[byteCode[IP]-VarBegin];
+                  Value_t* const a = &Stack[unsigned(++SP) * B];
+                  for(unsigned i = 0; i < n; ++i) a[i] = src[i];
+              }
         }
-        //assert(unsigned(SP+1) <= mData->mStackSize);
-        //std::cout << "Stack top: " << SP << "(" << Stack[SP] << ")\n";
     }
+#undef FP_BATCH_CHECKED_OP
+#undef FP_BATCH_OP
+}
 
-    mData->mEvalErrorType=0;
-    return Stack[SP];
+
+//===========================================================================
+// JIT compilation
+//===========================================================================
+namespace
+{
+    // Leaves the data untouched for types and platforms without a JIT.
+    template<typename Value_t>
+    struct JITCompiler
+    {
+        template<typename Data_t>
+        static void compile(Data_t&) {}
+    };
+}
+
+#ifdef FP_SUPPORT_X86_64_JIT
+#include "extrasrc/fp_jit_x86_64.inc"
+#endif
+
+/* The machine code is stored in the data, so a parser sharing its data with
+   copies gets a copy of its own first (through CopyOnWrite()), which the
+   code is then made for. The copies keep the old data without the code.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::CreateJIT()
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+        return false;
+    if(!mData->mJITFunction)
+    {
+        // Other threads may be using the data through copies of the parser
+        CopyOnWrite();
+        JITCompiler<Value_t>::compile(*mData);
+    }
+    return mData->mJITFunction != nullptr;
+}
+
+template<typename Value_t>
+typename FunctionParserBase<Value_t>::JITFunctionPtr
+FunctionParserBase<Value_t>::GetJITFunction() const
+{
+    return mData->mJITFunction;
+}
+
+
+//===========================================================================
+// C++ source generation
+//===========================================================================
+#include <iomanip>
+#include <sstream>
+#include "extrasrc/fp_cpp_source.inc"
+
+/* Nothing is written if the function can't be generated: for the types
+   other than float, double and long double, and for functions which call
+   other functions or use eval().
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::GenerateCppSource(std::ostream& dest,
+                                                    const char* funcName) const
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+        return false;
+    return CppSourceGenerator<Value_t>(funcName).generate(*mData, dest);
+}
+
+
+//===========================================================================
+// Saving and loading compiled code
+//===========================================================================
+#include <cstdint>
+#include "extrasrc/fp_compiled_code.inc"
+
+/* Fails if nothing has been parsed successfully, if Value_t can't be saved,
+   or if the code calls a function which has been removed from the parser.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::SaveCompiled(std::ostream& dest) const
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error ||
+       CompiledCodeTypeTag<Value_t>::value == 0)
+        return false;
+
+    CompiledCode<Value_t> code;
+    if(!code.takeFrom(*mData)) return false;
+    std::string record;
+    code.write(record);
+    dest.write(record.data(), std::streamsize(record.size()));
+    return bool(dest);
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::LoadCompiled(std::istream& source)
+{
+    std::string record(CompiledCodeHeaderSize, '\0');
+    std::size_t payloadSize;
+    if(!source.read(&record[0], CompiledCodeHeaderSize) ||
+       !CompiledCode<Value_t>::readHeader
+       (reinterpret_cast<const unsigned char*>(record.data()), payloadSize))
+        return false;
+
+    // The header has been checked, so the size is at least that of a record
+    // of some sort; the rest is checked when the record is read
+    record.resize(CompiledCodeHeaderSize + payloadSize);
+    if(!source.read(&record[CompiledCodeHeaderSize],
+                    std::streamsize(payloadSize)))
+        return false;
+    return LoadCompiled(record.data(), record.size()) != 0;
+}
+
+/* Loads the record at the beginning of the data, which can be followed by
+   other records, and returns its size, or 0 if it can't be loaded. The
+   functions the code calls are looked up by name. Nothing is changed if
+   loading fails.
+*/
+template<typename Value_t>
+std::size_t FunctionParserBase<Value_t>::LoadCompiled(const void* data,
+                                                      std::size_t size)
+{
+    CompiledCode<Value_t> code;
+    const std::size_t recordSize =
+        code.read(static_cast<const unsigned char*>(data), size);
+    if(recordSize == 0 || !code.mapFunctions(*mData)) return 0;
+
+    // The variables are parsed into a copy, which is dropped on failure
+    Data* const oldData = mData;
+    addReference(oldData->mReferenceCounter);
+    CopyOnWrite();
+    if(!ParseVariables(code.mVariables) ||
+       mData->mVariablesAmount != code.mVariablesAmount)
+    {
+        delete mData;
+        mData = oldData;
+        return 0;
+    }
+    if(releaseReference(oldData->mReferenceCounter)) delete oldData;
+
+    mData->mUseDegreeConversion = (code.mFlags & CompiledCodeFlagDegrees) != 0;
+    mData->mPropagateNaN = (code.mFlags & CompiledCodeFlagNaNPropagation) != 0 &&
+        std::numeric_limits<Value_t>::has_quiet_NaN;
+#ifdef FP_FINITE_MATH_ONLY
+    mData->mPropagateNaN = false;
+#endif
+    mData->mParseErrorType = FunctionParserErrorType::no_error;
+    mEvalErrorType = 0;
+    mData->mInlineVarNames.clear();
+    mData->mByteCode.swap(code.mByteCode);
+    mData->mImmed.swap(code.mImmed);
+    mData->mResultPositions.swap(code.mResultPositions);
+    mData->mStackSize = code.mStackSize;
+#ifdef FP_SUPPORT_OPTIMIZER
+    mData->mRegisterCode.swap(code.mRegisterCode);
+    mData->mRegisterResult = code.mRegisterResult;
+    mData->mResultRegisters.swap(code.mResultRegisters);
+    mData->mIncrementalCode.swap(code.mIncrementalCode);
+    mData->mIncrementalRegisterCount = code.mIncrementalRegisterCount;
+    mData->mIncrementalResult = code.mIncrementalResult;
+    mData->mIncrementalSets.swap(code.mIncrementalSets);
+    mData->mIncrementalCodeVersion = NewIncrementalCodeVersion();
+#endif
+    CreateThreadedCode();
+    return recordSize;
+}
+
+/* Every code made for EvalIncremental() gets a version of its own, so that
+   an EvalContext can tell whether its registers are from that code.
+*/
+template<typename Value_t>
+unsigned long long FunctionParserBase<Value_t>::NewIncrementalCodeVersion()
+{
+    static std::atomic<unsigned long long> versions(0);
+    return ++versions;
+}
+
+
+//===========================================================================
+// Parse cache files
+//===========================================================================
+#if defined(__unix__) || defined(__APPLE__)
+#define FP_SUPPORT_MAPPED_CACHE_FILES
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    // The file of the key: the 64-bit FNV-1a hash of the key in hex
+    std::string cacheFilePath(const std::string& directory,
+                              const std::string& key)
+    {
+        unsigned long long hash = 14695981039346656037ULL;
+        for(std::size_t i = 0; i < key.size(); ++i)
+            hash = (hash ^ (unsigned char)key[i]) * 1099511628211ULL;
+
+        std::ostringstream path;
+        path << directory << '/' << std::hex << std::setw(16)
+             << std::setfill('0') << hash << ".fpc";
+        return path.str();
+    }
+
+    /* A cache file is the size of the key, the key (to tell it from other
+       keys of the same hash) and the record of SaveCompiled().
+    */
+    template<typename Value_t>
+    bool loadCacheFile(FunctionParserBase<Value_t>& parser,
+                       const unsigned char* contents, std::size_t size,
+                       const std::string& key)
+    {
+        std::uint32_t keySize;
+        if(size < sizeof(keySize)) return false;
+        std::memcpy(&keySize, contents, sizeof(keySize));
+        contents += sizeof(keySize);
+        size -= sizeof(keySize);
+        if(keySize != key.size() || size < keySize ||
+           std::memcmp(contents, key.data(), keySize) != 0)
+            return false;
+        return parser.LoadCompiled(contents + keySize, size - keySize)
+            == size - keySize;
+    }
+}
+
+template<typename Value_t>
+void FunctionParserBase<Value_t>::setParseCacheDirectory
+(const std::string& directory)
+{
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    cache.mDirectory = directory;
+}
+
+template<typename Value_t>
+std::string FunctionParserBase<Value_t>::parseCacheDirectory()
+{
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    return cache.mDirectory;
+}
+
+/* The key of the code Optimize() would make of the current code in the
+   cache files, or an empty string if they aren't used. Unlike the key of
+   the parse cache, it's made of the bytecode, which Parse() makes the same
+   for any spacing of the function, and it tells the called functions by
+   their names rather than their indices and addresses, so that other
+   processes can use the files.
+*/
+template<typename Value_t>
+std::string FunctionParserBase<Value_t>::CacheFileKey() const
+{
+    std::vector<std::size_t> calls;
+    if(CompiledCodeTypeTag<Value_t>::value == 0
+    || mData->mParseErrorType != FunctionParserErrorType::no_error
+    || parseCacheDirectory().empty()
+    || !findFunctionCalls(mData->mByteCode, calls))
+        return std::string();
+
+    std::vector<std::string> funcNames(mData->mFuncPtrs.size()),
+        parserNames(mData->mFuncParsers.size());
+    for(typename NamePtrsMap<Value_t>::const_iterator
+            i = mData->mNamePtrs.begin(); i != mData->mNamePtrs.end(); ++i)
+    {
+        if(i->second.type == NameData<Value_t>::FUNC_PTR)
+            funcNames[i->second.index].assign(i->first.name,
+                                              i->first.nameLength);
+        else if(i->second.type == NameData<Value_t>::PARSER_PTR)
+            parserNames[i->second.index].assign(i->first.name,
+                                                i->first.nameLength);
+    }
+
+    std::ostringstream key;
+    key << std::hexfloat << "Optimize()" << '\0'
+        << CompiledCodeTypeTag<Value_t>::value << ' ' << sizeof(Value_t)
+        << ' ' << unsigned(VarBegin) << '\0' << mData->mVariablesString
+        << '\0' << mData->mUseDegreeConversion << mData->mPropagateNaN
+        << ' ' << epsilon() << '\0';
+    for(std::size_t i = 0, call = 0; i < mData->mByteCode.size(); ++i)
+    {
+        if(call < calls.size() && i == calls[call] + 1)
+        {
+            const unsigned index = mData->mByteCode[i];
+            const bool isParser = mData->mByteCode[calls[call++]] == cPCall;
+            key << (isParser ? parserNames[index] : funcNames[index]) << '/'
+                << (isParser ? mData->mFuncParsers[index].mNumParams :
+                    mData->mFuncPtrs[index].mNumParams) << ' ';
+        }
+        else
+            key << mData->mByteCode[i] << ' ';
+    }
+    key << '\0';
+    for(std::size_t i = 0; i < mData->mImmed.size(); ++i)
+        key << mData->mImmed[i] << ' ';
+    return key.str();
+}
+
+/* Replaces the code with the one in the cache file of the key, returning
+   false if there is no valid file. The files are never changed once
+   written (see SaveToCacheFile()), so they are read without locking.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::LoadFromCacheFile(const std::string& key)
+{
+    if(key.empty()) return false;
+    const std::string path = cacheFilePath(parseCacheDirectory(), key);
+
+    bool loaded = false;
+#ifdef FP_SUPPORT_MAPPED_CACHE_FILES
+    const int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0) return false;
+    struct stat status;
+    void* contents = MAP_FAILED;
+    if(fstat(fd, &status) == 0 && status.st_size > 0)
+        contents = mmap(0, std::size_t(status.st_size), PROT_READ,
+                        MAP_SHARED, fd, 0);
+    close(fd);
+    if(contents == MAP_FAILED) return false;
+    loaded = loadCacheFile(*this, static_cast<unsigned char*>(contents),
+                           std::size_t(status.st_size), key);
+    munmap(contents, std::size_t(status.st_size));
+#else
+    std::ifstream file(path.c_str(), std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    loaded = loadCacheFile
+        (*this, reinterpret_cast<const unsigned char*>(contents.data()),
+         contents.size(), key);
+#endif
+
+    if(loaded)
+    {
+        ParseCache& cache = ParseCache::instance();
+        std::lock_guard<std::mutex> lock(cache.mMutex);
+        ++cache.mStatistics.fileHits;
+    }
+    return loaded;
+}
+
+/* Writes the code to the cache file of the key. The file is written under
+   a name of its own and then renamed, which replaces any file of the same
+   name at once, so other processes never see a partly written file.
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::SaveToCacheFile(const std::string& key) const
+{
+    if(key.empty()) return;
+
+    std::ostringstream contents;
+    const std::uint32_t keySize = std::uint32_t(key.size());
+    contents.write(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+    contents << key;
+    if(!SaveCompiled(contents)) return;
+
+    static std::atomic<unsigned> tempFileCounter(0);
+    const std::string path = cacheFilePath(parseCacheDirectory(), key);
+    std::ostringstream tempPath;
+    tempPath << path << '.'
+#ifdef FP_SUPPORT_MAPPED_CACHE_FILES
+             << getpid() << '.'
+#endif
+             << std::this_thread::get_id() << '.' << ++tempFileCounter
+             << ".tmp";
+
+    std::ofstream file(tempPath.str().c_str(), std::ios::binary);
+    const std::string data = contents.str();
+    file.write(data.data(), std::streamsize(data.size()));
+    file.close();
+    if(!file || std::rename(tempPath.str().c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.str().c_str());
+        return;
+    }
+
+    ParseCache& cache = ParseCache::instance();
+    std::lock_guard<std::mutex> lock(cache.mMutex);
+    ++cache.mStatistics.fileWrites;
 }
 
 
@@ -3125,10 +7808,44 @@ void FunctionParserBase<Value_t>::InjectRawByteCode
     mData->mByteCode.assign(bytecode, bytecode + bytecodeAmount);
     mData->mImmed.assign(immed, immed + immedAmount);
     mData->mStackSize = stackSize;
+    mData->mResultPositions.clear();
+#ifdef FP_SUPPORT_OPTIMIZER
+    mData->mRegisterCode.clear();
+    mData->mIncrementalCode.clear();
+#endif
 
-#ifndef FP_USE_THREAD_SAFE_EVAL
-    mData->mStack.resize(stackSize);
+    CreateThreadedCode();
+}
+
+template<typename Value_t>
+Value_t FunctionParserBase<Value_t>::EvalWithoutThreadedCode
+(const Value_t* Vars)
+{
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error)
+        return Value_t(0);
+
+    // The stack is allocated in the same way as in Eval()
+#ifdef FP_USE_THREAD_SAFE_EVAL
+  #ifdef FP_USE_THREAD_SAFE_EVAL_WITH_ALLOCA
+    Value_t* const Stack = (Value_t*)alloca(mData->mStackSize*sizeof(Value_t));
+  #else
+    struct AutoDealloc
+    {
+        Value_t* ptr;
+        ~AutoDealloc() { delete[] ptr; }
+    } AutoDeallocStack = { new Value_t[mData->mStackSize] };
+    Value_t*& Stack = AutoDeallocStack.ptr;
+  #endif
+#else
+    if(mStack.size() < mData->mStackSize) mStack.resize(mData->mStackSize);
+    Value_t* const Stack = mStack.data();
 #endif
+
+    if(mData->mPropagateNaN)
+        return EvalBySwitch<false>(EvalCode(*mData), Stack, Vars,
+                                   mEvalErrorType, 0);
+    return EvalBySwitch<true>(EvalCode(*mData), Stack, Vars,
+                              mEvalErrorType, 0);
 }
 
 //===========================================================================
@@ -3815,6 +8532,34 @@ void FunctionParserBase<Value_t>::Optimize()
 {
     // Do nothing if no optimizations are supported.
 }
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Differentiate(unsigned)
+{
+    // Differentiation works on the trees of the optimizer.
+    return false;
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Gradient()
+{
+    return false;
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Combine
+(const std::vector<const FunctionParserBase*>&)
+{
+    return false;
+}
+
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Specialize
+(const std::vector<std::pair<unsigned, Value_t> >&)
+{
+    // The variables are substituted in the trees of the optimizer.
+    return false;
+}
 #endif
 
 
@@ -13,6 +13,9 @@
 
 #include <string>
 #include <vector>
+#include <utility>
+#include <iosfwd>
+#include <atomic>
 
 #ifdef FUNCTIONPARSER_SUPPORT_DEBUGGING
 #include <iostream>
@@ -71,6 +74,22 @@ class FunctionParserBase
     static Value_t epsilon();
     static void setEpsilon(Value_t);
 
+    void setNaNPropagation(bool);
+    bool nanPropagation() const;
+
+    struct ParseCacheStatistics
+    {
+        std::size_t hits, misses, evictions, entries;
+        std::size_t fileHits, fileWrites;
+    };
+
+    static void setParseCacheSize(std::size_t maxEntries);
+    static std::size_t parseCacheSize();
+    static void setParseCacheDirectory(const std::string& directory);
+    static std::string parseCacheDirectory();
+    static ParseCacheStatistics parseCacheStatistics();
+    static void clearParseCache();
+
     const char* ErrorMsg() const;
 
     [[deprecated("Use ParseError() instead")]] ParseErrorType GetParseErrorType() const;
@@ -79,13 +98,36 @@ class FunctionParserBase
     Value_t Eval(const Value_t* Vars);
     int EvalError() const;
 
+    class EvalContext;
+
+    Value_t Eval(EvalContext&, const Value_t* Vars) const;
+    Value_t Eval(const Value_t* Vars, int* evalError) const;
+    Value_t EvalIncremental(EvalContext&, const Value_t* Vars,
+                            unsigned long long changedVariables) const;
+
+    class CompiledExpression;
+
+    void EvalBatch(const Value_t* Vars, std::size_t stride,
+                   std::size_t count, Value_t* results);
+    void EvalBatch(const Value_t* const* Vars, std::size_t count,
+                   Value_t* results);
+    void EvalBatchParallel(const Value_t* Vars, std::size_t stride,
+                           std::size_t count, Value_t* results,
+                           unsigned threadsAmount = 0);
+    void EvalBatchParallel(const Value_t* const* Vars, std::size_t count,
+                           Value_t* results, unsigned threadsAmount = 0);
+
     bool AddConstant(const std::string& name, Value_t value);
     bool AddUnit(const std::string& name, Value_t value);
 
     typedef Value_t (*FunctionPtr)(const Value_t*);
+    typedef void (*BatchFunctionPtr)(const Value_t* const* params,
+                                     std::size_t n, Value_t* results);
 
     bool AddFunction(const std::string& name,
                      FunctionPtr, unsigned paramsAmount);
+    bool AddFunction(const std::string& name,
+                     BatchFunctionPtr, unsigned paramsAmount);
     bool AddFunction(const std::string& name, FunctionParserBase&);
 
     class FunctionWrapper;
@@ -99,6 +141,32 @@ class FunctionParserBase
     bool RemoveIdentifier(const std::string& name);
 
     void Optimize();
+    bool Differentiate(unsigned variableIndex);
+    bool Gradient();
+    bool Combine(const std::vector<const FunctionParserBase*>& parsers);
+    bool Specialize
+    (const std::vector<std::pair<unsigned, Value_t> >& fixedVariables);
+
+    unsigned GetResultAmount() const;
+    void EvalAll(const Value_t* Vars, Value_t* results);
+    void EvalAll(EvalContext&, const Value_t* Vars, Value_t* results) const;
+
+    Value_t EvalWithGradient(const Value_t* Vars, Value_t* gradient);
+
+    struct Interval;
+
+    Interval EvalInterval(const Interval* Vars);
+
+    typedef Value_t (*JITFunctionPtr)(const Value_t* Vars, int* evalError);
+
+    bool CreateJIT();
+    JITFunctionPtr GetJITFunction() const;
+
+    bool GenerateCppSource(std::ostream& dest, const char* funcName) const;
+
+    bool SaveCompiled(std::ostream& dest) const;
+    bool LoadCompiled(std::istream& source);
+    std::size_t LoadCompiled(const void* data, std::size_t size);
 
 
     int ParseAndDeduceVariables(const std::string& function,
@@ -135,6 +203,10 @@ class FunctionParserBase
                            unsigned stackSize);
 
     void PrintByteCode(std::ostream& dest, bool showExpression = true) const;
+
+    // Evaluates with the switch-based interpreter even if Eval() would use
+    // threaded code. Used for benchmarking the two against each other.
+    Value_t EvalWithoutThreadedCode(const Value_t* Vars);
 #endif
 
 
@@ -159,6 +231,13 @@ class FunctionParserBase
     Data* mData;
     unsigned mStackPtr;
 
+    /* The evaluation state is kept in each instance rather than in the data,
+       so that copies sharing the data can be evaluated by different threads.
+       The stack isn't used if Eval() is made thread-safe.
+    */
+    int mEvalErrorType;
+    std::vector<Value_t> mStack;
+
 
 // Private methods:
 // ---------------
@@ -166,6 +245,13 @@ class FunctionParserBase
     bool CheckRecursiveLinking(const FunctionParserBase*) const;
     bool NameExists(const char*, unsigned);
     bool ParseVariables(const std::string&);
+    struct ParseCache;
+    std::string ParseCacheKey(const char*, const std::string&, bool) const;
+    bool TakeFromParseCache(const std::string&);
+    void PutInParseCache(const std::string&);
+    std::string CacheFileKey() const;
+    bool LoadFromCacheFile(const std::string&);
+    void SaveToCacheFile(const std::string&) const;
     int ParseFunction(const char*, bool);
     const char* SetErrorType(FunctionParserErrorType, const char*);
 
@@ -195,6 +281,44 @@ class FunctionParserBase
     inline void PutOpcodeParamAt(unsigned, unsigned offset);
     const char* Compile(const char*);
 
+    struct CodeArrays;
+    struct EvalCode;
+    Value_t EvalWithStack(Value_t*, const Value_t*, int&, EvalContext*) const;
+    static Value_t EvalCodeWithStack(EvalCode, bool, Value_t*,
+                                     const Value_t*, int&, EvalContext*);
+    template<bool checkDomain>
+    static Value_t EvalBySwitch(EvalCode, Value_t*, const Value_t*,
+                                int&, EvalContext*);
+    template<bool checkDomain>
+    static Value_t EvalThreaded(EvalCode, Value_t*, const Value_t*,
+                                int&, EvalContext*);
+    template<bool checkDomain>
+    static Value_t EvalRegisters(EvalCode, Value_t*, const Value_t*,
+                                 int&, EvalContext*);
+    Value_t EvalIncrementalRegisters(EvalContext&, const Value_t*) const;
+    void CreateThreadedCode();
+
+    struct GradientTape;
+    Value_t RecordTape(GradientTape&, unsigned, unsigned, int&) const;
+    struct IntervalStack;
+    int EvalIntervalCode(IntervalStack&, unsigned, unsigned) const;
+    int EvalIntervalRange(IntervalStack&, unsigned, unsigned,
+                          unsigned, unsigned, unsigned&, int&) const;
+    void StoreResults(const Value_t*, const Value_t&, int, Value_t*) const;
+    void SetOptimizedCode(std::vector<unsigned>&, std::vector<Value_t>&,
+                          std::size_t, std::vector<unsigned>&);
+    static unsigned long long NewIncrementalCodeVersion();
+    struct BatchBuffers;
+    void EvalBatchImpl(const Value_t*, std::size_t, const Value_t* const*,
+                       std::size_t, Value_t*, unsigned);
+    int EvalBatchRows(const Value_t*, std::size_t, const Value_t* const*,
+                      std::size_t, unsigned, Value_t*, BatchBuffers&) const;
+    void EvalBlock(const Value_t* const*, unsigned, Value_t*,
+                   BatchBuffers&) const;
+    void EvalBlockRange(const Value_t* const*, unsigned, Value_t*, int*,
+                        BatchBuffers&, unsigned, unsigned, unsigned,
+                        unsigned&, int&) const;
+
     bool addFunctionWrapperPtr(const std::string&, FunctionWrapper*, unsigned);
     static void incFuncWrapperRefCount(FunctionWrapper*);
     static unsigned decFuncWrapperRefCount(FunctionWrapper*);
@@ -236,7 +360,7 @@ class FunctionParser_cld: public FunctionParserBase<std::complex<long double> >
 template<typename Value_t>
 class FunctionParserBase<Value_t>::FunctionWrapper
 {
-    unsigned mReferenceCount;
+    std::atomic<unsigned> mReferenceCount;
     friend class FunctionParserBase<Value_t>;
 
  public:
@@ -246,6 +370,81 @@ class FunctionParserBase<Value_t>::FunctionWrapper
     FunctionWrapper& operator=(const FunctionWrapper&) { return *this; }
 
     virtual Value_t callFunction(const Value_t*) = 0;
+
+    /* Called by EvalBatch() with a block of n rows, params[p][i] being the
+       parameter p of the row i. Returns false to have callFunction() called
+       for each row instead, which is what the default implementation does.
+    */
+    virtual bool callFunctionBatch(const Value_t* const* /*params*/,
+                                   std::size_t /*n*/, Value_t* /*results*/)
+    { return false; }
+};
+
+/* The evaluation stack and error code of Eval(EvalContext&, const Value_t*).
+   The stack grows to the needed size on the first evaluation and is then
+   reused, so a thread can keep one context for all its evaluations.
+*/
+template<typename Value_t>
+class FunctionParserBase<Value_t>::EvalContext
+{
+    std::vector<Value_t> mStack;
+    std::vector<EvalContext> mNestedContexts; // for functions parsers call
+    int mEvalErrorType;
+
+    // The registers kept by EvalIncremental(), and the instructions whose
+    // results in them may be out of date, as bits
+    std::vector<Value_t> mIncrementalRegisters;
+    std::vector<unsigned long long> mStaleInstructions;
+    unsigned long long mIncrementalCodeVersion;
+    friend class FunctionParserBase<Value_t>;
+    friend class FunctionParserBase<Value_t>::CompiledExpression;
+
+ public:
+    EvalContext(): mEvalErrorType(0), mIncrementalCodeVersion(0) {}
+
+    int EvalError() const { return mEvalErrorType; }
+};
+
+/* An immutable copy of the code (the bytecode, and the threaded code and
+   register code made from it), immediates, stack size and functions of a
+   parser, kept in one cache-aligned allocation. It stays valid when
+   the parser is changed or destroyed, and copies of it share the
+   allocation. Nothing is written to it by Eval(), so any number of threads
+   can evaluate it simultaneously without locking, each with its own
+   context.
+*/
+template<typename Value_t>
+class FunctionParserBase<Value_t>::CompiledExpression
+{
+    struct Block;
+    Block* mBlock;
+
+    void ReleaseBlock();
+
+ public:
+    CompiledExpression(): mBlock(nullptr) {}
+    explicit CompiledExpression(const FunctionParserBase&);
+    CompiledExpression(const CompiledExpression&);
+    CompiledExpression& operator=(const CompiledExpression&);
+    ~CompiledExpression();
+
+    bool empty() const { return !mBlock; }
+
+    Value_t Eval(EvalContext&, const Value_t* Vars) const;
+    Value_t Eval(const Value_t* Vars, int* evalError = 0) const;
+};
+
+/* A range of values from lower to upper (inclusive), for EvalInterval().
+*/
+template<typename Value_t>
+struct FunctionParserBase<Value_t>::Interval
+{
+    Value_t lower, upper;
+
+    Interval(): lower(), upper() {}
+    Interval(const Value_t& value): lower(value), upper(value) {}
+    Interval(const Value_t& lowerBound, const Value_t& upperBound):
+        lower(lowerBound), upper(upperBound) {}
 };
 
 template<typename Value_t>
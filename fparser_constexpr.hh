@@ -0,0 +1,1053 @@
+/***************************************************************************\
+|* Function Parser for C++ v5.0.0                                          *|
+|*-------------------------------------------------------------------------*|
+|* Copyright: Juha Nieminen, Joel Yliluoma                                 *|
+|*                                                                         *|
+|* This library is distributed under the terms of the                      *|
+|* GNU Lesser General Public License version 3.                            *|
+|* (See lgpl.txt and gpl.txt for the license text.)                        *|
+\***************************************************************************/
+
+/* Parses a function string at compile time into an expression template,
+   which the compiler can inline and optimize like hand-written code. Needs
+   C++17. The function and its variables are given by a type:
+
+       struct Gauss
+       {
+           static constexpr const char* function = "exp(-(x*x+y*y)/2)";
+           static constexpr const char* variables = "x,y";
+       };
+       double value = FunctionParserConstexpr<double, Gauss>::Eval(vars);
+
+   or with C++20 directly as template arguments:
+
+       FunctionParserConstexpr<double, FunctionSource<"exp(-x*x)", "x"> >
+
+   See the documentation for the details.
+*/
+
+#ifndef ONCE_FPARSER_CONSTEXPR_H_
+#define ONCE_FPARSER_CONSTEXPR_H_
+
+#include "extrasrc/fpaux.hh"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace FUNCTIONPARSERTYPES
+{
+namespace ConstexprParsing
+{
+    /* Not constexpr: calling this in the compile-time parsing makes the
+       compilation fail, and the diagnostics show the call with the
+       message. */
+    inline void parseError(const char* /*message*/, unsigned /*position*/) {}
+
+    struct FunctionInfo
+    {
+        const char* name;
+        unsigned opcode, params, flags;
+    };
+
+    inline constexpr FunctionInfo functions[] =
+    {
+#define o(code, funcname, nparams, options) \
+        { #funcname, code, nparams, options },
+        FUNCTIONPARSER_LIST_FUNCTION_OPCODES(o)
+#undef o
+    };
+
+    constexpr unsigned length(const char* str)
+    {
+        unsigned result = 0;
+        while(str[result]) ++result;
+        return result;
+    }
+
+    // The length of the space character at the position, as SkipSpace()
+    constexpr unsigned spaceLength(const char* str, unsigned pos)
+    {
+        const unsigned char c0 = (unsigned char) str[pos];
+        if(c0 == ' ' || c0 == '\t' || c0 == '\n' || c0 == '\r' || c0 == '\v')
+            return 1;
+        if(c0 == 0xC2 && (unsigned char) str[pos+1] == 0xA0) return 2;
+        if(c0 == 0xE2 || c0 == 0xE3)
+        {
+            const unsigned char c1 = (unsigned char) str[pos+1];
+            if(c1 == 0) return 0;
+            const unsigned char c2 = (unsigned char) str[pos+2];
+            if(c0 == 0xE3) return c1 == 0x80 && c2 == 0x80 ? 3 : 0;
+            if(c1 == 0x80 && (c2 <= 0x8B || c2 == 0xAF)) return 3;
+            if(c1 == 0x81 && c2 == 0x9F) return 3;
+        }
+        return 0;
+    }
+
+    // The length of the identifier at the position, or 0
+    constexpr unsigned identifierLength(const char* str, unsigned pos)
+    {
+        unsigned result = 0;
+        while(true)
+        {
+            const unsigned char c = (unsigned char) str[pos + result];
+            if((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'
+            || (result > 0 && c >= '0' && c <= '9')
+            || (c >= 0x80 && spaceLength(str, pos + result) == 0))
+                ++result;
+            else
+                return result;
+        }
+    }
+
+    constexpr bool equalNames(const char* a, unsigned aLength,
+                              const char* b, unsigned bLength)
+    {
+        if(aLength != bLength) return false;
+        for(unsigned i = 0; i < aLength; ++i)
+            if(a[i] != b[i]) return false;
+        return true;
+    }
+
+    /* The function of the given name, or 0. The functions only for the
+       complex types are identifiers like any others. */
+    constexpr const FunctionInfo* findFunction(const char* name,
+                                               unsigned nameLength)
+    {
+        for(const FunctionInfo& info: functions)
+            if(!(info.flags & FunctionFlag::ComplexOnly)
+            && equalNames(info.name, length(info.name), name, nameLength))
+                return &info;
+        return 0;
+    }
+
+    //========================================================================
+    // Literals
+    //========================================================================
+    /* The literals are converted exactly like the runtime parser converts
+       them with strtod() and strtold(), that is, correctly rounded. The
+       float literals are converted to double first, as at runtime. */
+    template<typename Value_t>
+    struct LiteralType { typedef double type; };
+
+#if defined(FP_USE_STRTOLD) || defined(FP_SUPPORT_CPLUSPLUS11_MATH_FUNCS)
+    template<>
+    struct LiteralType<long double> { typedef long double type; };
+#endif
+
+    template<unsigned Limbs>
+    struct BigInt
+    {
+        std::uint32_t limb[Limbs];
+        unsigned size;
+
+        constexpr BigInt(): limb(), size(0) {}
+
+        constexpr bool isZero() const { return size == 0; }
+
+        constexpr void trim() { while(size > 0 && limb[size-1] == 0) --size; }
+
+        constexpr void mulAdd(std::uint32_t factor, std::uint32_t addend)
+        {
+            std::uint64_t carry = addend;
+            for(unsigned i = 0; i < size; ++i)
+            {
+                carry += std::uint64_t(limb[i]) * factor;
+                limb[i] = std::uint32_t(carry);
+                carry >>= 32;
+            }
+            if(carry != 0) limb[size++] = std::uint32_t(carry);
+        }
+
+        constexpr unsigned bitLength() const
+        {
+            if(size == 0) return 0;
+            unsigned result = (size - 1) * 32;
+            for(std::uint32_t top = limb[size-1]; top != 0; top >>= 1)
+                ++result;
+            return result;
+        }
+
+        constexpr bool bit(unsigned index) const
+        {
+            return index / 32 < size && ((limb[index/32] >> index % 32) & 1);
+        }
+
+        constexpr void setBit(unsigned index)
+        {
+            while(size <= index / 32) limb[size++] = 0;
+            limb[index/32] |= std::uint32_t(1) << index % 32;
+        }
+
+        // Tells if any of the bits below the index are set
+        constexpr bool anyBitBelow(unsigned index) const
+        {
+            for(unsigned i = 0; i < index && i / 32 < size; ++i)
+                if(bit(i)) return true;
+            return false;
+        }
+
+        // The bits from the index upwards, at most 64 of them
+        constexpr std::uint64_t bitsFrom(unsigned index) const
+        {
+            std::uint64_t result = 0;
+            for(unsigned i = 0; i < 64; ++i)
+                if(bit(index + i)) result |= std::uint64_t(1) << i;
+            return result;
+        }
+
+        constexpr void shiftLeft(unsigned amount)
+        {
+            if(size == 0) return;
+            const unsigned limbShift = amount / 32, bitShift = amount % 32;
+            const unsigned newSize = size + limbShift + 1;
+            for(unsigned i = newSize; i-- > 0; )
+            {
+                std::uint64_t value = 0;
+                if(i >= limbShift && i - limbShift < size)
+                    value = std::uint64_t(limb[i - limbShift]) << bitShift;
+                if(bitShift != 0 && i >= limbShift + 1
+                && i - limbShift - 1 < size)
+                    value |= limb[i - limbShift - 1] >> (32 - bitShift);
+                limb[i] = std::uint32_t(value);
+            }
+            size = newSize;
+            trim();
+        }
+
+        constexpr void shiftRightByOne()
+        {
+            for(unsigned i = 0; i < size; ++i)
+                limb[i] = (limb[i] >> 1) |
+                    (i + 1 < size ? limb[i+1] << 31 : 0);
+            trim();
+        }
+
+        constexpr bool lessThan(const BigInt& other) const
+        {
+            if(size != other.size) return size < other.size;
+            for(unsigned i = size; i-- > 0; )
+                if(limb[i] != other.limb[i]) return limb[i] < other.limb[i];
+            return false;
+        }
+
+        // Requires *this >= other
+        constexpr void subtract(const BigInt& other)
+        {
+            std::int64_t borrow = 0;
+            for(unsigned i = 0; i < size; ++i)
+            {
+                std::int64_t value = std::int64_t(limb[i]) - borrow -
+                    (i < other.size ? std::int64_t(other.limb[i]) : 0);
+                borrow = value < 0;
+                limb[i] = std::uint32_t(value + (borrow << 32));
+            }
+            trim();
+        }
+    };
+
+    // value * 2^exponent, where the result is exactly representable
+    template<typename T>
+    constexpr T scaleByPowerOfTwo(T value, int exponent)
+    {
+        for(; exponent >= 30; exponent -= 30) value *= T(1 << 30);
+        for(; exponent <= -30; exponent += 30) value /= T(1 << 30);
+        return exponent >= 0 ? value * T(1 << exponent)
+                             : value / T(1 << -exponent);
+    }
+
+    /* Rounds value * 2^exponent to T, to nearest with ties to even.
+       "inexact" tells that the exact number is slightly above that; the
+       value then has to have at least two bits more than the mantissa. */
+    template<typename T, unsigned Limbs>
+    constexpr T roundToFloat(const BigInt<Limbs>& value, int exponent,
+                             bool inexact)
+    {
+        typedef std::numeric_limits<T> Limits;
+        const int bits = int(value.bitLength());
+        if(bits == 0) return T(0);
+
+        // The exponent of the lowest bit kept in the mantissa
+        int low = bits + exponent - Limits::digits;
+        if(low < Limits::min_exponent - Limits::digits)
+            low = Limits::min_exponent - Limits::digits;
+
+        std::uint64_t mantissa = 0;
+        if(low <= exponent)
+            mantissa = value.bitsFrom(0) << (exponent - low);
+        else
+        {
+            const unsigned drop = unsigned(low - exponent);
+            mantissa = value.bitsFrom(drop);
+            const bool roundBit = value.bit(drop - 1);
+            const bool sticky = inexact || value.anyBitBelow(drop - 1);
+            if(roundBit && (sticky || (mantissa & 1)))
+            {
+                if(++mantissa == 0)
+                {
+                    mantissa = std::uint64_t(1) << 63;
+                    ++low;
+                }
+            }
+        }
+        if(mantissa == 0) return T(0);
+
+        int topBit = low;
+        for(std::uint64_t m = mantissa; m > 1; m >>= 1) ++topBit;
+        if(topBit >= Limits::max_exponent) return Limits::infinity();
+        return scaleByPowerOfTwo(T(mantissa), low);
+    }
+
+    template<typename T>
+    constexpr int exactPowersOfTen()
+    {
+        // 10^n is exact when 5^n fits in the mantissa
+        const std::uint64_t limit = std::numeric_limits<T>::digits >= 64
+            ? ~std::uint64_t(0)
+            : (std::uint64_t(1) << std::numeric_limits<T>::digits) - 1;
+        int result = 0;
+        for(std::uint64_t power = 1; power <= limit / 5; power *= 5)
+            ++result;
+        return result;
+    }
+
+    template<typename T>
+    struct LiteralConverter
+    {
+        typedef std::numeric_limits<T> Limits;
+
+        // The significant digits used; any others only affect the rounding
+        static constexpr int MaxDigits = 800;
+        static constexpr int MaxDecimalExponent =
+            Limits::max_exponent10 + Limits::max_digits10 + 5;
+        static constexpr unsigned Limbs =
+            unsigned((MaxDecimalExponent + MaxDigits + 2) * 3322 / 1000
+                     + Limits::digits + 70) / 32 + 2;
+        typedef BigInt<Limbs> Integer;
+
+        // digits * 10^exponent10, where there are digitCount digits
+        static constexpr T fromDecimal(Integer digits, int digitCount,
+                                       int exponent10)
+        {
+            if(digits.isZero()) return T(0);
+            if(digitCount + exponent10 > Limits::max_exponent10 + 1)
+                return Limits::infinity();
+            if(digitCount + exponent10 < -MaxDecimalExponent)
+                return T(0);
+
+            const int exactPowers = exactPowersOfTen<T>();
+            if(int(digits.bitLength()) <= Limits::digits
+            && exponent10 <= exactPowers && exponent10 >= -exactPowers)
+            {
+                // A single correctly rounded operation
+                T power = 1;
+                for(int i = 0; i < exponent10 || i < -exponent10; ++i)
+                    power *= 10;
+                const T value = T(digits.bitsFrom(0));
+                return exponent10 >= 0 ? value * power : value / power;
+            }
+
+            if(exponent10 >= 0)
+            {
+                for(int i = 0; i < exponent10; ++i) digits.mulAdd(10, 0);
+                return roundToFloat<T>(digits, 0, false);
+            }
+
+            // Long division by 10^-exponent10, with enough bits in the
+            // quotient for the rounding
+            Integer divisor;
+            divisor.mulAdd(1, 1);
+            for(int i = 0; i < -exponent10; ++i) divisor.mulAdd(10, 0);
+            int shift = int(divisor.bitLength()) - int(digits.bitLength())
+                + Limits::digits + 2;
+            if(shift < 0) shift = 0;
+            digits.shiftLeft(unsigned(shift));
+            const int quotientBits =
+                int(digits.bitLength()) - int(divisor.bitLength());
+            divisor.shiftLeft(unsigned(quotientBits));
+            Integer quotient;
+            for(int bit = quotientBits; bit >= 0; --bit)
+            {
+                if(!digits.lessThan(divisor))
+                {
+                    digits.subtract(divisor);
+                    quotient.setBit(unsigned(bit));
+                }
+                divisor.shiftRightByOne();
+            }
+            return roundToFloat<T>(quotient, -shift, !digits.isZero());
+        }
+    };
+
+    constexpr int hexDigit(char c)
+    {
+        return c >= '0' && c <= '9' ? c - '0'
+             : c >= 'a' && c <= 'f' ? c - 'a' + 10
+             : c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+    }
+
+    /* Reads the literal at the position, as strtod() would. Returns the
+       length of the literal, or 0 if there is none. */
+    template<typename T>
+    constexpr unsigned parseLiteral(const char* str, unsigned pos, T& result)
+    {
+        typedef LiteralConverter<T> Converter;
+        typename Converter::Integer digits;
+        const unsigned begin = pos;
+        /* The value is digits * base^exponent, times 10^powerExponent or
+           2^powerExponent for hexadecimal literals */
+        int digitCount = 0, exponent = 0, powerExponent = 0;
+        bool truncated = false, anyDigits = false;
+
+        const bool hex = str[pos] == '0' && (str[pos+1] | 0x20) == 'x'
+            && (hexDigit(str[pos+2]) >= 0
+                || (str[pos+2] == '.' && hexDigit(str[pos+3]) >= 0));
+        const unsigned base = hex ? 16 : 10;
+        // The digits stored; 40 hexadecimal digits are more than enough
+        const int maxDigits = hex ? 40 : Converter::MaxDigits;
+        if(hex) pos += 2;
+
+        for(bool fraction = false; ; ++pos)
+        {
+            const char c = str[pos];
+            if(c == '.' && !fraction)
+            {
+                fraction = true;
+                continue;
+            }
+            const int d = hex ? hexDigit(c)
+                              : (c >= '0' && c <= '9' ? c - '0' : -1);
+            if(d < 0) break;
+
+            anyDigits = true;
+            if(digits.isZero() && d == 0)
+            {
+                if(fraction) --exponent;
+            }
+            else if(digitCount < maxDigits)
+            {
+                digits.mulAdd(base, std::uint32_t(d));
+                ++digitCount;
+                if(fraction) --exponent;
+            }
+            else
+            {
+                if(!fraction) ++exponent;
+                if(d != 0) truncated = true;
+            }
+        }
+        if(!anyDigits) return 0;
+
+        // The exponent, which is binary for hexadecimal literals
+        const char expChar = hex ? 'p' : 'e';
+        if((str[pos] | 0x20) == expChar)
+        {
+            unsigned expPos = pos + 1;
+            const bool negative = str[expPos] == '-';
+            if(str[expPos] == '-' || str[expPos] == '+') ++expPos;
+            if(str[expPos] >= '0' && str[expPos] <= '9')
+            {
+                int value = 0;
+                for(; str[expPos] >= '0' && str[expPos] <= '9'; ++expPos)
+                    if(value < 100000) value = value * 10 + (str[expPos] - '0');
+                powerExponent = negative ? -value : value;
+                pos = expPos;
+            }
+        }
+
+        if(hex)
+        {
+            const int binaryExponent = exponent * 4 + powerExponent;
+            if(digits.isZero())
+                result = T(0);
+            else if(int(digits.bitLength()) + binaryExponent >
+                    std::numeric_limits<T>::max_exponent + 1)
+                result = std::numeric_limits<T>::infinity();
+            else if(int(digits.bitLength()) + binaryExponent <
+                    std::numeric_limits<T>::min_exponent
+                    - std::numeric_limits<T>::digits - 2)
+                result = T(0);
+            else
+                result = roundToFloat<T>(digits, binaryExponent, truncated);
+            return pos - begin;
+        }
+
+        exponent += powerExponent;
+        if(truncated)
+        {
+            // Stands for the dropped digits in the rounding
+            digits.mulAdd(10, 1);
+            ++digitCount;
+            --exponent;
+        }
+        result = Converter::fromDecimal(digits, digitCount, exponent);
+        return pos - begin;
+    }
+
+    //========================================================================
+    // Parsing
+    //========================================================================
+    template<typename Value_t>
+    struct Node
+    {
+        /* An OPCODE, VarBegin + the index of a variable, or cFetch for an
+           inline variable "name := value;" */
+        unsigned opcode;
+        // The parameter nodes, or for cFetch the index of the inline variable
+        unsigned params[3];
+        Value_t value; // of cImmed
+    };
+
+    template<typename Value_t, unsigned Capacity>
+    struct Program
+    {
+        Node<Value_t> nodes[Capacity];
+        unsigned nodeCount, root, variableCount;
+        // The value nodes of the inline variables, evaluated in this order
+        unsigned inlineVariables[Capacity];
+        unsigned inlineVariableCount;
+    };
+
+    /* Follows the grammar of FunctionParserBase::Compile() and its helper
+       functions, operator by operator. */
+    template<typename Value_t, unsigned Capacity>
+    class Parser
+    {
+     public:
+        constexpr Parser(const char* function, const char* variables,
+                         bool useDegrees):
+            mFunction(function), mVariables(variables),
+            mUseDegrees(useDegrees), mPos(0), mProgram(),
+            mInlineVariableNames()
+        {}
+
+        constexpr Program<Value_t, Capacity> parse()
+        {
+            parseVariables();
+            parseInlineVariables();
+            mProgram.root = parseExpression();
+            if(mFunction[mPos] != 0)
+                error(mFunction[mPos] == ')' ? "Mismatched parenthesis"
+                                             : "Syntax error");
+            return mProgram;
+        }
+
+     private:
+        const char* mFunction;
+        const char* mVariables;
+        bool mUseDegrees;
+        unsigned mPos;
+        Program<Value_t, Capacity> mProgram;
+        // The positions of the names of the inline variables
+        unsigned mInlineVariableNames[Capacity];
+
+        constexpr void error(const char* message)
+        {
+            parseError(message, mPos);
+        }
+
+        constexpr void skipSpace()
+        {
+            while(unsigned spaceChars = spaceLength(mFunction, mPos))
+                mPos += spaceChars;
+        }
+
+        constexpr unsigned addNode(unsigned opcode,
+                                   unsigned param0 = 0, unsigned param1 = 0,
+                                   unsigned param2 = 0)
+        {
+            if(mProgram.nodeCount == Capacity)
+            {
+                error("Too many operations");
+                return 0;
+            }
+            Node<Value_t>& node = mProgram.nodes[mProgram.nodeCount];
+            node.opcode = opcode;
+            node.params[0] = param0;
+            node.params[1] = param1;
+            node.params[2] = param2;
+            return mProgram.nodeCount++;
+        }
+
+        constexpr void parseVariables()
+        {
+            unsigned pos = 0;
+            while(mVariables[pos] != 0)
+            {
+                while(unsigned spaceChars = spaceLength(mVariables, pos))
+                    pos += spaceChars;
+                const unsigned nameLength = identifierLength(mVariables, pos);
+                if(nameLength == 0
+                || findFunction(mVariables + pos, nameLength)
+                || variableIndex(mVariables + pos, nameLength,
+                                 mProgram.variableCount) >= 0)
+                {
+                    parseError("Invalid variables string", pos);
+                    return;
+                }
+                ++mProgram.variableCount;
+                pos += nameLength;
+                while(unsigned spaceChars = spaceLength(mVariables, pos))
+                    pos += spaceChars;
+                if(mVariables[pos] == ',')
+                    ++pos;
+                else if(mVariables[pos] != 0)
+                {
+                    parseError("Invalid variables string", pos);
+                    return;
+                }
+            }
+        }
+
+        // The index of the variable among the first "count" ones, or -1
+        constexpr int variableIndex(const char* name, unsigned nameLength,
+                                    unsigned count) const
+        {
+            unsigned pos = 0;
+            for(unsigned index = 0; index < count; ++index)
+            {
+                while(unsigned spaceChars = spaceLength(mVariables, pos))
+                    pos += spaceChars;
+                const unsigned varLength = identifierLength(mVariables, pos);
+                if(equalNames(mVariables + pos, varLength, name, nameLength))
+                    return int(index);
+                pos += varLength;
+                while(mVariables[pos] != 0 && mVariables[pos] != ',') ++pos;
+                if(mVariables[pos] == ',') ++pos;
+            }
+            return -1;
+        }
+
+        // "name := value;" definitions at the beginning
+        constexpr void parseInlineVariables()
+        {
+            while(true)
+            {
+                skipSpace();
+                const unsigned nameLength = identifierLength(mFunction, mPos);
+                if(nameLength == 0
+                || findFunction(mFunction + mPos, nameLength)
+                || variableIndex(mFunction + mPos, nameLength,
+                                 mProgram.variableCount) >= 0)
+                    return;
+                unsigned pos = mPos + nameLength;
+                while(unsigned spaceChars = spaceLength(mFunction, pos))
+                    pos += spaceChars;
+                if(mFunction[pos] != ':' || mFunction[pos+1] != '=') return;
+
+                const unsigned namePos = mPos;
+                mPos = pos + 2;
+                const unsigned value = parseExpression();
+                if(mFunction[mPos] != ';')
+                {
+                    error("Syntax error");
+                    return;
+                }
+                ++mPos;
+                mInlineVariableNames[mProgram.inlineVariableCount] = namePos;
+                mProgram.inlineVariables[mProgram.inlineVariableCount++] =
+                    value;
+            }
+        }
+
+        constexpr unsigned parseExpression()
+        {
+            skipSpace();
+            unsigned result = parseAnd();
+            while(mFunction[mPos] == '|')
+            {
+                ++mPos;
+                skipSpace();
+                result = addNode(cOr, result, parseAnd());
+            }
+            return result;
+        }
+
+        constexpr unsigned parseAnd()
+        {
+            unsigned result = parseComparison();
+            while(mFunction[mPos] == '&')
+            {
+                ++mPos;
+                skipSpace();
+                result = addNode(cAnd, result, parseComparison());
+            }
+            return result;
+        }
+
+        constexpr unsigned parseComparison()
+        {
+            unsigned result = parseAddition();
+            while(true)
+            {
+                unsigned opcode = 0;
+                const char c = mFunction[mPos], next = c ? mFunction[mPos+1] : 0;
+                if(c == '=') { opcode = cEqual; ++mPos; }
+                else if(c == '!' && next == '=') { opcode = cNEqual; mPos += 2; }
+                else if(c == '<' && next == '=') { opcode = cLessOrEq; mPos += 2; }
+                else if(c == '<') { opcode = cLess; ++mPos; }
+                else if(c == '>' && next == '=') { opcode = cGreaterOrEq; mPos += 2; }
+                else if(c == '>') { opcode = cGreater; ++mPos; }
+                else return result;
+                skipSpace();
+                result = addNode(opcode, result, parseAddition());
+            }
+        }
+
+        constexpr unsigned parseAddition()
+        {
+            unsigned result = parseMult();
+            while(mFunction[mPos] == '+' || mFunction[mPos] == '-')
+            {
+                const unsigned opcode = mFunction[mPos] == '+' ? cAdd : cSub;
+                ++mPos;
+                skipSpace();
+                result = addNode(opcode, result, parseMult());
+            }
+            return result;
+        }
+
+        constexpr unsigned parseMult()
+        {
+            unsigned result = parseUnaryMinus();
+            while(mFunction[mPos] == '*' || mFunction[mPos] == '/'
+               || mFunction[mPos] == '%')
+            {
+                const char c = mFunction[mPos];
+                const unsigned opcode = c == '*' ? cMul : c == '/' ? cDiv : cMod;
+                ++mPos;
+                skipSpace();
+                result = addNode(opcode, result, parseUnaryMinus());
+            }
+            return result;
+        }
+
+        constexpr unsigned parseUnaryMinus()
+        {
+            const char c = mFunction[mPos];
+            if(c != '-' && c != '!') return parsePow();
+            ++mPos;
+            skipSpace();
+            return addNode(c == '-' ? cNeg : cNot, parseUnaryMinus());
+        }
+
+        // Right-associative, with a possible unary minus in the exponent
+        constexpr unsigned parsePow()
+        {
+            const unsigned base = parseElement();
+            if(mFunction[mPos] != '^') return base;
+            ++mPos;
+            skipSpace();
+            const unsigned exponent = parseUnaryMinus();
+
+            // As in CompilePow(): e^x and 2^x
+            const Node<Value_t>& baseNode = mProgram.nodes[base];
+            if(baseNode.opcode == cImmed)
+            {
+                if(baseNode.value ==
+                   Value_t(2.7182818284590452353602874713526624977572L))
+                    return addNode(cExp, exponent);
+                if(baseNode.value == Value_t(2))
+                    return addNode(cExp2, exponent);
+            }
+            return addNode(cPow, base, exponent);
+        }
+
+        constexpr unsigned parseElement()
+        {
+            const char c = mFunction[mPos];
+            if((c >= '0' && c <= '9') || c == '.')
+            {
+                typename LiteralType<Value_t>::type value = 0;
+                const unsigned literalLength =
+                    parseLiteral(mFunction, mPos, value);
+                if(literalLength == 0)
+                {
+                    error("Syntax error");
+                    return 0;
+                }
+                mPos += literalLength;
+                skipSpace();
+                const unsigned result = addNode(cImmed);
+                mProgram.nodes[result].value = Value_t(value);
+                return result;
+            }
+
+            const unsigned nameLength = identifierLength(mFunction, mPos);
+            if(nameLength == 0)
+            {
+                if(c == '(') return parseParenthesis();
+                error(c == ')' ? "Mismatched parenthesis" : "Syntax error");
+                return 0;
+            }
+
+            const char* const name = mFunction + mPos;
+            if(const FunctionInfo* function = findFunction(name, nameLength))
+            {
+                mPos += nameLength;
+                skipSpace();
+                return parseFunction(*function);
+            }
+
+            mPos += nameLength;
+            skipSpace();
+
+            // The latest inline variable of the name comes first
+            for(unsigned i = mProgram.inlineVariableCount; i-- > 0; )
+            {
+                const unsigned namePos = mInlineVariableNames[i];
+                if(equalNames(mFunction + namePos,
+                              identifierLength(mFunction, namePos),
+                              name, nameLength))
+                    return addNode(cFetch, i);
+            }
+
+            const int index =
+                variableIndex(name, nameLength, mProgram.variableCount);
+            if(index < 0)
+            {
+                mPos = unsigned(name - mFunction);
+                error("Unknown identifier");
+                return 0;
+            }
+            return addNode(VarBegin + unsigned(index));
+        }
+
+        constexpr unsigned parseParenthesis()
+        {
+            ++mPos;
+            skipSpace();
+            if(mFunction[mPos] == ')')
+            {
+                error("Empty parentheses");
+                return 0;
+            }
+            const unsigned result = parseExpression();
+            if(mFunction[mPos] != ')')
+            {
+                error("Missing ')'");
+                return 0;
+            }
+            ++mPos;
+            skipSpace();
+            return result;
+        }
+
+        constexpr unsigned parseFunction(const FunctionInfo& function)
+        {
+            if(mFunction[mPos] != '(')
+            {
+                error("Missing '(' after the function name");
+                return 0;
+            }
+
+            // if() has three parameters, which CompileIf() parses itself
+            const unsigned paramAmount =
+                function.opcode == cIf ? 3 : function.params;
+            unsigned params[3] = { 0, 0, 0 };
+            for(unsigned i = 0; i < paramAmount; ++i)
+            {
+                ++mPos;
+                skipSpace();
+                if(mFunction[mPos] == ')')
+                {
+                    error("Illegal number of parameters to the function");
+                    return 0;
+                }
+                params[i] = parseExpression();
+                if(mFunction[mPos] != (i + 1 < paramAmount ? ',' : ')'))
+                {
+                    error(i + 1 < paramAmount ? "Missing ','" : "Missing ')'");
+                    return 0;
+                }
+            }
+            ++mPos;
+            skipSpace();
+
+            if(mUseDegrees && (function.flags & FunctionFlag::AngleIn))
+                params[0] = addNode(cRad, params[0]);
+            unsigned result =
+                addNode(function.opcode, params[0], params[1], params[2]);
+            if(mUseDegrees && (function.flags & FunctionFlag::AngleOut))
+                result = addNode(cDeg, result);
+            return result;
+        }
+    };
+
+    //========================================================================
+    // Evaluation
+    //========================================================================
+    /* The compiled function: Compiled::program is the parsed program,
+       and the nodes are evaluated by instantiating Evaluator for each. */
+    template<typename Value_t, typename Source, bool useDegrees>
+    struct Compiled
+    {
+        static constexpr unsigned Capacity =
+            2 * length(Source::function) + 2;
+
+        static constexpr Program<Value_t, Capacity> program =
+            Parser<Value_t, Capacity>
+            (Source::function, Source::variables, useDegrees).parse();
+    };
+
+    /* The operations are those of Eval() in the NaN propagation mode (see
+       fp_eval_opcodes.inc): there are no domain checks. */
+    template<typename Compiled_t, unsigned index>
+    struct Evaluator
+    {
+        typedef typename std::remove_const
+            <typename std::remove_reference
+             <decltype(Compiled_t::program.nodes[0].value)>::type>::type
+            Value_t;
+
+        static constexpr Node<Value_t> node = Compiled_t::program.nodes[index];
+
+        template<unsigned param>
+        static inline Value_t p(const Value_t* vars, const Value_t* inlineVars)
+        {
+            return Evaluator<Compiled_t, node.params[param]>::eval
+                (vars, inlineVars);
+        }
+
+        static inline Value_t eval(const Value_t* vars,
+                                   const Value_t* inlineVars)
+        {
+            constexpr unsigned op = node.opcode;
+#define FP_CONSTEXPR_UNARY(opcode, expression) \
+            else if constexpr(op == opcode) \
+            { const Value_t a = p<0>(vars, inlineVars); return expression; }
+#define FP_CONSTEXPR_BINARY(opcode, expression) \
+            else if constexpr(op == opcode) \
+            { const Value_t a = p<0>(vars, inlineVars), \
+                            b = p<1>(vars, inlineVars); return expression; }
+
+            if constexpr(op >= VarBegin) return vars[op - VarBegin];
+            else if constexpr(op == cImmed) return node.value;
+            else if constexpr(op == cFetch) return inlineVars[node.params[0]];
+            else if constexpr(op == cIf)
+                return fp_truth(p<0>(vars, inlineVars))
+                    ? p<1>(vars, inlineVars) : p<2>(vars, inlineVars);
+            FP_CONSTEXPR_UNARY(cAbs, fp_abs(a))
+            FP_CONSTEXPR_UNARY(cAcos, fp_acos(a))
+            FP_CONSTEXPR_UNARY(cAcosh, fp_acosh(a))
+            FP_CONSTEXPR_UNARY(cAsin, fp_asin(a))
+            FP_CONSTEXPR_UNARY(cAsinh, fp_asinh(a))
+            FP_CONSTEXPR_UNARY(cAtan, fp_atan(a))
+            FP_CONSTEXPR_BINARY(cAtan2, fp_atan2(a, b))
+            FP_CONSTEXPR_UNARY(cAtanh, fp_atanh(a))
+            FP_CONSTEXPR_UNARY(cCbrt, fp_cbrt(a))
+            FP_CONSTEXPR_UNARY(cCeil, fp_ceil(a))
+            FP_CONSTEXPR_UNARY(cCos, fp_cos(a))
+            FP_CONSTEXPR_UNARY(cCosh, fp_cosh(a))
+            FP_CONSTEXPR_UNARY(cCot, fp_inv(fp_tan(a)))
+            FP_CONSTEXPR_UNARY(cCsc, fp_inv(fp_sin(a)))
+            FP_CONSTEXPR_UNARY(cExp, fp_exp(a))
+            FP_CONSTEXPR_UNARY(cExp2, fp_exp2(a))
+            FP_CONSTEXPR_UNARY(cFloor, fp_floor(a))
+            FP_CONSTEXPR_BINARY(cHypot, fp_hypot(a, b))
+            FP_CONSTEXPR_UNARY(cInt, fp_int(a))
+            FP_CONSTEXPR_UNARY(cLog, fp_log(a))
+            FP_CONSTEXPR_UNARY(cLog10, fp_log10(a))
+            FP_CONSTEXPR_UNARY(cLog2, fp_log2(a))
+            FP_CONSTEXPR_BINARY(cMax, fp_max(a, b))
+            FP_CONSTEXPR_BINARY(cMin, fp_min(a, b))
+            FP_CONSTEXPR_BINARY(cPow, fp_pow(a, b))
+            FP_CONSTEXPR_UNARY(cSec, fp_inv(fp_cos(a)))
+            FP_CONSTEXPR_UNARY(cSin, fp_sin(a))
+            FP_CONSTEXPR_UNARY(cSinh, fp_sinh(a))
+            FP_CONSTEXPR_UNARY(cSqrt, fp_sqrt(a))
+            FP_CONSTEXPR_UNARY(cTan, fp_tan(a))
+            FP_CONSTEXPR_UNARY(cTanh, fp_tanh(a))
+            FP_CONSTEXPR_UNARY(cTrunc, fp_trunc(a))
+            FP_CONSTEXPR_UNARY(cNeg, -a)
+            FP_CONSTEXPR_BINARY(cAdd, a + b)
+            FP_CONSTEXPR_BINARY(cSub, a - b)
+            FP_CONSTEXPR_BINARY(cMul, a * b)
+            FP_CONSTEXPR_BINARY(cDiv, a / b)
+            FP_CONSTEXPR_BINARY(cMod, fp_mod(a, b))
+            FP_CONSTEXPR_BINARY(cEqual, Value_t(fp_equal(a, b)))
+            FP_CONSTEXPR_BINARY(cNEqual, Value_t(fp_nequal(a, b)))
+            FP_CONSTEXPR_BINARY(cLess, Value_t(fp_less(a, b)))
+            FP_CONSTEXPR_BINARY(cLessOrEq, Value_t(fp_lessOrEq(a, b)))
+            FP_CONSTEXPR_BINARY(cGreater, Value_t(fp_less(b, a)))
+            FP_CONSTEXPR_BINARY(cGreaterOrEq, Value_t(fp_lessOrEq(b, a)))
+            FP_CONSTEXPR_UNARY(cNot, Value_t(fp_not(a)))
+            FP_CONSTEXPR_BINARY(cAnd, Value_t(fp_and(a, b)))
+            FP_CONSTEXPR_BINARY(cOr, Value_t(fp_or(a, b)))
+            FP_CONSTEXPR_UNARY(cDeg, RadiansToDegrees(a))
+            FP_CONSTEXPR_UNARY(cRad, DegreesToRadians(a))
+            else
+                static_assert(op == cImmed, "Unsupported opcode");
+#undef FP_CONSTEXPR_UNARY
+#undef FP_CONSTEXPR_BINARY
+        }
+    };
+
+    template<typename Compiled_t, typename Value_t, unsigned index>
+    inline void evalInlineVariables(const Value_t* vars, Value_t* inlineVars)
+    {
+        if constexpr(index < Compiled_t::program.inlineVariableCount)
+        {
+            inlineVars[index] = Evaluator
+                <Compiled_t, Compiled_t::program.inlineVariables[index]>::eval
+                (vars, inlineVars);
+            evalInlineVariables<Compiled_t, Value_t, index + 1>
+                (vars, inlineVars);
+        }
+    }
+}
+}
+
+/* The function given by Source (see the beginning of the file), parsed at
+   compile time. Only float, double and long double are supported. */
+template<typename Value_t, typename Source, bool useDegrees = false>
+class FunctionParserConstexpr
+{
+    typedef FUNCTIONPARSERTYPES::ConstexprParsing::Compiled
+        <Value_t, Source, useDegrees> Compiled;
+
+    static_assert(std::is_floating_point<Value_t>::value,
+                  "FunctionParserConstexpr supports float, double and "
+                  "long double");
+
+ public:
+    typedef Value_t value_type;
+
+    static constexpr unsigned VariablesAmount =
+        Compiled::program.variableCount;
+
+    static inline Value_t Eval(const Value_t* vars)
+    {
+        using namespace FUNCTIONPARSERTYPES::ConstexprParsing;
+        Value_t inlineVars[Compiled::program.inlineVariableCount + 1] = {};
+        evalInlineVariables<Compiled, Value_t, 0>(vars, inlineVars);
+        return Evaluator<Compiled, Compiled::program.root>::eval
+            (vars, inlineVars);
+    }
+
+    Value_t operator()(const Value_t* vars) const { return Eval(vars); }
+};
+
+#if __cpp_nontype_template_args >= 201911L
+/* With C++20 the strings can be given directly as template arguments:
+   FunctionSource<"x*y+1", "x,y">. */
+template<unsigned Size>
+struct FunctionString
+{
+    char value[Size];
+
+    constexpr FunctionString(const char (&str)[Size])
+    {
+        for(unsigned i = 0; i < Size; ++i) value[i] = str[i];
+    }
+};
+
+template<FunctionString Function, FunctionString Variables = "">
+struct FunctionSource
+{
+    static constexpr const char* function = Function.value;
+    static constexpr const char* variables = Variables.value;
+};
+#endif
+
+#endif
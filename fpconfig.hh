@@ -54,6 +54,22 @@
 */
 //#define FP_SUPPORT_CPLUSPLUS11_MATH_FUNCS
 
+/* Uncomment this line or define it in your compiler settings to leave out
+   the x86-64 JIT compiler used by CreateJIT(). (CreateJIT() then always
+   returns false and Eval() always uses the bytecode interpreter.)
+*/
+//#define FP_DISABLE_JIT
+
+/* Uncomment this line or define it in your compiler settings to make Eval()
+   always use the switch-based bytecode interpreter. By default compilers
+   supporting the "labels as values" extension (gcc, clang) translate the
+   bytecode into threaded code, which is evaluated faster.
+*/
+//#define FP_DISABLE_THREADED_EVAL
+#if defined(__GNUC__) && !defined(FP_DISABLE_THREADED_EVAL)
+#define FP_SUPPORT_THREADED_EVAL
+#endif
+
 /*
  Whether to use shortcut evaluation for the & and | operators:
 */
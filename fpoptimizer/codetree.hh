@@ -70,6 +70,18 @@ namespace FPoptimizer_CodeTree
             std::vector<Value_t>&   immed,
             size_t& stacktop_max);
 
+        /* Synthesizes bytecode computing all of the given trees, which
+         * share their common subexpressions. The value of each tree is
+         * left in the stack at the position stored in resultPositions;
+         * the value of the last tree is topmost.
+         */
+        static void SynthesizeByteCode(
+            std::vector<CodeTree>& trees,
+            std::vector<unsigned>& byteCode,
+            std::vector<Value_t>&   immed,
+            size_t& stacktop_max,
+            std::vector<unsigned>& resultPositions);
+
         void SynthesizeByteCode(
             FPoptimizer_ByteCode::ByteCodeSynth<Value_t>& synth,
             bool MustPopTemps=true) const;
@@ -0,0 +1,343 @@
+#include "fpconfig.hh"
+#include "fparser.hh"
+#include "extrasrc/fptypes.hh"
+
+#ifdef FP_SUPPORT_OPTIMIZER
+
+#include "codetree.hh"
+#include "derivative.hh"
+
+using namespace FUNCTIONPARSERTYPES;
+
+namespace
+{
+    using namespace FPoptimizer_CodeTree;
+
+    /* Builds the derivative of a tree with the usual rules of
+     * differentiation. The tree is in the form produced by GenerateFrom(),
+     * so most functions have been turned into cPow, cMul and cAdd, but
+     * every opcode is handled in case constant folding brings one back.
+     */
+    template<typename Value_t>
+    class TreeDifferentiator
+    {
+    public:
+        explicit TreeDifferentiator(unsigned varIndex):
+            mVarIndex(varIndex), mFailed(false) { }
+
+        bool Failed() const { return mFailed; }
+
+        CodeTree<Value_t> D(const CodeTree<Value_t>& tree);
+
+    private:
+        bool DependsOnVar(const CodeTree<Value_t>& tree) const
+        {
+            if(tree.IsVar()) return tree.GetVar() == VarBegin + mVarIndex;
+            for(size_t a=0; a<tree.GetParamCount(); ++a)
+                if(DependsOnVar(tree.GetParam(a))) return true;
+            return false;
+        }
+
+        static bool IsZero(const CodeTree<Value_t>& tree)
+        {
+            return tree.IsImmed() && tree.GetImmed() == Value_t(0);
+        }
+
+        static CodeTree<Value_t> Immed(const Value_t& value)
+        {
+            return CodeTreeImmed(value);
+        }
+
+        static CodeTree<Value_t> Op(OPCODE opcode,
+                                    const CodeTree<Value_t>& a)
+        {
+            CodeTree<Value_t> result;
+            result.SetOpcode(opcode);
+            result.AddParam(a);
+            result.Rehash();
+            return result;
+        }
+
+        static CodeTree<Value_t> Op(OPCODE opcode,
+                                    const CodeTree<Value_t>& a,
+                                    const CodeTree<Value_t>& b)
+        {
+            CodeTree<Value_t> result;
+            result.SetOpcode(opcode);
+            result.AddParam(a);
+            result.AddParam(b);
+            result.Rehash();
+            return result;
+        }
+
+        static CodeTree<Value_t> Op(OPCODE opcode,
+                                    const CodeTree<Value_t>& a,
+                                    const CodeTree<Value_t>& b,
+                                    const CodeTree<Value_t>& c)
+        {
+            CodeTree<Value_t> result;
+            result.SetOpcode(opcode);
+            result.AddParam(a);
+            result.AddParam(b);
+            result.AddParam(c);
+            result.Rehash();
+            return result;
+        }
+
+        static CodeTree<Value_t> Pow(const CodeTree<Value_t>& a,
+                                     const Value_t& exponent)
+        {
+            return Op(cPow, a, Immed(exponent));
+        }
+
+        // a*b, leaving out a zero product altogether
+        static CodeTree<Value_t> Mul(const CodeTree<Value_t>& a,
+                                     const CodeTree<Value_t>& b)
+        {
+            if(IsZero(a) || IsZero(b)) return Immed(Value_t(0));
+            return Op(cMul, a, b);
+        }
+
+        static CodeTree<Value_t> Mul(const CodeTree<Value_t>& a,
+                                     const CodeTree<Value_t>& b,
+                                     const CodeTree<Value_t>& c)
+        {
+            if(IsZero(a) || IsZero(b) || IsZero(c)) return Immed(Value_t(0));
+            return Op(cMul, a, b, c);
+        }
+
+        static CodeTree<Value_t> Add(const CodeTree<Value_t>& a,
+                                     const CodeTree<Value_t>& b)
+        {
+            if(IsZero(a)) return b;
+            if(IsZero(b)) return a;
+            return Op(cAdd, a, b);
+        }
+
+        static CodeTree<Value_t> Neg(const CodeTree<Value_t>& a)
+        {
+            return Mul(a, Immed(Value_t(-1)));
+        }
+
+        // The derivative of a function of one parameter: f'(a) * da
+        CodeTree<Value_t> Chain(const CodeTree<Value_t>& derivative,
+                                const CodeTree<Value_t>& a)
+        {
+            return Mul(derivative, D(a));
+        }
+
+        unsigned mVarIndex;
+        bool mFailed;
+    };
+
+    template<typename Value_t>
+    CodeTree<Value_t> TreeDifferentiator<Value_t>::D
+    (const CodeTree<Value_t>& tree)
+    {
+        const Value_t zero(0), one(1);
+        const Value_t half = fp_const_preciseDouble<Value_t>(0.5);
+        if(!DependsOnVar(tree)) return Immed(zero);
+        if(tree.IsVar()) return Immed(one);
+
+        const CodeTree<Value_t>& a = tree.GetParam(0);
+        const bool isComplex = IsComplexType<Value_t>::value;
+
+        switch(tree.GetOpcode())
+        {
+          case cAdd:
+          {
+              CodeTree<Value_t> sum = Immed(zero);
+              for(size_t i=0; i<tree.GetParamCount(); ++i)
+                  sum = Add(sum, D(tree.GetParam(i)));
+              return sum;
+          }
+
+          case cMul:
+          {
+              // Product rule: the sum of the products where one of the
+              // factors has been replaced by its derivative.
+              CodeTree<Value_t> sum = Immed(zero);
+              for(size_t i=0; i<tree.GetParamCount(); ++i)
+              {
+                  CodeTree<Value_t> derivative = D(tree.GetParam(i));
+                  if(IsZero(derivative)) continue;
+                  CodeTree<Value_t> product;
+                  product.SetOpcode(cMul);
+                  product.AddParamMove(derivative);
+                  for(size_t j=0; j<tree.GetParamCount(); ++j)
+                      if(j != i) product.AddParam(tree.GetParam(j));
+                  product.Rehash();
+                  sum = Add(sum, product);
+              }
+              return sum;
+          }
+
+          case cNeg: return Neg(D(a));
+          case cSub: return Add(D(a), Neg(D(tree.GetParam(1))));
+
+          case cDiv:
+          {
+              const CodeTree<Value_t>& b = tree.GetParam(1);
+              return Add(Mul(D(a), Pow(b, -one)),
+                         Neg(Mul(a, D(b), Pow(b, Value_t(-2)))));
+          }
+
+          case cPow:
+          {
+              const CodeTree<Value_t>& b = tree.GetParam(1);
+              const CodeTree<Value_t> da = D(a), db = D(b);
+              // b*a^(b-1)*da + a^b*log(a)*db
+              CodeTree<Value_t> result = Immed(zero);
+              if(!IsZero(da))
+                  result = Mul(b, Op(cPow, a, Add(b, Immed(-one))), da);
+              if(!IsZero(db))
+                  result = Add(result, Mul(tree, Op(cLog, a), db));
+              return result;
+          }
+
+          case cSqrt: return Chain(Mul(Immed(half), Pow(tree, -one)), a);
+          case cRSqrt:
+              return Chain(Mul(Immed(-half), Pow(tree, Value_t(3))), a);
+          case cCbrt: return Chain(Mul(Immed(one / Value_t(3)),
+                                       Pow(tree, Value_t(-2))), a);
+          case cInv: return Chain(Neg(Pow(tree, Value_t(2))), a);
+          case cSqr: return Chain(Mul(Immed(Value_t(2)), a), a);
+
+          case cExp: return Chain(tree, a);
+          case cExp2:
+              return Chain(Mul(tree, Immed(fp_const_log2<Value_t>())), a);
+          case cLog: return Chain(Pow(a, -one), a);
+          case cLog2:
+              return Chain(Mul(Pow(a, -one),
+                               Immed(fp_const_log2inv<Value_t>())), a);
+          case cLog10:
+              return Chain(Mul(Pow(a, -one),
+                               Immed(fp_const_log10inv<Value_t>())), a);
+
+          case cSin: return Chain(Op(cCos, a), a);
+          case cCos: return Chain(Neg(Op(cSin, a)), a);
+          case cTan: return Chain(Pow(Op(cCos, a), Value_t(-2)), a);
+          case cCot: return Chain(Neg(Pow(Op(cSin, a), Value_t(-2))), a);
+          case cSec:
+              return Chain(Mul(Op(cSin, a), Pow(Op(cCos, a), Value_t(-2))), a);
+          case cCsc:
+              return Chain(Neg(Mul(Op(cCos, a), Pow(Op(cSin, a), Value_t(-2)))),
+                           a);
+          case cSinh: return Chain(Op(cCosh, a), a);
+          case cCosh: return Chain(Op(cSinh, a), a);
+          case cTanh: return Chain(Pow(Op(cCosh, a), Value_t(-2)), a);
+
+          case cAsin: // 1/sqrt(1-a^2)
+              return Chain(Pow(Add(Immed(one), Neg(Pow(a, Value_t(2)))),
+                               -half), a);
+          case cAcos: // -1/sqrt(1-a^2)
+              return Chain(Neg(Pow(Add(Immed(one), Neg(Pow(a, Value_t(2)))),
+                                   -half)), a);
+          case cAtan: // 1/(1+a^2)
+              return Chain(Pow(Add(Immed(one), Pow(a, Value_t(2))), -one), a);
+          case cAsinh: // 1/sqrt(a^2+1)
+              return Chain(Pow(Add(Pow(a, Value_t(2)), Immed(one)),
+                               -half), a);
+          case cAcosh: // 1/sqrt(a^2-1)
+              return Chain(Pow(Add(Pow(a, Value_t(2)), Immed(-one)),
+                               -half), a);
+          case cAtanh: // 1/(1-a^2)
+              return Chain(Pow(Add(Immed(one), Neg(Pow(a, Value_t(2)))),
+                               -one), a);
+
+          case cAtan2: // atan2(a,b): (b*da - a*db) / (a^2+b^2)
+          {
+              const CodeTree<Value_t>& b = tree.GetParam(1);
+              return Mul(Add(Mul(b, D(a)), Neg(Mul(a, D(b)))),
+                         Pow(Add(Pow(a, Value_t(2)), Pow(b, Value_t(2))),
+                             -one));
+          }
+
+          case cHypot: // (a*da + b*db) / hypot(a,b)
+          {
+              const CodeTree<Value_t>& b = tree.GetParam(1);
+              return Mul(Add(Mul(a, D(a)), Mul(b, D(b))), Pow(tree, -one));
+          }
+
+          case cDeg: return Chain(Immed(fp_const_rad_to_deg<Value_t>()), a);
+          case cRad: return Chain(Immed(fp_const_deg_to_rad<Value_t>()), a);
+
+          case cMod: // a - b*trunc(a/b)
+          {
+              const CodeTree<Value_t>& b = tree.GetParam(1);
+              const CodeTree<Value_t> quotient =
+                  Op(cTrunc, Mul(a, Pow(b, -one)));
+              return Add(D(a), Neg(Mul(D(b), quotient)));
+          }
+
+          case cMin:
+          case cMax:
+          {
+              // The derivative of whichever parameter is chosen
+              const OPCODE compare =
+                  tree.GetOpcode() == cMin ? cLess : cGreater;
+              CodeTree<Value_t> chosen = a, derivative = D(a);
+              for(size_t i=1; i<tree.GetParamCount(); ++i)
+              {
+                  const CodeTree<Value_t>& p = tree.GetParam(i);
+                  derivative =
+                      Op(cIf, Op(compare, p, chosen), D(p), derivative);
+                  chosen = Op(tree.GetOpcode(), chosen, p);
+              }
+              return derivative;
+          }
+
+          case cIf:
+          case cAbsIf:
+              return Op(tree.GetOpcode(), a,
+                        D(tree.GetParam(1)), D(tree.GetParam(2)));
+
+          case cAbs:
+              if(isComplex) break;
+              // The sign of a; the derivative at 0 is taken to be 0.
+              return Chain(Add(Op(cGreater, a, Immed(zero)),
+                               Neg(Op(cLess, a, Immed(zero)))), a);
+
+          // Piecewise constant functions
+          case cFloor: case cCeil: case cTrunc: case cInt:
+          case cEqual: case cNEqual: case cLess: case cLessOrEq:
+          case cGreater: case cGreaterOrEq:
+          case cNot: case cNotNot: case cAnd: case cOr:
+          case cAbsNot: case cAbsNotNot: case cAbsAnd: case cAbsOr:
+              if(isComplex) break;
+              return Immed(zero);
+
+          default: break;
+        }
+
+        mFailed = true;
+        return Immed(zero);
+    }
+}
+
+namespace FPoptimizer_CodeTree
+{
+    template<typename Value_t>
+    bool Differentiate(const CodeTree<Value_t>& tree, unsigned varIndex,
+                       CodeTree<Value_t>& result)
+    {
+        TreeDifferentiator<Value_t> differentiator(varIndex);
+        result = differentiator.D(tree);
+        return !differentiator.Failed();
+    }
+}
+
+/* BEGIN_EXPLICIT_INSTANTATION */
+#include "instantiate.hh"
+namespace FPoptimizer_CodeTree
+{
+#define FP_INSTANTIATE(type) \
+    template bool Differentiate( \
+        const CodeTree<type>& tree, unsigned varIndex, \
+        CodeTree<type>& result);
+    FPOPTIMIZER_EXPLICITLY_INSTANTIATE(FP_INSTANTIATE)
+#undef FP_INSTANTIATE
+}
+/* END_EXPLICIT_INSTANTATION */
+
+#endif
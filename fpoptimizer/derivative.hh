@@ -0,0 +1,28 @@
+#ifndef FPOptimizer_DerivativeHH
+#define FPOptimizer_DerivativeHH
+
+#include "codetree.hh"
+
+#ifdef FP_SUPPORT_OPTIMIZER
+
+namespace FPoptimizer_CodeTree
+{
+    /* Stores into 'result' the derivative of 'tree' with respect to the
+     * variable of the given index. The result is constant-folded while
+     * it's built, but not otherwise optimized.
+     *
+     * Returns false if the tree contains something which can't be
+     * differentiated: a call to a user-defined function (cFCall) or to a
+     * function defined as another parser (cPCall) whose parameters depend
+     * on the variable, or, for complex numbers, one of
+     * the functions which aren't complex differentiable (abs, real, imag,
+     * conj, arg, polar).
+     */
+    template<typename Value_t>
+    bool Differentiate(const CodeTree<Value_t>& tree, unsigned varIndex,
+                       CodeTree<Value_t>& result);
+}
+
+#endif
+
+#endif
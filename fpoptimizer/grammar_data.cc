@@ -107,7 +107,7 @@ namespace
     /* 61	*/ {fp_const_log10<Value_t>(), 0}, /* 2.302585092994045901093613792909309267998 */
     /* 62	*/ {fp_const_e<Value_t>(), 0}, /* 2.718281828459045090795598298427648842335 */
     /* 63	*/ {fp_const_rad_to_deg<Value_t>(), 0}, /* 57.29577951308232286464772187173366546631 */
-    /* 64	*/ {-fp_const_pihalf<Value_t>(), Modulo_Radians}, /* -1.570796326794896557998981734272092580795 */
+    /* 64	*/ {-fp_const_pihalf<Value_t>(), Modulo_Radians}, /* (-1.570796326794896557998981734272092580795+-0i) */
     /* 65	*/ {Value_t(0), Modulo_Radians}, /* 0 */
     /* 66	*/ {fp_const_pihalf<Value_t>(), Modulo_Radians}, /* 1.570796326794896557998981734272092580795 */
     /* 67	*/ {fp_const_pi<Value_t>(), Modulo_Radians}, /* 3.141592653589793115997963468544185161591 */
@@ -208,7 +208,7 @@ namespace
     /* 158	*/ {{0,/*           */0         , cAdd        ,AnyParams       ,2, 0}, 0, 0x0}, /* (cAdd  <2>) */
     /* 159	*/ {{1,/*4          */4         , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd x@I <1>) */
     /* 160	*/ {{1,/*53         */53        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd 0.5 <1>) */
-    /* 161	*/ {{1,/*64         */64        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd -1.570796326794896557998981734272092580795 <1>) */
+    /* 161	*/ {{1,/*64         */64        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd (-1.570796326794896557998981734272092580795+-0i) <1>) */
     /* 162	*/ {{1,/*65         */65        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd 0 <1>) */
     /* 163	*/ {{1,/*66         */66        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd 1.570796326794896557998981734272092580795 <1>) */
     /* 164	*/ {{1,/*67         */67        , cAdd        ,AnyParams       ,1, 0}, 0, 0x0}, /* (cAdd 3.141592653589793115997963468544185161591 <1>) */
@@ -835,7 +835,7 @@ namespace FPoptimizer_Grammar
         /* 13:	@F (cCos [(cAdd {1.570796326794896557998981734272092580795 (cMul %@N <1>)})])
          *	->	(cSin [(cMul -%@C <1>)])
          */		 {ProduceNewTree, 2, 1,/*638        */638       , {1,/*82         */82        , cCos        ,PositionalParams,0, 0}},
-        /* 14:	@F (cCos [(cAdd -1.570796326794896557998981734272092580795 <1>)])
+        /* 14:	@F (cCos [(cAdd (-1.570796326794896557998981734272092580795+-0i) <1>)])
          *	->	(cSin [(cAdd  <1>)])
          */		 {ProduceNewTree, 2, 1,/*631        */631       , {1,/*161        */161       , cCos        ,PositionalParams,0, 0}},
         /* 15:	@F (cCos [(cAdd 1.570796326794896557998981734272092580795 <1>)])
@@ -1063,7 +1063,7 @@ namespace FPoptimizer_Grammar
         /* 89:	@F (cSin [(cAdd {1.570796326794896557998981734272092580795 (cMul %@N <1>)})])
          *	->	(cCos [(cMul -%@C <1>)])
          */		 {ProduceNewTree, 2, 1,/*553        */553       , {1,/*82         */82        , cSin        ,PositionalParams,0, 0}},
-        /* 90:	@F (cSin [(cAdd -1.570796326794896557998981734272092580795 <1>)])
+        /* 90:	@F (cSin [(cAdd (-1.570796326794896557998981734272092580795+-0i) <1>)])
          *	->	(cMul {-1 (cCos [(cAdd  <1>)])})
          */		 {ProduceNewTree, 2, 1,/*203        */203       , {1,/*161        */161       , cSin        ,PositionalParams,0, 0}},
         /* 91:	@F (cSin [(cAdd 1.570796326794896557998981734272092580795 <1>)])
@@ -104,39 +104,51 @@ namespace
     */
 }
 
-namespace FPoptimizer_CodeTree
+namespace
 {
+    /* Brings the inversions and negations back into the tree before
+     * synthesizing bytecode for it.
+     */
     template<typename Value_t>
-    void CodeTree<Value_t>::SynthesizeByteCode(
-        std::vector<unsigned>& ByteCode,
-        std::vector<Value_t>&   Immed,
-        size_t& stacktop_max)
+    void PrepareTreeForSynthesis(CodeTree<Value_t>& tree)
     {
     #ifdef DEBUG_SUBSTITUTIONS
         std::cout << "Making bytecode for:\n";
-        DumpTreeWithIndent(*this);
+        DumpTreeWithIndent(tree);
     #endif
-        while(RecreateInversionsAndNegations())
+        while(tree.RecreateInversionsAndNegations())
         {
         #ifdef DEBUG_SUBSTITUTIONS
             std::cout << "One change issued, produced:\n";
-            DumpTreeWithIndent(*this);
+            DumpTreeWithIndent(tree);
         #endif
-            FixIncompleteHashes();
+            tree.FixIncompleteHashes();
 
             using namespace FPoptimizer_Optimize;
             using namespace FPoptimizer_Grammar;
             const void* g = (const void*)&grammar_optimize_recreate;
-            while(ApplyGrammar(*(const Grammar*)g, *this))
+            while(ApplyGrammar(*(const Grammar*)g, tree))
             {
-                FixIncompleteHashes();
+                tree.FixIncompleteHashes();
             }
         }
-        Sort();
+        tree.Sort();
     #ifdef DEBUG_SUBSTITUTIONS
         std::cout << "Actually synthesizing, after recreating inv/neg:\n";
-        DumpTreeWithIndent(*this);
+        DumpTreeWithIndent(tree);
     #endif
+    }
+}
+
+namespace FPoptimizer_CodeTree
+{
+    template<typename Value_t>
+    void CodeTree<Value_t>::SynthesizeByteCode(
+        std::vector<unsigned>& ByteCode,
+        std::vector<Value_t>&   Immed,
+        size_t& stacktop_max)
+    {
+        PrepareTreeForSynthesis(*this);
 
         FPoptimizer_ByteCode::ByteCodeSynth<Value_t> synth;
 
@@ -149,6 +161,42 @@ namespace FPoptimizer_CodeTree
         synth.Pull(ByteCode, Immed, stacktop_max);
     }
 
+    template<typename Value_t>
+    void CodeTree<Value_t>::SynthesizeByteCode(
+        std::vector<CodeTree>& trees,
+        std::vector<unsigned>& ByteCode,
+        std::vector<Value_t>&   Immed,
+        size_t& stacktop_max,
+        std::vector<unsigned>& resultPositions)
+    {
+        /* The subexpressions common to several of the trees are found
+         * by looking for them under a root holding all of the trees.
+         * The opcode of the root doesn't matter, as it is never
+         * synthesized itself.
+         */
+        CodeTree root;
+        root.SetOpcode(cAdd);
+        for(size_t a=0; a<trees.size(); ++a)
+        {
+            PrepareTreeForSynthesis(trees[a]);
+            root.AddParam(trees[a]);
+        }
+
+        FPoptimizer_ByteCode::ByteCodeSynth<Value_t> synth;
+        root.SynthCommonSubExpressions(synth);
+
+        /* The temporaries are left in the stack, so the value
+         * of each tree stays where it was synthesized.
+         */
+        resultPositions.clear();
+        for(size_t a=0; a<trees.size(); ++a)
+        {
+            trees[a].SynthesizeByteCode(synth, false);
+            resultPositions.push_back(unsigned(synth.GetStackTop() - 1));
+        }
+        synth.Pull(ByteCode, Immed, stacktop_max);
+    }
+
     template<typename Value_t>
     void CodeTree<Value_t>::SynthesizeByteCode(
         FPoptimizer_ByteCode::ByteCodeSynth<Value_t>& synth,
@@ -509,7 +557,13 @@ namespace FPoptimizer_CodeTree
     template void CodeTree<type>::SynthesizeByteCode( \
         std::vector<unsigned>& ByteCode, \
         std::vector<type>&   Immed, \
-        size_t& stacktop_max);
+        size_t& stacktop_max); \
+    template void CodeTree<type>::SynthesizeByteCode( \
+        std::vector<CodeTree<type> >& trees, \
+        std::vector<unsigned>& ByteCode, \
+        std::vector<type>&   Immed, \
+        size_t& stacktop_max, \
+        std::vector<unsigned>& resultPositions);
     FPOPTIMIZER_EXPLICITLY_INSTANTIATE(FP_INSTANTIATE)
 #undef FP_INSTANTIATE
 }
@@ -0,0 +1,700 @@
+#include <vector>
+#include <algorithm>
+
+#include "registercode.hh"
+#include "extrasrc/fptypes.hh"
+#include "extrasrc/fpaux.hh"
+
+#ifdef FP_SUPPORT_OPTIMIZER
+
+using namespace FUNCTIONPARSERTYPES;
+
+namespace
+{
+    /* A value produced while running the bytecode symbolically. The
+     * immediates, variables and function call arguments live in fixed
+     * registers; the temporaries get theirs from the register allocator.
+     */
+    struct RegisterValue
+    {
+        enum Kind { Immed, Variable, Argument, Temporary };
+        Kind kind;
+        unsigned index;          // Immed, Variable, Argument: its number
+        unsigned firstDef, lastUse;
+        unsigned physical;       // Temporary: the allocated register
+        unsigned definition;     // Temporary: the operation computing it
+        unsigned uses;           // The instructions emitted so far reading it
+
+        RegisterValue(Kind k, unsigned i):
+            kind(k), index(i), firstDef(~0u), lastUse(0), physical(0),
+            definition(~0u), uses(0) { }
+    };
+
+    /* An instruction whose register operands are still value numbers.
+     * operand[0] is the result, operand[1..4] are a, b, c and d.
+     */
+    struct PendingInstruction
+    {
+        unsigned opcode;
+        unsigned operand[5];
+        unsigned defMask, useMask; // Which operands are written and read
+
+        explicit PendingInstruction(unsigned op):
+            opcode(op), defMask(0), useMask(0)
+        {
+            for(unsigned i = 0; i < 5; ++i) operand[i] = 0;
+        }
+    };
+
+    /* An if() whose branches are being translated. The stack is restored
+     * to 'stack' at the start of the else branch, and both branches leave
+     * their value in the register of 'join'.
+     */
+    struct OpenIf
+    {
+        std::vector<unsigned> stack;
+        unsigned ifInstruction, jumpInstruction;
+        unsigned elseBegin, end; // Bytecode positions
+        unsigned join;
+        bool inElseBranch;
+    };
+
+    class RegisterCodeSynth
+    {
+    public:
+        RegisterCodeSynth(unsigned immedAmount, unsigned variablesAmount,
+                          bool reuseRegisters):
+            mImmedAmount(immedAmount), mVariablesAmount(variablesAmount),
+            mReuseRegisters(reuseRegisters), mArgumentCount(0)
+        {
+            for(unsigned i = 0; i < immedAmount; ++i)
+                mValues.push_back(RegisterValue(RegisterValue::Immed, i));
+            for(unsigned i = 0; i < variablesAmount; ++i)
+                mValues.push_back(RegisterValue(RegisterValue::Variable, i));
+        }
+
+        unsigned Immed(unsigned index) const { return index; }
+        unsigned Variable(unsigned index) const { return mImmedAmount + index; }
+
+        unsigned Argument(unsigned index)
+        {
+            while(mArguments.size() <= index)
+            {
+                mArguments.push_back(unsigned(mValues.size()));
+                mValues.push_back(RegisterValue(RegisterValue::Argument,
+                                                mArgumentCount++));
+            }
+            return mArguments[index];
+        }
+
+        // Without register reuse, each call gets argument registers of its own
+        void NextCall()
+        {
+            if(!mReuseRegisters) mArguments.clear();
+        }
+
+        unsigned NewTemporary()
+        {
+            mValues.push_back(RegisterValue(RegisterValue::Temporary, 0));
+            return unsigned(mValues.size()-1);
+        }
+
+        unsigned Emit(const PendingInstruction& instruction)
+        {
+            for(unsigned n = 1; n < 5; ++n)
+                if(instruction.useMask & (1u << n))
+                    ++mValues[instruction.operand[n]].uses;
+            mCode.push_back(instruction);
+            return unsigned(mCode.size()-1);
+        }
+
+        unsigned EmitOperation(unsigned opcode, const unsigned* params,
+                               unsigned paramAmount)
+        {
+            PendingInstruction instruction(opcode);
+            instruction.operand[0] = NewTemporary();
+            instruction.defMask = 1;
+            for(unsigned i = 0; i < paramAmount; ++i)
+            {
+                instruction.operand[1+i] = params[i];
+                instruction.useMask |= 2u << i;
+            }
+            mValues[instruction.operand[0]].definition = Emit(instruction);
+            return instruction.operand[0];
+        }
+
+        bool FuseProducts(unsigned& opcode, unsigned* params,
+                          unsigned& paramAmount,
+                          const std::vector<unsigned>& stack,
+                          const std::vector<OpenIf>& ifs);
+
+        void EmitMove(unsigned target, unsigned source)
+        {
+            PendingInstruction instruction(cDup);
+            instruction.operand[0] = target; instruction.defMask = 1;
+            instruction.operand[1] = source; instruction.useMask = 2;
+            Emit(instruction);
+        }
+
+        unsigned CodeSize() const { return unsigned(mCode.size()); }
+        PendingInstruction& Instruction(unsigned i) { return mCode[i]; }
+
+        void Finish(std::vector<RegisterInstruction>& code,
+                    unsigned& registerCount,
+                    const std::vector<unsigned>& results,
+                    std::vector<unsigned>& resultRegisters);
+
+    private:
+        bool TakeProduct(unsigned value, unsigned* factors,
+                         const std::vector<unsigned>& stack,
+                         const std::vector<OpenIf>& ifs);
+        void AllocateRegisters(unsigned& temporaryCount,
+                               const std::vector<unsigned>& results);
+        unsigned Physical(unsigned value, unsigned temporaryBase,
+                          unsigned argumentBase) const;
+
+        unsigned mImmedAmount, mVariablesAmount;
+        bool mReuseRegisters;
+        unsigned mArgumentCount;
+        std::vector<RegisterValue> mValues;
+        std::vector<unsigned> mArguments;
+        std::vector<PendingInstruction> mCode;
+    };
+
+    /* If the value is a product which nothing else needs, puts its factors
+     * in factors[0] and factors[1] and turns the cMul or cSqr computing it
+     * into a cNop, which Finish() leaves out. The factors are then read by
+     * the instruction using the product, which comes later in the same
+     * branch: the value would be kept for the else branch of an if()
+     * otherwise.
+     */
+    bool RegisterCodeSynth::TakeProduct(unsigned value, unsigned* factors,
+                                        const std::vector<unsigned>& stack,
+                                        const std::vector<OpenIf>& ifs)
+    {
+        const RegisterValue& product = mValues[value];
+        if(product.kind != RegisterValue::Temporary
+        || product.definition == ~0u || product.uses != 0
+        || std::find(stack.begin(), stack.end(), value) != stack.end())
+            return false;
+        for(std::size_t i = 0; i < ifs.size(); ++i)
+            if(std::find(ifs[i].stack.begin(), ifs[i].stack.end(), value)
+               != ifs[i].stack.end())
+                return false;
+
+        PendingInstruction& instruction = mCode[product.definition];
+        if(instruction.opcode == cMul)
+        {
+            factors[0] = instruction.operand[1];
+            factors[1] = instruction.operand[2];
+        }
+        else if(instruction.opcode == cSqr)
+            factors[0] = factors[1] = instruction.operand[1];
+        else
+            return false;
+
+        for(unsigned n = 1; n < 5; ++n)
+            if(instruction.useMask & (1u << n))
+                --mValues[instruction.operand[n]].uses;
+        instruction = PendingInstruction(cNop);
+        return true;
+    }
+
+    /* Fuses the cAdd or cSub of the bytecode with the multiplications
+     * giving its operands into a cFma, cFms, cFmma or cFmms, so that the
+     * register code makes one dispatch instead of two or three. The
+     * bytecode has them fused already where it can, but the products it
+     * makes with cSqr, or leaves apart on the stack, only meet here.
+     * params is the operand pair of the cAdd or cSub; the fused opcode
+     * and its operands replace them.
+     */
+    bool RegisterCodeSynth::FuseProducts(unsigned& opcode, unsigned* params,
+                                         unsigned& paramAmount,
+                                         const std::vector<unsigned>& stack,
+                                         const std::vector<OpenIf>& ifs)
+    {
+        if((opcode != cAdd && opcode != cSub) || params[0] == params[1])
+            return false;
+
+        unsigned factors[4];
+        if(TakeProduct(params[0], factors, stack, ifs))
+        {
+            if(TakeProduct(params[1], factors + 2, stack, ifs))
+            {
+                opcode = opcode == cAdd ? cFmma : cFmms;
+                paramAmount = 4;
+            }
+            else
+            {
+                opcode = opcode == cAdd ? cFma : cFms;
+                factors[2] = params[1];
+                paramAmount = 3;
+            }
+        }
+        else if(opcode == cAdd && TakeProduct(params[1], factors, stack, ifs))
+        {
+            opcode = cFma;
+            factors[2] = params[0];
+            paramAmount = 3;
+        }
+        else
+            return false;
+
+        std::copy(factors, factors + paramAmount, params);
+        return true;
+    }
+
+    void RegisterCodeSynth::AllocateRegisters
+    (unsigned& temporaryCount, const std::vector<unsigned>& results)
+    {
+        for(unsigned i = 0; i < mCode.size(); ++i)
+            for(unsigned n = 0; n < 5; ++n)
+            {
+                if(!((mCode[i].defMask | mCode[i].useMask) & (1u << n)))
+                    continue;
+                RegisterValue& value = mValues[mCode[i].operand[n]];
+                if(mCode[i].defMask & (1u << n))
+                {
+                    value.firstDef = std::min(value.firstDef, i);
+                    value.lastUse = std::max(value.lastUse, i);
+                }
+                if(mCode[i].useMask & (1u << n))
+                    value.lastUse = std::max(value.lastUse, i);
+            }
+        // The results must survive until the end
+        for(unsigned i = 0; i < results.size(); ++i)
+            mValues[results[i]].lastUse = unsigned(mCode.size());
+
+        /* Linear scan: the registers of values whose live range has ended
+         * by the time a new value is written are reused. A value may get
+         * the register of an operand of the very instruction writing it,
+         * since every instruction reads its operands first.
+         */
+        std::vector<unsigned> active, freeRegisters;
+        temporaryCount = 0;
+        for(unsigned i = 0; i < mCode.size(); ++i)
+            for(unsigned n = 0; n < 5; ++n)
+            {
+                if(!(mCode[i].defMask & (1u << n))) continue;
+                RegisterValue& value = mValues[mCode[i].operand[n]];
+                if(value.kind != RegisterValue::Temporary
+                || value.firstDef != i) continue;
+
+                for(std::size_t a = active.size(); a-- > 0; )
+                    if(mValues[active[a]].lastUse <= i)
+                    {
+                        freeRegisters.push_back(mValues[active[a]].physical);
+                        active.erase(active.begin() + a);
+                    }
+
+                if(freeRegisters.empty() || !mReuseRegisters)
+                    value.physical = temporaryCount++;
+                else
+                {
+                    value.physical = freeRegisters.back();
+                    freeRegisters.pop_back();
+                }
+                active.push_back(mCode[i].operand[n]);
+            }
+    }
+
+    unsigned RegisterCodeSynth::Physical(unsigned value,
+                                         unsigned temporaryBase,
+                                         unsigned argumentBase) const
+    {
+        const RegisterValue& v = mValues[value];
+        switch(v.kind)
+        {
+          case RegisterValue::Immed: return v.index;
+          case RegisterValue::Variable: return mImmedAmount + v.index;
+          case RegisterValue::Argument: return argumentBase + v.index;
+          case RegisterValue::Temporary: break;
+        }
+        return temporaryBase + v.physical;
+    }
+
+    void RegisterCodeSynth::Finish(std::vector<RegisterInstruction>& code,
+                                   unsigned& registerCount,
+                                   const std::vector<unsigned>& results,
+                                   std::vector<unsigned>& resultRegisters)
+    {
+        unsigned temporaryCount;
+        AllocateRegisters(temporaryCount, results);
+
+        const unsigned temporaryBase = mImmedAmount + mVariablesAmount;
+        const unsigned argumentBase = temporaryBase + temporaryCount;
+        registerCount = argumentBase + mArgumentCount;
+        resultRegisters.clear();
+        for(unsigned i = 0; i < results.size(); ++i)
+            resultRegisters.push_back
+                (Physical(results[i], temporaryBase, argumentBase));
+
+        // Moves between values which got the same register are dropped
+        std::vector<unsigned> newIndex(mCode.size() + 1);
+        code.clear();
+        for(unsigned i = 0; i < mCode.size(); ++i)
+        {
+            newIndex[i] = unsigned(code.size());
+            PendingInstruction& instruction = mCode[i];
+            for(unsigned n = 0; n < 5; ++n)
+                if((instruction.defMask | instruction.useMask) & (1u << n))
+                    instruction.operand[n] = Physical(instruction.operand[n],
+                                                      temporaryBase,
+                                                      argumentBase);
+            if(instruction.opcode == cNop
+            || (instruction.opcode == cDup
+             && instruction.operand[0] == instruction.operand[1]))
+                continue;
+
+            RegisterInstruction r;
+            r.opcode = instruction.opcode;
+            r.result = instruction.operand[0];
+            r.a = instruction.operand[1];
+            r.b = instruction.operand[2];
+            r.c = instruction.operand[3];
+            r.d = instruction.operand[4];
+            code.push_back(r);
+        }
+        newIndex[mCode.size()] = unsigned(code.size());
+
+        for(unsigned i = 0; i < code.size(); ++i)
+        {
+            if(code[i].opcode == cIf || code[i].opcode == cAbsIf)
+                code[i].b = newIndex[code[i].b];
+            else if(code[i].opcode == cJump)
+                code[i].a = newIndex[code[i].a];
+        }
+    }
+}
+
+namespace FPoptimizer_RegisterCode
+{
+    bool SynthesizeRegisterCode(
+        const std::vector<unsigned>& byteCode,
+        unsigned immedAmount,
+        unsigned variablesAmount,
+        const std::vector<unsigned>& funcParamAmounts,
+        const std::vector<unsigned>& parserParamAmounts,
+        const std::vector<unsigned>& resultPositions,
+        std::vector<RegisterInstruction>& code,
+        unsigned& registerCount,
+        unsigned& resultRegister,
+        std::vector<unsigned>& resultRegisters,
+        bool reuseRegisters)
+    {
+        code.clear();
+
+        RegisterCodeSynth synth(immedAmount, variablesAmount, reuseRegisters);
+        std::vector<unsigned> stack;
+        std::vector<OpenIf> ifs;
+        const unsigned byteCodeSize = unsigned(byteCode.size());
+        unsigned DP = 0;
+
+        for(unsigned IP = 0; ; ++IP)
+        {
+            /* Both branches of the innermost if() end here. The value of
+             * the else branch is moved to the register of the if(), as was
+             * the value of the then branch before the cJump.
+             */
+            while(!ifs.empty() && ifs.back().inElseBranch
+               && ifs.back().end == IP)
+            {
+                OpenIf& openIf = ifs.back();
+                if(stack.size() != openIf.stack.size() + 1
+                || !std::equal(openIf.stack.begin(), openIf.stack.end(),
+                               stack.begin()))
+                    return false;
+                synth.EmitMove(openIf.join, stack.back());
+                synth.Instruction(openIf.jumpInstruction).operand[1] =
+                    synth.CodeSize();
+                stack.back() = openIf.join;
+                ifs.pop_back();
+            }
+            if(IP >= byteCodeSize) break;
+            if(!ifs.empty() && !ifs.back().inElseBranch
+            && IP >= ifs.back().elseBegin)
+                return false;
+
+            const unsigned opcode = byteCode[IP];
+            if(opcode >= VarBegin)
+            {
+                if(opcode - VarBegin >= variablesAmount) return false;
+                stack.push_back(synth.Variable(opcode - VarBegin));
+                continue;
+            }
+
+            unsigned params[4];
+            switch(opcode)
+            {
+              case cImmed:
+                  if(DP >= immedAmount) return false;
+                  stack.push_back(synth.Immed(DP++));
+                  break;
+
+              case cDup:
+                  if(stack.empty()) return false;
+                  stack.push_back(stack.back());
+                  break;
+
+              case cFetch:
+              {
+                  if(IP + 1 >= byteCodeSize) return false;
+                  const unsigned index = byteCode[++IP];
+                  if(index >= stack.size()) return false;
+                  stack.push_back(stack[index]);
+                  break;
+              }
+
+              case cPopNMov:
+              {
+                  if(IP + 2 >= byteCodeSize) return false;
+                  const unsigned target = byteCode[++IP];
+                  const unsigned source = byteCode[++IP];
+                  if(target >= stack.size() || source >= stack.size())
+                      return false;
+                  stack[target] = stack[source];
+                  stack.resize(target + 1);
+                  break;
+              }
+
+              case cNop:
+                  break;
+
+              case cIf:
+              case cAbsIf:
+              {
+                  if(stack.empty() || IP + 2 >= byteCodeSize) return false;
+                  OpenIf openIf;
+                  PendingInstruction instruction(opcode);
+                  instruction.operand[1] = stack.back();
+                  instruction.useMask = 2;
+                  stack.pop_back();
+                  openIf.stack = stack;
+                  openIf.ifInstruction = synth.Emit(instruction);
+                  openIf.jumpInstruction = 0;
+                  openIf.elseBegin = byteCode[IP+1] + 1;
+                  openIf.end = 0;
+                  openIf.join = synth.NewTemporary();
+                  openIf.inElseBranch = false;
+                  if(openIf.elseBegin <= IP + 2) return false;
+                  ifs.push_back(openIf);
+                  IP += 2;
+                  break;
+              }
+
+              case cJump:
+              {
+                  if(ifs.empty() || ifs.back().inElseBranch
+                  || IP + 2 >= byteCodeSize)
+                      return false;
+                  OpenIf& openIf = ifs.back();
+                  if(stack.size() != openIf.stack.size() + 1
+                  || !std::equal(openIf.stack.begin(), openIf.stack.end(),
+                                 stack.begin()))
+                      return false;
+                  synth.EmitMove(openIf.join, stack.back());
+
+                  PendingInstruction instruction(cJump);
+                  openIf.jumpInstruction = synth.Emit(instruction);
+                  openIf.end = byteCode[IP+1] + 1;
+                  IP += 2;
+
+                  // The else branch starts right after the cJump
+                  if(openIf.elseBegin != IP + 1 || openIf.end <= IP)
+                      return false;
+                  synth.Instruction(openIf.ifInstruction).operand[2] =
+                      synth.CodeSize();
+                  openIf.inElseBranch = true;
+                  stack = openIf.stack;
+                  break;
+              }
+
+              case cFCall:
+              case cPCall:
+              {
+                  if(IP + 1 >= byteCodeSize) return false;
+                  const unsigned function = byteCode[++IP];
+                  const std::vector<unsigned>& paramAmounts =
+                      opcode == cFCall ? funcParamAmounts : parserParamAmounts;
+                  if(function >= paramAmounts.size()) return false;
+                  const unsigned paramAmount = paramAmounts[function];
+                  if(stack.size() < paramAmount) return false;
+
+                  // The arguments are passed in consecutive registers
+                  const std::size_t first = stack.size() - paramAmount;
+                  synth.NextCall();
+                  for(unsigned i = 0; i < paramAmount; ++i)
+                      synth.EmitMove(synth.Argument(i), stack[first + i]);
+                  stack.resize(first);
+
+                  PendingInstruction instruction(opcode);
+                  instruction.operand[0] = synth.NewTemporary();
+                  instruction.operand[1] = function;
+                  instruction.operand[2] = synth.Argument(0);
+                  instruction.defMask = 1;
+                  instruction.useMask = 4;
+                  synth.Emit(instruction);
+                  stack.push_back(instruction.operand[0]);
+                  break;
+              }
+
+              case cSinCos:
+              case cSinhCosh:
+              {
+                  if(stack.empty()) return false;
+                  PendingInstruction instruction(opcode);
+                  instruction.operand[0] = synth.NewTemporary();
+                  instruction.operand[1] = stack.back();
+                  instruction.operand[2] = synth.NewTemporary();
+                  instruction.defMask = 1 | 4;
+                  instruction.useMask = 2;
+                  synth.Emit(instruction);
+                  stack.back() = instruction.operand[0];
+                  stack.push_back(instruction.operand[2]);
+                  break;
+              }
+
+              default:
+              {
+                  unsigned paramAmount;
+                  if(IsUnaryOpcode(opcode)) paramAmount = 1;
+                  else if(IsBinaryOpcode(opcode) || opcode == cLog2by)
+                      paramAmount = 2;
+                  else if(opcode == cFma || opcode == cFms) paramAmount = 3;
+                  else if(opcode == cFmma || opcode == cFmms) paramAmount = 4;
+                  else return false;
+
+                  if(stack.size() < paramAmount) return false;
+                  for(unsigned i = 0; i < paramAmount; ++i)
+                      params[i] = stack[stack.size() - paramAmount + i];
+                  stack.resize(stack.size() - paramAmount);
+
+                  unsigned registerOpcode = opcode;
+                  if(opcode == cRDiv || opcode == cRSub)
+                  {
+                      std::swap(params[0], params[1]);
+                      registerOpcode = opcode == cRDiv ? cDiv : cSub;
+                  }
+                  synth.FuseProducts(registerOpcode, params, paramAmount,
+                                     stack, ifs);
+                  stack.push_back(synth.EmitOperation(registerOpcode, params,
+                                                      paramAmount));
+              }
+            }
+        }
+
+        // Like Eval(), the result is the topmost value
+        if(!ifs.empty() || stack.empty() || synth.CodeSize() == 0)
+            return false;
+
+        std::vector<unsigned> results;
+        for(unsigned i = 0; i < resultPositions.size(); ++i)
+        {
+            if(resultPositions[i] >= stack.size()) return false;
+            results.push_back(stack[resultPositions[i]]);
+        }
+        results.push_back(stack.back());
+
+        synth.Finish(code, registerCount, results, resultRegisters);
+        resultRegister = resultRegisters.back();
+        resultRegisters.pop_back();
+        return true;
+    }
+
+    void FindIncrementalSets(
+        const std::vector<RegisterInstruction>& code,
+        unsigned immedAmount,
+        unsigned variablesAmount,
+        unsigned registerCount,
+        const std::vector<unsigned>& funcParamAmounts,
+        const std::vector<unsigned>& parserParamAmounts,
+        std::vector<unsigned long long>& sets)
+    {
+        // The variables which the value in each register depends on
+        std::vector<unsigned long long> masks(registerCount, 0);
+        for(unsigned i = 0; i < variablesAmount; ++i)
+            masks[immedAmount + i] = 1ULL << (i < 63 ? i : 63);
+
+        /* The if() branches around the current instruction: where each
+         * one ends, and the variables of the conditions leading to it.
+         */
+        struct Branch { unsigned end; unsigned long long mask; };
+        std::vector<Branch> branches;
+
+        const std::size_t words = (code.size() + 63) / 64;
+        sets.assign(64 * words, 0);
+        for(unsigned i = 0; i < code.size(); ++i)
+        {
+            while(!branches.empty() && branches.back().end <= i)
+                branches.pop_back();
+
+            const RegisterInstruction& in = code[i];
+            unsigned long long mask =
+                branches.empty() ? 0 : branches.back().mask;
+            switch(in.opcode)
+            {
+              case cIf:
+              case cAbsIf:
+                  branches.push_back(Branch{in.b, mask | masks[in.a]});
+                  continue;
+
+              case cJump:
+                  // The else branch has the same conditions as the then one
+                  if(!branches.empty())
+                      branches.back().end =
+                          std::max(branches.back().end, in.a);
+                  continue;
+
+              case cFCall:
+              case cPCall:
+              {
+                  const unsigned paramAmount = in.opcode == cFCall ?
+                      funcParamAmounts[in.a] : parserParamAmounts[in.a];
+                  for(unsigned p = 0; p < paramAmount; ++p)
+                      mask |= masks[in.b + p];
+                  break;
+              }
+
+              case cSinCos:
+              case cSinhCosh:
+                  mask |= masks[in.a];
+                  break;
+
+              case cFmma:
+              case cFmms:
+                  mask |= masks[in.d];
+                  // fallthrough
+              case cFma:
+              case cFms:
+                  mask |= masks[in.c];
+                  // fallthrough
+              default:
+                  mask |= masks[in.a];
+                  if(IsBinaryOpcode(in.opcode) || in.opcode == cLog2by
+                  || in.opcode == cFma || in.opcode == cFms
+                  || in.opcode == cFmma || in.opcode == cFmms)
+                      mask |= masks[in.b];
+            }
+            for(unsigned bit = 0; bit < 64; ++bit)
+                if(mask & (1ULL << bit))
+                    sets[bit * words + i / 64] |= 1ULL << (i % 64);
+
+            /* A register written within a branch may hold the value of
+             * the other branch, or of the code before the if(), instead.
+             */
+            if(branches.empty())
+                masks[in.result] = mask;
+            else
+                masks[in.result] |= mask;
+            if(in.opcode == cSinCos || in.opcode == cSinhCosh)
+            {
+                if(branches.empty())
+                    masks[in.b] = mask;
+                else
+                    masks[in.b] |= mask;
+            }
+        }
+    }
+}
+
+#endif
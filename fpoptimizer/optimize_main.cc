@@ -4,6 +4,8 @@
 
 #include "codetree.hh"
 #include "optimize.hh"
+#include "registercode.hh"
+#include "derivative.hh"
 
 #ifdef FP_SUPPORT_OPTIMIZER
 
@@ -12,6 +14,23 @@ void FunctionParserBase<Value_t>::Optimize()
 {
     using namespace FPoptimizer_CodeTree;
 
+    // The results made by Gradient() are optimized already
+    if(!mData->mResultPositions.empty()) return;
+
+    // The code made by Parse() through the parse cache may have been
+    // optimized already
+    const std::string cacheKey = mData->mParseCacheKey.empty() ?
+        std::string() : mData->mParseCacheKey + '\0' + "Optimize()";
+    if(TakeFromParseCache(cacheKey)) return;
+
+    // Another process may have optimized the same code into a cache file
+    const std::string fileKey = CacheFileKey();
+    if(LoadFromCacheFile(fileKey))
+    {
+        PutInParseCache(cacheKey);
+        return;
+    }
+
     CopyOnWrite();
 
     //PrintByteCode(std::cout);
@@ -40,26 +59,322 @@ void FunctionParserBase<Value_t>::Optimize()
     fprintf(stderr, "Estimated stacktop %u\n", (unsigned)stacktop_max);
     fflush(stderr);*/
 
-    if(mData->mStackSize != stacktop_max)
+    std::vector<unsigned> resultPositions;
+    SetOptimizedCode(byteCode, immed, stacktop_max, resultPositions);
+    SaveToCacheFile(fileKey);
+    PutInParseCache(cacheKey);
+
+    //PrintByteCode(std::cout);
+}
+
+/* Replaces the function with its derivative with respect to the variable
+   of the given index, optimized like by Optimize(). Returns false, leaving
+   the function unchanged, if it can't be differentiated.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Differentiate(unsigned variableIndex)
+{
+    using namespace FPoptimizer_CodeTree;
+
+    if(FUNCTIONPARSERTYPES::IsIntType<Value_t>::value
+    || mData->mParseErrorType != FunctionParserErrorType::no_error
+    || !mData->mResultPositions.empty()
+    || variableIndex >= mData->mVariablesAmount)
+        return false;
+
+    CodeTree<Value_t> tree, derivative;
+    tree.GenerateFrom(*mData);
+    if(!FPoptimizer_CodeTree::Differentiate(tree, variableIndex, derivative))
+        return false;
+
+    CopyOnWrite();
+    FPoptimizer_Optimize::ApplyGrammars(derivative);
+
+    std::vector<unsigned> byteCode;
+    std::vector<Value_t> immed;
+    size_t stacktop_max = 0;
+    derivative.SynthesizeByteCode(byteCode, immed, stacktop_max);
+
+    std::vector<unsigned> resultPositions;
+    SetOptimizedCode(byteCode, immed, stacktop_max, resultPositions);
+    return true;
+}
+
+/* Replaces the function with one computing both its value and all of its
+   partial derivatives, for EvalAll(). The subexpressions they have in
+   common are computed only once. Eval() still returns just the value.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Gradient()
+{
+    using namespace FPoptimizer_CodeTree;
+
+    if(FUNCTIONPARSERTYPES::IsIntType<Value_t>::value
+    || mData->mParseErrorType != FunctionParserErrorType::no_error
+    || !mData->mResultPositions.empty())
+        return false;
+
+    CodeTree<Value_t> tree;
+    tree.GenerateFrom(*mData);
+
+    // The value comes last, so that it is the topmost one Eval() returns
+    const unsigned variablesAmount = mData->mVariablesAmount;
+    std::vector<CodeTree<Value_t> > trees(variablesAmount + 1);
+    for(unsigned i = 0; i < variablesAmount; ++i)
+        if(!FPoptimizer_CodeTree::Differentiate(tree, i, trees[i]))
+            return false;
+    trees[variablesAmount] = tree;
+
+    CopyOnWrite();
+    for(unsigned i = 0; i <= variablesAmount; ++i)
+        FPoptimizer_Optimize::ApplyGrammars(trees[i]);
+
+    std::vector<unsigned> byteCode;
+    std::vector<Value_t> immed;
+    size_t stacktop_max = 0;
+    std::vector<unsigned> positions;
+    CodeTree<Value_t>::SynthesizeByteCode(trees, byteCode, immed,
+                                          stacktop_max, positions);
+
+    std::vector<unsigned> resultPositions(1, positions[variablesAmount]);
+    resultPositions.insert(resultPositions.end(),
+                           positions.begin(), positions.end() - 1);
+    SetOptimizedCode(byteCode, immed, stacktop_max, resultPositions);
+    return true;
+}
+
+/* Replaces the function with one computing the functions of all the given
+   parsers, for EvalAll(): result n is the value of the function of parser
+   n. The subexpressions they have in common are computed only once. The
+   parsers must have the same variables, in the same order; the combined
+   parser gets them, and the constants, units and functions, from the first
+   one, and Eval() returns the value of its function. Returns false,
+   leaving the function unchanged, if the parsers can't be combined.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Combine
+(const std::vector<const FunctionParserBase*>& parsers)
+{
+    using namespace FPoptimizer_CodeTree;
+    using namespace FUNCTIONPARSERTYPES;
+
+    if(parsers.empty()) return false;
+    const Data& first = *parsers[0]->mData;
+    for(size_t n = 0; n < parsers.size(); ++n)
     {
-        mData->mStackSize = unsigned(stacktop_max); // Note: Ignoring GCC warning here.
-#if !defined(FP_USE_THREAD_SAFE_EVAL) && \
-    !defined(FP_USE_THREAD_SAFE_EVAL_WITH_ALLOCA)
-        mData->mStack.resize(stacktop_max);
-#endif
+        const Data& data = *parsers[n]->mData;
+        if(data.mParseErrorType != FunctionParserErrorType::no_error
+        || !data.mResultPositions.empty()
+        || data.mVariablesAmount != first.mVariablesAmount)
+            return false;
+        for(typename NamePtrsMap<Value_t>::const_iterator
+                i = data.mNamePtrs.begin(); i != data.mNamePtrs.end(); ++i)
+        {
+            if(i->second.type != NameData<Value_t>::VARIABLE) continue;
+            typename NamePtrsMap<Value_t>::const_iterator
+                j = first.mNamePtrs.find(i->first);
+            if(j == first.mNamePtrs.end()
+            || j->second.type != NameData<Value_t>::VARIABLE
+            || j->second.index != i->second.index)
+                return false;
+        }
     }
 
+    /* The functions called by each parser are appended to those of the
+     * first one, and the bytecode is read with its calls renumbered
+     * accordingly. The function of the first parser comes last, so that
+     * it is the topmost value, which Eval() returns.
+     */
+    Data combined;
+    combined.mVariablesAmount = first.mVariablesAmount;
+    std::vector<CodeTree<Value_t> > trees(parsers.size());
+    for(size_t n = 0; n < parsers.size(); ++n)
+    {
+        const Data& data = *parsers[n]->mData;
+        const unsigned funcOffset = unsigned(combined.mFuncPtrs.size());
+        const unsigned parserOffset = unsigned(combined.mFuncParsers.size());
+        combined.mFuncPtrs.insert(combined.mFuncPtrs.end(),
+                                  data.mFuncPtrs.begin(),
+                                  data.mFuncPtrs.end());
+        combined.mFuncParsers.insert(combined.mFuncParsers.end(),
+                                     data.mFuncParsers.begin(),
+                                     data.mFuncParsers.end());
+
+        combined.mByteCode = data.mByteCode;
+        combined.mImmed = data.mImmed;
+        std::vector<unsigned>& byteCode = combined.mByteCode;
+        for(size_t IP = 0; IP < byteCode.size(); ++IP)
+            switch(byteCode[IP])
+            {
+              case cIf: case cAbsIf: case cJump: IP += 2; break;
+              case cFCall: byteCode[++IP] += funcOffset; break;
+              case cPCall: byteCode[++IP] += parserOffset; break;
+              case cFetch: ++IP; break;
+              case cPopNMov: IP += 2; break;
+              default: break;
+            }
+        trees[n ? n - 1 : parsers.size() - 1].GenerateFrom(combined);
+    }
+
+    // The rest of the data comes from the first parser
+    if(this != parsers[0]) *this = *parsers[0];
+    CopyOnWrite();
+    mData->mFuncPtrs.swap(combined.mFuncPtrs);
+    mData->mFuncParsers.swap(combined.mFuncParsers);
+
+    for(size_t n = 0; n < trees.size(); ++n)
+        FPoptimizer_Optimize::ApplyGrammars(trees[n]);
+
+    std::vector<unsigned> byteCode;
+    std::vector<Value_t> immed;
+    size_t stacktop_max = 0;
+    std::vector<unsigned> positions;
+    CodeTree<Value_t>::SynthesizeByteCode(trees, byteCode, immed,
+                                          stacktop_max, positions);
+
+    std::vector<unsigned> resultPositions(1, positions.back());
+    resultPositions.insert(resultPositions.end(),
+                           positions.begin(), positions.end() - 1);
+    SetOptimizedCode(byteCode, immed, stacktop_max, resultPositions);
+    return true;
+}
+
+/* Replaces the function with one where the variables of the given indices
+   are fixed to the given values, optimized like by Optimize(). Only the
+   remaining variables are left, in their original order. Returns false,
+   leaving the function unchanged, if an index is out of range or given
+   twice, or if the function can't be specialized.
+*/
+template<typename Value_t>
+bool FunctionParserBase<Value_t>::Specialize
+(const std::vector<std::pair<unsigned, Value_t> >& fixedVariables)
+{
+    using namespace FPoptimizer_CodeTree;
+
+    if(mData->mParseErrorType != FunctionParserErrorType::no_error
+    || !mData->mResultPositions.empty())
+        return false;
+
+    // The tree substituted for each variable: its value, or the variable
+    // of the specialized function
+    const unsigned variablesAmount = mData->mVariablesAmount;
+    std::vector<CodeTree<Value_t> > varTrees(variablesAmount);
+    for(size_t i = 0; i < fixedVariables.size(); ++i)
+    {
+        const unsigned index = fixedVariables[i].first;
+        if(index >= variablesAmount || varTrees[index].IsDefined())
+            return false;
+        varTrees[index] = CodeTreeImmed(fixedVariables[i].second);
+    }
+
+    std::vector<std::string> names(variablesAmount);
+    for(typename FUNCTIONPARSERTYPES::NamePtrsMap<Value_t>::const_iterator
+            i = mData->mNamePtrs.begin(); i != mData->mNamePtrs.end(); ++i)
+        if(i->second.type == FUNCTIONPARSERTYPES::NameData<Value_t>::VARIABLE)
+            names[i->second.index - FUNCTIONPARSERTYPES::VarBegin].assign
+                (i->first.name, i->first.nameLength);
+
+    std::string variables;
+    unsigned remainingAmount = 0;
+    for(unsigned i = 0; i < variablesAmount; ++i)
+        if(!varTrees[i].IsDefined())
+        {
+            varTrees[i] = CodeTreeVar<Value_t>
+                (FUNCTIONPARSERTYPES::VarBegin + remainingAmount);
+            variables += (remainingAmount++ ? "," : "") + names[i];
+        }
+
+    CodeTree<Value_t> tree;
+    tree.GenerateFrom(*mData, varTrees);
+
+    CopyOnWrite();
+    FPoptimizer_Optimize::ApplyGrammars(tree);
+
+    std::vector<unsigned> byteCode;
+    std::vector<Value_t> immed;
+    size_t stacktop_max = 0;
+    tree.SynthesizeByteCode(byteCode, immed, stacktop_max);
+
+    ParseVariables(variables);
+    std::vector<unsigned> resultPositions;
+    SetOptimizedCode(byteCode, immed, stacktop_max, resultPositions);
+    return true;
+}
+
+/* Replaces the bytecode with the given optimized bytecode, and creates the
+   register code and the threaded code for it. resultPositions is empty, or
+   the stack positions of the results for EvalAll().
+*/
+template<typename Value_t>
+void FunctionParserBase<Value_t>::SetOptimizedCode
+(std::vector<unsigned>& byteCode, std::vector<Value_t>& immed,
+ std::size_t stacktop_max, std::vector<unsigned>& resultPositions)
+{
+    std::vector<unsigned> funcParamAmounts, parserParamAmounts;
+    for(size_t i = 0; i < mData->mFuncPtrs.size(); ++i)
+        funcParamAmounts.push_back(mData->mFuncPtrs[i].mNumParams);
+    for(size_t i = 0; i < mData->mFuncParsers.size(); ++i)
+        parserParamAmounts.push_back(mData->mFuncParsers[i].mNumParams);
+
+    std::vector<FUNCTIONPARSERTYPES::RegisterInstruction> registerCode;
+    unsigned registerCount = 0, registerResult = 0;
+    std::vector<unsigned> resultRegisters;
+    if(FPoptimizer_RegisterCode::SynthesizeRegisterCode
+       (byteCode, unsigned(immed.size()), mData->mVariablesAmount,
+        funcParamAmounts, parserParamAmounts, resultPositions,
+        registerCode, registerCount, registerResult, resultRegisters))
+    {
+        // The registers are kept in the evaluation stack
+        if(registerCount > stacktop_max) stacktop_max = registerCount;
+    }
+
+    // The code of EvalIncremental(), which keeps its registers itself
+    std::vector<FUNCTIONPARSERTYPES::RegisterInstruction> incrementalCode;
+    unsigned incrementalRegisterCount = 0, incrementalResult = 0;
+    std::vector<unsigned> noResultPositions, noResultRegisters;
+    std::vector<unsigned long long> incrementalSets;
+    if(FPoptimizer_RegisterCode::SynthesizeRegisterCode
+       (byteCode, unsigned(immed.size()), mData->mVariablesAmount,
+        funcParamAmounts, parserParamAmounts, noResultPositions,
+        incrementalCode, incrementalRegisterCount, incrementalResult,
+        noResultRegisters, false))
+        FPoptimizer_RegisterCode::FindIncrementalSets
+            (incrementalCode, unsigned(immed.size()), mData->mVariablesAmount,
+             incrementalRegisterCount, funcParamAmounts, parserParamAmounts,
+             incrementalSets);
+    else
+        incrementalCode.clear();
+
+    mData->mStackSize = unsigned(stacktop_max);
+
     mData->mByteCode.swap(byteCode);
     mData->mImmed.swap(immed);
-
-    //PrintByteCode(std::cout);
+    mData->mResultPositions.swap(resultPositions);
+    mData->mRegisterCode.swap(registerCode);
+    mData->mRegisterResult = registerResult;
+    mData->mResultRegisters.swap(resultRegisters);
+    mData->mIncrementalCode.swap(incrementalCode);
+    mData->mIncrementalRegisterCount = incrementalRegisterCount;
+    mData->mIncrementalResult = incrementalResult;
+    mData->mIncrementalSets.swap(incrementalSets);
+    mData->mIncrementalCodeVersion = NewIncrementalCodeVersion();
+    CreateThreadedCode();
 }
 
 #define FUNCTIONPARSER_INSTANTIATE_EMPTY_OPTIMIZE(type) \
     template<> void FunctionParserBase< type >::Optimize() {}
 
 #define FUNCTIONPARSER_INSTANTIATE_OPTIMIZE(type) \
-    template void FunctionParserBase<type>::Optimize();
+    template void FunctionParserBase<type>::Optimize(); \
+    template bool FunctionParserBase<type>::Differentiate(unsigned); \
+    template bool FunctionParserBase<type>::Gradient(); \
+    template bool FunctionParserBase<type>::Combine \
+    (const std::vector<const FunctionParserBase<type>*>&); \
+    template bool FunctionParserBase<type>::Specialize \
+    (const std::vector<std::pair<unsigned, type> >&); \
+    template void FunctionParserBase<type>::SetOptimizedCode \
+    (std::vector<unsigned>&, std::vector<type>&, std::size_t, \
+     std::vector<unsigned>&);
 
 #ifdef FP_SUPPORT_MPFR_FLOAT_TYPE
 FUNCTIONPARSER_INSTANTIATE_OPTIMIZE(MpfrFloat)
@@ -0,0 +1,77 @@
+#ifndef FPOptimizer_RegisterCodeHH
+#define FPOptimizer_RegisterCodeHH
+
+#include "fpconfig.hh"
+#include "extrasrc/fptypes.hh"
+
+#ifdef FP_SUPPORT_OPTIMIZER
+
+#include <vector>
+
+namespace FPoptimizer_RegisterCode
+{
+    /* Translates bytecode synthesized by CodeTree::SynthesizeByteCode()
+     * into the three-address register code run by Eval(). Every stack
+     * slot of the bytecode becomes a value in a register; pushing
+     * immediates and variables, cDup, cFetch and cPopNMov only rename
+     * values, so they produce no instructions at all. The temporaries are
+     * then given registers with a linear scan over their live ranges.
+     * A cAdd or cSub is fused with the cMul or cSqr computing an operand
+     * which nothing else uses, into a cFma, cFms, cFmma or cFmms.
+     *
+     * The registers are numbered so that the immediates come first, then
+     * the variables, then the temporaries, and last the arguments of
+     * function calls. registerCount is set to the total number of
+     * registers, and resultRegister to the one holding the result.
+     *
+     * funcParamAmounts and parserParamAmounts give the number of
+     * parameters of the functions called by cFCall and cPCall.
+     *
+     * If the bytecode computes several results (see EvalAll()),
+     * resultPositions gives their positions in the final stack, and
+     * resultRegisters receives the registers holding them. The registers
+     * of all the results are kept intact until the end.
+     *
+     * If reuseRegisters is false, every temporary and every argument of
+     * a function call gets a register of its own, as EvalIncremental()
+     * needs.
+     *
+     * Returns false if the bytecode contains something that can't be
+     * translated, or if it consists of nothing but a single push.
+     */
+    bool SynthesizeRegisterCode(
+        const std::vector<unsigned>& byteCode,
+        unsigned immedAmount,
+        unsigned variablesAmount,
+        const std::vector<unsigned>& funcParamAmounts,
+        const std::vector<unsigned>& parserParamAmounts,
+        const std::vector<unsigned>& resultPositions,
+        std::vector<FUNCTIONPARSERTYPES::RegisterInstruction>& code,
+        unsigned& registerCount,
+        unsigned& resultRegister,
+        std::vector<unsigned>& resultRegisters,
+        bool reuseRegisters = true);
+
+    /* Finds the instructions of the register code which have to be run
+     * again when variables change, for EvalIncremental(). sets receives
+     * 64 sets of instructions, each as (code.size()+63)/64 words of bits:
+     * set n has the instructions depending on the variable n, and the
+     * last set those depending on any of the variables from the 64th on.
+     * Instructions within an if() branch also depend on the variables of
+     * its condition; the jumps themselves are in no set. The functions
+     * called by cFCall and cPCall are assumed to depend on their
+     * parameters only.
+     */
+    void FindIncrementalSets(
+        const std::vector<FUNCTIONPARSERTYPES::RegisterInstruction>& code,
+        unsigned immedAmount,
+        unsigned variablesAmount,
+        unsigned registerCount,
+        const std::vector<unsigned>& funcParamAmounts,
+        const std::vector<unsigned>& parserParamAmounts,
+        std::vector<unsigned long long>& sets);
+}
+
+#endif
+
+#endif
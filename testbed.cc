@@ -13,6 +13,7 @@ static const char* const kVersionNumber = "2.3.0.12";
 
 #include "fpconfig.hh"
 #include "fparser.hh"
+#include "fparser_constexpr.hh"
 #include "extrasrc/fpaux.hh"
 #include "tests/stringutil.hh"
 
@@ -22,6 +23,7 @@ static const char* const kVersionNumber = "2.3.0.12";
 #include <cstdio>
 #include <algorithm>
 #include <cstring>
+#include <cstdint>
 #include <cassert>
 #include <future>
 #include <atomic>
@@ -1674,6 +1676,1947 @@ int testMultithreadedEvaluation()
 
 #endif
 
+//=========================================================================
+// Test evaluation contexts
+//=========================================================================
+#include <thread>
+
+namespace
+{
+    DefaultValue_t contextTestFunction(const DefaultValue_t* p)
+    {
+        return p[0] * p[1];
+    }
+
+    /* Each thread evaluates the same parser with its own context, and with
+       Eval(Vars, &error). Rows where y = 0 fail in the nested parser and
+       rows where x = y fail in the main one, so both errors have to reach
+       the right caller. */
+    bool testContextEvaluation(const DefaultParser& fp, unsigned threadNumber,
+                               DefaultParser::EvalContext& context)
+    {
+        const DefaultValue_t epsilon = testbedEpsilon<DefaultValue_t>() * 2;
+        for(unsigned i = 0; i < 20000; ++i)
+        {
+            const DefaultValue_t vars[2] =
+                { DefaultValue_t(int(i % 200) - 100) / 20,
+                  DefaultValue_t(int(threadNumber + i % 3) - 2) };
+            const DefaultValue_t x = vars[0], y = vars[1];
+            const bool fails = y == 0 || x - y == 0;
+            const DefaultValue_t expected = fails ? 0 :
+                std::sqrt(x*x) + 1/y + x*y - 1/(x-y);
+
+            for(int perCallError = 0; perCallError < 2; ++perCallError)
+            {
+                int error = -1;
+                const DefaultValue_t result = perCallError ?
+                    fp.Eval(vars, &error) : fp.Eval(context, vars);
+                if(!perCallError) error = context.EvalError();
+                if(error != (fails ? 1 : 0) ||
+                   std::fabs(result - expected) >
+                   epsilon * (1 + std::fabs(expected)))
+                {
+                    if(gVerbosityLevel >= 2)
+                        std::cout << "\n - Thread " << threadNumber << ": ("
+                                  << x << "," << y << ") -> " << result
+                                  << " (EvalError " << error
+                                  << ") instead of " << expected << std::endl;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int testEvaluationContexts()
+{
+    DefaultParser nested, fp;
+    nested.Parse("sqrt(x) + 1/y", "x,y");
+    fp.AddFunction("n", nested);
+    fp.AddFunction("m", contextTestFunction, 2);
+    fp.Parse("n(x*x, y) + m(x, y) - 1/(x-y)", "x,y");
+
+    const unsigned threadsAmount = 4;
+    for(int optimized = 0; optimized < 2; ++optimized)
+    {
+        bool ok[threadsAmount];
+        std::vector<std::thread> threads;
+        for(unsigned t = 0; t < threadsAmount; ++t)
+            threads.emplace_back([&fp, &ok, t]()
+            {
+                DefaultParser::EvalContext context;
+                ok[t] = testContextEvaluation(fp, t, context);
+            });
+        for(unsigned t = 0; t < threadsAmount; ++t)
+        {
+            threads[t].join();
+            if(!ok[t]) return false;
+        }
+
+        // The callers got the errors, the parsers didn't
+        if(fp.EvalError() != 0 || nested.EvalError() != 0) return false;
+        fp.Optimize();
+    }
+    return true;
+}
+
+//=========================================================================
+// Test batch evaluation
+//=========================================================================
+namespace
+{
+    bool testBatchEvaluationWith(DefaultParser& fp,
+                                 const DefaultValue_t* rows, unsigned count,
+                                 const DefaultValue_t* expectedResults,
+                                 int expectedError)
+    {
+        std::vector<DefaultValue_t> results(count);
+        fp.EvalBatch(rows, 2, count, results.data());
+        if(fp.EvalError() != expectedError)
+        {
+            if(gVerbosityLevel >= 2)
+                std::cout << "\n - EvalBatch() gave EvalError() "
+                          << fp.EvalError() << " instead of "
+                          << expectedError << std::endl;
+            return false;
+        }
+        for(unsigned row = 0; row < count; ++row)
+        {
+            if(std::fabs(results[row] - expectedResults[row]) >
+               testbedEpsilon<DefaultValue_t>())
+            {
+                if(gVerbosityLevel >= 2)
+                    std::cout << "\n - EvalBatch() returned " << results[row]
+                              << " instead of " << expectedResults[row]
+                              << " for row " << row << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    unsigned gBatchFunctionCalls = 0;
+
+    DefaultValue_t batchCountingFunction(const DefaultValue_t* p)
+    {
+        ++gBatchFunctionCalls;
+        return p[0] * 2;
+    }
+
+    unsigned gBatchFunctionRows = 0;
+
+    void batchCountingBlockFunction(const DefaultValue_t* const* p,
+                                    std::size_t n, DefaultValue_t* results)
+    {
+        ++gBatchFunctionCalls;
+        gBatchFunctionRows += unsigned(n);
+        for(std::size_t i = 0; i < n; ++i) results[i] = p[0][i] * 2;
+    }
+}
+
+int testBatchEvaluation()
+{
+    const DefaultValue_t rows[] =
+        { 1, 4,   0, 4,   2, -1,   4, 9,   -8, -0.5 };
+    const unsigned count = sizeof(rows) / sizeof(rows[0]) / 2;
+
+    // Failing rows evaluate to 0, and EvalError() tells the first error.
+    const DefaultValue_t results1[] = { 3, 0, 0, 3.25, 0 };
+    const DefaultValue_t results2[] = { 2, 0, 2.5, 4.25, -5 };
+
+    DefaultParser fp1, fp2;
+    fp1.Parse("1/x + sqrt(y)", "x,y");
+    fp2.Parse("if(x < 0, sqrt(-x-y-y), 1/x) + x", "x,y");
+
+    for(int optimized = 0; optimized < 2; ++optimized)
+    {
+        if(!testBatchEvaluationWith(fp1, rows, count, results1, 1))
+            return false;
+        if(!testBatchEvaluationWith(fp2, rows, count, results2, 1))
+            return false;
+        fp1.Optimize();
+        fp2.Optimize();
+    }
+
+    // More rows than fit in one block
+    std::vector<DefaultValue_t> manyRows, manyResults;
+    for(unsigned row = 0; row < 1000; ++row)
+    {
+        manyRows.push_back(row + 1);
+        manyRows.push_back(row % 7);
+        manyResults.push_back(1.0 / (row + 1) + std::sqrt(DefaultValue_t(row % 7)));
+    }
+    if(!testBatchEvaluationWith(fp1, manyRows.data(), 1000,
+                                manyResults.data(), 0))
+        return false;
+
+    /* The rows of each block take different branches. The untaken branches
+       would fail, and the function must be called only for its own rows.
+    */
+    DefaultParser fp3;
+    fp3.AddFunction("c", batchCountingFunction, 1);
+    fp3.Parse("if(y < 3, sqrt(2 - y) + x, if(x > 500, c(x), log(y - 2)))",
+              "x,y");
+    unsigned expectedCalls = 0;
+    for(unsigned row = 0; row < 1000; ++row)
+    {
+        const DefaultValue_t x = manyRows[row * 2], y = manyRows[row * 2 + 1];
+        manyResults[row] = y < 3 ? std::sqrt(2 - y) + x :
+            x > 500 ? (++expectedCalls, x * 2) : std::log(y - 2);
+    }
+    for(int optimized = 0; optimized < 2; ++optimized)
+    {
+        gBatchFunctionCalls = 0;
+        if(!testBatchEvaluationWith(fp3, manyRows.data(), 1000,
+                                    manyResults.data(), 0)
+        || gBatchFunctionCalls != expectedCalls)
+            return false;
+        fp3.Optimize();
+    }
+
+    // A batch function is called once for the rows of each block
+    DefaultParser fp4;
+    fp4.AddFunction("c", batchCountingBlockFunction, 1);
+    fp4.Parse("if(y < 3, sqrt(2 - y) + x, if(x > 500, c(x), log(y - 2)))",
+              "x,y");
+    for(int optimized = 0; optimized < 2; ++optimized)
+    {
+        gBatchFunctionCalls = gBatchFunctionRows = 0;
+        if(!testBatchEvaluationWith(fp4, manyRows.data(), 1000,
+                                    manyResults.data(), 0)
+        || gBatchFunctionRows != expectedCalls
+        || gBatchFunctionCalls == 0 || gBatchFunctionCalls * 16 > expectedCalls)
+            return false;
+        fp4.Optimize();
+    }
+    const DefaultValue_t vars[] = { 600, 5 };
+    if(fp4.Eval(vars) != 1200) return false;
+    return true;
+}
+
+//=========================================================================
+// Test JIT compilation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    double jitTestFunction(const double* p) { return p[0] * 2 - p[1]; }
+
+    class JITTestWrapper: public FunctionParser::FunctionWrapper
+    {
+     public:
+        virtual double callFunction(const double* p) { return p[0] + 10; }
+    };
+
+    /* Compares Eval() of a JIT-compiled copy of fp against fp itself,
+       including the error codes. */
+    bool testJITWith(FunctionParser& fp, const double* rows, unsigned count,
+                     unsigned paramAmount)
+    {
+        FunctionParser jitParser(fp);
+        jitParser.ForceDeepCopy();
+        if(!jitParser.CreateJIT())
+        {
+            if(gVerbosityLevel >= 2)
+                std::cout << "\n - CreateJIT() failed" << std::endl;
+            return false;
+        }
+
+        for(unsigned row = 0; row < count; ++row)
+        {
+            const double* vars = &rows[row * paramAmount];
+            const double expected = fp.Eval(vars);
+            const double result = jitParser.Eval(vars);
+            if(result != expected || jitParser.EvalError() != fp.EvalError())
+            {
+                if(gVerbosityLevel >= 2)
+                    std::cout << "\n - JIT returned " << result
+                              << " (EvalError " << jitParser.EvalError()
+                              << ") instead of " << expected << " (EvalError "
+                              << fp.EvalError() << ") for row " << row
+                              << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int testJITCompilation()
+{
+    FunctionParser fp;
+    fp.Parse("x+y", "x,y");
+    if(!fp.CreateJIT()) return -1;
+
+    // The function pointer can also be called directly
+    const FunctionParser::JITFunctionPtr function = fp.GetJITFunction();
+    const double vars[] = { 2, 3 };
+    int evalError = -1;
+    if(!function || function(vars, &evalError) != 5 || evalError != 0)
+        return false;
+
+    // Parsing again discards the machine code
+    fp.Parse("x-y", "x,y");
+    if(fp.GetJITFunction() || fp.Eval(vars) != -1) return false;
+
+    const double rows[] =
+        { 1, 4,   0, 4,   2, -1,   4, 9,   -8, -0.5,   0, -2,   0.5, 0.5,
+          -1, 0,   3, 1e300,   -2.5, 7 };
+    const unsigned count = sizeof(rows) / sizeof(rows[0]) / 2;
+
+    const char* const functions[] =
+    {
+        "1/x + sqrt(y)", "x%y + x/y", "log(x) + log10(y) + log2(x+1)",
+        "acos(x) + asin(y) + acosh(y) + atanh(x)", "x^y + pow(y,x)",
+        "cot(x) + csc(y) + sec(x*y)", "if(x < 0, sqrt(-x-y-y), 1/x) + x",
+        "if(x & y, x | y, !x) + (x = y) + (x != y) + (x <= y) + (x >= y)",
+        "sin(x)*cos(x) + sinh(y)/cosh(y) + tan(x+y) + atan2(x,y)",
+        "min(x,y) - max(x,y) + abs(x) + floor(y) + ceil(x) + trunc(-y)",
+        "int(x*3.5) + exp(y) + exp2(x) + cbrt(y) + hypot(x,y) + atan(x)",
+        "x*y + 1 - y*x*5 + x*x*x + 1/(x*x+1) - y/(x*x+1)",
+        "a := x*y + 1; b := if(a < 2, sin(a), a*x); a*b - b/a",
+        "f(x, y) + w(x*y) + g(x+1)",
+        // Deep enough to keep some stack slots in the stack frame
+        "x*(y+(x*(y+(x*(y+(x*(y+(x*(y+(x*(y+(x*(y+(x*(y+sin(x))))))))))))))))",
+        "sin(x+cos(y+sin(x+cos(y+sin(x+cos(y+sin(x+cos(y+sin(x+cos(y+"
+        "sin(x+cos(y+sin(x+cos(y))))))))))))))"
+    };
+
+    FunctionParser nested;
+    nested.Parse("1/x", "x");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        fp.AddFunction("f", jitTestFunction, 2);
+        fp.AddFunctionWrapper("w", JITTestWrapper(), 1);
+        fp.AddFunction("g", nested);
+        if(fp.Parse(functions[i], "x,y") >= 0)
+        {
+            if(gVerbosityLevel >= 2)
+                std::cout << "\n - Parsing \"" << functions[i] << "\" failed: "
+                          << fp.ErrorMsg() << std::endl;
+            return false;
+        }
+
+        for(int optimized = 0; optimized < 2; ++optimized)
+        {
+            if(!testJITWith(fp, rows, count, 2))
+            {
+                if(gVerbosityLevel >= 2)
+                    std::cout << " - for \"" << functions[i] << "\"" << std::endl;
+                return false;
+            }
+            fp.Optimize();
+        }
+    }
+    return true;
+}
+#else
+int testJITCompilation()
+{
+    return -1;
+}
+#endif
+
+
+//=========================================================================
+// Test differentiation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    double diffTestFunction(const double* p) { return p[0] * p[0]; }
+
+    /* The derivatives are optimized, so they can differ from the expected
+       values in the last digits. Variable -1 stands for the value itself. */
+    bool compareDerivative(const char* function, int variable,
+                           const double* vars, double result, double expected)
+    {
+        if(std::fabs(result - expected) <= 1e-10 * (1 + std::fabs(expected)))
+            return true;
+        if(gVerbosityLevel >= 2)
+        {
+            std::cout << "\n - ";
+            if(variable < 0) std::cout << "Value";
+            else std::cout << "Derivative with respect to variable "
+                           << variable;
+            std::cout << " of \"" << function << "\" at (" << vars[0]
+                      << ", " << vars[1] << ") was " << result
+                      << " instead of " << expected << std::endl;
+        }
+        return false;
+    }
+}
+
+int testDifferentiation()
+{
+    FunctionParser fp;
+    fp.Parse("x", "x");
+    if(!fp.Differentiate(0)) return -1;
+
+    // Each function is followed by its derivatives with respect to x and y
+    const char* const functions[] =
+    {
+        "sin(x)*x^2 + y", "2*x*sin(x) + x^2*cos(x)", "1",
+        "x/y - sqrt(x*y)", "1/y - y/(2*sqrt(x*y))", "-x/(y*y) - x/(2*sqrt(x*y))",
+        "log(x*y) + exp(-x)", "1/x - exp(-x)", "1/y",
+        "atan2(y, x) + hypot(x, y)", "-y/(x*x+y*y) + x/hypot(x,y)",
+        "x/(x*x+y*y) + y/hypot(x,y)",
+        "if(x < y, x*x*y, x+y)", "if(x < y, 2*x*y, 1)", "if(x < y, x*x, 1)",
+        "a := x*y; a*a + cosh(a)", "2*x*y*y + y*sinh(x*y)",
+        "2*x*x*y + x*sinh(x*y)",
+        // Functions defined by another parser are inlined, and can be
+        "h(x) + y^3", "2*x", "3*y*y"
+    };
+    const double rows[] = { 0.5, 2,   1.25, 0.75,   3, 1.5 };
+
+    FunctionParser derivative, square;
+    square.Parse("x*x", "x");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); i += 3)
+    {
+        fp.AddFunction("g", diffTestFunction, 1);
+        fp.AddFunction("h", square);
+        fp.Parse(functions[i], "x,y");
+        FunctionParser gradient(fp);
+        if(!gradient.Gradient() || gradient.GetResultAmount() != 3)
+            return false;
+
+        for(unsigned variable = 0; variable < 2; ++variable)
+        {
+            FunctionParser differentiated(fp);
+            if(!differentiated.Differentiate(variable)) return false;
+            derivative.Parse(functions[i + 1 + variable], "x,y");
+
+            for(unsigned row = 0; row < 3; ++row)
+            {
+                const double* vars = &rows[row * 2];
+                double results[3];
+                gradient.EvalAll(vars, results);
+                if(!compareDerivative(functions[i], int(variable), vars,
+                                      differentiated.Eval(vars),
+                                      derivative.Eval(vars))
+                || !compareDerivative(functions[i], int(variable), vars,
+                                      results[1 + variable],
+                                      derivative.Eval(vars))
+                || !compareDerivative(functions[i], -1, vars,
+                                      results[0], fp.Eval(vars))
+                || gradient.Eval(vars) != results[0])
+                    return false;
+            }
+        }
+    }
+
+    // The derivative of a user-defined function isn't known
+    fp.Parse("g(x) + y", "x,y");
+    if(fp.Differentiate(0) || !fp.Differentiate(1)) return false;
+    return fp.Eval(rows) == 1;
+}
+#else
+int testDifferentiation()
+{
+    return -1;
+}
+#endif
+
+
+//=========================================================================
+// Test reverse-mode gradients
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    FunctionParser gNestedGradientParser;
+
+    // Evaluates a gradient of its own while EvalWithGradient() is running
+    double gradientTestFunction(const double* p)
+    {
+        double gradient[2];
+        return gNestedGradientParser.EvalWithGradient(p, gradient) +
+            gradient[0];
+    }
+}
+
+int testReverseModeGradients()
+{
+    const char* const functions[] =
+    {
+        "sin(x)*x^2 + y", "x/y - sqrt(x*y) + cbrt(x)", "log(x*y) + exp(-x)",
+        "atan2(y, x) + hypot(x, y) + x%y", "if(x < y, x*x*y, x+y)",
+        "a := x*y; a*a + cosh(a) + sin(a)*cos(a)", "min(x, y)*max(x, 3*y)",
+        "h(x*y, x) + y^3 + abs(x-y)", "f(2, 1)*x + y", "1/(x*y) + y^x + acos(y/4)"
+    };
+    const double rows[] = { 0.5, 2,   1.25, 0.75,   3, 1.5,   -0.5, 2 };
+
+    FunctionParser fp, square;
+    square.Parse("x*x + y", "x,y");
+    gNestedGradientParser.Parse("x*x + y", "x,y");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        fp.AddFunction("h", square);
+        fp.AddFunction("f", gradientTestFunction, 2);
+        if(fp.Parse(functions[i], "x,y") >= 0) return false;
+
+        for(int optimized = 0; optimized < 2; ++optimized)
+        {
+            FunctionParser symbolic(fp);
+            if(!symbolic.Gradient()) return false;
+
+            for(unsigned row = 0; row < 4; ++row)
+            {
+                const double* vars = &rows[row * 2];
+                double gradient[2], expected[3];
+                const double value = fp.EvalWithGradient(vars, gradient);
+                const int evalError = fp.EvalError();
+                symbolic.EvalAll(vars, expected);
+                if(evalError != symbolic.EvalError()) return false;
+                if(evalError) continue;
+                if(!compareDerivative(functions[i], -1, vars,
+                                      value, expected[0])
+                || !compareDerivative(functions[i], 0, vars,
+                                      gradient[0], expected[1])
+                || !compareDerivative(functions[i], 1, vars,
+                                      gradient[1], expected[2]))
+                    return false;
+            }
+            fp.Optimize();
+        }
+    }
+
+    // The derivative of a C++ function isn't known
+    fp.Parse("f(x, 1) + y", "x,y");
+    double gradient[100] = { 1, 1 };
+    if(fp.EvalWithGradient(rows, gradient) != 0 || fp.EvalError() != 6
+    || gradient[0] != 0 || gradient[1] != 0)
+        return false;
+
+    // A negative base gives -(|z|^x), and the NaN partial of the unused
+    // operand of min() doesn't spoil the others
+    const double negativeBase[] = { 0.5, -3, -2 };
+    for(int optimized = 0; optimized < 2; ++optimized)
+    {
+        fp.Parse("z^x", "x,y,z");
+        if(optimized) fp.Optimize();
+        fp.EvalWithGradient(negativeBase, gradient);
+        if(fp.EvalError() || std::fabs(gradient[0] + 0.98025814346854) > 1e-12
+        || gradient[1] != 0
+        || std::fabs(gradient[2] - 0.35355339059327) > 1e-12)
+            return false;
+
+        fp.Parse("min(z^x, y)", "x,y,z");
+        if(optimized) fp.Optimize();
+        fp.EvalWithGradient(negativeBase, gradient);
+        if(fp.EvalError()
+        || gradient[0] != 0 || gradient[1] != 1 || gradient[2] != 0)
+            return false;
+    }
+
+    // The cost doesn't depend on the amount of variables
+    std::string function, variables;
+    double vars[100];
+    for(unsigned i = 0; i < 100; ++i)
+    {
+        const std::string name = "x" + std::to_string(i);
+        if(i)
+        {
+            function += "+";
+            variables += ",";
+        }
+        function += name;
+        function += "*";
+        function += name;
+        variables += name;
+        vars[i] = i * 0.5 - 20;
+    }
+    fp.Parse(function, variables);
+    fp.EvalWithGradient(vars, gradient);
+    for(unsigned i = 0; i < 100; ++i)
+        if(gradient[i] != 2 * vars[i]) return false;
+    return fp.EvalError() == 0;
+}
+#else
+int testReverseModeGradients()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test interval evaluation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    double intervalTestFunction(const double* p)
+    {
+        return p[0] * p[1];
+    }
+
+    // Whether the interval is [lower, upper] rounded outwards
+    bool checkInterval(const FunctionParser::Interval& interval,
+                       double lower, double upper)
+    {
+        return interval.lower <= lower && interval.lower > lower - 1e-12
+            && interval.upper >= upper && interval.upper < upper + 1e-12;
+    }
+}
+
+int testIntervalEvaluation()
+{
+    typedef FunctionParser::Interval Interval;
+    const char* const functions[] =
+    {
+        "sin(x)*x^2 + y", "x/y - sqrt(x*y) + cbrt(x)", "log(x*y) + exp(-x)",
+        "atan2(y, x) + hypot(x, y) + x%y", "if(x < y, x*x*y, x+y)",
+        "h(x*y, x) + y^3 + abs(x-y)", "tan(x) + cos(3*y)", "(x-y)^1.5 + x^-2",
+        "f(2, 3)*x + min(x, y)"
+    };
+    // The lower and upper bounds of x and y
+    const double boxes[] =
+    {
+        0.5, 0.75,  1, 2,     -1, 2,  0.25, 0.5,   -3, -1,  -2, 4,
+        1.5, 1.5,   0.5, 3,   -0.5, 0.5,  -0.5, 0.5
+    };
+    const unsigned boxesAmount = sizeof(boxes) / sizeof(boxes[0]) / 4;
+
+    // Not available if the library was compiled without infinities
+    FunctionParser fp, square;
+    fp.Parse("x", "x");
+    const Interval one(1);
+    fp.EvalInterval(&one);
+    if(fp.EvalError() == 6) return -1;
+
+    square.Parse("x*x + y", "x,y");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        fp.AddFunction("h", square);
+        fp.AddFunction("f", intervalTestFunction, 2);
+        if(fp.Parse(functions[i], "x,y") >= 0) return false;
+
+        for(int optimized = 0; optimized < 2; ++optimized)
+        {
+            for(unsigned box = 0; box < boxesAmount; ++box)
+            {
+                const double* bounds = &boxes[box * 4];
+                const Interval vars[2] =
+                    { Interval(bounds[0], bounds[1]),
+                      Interval(bounds[2], bounds[3]) };
+                const Interval result = fp.EvalInterval(vars);
+                const int evalError = fp.EvalError();
+
+                // Every value within the box must be within the result
+                for(unsigned point = 0; point < 25; ++point)
+                {
+                    const double values[2] =
+                        { bounds[0] + (bounds[1] - bounds[0]) * (point % 5) / 4,
+                          bounds[2] + (bounds[3] - bounds[2]) * (point / 5) / 4 };
+                    const double value = fp.Eval(values);
+                    if(fp.EvalError()) continue;
+                    if(evalError
+                    || !(result.lower <= value && value <= result.upper))
+                    {
+                        std::cout << "\n - Value of \"" << functions[i]
+                                  << "\" at (" << values[0] << ", "
+                                  << values[1] << ") is " << value
+                                  << ", not within [" << result.lower << ", "
+                                  << result.upper << "] (error " << evalError
+                                  << ")\n";
+                        return false;
+                    }
+                }
+            }
+            fp.Optimize();
+        }
+    }
+
+    // The bounds are rounded outwards: the exact sum of the doubles 0.1
+    // and 0.2 is between 0.3 and 0.1 + 0.2, which are different doubles
+    fp.Parse("x + y", "x,y");
+    Interval vars[2] = { Interval(0.1), Interval(0.2) };
+    const Interval sum = fp.EvalInterval(vars);
+    if(!(sum.lower <= 0.3 && 0.1 + 0.2 <= sum.upper)) return false;
+
+    // An if() whose condition can be either true or false gives both
+    fp.Parse("if(x < 1, y, 3)", "x,y");
+    vars[0] = Interval(0, 2);
+    if(!checkInterval(fp.EvalInterval(vars), 0.2, 3)) return false;
+    vars[0] = Interval(2, 4);
+    if(!checkInterval(fp.EvalInterval(vars), 3, 3)) return false;
+
+    // Errors are given only when there are no valid values at all
+    fp.Parse("sqrt(x) + 1/y", "x,y");
+    vars[0] = Interval(-1, 4);
+    vars[1] = Interval(0.5);
+    if(!checkInterval(fp.EvalInterval(vars), 2, 4) || fp.EvalError())
+        return false;
+    vars[0] = Interval(-4, -1);
+    fp.EvalInterval(vars);
+    if(fp.EvalError() != 2) return false;
+    vars[0] = Interval(1);
+    vars[1] = Interval(0);
+    fp.EvalInterval(vars);
+    if(fp.EvalError() != 1) return false;
+
+    // The bounds may be infinite, also both of the operands of a division
+    const double inf = std::numeric_limits<double>::infinity();
+    fp.Parse("x/y", "x,y");
+    vars[0] = Interval(1, inf);
+    vars[1] = Interval(1, inf);
+    Interval result = fp.EvalInterval(vars);
+    if(result.lower != 0 || result.upper != inf || fp.EvalError())
+        return false;
+    vars[0] = Interval(-inf, -1);
+    result = fp.EvalInterval(vars);
+    if(result.lower != -inf || result.upper != 0) return false;
+    vars[1] = Interval(-1, 1);
+    result = fp.EvalInterval(vars);
+    if(result.lower != -inf || result.upper != inf) return false;
+
+    fp.Parse("x*y + exp(-x) - 1/y", "x,y");
+    vars[0] = Interval(0, inf);
+    vars[1] = Interval(1, inf);
+    result = fp.EvalInterval(vars);
+    if(!(result.lower <= -1 && result.lower > -1 - 1e-12)
+    || result.upper != inf || fp.EvalError())
+        return false;
+    vars[1] = Interval(-inf, inf);
+    result = fp.EvalInterval(vars);
+    if(result.lower != -inf || result.upper != inf) return false;
+
+    fp.Parse("sqrt(x) + atan(y)", "x,y");
+    vars[0] = Interval(-inf, 4);
+    vars[1] = Interval(-inf, inf);
+    const double halfPi = FUNCTIONPARSERTYPES::fp_const_pi<double>() / 2;
+    if(!checkInterval(fp.EvalInterval(vars), -halfPi, 2 + halfPi))
+        return false;
+
+    // The optimizer folds acos(-2.5) into a NaN, which isn't taken for a
+    // base that contains zero
+    const char* const nanFunctions[] =
+    { "min(-(acos(-2.5))^y, 3.5)", "x - min(-(acos(-2.5))^y, 3.5)" };
+    vars[0] = Interval(0.9, 1.1);
+    vars[1] = Interval(0.3, 0.7);
+    for(unsigned i = 0; i < 2; ++i)
+    {
+        fp.Parse(nanFunctions[i], "x,y");
+        fp.Optimize();
+        result = fp.EvalInterval(vars);
+        const int evalError = fp.EvalError();
+        const double values[2] = { 1, 0.5 };
+        const double value = fp.Eval(values);
+        if(!evalError && !fp.EvalError()
+        && !(result.lower <= value && value <= result.upper))
+            return false;
+    }
+
+    // A C++ function is known only at single values
+    fp.AddFunction("f", intervalTestFunction, 2);
+    fp.Parse("f(x, 2) + y", "x,y");
+    vars[0] = Interval(3);
+    vars[1] = Interval(0.5);
+    if(!checkInterval(fp.EvalInterval(vars), 6.5, 6.5)) return false;
+    vars[0] = Interval(3, 4);
+    fp.EvalInterval(vars);
+    return fp.EvalError() == 6;
+}
+#else
+int testIntervalEvaluation()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test incremental evaluation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    unsigned gIncrementalTestCalls = 0;
+
+    double incrementalTestFunction(const double* p)
+    {
+        ++gIncrementalTestCalls;
+        return p[0] * p[0] + 1;
+    }
+}
+
+int testIncrementalEvaluation()
+{
+    const char* const functions[] =
+    {
+        "f(x*y)*z + sin(x) - cos(w)", "if(x < y, sqrt(y-x), log(x))*z + w",
+        "h(x, z) + hypot(y, w)*x", "a := x*z; if(a > w, a/y, a*y) + f(z)",
+        "if(x < 0, if(y < 0, 1/z, z), w) + sin(x)*cos(x)",
+        "x^y + sinh(z)*cosh(z) + w%y"
+    };
+    // The values given to the variables in turn
+    const double values[] = { 0.5, 2, -1, 3, 0, 1.5, -2.5, 4, 0.25 };
+    const unsigned valuesAmount = sizeof(values) / sizeof(values[0]);
+
+    FunctionParser fp, square;
+    square.Parse("x*x + y", "x,y");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        fp.AddFunction("h", square);
+        fp.AddFunction("f", incrementalTestFunction, 1);
+        if(fp.Parse(functions[i], "x,y,z,w") >= 0) return false;
+
+        for(int optimized = 0; optimized < 2; ++optimized)
+        {
+            FunctionParser::EvalContext context, reference;
+            double vars[4] = { 1, 2, 3, 4 };
+            unsigned long long changedVariables = ~0ULL;
+            for(unsigned step = 0; step < 60; ++step)
+            {
+                const double result =
+                    fp.EvalIncremental(context, vars, changedVariables);
+                const double expected = fp.Eval(reference, vars);
+                if(context.EvalError() != reference.EvalError()
+                || (!reference.EvalError() && result != expected))
+                {
+                    std::cout << "\n - \"" << functions[i]
+                              << "\" incrementally gives " << result
+                              << " (error " << context.EvalError()
+                              << ") instead of " << expected << " (error "
+                              << reference.EvalError() << ")\n";
+                    return false;
+                }
+
+                // Change one or two of the variables
+                changedVariables = 0;
+                for(unsigned n = 0; n <= step % 3 / 2; ++n)
+                {
+                    const unsigned index = (step * 7 + n * 3 + i) % 4;
+                    vars[index] = values[(step * 5 + n) % valuesAmount];
+                    changedVariables |= 1ULL << index;
+                }
+            }
+            fp.Optimize();
+        }
+    }
+
+    // A function is called again only when its parameter changes
+    fp.AddFunction("f", incrementalTestFunction, 1);
+    fp.Parse("f(z) + x*y", "x,y,z");
+    fp.Optimize();
+    FunctionParser::EvalContext context;
+    double vars[3] = { 1, 2, 3 };
+    gIncrementalTestCalls = 0;
+    if(fp.EvalIncremental(context, vars, ~0ULL) != 12) return false;
+    vars[0] = 2;
+    if(fp.EvalIncremental(context, vars, 1) != 14) return false;
+#ifdef FP_SUPPORT_OPTIMIZER
+    if(gIncrementalTestCalls != 1) return false;
+#endif
+    vars[2] = 1;
+    if(fp.EvalIncremental(context, vars, 4) != 6) return false;
+
+    // After an error, the failed instructions are run again
+    fp.Parse("sqrt(x) + y", "x,y");
+    fp.Optimize();
+    vars[0] = -1;
+    fp.EvalIncremental(context, vars, ~0ULL);
+    if(context.EvalError() != 2) return false;
+    vars[0] = 4;
+    if(fp.EvalIncremental(context, vars, 1) != 4 || context.EvalError())
+        return false;
+
+    // A context last used with other code runs everything
+    FunctionParser other;
+    other.Parse("x - y", "x,y");
+    other.Optimize();
+    return other.EvalIncremental(context, vars, 0) == 2
+        && fp.EvalIncremental(context, vars, 0) == 4;
+}
+#else
+int testIncrementalEvaluation()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test specialization
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+int testSpecialization()
+{
+    const char* const functions[] =
+    {
+        "x*y + sin(z)*w", "if(z < 1, x^2, cosh(w*z))*log(y*z)",
+        "h(x, z) + hypot(y, w)*f(z, w)", "a := x*z; if(a > w, a/y, a*y) + z%y",
+        "x^y + sinh(z)*cosh(z) - w"
+    };
+    const double vars[] = { 1.5, 2, 0.5, -3 };
+
+    FunctionParser fp, square;
+    square.Parse("x*x + y", "x,y");
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        fp.AddFunction("h", square);
+        fp.AddFunction("f", intervalTestFunction, 2);
+        if(fp.Parse(std::string(functions[i]) + " + f(x, 1)", "x,y,z,w") >= 0)
+            return false;
+        const double expected = fp.Eval(vars);
+
+        // Fix each subset of the variables in turn
+        for(unsigned fixedMask = 0; fixedMask < 16; ++fixedMask)
+        {
+            std::vector<std::pair<unsigned, double> > fixedVariables;
+            std::vector<double> remainingVars;
+            for(unsigned n = 0; n < 4; ++n)
+                if(fixedMask & (1 << n))
+                    fixedVariables.push_back(std::make_pair(n, vars[n]));
+                else
+                    remainingVars.push_back(vars[n]);
+
+            FunctionParser specialized(fp);
+            if(!specialized.Specialize(fixedVariables)) return false;
+            const double value = specialized.Eval(remainingVars.data());
+            if(specialized.EvalError()
+            || std::fabs(value - expected) > 1e-12 * (1 + std::fabs(expected)))
+            {
+                std::cout << "\n - \"" << functions[i] << "\" with variables "
+                          << fixedMask << " fixed gives " << value
+                          << " instead of " << expected << "\n";
+                return false;
+            }
+        }
+    }
+
+    // The remaining variables keep their order
+    fp.Parse("x*y + sin(y)", "x,y");
+    FunctionParser specialized(fp);
+    specialized.Specialize
+        (std::vector<std::pair<unsigned, double> >(1, std::make_pair(1u, 2.)));
+    const double x = 3;
+    if(std::fabs(specialized.Eval(&x) - (6 + std::sin(2.))) > 1e-14)
+        return false;
+    specialized = fp;
+    specialized.Specialize
+        (std::vector<std::pair<unsigned, double> >(1, std::make_pair(0u, 0.)));
+    const double y = 0.5;
+    if(specialized.Eval(&y) != std::sin(0.5)) return false;
+
+    // Invalid indices leave the function unchanged
+    std::vector<std::pair<unsigned, double> > fixedVariables;
+    fixedVariables.push_back(std::make_pair(2u, 1.));
+    if(specialized.Specialize(fixedVariables)) return false;
+    fixedVariables[0].first = 1;
+    fixedVariables.push_back(std::make_pair(1u, 2.));
+    if(specialized.Specialize(fixedVariables)) return false;
+    return specialized.Eval(&y) == std::sin(0.5);
+}
+#else
+int testSpecialization()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test combining functions
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    double combineTestFunction(const double* p)
+    {
+        return p[0] - 1;
+    }
+}
+
+int testCombining()
+{
+    const char* const functions[] =
+    {
+        "sqrt(x*x + y*y)*z", "exp(-(x*x + y*y)) + g(z)",
+        "if(z < 1, atan2(y, x), sqrt(x*x + y*y))", "h(x, y) + f(z, x)",
+        "sqrt(x*x + y*y) - 1/z"
+    };
+    const unsigned functionsAmount = sizeof(functions) / sizeof(functions[0]);
+    const double rows[] = { 0.5, 2, 3,   -1, 0.25, 0.5,   3, -4, 0 };
+
+    // Each parser has functions of its own
+    FunctionParser parsers[functionsAmount], square;
+    std::vector<const FunctionParserBase<double>*> parserPointers;
+    square.Parse("x*x + y", "x,y");
+    for(unsigned i = 0; i < functionsAmount; ++i)
+    {
+        if(i % 2) parsers[i].AddFunction("h", square);
+        parsers[i].AddFunction("g", combineTestFunction, 1);
+        parsers[i].AddFunction("f", intervalTestFunction, 2);
+        if(parsers[i].Parse(functions[i], "x,y,z") >= 0) return false;
+        parserPointers.push_back(&parsers[i]);
+    }
+
+    FunctionParser combined;
+    if(!combined.Combine(parserPointers)
+    || combined.GetResultAmount() != functionsAmount)
+        return false;
+    for(unsigned row = 0; row < 3; ++row)
+    {
+        const double* vars = &rows[row * 3];
+        double results[functionsAmount];
+        combined.EvalAll(vars, results);
+
+        // An error in one of the functions fails them all
+        int evalError = 0;
+        for(unsigned i = 0; i < functionsAmount; ++i)
+        {
+            parsers[i].Eval(vars);
+            if(parsers[i].EvalError()) evalError = parsers[i].EvalError();
+        }
+        if(combined.EvalError() != evalError) return false;
+        if(evalError) continue;
+
+        for(unsigned i = 0; i < functionsAmount; ++i)
+        {
+            const double expected = parsers[i].Eval(vars);
+            if(std::fabs(results[i] - expected) >
+               1e-12 * (1 + std::fabs(expected)))
+            {
+                std::cout << "\n - \"" << functions[i] << "\" gives "
+                          << results[i] << " instead of " << expected << "\n";
+                return false;
+            }
+        }
+        if(combined.Eval(vars) != results[0]) return false;
+    }
+
+    // The combined parser may be one of the parsers, but not one made
+    // by Combine() or Gradient()
+    parserPointers.resize(2);
+    parserPointers[0] = &parsers[1];
+    parserPointers[1] = &combined;
+    if(combined.Combine(parserPointers)) return false;
+    combined = parsers[0];
+    if(!combined.Combine(parserPointers)) return false;
+    double results[2];
+    combined.EvalAll(rows, results);
+    if(results[0] != parsers[1].Eval(rows)
+    || std::fabs(results[1] - parsers[0].Eval(rows)) > 1e-12)
+        return false;
+
+    // The parsers must have the same variables
+    FunctionParser other;
+    other.Parse("x + y", "x,y");
+    parserPointers[1] = &other;
+    if(combined.Combine(parserPointers)) return false;
+    other.Parse("x + y", "y,x,z");
+    if(combined.Combine(parserPointers)) return false;
+    other.Parse("x + ", "x,y,z");
+    return !combined.Combine(parserPointers);
+}
+#else
+int testCombining()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test parallel batch evaluation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    // Runs a parallel batch of its own with a parser of its own
+    double parallelTestFunction(const double* p)
+    {
+        FunctionParser fp;
+        fp.Parse("x*y", "x,y");
+        if(fp.ParseError() != FunctionParserErrorType::no_error) return 0;
+        const double vars[] = { p[0], 2, p[0], 3 };
+        double results[2];
+        fp.EvalBatchParallel(vars, 2, 2, results, 2);
+        return results[0] + results[1];
+    }
+}
+
+int testParallelBatchEvaluation()
+{
+    const char* const functions[] =
+    {
+        "sin(x)*cos(y) + sqrt(abs(x*y))", "if(x < y, x+1, log(y))",
+        "1/(x-300) + g(x, y)", "h(x) + f(x, y)"
+    };
+
+    FunctionParser square;
+    square.Parse("x*x + y", "x,y");
+    std::vector<double> rows, column1, column2;
+    for(unsigned row = 0; row < 1000; ++row)
+    {
+        rows.push_back(row * 0.5 - 3);
+        rows.push_back(row % 13 - 2);
+        column1.push_back(rows[row * 2]);
+        column2.push_back(rows[row * 2 + 1]);
+    }
+    const double* const columns[] = { &column1[0], &column2[0] };
+
+    for(unsigned i = 0; i < sizeof(functions) / sizeof(functions[0]); ++i)
+    {
+        FunctionParser fp;
+        fp.AddFunction("g", square);
+        fp.AddFunction("h", parallelTestFunction, 1);
+        fp.AddFunction("f", intervalTestFunction, 2);
+        if(fp.Parse(functions[i], "x,y") >= 0) return false;
+
+        for(int optimized = 0; optimized < 2; ++optimized)
+        {
+            // Counts which are not multiples of the block size, and none
+            const unsigned counts[] = { 1000, 130, 1, 0 };
+            for(unsigned c = 0; c < 4; ++c)
+            {
+                const unsigned count = counts[c];
+                std::vector<double> expected(count + 1), results(count + 1);
+                fp.EvalBatch(&rows[0], 2, count, &expected[0]);
+                const int expectedError = fp.EvalError();
+
+                for(unsigned threads = 0; threads <= 4; ++threads)
+                {
+                    for(int byColumns = 0; byColumns < 2; ++byColumns)
+                    {
+                        if(byColumns)
+                            fp.EvalBatchParallel(columns, count, &results[0],
+                                                 threads);
+                        else
+                            fp.EvalBatchParallel(&rows[0], 2, count,
+                                                 &results[0], threads);
+                        if(fp.EvalError() != expectedError
+                        || std::memcmp(&results[0], &expected[0],
+                                       count * sizeof(double)) != 0)
+                        {
+                            std::cout << "\n - \"" << functions[i]
+                                      << "\" differs from EvalBatch() with "
+                                      << count << " rows and " << threads
+                                      << " threads\n";
+                            return false;
+                        }
+                    }
+                }
+            }
+            fp.Optimize();
+        }
+    }
+    return true;
+}
+#else
+int testParallelBatchEvaluation()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test NaN propagation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    // By the bits, since std::isnan() and std::isinf() are always false
+    // if the testbed is compiled with -ffinite-math-only. Without the sign,
+    // the bits of a NaN are above those of infinity.
+    const std::uint64_t infinityBits = 0x7FF0000000000000ULL;
+
+    std::uint64_t absoluteValueBits(double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits & 0x7FFFFFFFFFFFFFFFULL;
+    }
+
+    bool isNaNValue(double value)
+    {
+        return absoluteValueBits(value) > infinityBits;
+    }
+
+    bool isInfValue(double value)
+    {
+        return absoluteValueBits(value) == infinityBits;
+    }
+}
+
+int testNaNPropagation()
+{
+    struct Test
+    {
+        const char* function;
+        double x;
+        bool nan;     // otherwise inf
+        int errors;   // the bits of the error codes
+    };
+    const Test tests[] =
+    {
+        { "sqrt(x)", -1, true, 1 << 1 },
+        { "1/x + x", 0, false, 1 << 0 },
+        { "log(x) + acos(x+2)", 0, true, (1 << 2) | (1 << 3) },
+        { "x + f(x)*2", 0, false, 1 << 0 }
+    };
+
+    // The result of a called parser depends on its own mode. The mode is
+    // not available if the library was compiled without NaNs.
+    FunctionParser inverse;
+    inverse.setNaNPropagation(true);
+    if(!inverse.nanPropagation()) return -1;
+    inverse.Parse("1/x", "x");
+
+    for(unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i)
+    {
+        FunctionParser fp;
+        fp.AddFunction("f", inverse);
+        fp.setNaNPropagation(true);
+        if(fp.Parse(tests[i].function, "x") >= 0 || !fp.nanPropagation())
+            return false;
+
+        for(int pass = 0; pass < 3; ++pass)
+        {
+            if(pass == 1) fp.Optimize();
+            if(pass == 2) fp.CreateJIT();
+
+            // Eval() and EvalBatch() of two rows
+            double results[3];
+            const double rows[] = { tests[i].x, tests[i].x };
+            results[0] = fp.Eval(&tests[i].x);
+            const int error = fp.EvalError();
+            fp.EvalBatch(rows, 1, 2, results + 1);
+            const int batchError = fp.EvalError();
+
+            for(unsigned r = 0; r < 3; ++r)
+            {
+                const double result = results[r];
+                if(isNaNValue(result) != tests[i].nan
+                || (!tests[i].nan && !isInfValue(result))
+                || error != tests[i].errors || batchError != tests[i].errors)
+                {
+                    std::cout << "\n - \"" << tests[i].function << "\" gave "
+                              << result << " with errors " << error << " and "
+                              << batchError << " in pass " << pass << "\n";
+                    return false;
+                }
+            }
+        }
+
+        // Back to the early returns: the result is 0 with an error code
+        fp.setNaNPropagation(false);
+        const double result = fp.Eval(&tests[i].x);
+        if(fp.nanPropagation() || result != 0.0 || fp.EvalError() <= 0
+        || (tests[i].errors & (1 << (fp.EvalError() - 1))) == 0)
+        {
+            std::cout << "\n - \"" << tests[i].function
+                      << "\" failed after NaN propagation was disabled\n";
+            return false;
+        }
+    }
+
+#ifdef FP_SUPPORT_LONG_INT_TYPE
+    // Types without NaN ignore the setting
+    FunctionParser_li fp_li;
+    fp_li.setNaNPropagation(true);
+    fp_li.Parse("1/x", "x");
+    const long zero = 0;
+    if(fp_li.nanPropagation() || fp_li.Eval(&zero) != 0
+    || fp_li.EvalError() != 1)
+        return false;
+#endif
+    return true;
+}
+#else
+int testNaNPropagation()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test C++ source generation
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+int testCppSourceGeneration()
+{
+    struct Test
+    {
+        const char* function;
+        bool optimize;
+        const char* expected[3]; // parts of the generated source
+    };
+    const Test tests[] =
+    {
+        { "x^y + sin(x)", false,
+          { "double cppTest(const double* vars)", "cppTest_pow(",
+            "std::sin(" } },
+        { "if(x < y, x*2, -y)", true,
+          { "double cppTest(const double* vars)", "goto L", "  L" } },
+        { "5", false, { "double cppTest(const double*)", "5.0", "return" } }
+    };
+
+    for(unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i)
+    {
+        FunctionParser fp;
+        if(fp.Parse(tests[i].function, "x,y") >= 0) return false;
+        if(tests[i].optimize) fp.Optimize();
+
+        std::ostringstream source;
+        if(!fp.GenerateCppSource(source, "cppTest")) return false;
+        for(unsigned p = 0; p < 3; ++p)
+            if(source.str().find(tests[i].expected[p]) == std::string::npos)
+            {
+                std::cout << "\n - \"" << tests[i].function
+                          << "\" didn't generate \"" << tests[i].expected[p]
+                          << "\":\n" << source.str();
+                return false;
+            }
+    }
+
+    // Nothing is written for functions which call other functions, nor for
+    // functions which failed to parse
+    FunctionParser inverse, fp;
+    inverse.Parse("1/x", "x");
+    fp.AddFunction("f", inverse);
+    std::ostringstream source;
+    fp.Parse("f(x) + 1", "x");
+    if(fp.GenerateCppSource(source, "cppTest")) return false;
+    fp.Parse("x +", "x");
+    if(fp.GenerateCppSource(source, "cppTest")) return false;
+
+#ifdef FP_SUPPORT_LONG_INT_TYPE
+    FunctionParser_li fp_li;
+    fp_li.Parse("x + 1", "x");
+    if(fp_li.GenerateCppSource(source, "cppTest")) return false;
+#endif
+    return source.str().empty();
+}
+#else
+int testCppSourceGeneration()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test compile-time parsing
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace ConstexprTests
+{
+    struct Trig
+    {
+        static constexpr const char* function =
+            "if(x < y, sin(x) * cos(y), atan2(y, x)) + 2^x"
+            " - 2.71828182845904523536^y";
+        static constexpr const char* variables = "x, y";
+    };
+    struct InlineVariables
+    {
+        static constexpr const char* function =
+            "a := x*x; b := a + y; a := b - 1; a / b + hypot(x, a)";
+        static constexpr const char* variables = "x,y";
+    };
+    struct Logic
+    {
+        static constexpr const char* function =
+            "(x = y | x >= 1) & !(y != 0.5) + x % 0.3 - int(y*10)";
+        static constexpr const char* variables = "x,y";
+    };
+    struct Literals
+    {
+        static constexpr const char* function =
+            "x*1.2 + 4.91 - 0x1.8p3 + 6.02214076e23/1e23"
+            " + 0.30000000000000000000000000000000001 + 2.5e-310*y";
+        static constexpr const char* variables = "x,y";
+    };
+    struct Literal1
+    {
+        static constexpr const char* function =
+            "0.30000000000000000000000000000000001";
+        static constexpr const char* variables = "";
+    };
+    struct Literal2
+    {
+        static constexpr const char* function = "1.7976931348623157e308";
+        static constexpr const char* variables = "";
+    };
+    struct Literal3
+    {
+        static constexpr const char* function = "4.9406564584124654e-324";
+        static constexpr const char* variables = "";
+    };
+    struct Literal4
+    {
+        static constexpr const char* function = "0x1.fffffffffffffp-2";
+        static constexpr const char* variables = "";
+    };
+}
+
+int testConstexprParsing()
+{
+    using namespace ConstexprTests;
+    const double values[][2] =
+    { { 0.25, 0.5 }, { 1.5, -2.0 }, { -0.7, 3.1 }, { 1.0, 1.0 } };
+
+    for(unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        const double results[] =
+        {
+            FunctionParserConstexpr<double, Trig>::Eval(values[i]),
+            FunctionParserConstexpr<double, Trig, true>::Eval(values[i]),
+            FunctionParserConstexpr<double, InlineVariables>::Eval(values[i]),
+            FunctionParserConstexpr<double, Logic>::Eval(values[i]),
+            FunctionParserConstexpr<double, Literals>::Eval(values[i])
+        };
+        const char* const functions[] =
+        { Trig::function, Trig::function, InlineVariables::function,
+          Logic::function, Literals::function };
+
+        for(unsigned f = 0; f < sizeof(functions) / sizeof(functions[0]); ++f)
+        {
+            FunctionParser fp;
+            fp.setNaNPropagation(true);
+            if(fp.Parse(functions[f], "x,y", f == 1) >= 0) return false;
+            const double expected = fp.Eval(values[i]);
+            if(!FUNCTIONPARSERTYPES::fp_equal(results[f], expected))
+            {
+                std::cout << "\n - \"" << functions[f] << "\" gave "
+                          << results[f] << " instead of " << expected
+                          << " with x=" << values[i][0] << ", y="
+                          << values[i][1] << "\n";
+                return false;
+            }
+        }
+    }
+
+    if(FunctionParserConstexpr<double, Trig>::VariablesAmount != 2)
+        return false;
+
+    // The literals are rounded exactly like the runtime parser does
+    const double literals[] =
+    {
+        FunctionParserConstexpr<double, Literal1>::Eval(0),
+        FunctionParserConstexpr<double, Literal2>::Eval(0),
+        FunctionParserConstexpr<double, Literal3>::Eval(0),
+        FunctionParserConstexpr<double, Literal4>::Eval(0)
+    };
+    const char* const literalFunctions[] =
+    { Literal1::function, Literal2::function, Literal3::function,
+      Literal4::function };
+    for(unsigned i = 0; i < sizeof(literals) / sizeof(literals[0]); ++i)
+    {
+        FunctionParser fp;
+        if(fp.Parse(literalFunctions[i], "") >= 0
+        || fp.Eval(0) != literals[i])
+        {
+            std::cout << "\n - \"" << literalFunctions[i] << "\" gave "
+                      << literals[i] << "\n";
+            return false;
+        }
+    }
+
+#ifdef FP_SUPPORT_FLOAT_TYPE
+    const float floatValues[] = { 0.25f, 0.5f };
+    FunctionParser_f fp_f;
+    fp_f.setNaNPropagation(true);
+    fp_f.Parse(Trig::function, Trig::variables);
+    if(!FUNCTIONPARSERTYPES::fp_equal
+       (FunctionParserConstexpr<float, Trig>::Eval(floatValues),
+        fp_f.Eval(floatValues)))
+        return false;
+#endif
+#ifdef FP_SUPPORT_LONG_DOUBLE_TYPE
+    const long double longDoubleValues[] = { 0.25L, 0.5L };
+    FunctionParser_ld fp_ld;
+    fp_ld.setNaNPropagation(true);
+    fp_ld.Parse(Trig::function, Trig::variables);
+    if(!FUNCTIONPARSERTYPES::fp_equal
+       (FunctionParserConstexpr<long double, Trig>::Eval(longDoubleValues),
+        fp_ld.Eval(longDoubleValues)))
+        return false;
+#endif
+    return true;
+}
+#else
+int testConstexprParsing()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test the parse cache
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    bool checkParseCacheStatistics(std::size_t hits, std::size_t misses,
+                                   std::size_t evictions, std::size_t entries)
+    {
+        const FunctionParser::ParseCacheStatistics statistics =
+            FunctionParser::parseCacheStatistics();
+        if(statistics.hits == hits && statistics.misses == misses &&
+           statistics.evictions == evictions && statistics.entries == entries)
+            return true;
+        if(gVerbosityLevel >= 2)
+            std::cout << "\n - The cache has " << statistics.hits << " hits, "
+                      << statistics.misses << " misses, "
+                      << statistics.evictions << " evictions and "
+                      << statistics.entries << " entries instead of " << hits
+                      << ", " << misses << ", " << evictions << " and "
+                      << entries << std::endl;
+        return false;
+    }
+}
+
+int testParseCache()
+{
+    FunctionParser::clearParseCache();
+    FunctionParser::setParseCacheSize(2);
+
+    const double vars[] = { 1.5, -2 };
+    FunctionParser fp1, fp2, fp3, fp4;
+
+    // Differently spaced copies of the function share the entry
+    if(fp1.Parse("x*x + sin(y)", "x,y") >= 0
+    || fp2.Parse(" x * x+sin (y) ", "x,y") >= 0
+    || !checkParseCacheStatistics(1, 1, 0, 1)
+    || fp1.Eval(vars) != fp2.Eval(vars))
+        return false;
+
+    // Failed parses aren't cached
+    if(fp3.Parse("x*x + ", "x,y") < 0
+    || fp3.Parse("x*x + ", "x,y") < 0
+    || !checkParseCacheStatistics(1, 3, 0, 1))
+        return false;
+
+#ifdef FP_SUPPORT_OPTIMIZER
+    fp1.Optimize();
+    fp2.Optimize();
+    if(!checkParseCacheStatistics(2, 4, 0, 2)
+    || fp1.Eval(vars) != fp2.Eval(vars))
+        return false;
+    const std::size_t entries = 2;
+#else
+    const std::size_t entries = 1;
+#endif
+
+    // The identifiers of the parser are a part of the key
+    fp3.AddConstant("k", 2);
+    fp4.AddConstant("k", 3);
+    if(fp3.Parse("k*x + sin(y)", "x,y") >= 0
+    || fp4.Parse("k*x + sin(y)", "x,y") >= 0
+    || fp3.Eval(vars) == fp4.Eval(vars)
+    || fp4.Eval(vars) != 3 * vars[0] + std::sin(vars[1]))
+        return false;
+
+    // The least recently used entries were removed
+    FunctionParser::ParseCacheStatistics statistics =
+        FunctionParser::parseCacheStatistics();
+    if(statistics.entries != 2 || statistics.evictions != entries)
+        return false;
+
+    FunctionParser::setParseCacheSize(0);
+    statistics = FunctionParser::parseCacheStatistics();
+    if(statistics.entries != 0 || FunctionParser::parseCacheSize() != 0)
+        return false;
+    FunctionParser::clearParseCache();
+    return true;
+}
+#else
+int testParseCache()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test saving and loading compiled code
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    // The record with a word of it changed and its checksum made again, as
+    // if it had been made by something else than SaveCompiled()
+    std::string resealedRecord(const std::string& record, std::size_t offset,
+                               std::uint32_t value)
+    {
+        const std::size_t checksumOffset = 32, payloadOffset = 36;
+        std::string result = record;
+        std::memcpy(&result[offset], &value, sizeof(value));
+        std::uint32_t hash = 2166136261u;
+        for(std::size_t i = payloadOffset; i < result.size(); ++i)
+            hash = (hash ^ static_cast<unsigned char>(result[i])) * 16777619u;
+        std::memcpy(&result[checksumOffset], &hash, sizeof(hash));
+        return result;
+    }
+}
+
+int testCompiledCode()
+{
+    const double vars[] = { 1.5, -2 };
+
+    // The functions are added in a different order to the loading parser,
+    // so the indices in the code are remapped by name
+    FunctionParser half, saver, loader;
+    half.Parse("x/2", "x");
+    saver.AddFunction("sqr", userDefFuncSqr<double>, 1);
+    saver.AddFunction("half", half);
+    loader.AddFunction("half", half);
+    loader.AddFunction("cube", userDefFuncSqr<double>, 1);
+    loader.AddFunction("sqr", userDefFuncSqr<double>, 1);
+
+    if(saver.Parse("sqr(x) + half(y) * sin(x)", "x,y") >= 0) return false;
+    saver.Optimize();
+    std::ostringstream stream;
+    if(!saver.SaveCompiled(stream)) return false;
+    std::istringstream source(stream.str());
+    if(!loader.LoadCompiled(source)) return false;
+
+    const double expected = saver.Eval(vars);
+    double batchResult = 0;
+    FunctionParser::EvalContext context;
+    loader.EvalBatch(vars, 2, 1, &batchResult);
+    if(loader.Eval(vars) != expected || batchResult != expected
+    || loader.EvalIncremental(context, vars, ~0ULL) != expected)
+    {
+        std::cout << "\n - The loaded function gave " << loader.Eval(vars)
+                  << " instead of " << expected << std::endl;
+        return false;
+    }
+
+    // Records can follow each other, as in a memory-mapped file
+    FunctionParser second, third;
+    second.Parse("x - y", "y,x");
+    third.AddFunction("sqr", userDefFuncSqr<double>, 1);
+    third.AddFunction("half", half);
+    second.SaveCompiled(stream);
+    const std::string records = stream.str();
+    std::size_t size = third.LoadCompiled(records.data(), records.size());
+    if(size == 0 || size >= records.size()
+    || third.LoadCompiled(records.data() + size, records.size() - size)
+       != records.size() - size
+    || third.Eval(vars) != vars[1] - vars[0])
+        return false;
+
+    // Nothing is loaded from a damaged record, or when a function is missing
+    std::string damaged = records;
+    damaged[size - 1] ^= 1;
+    FunctionParser noFunctions;
+    if(third.LoadCompiled(damaged.data(), size) != 0
+    || third.LoadCompiled(records.data(), size - 1) != 0
+    || third.Eval(vars) != vars[1] - vars[0]
+    || noFunctions.LoadCompiled(records.data(), records.size()) != 0)
+        return false;
+
+    // The code of a record with a valid checksum is checked too. The
+    // payload of "x - y" starts with the settings, the amount of variables,
+    // "y,x" and the stack size, followed by the size of the bytecode and
+    // the bytecode: the variables x and y, and the subtraction.
+    using namespace FUNCTIONPARSERTYPES;
+    const std::string record = records.substr(size);
+    const std::size_t stackSizeOffset = 36 + 4 + 4 + 4 + 3;
+    const std::size_t byteCodeOffset = stackSizeOffset + 4 + 4;
+    std::uint32_t byteCodeSize;
+    std::memcpy(&byteCodeSize, &record[stackSizeOffset + 4], 4);
+    if(byteCodeSize != 3) return false;
+    const std::string added = resealedRecord(record, byteCodeOffset + 8, cAdd);
+    if(noFunctions.LoadCompiled(added.data(), added.size()) != added.size()
+    || noFunctions.Eval(vars) != vars[0] + vars[1])
+        return false;
+    const std::string invalid[] =
+    {
+        resealedRecord(record, stackSizeOffset, 1),
+        resealedRecord(record, byteCodeOffset, VarBegin + 2),
+        resealedRecord(record, byteCodeOffset + 4, cAdd),
+        resealedRecord(record, byteCodeOffset + 8, cFetch),
+        resealedRecord(record, byteCodeOffset + 8, cImmed),
+        resealedRecord(record, byteCodeOffset + 4, cJump)
+    };
+    for(unsigned i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+        if(noFunctions.LoadCompiled(invalid[i].data(), invalid[i].size()) != 0
+        || noFunctions.Eval(vars) != vars[0] + vars[1])
+        {
+            std::cout << "\n - Invalid record " << i << " was loaded\n";
+            return false;
+        }
+
+#ifdef FP_SUPPORT_FLOAT_TYPE
+    // The record is for double only
+    FunctionParser_f floatParser;
+    if(floatParser.LoadCompiled(records.data() + size,
+                                records.size() - size) != 0)
+        return false;
+#endif
+    return true;
+}
+#else
+int testCompiledCode()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test the parse cache files
+//=========================================================================
+#if !defined(FP_DISABLE_DOUBLE_TYPE) && defined(FP_SUPPORT_OPTIMIZER) && \
+    (defined(__unix__) || defined(__APPLE__))
+#include <dirent.h>
+#include <unistd.h>
+namespace
+{
+    void removeDirectory(const std::string& directory)
+    {
+        if(DIR* dir = opendir(directory.c_str()))
+        {
+            while(dirent* entry = readdir(dir))
+                if(entry->d_name[0] != '.')
+                    unlink((directory + "/" + entry->d_name).c_str());
+            closedir(dir);
+        }
+        rmdir(directory.c_str());
+    }
+
+    bool checkParseCacheFiles()
+    {
+        const double vars[] = { 1.5, -2 };
+        const char* const function = "sqr(x) + x*y + sin(y)*sin(y) + cos(y)^2";
+        FunctionParser fp1, fp2, fp3;
+        fp1.AddFunction("sqr", userDefFuncSqr<double>, 1);
+        fp2.AddFunction("half", userDefFuncSqr<double>, 1);
+        fp2.AddFunction("sqr", userDefFuncSqr<double>, 1);
+        fp3.AddFunction("sqr", userDefFuncSqr<double>, 1);
+
+        if(fp1.Parse(function, "x,y") >= 0) return false;
+        fp1.Optimize();
+        FunctionParser::ParseCacheStatistics statistics =
+            FunctionParser::parseCacheStatistics();
+        if(statistics.fileHits != 0 || statistics.fileWrites != 1)
+            return false;
+
+        // A parser with different function indices takes the code from the
+        // file, as would a parser in another process
+        if(fp2.Parse(function, "x,y") >= 0) return false;
+        fp2.Optimize();
+        statistics = FunctionParser::parseCacheStatistics();
+        if(statistics.fileHits != 1 || statistics.fileWrites != 1
+        || fp2.Eval(vars) != fp1.Eval(vars))
+            return false;
+
+        // Other variables are another key
+        if(fp3.Parse(function, "y,x") >= 0) return false;
+        fp3.Optimize();
+        statistics = FunctionParser::parseCacheStatistics();
+        return statistics.fileHits == 1 && statistics.fileWrites == 2;
+    }
+}
+
+int testParseCacheFiles()
+{
+    char directory[] = "/tmp/fparser_cache_XXXXXX";
+    if(!mkdtemp(directory)) return -1;
+
+    // The memory cache is disabled, so that the code comes from the files
+    const std::size_t oldCacheSize = FunctionParser::parseCacheSize();
+    FunctionParser::setParseCacheSize(0);
+    FunctionParser::clearParseCache();
+    FunctionParser::setParseCacheDirectory(directory);
+
+    const bool ok = checkParseCacheFiles();
+
+    FunctionParser::setParseCacheDirectory("");
+    FunctionParser::clearParseCache();
+    FunctionParser::setParseCacheSize(oldCacheSize);
+    removeDirectory(directory);
+    return ok;
+}
+#else
+int testParseCacheFiles()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test sharing the data of parser copies between threads
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    /* Each thread evaluates its own copy of the parser, which shares the
+       data with the others, and some of the threads parse another function
+       into their copy in the middle. */
+    bool evaluateParserCopy(const FunctionParser& original, unsigned number)
+    {
+        FunctionParser fp(original);
+        for(unsigned i = 0; i < 2000; ++i)
+        {
+            if(i == 1000 && number % 2)
+                fp.Parse("sin(x)*y + x*x + 1", "x,y");
+
+            const double vars[2] = { double(i % 100) / 10, double(number) };
+            const double expected = std::sin(vars[0]) * vars[1]
+                + vars[0] * vars[0] + (i >= 1000 && number % 2 ? 1 : 0);
+            const double result = fp.Eval(vars);
+            if(fp.EvalError() != 0 ||
+               std::fabs(result - expected) > 1e-10 * (1 + std::fabs(expected)))
+            {
+                if(gVerbosityLevel >= 2)
+                    std::cout << "\n - Thread " << number << ": "
+                              << result << " instead of " << expected
+                              << std::endl;
+                return false;
+            }
+
+            FunctionParser copy(fp);
+            if(i % 100 == 0) fp = copy;
+        }
+        return true;
+    }
+}
+
+int testParserCopiesInThreads()
+{
+    FunctionParser fp;
+    if(fp.Parse("sin(x)*y + x*x", "x,y") >= 0) return false;
+    fp.Optimize();
+
+    std::vector<std::future<bool> > results;
+    for(unsigned i = 0; i < 4; ++i)
+        results.push_back(std::async(std::launch::async, evaluateParserCopy,
+                                     std::cref(fp), i));
+    bool ok = true;
+    for(std::size_t i = 0; i < results.size(); ++i)
+        ok = results[i].get() && ok;
+    if(!ok) return false;
+
+    // The error code and the settings are not shared with the copies
+    FunctionParser copy(fp);
+    const double zero[2] = { 0, 0 };
+    if(copy.Parse("1/x", "x,y") >= 0) return false;
+    copy.Eval(zero);
+    fp.Eval(zero);
+    if(copy.EvalError() == 0 || fp.EvalError() != 0) return false;
+
+    copy = fp;
+    copy.setDelimiterChar('}');
+    return fp.Parse("x}", "x") >= 0
+        && fp.ParseError() != FunctionParserErrorType::no_error
+        && copy.Parse("x}", "x") == 1
+        && copy.ParseError() == FunctionParserErrorType::no_error;
+}
+#else
+int testParserCopiesInThreads()
+{
+    return -1;
+}
+#endif
+
+//=========================================================================
+// Test compiled expressions
+//=========================================================================
+#ifndef FP_DISABLE_DOUBLE_TYPE
+namespace
+{
+    double twice(const double* p) { return 2 * p[0]; }
+
+    double compiledExpected(const double* vars)
+    {
+        return 2 * vars[0] + vars[1] * vars[1] + 1
+            + (vars[0] < vars[1] ? std::sqrt(vars[0]) : 3.5);
+    }
+
+    bool checkCompiledResult(double result, double expected)
+    {
+        if(std::fabs(result - expected) <= 1e-10 * (1 + std::fabs(expected)))
+            return true;
+        if(gVerbosityLevel >= 2)
+            std::cout << "\n - Compiled expression: " << result
+                      << " instead of " << expected << std::endl;
+        return false;
+    }
+
+    // Each thread evaluates the same compiled expression with its own
+    // context.
+    bool evaluateCompiledExpression
+    (const FunctionParser::CompiledExpression& compiled, unsigned number)
+    {
+        FunctionParser::EvalContext context;
+        for(unsigned i = 0; i < 2000; ++i)
+        {
+            const double vars[2] = { double(i % 100) / 10, double(number) };
+            const double result = compiled.Eval(context, vars);
+            if(context.EvalError() != 0 ||
+               !checkCompiledResult(result, compiledExpected(vars)))
+                return false;
+        }
+        return true;
+    }
+}
+
+int testCompiledExpression()
+{
+    FunctionParser::CompiledExpression empty, unparsed((FunctionParser()));
+    const double vars[2] = { 1.5, 2 };
+    int error = -1;
+    if(!empty.empty() || !unparsed.empty() ||
+       empty.Eval(vars, &error) != 0 || error != 0)
+        return false;
+
+    FunctionParser square;
+    if(square.Parse("x*x + 1", "x") >= 0) return false;
+
+    FunctionParser::CompiledExpression compiled;
+    {
+        FunctionParser fp;
+        fp.AddFunction("h", twice, 1);
+        fp.AddFunction("g", square);
+        if(fp.Parse("h(x) + g(y) + if(x < y, sqrt(x), 3.5)", "x,y") >= 0)
+            return false;
+        fp.Optimize();
+        compiled = FunctionParser::CompiledExpression(fp);
+        if(compiled.empty() ||
+           !checkCompiledResult(compiled.Eval(vars), fp.Eval(vars)))
+            return false;
+
+        // The expression doesn't change with the parser
+        if(fp.Parse("x", "x,y") >= 0) return false;
+    }
+    if(!checkCompiledResult(compiled.Eval(vars), compiledExpected(vars)))
+        return false;
+
+    FunctionParser::CompiledExpression copy(compiled);
+    compiled = FunctionParser::CompiledExpression();
+    std::vector<std::future<bool> > results;
+    for(unsigned i = 0; i < 4; ++i)
+        results.push_back(std::async(std::launch::async,
+                                     evaluateCompiledExpression,
+                                     std::cref(copy), i));
+    bool ok = true;
+    for(std::size_t i = 0; i < results.size(); ++i)
+        ok = results[i].get() && ok;
+    if(!ok) return false;
+
+    FunctionParser reciprocal;
+    if(reciprocal.Parse("1/x", "x") >= 0) return false;
+    const FunctionParser::CompiledExpression failing(reciprocal);
+    const double zero = 0;
+    failing.Eval(&zero, &error);
+    if(error != 1) return false;
+
+    // The optimized code gives the same errors as the parser in the NaN
+    // propagation mode
+    reciprocal.setNaNPropagation(true);
+    reciprocal.Optimize();
+    const FunctionParser::CompiledExpression propagating(reciprocal);
+    const double result = propagating.Eval(&zero, &error);
+    return result == reciprocal.Eval(&zero) && error == reciprocal.EvalError()
+        && error != 0;
+}
+#else
+int testCompiledExpression()
+{
+    return -1;
+}
+#endif
+
 //=========================================================================
 // Test variable deduction
 //=========================================================================
@@ -1890,6 +3833,162 @@ const char* getNameForValue_t()
     return "unknown value type";
 }
 
+/* Evaluates the given rows (each one paramAmount values long) with both
+   of the EvalBatch() variants, and compares the results against Eval().
+   With ignoreImagSign, the sign of the imaginary component is ignored as
+   in the comparisons of Eval() (the batch code may give a zero a
+   different sign, which matters on a branch cut).
+*/
+template<typename Value_t>
+bool testEvalBatch(FunctionParserBase<Value_t>& fp, unsigned paramAmount,
+                   const std::vector<Value_t>& rows,
+                   const std::vector<Value_t>& expected,
+                   bool ignoreImagSign, const Value_t Eps,
+                   std::ostream& error)
+{
+    using namespace FUNCTIONPARSERTYPES;
+    const std::size_t count = expected.size();
+    const unsigned stride = paramAmount > 0 ? paramAmount : 1;
+
+    std::vector<std::vector<Value_t> > columns(paramAmount);
+    std::vector<const Value_t*> columnPtrs(paramAmount);
+    for(unsigned p = 0; p < paramAmount; ++p)
+    {
+        for(std::size_t row = 0; row < count; ++row)
+            columns[p].push_back(rows[row * stride + p]);
+        columnPtrs[p] = columns[p].data();
+    }
+
+    for(int variant = 0; variant < 2; ++variant)
+    {
+        std::vector<Value_t> results(count);
+        if(variant == 0)
+            fp.EvalBatch(rows.data(), stride, count, results.data());
+        else
+            fp.EvalBatch(columnPtrs.data(), count, results.data());
+
+        const char* const variantName =
+            variant == 0 ? "EvalBatch(rows)" : "EvalBatch(columns)";
+        if(fp.EvalError() > 0)
+        {
+            error << variantName << ": EvalError " << fp.EvalError() << " ("
+                  << getEvalErrorName(fp.EvalError()) << ")";
+            return false;
+        }
+        for(std::size_t row = 0; row < count; ++row)
+        {
+            const Value_t v1 = expected[row];
+            Value_t v2 = results[row];
+        #ifdef FP_SUPPORT_COMPLEX_NUMBERS
+            if(IsComplexType<Value_t>::value && ignoreImagSign
+            && fp_less(fp_imag(v1), fp_real(Value_t{}))
+            != fp_less(fp_imag(v2), fp_real(Value_t{})))
+                v2 = fp_conj(v2);
+        #else
+            (void)ignoreImagSign;
+        #endif
+            const bool differs = IsIntType<Value_t>::value ? v1 != v2 :
+                (fp_abs(v1) < Eps ?
+                 (fp_abs(v2) < Eps ? fp_abs(v1 - v2) :
+                  fp_abs((v1 - v2) / v2)) :
+                 fp_abs((v1 - v2) / v1)) > Eps;
+            if(differs)
+            {
+                error << variantName << " returned " << std::setprecision(20)
+                      << v2 << " instead of " << v1 << " for (";
+                for(unsigned p = 0; p < paramAmount; ++p)
+                    error << (p>0 ? ", " : "") << rows[row * stride + p];
+                error << ")";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* Evaluates the given rows with the machine code made by CreateJIT(), if
+   it's supported for the type, and compares the results against Eval().
+*/
+template<typename Value_t>
+bool testJIT(const FunctionParserBase<Value_t>& fp, unsigned paramAmount,
+             const std::vector<Value_t>& rows,
+             const std::vector<Value_t>& expected,
+             const Value_t Eps, std::ostream& error)
+{
+    using namespace FUNCTIONPARSERTYPES;
+    FunctionParserBase<Value_t> jitParser(fp);
+    jitParser.ForceDeepCopy();
+    if(!jitParser.CreateJIT()) return true;
+
+    const unsigned stride = paramAmount > 0 ? paramAmount : 1;
+    for(std::size_t row = 0; row < expected.size(); ++row)
+    {
+        const Value_t v1 = expected[row];
+        const Value_t v2 = jitParser.Eval(&rows[row * stride]);
+        const bool differs = jitParser.EvalError() > 0 ||
+            (fp_abs(v1) < Eps ?
+             (fp_abs(v2) < Eps ? fp_abs(v1 - v2) :
+              fp_abs((v1 - v2) / v2)) :
+             fp_abs((v1 - v2) / v1)) > Eps;
+        if(differs)
+        {
+            error << "JIT returned " << std::setprecision(20) << v2
+                  << " (EvalError " << jitParser.EvalError()
+                  << ") instead of " << v1 << " for (";
+            for(unsigned p = 0; p < paramAmount; ++p)
+                error << (p>0 ? ", " : "") << rows[row * stride + p];
+            error << ")";
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Evaluates the given rows with the switch-based interpreter, which Eval()
+   falls back to when the bytecode can't be translated into threaded code.
+   The sign of the imaginary component is ignored like in testEvalBatch().
+*/
+template<typename Value_t>
+bool testSwitchDispatch(FunctionParserBase<Value_t>& fp, unsigned paramAmount,
+                        const std::vector<Value_t>& rows,
+                        const std::vector<Value_t>& expected,
+                        bool ignoreImagSign, const Value_t Eps,
+                        std::ostream& error)
+{
+    using namespace FUNCTIONPARSERTYPES;
+    const unsigned stride = paramAmount > 0 ? paramAmount : 1;
+    for(std::size_t row = 0; row < expected.size(); ++row)
+    {
+        const Value_t v1 = expected[row];
+        Value_t v2 = fp.EvalWithoutThreadedCode(&rows[row * stride]);
+    #ifdef FP_SUPPORT_COMPLEX_NUMBERS
+        if(IsComplexType<Value_t>::value && ignoreImagSign
+        && fp_less(fp_imag(v1), fp_real(Value_t{}))
+        != fp_less(fp_imag(v2), fp_real(Value_t{})))
+            v2 = fp_conj(v2);
+    #else
+        (void)ignoreImagSign;
+    #endif
+        const bool differs = fp.EvalError() > 0 ||
+            (IsIntType<Value_t>::value ? v1 != v2 :
+             (fp_abs(v1) < Eps ?
+              (fp_abs(v2) < Eps ? fp_abs(v1 - v2) :
+               fp_abs((v1 - v2) / v2)) :
+              fp_abs((v1 - v2) / v1)) > Eps);
+        if(differs)
+        {
+            error << "EvalWithoutThreadedCode() returned "
+                  << std::setprecision(20) << v2 << " (EvalError "
+                  << fp.EvalError() << ") instead of " << v1 << " for (";
+            for(unsigned p = 0; p < paramAmount; ++p)
+                error << (p>0 ? ", " : "") << rows[row * stride + p];
+            error << ")";
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename OutStream, typename Value_t>
 bool runRegressionTest(FunctionParserBase<Value_t>& fp,
                        unsigned testIndex,
@@ -1904,6 +4003,7 @@ bool runRegressionTest(FunctionParserBase<Value_t>& fp,
 
     Value_t vars[10];
     Value_t fp_vars[10];
+    std::vector<Value_t> batchRows, batchResults;
 
     bool is_complex = IsComplexType<Value_t>::value;
     Value_t complex_1_0 = Value_t(1);
@@ -1939,6 +4039,10 @@ bool runRegressionTest(FunctionParserBase<Value_t>& fp,
         {
             Value_t v2 = fp.Eval(fp_vars);
 
+            batchRows.insert(batchRows.end(), fp_vars,
+                             fp_vars + std::max(testData.paramAmount, 1u));
+            batchResults.push_back(v2);
+
             std::ostringstream error;
 
             if(fp.EvalError() > 0)
@@ -2089,6 +4193,33 @@ bool runRegressionTest(FunctionParserBase<Value_t>& fp,
         }
         if(paramInd == testData.paramAmount) break;
     }
+
+    std::ostringstream error;
+    if(!testEvalBatch(fp, testData.paramAmount, batchRows, batchResults,
+                      testData.ignoreImagSign, Eps, error) ||
+       !testJIT(fp, testData.paramAmount, batchRows, batchResults,
+                Eps, error) ||
+       !testSwitchDispatch(fp, testData.paramAmount, batchRows, batchResults,
+                           testData.ignoreImagSign, Eps, error))
+    {
+        if(gVerbosityLevel >= 2)
+        {
+            using namespace FUNCTIONPARSERTYPES;
+            out << "\n****************************\nTest "
+                << testData.testName
+                << ", function:\n\"" << testData.funcString
+                << "\"\n(" << getNameForValue_t<Value_t>() << testType << ")"
+                << "\nError: " << error.str() << '\n' << std::flush;
+        }
+        else
+        {
+            out << "";         // lock
+            briefErrorMessages << "- " << testData.testName << ": "
+                               << error.str() << "\n";
+            out << std::flush; // unlock
+        }
+        return false;
+    }
     return true;
 }
 
@@ -3152,7 +5283,25 @@ int main(int argc, char* argv[])
         { "UTF8 test", skipSlowAlgo ? nullptr : &UTF8Test },
         { "Identifier test", &testIdentifiers },
         { "Used-defined functions", &testUserDefinedFunctions },
-        { "Multithreading", &testMultithreadedEvaluation }
+        { "Multithreading", &testMultithreadedEvaluation },
+        { "Evaluation contexts", &testEvaluationContexts },
+        { "Batch evaluation", &testBatchEvaluation },
+        { "JIT compilation", &testJITCompilation },
+        { "Differentiation", &testDifferentiation },
+        { "Reverse-mode gradients", &testReverseModeGradients },
+        { "Interval evaluation", &testIntervalEvaluation },
+        { "Incremental evaluation", &testIncrementalEvaluation },
+        { "Specialization", &testSpecialization },
+        { "Combining functions", &testCombining },
+        { "Parallel batch evaluation", &testParallelBatchEvaluation },
+        { "NaN propagation", &testNaNPropagation },
+        { "C++ source generation", &testCppSourceGeneration },
+        { "Compile-time parsing", &testConstexprParsing },
+        { "Parse cache", &testParseCache },
+        { "Compiled code", &testCompiledCode },
+        { "Parse cache files", &testParseCacheFiles },
+        { "Parser copies in threads", &testParserCopiesInThreads },
+        { "Compiled expression", &testCompiledExpression }
     };
 
     const unsigned algorithmicTestsAmount =
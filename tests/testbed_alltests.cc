@@ -0,0 +1,6145 @@
+
+#include "testbed_autogen.hh"
+const TestType AllTests[] =
+{
+#define q(c) (c=='T'||c=='Y')
+#define o(opt,testname, min,max,step, funcstring, paramstr) \
+    { testname,#funcstring,paramstr, #min,#max,#step, #opt[4]-'0', q(#opt[0]),q(#opt[1]),q(#opt[2]),q(#opt[3]) },
+#define t01 "01unit_operators/"
+#define t02 "02unit_functions/"
+#define t03 "03unit_constants/"
+#define t10 "10optimizer_bytecode/"
+#define t11 "11optimizer_constaddmul/"
+#define t12 "12optimizer_nested2func/"
+#define t13 "13optimizer_trig_constfactor/"
+#define t14 "14optimizer_fun_sum_fun/"
+#define t20 "20optimizer_optimizations/"
+#define t50 "50regressions/"
+#define t99 "99misc/"
+
+#define FP_LIST_ALL_TESTS(o) \
+/*         ┌- use degrees instead of radians?   */ \
+/*         |┌- has a double version?            */ \
+/*         ||┌- has a long version?             */ \
+/*         |||┌- ignore sign in imaginary part? */ \
+/*         ||||┌- parameter count               */ \
+/*         ↓↓↓↓↓                                */ \
+/*   0*/ o(FFTF2,t01"add_i"      ,            -40,40,3,x+y, "x,y") \
+/*   1*/ o(FFTF3,t01"addsub_i"   ,            -40,40,3,x+y+x+x-z+x, "x,y,z") \
+/*   2*/ o(FFTF2,t01"and_i"      ,              -2,2,1,x&y, "x,y") \
+/*   3*/ o(FFTF2,t01"cmpeq_i"    ,              -2,2,1,x=y, "x,y") \
+/*   4*/ o(FFTF2,t01"cmpge_i"    ,              -2,2,1,x>=y, "x,y") \
+/*   5*/ o(FFTF2,t01"cmpgt_i"    ,              -2,2,1,x>y, "x,y") \
+/*   6*/ o(FFTF2,t01"cmple_i"    ,              -2,2,1,x<=y, "x,y") \
+/*   7*/ o(FFTF2,t01"cmplt_i"    ,              -2,2,1,x<y, "x,y") \
+/*   8*/ o(FFTF2,t01"cmpne_i"    ,              -2,2,1,x!=y, "x,y") \
+/*   9*/ o(FFTF2,t01"div_i"      ,          -460,100,8,x/(y+3), "x,y") \
+/*  10*/ o(FFTF3,t01"divmul_i"   ,            -26,20,2,x*y*x*x/(z+3)*(x+4), "x,y,z") \
+/*  11*/ o(FFTF1,t01"inv_i"      ,            -41,40,3,1/x, "x") \
+/*  12*/ o(FFTF2,t01"mod_i"      ,          -460,100,8,x%(z+3), "x,z") \
+/*  13*/ o(FFTF2,t01"mul_i"      ,          -460,100,8,x*(y+4), "x,y") \
+/*  14*/ o(FFTF1,t01"neg_i"      ,            -40,40,3,-x, "x") \
+/*  15*/ o(FFTF1,t01"not_i"      ,              -2,2,1,!x, "x") \
+/*  16*/ o(FFTF1,t01"notnot_i"   ,              -2,2,1,!!x, "x") \
+/*  17*/ o(FFTF2,t01"or_i"       ,              -2,2,1,x|y, "x,y") \
+/*  18*/ o(FFTF2,t01"sub_i"      ,            -40,40,3,x-y, "x,y") \
+/*  19*/ o(FFTF1,t02"abs_i"      ,    -40000,40000,100,abs(x), "x") \
+/*  20*/ o(FFTF3,t02"if_i"       ,              -2,2,1,if(x,y,z), "x,y,z") \
+/*  21*/ o(FTTF2,t02"max"        ,              -4,4,1,max(x,y), "x,y") \
+/*  22*/ o(FTTF2,t02"min"        ,              -4,4,1,min(x,y), "x,y") \
+/*  23*/ o(FTTF1,t10"abs"        ,               0,1,1,abs(-3)+x, "x") \
+/*  24*/ o(FTTF1,t10"abseq0"     ,               0,1,1,(abs(x)=0) + (0=abs(x)), "x") \
+/*  25*/ o(FTTF1,t10"absneq0"    ,               0,1,1,(abs(x)=0) + (0=abs(x)), "x") \
+/*  26*/ o(FTTF1,t10"absnot"     ,              -1,1,1,!(abs(x)), "x") \
+/*  27*/ o(FTTF1,t10"absnotnotnot",             -1,1,1,!(!!((x*x))), "x") \
+/*  28*/ o(FTTF1,t10"absnzge"    ,              -5,5,1,sub(abs(x) >= 4, abs(x) >= 0), "x") \
+/*  29*/ o(FTTF1,t10"absnzlt"    ,              -5,5,1,sub(abs(x) < 4, abs(x) < 0), "x") \
+/*  30*/ o(FTTF1,t10"abssqr"     ,              -1,1,1,abs(x)*abs(x), "x") \
+/*  31*/ o(FTTF1,t10"add"        ,               0,1,1,5+3+x, "x") \
+/*  32*/ o(FTTF1,t10"add0"       ,               0,1,1,x+0+x, "x") \
+/*  33*/ o(FTTF1,t10"and"        ,               0,1,1,(5&3)+x+(5&0)+(0&5)+(0&0), "x") \
+/*  34*/ o(FTTF1,t10"cmp/add"    ,            -10,10,1,1*((1-x+x+5)=4) +2*((1-x+x+5)<4) +4*((1-x+x+5)<=4) +8*((1-x+x+5)>4) +16*((1-x+x+5)>=4) +32*((1-x+x+5)!=4), "x") \
+/*  35*/ o(FTTF1,t10"cmp/mulneg" ,            -10,10,1,1*((x/2*x*5)=4) +2*((x/2*x*5)<4) +4*((x/2*x*5)<=4) +8*((x/2*x*5)>4) +16*((x/2*x*5)>=4) +32*((x/2*x*5)!=4), "x") \
+/*  36*/ o(FTTF1,t10"cmp/mulpos" ,            -10,10,1,1*((x/2*x*-5)=4) +2*((x/2*x*-5)<4) +4*((x/2*x*-5)<=4) +8*((x/2*x*-5)>4) +16*((x/2*x*-5)>=4) +32*((x/2*x*-5)!=4), "x") \
+/*  37*/ o(FTTF1,t10"cmp/neg"    ,            -10,10,1,1*((-x)=4) + 2*((-x)<4) + 4*((-x)<=4) + 8*((-x)>4) + 16*((-x)>=4) + 32*((-x)!=4), "x") \
+/*  38*/ o(FTTF1,t10"cmp/sqr"    ,            -10,10,1,1*((x*x)=16) + 2*((x*x)<16) + 4*((x*x)<=16) + 8*((x*x)>16) + 16*((x*x)>=16) + 32*((x*x)!=16), "x") \
+/*  39*/ o(FTTF1,t10"cmp/sqr_neg",            -10,10,1,1*((x*x)=-16) + 2*((x*x)<-16) + 4*((x*x)<=-16) + 8*((x*x)>-16) + -16*((x*x)>=-16) + 32*((x*x)!=-16), "x") \
+/*  40*/ o(FTTF1,t10"cmpeq"      ,               0,1,1,(5=3)+x+(4=4), "x") \
+/*  41*/ o(FTTF1,t10"cmpge"      ,               0,1,1,(5>=3)+x+(4>=8), "x") \
+/*  42*/ o(FTTF1,t10"cmpgt"      ,               0,1,1,(5>3)+x+(4>8), "x") \
+/*  43*/ o(FTTF1,t10"cmple"      ,               0,1,1,(5<3)+x+(4<8), "x") \
+/*  44*/ o(FTTF1,t10"cmplt"      ,               0,1,1,(5<3)+x, "x") \
+/*  45*/ o(FTTF1,t10"cmpne"      ,               0,1,1,(5!=3)+x+(4!=4), "x") \
+/*  46*/ o(FTTF1,t10"div"        ,               0,1,1,(5/4)+x, "x") \
+/*  47*/ o(FTTF1,t10"div1"       ,               0,1,1,x/1+x, "x") \
+/*  48*/ o(FTTF1,t10"divxx"      ,               1,1,1,x+x/x+x, "x") \
+/*  49*/ o(FTTF1,t10"dupaddmul7" ,              -3,3,1,(x+x)*7, "x") \
+/*  50*/ o(FTTF1,t10"dupminmax"  ,            -10,10,1,sub(min(x,x), max(x,x)), "x") \
+/*  51*/ o(FTTF1,t10"dupminmax2" ,            -10,10,1,sub(x+min(x,x), x+max(x,x)), "x") \
+/*  52*/ o(FTTF2,t10"dupminmax3" ,              -2,2,1,sub(min(min(y,x),x), max(max(y,x),x)), "x,y") \
+/*  53*/ o(FTTF1,t10"dupxmuladd" ,            -10,10,1,x+(x*4), "x") \
+/*  54*/ o(FTTF1,t10"eq0"        ,               0,1,1,(x=0) + (0=x), "x") \
+/*  55*/ o(FTTF1,t10"eq1"        ,               0,1,1,(!x=1), "x") \
+/*  56*/ o(FTTF1,t10"ge0_abs"    ,              -1,1,1,(abs(x) >= 0) + 2*(0 <= abs(x)) + 4*(abs(x) <= 0) + 8*(0 >= abs(x)), "x") \
+/*  57*/ o(FTTF1,t10"ge1_abs"    ,              -1,1,1,(abs(x) >= 1) + 2*(1 <= abs(x)) + 4*(abs(x) <= 1) + 8*(1 >= abs(x)), "x") \
+/*  58*/ o(FTTF1,t10"gt0_abs"    ,              -1,1,1,(abs(x) > 0) + 2*(0 < abs(x)) + 4*(abs(x) < 0) + 8*(0 > abs(x)), "x") \
+/*  59*/ o(FTTF1,t10"gt1_abs"    ,              -1,1,1,(abs(x) > 1) + 2*(1 < abs(x)) + 4*(abs(x) < 1) + 8*(1 > abs(x)), "x") \
+/*  60*/ o(FTTF1,t10"immsub"     ,              -6,6,1,x-5, "x") \
+/*  61*/ o(FTTF2,t10"invmul"     ,              -3,3,2,y*(1/x), "x,y") \
+/*  62*/ o(FTTF1,t10"lt0"        ,              -1,1,1,sub(abs(x)<0, x<0), "x") \
+/*  63*/ o(FTTF1,t10"max"        ,               0,1,1,max(5,4)+x, "x") \
+/*  64*/ o(FTTF1,t10"min"        ,               0,1,1,min(4,5)+x, "x") \
+/*  65*/ o(FTTF1,t10"mod"        ,               0,1,1,(5%4)+x, "x") \
+/*  66*/ o(FTTF1,t10"mul"        ,               0,1,1,(5*4)+x, "x") \
+/*  67*/ o(FTTF1,t10"mul1"       ,               0,1,1,x*1+x, "x") \
+/*  68*/ o(FTTF1,t10"mul2"       ,               0,1,1,x*2, "x") \
+/*  69*/ o(FTTF2,t10"mul4"       ,              -3,3,1,y*(x*2)*2 + (y*2)*2, "x,y") \
+/*  70*/ o(FTTF1,t10"mulneg"     ,               0,1,1,-(x*5), "x") \
+/*  71*/ o(FTTF1,t10"multodiv"   ,               0,1,1,x/4+x, "x") \
+/*  72*/ o(FTTF1,t10"negabs"     ,              -1,1,1,abs(-x), "x") \
+/*  73*/ o(FTTF2,t10"negadd"     ,              -6,6,1,x+(-y), "x,y") \
+/*  74*/ o(FTTF1,t10"negdiv"     ,              -1,1,1,(-x)/5, "x") \
+/*  75*/ o(FTTF1,t10"negmul"     ,               0,1,1,(-x)*5, "x") \
+/*  76*/ o(FTTF1,t10"negneg"     ,              -3,3,2,-(-(-(-(-(-(x)))))), "x") \
+/*  77*/ o(FTTF1,t10"negnot"     ,              -1,1,1,!(-x), "x") \
+/*  78*/ o(FTTF1,t10"negsqr"     ,              -1,1,1,(-x)*(-x), "x") \
+/*  79*/ o(FTTF2,t10"negsub"     ,              -6,6,1,x-(-y), "x,y") \
+/*  80*/ o(FTTF1,t10"neq0"       ,               0,1,1,(x!=0) + (0!=x), "x") \
+/*  81*/ o(FTTF1,t10"neq1"       ,               0,1,1,(!x!=1), "x") \
+/*  82*/ o(FTTF1,t10"not"        ,               0,1,1,(!(3))+x, "x") \
+/*  83*/ o(FTTF2,t10"not_eq"     ,               0,1,1,!(x = y), "x,y") \
+/*  84*/ o(FTTF2,t10"not_ge"     ,               0,1,1,!(x >= y), "x,y") \
+/*  85*/ o(FTTF2,t10"not_gt"     ,               0,1,1,!(x > y), "x,y") \
+/*  86*/ o(FTTF2,t10"not_le"     ,               0,1,1,!(x <= y), "x,y") \
+/*  87*/ o(FTTF2,t10"not_lt"     ,               0,1,1,!(x < y), "x,y") \
+/*  88*/ o(FTTF2,t10"not_ne"     ,               0,1,1,!(x != y), "x,y") \
+/*  89*/ o(FTTF1,t10"notnot"     ,              -1,1,1,!!(x), "x") \
+/*  90*/ o(FTTF1,t10"notnotnot"  ,              -1,1,1,!!!(x), "x") \
+/*  91*/ o(FTTF1,t10"notnotnot2" ,              -1,1,1,!x&!x, "x") \
+/*  92*/ o(FTTF1,t10"or"         ,               0,1,1,(5|3)+x+(5|0)+(0|5)+(0|0), "x") \
+/*  93*/ o(FTTF1,t10"sqr_nxx"    ,              -1,1,1,(-x)*x, "x") \
+/*  94*/ o(FTTF1,t10"sqr_xnx"    ,              -1,1,1,x*(-x), "x") \
+/*  95*/ o(FTTF1,t10"sqr_xx"     ,              -1,1,1,x*x, "x") \
+/*  96*/ o(FTTF2,t10"sqr_ynxx"   ,              -1,1,1,y*-x*x, "x,y") \
+/*  97*/ o(FTTF2,t10"sqr_yxnx"   ,              -1,1,1,y*x*-x, "x,y") \
+/*  98*/ o(FTTF2,t10"sqr_yxx"    ,              -1,1,1,y*x*x, "x,y") \
+/*  99*/ o(FTTF1,t10"sqreq0"     ,               0,1,1,(x*x=0) + (0=x*x), "x") \
+/* 100*/ o(FTTF1,t10"sqrneq0"    ,               0,1,1,(x*x=0) + (0=x*x), "x") \
+/* 101*/ o(FTTF1,t10"sub"        ,               0,1,1,5-3+x, "x") \
+/* 102*/ o(FTTF1,t10"sub0"       ,               0,1,1,x-0+x, "x") \
+/* 103*/ o(FTTF1,t10"subxx"      ,              -3,3,1,x+(x-x)+x+(1-x+x), "x") \
+/* 104*/ o(FTTF1,t10"xaddnot"    ,              -5,5,1,!(x+4), "x") \
+/* 105*/ o(FTTF1,t10"xaddnotnot" ,              -5,5,1,!!(x+4), "x") \
+/* 106*/ o(FTTF1,t10"xxdup"      ,              -1,1,1,sub(x,x), "x") \
+/* 107*/ o(FTTF2,t10"xxsqrdup"   ,              -1,1,1,y*abs(x)*abs(x), "x,y") \
+/* 108*/ o(FTTF1,t11"1"          ,              -1,1,2,(1/a)*5, "a") \
+/* 109*/ o(FTTF1,t11"2"          ,              -1,1,2,5*a, "a") \
+/* 110*/ o(FTTF1,t11"3"          ,              -1,1,2,5/a, "a") \
+/* 111*/ o(FTTF2,t11"4"          ,              -1,1,2,(a*5)*b, "a,b") \
+/* 112*/ o(FTTF2,t11"5"          ,              -1,1,2,(a*5)/b, "a,b") \
+/* 113*/ o(FTTF2,t11"6"          ,              -1,1,2,(1/a)*b, "a,b") \
+/* 114*/ o(FTTF2,t11"7"          ,              -1,1,2,(1/a)/b, "a,b") \
+/* 115*/ o(FTTF2,t11"8"          ,              -1,1,2,abs(a)*(abs(b)*5), "a,b") \
+/* 116*/ o(FTTF2,t11"9"          ,              -1,1,2,abs(a)/(abs(b)*5), "a,b") \
+/* 117*/ o(FTTF2,t11"10"         ,            -15,15,2,abs(b)*(5/a), "a,b") \
+/* 118*/ o(FTTF2,t11"11"         ,            -15,15,2,abs(b)/(50/a), "a,b") \
+/* 119*/ o(FTTF1,t11"12"         ,            -15,15,2,(-a)+5, "a") \
+/* 120*/ o(FTTF2,t11"13"         ,            -15,15,2,5+(a*b), "a,b") \
+/* 121*/ o(FTTF2,t11"14"         ,            -15,15,2,5-(a*b), "a,b") \
+/* 122*/ o(FTTF2,t11"15"         ,            -15,15,2,(a+5)+abs(b), "a,b") \
+/* 123*/ o(FTTF2,t11"16"         ,            -15,15,2,(a+5)-abs(b), "a,b") \
+/* 124*/ o(FTTF2,t11"17"         ,            -15,15,2,(-a)+abs(b), "a,b") \
+/* 125*/ o(FTTF2,t11"18"         ,            -15,15,2,(-a)-abs(b), "a,b") \
+/* 126*/ o(FTTF2,t11"19"         ,            -15,15,2,b+(abs(a)+5), "a,b") \
+/* 127*/ o(FTTF2,t11"20"         ,            -15,15,2,b-(abs(a)+5), "a,b") \
+/* 128*/ o(FTTF2,t11"21"         ,            -15,15,2,abs(b)+(5-a), "a,b") \
+/* 129*/ o(FTTF2,t11"22"         ,            -15,15,2,abs(b)-(5-a), "a,b") \
+/* 130*/ o(FTTF2,t11"23"         ,            -15,15,2,((1/   abs(b))*b)/a, "a,b") \
+/* 131*/ o(FTTF2,t11"24"         ,            -15,15,2,((1/   abs(b))*5)/a, "a,b") \
+/* 132*/ o(FTTF2,t11"25"         ,            -15,15,2,((1/   abs(b))*5)*a, "a,b") \
+/* 133*/ o(FTTF2,t11"26"         ,            -15,15,2,(   abs(a)/b)/a, "a,b") \
+/* 134*/ o(FTTF2,t11"27"         ,            -15,15,2,(   abs(a)/b)*a, "a,b") \
+/* 135*/ o(FTTF2,t11"28"         ,            -15,15,2,((-a)/b)*5, "a,b") \
+/* 136*/ o(FTTF2,t11"29"         ,            -15,15,2,(5/b)*a, "a,b") \
+/* 137*/ o(FTTF1,t11"30"         ,            -15,15,2,(7/b)*5, "b") \
+/* 138*/ o(FTTF2,t11"31"         ,            -15,15,2,b*(7/-a), "a,b") \
+/* 139*/ o(FTTF2,t11"32"         ,            -15,15,2,(5-b)-a, "a,b") \
+/* 140*/ o(FTTF2,t11"33"         ,            -15,15,2,(5-b)+a, "a,b") \
+/* 141*/ o(FTTF2,t11"34"         ,            -15,15,2,((a+7)-b)+5, "a,b") \
+/* 142*/ o(FTTF2,t11"35"         ,            -15,15,2,((-a)-b)+5, "a,b") \
+/* 143*/ o(FTTF1,t11"36"         ,            -15,15,2,(7-abs(a))+5, "a") \
+/* 144*/ o(FTTF2,t11"37"         ,            -15,15,2,((7-b)+a)+5, "a,b") \
+/* 145*/ o(FTTF2,t11"38"         ,            -15,15,2,((5*b+abs(a))<0)*1 + ((abs(b))<0)*2, "a,b") \
+/* 146*/ o(FTTF1,t11"39"         ,            -15,15,2,(a+7)*5, "a") \
+/* 147*/ o(FTTF2,t11"40"         ,            -15,15,2,(b+(a*7))*5, "a,b") \
+/* 148*/ o(FTTF2,t11"41"         ,            -15,15,2,(b-(a*7))*5, "a,b") \
+/* 149*/ o(FTTF1,t11"42"         ,            -15,15,2,(a+7)+5, "a") \
+/* 150*/ o(FTTF1,t11"43"         ,            -15,15,2,(a*7)*5, "a") \
+/* 151*/ o(FTTF1,t20"abseq0"     ,               0,1,1,(abs(x)=if(1,0,1)) + (if(1,0,1)=abs(x)), "x") \
+/* 152*/ o(FTTF1,t20"absneq0"    ,               0,1,1,(abs(x)!=if(1,0,1)) + (if(1,0,1)!=abs(x)), "x") \
+/* 153*/ o(FTTF1,t20"absnzge"    ,              -5,5,1,sub(abs(x) >= if(1,4,0), abs(x) >= (if(1,1,0)-1)), "x") \
+/* 154*/ o(FTTF1,t20"absnzlt"    ,              -5,5,1,sub(abs(x) < if(1,4,0), abs(x) < (if(1,1,0)-1)), "x") \
+/* 155*/ o(FTTF2,t20"addconstmul",              -3,3,2,5*(if(1,4,0)+x+y), "x,y") \
+/* 156*/ o(FTTF2,t20"addmulconstmul",           -3,3,2,5*(if(1,4,0)*y+x), "x,y") \
+/* 157*/ o(FTTF2,t20"addnegmulneg",             -3,3,2,(-5) + (if(1,5,0)*x*y), "x,y") \
+/* 158*/ o(FTTF2,t20"addnegmulpos",             -3,3,2,(if(1,-5,0)*y) + (if(1,5,0)*x), "x,y") \
+/* 159*/ o(FTTF2,t20"cmpeq/add_imm",            -6,6,1,(x+4+y) = 6, "x,y") \
+/* 160*/ o(FTTF1,t20"cmpeq/add_reduce",         -6,6,1,((x*5/2)+x*x-2) = ((x*5/2)+abs(x)), "x") \
+/* 161*/ o(FTTF2,t20"cmpeq/addadd_imm",         -6,6,1,(x+4) = (y+6), "x,y") \
+/* 162*/ o(FTTF2,t20"cmpeq/minmax",              0,1,1,if(x = y,x,y), "x,y") \
+/* 163*/ o(FTTF2,t20"cmpeq/minmax_rev",          0,1,1,if(x = y,y,x), "x,y") \
+/* 164*/ o(FTTF2,t20"cmpeq/mul_imm_neg",        -6,6,1,(x*-4*y) = 6, "x,y") \
+/* 165*/ o(FTTF2,t20"cmpeq/mul_imm_pos",        -6,6,1,(x*4*y) = 6, "x,y") \
+/* 166*/ o(FTTF2,t20"cmpeq/mulmul_imm_neg",     -6,6,1,(x*-4) = (y+6), "x,y") \
+/* 167*/ o(FTTF2,t20"cmpeq/mulmul_imm_pos",     -6,6,1,(x*4) = (y+6), "x,y") \
+/* 168*/ o(FTTF2,t20"cmpge/add_imm",            -6,6,1,(x+4+y) >= 6, "x,y") \
+/* 169*/ o(FTTF1,t20"cmpge/add_reduce",         -6,6,1,((x*5/2)+x*x-2) >= ((x*5/2)+abs(x)), "x") \
+/* 170*/ o(FTTF2,t20"cmpge/addadd_imm",         -6,6,1,(x+4) >= (y+6), "x,y") \
+/* 171*/ o(FTTF2,t20"cmpge/minmax",              0,1,1,if(x >= y,x,y), "x,y") \
+/* 172*/ o(FTTF2,t20"cmpge/minmax_rev",          0,1,1,if(x >= y,y,x), "x,y") \
+/* 173*/ o(FTTF2,t20"cmpge/mul_imm_neg",        -6,6,1,(x*-4*y) >= 6, "x,y") \
+/* 174*/ o(FTTF2,t20"cmpge/mul_imm_pos",        -6,6,1,(x*4*y) >= 6, "x,y") \
+/* 175*/ o(FTTF2,t20"cmpge/mulmul_imm_neg",     -6,6,1,(x*-4) >= (y+6), "x,y") \
+/* 176*/ o(FTTF2,t20"cmpge/mulmul_imm_pos",     -6,6,1,(x*4) >= (y+6), "x,y") \
+/* 177*/ o(FTTF2,t20"cmpgt/add_imm",            -6,6,1,(x+4+y) > 6, "x,y") \
+/* 178*/ o(FTTF1,t20"cmpgt/add_reduce",         -6,6,1,((x*5/2)+x*x-2) > ((x*5/2)+abs(x)), "x") \
+/* 179*/ o(FTTF2,t20"cmpgt/addadd_imm",         -6,6,1,(x+4) > (y+6), "x,y") \
+/* 180*/ o(FTTF2,t20"cmpgt/minmax",              0,1,1,if(x > y,x,y), "x,y") \
+/* 181*/ o(FTTF2,t20"cmpgt/minmax_rev",          0,1,1,if(x > y,y,x), "x,y") \
+/* 182*/ o(FTTF2,t20"cmpgt/mul_imm_neg",        -6,6,1,(x*-4*y) > 6, "x,y") \
+/* 183*/ o(FTTF2,t20"cmpgt/mul_imm_pos",        -6,6,1,(x*4*y) > 6, "x,y") \
+/* 184*/ o(FTTF2,t20"cmpgt/mulmul_imm_neg",     -6,6,1,(x*-4) > (y+6), "x,y") \
+/* 185*/ o(FTTF2,t20"cmpgt/mulmul_imm_pos",     -6,6,1,(x*4) > (y+6), "x,y") \
+/* 186*/ o(FTTF2,t20"cmple/add_imm",            -6,6,1,(x+4+y) <= 6, "x,y") \
+/* 187*/ o(FTTF1,t20"cmple/add_reduce",         -6,6,1,(((x*5/2)+x*x-2)) <= ((x*5/2)+abs(x)), "x") \
+/* 188*/ o(FTTF2,t20"cmple/addadd_imm",         -6,6,1,(x+4) <= (y+6), "x,y") \
+/* 189*/ o(FTTF2,t20"cmple/minmax",              0,1,1,if(x <= y,x,y), "x,y") \
+/* 190*/ o(FTTF2,t20"cmple/minmax_rev",          0,1,1,if(x <= y,y,x), "x,y") \
+/* 191*/ o(FTTF2,t20"cmple/mul_imm_neg",        -6,6,1,(x*-4*y) <= 6, "x,y") \
+/* 192*/ o(FTTF2,t20"cmple/mul_imm_pos",        -6,6,1,(x*4*y) <= 6, "x,y") \
+/* 193*/ o(FTTF2,t20"cmple/mulmul_imm_neg",     -6,6,1,(x*-4) <= (y+6), "x,y") \
+/* 194*/ o(FTTF2,t20"cmple/mulmul_imm_pos",     -6,6,1,(x*4) <= (y+6), "x,y") \
+/* 195*/ o(FTTF2,t20"cmplt/add_imm",            -6,6,1,(x+4+y) < 6, "x,y") \
+/* 196*/ o(FTTF1,t20"cmplt/add_reduce",         -6,6,1,(((x*5/2)+x*x-2)) < ((x*5/2)+abs(x)), "x") \
+/* 197*/ o(FTTF2,t20"cmplt/addadd_imm",         -6,6,1,(x+4) < (y+6), "x,y") \
+/* 198*/ o(FTTF2,t20"cmplt/minmax",              0,1,1,if(x < y,x,y), "x,y") \
+/* 199*/ o(FTTF2,t20"cmplt/minmax_rev",          0,1,1,if(x < y,y,x), "x,y") \
+/* 200*/ o(FTTF2,t20"cmplt/mul_imm_neg",        -6,6,1,(x*-4*y) < 6, "x,y") \
+/* 201*/ o(FTTF2,t20"cmplt/mul_imm_pos",        -6,6,1,(x*4*y) < 6, "x,y") \
+/* 202*/ o(FTTF2,t20"cmplt/mulmul_imm_neg",     -6,6,1,(x*-4) < (y+6), "x,y") \
+/* 203*/ o(FTTF2,t20"cmplt/mulmul_imm_pos",     -6,6,1,(x*4) < (y+6), "x,y") \
+/* 204*/ o(FTTF2,t20"cmpne/add_imm",            -6,6,1,(x+4+y) != 6, "x,y") \
+/* 205*/ o(FTTF1,t20"cmpne/add_reduce",         -6,6,1,(((x*5/2)+x*x-2)) != ((x*5/2)+abs(x)), "x") \
+/* 206*/ o(FTTF2,t20"cmpne/addadd_imm",         -6,6,1,(x+4) != (y+6), "x,y") \
+/* 207*/ o(FTTF2,t20"cmpne/minmax",              0,1,1,if(x != y,x,y), "x,y") \
+/* 208*/ o(FTTF2,t20"cmpne/minmax_rev",          0,1,1,if(x != y,y,x), "x,y") \
+/* 209*/ o(FTTF2,t20"cmpne/mul_imm_neg",        -6,6,1,(x*-4*y) != 6, "x,y") \
+/* 210*/ o(FTTF2,t20"cmpne/mul_imm_pos",        -6,6,1,(x*4*y) != 6, "x,y") \
+/* 211*/ o(FTTF2,t20"cmpne/mulmul_imm_neg",     -6,6,1,(x*-4) != (y+6), "x,y") \
+/* 212*/ o(FTTF2,t20"cmpne/mulmul_imm_pos",     -6,6,1,(x*4) != (y+6), "x,y") \
+/* 213*/ o(FTTF2,t20"cmpzz/add_imm",            -6,6,1,0x0001 * ((x+4+y) < 6) + 0x0002 * ((x+4+y) <= 6) + 0x0004 * ((x+4+y) > 6) + 0x0008 * ((x+4+y) >= 6) + 0x0010 * ((x+4+y) != 6) + 0x0020 * ((x+4+y) = 6), "x,y") \
+/* 214*/ o(FTTF1,t20"cmpzz/add_reduce",         -6,6,1,0x0001 * ((((x*5/2)+x*x-2)) < ((x*5/2)+abs(x))) + 0x0002 * ((((x*5/2)+x*x-2)) <= ((x*5/2)+abs(x))) + 0x0004 * ((((x*5/2)+x*x-2)) > ((x*5/2)+abs(x))) + 0x0008 * ((((x*5/2)+x*x-2)) >= ((x*5/2)+abs(x))) + 0x0010 * ((((x*5/2)+x*x-2)) != ((x*5/2)+abs(x))) + 0x0020 * ((((x*5/2)+x*x-2)) = ((x*5/2)+abs(x))), "x") \
+/* 215*/ o(FTTF2,t20"cmpzz/addadd_imm",         -6,6,1,0x0001 * ((x+4) < (y+6)) + 0x0002 * ((x+4) <= (y+6)) + 0x0004 * ((x+4) > (y+6)) + 0x0008 * ((x+4) >= (y+6)) + 0x0010 * ((x+4) != (y+6)) + 0x0020 * ((x+4) = (y+6)), "x,y") \
+/* 216*/ o(FTTF2,t20"cmpzz/minmax",              0,1,1,0x0001 * if(x < y,x,y) + 0x0002 * if(x <= y,x,y) + 0x0004 * if(x > y,x,y) + 0x0008 * if(x >= y,x,y) + 0x0010 * if(x != y,x,y) + 0x0020 * if(x = y,x,y), "x,y") \
+/* 217*/ o(FTTF2,t20"cmpzz/minmax_rev",          0,1,1,0x0001 * if(x < y,y,x) + 0x0002 * if(x <= y,y,x) + 0x0004 * if(x > y,y,x) + 0x0008 * if(x >= y,y,x) + 0x0010 * if(x != y,y,x) + 0x0020 * if(x = y,y,x), "x,y") \
+/* 218*/ o(FTTF2,t20"cmpzz/mul_imm_neg",        -6,6,1,0x0001 * ((x*-4*y) < 6) + 0x0002 * ((x*-4*y) <= 6) + 0x0004 * ((x*-4*y) > 6) + 0x0008 * ((x*-4*y) >= 6) + 0x0010 * ((x*-4*y) != 6) + 0x0020 * ((x*-4*y) = 6), "x,y") \
+/* 219*/ o(FTTF2,t20"cmpzz/mul_imm_pos",        -6,6,1,0x0001 * ((x*4*y) < 6) + 0x0002 * ((x*4*y) <= 6) + 0x0004 * ((x*4*y) > 6) + 0x0008 * ((x*4*y) >= 6) + 0x0010 * ((x*4*y) != 6) + 0x0020 * ((x*4*y) = 6), "x,y") \
+/* 220*/ o(FTTF2,t20"cmpzz/mulmul_imm_neg",     -6,6,1,0x0001 * ((x*-4) < (y+6)) + 0x0002 * ((x*-4) <= (y+6)) + 0x0004 * ((x*-4) > (y+6)) + 0x0008 * ((x*-4) >= (y+6)) + 0x0010 * ((x*-4) != (y+6)) + 0x0020 * ((x*-4) = (y+6)), "x,y") \
+/* 221*/ o(FTTF2,t20"cmpzz/mulmul_imm_pos",     -6,6,1,0x0001 * ((x*4) < (y+6)) + 0x0002 * ((x*4) <= (y+6)) + 0x0004 * ((x*4) > (y+6)) + 0x0008 * ((x*4) >= (y+6)) + 0x0010 * ((x*4) != (y+6)) + 0x0020 * ((x*4) = (y+6)), "x,y") \
+/* 222*/ o(FTTF2,t20"commutative/add",          -2,2,1,(x+y) = (y+x), "x,y") \
+/* 223*/ o(FTTF2,t20"commutative/and",          -2,2,1,(x&y) = (y&x), "x,y") \
+/* 224*/ o(FTTF2,t20"commutative/eq",           -2,2,1,(x=y) = (y=x), "x,y") \
+/* 225*/ o(FTTF2,t20"commutative/fma",          -2,2,1,(x*y+3) = (y*x+3), "x,y") \
+/* 226*/ o(FTTF2,t20"commutative/max",          -2,2,1,max(x,y) = max(y,x), "x,y") \
+/* 227*/ o(FTTF2,t20"commutative/min",          -2,2,1,min(x,y) = min(y,x), "x,y") \
+/* 228*/ o(FTTF2,t20"commutative/mul",          -2,2,1,(x*y) = (y*x), "x,y") \
+/* 229*/ o(FTTF2,t20"commutative/neq",          -2,2,1,(x!=y) = (y!=x), "x,y") \
+/* 230*/ o(FTTF2,t20"commutative/or",           -2,2,1,(x|y) = (y|x), "x,y") \
+/* 231*/ o(FTTF1,t20"eq0"        ,               0,1,1,(x=if(1,0,0)) + (if(1,0,0)=x), "x") \
+/* 232*/ o(FTTF1,t20"eq1"        ,               0,1,1,(!x=if(1,1,1)), "x") \
+/* 233*/ o(FTTF1,t20"ge0_abs"    ,              -1,1,1,(abs(x) >= if(1,0,0)) + 2*(if(1,0,0) <= abs(x)) + 4*(abs(x) <= if(1,0,0)) + 8*(if(1,0,0) >= abs(x)), "x") \
+/* 234*/ o(FTTF1,t20"ge1_abs"    ,              -1,1,1,(abs(x) >= if(1,1,1)) + 2*(if(1,1,1) <= abs(x)) + 4*(abs(x) <= if(1,1,1)) + 8*(if(1,1,1) >= abs(x)), "x") \
+/* 235*/ o(FTTF2,t20"ge_and_eq"  ,               0,1,1,(x >= y) & (x = y), "x,y") \
+/* 236*/ o(FTTF2,t20"ge_and_le"  ,               0,1,1,(x >= y) & (x <= y), "x,y") \
+/* 237*/ o(FTTF2,t20"ge_and_ne"  ,               0,1,1,(x >= y) & (x != y), "x,y") \
+/* 238*/ o(FTTF2,t20"ge_or_eq"   ,               0,1,1,(x >= y) | (x = y), "x,y") \
+/* 239*/ o(FTTF2,t20"ge_or_le"   ,               0,1,1,(x >= y) | (x <= y), "x,y") \
+/* 240*/ o(FTTF2,t20"ge_or_ne"   ,               0,1,1,(x >= y) | (x != y), "x,y") \
+/* 241*/ o(FTTF1,t20"gt0_abs"    ,              -1,1,1,(abs(x) > if(1,0,0)) + 2*(if(1,0,0) < abs(x)) + 4*(abs(x) < if(1,0,0)) + 8*(if(1,0,0) > abs(x)), "x") \
+/* 242*/ o(FTTF1,t20"gt1_abs"    ,              -1,1,1,(abs(x) > if(1,1,1)) + 2*(if(1,1,1) < abs(x)) + 4*(abs(x) < if(1,1,1)) + 8*(if(1,1,1) > abs(x)), "x") \
+/* 243*/ o(FTTF2,t20"gt_and_eq"  ,               0,1,1,(x > y) & (x = y), "x,y") \
+/* 244*/ o(FTTF2,t20"gt_and_ge"  ,               0,1,1,(x > y) & (x >= y), "x,y") \
+/* 245*/ o(FTTF2,t20"gt_and_le"  ,               0,1,1,(x > y) & (x <= y), "x,y") \
+/* 246*/ o(FTTF2,t20"gt_and_ne"  ,               0,1,1,(x > y) & (x != y), "x,y") \
+/* 247*/ o(FTTF2,t20"gt_or_eq"   ,               0,1,1,(x > y) | (x = y), "x,y") \
+/* 248*/ o(FTTF2,t20"gt_or_ge"   ,               0,1,1,(x > y) | (x >= y), "x,y") \
+/* 249*/ o(FTTF2,t20"gt_or_le"   ,               0,1,1,(x > y) | (x <= y), "x,y") \
+/* 250*/ o(FTTF2,t20"gt_or_ne"   ,               0,1,1,(x > y) | (x != y), "x,y") \
+/* 251*/ o(FTTF1,t20"if10"       ,               0,1,1,if(x,1,0) + 10*if(x,0,1)    + 100*if(x>0,1,0) + 1000*if(x>0,0,1), "x") \
+/* 252*/ o(FTTF2,t20"if_extract/abs",           -2,2,1,if(x, abs(x+2), abs(y+5)), "x,y") \
+/* 253*/ o(FTTF2,t20"if_extract/add",           -2,2,1,if(x, y+2, y+5), "x,y") \
+/* 254*/ o(FTTF2,t20"if_extract/add1",          -2,2,1,if(x, y+2, y), "x,y") \
+/* 255*/ o(FTTF2,t20"if_extract/add2",          -2,2,1,if(x, y, y+2), "x,y") \
+/* 256*/ o(FTTF3,t20"if_extract/and1_l",        -1,1,1,if(x, y&z, y<1), "x,y,z") \
+/* 257*/ o(FTTF3,t20"if_extract/and1_nl",       -1,1,1,if(x, y&z, z), "x,y,z") \
+/* 258*/ o(FTTF3,t20"if_extract/and2_l",        -1,1,1,if(x, y<1, y&z), "x,y,z") \
+/* 259*/ o(FTTF3,t20"if_extract/and2_nl",       -1,1,1,if(x, z, y&z), "x,y,z") \
+/* 260*/ o(FFTF2,t20"if_extract/div",           -2,2,1,if(x, y/x, y/2), "x,y") \
+/* 261*/ o(FTTF2,t20"if_extract/min",           -2,2,1,if(x, min(y,2), min(y,5)), "x,y") \
+/* 262*/ o(FTTF2,t20"if_extract/mul",           -2,2,1,if(x, y*2, y*5), "x,y") \
+/* 263*/ o(FTTF2,t20"if_extract/mul1",          -2,2,1,if(x, y*2, y), "x,y") \
+/* 264*/ o(FTTF2,t20"if_extract/mul2",          -2,2,1,if(x, y, y*2), "x,y") \
+/* 265*/ o(FTTF3,t20"if_extract/or1_l",         -1,1,1,if(x, y|z, y<1), "x,y,z") \
+/* 266*/ o(FTTF3,t20"if_extract/or1_nl",        -1,1,1,if(x, y|z, z), "x,y,z") \
+/* 267*/ o(FTTF3,t20"if_extract/or2_l",         -1,1,1,if(x, y<1, y|z), "x,y,z") \
+/* 268*/ o(FTTF3,t20"if_extract/or2_nl",        -1,1,1,if(x, z, y|z), "x,y,z") \
+/* 269*/ o(FTTF1,t20"if_join_add2",              3,5,1,x + 10 + if(x<4, 3,4), "x") \
+/* 270*/ o(FTTF1,t20"if_join_mul2",              3,5,1,x * 10 * if(x<4, 3,4), "x") \
+/* 271*/ o(FTTF1,t20"ifabs"      ,              -1,1,1,1*(5+if(x< 0,-x,x)) + 10*(5+if(x<=0,-x,x)) + 100*(5+if(x> 0,-x,x)) + 1000*(5+if(x>=0,-x,x)) + 10000*(5+if(x< 0,x,-x)) + 100000*(5+if(x<=0,x,-x)) + 1000000*(5+if(x> 0,x,-x)) + 10000000*(5+if(x>=0,x,-x)), "x") \
+/* 272*/ o(FTTF4,t20"ifmerge"    ,              -1,1,1,if(x,if(y,x,b),if(y,x,d)) + if(b,if(d,y,x),if(d,b,x)), "b,d,x,y") \
+/* 273*/ o(FTTF4,t20"ifmerge2"   ,              -1,1,1,if(x,if(y,a,b),if(b,a,b)), "a,b,x,y") \
+/* 274*/ o(FTTF4,t20"ifmerge2b"  ,              -1,1,1,if(x,if(y,a,b),if(b,b,a)), "a,b,x,y") \
+/* 275*/ o(FTTF2,t20"ifnop"      ,               0,1,1,if(x,y,y), "x,y") \
+/* 276*/ o(FTTF2,t20"l_abs"      ,              -4,4,1,(x+2) & abs(x) & (y+2), "x,y") \
+/* 277*/ o(FTTF2,t20"l_mulabs"   ,              -4,4,1,(x*abs(y)) & (y+2), "x,y") \
+/* 278*/ o(FTTF2,t20"l_mulneg"   ,              -4,4,1,(x*y*-5) & (y+2), "x,y") \
+/* 279*/ o(FTTF2,t20"l_notnot"   ,              -4,4,1,(x+2) & !!x & (y+2), "x,y") \
+/* 280*/ o(FTTF2,t20"le_and_eq"  ,               0,1,1,(x <= y) & (x = y), "x,y") \
+/* 281*/ o(FTTF2,t20"le_and_ne"  ,               0,1,1,(x <= y) & (x != y), "x,y") \
+/* 282*/ o(FTTF2,t20"le_or_eq"   ,               0,1,1,(x <= y) | (x = y), "x,y") \
+/* 283*/ o(FTTF2,t20"le_or_ne"   ,               0,1,1,(x <= y) | (x != y), "x,y") \
+/* 284*/ o(FTTF2,t20"lt_and_eq"  ,               0,1,1,(x < y) & (x = y), "x,y") \
+/* 285*/ o(FTTF2,t20"lt_and_ge"  ,               0,1,1,(x < y) & (x >= y), "x,y") \
+/* 286*/ o(FTTF2,t20"lt_and_gt"  ,               0,1,1,(x < y) & (x > y), "x,y") \
+/* 287*/ o(FTTF2,t20"lt_and_le"  ,               0,1,1,(x < y) & (x <= y), "x,y") \
+/* 288*/ o(FTTF2,t20"lt_and_ne"  ,               0,1,1,(x < y) & (x != y), "x,y") \
+/* 289*/ o(FTTF2,t20"lt_or_eq"   ,               0,1,1,(x < y) | (x = y), "x,y") \
+/* 290*/ o(FTTF2,t20"lt_or_ge"   ,               0,1,1,(x < y) | (x >= y), "x,y") \
+/* 291*/ o(FTTF2,t20"lt_or_gt"   ,               0,1,1,(x < y) | (x > y), "x,y") \
+/* 292*/ o(FTTF2,t20"lt_or_le"   ,               0,1,1,(x < y) | (x <= y), "x,y") \
+/* 293*/ o(FTTF2,t20"lt_or_ne"   ,               0,1,1,(x < y) | (x != y), "x,y") \
+/* 294*/ o(FTTF3,t20"mergemulabs",              -1,1,1,abs(x)*abs(y)*z, "x,y,z") \
+/* 295*/ o(FTTF3,t20"mixedminmax",               0,4,1,max(z,min(x,max(max(z,y),x))) + 10*min(z,max(x,min(y,x))) + 100*min(max(x,y),min(y,z)) + 1000*max(min(x,y),max(y,z)), "x,y,z") \
+/* 296*/ o(FTTF2,t20"nand2"      ,               0,1,1,!x | !y, "x,y") \
+/* 297*/ o(FTTF3,t20"nand2plus"  ,               0,1,1,!x | !y | z, "x,y,z") \
+/* 298*/ o(FTTF3,t20"nand3"      ,               0,1,1,!x | !y | !z, "x,y,z") \
+/* 299*/ o(FTTF1,t20"neq0"       ,               0,1,1,(x!=if(1,0,0)) + (if(1,0,0)!=x), "x") \
+/* 300*/ o(FTTF1,t20"neq1"       ,               0,1,1,(!x!=if(1,1,1)), "x") \
+/* 301*/ o(FTTF2,t20"nor2"       ,               0,1,1,!x & !y, "x,y") \
+/* 302*/ o(FTTF3,t20"nor2plus"   ,               0,1,1,!x & !y & z, "x,y,z") \
+/* 303*/ o(FTTF3,t20"nor3"       ,               0,1,1,!x & !y & !z, "x,y,z") \
+/* 304*/ o(FTTF2,t20"not_eq"     ,               0,1,1,if(x = y, 0,1), "x,y") \
+/* 305*/ o(FTTF2,t20"not_ge"     ,               0,1,1,if(x >= y, 0,1), "x,y") \
+/* 306*/ o(FTTF2,t20"not_gt"     ,               0,1,1,if(x > y, 0,1), "x,y") \
+/* 307*/ o(FTTF2,t20"not_le"     ,               0,1,1,if(x <= y, 0,1), "x,y") \
+/* 308*/ o(FTTF2,t20"not_lt"     ,               0,1,1,if(x < y, 0,1), "x,y") \
+/* 309*/ o(FTTF2,t20"not_ne"     ,               0,1,1,if(x != y, 0,1), "x,y") \
+/* 310*/ o(FTTF2,t20"notnot"     ,              -2,2,1,!!x + if(y, 1,0), "x,y") \
+/* 311*/ o(FTTF1,t20"xaddnot"    ,              -5,5,1,!(x+if(1,4,4)), "x") \
+/* 312*/ o(FTTF1,t20"xaddnotnot" ,              -5,5,1,!!(x+if(1,4,4)), "x") \
+/* 313*/ o(FTTF1,t50"1"          ,            -10,10,1,x+max(0, min(-2,0)), "x") \
+/* 314*/ o(FTTF1,t50"2"          ,            -10,10,1,min(x,min(1,x)), "x") \
+/* 315*/ o(FTTF1,t50"3"          ,              -2,2,1,sub(  (!x & !!x) ,  (!x | !!x)  ), "x") \
+/* 316*/ o(FTTF2,t50"4"          ,              -2,2,1,sub(!(x-y), !!(x-y)), "x,y") \
+/* 317*/ o(FTTF1,t50"6"          ,              -5,5,1,sub(!(x+4), !!(x+3)), "x") \
+/* 318*/ o(FTTF1,t50"7"          ,              -9,9,1,x>7 & x<2, "x") \
+/* 319*/ o(FTTF1,t50"9a"         ,              -1,1,1,a:=x;a*0, "x") \
+/* 320*/ o(FTTF2,t50"9b"         ,              -1,1,1,sub(a,b)*0, "a,b") \
+/* 321*/ o(FTTF2,t50"9c"         ,              -1,1,1,psub(a,b)*0, "a,b") \
+/* 322*/ o(FTTF2,t50"9d"         ,              -1,1,1,if(a,b*0,a*0)*0, "a,b") \
+/* 323*/ o(FTTF1,t50"36"         ,            -10,10,1,-if(x<0, x, -x) + -if(x<5, 2, 3), "x") \
+/* 324*/ o(FTTF2,t50"60"         ,              -2,2,1,sqr(x) | sub(x,y) | value(), "x,y") \
+/* 325*/ o(FTTF3,t50"61"         ,              -3,3,2,5*x*y + (-5)*z, "x,y,z") \
+/* 326*/ o(FTTF2,t99"16"         ,            -20,20,1,if(x<0, if(y<0, x+y, x-y), if(y>0, x*y, x+2*y)), "x,y") \
+/* 327*/ o(FTTF2,t99"17"         ,            -20,20,1,sqr(x)+sub(x,y)+psqr(y)+psub(y+1,x-2)-1, "x,y") \
+/* 328*/ o(FTTF2,t99"19"         ,              -7,7,1,(x<y)+10*(x<=y)+100*(x>y)+1000*(x>=y)+10000*(x=y)+100000*(x!=y)+ (x&y)*2+(x|y)*20+(!x)*200+(!!x)*2000+4*!((x<y)&(x<3))+40*!!(!(x>y)|(x>3)), "x,y") \
+/* 329*/ o(FTTF2,t99"20"         ,          -100,100,1,(!(x != y) & !x) + !(!(!(!y))), "x,y") \
+/* 330*/ o(FTTF1,t99"21"         ,            -10,10,1,sqr(x)+value()-pvalue ( ), "x") \
+/* 331*/ o(FTTF1,t99"24"         ,        -1000,1000,1,(min(x, min(1,x)) + min(x, 1))/2 + min(x, 1)*3 + max(0, min(-2,0)), "x") \
+/* 332*/ o(FTTF2,t99"29"         ,              -5,5,1,x-y*1, "x,y") \
+/* 333*/ o(FTTF3,t99"35"         ,            -10,10,1,A_very_long_variable_name_1-A_very_long_variable_name_2+ Yet_a_third_very_long_variable_name*A_very_long_variable_name_1, "A_very_long_variable_name_1,A_very_long_variable_name_2,Yet_a_third_very_long_variable_name") \
+/* 334*/ o(FTTF2,t99"50"         ,            -10,10,1,(x<y | y<x) + 2*(x<y & y<x) + 4*(x<=y & y<=x) + 8*(x<y & x!=y) + 16*(x<y | x!=y) + 32*(x<=y & x>=y) + 64*(x<=y | x>=y) + 128*(x!=y & x=y) + 256*(x!=y & x!=y) + 512*(x<=y & x=y), "x,y") \
+/* 335*/ o(FTTF2,t99"58"         ,            -11,11,1,(-x < 3) + (x*-1 > 5) + (x*-3 < 10) + (x*-3 < y*7) + (x*4 < y*7) + (x*6 < y*-3) + (-x < 11) + (5 < -y), "x,y") \
+/* 336*/ o(FFTF3,t99"i1"         ,              -8,7,1,1+2+3-4*5*6/3+10/2-9%2 + (x+y - 11*x + z/10 + x/(z+31)), "x,y,z") \
+/* 337*/ o(FFTF3,t99"i2"         ,              -7,7,1,if(abs(x*y) < 20 | x+y > 30 & z > 5, min(x,2*y), max(y,z*2)), "x,y,z") \
+/* 338*/ o(FFTF3,t99"i3"         ,               1,7,1,(x+y) + 2*(x-z) + 3*(x*y) + 4*(y/z) + 5*(x%z) + 6*(x<y) + 7*(x<=z) + 8*(x>2*z) + 9*(y>=3*z) + 10*(x+y!=z) + 11*(100+x) + 12*(101-y) + 13*(102*z) + 14*(103/x), "x,y,z") \
+/* 339*/ o(FTTF4,t99"unicode_varname",          -5,5,1,お+早*う-t, "t,う,お,早") \
+/* 340*/ o(FTFF2,t01"add_d"      ,            -2,2,0.5,x+y, "x,y") \
+/* 341*/ o(FTFF3,t01"addsub_d"   ,            -2,2,0.5,x+y+x+x-z+x, "x,y,z") \
+/* 342*/ o(FTFF2,t01"and_d"      ,     -1.75,1.75,0.25,x&y, "x,y") \
+/* 343*/ o(FTFF2,t01"cmpeq_d"    ,     -1.75,1.75,0.25,x=y, "x,y") \
+/* 344*/ o(FTFF2,t01"cmpge_d"    ,     -1.75,1.75,0.25,x>=y, "x,y") \
+/* 345*/ o(FTFF2,t01"cmpgt_d"    ,     -1.75,1.75,0.25,x>y, "x,y") \
+/* 346*/ o(FTFF2,t01"cmple_d"    ,     -1.75,1.75,0.25,x<=y, "x,y") \
+/* 347*/ o(FTFF2,t01"cmplt_d"    ,     -1.75,1.75,0.25,x<y, "x,y") \
+/* 348*/ o(FTFF2,t01"cmpne_d"    ,     -1.75,1.75,0.25,x!=y, "x,y") \
+/* 349*/ o(FTFF2,t01"div_d"      ,      -7.25,7.25,0.5,(x-0.25)/y, "x,y") \
+/* 350*/ o(FTFF3,t01"divmul_d"   ,      -7.25,7.25,0.5,x*y*x*x/z*(x-0.25), "x,y,z") \
+/* 351*/ o(FTFF1,t01"inv_d"      ,            -7,6,0.6,1/x, "x") \
+/* 352*/ o(FTFF2,t01"mod"        ,       -11.1,11,0.25,x%z, "x,z") \
+/* 353*/ o(FTFF2,t01"mul_d"      ,      -7.25,7.25,0.5,x*y, "x,y") \
+/* 354*/ o(FTFF1,t01"neg_d"      ,            -6,6,0.5,-x, "x") \
+/* 355*/ o(FTFF1,t01"not_d"      ,     -1.25,1.25,0.25,!x, "x") \
+/* 356*/ o(FTFF1,t01"notnot_d"   ,     -1.25,1.25,0.25,!!x, "x") \
+/* 357*/ o(FTFF2,t01"or_d"       ,     -1.75,1.75,0.25,x|y, "x,y") \
+/* 358*/ o(FTFF2,t01"sub_d"      ,            -2,2,0.5,x-y, "x,y") \
+/* 359*/ o(FTFF1,t02"abs_d"      ,          -10,10,0.5,abs(x), "x") \
+/* 360*/ o(FTFF1,t02"acos"       ,           -1,1,0.01,acos(x), "x") \
+/* 361*/ o(TTFF1,t02"acos_deg"   ,           -1,1,0.01,acos(x), "x") \
+/* 362*/ o(FTFF1,t02"acosh"      ,           1,400,0.1,acosh(x), "x") \
+/* 363*/ o(TTFF1,t02"acosh_deg"  ,           1,400,0.1,acosh(x), "x") \
+/* 364*/ o(FTFF1,t02"asin"       ,           -1,1,0.01,asin(x), "x") \
+/* 365*/ o(TTFF1,t02"asin_deg"   ,           -1,1,0.01,asin(x), "x") \
+/* 366*/ o(FTFF1,t02"asinh"      ,           -1,1,0.01,asinh(x), "x") \
+/* 367*/ o(TTFF1,t02"asinh_deg"  ,           -1,1,0.01,asinh(x), "x") \
+/* 368*/ o(FTFF1,t02"atan"       ,        -400,400,0.1,atan(x), "x") \
+/* 369*/ o(FTFF2,t02"atan2"      ,           -4,4,0.05,atan2(x,y), "x,y") \
+/* 370*/ o(TTFF2,t02"atan2_deg"  ,           -4,4,0.05,atan2(x,y), "x,y") \
+/* 371*/ o(TTFF1,t02"atan_deg"   ,        -400,400,0.1,atan(x), "x") \
+/* 372*/ o(FTFF1,t02"atanh"      ,     -0.99,0.99,0.01,atanh(x), "x") \
+/* 373*/ o(FTFF1,t02"cbrt"       ,   -50000,50000,1000,cbrt(x), "x") \
+/* 374*/ o(FTFF1,t02"ceil"       ,         -10,10,0.25,ceil(x), "x") \
+/* 375*/ o(FTFF1,t02"cos"        ,          -40,40,0.5,cos(x), "x") \
+/* 376*/ o(TTFF1,t02"cos_deg"    ,          -400,400,5,cos(x), "x") \
+/* 377*/ o(FTFF1,t02"cosh"       ,         -40,40,0.25,cosh(x), "x") \
+/* 378*/ o(TTFF1,t02"cosh_deg"   ,         -40,40,0.25,cosh(x), "x") \
+/* 379*/ o(FTFF4,t02"d2r"        ,            -1,1,0.5,K:=value()*18;x*(pi/K) + y/K*pi + z/(K/pi) + w*pi/K, "w,x,y,z") \
+/* 380*/ o(FTFF1,t02"exp"        ,         -90,90,0.25,exp(x), "x") \
+/* 381*/ o(FTFF1,t02"exp2"       ,         -90,90,0.01,exp2(x), "x") \
+/* 382*/ o(FTFF1,t02"floor"      ,         -10,10,0.25,floor(x), "x") \
+/* 383*/ o(FTFF2,t02"hypot"      ,           -4,4,0.05,hypot(x,y), "x,y") \
+/* 384*/ o(FTFF3,t02"if_d"       ,     -1.25,1.25,0.25,if(x,y,z), "x,y,z") \
+/* 385*/ o(FTFF1,t02"int"        ,     -4000,4000,0.25,int(x), "x") \
+/* 386*/ o(FTFF1,t02"log"        ,        1e-6,4000,10,log(x), "x") \
+/* 387*/ o(FTFF1,t02"log2"       ,       1e-6,4000,0.1,log2(x), "x") \
+/* 388*/ o(FTFF1,t02"log10"      ,       1e-6,4000,0.1,log10(x), "x") \
+/* 389*/ o(FTFF1,t02"negativeroots3",            0,1,1,(-125)^(1/3)+x, "x") \
+/* 390*/ o(FTFF1,t02"negativeroots5",            0,1,1,(-97.65625)^(1/5)+x, "x") \
+/* 391*/ o(FTFF1,t02"negativeroots7",            0,1,1,((-pi)^7)^(1/7)+x, "x") \
+/* 392*/ o(FTFF1,t02"negativeroots31",           0,1,1,(-2147483648)^(1/31)+x, "x") \
+/* 393*/ o(FTFF2,t02"pow_neg"    ,              1,20,1,pow(-x*0.25,y), "x,y") \
+/* 394*/ o(FTFF2,t02"pow_pos"    ,         0.01,4,0.05,pow(x,y), "x,y") \
+/* 395*/ o(FTFF4,t02"r2d"        ,            -1,1,0.5,K:=value()*18;x*(K/pi) + y/pi*K + z/(pi/K) + w*K/pi, "w,x,y,z") \
+/* 396*/ o(FTFF1,t02"sin"        ,          -40,40,0.5,sin(x), "x") \
+/* 397*/ o(TTFF1,t02"sin_deg"    ,          -400,400,5,sin(x), "x") \
+/* 398*/ o(FTFF1,t02"sinh"       ,         -40,40,0.25,sinh(x), "x") \
+/* 399*/ o(TTFF1,t02"sinh_deg"   ,         -40,40,0.25,sinh(x), "x") \
+/* 400*/ o(FTFF1,t02"sqrt"       ,       0,100000,1000,sqrt(x), "x") \
+/* 401*/ o(FTFF1,t02"tan"        ,       -1.3,1.3,0.05,tan(x), "x") \
+/* 402*/ o(TTFF1,t02"tan_deg"    ,         -89,89,0.25,tan(x), "x") \
+/* 403*/ o(FTFF1,t02"tanh"       ,         -40,40,0.25,tanh(x), "x") \
+/* 404*/ o(TTFF1,t02"tanh_deg"   ,         -40,40,0.25,tanh(x), "x") \
+/* 405*/ o(FTFF1,t02"trunc"      ,       -400,400,0.25,trunc(x), "x") \
+/* 406*/ o(FTFF1,t02"trunc_d"    ,      -4000,4000,0.1,trunc(x), "x") \
+/* 407*/ o(FTFF4,t02"ufunc0"     ,              -2,2,1,value() + w*pvalue() + sqr(x) + 8*sub(x,y) + 77*psqr(z) + 30*psub(x,y), "w,x,y,z") \
+/* 408*/ o(FTFF4,t02"ufunc1"     ,              -2,2,1,value() + w*pvalue() + sqr(x) + 8*sub(x,y) + 77*psqr(z) + 30*psub(x,y), "w,x,y,z") \
+/* 409*/ o(FTFF1,t03"e_d"        ,               0,1,1,x*0+ naturalnumber, "x") \
+/* 410*/ o(FTFF1,t03"l10_d"      ,               0,1,1,x*0+ logten, "x") \
+/* 411*/ o(FTFF1,t03"pi_d"       ,               0,1,1,x*0+ pi, "x") \
+/* 412*/ o(FTFF1,t10"abscos"     ,       -0.7,0.7,0.28,cos(abs(x)), "x") \
+/* 413*/ o(FTFF1,t10"abscosh"    ,       -0.7,0.7,0.28,cosh(abs(x)), "x") \
+/* 414*/ o(FTFF1,t10"absevenconstpow",  0.001,0.9,0.01,abs(x) ^ 1506, "x") \
+/* 415*/ o(FTFF2,t10"absmulevenconstpow", 0.001,0.9,0.01,(abs(x)*y) ^ 1506, "x,y") \
+/* 416*/ o(FTFF1,t10"absneverneg",           -1,1,0.25,abs(acos(x)), "x") \
+/* 417*/ o(FTFF1,t10"absnot2"    ,           -1,1,0.25,!acos(x), "x") \
+/* 418*/ o(FTFF2,t10"absnot3"    ,           -1,1,0.25,!(!(x&y)), "x,y") \
+/* 419*/ o(FTFF1,t10"absnot4"    ,           -1,1,0.25,!(!acos(x)), "x") \
+/* 420*/ o(FTFF1,t10"absyxpow_neg",         -10,10,0.1,(x^-4)^1.5, "x") \
+/* 421*/ o(FTFF1,t10"absyxpow_pos",         -10,10,0.1,(x^4)^1.5, "x") \
+/* 422*/ o(FTFF1,t10"acos"       ,               0,1,1,acos(0.7)+x, "x") \
+/* 423*/ o(TTFF1,t10"acos_deg"   ,               0,1,1,acos(0.7)+x, "x") \
+/* 424*/ o(FTFF1,t10"acosh"      ,               0,1,1,acosh(1.1)+x, "x") \
+/* 425*/ o(TTFF1,t10"acosh_deg"  ,               0,1,1,acosh(1.1)+x, "x") \
+/* 426*/ o(FTFF1,t10"acoshcosh"  ,             1,3,0.1,cosh(acosh(x)), "x") \
+/* 427*/ o(FTFF1,t10"acoshsinh"  ,        1.7,3.7,0.28,sinh(acosh(x)), "x") \
+/* 428*/ o(FTFF1,t10"addexp"     ,           -3,-3,0.7,exp(x+4), "x") \
+/* 429*/ o(FTFF1,t10"addexp2"    ,           -3,-3,0.7,exp2(x+4), "x") \
+/* 430*/ o(FTFF1,t10"asin"       ,               0,1,1,asin(0.7)+x, "x") \
+/* 431*/ o(TTFF1,t10"asin_deg"   ,               0,1,1,asin(0.7)+x, "x") \
+/* 432*/ o(FTFF1,t10"asinh"      ,               0,1,1,asinh(1.1)+x, "x") \
+/* 433*/ o(TTFF1,t10"asinh_deg"  ,               0,1,1,asinh(1.1)+x, "x") \
+/* 434*/ o(FTFF1,t10"asinhcosh"  ,       -0.7,0.7,0.28,cosh(asinh(x)), "x") \
+/* 435*/ o(FTFF1,t10"asinhsinh"  ,            -3,3,0.1,sinh(asinh(x)), "x") \
+/* 436*/ o(FTFF1,t10"atan"       ,               0,1,1,atan(1.1)+x, "x") \
+/* 437*/ o(FTFF1,t10"atan2"      ,               0,1,1,atan2(5,4)+x, "x") \
+/* 438*/ o(TTFF1,t10"atan2_deg"  ,               0,1,1,atan2(5,4)+x, "x") \
+/* 439*/ o(FTFF2,t10"atan2tan"   ,           -3,3,0.11,tan(atan2(x,y)), "x,y") \
+/* 440*/ o(TTFF1,t10"atan_deg"   ,               0,1,1,atan(1.1)+x, "x") \
+/* 441*/ o(FTFF1,t10"atanh"      ,               0,1,1,atanh(0.7)+x, "x") \
+/* 442*/ o(FTFF1,t10"cbrt"       ,               0,1,1,cbrt(1.1)+x, "x") \
+/* 443*/ o(FTFF1,t10"ceil"       ,               0,1,1,ceil(1.1)+x, "x") \
+/* 444*/ o(FTFF1,t10"ceilneg"    ,            -1,1,0.5,ceil(-x), "x") \
+/* 445*/ o(FTFF1,t10"cmp/acos"   ,           -1,1,0.25,1*(acos(x)=acos(0.75)) + 2*(acos(x)<acos(0.75)) + 4*(acos(x)<=acos(0.75)) + 8*(acos(x)>acos(0.75)) + 16*(acos(x)>=acos(0.75)) + 32*(acos(x)!=acos(0.75)), "x") \
+/* 446*/ o(FTFF1,t10"cmp/acos_outrange",     -1,1,0.25,1*(acos(x)=2) + 2*(acos(x)<2) + 4*(acos(x)<=2) + 8*(acos(x)>2) + 16*(acos(x)>=2) + 32*(acos(x)!=2), "x") \
+/* 447*/ o(FTFF1,t10"cmp/asin"   ,           -1,1,0.25,1*(asin(x)=asin(0.75)) + 2*(asin(x)<asin(0.75)) + 4*(asin(x)<=asin(0.75)) + 8*(asin(x)>asin(0.75)) + 16*(asin(x)>=asin(0.75)) + 32*(asin(x)!=asin(0.75)), "x") \
+/* 448*/ o(FTFF1,t10"cmp/asin_outrange",     -1,1,0.25,1*(asin(x)=2) + 2*(asin(x)<2) + 4*(asin(x)<=2) + 8*(asin(x)>2) + 16*(asin(x)>=2) + 32*(asin(x)!=2), "x") \
+/* 449*/ o(FTFF1,t10"cmp/atan"   ,            -3,3,0.5,1*(atan(x)=atan(2)) + 2*(atan(x)<atan(2)) + 4*(atan(x)<=atan(2)) + 8*(atan(x)>atan(2)) + 16*(atan(x)>=atan(2)) + 32*(atan(x)!=atan(2)), "x") \
+/* 450*/ o(FTFF1,t10"cmp/exp"    ,            -3,3,0.5,1*(exp(x)=exp(2)) + 2*(exp(x)<exp(2)) + 4*(exp(x)<=exp(2)) + 8*(exp(x)>exp(2)) + 16*(exp(x)>=exp(2)) + 32*(exp(x)!=exp(2)), "x") \
+/* 451*/ o(FTFF1,t10"cmp/exp2"   ,            -3,3,0.5,1*(exp2(x)=exp2(2)) + 2*(exp2(x)<exp2(2)) + 4*(exp2(x)<=exp2(2)) + 8*(exp2(x)>exp2(2)) + 16*(exp2(x)>=exp2(2)) + 32*(exp2(x)!=exp2(2)), "x") \
+/* 452*/ o(FTFF1,t10"cmp/exp2_neg",           -3,3,0.5,1*(exp2(x)=-4) + 2*(exp2(x)<-4) + 4*(exp2(x)<=-4) + 8*(exp2(x)>-4) + 16*(exp2(x)>=-4) + 32*(exp2(x)!=-4), "x") \
+/* 453*/ o(FTFF1,t10"cmp/exp_neg",            -3,3,0.5,1*(exp(x)=-4) + 2*(exp(x)<-4) + 4*(exp(x)<=-4) + 8*(exp(x)>-4) + 16*(exp(x)>=-4) + 32*(exp(x)!=-4), "x") \
+/* 454*/ o(FTFF1,t10"cmp/log2_nn",           0.5,3,0.5,1*(log2(x)=-2) + 2*(log2(x)<-2) + 4*(log2(x)<=-2) + 8*(log2(x)>-2) + 16*(log2(x)>=-2) + 32*(log2(x)!=-2), "x") \
+/* 455*/ o(FTFF1,t10"cmp/log2_np",           0.5,3,0.5,1*(log2(x)=log2(2)) + 2*(log2(x)<log2(2)) + 4*(log2(x)<=log2(2)) + 8*(log2(x)>log2(2)) + 16*(log2(x)>=log2(2)) + 32*(log2(x)!=log2(2)), "x") \
+/* 456*/ o(FTFF1,t10"cmp/log2_pn",            -3,3,0.5,1*(log2(abs(x))=-2) + 2*(log2(abs(x))<-2) + 4*(log2(abs(x))<=-2) + 8*(log2(abs(x))>-2) + 16*(log2(abs(x))>=-2) + 32*(log2(abs(x))!=-2), "x") \
+/* 457*/ o(FTFF1,t10"cmp/log2_pp",            -3,3,0.5,1*(log2(abs(x))=log2(2)) + 2*(log2(abs(x))<log2(2)) + 4*(log2(abs(x))<=log2(2)) + 8*(log2(abs(x))>log2(2)) + 16*(log2(abs(x))>=log2(2)) + 32*(log2(abs(x))!=log2(2)), "x") \
+/* 458*/ o(FTFF1,t10"cmp/log10_nn",          0.5,3,0.5,1*(log10(x)=-2) + 2*(log10(x)<-2) + 4*(log10(x)<=-2) + 8*(log10(x)>-2) + 16*(log10(x)>=-2) + 32*(log10(x)!=-2), "x") \
+/* 459*/ o(FTFF1,t10"cmp/log10_np",          0.5,3,0.5,1*(log10(x)=log10(2)) + 2*(log10(x)<log10(2)) + 4*(log10(x)<=log10(2)) + 8*(log10(x)>log10(2)) + 16*(log10(x)>=log10(2)) + 32*(log10(x)!=log10(2)), "x") \
+/* 460*/ o(FTFF1,t10"cmp/log10_pn",           -3,3,0.5,1*(log10(abs(x))=-2) + 2*(log10(abs(x))<-2) + 4*(log10(abs(x))<=-2) + 8*(log10(abs(x))>-2) + 16*(log10(abs(x))>=-2) + 32*(log10(abs(x))!=-2), "x") \
+/* 461*/ o(FTFF1,t10"cmp/log10_pp",           -3,3,0.5,1*(log10(abs(x))=log10(1)) + 2*(log10(abs(x))<log10(1)) + 4*(log10(abs(x))<=log10(1)) + 8*(log10(abs(x))>log10(1)) + 16*(log10(abs(x))>=log10(1)) + 32*(log10(abs(x))!=log10(1)), "x") \
+/* 462*/ o(FTFF1,t10"cmp/log_nn" ,           0.5,3,0.5,1*(log(x)=-2) + 2*(log(x)<-2) + 4*(log(x)<=-2) + 8*(log(x)>-2) + 16*(log(x)>=-2) + 32*(log(x)!=-2), "x") \
+/* 463*/ o(FTFF1,t10"cmp/log_np" ,           0.5,3,0.5,1*(log(x)=log(2)) + 2*(log(x)<log(2)) + 4*(log(x)<=log(2)) + 8*(log(x)>log(2)) + 16*(log(x)>=log(2)) + 32*(log(x)!=log(2)), "x") \
+/* 464*/ o(FTFF1,t10"cmp/log_pn" ,            -3,3,0.5,1*(log(abs(x))=-2) + 2*(log(abs(x))<-2) + 4*(log(abs(x))<=-2) + 8*(log(abs(x))>-2) + 16*(log(abs(x))>=-2) + 32*(log(abs(x))!=-2), "x") \
+/* 465*/ o(FTFF1,t10"cmp/log_pp" ,            -3,3,0.5,1*(log(abs(x))=log(2)) + 2*(log(abs(x))<log(2)) + 4*(log(abs(x))<=log(2)) + 8*(log(abs(x))>log(2)) + 16*(log(abs(x))>=log(2)) + 32*(log(abs(x))!=log(2)), "x") \
+/* 466*/ o(FTFF1,t10"cmp/powx_n_n",           -36,36,1,1*(((-2.051)^x)=((-1.061)^x)) +2*(((-2.051)^x)<((-1.061)^x)) +4*(((-2.051)^x)<=((-1.061)^x)) +8*(((-2.051)^x)>((-1.061)^x)) +16*(((-2.051)^x)>=((-1.061)^x)) +32*(((-2.051)^x)!=((-1.061)^x)), "x") \
+/* 467*/ o(FTFF1,t10"cmp/powx_n_p",           -36,36,1,1*(((-2.051)^x)=(1.061^(x/3))) +2*(((-2.051)^x)<(1.061^(x/3))) +4*(((-2.051)^x)<=(1.061^(x/3))) +8*(((-2.051)^x)>(1.061^(x/3))) +16*(((-2.051)^x)>=(1.061^(x/3))) +32*(((-2.051)^x)!=(1.061^(x/3))), "x") \
+/* 468*/ o(FTFF1,t10"cmp/powx_nn",              -4,4,1,1*(((-2.051)^x)=-4) +2*(((-2.051)^x)<-4) +4*(((-2.051)^x)<=-4) +8*(((-2.051)^x)>-4) +16*(((-2.051)^x)>=-4) +32*(((-2.051)^x)!=-4), "x") \
+/* 469*/ o(FTFF1,t10"cmp/powx_np",              -4,4,1,1*(((-2.051)^x)=4) +2*(((-2.051)^x)<4) +4*(((-2.051)^x)<=4) +8*(((-2.051)^x)>4) +16*(((-2.051)^x)>=4) +32*(((-2.051)^x)!=4), "x") \
+/* 470*/ o(FTFF1,t10"cmp/powx_p_n",           -36,36,1,1*((2.051^(x/3))=((-1.061)^x)) +2*((2.051^(x/3))<((-1.061)^x)) +4*((2.051^(x/3))<=((-1.061)^x)) +8*((2.051^(x/3))>((-1.061)^x)) +16*((2.051^(x/3))>=((-1.061)^x)) +32*((2.051^(x/3))!=((-1.061)^x)), "x") \
+/* 471*/ o(FTFF1,t10"cmp/powx_p_p",           -36,36,1,1*((2.051^(x/3))=(1.061^(x/3))) +2*((2.051^(x/3))<(1.061^(x/3))) +4*((2.051^(x/3))<=(1.061^(x/3))) +8*((2.051^(x/3))>(1.061^(x/3))) +16*((2.051^(x/3))>=(1.061^(x/3))) +32*((2.051^(x/3))!=(1.061^(x/3))), "x") \
+/* 472*/ o(FTFF1,t10"cmp/powx_pn",              -4,4,1,1*((2.051^x)=-4) +2*((2.051^x)<-4) +4*((2.051^x)<=-4) +8*((2.051^x)>-4) +16*((2.051^x)>=-4) +32*((2.051^x)!=-4), "x") \
+/* 473*/ o(FTFF1,t10"cmp/powx_pp",              -4,4,1,1*((2.051^x)=4) +2*((2.051^x)<4) +4*((2.051^x)<=4) +8*((2.051^x)>4) +16*((2.051^x)>=4) +32*((2.051^x)!=4), "x") \
+/* 474*/ o(FTFF1,t10"cmp/powy_n_n",        0.25,3,0.25,1*((x^-5.1)=(x^-6.1)) +2*((x^-5.1)<(x^-6.1)) +4*((x^-5.1)<=(x^-6.1)) +8*((x^-5.1)>(x^-6.1)) +16*((x^-5.1)>=(x^-6.1)) +32*((x^-5.1)!=(x^-6.1)), "x") \
+/* 475*/ o(FTFF1,t10"cmp/powy_n_p",        0.25,3,0.25,1*((x^-5.1)=(x^6.1)) +2*((x^-5.1)<(x^6.1)) +4*((x^-5.1)<=(x^6.1)) +8*((x^-5.1)>(x^6.1)) +16*((x^-5.1)>=(x^6.1)) +32*((x^-5.1)!=(x^6.1)), "x") \
+/* 476*/ o(FTFF1,t10"cmp/powy_nn",         0.25,3,0.25,1*((x^-5.1)=-4) +2*((x^-5.1)<-4) +4*((x^-5.1)<=-4) +8*((x^-5.1)>-4) +16*((x^-5.1)>=-4) +32*((x^-5.1)!=-4), "x") \
+/* 477*/ o(FTFF1,t10"cmp/powy_np",         0.25,3,0.25,1*((x^-5.1)=4) +2*((x^-5.1)<4) +4*((x^-5.1)<=4) +8*((x^-5.1)>4) +16*((x^-5.1)>=4) +32*((x^-5.1)!=4), "x") \
+/* 478*/ o(FTFF1,t10"cmp/powy_p_n",        0.25,3,0.25,1*((x^5.1)=(x^-6.1)) +2*((x^5.1)<(x^-6.1)) +4*((x^5.1)<=(x^-6.1)) +8*((x^5.1)>(x^-6.1)) +16*((x^5.1)>=(x^-6.1)) +32*((x^5.1)!=(x^-6.1)), "x") \
+/* 479*/ o(FTFF1,t10"cmp/powy_p_p",        0.25,3,0.25,1*((x^5.1)=(x^6.1)) +2*((x^5.1)<(x^6.1)) +4*((x^5.1)<=(x^6.1)) +8*((x^5.1)>(x^6.1)) +16*((x^5.1)>=(x^6.1)) +32*((x^5.1)!=(x^6.1)), "x") \
+/* 480*/ o(FTFF1,t10"cmp/powy_pn",         0.25,3,0.25,1*((x^5.1)=-4) +2*((x^5.1)<-4) +4*((x^5.1)<=-4) +8*((x^5.1)>-4) +16*((x^5.1)>=-4) +32*((x^5.1)!=-4), "x") \
+/* 481*/ o(FTFF1,t10"cmp/powy_pp",         0.25,3,0.25,1*((x^5.1)=4) +2*((x^5.1)<4) +4*((x^5.1)<=4) +8*((x^5.1)>4) +16*((x^5.1)>=4) +32*((x^5.1)!=4), "x") \
+/* 482*/ o(FTFF1,t10"cmp/sinh"   ,            -3,3,0.5,1*(sinh(x)=sinh(2)) + 2*(sinh(x)<sinh(2)) + 4*(sinh(x)<=sinh(2)) + 8*(sinh(x)>sinh(2)) + 16*(sinh(x)>=sinh(2)) + 32*(sinh(x)!=sinh(2)), "x") \
+/* 483*/ o(FTFF1,t10"cmp/tanh"   ,           -4,4,0.25,1*(tanh(x)=tanh(0.75)) + 2*(tanh(x)<tanh(0.75)) + 4*(tanh(x)<=tanh(0.75)) + 8*(tanh(x)>tanh(0.75)) + 16*(tanh(x)>=tanh(0.75)) + 32*(tanh(x)!=tanh(0.75)), "x") \
+/* 484*/ o(FTFF1,t10"cmp/tanh_outrange",     -4,4,0.25,1*(tanh(x)=2) + 2*(tanh(x)<2) + 4*(tanh(x)<=2) + 8*(tanh(x)>2) + 16*(tanh(x)>=2) + 32*(tanh(x)!=2), "x") \
+/* 485*/ o(FTFF1,t10"cos"        ,               0,1,1,cos(1.1)+x, "x") \
+/* 486*/ o(TTFF1,t10"cos_deg"    ,               0,1,1,cos(1.1)+x, "x") \
+/* 487*/ o(FTFF1,t10"cosh"       ,               0,1,1,cosh(1.1)+x, "x") \
+/* 488*/ o(TTFF1,t10"cosh_deg"   ,               0,1,1,cosh(1.1)+x, "x") \
+/* 489*/ o(FTFF2,t10"deg"        ,          -10,10,0.8,(180/pi)*y + x*(180/pi) + (y*(180/pi))*4, "x,y") \
+/* 490*/ o(TTFF1,t10"degxmul"    ,            -1,1,0.5,acos(x)*2, "x") \
+/* 491*/ o(FTFF1,t10"dupaddmulh" ,              -3,3,1,(x+x)*0.5, "x") \
+/* 492*/ o(FTFF2,t10"dupaddmulmul7",            -3,3,1,y*(x+x)*7, "x,y") \
+/* 493*/ o(FTFF2,t10"dupaddmulmulh",            -3,3,1,y*(x+x)*0.5, "x,y") \
+/* 494*/ o(FTFF1,t10"dupxpowmul" ,            -10,10,1,x*(x^3), "x") \
+/* 495*/ o(FTFF1,t10"exp"        ,               0,1,1,exp(1.1)+x, "x") \
+/* 496*/ o(FTFF1,t10"exp2"       ,               0,1,1,exp2(1.1)+x, "x") \
+/* 497*/ o(FTFF2,t10"exp2div"    ,              -3,3,2,x/exp2(y), "x,y") \
+/* 498*/ o(FTFF1,t10"exp2log2"   ,            -3,3,0.1,log2(exp2(x)), "x") \
+/* 499*/ o(FTFF1,t10"exp2xpow"   ,         -.1,.1,0.01,exp2(x)^1506, "x") \
+/* 500*/ o(FTFF2,t10"expdiv"     ,              -3,3,2,x/exp(y), "x,y") \
+/* 501*/ o(FTFF1,t10"explog"     ,            -3,3,0.1,log(exp(x)), "x") \
+/* 502*/ o(FTFF1,t10"explog2"    ,            -3,3,0.1,log2(exp(x)), "x") \
+/* 503*/ o(FTFF1,t10"explog10"   ,            -3,3,0.1,log10(exp(x)), "x") \
+/* 504*/ o(FTFF1,t10"expxpow"    ,         -.1,.1,0.01,exp(x)^1506, "x") \
+/* 505*/ o(FTFF1,t10"floor"      ,               0,1,1,floor(1.1)+x, "x") \
+/* 506*/ o(FTFF1,t10"floorneg"   ,            -1,1,0.5,floor(-x), "x") \
+/* 507*/ o(FTFF1,t10"ge0_neg"    ,           -1,1,0.25,(sin(x) >= 0) + 2*(0 <= sin(x)) + 4*(sin(x) <= 0) + 8*(0 >= sin(x)), "x") \
+/* 508*/ o(FTFF1,t10"ge0_pos"    ,           -1,1,0.25,(acos(x) >= 0) + 2*(0 <= acos(x)) + 4*(acos(x) <= 0) + 8*(0 >= acos(x)), "x") \
+/* 509*/ o(FTFF1,t10"ge1_neg"    ,           -1,1,0.25,(sin(x) >= 1) + 2*(1 <= sin(x)) + 4*(sin(x) <= 1) + 8*(1 >= sin(x)), "x") \
+/* 510*/ o(FTFF1,t10"ge1_pos"    ,           -1,1,0.25,(acos(x) >= 1) + 2*(1 <= acos(x)) + 4*(acos(x) <= 1) + 8*(1 >= acos(x)), "x") \
+/* 511*/ o(FTFF1,t10"gehalf"     ,           -1,1,0.25,x>=0.5, "x") \
+/* 512*/ o(FTFF1,t10"gt0_neg"    ,           -1,1,0.25,(sin(x) > 0) + 2*(0 < sin(x)) + 4*(sin(x) < 0) + 8*(0 > sin(x)), "x") \
+/* 513*/ o(FTFF1,t10"gt0_pos"    ,           -1,1,0.25,(acos(x) > 0) + 2*(0 < acos(x)) + 4*(acos(x) < 0) + 8*(0 > acos(x)), "x") \
+/* 514*/ o(FTFF1,t10"gt1_neg"    ,           -1,1,0.25,(sin(x) > 1) + 2*(1 < sin(x)) + 4*(sin(x) < 1) + 8*(1 > sin(x)), "x") \
+/* 515*/ o(FTFF1,t10"gt1_pos"    ,           -1,1,0.25,(acos(x) > 1) + 2*(1 < acos(x)) + 4*(acos(x) < 1) + 8*(1 > acos(x)), "x") \
+/* 516*/ o(FTFF1,t10"gtminushalf",           -1,1,0.25,x>-0.5, "x") \
+/* 517*/ o(FTFF1,t10"hypot"      ,               0,1,1,hypot(5,4)+x, "x") \
+/* 518*/ o(FTFF1,t10"int"        ,       -1.5,1.5,0.25,x+sub(sub(sub(sub(sub(int(1.1), int(1.6)), int(1.5)), int(-1.1)), int(-1.6)), int(-1.5)), "x") \
+/* 519*/ o(FTFF1,t10"intceil"    ,            -1,1,0.5,ceil(x>4), "x") \
+/* 520*/ o(FTFF1,t10"intfloor"   ,            -1,1,0.5,floor(x>4), "x") \
+/* 521*/ o(FTFF1,t10"intint"     ,            -1,1,0.5,int(x>4), "x") \
+/* 522*/ o(FTFF1,t10"inttrunc"   ,            -1,1,0.5,trunc(x>4), "x") \
+/* 523*/ o(FTFF2,t10"invdiv"     ,              -3,3,2,y/(1/x), "x,y") \
+/* 524*/ o(FTFF1,t10"invinv"     ,              -3,3,2,1/(1/x), "x") \
+/* 525*/ o(FTFF1,t10"leminushalf",           -1,1,0.25,x<=-0.5, "x") \
+/* 526*/ o(FTFF1,t10"log"        ,               0,1,1,log(1.1)+x, "x") \
+/* 527*/ o(FTFF1,t10"log2"       ,               0,1,1,log2(1.1)+x, "x") \
+/* 528*/ o(FTFF1,t10"log2exp1"   ,           0.5,3,0.5,exp(log2(x)), "x") \
+/* 529*/ o(FTFF1,t10"log2exp2"   ,        -1,0.75,0.25,exp2(log2(acos(x))), "x") \
+/* 530*/ o(FTFF1,t10"log10"      ,               0,1,1,log10(1.1)+x, "x") \
+/* 531*/ o(FTFF1,t10"logexp1"    ,           0.5,3,0.5,exp(log(x)), "x") \
+/* 532*/ o(FTFF1,t10"logexp2"    ,        -1,0.75,0.25,exp(log(acos(x))), "x") \
+/* 533*/ o(FTFF1,t10"logmul"     ,           -3,3,0.41,log(1.1^x*4.1), "x") \
+/* 534*/ o(FTFF1,t10"logmul2"    ,           -3,3,0.41,log2(1.1^x*4.1), "x") \
+/* 535*/ o(FTFF1,t10"logmul10"   ,           -3,3,0.41,log10(1.1^x*4.1), "x") \
+/* 536*/ o(FTFF1,t10"lthalf"     ,           -1,1,0.25,x<0.5, "x") \
+/* 537*/ o(FTFF1,t10"mul1b"      ,               0,1,1,((x*0.2)*5)+x, "x") \
+/* 538*/ o(FTFF2,t10"mul_zero"   ,          0.1,10,0.1,(x*y+1)+(sin(x)+sin(y))*log(x)*y*x*0, "x,y") \
+/* 539*/ o(FTFF1,t10"mulminus1"  ,               0,1,1,x*-1, "x") \
+/* 540*/ o(FTFF1,t10"neg"        ,               0,1,1,((-((5))))+x, "x") \
+/* 541*/ o(FTFF1,t10"negceil"    ,            -1,1,0.5,-ceil(x), "x") \
+/* 542*/ o(FTFF1,t10"negcos"     ,       -0.7,0.7,0.28,cos(-x), "x") \
+/* 543*/ o(FTFF1,t10"negcosh"    ,       -0.7,0.7,0.28,cosh(-x), "x") \
+/* 544*/ o(FTFF1,t10"negfloor"   ,            -1,1,0.5,-floor(x), "x") \
+/* 545*/ o(FTFF1,t10"negsin"     ,       -0.7,0.7,0.28,sin(-x), "x") \
+/* 546*/ o(FTFF1,t10"negsinh"    ,       -0.7,0.7,0.28,sinh(-x), "x") \
+/* 547*/ o(FTFF1,t10"negtan"     ,       -0.7,0.7,0.28,tan(-x), "x") \
+/* 548*/ o(FTFF1,t10"negtanh"    ,       -0.7,0.7,0.28,tanh(-x), "x") \
+/* 549*/ o(FTFF1,t10"pow_neg"    ,               0,1,1,pow(-0.25,4)+x, "x") \
+/* 550*/ o(FTFF1,t10"pow_pos"    ,               0,1,1,pow(1.1, 7.1)+x, "x") \
+/* 551*/ o(FTFF2,t10"powdiv"     ,              -3,3,2,x/pow(x,y), "x,y") \
+/* 552*/ o(FTFF1,t10"powhalf"    ,             0,4,0.1,pow(x,0.5), "x") \
+/* 553*/ o(FTFF2,t10"powinv"     ,              -3,3,2,1/pow(x,y), "x,y") \
+/* 554*/ o(FTFF1,t10"powminushalf",        0.25,4,0.25,pow(x,-0.5), "x") \
+/* 555*/ o(FTFF1,t10"powminusone",               1,5,1,pow(x,-1.0), "x") \
+/* 556*/ o(FTFF1,t10"powminusthird",       0.25,4,0.25,pow(x,(-1.0/3.0)), "x") \
+/* 557*/ o(FTFF1,t10"powthird"   ,             0,4,0.1,pow(x,(1.0/3.0)), "x") \
+/* 558*/ o(FTFF1,t10"powxpow"    ,         -.1,.1,0.01,(x^1.7)^1506, "x") \
+/* 559*/ o(FTFF2,t10"rad"        ,          -10,10,0.8,(pi/180)*y + x*(pi/180) + (x*(pi/180))*4, "x,y") \
+/* 560*/ o(FTFF1,t10"radxmul"    ,            -2,2,0.8,cos((x*pi/180)*4), "x") \
+/* 561*/ o(FTFF1,t10"rsqrt0"     ,        0.01,10,0.05,1/sqrt(x), "x") \
+/* 562*/ o(FTFF1,t10"rsqrt1"     ,        0.01,10,0.05,sqrt(1/x), "x") \
+/* 563*/ o(FTFF1,t10"rsqrt2"     ,        0.01,10,0.05,1/(1/sqrt(x)), "x") \
+/* 564*/ o(FTFF1,t10"rsqrt3"     ,        0.01,10,0.05,1/sqrt(1/x), "x") \
+/* 565*/ o(FTFF1,t10"rsqrt4"     ,        0.01,10,0.05,(1/sqrt(x))^2, "x") \
+/* 566*/ o(FTFF1,t10"rsqrt5"     ,        0.01,10,0.05,sqrt(1/(x^2)), "x") \
+/* 567*/ o(FTFF1,t10"rsqrt6"     ,        0.01,10,0.05,abs(1/x^2), "x") \
+/* 568*/ o(FTFF1,t10"sin"        ,               0,1,1,sin(1.1)+x, "x") \
+/* 569*/ o(TTFF1,t10"sin_deg"    ,               0,1,1,sin(1.1)+x, "x") \
+/* 570*/ o(FTFF1,t10"sincos_cci" ,       -0.7,0.7,0.28,cos(x) + sec(x), "x") \
+/* 571*/ o(FTFF1,t10"sincos_cic" ,       -0.7,0.7,0.28,sec(x) + cos(x), "x") \
+/* 572*/ o(FTFF1,t10"sincos_sc"  ,       -0.7,0.7,0.28,sin(x) + cos(x), "x") \
+/* 573*/ o(FTFF1,t10"sincos_sci" ,       -0.7,0.7,0.28,sin(x) + sec(x), "x") \
+/* 574*/ o(FTFF1,t10"sincos_sis" ,       -0.7,0.7,0.28,csc(x) + sin(x), "x") \
+/* 575*/ o(FTFF1,t10"sincos_ssi" ,       -0.7,0.7,0.28,sin(x) + csc(x), "x") \
+/* 576*/ o(FTFF1,t10"sincos_tan" ,       -0.7,0.7,0.28,sin(x) / cos(x), "x") \
+/* 577*/ o(FTFF1,t10"sincos_tit" ,       -0.7,0.7,0.28,cot(x) + tan(x), "x") \
+/* 578*/ o(FTFF1,t10"sincos_tti" ,       -0.7,0.7,0.28,tan(x) + cot(x), "x") \
+/* 579*/ o(FTFF1,t10"sinh"       ,               0,1,1,sinh(1.1)+x, "x") \
+/* 580*/ o(TTFF1,t10"sinh_deg"   ,               0,1,1,sinh(1.1)+x, "x") \
+/* 581*/ o(FTFF1,t10"sqrlog"     ,          -10,10,0.8,log(x^2), "x") \
+/* 582*/ o(FTFF1,t10"sqrlog2"    ,          -10,10,0.8,log2(x^2), "x") \
+/* 583*/ o(FTFF1,t10"sqrlog10"   ,          -10,10,0.8,log10(x^2), "x") \
+/* 584*/ o(FTFF1,t10"sqrsqrt"    ,            -2,2,0.5,sqrt(x^2), "x") \
+/* 585*/ o(FTFF1,t10"sqrt"       ,               0,1,1,sqrt(1.1)+x, "x") \
+/* 586*/ o(FTFF1,t10"sqrtsqr1"   ,             0,3,0.5,sqrt(x)^2, "x") \
+/* 587*/ o(FTFF1,t10"sqrtsqr2"   ,            -1,1,0.5,sqrt(acos(x))^2, "x") \
+/* 588*/ o(FTFF1,t10"sqrxpow"    ,         -.1,.1,0.01,(x^2)^2402, "x") \
+/* 589*/ o(FTFF1,t10"sqrxpow_nonint",       -10,10,0.1,(x^2)^3.5, "x") \
+/* 590*/ o(FTFF1,t10"tan"        ,               0,1,1,tan(1.1)+x, "x") \
+/* 591*/ o(TTFF1,t10"tan_deg"    ,               0,1,1,tan(1.1)+x, "x") \
+/* 592*/ o(FTFF1,t10"tanh"       ,               0,1,1,tanh(1.1)+x, "x") \
+/* 593*/ o(TTFF1,t10"tanh_deg"   ,               0,1,1,tanh(1.1)+x, "x") \
+/* 594*/ o(FTFF1,t10"trunc"      ,               0,1,1,trunc(1.1)+x, "x") \
+/* 595*/ o(TTFF1,t10"xmulrad"    ,            -2,2,0.8,cos(x*5), "x") \
+/* 596*/ o(FTFF1,t10"xmulsinhneg",       -0.7,0.7,0.28,-sinh(x*5), "x") \
+/* 597*/ o(FTFF1,t10"xmulsinneg" ,       -0.7,0.7,0.28,-sin(x*5), "x") \
+/* 598*/ o(FTFF1,t10"xmultanhneg",       -0.7,0.7,0.28,-tanh(x*5), "x") \
+/* 599*/ o(FTFF1,t10"xmultanneg" ,       -0.7,0.7,0.28,-tan(x*5), "x") \
+/* 600*/ o(FTFF1,t10"xsqryfsqrhypot",        0.5,3,0.7,sqrt(log(x)^2+log2(x)^2), "x") \
+/* 601*/ o(FTFF2,t10"xsqrysqrhypot",         0.5,3,0.7,sqrt(log(x)^2+y*y), "x,y") \
+/* 602*/ o(FTFF1,t10"xxfdup"     ,              -1,1,1,sub(sin(x),sin(x)), "x") \
+/* 603*/ o(FTFF1,t10"ypowxpow"   ,           0,10,0.01,(x^38.5)^5, "x") \
+/* 604*/ o(FTFF2,t12"a_a2_r"     ,              -3,3,2,csc(atan2(a,b)), "a,b") \
+/* 605*/ o(FTFF1,t12"a_a_"       ,              -3,3,2,csc(csc(a)), "a") \
+/* 606*/ o(FTFF1,t12"a_ac_r"     ,     -0.75,0.75,0.25,csc(acos(a)), "a") \
+/* 607*/ o(FTFF1,t12"a_ach_r"    ,           0.5,2,0.5,csc(acosh((a+0.6))), "a") \
+/* 608*/ o(FTFF1,t12"a_as_r"     ,          0.5,1,0.25,csc(asin(a)), "a") \
+/* 609*/ o(FTFF1,t12"a_ash_"     ,              -3,3,2,csc(asinh(a)), "a") \
+/* 610*/ o(FTFF1,t12"a_at_"      ,              -3,3,2,csc(atan(a)), "a") \
+/* 611*/ o(FTFF2,t12"a_atd_r"    ,              -3,3,2,csc(atan(a/b)), "a,b") \
+/* 612*/ o(FTFF1,t12"a_ath_r"    ,     0.25,0.75,0.125,csc(atanh(a)), "a") \
+/* 613*/ o(FTFF1,t12"a_atn_r"    ,              -3,3,2,csc(atan(-abs(a))), "a") \
+/* 614*/ o(FTFF1,t12"a_atp_r"    ,              -3,3,2,csc(atan(abs(a))), "a") \
+/* 615*/ o(FTFF1,t12"a_b_"       ,              -3,3,2,csc(abs(a)), "a") \
+/* 616*/ o(FTFF1,t12"a_c_"       ,            -2,2,0.5,csc(cos(a)), "a") \
+/* 617*/ o(FTFF1,t12"a_cb_r"     ,           0.5,2,0.5,csc(cbrt(a)), "a") \
+/* 618*/ o(FTFF1,t12"a_ch_"      ,            -2,2,0.5,csc(cosh(a)), "a") \
+/* 619*/ o(FTFF2,t12"a_chl_"     ,            -2,2,0.5,csc(cosh(a!=b)), "a,b") \
+/* 620*/ o(FTFF2,t12"a_cl_"      ,            -2,2,0.5,csc(cos(a!=b)), "a,b") \
+/* 621*/ o(FTFF1,t12"a_e2_"      ,            -2,2,0.5,csc(exp2(a)), "a") \
+/* 622*/ o(FTFF2,t12"a_e2l_"     ,            -2,2,0.5,csc(exp2(a!=b)), "a,b") \
+/* 623*/ o(FTFF1,t12"a_e_"       ,            -2,2,0.5,csc(sec(a)), "a") \
+/* 624*/ o(FTFF2,t12"a_el_"      ,            -2,2,0.5,csc(sec(a!=b)), "a,b") \
+/* 625*/ o(FTFF1,t12"a_ex_"      ,            -2,2,0.5,csc(exp(a)), "a") \
+/* 626*/ o(FTFF2,t12"a_exl_"     ,            -2,2,0.5,csc(exp(a!=b)), "a,b") \
+/* 627*/ o(FTFF1,t12"a_h1x_r"    ,            -2,2,0.5,csc(hypot(1,a)), "a") \
+/* 628*/ o(FTFF1,t12"a_h2x_r"    ,            -2,2,0.5,csc(hypot(2,a)), "a") \
+/* 629*/ o(FTFF2,t12"a_h_r"      ,              -3,3,2,csc(hypot(a,b)), "a,b") \
+/* 630*/ o(FTFF1,t12"a_hx1_r"    ,            -2,2,0.5,csc(hypot(a,1)), "a") \
+/* 631*/ o(FTFF1,t12"a_hx2_r"    ,            -2,2,0.5,csc(hypot(a,2)), "a") \
+/* 632*/ o(FTFF2,t12"a_ia2_r"    ,              -3,3,2,csc(1/atan2(a,b)), "a,b") \
+/* 633*/ o(FTFF2,t12"a_iatd_r"   ,              -3,3,2,csc(1/atan(a/b)), "a,b") \
+/* 634*/ o(FTFF1,t12"a_ih1x_r"   ,            -2,2,0.5,csc(1/hypot(1,a)), "a") \
+/* 635*/ o(FTFF1,t12"a_ih2x_r"   ,            -2,2,0.5,csc(1/hypot(2,a)), "a") \
+/* 636*/ o(FTFF2,t12"a_ih_r"     ,              -3,3,2,csc(1/hypot(a,b)), "a,b") \
+/* 637*/ o(FTFF1,t12"a_ihx1_r"   ,            -2,2,0.5,csc(1/hypot(a,1)), "a") \
+/* 638*/ o(FTFF1,t12"a_ihx2_r"   ,            -2,2,0.5,csc(1/hypot(a,2)), "a") \
+/* 639*/ o(FTFF1,t12"a_l2_r"     ,       0.25,3.25,0.5,csc(log2(a)), "a") \
+/* 640*/ o(FTFF1,t12"a_l_r"      ,       0.25,3.25,0.5,csc(log(a)), "a") \
+/* 641*/ o(FTFF1,t12"a_lt_r"     ,       0.25,3.25,0.5,csc(log10(a)), "a") \
+/* 642*/ o(FTFF1,t12"a_o_"       ,              -3,3,2,csc(cot(a)), "a") \
+/* 643*/ o(FTFF2,t12"a_p_"       ,           0.5,2,0.5,csc(pow(a,b)), "a,b") \
+/* 644*/ o(FTFF1,t12"a_s_"       ,              -3,3,2,csc(sin(a)), "a") \
+/* 645*/ o(FTFF1,t12"a_sh_"      ,              -3,3,2,csc(sinh(a)), "a") \
+/* 646*/ o(FTFF1,t12"a_sq_r"     ,           0.5,2,0.5,csc(sqrt(a)), "a") \
+/* 647*/ o(FTFF1,t12"a_t_"       ,              -3,3,2,csc(tan(a)), "a") \
+/* 648*/ o(FTFF1,t12"a_th_"      ,              -3,3,2,csc(tanh(a)), "a") \
+/* 649*/ o(FTFF2,t12"ac_a2_r"    ,          0.5,1,0.25,acos(atan2((a+0.4),(b+0.4))), "a,b") \
+/* 650*/ o(FTFF1,t12"ac_ac_r"  , -0.1875,0.1875,0.0625,acos(acos((a+0.8))), "a") \
+/* 651*/ o(FTFF1,t12"ac_ach_r" , -0.1875,0.1875,0.0625,acos(acosh((a+1.2))), "a") \
+/* 652*/ o(FTFF1,t12"ac_as_r"    ,     -0.75,0.75,0.25,acos(asin(a)), "a") \
+/* 653*/ o(FTFF1,t12"ac_ash_r"   ,            -1,1,0.5,acos(asinh(a)), "a") \
+/* 654*/ o(FTFF2,t12"ac_ashl_"   ,            -2,2,0.5,acos(asinh(a!=b)), "a,b") \
+/* 655*/ o(FTFF1,t12"ac_at_r"    ,            -1,1,0.5,acos(atan(a)), "a") \
+/* 656*/ o(FTFF2,t12"ac_atd_r"   ,          0.5,1,0.25,acos(atan((a+0.4)/(b+0.4))), "a,b") \
+/* 657*/ o(FTFF1,t12"ac_ath_r"   ,     -0.75,0.75,0.25,acos(atanh(a)), "a") \
+/* 658*/ o(FTFF2,t12"ac_atl_"    ,            -2,2,0.5,acos(atan(a!=b)), "a,b") \
+/* 659*/ o(FTFF1,t12"ac_atn_r"   ,            -1,1,0.5,acos(atan(-abs(a))), "a") \
+/* 660*/ o(FTFF1,t12"ac_atp_r"   ,            -1,1,0.5,acos(atan(abs(a))), "a") \
+/* 661*/ o(FTFF1,t12"ac_b_r"     ,            -1,1,0.5,acos(abs(a)), "a") \
+/* 662*/ o(FTFF1,t12"ac_c_r"     ,            -2,2,0.5,acos(cos(a)), "a") \
+/* 663*/ o(FTFF1,t12"ac_cb_r"    ,             0,1,0.5,acos(cbrt(a)), "a") \
+/* 664*/ o(FTFF2,t12"ac_cbl_r"   ,            -2,2,0.5,acos(cbrt(a!=b)), "a,b") \
+/* 665*/ o(FTFF2,t12"ac_cl_r"    ,            -2,2,0.5,acos(cos(a!=b)), "a,b") \
+/* 666*/ o(FTFF1,t12"ac_e2_r"  , -0.1875,0.1875,0.0625,acos(exp2((a+-0.2))), "a") \
+/* 667*/ o(FTFF2,t12"ac_eq_r"    ,            -2,2,0.5,acos(a=b), "a,b") \
+/* 668*/ o(FTFF1,t12"ac_ex_r"  , -0.1875,0.1875,0.0625,acos(exp((a+-0.2))), "a") \
+/* 669*/ o(FTFF2,t12"ac_h_r"     ,       -0.5,0.5,0.25,acos(hypot(a,b)), "a,b") \
+/* 670*/ o(FTFF2,t12"ac_ia2_r" , -0.1875,0.1875,0.0625,acos(1/atan2((a+-0.2),(b+-0.2))), "a,b") \
+/* 671*/ o(FTFF1,t12"ac_ih1x_r"  ,            -2,2,0.5,acos(1/hypot(1,a)), "a") \
+/* 672*/ o(FTFF1,t12"ac_ih2x_r"  ,            -2,2,0.5,acos(1/hypot(2,a)), "a") \
+/* 673*/ o(FTFF2,t12"ac_ih_r"    ,              -3,3,2,acos(1/hypot(a,b)), "a,b") \
+/* 674*/ o(FTFF1,t12"ac_ihx1_r"  ,            -2,2,0.5,acos(1/hypot(a,1)), "a") \
+/* 675*/ o(FTFF1,t12"ac_ihx2_r"  ,            -2,2,0.5,acos(1/hypot(a,2)), "a") \
+/* 676*/ o(FTFF1,t12"ac_l2_r"    ,           0.5,2,0.5,acos(log2(a)), "a") \
+/* 677*/ o(FTFF1,t12"ac_l_r"     ,           0.5,2,0.5,acos(log(a)), "a") \
+/* 678*/ o(FTFF1,t12"ac_lt_r"    ,           0.5,2,0.5,acos(log10(a)), "a") \
+/* 679*/ o(FTFF2,t12"ac_ne_r"    ,            -2,2,0.5,acos(a!=b), "a,b") \
+/* 680*/ o(FTFF1,t12"ac_o_r"     ,          0.5,1,0.25,acos(cot((a+0.4))), "a") \
+/* 681*/ o(FTFF2,t12"ac_p_r"     ,          0.5,1,0.25,acos(pow(a,b)), "a,b") \
+/* 682*/ o(FTFF1,t12"ac_s_"      ,            -2,2,0.5,acos(sin(a)), "a") \
+/* 683*/ o(FTFF1,t12"ac_sh_r"    ,     -0.75,0.75,0.25,acos(sinh(a)), "a") \
+/* 684*/ o(FTFF2,t12"ac_sl_"     ,            -2,2,0.5,acos(sin(a!=b)), "a,b") \
+/* 685*/ o(FTFF1,t12"ac_sq_r"    ,             0,1,0.5,acos(sqrt(a)), "a") \
+/* 686*/ o(FTFF2,t12"ac_sql_r"   ,            -2,2,0.5,acos(sqrt(a!=b)), "a,b") \
+/* 687*/ o(FTFF1,t12"ac_t_r"     ,     -0.75,0.75,0.25,acos(tan(a)), "a") \
+/* 688*/ o(FTFF1,t12"ac_th_r"    ,            -2,2,0.5,acos(tanh(a)), "a") \
+/* 689*/ o(FTFF2,t12"ac_thl_r"   ,            -2,2,0.5,acos(tanh(a!=b)), "a,b") \
+/* 690*/ o(FTFF1,t12"ach_a_r"    ,           0.5,2,0.5,acosh(csc(a)), "a") \
+/* 691*/ o(FTFF1,t12"ach_ac_r"   ,       -0.5,0.5,0.25,acosh(acos(a)), "a") \
+/* 692*/ o(FTFF1,t12"ach_ach_r"  ,           0.5,2,0.5,acosh(acosh((a+1.2))), "a") \
+/* 693*/ o(FTFF1,t12"ach_ash_r"  ,           0.5,2,0.5,acosh(asinh((a+0.8))), "a") \
+/* 694*/ o(FTFF1,t12"ach_at_r"   ,           0.5,2,0.5,acosh(atan((a+1.2))), "a") \
+/* 695*/ o(FTFF1,t12"ach_atp_r"  ,           0.5,2,0.5,acosh(atan(abs((a+1.2)))), "a") \
+/* 696*/ o(FTFF1,t12"ach_b_"     ,              -3,3,2,acosh(abs(a)), "a") \
+/* 697*/ o(FTFF1,t12"ach_cb_r"   ,           0.5,2,0.5,acosh(cbrt((a+0.6))), "a") \
+/* 698*/ o(FTFF1,t12"ach_ch_r"   ,            -2,2,0.5,acosh(cosh(a)), "a") \
+/* 699*/ o(FTFF2,t12"ach_chl_r"  ,            -2,2,0.5,acosh(cosh(a!=b)), "a,b") \
+/* 700*/ o(FTFF1,t12"ach_e2_r"   ,             0,2,0.5,acosh(exp2(a)), "a") \
+/* 701*/ o(FTFF2,t12"ach_e2l_r"  ,            -2,2,0.5,acosh(exp2(a!=b)), "a,b") \
+/* 702*/ o(FTFF1,t12"ach_e_r"    ,            -1,1,0.5,acosh(sec(a)), "a") \
+/* 703*/ o(FTFF2,t12"ach_el_r"   ,            -2,2,0.5,acosh(sec(a!=b)), "a,b") \
+/* 704*/ o(FTFF1,t12"ach_ex_r"   ,             0,2,0.5,acosh(exp(a)), "a") \
+/* 705*/ o(FTFF2,t12"ach_exl_r"  ,            -2,2,0.5,acosh(exp(a!=b)), "a,b") \
+/* 706*/ o(FTFF1,t12"ach_h1x_r"  ,            -2,2,0.5,acosh(hypot(1,a)), "a") \
+/* 707*/ o(FTFF1,t12"ach_h2x_r"  ,            -2,2,0.5,acosh(hypot(2,a)), "a") \
+/* 708*/ o(FTFF2,t12"ach_h_r"    ,              -3,3,2,acosh(hypot(a,b)), "a,b") \
+/* 709*/ o(FTFF1,t12"ach_hx1_r"  ,            -2,2,0.5,acosh(hypot(a,1)), "a") \
+/* 710*/ o(FTFF1,t12"ach_hx2_r"  ,            -2,2,0.5,acosh(hypot(a,2)), "a") \
+/* 711*/ o(FTFF2,t12"ach_ia2_r"  ,          0.5,1,0.25,acosh(1/atan2((a+0.4),(b+0.4))), "a,b") \
+/* 712*/ o(FTFF2,t12"ach_iatd_r" ,          0.5,1,0.25,acosh(1/atan((a+0.4)/(b+0.4))), "a,b") \
+/* 713*/ o(FTFF2,t12"ach_ih_r"   ,       -0.5,0.5,0.25,acosh(1/hypot((a+-0.2),(b+-0.2))), "a,b") \
+/* 714*/ o(FTFF1,t12"ach_l2_r"   ,           0.5,2,0.5,acosh(log2((a+1.6))), "a") \
+/* 715*/ o(FTFF1,t12"ach_l_r"    ,           0.5,2,0.5,acosh(log((a+2.4))), "a") \
+/* 716*/ o(FTFF1,t12"ach_o_r"    ,     0.25,0.75,0.125,acosh(cot(a)), "a") \
+/* 717*/ o(FTFF2,t12"ach_p_r"    ,           0.5,2,0.5,acosh(pow((a+0.6),(b+0.6))), "a,b") \
+/* 718*/ o(FTFF1,t12"ach_sh_r"   ,           0.5,2,0.5,acosh(sinh((a+0.4))), "a") \
+/* 719*/ o(FTFF1,t12"ach_sq_r"   ,           0.5,2,0.5,acosh(sqrt((a+0.6))), "a") \
+/* 720*/ o(FTFF1,t12"ach_t_r"    ,          0.5,1,0.25,acosh(tan((a+0.4))), "a") \
+/* 721*/ o(FTFF2,t12"as_a2_r"    ,          0.5,1,0.25,asin(atan2((a+0.4),(b+0.4))), "a,b") \
+/* 722*/ o(FTFF1,t12"as_ac_r"  , -0.1875,0.1875,0.0625,asin(acos((a+0.8))), "a") \
+/* 723*/ o(FTFF1,t12"as_ach_r" , -0.1875,0.1875,0.0625,asin(acosh((a+1.2))), "a") \
+/* 724*/ o(FTFF1,t12"as_as_r"    ,     -0.75,0.75,0.25,asin(asin(a)), "a") \
+/* 725*/ o(FTFF1,t12"as_ash_r"   ,            -1,1,0.5,asin(asinh(a)), "a") \
+/* 726*/ o(FTFF2,t12"as_ashl_"   ,            -2,2,0.5,asin(asinh(a!=b)), "a,b") \
+/* 727*/ o(FTFF1,t12"as_at_r"    ,            -1,1,0.5,asin(atan(a)), "a") \
+/* 728*/ o(FTFF2,t12"as_atd_r"   ,          0.5,1,0.25,asin(atan((a+0.4)/(b+0.4))), "a,b") \
+/* 729*/ o(FTFF1,t12"as_ath_r"   ,     -0.75,0.75,0.25,asin(atanh(a)), "a") \
+/* 730*/ o(FTFF2,t12"as_atl_"    ,            -2,2,0.5,asin(atan(a!=b)), "a,b") \
+/* 731*/ o(FTFF1,t12"as_atn_r"   ,            -1,1,0.5,asin(atan(-abs(a))), "a") \
+/* 732*/ o(FTFF1,t12"as_atp_r"   ,            -1,1,0.5,asin(atan(abs(a))), "a") \
+/* 733*/ o(FTFF1,t12"as_b_r"     ,            -1,1,0.5,asin(abs(a)), "a") \
+/* 734*/ o(FTFF1,t12"as_c_r"     ,            -2,2,0.5,asin(cos(a)), "a") \
+/* 735*/ o(FTFF1,t12"as_cb_r"    ,             0,1,0.5,asin(cbrt(a)), "a") \
+/* 736*/ o(FTFF2,t12"as_cbl_r"   ,            -2,2,0.5,asin(cbrt(a!=b)), "a,b") \
+/* 737*/ o(FTFF2,t12"as_cl_r"    ,            -2,2,0.5,asin(cos(a!=b)), "a,b") \
+/* 738*/ o(FTFF1,t12"as_e2_r"  , -0.1875,0.1875,0.0625,asin(exp2((a+-0.2))), "a") \
+/* 739*/ o(FTFF2,t12"as_eq_r"    ,            -2,2,0.5,asin(a=b), "a,b") \
+/* 740*/ o(FTFF1,t12"as_ex_r"  , -0.1875,0.1875,0.0625,asin(exp((a+-0.2))), "a") \
+/* 741*/ o(FTFF2,t12"as_h_r"     ,       -0.5,0.5,0.25,asin(hypot(a,b)), "a,b") \
+/* 742*/ o(FTFF2,t12"as_ia2_r" , -0.1875,0.1875,0.0625,asin(1/atan2((a+-0.2),(b+-0.2))), "a,b") \
+/* 743*/ o(FTFF1,t12"as_ih1x_r"  ,            -2,2,0.5,asin(1/hypot(1,a)), "a") \
+/* 744*/ o(FTFF1,t12"as_ih2x_r"  ,            -2,2,0.5,asin(1/hypot(2,a)), "a") \
+/* 745*/ o(FTFF2,t12"as_ih_r"    ,              -3,3,2,asin(1/hypot(a,b)), "a,b") \
+/* 746*/ o(FTFF1,t12"as_ihx1_r"  ,            -2,2,0.5,asin(1/hypot(a,1)), "a") \
+/* 747*/ o(FTFF1,t12"as_ihx2_r"  ,            -2,2,0.5,asin(1/hypot(a,2)), "a") \
+/* 748*/ o(FTFF1,t12"as_l2_r"    ,           0.5,2,0.5,asin(log2(a)), "a") \
+/* 749*/ o(FTFF1,t12"as_l_r"     ,           0.5,2,0.5,asin(log(a)), "a") \
+/* 750*/ o(FTFF1,t12"as_lt_r"    ,           0.5,2,0.5,asin(log10(a)), "a") \
+/* 751*/ o(FTFF2,t12"as_ne_r"    ,            -2,2,0.5,asin(a!=b), "a,b") \
+/* 752*/ o(FTFF1,t12"as_o_r"     ,          0.5,1,0.25,asin(cot((a+0.4))), "a") \
+/* 753*/ o(FTFF2,t12"as_p_r"     ,          0.5,1,0.25,asin(pow(a,b)), "a,b") \
+/* 754*/ o(FTFF1,t12"as_s_"      ,            -2,2,0.5,asin(sin(a)), "a") \
+/* 755*/ o(FTFF1,t12"as_sh_r"    ,     -0.75,0.75,0.25,asin(sinh(a)), "a") \
+/* 756*/ o(FTFF2,t12"as_sl_"     ,            -2,2,0.5,asin(sin(a!=b)), "a,b") \
+/* 757*/ o(FTFF1,t12"as_sq_r"    ,             0,1,0.5,asin(sqrt(a)), "a") \
+/* 758*/ o(FTFF2,t12"as_sql_r"   ,            -2,2,0.5,asin(sqrt(a!=b)), "a,b") \
+/* 759*/ o(FTFF1,t12"as_t_r"     ,     -0.75,0.75,0.25,asin(tan(a)), "a") \
+/* 760*/ o(FTFF1,t12"as_th_r"    ,            -2,2,0.5,asin(tanh(a)), "a") \
+/* 761*/ o(FTFF2,t12"as_thl_r"   ,            -2,2,0.5,asin(tanh(a!=b)), "a,b") \
+/* 762*/ o(FTFF2,t12"ash_a2_r"   ,            -2,2,0.5,asinh(atan2(a,b)), "a,b") \
+/* 763*/ o(FTFF1,t12"ash_a_"     ,              -3,3,2,asinh(csc(a)), "a") \
+/* 764*/ o(FTFF1,t12"ash_ac_r"   ,            -1,1,0.5,asinh(acos(a)), "a") \
+/* 765*/ o(FTFF1,t12"ash_ach_r"  ,           0.5,2,0.5,asinh(acosh((a+0.6))), "a") \
+/* 766*/ o(FTFF2,t12"ash_acl_r"  ,            -2,2,0.5,asinh(acos(a!=b)), "a,b") \
+/* 767*/ o(FTFF1,t12"ash_as_r"   ,            -1,1,0.5,asinh(asin(a)), "a") \
+/* 768*/ o(FTFF1,t12"ash_ash_r"  ,            -2,2,0.5,asinh(asinh(a)), "a") \
+/* 769*/ o(FTFF2,t12"ash_ashl_"  ,            -2,2,0.5,asinh(asinh(a!=b)), "a,b") \
+/* 770*/ o(FTFF2,t12"ash_asl_r"  ,            -2,2,0.5,asinh(asin(a!=b)), "a,b") \
+/* 771*/ o(FTFF1,t12"ash_at_r"   ,            -2,2,0.5,asinh(atan(a)), "a") \
+/* 772*/ o(FTFF2,t12"ash_atd_r"  ,              -3,3,2,asinh(atan(a/b)), "a,b") \
+/* 773*/ o(FTFF1,t12"ash_ath_r"  ,     -0.75,0.75,0.25,asinh(atanh(a)), "a") \
+/* 774*/ o(FTFF2,t12"ash_atl_"   ,            -2,2,0.5,asinh(atan(a!=b)), "a,b") \
+/* 775*/ o(FTFF1,t12"ash_atn_r"  ,            -2,2,0.5,asinh(atan(-abs(a))), "a") \
+/* 776*/ o(FTFF1,t12"ash_atp_r"  ,            -2,2,0.5,asinh(atan(abs(a))), "a") \
+/* 777*/ o(FTFF1,t12"ash_b_"     ,            -2,2,0.5,asinh(abs(a)), "a") \
+/* 778*/ o(FTFF1,t12"ash_c_"     ,            -2,2,0.5,asinh(cos(a)), "a") \
+/* 779*/ o(FTFF1,t12"ash_cb_r"   ,             0,2,0.5,asinh(cbrt(a)), "a") \
+/* 780*/ o(FTFF2,t12"ash_cbl_r"  ,            -2,2,0.5,asinh(cbrt(a!=b)), "a,b") \
+/* 781*/ o(FTFF1,t12"ash_ch_"    ,            -2,2,0.5,asinh(cosh(a)), "a") \
+/* 782*/ o(FTFF2,t12"ash_chl_"   ,            -2,2,0.5,asinh(cosh(a!=b)), "a,b") \
+/* 783*/ o(FTFF2,t12"ash_cl_"    ,            -2,2,0.5,asinh(cos(a!=b)), "a,b") \
+/* 784*/ o(FTFF1,t12"ash_e2_"    ,            -2,2,0.5,asinh(exp2(a)), "a") \
+/* 785*/ o(FTFF2,t12"ash_e2l_"   ,            -2,2,0.5,asinh(exp2(a!=b)), "a,b") \
+/* 786*/ o(FTFF1,t12"ash_e_"     ,            -2,2,0.5,asinh(sec(a)), "a") \
+/* 787*/ o(FTFF2,t12"ash_el_"    ,            -2,2,0.5,asinh(sec(a!=b)), "a,b") \
+/* 788*/ o(FTFF2,t12"ash_eq_"    ,            -2,2,0.5,asinh(a=b), "a,b") \
+/* 789*/ o(FTFF1,t12"ash_ex_"    ,            -2,2,0.5,asinh(exp(a)), "a") \
+/* 790*/ o(FTFF2,t12"ash_exl_"   ,            -2,2,0.5,asinh(exp(a!=b)), "a,b") \
+/* 791*/ o(FTFF1,t12"ash_h1x_r"  ,            -2,2,0.5,asinh(hypot(1,a)), "a") \
+/* 792*/ o(FTFF1,t12"ash_h2x_r"  ,            -2,2,0.5,asinh(hypot(2,a)), "a") \
+/* 793*/ o(FTFF2,t12"ash_h_r"    ,            -2,2,0.5,asinh(hypot(a,b)), "a,b") \
+/* 794*/ o(FTFF1,t12"ash_hx1_r"  ,            -2,2,0.5,asinh(hypot(a,1)), "a") \
+/* 795*/ o(FTFF1,t12"ash_hx2_r"  ,            -2,2,0.5,asinh(hypot(a,2)), "a") \
+/* 796*/ o(FTFF2,t12"ash_ia2_r"  ,              -3,3,2,asinh(1/atan2(a,b)), "a,b") \
+/* 797*/ o(FTFF2,t12"ash_iatd_r" ,              -3,3,2,asinh(1/atan(a/b)), "a,b") \
+/* 798*/ o(FTFF1,t12"ash_ih1x_r" ,            -2,2,0.5,asinh(1/hypot(1,a)), "a") \
+/* 799*/ o(FTFF1,t12"ash_ih2x_r" ,            -2,2,0.5,asinh(1/hypot(2,a)), "a") \
+/* 800*/ o(FTFF2,t12"ash_ih_r"   ,              -3,3,2,asinh(1/hypot(a,b)), "a,b") \
+/* 801*/ o(FTFF1,t12"ash_ihx1_r" ,            -2,2,0.5,asinh(1/hypot(a,1)), "a") \
+/* 802*/ o(FTFF1,t12"ash_ihx2_r" ,            -2,2,0.5,asinh(1/hypot(a,2)), "a") \
+/* 803*/ o(FTFF1,t12"ash_l2_r"   ,           0.5,2,0.5,asinh(log2(a)), "a") \
+/* 804*/ o(FTFF1,t12"ash_l_r"    ,           0.5,2,0.5,asinh(log(a)), "a") \
+/* 805*/ o(FTFF1,t12"ash_lt_r"   ,           0.5,2,0.5,asinh(log10(a)), "a") \
+/* 806*/ o(FTFF2,t12"ash_ne_"    ,            -2,2,0.5,asinh(a!=b), "a,b") \
+/* 807*/ o(FTFF1,t12"ash_o_"     ,              -3,3,2,asinh(cot(a)), "a") \
+/* 808*/ o(FTFF2,t12"ash_p_"     ,           0.5,2,0.5,asinh(pow(a,b)), "a,b") \
+/* 809*/ o(FTFF1,t12"ash_s_r"    ,            -2,2,0.5,asinh(sin(a)), "a") \
+/* 810*/ o(FTFF1,t12"ash_sh_"    ,            -2,2,0.5,asinh(sinh(a)), "a") \
+/* 811*/ o(FTFF2,t12"ash_shl_"   ,            -2,2,0.5,asinh(sinh(a!=b)), "a,b") \
+/* 812*/ o(FTFF2,t12"ash_sl_"    ,            -2,2,0.5,asinh(sin(a!=b)), "a,b") \
+/* 813*/ o(FTFF1,t12"ash_sq_r"   ,             0,2,0.5,asinh(sqrt(a)), "a") \
+/* 814*/ o(FTFF2,t12"ash_sql_r"  ,            -2,2,0.5,asinh(sqrt(a!=b)), "a,b") \
+/* 815*/ o(FTFF1,t12"ash_t_r"    ,            -2,2,0.5,asinh(tan(a)), "a") \
+/* 816*/ o(FTFF1,t12"ash_th_r"   ,            -2,2,0.5,asinh(tanh(a)), "a") \
+/* 817*/ o(FTFF2,t12"ash_thl_r"  ,            -2,2,0.5,asinh(tanh(a!=b)), "a,b") \
+/* 818*/ o(FTFF2,t12"ash_tl_r"   ,            -2,2,0.5,asinh(tan(a!=b)), "a,b") \
+/* 819*/ o(FTFF2,t12"at_a2_r"    ,            -2,2,0.5,atan(atan2(a,b)), "a,b") \
+/* 820*/ o(FTFF1,t12"at_a_"      ,              -3,3,2,atan(csc(a)), "a") \
+/* 821*/ o(FTFF1,t12"at_ac_r"    ,            -1,1,0.5,atan(acos(a)), "a") \
+/* 822*/ o(FTFF1,t12"at_ach_r"   ,           0.5,2,0.5,atan(acosh((a+0.6))), "a") \
+/* 823*/ o(FTFF2,t12"at_acl_r"   ,            -2,2,0.5,atan(acos(a!=b)), "a,b") \
+/* 824*/ o(FTFF1,t12"at_as_r"    ,            -1,1,0.5,atan(asin(a)), "a") \
+/* 825*/ o(FTFF1,t12"at_ash_r"   ,            -2,2,0.5,atan(asinh(a)), "a") \
+/* 826*/ o(FTFF2,t12"at_ashl_r"  ,            -2,2,0.5,atan(asinh(a!=b)), "a,b") \
+/* 827*/ o(FTFF2,t12"at_asl_r"   ,            -2,2,0.5,atan(asin(a!=b)), "a,b") \
+/* 828*/ o(FTFF1,t12"at_at_r"    ,            -2,2,0.5,atan(atan(a)), "a") \
+/* 829*/ o(FTFF2,t12"at_atd_r"   ,              -3,3,2,atan(atan(a/b)), "a,b") \
+/* 830*/ o(FTFF1,t12"at_ath_r"   ,     -0.75,0.75,0.25,atan(atanh(a)), "a") \
+/* 831*/ o(FTFF2,t12"at_atl_"    ,            -2,2,0.5,atan(atan(a!=b)), "a,b") \
+/* 832*/ o(FTFF1,t12"at_atn_r"   ,            -2,2,0.5,atan(atan(-abs(a))), "a") \
+/* 833*/ o(FTFF1,t12"at_atp_r"   ,            -2,2,0.5,atan(atan(abs(a))), "a") \
+/* 834*/ o(FTFF1,t12"at_b_r"     ,            -2,2,0.5,atan(abs(a)), "a") \
+/* 835*/ o(FTFF1,t12"at_c_r"     ,            -2,2,0.5,atan(cos(a)), "a") \
+/* 836*/ o(FTFF1,t12"at_cb_r"    ,             0,2,0.5,atan(cbrt(a)), "a") \
+/* 837*/ o(FTFF2,t12"at_cbl_r"   ,            -2,2,0.5,atan(cbrt(a!=b)), "a,b") \
+/* 838*/ o(FTFF1,t12"at_ch_r"    ,            -2,2,0.5,atan(cosh(a)), "a") \
+/* 839*/ o(FTFF2,t12"at_chl_"    ,            -2,2,0.5,atan(cosh(a!=b)), "a,b") \
+/* 840*/ o(FTFF2,t12"at_cl_r"    ,            -2,2,0.5,atan(cos(a!=b)), "a,b") \
+/* 841*/ o(FTFF1,t12"at_e2_r"    ,            -2,2,0.5,atan(exp2(a)), "a") \
+/* 842*/ o(FTFF2,t12"at_e2l_"    ,            -2,2,0.5,atan(exp2(a!=b)), "a,b") \
+/* 843*/ o(FTFF1,t12"at_e_r"     ,            -2,2,0.5,atan(sec(a)), "a") \
+/* 844*/ o(FTFF2,t12"at_el_r"    ,            -2,2,0.5,atan(sec(a!=b)), "a,b") \
+/* 845*/ o(FTFF2,t12"at_eq_"     ,            -2,2,0.5,atan(a=b), "a,b") \
+/* 846*/ o(FTFF1,t12"at_ex_r"    ,            -2,2,0.5,atan(exp(a)), "a") \
+/* 847*/ o(FTFF2,t12"at_exl_"    ,            -2,2,0.5,atan(exp(a!=b)), "a,b") \
+/* 848*/ o(FTFF1,t12"at_h1x_r"   ,            -2,2,0.5,atan(hypot(1,a)), "a") \
+/* 849*/ o(FTFF1,t12"at_h2x_r"   ,            -2,2,0.5,atan(hypot(2,a)), "a") \
+/* 850*/ o(FTFF2,t12"at_h_r"     ,            -2,2,0.5,atan(hypot(a,b)), "a,b") \
+/* 851*/ o(FTFF1,t12"at_hx1_r"   ,            -2,2,0.5,atan(hypot(a,1)), "a") \
+/* 852*/ o(FTFF1,t12"at_hx2_r"   ,            -2,2,0.5,atan(hypot(a,2)), "a") \
+/* 853*/ o(FTFF2,t12"at_ia2_r"   ,              -3,3,2,atan(1/atan2(a,b)), "a,b") \
+/* 854*/ o(FTFF2,t12"at_iatd_r"  ,              -3,3,2,atan(1/atan(a/b)), "a,b") \
+/* 855*/ o(FTFF1,t12"at_ih1x_r"  ,            -2,2,0.5,atan(1/hypot(1,a)), "a") \
+/* 856*/ o(FTFF1,t12"at_ih2x_r"  ,            -2,2,0.5,atan(1/hypot(2,a)), "a") \
+/* 857*/ o(FTFF2,t12"at_ih_r"    ,              -3,3,2,atan(1/hypot(a,b)), "a,b") \
+/* 858*/ o(FTFF1,t12"at_ihx1_r"  ,            -2,2,0.5,atan(1/hypot(a,1)), "a") \
+/* 859*/ o(FTFF1,t12"at_ihx2_r"  ,            -2,2,0.5,atan(1/hypot(a,2)), "a") \
+/* 860*/ o(FTFF1,t12"at_l2_r"    ,           0.5,2,0.5,atan(log2(a)), "a") \
+/* 861*/ o(FTFF1,t12"at_l_r"     ,           0.5,2,0.5,atan(log(a)), "a") \
+/* 862*/ o(FTFF1,t12"at_lt_r"    ,           0.5,2,0.5,atan(log10(a)), "a") \
+/* 863*/ o(FTFF2,t12"at_ne_"     ,            -2,2,0.5,atan(a!=b), "a,b") \
+/* 864*/ o(FTFF1,t12"at_o_"      ,              -3,3,2,atan(cot(a)), "a") \
+/* 865*/ o(FTFF2,t12"at_p_r"     ,           0.5,2,0.5,atan(pow(a,b)), "a,b") \
+/* 866*/ o(FTFF1,t12"at_s_r"     ,            -2,2,0.5,atan(sin(a)), "a") \
+/* 867*/ o(FTFF1,t12"at_sh_r"    ,            -2,2,0.5,atan(sinh(a)), "a") \
+/* 868*/ o(FTFF2,t12"at_shl_r"   ,            -2,2,0.5,atan(sinh(a!=b)), "a,b") \
+/* 869*/ o(FTFF2,t12"at_sl_"     ,            -2,2,0.5,atan(sin(a!=b)), "a,b") \
+/* 870*/ o(FTFF1,t12"at_sq_r"    ,             0,2,0.5,atan(sqrt(a)), "a") \
+/* 871*/ o(FTFF2,t12"at_sql_r"   ,            -2,2,0.5,atan(sqrt(a!=b)), "a,b") \
+/* 872*/ o(FTFF1,t12"at_t_r"     ,            -2,2,0.5,atan(tan(a)), "a") \
+/* 873*/ o(FTFF1,t12"at_th_r"    ,            -2,2,0.5,atan(tanh(a)), "a") \
+/* 874*/ o(FTFF2,t12"at_thl_r"   ,            -2,2,0.5,atan(tanh(a!=b)), "a,b") \
+/* 875*/ o(FTFF2,t12"at_tl_r"    ,            -2,2,0.5,atan(tan(a!=b)), "a,b") \
+/* 876*/ o(FTFF2,t12"ath_a2_r"   ,          0.5,1,0.25,atanh(atan2((a+0.4),(b+0.4))), "a,b") \
+/* 877*/ o(FTFF1,t12"ath_ac_r" , -0.1875,0.1875,0.0625,atanh(acos((a+0.8))), "a") \
+/* 878*/ o(FTFF1,t12"ath_ach_r", -0.1875,0.1875,0.0625,atanh(acosh((a+1.2))), "a") \
+/* 879*/ o(FTFF1,t12"ath_as_r"   ,     -0.75,0.75,0.25,atanh(asin(a)), "a") \
+/* 880*/ o(FTFF1,t12"ath_ash_r"  ,            -1,1,0.5,atanh(asinh(a)), "a") \
+/* 881*/ o(FTFF2,t12"ath_ashl_"  ,            -2,2,0.5,atanh(asinh(a!=b)), "a,b") \
+/* 882*/ o(FTFF1,t12"ath_at_r"   ,            -1,1,0.5,atanh(atan(a)), "a") \
+/* 883*/ o(FTFF2,t12"ath_atd_r"  ,          0.5,1,0.25,atanh(atan((a+0.4)/(b+0.4))), "a,b") \
+/* 884*/ o(FTFF1,t12"ath_ath_r"  ,     -0.75,0.75,0.25,atanh(atanh(a)), "a") \
+/* 885*/ o(FTFF2,t12"ath_atl_"   ,            -2,2,0.5,atanh(atan(a!=b)), "a,b") \
+/* 886*/ o(FTFF1,t12"ath_atn_r"  ,            -1,1,0.5,atanh(atan(-abs(a))), "a") \
+/* 887*/ o(FTFF1,t12"ath_atp_r"  ,            -1,1,0.5,atanh(atan(abs(a))), "a") \
+/* 888*/ o(FTFF1,t12"ath_b_r"    ,     -0.75,0.75,0.25,atanh(abs(a)), "a") \
+/* 889*/ o(FTFF1,t12"ath_c_"     ,              -3,3,2,atanh(cos(a)), "a") \
+/* 890*/ o(FTFF1,t12"ath_cb_r"   ,         0,0.75,0.25,atanh(cbrt(a)), "a") \
+/* 891*/ o(FTFF1,t12"ath_e2_r" , -0.1875,0.1875,0.0625,atanh(exp2((a+-0.2))), "a") \
+/* 892*/ o(FTFF1,t12"ath_ex_r" , -0.1875,0.1875,0.0625,atanh(exp((a+-0.2))), "a") \
+/* 893*/ o(FTFF2,t12"ath_h_r"    ,       -0.5,0.5,0.25,atanh(hypot(a,b)), "a,b") \
+/* 894*/ o(FTFF2,t12"ath_ia2_r", -0.1875,0.1875,0.0625,atanh(1/atan2((a+-0.2),(b+-0.2))), "a,b") \
+/* 895*/ o(FTFF1,t12"ath_ih1x_"  ,              -3,3,2,atanh(1/hypot(1,a)), "a") \
+/* 896*/ o(FTFF1,t12"ath_ih2x_r" ,            -2,2,0.5,atanh(1/hypot(2,a)), "a") \
+/* 897*/ o(FTFF2,t12"ath_ih_r"   ,              -3,3,2,atanh(1/hypot(a,b)), "a,b") \
+/* 898*/ o(FTFF1,t12"ath_ihx1_"  ,              -3,3,2,atanh(1/hypot(a,1)), "a") \
+/* 899*/ o(FTFF1,t12"ath_ihx2_r" ,            -2,2,0.5,atanh(1/hypot(a,2)), "a") \
+/* 900*/ o(FTFF1,t12"ath_l2_r"   ,          0.5,1,0.25,atanh(log2((a+0.2))), "a") \
+/* 901*/ o(FTFF1,t12"ath_l_r"    ,           0.5,2,0.5,atanh(log(a)), "a") \
+/* 902*/ o(FTFF1,t12"ath_lt_r"   ,           0.5,2,0.5,atanh(log10(a)), "a") \
+/* 903*/ o(FTFF1,t12"ath_o_r"    ,          0.5,1,0.25,atanh(cot((a+0.4))), "a") \
+/* 904*/ o(FTFF2,t12"ath_p_r"    ,     0.25,0.75,0.125,atanh(pow(a,b)), "a,b") \
+/* 905*/ o(FTFF1,t12"ath_s_r"    ,            -2,2,0.5,atanh(sin(a)), "a") \
+/* 906*/ o(FTFF1,t12"ath_sh_r"   ,     -0.75,0.75,0.25,atanh(sinh(a)), "a") \
+/* 907*/ o(FTFF2,t12"ath_sl_"    ,            -2,2,0.5,atanh(sin(a!=b)), "a,b") \
+/* 908*/ o(FTFF1,t12"ath_sq_r"   ,         0,0.75,0.25,atanh(sqrt(a)), "a") \
+/* 909*/ o(FTFF1,t12"ath_t_r"    ,     -0.75,0.75,0.25,atanh(tan(a)), "a") \
+/* 910*/ o(FTFF1,t12"ath_th_r"   ,            -2,2,0.5,atanh(tanh(a)), "a") \
+/* 911*/ o(FTFF2,t12"ath_thl_r"  ,            -2,2,0.5,atanh(tanh(a!=b)), "a,b") \
+/* 912*/ o(FTFF2,t12"b_a2_r"     ,            -2,2,0.5,abs(atan2(a,b)), "a,b") \
+/* 913*/ o(FTFF1,t12"b_a_"       ,              -3,3,2,abs(csc(a)), "a") \
+/* 914*/ o(FTFF1,t12"b_ac_r"     ,            -1,1,0.5,abs(acos(a)), "a") \
+/* 915*/ o(FTFF1,t12"b_ach_r"    ,           0.5,2,0.5,abs(acosh((a+0.6))), "a") \
+/* 916*/ o(FTFF2,t12"b_acl_r"    ,            -2,2,0.5,abs(acos(a!=b)), "a,b") \
+/* 917*/ o(FTFF1,t12"b_as_r"     ,            -1,1,0.5,abs(asin(a)), "a") \
+/* 918*/ o(FTFF1,t12"b_ash_r"    ,            -2,2,0.5,abs(asinh(a)), "a") \
+/* 919*/ o(FTFF2,t12"b_ashl_"    ,            -2,2,0.5,abs(asinh(a!=b)), "a,b") \
+/* 920*/ o(FTFF2,t12"b_asl_r"    ,            -2,2,0.5,abs(asin(a!=b)), "a,b") \
+/* 921*/ o(FTFF1,t12"b_at_r"     ,            -2,2,0.5,abs(atan(a)), "a") \
+/* 922*/ o(FTFF2,t12"b_atd_r"    ,              -3,3,2,abs(atan(a/b)), "a,b") \
+/* 923*/ o(FTFF1,t12"b_ath_"     ,     -0.75,0.75,0.25,abs(atanh(a)), "a") \
+/* 924*/ o(FTFF2,t12"b_atl_"     ,            -2,2,0.5,abs(atan(a!=b)), "a,b") \
+/* 925*/ o(FTFF1,t12"b_atn_r"    ,            -2,2,0.5,abs(atan(-abs(a))), "a") \
+/* 926*/ o(FTFF1,t12"b_atp_r"    ,            -2,2,0.5,abs(atan(abs(a))), "a") \
+/* 927*/ o(FTFF1,t12"b_b_"       ,            -2,2,0.5,abs(abs(a)), "a") \
+/* 928*/ o(FTFF1,t12"b_c_"       ,            -2,2,0.5,abs(cos(a)), "a") \
+/* 929*/ o(FTFF1,t12"b_cb_r"     ,             0,2,0.5,abs(cbrt(a)), "a") \
+/* 930*/ o(FTFF2,t12"b_cbl_r"    ,            -2,2,0.5,abs(cbrt(a!=b)), "a,b") \
+/* 931*/ o(FTFF1,t12"b_ch_"      ,            -2,2,0.5,abs(cosh(a)), "a") \
+/* 932*/ o(FTFF2,t12"b_chl_"     ,            -2,2,0.5,abs(cosh(a!=b)), "a,b") \
+/* 933*/ o(FTFF2,t12"b_cl_"      ,            -2,2,0.5,abs(cos(a!=b)), "a,b") \
+/* 934*/ o(FTFF1,t12"b_e2_"      ,            -2,2,0.5,abs(exp2(a)), "a") \
+/* 935*/ o(FTFF2,t12"b_e2l_"     ,            -2,2,0.5,abs(exp2(a!=b)), "a,b") \
+/* 936*/ o(FTFF1,t12"b_e_"       ,            -2,2,0.5,abs(sec(a)), "a") \
+/* 937*/ o(FTFF2,t12"b_el_"      ,            -2,2,0.5,abs(sec(a!=b)), "a,b") \
+/* 938*/ o(FTFF2,t12"b_eq_"      ,            -2,2,0.5,abs(a=b), "a,b") \
+/* 939*/ o(FTFF1,t12"b_ex_"      ,            -2,2,0.5,abs(exp(a)), "a") \
+/* 940*/ o(FTFF2,t12"b_exl_"     ,            -2,2,0.5,abs(exp(a!=b)), "a,b") \
+/* 941*/ o(FTFF1,t12"b_h1x_r"    ,            -2,2,0.5,abs(hypot(1,a)), "a") \
+/* 942*/ o(FTFF1,t12"b_h2x_r"    ,            -2,2,0.5,abs(hypot(2,a)), "a") \
+/* 943*/ o(FTFF2,t12"b_h_r"      ,            -2,2,0.5,abs(hypot(a,b)), "a,b") \
+/* 944*/ o(FTFF1,t12"b_hx1_r"    ,            -2,2,0.5,abs(hypot(a,1)), "a") \
+/* 945*/ o(FTFF1,t12"b_hx2_r"    ,            -2,2,0.5,abs(hypot(a,2)), "a") \
+/* 946*/ o(FTFF2,t12"b_ia2_r"    ,              -3,3,2,abs(1/atan2(a,b)), "a,b") \
+/* 947*/ o(FTFF2,t12"b_iatd_r"   ,              -3,3,2,abs(1/atan(a/b)), "a,b") \
+/* 948*/ o(FTFF1,t12"b_ih1x_r"   ,            -2,2,0.5,abs(1/hypot(1,a)), "a") \
+/* 949*/ o(FTFF1,t12"b_ih2x_r"   ,            -2,2,0.5,abs(1/hypot(2,a)), "a") \
+/* 950*/ o(FTFF2,t12"b_ih_r"     ,              -3,3,2,abs(1/hypot(a,b)), "a,b") \
+/* 951*/ o(FTFF1,t12"b_ihx1_r"   ,            -2,2,0.5,abs(1/hypot(a,1)), "a") \
+/* 952*/ o(FTFF1,t12"b_ihx2_r"   ,            -2,2,0.5,abs(1/hypot(a,2)), "a") \
+/* 953*/ o(FTFF1,t12"b_l2_r"     ,           0.5,2,0.5,abs(log2(a)), "a") \
+/* 954*/ o(FTFF1,t12"b_l_r"      ,           0.5,2,0.5,abs(log(a)), "a") \
+/* 955*/ o(FTFF1,t12"b_lt_r"     ,           0.5,2,0.5,abs(log10(a)), "a") \
+/* 956*/ o(FTFF2,t12"b_ne_"      ,            -2,2,0.5,abs(a!=b), "a,b") \
+/* 957*/ o(FTFF1,t12"b_o_"       ,              -3,3,2,abs(cot(a)), "a") \
+/* 958*/ o(FTFF2,t12"b_p_r"      ,           0.5,2,0.5,abs(pow(a,b)), "a,b") \
+/* 959*/ o(FTFF1,t12"b_s_"       ,            -2,2,0.5,abs(sin(a)), "a") \
+/* 960*/ o(FTFF1,t12"b_sh_"      ,            -2,2,0.5,abs(sinh(a)), "a") \
+/* 961*/ o(FTFF2,t12"b_shl_"     ,            -2,2,0.5,abs(sinh(a!=b)), "a,b") \
+/* 962*/ o(FTFF2,t12"b_sl_"      ,            -2,2,0.5,abs(sin(a!=b)), "a,b") \
+/* 963*/ o(FTFF1,t12"b_sq_r"     ,             0,2,0.5,abs(sqrt(a)), "a") \
+/* 964*/ o(FTFF2,t12"b_sql_r"    ,            -2,2,0.5,abs(sqrt(a!=b)), "a,b") \
+/* 965*/ o(FTFF1,t12"b_t_r"      ,            -2,2,0.5,abs(tan(a)), "a") \
+/* 966*/ o(FTFF1,t12"b_th_r"     ,            -2,2,0.5,abs(tanh(a)), "a") \
+/* 967*/ o(FTFF2,t12"b_thl_r"    ,            -2,2,0.5,abs(tanh(a!=b)), "a,b") \
+/* 968*/ o(FTFF2,t12"b_tl_r"     ,            -2,2,0.5,abs(tan(a!=b)), "a,b") \
+/* 969*/ o(FTFF2,t12"c_a2_r"     ,            -2,2,0.5,cos(atan2(a,b)), "a,b") \
+/* 970*/ o(FTFF1,t12"c_a_"       ,              -3,3,2,cos(csc(a)), "a") \
+/* 971*/ o(FTFF1,t12"c_ac_r"     ,            -1,1,0.5,cos(acos(a)), "a") \
+/* 972*/ o(FTFF1,t12"c_ach_r"    ,           0.5,2,0.5,cos(acosh((a+0.6))), "a") \
+/* 973*/ o(FTFF2,t12"c_acl_r"    ,            -2,2,0.5,cos(acos(a!=b)), "a,b") \
+/* 974*/ o(FTFF1,t12"c_as_r"     ,            -1,1,0.5,cos(asin(a)), "a") \
+/* 975*/ o(FTFF1,t12"c_ash_r"    ,            -2,2,0.5,cos(asinh(a)), "a") \
+/* 976*/ o(FTFF2,t12"c_ashl_"    ,            -2,2,0.5,cos(asinh(a!=b)), "a,b") \
+/* 977*/ o(FTFF2,t12"c_asl_r"    ,            -2,2,0.5,cos(asin(a!=b)), "a,b") \
+/* 978*/ o(FTFF1,t12"c_at_r"     ,            -2,2,0.5,cos(atan(a)), "a") \
+/* 979*/ o(FTFF2,t12"c_atd_r"    ,              -3,3,2,cos(atan(a/b)), "a,b") \
+/* 980*/ o(FTFF1,t12"c_ath_"     ,     -0.75,0.75,0.25,cos(atanh(a)), "a") \
+/* 981*/ o(FTFF2,t12"c_atl_"     ,            -2,2,0.5,cos(atan(a!=b)), "a,b") \
+/* 982*/ o(FTFF1,t12"c_atn_r"    ,            -2,2,0.5,cos(atan(-abs(a))), "a") \
+/* 983*/ o(FTFF1,t12"c_atp_r"    ,            -2,2,0.5,cos(atan(abs(a))), "a") \
+/* 984*/ o(FTFF1,t12"c_b_"       ,            -2,2,0.5,cos(abs(a)), "a") \
+/* 985*/ o(FTFF1,t12"c_c_"       ,            -2,2,0.5,cos(cos(a)), "a") \
+/* 986*/ o(FTFF1,t12"c_cb_r"     ,             0,2,0.5,cos(cbrt(a)), "a") \
+/* 987*/ o(FTFF2,t12"c_cbl_r"    ,            -2,2,0.5,cos(cbrt(a!=b)), "a,b") \
+/* 988*/ o(FTFF1,t12"c_ch_"      ,            -2,2,0.5,cos(cosh(a)), "a") \
+/* 989*/ o(FTFF2,t12"c_chl_"     ,            -2,2,0.5,cos(cosh(a!=b)), "a,b") \
+/* 990*/ o(FTFF2,t12"c_cl_"      ,            -2,2,0.5,cos(cos(a!=b)), "a,b") \
+/* 991*/ o(FTFF1,t12"c_e2_"      ,            -2,2,0.5,cos(exp2(a)), "a") \
+/* 992*/ o(FTFF2,t12"c_e2l_"     ,            -2,2,0.5,cos(exp2(a!=b)), "a,b") \
+/* 993*/ o(FTFF1,t12"c_e_"       ,            -2,2,0.5,cos(sec(a)), "a") \
+/* 994*/ o(FTFF2,t12"c_el_"      ,            -2,2,0.5,cos(sec(a!=b)), "a,b") \
+/* 995*/ o(FTFF2,t12"c_eq_"      ,            -2,2,0.5,cos(a=b), "a,b") \
+/* 996*/ o(FTFF1,t12"c_ex_"      ,            -2,2,0.5,cos(exp(a)), "a") \
+/* 997*/ o(FTFF2,t12"c_exl_"     ,            -2,2,0.5,cos(exp(a!=b)), "a,b") \
+/* 998*/ o(FTFF1,t12"c_h1x_r"    ,            -2,2,0.5,cos(hypot(1,a)), "a") \
+/* 999*/ o(FTFF1,t12"c_h2x_r"    ,            -2,2,0.5,cos(hypot(2,a)), "a") \
+/*1000*/ o(FTFF2,t12"c_h_r"      ,            -2,2,0.5,cos(hypot(a,b)), "a,b") \
+/*1001*/ o(FTFF1,t12"c_hx1_r"    ,            -2,2,0.5,cos(hypot(a,1)), "a") \
+/*1002*/ o(FTFF1,t12"c_hx2_r"    ,            -2,2,0.5,cos(hypot(a,2)), "a") \
+/*1003*/ o(FTFF2,t12"c_ia2_r"    ,              -3,3,2,cos(1/atan2(a,b)), "a,b") \
+/*1004*/ o(FTFF2,t12"c_iatd_r"   ,              -3,3,2,cos(1/atan(a/b)), "a,b") \
+/*1005*/ o(FTFF1,t12"c_ih1x_r"   ,            -2,2,0.5,cos(1/hypot(1,a)), "a") \
+/*1006*/ o(FTFF1,t12"c_ih2x_r"   ,            -2,2,0.5,cos(1/hypot(2,a)), "a") \
+/*1007*/ o(FTFF2,t12"c_ih_r"     ,              -3,3,2,cos(1/hypot(a,b)), "a,b") \
+/*1008*/ o(FTFF1,t12"c_ihx1_r"   ,            -2,2,0.5,cos(1/hypot(a,1)), "a") \
+/*1009*/ o(FTFF1,t12"c_ihx2_r"   ,            -2,2,0.5,cos(1/hypot(a,2)), "a") \
+/*1010*/ o(FTFF1,t12"c_l2_r"     ,           0.5,2,0.5,cos(log2(a)), "a") \
+/*1011*/ o(FTFF1,t12"c_l_r"      ,           0.5,2,0.5,cos(log(a)), "a") \
+/*1012*/ o(FTFF1,t12"c_lt_r"     ,           0.5,2,0.5,cos(log10(a)), "a") \
+/*1013*/ o(FTFF2,t12"c_ne_"      ,            -2,2,0.5,cos(a!=b), "a,b") \
+/*1014*/ o(FTFF1,t12"c_o_"       ,              -3,3,2,cos(cot(a)), "a") \
+/*1015*/ o(FTFF2,t12"c_p_"       ,           0.5,2,0.5,cos(pow(a,b)), "a,b") \
+/*1016*/ o(FTFF1,t12"c_s_"       ,            -2,2,0.5,cos(sin(a)), "a") \
+/*1017*/ o(FTFF1,t12"c_sh_"      ,            -2,2,0.5,cos(sinh(a)), "a") \
+/*1018*/ o(FTFF2,t12"c_shl_"     ,            -2,2,0.5,cos(sinh(a!=b)), "a,b") \
+/*1019*/ o(FTFF2,t12"c_sl_"      ,            -2,2,0.5,cos(sin(a!=b)), "a,b") \
+/*1020*/ o(FTFF1,t12"c_sq_r"     ,             0,2,0.5,cos(sqrt(a)), "a") \
+/*1021*/ o(FTFF2,t12"c_sql_r"    ,            -2,2,0.5,cos(sqrt(a!=b)), "a,b") \
+/*1022*/ o(FTFF1,t12"c_t_r"      ,            -2,2,0.5,cos(tan(a)), "a") \
+/*1023*/ o(FTFF1,t12"c_th_r"     ,            -2,2,0.5,cos(tanh(a)), "a") \
+/*1024*/ o(FTFF2,t12"c_thl_r"    ,            -2,2,0.5,cos(tanh(a!=b)), "a,b") \
+/*1025*/ o(FTFF2,t12"c_tl_r"     ,            -2,2,0.5,cos(tan(a!=b)), "a,b") \
+/*1026*/ o(FTFF2,t12"cb_a2_r"    ,             0,2,0.5,cbrt(atan2(a,b)), "a,b") \
+/*1027*/ o(FTFF1,t12"cb_a_r"     ,           0.5,2,0.5,cbrt(csc(a)), "a") \
+/*1028*/ o(FTFF1,t12"cb_ac_r"    ,            -1,1,0.5,cbrt(acos(a)), "a") \
+/*1029*/ o(FTFF1,t12"cb_ach_r"   ,           0.5,2,0.5,cbrt(acosh((a+0.6))), "a") \
+/*1030*/ o(FTFF2,t12"cb_acl_r"   ,            -2,2,0.5,cbrt(acos(a!=b)), "a,b") \
+/*1031*/ o(FTFF1,t12"cb_as_r"    ,             0,1,0.5,cbrt(asin(a)), "a") \
+/*1032*/ o(FTFF1,t12"cb_ash_r"   ,             0,2,0.5,cbrt(asinh(a)), "a") \
+/*1033*/ o(FTFF2,t12"cb_ashl_r"  ,            -2,2,0.5,cbrt(asinh(a!=b)), "a,b") \
+/*1034*/ o(FTFF2,t12"cb_asl_r"   ,            -2,2,0.5,cbrt(asin(a!=b)), "a,b") \
+/*1035*/ o(FTFF1,t12"cb_at_r"    ,             0,2,0.5,cbrt(atan(a)), "a") \
+/*1036*/ o(FTFF2,t12"cb_atd_r"   ,           0.5,2,0.5,cbrt(atan(a/b)), "a,b") \
+/*1037*/ o(FTFF1,t12"cb_ath_r"   ,         0,0.75,0.25,cbrt(atanh(a)), "a") \
+/*1038*/ o(FTFF2,t12"cb_atl_r"   ,            -2,2,0.5,cbrt(atan(a!=b)), "a,b") \
+/*1039*/ o(FTFF1,t12"cb_atp_r"   ,            -2,2,0.5,cbrt(atan(abs(a))), "a") \
+/*1040*/ o(FTFF1,t12"cb_b_r"     ,            -2,2,0.5,cbrt(abs(a)), "a") \
+/*1041*/ o(FTFF1,t12"cb_c_"      ,            -1,1,0.5,cbrt(cos(a)), "a") \
+/*1042*/ o(FTFF1,t12"cb_cb_r"    ,             0,2,0.5,cbrt(cbrt(a)), "a") \
+/*1043*/ o(FTFF2,t12"cb_cbl_r"   ,            -2,2,0.5,cbrt(cbrt(a!=b)), "a,b") \
+/*1044*/ o(FTFF1,t12"cb_ch_r"    ,            -2,2,0.5,cbrt(cosh(a)), "a") \
+/*1045*/ o(FTFF2,t12"cb_chl_"    ,            -2,2,0.5,cbrt(cosh(a!=b)), "a,b") \
+/*1046*/ o(FTFF2,t12"cb_cl_"     ,            -2,2,0.5,cbrt(cos(a!=b)), "a,b") \
+/*1047*/ o(FTFF1,t12"cb_e2_r"    ,            -2,2,0.5,cbrt(exp2(a)), "a") \
+/*1048*/ o(FTFF2,t12"cb_e2l_"    ,            -2,2,0.5,cbrt(exp2(a!=b)), "a,b") \
+/*1049*/ o(FTFF1,t12"cb_e_"      ,            -1,1,0.5,cbrt(sec(a)), "a") \
+/*1050*/ o(FTFF2,t12"cb_el_"     ,            -2,2,0.5,cbrt(sec(a!=b)), "a,b") \
+/*1051*/ o(FTFF2,t12"cb_eq_r"    ,            -2,2,0.5,cbrt(a=b), "a,b") \
+/*1052*/ o(FTFF1,t12"cb_ex_"     ,            -2,2,0.5,cbrt(exp(a)), "a") \
+/*1053*/ o(FTFF2,t12"cb_exl_"    ,            -2,2,0.5,cbrt(exp(a!=b)), "a,b") \
+/*1054*/ o(FTFF1,t12"cb_h1x_r"   ,            -2,2,0.5,cbrt(hypot(1,a)), "a") \
+/*1055*/ o(FTFF1,t12"cb_h2x_r"   ,            -2,2,0.5,cbrt(hypot(2,a)), "a") \
+/*1056*/ o(FTFF2,t12"cb_h_r"     ,            -2,2,0.5,cbrt(hypot(a,b)), "a,b") \
+/*1057*/ o(FTFF1,t12"cb_hx1_r"   ,            -2,2,0.5,cbrt(hypot(a,1)), "a") \
+/*1058*/ o(FTFF1,t12"cb_hx2_r"   ,            -2,2,0.5,cbrt(hypot(a,2)), "a") \
+/*1059*/ o(FTFF2,t12"cb_ia2_r"   ,           0.5,2,0.5,cbrt(1/atan2(a,b)), "a,b") \
+/*1060*/ o(FTFF2,t12"cb_iatd_r"  ,           0.5,2,0.5,cbrt(1/atan(a/b)), "a,b") \
+/*1061*/ o(FTFF1,t12"cb_ih1x_r"  ,            -2,2,0.5,cbrt(1/hypot(1,a)), "a") \
+/*1062*/ o(FTFF1,t12"cb_ih2x_r"  ,            -2,2,0.5,cbrt(1/hypot(2,a)), "a") \
+/*1063*/ o(FTFF2,t12"cb_ih_r"    ,              -3,3,2,cbrt(1/hypot(a,b)), "a,b") \
+/*1064*/ o(FTFF1,t12"cb_ihx1_r"  ,            -2,2,0.5,cbrt(1/hypot(a,1)), "a") \
+/*1065*/ o(FTFF1,t12"cb_ihx2_r"  ,            -2,2,0.5,cbrt(1/hypot(a,2)), "a") \
+/*1066*/ o(FTFF1,t12"cb_l2_r"    ,           0.5,2,0.5,cbrt(log2((a+0.6))), "a") \
+/*1067*/ o(FTFF1,t12"cb_l_r"     ,           0.5,2,0.5,cbrt(log((a+0.6))), "a") \
+/*1068*/ o(FTFF1,t12"cb_lt_r"    ,           0.5,2,0.5,cbrt(log10((a+0.6))), "a") \
+/*1069*/ o(FTFF2,t12"cb_ne_r"    ,            -2,2,0.5,cbrt(a!=b), "a,b") \
+/*1070*/ o(FTFF1,t12"cb_o_r"     ,          0.5,1,0.25,cbrt(cot(a)), "a") \
+/*1071*/ o(FTFF2,t12"cb_p_r"     ,           0.5,2,0.5,cbrt(pow(a,b)), "a,b") \
+/*1072*/ o(FTFF1,t12"cb_s_r"     ,             0,2,0.5,cbrt(sin(a)), "a") \
+/*1073*/ o(FTFF1,t12"cb_sh_r"    ,             0,2,0.5,cbrt(sinh(a)), "a") \
+/*1074*/ o(FTFF2,t12"cb_shl_r"   ,            -2,2,0.5,cbrt(sinh(a!=b)), "a,b") \
+/*1075*/ o(FTFF2,t12"cb_sl_r"    ,            -2,2,0.5,cbrt(sin(a!=b)), "a,b") \
+/*1076*/ o(FTFF1,t12"cb_sq_r"    ,             0,2,0.5,cbrt(sqrt(a)), "a") \
+/*1077*/ o(FTFF2,t12"cb_sql_r"   ,            -2,2,0.5,cbrt(sqrt(a!=b)), "a,b") \
+/*1078*/ o(FTFF1,t12"cb_t_r"     ,             0,1,0.5,cbrt(tan(a)), "a") \
+/*1079*/ o(FTFF1,t12"cb_th_r"    ,             0,2,0.5,cbrt(tanh(a)), "a") \
+/*1080*/ o(FTFF2,t12"cb_thl_r"   ,            -2,2,0.5,cbrt(tanh(a!=b)), "a,b") \
+/*1081*/ o(FTFF2,t12"cb_tl_r"    ,            -2,2,0.5,cbrt(tan(a!=b)), "a,b") \
+/*1082*/ o(FTFF2,t12"ch_a2_r"    ,            -2,2,0.5,cosh(atan2(a,b)), "a,b") \
+/*1083*/ o(FTFF1,t12"ch_a_"      ,              -3,3,2,cosh(csc(a)), "a") \
+/*1084*/ o(FTFF1,t12"ch_ac_r"    ,            -1,1,0.5,cosh(acos(a)), "a") \
+/*1085*/ o(FTFF1,t12"ch_ach_r"   ,           0.5,2,0.5,cosh(acosh((a+0.6))), "a") \
+/*1086*/ o(FTFF2,t12"ch_acl_r"   ,            -2,2,0.5,cosh(acos(a!=b)), "a,b") \
+/*1087*/ o(FTFF1,t12"ch_as_r"    ,            -1,1,0.5,cosh(asin(a)), "a") \
+/*1088*/ o(FTFF1,t12"ch_ash_r"   ,            -2,2,0.5,cosh(asinh(a)), "a") \
+/*1089*/ o(FTFF2,t12"ch_ashl_"   ,            -2,2,0.5,cosh(asinh(a!=b)), "a,b") \
+/*1090*/ o(FTFF2,t12"ch_asl_r"   ,            -2,2,0.5,cosh(asin(a!=b)), "a,b") \
+/*1091*/ o(FTFF1,t12"ch_at_r"    ,            -2,2,0.5,cosh(atan(a)), "a") \
+/*1092*/ o(FTFF2,t12"ch_atd_r"   ,              -3,3,2,cosh(atan(a/b)), "a,b") \
+/*1093*/ o(FTFF1,t12"ch_ath_"    ,     -0.75,0.75,0.25,cosh(atanh(a)), "a") \
+/*1094*/ o(FTFF2,t12"ch_atl_"    ,            -2,2,0.5,cosh(atan(a!=b)), "a,b") \
+/*1095*/ o(FTFF1,t12"ch_atn_r"   ,            -2,2,0.5,cosh(atan(-abs(a))), "a") \
+/*1096*/ o(FTFF1,t12"ch_atp_r"   ,            -2,2,0.5,cosh(atan(abs(a))), "a") \
+/*1097*/ o(FTFF1,t12"ch_b_"      ,            -2,2,0.5,cosh(abs(a)), "a") \
+/*1098*/ o(FTFF1,t12"ch_c_"      ,            -2,2,0.5,cosh(cos(a)), "a") \
+/*1099*/ o(FTFF1,t12"ch_cb_r"    ,             0,2,0.5,cosh(cbrt(a)), "a") \
+/*1100*/ o(FTFF2,t12"ch_cbl_r"   ,            -2,2,0.5,cosh(cbrt(a!=b)), "a,b") \
+/*1101*/ o(FTFF1,t12"ch_ch_"     ,            -2,2,0.5,cosh(cosh(a)), "a") \
+/*1102*/ o(FTFF2,t12"ch_chl_"    ,            -2,2,0.5,cosh(cosh(a!=b)), "a,b") \
+/*1103*/ o(FTFF2,t12"ch_cl_"     ,            -2,2,0.5,cosh(cos(a!=b)), "a,b") \
+/*1104*/ o(FTFF1,t12"ch_e2_"     ,            -2,2,0.5,cosh(exp2(a)), "a") \
+/*1105*/ o(FTFF2,t12"ch_e2l_"    ,            -2,2,0.5,cosh(exp2(a!=b)), "a,b") \
+/*1106*/ o(FTFF1,t12"ch_e_"      ,            -2,2,0.5,cosh(sec(a)), "a") \
+/*1107*/ o(FTFF2,t12"ch_el_"     ,            -2,2,0.5,cosh(sec(a!=b)), "a,b") \
+/*1108*/ o(FTFF2,t12"ch_eq_"     ,            -2,2,0.5,cosh(a=b), "a,b") \
+/*1109*/ o(FTFF1,t12"ch_ex_"     ,            -2,2,0.5,cosh(exp(a)), "a") \
+/*1110*/ o(FTFF2,t12"ch_exl_"    ,            -2,2,0.5,cosh(exp(a!=b)), "a,b") \
+/*1111*/ o(FTFF1,t12"ch_h1x_r"   ,            -2,2,0.5,cosh(hypot(1,a)), "a") \
+/*1112*/ o(FTFF1,t12"ch_h2x_r"   ,            -2,2,0.5,cosh(hypot(2,a)), "a") \
+/*1113*/ o(FTFF2,t12"ch_h_r"     ,            -2,2,0.5,cosh(hypot(a,b)), "a,b") \
+/*1114*/ o(FTFF1,t12"ch_hx1_r"   ,            -2,2,0.5,cosh(hypot(a,1)), "a") \
+/*1115*/ o(FTFF1,t12"ch_hx2_r"   ,            -2,2,0.5,cosh(hypot(a,2)), "a") \
+/*1116*/ o(FTFF2,t12"ch_ia2_r"   ,              -3,3,2,cosh(1/atan2(a,b)), "a,b") \
+/*1117*/ o(FTFF2,t12"ch_iatd_r"  ,              -3,3,2,cosh(1/atan(a/b)), "a,b") \
+/*1118*/ o(FTFF1,t12"ch_ih1x_r"  ,            -2,2,0.5,cosh(1/hypot(1,a)), "a") \
+/*1119*/ o(FTFF1,t12"ch_ih2x_r"  ,            -2,2,0.5,cosh(1/hypot(2,a)), "a") \
+/*1120*/ o(FTFF2,t12"ch_ih_r"    ,              -3,3,2,cosh(1/hypot(a,b)), "a,b") \
+/*1121*/ o(FTFF1,t12"ch_ihx1_r"  ,            -2,2,0.5,cosh(1/hypot(a,1)), "a") \
+/*1122*/ o(FTFF1,t12"ch_ihx2_r"  ,            -2,2,0.5,cosh(1/hypot(a,2)), "a") \
+/*1123*/ o(FTFF1,t12"ch_l2_r"    ,           0.5,2,0.5,cosh(log2(a)), "a") \
+/*1124*/ o(FTFF1,t12"ch_l_r"     ,           0.5,2,0.5,cosh(log(a)), "a") \
+/*1125*/ o(FTFF1,t12"ch_lt_r"    ,           0.5,2,0.5,cosh(log10(a)), "a") \
+/*1126*/ o(FTFF2,t12"ch_ne_"     ,            -2,2,0.5,cosh(a!=b), "a,b") \
+/*1127*/ o(FTFF1,t12"ch_o_"      ,              -3,3,2,cosh(cot(a)), "a") \
+/*1128*/ o(FTFF2,t12"ch_p_"      ,           0.5,2,0.5,cosh(pow(a,b)), "a,b") \
+/*1129*/ o(FTFF1,t12"ch_s_"      ,            -2,2,0.5,cosh(sin(a)), "a") \
+/*1130*/ o(FTFF1,t12"ch_sh_"     ,            -2,2,0.5,cosh(sinh(a)), "a") \
+/*1131*/ o(FTFF2,t12"ch_shl_"    ,            -2,2,0.5,cosh(sinh(a!=b)), "a,b") \
+/*1132*/ o(FTFF2,t12"ch_sl_"     ,            -2,2,0.5,cosh(sin(a!=b)), "a,b") \
+/*1133*/ o(FTFF1,t12"ch_sq_r"    ,             0,2,0.5,cosh(sqrt(a)), "a") \
+/*1134*/ o(FTFF2,t12"ch_sql_r"   ,            -2,2,0.5,cosh(sqrt(a!=b)), "a,b") \
+/*1135*/ o(FTFF1,t12"ch_t_r"     ,            -2,2,0.5,cosh(tan(a)), "a") \
+/*1136*/ o(FTFF1,t12"ch_th_r"    ,            -2,2,0.5,cosh(tanh(a)), "a") \
+/*1137*/ o(FTFF2,t12"ch_thl_r"   ,            -2,2,0.5,cosh(tanh(a!=b)), "a,b") \
+/*1138*/ o(FTFF2,t12"ch_tl_r"    ,            -2,2,0.5,cosh(tan(a!=b)), "a,b") \
+/*1139*/ o(FTFF2,t12"e2_a2_r"    ,            -2,2,0.5,exp2(atan2(a,b)), "a,b") \
+/*1140*/ o(FTFF1,t12"e2_a_"      ,              -3,3,2,exp2(csc(a)), "a") \
+/*1141*/ o(FTFF1,t12"e2_ac_r"    ,            -1,1,0.5,exp2(acos(a)), "a") \
+/*1142*/ o(FTFF1,t12"e2_ach_r"   ,           0.5,2,0.5,exp2(acosh((a+0.6))), "a") \
+/*1143*/ o(FTFF2,t12"e2_acl_r"   ,            -2,2,0.5,exp2(acos(a!=b)), "a,b") \
+/*1144*/ o(FTFF1,t12"e2_as_r"    ,            -1,1,0.5,exp2(asin(a)), "a") \
+/*1145*/ o(FTFF1,t12"e2_ash_r"   ,            -2,2,0.5,exp2(asinh(a)), "a") \
+/*1146*/ o(FTFF2,t12"e2_ashl_"   ,            -2,2,0.5,exp2(asinh(a!=b)), "a,b") \
+/*1147*/ o(FTFF2,t12"e2_asl_r"   ,            -2,2,0.5,exp2(asin(a!=b)), "a,b") \
+/*1148*/ o(FTFF1,t12"e2_at_r"    ,            -2,2,0.5,exp2(atan(a)), "a") \
+/*1149*/ o(FTFF2,t12"e2_atd_r"   ,              -3,3,2,exp2(atan(a/b)), "a,b") \
+/*1150*/ o(FTFF1,t12"e2_ath_"    ,     -0.75,0.75,0.25,exp2(atanh(a)), "a") \
+/*1151*/ o(FTFF2,t12"e2_atl_"    ,            -2,2,0.5,exp2(atan(a!=b)), "a,b") \
+/*1152*/ o(FTFF1,t12"e2_atn_r"   ,            -2,2,0.5,exp2(atan(-abs(a))), "a") \
+/*1153*/ o(FTFF1,t12"e2_atp_r"   ,            -2,2,0.5,exp2(atan(abs(a))), "a") \
+/*1154*/ o(FTFF1,t12"e2_b_"      ,            -2,2,0.5,exp2(abs(a)), "a") \
+/*1155*/ o(FTFF1,t12"e2_c_"      ,            -2,2,0.5,exp2(cos(a)), "a") \
+/*1156*/ o(FTFF1,t12"e2_cb_r"    ,             0,2,0.5,exp2(cbrt(a)), "a") \
+/*1157*/ o(FTFF2,t12"e2_cbl_r"   ,            -2,2,0.5,exp2(cbrt(a!=b)), "a,b") \
+/*1158*/ o(FTFF1,t12"e2_ch_"     ,            -2,2,0.5,exp2(cosh(a)), "a") \
+/*1159*/ o(FTFF2,t12"e2_chl_"    ,            -2,2,0.5,exp2(cosh(a!=b)), "a,b") \
+/*1160*/ o(FTFF2,t12"e2_cl_"     ,            -2,2,0.5,exp2(cos(a!=b)), "a,b") \
+/*1161*/ o(FTFF1,t12"e2_e2_"     ,            -2,2,0.5,exp2(exp2(a)), "a") \
+/*1162*/ o(FTFF2,t12"e2_e2l_"    ,            -2,2,0.5,exp2(exp2(a!=b)), "a,b") \
+/*1163*/ o(FTFF1,t12"e2_e_"      ,            -2,2,0.5,exp2(sec(a)), "a") \
+/*1164*/ o(FTFF2,t12"e2_el_"     ,            -2,2,0.5,exp2(sec(a!=b)), "a,b") \
+/*1165*/ o(FTFF2,t12"e2_eq_"     ,            -2,2,0.5,exp2(a=b), "a,b") \
+/*1166*/ o(FTFF1,t12"e2_ex_"     ,            -2,2,0.5,exp2(exp(a)), "a") \
+/*1167*/ o(FTFF2,t12"e2_exl_"    ,            -2,2,0.5,exp2(exp(a!=b)), "a,b") \
+/*1168*/ o(FTFF1,t12"e2_h1x_r"   ,            -2,2,0.5,exp2(hypot(1,a)), "a") \
+/*1169*/ o(FTFF1,t12"e2_h2x_r"   ,            -2,2,0.5,exp2(hypot(2,a)), "a") \
+/*1170*/ o(FTFF2,t12"e2_h_r"     ,            -2,2,0.5,exp2(hypot(a,b)), "a,b") \
+/*1171*/ o(FTFF1,t12"e2_hx1_r"   ,            -2,2,0.5,exp2(hypot(a,1)), "a") \
+/*1172*/ o(FTFF1,t12"e2_hx2_r"   ,            -2,2,0.5,exp2(hypot(a,2)), "a") \
+/*1173*/ o(FTFF2,t12"e2_ia2_r"   ,              -3,3,2,exp2(1/atan2(a,b)), "a,b") \
+/*1174*/ o(FTFF2,t12"e2_iatd_r"  ,              -3,3,2,exp2(1/atan(a/b)), "a,b") \
+/*1175*/ o(FTFF1,t12"e2_ih1x_r"  ,            -2,2,0.5,exp2(1/hypot(1,a)), "a") \
+/*1176*/ o(FTFF1,t12"e2_ih2x_r"  ,            -2,2,0.5,exp2(1/hypot(2,a)), "a") \
+/*1177*/ o(FTFF2,t12"e2_ih_r"    ,              -3,3,2,exp2(1/hypot(a,b)), "a,b") \
+/*1178*/ o(FTFF1,t12"e2_ihx1_r"  ,            -2,2,0.5,exp2(1/hypot(a,1)), "a") \
+/*1179*/ o(FTFF1,t12"e2_ihx2_r"  ,            -2,2,0.5,exp2(1/hypot(a,2)), "a") \
+/*1180*/ o(FTFF1,t12"e2_l2_r"    ,           0.5,2,0.5,exp2(log2(a)), "a") \
+/*1181*/ o(FTFF1,t12"e2_l_r"     ,           0.5,2,0.5,exp2(log(a)), "a") \
+/*1182*/ o(FTFF1,t12"e2_lt_r"    ,           0.5,2,0.5,exp2(log10(a)), "a") \
+/*1183*/ o(FTFF2,t12"e2_ne_"     ,            -2,2,0.5,exp2(a!=b), "a,b") \
+/*1184*/ o(FTFF1,t12"e2_o_"      ,              -3,3,2,exp2(cot(a)), "a") \
+/*1185*/ o(FTFF2,t12"e2_p_"      ,           0.5,2,0.5,exp2(pow(a,b)), "a,b") \
+/*1186*/ o(FTFF1,t12"e2_s_"      ,            -2,2,0.5,exp2(sin(a)), "a") \
+/*1187*/ o(FTFF1,t12"e2_sh_"     ,            -2,2,0.5,exp2(sinh(a)), "a") \
+/*1188*/ o(FTFF2,t12"e2_shl_"    ,            -2,2,0.5,exp2(sinh(a!=b)), "a,b") \
+/*1189*/ o(FTFF2,t12"e2_sl_"     ,            -2,2,0.5,exp2(sin(a!=b)), "a,b") \
+/*1190*/ o(FTFF1,t12"e2_sq_r"    ,             0,2,0.5,exp2(sqrt(a)), "a") \
+/*1191*/ o(FTFF2,t12"e2_sql_r"   ,            -2,2,0.5,exp2(sqrt(a!=b)), "a,b") \
+/*1192*/ o(FTFF1,t12"e2_t_r"     ,            -2,2,0.5,exp2(tan(a)), "a") \
+/*1193*/ o(FTFF1,t12"e2_th_r"    ,            -2,2,0.5,exp2(tanh(a)), "a") \
+/*1194*/ o(FTFF2,t12"e2_thl_r"   ,            -2,2,0.5,exp2(tanh(a!=b)), "a,b") \
+/*1195*/ o(FTFF2,t12"e2_tl_r"    ,            -2,2,0.5,exp2(tan(a!=b)), "a,b") \
+/*1196*/ o(FTFF2,t12"e_a2_r"     ,              -3,3,2,sec(atan2(a,b)), "a,b") \
+/*1197*/ o(FTFF1,t12"e_a_"       ,              -3,3,2,sec(csc(a)), "a") \
+/*1198*/ o(FTFF1,t12"e_ac_r"     ,          0.5,1,0.25,sec(acos(a)), "a") \
+/*1199*/ o(FTFF1,t12"e_ach_r"    ,           0.5,2,0.5,sec(acosh((a+0.6))), "a") \
+/*1200*/ o(FTFF1,t12"e_as_r"     ,     -0.75,0.75,0.25,sec(asin(a)), "a") \
+/*1201*/ o(FTFF1,t12"e_ash_r"    ,            -2,2,0.5,sec(asinh(a)), "a") \
+/*1202*/ o(FTFF2,t12"e_ashl_"    ,            -2,2,0.5,sec(asinh(a!=b)), "a,b") \
+/*1203*/ o(FTFF1,t12"e_at_r"     ,            -2,2,0.5,sec(atan(a)), "a") \
+/*1204*/ o(FTFF2,t12"e_atd_r"    ,              -3,3,2,sec(atan(a/b)), "a,b") \
+/*1205*/ o(FTFF1,t12"e_ath_"     ,     -0.75,0.75,0.25,sec(atanh(a)), "a") \
+/*1206*/ o(FTFF2,t12"e_atl_"     ,            -2,2,0.5,sec(atan(a!=b)), "a,b") \
+/*1207*/ o(FTFF1,t12"e_atn_r"    ,            -2,2,0.5,sec(atan(-abs(a))), "a") \
+/*1208*/ o(FTFF1,t12"e_atp_r"    ,            -2,2,0.5,sec(atan(abs(a))), "a") \
+/*1209*/ o(FTFF1,t12"e_b_"       ,            -2,2,0.5,sec(abs(a)), "a") \
+/*1210*/ o(FTFF1,t12"e_c_"       ,            -2,2,0.5,sec(cos(a)), "a") \
+/*1211*/ o(FTFF1,t12"e_cb_r"     ,             0,2,0.5,sec(cbrt(a)), "a") \
+/*1212*/ o(FTFF2,t12"e_cbl_r"    ,            -2,2,0.5,sec(cbrt(a!=b)), "a,b") \
+/*1213*/ o(FTFF1,t12"e_ch_"      ,            -2,2,0.5,sec(cosh(a)), "a") \
+/*1214*/ o(FTFF2,t12"e_chl_"     ,            -2,2,0.5,sec(cosh(a!=b)), "a,b") \
+/*1215*/ o(FTFF2,t12"e_cl_"      ,            -2,2,0.5,sec(cos(a!=b)), "a,b") \
+/*1216*/ o(FTFF1,t12"e_e2_"      ,            -2,2,0.5,sec(exp2(a)), "a") \
+/*1217*/ o(FTFF2,t12"e_e2l_"     ,            -2,2,0.5,sec(exp2(a!=b)), "a,b") \
+/*1218*/ o(FTFF1,t12"e_e_"       ,           -1,1,0.25,sec(sec(a)), "a") \
+/*1219*/ o(FTFF2,t12"e_el_"      ,            -2,2,0.5,sec(sec(a!=b)), "a,b") \
+/*1220*/ o(FTFF2,t12"e_eq_"      ,            -2,2,0.5,sec(a=b), "a,b") \
+/*1221*/ o(FTFF1,t12"e_ex_"      ,            -2,2,0.5,sec(exp(a)), "a") \
+/*1222*/ o(FTFF2,t12"e_exl_"     ,            -2,2,0.5,sec(exp(a!=b)), "a,b") \
+/*1223*/ o(FTFF1,t12"e_h1x_r"    ,            -2,2,0.5,sec(hypot(1,a)), "a") \
+/*1224*/ o(FTFF1,t12"e_h2x_r"    ,            -2,2,0.5,sec(hypot(2,a)), "a") \
+/*1225*/ o(FTFF2,t12"e_h_r"      ,            -2,2,0.5,sec(hypot(a,b)), "a,b") \
+/*1226*/ o(FTFF1,t12"e_hx1_r"    ,            -2,2,0.5,sec(hypot(a,1)), "a") \
+/*1227*/ o(FTFF1,t12"e_hx2_r"    ,            -2,2,0.5,sec(hypot(a,2)), "a") \
+/*1228*/ o(FTFF2,t12"e_ia2_r"    ,              -3,3,2,sec(1/atan2(a,b)), "a,b") \
+/*1229*/ o(FTFF2,t12"e_iatd_r"   ,              -3,3,2,sec(1/atan(a/b)), "a,b") \
+/*1230*/ o(FTFF1,t12"e_ih1x_r"   ,            -2,2,0.5,sec(1/hypot(1,a)), "a") \
+/*1231*/ o(FTFF1,t12"e_ih2x_r"   ,            -2,2,0.5,sec(1/hypot(2,a)), "a") \
+/*1232*/ o(FTFF2,t12"e_ih_r"     ,              -3,3,2,sec(1/hypot(a,b)), "a,b") \
+/*1233*/ o(FTFF1,t12"e_ihx1_r"   ,            -2,2,0.5,sec(1/hypot(a,1)), "a") \
+/*1234*/ o(FTFF1,t12"e_ihx2_r"   ,            -2,2,0.5,sec(1/hypot(a,2)), "a") \
+/*1235*/ o(FTFF1,t12"e_l2_r"     ,           0.5,2,0.5,sec(log2(a)), "a") \
+/*1236*/ o(FTFF1,t12"e_l_r"      ,           0.5,2,0.5,sec(log(a)), "a") \
+/*1237*/ o(FTFF1,t12"e_lt_r"     ,           0.5,2,0.5,sec(log10(a)), "a") \
+/*1238*/ o(FTFF2,t12"e_ne_"      ,            -2,2,0.5,sec(a!=b), "a,b") \
+/*1239*/ o(FTFF1,t12"e_o_"       ,              -3,3,2,sec(cot(a)), "a") \
+/*1240*/ o(FTFF2,t12"e_p_"       ,           0.5,2,0.5,sec(pow(a,b)), "a,b") \
+/*1241*/ o(FTFF1,t12"e_s_"       ,            -2,2,0.5,sec(sin(a)), "a") \
+/*1242*/ o(FTFF1,t12"e_sh_"      ,            -2,2,0.5,sec(sinh(a)), "a") \
+/*1243*/ o(FTFF2,t12"e_shl_"     ,            -2,2,0.5,sec(sinh(a!=b)), "a,b") \
+/*1244*/ o(FTFF2,t12"e_sl_"      ,            -2,2,0.5,sec(sin(a!=b)), "a,b") \
+/*1245*/ o(FTFF1,t12"e_sq_r"     ,             0,2,0.5,sec(sqrt(a)), "a") \
+/*1246*/ o(FTFF2,t12"e_sql_r"    ,            -2,2,0.5,sec(sqrt(a!=b)), "a,b") \
+/*1247*/ o(FTFF1,t12"e_t_r"      ,            -2,2,0.5,sec(tan(a)), "a") \
+/*1248*/ o(FTFF1,t12"e_th_r"     ,            -2,2,0.5,sec(tanh(a)), "a") \
+/*1249*/ o(FTFF2,t12"e_thl_r"    ,            -2,2,0.5,sec(tanh(a!=b)), "a,b") \
+/*1250*/ o(FTFF2,t12"e_tl_r"     ,            -2,2,0.5,sec(tan(a!=b)), "a,b") \
+/*1251*/ o(FTFF2,t12"ex_a2_r"    ,            -2,2,0.5,exp(atan2(a,b)), "a,b") \
+/*1252*/ o(FTFF1,t12"ex_a_"      ,              -3,3,2,exp(csc(a)), "a") \
+/*1253*/ o(FTFF1,t12"ex_ac_r"    ,            -1,1,0.5,exp(acos(a)), "a") \
+/*1254*/ o(FTFF1,t12"ex_ach_r"   ,           0.5,2,0.5,exp(acosh((a+0.6))), "a") \
+/*1255*/ o(FTFF2,t12"ex_acl_r"   ,            -2,2,0.5,exp(acos(a!=b)), "a,b") \
+/*1256*/ o(FTFF1,t12"ex_as_r"    ,            -1,1,0.5,exp(asin(a)), "a") \
+/*1257*/ o(FTFF1,t12"ex_ash_r"   ,            -2,2,0.5,exp(asinh(a)), "a") \
+/*1258*/ o(FTFF2,t12"ex_ashl_"   ,            -2,2,0.5,exp(asinh(a!=b)), "a,b") \
+/*1259*/ o(FTFF2,t12"ex_asl_r"   ,            -2,2,0.5,exp(asin(a!=b)), "a,b") \
+/*1260*/ o(FTFF1,t12"ex_at_r"    ,            -2,2,0.5,exp(atan(a)), "a") \
+/*1261*/ o(FTFF2,t12"ex_atd_r"   ,              -3,3,2,exp(atan(a/b)), "a,b") \
+/*1262*/ o(FTFF1,t12"ex_ath_"    ,     -0.75,0.75,0.25,exp(atanh(a)), "a") \
+/*1263*/ o(FTFF2,t12"ex_atl_"    ,            -2,2,0.5,exp(atan(a!=b)), "a,b") \
+/*1264*/ o(FTFF1,t12"ex_atn_r"   ,            -2,2,0.5,exp(atan(-abs(a))), "a") \
+/*1265*/ o(FTFF1,t12"ex_atp_r"   ,            -2,2,0.5,exp(atan(abs(a))), "a") \
+/*1266*/ o(FTFF1,t12"ex_b_"      ,            -2,2,0.5,exp(abs(a)), "a") \
+/*1267*/ o(FTFF1,t12"ex_c_"      ,            -2,2,0.5,exp(cos(a)), "a") \
+/*1268*/ o(FTFF1,t12"ex_cb_r"    ,             0,2,0.5,exp(cbrt(a)), "a") \
+/*1269*/ o(FTFF2,t12"ex_cbl_r"   ,            -2,2,0.5,exp(cbrt(a!=b)), "a,b") \
+/*1270*/ o(FTFF1,t12"ex_ch_"     ,            -2,2,0.5,exp(cosh(a)), "a") \
+/*1271*/ o(FTFF2,t12"ex_chl_"    ,            -2,2,0.5,exp(cosh(a!=b)), "a,b") \
+/*1272*/ o(FTFF2,t12"ex_cl_"     ,            -2,2,0.5,exp(cos(a!=b)), "a,b") \
+/*1273*/ o(FTFF1,t12"ex_e2_"     ,            -2,2,0.5,exp(exp2(a)), "a") \
+/*1274*/ o(FTFF2,t12"ex_e2l_"    ,            -2,2,0.5,exp(exp2(a!=b)), "a,b") \
+/*1275*/ o(FTFF1,t12"ex_e_"      ,            -2,2,0.5,exp(sec(a)), "a") \
+/*1276*/ o(FTFF2,t12"ex_el_"     ,            -2,2,0.5,exp(sec(a!=b)), "a,b") \
+/*1277*/ o(FTFF2,t12"ex_eq_"     ,            -2,2,0.5,exp(a=b), "a,b") \
+/*1278*/ o(FTFF1,t12"ex_ex_"     ,            -2,2,0.5,exp(exp(a)), "a") \
+/*1279*/ o(FTFF2,t12"ex_exl_"    ,            -2,2,0.5,exp(exp(a!=b)), "a,b") \
+/*1280*/ o(FTFF1,t12"ex_h1x_r"   ,            -2,2,0.5,exp(hypot(1,a)), "a") \
+/*1281*/ o(FTFF1,t12"ex_h2x_r"   ,            -2,2,0.5,exp(hypot(2,a)), "a") \
+/*1282*/ o(FTFF2,t12"ex_h_r"     ,            -2,2,0.5,exp(hypot(a,b)), "a,b") \
+/*1283*/ o(FTFF1,t12"ex_hx1_r"   ,            -2,2,0.5,exp(hypot(a,1)), "a") \
+/*1284*/ o(FTFF1,t12"ex_hx2_r"   ,            -2,2,0.5,exp(hypot(a,2)), "a") \
+/*1285*/ o(FTFF2,t12"ex_ia2_r"   ,              -3,3,2,exp(1/atan2(a,b)), "a,b") \
+/*1286*/ o(FTFF2,t12"ex_iatd_r"  ,              -3,3,2,exp(1/atan(a/b)), "a,b") \
+/*1287*/ o(FTFF1,t12"ex_ih1x_r"  ,            -2,2,0.5,exp(1/hypot(1,a)), "a") \
+/*1288*/ o(FTFF1,t12"ex_ih2x_r"  ,            -2,2,0.5,exp(1/hypot(2,a)), "a") \
+/*1289*/ o(FTFF2,t12"ex_ih_r"    ,              -3,3,2,exp(1/hypot(a,b)), "a,b") \
+/*1290*/ o(FTFF1,t12"ex_ihx1_r"  ,            -2,2,0.5,exp(1/hypot(a,1)), "a") \
+/*1291*/ o(FTFF1,t12"ex_ihx2_r"  ,            -2,2,0.5,exp(1/hypot(a,2)), "a") \
+/*1292*/ o(FTFF1,t12"ex_l2_r"    ,           0.5,2,0.5,exp(log2(a)), "a") \
+/*1293*/ o(FTFF1,t12"ex_l_r"     ,           0.5,2,0.5,exp(log(a)), "a") \
+/*1294*/ o(FTFF1,t12"ex_lt_r"    ,           0.5,2,0.5,exp(log10(a)), "a") \
+/*1295*/ o(FTFF2,t12"ex_ne_"     ,            -2,2,0.5,exp(a!=b), "a,b") \
+/*1296*/ o(FTFF1,t12"ex_o_"      ,              -3,3,2,exp(cot(a)), "a") \
+/*1297*/ o(FTFF2,t12"ex_p_"      ,           0.5,2,0.5,exp(pow(a,b)), "a,b") \
+/*1298*/ o(FTFF1,t12"ex_s_"      ,            -2,2,0.5,exp(sin(a)), "a") \
+/*1299*/ o(FTFF1,t12"ex_sh_"     ,            -2,2,0.5,exp(sinh(a)), "a") \
+/*1300*/ o(FTFF2,t12"ex_shl_"    ,            -2,2,0.5,exp(sinh(a!=b)), "a,b") \
+/*1301*/ o(FTFF2,t12"ex_sl_"     ,            -2,2,0.5,exp(sin(a!=b)), "a,b") \
+/*1302*/ o(FTFF1,t12"ex_sq_r"    ,             0,2,0.5,exp(sqrt(a)), "a") \
+/*1303*/ o(FTFF2,t12"ex_sql_r"   ,            -2,2,0.5,exp(sqrt(a!=b)), "a,b") \
+/*1304*/ o(FTFF1,t12"ex_t_r"     ,            -2,2,0.5,exp(tan(a)), "a") \
+/*1305*/ o(FTFF1,t12"ex_th_r"    ,            -2,2,0.5,exp(tanh(a)), "a") \
+/*1306*/ o(FTFF2,t12"ex_thl_r"   ,            -2,2,0.5,exp(tanh(a!=b)), "a,b") \
+/*1307*/ o(FTFF2,t12"ex_tl_r"    ,            -2,2,0.5,exp(tan(a!=b)), "a,b") \
+/*1308*/ o(FTFF2,t12"l2_a2_r"    ,           0.5,2,0.5,log2(atan2(a,b)), "a,b") \
+/*1309*/ o(FTFF1,t12"l2_a_r"     ,           0.5,2,0.5,log2(csc(a)), "a") \
+/*1310*/ o(FTFF1,t12"l2_ac_r"    ,     -0.75,0.75,0.25,log2(acos(a)), "a") \
+/*1311*/ o(FTFF1,t12"l2_ach_r"   ,           0.5,2,0.5,log2(acosh((a+0.6))), "a") \
+/*1312*/ o(FTFF1,t12"l2_as_r"    ,          0.5,1,0.25,log2(asin(a)), "a") \
+/*1313*/ o(FTFF1,t12"l2_ash_r"   ,           0.5,2,0.5,log2(asinh(a)), "a") \
+/*1314*/ o(FTFF1,t12"l2_at_r"    ,           0.5,2,0.5,log2(atan(a)), "a") \
+/*1315*/ o(FTFF2,t12"l2_atd_r"   ,           0.5,2,0.5,log2(atan(a/b)), "a,b") \
+/*1316*/ o(FTFF1,t12"l2_ath_r"   ,     0.25,0.75,0.125,log2(atanh(a)), "a") \
+/*1317*/ o(FTFF1,t12"l2_atp_r"   ,              -3,3,2,log2(atan(abs(a))), "a") \
+/*1318*/ o(FTFF1,t12"l2_b_"      ,              -3,3,2,log2(abs(a)), "a") \
+/*1319*/ o(FTFF1,t12"l2_c_"      ,            -1,1,0.5,log2(cos(a)), "a") \
+/*1320*/ o(FTFF1,t12"l2_cb_r"    ,           0.5,2,0.5,log2(cbrt(a)), "a") \
+/*1321*/ o(FTFF1,t12"l2_ch_r"    ,            -2,2,0.5,log2(cosh(a)), "a") \
+/*1322*/ o(FTFF2,t12"l2_chl_"    ,            -2,2,0.5,log2(cosh(a!=b)), "a,b") \
+/*1323*/ o(FTFF2,t12"l2_cl_"     ,            -2,2,0.5,log2(cos(a!=b)), "a,b") \
+/*1324*/ o(FTFF1,t12"l2_e2_r"    ,            -2,2,0.5,log2(exp2(a)), "a") \
+/*1325*/ o(FTFF2,t12"l2_e2l_"    ,            -2,2,0.5,log2(exp2(a!=b)), "a,b") \
+/*1326*/ o(FTFF1,t12"l2_e_"      ,            -1,1,0.5,log2(sec(a)), "a") \
+/*1327*/ o(FTFF2,t12"l2_el_"     ,            -2,2,0.5,log2(sec(a!=b)), "a,b") \
+/*1328*/ o(FTFF1,t12"l2_ex_"     ,            -2,2,0.5,log2(exp(a)), "a") \
+/*1329*/ o(FTFF2,t12"l2_exl_"    ,            -2,2,0.5,log2(exp(a!=b)), "a,b") \
+/*1330*/ o(FTFF1,t12"l2_h1x_r"   ,            -2,2,0.5,log2(hypot(1,a)), "a") \
+/*1331*/ o(FTFF1,t12"l2_h2x_r"   ,            -2,2,0.5,log2(hypot(2,a)), "a") \
+/*1332*/ o(FTFF2,t12"l2_h_r"     ,              -3,3,2,log2(hypot(a,b)), "a,b") \
+/*1333*/ o(FTFF1,t12"l2_hx1_r"   ,            -2,2,0.5,log2(hypot(a,1)), "a") \
+/*1334*/ o(FTFF1,t12"l2_hx2_r"   ,            -2,2,0.5,log2(hypot(a,2)), "a") \
+/*1335*/ o(FTFF2,t12"l2_ia2_r"   ,           0.5,2,0.5,log2(1/atan2(a,b)), "a,b") \
+/*1336*/ o(FTFF2,t12"l2_iatd_r"  ,           0.5,2,0.5,log2(1/atan(a/b)), "a,b") \
+/*1337*/ o(FTFF1,t12"l2_ih1x_r"  ,            -2,2,0.5,log2(1/hypot(1,a)), "a") \
+/*1338*/ o(FTFF1,t12"l2_ih2x_r"  ,            -2,2,0.5,log2(1/hypot(2,a)), "a") \
+/*1339*/ o(FTFF2,t12"l2_ih_r"    ,              -3,3,2,log2(1/hypot(a,b)), "a,b") \
+/*1340*/ o(FTFF1,t12"l2_ihx1_r"  ,            -2,2,0.5,log2(1/hypot(a,1)), "a") \
+/*1341*/ o(FTFF1,t12"l2_ihx2_r"  ,            -2,2,0.5,log2(1/hypot(a,2)), "a") \
+/*1342*/ o(FTFF1,t12"l2_l2_r"    ,           0.5,2,0.5,log2(log2((a+0.6))), "a") \
+/*1343*/ o(FTFF1,t12"l2_l_r"     ,           0.5,2,0.5,log2(log((a+0.6))), "a") \
+/*1344*/ o(FTFF1,t12"l2_lt_r"    ,           0.5,2,0.5,log2(log10((a+0.6))), "a") \
+/*1345*/ o(FTFF1,t12"l2_o_r"     ,          0.5,1,0.25,log2(cot(a)), "a") \
+/*1346*/ o(FTFF2,t12"l2_p_r"     ,           0.5,2,0.5,log2(pow(a,b)), "a,b") \
+/*1347*/ o(FTFF1,t12"l2_s_r"     ,           0.5,2,0.5,log2(sin(a)), "a") \
+/*1348*/ o(FTFF1,t12"l2_sh_r"    ,           0.5,2,0.5,log2(sinh(a)), "a") \
+/*1349*/ o(FTFF1,t12"l2_sq_r"    ,           0.5,2,0.5,log2(sqrt(a)), "a") \
+/*1350*/ o(FTFF1,t12"l2_t_r"     ,          0.5,1,0.25,log2(tan(a)), "a") \
+/*1351*/ o(FTFF1,t12"l2_th_r"    ,           0.5,2,0.5,log2(tanh(a)), "a") \
+/*1352*/ o(FTFF2,t12"l_a2_r"     ,           0.5,2,0.5,log(atan2(a,b)), "a,b") \
+/*1353*/ o(FTFF1,t12"l_a_r"      ,           0.5,2,0.5,log(csc(a)), "a") \
+/*1354*/ o(FTFF1,t12"l_ac_r"     ,     -0.75,0.75,0.25,log(acos(a)), "a") \
+/*1355*/ o(FTFF1,t12"l_ach_r"    ,           0.5,2,0.5,log(acosh((a+0.6))), "a") \
+/*1356*/ o(FTFF1,t12"l_as_r"     ,          0.5,1,0.25,log(asin(a)), "a") \
+/*1357*/ o(FTFF1,t12"l_ash_r"    ,           0.5,2,0.5,log(asinh(a)), "a") \
+/*1358*/ o(FTFF1,t12"l_at_r"     ,           0.5,2,0.5,log(atan(a)), "a") \
+/*1359*/ o(FTFF2,t12"l_atd_r"    ,           0.5,2,0.5,log(atan(a/b)), "a,b") \
+/*1360*/ o(FTFF1,t12"l_ath_r"    ,     0.25,0.75,0.125,log(atanh(a)), "a") \
+/*1361*/ o(FTFF1,t12"l_atp_r"    ,              -3,3,2,log(atan(abs(a))), "a") \
+/*1362*/ o(FTFF1,t12"l_b_"       ,              -3,3,2,log(abs(a)), "a") \
+/*1363*/ o(FTFF1,t12"l_c_"       ,            -1,1,0.5,log(cos(a)), "a") \
+/*1364*/ o(FTFF1,t12"l_cb_r"     ,           0.5,2,0.5,log(cbrt(a)), "a") \
+/*1365*/ o(FTFF1,t12"l_ch_r"     ,            -2,2,0.5,log(cosh(a)), "a") \
+/*1366*/ o(FTFF2,t12"l_chl_"     ,            -2,2,0.5,log(cosh(a!=b)), "a,b") \
+/*1367*/ o(FTFF2,t12"l_cl_"      ,            -2,2,0.5,log(cos(a!=b)), "a,b") \
+/*1368*/ o(FTFF1,t12"l_e2_r"     ,            -2,2,0.5,log(exp2(a)), "a") \
+/*1369*/ o(FTFF2,t12"l_e2l_"     ,            -2,2,0.5,log(exp2(a!=b)), "a,b") \
+/*1370*/ o(FTFF1,t12"l_e_"       ,            -1,1,0.5,log(sec(a)), "a") \
+/*1371*/ o(FTFF2,t12"l_el_"      ,            -2,2,0.5,log(sec(a!=b)), "a,b") \
+/*1372*/ o(FTFF1,t12"l_ex_"      ,            -2,2,0.5,log(exp(a)), "a") \
+/*1373*/ o(FTFF2,t12"l_exl_"     ,            -2,2,0.5,log(exp(a!=b)), "a,b") \
+/*1374*/ o(FTFF1,t12"l_h1x_r"    ,            -2,2,0.5,log(hypot(1,a)), "a") \
+/*1375*/ o(FTFF1,t12"l_h2x_r"    ,            -2,2,0.5,log(hypot(2,a)), "a") \
+/*1376*/ o(FTFF2,t12"l_h_r"      ,              -3,3,2,log(hypot(a,b)), "a,b") \
+/*1377*/ o(FTFF1,t12"l_hx1_r"    ,            -2,2,0.5,log(hypot(a,1)), "a") \
+/*1378*/ o(FTFF1,t12"l_hx2_r"    ,            -2,2,0.5,log(hypot(a,2)), "a") \
+/*1379*/ o(FTFF2,t12"l_ia2_r"    ,           0.5,2,0.5,log(1/atan2(a,b)), "a,b") \
+/*1380*/ o(FTFF2,t12"l_iatd_r"   ,           0.5,2,0.5,log(1/atan(a/b)), "a,b") \
+/*1381*/ o(FTFF1,t12"l_ih1x_r"   ,            -2,2,0.5,log(1/hypot(1,a)), "a") \
+/*1382*/ o(FTFF1,t12"l_ih2x_r"   ,            -2,2,0.5,log(1/hypot(2,a)), "a") \
+/*1383*/ o(FTFF2,t12"l_ih_r"     ,              -3,3,2,log(1/hypot(a,b)), "a,b") \
+/*1384*/ o(FTFF1,t12"l_ihx1_r"   ,            -2,2,0.5,log(1/hypot(a,1)), "a") \
+/*1385*/ o(FTFF1,t12"l_ihx2_r"   ,            -2,2,0.5,log(1/hypot(a,2)), "a") \
+/*1386*/ o(FTFF1,t12"l_l2_r"     ,           0.5,2,0.5,log(log2((a+0.6))), "a") \
+/*1387*/ o(FTFF1,t12"l_l_r"      ,           0.5,2,0.5,log(log((a+0.6))), "a") \
+/*1388*/ o(FTFF1,t12"l_lt_r"     ,           0.5,2,0.5,log(log10((a+0.6))), "a") \
+/*1389*/ o(FTFF1,t12"l_o_r"      ,          0.5,1,0.25,log(cot(a)), "a") \
+/*1390*/ o(FTFF2,t12"l_p_r"      ,           0.5,2,0.5,log(pow(a,b)), "a,b") \
+/*1391*/ o(FTFF1,t12"l_s_r"      ,           0.5,2,0.5,log(sin(a)), "a") \
+/*1392*/ o(FTFF1,t12"l_sh_r"     ,           0.5,2,0.5,log(sinh(a)), "a") \
+/*1393*/ o(FTFF1,t12"l_sq_r"     ,           0.5,2,0.5,log(sqrt(a)), "a") \
+/*1394*/ o(FTFF1,t12"l_t_r"      ,          0.5,1,0.25,log(tan(a)), "a") \
+/*1395*/ o(FTFF1,t12"l_th_r"     ,           0.5,2,0.5,log(tanh(a)), "a") \
+/*1396*/ o(FTFF2,t12"lt_a2_r"    ,           0.5,2,0.5,log10(atan2(a,b)), "a,b") \
+/*1397*/ o(FTFF1,t12"lt_a_r"     ,           0.5,2,0.5,log10(csc(a)), "a") \
+/*1398*/ o(FTFF1,t12"lt_ac_r"    ,     -0.75,0.75,0.25,log10(acos(a)), "a") \
+/*1399*/ o(FTFF1,t12"lt_ach_r"   ,           0.5,2,0.5,log10(acosh((a+0.6))), "a") \
+/*1400*/ o(FTFF1,t12"lt_as_r"    ,          0.5,1,0.25,log10(asin(a)), "a") \
+/*1401*/ o(FTFF1,t12"lt_ash_r"   ,           0.5,2,0.5,log10(asinh(a)), "a") \
+/*1402*/ o(FTFF1,t12"lt_at_r"    ,           0.5,2,0.5,log10(atan(a)), "a") \
+/*1403*/ o(FTFF2,t12"lt_atd_r"   ,           0.5,2,0.5,log10(atan(a/b)), "a,b") \
+/*1404*/ o(FTFF1,t12"lt_ath_r"   ,     0.25,0.75,0.125,log10(atanh(a)), "a") \
+/*1405*/ o(FTFF1,t12"lt_atp_r"   ,              -3,3,2,log10(atan(abs(a))), "a") \
+/*1406*/ o(FTFF1,t12"lt_b_"      ,              -3,3,2,log10(abs(a)), "a") \
+/*1407*/ o(FTFF1,t12"lt_c_"      ,            -1,1,0.5,log10(cos(a)), "a") \
+/*1408*/ o(FTFF1,t12"lt_cb_r"    ,           0.5,2,0.5,log10(cbrt(a)), "a") \
+/*1409*/ o(FTFF1,t12"lt_ch_r"    ,            -2,2,0.5,log10(cosh(a)), "a") \
+/*1410*/ o(FTFF2,t12"lt_chl_"    ,            -2,2,0.5,log10(cosh(a!=b)), "a,b") \
+/*1411*/ o(FTFF2,t12"lt_cl_"     ,            -2,2,0.5,log10(cos(a!=b)), "a,b") \
+/*1412*/ o(FTFF1,t12"lt_e2_r"    ,            -2,2,0.5,log10(exp2(a)), "a") \
+/*1413*/ o(FTFF2,t12"lt_e2l_"    ,            -2,2,0.5,log10(exp2(a!=b)), "a,b") \
+/*1414*/ o(FTFF1,t12"lt_e_"      ,            -1,1,0.5,log10(sec(a)), "a") \
+/*1415*/ o(FTFF2,t12"lt_el_"     ,            -2,2,0.5,log10(sec(a!=b)), "a,b") \
+/*1416*/ o(FTFF1,t12"lt_ex_"     ,            -2,2,0.5,log10(exp(a)), "a") \
+/*1417*/ o(FTFF2,t12"lt_exl_"    ,            -2,2,0.5,log10(exp(a!=b)), "a,b") \
+/*1418*/ o(FTFF1,t12"lt_h1x_r"   ,            -2,2,0.5,log10(hypot(1,a)), "a") \
+/*1419*/ o(FTFF1,t12"lt_h2x_r"   ,            -2,2,0.5,log10(hypot(2,a)), "a") \
+/*1420*/ o(FTFF2,t12"lt_h_r"     ,              -3,3,2,log10(hypot(a,b)), "a,b") \
+/*1421*/ o(FTFF1,t12"lt_hx1_r"   ,            -2,2,0.5,log10(hypot(a,1)), "a") \
+/*1422*/ o(FTFF1,t12"lt_hx2_r"   ,            -2,2,0.5,log10(hypot(a,2)), "a") \
+/*1423*/ o(FTFF2,t12"lt_ia2_r"   ,           0.5,2,0.5,log10(1/atan2(a,b)), "a,b") \
+/*1424*/ o(FTFF2,t12"lt_iatd_r"  ,           0.5,2,0.5,log10(1/atan(a/b)), "a,b") \
+/*1425*/ o(FTFF1,t12"lt_ih1x_r"  ,            -2,2,0.5,log10(1/hypot(1,a)), "a") \
+/*1426*/ o(FTFF1,t12"lt_ih2x_r"  ,            -2,2,0.5,log10(1/hypot(2,a)), "a") \
+/*1427*/ o(FTFF2,t12"lt_ih_r"    ,              -3,3,2,log10(1/hypot(a,b)), "a,b") \
+/*1428*/ o(FTFF1,t12"lt_ihx1_r"  ,            -2,2,0.5,log10(1/hypot(a,1)), "a") \
+/*1429*/ o(FTFF1,t12"lt_ihx2_r"  ,            -2,2,0.5,log10(1/hypot(a,2)), "a") \
+/*1430*/ o(FTFF1,t12"lt_l2_r"    ,           0.5,2,0.5,log10(log2((a+0.6))), "a") \
+/*1431*/ o(FTFF1,t12"lt_l_r"     ,           0.5,2,0.5,log10(log((a+0.6))), "a") \
+/*1432*/ o(FTFF1,t12"lt_lt_r"    ,           0.5,2,0.5,log10(log10((a+0.6))), "a") \
+/*1433*/ o(FTFF1,t12"lt_o_r"     ,          0.5,1,0.25,log10(cot(a)), "a") \
+/*1434*/ o(FTFF2,t12"lt_p_r"     ,           0.5,2,0.5,log10(pow(a,b)), "a,b") \
+/*1435*/ o(FTFF1,t12"lt_s_r"     ,           0.5,2,0.5,log10(sin(a)), "a") \
+/*1436*/ o(FTFF1,t12"lt_sh_r"    ,           0.5,2,0.5,log10(sinh(a)), "a") \
+/*1437*/ o(FTFF1,t12"lt_sq_r"    ,           0.5,2,0.5,log10(sqrt(a)), "a") \
+/*1438*/ o(FTFF1,t12"lt_t_r"     ,          0.5,1,0.25,log10(tan(a)), "a") \
+/*1439*/ o(FTFF1,t12"lt_th_r"    ,           0.5,2,0.5,log10(tanh(a)), "a") \
+/*1440*/ o(FTFF2,t12"o_a2_r"     ,              -3,3,2,cot(atan2(a,b)), "a,b") \
+/*1441*/ o(FTFF1,t12"o_a_"       ,              -3,3,2,cot(csc(a)), "a") \
+/*1442*/ o(FTFF1,t12"o_ac_r"     ,     0.25,0.75,0.125,cot(acos(a)), "a") \
+/*1443*/ o(FTFF1,t12"o_ach_r"    ,           0.5,2,0.5,cot(acosh((a+0.6))), "a") \
+/*1444*/ o(FTFF1,t12"o_as_r"     ,     0.25,0.75,0.125,cot(asin(a)), "a") \
+/*1445*/ o(FTFF1,t12"o_ash_"     ,              -3,3,2,cot(asinh(a)), "a") \
+/*1446*/ o(FTFF1,t12"o_at_"      ,              -3,3,2,cot(atan(a)), "a") \
+/*1447*/ o(FTFF2,t12"o_atd_r"    ,              -3,3,2,cot(atan(a/b)), "a,b") \
+/*1448*/ o(FTFF1,t12"o_ath_r"    ,     0.25,0.75,0.125,cot(atanh(a)), "a") \
+/*1449*/ o(FTFF1,t12"o_atn_r"    ,              -3,3,2,cot(atan(-abs(a))), "a") \
+/*1450*/ o(FTFF1,t12"o_atp_r"    ,              -3,3,2,cot(atan(abs(a))), "a") \
+/*1451*/ o(FTFF1,t12"o_b_"       ,              -3,3,2,cot(abs(a)), "a") \
+/*1452*/ o(FTFF1,t12"o_c_"       ,            -2,2,0.5,cot(cos(a)), "a") \
+/*1453*/ o(FTFF1,t12"o_cb_r"     ,           0.5,2,0.5,cot(cbrt(a)), "a") \
+/*1454*/ o(FTFF1,t12"o_ch_"      ,            -2,2,0.5,cot(cosh(a)), "a") \
+/*1455*/ o(FTFF2,t12"o_chl_"     ,            -2,2,0.5,cot(cosh(a!=b)), "a,b") \
+/*1456*/ o(FTFF2,t12"o_cl_"      ,            -2,2,0.5,cot(cos(a!=b)), "a,b") \
+/*1457*/ o(FTFF1,t12"o_e2_"      ,            -2,2,0.5,cot(exp2(a)), "a") \
+/*1458*/ o(FTFF2,t12"o_e2l_"     ,            -2,2,0.5,cot(exp2(a!=b)), "a,b") \
+/*1459*/ o(FTFF1,t12"o_e_"       ,            -2,2,0.5,cot(sec(a)), "a") \
+/*1460*/ o(FTFF2,t12"o_el_"      ,            -2,2,0.5,cot(sec(a!=b)), "a,b") \
+/*1461*/ o(FTFF1,t12"o_ex_"      ,            -2,2,0.5,cot(exp(a)), "a") \
+/*1462*/ o(FTFF2,t12"o_exl_"     ,            -2,2,0.5,cot(exp(a!=b)), "a,b") \
+/*1463*/ o(FTFF1,t12"o_h1x_r"    ,            -2,2,0.5,cot(hypot(1,a)), "a") \
+/*1464*/ o(FTFF1,t12"o_h2x_r"    ,            -2,2,0.5,cot(hypot(2,a)), "a") \
+/*1465*/ o(FTFF2,t12"o_h_r"      ,              -3,3,2,cot(hypot(a,b)), "a,b") \
+/*1466*/ o(FTFF1,t12"o_hx1_r"    ,            -2,2,0.5,cot(hypot(a,1)), "a") \
+/*1467*/ o(FTFF1,t12"o_hx2_r"    ,            -2,2,0.5,cot(hypot(a,2)), "a") \
+/*1468*/ o(FTFF2,t12"o_ia2_r"    ,              -3,3,2,cot(1/atan2(a,b)), "a,b") \
+/*1469*/ o(FTFF2,t12"o_iatd_r"   ,              -3,3,2,cot(1/atan(a/b)), "a,b") \
+/*1470*/ o(FTFF1,t12"o_ih1x_r"   ,            -2,2,0.5,cot(1/hypot(1,a)), "a") \
+/*1471*/ o(FTFF1,t12"o_ih2x_r"   ,            -2,2,0.5,cot(1/hypot(2,a)), "a") \
+/*1472*/ o(FTFF2,t12"o_ih_r"     ,              -3,3,2,cot(1/hypot(a,b)), "a,b") \
+/*1473*/ o(FTFF1,t12"o_ihx1_r"   ,            -2,2,0.5,cot(1/hypot(a,1)), "a") \
+/*1474*/ o(FTFF1,t12"o_ihx2_r"   ,            -2,2,0.5,cot(1/hypot(a,2)), "a") \
+/*1475*/ o(FTFF1,t12"o_l2_r"     ,       0.25,3.25,0.5,cot(log2(a)), "a") \
+/*1476*/ o(FTFF1,t12"o_l_r"      ,       0.25,3.25,0.5,cot(log(a)), "a") \
+/*1477*/ o(FTFF1,t12"o_lt_r"     ,       0.25,3.25,0.5,cot(log10(a)), "a") \
+/*1478*/ o(FTFF1,t12"o_o_"       ,              -3,3,2,cot(cot(a)), "a") \
+/*1479*/ o(FTFF2,t12"o_p_"       ,           0.5,2,0.5,cot(pow(a,b)), "a,b") \
+/*1480*/ o(FTFF1,t12"o_s_"       ,              -3,3,2,cot(sin(a)), "a") \
+/*1481*/ o(FTFF1,t12"o_sh_"      ,              -3,3,2,cot(sinh(a)), "a") \
+/*1482*/ o(FTFF1,t12"o_sq_r"     ,           0.5,2,0.5,cot(sqrt(a)), "a") \
+/*1483*/ o(FTFF1,t12"o_t_"       ,              -3,3,2,cot(tan(a)), "a") \
+/*1484*/ o(FTFF1,t12"o_th_"      ,              -3,3,2,cot(tanh(a)), "a") \
+/*1485*/ o(FTFF2,t12"s_a2_r"     ,            -2,2,0.5,sin(atan2(a,b)), "a,b") \
+/*1486*/ o(FTFF1,t12"s_a_"       ,              -3,3,2,sin(csc(a)), "a") \
+/*1487*/ o(FTFF1,t12"s_ac_r"     ,            -1,1,0.5,sin(acos(a)), "a") \
+/*1488*/ o(FTFF1,t12"s_ach_r"    ,           0.5,2,0.5,sin(acosh((a+0.6))), "a") \
+/*1489*/ o(FTFF2,t12"s_acl_r"    ,            -2,2,0.5,sin(acos(a!=b)), "a,b") \
+/*1490*/ o(FTFF1,t12"s_as_r"     ,            -1,1,0.5,sin(asin(a)), "a") \
+/*1491*/ o(FTFF1,t12"s_ash_r"    ,            -2,2,0.5,sin(asinh(a)), "a") \
+/*1492*/ o(FTFF2,t12"s_ashl_"    ,            -2,2,0.5,sin(asinh(a!=b)), "a,b") \
+/*1493*/ o(FTFF2,t12"s_asl_r"    ,            -2,2,0.5,sin(asin(a!=b)), "a,b") \
+/*1494*/ o(FTFF1,t12"s_at_r"     ,            -2,2,0.5,sin(atan(a)), "a") \
+/*1495*/ o(FTFF2,t12"s_atd_r"    ,              -3,3,2,sin(atan(a/b)), "a,b") \
+/*1496*/ o(FTFF1,t12"s_ath_"     ,     -0.75,0.75,0.25,sin(atanh(a)), "a") \
+/*1497*/ o(FTFF2,t12"s_atl_"     ,            -2,2,0.5,sin(atan(a!=b)), "a,b") \
+/*1498*/ o(FTFF1,t12"s_atn_r"    ,            -2,2,0.5,sin(atan(-abs(a))), "a") \
+/*1499*/ o(FTFF1,t12"s_atp_r"    ,            -2,2,0.5,sin(atan(abs(a))), "a") \
+/*1500*/ o(FTFF1,t12"s_b_"       ,            -2,2,0.5,sin(abs(a)), "a") \
+/*1501*/ o(FTFF1,t12"s_c_"       ,            -2,2,0.5,sin(cos(a)), "a") \
+/*1502*/ o(FTFF1,t12"s_cb_r"     ,             0,2,0.5,sin(cbrt(a)), "a") \
+/*1503*/ o(FTFF2,t12"s_cbl_r"    ,            -2,2,0.5,sin(cbrt(a!=b)), "a,b") \
+/*1504*/ o(FTFF1,t12"s_ch_"      ,            -2,2,0.5,sin(cosh(a)), "a") \
+/*1505*/ o(FTFF2,t12"s_chl_"     ,            -2,2,0.5,sin(cosh(a!=b)), "a,b") \
+/*1506*/ o(FTFF2,t12"s_cl_"      ,            -2,2,0.5,sin(cos(a!=b)), "a,b") \
+/*1507*/ o(FTFF1,t12"s_e2_"      ,            -2,2,0.5,sin(exp2(a)), "a") \
+/*1508*/ o(FTFF2,t12"s_e2l_"     ,            -2,2,0.5,sin(exp2(a!=b)), "a,b") \
+/*1509*/ o(FTFF1,t12"s_e_"       ,            -2,2,0.5,sin(sec(a)), "a") \
+/*1510*/ o(FTFF2,t12"s_el_"      ,            -2,2,0.5,sin(sec(a!=b)), "a,b") \
+/*1511*/ o(FTFF2,t12"s_eq_"      ,            -2,2,0.5,sin(a=b), "a,b") \
+/*1512*/ o(FTFF1,t12"s_ex_"      ,            -2,2,0.5,sin(exp(a)), "a") \
+/*1513*/ o(FTFF2,t12"s_exl_"     ,            -2,2,0.5,sin(exp(a!=b)), "a,b") \
+/*1514*/ o(FTFF1,t12"s_h1x_r"    ,            -2,2,0.5,sin(hypot(1,a)), "a") \
+/*1515*/ o(FTFF1,t12"s_h2x_r"    ,            -2,2,0.5,sin(hypot(2,a)), "a") \
+/*1516*/ o(FTFF2,t12"s_h_r"      ,            -2,2,0.5,sin(hypot(a,b)), "a,b") \
+/*1517*/ o(FTFF1,t12"s_hx1_r"    ,            -2,2,0.5,sin(hypot(a,1)), "a") \
+/*1518*/ o(FTFF1,t12"s_hx2_r"    ,            -2,2,0.5,sin(hypot(a,2)), "a") \
+/*1519*/ o(FTFF2,t12"s_ia2_r"    ,              -3,3,2,sin(1/atan2(a,b)), "a,b") \
+/*1520*/ o(FTFF2,t12"s_iatd_r"   ,              -3,3,2,sin(1/atan(a/b)), "a,b") \
+/*1521*/ o(FTFF1,t12"s_ih1x_r"   ,            -2,2,0.5,sin(1/hypot(1,a)), "a") \
+/*1522*/ o(FTFF1,t12"s_ih2x_r"   ,            -2,2,0.5,sin(1/hypot(2,a)), "a") \
+/*1523*/ o(FTFF2,t12"s_ih_r"     ,              -3,3,2,sin(1/hypot(a,b)), "a,b") \
+/*1524*/ o(FTFF1,t12"s_ihx1_r"   ,            -2,2,0.5,sin(1/hypot(a,1)), "a") \
+/*1525*/ o(FTFF1,t12"s_ihx2_r"   ,            -2,2,0.5,sin(1/hypot(a,2)), "a") \
+/*1526*/ o(FTFF1,t12"s_l2_r"     ,           0.5,2,0.5,sin(log2(a)), "a") \
+/*1527*/ o(FTFF1,t12"s_l_r"      ,           0.5,2,0.5,sin(log(a)), "a") \
+/*1528*/ o(FTFF1,t12"s_lt_r"     ,           0.5,2,0.5,sin(log10(a)), "a") \
+/*1529*/ o(FTFF2,t12"s_ne_"      ,            -2,2,0.5,sin(a!=b), "a,b") \
+/*1530*/ o(FTFF1,t12"s_o_"       ,              -3,3,2,sin(cot(a)), "a") \
+/*1531*/ o(FTFF2,t12"s_p_"       ,           0.5,2,0.5,sin(pow(a,b)), "a,b") \
+/*1532*/ o(FTFF1,t12"s_s_"       ,            -2,2,0.5,sin(sin(a)), "a") \
+/*1533*/ o(FTFF1,t12"s_sh_"      ,            -2,2,0.5,sin(sinh(a)), "a") \
+/*1534*/ o(FTFF2,t12"s_shl_"     ,            -2,2,0.5,sin(sinh(a!=b)), "a,b") \
+/*1535*/ o(FTFF2,t12"s_sl_"      ,            -2,2,0.5,sin(sin(a!=b)), "a,b") \
+/*1536*/ o(FTFF1,t12"s_sq_r"     ,             0,2,0.5,sin(sqrt(a)), "a") \
+/*1537*/ o(FTFF2,t12"s_sql_r"    ,            -2,2,0.5,sin(sqrt(a!=b)), "a,b") \
+/*1538*/ o(FTFF1,t12"s_t_r"      ,            -2,2,0.5,sin(tan(a)), "a") \
+/*1539*/ o(FTFF1,t12"s_th_r"     ,            -2,2,0.5,sin(tanh(a)), "a") \
+/*1540*/ o(FTFF2,t12"s_thl_r"    ,            -2,2,0.5,sin(tanh(a!=b)), "a,b") \
+/*1541*/ o(FTFF2,t12"s_tl_r"     ,            -2,2,0.5,sin(tan(a!=b)), "a,b") \
+/*1542*/ o(FTFF2,t12"sh_a2_r"    ,            -2,2,0.5,sinh(atan2(a,b)), "a,b") \
+/*1543*/ o(FTFF1,t12"sh_a_"      ,              -3,3,2,sinh(csc(a)), "a") \
+/*1544*/ o(FTFF1,t12"sh_ac_r"    ,            -1,1,0.5,sinh(acos(a)), "a") \
+/*1545*/ o(FTFF1,t12"sh_ach_r"   ,           0.5,2,0.5,sinh(acosh((a+0.6))), "a") \
+/*1546*/ o(FTFF2,t12"sh_acl_r"   ,            -2,2,0.5,sinh(acos(a!=b)), "a,b") \
+/*1547*/ o(FTFF1,t12"sh_as_r"    ,            -1,1,0.5,sinh(asin(a)), "a") \
+/*1548*/ o(FTFF1,t12"sh_ash_r"   ,            -2,2,0.5,sinh(asinh(a)), "a") \
+/*1549*/ o(FTFF2,t12"sh_ashl_"   ,            -2,2,0.5,sinh(asinh(a!=b)), "a,b") \
+/*1550*/ o(FTFF2,t12"sh_asl_r"   ,            -2,2,0.5,sinh(asin(a!=b)), "a,b") \
+/*1551*/ o(FTFF1,t12"sh_at_r"    ,            -2,2,0.5,sinh(atan(a)), "a") \
+/*1552*/ o(FTFF2,t12"sh_atd_r"   ,              -3,3,2,sinh(atan(a/b)), "a,b") \
+/*1553*/ o(FTFF1,t12"sh_ath_"    ,     -0.75,0.75,0.25,sinh(atanh(a)), "a") \
+/*1554*/ o(FTFF2,t12"sh_atl_"    ,            -2,2,0.5,sinh(atan(a!=b)), "a,b") \
+/*1555*/ o(FTFF1,t12"sh_atn_r"   ,            -2,2,0.5,sinh(atan(-abs(a))), "a") \
+/*1556*/ o(FTFF1,t12"sh_atp_r"   ,            -2,2,0.5,sinh(atan(abs(a))), "a") \
+/*1557*/ o(FTFF1,t12"sh_b_"      ,            -2,2,0.5,sinh(abs(a)), "a") \
+/*1558*/ o(FTFF1,t12"sh_c_"      ,            -2,2,0.5,sinh(cos(a)), "a") \
+/*1559*/ o(FTFF1,t12"sh_cb_r"    ,             0,2,0.5,sinh(cbrt(a)), "a") \
+/*1560*/ o(FTFF2,t12"sh_cbl_r"   ,            -2,2,0.5,sinh(cbrt(a!=b)), "a,b") \
+/*1561*/ o(FTFF1,t12"sh_ch_"     ,            -2,2,0.5,sinh(cosh(a)), "a") \
+/*1562*/ o(FTFF2,t12"sh_chl_"    ,            -2,2,0.5,sinh(cosh(a!=b)), "a,b") \
+/*1563*/ o(FTFF2,t12"sh_cl_"     ,            -2,2,0.5,sinh(cos(a!=b)), "a,b") \
+/*1564*/ o(FTFF1,t12"sh_e2_"     ,            -2,2,0.5,sinh(exp2(a)), "a") \
+/*1565*/ o(FTFF2,t12"sh_e2l_"    ,            -2,2,0.5,sinh(exp2(a!=b)), "a,b") \
+/*1566*/ o(FTFF1,t12"sh_e_"      ,            -2,2,0.5,sinh(sec(a)), "a") \
+/*1567*/ o(FTFF2,t12"sh_el_"     ,            -2,2,0.5,sinh(sec(a!=b)), "a,b") \
+/*1568*/ o(FTFF2,t12"sh_eq_"     ,            -2,2,0.5,sinh(a=b), "a,b") \
+/*1569*/ o(FTFF1,t12"sh_ex_"     ,            -2,2,0.5,sinh(exp(a)), "a") \
+/*1570*/ o(FTFF2,t12"sh_exl_"    ,            -2,2,0.5,sinh(exp(a!=b)), "a,b") \
+/*1571*/ o(FTFF1,t12"sh_h1x_r"   ,            -2,2,0.5,sinh(hypot(1,a)), "a") \
+/*1572*/ o(FTFF1,t12"sh_h2x_r"   ,            -2,2,0.5,sinh(hypot(2,a)), "a") \
+/*1573*/ o(FTFF2,t12"sh_h_r"     ,            -2,2,0.5,sinh(hypot(a,b)), "a,b") \
+/*1574*/ o(FTFF1,t12"sh_hx1_r"   ,            -2,2,0.5,sinh(hypot(a,1)), "a") \
+/*1575*/ o(FTFF1,t12"sh_hx2_r"   ,            -2,2,0.5,sinh(hypot(a,2)), "a") \
+/*1576*/ o(FTFF2,t12"sh_ia2_r"   ,              -3,3,2,sinh(1/atan2(a,b)), "a,b") \
+/*1577*/ o(FTFF2,t12"sh_iatd_r"  ,              -3,3,2,sinh(1/atan(a/b)), "a,b") \
+/*1578*/ o(FTFF1,t12"sh_ih1x_r"  ,            -2,2,0.5,sinh(1/hypot(1,a)), "a") \
+/*1579*/ o(FTFF1,t12"sh_ih2x_r"  ,            -2,2,0.5,sinh(1/hypot(2,a)), "a") \
+/*1580*/ o(FTFF2,t12"sh_ih_r"    ,              -3,3,2,sinh(1/hypot(a,b)), "a,b") \
+/*1581*/ o(FTFF1,t12"sh_ihx1_r"  ,            -2,2,0.5,sinh(1/hypot(a,1)), "a") \
+/*1582*/ o(FTFF1,t12"sh_ihx2_r"  ,            -2,2,0.5,sinh(1/hypot(a,2)), "a") \
+/*1583*/ o(FTFF1,t12"sh_l2_r"    ,           0.5,2,0.5,sinh(log2(a)), "a") \
+/*1584*/ o(FTFF1,t12"sh_l_r"     ,           0.5,2,0.5,sinh(log(a)), "a") \
+/*1585*/ o(FTFF1,t12"sh_lt_r"    ,           0.5,2,0.5,sinh(log10(a)), "a") \
+/*1586*/ o(FTFF2,t12"sh_ne_"     ,            -2,2,0.5,sinh(a!=b), "a,b") \
+/*1587*/ o(FTFF1,t12"sh_o_"      ,              -3,3,2,sinh(cot(a)), "a") \
+/*1588*/ o(FTFF2,t12"sh_p_"      ,           0.5,2,0.5,sinh(pow(a,b)), "a,b") \
+/*1589*/ o(FTFF1,t12"sh_s_"      ,            -2,2,0.5,sinh(sin(a)), "a") \
+/*1590*/ o(FTFF1,t12"sh_sh_"     ,            -2,2,0.5,sinh(sinh(a)), "a") \
+/*1591*/ o(FTFF2,t12"sh_shl_"    ,            -2,2,0.5,sinh(sinh(a!=b)), "a,b") \
+/*1592*/ o(FTFF2,t12"sh_sl_"     ,            -2,2,0.5,sinh(sin(a!=b)), "a,b") \
+/*1593*/ o(FTFF1,t12"sh_sq_r"    ,             0,2,0.5,sinh(sqrt(a)), "a") \
+/*1594*/ o(FTFF2,t12"sh_sql_r"   ,            -2,2,0.5,sinh(sqrt(a!=b)), "a,b") \
+/*1595*/ o(FTFF1,t12"sh_t_r"     ,            -2,2,0.5,sinh(tan(a)), "a") \
+/*1596*/ o(FTFF1,t12"sh_th_r"    ,            -2,2,0.5,sinh(tanh(a)), "a") \
+/*1597*/ o(FTFF2,t12"sh_thl_r"   ,            -2,2,0.5,sinh(tanh(a!=b)), "a,b") \
+/*1598*/ o(FTFF2,t12"sh_tl_r"    ,            -2,2,0.5,sinh(tan(a!=b)), "a,b") \
+/*1599*/ o(FTFF2,t12"sq_a2_r"    ,             0,2,0.5,sqrt(atan2(a,b)), "a,b") \
+/*1600*/ o(FTFF1,t12"sq_a_r"     ,           0.5,2,0.5,sqrt(csc(a)), "a") \
+/*1601*/ o(FTFF1,t12"sq_ac_r"    ,            -1,1,0.5,sqrt(acos(a)), "a") \
+/*1602*/ o(FTFF1,t12"sq_ach_r"   ,           0.5,2,0.5,sqrt(acosh((a+0.6))), "a") \
+/*1603*/ o(FTFF2,t12"sq_acl_r"   ,            -2,2,0.5,sqrt(acos(a!=b)), "a,b") \
+/*1604*/ o(FTFF1,t12"sq_as_r"    ,             0,1,0.5,sqrt(asin(a)), "a") \
+/*1605*/ o(FTFF1,t12"sq_ash_r"   ,             0,2,0.5,sqrt(asinh(a)), "a") \
+/*1606*/ o(FTFF2,t12"sq_ashl_r"  ,            -2,2,0.5,sqrt(asinh(a!=b)), "a,b") \
+/*1607*/ o(FTFF2,t12"sq_asl_r"   ,            -2,2,0.5,sqrt(asin(a!=b)), "a,b") \
+/*1608*/ o(FTFF1,t12"sq_at_r"    ,             0,2,0.5,sqrt(atan(a)), "a") \
+/*1609*/ o(FTFF2,t12"sq_atd_r"   ,           0.5,2,0.5,sqrt(atan(a/b)), "a,b") \
+/*1610*/ o(FTFF1,t12"sq_ath_r"   ,         0,0.75,0.25,sqrt(atanh(a)), "a") \
+/*1611*/ o(FTFF2,t12"sq_atl_r"   ,            -2,2,0.5,sqrt(atan(a!=b)), "a,b") \
+/*1612*/ o(FTFF1,t12"sq_atp_r"   ,            -2,2,0.5,sqrt(atan(abs(a))), "a") \
+/*1613*/ o(FTFF1,t12"sq_b_r"     ,            -2,2,0.5,sqrt(abs(a)), "a") \
+/*1614*/ o(FTFF1,t12"sq_c_"      ,            -1,1,0.5,sqrt(cos(a)), "a") \
+/*1615*/ o(FTFF1,t12"sq_cb_r"    ,             0,2,0.5,sqrt(cbrt(a)), "a") \
+/*1616*/ o(FTFF2,t12"sq_cbl_r"   ,            -2,2,0.5,sqrt(cbrt(a!=b)), "a,b") \
+/*1617*/ o(FTFF1,t12"sq_ch_r"    ,            -2,2,0.5,sqrt(cosh(a)), "a") \
+/*1618*/ o(FTFF2,t12"sq_chl_"    ,            -2,2,0.5,sqrt(cosh(a!=b)), "a,b") \
+/*1619*/ o(FTFF2,t12"sq_cl_"     ,            -2,2,0.5,sqrt(cos(a!=b)), "a,b") \
+/*1620*/ o(FTFF1,t12"sq_e2_r"    ,            -2,2,0.5,sqrt(exp2(a)), "a") \
+/*1621*/ o(FTFF2,t12"sq_e2l_"    ,            -2,2,0.5,sqrt(exp2(a!=b)), "a,b") \
+/*1622*/ o(FTFF1,t12"sq_e_"      ,            -1,1,0.5,sqrt(sec(a)), "a") \
+/*1623*/ o(FTFF2,t12"sq_el_"     ,            -2,2,0.5,sqrt(sec(a!=b)), "a,b") \
+/*1624*/ o(FTFF2,t12"sq_eq_r"    ,            -2,2,0.5,sqrt(a=b), "a,b") \
+/*1625*/ o(FTFF1,t12"sq_ex_"     ,            -2,2,0.5,sqrt(exp(a)), "a") \
+/*1626*/ o(FTFF2,t12"sq_exl_"    ,            -2,2,0.5,sqrt(exp(a!=b)), "a,b") \
+/*1627*/ o(FTFF1,t12"sq_h1x_r"   ,            -2,2,0.5,sqrt(hypot(1,a)), "a") \
+/*1628*/ o(FTFF1,t12"sq_h2x_r"   ,            -2,2,0.5,sqrt(hypot(2,a)), "a") \
+/*1629*/ o(FTFF2,t12"sq_h_r"     ,            -2,2,0.5,sqrt(hypot(a,b)), "a,b") \
+/*1630*/ o(FTFF1,t12"sq_hx1_r"   ,            -2,2,0.5,sqrt(hypot(a,1)), "a") \
+/*1631*/ o(FTFF1,t12"sq_hx2_r"   ,            -2,2,0.5,sqrt(hypot(a,2)), "a") \
+/*1632*/ o(FTFF2,t12"sq_ia2_r"   ,           0.5,2,0.5,sqrt(1/atan2(a,b)), "a,b") \
+/*1633*/ o(FTFF2,t12"sq_iatd_r"  ,           0.5,2,0.5,sqrt(1/atan(a/b)), "a,b") \
+/*1634*/ o(FTFF1,t12"sq_ih1x_r"  ,            -2,2,0.5,sqrt(1/hypot(1,a)), "a") \
+/*1635*/ o(FTFF1,t12"sq_ih2x_r"  ,            -2,2,0.5,sqrt(1/hypot(2,a)), "a") \
+/*1636*/ o(FTFF2,t12"sq_ih_r"    ,              -3,3,2,sqrt(1/hypot(a,b)), "a,b") \
+/*1637*/ o(FTFF1,t12"sq_ihx1_r"  ,            -2,2,0.5,sqrt(1/hypot(a,1)), "a") \
+/*1638*/ o(FTFF1,t12"sq_ihx2_r"  ,            -2,2,0.5,sqrt(1/hypot(a,2)), "a") \
+/*1639*/ o(FTFF1,t12"sq_l2_r"    ,           0.5,2,0.5,sqrt(log2((a+0.6))), "a") \
+/*1640*/ o(FTFF1,t12"sq_l_r"     ,           0.5,2,0.5,sqrt(log((a+0.6))), "a") \
+/*1641*/ o(FTFF1,t12"sq_lt_r"    ,           0.5,2,0.5,sqrt(log10((a+0.6))), "a") \
+/*1642*/ o(FTFF2,t12"sq_ne_r"    ,            -2,2,0.5,sqrt(a!=b), "a,b") \
+/*1643*/ o(FTFF1,t12"sq_o_r"     ,          0.5,1,0.25,sqrt(cot(a)), "a") \
+/*1644*/ o(FTFF2,t12"sq_p_r"     ,           0.5,2,0.5,sqrt(pow(a,b)), "a,b") \
+/*1645*/ o(FTFF1,t12"sq_s_r"     ,             0,2,0.5,sqrt(sin(a)), "a") \
+/*1646*/ o(FTFF1,t12"sq_sh_r"    ,             0,2,0.5,sqrt(sinh(a)), "a") \
+/*1647*/ o(FTFF2,t12"sq_shl_r"   ,            -2,2,0.5,sqrt(sinh(a!=b)), "a,b") \
+/*1648*/ o(FTFF2,t12"sq_sl_r"    ,            -2,2,0.5,sqrt(sin(a!=b)), "a,b") \
+/*1649*/ o(FTFF1,t12"sq_sq_r"    ,             0,2,0.5,sqrt(sqrt(a)), "a") \
+/*1650*/ o(FTFF2,t12"sq_sql_r"   ,            -2,2,0.5,sqrt(sqrt(a!=b)), "a,b") \
+/*1651*/ o(FTFF1,t12"sq_t_r"     ,             0,1,0.5,sqrt(tan(a)), "a") \
+/*1652*/ o(FTFF1,t12"sq_th_r"    ,             0,2,0.5,sqrt(tanh(a)), "a") \
+/*1653*/ o(FTFF2,t12"sq_thl_r"   ,            -2,2,0.5,sqrt(tanh(a!=b)), "a,b") \
+/*1654*/ o(FTFF2,t12"sq_tl_r"    ,            -2,2,0.5,sqrt(tan(a!=b)), "a,b") \
+/*1655*/ o(FTFF2,t12"t_a2_r"     ,              -3,3,2,tan(atan2(a,b)), "a,b") \
+/*1656*/ o(FTFF1,t12"t_a_"       ,              -3,3,2,tan(csc(a)), "a") \
+/*1657*/ o(FTFF1,t12"t_ac_r"     ,          0.5,1,0.25,tan(acos(a)), "a") \
+/*1658*/ o(FTFF1,t12"t_ach_r"    ,           0.5,2,0.5,tan(acosh((a+0.6))), "a") \
+/*1659*/ o(FTFF1,t12"t_as_r"     ,     -0.75,0.75,0.25,tan(asin(a)), "a") \
+/*1660*/ o(FTFF1,t12"t_ash_r"    ,            -2,2,0.5,tan(asinh(a)), "a") \
+/*1661*/ o(FTFF2,t12"t_ashl_r"   ,            -2,2,0.5,tan(asinh(a!=b)), "a,b") \
+/*1662*/ o(FTFF1,t12"t_at_r"     ,            -2,2,0.5,tan(atan(a)), "a") \
+/*1663*/ o(FTFF2,t12"t_atd_r"    ,              -3,3,2,tan(atan(a/b)), "a,b") \
+/*1664*/ o(FTFF1,t12"t_ath_r"    ,     -0.75,0.75,0.25,tan(atanh(a)), "a") \
+/*1665*/ o(FTFF2,t12"t_atl_r"    ,            -2,2,0.5,tan(atan(a!=b)), "a,b") \
+/*1666*/ o(FTFF1,t12"t_atn_r"    ,            -2,2,0.5,tan(atan(-abs(a))), "a") \
+/*1667*/ o(FTFF1,t12"t_atp_r"    ,            -2,2,0.5,tan(atan(abs(a))), "a") \
+/*1668*/ o(FTFF1,t12"t_b_r"      ,            -2,2,0.5,tan(abs(a)), "a") \
+/*1669*/ o(FTFF1,t12"t_c_"       ,            -2,2,0.5,tan(cos(a)), "a") \
+/*1670*/ o(FTFF1,t12"t_cb_r"     ,             0,2,0.5,tan(cbrt(a)), "a") \
+/*1671*/ o(FTFF2,t12"t_cbl_r"    ,            -2,2,0.5,tan(cbrt(a!=b)), "a,b") \
+/*1672*/ o(FTFF1,t12"t_ch_"      ,            -2,2,0.5,tan(cosh(a)), "a") \
+/*1673*/ o(FTFF2,t12"t_chl_"     ,            -2,2,0.5,tan(cosh(a!=b)), "a,b") \
+/*1674*/ o(FTFF2,t12"t_cl_"      ,            -2,2,0.5,tan(cos(a!=b)), "a,b") \
+/*1675*/ o(FTFF1,t12"t_e2_"      ,            -2,2,0.5,tan(exp2(a)), "a") \
+/*1676*/ o(FTFF2,t12"t_e2l_"     ,            -2,2,0.5,tan(exp2(a!=b)), "a,b") \
+/*1677*/ o(FTFF1,t12"t_e_"       ,           -1,1,0.25,tan(sec(a)), "a") \
+/*1678*/ o(FTFF2,t12"t_el_"      ,            -2,2,0.5,tan(sec(a!=b)), "a,b") \
+/*1679*/ o(FTFF2,t12"t_eq_r"     ,            -2,2,0.5,tan(a=b), "a,b") \
+/*1680*/ o(FTFF1,t12"t_ex_"      ,            -2,2,0.5,tan(exp(a)), "a") \
+/*1681*/ o(FTFF2,t12"t_exl_"     ,            -2,2,0.5,tan(exp(a!=b)), "a,b") \
+/*1682*/ o(FTFF1,t12"t_h1x_r"    ,            -2,2,0.5,tan(hypot(1,a)), "a") \
+/*1683*/ o(FTFF1,t12"t_h2x_r"    ,            -2,2,0.5,tan(hypot(2,a)), "a") \
+/*1684*/ o(FTFF2,t12"t_h_r"      ,            -2,2,0.5,tan(hypot(a,b)), "a,b") \
+/*1685*/ o(FTFF1,t12"t_hx1_r"    ,            -2,2,0.5,tan(hypot(a,1)), "a") \
+/*1686*/ o(FTFF1,t12"t_hx2_r"    ,            -2,2,0.5,tan(hypot(a,2)), "a") \
+/*1687*/ o(FTFF2,t12"t_ia2_r"    ,              -3,3,2,tan(1/atan2(a,b)), "a,b") \
+/*1688*/ o(FTFF2,t12"t_iatd_r"   ,              -3,3,2,tan(1/atan(a/b)), "a,b") \
+/*1689*/ o(FTFF1,t12"t_ih1x_r"   ,            -2,2,0.5,tan(1/hypot(1,a)), "a") \
+/*1690*/ o(FTFF1,t12"t_ih2x_r"   ,            -2,2,0.5,tan(1/hypot(2,a)), "a") \
+/*1691*/ o(FTFF2,t12"t_ih_r"     ,              -3,3,2,tan(1/hypot(a,b)), "a,b") \
+/*1692*/ o(FTFF1,t12"t_ihx1_r"   ,            -2,2,0.5,tan(1/hypot(a,1)), "a") \
+/*1693*/ o(FTFF1,t12"t_ihx2_r"   ,            -2,2,0.5,tan(1/hypot(a,2)), "a") \
+/*1694*/ o(FTFF1,t12"t_l2_r"     ,           0.5,2,0.5,tan(log2(a)), "a") \
+/*1695*/ o(FTFF1,t12"t_l_r"      ,           0.5,2,0.5,tan(log(a)), "a") \
+/*1696*/ o(FTFF1,t12"t_lt_r"     ,           0.5,2,0.5,tan(log10(a)), "a") \
+/*1697*/ o(FTFF2,t12"t_ne_r"     ,            -2,2,0.5,tan(a!=b), "a,b") \
+/*1698*/ o(FTFF1,t12"t_o_"       ,              -3,3,2,tan(cot(a)), "a") \
+/*1699*/ o(FTFF2,t12"t_p_"       ,           0.5,2,0.5,tan(pow(a,b)), "a,b") \
+/*1700*/ o(FTFF1,t12"t_s_r"      ,            -2,2,0.5,tan(sin(a)), "a") \
+/*1701*/ o(FTFF1,t12"t_sh_r"     ,            -2,2,0.5,tan(sinh(a)), "a") \
+/*1702*/ o(FTFF2,t12"t_shl_r"    ,            -2,2,0.5,tan(sinh(a!=b)), "a,b") \
+/*1703*/ o(FTFF2,t12"t_sl_r"     ,            -2,2,0.5,tan(sin(a!=b)), "a,b") \
+/*1704*/ o(FTFF1,t12"t_sq_r"     ,             0,2,0.5,tan(sqrt(a)), "a") \
+/*1705*/ o(FTFF2,t12"t_sql_r"    ,            -2,2,0.5,tan(sqrt(a!=b)), "a,b") \
+/*1706*/ o(FTFF1,t12"t_t_r"      ,            -2,2,0.5,tan(tan(a)), "a") \
+/*1707*/ o(FTFF1,t12"t_th_r"     ,            -2,2,0.5,tan(tanh(a)), "a") \
+/*1708*/ o(FTFF2,t12"t_thl_r"    ,            -2,2,0.5,tan(tanh(a!=b)), "a,b") \
+/*1709*/ o(FTFF2,t12"t_tl_r"     ,            -2,2,0.5,tan(tan(a!=b)), "a,b") \
+/*1710*/ o(FTFF2,t12"th_a2_r"    ,            -2,2,0.5,tanh(atan2(a,b)), "a,b") \
+/*1711*/ o(FTFF1,t12"th_a_"      ,              -3,3,2,tanh(csc(a)), "a") \
+/*1712*/ o(FTFF1,t12"th_ac_r"    ,            -1,1,0.5,tanh(acos(a)), "a") \
+/*1713*/ o(FTFF1,t12"th_ach_r"   ,           0.5,2,0.5,tanh(acosh((a+0.6))), "a") \
+/*1714*/ o(FTFF2,t12"th_acl_r"   ,            -2,2,0.5,tanh(acos(a!=b)), "a,b") \
+/*1715*/ o(FTFF1,t12"th_as_r"    ,            -1,1,0.5,tanh(asin(a)), "a") \
+/*1716*/ o(FTFF1,t12"th_ash_r"   ,            -2,2,0.5,tanh(asinh(a)), "a") \
+/*1717*/ o(FTFF2,t12"th_ashl_r"  ,            -2,2,0.5,tanh(asinh(a!=b)), "a,b") \
+/*1718*/ o(FTFF2,t12"th_asl_r"   ,            -2,2,0.5,tanh(asin(a!=b)), "a,b") \
+/*1719*/ o(FTFF1,t12"th_at_r"    ,            -2,2,0.5,tanh(atan(a)), "a") \
+/*1720*/ o(FTFF2,t12"th_atd_r"   ,              -3,3,2,tanh(atan(a/b)), "a,b") \
+/*1721*/ o(FTFF1,t12"th_ath_r"   ,     -0.75,0.75,0.25,tanh(atanh(a)), "a") \
+/*1722*/ o(FTFF2,t12"th_atl_r"   ,            -2,2,0.5,tanh(atan(a!=b)), "a,b") \
+/*1723*/ o(FTFF1,t12"th_atn_r"   ,            -2,2,0.5,tanh(atan(-abs(a))), "a") \
+/*1724*/ o(FTFF1,t12"th_atp_r"   ,            -2,2,0.5,tanh(atan(abs(a))), "a") \
+/*1725*/ o(FTFF1,t12"th_b_r"     ,            -2,2,0.5,tanh(abs(a)), "a") \
+/*1726*/ o(FTFF1,t12"th_c_"      ,            -2,2,0.5,tanh(cos(a)), "a") \
+/*1727*/ o(FTFF1,t12"th_cb_r"    ,             0,2,0.5,tanh(cbrt(a)), "a") \
+/*1728*/ o(FTFF2,t12"th_cbl_r"   ,            -2,2,0.5,tanh(cbrt(a!=b)), "a,b") \
+/*1729*/ o(FTFF1,t12"th_ch_"     ,            -2,2,0.5,tanh(cosh(a)), "a") \
+/*1730*/ o(FTFF2,t12"th_chl_"    ,            -2,2,0.5,tanh(cosh(a!=b)), "a,b") \
+/*1731*/ o(FTFF2,t12"th_cl_"     ,            -2,2,0.5,tanh(cos(a!=b)), "a,b") \
+/*1732*/ o(FTFF1,t12"th_e2_"     ,            -2,2,0.5,tanh(exp2(a)), "a") \
+/*1733*/ o(FTFF2,t12"th_e2l_"    ,            -2,2,0.5,tanh(exp2(a!=b)), "a,b") \
+/*1734*/ o(FTFF1,t12"th_e_"      ,            -2,2,0.5,tanh(sec(a)), "a") \
+/*1735*/ o(FTFF2,t12"th_el_"     ,            -2,2,0.5,tanh(sec(a!=b)), "a,b") \
+/*1736*/ o(FTFF2,t12"th_eq_r"    ,            -2,2,0.5,tanh(a=b), "a,b") \
+/*1737*/ o(FTFF1,t12"th_ex_"     ,            -2,2,0.5,tanh(exp(a)), "a") \
+/*1738*/ o(FTFF2,t12"th_exl_"    ,            -2,2,0.5,tanh(exp(a!=b)), "a,b") \
+/*1739*/ o(FTFF1,t12"th_h1x_r"   ,            -2,2,0.5,tanh(hypot(1,a)), "a") \
+/*1740*/ o(FTFF1,t12"th_h2x_r"   ,            -2,2,0.5,tanh(hypot(2,a)), "a") \
+/*1741*/ o(FTFF2,t12"th_h_r"     ,            -2,2,0.5,tanh(hypot(a,b)), "a,b") \
+/*1742*/ o(FTFF1,t12"th_hx1_r"   ,            -2,2,0.5,tanh(hypot(a,1)), "a") \
+/*1743*/ o(FTFF1,t12"th_hx2_r"   ,            -2,2,0.5,tanh(hypot(a,2)), "a") \
+/*1744*/ o(FTFF2,t12"th_ia2_r"   ,              -3,3,2,tanh(1/atan2(a,b)), "a,b") \
+/*1745*/ o(FTFF2,t12"th_iatd_r"  ,              -3,3,2,tanh(1/atan(a/b)), "a,b") \
+/*1746*/ o(FTFF1,t12"th_ih1x_r"  ,            -2,2,0.5,tanh(1/hypot(1,a)), "a") \
+/*1747*/ o(FTFF1,t12"th_ih2x_r"  ,            -2,2,0.5,tanh(1/hypot(2,a)), "a") \
+/*1748*/ o(FTFF2,t12"th_ih_r"    ,              -3,3,2,tanh(1/hypot(a,b)), "a,b") \
+/*1749*/ o(FTFF1,t12"th_ihx1_r"  ,            -2,2,0.5,tanh(1/hypot(a,1)), "a") \
+/*1750*/ o(FTFF1,t12"th_ihx2_r"  ,            -2,2,0.5,tanh(1/hypot(a,2)), "a") \
+/*1751*/ o(FTFF1,t12"th_l2_r"    ,           0.5,2,0.5,tanh(log2(a)), "a") \
+/*1752*/ o(FTFF1,t12"th_l_r"     ,           0.5,2,0.5,tanh(log(a)), "a") \
+/*1753*/ o(FTFF1,t12"th_lt_r"    ,           0.5,2,0.5,tanh(log10(a)), "a") \
+/*1754*/ o(FTFF2,t12"th_ne_r"    ,            -2,2,0.5,tanh(a!=b), "a,b") \
+/*1755*/ o(FTFF1,t12"th_o_"      ,              -3,3,2,tanh(cot(a)), "a") \
+/*1756*/ o(FTFF2,t12"th_p_"      ,           0.5,2,0.5,tanh(pow(a,b)), "a,b") \
+/*1757*/ o(FTFF1,t12"th_s_r"     ,            -2,2,0.5,tanh(sin(a)), "a") \
+/*1758*/ o(FTFF1,t12"th_sh_r"    ,            -2,2,0.5,tanh(sinh(a)), "a") \
+/*1759*/ o(FTFF2,t12"th_shl_r"   ,            -2,2,0.5,tanh(sinh(a!=b)), "a,b") \
+/*1760*/ o(FTFF2,t12"th_sl_r"    ,            -2,2,0.5,tanh(sin(a!=b)), "a,b") \
+/*1761*/ o(FTFF1,t12"th_sq_r"    ,             0,2,0.5,tanh(sqrt(a)), "a") \
+/*1762*/ o(FTFF2,t12"th_sql_r"   ,            -2,2,0.5,tanh(sqrt(a!=b)), "a,b") \
+/*1763*/ o(FTFF1,t12"th_t_r"     ,            -2,2,0.5,tanh(tan(a)), "a") \
+/*1764*/ o(FTFF1,t12"th_th_r"    ,            -2,2,0.5,tanh(tanh(a)), "a") \
+/*1765*/ o(FTFF2,t12"th_thl_r"   ,            -2,2,0.5,tanh(tanh(a!=b)), "a,b") \
+/*1766*/ o(FTFF2,t12"th_tl_r"    ,            -2,2,0.5,tanh(tan(a!=b)), "a,b") \
+/*1767*/ o(FTFF2,t12"z_a2_r"     ,            -2,2,0.5,atan2(a,b), "a,b") \
+/*1768*/ o(FTFF1,t12"z_a_"       ,              -3,3,2,csc(a), "a") \
+/*1769*/ o(FTFF1,t12"z_ac_r"     ,            -1,1,0.5,acos(a), "a") \
+/*1770*/ o(FTFF1,t12"z_ach_r"    ,           0.5,2,0.5,acosh((a+0.6)), "a") \
+/*1771*/ o(FTFF2,t12"z_acl_r"    ,            -2,2,0.5,acos(a!=b), "a,b") \
+/*1772*/ o(FTFF1,t12"z_as_r"     ,            -1,1,0.5,asin(a), "a") \
+/*1773*/ o(FTFF1,t12"z_ash_r"    ,            -2,2,0.5,asinh(a), "a") \
+/*1774*/ o(FTFF2,t12"z_ashl_"    ,            -2,2,0.5,asinh(a!=b), "a,b") \
+/*1775*/ o(FTFF2,t12"z_asl_r"    ,            -2,2,0.5,asin(a!=b), "a,b") \
+/*1776*/ o(FTFF1,t12"z_at_r"     ,            -2,2,0.5,atan(a), "a") \
+/*1777*/ o(FTFF2,t12"z_atd_r"    ,              -3,3,2,atan(a/b), "a,b") \
+/*1778*/ o(FTFF1,t12"z_ath_"     ,     -0.75,0.75,0.25,atanh(a), "a") \
+/*1779*/ o(FTFF2,t12"z_atl_"     ,            -2,2,0.5,atan(a!=b), "a,b") \
+/*1780*/ o(FTFF1,t12"z_atn_r"    ,            -2,2,0.5,atan(-abs(a)), "a") \
+/*1781*/ o(FTFF1,t12"z_atp_r"    ,            -2,2,0.5,atan(abs(a)), "a") \
+/*1782*/ o(FTFF1,t12"z_b_"       ,            -2,2,0.5,abs(a), "a") \
+/*1783*/ o(FTFF1,t12"z_c_"       ,            -2,2,0.5,cos(a), "a") \
+/*1784*/ o(FTFF1,t12"z_cb_r"     ,             0,2,0.5,cbrt(a), "a") \
+/*1785*/ o(FTFF2,t12"z_cbl_r"    ,            -2,2,0.5,cbrt(a!=b), "a,b") \
+/*1786*/ o(FTFF1,t12"z_ch_"      ,            -2,2,0.5,cosh(a), "a") \
+/*1787*/ o(FTFF2,t12"z_chl_"     ,            -2,2,0.5,cosh(a!=b), "a,b") \
+/*1788*/ o(FTFF2,t12"z_cl_"      ,            -2,2,0.5,cos(a!=b), "a,b") \
+/*1789*/ o(FTFF1,t12"z_e2_"      ,            -2,2,0.5,exp2(a), "a") \
+/*1790*/ o(FTFF2,t12"z_e2l_"     ,            -2,2,0.5,exp2(a!=b), "a,b") \
+/*1791*/ o(FTFF1,t12"z_e_"       ,            -2,2,0.5,sec(a), "a") \
+/*1792*/ o(FTFF2,t12"z_el_"      ,            -2,2,0.5,sec(a!=b), "a,b") \
+/*1793*/ o(FTFF2,t12"z_eq_"      ,            -2,2,0.5,a=b, "a,b") \
+/*1794*/ o(FTFF1,t12"z_ex_"      ,            -2,2,0.5,exp(a), "a") \
+/*1795*/ o(FTFF2,t12"z_exl_"     ,            -2,2,0.5,exp(a!=b), "a,b") \
+/*1796*/ o(FTFF1,t12"z_h1x_r"    ,            -2,2,0.5,hypot(1,a), "a") \
+/*1797*/ o(FTFF1,t12"z_h2x_r"    ,            -2,2,0.5,hypot(2,a), "a") \
+/*1798*/ o(FTFF2,t12"z_h_r"      ,            -2,2,0.5,hypot(a,b), "a,b") \
+/*1799*/ o(FTFF1,t12"z_hx1_r"    ,            -2,2,0.5,hypot(a,1), "a") \
+/*1800*/ o(FTFF1,t12"z_hx2_r"    ,            -2,2,0.5,hypot(a,2), "a") \
+/*1801*/ o(FTFF2,t12"z_ia2_r"    ,              -3,3,2,1/atan2(a,b), "a,b") \
+/*1802*/ o(FTFF2,t12"z_iatd_r"   ,              -3,3,2,1/atan(a/b), "a,b") \
+/*1803*/ o(FTFF1,t12"z_ih1x_r"   ,            -2,2,0.5,1/hypot(1,a), "a") \
+/*1804*/ o(FTFF1,t12"z_ih2x_r"   ,            -2,2,0.5,1/hypot(2,a), "a") \
+/*1805*/ o(FTFF2,t12"z_ih_r"     ,              -3,3,2,1/hypot(a,b), "a,b") \
+/*1806*/ o(FTFF1,t12"z_ihx1_r"   ,            -2,2,0.5,1/hypot(a,1), "a") \
+/*1807*/ o(FTFF1,t12"z_ihx2_r"   ,            -2,2,0.5,1/hypot(a,2), "a") \
+/*1808*/ o(FTFF1,t12"z_l2_r"     ,           0.5,2,0.5,log2(a), "a") \
+/*1809*/ o(FTFF1,t12"z_l_r"      ,           0.5,2,0.5,log(a), "a") \
+/*1810*/ o(FTFF1,t12"z_lt_r"     ,           0.5,2,0.5,log10(a), "a") \
+/*1811*/ o(FTFF2,t12"z_ne_"      ,            -2,2,0.5,a!=b, "a,b") \
+/*1812*/ o(FTFF1,t12"z_o_"       ,              -3,3,2,cot(a), "a") \
+/*1813*/ o(FTFF2,t12"z_p_r"      ,           0.5,2,0.5,pow(a,b), "a,b") \
+/*1814*/ o(FTFF1,t12"z_s_"       ,            -2,2,0.5,sin(a), "a") \
+/*1815*/ o(FTFF1,t12"z_sh_"      ,            -2,2,0.5,sinh(a), "a") \
+/*1816*/ o(FTFF2,t12"z_shl_"     ,            -2,2,0.5,sinh(a!=b), "a,b") \
+/*1817*/ o(FTFF2,t12"z_sl_"      ,            -2,2,0.5,sin(a!=b), "a,b") \
+/*1818*/ o(FTFF1,t12"z_sq_r"     ,             0,2,0.5,sqrt(a), "a") \
+/*1819*/ o(FTFF2,t12"z_sql_r"    ,            -2,2,0.5,sqrt(a!=b), "a,b") \
+/*1820*/ o(FTFF1,t12"z_t_r"      ,            -2,2,0.5,tan(a), "a") \
+/*1821*/ o(FTFF1,t12"z_th_r"     ,            -2,2,0.5,tanh(a), "a") \
+/*1822*/ o(FTFF2,t12"z_thl_r"    ,            -2,2,0.5,tanh(a!=b), "a,b") \
+/*1823*/ o(FTFF2,t12"z_tl_r"     ,            -2,2,0.5,tan(a!=b), "a,b") \
+/*1824*/ o(FTFF1,t13"acos_2_r"   ,       -0.5,0.5,0.25,acos(a*2), "a") \
+/*1825*/ o(FTFF1,t13"acos_m1_r"  ,            -1,1,0.5,acos(a*-1), "a") \
+/*1826*/ o(FTFF1,t13"acos_m2_r"  ,       -0.5,0.5,0.25,acos(a*-2), "a") \
+/*1827*/ o(FTFF1,t13"acosh_2_r"  ,           0.5,2,0.5,acosh(a*2), "a") \
+/*1828*/ o(FTFF1,t13"acosh_m1_r", -1.8125,-1.1875,0.0625,acosh(a*-1), "a") \
+/*1829*/ o(FTFF1,t13"acosh_m2_r", -5.3125,-4.4375,0.0625,acosh(a*-2), "a") \
+/*1830*/ o(FTFF1,t13"asin_2_r"   ,       -0.5,0.5,0.25,asin(a*2), "a") \
+/*1831*/ o(FTFF1,t13"asin_m1_r"  ,            -1,1,0.5,asin(a*-1), "a") \
+/*1832*/ o(FTFF1,t13"asin_m2_r"  ,       -0.5,0.5,0.25,asin(a*-2), "a") \
+/*1833*/ o(FTFF1,t13"asinh_2_r"  ,            -2,2,0.5,asinh(a*2), "a") \
+/*1834*/ o(FTFF1,t13"asinh_m1_r" ,            -2,2,0.5,asinh(a*-1), "a") \
+/*1835*/ o(FTFF1,t13"asinh_m2_r" ,            -2,2,0.5,asinh(a*-2), "a") \
+/*1836*/ o(FTFF1,t13"atan_2_r"   ,            -2,2,0.5,atan(a*2), "a") \
+/*1837*/ o(FTFF1,t13"atan_m1_r"  ,            -2,2,0.5,atan(a*-1), "a") \
+/*1838*/ o(FTFF1,t13"atan_m2_r"  ,            -2,2,0.5,atan(a*-2), "a") \
+/*1839*/ o(FTFF1,t13"atanh_2_r"  ,     -0.25,0.25,0.05,atanh(a*2), "a") \
+/*1840*/ o(FTFF1,t13"atanh_m1_"  ,     -0.75,0.75,0.25,atanh(a*-1), "a") \
+/*1841*/ o(FTFF1,t13"atanh_m2_r" ,     -0.25,0.25,0.05,atanh(a*-2), "a") \
+/*1842*/ o(FTFF1,t13"cos_2_"     ,            -2,2,0.5,cos(a*2), "a") \
+/*1843*/ o(FTFF1,t13"cos_m1_"    ,            -2,2,0.5,cos(a*-1), "a") \
+/*1844*/ o(FTFF1,t13"cos_m2_"    ,            -2,2,0.5,cos(a*-2), "a") \
+/*1845*/ o(FTFF1,t13"cosh_2_"    ,            -2,2,0.5,cosh(a*2), "a") \
+/*1846*/ o(FTFF1,t13"cosh_m1_"   ,            -2,2,0.5,cosh(a*-1), "a") \
+/*1847*/ o(FTFF1,t13"cosh_m2_"   ,            -2,2,0.5,cosh(a*-2), "a") \
+/*1848*/ o(FTFF1,t13"cot_2_"     ,              -3,3,2,cot(a*2), "a") \
+/*1849*/ o(FTFF1,t13"cot_m1_"    ,              -3,3,2,cot(a*-1), "a") \
+/*1850*/ o(FTFF1,t13"cot_m2_"    ,              -3,3,2,cot(a*-2), "a") \
+/*1851*/ o(FTFF1,t13"csc_2_"     ,              -3,3,2,csc(a*2), "a") \
+/*1852*/ o(FTFF1,t13"csc_m1_"    ,              -3,3,2,csc(a*-1), "a") \
+/*1853*/ o(FTFF1,t13"csc_m2_"    ,              -3,3,2,csc(a*-2), "a") \
+/*1854*/ o(FTFF1,t13"sec_2_"     ,            -2,2,0.5,sec(a*2), "a") \
+/*1855*/ o(FTFF1,t13"sec_m1_"    ,            -2,2,0.5,sec(a*-1), "a") \
+/*1856*/ o(FTFF1,t13"sec_m2_"    ,            -2,2,0.5,sec(a*-2), "a") \
+/*1857*/ o(FTFF1,t13"sin_2_"     ,            -2,2,0.5,sin(a*2), "a") \
+/*1858*/ o(FTFF1,t13"sin_m1_"    ,            -2,2,0.5,sin(a*-1), "a") \
+/*1859*/ o(FTFF1,t13"sin_m2_"    ,            -2,2,0.5,sin(a*-2), "a") \
+/*1860*/ o(FTFF1,t13"sinh_2_"    ,            -2,2,0.5,sinh(a*2), "a") \
+/*1861*/ o(FTFF1,t13"sinh_m1_"   ,            -2,2,0.5,sinh(a*-1), "a") \
+/*1862*/ o(FTFF1,t13"sinh_m2_"   ,            -2,2,0.5,sinh(a*-2), "a") \
+/*1863*/ o(FTFF1,t13"tan_2_r"    ,            -2,2,0.5,tan(a*2), "a") \
+/*1864*/ o(FTFF1,t13"tan_m1_r"   ,            -2,2,0.5,tan(a*-1), "a") \
+/*1865*/ o(FTFF1,t13"tan_m2_r"   ,            -2,2,0.5,tan(a*-2), "a") \
+/*1866*/ o(FTFF1,t13"tanh_2_r"   ,            -2,2,0.5,tanh(a*2), "a") \
+/*1867*/ o(FTFF1,t13"tanh_m1_r"  ,            -2,2,0.5,tanh(a*-1), "a") \
+/*1868*/ o(FTFF1,t13"tanh_m2_r"  ,            -2,2,0.5,tanh(a*-2), "a") \
+/*1869*/ o(FTFF1,t14"mmm/ac_ac_r",            -1,1,0.5,acos(-a)-acos(-a), "a") \
+/*1870*/ o(FTFF1,t14"mmm/ac_as_r",            -1,1,0.5,acos(-a)-asin(-a), "a") \
+/*1871*/ o(FTFF1,t14"mmm/ac_ash_r",           -1,1,0.5,acos(-a)-asinh(-a), "a") \
+/*1872*/ o(FTFF1,t14"mmm/ac_at_r",            -1,1,0.5,acos(-a)-atan(-a), "a") \
+/*1873*/ o(FTFF1,t14"mmm/ac_ath_",     -0.75,0.75,0.25,acos(-a)-atanh(-a), "a") \
+/*1874*/ o(FTFF1,t14"mmm/ac_c_r" ,            -1,1,0.5,acos(-a)-cos(-a), "a") \
+/*1875*/ o(FTFF1,t14"mmm/ac_ch_r",            -1,1,0.5,acos(-a)-cosh(-a), "a") \
+/*1876*/ o(FTFF1,t14"mmm/ac_ex_r",            -1,1,0.5,acos(-a)-exp(-a), "a") \
+/*1877*/ o(FTFF1,t14"mmm/ac_l_r" ,         -1,-0.1,0.5,acos(-a)-log(-a), "a") \
+/*1878*/ o(FTFF1,t14"mmm/ac_s_r" ,            -1,1,0.5,acos(-a)-sin(-a), "a") \
+/*1879*/ o(FTFF1,t14"mmm/ac_sh_r",            -1,1,0.5,acos(-a)-sinh(-a), "a") \
+/*1880*/ o(FTFF1,t14"mmm/ac_t_r" ,            -1,1,0.5,acos(-a)-tan(-a), "a") \
+/*1881*/ o(FTFF1,t14"mmm/ac_th_r",            -1,1,0.5,acos(-a)-tanh(-a), "a") \
+/*1882*/ o(FTFF1,t14"mmm/ach_ach_r", -5.5625,-1.75,0.0625,acosh(-a)-acosh(-a), "a") \
+/*1883*/ o(FTFF1,t14"mmm/ach_ash_r", -6.25,-1.1875,0.0625,acosh(-a)-asinh(-a), "a") \
+/*1884*/ o(FTFF1,t14"mmm/ach_at_r", -5.875,-3.75,0.0625,acosh(-a)-atan(-a), "a") \
+/*1885*/ o(FTFF1,t14"mmm/ach_c_r",   -4.6875,-4,0.0625,acosh(-a)-cos(-a), "a") \
+/*1886*/ o(FTFF1,t14"mmm/ach_ch_r",    -6.25,-2,0.0625,acosh(-a)-cosh(-a), "a") \
+/*1887*/ o(FTFF1,t14"mmm/ach_ex_r", -5.9375,-2.5,0.0625,acosh(-a)-exp(-a), "a") \
+/*1888*/ o(FTFF1,t14"mmm/ach_l_r", -3.8125,-2.125,0.0625,acosh(-a)-log(-a), "a") \
+/*1889*/ o(FTFF1,t14"mmm/ach_s_r", -6.25,-4.625,0.0625,acosh(-a)-sin(-a), "a") \
+/*1890*/ o(FTFF1,t14"mmm/ach_sh_r", -4.1875,-3.1875,0.0625,acosh(-a)-sinh(-a), "a") \
+/*1891*/ o(FTFF1,t14"mmm/ach_t_r", -2.5625,-1.125,0.0625,acosh(-a)-tan(-a), "a") \
+/*1892*/ o(FTFF1,t14"mmm/ach_th_r", -4.5,-1.875,0.0625,acosh(-a)-tanh(-a), "a") \
+/*1893*/ o(FTFF1,t14"mmm/as_ac_r",            -1,1,0.5,asin(-a)-acos(-a), "a") \
+/*1894*/ o(FTFF1,t14"mmm/as_as_r",            -1,1,0.5,asin(-a)-asin(-a), "a") \
+/*1895*/ o(FTFF1,t14"mmm/as_ash_r",           -1,1,0.5,asin(-a)-asinh(-a), "a") \
+/*1896*/ o(FTFF1,t14"mmm/as_at_r",            -1,1,0.5,asin(-a)-atan(-a), "a") \
+/*1897*/ o(FTFF1,t14"mmm/as_ath_",     -0.75,0.75,0.25,asin(-a)-atanh(-a), "a") \
+/*1898*/ o(FTFF1,t14"mmm/as_c_r" ,            -1,1,0.5,asin(-a)-cos(-a), "a") \
+/*1899*/ o(FTFF1,t14"mmm/as_ch_r",            -1,1,0.5,asin(-a)-cosh(-a), "a") \
+/*1900*/ o(FTFF1,t14"mmm/as_ex_r",            -1,1,0.5,asin(-a)-exp(-a), "a") \
+/*1901*/ o(FTFF1,t14"mmm/as_l_r" ,         -1,-0.1,0.5,asin(-a)-log(-a), "a") \
+/*1902*/ o(FTFF1,t14"mmm/as_s_r" ,            -1,1,0.5,asin(-a)-sin(-a), "a") \
+/*1903*/ o(FTFF1,t14"mmm/as_sh_r",            -1,1,0.5,asin(-a)-sinh(-a), "a") \
+/*1904*/ o(FTFF1,t14"mmm/as_t_r" ,            -1,1,0.5,asin(-a)-tan(-a), "a") \
+/*1905*/ o(FTFF1,t14"mmm/as_th_r",            -1,1,0.5,asin(-a)-tanh(-a), "a") \
+/*1906*/ o(FTFF1,t14"mmm/ash_ac_r",           -1,1,0.5,asinh(-a)-acos(-a), "a") \
+/*1907*/ o(FTFF1,t14"mmm/ash_ach_r", -4.375,-2.0625,0.0625,asinh(-a)-acosh(-a), "a") \
+/*1908*/ o(FTFF1,t14"mmm/ash_as_r",           -1,1,0.5,asinh(-a)-asin(-a), "a") \
+/*1909*/ o(FTFF1,t14"mmm/ash_ash_r",          -2,2,0.5,asinh(-a)-asinh(-a), "a") \
+/*1910*/ o(FTFF1,t14"mmm/ash_at_r",           -2,2,0.5,asinh(-a)-atan(-a), "a") \
+/*1911*/ o(FTFF1,t14"mmm/ash_ath_",    -0.75,0.75,0.25,asinh(-a)-atanh(-a), "a") \
+/*1912*/ o(FTFF1,t14"mmm/ash_c_r",            -2,2,0.5,asinh(-a)-cos(-a), "a") \
+/*1913*/ o(FTFF1,t14"mmm/ash_ch_r",           -2,2,0.5,asinh(-a)-cosh(-a), "a") \
+/*1914*/ o(FTFF1,t14"mmm/ash_ex_r",           -2,2,0.5,asinh(-a)-exp(-a), "a") \
+/*1915*/ o(FTFF1,t14"mmm/ash_l_r",           -4,0,0.75,asinh(-a)-log(-a), "a") \
+/*1916*/ o(FTFF1,t14"mmm/ash_s_r",            -2,2,0.5,asinh(-a)-sin(-a), "a") \
+/*1917*/ o(FTFF1,t14"mmm/ash_sh_r",           -2,2,0.5,asinh(-a)-sinh(-a), "a") \
+/*1918*/ o(FTFF1,t14"mmm/ash_t_r",            -2,2,0.5,asinh(-a)-tan(-a), "a") \
+/*1919*/ o(FTFF1,t14"mmm/ash_th_r",           -2,2,0.5,asinh(-a)-tanh(-a), "a") \
+/*1920*/ o(FTFF1,t14"mmm/at_ac_r",            -1,1,0.5,atan(-a)-acos(-a), "a") \
+/*1921*/ o(FTFF1,t14"mmm/at_ach_r",  -6.25,-4.5,0.0625,atan(-a)-acosh(-a), "a") \
+/*1922*/ o(FTFF1,t14"mmm/at_as_r",            -1,1,0.5,atan(-a)-asin(-a), "a") \
+/*1923*/ o(FTFF1,t14"mmm/at_ash_r",           -2,2,0.5,atan(-a)-asinh(-a), "a") \
+/*1924*/ o(FTFF1,t14"mmm/at_at_r",            -2,2,0.5,atan(-a)-atan(-a), "a") \
+/*1925*/ o(FTFF1,t14"mmm/at_ath_",     -0.75,0.75,0.25,atan(-a)-atanh(-a), "a") \
+/*1926*/ o(FTFF1,t14"mmm/at_c_r" ,            -2,2,0.5,atan(-a)-cos(-a), "a") \
+/*1927*/ o(FTFF1,t14"mmm/at_ch_r",            -2,2,0.5,atan(-a)-cosh(-a), "a") \
+/*1928*/ o(FTFF1,t14"mmm/at_ex_r",            -2,2,0.5,atan(-a)-exp(-a), "a") \
+/*1929*/ o(FTFF1,t14"mmm/at_l_r" ,           -4,0,0.75,atan(-a)-log(-a), "a") \
+/*1930*/ o(FTFF1,t14"mmm/at_s_r" ,            -2,2,0.5,atan(-a)-sin(-a), "a") \
+/*1931*/ o(FTFF1,t14"mmm/at_sh_r",            -2,2,0.5,atan(-a)-sinh(-a), "a") \
+/*1932*/ o(FTFF1,t14"mmm/at_t_r" ,            -2,2,0.5,atan(-a)-tan(-a), "a") \
+/*1933*/ o(FTFF1,t14"mmm/at_th_r",            -2,2,0.5,atan(-a)-tanh(-a), "a") \
+/*1934*/ o(FTFF1,t14"mmm/ath_ac_",     -0.75,0.75,0.25,atanh(-a)-acos(-a), "a") \
+/*1935*/ o(FTFF1,t14"mmm/ath_as_",     -0.75,0.75,0.25,atanh(-a)-asin(-a), "a") \
+/*1936*/ o(FTFF1,t14"mmm/ath_ash_",    -0.75,0.75,0.25,atanh(-a)-asinh(-a), "a") \
+/*1937*/ o(FTFF1,t14"mmm/ath_at_",     -0.75,0.75,0.25,atanh(-a)-atan(-a), "a") \
+/*1938*/ o(FTFF1,t14"mmm/ath_ath_",    -0.75,0.75,0.25,atanh(-a)-atanh(-a), "a") \
+/*1939*/ o(FTFF1,t14"mmm/ath_c_" ,     -0.75,0.75,0.25,atanh(-a)-cos(-a), "a") \
+/*1940*/ o(FTFF1,t14"mmm/ath_ch_",     -0.75,0.75,0.25,atanh(-a)-cosh(-a), "a") \
+/*1941*/ o(FTFF1,t14"mmm/ath_ex_",     -0.75,0.75,0.25,atanh(-a)-exp(-a), "a") \
+/*1942*/ o(FTFF1,t14"mmm/ath_l_" ,    -0.75,-0.25,0.25,atanh(-a)-log(-a), "a") \
+/*1943*/ o(FTFF1,t14"mmm/ath_s_" ,     -0.75,0.75,0.25,atanh(-a)-sin(-a), "a") \
+/*1944*/ o(FTFF1,t14"mmm/ath_sh_",     -0.75,0.75,0.25,atanh(-a)-sinh(-a), "a") \
+/*1945*/ o(FTFF1,t14"mmm/ath_t_r",     -0.75,0.75,0.25,atanh(-a)-tan(-a), "a") \
+/*1946*/ o(FTFF1,t14"mmm/ath_th_r",    -0.75,0.75,0.25,atanh(-a)-tanh(-a), "a") \
+/*1947*/ o(FTFF1,t14"mmm/c_ac_r" ,            -1,1,0.5,cos(-a)-acos(-a), "a") \
+/*1948*/ o(FTFF1,t14"mmm/c_ach_r",    -5.625,-5,0.0625,cos(-a)-acosh(-a), "a") \
+/*1949*/ o(FTFF1,t14"mmm/c_as_r" ,            -1,1,0.5,cos(-a)-asin(-a), "a") \
+/*1950*/ o(FTFF1,t14"mmm/c_ash_r",            -2,2,0.5,cos(-a)-asinh(-a), "a") \
+/*1951*/ o(FTFF1,t14"mmm/c_at_r" ,            -2,2,0.5,cos(-a)-atan(-a), "a") \
+/*1952*/ o(FTFF1,t14"mmm/c_ath_" ,     -0.75,0.75,0.25,cos(-a)-atanh(-a), "a") \
+/*1953*/ o(FTFF1,t14"mmm/c_c_"   ,            -2,2,0.5,cos(-a)-cos(-a), "a") \
+/*1954*/ o(FTFF1,t14"mmm/c_ch_"  ,            -2,2,0.5,cos(-a)-cosh(-a), "a") \
+/*1955*/ o(FTFF1,t14"mmm/c_ex_"  ,            -2,2,0.5,cos(-a)-exp(-a), "a") \
+/*1956*/ o(FTFF1,t14"mmm/c_l_r"  ,           -4,0,0.75,cos(-a)-log(-a), "a") \
+/*1957*/ o(FTFF1,t14"mmm/c_s_"   ,            -2,2,0.5,cos(-a)-sin(-a), "a") \
+/*1958*/ o(FTFF1,t14"mmm/c_sh_"  ,            -2,2,0.5,cos(-a)-sinh(-a), "a") \
+/*1959*/ o(FTFF1,t14"mmm/c_t_r"  ,            -2,2,0.5,cos(-a)-tan(-a), "a") \
+/*1960*/ o(FTFF1,t14"mmm/c_th_r" ,            -2,2,0.5,cos(-a)-tanh(-a), "a") \
+/*1961*/ o(FTFF1,t14"mmm/ch_ac_r",            -1,1,0.5,cosh(-a)-acos(-a), "a") \
+/*1962*/ o(FTFF1,t14"mmm/ch_ach_r", -5.5625,-4.0625,0.0625,cosh(-a)-acosh(-a), "a") \
+/*1963*/ o(FTFF1,t14"mmm/ch_as_r",            -1,1,0.5,cosh(-a)-asin(-a), "a") \
+/*1964*/ o(FTFF1,t14"mmm/ch_ash_r",           -2,2,0.5,cosh(-a)-asinh(-a), "a") \
+/*1965*/ o(FTFF1,t14"mmm/ch_at_r",            -2,2,0.5,cosh(-a)-atan(-a), "a") \
+/*1966*/ o(FTFF1,t14"mmm/ch_ath_",     -0.75,0.75,0.25,cosh(-a)-atanh(-a), "a") \
+/*1967*/ o(FTFF1,t14"mmm/ch_c_"  ,            -2,2,0.5,cosh(-a)-cos(-a), "a") \
+/*1968*/ o(FTFF1,t14"mmm/ch_ch_" ,            -2,2,0.5,cosh(-a)-cosh(-a), "a") \
+/*1969*/ o(FTFF1,t14"mmm/ch_ex_" ,            -2,2,0.5,cosh(-a)-exp(-a), "a") \
+/*1970*/ o(FTFF1,t14"mmm/ch_l_r" ,           -4,0,0.75,cosh(-a)-log(-a), "a") \
+/*1971*/ o(FTFF1,t14"mmm/ch_s_"  ,            -2,2,0.5,cosh(-a)-sin(-a), "a") \
+/*1972*/ o(FTFF1,t14"mmm/ch_sh_" ,            -2,2,0.5,cosh(-a)-sinh(-a), "a") \
+/*1973*/ o(FTFF1,t14"mmm/ch_t_r" ,            -2,2,0.5,cosh(-a)-tan(-a), "a") \
+/*1974*/ o(FTFF1,t14"mmm/ch_th_r",            -2,2,0.5,cosh(-a)-tanh(-a), "a") \
+/*1975*/ o(FTFF1,t14"mmm/ex_ac_r",            -1,1,0.5,exp(-a)-acos(-a), "a") \
+/*1976*/ o(FTFF1,t14"mmm/ex_ach_r", -4.0625,-2.6875,0.0625,exp(-a)-acosh(-a), "a") \
+/*1977*/ o(FTFF1,t14"mmm/ex_as_r",            -1,1,0.5,exp(-a)-asin(-a), "a") \
+/*1978*/ o(FTFF1,t14"mmm/ex_ash_r",           -2,2,0.5,exp(-a)-asinh(-a), "a") \
+/*1979*/ o(FTFF1,t14"mmm/ex_at_r",            -2,2,0.5,exp(-a)-atan(-a), "a") \
+/*1980*/ o(FTFF1,t14"mmm/ex_ath_",     -0.75,0.75,0.25,exp(-a)-atanh(-a), "a") \
+/*1981*/ o(FTFF1,t14"mmm/ex_c_"  ,            -2,2,0.5,exp(-a)-cos(-a), "a") \
+/*1982*/ o(FTFF1,t14"mmm/ex_ch_" ,            -2,2,0.5,exp(-a)-cosh(-a), "a") \
+/*1983*/ o(FTFF1,t14"mmm/ex_ex_" ,            -2,2,0.5,exp(-a)-exp(-a), "a") \
+/*1984*/ o(FTFF1,t14"mmm/ex_l_r" ,           -4,0,0.75,exp(-a)-log(-a), "a") \
+/*1985*/ o(FTFF1,t14"mmm/ex_s_"  ,            -2,2,0.5,exp(-a)-sin(-a), "a") \
+/*1986*/ o(FTFF1,t14"mmm/ex_sh_" ,            -2,2,0.5,exp(-a)-sinh(-a), "a") \
+/*1987*/ o(FTFF1,t14"mmm/ex_t_r" ,            -2,2,0.5,exp(-a)-tan(-a), "a") \
+/*1988*/ o(FTFF1,t14"mmm/ex_th_r",            -2,2,0.5,exp(-a)-tanh(-a), "a") \
+/*1989*/ o(FTFF1,t14"mmm/l_ac_r" ,         -1,-0.1,0.5,log(-a)-acos(-a), "a") \
+/*1990*/ o(FTFF1,t14"mmm/l_ach_r",    -2.125,-1,0.0625,log(-a)-acosh(-a), "a") \
+/*1991*/ o(FTFF1,t14"mmm/l_as_r" ,         -1,-0.1,0.5,log(-a)-asin(-a), "a") \
+/*1992*/ o(FTFF1,t14"mmm/l_ash_r",           -4,0,0.75,log(-a)-asinh(-a), "a") \
+/*1993*/ o(FTFF1,t14"mmm/l_at_r" ,           -4,0,0.75,log(-a)-atan(-a), "a") \
+/*1994*/ o(FTFF1,t14"mmm/l_ath_" ,    -0.75,-0.25,0.25,log(-a)-atanh(-a), "a") \
+/*1995*/ o(FTFF1,t14"mmm/l_c_r"  ,           -4,0,0.75,log(-a)-cos(-a), "a") \
+/*1996*/ o(FTFF1,t14"mmm/l_ch_r" ,           -4,0,0.75,log(-a)-cosh(-a), "a") \
+/*1997*/ o(FTFF1,t14"mmm/l_ex_r" ,           -4,0,0.75,log(-a)-exp(-a), "a") \
+/*1998*/ o(FTFF1,t14"mmm/l_l_r"  ,           -4,0,0.75,log(-a)-log(-a), "a") \
+/*1999*/ o(FTFF1,t14"mmm/l_s_r"  ,           -4,0,0.75,log(-a)-sin(-a), "a") \
+/*2000*/ o(FTFF1,t14"mmm/l_sh_r" ,           -4,0,0.75,log(-a)-sinh(-a), "a") \
+/*2001*/ o(FTFF1,t14"mmm/l_t_r"  ,           -4,0,0.75,log(-a)-tan(-a), "a") \
+/*2002*/ o(FTFF1,t14"mmm/l_th_r" ,           -4,0,0.75,log(-a)-tanh(-a), "a") \
+/*2003*/ o(FTFF1,t14"mmm/s_ac_r" ,            -1,1,0.5,sin(-a)-acos(-a), "a") \
+/*2004*/ o(FTFF1,t14"mmm/s_ach_r", -3.5625,-2.875,0.0625,sin(-a)-acosh(-a), "a") \
+/*2005*/ o(FTFF1,t14"mmm/s_as_r" ,            -1,1,0.5,sin(-a)-asin(-a), "a") \
+/*2006*/ o(FTFF1,t14"mmm/s_ash_r",            -2,2,0.5,sin(-a)-asinh(-a), "a") \
+/*2007*/ o(FTFF1,t14"mmm/s_at_r" ,            -2,2,0.5,sin(-a)-atan(-a), "a") \
+/*2008*/ o(FTFF1,t14"mmm/s_ath_" ,     -0.75,0.75,0.25,sin(-a)-atanh(-a), "a") \
+/*2009*/ o(FTFF1,t14"mmm/s_c_"   ,            -2,2,0.5,sin(-a)-cos(-a), "a") \
+/*2010*/ o(FTFF1,t14"mmm/s_ch_"  ,            -2,2,0.5,sin(-a)-cosh(-a), "a") \
+/*2011*/ o(FTFF1,t14"mmm/s_ex_"  ,            -2,2,0.5,sin(-a)-exp(-a), "a") \
+/*2012*/ o(FTFF1,t14"mmm/s_l_r"  ,           -4,0,0.75,sin(-a)-log(-a), "a") \
+/*2013*/ o(FTFF1,t14"mmm/s_s_"   ,            -2,2,0.5,sin(-a)-sin(-a), "a") \
+/*2014*/ o(FTFF1,t14"mmm/s_sh_"  ,            -2,2,0.5,sin(-a)-sinh(-a), "a") \
+/*2015*/ o(FTFF1,t14"mmm/s_t_r"  ,            -2,2,0.5,sin(-a)-tan(-a), "a") \
+/*2016*/ o(FTFF1,t14"mmm/s_th_r" ,            -2,2,0.5,sin(-a)-tanh(-a), "a") \
+/*2017*/ o(FTFF1,t14"mmm/sh_ac_r",            -1,1,0.5,sinh(-a)-acos(-a), "a") \
+/*2018*/ o(FTFF1,t14"mmm/sh_ach_r",  -5.6875,-1,0.0625,sinh(-a)-acosh(-a), "a") \
+/*2019*/ o(FTFF1,t14"mmm/sh_as_r",            -1,1,0.5,sinh(-a)-asin(-a), "a") \
+/*2020*/ o(FTFF1,t14"mmm/sh_ash_r",           -2,2,0.5,sinh(-a)-asinh(-a), "a") \
+/*2021*/ o(FTFF1,t14"mmm/sh_at_r",            -2,2,0.5,sinh(-a)-atan(-a), "a") \
+/*2022*/ o(FTFF1,t14"mmm/sh_ath_",     -0.75,0.75,0.25,sinh(-a)-atanh(-a), "a") \
+/*2023*/ o(FTFF1,t14"mmm/sh_c_"  ,            -2,2,0.5,sinh(-a)-cos(-a), "a") \
+/*2024*/ o(FTFF1,t14"mmm/sh_ch_" ,            -2,2,0.5,sinh(-a)-cosh(-a), "a") \
+/*2025*/ o(FTFF1,t14"mmm/sh_ex_" ,            -2,2,0.5,sinh(-a)-exp(-a), "a") \
+/*2026*/ o(FTFF1,t14"mmm/sh_l_r" ,           -4,0,0.75,sinh(-a)-log(-a), "a") \
+/*2027*/ o(FTFF1,t14"mmm/sh_s_"  ,            -2,2,0.5,sinh(-a)-sin(-a), "a") \
+/*2028*/ o(FTFF1,t14"mmm/sh_sh_" ,            -2,2,0.5,sinh(-a)-sinh(-a), "a") \
+/*2029*/ o(FTFF1,t14"mmm/sh_t_r" ,            -2,2,0.5,sinh(-a)-tan(-a), "a") \
+/*2030*/ o(FTFF1,t14"mmm/sh_th_r",            -2,2,0.5,sinh(-a)-tanh(-a), "a") \
+/*2031*/ o(FTFF1,t14"mmm/t_ac_r" ,            -1,1,0.5,tan(-a)-acos(-a), "a") \
+/*2032*/ o(FTFF1,t14"mmm/t_ach_r",    -6,-2.125,0.0625,tan(-a)-acosh(-a), "a") \
+/*2033*/ o(FTFF1,t14"mmm/t_as_r" ,            -1,1,0.5,tan(-a)-asin(-a), "a") \
+/*2034*/ o(FTFF1,t14"mmm/t_ash_r",            -2,2,0.5,tan(-a)-asinh(-a), "a") \
+/*2035*/ o(FTFF1,t14"mmm/t_at_r" ,            -2,2,0.5,tan(-a)-atan(-a), "a") \
+/*2036*/ o(FTFF1,t14"mmm/t_ath_r",     -0.75,0.75,0.25,tan(-a)-atanh(-a), "a") \
+/*2037*/ o(FTFF1,t14"mmm/t_c_r"  ,            -2,2,0.5,tan(-a)-cos(-a), "a") \
+/*2038*/ o(FTFF1,t14"mmm/t_ch_r" ,            -2,2,0.5,tan(-a)-cosh(-a), "a") \
+/*2039*/ o(FTFF1,t14"mmm/t_ex_r" ,            -2,2,0.5,tan(-a)-exp(-a), "a") \
+/*2040*/ o(FTFF1,t14"mmm/t_l_r"  ,           -4,0,0.75,tan(-a)-log(-a), "a") \
+/*2041*/ o(FTFF1,t14"mmm/t_s_r"  ,            -2,2,0.5,tan(-a)-sin(-a), "a") \
+/*2042*/ o(FTFF1,t14"mmm/t_sh_r" ,            -2,2,0.5,tan(-a)-sinh(-a), "a") \
+/*2043*/ o(FTFF1,t14"mmm/t_t_r"  ,            -2,2,0.5,tan(-a)-tan(-a), "a") \
+/*2044*/ o(FTFF1,t14"mmm/t_th_r" ,            -2,2,0.5,tan(-a)-tanh(-a), "a") \
+/*2045*/ o(FTFF1,t14"mmm/th_ac_r",            -1,1,0.5,tanh(-a)-acos(-a), "a") \
+/*2046*/ o(FTFF1,t14"mmm/th_ach_r", -5.875,-1.3125,0.0625,tanh(-a)-acosh(-a), "a") \
+/*2047*/ o(FTFF1,t14"mmm/th_as_r",            -1,1,0.5,tanh(-a)-asin(-a), "a") \
+/*2048*/ o(FTFF1,t14"mmm/th_ash_r",           -2,2,0.5,tanh(-a)-asinh(-a), "a") \
+/*2049*/ o(FTFF1,t14"mmm/th_at_r",            -2,2,0.5,tanh(-a)-atan(-a), "a") \
+/*2050*/ o(FTFF1,t14"mmm/th_ath_r",    -0.75,0.75,0.25,tanh(-a)-atanh(-a), "a") \
+/*2051*/ o(FTFF1,t14"mmm/th_c_r" ,            -2,2,0.5,tanh(-a)-cos(-a), "a") \
+/*2052*/ o(FTFF1,t14"mmm/th_ch_r",            -2,2,0.5,tanh(-a)-cosh(-a), "a") \
+/*2053*/ o(FTFF1,t14"mmm/th_ex_r",            -2,2,0.5,tanh(-a)-exp(-a), "a") \
+/*2054*/ o(FTFF1,t14"mmm/th_l_r" ,           -4,0,0.75,tanh(-a)-log(-a), "a") \
+/*2055*/ o(FTFF1,t14"mmm/th_s_r" ,            -2,2,0.5,tanh(-a)-sin(-a), "a") \
+/*2056*/ o(FTFF1,t14"mmm/th_sh_r",            -2,2,0.5,tanh(-a)-sinh(-a), "a") \
+/*2057*/ o(FTFF1,t14"mmm/th_t_r" ,            -2,2,0.5,tanh(-a)-tan(-a), "a") \
+/*2058*/ o(FTFF1,t14"mmm/th_th_r",            -2,2,0.5,tanh(-a)-tanh(-a), "a") \
+/*2059*/ o(FTFF1,t14"mmp/ac_ac_r",            -1,1,0.5,acos(-a)-acos(a), "a") \
+/*2060*/ o(FTFF1,t14"mmp/ac_as_r",            -1,1,0.5,acos(-a)-asin(a), "a") \
+/*2061*/ o(FTFF1,t14"mmp/ac_ash_r",           -1,1,0.5,acos(-a)-asinh(a), "a") \
+/*2062*/ o(FTFF1,t14"mmp/ac_at_r",            -1,1,0.5,acos(-a)-atan(a), "a") \
+/*2063*/ o(FTFF1,t14"mmp/ac_ath_",     -0.75,0.75,0.25,acos(-a)-atanh(a), "a") \
+/*2064*/ o(FTFF1,t14"mmp/ac_c_r" ,            -1,1,0.5,acos(-a)-cos(a), "a") \
+/*2065*/ o(FTFF1,t14"mmp/ac_ch_r",            -1,1,0.5,acos(-a)-cosh(a), "a") \
+/*2066*/ o(FTFF1,t14"mmp/ac_ex_r",            -1,1,0.5,acos(-a)-exp(a), "a") \
+/*2067*/ o(FTFF1,t14"mmp/ac_l_r" ,          0.5,1,0.25,acos(-a)-log(a), "a") \
+/*2068*/ o(FTFF1,t14"mmp/ac_s_r" ,            -1,1,0.5,acos(-a)-sin(a), "a") \
+/*2069*/ o(FTFF1,t14"mmp/ac_sh_r",            -1,1,0.5,acos(-a)-sinh(a), "a") \
+/*2070*/ o(FTFF1,t14"mmp/ac_t_r" ,            -1,1,0.5,acos(-a)-tan(a), "a") \
+/*2071*/ o(FTFF1,t14"mmp/ac_th_r",            -1,1,0.5,acos(-a)-tanh(a), "a") \
+/*2072*/ o(FTFF1,t14"mmp/ach_ash_r", -5.0625,-4.125,0.0625,acosh(-a)-asinh(a), "a") \
+/*2073*/ o(FTFF1,t14"mmp/ach_at_r", -5.4375,-1.5625,0.0625,acosh(-a)-atan(a), "a") \
+/*2074*/ o(FTFF1,t14"mmp/ach_c_r", -4.875,-2.75,0.0625,acosh(-a)-cos(a), "a") \
+/*2075*/ o(FTFF1,t14"mmp/ach_ch_r", -2.75,-1.25,0.0625,acosh(-a)-cosh(a), "a") \
+/*2076*/ o(FTFF1,t14"mmp/ach_ex_r", -4.9375,-1.1875,0.0625,acosh(-a)-exp(a), "a") \
+/*2077*/ o(FTFF1,t14"mmp/ach_s_r", -5.375,-3.1875,0.0625,acosh(-a)-sin(a), "a") \
+/*2078*/ o(FTFF1,t14"mmp/ach_sh_r", -4.375,-2.6875,0.0625,acosh(-a)-sinh(a), "a") \
+/*2079*/ o(FTFF1,t14"mmp/ach_t_r", -3.4375,-2.5,0.0625,acosh(-a)-tan(a), "a") \
+/*2080*/ o(FTFF1,t14"mmp/ach_th_r",  -2,-1.0625,0.0625,acosh(-a)-tanh(a), "a") \
+/*2081*/ o(FTFF1,t14"mmp/as_ac_r",            -1,1,0.5,asin(-a)-acos(a), "a") \
+/*2082*/ o(FTFF1,t14"mmp/as_as_r",            -1,1,0.5,asin(-a)-asin(a), "a") \
+/*2083*/ o(FTFF1,t14"mmp/as_ash_r",           -1,1,0.5,asin(-a)-asinh(a), "a") \
+/*2084*/ o(FTFF1,t14"mmp/as_at_r",            -1,1,0.5,asin(-a)-atan(a), "a") \
+/*2085*/ o(FTFF1,t14"mmp/as_ath_",     -0.75,0.75,0.25,asin(-a)-atanh(a), "a") \
+/*2086*/ o(FTFF1,t14"mmp/as_c_r" ,            -1,1,0.5,asin(-a)-cos(a), "a") \
+/*2087*/ o(FTFF1,t14"mmp/as_ch_r",            -1,1,0.5,asin(-a)-cosh(a), "a") \
+/*2088*/ o(FTFF1,t14"mmp/as_ex_r",            -1,1,0.5,asin(-a)-exp(a), "a") \
+/*2089*/ o(FTFF1,t14"mmp/as_l_r" ,          0.5,1,0.25,asin(-a)-log(a), "a") \
+/*2090*/ o(FTFF1,t14"mmp/as_s_r" ,            -1,1,0.5,asin(-a)-sin(a), "a") \
+/*2091*/ o(FTFF1,t14"mmp/as_sh_r",            -1,1,0.5,asin(-a)-sinh(a), "a") \
+/*2092*/ o(FTFF1,t14"mmp/as_t_r" ,            -1,1,0.5,asin(-a)-tan(a), "a") \
+/*2093*/ o(FTFF1,t14"mmp/as_th_r",            -1,1,0.5,asin(-a)-tanh(a), "a") \
+/*2094*/ o(FTFF1,t14"mmp/ash_ac_r",           -1,1,0.5,asinh(-a)-acos(a), "a") \
+/*2095*/ o(FTFF1,t14"mmp/ash_ach_r", 5.25,11.375,0.0625,asinh(-a)-acosh(a), "a") \
+/*2096*/ o(FTFF1,t14"mmp/ash_as_r",           -1,1,0.5,asinh(-a)-asin(a), "a") \
+/*2097*/ o(FTFF1,t14"mmp/ash_ash_r",          -2,2,0.5,asinh(-a)-asinh(a), "a") \
+/*2098*/ o(FTFF1,t14"mmp/ash_at_r",           -2,2,0.5,asinh(-a)-atan(a), "a") \
+/*2099*/ o(FTFF1,t14"mmp/ash_ath_",    -0.75,0.75,0.25,asinh(-a)-atanh(a), "a") \
+/*2100*/ o(FTFF1,t14"mmp/ash_c_r",            -2,2,0.5,asinh(-a)-cos(a), "a") \
+/*2101*/ o(FTFF1,t14"mmp/ash_ch_r",           -2,2,0.5,asinh(-a)-cosh(a), "a") \
+/*2102*/ o(FTFF1,t14"mmp/ash_ex_r",           -2,2,0.5,asinh(-a)-exp(a), "a") \
+/*2103*/ o(FTFF1,t14"mmp/ash_l_r",           0.5,2,0.5,asinh(-a)-log(a), "a") \
+/*2104*/ o(FTFF1,t14"mmp/ash_s_r",            -2,2,0.5,asinh(-a)-sin(a), "a") \
+/*2105*/ o(FTFF1,t14"mmp/ash_sh_r",           -2,2,0.5,asinh(-a)-sinh(a), "a") \
+/*2106*/ o(FTFF1,t14"mmp/ash_t_r",            -2,2,0.5,asinh(-a)-tan(a), "a") \
+/*2107*/ o(FTFF1,t14"mmp/ash_th_r",           -2,2,0.5,asinh(-a)-tanh(a), "a") \
+/*2108*/ o(FTFF1,t14"mmp/at_ac_r",            -1,1,0.5,atan(-a)-acos(a), "a") \
+/*2109*/ o(FTFF1,t14"mmp/at_ach_r", 6.125,7.625,0.0625,atan(-a)-acosh(a), "a") \
+/*2110*/ o(FTFF1,t14"mmp/at_as_r",            -1,1,0.5,atan(-a)-asin(a), "a") \
+/*2111*/ o(FTFF1,t14"mmp/at_ash_r",           -2,2,0.5,atan(-a)-asinh(a), "a") \
+/*2112*/ o(FTFF1,t14"mmp/at_at_r",            -2,2,0.5,atan(-a)-atan(a), "a") \
+/*2113*/ o(FTFF1,t14"mmp/at_ath_",     -0.75,0.75,0.25,atan(-a)-atanh(a), "a") \
+/*2114*/ o(FTFF1,t14"mmp/at_c_r" ,            -2,2,0.5,atan(-a)-cos(a), "a") \
+/*2115*/ o(FTFF1,t14"mmp/at_ch_r",            -2,2,0.5,atan(-a)-cosh(a), "a") \
+/*2116*/ o(FTFF1,t14"mmp/at_ex_r",            -2,2,0.5,atan(-a)-exp(a), "a") \
+/*2117*/ o(FTFF1,t14"mmp/at_l_r" ,           0.5,2,0.5,atan(-a)-log(a), "a") \
+/*2118*/ o(FTFF1,t14"mmp/at_s_r" ,            -2,2,0.5,atan(-a)-sin(a), "a") \
+/*2119*/ o(FTFF1,t14"mmp/at_sh_r",            -2,2,0.5,atan(-a)-sinh(a), "a") \
+/*2120*/ o(FTFF1,t14"mmp/at_t_r" ,            -2,2,0.5,atan(-a)-tan(a), "a") \
+/*2121*/ o(FTFF1,t14"mmp/at_th_r",            -2,2,0.5,atan(-a)-tanh(a), "a") \
+/*2122*/ o(FTFF1,t14"mmp/ath_ac_",     -0.75,0.75,0.25,atanh(-a)-acos(a), "a") \
+/*2123*/ o(FTFF1,t14"mmp/ath_as_",     -0.75,0.75,0.25,atanh(-a)-asin(a), "a") \
+/*2124*/ o(FTFF1,t14"mmp/ath_ash_",    -0.75,0.75,0.25,atanh(-a)-asinh(a), "a") \
+/*2125*/ o(FTFF1,t14"mmp/ath_at_",     -0.75,0.75,0.25,atanh(-a)-atan(a), "a") \
+/*2126*/ o(FTFF1,t14"mmp/ath_ath_",    -0.75,0.75,0.25,atanh(-a)-atanh(a), "a") \
+/*2127*/ o(FTFF1,t14"mmp/ath_c_" ,     -0.75,0.75,0.25,atanh(-a)-cos(a), "a") \
+/*2128*/ o(FTFF1,t14"mmp/ath_ch_",     -0.75,0.75,0.25,atanh(-a)-cosh(a), "a") \
+/*2129*/ o(FTFF1,t14"mmp/ath_ex_",     -0.75,0.75,0.25,atanh(-a)-exp(a), "a") \
+/*2130*/ o(FTFF1,t14"mmp/ath_l_r",     0.25,0.75,0.125,atanh(-a)-log(a), "a") \
+/*2131*/ o(FTFF1,t14"mmp/ath_s_" ,     -0.75,0.75,0.25,atanh(-a)-sin(a), "a") \
+/*2132*/ o(FTFF1,t14"mmp/ath_sh_",     -0.75,0.75,0.25,atanh(-a)-sinh(a), "a") \
+/*2133*/ o(FTFF1,t14"mmp/ath_t_r",     -0.75,0.75,0.25,atanh(-a)-tan(a), "a") \
+/*2134*/ o(FTFF1,t14"mmp/ath_th_r",    -0.75,0.75,0.25,atanh(-a)-tanh(a), "a") \
+/*2135*/ o(FTFF1,t14"mmp/c_ac_r" ,            -1,1,0.5,cos(-a)-acos(a), "a") \
+/*2136*/ o(FTFF1,t14"mmp/c_ach_r", 2.5625,5.1875,0.0625,cos(-a)-acosh(a), "a") \
+/*2137*/ o(FTFF1,t14"mmp/c_as_r" ,            -1,1,0.5,cos(-a)-asin(a), "a") \
+/*2138*/ o(FTFF1,t14"mmp/c_ash_r",            -2,2,0.5,cos(-a)-asinh(a), "a") \
+/*2139*/ o(FTFF1,t14"mmp/c_at_r" ,            -2,2,0.5,cos(-a)-atan(a), "a") \
+/*2140*/ o(FTFF1,t14"mmp/c_ath_" ,     -0.75,0.75,0.25,cos(-a)-atanh(a), "a") \
+/*2141*/ o(FTFF1,t14"mmp/c_c_"   ,            -2,2,0.5,cos(-a)-cos(a), "a") \
+/*2142*/ o(FTFF1,t14"mmp/c_ch_"  ,            -2,2,0.5,cos(-a)-cosh(a), "a") \
+/*2143*/ o(FTFF1,t14"mmp/c_ex_"  ,            -2,2,0.5,cos(-a)-exp(a), "a") \
+/*2144*/ o(FTFF1,t14"mmp/c_l_r"  ,           0.5,2,0.5,cos(-a)-log(a), "a") \
+/*2145*/ o(FTFF1,t14"mmp/c_s_"   ,            -2,2,0.5,cos(-a)-sin(a), "a") \
+/*2146*/ o(FTFF1,t14"mmp/c_sh_"  ,            -2,2,0.5,cos(-a)-sinh(a), "a") \
+/*2147*/ o(FTFF1,t14"mmp/c_t_r"  ,            -2,2,0.5,cos(-a)-tan(a), "a") \
+/*2148*/ o(FTFF1,t14"mmp/c_th_r" ,            -2,2,0.5,cos(-a)-tanh(a), "a") \
+/*2149*/ o(FTFF1,t14"mmp/ch_ac_r",            -1,1,0.5,cosh(-a)-acos(a), "a") \
+/*2150*/ o(FTFF1,t14"mmp/ch_ach_r", 5.625,7.8125,0.0625,cosh(-a)-acosh(a), "a") \
+/*2151*/ o(FTFF1,t14"mmp/ch_as_r",            -1,1,0.5,cosh(-a)-asin(a), "a") \
+/*2152*/ o(FTFF1,t14"mmp/ch_ash_r",           -2,2,0.5,cosh(-a)-asinh(a), "a") \
+/*2153*/ o(FTFF1,t14"mmp/ch_at_r",            -2,2,0.5,cosh(-a)-atan(a), "a") \
+/*2154*/ o(FTFF1,t14"mmp/ch_ath_",     -0.75,0.75,0.25,cosh(-a)-atanh(a), "a") \
+/*2155*/ o(FTFF1,t14"mmp/ch_c_"  ,            -2,2,0.5,cosh(-a)-cos(a), "a") \
+/*2156*/ o(FTFF1,t14"mmp/ch_ch_" ,            -2,2,0.5,cosh(-a)-cosh(a), "a") \
+/*2157*/ o(FTFF1,t14"mmp/ch_ex_" ,            -2,2,0.5,cosh(-a)-exp(a), "a") \
+/*2158*/ o(FTFF1,t14"mmp/ch_l_r" ,           0.5,2,0.5,cosh(-a)-log(a), "a") \
+/*2159*/ o(FTFF1,t14"mmp/ch_s_"  ,            -2,2,0.5,cosh(-a)-sin(a), "a") \
+/*2160*/ o(FTFF1,t14"mmp/ch_sh_" ,            -2,2,0.5,cosh(-a)-sinh(a), "a") \
+/*2161*/ o(FTFF1,t14"mmp/ch_t_r" ,            -2,2,0.5,cosh(-a)-tan(a), "a") \
+/*2162*/ o(FTFF1,t14"mmp/ch_th_r",            -2,2,0.5,cosh(-a)-tanh(a), "a") \
+/*2163*/ o(FTFF1,t14"mmp/ex_ac_r",            -1,1,0.5,exp(-a)-acos(a), "a") \
+/*2164*/ o(FTFF1,t14"mmp/ex_ach_r", 5.5625,7.4375,0.0625,exp(-a)-acosh(a), "a") \
+/*2165*/ o(FTFF1,t14"mmp/ex_as_r",            -1,1,0.5,exp(-a)-asin(a), "a") \
+/*2166*/ o(FTFF1,t14"mmp/ex_ash_r",           -2,2,0.5,exp(-a)-asinh(a), "a") \
+/*2167*/ o(FTFF1,t14"mmp/ex_at_r",            -2,2,0.5,exp(-a)-atan(a), "a") \
+/*2168*/ o(FTFF1,t14"mmp/ex_ath_",     -0.75,0.75,0.25,exp(-a)-atanh(a), "a") \
+/*2169*/ o(FTFF1,t14"mmp/ex_c_"  ,            -2,2,0.5,exp(-a)-cos(a), "a") \
+/*2170*/ o(FTFF1,t14"mmp/ex_ch_" ,            -2,2,0.5,exp(-a)-cosh(a), "a") \
+/*2171*/ o(FTFF1,t14"mmp/ex_ex_" ,            -2,2,0.5,exp(-a)-exp(a), "a") \
+/*2172*/ o(FTFF1,t14"mmp/ex_l_r" ,           0.5,2,0.5,exp(-a)-log(a), "a") \
+/*2173*/ o(FTFF1,t14"mmp/ex_s_"  ,            -2,2,0.5,exp(-a)-sin(a), "a") \
+/*2174*/ o(FTFF1,t14"mmp/ex_sh_" ,            -2,2,0.5,exp(-a)-sinh(a), "a") \
+/*2175*/ o(FTFF1,t14"mmp/ex_t_r" ,            -2,2,0.5,exp(-a)-tan(a), "a") \
+/*2176*/ o(FTFF1,t14"mmp/ex_th_r",            -2,2,0.5,exp(-a)-tanh(a), "a") \
+/*2177*/ o(FTFF1,t14"mmp/l_ac_r" ,         -1,-0.1,0.5,log(-a)-acos(a), "a") \
+/*2178*/ o(FTFF1,t14"mmp/l_as_r" ,         -1,-0.1,0.5,log(-a)-asin(a), "a") \
+/*2179*/ o(FTFF1,t14"mmp/l_ash_r",           -4,0,0.75,log(-a)-asinh(a), "a") \
+/*2180*/ o(FTFF1,t14"mmp/l_at_r" ,           -4,0,0.75,log(-a)-atan(a), "a") \
+/*2181*/ o(FTFF1,t14"mmp/l_ath_" ,    -0.75,-0.25,0.25,log(-a)-atanh(a), "a") \
+/*2182*/ o(FTFF1,t14"mmp/l_c_r"  ,           -4,0,0.75,log(-a)-cos(a), "a") \
+/*2183*/ o(FTFF1,t14"mmp/l_ch_r" ,           -4,0,0.75,log(-a)-cosh(a), "a") \
+/*2184*/ o(FTFF1,t14"mmp/l_ex_r" ,           -4,0,0.75,log(-a)-exp(a), "a") \
+/*2185*/ o(FTFF1,t14"mmp/l_s_r"  ,           -4,0,0.75,log(-a)-sin(a), "a") \
+/*2186*/ o(FTFF1,t14"mmp/l_sh_r" ,           -4,0,0.75,log(-a)-sinh(a), "a") \
+/*2187*/ o(FTFF1,t14"mmp/l_t_r"  ,           -4,0,0.75,log(-a)-tan(a), "a") \
+/*2188*/ o(FTFF1,t14"mmp/l_th_r" ,           -4,0,0.75,log(-a)-tanh(a), "a") \
+/*2189*/ o(FTFF1,t14"mmp/s_ac_r" ,            -1,1,0.5,sin(-a)-acos(a), "a") \
+/*2190*/ o(FTFF1,t14"mmp/s_ach_r", 4.8125,9.5625,0.0625,sin(-a)-acosh(a), "a") \
+/*2191*/ o(FTFF1,t14"mmp/s_as_r" ,            -1,1,0.5,sin(-a)-asin(a), "a") \
+/*2192*/ o(FTFF1,t14"mmp/s_ash_r",            -2,2,0.5,sin(-a)-asinh(a), "a") \
+/*2193*/ o(FTFF1,t14"mmp/s_at_r" ,            -2,2,0.5,sin(-a)-atan(a), "a") \
+/*2194*/ o(FTFF1,t14"mmp/s_ath_" ,     -0.75,0.75,0.25,sin(-a)-atanh(a), "a") \
+/*2195*/ o(FTFF1,t14"mmp/s_c_"   ,            -2,2,0.5,sin(-a)-cos(a), "a") \
+/*2196*/ o(FTFF1,t14"mmp/s_ch_"  ,            -2,2,0.5,sin(-a)-cosh(a), "a") \
+/*2197*/ o(FTFF1,t14"mmp/s_ex_"  ,            -2,2,0.5,sin(-a)-exp(a), "a") \
+/*2198*/ o(FTFF1,t14"mmp/s_l_r"  ,           0.5,2,0.5,sin(-a)-log(a), "a") \
+/*2199*/ o(FTFF1,t14"mmp/s_s_"   ,            -2,2,0.5,sin(-a)-sin(a), "a") \
+/*2200*/ o(FTFF1,t14"mmp/s_sh_"  ,            -2,2,0.5,sin(-a)-sinh(a), "a") \
+/*2201*/ o(FTFF1,t14"mmp/s_t_r"  ,            -2,2,0.5,sin(-a)-tan(a), "a") \
+/*2202*/ o(FTFF1,t14"mmp/s_th_r" ,            -2,2,0.5,sin(-a)-tanh(a), "a") \
+/*2203*/ o(FTFF1,t14"mmp/sh_ac_r",            -1,1,0.5,sinh(-a)-acos(a), "a") \
+/*2204*/ o(FTFF1,t14"mmp/sh_ach_r", 5.9375,11.625,0.0625,sinh(-a)-acosh(a), "a") \
+/*2205*/ o(FTFF1,t14"mmp/sh_as_r",            -1,1,0.5,sinh(-a)-asin(a), "a") \
+/*2206*/ o(FTFF1,t14"mmp/sh_ash_r",           -2,2,0.5,sinh(-a)-asinh(a), "a") \
+/*2207*/ o(FTFF1,t14"mmp/sh_at_r",            -2,2,0.5,sinh(-a)-atan(a), "a") \
+/*2208*/ o(FTFF1,t14"mmp/sh_ath_",     -0.75,0.75,0.25,sinh(-a)-atanh(a), "a") \
+/*2209*/ o(FTFF1,t14"mmp/sh_c_"  ,            -2,2,0.5,sinh(-a)-cos(a), "a") \
+/*2210*/ o(FTFF1,t14"mmp/sh_ch_" ,            -2,2,0.5,sinh(-a)-cosh(a), "a") \
+/*2211*/ o(FTFF1,t14"mmp/sh_ex_" ,            -2,2,0.5,sinh(-a)-exp(a), "a") \
+/*2212*/ o(FTFF1,t14"mmp/sh_l_r" ,           0.5,2,0.5,sinh(-a)-log(a), "a") \
+/*2213*/ o(FTFF1,t14"mmp/sh_s_"  ,            -2,2,0.5,sinh(-a)-sin(a), "a") \
+/*2214*/ o(FTFF1,t14"mmp/sh_sh_" ,            -2,2,0.5,sinh(-a)-sinh(a), "a") \
+/*2215*/ o(FTFF1,t14"mmp/sh_t_r" ,            -2,2,0.5,sinh(-a)-tan(a), "a") \
+/*2216*/ o(FTFF1,t14"mmp/sh_th_r",            -2,2,0.5,sinh(-a)-tanh(a), "a") \
+/*2217*/ o(FTFF1,t14"mmp/t_ac_r" ,            -1,1,0.5,tan(-a)-acos(a), "a") \
+/*2218*/ o(FTFF1,t14"mmp/t_ach_r", 5.6875,9.6875,0.0625,tan(-a)-acosh(a), "a") \
+/*2219*/ o(FTFF1,t14"mmp/t_as_r" ,            -1,1,0.5,tan(-a)-asin(a), "a") \
+/*2220*/ o(FTFF1,t14"mmp/t_ash_r",            -2,2,0.5,tan(-a)-asinh(a), "a") \
+/*2221*/ o(FTFF1,t14"mmp/t_at_r" ,            -2,2,0.5,tan(-a)-atan(a), "a") \
+/*2222*/ o(FTFF1,t14"mmp/t_ath_r",     -0.75,0.75,0.25,tan(-a)-atanh(a), "a") \
+/*2223*/ o(FTFF1,t14"mmp/t_c_r"  ,            -2,2,0.5,tan(-a)-cos(a), "a") \
+/*2224*/ o(FTFF1,t14"mmp/t_ch_r" ,            -2,2,0.5,tan(-a)-cosh(a), "a") \
+/*2225*/ o(FTFF1,t14"mmp/t_ex_r" ,            -2,2,0.5,tan(-a)-exp(a), "a") \
+/*2226*/ o(FTFF1,t14"mmp/t_l_r"  ,           0.5,2,0.5,tan(-a)-log(a), "a") \
+/*2227*/ o(FTFF1,t14"mmp/t_s_r"  ,            -2,2,0.5,tan(-a)-sin(a), "a") \
+/*2228*/ o(FTFF1,t14"mmp/t_sh_r" ,            -2,2,0.5,tan(-a)-sinh(a), "a") \
+/*2229*/ o(FTFF1,t14"mmp/t_t_r"  ,            -2,2,0.5,tan(-a)-tan(a), "a") \
+/*2230*/ o(FTFF1,t14"mmp/t_th_r" ,            -2,2,0.5,tan(-a)-tanh(a), "a") \
+/*2231*/ o(FTFF1,t14"mmp/th_ac_r",            -1,1,0.5,tanh(-a)-acos(a), "a") \
+/*2232*/ o(FTFF1,t14"mmp/th_ach_r", 3.6875,8.25,0.0625,tanh(-a)-acosh(a), "a") \
+/*2233*/ o(FTFF1,t14"mmp/th_as_r",            -1,1,0.5,tanh(-a)-asin(a), "a") \
+/*2234*/ o(FTFF1,t14"mmp/th_ash_r",           -2,2,0.5,tanh(-a)-asinh(a), "a") \
+/*2235*/ o(FTFF1,t14"mmp/th_at_r",            -2,2,0.5,tanh(-a)-atan(a), "a") \
+/*2236*/ o(FTFF1,t14"mmp/th_ath_r",    -0.75,0.75,0.25,tanh(-a)-atanh(a), "a") \
+/*2237*/ o(FTFF1,t14"mmp/th_c_r" ,            -2,2,0.5,tanh(-a)-cos(a), "a") \
+/*2238*/ o(FTFF1,t14"mmp/th_ch_r",            -2,2,0.5,tanh(-a)-cosh(a), "a") \
+/*2239*/ o(FTFF1,t14"mmp/th_ex_r",            -2,2,0.5,tanh(-a)-exp(a), "a") \
+/*2240*/ o(FTFF1,t14"mmp/th_l_r" ,           0.5,2,0.5,tanh(-a)-log(a), "a") \
+/*2241*/ o(FTFF1,t14"mmp/th_s_r" ,            -2,2,0.5,tanh(-a)-sin(a), "a") \
+/*2242*/ o(FTFF1,t14"mmp/th_sh_r",            -2,2,0.5,tanh(-a)-sinh(a), "a") \
+/*2243*/ o(FTFF1,t14"mmp/th_t_r" ,            -2,2,0.5,tanh(-a)-tan(a), "a") \
+/*2244*/ o(FTFF1,t14"mmp/th_th_r",            -2,2,0.5,tanh(-a)-tanh(a), "a") \
+/*2245*/ o(FTFF1,t14"mpm/ac_ac_r",            -1,1,0.5,acos(a)-acos(-a), "a") \
+/*2246*/ o(FTFF1,t14"mpm/ac_as_r",            -1,1,0.5,acos(a)-asin(-a), "a") \
+/*2247*/ o(FTFF1,t14"mpm/ac_ash_r",           -1,1,0.5,acos(a)-asinh(-a), "a") \
+/*2248*/ o(FTFF1,t14"mpm/ac_at_r",            -1,1,0.5,acos(a)-atan(-a), "a") \
+/*2249*/ o(FTFF1,t14"mpm/ac_ath_",     -0.75,0.75,0.25,acos(a)-atanh(-a), "a") \
+/*2250*/ o(FTFF1,t14"mpm/ac_c_r" ,            -1,1,0.5,acos(a)-cos(-a), "a") \
+/*2251*/ o(FTFF1,t14"mpm/ac_ch_r",            -1,1,0.5,acos(a)-cosh(-a), "a") \
+/*2252*/ o(FTFF1,t14"mpm/ac_ex_r",            -1,1,0.5,acos(a)-exp(-a), "a") \
+/*2253*/ o(FTFF1,t14"mpm/ac_l_r" ,         -1,-0.1,0.5,acos(a)-log(-a), "a") \
+/*2254*/ o(FTFF1,t14"mpm/ac_s_r" ,            -1,1,0.5,acos(a)-sin(-a), "a") \
+/*2255*/ o(FTFF1,t14"mpm/ac_sh_r",            -1,1,0.5,acos(a)-sinh(-a), "a") \
+/*2256*/ o(FTFF1,t14"mpm/ac_t_r" ,            -1,1,0.5,acos(a)-tan(-a), "a") \
+/*2257*/ o(FTFF1,t14"mpm/ac_th_r",            -1,1,0.5,acos(a)-tanh(-a), "a") \
+/*2258*/ o(FTFF1,t14"mpm/ach_ash_r", 5.5625,8.75,0.0625,acosh(a)-asinh(-a), "a") \
+/*2259*/ o(FTFF1,t14"mpm/ach_at_r",  2.5,4.3125,0.0625,acosh(a)-atan(-a), "a") \
+/*2260*/ o(FTFF1,t14"mpm/ach_c_r",   3.375,8.75,0.0625,acosh(a)-cos(-a), "a") \
+/*2261*/ o(FTFF1,t14"mpm/ach_ch_r",  5.75,7.625,0.0625,acosh(a)-cosh(-a), "a") \
+/*2262*/ o(FTFF1,t14"mpm/ach_ex_r", 3.9375,7.4375,0.0625,acosh(a)-exp(-a), "a") \
+/*2263*/ o(FTFF1,t14"mpm/ach_s_r",  2.8125,6.75,0.0625,acosh(a)-sin(-a), "a") \
+/*2264*/ o(FTFF1,t14"mpm/ach_sh_r", 4.3125,9.875,0.0625,acosh(a)-sinh(-a), "a") \
+/*2265*/ o(FTFF1,t14"mpm/ach_t_r",  3.8125,6.75,0.0625,acosh(a)-tan(-a), "a") \
+/*2266*/ o(FTFF1,t14"mpm/ach_th_r",     2,7.875,0.0625,acosh(a)-tanh(-a), "a") \
+/*2267*/ o(FTFF1,t14"mpm/as_ac_r",            -1,1,0.5,asin(a)-acos(-a), "a") \
+/*2268*/ o(FTFF1,t14"mpm/as_as_r",            -1,1,0.5,asin(a)-asin(-a), "a") \
+/*2269*/ o(FTFF1,t14"mpm/as_ash_r",           -1,1,0.5,asin(a)-asinh(-a), "a") \
+/*2270*/ o(FTFF1,t14"mpm/as_at_r",            -1,1,0.5,asin(a)-atan(-a), "a") \
+/*2271*/ o(FTFF1,t14"mpm/as_ath_",     -0.75,0.75,0.25,asin(a)-atanh(-a), "a") \
+/*2272*/ o(FTFF1,t14"mpm/as_c_r" ,            -1,1,0.5,asin(a)-cos(-a), "a") \
+/*2273*/ o(FTFF1,t14"mpm/as_ch_r",            -1,1,0.5,asin(a)-cosh(-a), "a") \
+/*2274*/ o(FTFF1,t14"mpm/as_ex_r",            -1,1,0.5,asin(a)-exp(-a), "a") \
+/*2275*/ o(FTFF1,t14"mpm/as_l_r" ,         -1,-0.1,0.5,asin(a)-log(-a), "a") \
+/*2276*/ o(FTFF1,t14"mpm/as_s_r" ,            -1,1,0.5,asin(a)-sin(-a), "a") \
+/*2277*/ o(FTFF1,t14"mpm/as_sh_r",            -1,1,0.5,asin(a)-sinh(-a), "a") \
+/*2278*/ o(FTFF1,t14"mpm/as_t_r" ,            -1,1,0.5,asin(a)-tan(-a), "a") \
+/*2279*/ o(FTFF1,t14"mpm/as_th_r",            -1,1,0.5,asin(a)-tanh(-a), "a") \
+/*2280*/ o(FTFF1,t14"mpm/ash_ac_r",           -1,1,0.5,asinh(a)-acos(-a), "a") \
+/*2281*/ o(FTFF1,t14"mpm/ash_ach_r", -5.4375,-2.8125,0.0625,asinh(a)-acosh(-a), "a") \
+/*2282*/ o(FTFF1,t14"mpm/ash_as_r",           -1,1,0.5,asinh(a)-asin(-a), "a") \
+/*2283*/ o(FTFF1,t14"mpm/ash_ash_r",          -2,2,0.5,asinh(a)-asinh(-a), "a") \
+/*2284*/ o(FTFF1,t14"mpm/ash_at_r",           -2,2,0.5,asinh(a)-atan(-a), "a") \
+/*2285*/ o(FTFF1,t14"mpm/ash_ath_",    -0.75,0.75,0.25,asinh(a)-atanh(-a), "a") \
+/*2286*/ o(FTFF1,t14"mpm/ash_c_r",            -2,2,0.5,asinh(a)-cos(-a), "a") \
+/*2287*/ o(FTFF1,t14"mpm/ash_ch_r",           -2,2,0.5,asinh(a)-cosh(-a), "a") \
+/*2288*/ o(FTFF1,t14"mpm/ash_ex_r",           -2,2,0.5,asinh(a)-exp(-a), "a") \
+/*2289*/ o(FTFF1,t14"mpm/ash_l_r",           -4,0,0.75,asinh(a)-log(-a), "a") \
+/*2290*/ o(FTFF1,t14"mpm/ash_s_r",            -2,2,0.5,asinh(a)-sin(-a), "a") \
+/*2291*/ o(FTFF1,t14"mpm/ash_sh_r",           -2,2,0.5,asinh(a)-sinh(-a), "a") \
+/*2292*/ o(FTFF1,t14"mpm/ash_t_r",            -2,2,0.5,asinh(a)-tan(-a), "a") \
+/*2293*/ o(FTFF1,t14"mpm/ash_th_r",           -2,2,0.5,asinh(a)-tanh(-a), "a") \
+/*2294*/ o(FTFF1,t14"mpm/at_ac_r",            -1,1,0.5,atan(a)-acos(-a), "a") \
+/*2295*/ o(FTFF1,t14"mpm/at_ach_r", -3.5,-1.1875,0.0625,atan(a)-acosh(-a), "a") \
+/*2296*/ o(FTFF1,t14"mpm/at_as_r",            -1,1,0.5,atan(a)-asin(-a), "a") \
+/*2297*/ o(FTFF1,t14"mpm/at_ash_r",           -2,2,0.5,atan(a)-asinh(-a), "a") \
+/*2298*/ o(FTFF1,t14"mpm/at_at_r",            -2,2,0.5,atan(a)-atan(-a), "a") \
+/*2299*/ o(FTFF1,t14"mpm/at_ath_",     -0.75,0.75,0.25,atan(a)-atanh(-a), "a") \
+/*2300*/ o(FTFF1,t14"mpm/at_c_r" ,            -2,2,0.5,atan(a)-cos(-a), "a") \
+/*2301*/ o(FTFF1,t14"mpm/at_ch_r",            -2,2,0.5,atan(a)-cosh(-a), "a") \
+/*2302*/ o(FTFF1,t14"mpm/at_ex_r",            -2,2,0.5,atan(a)-exp(-a), "a") \
+/*2303*/ o(FTFF1,t14"mpm/at_l_r" ,           -4,0,0.75,atan(a)-log(-a), "a") \
+/*2304*/ o(FTFF1,t14"mpm/at_s_r" ,            -2,2,0.5,atan(a)-sin(-a), "a") \
+/*2305*/ o(FTFF1,t14"mpm/at_sh_r",            -2,2,0.5,atan(a)-sinh(-a), "a") \
+/*2306*/ o(FTFF1,t14"mpm/at_t_r" ,            -2,2,0.5,atan(a)-tan(-a), "a") \
+/*2307*/ o(FTFF1,t14"mpm/at_th_r",            -2,2,0.5,atan(a)-tanh(-a), "a") \
+/*2308*/ o(FTFF1,t14"mpm/ath_ac_",     -0.75,0.75,0.25,atanh(a)-acos(-a), "a") \
+/*2309*/ o(FTFF1,t14"mpm/ath_as_",     -0.75,0.75,0.25,atanh(a)-asin(-a), "a") \
+/*2310*/ o(FTFF1,t14"mpm/ath_ash_",    -0.75,0.75,0.25,atanh(a)-asinh(-a), "a") \
+/*2311*/ o(FTFF1,t14"mpm/ath_at_",     -0.75,0.75,0.25,atanh(a)-atan(-a), "a") \
+/*2312*/ o(FTFF1,t14"mpm/ath_ath_",    -0.75,0.75,0.25,atanh(a)-atanh(-a), "a") \
+/*2313*/ o(FTFF1,t14"mpm/ath_c_" ,     -0.75,0.75,0.25,atanh(a)-cos(-a), "a") \
+/*2314*/ o(FTFF1,t14"mpm/ath_ch_",     -0.75,0.75,0.25,atanh(a)-cosh(-a), "a") \
+/*2315*/ o(FTFF1,t14"mpm/ath_ex_",     -0.75,0.75,0.25,atanh(a)-exp(-a), "a") \
+/*2316*/ o(FTFF1,t14"mpm/ath_l_" ,    -0.75,-0.25,0.25,atanh(a)-log(-a), "a") \
+/*2317*/ o(FTFF1,t14"mpm/ath_s_" ,     -0.75,0.75,0.25,atanh(a)-sin(-a), "a") \
+/*2318*/ o(FTFF1,t14"mpm/ath_sh_",     -0.75,0.75,0.25,atanh(a)-sinh(-a), "a") \
+/*2319*/ o(FTFF1,t14"mpm/ath_t_r",     -0.75,0.75,0.25,atanh(a)-tan(-a), "a") \
+/*2320*/ o(FTFF1,t14"mpm/ath_th_r",    -0.75,0.75,0.25,atanh(a)-tanh(-a), "a") \
+/*2321*/ o(FTFF1,t14"mpm/c_ac_r" ,            -1,1,0.5,cos(a)-acos(-a), "a") \
+/*2322*/ o(FTFF1,t14"mpm/c_ach_r", -5.375,-4.375,0.0625,cos(a)-acosh(-a), "a") \
+/*2323*/ o(FTFF1,t14"mpm/c_as_r" ,            -1,1,0.5,cos(a)-asin(-a), "a") \
+/*2324*/ o(FTFF1,t14"mpm/c_ash_r",            -2,2,0.5,cos(a)-asinh(-a), "a") \
+/*2325*/ o(FTFF1,t14"mpm/c_at_r" ,            -2,2,0.5,cos(a)-atan(-a), "a") \
+/*2326*/ o(FTFF1,t14"mpm/c_ath_" ,     -0.75,0.75,0.25,cos(a)-atanh(-a), "a") \
+/*2327*/ o(FTFF1,t14"mpm/c_c_"   ,            -2,2,0.5,cos(a)-cos(-a), "a") \
+/*2328*/ o(FTFF1,t14"mpm/c_ch_"  ,            -2,2,0.5,cos(a)-cosh(-a), "a") \
+/*2329*/ o(FTFF1,t14"mpm/c_ex_"  ,            -2,2,0.5,cos(a)-exp(-a), "a") \
+/*2330*/ o(FTFF1,t14"mpm/c_l_r"  ,           -4,0,0.75,cos(a)-log(-a), "a") \
+/*2331*/ o(FTFF1,t14"mpm/c_s_"   ,            -2,2,0.5,cos(a)-sin(-a), "a") \
+/*2332*/ o(FTFF1,t14"mpm/c_sh_"  ,            -2,2,0.5,cos(a)-sinh(-a), "a") \
+/*2333*/ o(FTFF1,t14"mpm/c_t_r"  ,            -2,2,0.5,cos(a)-tan(-a), "a") \
+/*2334*/ o(FTFF1,t14"mpm/c_th_r" ,            -2,2,0.5,cos(a)-tanh(-a), "a") \
+/*2335*/ o(FTFF1,t14"mpm/ch_ac_r",            -1,1,0.5,cosh(a)-acos(-a), "a") \
+/*2336*/ o(FTFF1,t14"mpm/ch_ach_r", -5.25,-2.5625,0.0625,cosh(a)-acosh(-a), "a") \
+/*2337*/ o(FTFF1,t14"mpm/ch_as_r",            -1,1,0.5,cosh(a)-asin(-a), "a") \
+/*2338*/ o(FTFF1,t14"mpm/ch_ash_r",           -2,2,0.5,cosh(a)-asinh(-a), "a") \
+/*2339*/ o(FTFF1,t14"mpm/ch_at_r",            -2,2,0.5,cosh(a)-atan(-a), "a") \
+/*2340*/ o(FTFF1,t14"mpm/ch_ath_",     -0.75,0.75,0.25,cosh(a)-atanh(-a), "a") \
+/*2341*/ o(FTFF1,t14"mpm/ch_c_"  ,            -2,2,0.5,cosh(a)-cos(-a), "a") \
+/*2342*/ o(FTFF1,t14"mpm/ch_ch_" ,            -2,2,0.5,cosh(a)-cosh(-a), "a") \
+/*2343*/ o(FTFF1,t14"mpm/ch_ex_" ,            -2,2,0.5,cosh(a)-exp(-a), "a") \
+/*2344*/ o(FTFF1,t14"mpm/ch_l_r" ,           -4,0,0.75,cosh(a)-log(-a), "a") \
+/*2345*/ o(FTFF1,t14"mpm/ch_s_"  ,            -2,2,0.5,cosh(a)-sin(-a), "a") \
+/*2346*/ o(FTFF1,t14"mpm/ch_sh_" ,            -2,2,0.5,cosh(a)-sinh(-a), "a") \
+/*2347*/ o(FTFF1,t14"mpm/ch_t_r" ,            -2,2,0.5,cosh(a)-tan(-a), "a") \
+/*2348*/ o(FTFF1,t14"mpm/ch_th_r",            -2,2,0.5,cosh(a)-tanh(-a), "a") \
+/*2349*/ o(FTFF1,t14"mpm/ex_ac_r",            -1,1,0.5,exp(a)-acos(-a), "a") \
+/*2350*/ o(FTFF1,t14"mpm/ex_ach_r", -5.5,-1.6875,0.0625,exp(a)-acosh(-a), "a") \
+/*2351*/ o(FTFF1,t14"mpm/ex_as_r",            -1,1,0.5,exp(a)-asin(-a), "a") \
+/*2352*/ o(FTFF1,t14"mpm/ex_ash_r",           -2,2,0.5,exp(a)-asinh(-a), "a") \
+/*2353*/ o(FTFF1,t14"mpm/ex_at_r",            -2,2,0.5,exp(a)-atan(-a), "a") \
+/*2354*/ o(FTFF1,t14"mpm/ex_ath_",     -0.75,0.75,0.25,exp(a)-atanh(-a), "a") \
+/*2355*/ o(FTFF1,t14"mpm/ex_c_"  ,            -2,2,0.5,exp(a)-cos(-a), "a") \
+/*2356*/ o(FTFF1,t14"mpm/ex_ch_" ,            -2,2,0.5,exp(a)-cosh(-a), "a") \
+/*2357*/ o(FTFF1,t14"mpm/ex_ex_" ,            -2,2,0.5,exp(a)-exp(-a), "a") \
+/*2358*/ o(FTFF1,t14"mpm/ex_l_r" ,           -4,0,0.75,exp(a)-log(-a), "a") \
+/*2359*/ o(FTFF1,t14"mpm/ex_s_"  ,            -2,2,0.5,exp(a)-sin(-a), "a") \
+/*2360*/ o(FTFF1,t14"mpm/ex_sh_" ,            -2,2,0.5,exp(a)-sinh(-a), "a") \
+/*2361*/ o(FTFF1,t14"mpm/ex_t_r" ,            -2,2,0.5,exp(a)-tan(-a), "a") \
+/*2362*/ o(FTFF1,t14"mpm/ex_th_r",            -2,2,0.5,exp(a)-tanh(-a), "a") \
+/*2363*/ o(FTFF1,t14"mpm/l_ac_r" ,          0.5,1,0.25,log(a)-acos(-a), "a") \
+/*2364*/ o(FTFF1,t14"mpm/l_as_r" ,          0.5,1,0.25,log(a)-asin(-a), "a") \
+/*2365*/ o(FTFF1,t14"mpm/l_ash_r",           0.5,2,0.5,log(a)-asinh(-a), "a") \
+/*2366*/ o(FTFF1,t14"mpm/l_at_r" ,           0.5,2,0.5,log(a)-atan(-a), "a") \
+/*2367*/ o(FTFF1,t14"mpm/l_ath_r",     0.25,0.75,0.125,log(a)-atanh(-a), "a") \
+/*2368*/ o(FTFF1,t14"mpm/l_c_r"  ,           0.5,2,0.5,log(a)-cos(-a), "a") \
+/*2369*/ o(FTFF1,t14"mpm/l_ch_r" ,           0.5,2,0.5,log(a)-cosh(-a), "a") \
+/*2370*/ o(FTFF1,t14"mpm/l_ex_r" ,           0.5,2,0.5,log(a)-exp(-a), "a") \
+/*2371*/ o(FTFF1,t14"mpm/l_s_r"  ,           0.5,2,0.5,log(a)-sin(-a), "a") \
+/*2372*/ o(FTFF1,t14"mpm/l_sh_r" ,           0.5,2,0.5,log(a)-sinh(-a), "a") \
+/*2373*/ o(FTFF1,t14"mpm/l_t_r"  ,           0.5,2,0.5,log(a)-tan(-a), "a") \
+/*2374*/ o(FTFF1,t14"mpm/l_th_r" ,           0.5,2,0.5,log(a)-tanh(-a), "a") \
+/*2375*/ o(FTFF1,t14"mpm/s_ac_r" ,            -1,1,0.5,sin(a)-acos(-a), "a") \
+/*2376*/ o(FTFF1,t14"mpm/s_ach_r", -6.1875,-5.5,0.0625,sin(a)-acosh(-a), "a") \
+/*2377*/ o(FTFF1,t14"mpm/s_as_r" ,            -1,1,0.5,sin(a)-asin(-a), "a") \
+/*2378*/ o(FTFF1,t14"mpm/s_ash_r",            -2,2,0.5,sin(a)-asinh(-a), "a") \
+/*2379*/ o(FTFF1,t14"mpm/s_at_r" ,            -2,2,0.5,sin(a)-atan(-a), "a") \
+/*2380*/ o(FTFF1,t14"mpm/s_ath_" ,     -0.75,0.75,0.25,sin(a)-atanh(-a), "a") \
+/*2381*/ o(FTFF1,t14"mpm/s_c_"   ,            -2,2,0.5,sin(a)-cos(-a), "a") \
+/*2382*/ o(FTFF1,t14"mpm/s_ch_"  ,            -2,2,0.5,sin(a)-cosh(-a), "a") \
+/*2383*/ o(FTFF1,t14"mpm/s_ex_"  ,            -2,2,0.5,sin(a)-exp(-a), "a") \
+/*2384*/ o(FTFF1,t14"mpm/s_l_r"  ,           -4,0,0.75,sin(a)-log(-a), "a") \
+/*2385*/ o(FTFF1,t14"mpm/s_s_"   ,            -2,2,0.5,sin(a)-sin(-a), "a") \
+/*2386*/ o(FTFF1,t14"mpm/s_sh_"  ,            -2,2,0.5,sin(a)-sinh(-a), "a") \
+/*2387*/ o(FTFF1,t14"mpm/s_t_r"  ,            -2,2,0.5,sin(a)-tan(-a), "a") \
+/*2388*/ o(FTFF1,t14"mpm/s_th_r" ,            -2,2,0.5,sin(a)-tanh(-a), "a") \
+/*2389*/ o(FTFF1,t14"mpm/sh_ac_r",            -1,1,0.5,sinh(a)-acos(-a), "a") \
+/*2390*/ o(FTFF1,t14"mpm/sh_ach_r", -5.375,-2.1875,0.0625,sinh(a)-acosh(-a), "a") \
+/*2391*/ o(FTFF1,t14"mpm/sh_as_r",            -1,1,0.5,sinh(a)-asin(-a), "a") \
+/*2392*/ o(FTFF1,t14"mpm/sh_ash_r",           -2,2,0.5,sinh(a)-asinh(-a), "a") \
+/*2393*/ o(FTFF1,t14"mpm/sh_at_r",            -2,2,0.5,sinh(a)-atan(-a), "a") \
+/*2394*/ o(FTFF1,t14"mpm/sh_ath_",     -0.75,0.75,0.25,sinh(a)-atanh(-a), "a") \
+/*2395*/ o(FTFF1,t14"mpm/sh_c_"  ,            -2,2,0.5,sinh(a)-cos(-a), "a") \
+/*2396*/ o(FTFF1,t14"mpm/sh_ch_" ,            -2,2,0.5,sinh(a)-cosh(-a), "a") \
+/*2397*/ o(FTFF1,t14"mpm/sh_ex_" ,            -2,2,0.5,sinh(a)-exp(-a), "a") \
+/*2398*/ o(FTFF1,t14"mpm/sh_l_r" ,           -4,0,0.75,sinh(a)-log(-a), "a") \
+/*2399*/ o(FTFF1,t14"mpm/sh_s_"  ,            -2,2,0.5,sinh(a)-sin(-a), "a") \
+/*2400*/ o(FTFF1,t14"mpm/sh_sh_" ,            -2,2,0.5,sinh(a)-sinh(-a), "a") \
+/*2401*/ o(FTFF1,t14"mpm/sh_t_r" ,            -2,2,0.5,sinh(a)-tan(-a), "a") \
+/*2402*/ o(FTFF1,t14"mpm/sh_th_r",            -2,2,0.5,sinh(a)-tanh(-a), "a") \
+/*2403*/ o(FTFF1,t14"mpm/t_ac_r" ,            -1,1,0.5,tan(a)-acos(-a), "a") \
+/*2404*/ o(FTFF1,t14"mpm/t_ach_r", -3.4375,-1.0625,0.0625,tan(a)-acosh(-a), "a") \
+/*2405*/ o(FTFF1,t14"mpm/t_as_r" ,            -1,1,0.5,tan(a)-asin(-a), "a") \
+/*2406*/ o(FTFF1,t14"mpm/t_ash_r",            -2,2,0.5,tan(a)-asinh(-a), "a") \
+/*2407*/ o(FTFF1,t14"mpm/t_at_r" ,            -2,2,0.5,tan(a)-atan(-a), "a") \
+/*2408*/ o(FTFF1,t14"mpm/t_ath_r",     -0.75,0.75,0.25,tan(a)-atanh(-a), "a") \
+/*2409*/ o(FTFF1,t14"mpm/t_c_r"  ,            -2,2,0.5,tan(a)-cos(-a), "a") \
+/*2410*/ o(FTFF1,t14"mpm/t_ch_r" ,            -2,2,0.5,tan(a)-cosh(-a), "a") \
+/*2411*/ o(FTFF1,t14"mpm/t_ex_r" ,            -2,2,0.5,tan(a)-exp(-a), "a") \
+/*2412*/ o(FTFF1,t14"mpm/t_l_r"  ,           -4,0,0.75,tan(a)-log(-a), "a") \
+/*2413*/ o(FTFF1,t14"mpm/t_s_r"  ,            -2,2,0.5,tan(a)-sin(-a), "a") \
+/*2414*/ o(FTFF1,t14"mpm/t_sh_r" ,            -2,2,0.5,tan(a)-sinh(-a), "a") \
+/*2415*/ o(FTFF1,t14"mpm/t_t_r"  ,            -2,2,0.5,tan(a)-tan(-a), "a") \
+/*2416*/ o(FTFF1,t14"mpm/t_th_r" ,            -2,2,0.5,tan(a)-tanh(-a), "a") \
+/*2417*/ o(FTFF1,t14"mpm/th_ac_r",            -1,1,0.5,tanh(a)-acos(-a), "a") \
+/*2418*/ o(FTFF1,t14"mpm/th_ach_r", -2.5,-1.8125,0.0625,tanh(a)-acosh(-a), "a") \
+/*2419*/ o(FTFF1,t14"mpm/th_as_r",            -1,1,0.5,tanh(a)-asin(-a), "a") \
+/*2420*/ o(FTFF1,t14"mpm/th_ash_r",           -2,2,0.5,tanh(a)-asinh(-a), "a") \
+/*2421*/ o(FTFF1,t14"mpm/th_at_r",            -2,2,0.5,tanh(a)-atan(-a), "a") \
+/*2422*/ o(FTFF1,t14"mpm/th_ath_r",    -0.75,0.75,0.25,tanh(a)-atanh(-a), "a") \
+/*2423*/ o(FTFF1,t14"mpm/th_c_r" ,            -2,2,0.5,tanh(a)-cos(-a), "a") \
+/*2424*/ o(FTFF1,t14"mpm/th_ch_r",            -2,2,0.5,tanh(a)-cosh(-a), "a") \
+/*2425*/ o(FTFF1,t14"mpm/th_ex_r",            -2,2,0.5,tanh(a)-exp(-a), "a") \
+/*2426*/ o(FTFF1,t14"mpm/th_l_r" ,           -4,0,0.75,tanh(a)-log(-a), "a") \
+/*2427*/ o(FTFF1,t14"mpm/th_s_r" ,            -2,2,0.5,tanh(a)-sin(-a), "a") \
+/*2428*/ o(FTFF1,t14"mpm/th_sh_r",            -2,2,0.5,tanh(a)-sinh(-a), "a") \
+/*2429*/ o(FTFF1,t14"mpm/th_t_r" ,            -2,2,0.5,tanh(a)-tan(-a), "a") \
+/*2430*/ o(FTFF1,t14"mpm/th_th_r",            -2,2,0.5,tanh(a)-tanh(-a), "a") \
+/*2431*/ o(FTFF1,t14"mpp/ac_ac_r",            -1,1,0.5,acos(a)-acos(a), "a") \
+/*2432*/ o(FTFF1,t14"mpp/ac_as_r",            -1,1,0.5,acos(a)-asin(a), "a") \
+/*2433*/ o(FTFF1,t14"mpp/ac_ash_r",           -1,1,0.5,acos(a)-asinh(a), "a") \
+/*2434*/ o(FTFF1,t14"mpp/ac_at_r",            -1,1,0.5,acos(a)-atan(a), "a") \
+/*2435*/ o(FTFF1,t14"mpp/ac_ath_",     -0.75,0.75,0.25,acos(a)-atanh(a), "a") \
+/*2436*/ o(FTFF1,t14"mpp/ac_c_r" ,            -1,1,0.5,acos(a)-cos(a), "a") \
+/*2437*/ o(FTFF1,t14"mpp/ac_ch_r",            -1,1,0.5,acos(a)-cosh(a), "a") \
+/*2438*/ o(FTFF1,t14"mpp/ac_ex_r",            -1,1,0.5,acos(a)-exp(a), "a") \
+/*2439*/ o(FTFF1,t14"mpp/ac_l_r" ,          0.5,1,0.25,acos(a)-log(a), "a") \
+/*2440*/ o(FTFF1,t14"mpp/ac_s_r" ,            -1,1,0.5,acos(a)-sin(a), "a") \
+/*2441*/ o(FTFF1,t14"mpp/ac_sh_r",            -1,1,0.5,acos(a)-sinh(a), "a") \
+/*2442*/ o(FTFF1,t14"mpp/ac_t_r" ,            -1,1,0.5,acos(a)-tan(a), "a") \
+/*2443*/ o(FTFF1,t14"mpp/ac_th_r",            -1,1,0.5,acos(a)-tanh(a), "a") \
+/*2444*/ o(FTFF1,t14"mpp/ach_ach_r", 3.625,5.3125,0.0625,acosh(a)-acosh(a), "a") \
+/*2445*/ o(FTFF1,t14"mpp/ach_ash_r", 3.3125,3.9375,0.0625,acosh(a)-asinh(a), "a") \
+/*2446*/ o(FTFF1,t14"mpp/ach_at_r", 3.9375,6.3125,0.0625,acosh(a)-atan(a), "a") \
+/*2447*/ o(FTFF1,t14"mpp/ach_c_r", 5.9375,11.8125,0.0625,acosh(a)-cos(a), "a") \
+/*2448*/ o(FTFF1,t14"mpp/ach_ch_r", 4.375,6.0625,0.0625,acosh(a)-cosh(a), "a") \
+/*2449*/ o(FTFF1,t14"mpp/ach_ex_r",  4.75,9.875,0.0625,acosh(a)-exp(a), "a") \
+/*2450*/ o(FTFF1,t14"mpp/ach_l_r", 1.6875,4.875,0.0625,acosh(a)-log(a), "a") \
+/*2451*/ o(FTFF1,t14"mpp/ach_s_r", 1.3125,7.375,0.0625,acosh(a)-sin(a), "a") \
+/*2452*/ o(FTFF1,t14"mpp/ach_sh_r",    1.3125,7,0.0625,acosh(a)-sinh(a), "a") \
+/*2453*/ o(FTFF1,t14"mpp/ach_t_r", 1.1875,7.375,0.0625,acosh(a)-tan(a), "a") \
+/*2454*/ o(FTFF1,t14"mpp/ach_th_r", 5.625,6.625,0.0625,acosh(a)-tanh(a), "a") \
+/*2455*/ o(FTFF1,t14"mpp/as_ac_r",            -1,1,0.5,asin(a)-acos(a), "a") \
+/*2456*/ o(FTFF1,t14"mpp/as_as_r",            -1,1,0.5,asin(a)-asin(a), "a") \
+/*2457*/ o(FTFF1,t14"mpp/as_ash_r",           -1,1,0.5,asin(a)-asinh(a), "a") \
+/*2458*/ o(FTFF1,t14"mpp/as_at_r",            -1,1,0.5,asin(a)-atan(a), "a") \
+/*2459*/ o(FTFF1,t14"mpp/as_ath_",     -0.75,0.75,0.25,asin(a)-atanh(a), "a") \
+/*2460*/ o(FTFF1,t14"mpp/as_c_r" ,            -1,1,0.5,asin(a)-cos(a), "a") \
+/*2461*/ o(FTFF1,t14"mpp/as_ch_r",            -1,1,0.5,asin(a)-cosh(a), "a") \
+/*2462*/ o(FTFF1,t14"mpp/as_ex_r",            -1,1,0.5,asin(a)-exp(a), "a") \
+/*2463*/ o(FTFF1,t14"mpp/as_l_r" ,          0.5,1,0.25,asin(a)-log(a), "a") \
+/*2464*/ o(FTFF1,t14"mpp/as_s_r" ,            -1,1,0.5,asin(a)-sin(a), "a") \
+/*2465*/ o(FTFF1,t14"mpp/as_sh_r",            -1,1,0.5,asin(a)-sinh(a), "a") \
+/*2466*/ o(FTFF1,t14"mpp/as_t_r" ,            -1,1,0.5,asin(a)-tan(a), "a") \
+/*2467*/ o(FTFF1,t14"mpp/as_th_r",            -1,1,0.5,asin(a)-tanh(a), "a") \
+/*2468*/ o(FTFF1,t14"mpp/ash_ac_r",           -1,1,0.5,asinh(a)-acos(a), "a") \
+/*2469*/ o(FTFF1,t14"mpp/ash_ach_r",    3,8.625,0.0625,asinh(a)-acosh(a), "a") \
+/*2470*/ o(FTFF1,t14"mpp/ash_as_r",           -1,1,0.5,asinh(a)-asin(a), "a") \
+/*2471*/ o(FTFF1,t14"mpp/ash_ash_r",          -2,2,0.5,asinh(a)-asinh(a), "a") \
+/*2472*/ o(FTFF1,t14"mpp/ash_at_r",           -2,2,0.5,asinh(a)-atan(a), "a") \
+/*2473*/ o(FTFF1,t14"mpp/ash_ath_",    -0.75,0.75,0.25,asinh(a)-atanh(a), "a") \
+/*2474*/ o(FTFF1,t14"mpp/ash_c_r",            -2,2,0.5,asinh(a)-cos(a), "a") \
+/*2475*/ o(FTFF1,t14"mpp/ash_ch_r",           -2,2,0.5,asinh(a)-cosh(a), "a") \
+/*2476*/ o(FTFF1,t14"mpp/ash_ex_r",           -2,2,0.5,asinh(a)-exp(a), "a") \
+/*2477*/ o(FTFF1,t14"mpp/ash_l_r",           0.5,2,0.5,asinh(a)-log(a), "a") \
+/*2478*/ o(FTFF1,t14"mpp/ash_s_r",            -2,2,0.5,asinh(a)-sin(a), "a") \
+/*2479*/ o(FTFF1,t14"mpp/ash_sh_r",           -2,2,0.5,asinh(a)-sinh(a), "a") \
+/*2480*/ o(FTFF1,t14"mpp/ash_t_r",            -2,2,0.5,asinh(a)-tan(a), "a") \
+/*2481*/ o(FTFF1,t14"mpp/ash_th_r",           -2,2,0.5,asinh(a)-tanh(a), "a") \
+/*2482*/ o(FTFF1,t14"mpp/at_ac_r",            -1,1,0.5,atan(a)-acos(a), "a") \
+/*2483*/ o(FTFF1,t14"mpp/at_ach_r", 5.625,11.1875,0.0625,atan(a)-acosh(a), "a") \
+/*2484*/ o(FTFF1,t14"mpp/at_as_r",            -1,1,0.5,atan(a)-asin(a), "a") \
+/*2485*/ o(FTFF1,t14"mpp/at_ash_r",           -2,2,0.5,atan(a)-asinh(a), "a") \
+/*2486*/ o(FTFF1,t14"mpp/at_at_r",            -2,2,0.5,atan(a)-atan(a), "a") \
+/*2487*/ o(FTFF1,t14"mpp/at_ath_",     -0.75,0.75,0.25,atan(a)-atanh(a), "a") \
+/*2488*/ o(FTFF1,t14"mpp/at_c_r" ,            -2,2,0.5,atan(a)-cos(a), "a") \
+/*2489*/ o(FTFF1,t14"mpp/at_ch_r",            -2,2,0.5,atan(a)-cosh(a), "a") \
+/*2490*/ o(FTFF1,t14"mpp/at_ex_r",            -2,2,0.5,atan(a)-exp(a), "a") \
+/*2491*/ o(FTFF1,t14"mpp/at_l_r" ,           0.5,2,0.5,atan(a)-log(a), "a") \
+/*2492*/ o(FTFF1,t14"mpp/at_s_r" ,            -2,2,0.5,atan(a)-sin(a), "a") \
+/*2493*/ o(FTFF1,t14"mpp/at_sh_r",            -2,2,0.5,atan(a)-sinh(a), "a") \
+/*2494*/ o(FTFF1,t14"mpp/at_t_r" ,            -2,2,0.5,atan(a)-tan(a), "a") \
+/*2495*/ o(FTFF1,t14"mpp/at_th_r",            -2,2,0.5,atan(a)-tanh(a), "a") \
+/*2496*/ o(FTFF1,t14"mpp/ath_ac_",     -0.75,0.75,0.25,atanh(a)-acos(a), "a") \
+/*2497*/ o(FTFF1,t14"mpp/ath_as_",     -0.75,0.75,0.25,atanh(a)-asin(a), "a") \
+/*2498*/ o(FTFF1,t14"mpp/ath_ash_",    -0.75,0.75,0.25,atanh(a)-asinh(a), "a") \
+/*2499*/ o(FTFF1,t14"mpp/ath_at_",     -0.75,0.75,0.25,atanh(a)-atan(a), "a") \
+/*2500*/ o(FTFF1,t14"mpp/ath_ath_",    -0.75,0.75,0.25,atanh(a)-atanh(a), "a") \
+/*2501*/ o(FTFF1,t14"mpp/ath_c_" ,     -0.75,0.75,0.25,atanh(a)-cos(a), "a") \
+/*2502*/ o(FTFF1,t14"mpp/ath_ch_",     -0.75,0.75,0.25,atanh(a)-cosh(a), "a") \
+/*2503*/ o(FTFF1,t14"mpp/ath_ex_",     -0.75,0.75,0.25,atanh(a)-exp(a), "a") \
+/*2504*/ o(FTFF1,t14"mpp/ath_l_r",     0.25,0.75,0.125,atanh(a)-log(a), "a") \
+/*2505*/ o(FTFF1,t14"mpp/ath_s_" ,     -0.75,0.75,0.25,atanh(a)-sin(a), "a") \
+/*2506*/ o(FTFF1,t14"mpp/ath_sh_",     -0.75,0.75,0.25,atanh(a)-sinh(a), "a") \
+/*2507*/ o(FTFF1,t14"mpp/ath_t_r",     -0.75,0.75,0.25,atanh(a)-tan(a), "a") \
+/*2508*/ o(FTFF1,t14"mpp/ath_th_r",    -0.75,0.75,0.25,atanh(a)-tanh(a), "a") \
+/*2509*/ o(FTFF1,t14"mpp/c_ac_r" ,            -1,1,0.5,cos(a)-acos(a), "a") \
+/*2510*/ o(FTFF1,t14"mpp/c_ach_r",  3.1875,6.75,0.0625,cos(a)-acosh(a), "a") \
+/*2511*/ o(FTFF1,t14"mpp/c_as_r" ,            -1,1,0.5,cos(a)-asin(a), "a") \
+/*2512*/ o(FTFF1,t14"mpp/c_ash_r",            -2,2,0.5,cos(a)-asinh(a), "a") \
+/*2513*/ o(FTFF1,t14"mpp/c_at_r" ,            -2,2,0.5,cos(a)-atan(a), "a") \
+/*2514*/ o(FTFF1,t14"mpp/c_ath_" ,     -0.75,0.75,0.25,cos(a)-atanh(a), "a") \
+/*2515*/ o(FTFF1,t14"mpp/c_c_"   ,            -2,2,0.5,cos(a)-cos(a), "a") \
+/*2516*/ o(FTFF1,t14"mpp/c_ch_"  ,            -2,2,0.5,cos(a)-cosh(a), "a") \
+/*2517*/ o(FTFF1,t14"mpp/c_ex_"  ,            -2,2,0.5,cos(a)-exp(a), "a") \
+/*2518*/ o(FTFF1,t14"mpp/c_l_r"  ,           0.5,2,0.5,cos(a)-log(a), "a") \
+/*2519*/ o(FTFF1,t14"mpp/c_s_"   ,            -2,2,0.5,cos(a)-sin(a), "a") \
+/*2520*/ o(FTFF1,t14"mpp/c_sh_"  ,            -2,2,0.5,cos(a)-sinh(a), "a") \
+/*2521*/ o(FTFF1,t14"mpp/c_t_r"  ,            -2,2,0.5,cos(a)-tan(a), "a") \
+/*2522*/ o(FTFF1,t14"mpp/c_th_r" ,            -2,2,0.5,cos(a)-tanh(a), "a") \
+/*2523*/ o(FTFF1,t14"mpp/ch_ac_r",            -1,1,0.5,cosh(a)-acos(a), "a") \
+/*2524*/ o(FTFF1,t14"mpp/ch_ach_r", 4.375,10.4375,0.0625,cosh(a)-acosh(a), "a") \
+/*2525*/ o(FTFF1,t14"mpp/ch_as_r",            -1,1,0.5,cosh(a)-asin(a), "a") \
+/*2526*/ o(FTFF1,t14"mpp/ch_ash_r",           -2,2,0.5,cosh(a)-asinh(a), "a") \
+/*2527*/ o(FTFF1,t14"mpp/ch_at_r",            -2,2,0.5,cosh(a)-atan(a), "a") \
+/*2528*/ o(FTFF1,t14"mpp/ch_ath_",     -0.75,0.75,0.25,cosh(a)-atanh(a), "a") \
+/*2529*/ o(FTFF1,t14"mpp/ch_c_"  ,            -2,2,0.5,cosh(a)-cos(a), "a") \
+/*2530*/ o(FTFF1,t14"mpp/ch_ch_" ,            -2,2,0.5,cosh(a)-cosh(a), "a") \
+/*2531*/ o(FTFF1,t14"mpp/ch_ex_" ,            -2,2,0.5,cosh(a)-exp(a), "a") \
+/*2532*/ o(FTFF1,t14"mpp/ch_l_r" ,           0.5,2,0.5,cosh(a)-log(a), "a") \
+/*2533*/ o(FTFF1,t14"mpp/ch_s_"  ,            -2,2,0.5,cosh(a)-sin(a), "a") \
+/*2534*/ o(FTFF1,t14"mpp/ch_sh_" ,            -2,2,0.5,cosh(a)-sinh(a), "a") \
+/*2535*/ o(FTFF1,t14"mpp/ch_t_r" ,            -2,2,0.5,cosh(a)-tan(a), "a") \
+/*2536*/ o(FTFF1,t14"mpp/ch_th_r",            -2,2,0.5,cosh(a)-tanh(a), "a") \
+/*2537*/ o(FTFF1,t14"mpp/ex_ac_r",            -1,1,0.5,exp(a)-acos(a), "a") \
+/*2538*/ o(FTFF1,t14"mpp/ex_ach_r", 5.25,10.3125,0.0625,exp(a)-acosh(a), "a") \
+/*2539*/ o(FTFF1,t14"mpp/ex_as_r",            -1,1,0.5,exp(a)-asin(a), "a") \
+/*2540*/ o(FTFF1,t14"mpp/ex_ash_r",           -2,2,0.5,exp(a)-asinh(a), "a") \
+/*2541*/ o(FTFF1,t14"mpp/ex_at_r",            -2,2,0.5,exp(a)-atan(a), "a") \
+/*2542*/ o(FTFF1,t14"mpp/ex_ath_",     -0.75,0.75,0.25,exp(a)-atanh(a), "a") \
+/*2543*/ o(FTFF1,t14"mpp/ex_c_"  ,            -2,2,0.5,exp(a)-cos(a), "a") \
+/*2544*/ o(FTFF1,t14"mpp/ex_ch_" ,            -2,2,0.5,exp(a)-cosh(a), "a") \
+/*2545*/ o(FTFF1,t14"mpp/ex_ex_" ,            -2,2,0.5,exp(a)-exp(a), "a") \
+/*2546*/ o(FTFF1,t14"mpp/ex_l_r" ,           0.5,2,0.5,exp(a)-log(a), "a") \
+/*2547*/ o(FTFF1,t14"mpp/ex_s_"  ,            -2,2,0.5,exp(a)-sin(a), "a") \
+/*2548*/ o(FTFF1,t14"mpp/ex_sh_" ,            -2,2,0.5,exp(a)-sinh(a), "a") \
+/*2549*/ o(FTFF1,t14"mpp/ex_t_r" ,            -2,2,0.5,exp(a)-tan(a), "a") \
+/*2550*/ o(FTFF1,t14"mpp/ex_th_r",            -2,2,0.5,exp(a)-tanh(a), "a") \
+/*2551*/ o(FTFF1,t14"mpp/l_ac_r" ,          0.5,1,0.25,log(a)-acos(a), "a") \
+/*2552*/ o(FTFF1,t14"mpp/l_ach_r", 1.875,5.8125,0.0625,log(a)-acosh(a), "a") \
+/*2553*/ o(FTFF1,t14"mpp/l_as_r" ,          0.5,1,0.25,log(a)-asin(a), "a") \
+/*2554*/ o(FTFF1,t14"mpp/l_ash_r",           0.5,2,0.5,log(a)-asinh(a), "a") \
+/*2555*/ o(FTFF1,t14"mpp/l_at_r" ,           0.5,2,0.5,log(a)-atan(a), "a") \
+/*2556*/ o(FTFF1,t14"mpp/l_ath_r",     0.25,0.75,0.125,log(a)-atanh(a), "a") \
+/*2557*/ o(FTFF1,t14"mpp/l_c_r"  ,           0.5,2,0.5,log(a)-cos(a), "a") \
+/*2558*/ o(FTFF1,t14"mpp/l_ch_r" ,           0.5,2,0.5,log(a)-cosh(a), "a") \
+/*2559*/ o(FTFF1,t14"mpp/l_ex_r" ,           0.5,2,0.5,log(a)-exp(a), "a") \
+/*2560*/ o(FTFF1,t14"mpp/l_l_r"  ,           0.5,2,0.5,log(a)-log(a), "a") \
+/*2561*/ o(FTFF1,t14"mpp/l_s_r"  ,           0.5,2,0.5,log(a)-sin(a), "a") \
+/*2562*/ o(FTFF1,t14"mpp/l_sh_r" ,           0.5,2,0.5,log(a)-sinh(a), "a") \
+/*2563*/ o(FTFF1,t14"mpp/l_t_r"  ,           0.5,2,0.5,log(a)-tan(a), "a") \
+/*2564*/ o(FTFF1,t14"mpp/l_th_r" ,           0.5,2,0.5,log(a)-tanh(a), "a") \
+/*2565*/ o(FTFF1,t14"mpp/s_ac_r" ,            -1,1,0.5,sin(a)-acos(a), "a") \
+/*2566*/ o(FTFF1,t14"mpp/s_ach_r",      1,3.875,0.0625,sin(a)-acosh(a), "a") \
+/*2567*/ o(FTFF1,t14"mpp/s_as_r" ,            -1,1,0.5,sin(a)-asin(a), "a") \
+/*2568*/ o(FTFF1,t14"mpp/s_ash_r",            -2,2,0.5,sin(a)-asinh(a), "a") \
+/*2569*/ o(FTFF1,t14"mpp/s_at_r" ,            -2,2,0.5,sin(a)-atan(a), "a") \
+/*2570*/ o(FTFF1,t14"mpp/s_ath_" ,     -0.75,0.75,0.25,sin(a)-atanh(a), "a") \
+/*2571*/ o(FTFF1,t14"mpp/s_c_"   ,            -2,2,0.5,sin(a)-cos(a), "a") \
+/*2572*/ o(FTFF1,t14"mpp/s_ch_"  ,            -2,2,0.5,sin(a)-cosh(a), "a") \
+/*2573*/ o(FTFF1,t14"mpp/s_ex_"  ,            -2,2,0.5,sin(a)-exp(a), "a") \
+/*2574*/ o(FTFF1,t14"mpp/s_l_r"  ,           0.5,2,0.5,sin(a)-log(a), "a") \
+/*2575*/ o(FTFF1,t14"mpp/s_s_"   ,            -2,2,0.5,sin(a)-sin(a), "a") \
+/*2576*/ o(FTFF1,t14"mpp/s_sh_"  ,            -2,2,0.5,sin(a)-sinh(a), "a") \
+/*2577*/ o(FTFF1,t14"mpp/s_t_r"  ,            -2,2,0.5,sin(a)-tan(a), "a") \
+/*2578*/ o(FTFF1,t14"mpp/s_th_r" ,            -2,2,0.5,sin(a)-tanh(a), "a") \
+/*2579*/ o(FTFF1,t14"mpp/sh_ac_r",            -1,1,0.5,sinh(a)-acos(a), "a") \
+/*2580*/ o(FTFF1,t14"mpp/sh_ach_r", 6.1875,7.4375,0.0625,sinh(a)-acosh(a), "a") \
+/*2581*/ o(FTFF1,t14"mpp/sh_as_r",            -1,1,0.5,sinh(a)-asin(a), "a") \
+/*2582*/ o(FTFF1,t14"mpp/sh_ash_r",           -2,2,0.5,sinh(a)-asinh(a), "a") \
+/*2583*/ o(FTFF1,t14"mpp/sh_at_r",            -2,2,0.5,sinh(a)-atan(a), "a") \
+/*2584*/ o(FTFF1,t14"mpp/sh_ath_",     -0.75,0.75,0.25,sinh(a)-atanh(a), "a") \
+/*2585*/ o(FTFF1,t14"mpp/sh_c_"  ,            -2,2,0.5,sinh(a)-cos(a), "a") \
+/*2586*/ o(FTFF1,t14"mpp/sh_ch_" ,            -2,2,0.5,sinh(a)-cosh(a), "a") \
+/*2587*/ o(FTFF1,t14"mpp/sh_ex_" ,            -2,2,0.5,sinh(a)-exp(a), "a") \
+/*2588*/ o(FTFF1,t14"mpp/sh_l_r" ,           0.5,2,0.5,sinh(a)-log(a), "a") \
+/*2589*/ o(FTFF1,t14"mpp/sh_s_"  ,            -2,2,0.5,sinh(a)-sin(a), "a") \
+/*2590*/ o(FTFF1,t14"mpp/sh_sh_" ,            -2,2,0.5,sinh(a)-sinh(a), "a") \
+/*2591*/ o(FTFF1,t14"mpp/sh_t_r" ,            -2,2,0.5,sinh(a)-tan(a), "a") \
+/*2592*/ o(FTFF1,t14"mpp/sh_th_r",            -2,2,0.5,sinh(a)-tanh(a), "a") \
+/*2593*/ o(FTFF1,t14"mpp/t_ac_r" ,            -1,1,0.5,tan(a)-acos(a), "a") \
+/*2594*/ o(FTFF1,t14"mpp/t_ach_r",      3.375,5,0.0625,tan(a)-acosh(a), "a") \
+/*2595*/ o(FTFF1,t14"mpp/t_as_r" ,            -1,1,0.5,tan(a)-asin(a), "a") \
+/*2596*/ o(FTFF1,t14"mpp/t_ash_r",            -2,2,0.5,tan(a)-asinh(a), "a") \
+/*2597*/ o(FTFF1,t14"mpp/t_at_r" ,            -2,2,0.5,tan(a)-atan(a), "a") \
+/*2598*/ o(FTFF1,t14"mpp/t_ath_r",     -0.75,0.75,0.25,tan(a)-atanh(a), "a") \
+/*2599*/ o(FTFF1,t14"mpp/t_c_r"  ,            -2,2,0.5,tan(a)-cos(a), "a") \
+/*2600*/ o(FTFF1,t14"mpp/t_ch_r" ,            -2,2,0.5,tan(a)-cosh(a), "a") \
+/*2601*/ o(FTFF1,t14"mpp/t_ex_r" ,            -2,2,0.5,tan(a)-exp(a), "a") \
+/*2602*/ o(FTFF1,t14"mpp/t_l_r"  ,           0.5,2,0.5,tan(a)-log(a), "a") \
+/*2603*/ o(FTFF1,t14"mpp/t_s_r"  ,            -2,2,0.5,tan(a)-sin(a), "a") \
+/*2604*/ o(FTFF1,t14"mpp/t_sh_r" ,            -2,2,0.5,tan(a)-sinh(a), "a") \
+/*2605*/ o(FTFF1,t14"mpp/t_t_r"  ,            -2,2,0.5,tan(a)-tan(a), "a") \
+/*2606*/ o(FTFF1,t14"mpp/t_th_r" ,            -2,2,0.5,tan(a)-tanh(a), "a") \
+/*2607*/ o(FTFF1,t14"mpp/th_ac_r",            -1,1,0.5,tanh(a)-acos(a), "a") \
+/*2608*/ o(FTFF1,t14"mpp/th_ach_r",   3.25,7.25,0.0625,tanh(a)-acosh(a), "a") \
+/*2609*/ o(FTFF1,t14"mpp/th_as_r",            -1,1,0.5,tanh(a)-asin(a), "a") \
+/*2610*/ o(FTFF1,t14"mpp/th_ash_r",           -2,2,0.5,tanh(a)-asinh(a), "a") \
+/*2611*/ o(FTFF1,t14"mpp/th_at_r",            -2,2,0.5,tanh(a)-atan(a), "a") \
+/*2612*/ o(FTFF1,t14"mpp/th_ath_r",    -0.75,0.75,0.25,tanh(a)-atanh(a), "a") \
+/*2613*/ o(FTFF1,t14"mpp/th_c_r" ,            -2,2,0.5,tanh(a)-cos(a), "a") \
+/*2614*/ o(FTFF1,t14"mpp/th_ch_r",            -2,2,0.5,tanh(a)-cosh(a), "a") \
+/*2615*/ o(FTFF1,t14"mpp/th_ex_r",            -2,2,0.5,tanh(a)-exp(a), "a") \
+/*2616*/ o(FTFF1,t14"mpp/th_l_r" ,           0.5,2,0.5,tanh(a)-log(a), "a") \
+/*2617*/ o(FTFF1,t14"mpp/th_s_r" ,            -2,2,0.5,tanh(a)-sin(a), "a") \
+/*2618*/ o(FTFF1,t14"mpp/th_sh_r",            -2,2,0.5,tanh(a)-sinh(a), "a") \
+/*2619*/ o(FTFF1,t14"mpp/th_t_r" ,            -2,2,0.5,tanh(a)-tan(a), "a") \
+/*2620*/ o(FTFF1,t14"mpp/th_th_r",            -2,2,0.5,tanh(a)-tanh(a), "a") \
+/*2621*/ o(FTFF1,t14"nmm/ac_ac_r",            -1,1,0.5,-acos(-a)-acos(-a), "a") \
+/*2622*/ o(FTFF1,t14"nmm/ac_as_r",            -1,1,0.5,-acos(-a)-asin(-a), "a") \
+/*2623*/ o(FTFF1,t14"nmm/ac_ash_r",           -1,1,0.5,-acos(-a)-asinh(-a), "a") \
+/*2624*/ o(FTFF1,t14"nmm/ac_at_r",            -1,1,0.5,-acos(-a)-atan(-a), "a") \
+/*2625*/ o(FTFF1,t14"nmm/ac_ath_",     -0.75,0.75,0.25,-acos(-a)-atanh(-a), "a") \
+/*2626*/ o(FTFF1,t14"nmm/ac_c_r" ,            -1,1,0.5,-acos(-a)-cos(-a), "a") \
+/*2627*/ o(FTFF1,t14"nmm/ac_ch_r",            -1,1,0.5,-acos(-a)-cosh(-a), "a") \
+/*2628*/ o(FTFF1,t14"nmm/ac_ex_r",            -1,1,0.5,-acos(-a)-exp(-a), "a") \
+/*2629*/ o(FTFF1,t14"nmm/ac_l_r" ,         -1,-0.1,0.5,-acos(-a)-log(-a), "a") \
+/*2630*/ o(FTFF1,t14"nmm/ac_s_r" ,            -1,1,0.5,-acos(-a)-sin(-a), "a") \
+/*2631*/ o(FTFF1,t14"nmm/ac_sh_r",            -1,1,0.5,-acos(-a)-sinh(-a), "a") \
+/*2632*/ o(FTFF1,t14"nmm/ac_t_r" ,            -1,1,0.5,-acos(-a)-tan(-a), "a") \
+/*2633*/ o(FTFF1,t14"nmm/ac_th_r",            -1,1,0.5,-acos(-a)-tanh(-a), "a") \
+/*2634*/ o(FTFF1,t14"nmm/ach_ach_r", -5.5,-2.8125,0.0625,-acosh(-a)-acosh(-a), "a") \
+/*2635*/ o(FTFF1,t14"nmm/ach_ash_r", -2.0625,-1.0625,0.0625,-acosh(-a)-asinh(-a), "a") \
+/*2636*/ o(FTFF1,t14"nmm/ach_at_r", -4.875,-2.875,0.0625,-acosh(-a)-atan(-a), "a") \
+/*2637*/ o(FTFF1,t14"nmm/ach_c_r",     -6,-5.25,0.0625,-acosh(-a)-cos(-a), "a") \
+/*2638*/ o(FTFF1,t14"nmm/ach_ch_r", -4.875,-3.75,0.0625,-acosh(-a)-cosh(-a), "a") \
+/*2639*/ o(FTFF1,t14"nmm/ach_ex_r", -4.1875,-2.8125,0.0625,-acosh(-a)-exp(-a), "a") \
+/*2640*/ o(FTFF1,t14"nmm/ach_l_r",   -4,-1.1875,0.0625,-acosh(-a)-log(-a), "a") \
+/*2641*/ o(FTFF1,t14"nmm/ach_s_r", -5.25,-3.0625,0.0625,-acosh(-a)-sin(-a), "a") \
+/*2642*/ o(FTFF1,t14"nmm/ach_sh_r", -6.125,-5.375,0.0625,-acosh(-a)-sinh(-a), "a") \
+/*2643*/ o(FTFF1,t14"nmm/ach_t_r", -5.9375,-2.5,0.0625,-acosh(-a)-tan(-a), "a") \
+/*2644*/ o(FTFF1,t14"nmm/ach_th_r", -5.5,-2.625,0.0625,-acosh(-a)-tanh(-a), "a") \
+/*2645*/ o(FTFF1,t14"nmm/as_as_r",            -1,1,0.5,-asin(-a)-asin(-a), "a") \
+/*2646*/ o(FTFF1,t14"nmm/as_ash_r",           -1,1,0.5,-asin(-a)-asinh(-a), "a") \
+/*2647*/ o(FTFF1,t14"nmm/as_at_r",            -1,1,0.5,-asin(-a)-atan(-a), "a") \
+/*2648*/ o(FTFF1,t14"nmm/as_ath_",     -0.75,0.75,0.25,-asin(-a)-atanh(-a), "a") \
+/*2649*/ o(FTFF1,t14"nmm/as_c_r" ,            -1,1,0.5,-asin(-a)-cos(-a), "a") \
+/*2650*/ o(FTFF1,t14"nmm/as_ch_r",            -1,1,0.5,-asin(-a)-cosh(-a), "a") \
+/*2651*/ o(FTFF1,t14"nmm/as_ex_r",            -1,1,0.5,-asin(-a)-exp(-a), "a") \
+/*2652*/ o(FTFF1,t14"nmm/as_l_r" ,         -1,-0.1,0.5,-asin(-a)-log(-a), "a") \
+/*2653*/ o(FTFF1,t14"nmm/as_s_r" ,            -1,1,0.5,-asin(-a)-sin(-a), "a") \
+/*2654*/ o(FTFF1,t14"nmm/as_sh_r",            -1,1,0.5,-asin(-a)-sinh(-a), "a") \
+/*2655*/ o(FTFF1,t14"nmm/as_t_r" ,            -1,1,0.5,-asin(-a)-tan(-a), "a") \
+/*2656*/ o(FTFF1,t14"nmm/as_th_r",            -1,1,0.5,-asin(-a)-tanh(-a), "a") \
+/*2657*/ o(FTFF1,t14"nmm/ash_ash_r",          -2,2,0.5,-asinh(-a)-asinh(-a), "a") \
+/*2658*/ o(FTFF1,t14"nmm/ash_at_r",           -2,2,0.5,-asinh(-a)-atan(-a), "a") \
+/*2659*/ o(FTFF1,t14"nmm/ash_ath_",    -0.75,0.75,0.25,-asinh(-a)-atanh(-a), "a") \
+/*2660*/ o(FTFF1,t14"nmm/ash_c_r",            -2,2,0.5,-asinh(-a)-cos(-a), "a") \
+/*2661*/ o(FTFF1,t14"nmm/ash_ch_r",           -2,2,0.5,-asinh(-a)-cosh(-a), "a") \
+/*2662*/ o(FTFF1,t14"nmm/ash_ex_r",           -2,2,0.5,-asinh(-a)-exp(-a), "a") \
+/*2663*/ o(FTFF1,t14"nmm/ash_l_r",           -4,0,0.75,-asinh(-a)-log(-a), "a") \
+/*2664*/ o(FTFF1,t14"nmm/ash_s_r",            -2,2,0.5,-asinh(-a)-sin(-a), "a") \
+/*2665*/ o(FTFF1,t14"nmm/ash_sh_r",           -2,2,0.5,-asinh(-a)-sinh(-a), "a") \
+/*2666*/ o(FTFF1,t14"nmm/ash_t_r",            -2,2,0.5,-asinh(-a)-tan(-a), "a") \
+/*2667*/ o(FTFF1,t14"nmm/ash_th_r",           -2,2,0.5,-asinh(-a)-tanh(-a), "a") \
+/*2668*/ o(FTFF1,t14"nmm/at_at_r",            -2,2,0.5,-atan(-a)-atan(-a), "a") \
+/*2669*/ o(FTFF1,t14"nmm/at_ath_",     -0.75,0.75,0.25,-atan(-a)-atanh(-a), "a") \
+/*2670*/ o(FTFF1,t14"nmm/at_c_r" ,            -2,2,0.5,-atan(-a)-cos(-a), "a") \
+/*2671*/ o(FTFF1,t14"nmm/at_ch_r",            -2,2,0.5,-atan(-a)-cosh(-a), "a") \
+/*2672*/ o(FTFF1,t14"nmm/at_ex_r",            -2,2,0.5,-atan(-a)-exp(-a), "a") \
+/*2673*/ o(FTFF1,t14"nmm/at_l_r" ,           -4,0,0.75,-atan(-a)-log(-a), "a") \
+/*2674*/ o(FTFF1,t14"nmm/at_s_r" ,            -2,2,0.5,-atan(-a)-sin(-a), "a") \
+/*2675*/ o(FTFF1,t14"nmm/at_sh_r",            -2,2,0.5,-atan(-a)-sinh(-a), "a") \
+/*2676*/ o(FTFF1,t14"nmm/at_t_r" ,            -2,2,0.5,-atan(-a)-tan(-a), "a") \
+/*2677*/ o(FTFF1,t14"nmm/at_th_r",            -2,2,0.5,-atan(-a)-tanh(-a), "a") \
+/*2678*/ o(FTFF1,t14"nmm/ath_ath_",    -0.75,0.75,0.25,-atanh(-a)-atanh(-a), "a") \
+/*2679*/ o(FTFF1,t14"nmm/ath_c_" ,     -0.75,0.75,0.25,-atanh(-a)-cos(-a), "a") \
+/*2680*/ o(FTFF1,t14"nmm/ath_ch_",     -0.75,0.75,0.25,-atanh(-a)-cosh(-a), "a") \
+/*2681*/ o(FTFF1,t14"nmm/ath_ex_",     -0.75,0.75,0.25,-atanh(-a)-exp(-a), "a") \
+/*2682*/ o(FTFF1,t14"nmm/ath_l_" ,    -0.75,-0.25,0.25,-atanh(-a)-log(-a), "a") \
+/*2683*/ o(FTFF1,t14"nmm/ath_s_" ,     -0.75,0.75,0.25,-atanh(-a)-sin(-a), "a") \
+/*2684*/ o(FTFF1,t14"nmm/ath_sh_",     -0.75,0.75,0.25,-atanh(-a)-sinh(-a), "a") \
+/*2685*/ o(FTFF1,t14"nmm/ath_t_r",     -0.75,0.75,0.25,-atanh(-a)-tan(-a), "a") \
+/*2686*/ o(FTFF1,t14"nmm/ath_th_r",    -0.75,0.75,0.25,-atanh(-a)-tanh(-a), "a") \
+/*2687*/ o(FTFF1,t14"nmm/c_c_"   ,            -2,2,0.5,-cos(-a)-cos(-a), "a") \
+/*2688*/ o(FTFF1,t14"nmm/c_ch_"  ,            -2,2,0.5,-cos(-a)-cosh(-a), "a") \
+/*2689*/ o(FTFF1,t14"nmm/c_ex_"  ,            -2,2,0.5,-cos(-a)-exp(-a), "a") \
+/*2690*/ o(FTFF1,t14"nmm/c_l_r"  ,           -4,0,0.75,-cos(-a)-log(-a), "a") \
+/*2691*/ o(FTFF1,t14"nmm/c_s_"   ,            -2,2,0.5,-cos(-a)-sin(-a), "a") \
+/*2692*/ o(FTFF1,t14"nmm/c_sh_"  ,            -2,2,0.5,-cos(-a)-sinh(-a), "a") \
+/*2693*/ o(FTFF1,t14"nmm/c_t_r"  ,            -2,2,0.5,-cos(-a)-tan(-a), "a") \
+/*2694*/ o(FTFF1,t14"nmm/c_th_r" ,            -2,2,0.5,-cos(-a)-tanh(-a), "a") \
+/*2695*/ o(FTFF1,t14"nmm/ch_ch_" ,            -2,2,0.5,-cosh(-a)-cosh(-a), "a") \
+/*2696*/ o(FTFF1,t14"nmm/ch_ex_" ,            -2,2,0.5,-cosh(-a)-exp(-a), "a") \
+/*2697*/ o(FTFF1,t14"nmm/ch_l_r" ,           -4,0,0.75,-cosh(-a)-log(-a), "a") \
+/*2698*/ o(FTFF1,t14"nmm/ch_s_"  ,            -2,2,0.5,-cosh(-a)-sin(-a), "a") \
+/*2699*/ o(FTFF1,t14"nmm/ch_sh_" ,            -2,2,0.5,-cosh(-a)-sinh(-a), "a") \
+/*2700*/ o(FTFF1,t14"nmm/ch_t_r" ,            -2,2,0.5,-cosh(-a)-tan(-a), "a") \
+/*2701*/ o(FTFF1,t14"nmm/ch_th_r",            -2,2,0.5,-cosh(-a)-tanh(-a), "a") \
+/*2702*/ o(FTFF1,t14"nmm/ex_ex_" ,            -2,2,0.5,-exp(-a)-exp(-a), "a") \
+/*2703*/ o(FTFF1,t14"nmm/ex_l_r" ,           -4,0,0.75,-exp(-a)-log(-a), "a") \
+/*2704*/ o(FTFF1,t14"nmm/ex_s_"  ,            -2,2,0.5,-exp(-a)-sin(-a), "a") \
+/*2705*/ o(FTFF1,t14"nmm/ex_sh_" ,            -2,2,0.5,-exp(-a)-sinh(-a), "a") \
+/*2706*/ o(FTFF1,t14"nmm/ex_t_r" ,            -2,2,0.5,-exp(-a)-tan(-a), "a") \
+/*2707*/ o(FTFF1,t14"nmm/ex_th_r",            -2,2,0.5,-exp(-a)-tanh(-a), "a") \
+/*2708*/ o(FTFF1,t14"nmm/l_l_r"  ,           -4,0,0.75,-log(-a)-log(-a), "a") \
+/*2709*/ o(FTFF1,t14"nmm/l_s_r"  ,           -4,0,0.75,-log(-a)-sin(-a), "a") \
+/*2710*/ o(FTFF1,t14"nmm/l_sh_r" ,           -4,0,0.75,-log(-a)-sinh(-a), "a") \
+/*2711*/ o(FTFF1,t14"nmm/l_t_r"  ,           -4,0,0.75,-log(-a)-tan(-a), "a") \
+/*2712*/ o(FTFF1,t14"nmm/l_th_r" ,           -4,0,0.75,-log(-a)-tanh(-a), "a") \
+/*2713*/ o(FTFF1,t14"nmm/s_s_"   ,            -2,2,0.5,-sin(-a)-sin(-a), "a") \
+/*2714*/ o(FTFF1,t14"nmm/s_sh_"  ,            -2,2,0.5,-sin(-a)-sinh(-a), "a") \
+/*2715*/ o(FTFF1,t14"nmm/s_t_r"  ,            -2,2,0.5,-sin(-a)-tan(-a), "a") \
+/*2716*/ o(FTFF1,t14"nmm/s_th_r" ,            -2,2,0.5,-sin(-a)-tanh(-a), "a") \
+/*2717*/ o(FTFF1,t14"nmm/sh_sh_" ,            -2,2,0.5,-sinh(-a)-sinh(-a), "a") \
+/*2718*/ o(FTFF1,t14"nmm/sh_t_r" ,            -2,2,0.5,-sinh(-a)-tan(-a), "a") \
+/*2719*/ o(FTFF1,t14"nmm/sh_th_r",            -2,2,0.5,-sinh(-a)-tanh(-a), "a") \
+/*2720*/ o(FTFF1,t14"nmm/t_t_r"  ,            -2,2,0.5,-tan(-a)-tan(-a), "a") \
+/*2721*/ o(FTFF1,t14"nmm/t_th_r" ,            -2,2,0.5,-tan(-a)-tanh(-a), "a") \
+/*2722*/ o(FTFF1,t14"nmm/th_th_r",            -2,2,0.5,-tanh(-a)-tanh(-a), "a") \
+/*2723*/ o(FTFF1,t14"npm/ac_ac_r",            -1,1,0.5,-acos(a)-acos(-a), "a") \
+/*2724*/ o(FTFF1,t14"npm/ac_as_r",            -1,1,0.5,-acos(a)-asin(-a), "a") \
+/*2725*/ o(FTFF1,t14"npm/ac_ash_r",           -1,1,0.5,-acos(a)-asinh(-a), "a") \
+/*2726*/ o(FTFF1,t14"npm/ac_at_r",            -1,1,0.5,-acos(a)-atan(-a), "a") \
+/*2727*/ o(FTFF1,t14"npm/ac_ath_",     -0.75,0.75,0.25,-acos(a)-atanh(-a), "a") \
+/*2728*/ o(FTFF1,t14"npm/ac_c_r" ,            -1,1,0.5,-acos(a)-cos(-a), "a") \
+/*2729*/ o(FTFF1,t14"npm/ac_ch_r",            -1,1,0.5,-acos(a)-cosh(-a), "a") \
+/*2730*/ o(FTFF1,t14"npm/ac_ex_r",            -1,1,0.5,-acos(a)-exp(-a), "a") \
+/*2731*/ o(FTFF1,t14"npm/ac_l_r" ,         -1,-0.1,0.5,-acos(a)-log(-a), "a") \
+/*2732*/ o(FTFF1,t14"npm/ac_s_r" ,            -1,1,0.5,-acos(a)-sin(-a), "a") \
+/*2733*/ o(FTFF1,t14"npm/ac_sh_r",            -1,1,0.5,-acos(a)-sinh(-a), "a") \
+/*2734*/ o(FTFF1,t14"npm/ac_t_r" ,            -1,1,0.5,-acos(a)-tan(-a), "a") \
+/*2735*/ o(FTFF1,t14"npm/ac_th_r",            -1,1,0.5,-acos(a)-tanh(-a), "a") \
+/*2736*/ o(FTFF1,t14"npm/ach_ash_r", 4.5625,5.5625,0.0625,-acosh(a)-asinh(-a), "a") \
+/*2737*/ o(FTFF1,t14"npm/ach_at_r", 5.8125,11.5,0.0625,-acosh(a)-atan(-a), "a") \
+/*2738*/ o(FTFF1,t14"npm/ach_c_r", 5.1875,10.75,0.0625,-acosh(a)-cos(-a), "a") \
+/*2739*/ o(FTFF1,t14"npm/ach_ch_r", 2.1875,4.375,0.0625,-acosh(a)-cosh(-a), "a") \
+/*2740*/ o(FTFF1,t14"npm/ach_ex_r", 2.6875,4.1875,0.0625,-acosh(a)-exp(-a), "a") \
+/*2741*/ o(FTFF1,t14"npm/ach_s_r", 4.0625,9.5625,0.0625,-acosh(a)-sin(-a), "a") \
+/*2742*/ o(FTFF1,t14"npm/ach_sh_r",   2.25,6.75,0.0625,-acosh(a)-sinh(-a), "a") \
+/*2743*/ o(FTFF1,t14"npm/ach_t_r",    6,10.3125,0.0625,-acosh(a)-tan(-a), "a") \
+/*2744*/ o(FTFF1,t14"npm/ach_th_r", 5.0625,8.375,0.0625,-acosh(a)-tanh(-a), "a") \
+/*2745*/ o(FTFF1,t14"npm/as_ac_r",            -1,1,0.5,-asin(a)-acos(-a), "a") \
+/*2746*/ o(FTFF1,t14"npm/as_as_r",            -1,1,0.5,-asin(a)-asin(-a), "a") \
+/*2747*/ o(FTFF1,t14"npm/as_ash_r",           -1,1,0.5,-asin(a)-asinh(-a), "a") \
+/*2748*/ o(FTFF1,t14"npm/as_at_r",            -1,1,0.5,-asin(a)-atan(-a), "a") \
+/*2749*/ o(FTFF1,t14"npm/as_ath_",     -0.75,0.75,0.25,-asin(a)-atanh(-a), "a") \
+/*2750*/ o(FTFF1,t14"npm/as_c_r" ,            -1,1,0.5,-asin(a)-cos(-a), "a") \
+/*2751*/ o(FTFF1,t14"npm/as_ch_r",            -1,1,0.5,-asin(a)-cosh(-a), "a") \
+/*2752*/ o(FTFF1,t14"npm/as_ex_r",            -1,1,0.5,-asin(a)-exp(-a), "a") \
+/*2753*/ o(FTFF1,t14"npm/as_l_r" ,         -1,-0.1,0.5,-asin(a)-log(-a), "a") \
+/*2754*/ o(FTFF1,t14"npm/as_s_r" ,            -1,1,0.5,-asin(a)-sin(-a), "a") \
+/*2755*/ o(FTFF1,t14"npm/as_sh_r",            -1,1,0.5,-asin(a)-sinh(-a), "a") \
+/*2756*/ o(FTFF1,t14"npm/as_t_r" ,            -1,1,0.5,-asin(a)-tan(-a), "a") \
+/*2757*/ o(FTFF1,t14"npm/as_th_r",            -1,1,0.5,-asin(a)-tanh(-a), "a") \
+/*2758*/ o(FTFF1,t14"npm/ash_ac_r",           -1,1,0.5,-asinh(a)-acos(-a), "a") \
+/*2759*/ o(FTFF1,t14"npm/ash_ach_r", -4.5,-1.8125,0.0625,-asinh(a)-acosh(-a), "a") \
+/*2760*/ o(FTFF1,t14"npm/ash_as_r",           -1,1,0.5,-asinh(a)-asin(-a), "a") \
+/*2761*/ o(FTFF1,t14"npm/ash_ash_r",          -2,2,0.5,-asinh(a)-asinh(-a), "a") \
+/*2762*/ o(FTFF1,t14"npm/ash_at_r",           -2,2,0.5,-asinh(a)-atan(-a), "a") \
+/*2763*/ o(FTFF1,t14"npm/ash_ath_",    -0.75,0.75,0.25,-asinh(a)-atanh(-a), "a") \
+/*2764*/ o(FTFF1,t14"npm/ash_c_r",            -2,2,0.5,-asinh(a)-cos(-a), "a") \
+/*2765*/ o(FTFF1,t14"npm/ash_ch_r",           -2,2,0.5,-asinh(a)-cosh(-a), "a") \
+/*2766*/ o(FTFF1,t14"npm/ash_ex_r",           -2,2,0.5,-asinh(a)-exp(-a), "a") \
+/*2767*/ o(FTFF1,t14"npm/ash_l_r",           -4,0,0.75,-asinh(a)-log(-a), "a") \
+/*2768*/ o(FTFF1,t14"npm/ash_s_r",            -2,2,0.5,-asinh(a)-sin(-a), "a") \
+/*2769*/ o(FTFF1,t14"npm/ash_sh_r",           -2,2,0.5,-asinh(a)-sinh(-a), "a") \
+/*2770*/ o(FTFF1,t14"npm/ash_t_r",            -2,2,0.5,-asinh(a)-tan(-a), "a") \
+/*2771*/ o(FTFF1,t14"npm/ash_th_r",           -2,2,0.5,-asinh(a)-tanh(-a), "a") \
+/*2772*/ o(FTFF1,t14"npm/at_ac_r",            -1,1,0.5,-atan(a)-acos(-a), "a") \
+/*2773*/ o(FTFF1,t14"npm/at_ach_r", -6.25,-1.75,0.0625,-atan(a)-acosh(-a), "a") \
+/*2774*/ o(FTFF1,t14"npm/at_as_r",            -1,1,0.5,-atan(a)-asin(-a), "a") \
+/*2775*/ o(FTFF1,t14"npm/at_ash_r",           -2,2,0.5,-atan(a)-asinh(-a), "a") \
+/*2776*/ o(FTFF1,t14"npm/at_at_r",            -2,2,0.5,-atan(a)-atan(-a), "a") \
+/*2777*/ o(FTFF1,t14"npm/at_ath_",     -0.75,0.75,0.25,-atan(a)-atanh(-a), "a") \
+/*2778*/ o(FTFF1,t14"npm/at_c_r" ,            -2,2,0.5,-atan(a)-cos(-a), "a") \
+/*2779*/ o(FTFF1,t14"npm/at_ch_r",            -2,2,0.5,-atan(a)-cosh(-a), "a") \
+/*2780*/ o(FTFF1,t14"npm/at_ex_r",            -2,2,0.5,-atan(a)-exp(-a), "a") \
+/*2781*/ o(FTFF1,t14"npm/at_l_r" ,           -4,0,0.75,-atan(a)-log(-a), "a") \
+/*2782*/ o(FTFF1,t14"npm/at_s_r" ,            -2,2,0.5,-atan(a)-sin(-a), "a") \
+/*2783*/ o(FTFF1,t14"npm/at_sh_r",            -2,2,0.5,-atan(a)-sinh(-a), "a") \
+/*2784*/ o(FTFF1,t14"npm/at_t_r" ,            -2,2,0.5,-atan(a)-tan(-a), "a") \
+/*2785*/ o(FTFF1,t14"npm/at_th_r",            -2,2,0.5,-atan(a)-tanh(-a), "a") \
+/*2786*/ o(FTFF1,t14"npm/ath_ac_",     -0.75,0.75,0.25,-atanh(a)-acos(-a), "a") \
+/*2787*/ o(FTFF1,t14"npm/ath_as_",     -0.75,0.75,0.25,-atanh(a)-asin(-a), "a") \
+/*2788*/ o(FTFF1,t14"npm/ath_ash_",    -0.75,0.75,0.25,-atanh(a)-asinh(-a), "a") \
+/*2789*/ o(FTFF1,t14"npm/ath_at_",     -0.75,0.75,0.25,-atanh(a)-atan(-a), "a") \
+/*2790*/ o(FTFF1,t14"npm/ath_ath_",    -0.75,0.75,0.25,-atanh(a)-atanh(-a), "a") \
+/*2791*/ o(FTFF1,t14"npm/ath_c_" ,     -0.75,0.75,0.25,-atanh(a)-cos(-a), "a") \
+/*2792*/ o(FTFF1,t14"npm/ath_ch_",     -0.75,0.75,0.25,-atanh(a)-cosh(-a), "a") \
+/*2793*/ o(FTFF1,t14"npm/ath_ex_",     -0.75,0.75,0.25,-atanh(a)-exp(-a), "a") \
+/*2794*/ o(FTFF1,t14"npm/ath_l_" ,    -0.75,-0.25,0.25,-atanh(a)-log(-a), "a") \
+/*2795*/ o(FTFF1,t14"npm/ath_s_" ,     -0.75,0.75,0.25,-atanh(a)-sin(-a), "a") \
+/*2796*/ o(FTFF1,t14"npm/ath_sh_",     -0.75,0.75,0.25,-atanh(a)-sinh(-a), "a") \
+/*2797*/ o(FTFF1,t14"npm/ath_t_r",     -0.75,0.75,0.25,-atanh(a)-tan(-a), "a") \
+/*2798*/ o(FTFF1,t14"npm/ath_th_r",    -0.75,0.75,0.25,-atanh(a)-tanh(-a), "a") \
+/*2799*/ o(FTFF1,t14"npm/c_ac_r" ,            -1,1,0.5,-cos(a)-acos(-a), "a") \
+/*2800*/ o(FTFF1,t14"npm/c_ach_r", -4.8125,-1.75,0.0625,-cos(a)-acosh(-a), "a") \
+/*2801*/ o(FTFF1,t14"npm/c_as_r" ,            -1,1,0.5,-cos(a)-asin(-a), "a") \
+/*2802*/ o(FTFF1,t14"npm/c_ash_r",            -2,2,0.5,-cos(a)-asinh(-a), "a") \
+/*2803*/ o(FTFF1,t14"npm/c_at_r" ,            -2,2,0.5,-cos(a)-atan(-a), "a") \
+/*2804*/ o(FTFF1,t14"npm/c_ath_" ,     -0.75,0.75,0.25,-cos(a)-atanh(-a), "a") \
+/*2805*/ o(FTFF1,t14"npm/c_c_"   ,            -2,2,0.5,-cos(a)-cos(-a), "a") \
+/*2806*/ o(FTFF1,t14"npm/c_ch_"  ,            -2,2,0.5,-cos(a)-cosh(-a), "a") \
+/*2807*/ o(FTFF1,t14"npm/c_ex_"  ,            -2,2,0.5,-cos(a)-exp(-a), "a") \
+/*2808*/ o(FTFF1,t14"npm/c_l_r"  ,           -4,0,0.75,-cos(a)-log(-a), "a") \
+/*2809*/ o(FTFF1,t14"npm/c_s_"   ,            -2,2,0.5,-cos(a)-sin(-a), "a") \
+/*2810*/ o(FTFF1,t14"npm/c_sh_"  ,            -2,2,0.5,-cos(a)-sinh(-a), "a") \
+/*2811*/ o(FTFF1,t14"npm/c_t_r"  ,            -2,2,0.5,-cos(a)-tan(-a), "a") \
+/*2812*/ o(FTFF1,t14"npm/c_th_r" ,            -2,2,0.5,-cos(a)-tanh(-a), "a") \
+/*2813*/ o(FTFF1,t14"npm/ch_ac_r",            -1,1,0.5,-cosh(a)-acos(-a), "a") \
+/*2814*/ o(FTFF1,t14"npm/ch_ach_r", -6.25,-1.75,0.0625,-cosh(a)-acosh(-a), "a") \
+/*2815*/ o(FTFF1,t14"npm/ch_as_r",            -1,1,0.5,-cosh(a)-asin(-a), "a") \
+/*2816*/ o(FTFF1,t14"npm/ch_ash_r",           -2,2,0.5,-cosh(a)-asinh(-a), "a") \
+/*2817*/ o(FTFF1,t14"npm/ch_at_r",            -2,2,0.5,-cosh(a)-atan(-a), "a") \
+/*2818*/ o(FTFF1,t14"npm/ch_ath_",     -0.75,0.75,0.25,-cosh(a)-atanh(-a), "a") \
+/*2819*/ o(FTFF1,t14"npm/ch_c_"  ,            -2,2,0.5,-cosh(a)-cos(-a), "a") \
+/*2820*/ o(FTFF1,t14"npm/ch_ch_" ,            -2,2,0.5,-cosh(a)-cosh(-a), "a") \
+/*2821*/ o(FTFF1,t14"npm/ch_ex_" ,            -2,2,0.5,-cosh(a)-exp(-a), "a") \
+/*2822*/ o(FTFF1,t14"npm/ch_l_r" ,           -4,0,0.75,-cosh(a)-log(-a), "a") \
+/*2823*/ o(FTFF1,t14"npm/ch_s_"  ,            -2,2,0.5,-cosh(a)-sin(-a), "a") \
+/*2824*/ o(FTFF1,t14"npm/ch_sh_" ,            -2,2,0.5,-cosh(a)-sinh(-a), "a") \
+/*2825*/ o(FTFF1,t14"npm/ch_t_r" ,            -2,2,0.5,-cosh(a)-tan(-a), "a") \
+/*2826*/ o(FTFF1,t14"npm/ch_th_r",            -2,2,0.5,-cosh(a)-tanh(-a), "a") \
+/*2827*/ o(FTFF1,t14"npm/ex_ac_r",            -1,1,0.5,-exp(a)-acos(-a), "a") \
+/*2828*/ o(FTFF1,t14"npm/ex_ach_r",     -5,-1.5,0.0625,-exp(a)-acosh(-a), "a") \
+/*2829*/ o(FTFF1,t14"npm/ex_as_r",            -1,1,0.5,-exp(a)-asin(-a), "a") \
+/*2830*/ o(FTFF1,t14"npm/ex_ash_r",           -2,2,0.5,-exp(a)-asinh(-a), "a") \
+/*2831*/ o(FTFF1,t14"npm/ex_at_r",            -2,2,0.5,-exp(a)-atan(-a), "a") \
+/*2832*/ o(FTFF1,t14"npm/ex_ath_",     -0.75,0.75,0.25,-exp(a)-atanh(-a), "a") \
+/*2833*/ o(FTFF1,t14"npm/ex_c_"  ,            -2,2,0.5,-exp(a)-cos(-a), "a") \
+/*2834*/ o(FTFF1,t14"npm/ex_ch_" ,            -2,2,0.5,-exp(a)-cosh(-a), "a") \
+/*2835*/ o(FTFF1,t14"npm/ex_ex_" ,            -2,2,0.5,-exp(a)-exp(-a), "a") \
+/*2836*/ o(FTFF1,t14"npm/ex_l_r" ,           -4,0,0.75,-exp(a)-log(-a), "a") \
+/*2837*/ o(FTFF1,t14"npm/ex_s_"  ,            -2,2,0.5,-exp(a)-sin(-a), "a") \
+/*2838*/ o(FTFF1,t14"npm/ex_sh_" ,            -2,2,0.5,-exp(a)-sinh(-a), "a") \
+/*2839*/ o(FTFF1,t14"npm/ex_t_r" ,            -2,2,0.5,-exp(a)-tan(-a), "a") \
+/*2840*/ o(FTFF1,t14"npm/ex_th_r",            -2,2,0.5,-exp(a)-tanh(-a), "a") \
+/*2841*/ o(FTFF1,t14"npm/l_ac_r" ,          0.5,1,0.25,-log(a)-acos(-a), "a") \
+/*2842*/ o(FTFF1,t14"npm/l_as_r" ,          0.5,1,0.25,-log(a)-asin(-a), "a") \
+/*2843*/ o(FTFF1,t14"npm/l_ash_r",           0.5,2,0.5,-log(a)-asinh(-a), "a") \
+/*2844*/ o(FTFF1,t14"npm/l_at_r" ,           0.5,2,0.5,-log(a)-atan(-a), "a") \
+/*2845*/ o(FTFF1,t14"npm/l_ath_r",     0.25,0.75,0.125,-log(a)-atanh(-a), "a") \
+/*2846*/ o(FTFF1,t14"npm/l_c_r"  ,           0.5,2,0.5,-log(a)-cos(-a), "a") \
+/*2847*/ o(FTFF1,t14"npm/l_ch_r" ,           0.5,2,0.5,-log(a)-cosh(-a), "a") \
+/*2848*/ o(FTFF1,t14"npm/l_ex_r" ,           0.5,2,0.5,-log(a)-exp(-a), "a") \
+/*2849*/ o(FTFF1,t14"npm/l_s_r"  ,           0.5,2,0.5,-log(a)-sin(-a), "a") \
+/*2850*/ o(FTFF1,t14"npm/l_sh_r" ,           0.5,2,0.5,-log(a)-sinh(-a), "a") \
+/*2851*/ o(FTFF1,t14"npm/l_t_r"  ,           0.5,2,0.5,-log(a)-tan(-a), "a") \
+/*2852*/ o(FTFF1,t14"npm/l_th_r" ,           0.5,2,0.5,-log(a)-tanh(-a), "a") \
+/*2853*/ o(FTFF1,t14"npm/s_ac_r" ,            -1,1,0.5,-sin(a)-acos(-a), "a") \
+/*2854*/ o(FTFF1,t14"npm/s_ach_r", -4.5,-3.0625,0.0625,-sin(a)-acosh(-a), "a") \
+/*2855*/ o(FTFF1,t14"npm/s_as_r" ,            -1,1,0.5,-sin(a)-asin(-a), "a") \
+/*2856*/ o(FTFF1,t14"npm/s_ash_r",            -2,2,0.5,-sin(a)-asinh(-a), "a") \
+/*2857*/ o(FTFF1,t14"npm/s_at_r" ,            -2,2,0.5,-sin(a)-atan(-a), "a") \
+/*2858*/ o(FTFF1,t14"npm/s_ath_" ,     -0.75,0.75,0.25,-sin(a)-atanh(-a), "a") \
+/*2859*/ o(FTFF1,t14"npm/s_c_"   ,            -2,2,0.5,-sin(a)-cos(-a), "a") \
+/*2860*/ o(FTFF1,t14"npm/s_ch_"  ,            -2,2,0.5,-sin(a)-cosh(-a), "a") \
+/*2861*/ o(FTFF1,t14"npm/s_ex_"  ,            -2,2,0.5,-sin(a)-exp(-a), "a") \
+/*2862*/ o(FTFF1,t14"npm/s_l_r"  ,           -4,0,0.75,-sin(a)-log(-a), "a") \
+/*2863*/ o(FTFF1,t14"npm/s_s_"   ,            -2,2,0.5,-sin(a)-sin(-a), "a") \
+/*2864*/ o(FTFF1,t14"npm/s_sh_"  ,            -2,2,0.5,-sin(a)-sinh(-a), "a") \
+/*2865*/ o(FTFF1,t14"npm/s_t_r"  ,            -2,2,0.5,-sin(a)-tan(-a), "a") \
+/*2866*/ o(FTFF1,t14"npm/s_th_r" ,            -2,2,0.5,-sin(a)-tanh(-a), "a") \
+/*2867*/ o(FTFF1,t14"npm/sh_ac_r",            -1,1,0.5,-sinh(a)-acos(-a), "a") \
+/*2868*/ o(FTFF1,t14"npm/sh_ach_r",    -6,-1.75,0.0625,-sinh(a)-acosh(-a), "a") \
+/*2869*/ o(FTFF1,t14"npm/sh_as_r",            -1,1,0.5,-sinh(a)-asin(-a), "a") \
+/*2870*/ o(FTFF1,t14"npm/sh_ash_r",           -2,2,0.5,-sinh(a)-asinh(-a), "a") \
+/*2871*/ o(FTFF1,t14"npm/sh_at_r",            -2,2,0.5,-sinh(a)-atan(-a), "a") \
+/*2872*/ o(FTFF1,t14"npm/sh_ath_",     -0.75,0.75,0.25,-sinh(a)-atanh(-a), "a") \
+/*2873*/ o(FTFF1,t14"npm/sh_c_"  ,            -2,2,0.5,-sinh(a)-cos(-a), "a") \
+/*2874*/ o(FTFF1,t14"npm/sh_ch_" ,            -2,2,0.5,-sinh(a)-cosh(-a), "a") \
+/*2875*/ o(FTFF1,t14"npm/sh_ex_" ,            -2,2,0.5,-sinh(a)-exp(-a), "a") \
+/*2876*/ o(FTFF1,t14"npm/sh_l_r" ,           -4,0,0.75,-sinh(a)-log(-a), "a") \
+/*2877*/ o(FTFF1,t14"npm/sh_s_"  ,            -2,2,0.5,-sinh(a)-sin(-a), "a") \
+/*2878*/ o(FTFF1,t14"npm/sh_sh_" ,            -2,2,0.5,-sinh(a)-sinh(-a), "a") \
+/*2879*/ o(FTFF1,t14"npm/sh_t_r" ,            -2,2,0.5,-sinh(a)-tan(-a), "a") \
+/*2880*/ o(FTFF1,t14"npm/sh_th_r",            -2,2,0.5,-sinh(a)-tanh(-a), "a") \
+/*2881*/ o(FTFF1,t14"npm/t_ac_r" ,            -1,1,0.5,-tan(a)-acos(-a), "a") \
+/*2882*/ o(FTFF1,t14"npm/t_ach_r",    -5.125,-3,0.0625,-tan(a)-acosh(-a), "a") \
+/*2883*/ o(FTFF1,t14"npm/t_as_r" ,            -1,1,0.5,-tan(a)-asin(-a), "a") \
+/*2884*/ o(FTFF1,t14"npm/t_ash_r",            -2,2,0.5,-tan(a)-asinh(-a), "a") \
+/*2885*/ o(FTFF1,t14"npm/t_at_r" ,            -2,2,0.5,-tan(a)-atan(-a), "a") \
+/*2886*/ o(FTFF1,t14"npm/t_ath_r",     -0.75,0.75,0.25,-tan(a)-atanh(-a), "a") \
+/*2887*/ o(FTFF1,t14"npm/t_c_r"  ,            -2,2,0.5,-tan(a)-cos(-a), "a") \
+/*2888*/ o(FTFF1,t14"npm/t_ch_r" ,            -2,2,0.5,-tan(a)-cosh(-a), "a") \
+/*2889*/ o(FTFF1,t14"npm/t_ex_r" ,            -2,2,0.5,-tan(a)-exp(-a), "a") \
+/*2890*/ o(FTFF1,t14"npm/t_l_r"  ,           -4,0,0.75,-tan(a)-log(-a), "a") \
+/*2891*/ o(FTFF1,t14"npm/t_s_r"  ,            -2,2,0.5,-tan(a)-sin(-a), "a") \
+/*2892*/ o(FTFF1,t14"npm/t_sh_r" ,            -2,2,0.5,-tan(a)-sinh(-a), "a") \
+/*2893*/ o(FTFF1,t14"npm/t_t_r"  ,            -2,2,0.5,-tan(a)-tan(-a), "a") \
+/*2894*/ o(FTFF1,t14"npm/t_th_r" ,            -2,2,0.5,-tan(a)-tanh(-a), "a") \
+/*2895*/ o(FTFF1,t14"npm/th_ac_r",            -1,1,0.5,-tanh(a)-acos(-a), "a") \
+/*2896*/ o(FTFF1,t14"npm/th_ach_r", -3.0625,-2.125,0.0625,-tanh(a)-acosh(-a), "a") \
+/*2897*/ o(FTFF1,t14"npm/th_as_r",            -1,1,0.5,-tanh(a)-asin(-a), "a") \
+/*2898*/ o(FTFF1,t14"npm/th_ash_r",           -2,2,0.5,-tanh(a)-asinh(-a), "a") \
+/*2899*/ o(FTFF1,t14"npm/th_at_r",            -2,2,0.5,-tanh(a)-atan(-a), "a") \
+/*2900*/ o(FTFF1,t14"npm/th_ath_r",    -0.75,0.75,0.25,-tanh(a)-atanh(-a), "a") \
+/*2901*/ o(FTFF1,t14"npm/th_c_r" ,            -2,2,0.5,-tanh(a)-cos(-a), "a") \
+/*2902*/ o(FTFF1,t14"npm/th_ch_r",            -2,2,0.5,-tanh(a)-cosh(-a), "a") \
+/*2903*/ o(FTFF1,t14"npm/th_ex_r",            -2,2,0.5,-tanh(a)-exp(-a), "a") \
+/*2904*/ o(FTFF1,t14"npm/th_l_r" ,           -4,0,0.75,-tanh(a)-log(-a), "a") \
+/*2905*/ o(FTFF1,t14"npm/th_s_r" ,            -2,2,0.5,-tanh(a)-sin(-a), "a") \
+/*2906*/ o(FTFF1,t14"npm/th_sh_r",            -2,2,0.5,-tanh(a)-sinh(-a), "a") \
+/*2907*/ o(FTFF1,t14"npm/th_t_r" ,            -2,2,0.5,-tanh(a)-tan(-a), "a") \
+/*2908*/ o(FTFF1,t14"npm/th_th_r",            -2,2,0.5,-tanh(a)-tanh(-a), "a") \
+/*2909*/ o(FTFF1,t14"npp/ac_ac_r",            -1,1,0.5,-acos(a)-acos(a), "a") \
+/*2910*/ o(FTFF1,t14"npp/ac_as_r",            -1,1,0.5,-acos(a)-asin(a), "a") \
+/*2911*/ o(FTFF1,t14"npp/ac_ash_r",           -1,1,0.5,-acos(a)-asinh(a), "a") \
+/*2912*/ o(FTFF1,t14"npp/ac_at_r",            -1,1,0.5,-acos(a)-atan(a), "a") \
+/*2913*/ o(FTFF1,t14"npp/ac_ath_",     -0.75,0.75,0.25,-acos(a)-atanh(a), "a") \
+/*2914*/ o(FTFF1,t14"npp/ac_c_r" ,            -1,1,0.5,-acos(a)-cos(a), "a") \
+/*2915*/ o(FTFF1,t14"npp/ac_ch_r",            -1,1,0.5,-acos(a)-cosh(a), "a") \
+/*2916*/ o(FTFF1,t14"npp/ac_ex_r",            -1,1,0.5,-acos(a)-exp(a), "a") \
+/*2917*/ o(FTFF1,t14"npp/ac_l_r" ,          0.5,1,0.25,-acos(a)-log(a), "a") \
+/*2918*/ o(FTFF1,t14"npp/ac_s_r" ,            -1,1,0.5,-acos(a)-sin(a), "a") \
+/*2919*/ o(FTFF1,t14"npp/ac_sh_r",            -1,1,0.5,-acos(a)-sinh(a), "a") \
+/*2920*/ o(FTFF1,t14"npp/ac_t_r" ,            -1,1,0.5,-acos(a)-tan(a), "a") \
+/*2921*/ o(FTFF1,t14"npp/ac_th_r",            -1,1,0.5,-acos(a)-tanh(a), "a") \
+/*2922*/ o(FTFF1,t14"npp/ach_ach_r", 4.125,9.9375,0.0625,-acosh(a)-acosh(a), "a") \
+/*2923*/ o(FTFF1,t14"npp/ach_ash_r",   2,7.5625,0.0625,-acosh(a)-asinh(a), "a") \
+/*2924*/ o(FTFF1,t14"npp/ach_at_r", 1.4375,6.8125,0.0625,-acosh(a)-atan(a), "a") \
+/*2925*/ o(FTFF1,t14"npp/ach_c_r",  1.25,3.9375,0.0625,-acosh(a)-cos(a), "a") \
+/*2926*/ o(FTFF1,t14"npp/ach_ch_r", 2.1875,6.1875,0.0625,-acosh(a)-cosh(a), "a") \
+/*2927*/ o(FTFF1,t14"npp/ach_ex_r", 3.125,5.4375,0.0625,-acosh(a)-exp(a), "a") \
+/*2928*/ o(FTFF1,t14"npp/ach_l_r",   1.25,4.625,0.0625,-acosh(a)-log(a), "a") \
+/*2929*/ o(FTFF1,t14"npp/ach_s_r", 1.875,6.8125,0.0625,-acosh(a)-sin(a), "a") \
+/*2930*/ o(FTFF1,t14"npp/ach_sh_r", 3.875,9.3125,0.0625,-acosh(a)-sinh(a), "a") \
+/*2931*/ o(FTFF1,t14"npp/ach_t_r",  2.875,5.125,0.0625,-acosh(a)-tan(a), "a") \
+/*2932*/ o(FTFF1,t14"npp/ach_th_r", 2.5625,6.125,0.0625,-acosh(a)-tanh(a), "a") \
+/*2933*/ o(FTFF1,t14"npp/as_as_r",            -1,1,0.5,-asin(a)-asin(a), "a") \
+/*2934*/ o(FTFF1,t14"npp/as_ash_r",           -1,1,0.5,-asin(a)-asinh(a), "a") \
+/*2935*/ o(FTFF1,t14"npp/as_at_r",            -1,1,0.5,-asin(a)-atan(a), "a") \
+/*2936*/ o(FTFF1,t14"npp/as_ath_",     -0.75,0.75,0.25,-asin(a)-atanh(a), "a") \
+/*2937*/ o(FTFF1,t14"npp/as_c_r" ,            -1,1,0.5,-asin(a)-cos(a), "a") \
+/*2938*/ o(FTFF1,t14"npp/as_ch_r",            -1,1,0.5,-asin(a)-cosh(a), "a") \
+/*2939*/ o(FTFF1,t14"npp/as_ex_r",            -1,1,0.5,-asin(a)-exp(a), "a") \
+/*2940*/ o(FTFF1,t14"npp/as_l_r" ,          0.5,1,0.25,-asin(a)-log(a), "a") \
+/*2941*/ o(FTFF1,t14"npp/as_s_r" ,            -1,1,0.5,-asin(a)-sin(a), "a") \
+/*2942*/ o(FTFF1,t14"npp/as_sh_r",            -1,1,0.5,-asin(a)-sinh(a), "a") \
+/*2943*/ o(FTFF1,t14"npp/as_t_r" ,            -1,1,0.5,-asin(a)-tan(a), "a") \
+/*2944*/ o(FTFF1,t14"npp/as_th_r",            -1,1,0.5,-asin(a)-tanh(a), "a") \
+/*2945*/ o(FTFF1,t14"npp/ash_ash_r",          -2,2,0.5,-asinh(a)-asinh(a), "a") \
+/*2946*/ o(FTFF1,t14"npp/ash_at_r",           -2,2,0.5,-asinh(a)-atan(a), "a") \
+/*2947*/ o(FTFF1,t14"npp/ash_ath_",    -0.75,0.75,0.25,-asinh(a)-atanh(a), "a") \
+/*2948*/ o(FTFF1,t14"npp/ash_c_r",            -2,2,0.5,-asinh(a)-cos(a), "a") \
+/*2949*/ o(FTFF1,t14"npp/ash_ch_r",           -2,2,0.5,-asinh(a)-cosh(a), "a") \
+/*2950*/ o(FTFF1,t14"npp/ash_ex_r",           -2,2,0.5,-asinh(a)-exp(a), "a") \
+/*2951*/ o(FTFF1,t14"npp/ash_l_r",           0.5,2,0.5,-asinh(a)-log(a), "a") \
+/*2952*/ o(FTFF1,t14"npp/ash_s_r",            -2,2,0.5,-asinh(a)-sin(a), "a") \
+/*2953*/ o(FTFF1,t14"npp/ash_sh_r",           -2,2,0.5,-asinh(a)-sinh(a), "a") \
+/*2954*/ o(FTFF1,t14"npp/ash_t_r",            -2,2,0.5,-asinh(a)-tan(a), "a") \
+/*2955*/ o(FTFF1,t14"npp/ash_th_r",           -2,2,0.5,-asinh(a)-tanh(a), "a") \
+/*2956*/ o(FTFF1,t14"npp/at_at_r",            -2,2,0.5,-atan(a)-atan(a), "a") \
+/*2957*/ o(FTFF1,t14"npp/at_ath_",     -0.75,0.75,0.25,-atan(a)-atanh(a), "a") \
+/*2958*/ o(FTFF1,t14"npp/at_c_r" ,            -2,2,0.5,-atan(a)-cos(a), "a") \
+/*2959*/ o(FTFF1,t14"npp/at_ch_r",            -2,2,0.5,-atan(a)-cosh(a), "a") \
+/*2960*/ o(FTFF1,t14"npp/at_ex_r",            -2,2,0.5,-atan(a)-exp(a), "a") \
+/*2961*/ o(FTFF1,t14"npp/at_l_r" ,           0.5,2,0.5,-atan(a)-log(a), "a") \
+/*2962*/ o(FTFF1,t14"npp/at_s_r" ,            -2,2,0.5,-atan(a)-sin(a), "a") \
+/*2963*/ o(FTFF1,t14"npp/at_sh_r",            -2,2,0.5,-atan(a)-sinh(a), "a") \
+/*2964*/ o(FTFF1,t14"npp/at_t_r" ,            -2,2,0.5,-atan(a)-tan(a), "a") \
+/*2965*/ o(FTFF1,t14"npp/at_th_r",            -2,2,0.5,-atan(a)-tanh(a), "a") \
+/*2966*/ o(FTFF1,t14"npp/ath_ath_",    -0.75,0.75,0.25,-atanh(a)-atanh(a), "a") \
+/*2967*/ o(FTFF1,t14"npp/ath_c_" ,     -0.75,0.75,0.25,-atanh(a)-cos(a), "a") \
+/*2968*/ o(FTFF1,t14"npp/ath_ch_",     -0.75,0.75,0.25,-atanh(a)-cosh(a), "a") \
+/*2969*/ o(FTFF1,t14"npp/ath_ex_",     -0.75,0.75,0.25,-atanh(a)-exp(a), "a") \
+/*2970*/ o(FTFF1,t14"npp/ath_l_r",     0.25,0.75,0.125,-atanh(a)-log(a), "a") \
+/*2971*/ o(FTFF1,t14"npp/ath_s_" ,     -0.75,0.75,0.25,-atanh(a)-sin(a), "a") \
+/*2972*/ o(FTFF1,t14"npp/ath_sh_",     -0.75,0.75,0.25,-atanh(a)-sinh(a), "a") \
+/*2973*/ o(FTFF1,t14"npp/ath_t_r",     -0.75,0.75,0.25,-atanh(a)-tan(a), "a") \
+/*2974*/ o(FTFF1,t14"npp/ath_th_r",    -0.75,0.75,0.25,-atanh(a)-tanh(a), "a") \
+/*2975*/ o(FTFF1,t14"npp/c_c_"   ,            -2,2,0.5,-cos(a)-cos(a), "a") \
+/*2976*/ o(FTFF1,t14"npp/c_ch_"  ,            -2,2,0.5,-cos(a)-cosh(a), "a") \
+/*2977*/ o(FTFF1,t14"npp/c_ex_"  ,            -2,2,0.5,-cos(a)-exp(a), "a") \
+/*2978*/ o(FTFF1,t14"npp/c_l_r"  ,           0.5,2,0.5,-cos(a)-log(a), "a") \
+/*2979*/ o(FTFF1,t14"npp/c_s_"   ,            -2,2,0.5,-cos(a)-sin(a), "a") \
+/*2980*/ o(FTFF1,t14"npp/c_sh_"  ,            -2,2,0.5,-cos(a)-sinh(a), "a") \
+/*2981*/ o(FTFF1,t14"npp/c_t_r"  ,            -2,2,0.5,-cos(a)-tan(a), "a") \
+/*2982*/ o(FTFF1,t14"npp/c_th_r" ,            -2,2,0.5,-cos(a)-tanh(a), "a") \
+/*2983*/ o(FTFF1,t14"npp/ch_ch_" ,            -2,2,0.5,-cosh(a)-cosh(a), "a") \
+/*2984*/ o(FTFF1,t14"npp/ch_ex_" ,            -2,2,0.5,-cosh(a)-exp(a), "a") \
+/*2985*/ o(FTFF1,t14"npp/ch_l_r" ,           0.5,2,0.5,-cosh(a)-log(a), "a") \
+/*2986*/ o(FTFF1,t14"npp/ch_s_"  ,            -2,2,0.5,-cosh(a)-sin(a), "a") \
+/*2987*/ o(FTFF1,t14"npp/ch_sh_" ,            -2,2,0.5,-cosh(a)-sinh(a), "a") \
+/*2988*/ o(FTFF1,t14"npp/ch_t_r" ,            -2,2,0.5,-cosh(a)-tan(a), "a") \
+/*2989*/ o(FTFF1,t14"npp/ch_th_r",            -2,2,0.5,-cosh(a)-tanh(a), "a") \
+/*2990*/ o(FTFF1,t14"npp/ex_ex_" ,            -2,2,0.5,-exp(a)-exp(a), "a") \
+/*2991*/ o(FTFF1,t14"npp/ex_l_r" ,           0.5,2,0.5,-exp(a)-log(a), "a") \
+/*2992*/ o(FTFF1,t14"npp/ex_s_"  ,            -2,2,0.5,-exp(a)-sin(a), "a") \
+/*2993*/ o(FTFF1,t14"npp/ex_sh_" ,            -2,2,0.5,-exp(a)-sinh(a), "a") \
+/*2994*/ o(FTFF1,t14"npp/ex_t_r" ,            -2,2,0.5,-exp(a)-tan(a), "a") \
+/*2995*/ o(FTFF1,t14"npp/ex_th_r",            -2,2,0.5,-exp(a)-tanh(a), "a") \
+/*2996*/ o(FTFF1,t14"npp/l_l_r"  ,           0.5,2,0.5,-log(a)-log(a), "a") \
+/*2997*/ o(FTFF1,t14"npp/l_s_r"  ,           0.5,2,0.5,-log(a)-sin(a), "a") \
+/*2998*/ o(FTFF1,t14"npp/l_sh_r" ,           0.5,2,0.5,-log(a)-sinh(a), "a") \
+/*2999*/ o(FTFF1,t14"npp/l_t_r"  ,           0.5,2,0.5,-log(a)-tan(a), "a") \
+/*3000*/ o(FTFF1,t14"npp/l_th_r" ,           0.5,2,0.5,-log(a)-tanh(a), "a") \
+/*3001*/ o(FTFF1,t14"npp/s_s_"   ,            -2,2,0.5,-sin(a)-sin(a), "a") \
+/*3002*/ o(FTFF1,t14"npp/s_sh_"  ,            -2,2,0.5,-sin(a)-sinh(a), "a") \
+/*3003*/ o(FTFF1,t14"npp/s_t_r"  ,            -2,2,0.5,-sin(a)-tan(a), "a") \
+/*3004*/ o(FTFF1,t14"npp/s_th_r" ,            -2,2,0.5,-sin(a)-tanh(a), "a") \
+/*3005*/ o(FTFF1,t14"npp/sh_sh_" ,            -2,2,0.5,-sinh(a)-sinh(a), "a") \
+/*3006*/ o(FTFF1,t14"npp/sh_t_r" ,            -2,2,0.5,-sinh(a)-tan(a), "a") \
+/*3007*/ o(FTFF1,t14"npp/sh_th_r",            -2,2,0.5,-sinh(a)-tanh(a), "a") \
+/*3008*/ o(FTFF1,t14"npp/t_t_r"  ,            -2,2,0.5,-tan(a)-tan(a), "a") \
+/*3009*/ o(FTFF1,t14"npp/t_th_r" ,            -2,2,0.5,-tan(a)-tanh(a), "a") \
+/*3010*/ o(FTFF1,t14"npp/th_th_r",            -2,2,0.5,-tanh(a)-tanh(a), "a") \
+/*3011*/ o(FTFF1,t14"pmm/ac_ac_r",            -1,1,0.5,acos(-a)+acos(-a), "a") \
+/*3012*/ o(FTFF1,t14"pmm/ac_as_r",            -1,1,0.5,acos(-a)+asin(-a), "a") \
+/*3013*/ o(FTFF1,t14"pmm/ac_ash_r",           -1,1,0.5,acos(-a)+asinh(-a), "a") \
+/*3014*/ o(FTFF1,t14"pmm/ac_at_r",            -1,1,0.5,acos(-a)+atan(-a), "a") \
+/*3015*/ o(FTFF1,t14"pmm/ac_ath_",     -0.75,0.75,0.25,acos(-a)+atanh(-a), "a") \
+/*3016*/ o(FTFF1,t14"pmm/ac_c_r" ,            -1,1,0.5,acos(-a)+cos(-a), "a") \
+/*3017*/ o(FTFF1,t14"pmm/ac_ch_r",            -1,1,0.5,acos(-a)+cosh(-a), "a") \
+/*3018*/ o(FTFF1,t14"pmm/ac_ex_r",            -1,1,0.5,acos(-a)+exp(-a), "a") \
+/*3019*/ o(FTFF1,t14"pmm/ac_l_r" ,         -1,-0.1,0.5,acos(-a)+log(-a), "a") \
+/*3020*/ o(FTFF1,t14"pmm/ac_s_r" ,            -1,1,0.5,acos(-a)+sin(-a), "a") \
+/*3021*/ o(FTFF1,t14"pmm/ac_sh_r",            -1,1,0.5,acos(-a)+sinh(-a), "a") \
+/*3022*/ o(FTFF1,t14"pmm/ac_t_r" ,            -1,1,0.5,acos(-a)+tan(-a), "a") \
+/*3023*/ o(FTFF1,t14"pmm/ac_th_r",            -1,1,0.5,acos(-a)+tanh(-a), "a") \
+/*3024*/ o(FTFF1,t14"pmm/ach_ach_r", -4.5625,-1,0.0625,acosh(-a)+acosh(-a), "a") \
+/*3025*/ o(FTFF1,t14"pmm/ach_ash_r", -5.4375,-2,0.0625,acosh(-a)+asinh(-a), "a") \
+/*3026*/ o(FTFF1,t14"pmm/ach_at_r", -3.0625,-2.125,0.0625,acosh(-a)+atan(-a), "a") \
+/*3027*/ o(FTFF1,t14"pmm/ach_c_r", -4.5625,-1.875,0.0625,acosh(-a)+cos(-a), "a") \
+/*3028*/ o(FTFF1,t14"pmm/ach_ch_r", -4.3125,-2.9375,0.0625,acosh(-a)+cosh(-a), "a") \
+/*3029*/ o(FTFF1,t14"pmm/ach_ex_r", -3.0625,-2.125,0.0625,acosh(-a)+exp(-a), "a") \
+/*3030*/ o(FTFF1,t14"pmm/ach_l_r",    -6.125,-4,0.0625,acosh(-a)+log(-a), "a") \
+/*3031*/ o(FTFF1,t14"pmm/ach_s_r", -5.875,-4.25,0.0625,acosh(-a)+sin(-a), "a") \
+/*3032*/ o(FTFF1,t14"pmm/ach_sh_r", -5.25,-4.5625,0.0625,acosh(-a)+sinh(-a), "a") \
+/*3033*/ o(FTFF1,t14"pmm/ach_t_r", -3.0625,-1.6875,0.0625,acosh(-a)+tan(-a), "a") \
+/*3034*/ o(FTFF1,t14"pmm/ach_th_r",  -5,-3.1875,0.0625,acosh(-a)+tanh(-a), "a") \
+/*3035*/ o(FTFF1,t14"pmm/as_as_r",            -1,1,0.5,asin(-a)+asin(-a), "a") \
+/*3036*/ o(FTFF1,t14"pmm/as_ash_r",           -1,1,0.5,asin(-a)+asinh(-a), "a") \
+/*3037*/ o(FTFF1,t14"pmm/as_at_r",            -1,1,0.5,asin(-a)+atan(-a), "a") \
+/*3038*/ o(FTFF1,t14"pmm/as_ath_",     -0.75,0.75,0.25,asin(-a)+atanh(-a), "a") \
+/*3039*/ o(FTFF1,t14"pmm/as_c_r" ,            -1,1,0.5,asin(-a)+cos(-a), "a") \
+/*3040*/ o(FTFF1,t14"pmm/as_ch_r",            -1,1,0.5,asin(-a)+cosh(-a), "a") \
+/*3041*/ o(FTFF1,t14"pmm/as_ex_r",            -1,1,0.5,asin(-a)+exp(-a), "a") \
+/*3042*/ o(FTFF1,t14"pmm/as_l_r" ,         -1,-0.1,0.5,asin(-a)+log(-a), "a") \
+/*3043*/ o(FTFF1,t14"pmm/as_s_r" ,            -1,1,0.5,asin(-a)+sin(-a), "a") \
+/*3044*/ o(FTFF1,t14"pmm/as_sh_r",            -1,1,0.5,asin(-a)+sinh(-a), "a") \
+/*3045*/ o(FTFF1,t14"pmm/as_t_r" ,            -1,1,0.5,asin(-a)+tan(-a), "a") \
+/*3046*/ o(FTFF1,t14"pmm/as_th_r",            -1,1,0.5,asin(-a)+tanh(-a), "a") \
+/*3047*/ o(FTFF1,t14"pmm/ash_ash_r",          -2,2,0.5,asinh(-a)+asinh(-a), "a") \
+/*3048*/ o(FTFF1,t14"pmm/ash_at_r",           -2,2,0.5,asinh(-a)+atan(-a), "a") \
+/*3049*/ o(FTFF1,t14"pmm/ash_ath_",    -0.75,0.75,0.25,asinh(-a)+atanh(-a), "a") \
+/*3050*/ o(FTFF1,t14"pmm/ash_c_r",            -2,2,0.5,asinh(-a)+cos(-a), "a") \
+/*3051*/ o(FTFF1,t14"pmm/ash_ch_r",           -2,2,0.5,asinh(-a)+cosh(-a), "a") \
+/*3052*/ o(FTFF1,t14"pmm/ash_ex_r",           -2,2,0.5,asinh(-a)+exp(-a), "a") \
+/*3053*/ o(FTFF1,t14"pmm/ash_l_r",           -4,0,0.75,asinh(-a)+log(-a), "a") \
+/*3054*/ o(FTFF1,t14"pmm/ash_s_r",            -2,2,0.5,asinh(-a)+sin(-a), "a") \
+/*3055*/ o(FTFF1,t14"pmm/ash_sh_r",           -2,2,0.5,asinh(-a)+sinh(-a), "a") \
+/*3056*/ o(FTFF1,t14"pmm/ash_t_r",            -2,2,0.5,asinh(-a)+tan(-a), "a") \
+/*3057*/ o(FTFF1,t14"pmm/ash_th_r",           -2,2,0.5,asinh(-a)+tanh(-a), "a") \
+/*3058*/ o(FTFF1,t14"pmm/at_at_r",            -2,2,0.5,atan(-a)+atan(-a), "a") \
+/*3059*/ o(FTFF1,t14"pmm/at_ath_",     -0.75,0.75,0.25,atan(-a)+atanh(-a), "a") \
+/*3060*/ o(FTFF1,t14"pmm/at_c_r" ,            -2,2,0.5,atan(-a)+cos(-a), "a") \
+/*3061*/ o(FTFF1,t14"pmm/at_ch_r",            -2,2,0.5,atan(-a)+cosh(-a), "a") \
+/*3062*/ o(FTFF1,t14"pmm/at_ex_r",            -2,2,0.5,atan(-a)+exp(-a), "a") \
+/*3063*/ o(FTFF1,t14"pmm/at_l_r" ,           -4,0,0.75,atan(-a)+log(-a), "a") \
+/*3064*/ o(FTFF1,t14"pmm/at_s_r" ,            -2,2,0.5,atan(-a)+sin(-a), "a") \
+/*3065*/ o(FTFF1,t14"pmm/at_sh_r",            -2,2,0.5,atan(-a)+sinh(-a), "a") \
+/*3066*/ o(FTFF1,t14"pmm/at_t_r" ,            -2,2,0.5,atan(-a)+tan(-a), "a") \
+/*3067*/ o(FTFF1,t14"pmm/at_th_r",            -2,2,0.5,atan(-a)+tanh(-a), "a") \
+/*3068*/ o(FTFF1,t14"pmm/ath_ath_",    -0.75,0.75,0.25,atanh(-a)+atanh(-a), "a") \
+/*3069*/ o(FTFF1,t14"pmm/ath_c_" ,     -0.75,0.75,0.25,atanh(-a)+cos(-a), "a") \
+/*3070*/ o(FTFF1,t14"pmm/ath_ch_",     -0.75,0.75,0.25,atanh(-a)+cosh(-a), "a") \
+/*3071*/ o(FTFF1,t14"pmm/ath_ex_",     -0.75,0.75,0.25,atanh(-a)+exp(-a), "a") \
+/*3072*/ o(FTFF1,t14"pmm/ath_l_" ,    -0.75,-0.25,0.25,atanh(-a)+log(-a), "a") \
+/*3073*/ o(FTFF1,t14"pmm/ath_s_" ,     -0.75,0.75,0.25,atanh(-a)+sin(-a), "a") \
+/*3074*/ o(FTFF1,t14"pmm/ath_sh_",     -0.75,0.75,0.25,atanh(-a)+sinh(-a), "a") \
+/*3075*/ o(FTFF1,t14"pmm/ath_t_r",     -0.75,0.75,0.25,atanh(-a)+tan(-a), "a") \
+/*3076*/ o(FTFF1,t14"pmm/ath_th_r",    -0.75,0.75,0.25,atanh(-a)+tanh(-a), "a") \
+/*3077*/ o(FTFF1,t14"pmm/c_c_"   ,            -2,2,0.5,cos(-a)+cos(-a), "a") \
+/*3078*/ o(FTFF1,t14"pmm/c_ch_"  ,            -2,2,0.5,cos(-a)+cosh(-a), "a") \
+/*3079*/ o(FTFF1,t14"pmm/c_ex_"  ,            -2,2,0.5,cos(-a)+exp(-a), "a") \
+/*3080*/ o(FTFF1,t14"pmm/c_l_r"  ,           -4,0,0.75,cos(-a)+log(-a), "a") \
+/*3081*/ o(FTFF1,t14"pmm/c_s_"   ,            -2,2,0.5,cos(-a)+sin(-a), "a") \
+/*3082*/ o(FTFF1,t14"pmm/c_sh_"  ,            -2,2,0.5,cos(-a)+sinh(-a), "a") \
+/*3083*/ o(FTFF1,t14"pmm/c_t_r"  ,            -2,2,0.5,cos(-a)+tan(-a), "a") \
+/*3084*/ o(FTFF1,t14"pmm/c_th_r" ,            -2,2,0.5,cos(-a)+tanh(-a), "a") \
+/*3085*/ o(FTFF1,t14"pmm/ch_ch_" ,            -2,2,0.5,cosh(-a)+cosh(-a), "a") \
+/*3086*/ o(FTFF1,t14"pmm/ch_ex_" ,            -2,2,0.5,cosh(-a)+exp(-a), "a") \
+/*3087*/ o(FTFF1,t14"pmm/ch_l_r" ,           -4,0,0.75,cosh(-a)+log(-a), "a") \
+/*3088*/ o(FTFF1,t14"pmm/ch_s_"  ,            -2,2,0.5,cosh(-a)+sin(-a), "a") \
+/*3089*/ o(FTFF1,t14"pmm/ch_sh_" ,            -2,2,0.5,cosh(-a)+sinh(-a), "a") \
+/*3090*/ o(FTFF1,t14"pmm/ch_t_r" ,            -2,2,0.5,cosh(-a)+tan(-a), "a") \
+/*3091*/ o(FTFF1,t14"pmm/ch_th_r",            -2,2,0.5,cosh(-a)+tanh(-a), "a") \
+/*3092*/ o(FTFF1,t14"pmm/ex_ex_" ,            -2,2,0.5,exp(-a)+exp(-a), "a") \
+/*3093*/ o(FTFF1,t14"pmm/ex_l_r" ,           -4,0,0.75,exp(-a)+log(-a), "a") \
+/*3094*/ o(FTFF1,t14"pmm/ex_s_"  ,            -2,2,0.5,exp(-a)+sin(-a), "a") \
+/*3095*/ o(FTFF1,t14"pmm/ex_sh_" ,            -2,2,0.5,exp(-a)+sinh(-a), "a") \
+/*3096*/ o(FTFF1,t14"pmm/ex_t_r" ,            -2,2,0.5,exp(-a)+tan(-a), "a") \
+/*3097*/ o(FTFF1,t14"pmm/ex_th_r",            -2,2,0.5,exp(-a)+tanh(-a), "a") \
+/*3098*/ o(FTFF1,t14"pmm/l_l_r"  ,           -4,0,0.75,log(-a)+log(-a), "a") \
+/*3099*/ o(FTFF1,t14"pmm/l_s_r"  ,           -4,0,0.75,log(-a)+sin(-a), "a") \
+/*3100*/ o(FTFF1,t14"pmm/l_sh_r" ,           -4,0,0.75,log(-a)+sinh(-a), "a") \
+/*3101*/ o(FTFF1,t14"pmm/l_t_r"  ,           -4,0,0.75,log(-a)+tan(-a), "a") \
+/*3102*/ o(FTFF1,t14"pmm/l_th_r" ,           -4,0,0.75,log(-a)+tanh(-a), "a") \
+/*3103*/ o(FTFF1,t14"pmm/s_s_"   ,            -2,2,0.5,sin(-a)+sin(-a), "a") \
+/*3104*/ o(FTFF1,t14"pmm/s_sh_"  ,            -2,2,0.5,sin(-a)+sinh(-a), "a") \
+/*3105*/ o(FTFF1,t14"pmm/s_t_r"  ,            -2,2,0.5,sin(-a)+tan(-a), "a") \
+/*3106*/ o(FTFF1,t14"pmm/s_th_r" ,            -2,2,0.5,sin(-a)+tanh(-a), "a") \
+/*3107*/ o(FTFF1,t14"pmm/sh_sh_" ,            -2,2,0.5,sinh(-a)+sinh(-a), "a") \
+/*3108*/ o(FTFF1,t14"pmm/sh_t_r" ,            -2,2,0.5,sinh(-a)+tan(-a), "a") \
+/*3109*/ o(FTFF1,t14"pmm/sh_th_r",            -2,2,0.5,sinh(-a)+tanh(-a), "a") \
+/*3110*/ o(FTFF1,t14"pmm/t_t_r"  ,            -2,2,0.5,tan(-a)+tan(-a), "a") \
+/*3111*/ o(FTFF1,t14"pmm/t_th_r" ,            -2,2,0.5,tan(-a)+tanh(-a), "a") \
+/*3112*/ o(FTFF1,t14"pmm/th_th_r",            -2,2,0.5,tanh(-a)+tanh(-a), "a") \
+/*3113*/ o(FTFF1,t14"ppm/ac_ac_r",            -1,1,0.5,acos(a)+acos(-a), "a") \
+/*3114*/ o(FTFF1,t14"ppm/ac_as_r",            -1,1,0.5,acos(a)+asin(-a), "a") \
+/*3115*/ o(FTFF1,t14"ppm/ac_ash_r",           -1,1,0.5,acos(a)+asinh(-a), "a") \
+/*3116*/ o(FTFF1,t14"ppm/ac_at_r",            -1,1,0.5,acos(a)+atan(-a), "a") \
+/*3117*/ o(FTFF1,t14"ppm/ac_ath_",     -0.75,0.75,0.25,acos(a)+atanh(-a), "a") \
+/*3118*/ o(FTFF1,t14"ppm/ac_c_r" ,            -1,1,0.5,acos(a)+cos(-a), "a") \
+/*3119*/ o(FTFF1,t14"ppm/ac_ch_r",            -1,1,0.5,acos(a)+cosh(-a), "a") \
+/*3120*/ o(FTFF1,t14"ppm/ac_ex_r",            -1,1,0.5,acos(a)+exp(-a), "a") \
+/*3121*/ o(FTFF1,t14"ppm/ac_l_r" ,         -1,-0.1,0.5,acos(a)+log(-a), "a") \
+/*3122*/ o(FTFF1,t14"ppm/ac_s_r" ,            -1,1,0.5,acos(a)+sin(-a), "a") \
+/*3123*/ o(FTFF1,t14"ppm/ac_sh_r",            -1,1,0.5,acos(a)+sinh(-a), "a") \
+/*3124*/ o(FTFF1,t14"ppm/ac_t_r" ,            -1,1,0.5,acos(a)+tan(-a), "a") \
+/*3125*/ o(FTFF1,t14"ppm/ac_th_r",            -1,1,0.5,acos(a)+tanh(-a), "a") \
+/*3126*/ o(FTFF1,t14"ppm/ach_ash_r", 4.125,7.9375,0.0625,acosh(a)+asinh(-a), "a") \
+/*3127*/ o(FTFF1,t14"ppm/ach_at_r", 2.3125,4.75,0.0625,acosh(a)+atan(-a), "a") \
+/*3128*/ o(FTFF1,t14"ppm/ach_c_r",    5,11.1875,0.0625,acosh(a)+cos(-a), "a") \
+/*3129*/ o(FTFF1,t14"ppm/ach_ch_r",      2.25,6,0.0625,acosh(a)+cosh(-a), "a") \
+/*3130*/ o(FTFF1,t14"ppm/ach_ex_r", 5.6875,8.3125,0.0625,acosh(a)+exp(-a), "a") \
+/*3131*/ o(FTFF1,t14"ppm/ach_s_r",  1.625,6.375,0.0625,acosh(a)+sin(-a), "a") \
+/*3132*/ o(FTFF1,t14"ppm/ach_sh_r", 3.9375,5.5625,0.0625,acosh(a)+sinh(-a), "a") \
+/*3133*/ o(FTFF1,t14"ppm/ach_t_r", 5.375,8.3125,0.0625,acosh(a)+tan(-a), "a") \
+/*3134*/ o(FTFF1,t14"ppm/ach_th_r", 1.8125,5.9375,0.0625,acosh(a)+tanh(-a), "a") \
+/*3135*/ o(FTFF1,t14"ppm/as_ac_r",            -1,1,0.5,asin(a)+acos(-a), "a") \
+/*3136*/ o(FTFF1,t14"ppm/as_as_r",            -1,1,0.5,asin(a)+asin(-a), "a") \
+/*3137*/ o(FTFF1,t14"ppm/as_ash_r",           -1,1,0.5,asin(a)+asinh(-a), "a") \
+/*3138*/ o(FTFF1,t14"ppm/as_at_r",            -1,1,0.5,asin(a)+atan(-a), "a") \
+/*3139*/ o(FTFF1,t14"ppm/as_ath_",     -0.75,0.75,0.25,asin(a)+atanh(-a), "a") \
+/*3140*/ o(FTFF1,t14"ppm/as_c_r" ,            -1,1,0.5,asin(a)+cos(-a), "a") \
+/*3141*/ o(FTFF1,t14"ppm/as_ch_r",            -1,1,0.5,asin(a)+cosh(-a), "a") \
+/*3142*/ o(FTFF1,t14"ppm/as_ex_r",            -1,1,0.5,asin(a)+exp(-a), "a") \
+/*3143*/ o(FTFF1,t14"ppm/as_l_r" ,         -1,-0.1,0.5,asin(a)+log(-a), "a") \
+/*3144*/ o(FTFF1,t14"ppm/as_s_r" ,            -1,1,0.5,asin(a)+sin(-a), "a") \
+/*3145*/ o(FTFF1,t14"ppm/as_sh_r",            -1,1,0.5,asin(a)+sinh(-a), "a") \
+/*3146*/ o(FTFF1,t14"ppm/as_t_r" ,            -1,1,0.5,asin(a)+tan(-a), "a") \
+/*3147*/ o(FTFF1,t14"ppm/as_th_r",            -1,1,0.5,asin(a)+tanh(-a), "a") \
+/*3148*/ o(FTFF1,t14"ppm/ash_ac_r",           -1,1,0.5,asinh(a)+acos(-a), "a") \
+/*3149*/ o(FTFF1,t14"ppm/ash_ach_r", -2.4375,-1.1875,0.0625,asinh(a)+acosh(-a), "a") \
+/*3150*/ o(FTFF1,t14"ppm/ash_as_r",           -1,1,0.5,asinh(a)+asin(-a), "a") \
+/*3151*/ o(FTFF1,t14"ppm/ash_ash_r",          -2,2,0.5,asinh(a)+asinh(-a), "a") \
+/*3152*/ o(FTFF1,t14"ppm/ash_at_r",           -2,2,0.5,asinh(a)+atan(-a), "a") \
+/*3153*/ o(FTFF1,t14"ppm/ash_ath_",    -0.75,0.75,0.25,asinh(a)+atanh(-a), "a") \
+/*3154*/ o(FTFF1,t14"ppm/ash_c_r",            -2,2,0.5,asinh(a)+cos(-a), "a") \
+/*3155*/ o(FTFF1,t14"ppm/ash_ch_r",           -2,2,0.5,asinh(a)+cosh(-a), "a") \
+/*3156*/ o(FTFF1,t14"ppm/ash_ex_r",           -2,2,0.5,asinh(a)+exp(-a), "a") \
+/*3157*/ o(FTFF1,t14"ppm/ash_l_r",           -4,0,0.75,asinh(a)+log(-a), "a") \
+/*3158*/ o(FTFF1,t14"ppm/ash_s_r",            -2,2,0.5,asinh(a)+sin(-a), "a") \
+/*3159*/ o(FTFF1,t14"ppm/ash_sh_r",           -2,2,0.5,asinh(a)+sinh(-a), "a") \
+/*3160*/ o(FTFF1,t14"ppm/ash_t_r",            -2,2,0.5,asinh(a)+tan(-a), "a") \
+/*3161*/ o(FTFF1,t14"ppm/ash_th_r",           -2,2,0.5,asinh(a)+tanh(-a), "a") \
+/*3162*/ o(FTFF1,t14"ppm/at_ac_r",            -1,1,0.5,atan(a)+acos(-a), "a") \
+/*3163*/ o(FTFF1,t14"ppm/at_ach_r", -5.625,-4.8125,0.0625,atan(a)+acosh(-a), "a") \
+/*3164*/ o(FTFF1,t14"ppm/at_as_r",            -1,1,0.5,atan(a)+asin(-a), "a") \
+/*3165*/ o(FTFF1,t14"ppm/at_ash_r",           -2,2,0.5,atan(a)+asinh(-a), "a") \
+/*3166*/ o(FTFF1,t14"ppm/at_at_r",            -2,2,0.5,atan(a)+atan(-a), "a") \
+/*3167*/ o(FTFF1,t14"ppm/at_ath_",     -0.75,0.75,0.25,atan(a)+atanh(-a), "a") \
+/*3168*/ o(FTFF1,t14"ppm/at_c_r" ,            -2,2,0.5,atan(a)+cos(-a), "a") \
+/*3169*/ o(FTFF1,t14"ppm/at_ch_r",            -2,2,0.5,atan(a)+cosh(-a), "a") \
+/*3170*/ o(FTFF1,t14"ppm/at_ex_r",            -2,2,0.5,atan(a)+exp(-a), "a") \
+/*3171*/ o(FTFF1,t14"ppm/at_l_r" ,           -4,0,0.75,atan(a)+log(-a), "a") \
+/*3172*/ o(FTFF1,t14"ppm/at_s_r" ,            -2,2,0.5,atan(a)+sin(-a), "a") \
+/*3173*/ o(FTFF1,t14"ppm/at_sh_r",            -2,2,0.5,atan(a)+sinh(-a), "a") \
+/*3174*/ o(FTFF1,t14"ppm/at_t_r" ,            -2,2,0.5,atan(a)+tan(-a), "a") \
+/*3175*/ o(FTFF1,t14"ppm/at_th_r",            -2,2,0.5,atan(a)+tanh(-a), "a") \
+/*3176*/ o(FTFF1,t14"ppm/ath_ac_",     -0.75,0.75,0.25,atanh(a)+acos(-a), "a") \
+/*3177*/ o(FTFF1,t14"ppm/ath_as_",     -0.75,0.75,0.25,atanh(a)+asin(-a), "a") \
+/*3178*/ o(FTFF1,t14"ppm/ath_ash_",    -0.75,0.75,0.25,atanh(a)+asinh(-a), "a") \
+/*3179*/ o(FTFF1,t14"ppm/ath_at_",     -0.75,0.75,0.25,atanh(a)+atan(-a), "a") \
+/*3180*/ o(FTFF1,t14"ppm/ath_ath_",    -0.75,0.75,0.25,atanh(a)+atanh(-a), "a") \
+/*3181*/ o(FTFF1,t14"ppm/ath_c_" ,     -0.75,0.75,0.25,atanh(a)+cos(-a), "a") \
+/*3182*/ o(FTFF1,t14"ppm/ath_ch_",     -0.75,0.75,0.25,atanh(a)+cosh(-a), "a") \
+/*3183*/ o(FTFF1,t14"ppm/ath_ex_",     -0.75,0.75,0.25,atanh(a)+exp(-a), "a") \
+/*3184*/ o(FTFF1,t14"ppm/ath_l_" ,    -0.75,-0.25,0.25,atanh(a)+log(-a), "a") \
+/*3185*/ o(FTFF1,t14"ppm/ath_s_" ,     -0.75,0.75,0.25,atanh(a)+sin(-a), "a") \
+/*3186*/ o(FTFF1,t14"ppm/ath_sh_",     -0.75,0.75,0.25,atanh(a)+sinh(-a), "a") \
+/*3187*/ o(FTFF1,t14"ppm/ath_t_r",     -0.75,0.75,0.25,atanh(a)+tan(-a), "a") \
+/*3188*/ o(FTFF1,t14"ppm/ath_th_r",    -0.75,0.75,0.25,atanh(a)+tanh(-a), "a") \
+/*3189*/ o(FTFF1,t14"ppm/c_ac_r" ,            -1,1,0.5,cos(a)+acos(-a), "a") \
+/*3190*/ o(FTFF1,t14"ppm/c_ach_r", -4.1875,-2.125,0.0625,cos(a)+acosh(-a), "a") \
+/*3191*/ o(FTFF1,t14"ppm/c_as_r" ,            -1,1,0.5,cos(a)+asin(-a), "a") \
+/*3192*/ o(FTFF1,t14"ppm/c_ash_r",            -2,2,0.5,cos(a)+asinh(-a), "a") \
+/*3193*/ o(FTFF1,t14"ppm/c_at_r" ,            -2,2,0.5,cos(a)+atan(-a), "a") \
+/*3194*/ o(FTFF1,t14"ppm/c_ath_" ,     -0.75,0.75,0.25,cos(a)+atanh(-a), "a") \
+/*3195*/ o(FTFF1,t14"ppm/c_c_"   ,            -2,2,0.5,cos(a)+cos(-a), "a") \
+/*3196*/ o(FTFF1,t14"ppm/c_ch_"  ,            -2,2,0.5,cos(a)+cosh(-a), "a") \
+/*3197*/ o(FTFF1,t14"ppm/c_ex_"  ,            -2,2,0.5,cos(a)+exp(-a), "a") \
+/*3198*/ o(FTFF1,t14"ppm/c_l_r"  ,           -4,0,0.75,cos(a)+log(-a), "a") \
+/*3199*/ o(FTFF1,t14"ppm/c_s_"   ,            -2,2,0.5,cos(a)+sin(-a), "a") \
+/*3200*/ o(FTFF1,t14"ppm/c_sh_"  ,            -2,2,0.5,cos(a)+sinh(-a), "a") \
+/*3201*/ o(FTFF1,t14"ppm/c_t_r"  ,            -2,2,0.5,cos(a)+tan(-a), "a") \
+/*3202*/ o(FTFF1,t14"ppm/c_th_r" ,            -2,2,0.5,cos(a)+tanh(-a), "a") \
+/*3203*/ o(FTFF1,t14"ppm/ch_ac_r",            -1,1,0.5,cosh(a)+acos(-a), "a") \
+/*3204*/ o(FTFF1,t14"ppm/ch_ach_r", -2.8125,-2.125,0.0625,cosh(a)+acosh(-a), "a") \
+/*3205*/ o(FTFF1,t14"ppm/ch_as_r",            -1,1,0.5,cosh(a)+asin(-a), "a") \
+/*3206*/ o(FTFF1,t14"ppm/ch_ash_r",           -2,2,0.5,cosh(a)+asinh(-a), "a") \
+/*3207*/ o(FTFF1,t14"ppm/ch_at_r",            -2,2,0.5,cosh(a)+atan(-a), "a") \
+/*3208*/ o(FTFF1,t14"ppm/ch_ath_",     -0.75,0.75,0.25,cosh(a)+atanh(-a), "a") \
+/*3209*/ o(FTFF1,t14"ppm/ch_c_"  ,            -2,2,0.5,cosh(a)+cos(-a), "a") \
+/*3210*/ o(FTFF1,t14"ppm/ch_ch_" ,            -2,2,0.5,cosh(a)+cosh(-a), "a") \
+/*3211*/ o(FTFF1,t14"ppm/ch_ex_" ,            -2,2,0.5,cosh(a)+exp(-a), "a") \
+/*3212*/ o(FTFF1,t14"ppm/ch_l_r" ,           -4,0,0.75,cosh(a)+log(-a), "a") \
+/*3213*/ o(FTFF1,t14"ppm/ch_s_"  ,            -2,2,0.5,cosh(a)+sin(-a), "a") \
+/*3214*/ o(FTFF1,t14"ppm/ch_sh_" ,            -2,2,0.5,cosh(a)+sinh(-a), "a") \
+/*3215*/ o(FTFF1,t14"ppm/ch_t_r" ,            -2,2,0.5,cosh(a)+tan(-a), "a") \
+/*3216*/ o(FTFF1,t14"ppm/ch_th_r",            -2,2,0.5,cosh(a)+tanh(-a), "a") \
+/*3217*/ o(FTFF1,t14"ppm/ex_ac_r",            -1,1,0.5,exp(a)+acos(-a), "a") \
+/*3218*/ o(FTFF1,t14"ppm/ex_ach_r", -5.4375,-3.875,0.0625,exp(a)+acosh(-a), "a") \
+/*3219*/ o(FTFF1,t14"ppm/ex_as_r",            -1,1,0.5,exp(a)+asin(-a), "a") \
+/*3220*/ o(FTFF1,t14"ppm/ex_ash_r",           -2,2,0.5,exp(a)+asinh(-a), "a") \
+/*3221*/ o(FTFF1,t14"ppm/ex_at_r",            -2,2,0.5,exp(a)+atan(-a), "a") \
+/*3222*/ o(FTFF1,t14"ppm/ex_ath_",     -0.75,0.75,0.25,exp(a)+atanh(-a), "a") \
+/*3223*/ o(FTFF1,t14"ppm/ex_c_"  ,            -2,2,0.5,exp(a)+cos(-a), "a") \
+/*3224*/ o(FTFF1,t14"ppm/ex_ch_" ,            -2,2,0.5,exp(a)+cosh(-a), "a") \
+/*3225*/ o(FTFF1,t14"ppm/ex_ex_" ,            -2,2,0.5,exp(a)+exp(-a), "a") \
+/*3226*/ o(FTFF1,t14"ppm/ex_l_r" ,           -4,0,0.75,exp(a)+log(-a), "a") \
+/*3227*/ o(FTFF1,t14"ppm/ex_s_"  ,            -2,2,0.5,exp(a)+sin(-a), "a") \
+/*3228*/ o(FTFF1,t14"ppm/ex_sh_" ,            -2,2,0.5,exp(a)+sinh(-a), "a") \
+/*3229*/ o(FTFF1,t14"ppm/ex_t_r" ,            -2,2,0.5,exp(a)+tan(-a), "a") \
+/*3230*/ o(FTFF1,t14"ppm/ex_th_r",            -2,2,0.5,exp(a)+tanh(-a), "a") \
+/*3231*/ o(FTFF1,t14"ppm/l_ac_r" ,          0.5,1,0.25,log(a)+acos(-a), "a") \
+/*3232*/ o(FTFF1,t14"ppm/l_as_r" ,          0.5,1,0.25,log(a)+asin(-a), "a") \
+/*3233*/ o(FTFF1,t14"ppm/l_ash_r",           0.5,2,0.5,log(a)+asinh(-a), "a") \
+/*3234*/ o(FTFF1,t14"ppm/l_at_r" ,           0.5,2,0.5,log(a)+atan(-a), "a") \
+/*3235*/ o(FTFF1,t14"ppm/l_ath_r",     0.25,0.75,0.125,log(a)+atanh(-a), "a") \
+/*3236*/ o(FTFF1,t14"ppm/l_c_r"  ,           0.5,2,0.5,log(a)+cos(-a), "a") \
+/*3237*/ o(FTFF1,t14"ppm/l_ch_r" ,           0.5,2,0.5,log(a)+cosh(-a), "a") \
+/*3238*/ o(FTFF1,t14"ppm/l_ex_r" ,           0.5,2,0.5,log(a)+exp(-a), "a") \
+/*3239*/ o(FTFF1,t14"ppm/l_s_r"  ,           0.5,2,0.5,log(a)+sin(-a), "a") \
+/*3240*/ o(FTFF1,t14"ppm/l_sh_r" ,           0.5,2,0.5,log(a)+sinh(-a), "a") \
+/*3241*/ o(FTFF1,t14"ppm/l_t_r"  ,           0.5,2,0.5,log(a)+tan(-a), "a") \
+/*3242*/ o(FTFF1,t14"ppm/l_th_r" ,           0.5,2,0.5,log(a)+tanh(-a), "a") \
+/*3243*/ o(FTFF1,t14"ppm/s_ac_r" ,            -1,1,0.5,sin(a)+acos(-a), "a") \
+/*3244*/ o(FTFF1,t14"ppm/s_ach_r", -5.3125,-1.75,0.0625,sin(a)+acosh(-a), "a") \
+/*3245*/ o(FTFF1,t14"ppm/s_as_r" ,            -1,1,0.5,sin(a)+asin(-a), "a") \
+/*3246*/ o(FTFF1,t14"ppm/s_ash_r",            -2,2,0.5,sin(a)+asinh(-a), "a") \
+/*3247*/ o(FTFF1,t14"ppm/s_at_r" ,            -2,2,0.5,sin(a)+atan(-a), "a") \
+/*3248*/ o(FTFF1,t14"ppm/s_ath_" ,     -0.75,0.75,0.25,sin(a)+atanh(-a), "a") \
+/*3249*/ o(FTFF1,t14"ppm/s_c_"   ,            -2,2,0.5,sin(a)+cos(-a), "a") \
+/*3250*/ o(FTFF1,t14"ppm/s_ch_"  ,            -2,2,0.5,sin(a)+cosh(-a), "a") \
+/*3251*/ o(FTFF1,t14"ppm/s_ex_"  ,            -2,2,0.5,sin(a)+exp(-a), "a") \
+/*3252*/ o(FTFF1,t14"ppm/s_l_r"  ,           -4,0,0.75,sin(a)+log(-a), "a") \
+/*3253*/ o(FTFF1,t14"ppm/s_s_"   ,            -2,2,0.5,sin(a)+sin(-a), "a") \
+/*3254*/ o(FTFF1,t14"ppm/s_sh_"  ,            -2,2,0.5,sin(a)+sinh(-a), "a") \
+/*3255*/ o(FTFF1,t14"ppm/s_t_r"  ,            -2,2,0.5,sin(a)+tan(-a), "a") \
+/*3256*/ o(FTFF1,t14"ppm/s_th_r" ,            -2,2,0.5,sin(a)+tanh(-a), "a") \
+/*3257*/ o(FTFF1,t14"ppm/sh_ac_r",            -1,1,0.5,sinh(a)+acos(-a), "a") \
+/*3258*/ o(FTFF1,t14"ppm/sh_ach_r", -4.125,-1.4375,0.0625,sinh(a)+acosh(-a), "a") \
+/*3259*/ o(FTFF1,t14"ppm/sh_as_r",            -1,1,0.5,sinh(a)+asin(-a), "a") \
+/*3260*/ o(FTFF1,t14"ppm/sh_ash_r",           -2,2,0.5,sinh(a)+asinh(-a), "a") \
+/*3261*/ o(FTFF1,t14"ppm/sh_at_r",            -2,2,0.5,sinh(a)+atan(-a), "a") \
+/*3262*/ o(FTFF1,t14"ppm/sh_ath_",     -0.75,0.75,0.25,sinh(a)+atanh(-a), "a") \
+/*3263*/ o(FTFF1,t14"ppm/sh_c_"  ,            -2,2,0.5,sinh(a)+cos(-a), "a") \
+/*3264*/ o(FTFF1,t14"ppm/sh_ch_" ,            -2,2,0.5,sinh(a)+cosh(-a), "a") \
+/*3265*/ o(FTFF1,t14"ppm/sh_ex_" ,            -2,2,0.5,sinh(a)+exp(-a), "a") \
+/*3266*/ o(FTFF1,t14"ppm/sh_l_r" ,           -4,0,0.75,sinh(a)+log(-a), "a") \
+/*3267*/ o(FTFF1,t14"ppm/sh_s_"  ,            -2,2,0.5,sinh(a)+sin(-a), "a") \
+/*3268*/ o(FTFF1,t14"ppm/sh_sh_" ,            -2,2,0.5,sinh(a)+sinh(-a), "a") \
+/*3269*/ o(FTFF1,t14"ppm/sh_t_r" ,            -2,2,0.5,sinh(a)+tan(-a), "a") \
+/*3270*/ o(FTFF1,t14"ppm/sh_th_r",            -2,2,0.5,sinh(a)+tanh(-a), "a") \
+/*3271*/ o(FTFF1,t14"ppm/t_ac_r" ,            -1,1,0.5,tan(a)+acos(-a), "a") \
+/*3272*/ o(FTFF1,t14"ppm/t_ach_r", -5.5625,-2.5,0.0625,tan(a)+acosh(-a), "a") \
+/*3273*/ o(FTFF1,t14"ppm/t_as_r" ,            -1,1,0.5,tan(a)+asin(-a), "a") \
+/*3274*/ o(FTFF1,t14"ppm/t_ash_r",            -2,2,0.5,tan(a)+asinh(-a), "a") \
+/*3275*/ o(FTFF1,t14"ppm/t_at_r" ,            -2,2,0.5,tan(a)+atan(-a), "a") \
+/*3276*/ o(FTFF1,t14"ppm/t_ath_r",     -0.75,0.75,0.25,tan(a)+atanh(-a), "a") \
+/*3277*/ o(FTFF1,t14"ppm/t_c_r"  ,            -2,2,0.5,tan(a)+cos(-a), "a") \
+/*3278*/ o(FTFF1,t14"ppm/t_ch_r" ,            -2,2,0.5,tan(a)+cosh(-a), "a") \
+/*3279*/ o(FTFF1,t14"ppm/t_ex_r" ,            -2,2,0.5,tan(a)+exp(-a), "a") \
+/*3280*/ o(FTFF1,t14"ppm/t_l_r"  ,           -4,0,0.75,tan(a)+log(-a), "a") \
+/*3281*/ o(FTFF1,t14"ppm/t_s_r"  ,            -2,2,0.5,tan(a)+sin(-a), "a") \
+/*3282*/ o(FTFF1,t14"ppm/t_sh_r" ,            -2,2,0.5,tan(a)+sinh(-a), "a") \
+/*3283*/ o(FTFF1,t14"ppm/t_t_r"  ,            -2,2,0.5,tan(a)+tan(-a), "a") \
+/*3284*/ o(FTFF1,t14"ppm/t_th_r" ,            -2,2,0.5,tan(a)+tanh(-a), "a") \
+/*3285*/ o(FTFF1,t14"ppm/th_ac_r",            -1,1,0.5,tanh(a)+acos(-a), "a") \
+/*3286*/ o(FTFF1,t14"ppm/th_ach_r", -2.375,-1.125,0.0625,tanh(a)+acosh(-a), "a") \
+/*3287*/ o(FTFF1,t14"ppm/th_as_r",            -1,1,0.5,tanh(a)+asin(-a), "a") \
+/*3288*/ o(FTFF1,t14"ppm/th_ash_r",           -2,2,0.5,tanh(a)+asinh(-a), "a") \
+/*3289*/ o(FTFF1,t14"ppm/th_at_r",            -2,2,0.5,tanh(a)+atan(-a), "a") \
+/*3290*/ o(FTFF1,t14"ppm/th_ath_r",    -0.75,0.75,0.25,tanh(a)+atanh(-a), "a") \
+/*3291*/ o(FTFF1,t14"ppm/th_c_r" ,            -2,2,0.5,tanh(a)+cos(-a), "a") \
+/*3292*/ o(FTFF1,t14"ppm/th_ch_r",            -2,2,0.5,tanh(a)+cosh(-a), "a") \
+/*3293*/ o(FTFF1,t14"ppm/th_ex_r",            -2,2,0.5,tanh(a)+exp(-a), "a") \
+/*3294*/ o(FTFF1,t14"ppm/th_l_r" ,           -4,0,0.75,tanh(a)+log(-a), "a") \
+/*3295*/ o(FTFF1,t14"ppm/th_s_r" ,            -2,2,0.5,tanh(a)+sin(-a), "a") \
+/*3296*/ o(FTFF1,t14"ppm/th_sh_r",            -2,2,0.5,tanh(a)+sinh(-a), "a") \
+/*3297*/ o(FTFF1,t14"ppm/th_t_r" ,            -2,2,0.5,tanh(a)+tan(-a), "a") \
+/*3298*/ o(FTFF1,t14"ppm/th_th_r",            -2,2,0.5,tanh(a)+tanh(-a), "a") \
+/*3299*/ o(FTFF1,t14"ppp/ac_ac_r",            -1,1,0.5,acos(a)+acos(a), "a") \
+/*3300*/ o(FTFF1,t14"ppp/ac_as_r",            -1,1,0.5,acos(a)+asin(a), "a") \
+/*3301*/ o(FTFF1,t14"ppp/ac_ash_r",           -1,1,0.5,acos(a)+asinh(a), "a") \
+/*3302*/ o(FTFF1,t14"ppp/ac_at_r",            -1,1,0.5,acos(a)+atan(a), "a") \
+/*3303*/ o(FTFF1,t14"ppp/ac_ath_",     -0.75,0.75,0.25,acos(a)+atanh(a), "a") \
+/*3304*/ o(FTFF1,t14"ppp/ac_c_r" ,            -1,1,0.5,acos(a)+cos(a), "a") \
+/*3305*/ o(FTFF1,t14"ppp/ac_ch_r",            -1,1,0.5,acos(a)+cosh(a), "a") \
+/*3306*/ o(FTFF1,t14"ppp/ac_ex_r",            -1,1,0.5,acos(a)+exp(a), "a") \
+/*3307*/ o(FTFF1,t14"ppp/ac_l_r" ,          0.5,1,0.25,acos(a)+log(a), "a") \
+/*3308*/ o(FTFF1,t14"ppp/ac_s_r" ,            -1,1,0.5,acos(a)+sin(a), "a") \
+/*3309*/ o(FTFF1,t14"ppp/ac_sh_r",            -1,1,0.5,acos(a)+sinh(a), "a") \
+/*3310*/ o(FTFF1,t14"ppp/ac_t_r" ,            -1,1,0.5,acos(a)+tan(a), "a") \
+/*3311*/ o(FTFF1,t14"ppp/ac_th_r",            -1,1,0.5,acos(a)+tanh(a), "a") \
+/*3312*/ o(FTFF1,t14"ppp/ach_ach_r", 3.9375,8.875,0.0625,acosh(a)+acosh(a), "a") \
+/*3313*/ o(FTFF1,t14"ppp/ach_ash_r", 2.875,7.9375,0.0625,acosh(a)+asinh(a), "a") \
+/*3314*/ o(FTFF1,t14"ppp/ach_at_r", 3.75,8.6875,0.0625,acosh(a)+atan(a), "a") \
+/*3315*/ o(FTFF1,t14"ppp/ach_c_r", 3.1875,7.3125,0.0625,acosh(a)+cos(a), "a") \
+/*3316*/ o(FTFF1,t14"ppp/ach_ch_r",  4.5,5.5625,0.0625,acosh(a)+cosh(a), "a") \
+/*3317*/ o(FTFF1,t14"ppp/ach_ex_r", 4.6875,8.8125,0.0625,acosh(a)+exp(a), "a") \
+/*3318*/ o(FTFF1,t14"ppp/ach_l_r", 5.375,10.0625,0.0625,acosh(a)+log(a), "a") \
+/*3319*/ o(FTFF1,t14"ppp/ach_s_r",  2.875,7.375,0.0625,acosh(a)+sin(a), "a") \
+/*3320*/ o(FTFF1,t14"ppp/ach_sh_r", 2.6875,3.75,0.0625,acosh(a)+sinh(a), "a") \
+/*3321*/ o(FTFF1,t14"ppp/ach_t_r",      2,3.875,0.0625,acosh(a)+tan(a), "a") \
+/*3322*/ o(FTFF1,t14"ppp/ach_th_r", 2.0625,3.8125,0.0625,acosh(a)+tanh(a), "a") \
+/*3323*/ o(FTFF1,t14"ppp/as_as_r",            -1,1,0.5,asin(a)+asin(a), "a") \
+/*3324*/ o(FTFF1,t14"ppp/as_ash_r",           -1,1,0.5,asin(a)+asinh(a), "a") \
+/*3325*/ o(FTFF1,t14"ppp/as_at_r",            -1,1,0.5,asin(a)+atan(a), "a") \
+/*3326*/ o(FTFF1,t14"ppp/as_ath_",     -0.75,0.75,0.25,asin(a)+atanh(a), "a") \
+/*3327*/ o(FTFF1,t14"ppp/as_c_r" ,            -1,1,0.5,asin(a)+cos(a), "a") \
+/*3328*/ o(FTFF1,t14"ppp/as_ch_r",            -1,1,0.5,asin(a)+cosh(a), "a") \
+/*3329*/ o(FTFF1,t14"ppp/as_ex_r",            -1,1,0.5,asin(a)+exp(a), "a") \
+/*3330*/ o(FTFF1,t14"ppp/as_l_r" ,          0.5,1,0.25,asin(a)+log(a), "a") \
+/*3331*/ o(FTFF1,t14"ppp/as_s_r" ,            -1,1,0.5,asin(a)+sin(a), "a") \
+/*3332*/ o(FTFF1,t14"ppp/as_sh_r",            -1,1,0.5,asin(a)+sinh(a), "a") \
+/*3333*/ o(FTFF1,t14"ppp/as_t_r" ,            -1,1,0.5,asin(a)+tan(a), "a") \
+/*3334*/ o(FTFF1,t14"ppp/as_th_r",            -1,1,0.5,asin(a)+tanh(a), "a") \
+/*3335*/ o(FTFF1,t14"ppp/ash_ash_r",          -2,2,0.5,asinh(a)+asinh(a), "a") \
+/*3336*/ o(FTFF1,t14"ppp/ash_at_r",           -2,2,0.5,asinh(a)+atan(a), "a") \
+/*3337*/ o(FTFF1,t14"ppp/ash_ath_",    -0.75,0.75,0.25,asinh(a)+atanh(a), "a") \
+/*3338*/ o(FTFF1,t14"ppp/ash_c_r",            -2,2,0.5,asinh(a)+cos(a), "a") \
+/*3339*/ o(FTFF1,t14"ppp/ash_ch_r",           -2,2,0.5,asinh(a)+cosh(a), "a") \
+/*3340*/ o(FTFF1,t14"ppp/ash_ex_r",           -2,2,0.5,asinh(a)+exp(a), "a") \
+/*3341*/ o(FTFF1,t14"ppp/ash_l_r",           0.5,2,0.5,asinh(a)+log(a), "a") \
+/*3342*/ o(FTFF1,t14"ppp/ash_s_r",            -2,2,0.5,asinh(a)+sin(a), "a") \
+/*3343*/ o(FTFF1,t14"ppp/ash_sh_r",           -2,2,0.5,asinh(a)+sinh(a), "a") \
+/*3344*/ o(FTFF1,t14"ppp/ash_t_r",            -2,2,0.5,asinh(a)+tan(a), "a") \
+/*3345*/ o(FTFF1,t14"ppp/ash_th_r",           -2,2,0.5,asinh(a)+tanh(a), "a") \
+/*3346*/ o(FTFF1,t14"ppp/at_at_r",            -2,2,0.5,atan(a)+atan(a), "a") \
+/*3347*/ o(FTFF1,t14"ppp/at_ath_",     -0.75,0.75,0.25,atan(a)+atanh(a), "a") \
+/*3348*/ o(FTFF1,t14"ppp/at_c_r" ,            -2,2,0.5,atan(a)+cos(a), "a") \
+/*3349*/ o(FTFF1,t14"ppp/at_ch_r",            -2,2,0.5,atan(a)+cosh(a), "a") \
+/*3350*/ o(FTFF1,t14"ppp/at_ex_r",            -2,2,0.5,atan(a)+exp(a), "a") \
+/*3351*/ o(FTFF1,t14"ppp/at_l_r" ,           0.5,2,0.5,atan(a)+log(a), "a") \
+/*3352*/ o(FTFF1,t14"ppp/at_s_r" ,            -2,2,0.5,atan(a)+sin(a), "a") \
+/*3353*/ o(FTFF1,t14"ppp/at_sh_r",            -2,2,0.5,atan(a)+sinh(a), "a") \
+/*3354*/ o(FTFF1,t14"ppp/at_t_r" ,            -2,2,0.5,atan(a)+tan(a), "a") \
+/*3355*/ o(FTFF1,t14"ppp/at_th_r",            -2,2,0.5,atan(a)+tanh(a), "a") \
+/*3356*/ o(FTFF1,t14"ppp/ath_ath_",    -0.75,0.75,0.25,atanh(a)+atanh(a), "a") \
+/*3357*/ o(FTFF1,t14"ppp/ath_c_" ,     -0.75,0.75,0.25,atanh(a)+cos(a), "a") \
+/*3358*/ o(FTFF1,t14"ppp/ath_ch_",     -0.75,0.75,0.25,atanh(a)+cosh(a), "a") \
+/*3359*/ o(FTFF1,t14"ppp/ath_ex_",     -0.75,0.75,0.25,atanh(a)+exp(a), "a") \
+/*3360*/ o(FTFF1,t14"ppp/ath_l_r",     0.25,0.75,0.125,atanh(a)+log(a), "a") \
+/*3361*/ o(FTFF1,t14"ppp/ath_s_" ,     -0.75,0.75,0.25,atanh(a)+sin(a), "a") \
+/*3362*/ o(FTFF1,t14"ppp/ath_sh_",     -0.75,0.75,0.25,atanh(a)+sinh(a), "a") \
+/*3363*/ o(FTFF1,t14"ppp/ath_t_r",     -0.75,0.75,0.25,atanh(a)+tan(a), "a") \
+/*3364*/ o(FTFF1,t14"ppp/ath_th_r",    -0.75,0.75,0.25,atanh(a)+tanh(a), "a") \
+/*3365*/ o(FTFF1,t14"ppp/c_c_"   ,            -2,2,0.5,cos(a)+cos(a), "a") \
+/*3366*/ o(FTFF1,t14"ppp/c_ch_"  ,            -2,2,0.5,cos(a)+cosh(a), "a") \
+/*3367*/ o(FTFF1,t14"ppp/c_ex_"  ,            -2,2,0.5,cos(a)+exp(a), "a") \
+/*3368*/ o(FTFF1,t14"ppp/c_l_r"  ,           0.5,2,0.5,cos(a)+log(a), "a") \
+/*3369*/ o(FTFF1,t14"ppp/c_s_"   ,            -2,2,0.5,cos(a)+sin(a), "a") \
+/*3370*/ o(FTFF1,t14"ppp/c_sh_"  ,            -2,2,0.5,cos(a)+sinh(a), "a") \
+/*3371*/ o(FTFF1,t14"ppp/c_t_r"  ,            -2,2,0.5,cos(a)+tan(a), "a") \
+/*3372*/ o(FTFF1,t14"ppp/c_th_r" ,            -2,2,0.5,cos(a)+tanh(a), "a") \
+/*3373*/ o(FTFF1,t14"ppp/ch_ch_" ,            -2,2,0.5,cosh(a)+cosh(a), "a") \
+/*3374*/ o(FTFF1,t14"ppp/ch_ex_" ,            -2,2,0.5,cosh(a)+exp(a), "a") \
+/*3375*/ o(FTFF1,t14"ppp/ch_l_r" ,           0.5,2,0.5,cosh(a)+log(a), "a") \
+/*3376*/ o(FTFF1,t14"ppp/ch_s_"  ,            -2,2,0.5,cosh(a)+sin(a), "a") \
+/*3377*/ o(FTFF1,t14"ppp/ch_sh_" ,            -2,2,0.5,cosh(a)+sinh(a), "a") \
+/*3378*/ o(FTFF1,t14"ppp/ch_t_r" ,            -2,2,0.5,cosh(a)+tan(a), "a") \
+/*3379*/ o(FTFF1,t14"ppp/ch_th_r",            -2,2,0.5,cosh(a)+tanh(a), "a") \
+/*3380*/ o(FTFF1,t14"ppp/ex_ex_" ,            -2,2,0.5,exp(a)+exp(a), "a") \
+/*3381*/ o(FTFF1,t14"ppp/ex_l_r" ,           0.5,2,0.5,exp(a)+log(a), "a") \
+/*3382*/ o(FTFF1,t14"ppp/ex_s_"  ,            -2,2,0.5,exp(a)+sin(a), "a") \
+/*3383*/ o(FTFF1,t14"ppp/ex_sh_" ,            -2,2,0.5,exp(a)+sinh(a), "a") \
+/*3384*/ o(FTFF1,t14"ppp/ex_t_r" ,            -2,2,0.5,exp(a)+tan(a), "a") \
+/*3385*/ o(FTFF1,t14"ppp/ex_th_r",            -2,2,0.5,exp(a)+tanh(a), "a") \
+/*3386*/ o(FTFF1,t14"ppp/l_l_r"  ,           0.5,2,0.5,log(a)+log(a), "a") \
+/*3387*/ o(FTFF1,t14"ppp/l_s_r"  ,           0.5,2,0.5,log(a)+sin(a), "a") \
+/*3388*/ o(FTFF1,t14"ppp/l_sh_r" ,           0.5,2,0.5,log(a)+sinh(a), "a") \
+/*3389*/ o(FTFF1,t14"ppp/l_t_r"  ,           0.5,2,0.5,log(a)+tan(a), "a") \
+/*3390*/ o(FTFF1,t14"ppp/l_th_r" ,           0.5,2,0.5,log(a)+tanh(a), "a") \
+/*3391*/ o(FTFF1,t14"ppp/s_s_"   ,            -2,2,0.5,sin(a)+sin(a), "a") \
+/*3392*/ o(FTFF1,t14"ppp/s_sh_"  ,            -2,2,0.5,sin(a)+sinh(a), "a") \
+/*3393*/ o(FTFF1,t14"ppp/s_t_r"  ,            -2,2,0.5,sin(a)+tan(a), "a") \
+/*3394*/ o(FTFF1,t14"ppp/s_th_r" ,            -2,2,0.5,sin(a)+tanh(a), "a") \
+/*3395*/ o(FTFF1,t14"ppp/sh_sh_" ,            -2,2,0.5,sinh(a)+sinh(a), "a") \
+/*3396*/ o(FTFF1,t14"ppp/sh_t_r" ,            -2,2,0.5,sinh(a)+tan(a), "a") \
+/*3397*/ o(FTFF1,t14"ppp/sh_th_r",            -2,2,0.5,sinh(a)+tanh(a), "a") \
+/*3398*/ o(FTFF1,t14"ppp/t_t_r"  ,            -2,2,0.5,tan(a)+tan(a), "a") \
+/*3399*/ o(FTFF1,t14"ppp/t_th_r" ,            -2,2,0.5,tan(a)+tanh(a), "a") \
+/*3400*/ o(FTFF1,t14"ppp/th_th_r",            -2,2,0.5,tanh(a)+tanh(a), "a") \
+/*3401*/ o(FTFF1,t20"abscos"     ,              -1,1,1,cos(sqrt(cbrt(x^6))) + sqrt(cbrt(x^6)), "x") \
+/*3402*/ o(FTFF1,t20"abscosh"    ,              -1,1,1,cosh(sqrt(cbrt(x^6))) + sqrt(cbrt(x^6)), "x") \
+/*3403*/ o(FTFF1,t20"acoscos"    ,            -1,1,0.1,cos(acos(x)), "x") \
+/*3404*/ o(FTFF1,t20"acoshsinh"  ,        1.7,3.7,0.28,sinh(if(1,acosh(x),0)), "x") \
+/*3405*/ o(FTFF1,t20"add_sin_cos",              -3,3,2,sin(x)+cos(x), "x") \
+/*3406*/ o(FTFF1,t20"add_sin_cosc",             -3,3,2,sin(x)+cos(x)*2.7, "x") \
+/*3407*/ o(FTFF1,t20"add_sinc_cos",             -3,3,2,sin(x)*2.7+cos(x), "x") \
+/*3408*/ o(FTFF1,t20"add_sinc_cosc1",     -2.5,2.5,0.5,sin(x)*5.1+cos(x)*2.7, "x") \
+/*3409*/ o(FTFF1,t20"add_sinc_cosc2",     -2.5,2.5,0.5,sin(x)*5.1+cos(x)*-2.7, "x") \
+/*3410*/ o(FTFF1,t20"add_sinc_cosc3",     -2.5,2.5,0.5,sin(x)*-5.1+cos(x)*2.7, "x") \
+/*3411*/ o(FTFF1,t20"add_sinc_cosc4",     -2.5,2.5,0.5,sin(x)*-5.1+cos(x)*-2.7, "x") \
+/*3412*/ o(FTFF2,t20"addlog"     ,         0.25,1,0.25,log(x)+log(y), "x,y") \
+/*3413*/ o(FTFF1,t20"addsin2cos2",            -1,1,0.5,sin(x)^2 + cos(x)^2, "x") \
+/*3414*/ o(FTFF1,t20"asinhcosh"  ,       -0.7,0.7,0.28,cosh(if(1,asinh(x),0)), "x") \
+/*3415*/ o(FTFF1,t20"asinsin"    ,            -1,1,0.1,sin(asin(x)), "x") \
+/*3416*/ o(FTFF1,t20"cmpeq/pow_imm_negneg",     -5,5,2,pow(x,-3) = -0.015625, "x") \
+/*3417*/ o(FTFF1,t20"cmpeq/pow_imm_negpos",     -5,5,2,pow(x,-2) = 0.0625, "x") \
+/*3418*/ o(FTFF1,t20"cmpeq/pow_imm_posneg",     -6,6,1,pow(x,3) = -125, "x") \
+/*3419*/ o(FTFF1,t20"cmpeq/pow_imm_pospos",     -6,6,1,pow(x,2) = 25, "x") \
+/*3420*/ o(FTFF1,t20"cmpeq/pow_imm_pospos_base", -6,6,1,5.0625 = pow(1.5,x), "x") \
+/*3421*/ o(FTFF2,t20"cmpeq/powpow_imm_base",    -6,6,1,pow(2,x) = pow(-4,y), "x,y") \
+/*3422*/ o(FTFF1,t20"cmpge/pow_imm_negneg",     -5,5,2,pow(x,-3) >= -0.015625, "x") \
+/*3423*/ o(FTFF1,t20"cmpge/pow_imm_negpos",     -5,5,2,pow(x,-2) >= 0.0625, "x") \
+/*3424*/ o(FTFF1,t20"cmpge/pow_imm_posneg",     -6,6,1,pow(x,3) >= -125, "x") \
+/*3425*/ o(FTFF1,t20"cmpge/pow_imm_pospos",     -6,6,1,pow(x,2) >= 25, "x") \
+/*3426*/ o(FTFF1,t20"cmpge/pow_imm_pospos_base", -6,6,1,5.0625 >= pow(1.5,x), "x") \
+/*3427*/ o(FTFF2,t20"cmpge/powpow_imm_base",    -6,6,1,pow(2,x) >= pow(-4,y), "x,y") \
+/*3428*/ o(FTFF1,t20"cmpgt/pow_imm_negneg",     -5,5,2,pow(x,-3) > -0.015625, "x") \
+/*3429*/ o(FTFF1,t20"cmpgt/pow_imm_negpos",     -5,5,2,pow(x,-2) > 0.0625, "x") \
+/*3430*/ o(FTFF1,t20"cmpgt/pow_imm_posneg",     -6,6,1,pow(x,3) > -125, "x") \
+/*3431*/ o(FTFF1,t20"cmpgt/pow_imm_pospos",     -6,6,1,pow(x,2) > 25, "x") \
+/*3432*/ o(FTFF1,t20"cmpgt/pow_imm_pospos_base", -6,6,1,5.0625 > pow(1.5,x), "x") \
+/*3433*/ o(FTFF2,t20"cmpgt/powpow_imm_base",    -6,6,1,pow(2,x) > pow(-4,y), "x,y") \
+/*3434*/ o(FTFF1,t20"cmple/pow_imm_negneg",     -5,5,2,pow(x,-3) <= -0.015625, "x") \
+/*3435*/ o(FTFF1,t20"cmple/pow_imm_negpos",     -5,5,2,pow(x,-2) <= 0.0625, "x") \
+/*3436*/ o(FTFF1,t20"cmple/pow_imm_posneg",     -6,6,1,pow(x,3) <= -125, "x") \
+/*3437*/ o(FTFF1,t20"cmple/pow_imm_pospos",     -6,6,1,pow(x,2) <= 25, "x") \
+/*3438*/ o(FTFF1,t20"cmple/pow_imm_pospos_base", -6,6,1,5.0625 <= pow(1.5,x), "x") \
+/*3439*/ o(FTFF2,t20"cmple/powpow_imm_base",    -6,6,1,pow(2,x) <= pow(-4,y), "x,y") \
+/*3440*/ o(FTFF1,t20"cmplt/pow_imm_negneg",     -5,5,2,pow(x,-3) < -0.015625, "x") \
+/*3441*/ o(FTFF1,t20"cmplt/pow_imm_negpos",     -5,5,2,pow(x,-2) < 0.0625, "x") \
+/*3442*/ o(FTFF1,t20"cmplt/pow_imm_posneg",     -6,6,1,pow(x,3) < -125, "x") \
+/*3443*/ o(FTFF1,t20"cmplt/pow_imm_pospos",     -6,6,1,pow(x,2) < 25, "x") \
+/*3444*/ o(FTFF1,t20"cmplt/pow_imm_pospos_base", -6,6,1,5.0625 < pow(1.5,x), "x") \
+/*3445*/ o(FTFF2,t20"cmplt/powpow_imm_base",    -6,6,1,pow(2,x) < pow(-4,y), "x,y") \
+/*3446*/ o(FTFF1,t20"cmpne/pow_imm_negneg",     -5,5,2,pow(x,-3) != -0.015625, "x") \
+/*3447*/ o(FTFF1,t20"cmpne/pow_imm_negpos",     -5,5,2,pow(x,-2) != 0.0625, "x") \
+/*3448*/ o(FTFF1,t20"cmpne/pow_imm_posneg",     -6,6,1,pow(x,3) != -125, "x") \
+/*3449*/ o(FTFF1,t20"cmpne/pow_imm_pospos",     -6,6,1,pow(x,2) != 25, "x") \
+/*3450*/ o(FTFF1,t20"cmpne/pow_imm_pospos_base", -6,6,1,5.0625 != pow(1.5,x), "x") \
+/*3451*/ o(FTFF2,t20"cmpne/powpow_imm_base",    -6,6,1,pow(2,x) != pow(-4,y), "x,y") \
+/*3452*/ o(FTFF1,t20"cmpzz/pow_imm_negneg",     -5,5,2,0x0001 * (pow(x,-3) < -0.015625) + 0x0002 * (pow(x,-3) <= -0.015625) + 0x0004 * (pow(x,-3) > -0.015625) + 0x0008 * (pow(x,-3) >= -0.015625) + 0x0010 * (pow(x,-3) != -0.015625) + 0x0020 * (pow(x,-3) = -0.015625), "x") \
+/*3453*/ o(FTFF1,t20"cmpzz/pow_imm_negpos",     -5,5,2,0x0001 * (pow(x,-2) < 0.0625) + 0x0002 * (pow(x,-2) <= 0.0625) + 0x0004 * (pow(x,-2) > 0.0625) + 0x0008 * (pow(x,-2) >= 0.0625) + 0x0010 * (pow(x,-2) != 0.0625) + 0x0020 * (pow(x,-2) = 0.0625), "x") \
+/*3454*/ o(FTFF1,t20"cmpzz/pow_imm_posneg",     -6,6,1,0x0001 * (pow(x,3) < -125) + 0x0002 * (pow(x,3) <= -125) + 0x0004 * (pow(x,3) > -125) + 0x0008 * (pow(x,3) >= -125) + 0x0010 * (pow(x,3) != -125) + 0x0020 * (pow(x,3) = -125), "x") \
+/*3455*/ o(FTFF1,t20"cmpzz/pow_imm_pospos",     -6,6,1,0x0001 * (pow(x,2) < 25) + 0x0002 * (pow(x,2) <= 25) + 0x0004 * (pow(x,2) > 25) + 0x0008 * (pow(x,2) >= 25) + 0x0010 * (pow(x,2) != 25) + 0x0020 * (pow(x,2) = 25), "x") \
+/*3456*/ o(FTFF1,t20"cmpzz/pow_imm_pospos_base", -6,6,1,0x0001 * (5.0625 < pow(1.5,x)) + 0x0002 * (5.0625 <= pow(1.5,x)) + 0x0004 * (5.0625 > pow(1.5,x)) + 0x0008 * (5.0625 >= pow(1.5,x)) + 0x0010 * (5.0625 != pow(1.5,x)) + 0x0020 * (5.0625 = pow(1.5,x)), "x") \
+/*3457*/ o(FTFF2,t20"cmpzz/powpow_imm_base",    -6,6,1,0x0001 * (pow(2,x) < pow(-4,y)) + 0x0002 * (pow(2,x) <= pow(-4,y)) + 0x0004 * (pow(2,x) > pow(-4,y)) + 0x0008 * (pow(2,x) >= pow(-4,y)) + 0x0010 * (pow(2,x) != pow(-4,y)) + 0x0020 * (pow(2,x) = pow(-4,y)), "x,y") \
+/*3458*/ o(FTFF2,t20"commutative/hypot",        -2,2,1,hypot(x,y) = hypot(y,x), "x,y") \
+/*3459*/ o(FTFF2,t20"divinv"     ,           -2,4,0.75,1/(x/y), "x,y") \
+/*3460*/ o(FTFF2,t20"expexp_a"   ,            -2,2,0.5,exp(x*2 + y*3), "x,y") \
+/*3461*/ o(FTFF3,t20"expexp_b"   ,            -2,2,0.5,exp(x) * exp(y+z), "x,y,z") \
+/*3462*/ o(FTFF3,t20"expexp_c"   ,            -2,2,0.5,exp(x + y*z), "x,y,z") \
+/*3463*/ o(FTFF1,t20"gehalf"     ,           -1,1,0.25,x>=if(1,0.5,0), "x") \
+/*3464*/ o(FTFF2,t20"if_extract/sin",         -4,4,0.5,if(x, sin(y), sin(x)), "x,y") \
+/*3465*/ o(FTFF2,t20"if_hoist/a_i",           -2,2,0.5,csc(if(x<y, -1.1, 1.2)), "x,y") \
+/*3466*/ o(FTFF2,t20"if_hoist/a_p",           -2,2,0.5,csc((x<y)+-1.1), "x,y") \
+/*3467*/ o(FTFF2,t20"if_hoist/ab_i",          -2,2,0.5,abs(if(x<y, -1.1, 1.2)), "x,y") \
+/*3468*/ o(FTFF2,t20"if_hoist/ab_l",          -2,2,0.5,abs(x<y), "x,y") \
+/*3469*/ o(FTFF2,t20"if_hoist/ab_mc",         -2,2,0.5,abs((x<y)*-1.1), "x,y") \
+/*3470*/ o(FTFF2,t20"if_hoist/ab_mv",         -2,2,0.5,abs((x<y)*x*y*-1.1), "x,y") \
+/*3471*/ o(FTFF2,t20"if_hoist/ab_p",          -2,2,0.5,abs((x<y)+-1.1), "x,y") \
+/*3472*/ o(FTFF2,t20"if_hoist/ac_i",          -2,2,0.5,acos(if(x<y, 0.1, 1)), "x,y") \
+/*3473*/ o(FTFF2,t20"if_hoist/ac_l",          -2,2,0.5,acos(x<y), "x,y") \
+/*3474*/ o(FTFF2,t20"if_hoist/ac_mc",         -2,2,0.5,acos((x<y)*0.1), "x,y") \
+/*3475*/ o(FTFF2,t20"if_hoist/ac_mv",         -2,2,0.5,acos((x<y)*x*y*0.2), "x,y") \
+/*3476*/ o(FTFF2,t20"if_hoist/ac_p",          -2,2,0.5,acos((x<y)+-0.9), "x,y") \
+/*3477*/ o(FTFF2,t20"if_hoist/ach_i",          0,2,0.5,acosh(if(x<y, 1, 1.4)), "x,y") \
+/*3478*/ o(FTFF2,t20"if_hoist/ach_p",         -2,2,0.5,acosh((x<y)+1.4), "x,y") \
+/*3479*/ o(FTFF2,t20"if_hoist/as_i",          -2,2,0.5,asin(if(x<y, -0.3, -0.7)), "x,y") \
+/*3480*/ o(FTFF2,t20"if_hoist/as_l",          -2,2,0.5,asin(x<y), "x,y") \
+/*3481*/ o(FTFF2,t20"if_hoist/as_mc",         -2,2,0.5,asin((x<y)*0.5), "x,y") \
+/*3482*/ o(FTFF2,t20"if_hoist/as_mv",         -2,2,0.5,asin((x<y)*x*y*0.1), "x,y") \
+/*3483*/ o(FTFF2,t20"if_hoist/as_p",          -2,2,0.5,asin((x<y)+0), "x,y") \
+/*3484*/ o(FTFF2,t20"if_hoist/ash_i",         -2,2,0.5,asinh(if(x<y, -1.1, 1.2)), "x,y") \
+/*3485*/ o(FTFF2,t20"if_hoist/ash_l",         -2,2,0.5,asinh(x<y), "x,y") \
+/*3486*/ o(FTFF2,t20"if_hoist/ash_mc",        -2,2,0.5,asinh((x<y)*-1.1), "x,y") \
+/*3487*/ o(FTFF2,t20"if_hoist/ash_mv",        -2,2,0.5,asinh((x<y)*x*y*-1.1), "x,y") \
+/*3488*/ o(FTFF2,t20"if_hoist/ash_p",         -2,2,0.5,asinh((x<y)+-1.1), "x,y") \
+/*3489*/ o(FTFF2,t20"if_hoist/at_i",          -2,2,0.5,atan(if(x<y, -1.1, 1.2)), "x,y") \
+/*3490*/ o(FTFF2,t20"if_hoist/at_l",          -2,2,0.5,atan(x<y), "x,y") \
+/*3491*/ o(FTFF2,t20"if_hoist/at_mc",         -2,2,0.5,atan((x<y)*-1.1), "x,y") \
+/*3492*/ o(FTFF2,t20"if_hoist/at_mv",         -2,2,0.5,atan((x<y)*x*y*-1.1), "x,y") \
+/*3493*/ o(FTFF2,t20"if_hoist/at_p",          -2,2,0.5,atan((x<y)+-1.1), "x,y") \
+/*3494*/ o(FTFF2,t20"if_hoist/ath_i",         -2,2,0.5,atanh(if(x<y, -0.3, 0.7)), "x,y") \
+/*3495*/ o(FTFF2,t20"if_hoist/ath_mc",        -2,2,0.5,atanh((x<y)*0.8), "x,y") \
+/*3496*/ o(FTFF2,t20"if_hoist/ath_mv",        -1,1,0.5,atanh((x<y)*x*y*0.4), "x,y") \
+/*3497*/ o(FTFF2,t20"if_hoist/ath_p",         -2,2,0.5,atanh((x<y)+-0.4), "x,y") \
+/*3498*/ o(FTFF2,t20"if_hoist/c_i",           -2,2,0.5,cos(if(x<y, -1.1, 1.2)), "x,y") \
+/*3499*/ o(FTFF2,t20"if_hoist/c_l",           -2,2,0.5,cos(x<y), "x,y") \
+/*3500*/ o(FTFF2,t20"if_hoist/c_mc",          -2,2,0.5,cos((x<y)*-1.1), "x,y") \
+/*3501*/ o(FTFF2,t20"if_hoist/c_mv",          -2,2,0.5,cos((x<y)*x*y*-1.1), "x,y") \
+/*3502*/ o(FTFF2,t20"if_hoist/c_p",           -2,2,0.5,cos((x<y)+-1.1), "x,y") \
+/*3503*/ o(FTFF2,t20"if_hoist/cb_i",          -2,2,0.5,cbrt(if(x<y, -1.1, 1.2)), "x,y") \
+/*3504*/ o(FTFF2,t20"if_hoist/cb_l",          -2,2,0.5,cbrt(x<y), "x,y") \
+/*3505*/ o(FTFF2,t20"if_hoist/cb_mc",         -2,2,0.5,cbrt((x<y)*-1.1), "x,y") \
+/*3506*/ o(FTFF2,t20"if_hoist/cb_mv",         -2,2,0.5,cbrt((x<y)*x*y*-1.1), "x,y") \
+/*3507*/ o(FTFF2,t20"if_hoist/cb_p",          -2,2,0.5,cbrt((x<y)+-1.1), "x,y") \
+/*3508*/ o(FTFF2,t20"if_hoist/ch_i",          -2,2,0.5,cosh(if(x<y, -1.1, 1.2)), "x,y") \
+/*3509*/ o(FTFF2,t20"if_hoist/ch_l",          -2,2,0.5,cosh(x<y), "x,y") \
+/*3510*/ o(FTFF2,t20"if_hoist/ch_mc",         -2,2,0.5,cosh((x<y)*-1.1), "x,y") \
+/*3511*/ o(FTFF2,t20"if_hoist/ch_mv",         -2,2,0.5,cosh((x<y)*x*y*-1.1), "x,y") \
+/*3512*/ o(FTFF2,t20"if_hoist/ch_p",          -2,2,0.5,cosh((x<y)+-1.1), "x,y") \
+/*3513*/ o(FTFF2,t20"if_hoist/cl_i",          -2,2,0.5,ceil(if(x<y, -1.1, 1.2)), "x,y") \
+/*3514*/ o(FTFF2,t20"if_hoist/cl_l",          -2,2,0.5,ceil(x<y), "x,y") \
+/*3515*/ o(FTFF2,t20"if_hoist/cl_mc",         -2,2,0.5,ceil((x<y)*-1.1), "x,y") \
+/*3516*/ o(FTFF2,t20"if_hoist/cl_mv",         -2,2,0.5,ceil((x<y)*x*y*-1.1), "x,y") \
+/*3517*/ o(FTFF2,t20"if_hoist/cl_p",          -2,2,0.5,ceil((x<y)+-1.1), "x,y") \
+/*3518*/ o(FTFF2,t20"if_hoist/e2_i",          -2,2,0.5,exp2(if(x<y, -1.1, 1.2)), "x,y") \
+/*3519*/ o(FTFF2,t20"if_hoist/e2_l",          -2,2,0.5,exp2(x<y), "x,y") \
+/*3520*/ o(FTFF2,t20"if_hoist/e2_mc",         -2,2,0.5,exp2((x<y)*-1.1), "x,y") \
+/*3521*/ o(FTFF2,t20"if_hoist/e2_mv",         -2,2,0.5,exp2((x<y)*x*y*-1.1), "x,y") \
+/*3522*/ o(FTFF2,t20"if_hoist/e2_p",          -2,2,0.5,exp2((x<y)+-1.1), "x,y") \
+/*3523*/ o(FTFF2,t20"if_hoist/e_i",           -2,2,0.5,sec(if(x<y, -1.1, 1.2)), "x,y") \
+/*3524*/ o(FTFF2,t20"if_hoist/e_l",           -2,2,0.5,sec(x<y), "x,y") \
+/*3525*/ o(FTFF2,t20"if_hoist/e_mc",          -2,2,0.5,sec((x<y)*-1.1), "x,y") \
+/*3526*/ o(FTFF2,t20"if_hoist/e_mv",          -2,2,0.5,sec((x<y)*x*y*-1.1), "x,y") \
+/*3527*/ o(FTFF2,t20"if_hoist/e_p",           -2,2,0.5,sec((x<y)+-1.1), "x,y") \
+/*3528*/ o(FTFF2,t20"if_hoist/ex_i",          -2,2,0.5,exp(if(x<y, -1.1, 1.2)), "x,y") \
+/*3529*/ o(FTFF2,t20"if_hoist/ex_l",          -2,2,0.5,exp(x<y), "x,y") \
+/*3530*/ o(FTFF2,t20"if_hoist/ex_mc",         -2,2,0.5,exp((x<y)*-1.1), "x,y") \
+/*3531*/ o(FTFF2,t20"if_hoist/ex_mv",         -2,2,0.5,exp((x<y)*x*y*-1.1), "x,y") \
+/*3532*/ o(FTFF2,t20"if_hoist/ex_p",          -2,2,0.5,exp((x<y)+-1.1), "x,y") \
+/*3533*/ o(FTFF2,t20"if_hoist/fl_i",          -2,2,0.5,floor(if(x<y, -1.1, 1.2)), "x,y") \
+/*3534*/ o(FTFF2,t20"if_hoist/fl_l",          -2,2,0.5,floor(x<y), "x,y") \
+/*3535*/ o(FTFF2,t20"if_hoist/fl_mc",         -2,2,0.5,floor((x<y)*-1.1), "x,y") \
+/*3536*/ o(FTFF2,t20"if_hoist/fl_mv",         -2,2,0.5,floor((x<y)*x*y*-1.1), "x,y") \
+/*3537*/ o(FTFF2,t20"if_hoist/fl_p",          -2,2,0.5,floor((x<y)+-1.1), "x,y") \
+/*3538*/ o(FTFF2,t20"if_hoist/i_i",           -2,2,0.5,int(if(x<y, -1.1, 1.2)), "x,y") \
+/*3539*/ o(FTFF2,t20"if_hoist/i_l",           -2,2,0.5,int(x<y), "x,y") \
+/*3540*/ o(FTFF2,t20"if_hoist/i_mc",          -2,2,0.5,int((x<y)*-1.1), "x,y") \
+/*3541*/ o(FTFF2,t20"if_hoist/i_mv",          -2,2,0.5,int((x<y)*x*y*-1.1), "x,y") \
+/*3542*/ o(FTFF2,t20"if_hoist/i_p",           -2,2,0.5,int((x<y)+-1.1), "x,y") \
+/*3543*/ o(FTFF2,t20"if_hoist/l2_i",          -2,2,0.5,log2(if(x<y, 1.1, 1.1)), "x,y") \
+/*3544*/ o(FTFF2,t20"if_hoist/l2_p",          -2,2,0.5,log2((x<y)+0.2), "x,y") \
+/*3545*/ o(FTFF2,t20"if_hoist/l_i",           -2,2,0.5,log(if(x<y, 1.1, 0.9)), "x,y") \
+/*3546*/ o(FTFF2,t20"if_hoist/l_p",           -2,2,0.5,log((x<y)+0.8), "x,y") \
+/*3547*/ o(FTFF2,t20"if_hoist/lt_i",          -2,2,0.5,log10(if(x<y, 0.7, 0.1)), "x,y") \
+/*3548*/ o(FTFF2,t20"if_hoist/lt_p",          -2,2,0.5,log10((x<y)+1.4), "x,y") \
+/*3549*/ o(FTFF2,t20"if_hoist/o_i",           -2,2,0.5,cot(if(x<y, -1.1, 1.2)), "x,y") \
+/*3550*/ o(FTFF2,t20"if_hoist/o_p",           -2,2,0.5,cot((x<y)+-1.1), "x,y") \
+/*3551*/ o(FTFF2,t20"if_hoist/s_i",           -2,2,0.5,sin(if(x<y, -1.1, 1.2)), "x,y") \
+/*3552*/ o(FTFF2,t20"if_hoist/s_l",           -2,2,0.5,sin(x<y), "x,y") \
+/*3553*/ o(FTFF2,t20"if_hoist/s_mc",          -2,2,0.5,sin((x<y)*-1.1), "x,y") \
+/*3554*/ o(FTFF2,t20"if_hoist/s_mv",          -2,2,0.5,sin((x<y)*x*y*-1.1), "x,y") \
+/*3555*/ o(FTFF2,t20"if_hoist/s_p",           -2,2,0.5,sin((x<y)+-1.1), "x,y") \
+/*3556*/ o(FTFF2,t20"if_hoist/sh_i",          -2,2,0.5,sinh(if(x<y, -1.1, 1.2)), "x,y") \
+/*3557*/ o(FTFF2,t20"if_hoist/sh_l",          -2,2,0.5,sinh(x<y), "x,y") \
+/*3558*/ o(FTFF2,t20"if_hoist/sh_mc",         -2,2,0.5,sinh((x<y)*-1.1), "x,y") \
+/*3559*/ o(FTFF2,t20"if_hoist/sh_mv",         -2,2,0.5,sinh((x<y)*x*y*-1.1), "x,y") \
+/*3560*/ o(FTFF2,t20"if_hoist/sh_p",          -2,2,0.5,sinh((x<y)+-1.1), "x,y") \
+/*3561*/ o(FTFF2,t20"if_hoist/sq_i",          -2,2,0.5,sqrt(if(x<y, 1.2, 0.3)), "x,y") \
+/*3562*/ o(FTFF2,t20"if_hoist/sq_l",          -2,2,0.5,sqrt(x<y), "x,y") \
+/*3563*/ o(FTFF2,t20"if_hoist/sq_mc",         -2,2,0.5,sqrt((x<y)*0.3), "x,y") \
+/*3564*/ o(FTFF2,t20"if_hoist/sq_mv",         -1,1,0.5,sqrt((x<y)*x*y*0), "x,y") \
+/*3565*/ o(FTFF2,t20"if_hoist/sq_p",          -2,2,0.5,sqrt((x<y)+0.1), "x,y") \
+/*3566*/ o(FTFF2,t20"if_hoist/t_i",           -2,2,0.5,tan(if(x<y, -1.1, 1.2)), "x,y") \
+/*3567*/ o(FTFF2,t20"if_hoist/t_l",           -2,2,0.5,tan(x<y), "x,y") \
+/*3568*/ o(FTFF2,t20"if_hoist/t_mc",          -2,2,0.5,tan((x<y)*-1.1), "x,y") \
+/*3569*/ o(FTFF2,t20"if_hoist/t_mv",          -2,2,0.5,tan((x<y)*x*y*-1.1), "x,y") \
+/*3570*/ o(FTFF2,t20"if_hoist/t_p",           -2,2,0.5,tan((x<y)+-1.1), "x,y") \
+/*3571*/ o(FTFF2,t20"if_hoist/th_i",          -2,2,0.5,tanh(if(x<y, -1.1, 1.2)), "x,y") \
+/*3572*/ o(FTFF2,t20"if_hoist/th_l",          -2,2,0.5,tanh(x<y), "x,y") \
+/*3573*/ o(FTFF2,t20"if_hoist/th_mc",         -2,2,0.5,tanh((x<y)*-1.1), "x,y") \
+/*3574*/ o(FTFF2,t20"if_hoist/th_mv",         -2,2,0.5,tanh((x<y)*x*y*-1.1), "x,y") \
+/*3575*/ o(FTFF2,t20"if_hoist/th_p",          -2,2,0.5,tanh((x<y)+-1.1), "x,y") \
+/*3576*/ o(FTFF2,t20"if_hoist/tr_i",          -2,2,0.5,trunc(if(x<y, -1.1, 1.2)), "x,y") \
+/*3577*/ o(FTFF2,t20"if_hoist/tr_l",          -2,2,0.5,trunc(x<y), "x,y") \
+/*3578*/ o(FTFF2,t20"if_hoist/tr_mc",         -2,2,0.5,trunc((x<y)*-1.1), "x,y") \
+/*3579*/ o(FTFF2,t20"if_hoist/tr_mv",         -2,2,0.5,trunc((x<y)*x*y*-1.1), "x,y") \
+/*3580*/ o(FTFF2,t20"if_hoist/tr_p",          -2,2,0.5,trunc((x<y)+-1.1), "x,y") \
+/*3581*/ o(FTFF2,t20"if_join_add",             3,5,0.5,if(x<4, sin(y),cos(y+1)) + if(x<4, cos(y),sin(y+1)), "x,y") \
+/*3582*/ o(FTFF2,t20"if_join_and",             3,5,0.5,if(x<4, sin(y),cos(y+1)) & if(x<4, cos(y),sin(y+1)), "x,y") \
+/*3583*/ o(FTFF2,t20"if_join_max",             3,5,0.5,max(if(x<4, sin(y),cos(y+1)), if(x<4, cos(y),sin(y+1))), "x,y") \
+/*3584*/ o(FTFF2,t20"if_join_min",             3,5,0.5,min(if(x<4, sin(y),cos(y+1)), if(x<4, cos(y),sin(y+1))), "x,y") \
+/*3585*/ o(FTFF2,t20"if_join_mul",             3,5,0.5,if(x<4, sin(y),cos(y+1)) * if(x<4, cos(y),sin(y+1)), "x,y") \
+/*3586*/ o(FTFF2,t20"if_join_or" ,             3,5,0.5,if(x<4, sin(y),cos(y+1)) | if(x<4, cos(y),sin(y+1)), "x,y") \
+/*3587*/ o(FTFF3,t20"ifabsnot"   ,            -1,1,0.5,if(!(sin(x)+1.2), y,z), "x,y,z") \
+/*3588*/ o(FTFF3,t20"ifconst"    ,            -1,1,0.5,if(1, x,y) + if(0,z,y), "x,y,z") \
+/*3589*/ o(FTFF4,t20"ififconst"  ,               0,1,1,if(if(x,1,y),z,w) + if(if(w,z,0),x,y), "w,x,y,z") \
+/*3590*/ o(FTFF3,t20"ifnot"      ,               0,1,1,if(!x, y,z), "x,y,z") \
+/*3591*/ o(FTFF1,t20"lthalf"     ,           -1,1,0.25,x<if(1,0.5,0), "x") \
+/*3592*/ o(FTFF2,t20"muland2"    ,            -1,1,0.5,!!x * !!y, "x,y") \
+/*3593*/ o(FTFF3,t20"muland2plus",            -1,1,0.5,!!x * !!y * z, "x,y,z") \
+/*3594*/ o(FTFF3,t20"muland3"    ,            -1,1,0.5,!!x * !!y * !!z, "x,y,z") \
+/*3595*/ o(FTFF2,t20"mulandlt"   ,            -1,1,0.5,!!x * (y<0), "x,y") \
+/*3596*/ o(FTFF2,t20"mulimmlog"  ,         0.25,1,0.25,log(if(1,5,0)*x*y), "x,y") \
+/*3597*/ o(FTFF2,t20"mulnor2"    ,            -1,1,0.5,!x * !y, "x,y") \
+/*3598*/ o(FTFF3,t20"mulnor2plus",            -1,1,0.5,!x * !y * z, "x,y,z") \
+/*3599*/ o(FTFF3,t20"mulnor3"    ,            -1,1,0.5,!x * !y * !z, "x,y,z") \
+/*3600*/ o(FTFF1,t20"negceil"    ,              -1,1,1,ceil(x*(abs(x)-abs(x)-1)), "x") \
+/*3601*/ o(FTFF1,t20"negcos"     ,              -1,1,1,cos(x*if(1,-1,0)), "x") \
+/*3602*/ o(FTFF1,t20"negcosh"    ,              -1,1,1,cosh(x*if(1,-1,0)), "x") \
+/*3603*/ o(FTFF1,t20"negfloor"   ,              -1,1,1,floor(x*(abs(x)-abs(x)-1)), "x") \
+/*3604*/ o(FTFF1,t20"negsin"     ,              -1,1,1,sin(x*if(1,-1,0)), "x") \
+/*3605*/ o(FTFF1,t20"negsinh"    ,              -1,1,1,sinh(x*if(1,-1,0)), "x") \
+/*3606*/ o(FTFF1,t20"posnot"     ,            -1,1,0.5,!(sin(x) + 1.2), "x") \
+/*3607*/ o(FTFF1,t20"posnotnot"  ,            -1,1,0.5,!!(sin(x) + 1.2), "x") \
+/*3608*/ o(FTFF1,t20"powimmaddimmlog",     0.25,1,0.25,pow(5, log(x)+1), "x") \
+/*3609*/ o(FTFF1,t20"powimmlog"  ,         0.25,2,0.25,pow(3, log(x)) + pow(5, log(x)*sin(x)), "x") \
+/*3610*/ o(FTFF2,t20"powmulimm_fnen",           -3,3,2,((-5.1)*x*y)^(-8), "x,y") \
+/*3611*/ o(FTFF2,t20"powmulimm_fnep",           -3,3,1,((-5.1)*x*y)^(4), "x,y") \
+/*3612*/ o(FTFF1,t20"powmulimm_fnfn",        -3,-1,0.5,((-5.1)*x)^(-7.1), "x") \
+/*3613*/ o(FTFT2,t20"powmulimm_fnfp",           -3,3,1,((-1.1)*x*y)^2.1, "x,y") \
+/*3614*/ o(FTFT2,t20"powmulimm_fpfp",           -3,3,1,(1.1*x*y)^2.1, "x,y") \
+/*3615*/ o(FTFF1,t20"sub1cos2"   ,            -1,1,0.5,1-cos(x)^2, "x") \
+/*3616*/ o(FTFF1,t20"sub1sin2"   ,            -1,1,0.5,1-sin(x)^2, "x") \
+/*3617*/ o(FTFF1,t20"trig_modulo",           -3,3,0.25,y := x*pi; p23 := pi*2/3; p52 := pi*5/2; p62 := pi*6/2; p72 := pi*7/2; cos(y+pi) + cos(y+p23) + cos(y+p52) + cos(y+p62) + cos(y+p72) + sin(y+pi) + sin(y+p23) + sin(y+p52) + sin(y+p62) + sin(y+p72) + cos(y-pi) + cos(y-p23) + cos(y-p52) + cos(y-p62) + cos(y-p72) + sin(y-pi) + sin(y-p23) + sin(y-p52) + sin(y-p62) + sin(y-p72), "x") \
+/*3618*/ o(FTFF1,t20"trunc_from_if0",        -3,3,0.25,if(x>0,  floor(x),ceil(x)), "x") \
+/*3619*/ o(FTFF1,t20"trunc_from_if1",        -3,3,0.25,if(x>=0, floor(x),ceil(x)), "x") \
+/*3620*/ o(FTFF1,t20"trunc_from_if2",        -3,3,0.25,if(x<0,  ceil(x),floor(x)), "x") \
+/*3621*/ o(FTFF1,t20"trunc_from_if3",        -3,3,0.25,if(x<=0, ceil(x),floor(x)), "x") \
+/*3622*/ o(FTFF1,t20"trunc_from_if4",        -3,3,0.25,if(x>0,  ceil(x),floor(x)), "x") \
+/*3623*/ o(FTFF1,t20"trunc_from_if5",        -3,3,0.25,if(x>=0, ceil(x),floor(x)), "x") \
+/*3624*/ o(FTFF1,t20"trunc_from_if6",        -3,3,0.25,if(x<0,  floor(x),ceil(x)), "x") \
+/*3625*/ o(FTFF1,t20"trunc_from_if7",        -3,3,0.25,if(x<=0, floor(x),ceil(x)), "x") \
+/*3626*/ o(FTFF1,t50"5"          ,       -0.7,0.7,0.28,sub(sin(x)+csc(x),cos(x)), "x") \
+/*3627*/ o(FTFF2,t50"8"          ,              -9,9,1,atan2(-x,-y) + 10*atan2(-x,y) + 20*atan2(x,-y) + 30*atan2(x,y), "x,y") \
+/*3628*/ o(FTFF1,t50"10"         ,              1,10,1,1/abs(x)<1, "x") \
+/*3629*/ o(FTFF1,t50"11"         ,     1e25,10e25,1e25,exp(x/5e+25), "x") \
+/*3630*/ o(FTFF2,t50"42"         ,            -3,3,.25,sqrt(x*x) + 1.5*((y*y)^.25) + hypot(x,y), "x,y") \
+/*3631*/ o(FTFF1,t50"51"         ,          -100,-1,.5,log(-x), "x") \
+/*3632*/ o(FTFF1,t50"57"         ,         .05,1.0,.01,cosh(asinh(x)), "x") \
+/*3633*/ o(FTFF2,t50"59"         ,            -2,2,1.2,cosh(x^2) + tanh(y^2), "x,y") \
+/*3634*/ o(FTFF2,t50"62"         ,        -5.5,5.5,0.5,int(0.5+x)+10*trunc(0.5+y), "x,y") \
+/*3635*/ o(FTFF1,t99"1"          ,      -1000,1000,.25,x*4/2 + (1+(2+3)) + x*x+x+1+2+3*4+5*6*\n7-8*9, "x") \
+/*3636*/ o(FTFF1,t99"2"          ,       -1000,1000,.1,2 * x+ sin ( x ) / .5 + 2-sin(x)*sin(x), "x") \
+/*3637*/ o(FTFF3,t99"3"          ,             -7,7,.5,(x=y & y=x)+  1+2-3.1*4e2/.5 + x*x+y*y+z*z  + (x&x) + (y|y), "x,y,z") \
+/*3638*/ o(FTFF2,t99"4"          ,           -10,10,.5,( ((( ( x-y) -( ((y) *2) -3)) )* 4))+sin(x)*cos(y)-cos(x)*sin(y), "x,y") \
+/*3639*/ o(FTFF2,t99"5"          ,            .1,8,.15,__A5_x08^o__5_0AB_, "__A5_x08,o__5_0AB_") \
+/*3640*/ o(FTFF1,t99"7"          ,          -10,10,.01,cos(x)*sin(1-x)*(1-cos(x/2)*sin(x*5)), "x") \
+/*3641*/ o(FTFF2,t99"8"          ,             -8,8,.2,atan2(x,y)+max(x,y), "x,y") \
+/*3642*/ o(FTFF3,t99"9"          ,             1,15,.7,1.5+x*y-2+4/8+z+z+z+z+x/(y*z), "x,y,z") \
+/*3643*/ o(FTFF3,t99"10"         ,              1,4,.3,1+sin(cos(max(1+2+3+4+5, x+y+z)))+2, "x,y,z") \
+/*3644*/ o(FTFF3,t99"11"         ,             1,19,.8,-(-(-(-(-x))-x))+y*1+log(1.1^z), "x,y,z") \
+/*3645*/ o(FTFF1,t99"12"         ,         1.5,2000,.5,1/log(10^((3-2)/log(x))), "x") \
+/*3646*/ o(FTFF2,t99"13"         ,           -30,30,.5,x^3 * x^4 + y^3 * y^5, "x,y") \
+/*3647*/ o(FTFF1,t99"14"         ,           -50,50,.1,x*pi + sin(2*pi) + CONST, "x") \
+/*3648*/ o(FTFF2,t99"15"         ,           1.1,6,.07,x^y/log(y) + log(x)/log(y) + log(x^y), "x,y") \
+/*3649*/ o(FTFF2,t99"18"         ,             1,17,.2,- ( - ( - ( - 5 ) ) ) * -x^ -y^-2, "x,y") \
+/*3650*/ o(FTFF2,t99"22"         ,             -4,4,.1,3.5doubled + 10*x tripled - sin(y)doubled + 100*(x doubled-y tripled)doubled + 5/2doubled + 1.1^x doubled + 1.1doubled^x doubled, "x,y") \
+/*3651*/ o(FTFF1,t99"23"         ,       -1000,1000,.1,(x/(2*acos(0)))*180, "x") \
+/*3652*/ o(FTFF3,t99"25"         ,              1,3,.2,a^b^c + a^-2 * (-b^2) + (-b^-c), "a,b,c") \
+/*3653*/ o(TTFF1,t99"26_deg"     ,         -100,100,.1,sin(x) + cos(x*1.5) + asin(x/110) + acos(x/120), "x") \
+/*3654*/ o(FTFF2,t99"27"         ,          .1,.9,.025,abs(x)+acos(x)+asin(x)+atan(x)+atan2(x,y)+ceil(x)+cos(x)+cosh(x)+cot(x)+csc(x) + pow(x,y), "x,y") \
+/*3655*/ o(FTFF2,t99"28"         ,          .1,.9,.025,exp(x)+floor(x)+int(x)+log(x)+log10(x)+max(x,y)+min(x,y)+sec(x)+sin(x)+sinh(x)+sqrt(x)+tan(x)+tanh(x)+ceil(y)+trunc(y), "x,y") \
+/*3656*/ o(FTFF2,t99"30"         ,              3,10,1,x - y*1 + (x%y) + x / (y^1.1) + 2^3 + 5%3 + x^(y^0) + x^0.5, "x,y") \
+/*3657*/ o(FTFF3,t99"31"         ,            .1,4,.35,x - (y*(y*(y*-1))*1) + log(x*exp(1.0)^y) - log(x^y) + exp(1.0)^log(x+6) + 10^(log(x+6)/log(y+6)*log(z+6)/log(10)) - exp(1.0)^(log(x+6)*y) - 5^(log(x+7)/log(5)) + (x*z+17)^3 * (x*z+17)^2 / (x*z+17)^4, "x,y,z") \
+/*3658*/ o(FTFF3,t99"32"         ,             1,2,.05,x+y/y-min(3,4)-x-max(4,3)+max(3,4)-min(4,3)+0+(z*1)+(x-2+2)+(x*0.5*2)+y*0+min(min(min(4.0,x),1.0),min(x,min(min(y,4.0),z)))+max(max(max(4.0,x),1.0),max(x,max(max(y,4.0),z)))+(abs(1)+acos(1.0)+asin(1.0)+atan(1.0)+ceil(1.1)+cos(0.0)+cosh(0.0)+floor(1.1)+log(1.0)+sin(0.0)+sinh(0.0)+tan(1.0)+tanh(1.0)+atan2(1.0,1.0))+(x-(y-z))+(x+y) + (x*y)+max(x,max(x,max(x,max(x,x))))*-1.0+(z-z)+1/sin(x/5) + 1/cos(y/5) + 1/tan(z/5)+log10(cot(z/5) + csc(y/5) + sec(x/5))+log(30+x)*log(40+y)/log(50+z)+sin(x/(180/pi))+asin(x/10)*(180/pi)+floor(-x) + 1/ceil(x)+sqrt(5 * 0.2)+(-x+-x+-x+-x+-x+-x), "x,y,z") \
+/*3659*/ o(FTFF2,t99"33"         ,             -2,2,.1,sin(sqrt(10-x*x+y*y))+cos(sqrt(15-x*x-y*y))+sin(x*x+y*y), "x,y") \
+/*3660*/ o(FTFF1,t99"37"         ,           -10,10,.1,5 + 7.5*8 / 3 - 2^4*2 + 7%2+4 + x, "x") \
+/*3661*/ o(FTFF3,t99"38"         ,           -.9,.9,.1,asinh(x) + 1.5*acosh(y+3) + 2.5*atanh(z), "x,y,z") \
+/*3662*/ o(FTFF3,t99"39"         ,        -1.3,1.3,.15,sin(x+cos(y*1.5))-cos(x+sin(y*1.5))+z*z*z*sin(z*z*z-x*x-y*y)- cos(y*1.5)*sin(x+cos(y*1.5))+x*y*z+x*y*2.5+x*y*z*cos(x)+x*y*cos(x)+x*z*cos(x)+ y*z*2.5+(x*y*z*cos(x)-x*y*z-y*cos(x)-x*z*y+x*y+x*z-cos(x)*x), "x,y,z") \
+/*3663*/ o(FTFF3,t99"40"         ,       -1.3,1.3,.075,(x+x+x+x+x+x+x+x+x+x+x+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z)* (x+x+x+x+x+x+x+x+x+x+x+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z)+ 2*(x+x+x+x+x+x+x+x+x+x+x+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z)- x*y*(x+x+x+x+x+x+x+x+x+x+x+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z)+ x*(x+x+x+x+x+x+x+x+x+x+x+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z+y+z), "x,y,z") \
+/*3664*/ o(FTFF3,t99"41"         ,            -2,2,.15,x*3+x*y+x*z+x*sin(y*z) - (sin(x)+cos(y))*4 + (sin(x)+cos(y))*x + (sin(x)+cos(y))*y + (sin(x)+cos(y))*z, "x,y,z") \
+/*3665*/ o(FTFF1,t99"43"         ,        -100,100,.03,log(x*x)+abs(exp(abs(x)+1)), "x") \
+/*3666*/ o(FTFF1,t99"44"         ,      0.125,100,.125,(x^2)^(1/8) + 1.1*(x^3)^(1/7) + 1.2*(x^4)^(1/6) + 1.3*(x^5)^(1/5) + 1.4*(x^6)^(1/6) + 1.5*(x^7)^(1/4) + 1.6*(x^8)^(1/3) + 1.7*(x^9)^(1/2) + 1.8*(sqrt(abs(-sqrt(x))^3)), "x") \
+/*3667*/ o(FTFF1,t99"45"         ,         -10,10,.025,(x^2)^(1/7) + 1.1*(x^4)^(1/5) + 1.2*(x^6)^(1/3), "x") \
+/*3668*/ o(FTFF2,t99"46"         ,          -.9,.9,.15,abs(floor(acos(x)+4)) + 1.1*abs(floor(acos(y)+1.5)) + (acos(x) < (acos(y)-10)) + 1.2*max(-4, acos(x)) + 1.3*min(9, acos(x)-9), "x,y") \
+/*3669*/ o(FTFF2,t99"47"         ,             -3,3,.1,1.25*(exp(x)+exp(-x)) + 1.5*(exp(y)-exp(-y)) + 1.75*((exp(-x)+exp(x))/2) + 2.0*((exp(-x)-exp(x))/2) + 2.25*(cosh(y)+sinh(y)), "x,y") \
+/*3670*/ o(FTFF1,t99"48"         ,         2,1e9,1.2e7,sinh((log(x)/5+1)*5) + 1.2*cosh((log(x)/log(2)+1)*log(2)) + !(x | !(x/4)), "x") \
+/*3671*/ o(FTFF1,t99"49"         ,        -100,100,.05,atan2(0, x) + (-4*(x-100))^3.3, "x") \
+/*3672*/ o(FTFF1,t99"52"         ,           -10,10,.5,x + (1.0+2.0+3.0+4.0-5.0-6.0-7.0-8.0)/3.0 + 4.0*(1.0+sin(2.0)+cos(4.0*5.0+6.0)/2.0) + cos(0.5)*tan(0.6+0.2) - 1.1/log(2.1)*sqrt(3.3) + 2^3, "x") \
+/*3673*/ o(FTFF2,t99"53"         ,            0,10,0.5,(x&y) + 4*(int(x/10)|int(y/10)) + 8*((-!-!-x)+(!-!-!y)) + 16*(-------x + !!!!!!!y), "x,y") \
+/*3674*/ o(FTFF2,t99"54"         ,          -10,100,.5,(x<y)+(x<=y)+(x>y)+(x>=y)+ (x=y)+(x!=y)+(x&y)+(x|y)+ (!x)+(!!x)+ !((x<y)&(x<3))+ !!(!(x>y)|(x>3)), "x,y") \
+/*3675*/ o(FTFF2,t99"55"         ,            1,100,.5,(x^1.2 < 0) + (y^2.5 < 0) + 2*(x*x<0) + 3*(y^3<0) + 4*(x^4<0), "x,y") \
+/*3676*/ o(FTFF1,t99"56"         ,         .25,100,.25,1.75e21%x, "x") \
+/*3677*/ o(FTFF1,t99"59"         ,            -3,3,0.2,(cos(x) < sin(x)) + (cos(x)-sin(x)) + sub(sinh(x)-cosh(x), sinh(x)/cosh(x)) + sqrt(cos(x)^2+sin(x)^2), "x") \
+/*3678*/ o(FTFF3,t99"60"         ,            -3,3,0.5,x^2+y + (z-x^2) + (x^2-y^2) + (x^2+y^2+z) + x*y + if(x<y, 1, 2) + if(x<z, y^2-x, x^2+z) + x*y*z + (x*y)^2, "x,y,z") \
+/*3679*/ o(FTFF1,t99"absneg"     ,           -10,10,.1,abs(-4 + sin(x)), "x") \
+/*3680*/ o(FFFF2,t10"invsincostan",      -0.7,0.7,0.28,x/sin(y) + x/cos(y) + x/tan(y) + x/csc(y) + x/sec(y) + x/cot(y) + 1/sin(y) + 1/cos(y) + 1/tan(y) + 1/csc(y) + 1/sec(y) + 1/cot(y), "x,y") \
+/*3681*/ o(FFFF2,t20"round_plusint/c_ac", -1.5,1.5,0.5,ceil(x+abs(ceil(y))), "x,y") \
+/*3682*/ o(FFFF2,t20"round_plusint/c_af", -1.5,1.5,0.5,ceil(x+abs(floor(y))), "x,y") \
+/*3683*/ o(FFFF2,t20"round_plusint/c_ai", -1.5,1.5,0.5,ceil(x+abs(int(y))), "x,y") \
+/*3684*/ o(FFFF2,t20"round_plusint/c_an", -1.5,1.5,0.5,ceil(x+abs(y)), "x,y") \
+/*3685*/ o(FFFF2,t20"round_plusint/c_at", -1.5,1.5,0.5,ceil(x+abs(trunc(y))), "x,y") \
+/*3686*/ o(FFFF2,t20"round_plusint/c_c",  -1.5,1.5,0.5,ceil(x+ceil(y)), "x,y") \
+/*3687*/ o(FFFF2,t20"round_plusint/c_f",  -1.5,1.5,0.5,ceil(x+floor(y)), "x,y") \
+/*3688*/ o(FFFF2,t20"round_plusint/c_i",  -1.5,1.5,0.5,ceil(x+int(y)), "x,y") \
+/*3689*/ o(FFFF2,t20"round_plusint/c_l",  -1.5,1.5,0.5,ceil(x+(x<y)), "x,y") \
+/*3690*/ o(FFFF2,t20"round_plusint/c_n",  -1.5,1.5,0.5,ceil(x+-(abs(y)+1)), "x,y") \
+/*3691*/ o(FFFF2,t20"round_plusint/c_p",  -1.5,1.5,0.5,ceil(x+(x<y)), "x,y") \
+/*3692*/ o(FFFF2,t20"round_plusint/c_t",  -1.5,1.5,0.5,ceil(x+trunc(y)), "x,y") \
+/*3693*/ o(FFFF2,t20"round_plusint/f_ac", -1.5,1.5,0.5,floor(x+abs(ceil(y))), "x,y") \
+/*3694*/ o(FFFF2,t20"round_plusint/f_af", -1.5,1.5,0.5,floor(x+abs(floor(y))), "x,y") \
+/*3695*/ o(FFFF2,t20"round_plusint/f_ai", -1.5,1.5,0.5,floor(x+abs(int(y))), "x,y") \
+/*3696*/ o(FFFF2,t20"round_plusint/f_an", -1.5,1.5,0.5,floor(x+abs(y)), "x,y") \
+/*3697*/ o(FFFF2,t20"round_plusint/f_at", -1.5,1.5,0.5,floor(x+abs(trunc(y))), "x,y") \
+/*3698*/ o(FFFF2,t20"round_plusint/f_c",  -1.5,1.5,0.5,floor(x+ceil(y)), "x,y") \
+/*3699*/ o(FFFF2,t20"round_plusint/f_f",  -1.5,1.5,0.5,floor(x+floor(y)), "x,y") \
+/*3700*/ o(FFFF2,t20"round_plusint/f_i",  -1.5,1.5,0.5,floor(x+int(y)), "x,y") \
+/*3701*/ o(FFFF2,t20"round_plusint/f_l",  -1.5,1.5,0.5,floor(x+(x<y)), "x,y") \
+/*3702*/ o(FFFF2,t20"round_plusint/f_n",  -1.5,1.5,0.5,floor(x+-(abs(y)+1)), "x,y") \
+/*3703*/ o(FFFF2,t20"round_plusint/f_p",  -1.5,1.5,0.5,floor(x+(x<y)), "x,y") \
+/*3704*/ o(FFFF2,t20"round_plusint/f_t",  -1.5,1.5,0.5,floor(x+trunc(y)), "x,y") \
+/*3705*/ o(FFFF2,t20"round_plusint/i_ac", -1.5,1.5,0.5,int(x+abs(ceil(y))), "x,y") \
+/*3706*/ o(FFFF2,t20"round_plusint/i_af", -1.5,1.5,0.5,int(x+abs(floor(y))), "x,y") \
+/*3707*/ o(FFFF2,t20"round_plusint/i_ai", -1.5,1.5,0.5,int(x+abs(int(y))), "x,y") \
+/*3708*/ o(FFFF2,t20"round_plusint/i_an", -1.5,1.5,0.5,int(x+abs(y)), "x,y") \
+/*3709*/ o(FFFF2,t20"round_plusint/i_at", -1.5,1.5,0.5,int(x+abs(trunc(y))), "x,y") \
+/*3710*/ o(FFFF2,t20"round_plusint/i_c",  -1.5,1.5,0.5,int(x+ceil(y)), "x,y") \
+/*3711*/ o(FFFF2,t20"round_plusint/i_f",  -1.5,1.5,0.5,int(x+floor(y)), "x,y") \
+/*3712*/ o(FFFF2,t20"round_plusint/i_i",  -1.5,1.5,0.5,int(x+int(y)), "x,y") \
+/*3713*/ o(FFFF2,t20"round_plusint/i_l",  -1.5,1.5,0.5,int(x+(x<y)), "x,y") \
+/*3714*/ o(FFFF2,t20"round_plusint/i_n",  -1.5,1.5,0.5,int(x+-(abs(y)+1)), "x,y") \
+/*3715*/ o(FFFF2,t20"round_plusint/i_p",  -1.5,1.5,0.5,int(x+(x<y)), "x,y") \
+/*3716*/ o(FFFF2,t20"round_plusint/i_t",  -1.5,1.5,0.5,int(x+trunc(y)), "x,y") \
+/*3717*/ o(FFFF2,t20"round_plusint/t_ac", -1.5,1.5,0.5,trunc(x+abs(ceil(y))), "x,y") \
+/*3718*/ o(FFFF2,t20"round_plusint/t_af", -1.5,1.5,0.5,trunc(x+abs(floor(y))), "x,y") \
+/*3719*/ o(FFFF2,t20"round_plusint/t_ai", -1.5,1.5,0.5,trunc(x+abs(int(y))), "x,y") \
+/*3720*/ o(FFFF2,t20"round_plusint/t_an", -1.5,1.5,0.5,trunc(x+abs(y)), "x,y") \
+/*3721*/ o(FFFF2,t20"round_plusint/t_at", -1.5,1.5,0.5,trunc(x+abs(trunc(y))), "x,y") \
+/*3722*/ o(FFFF2,t20"round_plusint/t_c",  -1.5,1.5,0.5,trunc(x+ceil(y)), "x,y") \
+/*3723*/ o(FFFF2,t20"round_plusint/t_f",  -1.5,1.5,0.5,trunc(x+floor(y)), "x,y") \
+/*3724*/ o(FFFF2,t20"round_plusint/t_i",  -1.5,1.5,0.5,trunc(x+int(y)), "x,y") \
+/*3725*/ o(FFFF2,t20"round_plusint/t_l",  -1.5,1.5,0.5,trunc(x+(x<y)), "x,y") \
+/*3726*/ o(FFFF2,t20"round_plusint/t_n",  -1.5,1.5,0.5,trunc(x+-(abs(y)+1)), "x,y") \
+/*3727*/ o(FFFF2,t20"round_plusint/t_p",  -1.5,1.5,0.5,trunc(x+(x<y)), "x,y") \
+/*3728*/ o(FFFF2,t20"round_plusint/t_t",  -1.5,1.5,0.5,trunc(x+trunc(y)), "x,y") \
+/*3729*/ o(FFFF2,t01"modm"       ,          -11,11,0.3,x%z, "x,z") \
+/*3730*/ o(FFFF1,t02"abs_m"      ,        -400,400,0.5,abs(x), "x") \
+/*3731*/ o(FFFF1,t02"acoshm"     ,           1,400,0.1,acosh(x), "x") \
+/*3732*/ o(TFFF1,t02"acoshm_deg" ,           1,400,0.1,acosh(x), "x") \
+/*3733*/ o(FFFF1,t02"acosm"      ,           -1,1,0.01,acos(x), "x") \
+/*3734*/ o(TFFF1,t02"acosm_deg"  ,           -1,1,0.01,acos(x), "x") \
+/*3735*/ o(FFFF1,t02"asinhm"     ,           -1,1,0.01,asinh(x), "x") \
+/*3736*/ o(TFFF1,t02"asinhm_deg" ,           -1,1,0.01,asinh(x), "x") \
+/*3737*/ o(FFFF1,t02"asinm"      ,           -1,1,0.01,asin(x), "x") \
+/*3738*/ o(TFFF1,t02"asinm_deg"  ,           -1,1,0.01,asin(x), "x") \
+/*3739*/ o(FFFF2,t02"atan2m"     ,           -4,4,0.15,atan2(x,y), "x,y") \
+/*3740*/ o(TFFF2,t02"atan2m_deg" ,           -4,4,0.15,atan2(x,y), "x,y") \
+/*3741*/ o(FFFF1,t02"atanhm"     ,     -0.99,0.99,0.01,atanh(x), "x") \
+/*3742*/ o(FFFF1,t02"atanm"      ,        -400,400,0.1,atan(x), "x") \
+/*3743*/ o(TFFF1,t02"atanm_deg"  ,        -400,400,0.1,atan(x), "x") \
+/*3744*/ o(FFFF1,t02"cbrtm"      ,   -50000,50000,1000,cbrt(x), "x") \
+/*3745*/ o(FFFF1,t02"ceilm"      ,         -10,10,0.25,ceil(x), "x") \
+/*3746*/ o(FFFF1,t02"coshm"      ,        -140,140,0.1,cosh(x), "x") \
+/*3747*/ o(TFFF1,t02"coshm_deg"  ,        -140,140,0.1,cosh(x), "x") \
+/*3748*/ o(FFFF1,t02"cosm"       ,      -40000,40000,5,cos(x), "x") \
+/*3749*/ o(TFFF1,t02"cosm_deg"   ,      -40000,40000,5,cos(x), "x") \
+/*3750*/ o(FFFF1,t02"exp2m"      ,         -90,90,0.02,exp2(x), "x") \
+/*3751*/ o(FFFF1,t02"expm"       ,         -90,90,0.02,exp(x), "x") \
+/*3752*/ o(FFFF1,t02"floorm"     ,         -10,10,0.25,floor(x), "x") \
+/*3753*/ o(FFFF2,t02"hypotm"     ,           -4,4,0.05,hypot(x,y), "x,y") \
+/*3754*/ o(FFFF1,t02"log2m"      ,        1e-6,400,0.1,log2(x), "x") \
+/*3755*/ o(FFFF1,t02"log10m"     ,        1e-6,400,0.1,log10(x), "x") \
+/*3756*/ o(FFFF1,t02"logm"       ,        1e-6,400,0.1,log(x), "x") \
+/*3757*/ o(FFFF2,t02"pow_negm"   ,              1,20,1,pow(-x*0.25,y), "x,y") \
+/*3758*/ o(FFFF2,t02"pow_posm"   ,         0.01,4,0.05,pow(x,y), "x,y") \
+/*3759*/ o(FFFF1,t02"sinhm"      ,        -400,400,0.1,sinh(x), "x") \
+/*3760*/ o(TFFF1,t02"sinhm_deg"  ,        -400,400,0.1,sinh(x), "x") \
+/*3761*/ o(FFFF1,t02"sinm"       ,      -40000,40000,5,sin(x), "x") \
+/*3762*/ o(TFFF1,t02"sinm_deg"   ,      -40000,40000,5,sin(x), "x") \
+/*3763*/ o(FFFF1,t02"sqrtm"      ,       0,100000,1000,sqrt(x), "x") \
+/*3764*/ o(FFFF1,t02"tanhm"      ,      -40000,40000,5,tanh(x), "x") \
+/*3765*/ o(TFFF1,t02"tanhm_deg"  ,      -40000,40000,5,tanh(x), "x") \
+/*3766*/ o(FFFF1,t02"tanm"       ,       -1.3,1.3,0.05,tan(x), "x") \
+/*3767*/ o(TFFF1,t02"tanm_deg"   ,         -89,89,0.25,tan(x), "x") \
+/*3768*/ o(FFFF1,t03"e_mpfr"     ,               0,1,1,x*0+ naturalnumber, "x") \
+/*3769*/ o(FFFF1,t03"l2_mpfr"    ,               0,1,1,x*0+ logtwo, "x") \
+/*3770*/ o(FFFF1,t03"l10_mpfr"   ,               0,1,1,x*0+ logten, "x") \
+/*3771*/ o(FFFF1,t03"pi_mpfr"    ,               0,1,1,x*0+ pi, "x") \
+/*3772*/ o(FFFF1,t03"l2_f"       ,               0,1,1,x*0+ logtwo, "x") \
+/*3773*/ o(FFFF2,t01"cmpge_cd"   ,     -1.75,1.75,0.25,x>=y, "x,y") \
+/*3774*/ o(FFFF2,t01"cmpgt_cd"   ,     -1.75,1.75,0.25,x>y, "x,y") \
+/*3775*/ o(FFFF2,t01"cmple_cd"   ,     -1.75,1.75,0.25,x<=y, "x,y") \
+/*3776*/ o(FFFF2,t01"cmplt_cd"   ,     -1.75,1.75,0.25,x<y, "x,y") \
+/*3777*/ o(FFFF3,t01"divmul_cd"  ,      -1.25,1.25,0.5,x*y*x*x/z*(x-0.25), "x,y,z") \
+/*3778*/ o(FFFF1,t02"arg"        ,        1e-6,4000,10,arg(x), "x") \
+/*3779*/ o(FFFF1,t02"conj"       ,        1e-6,4000,10,conj(x), "x") \
+/*3780*/ o(FFFF1,t02"imag"       ,        1e-6,4000,10,imag(x), "x") \
+/*3781*/ o(FFFF1,t02"log_cd"     ,        -30.1,30,0.5,log(x), "x") \
+/*3782*/ o(FFFF2,t02"polar"      ,         0.01,3,0.05,polar(x,y), "x,y") \
+/*3783*/ o(FFFF1,t02"real"       ,        1e-6,4000,10,real(x), "x") \
+/*3784*/ o(FFFF1,t02"sqrt_cd"    , -100000,100000,1000,sqrt(x), "x") \
+/*3785*/ o(FFFF1,t03"complex_minus1",            0,1,1,x+((sqrt(-1)=1i) & (sqrt(- 1)=-(1i)) & (sqrt(-(1))=-(1i))), "x") \
+/*3786*/ o(FFFF1,t12"a_ac"       ,              -3,3,2,csc(acos(a)), "a") \
+/*3787*/ o(FFFF1,t12"a_ach"      ,              -3,3,2,csc(acosh(a)), "a") \
+/*3788*/ o(FFFF1,t12"a_as"       ,              -3,3,2,csc(asin(a)), "a") \
+/*3789*/ o(FFFF2,t12"a_atd"      ,          0.5,1,0.25,csc(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3790*/ o(FFFF1,t12"a_ath"      ,       0.25,3.25,0.5,csc(atanh(a)), "a") \
+/*3791*/ o(FFFF1,t12"a_atn"      ,              -3,3,2,csc(atan(-abs((a+-0.4)))), "a") \
+/*3792*/ o(FFFF1,t12"a_atp"      ,              -3,3,2,csc(atan(abs((a+-0.4)))), "a") \
+/*3793*/ o(FFFF1,t12"a_cb"       ,              -3,3,2,csc(cbrt(a)), "a") \
+/*3794*/ o(FFFF1,t12"a_g"        ,              -3,3,2,csc(arg(a)), "a") \
+/*3795*/ o(FFFF2,t12"a_h"        ,           0.5,2,0.5,csc(hypot(a,b)), "a,b") \
+/*3796*/ o(FFFF1,t12"a_h1x"      ,              -3,3,2,csc(hypot(1,a)), "a") \
+/*3797*/ o(FFFF1,t12"a_h2x"      ,            -1,1,0.5,csc(hypot(2,a)), "a") \
+/*3798*/ o(FFFF1,t12"a_hx1"      ,              -3,3,2,csc(hypot(a,1)), "a") \
+/*3799*/ o(FFFF1,t12"a_hx2"      ,            -1,1,0.5,csc(hypot(a,2)), "a") \
+/*3800*/ o(FFFF1,t12"a_i"        ,              -3,3,2,csc(imag(a)), "a") \
+/*3801*/ o(FFFF2,t12"a_iatd"     ,          0.5,1,0.25,csc(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3802*/ o(FFFF2,t12"a_ih"       ,           0.5,2,0.5,csc(1/hypot(a,b)), "a,b") \
+/*3803*/ o(FFFF1,t12"a_ih1x"     ,              -3,3,2,csc(1/hypot(1,a)), "a") \
+/*3804*/ o(FFFF1,t12"a_ih2x"     ,            -1,1,0.5,csc(1/hypot(2,a)), "a") \
+/*3805*/ o(FFFF1,t12"a_ihx1"     ,              -3,3,2,csc(1/hypot(a,1)), "a") \
+/*3806*/ o(FFFF1,t12"a_ihx2"     ,            -1,1,0.5,csc(1/hypot(a,2)), "a") \
+/*3807*/ o(FFFF1,t12"a_j"        ,              -3,3,2,csc(conj(a)), "a") \
+/*3808*/ o(FFFF1,t12"a_l"        ,              -3,3,2,csc(log(a)), "a") \
+/*3809*/ o(FFFF1,t12"a_l2"       ,              -3,3,2,csc(log2(a)), "a") \
+/*3810*/ o(FFFF1,t12"a_lt"       ,              -3,3,2,csc(log10(a)), "a") \
+/*3811*/ o(FFFF2,t12"a_po"       ,              -3,3,2,csc(polar(a,b)), "a,b") \
+/*3812*/ o(FFFF1,t12"a_r"        ,              -3,3,2,csc(real(a)), "a") \
+/*3813*/ o(FFFF1,t12"a_sq"       ,              -3,3,2,csc(sqrt(a)), "a") \
+/*3814*/ o(FFFF1,t12"ac_a"       ,              -3,3,2,acos(csc(a)), "a") \
+/*3815*/ o(FFFF1,t12"ac_ac"      ,              -3,3,2,acos(acos(a)), "a") \
+/*3816*/ o(FFFF1,t12"ac_ach"     ,              -3,3,2,acos(acosh(a)), "a") \
+/*3817*/ o(FFFF1,t12"ac_as"      ,              -3,3,2,acos(asin(a)), "a") \
+/*3818*/ o(FFFF1,t12"ac_ash"     ,              -3,3,2,acos(asinh(a)), "a") \
+/*3819*/ o(FFFF1,t12"ac_at"      ,              -3,3,2,acos(atan(a)), "a") \
+/*3820*/ o(FFFF2,t12"ac_atd"     ,          0.5,1,0.25,acos(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3821*/ o(FFFF1,t12"ac_ath"     ,       0.25,3.25,0.5,acos(atanh(a)), "a") \
+/*3822*/ o(FFFF1,t12"ac_b"       ,       -0.5,0.5,0.25,acos(abs(a)), "a") \
+/*3823*/ o(FFFF1,t12"ac_c"       ,              -3,3,2,acos(cos(a)), "a") \
+/*3824*/ o(FFFF1,t12"ac_cb"      ,           0.5,2,0.5,acos(cbrt(a)), "a") \
+/*3825*/ o(FFFF1,t12"ac_ch"      ,              -3,3,2,acos(cosh(a)), "a") \
+/*3826*/ o(FFFF1,t12"ac_e"       ,              -3,3,2,acos(sec(a)), "a") \
+/*3827*/ o(FFFF1,t12"ac_e2"      ,              -3,3,2,acos(exp2(a)), "a") \
+/*3828*/ o(FFFF1,t12"ac_ex"      ,              -3,3,2,acos(exp(a)), "a") \
+/*3829*/ o(FFFF1,t12"ac_g"       ,          0.5,1,0.25,acos(arg((a+0.6))), "a") \
+/*3830*/ o(FFFF2,t12"ac_h"       ,           0.5,2,0.5,acos(hypot((a+-0.2),(b+-0.2))), "a,b") \
+/*3831*/ o(FFFF1,t12"ac_h1x"     ,           0.5,2,0.5,acos(hypot(1,a)), "a") \
+/*3832*/ o(FFFF1,t12"ac_h2x"     ,              -3,3,2,acos(hypot(2,a)), "a") \
+/*3833*/ o(FFFF1,t12"ac_hx1"     ,           0.5,2,0.5,acos(hypot(a,1)), "a") \
+/*3834*/ o(FFFF1,t12"ac_hx2"     ,              -3,3,2,acos(hypot(a,2)), "a") \
+/*3835*/ o(FFFF1,t12"ac_i"       ,     -0.75,0.75,0.25,acos(imag(a)), "a") \
+/*3836*/ o(FFFT2,t12"ac_iatd"    ,          0.5,1,0.25,acos(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3837*/ o(FFFF2,t12"ac_ih"      ,       0.25,3.25,0.5,acos(1/hypot(a,b)), "a,b") \
+/*3838*/ o(FFFF1,t12"ac_ih1x"    ,              -3,3,2,acos(1/hypot(1,a)), "a") \
+/*3839*/ o(FFFF1,t12"ac_ih2x"    ,              -3,3,2,acos(1/hypot(2,a)), "a") \
+/*3840*/ o(FFFF1,t12"ac_ihx1"    ,              -3,3,2,acos(1/hypot(a,1)), "a") \
+/*3841*/ o(FFFF1,t12"ac_ihx2"    ,              -3,3,2,acos(1/hypot(a,2)), "a") \
+/*3842*/ o(FFFF1,t12"ac_j"       ,              -3,3,2,acos(conj(a)), "a") \
+/*3843*/ o(FFFF1,t12"ac_l"       ,              -3,3,2,acos(log(a)), "a") \
+/*3844*/ o(FFFF1,t12"ac_l2"      ,              -3,3,2,acos(log2(a)), "a") \
+/*3845*/ o(FFFF1,t12"ac_lt"      ,              -3,3,2,acos(log10(a)), "a") \
+/*3846*/ o(FFFF1,t12"ac_o"       ,              -3,3,2,acos(cot(a)), "a") \
+/*3847*/ o(FFFF2,t12"ac_p"       ,           0.5,2,0.5,acos(pow(a,b)), "a,b") \
+/*3848*/ o(FFFF2,t12"ac_po"      ,              -3,3,2,acos(polar(a,b)), "a,b") \
+/*3849*/ o(FFFF1,t12"ac_r"       ,     -0.75,0.75,0.25,acos(real(a)), "a") \
+/*3850*/ o(FFFF1,t12"ac_sh"      ,              -3,3,2,acos(sinh(a)), "a") \
+/*3851*/ o(FFFF1,t12"ac_sq"      ,       0.25,3.25,0.5,acos(sqrt(a)), "a") \
+/*3852*/ o(FFFF1,t12"ac_t"       ,              -3,3,2,acos(tan(a)), "a") \
+/*3853*/ o(FFFF1,t12"ac_th"      ,              -3,3,2,acos(tanh(a)), "a") \
+/*3854*/ o(FFFF1,t12"ach_a"      ,              -3,3,2,acosh(csc(a)), "a") \
+/*3855*/ o(FFFF1,t12"ach_ac"     ,              -3,3,2,acosh(acos(a)), "a") \
+/*3856*/ o(FFFF1,t12"ach_ach"    ,              -3,3,2,acosh(acosh(a)), "a") \
+/*3857*/ o(FFFF1,t12"ach_as"     ,              -3,3,2,acosh(asin(a)), "a") \
+/*3858*/ o(FFFF1,t12"ach_ash"    ,              -3,3,2,acosh(asinh(a)), "a") \
+/*3859*/ o(FFFF1,t12"ach_at"     ,              -3,3,2,acosh(atan(a)), "a") \
+/*3860*/ o(FFFF1,t12"ach_ath"    ,       0.25,3.25,0.5,acosh(atanh(a)), "a") \
+/*3861*/ o(FFFF1,t12"ach_c"      ,              -3,3,2,acosh(cos(a)), "a") \
+/*3862*/ o(FFFF1,t12"ach_cb"     ,           0.5,2,0.5,acosh(cbrt(a)), "a") \
+/*3863*/ o(FFFF1,t12"ach_ch"     ,              -3,3,2,acosh(cosh(a)), "a") \
+/*3864*/ o(FFFF1,t12"ach_e"      ,              -3,3,2,acosh(sec(a)), "a") \
+/*3865*/ o(FFFF1,t12"ach_e2"     ,              -3,3,2,acosh(exp2(a)), "a") \
+/*3866*/ o(FFFF1,t12"ach_ex"     ,              -3,3,2,acosh(exp(a)), "a") \
+/*3867*/ o(FFFF1,t12"ach_g"      ,     0.25,0.75,0.125,acosh(arg((a+-0.6))), "a") \
+/*3868*/ o(FFFF2,t12"ach_h"      ,           0.5,2,0.5,acosh(hypot((a+-0.2),(b+-0.2))), "a,b") \
+/*3869*/ o(FFFF1,t12"ach_h1x"    ,           0.5,2,0.5,acosh(hypot(1,a)), "a") \
+/*3870*/ o(FFFF1,t12"ach_h2x"    ,            -1,1,0.5,acosh(hypot(2,a)), "a") \
+/*3871*/ o(FFFF1,t12"ach_hx1"    ,           0.5,2,0.5,acosh(hypot(a,1)), "a") \
+/*3872*/ o(FFFF1,t12"ach_hx2"    ,            -1,1,0.5,acosh(hypot(a,2)), "a") \
+/*3873*/ o(FFFF2,t12"ach_ih"     ,       0.25,3.25,0.5,acosh(1/hypot(a,b)), "a,b") \
+/*3874*/ o(FFFF1,t12"ach_ih1x"   ,              -3,3,2,acosh(1/hypot(1,a)), "a") \
+/*3875*/ o(FFFT1,t12"ach_ih2x"   ,            -1,1,0.5,acosh(1/hypot(2,a)), "a") \
+/*3876*/ o(FFFF1,t12"ach_ihx1"   ,              -3,3,2,acosh(1/hypot(a,1)), "a") \
+/*3877*/ o(FFFT1,t12"ach_ihx2"   ,            -1,1,0.5,acosh(1/hypot(a,2)), "a") \
+/*3878*/ o(FFFF1,t12"ach_j"      ,              -3,3,2,acosh(conj(a)), "a") \
+/*3879*/ o(FFFF1,t12"ach_l"      ,              -3,3,2,acosh(log(a)), "a") \
+/*3880*/ o(FFFF1,t12"ach_l2"     ,              -3,3,2,acosh(log2(a)), "a") \
+/*3881*/ o(FFFF1,t12"ach_lt"     ,              -3,3,2,acosh(log10(a)), "a") \
+/*3882*/ o(FFFF1,t12"ach_o"      ,              -3,3,2,acosh(cot(a)), "a") \
+/*3883*/ o(FFFF2,t12"ach_p"      ,           0.5,2,0.5,acosh(pow(a,b)), "a,b") \
+/*3884*/ o(FFFF2,t12"ach_po"     ,              -3,3,2,acosh(polar(a,b)), "a,b") \
+/*3885*/ o(FFFF1,t12"ach_r"      ,           0.5,2,0.5,acosh(real((a+0.6))), "a") \
+/*3886*/ o(FFFF1,t12"ach_s"      ,              -3,3,2,acosh(sin(a)), "a") \
+/*3887*/ o(FFFF1,t12"ach_sh"     ,              -3,3,2,acosh(sinh(a)), "a") \
+/*3888*/ o(FFFF1,t12"ach_sq"     ,       0.25,3.25,0.5,acosh(sqrt(a)), "a") \
+/*3889*/ o(FFFF1,t12"ach_t"      ,              -3,3,2,acosh(tan(a)), "a") \
+/*3890*/ o(FFFF1,t12"ach_th"     ,              -3,3,2,acosh(tanh(a)), "a") \
+/*3891*/ o(FFFF1,t12"as_a"       ,              -3,3,2,asin(csc(a)), "a") \
+/*3892*/ o(FFFF1,t12"as_ac"      ,              -3,3,2,asin(acos(a)), "a") \
+/*3893*/ o(FFFF1,t12"as_ach"     ,              -3,3,2,asin(acosh(a)), "a") \
+/*3894*/ o(FFFF1,t12"as_as"      ,              -3,3,2,asin(asin(a)), "a") \
+/*3895*/ o(FFFF1,t12"as_ash"     ,              -3,3,2,asin(asinh(a)), "a") \
+/*3896*/ o(FFFF1,t12"as_at"      ,              -3,3,2,asin(atan(a)), "a") \
+/*3897*/ o(FFFF2,t12"as_atd"     ,          0.5,1,0.25,asin(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3898*/ o(FFFF1,t12"as_ath"     ,       0.25,3.25,0.5,asin(atanh(a)), "a") \
+/*3899*/ o(FFFF1,t12"as_b"       ,       -0.5,0.5,0.25,asin(abs(a)), "a") \
+/*3900*/ o(FFFF1,t12"as_c"       ,              -3,3,2,asin(cos(a)), "a") \
+/*3901*/ o(FFFF1,t12"as_cb"      ,           0.5,2,0.5,asin(cbrt(a)), "a") \
+/*3902*/ o(FFFF1,t12"as_ch"      ,              -3,3,2,asin(cosh(a)), "a") \
+/*3903*/ o(FFFF1,t12"as_e"       ,              -3,3,2,asin(sec(a)), "a") \
+/*3904*/ o(FFFF1,t12"as_e2"      ,              -3,3,2,asin(exp2(a)), "a") \
+/*3905*/ o(FFFF1,t12"as_ex"      ,              -3,3,2,asin(exp(a)), "a") \
+/*3906*/ o(FFFF1,t12"as_g"       ,          0.5,1,0.25,asin(arg((a+0.6))), "a") \
+/*3907*/ o(FFFF2,t12"as_h"       ,           0.5,2,0.5,asin(hypot((a+-0.2),(b+-0.2))), "a,b") \
+/*3908*/ o(FFFF1,t12"as_h1x"     ,           0.5,2,0.5,asin(hypot(1,a)), "a") \
+/*3909*/ o(FFFF1,t12"as_h2x"     ,              -3,3,2,asin(hypot(2,a)), "a") \
+/*3910*/ o(FFFF1,t12"as_hx1"     ,           0.5,2,0.5,asin(hypot(a,1)), "a") \
+/*3911*/ o(FFFF1,t12"as_hx2"     ,              -3,3,2,asin(hypot(a,2)), "a") \
+/*3912*/ o(FFFF1,t12"as_i"       ,     -0.75,0.75,0.25,asin(imag(a)), "a") \
+/*3913*/ o(FFFT2,t12"as_iatd"    ,          0.5,1,0.25,asin(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3914*/ o(FFFF2,t12"as_ih"      ,       0.25,3.25,0.5,asin(1/hypot(a,b)), "a,b") \
+/*3915*/ o(FFFF1,t12"as_ih1x"    ,              -3,3,2,asin(1/hypot(1,a)), "a") \
+/*3916*/ o(FFFF1,t12"as_ih2x"    ,              -3,3,2,asin(1/hypot(2,a)), "a") \
+/*3917*/ o(FFFF1,t12"as_ihx1"    ,              -3,3,2,asin(1/hypot(a,1)), "a") \
+/*3918*/ o(FFFF1,t12"as_ihx2"    ,              -3,3,2,asin(1/hypot(a,2)), "a") \
+/*3919*/ o(FFFF1,t12"as_j"       ,              -3,3,2,asin(conj(a)), "a") \
+/*3920*/ o(FFFF1,t12"as_l"       ,              -3,3,2,asin(log(a)), "a") \
+/*3921*/ o(FFFF1,t12"as_l2"      ,              -3,3,2,asin(log2(a)), "a") \
+/*3922*/ o(FFFF1,t12"as_lt"      ,              -3,3,2,asin(log10(a)), "a") \
+/*3923*/ o(FFFF1,t12"as_o"       ,              -3,3,2,asin(cot(a)), "a") \
+/*3924*/ o(FFFF2,t12"as_p"       ,           0.5,2,0.5,asin(pow(a,b)), "a,b") \
+/*3925*/ o(FFFF2,t12"as_po"      ,              -3,3,2,asin(polar(a,b)), "a,b") \
+/*3926*/ o(FFFF1,t12"as_r"       ,     -0.75,0.75,0.25,asin(real(a)), "a") \
+/*3927*/ o(FFFF1,t12"as_sh"      ,              -3,3,2,asin(sinh(a)), "a") \
+/*3928*/ o(FFFF1,t12"as_sq"      ,       0.25,3.25,0.5,asin(sqrt(a)), "a") \
+/*3929*/ o(FFFF1,t12"as_t"       ,              -3,3,2,asin(tan(a)), "a") \
+/*3930*/ o(FFFF1,t12"as_th"      ,              -3,3,2,asin(tanh(a)), "a") \
+/*3931*/ o(FFFF1,t12"ash_ac"     ,              -3,3,2,asinh(acos(a)), "a") \
+/*3932*/ o(FFFF1,t12"ash_ach"    ,              -3,3,2,asinh(acosh(a)), "a") \
+/*3933*/ o(FFFF1,t12"ash_as"     ,              -3,3,2,asinh(asin(a)), "a") \
+/*3934*/ o(FFFF1,t12"ash_ash"    ,              -3,3,2,asinh(asinh(a)), "a") \
+/*3935*/ o(FFFF1,t12"ash_at"     ,              -3,3,2,asinh(atan(a)), "a") \
+/*3936*/ o(FFFF2,t12"ash_atd"    ,          0.5,1,0.25,asinh(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3937*/ o(FFFF1,t12"ash_ath"    ,       -0.5,0.5,0.25,asinh(atanh(a)), "a") \
+/*3938*/ o(FFFF1,t12"ash_atn"    ,              -2,2,2,asinh(atan(-abs(a))), "a") \
+/*3939*/ o(FFFF1,t12"ash_atp"    ,              -2,2,2,asinh(atan(abs(a))), "a") \
+/*3940*/ o(FFFF1,t12"ash_cb"     ,           0.5,2,0.5,asinh(cbrt(a)), "a") \
+/*3941*/ o(FFFF1,t12"ash_g"      ,              -3,3,2,asinh(arg(a)), "a") \
+/*3942*/ o(FFFF2,t12"ash_h"      ,             0,1,0.5,asinh(hypot((a+-0.2),(b+-0.2))), "a,b") \
+/*3943*/ o(FFFF1,t12"ash_h1x"    ,              -3,3,2,asinh(hypot(1,a)), "a") \
+/*3944*/ o(FFFF1,t12"ash_h2x"    ,            -1,1,0.5,asinh(hypot(2,a)), "a") \
+/*3945*/ o(FFFF1,t12"ash_hx1"    ,              -3,3,2,asinh(hypot(a,1)), "a") \
+/*3946*/ o(FFFF1,t12"ash_hx2"    ,            -1,1,0.5,asinh(hypot(a,2)), "a") \
+/*3947*/ o(FFFF1,t12"ash_i"      ,            -2,2,0.5,asinh(imag(a)), "a") \
+/*3948*/ o(FFFF2,t12"ash_iatd"   ,          0.5,1,0.25,asinh(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3949*/ o(FFFF2,t12"ash_ih"     ,       0.25,3.25,0.5,asinh(1/hypot(a,b)), "a,b") \
+/*3950*/ o(FFFF1,t12"ash_ih1x"   ,              -3,3,2,asinh(1/hypot(1,a)), "a") \
+/*3951*/ o(FFFF1,t12"ash_ih2x"   ,            -1,1,0.5,asinh(1/hypot(2,a)), "a") \
+/*3952*/ o(FFFF1,t12"ash_ihx1"   ,              -3,3,2,asinh(1/hypot(a,1)), "a") \
+/*3953*/ o(FFFF1,t12"ash_ihx2"   ,            -1,1,0.5,asinh(1/hypot(a,2)), "a") \
+/*3954*/ o(FFFF1,t12"ash_j"      ,              -3,3,2,asinh(conj(a)), "a") \
+/*3955*/ o(FFFF1,t12"ash_l"      ,              -3,3,2,asinh(log(a)), "a") \
+/*3956*/ o(FFFF1,t12"ash_l2"     ,              -3,3,2,asinh(log2(a)), "a") \
+/*3957*/ o(FFFF1,t12"ash_lt"     ,              -3,3,2,asinh(log10(a)), "a") \
+/*3958*/ o(FFFF2,t12"ash_po"     ,            -2,2,0.5,asinh(polar(a,b)), "a,b") \
+/*3959*/ o(FFFF1,t12"ash_r"      ,            -2,2,0.5,asinh(real(a)), "a") \
+/*3960*/ o(FFFF1,t12"ash_s"      ,              -3,3,2,asinh(sin(a)), "a") \
+/*3961*/ o(FFFF1,t12"ash_sq"     ,           0.5,2,0.5,asinh(sqrt(a)), "a") \
+/*3962*/ o(FFFF1,t12"ash_t"      ,              -3,3,2,asinh(tan(a)), "a") \
+/*3963*/ o(FFFF1,t12"ash_th"     ,              -3,3,2,asinh(tanh(a)), "a") \
+/*3964*/ o(FFFF1,t12"at_ac"      ,              -3,3,2,atan(acos(a)), "a") \
+/*3965*/ o(FFFF1,t12"at_ach"     ,              -3,3,2,atan(acosh(a)), "a") \
+/*3966*/ o(FFFF1,t12"at_as"      ,              -3,3,2,atan(asin(a)), "a") \
+/*3967*/ o(FFFF1,t12"at_ash"     ,              -3,3,2,atan(asinh(a)), "a") \
+/*3968*/ o(FFFF1,t12"at_at"      ,              -3,3,2,atan(atan(a)), "a") \
+/*3969*/ o(FFFF2,t12"at_atd"     ,          0.5,1,0.25,atan(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3970*/ o(FFFF1,t12"at_ath"   , -0.1875,0.1875,0.0625,atan(atanh(a)), "a") \
+/*3971*/ o(FFFF1,t12"at_b"       ,              -2,2,2,atan(abs(a)), "a") \
+/*3972*/ o(FFFF1,t12"at_c"       ,              -3,3,2,atan(cos(a)), "a") \
+/*3973*/ o(FFFF1,t12"at_cb"      ,              -3,3,2,atan(cbrt(a)), "a") \
+/*3974*/ o(FFFF1,t12"at_ch"      ,              -3,3,2,atan(cosh(a)), "a") \
+/*3975*/ o(FFFF1,t12"at_e"       ,              -3,3,2,atan(sec(a)), "a") \
+/*3976*/ o(FFFF1,t12"at_e2"      ,              -3,3,2,atan(exp2(a)), "a") \
+/*3977*/ o(FFFF1,t12"at_ex"      ,              -3,3,2,atan(exp(a)), "a") \
+/*3978*/ o(FFFF1,t12"at_g"       ,       -0.5,0.5,0.25,atan(arg((a+1))), "a") \
+/*3979*/ o(FFFF2,t12"at_h"       ,       0.25,3.25,0.5,atan(hypot(a,b)), "a,b") \
+/*3980*/ o(FFFF1,t12"at_h1x"     ,              -3,3,2,atan(hypot(1,a)), "a") \
+/*3981*/ o(FFFF1,t12"at_h2x"     ,              -3,3,2,atan(hypot(2,a)), "a") \
+/*3982*/ o(FFFF1,t12"at_hx1"     ,              -3,3,2,atan(hypot(a,1)), "a") \
+/*3983*/ o(FFFF1,t12"at_hx2"     ,              -3,3,2,atan(hypot(a,2)), "a") \
+/*3984*/ o(FFFF1,t12"at_i"       ,            -2,2,0.5,atan(imag(a)), "a") \
+/*3985*/ o(FFFF2,t12"at_iatd"    ,          0.5,1,0.25,atan(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*3986*/ o(FFFF2,t12"at_ih"      ,           0.5,2,0.5,atan(1/hypot(a,b)), "a,b") \
+/*3987*/ o(FFFF1,t12"at_ih1x"    ,              -3,3,2,atan(1/hypot(1,a)), "a") \
+/*3988*/ o(FFFF1,t12"at_ih2x"    ,              -3,3,2,atan(1/hypot(2,a)), "a") \
+/*3989*/ o(FFFF1,t12"at_ihx1"    ,              -3,3,2,atan(1/hypot(a,1)), "a") \
+/*3990*/ o(FFFF1,t12"at_ihx2"    ,              -3,3,2,atan(1/hypot(a,2)), "a") \
+/*3991*/ o(FFFF1,t12"at_j"       ,              -3,3,2,atan(conj(a)), "a") \
+/*3992*/ o(FFFF1,t12"at_l"       ,              -3,3,2,atan(log(a)), "a") \
+/*3993*/ o(FFFF1,t12"at_l2"      ,              -3,3,2,atan(log2(a)), "a") \
+/*3994*/ o(FFFF1,t12"at_lt"      ,              -3,3,2,atan(log10(a)), "a") \
+/*3995*/ o(FFFF2,t12"at_p"       ,              -3,3,2,atan(pow(a,b)), "a,b") \
+/*3996*/ o(FFFF2,t12"at_po"      ,              -2,2,2,atan(polar(a,b)), "a,b") \
+/*3997*/ o(FFFF1,t12"at_r"       ,            -2,2,0.5,atan(real(a)), "a") \
+/*3998*/ o(FFFF1,t12"at_s"       ,              -3,3,2,atan(sin(a)), "a") \
+/*3999*/ o(FFFF1,t12"at_sh"      ,              -3,3,2,atan(sinh(a)), "a") \
+/*4000*/ o(FFFF1,t12"at_sq"      ,              -3,3,2,atan(sqrt(a)), "a") \
+/*4001*/ o(FFFF1,t12"at_t"       ,              -3,3,2,atan(tan(a)), "a") \
+/*4002*/ o(FFFF1,t12"at_th"      ,              -3,3,2,atan(tanh(a)), "a") \
+/*4003*/ o(FFFF1,t12"ath_a"      ,              -3,3,2,atanh(csc(a)), "a") \
+/*4004*/ o(FFFF1,t12"ath_ac"     ,              -3,3,2,atanh(acos(a)), "a") \
+/*4005*/ o(FFFF1,t12"ath_ach"    ,              -3,3,2,atanh(acosh(a)), "a") \
+/*4006*/ o(FFFF1,t12"ath_as"     ,              -3,3,2,atanh(asin(a)), "a") \
+/*4007*/ o(FFFF1,t12"ath_ash"    ,              -3,3,2,atanh(asinh(a)), "a") \
+/*4008*/ o(FFFF1,t12"ath_at"     ,              -3,3,2,atanh(atan(a)), "a") \
+/*4009*/ o(FFFF2,t12"ath_atd"    ,          0.5,1,0.25,atanh(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4010*/ o(FFFF1,t12"ath_ath"    ,       0.25,3.25,0.5,atanh(atanh(a)), "a") \
+/*4011*/ o(FFFF1,t12"ath_b"      ,       -0.5,0.5,0.25,atanh(abs(a)), "a") \
+/*4012*/ o(FFFF1,t12"ath_cb"     ,              -3,3,2,atanh(cbrt(a)), "a") \
+/*4013*/ o(FFFF1,t12"ath_ch"     ,              -3,3,2,atanh(cosh(a)), "a") \
+/*4014*/ o(FFFF1,t12"ath_e"      ,              -3,3,2,atanh(sec(a)), "a") \
+/*4015*/ o(FFFF1,t12"ath_e2"     ,              -3,3,2,atanh(exp2(a)), "a") \
+/*4016*/ o(FFFF1,t12"ath_ex"     ,              -3,3,2,atanh(exp(a)), "a") \
+/*4017*/ o(FFFF1,t12"ath_g"      ,          0.5,1,0.25,atanh(arg((a+0.2))), "a") \
+/*4018*/ o(FFFF2,t12"ath_h"      ,     0.25,0.75,0.125,atanh(hypot(a,b)), "a,b") \
+/*4019*/ o(FFFF1,t12"ath_h1x"    ,              -3,3,2,atanh(hypot(1,a)), "a") \
+/*4020*/ o(FFFF1,t12"ath_h2x"    ,              -3,3,2,atanh(hypot(2,a)), "a") \
+/*4021*/ o(FFFF1,t12"ath_hx1"    ,              -3,3,2,atanh(hypot(a,1)), "a") \
+/*4022*/ o(FFFF1,t12"ath_hx2"    ,              -3,3,2,atanh(hypot(a,2)), "a") \
+/*4023*/ o(FFFF1,t12"ath_i"      ,     -0.75,0.75,0.25,atanh(imag(a)), "a") \
+/*4024*/ o(FFFT2,t12"ath_iatd"   ,          0.5,1,0.25,atanh(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4025*/ o(FFFF2,t12"ath_ih"     ,           0.5,2,0.5,atanh(1/hypot(a,b)), "a,b") \
+/*4026*/ o(FFFF1,t12"ath_ih2x"   ,              -3,3,2,atanh(1/hypot(2,a)), "a") \
+/*4027*/ o(FFFF1,t12"ath_ihx2"   ,              -3,3,2,atanh(1/hypot(a,2)), "a") \
+/*4028*/ o(FFFF1,t12"ath_j"      ,     -0.75,0.75,0.25,atanh(conj(a)), "a") \
+/*4029*/ o(FFFF1,t12"ath_l"      ,              -3,3,2,atanh(log(a)), "a") \
+/*4030*/ o(FFFF1,t12"ath_l2"     ,              -3,3,2,atanh(log2(a)), "a") \
+/*4031*/ o(FFFF1,t12"ath_lt"     ,              -3,3,2,atanh(log10(a)), "a") \
+/*4032*/ o(FFFF1,t12"ath_o"      ,              -3,3,2,atanh(cot(a)), "a") \
+/*4033*/ o(FFFF2,t12"ath_p"      ,              -3,3,2,atanh(pow(a,b)), "a,b") \
+/*4034*/ o(FFFF2,t12"ath_po"     ,     -0.75,0.75,0.25,atanh(polar(a,b)), "a,b") \
+/*4035*/ o(FFFF1,t12"ath_r"      ,     -0.75,0.75,0.25,atanh(real(a)), "a") \
+/*4036*/ o(FFFF1,t12"ath_s"      ,              -3,3,2,atanh(sin(a)), "a") \
+/*4037*/ o(FFFF1,t12"ath_sh"     ,              -3,3,2,atanh(sinh(a)), "a") \
+/*4038*/ o(FFFF1,t12"ath_sq"     ,              -3,3,2,atanh(sqrt(a)), "a") \
+/*4039*/ o(FFFF1,t12"ath_t"      ,              -3,3,2,atanh(tan(a)), "a") \
+/*4040*/ o(FFFF1,t12"ath_th"     ,              -3,3,2,atanh(tanh(a)), "a") \
+/*4041*/ o(FFFF1,t12"b_ac"       ,              -3,3,2,abs(acos(a)), "a") \
+/*4042*/ o(FFFF1,t12"b_ach"      ,              -3,3,2,abs(acosh(a)), "a") \
+/*4043*/ o(FFFF1,t12"b_as"       ,              -3,3,2,abs(asin(a)), "a") \
+/*4044*/ o(FFFF1,t12"b_ash"      ,              -3,3,2,abs(asinh(a)), "a") \
+/*4045*/ o(FFFF1,t12"b_at"       ,              -3,3,2,abs(atan(a)), "a") \
+/*4046*/ o(FFFF2,t12"b_atd"      ,          0.5,1,0.25,abs(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4047*/ o(FFFF1,t12"b_atn"      ,              -2,2,2,abs(atan(-abs(a))), "a") \
+/*4048*/ o(FFFF1,t12"b_atp"      ,              -2,2,2,abs(atan(abs(a))), "a") \
+/*4049*/ o(FFFF1,t12"b_cb"       ,              -3,3,2,abs(cbrt(a)), "a") \
+/*4050*/ o(FFFF1,t12"b_g"        ,              -3,3,2,abs(arg(a)), "a") \
+/*4051*/ o(FFFF2,t12"b_h"        ,           0.5,2,0.5,abs(hypot(a,b)), "a,b") \
+/*4052*/ o(FFFF1,t12"b_h1x"      ,              -3,3,2,abs(hypot(1,a)), "a") \
+/*4053*/ o(FFFF1,t12"b_h2x"      ,            -1,1,0.5,abs(hypot(2,a)), "a") \
+/*4054*/ o(FFFF1,t12"b_hx1"      ,              -3,3,2,abs(hypot(a,1)), "a") \
+/*4055*/ o(FFFF1,t12"b_hx2"      ,            -1,1,0.5,abs(hypot(a,2)), "a") \
+/*4056*/ o(FFFF1,t12"b_i"        ,            -2,2,0.5,abs(imag(a)), "a") \
+/*4057*/ o(FFFF2,t12"b_iatd"     ,          0.5,1,0.25,abs(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4058*/ o(FFFF2,t12"b_ih"       ,           0.5,2,0.5,abs(1/hypot(a,b)), "a,b") \
+/*4059*/ o(FFFF1,t12"b_ih1x"     ,              -3,3,2,abs(1/hypot(1,a)), "a") \
+/*4060*/ o(FFFF1,t12"b_ih2x"     ,            -1,1,0.5,abs(1/hypot(2,a)), "a") \
+/*4061*/ o(FFFF1,t12"b_ihx1"     ,              -3,3,2,abs(1/hypot(a,1)), "a") \
+/*4062*/ o(FFFF1,t12"b_ihx2"     ,            -1,1,0.5,abs(1/hypot(a,2)), "a") \
+/*4063*/ o(FFFF1,t12"b_j"        ,            -2,2,0.5,abs(conj(a)), "a") \
+/*4064*/ o(FFFF1,t12"b_l"        ,              -3,3,2,abs(log(a)), "a") \
+/*4065*/ o(FFFF1,t12"b_l2"       ,              -3,3,2,abs(log2(a)), "a") \
+/*4066*/ o(FFFF1,t12"b_lt"       ,              -3,3,2,abs(log10(a)), "a") \
+/*4067*/ o(FFFF2,t12"b_p"        ,              -3,3,2,abs(pow(a,b)), "a,b") \
+/*4068*/ o(FFFF2,t12"b_po"       ,            -2,2,0.5,abs(polar(a,b)), "a,b") \
+/*4069*/ o(FFFF1,t12"b_r"        ,            -2,2,0.5,abs(real(a)), "a") \
+/*4070*/ o(FFFF1,t12"b_sq"       ,              -3,3,2,abs(sqrt(a)), "a") \
+/*4071*/ o(FFFF1,t12"b_t"        ,              -3,3,2,abs(tan(a)), "a") \
+/*4072*/ o(FFFF1,t12"b_th"       ,              -3,3,2,abs(tanh(a)), "a") \
+/*4073*/ o(FFFF1,t12"c_ac"       ,              -3,3,2,cos(acos(a)), "a") \
+/*4074*/ o(FFFF1,t12"c_ach"      ,              -3,3,2,cos(acosh(a)), "a") \
+/*4075*/ o(FFFF1,t12"c_as"       ,              -3,3,2,cos(asin(a)), "a") \
+/*4076*/ o(FFFF1,t12"c_ash"      ,              -3,3,2,cos(asinh(a)), "a") \
+/*4077*/ o(FFFF1,t12"c_at"       ,              -3,3,2,cos(atan(a)), "a") \
+/*4078*/ o(FFFF2,t12"c_atd"      ,          0.5,1,0.25,cos(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4079*/ o(FFFF1,t12"c_atn"      ,              -2,2,2,cos(atan(-abs(a))), "a") \
+/*4080*/ o(FFFF1,t12"c_atp"      ,              -2,2,2,cos(atan(abs(a))), "a") \
+/*4081*/ o(FFFF1,t12"c_cb"       ,              -3,3,2,cos(cbrt(a)), "a") \
+/*4082*/ o(FFFF1,t12"c_g"        ,              -3,3,2,cos(arg(a)), "a") \
+/*4083*/ o(FFFF2,t12"c_h"        ,           0.5,2,0.5,cos(hypot(a,b)), "a,b") \
+/*4084*/ o(FFFF1,t12"c_h1x"      ,              -3,3,2,cos(hypot(1,a)), "a") \
+/*4085*/ o(FFFF1,t12"c_h2x"      ,            -1,1,0.5,cos(hypot(2,a)), "a") \
+/*4086*/ o(FFFF1,t12"c_hx1"      ,              -3,3,2,cos(hypot(a,1)), "a") \
+/*4087*/ o(FFFF1,t12"c_hx2"      ,            -1,1,0.5,cos(hypot(a,2)), "a") \
+/*4088*/ o(FFFF1,t12"c_i"        ,            -2,2,0.5,cos(imag(a)), "a") \
+/*4089*/ o(FFFF2,t12"c_iatd"     ,          0.5,1,0.25,cos(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4090*/ o(FFFF2,t12"c_ih"       ,           0.5,2,0.5,cos(1/hypot(a,b)), "a,b") \
+/*4091*/ o(FFFF1,t12"c_ih1x"     ,              -3,3,2,cos(1/hypot(1,a)), "a") \
+/*4092*/ o(FFFF1,t12"c_ih2x"     ,            -1,1,0.5,cos(1/hypot(2,a)), "a") \
+/*4093*/ o(FFFF1,t12"c_ihx1"     ,              -3,3,2,cos(1/hypot(a,1)), "a") \
+/*4094*/ o(FFFF1,t12"c_ihx2"     ,            -1,1,0.5,cos(1/hypot(a,2)), "a") \
+/*4095*/ o(FFFF1,t12"c_j"        ,            -2,2,0.5,cos(conj(a)), "a") \
+/*4096*/ o(FFFF1,t12"c_l"        ,              -3,3,2,cos(log(a)), "a") \
+/*4097*/ o(FFFF1,t12"c_l2"       ,              -3,3,2,cos(log2(a)), "a") \
+/*4098*/ o(FFFF1,t12"c_lt"       ,              -3,3,2,cos(log10(a)), "a") \
+/*4099*/ o(FFFF2,t12"c_po"       ,            -2,2,0.5,cos(polar(a,b)), "a,b") \
+/*4100*/ o(FFFF1,t12"c_r"        ,            -2,2,0.5,cos(real(a)), "a") \
+/*4101*/ o(FFFF1,t12"c_sq"       ,              -3,3,2,cos(sqrt(a)), "a") \
+/*4102*/ o(FFFF1,t12"c_t"        ,              -3,3,2,cos(tan(a)), "a") \
+/*4103*/ o(FFFF1,t12"c_th"       ,              -3,3,2,cos(tanh(a)), "a") \
+/*4104*/ o(FFFF1,t12"cb_a"       ,              -3,3,2,cbrt(csc(a)), "a") \
+/*4105*/ o(FFFF1,t12"cb_ac"      ,              -3,3,2,cbrt(acos(a)), "a") \
+/*4106*/ o(FFFF1,t12"cb_ach"     ,              -3,3,2,cbrt(acosh(a)), "a") \
+/*4107*/ o(FFFF1,t12"cb_as"      ,              -3,3,2,cbrt(asin(a)), "a") \
+/*4108*/ o(FFFF1,t12"cb_ash"     ,              -3,3,2,cbrt(asinh(a)), "a") \
+/*4109*/ o(FFFF1,t12"cb_at"      ,              -3,3,2,cbrt(atan(a)), "a") \
+/*4110*/ o(FFFF2,t12"cb_atd"     ,          0.5,1,0.25,cbrt(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4111*/ o(FFFF1,t12"cb_ath"     ,       0.25,3.25,0.5,cbrt(atanh(a)), "a") \
+/*4112*/ o(FFFF1,t12"cb_atp"     ,              -3,3,2,cbrt(atan(abs((a+-0.4)))), "a") \
+/*4113*/ o(FFFF1,t12"cb_b"       ,              -3,3,2,cbrt(abs(a)), "a") \
+/*4114*/ o(FFFF1,t12"cb_cb"      ,              -3,3,2,cbrt(cbrt(a)), "a") \
+/*4115*/ o(FFFF1,t12"cb_ch"      ,            -1,1,0.5,cbrt(cosh(a)), "a") \
+/*4116*/ o(FFFF1,t12"cb_e2"      ,              -2,2,2,cbrt(exp2(a)), "a") \
+/*4117*/ o(FFFF1,t12"cb_g"       ,           0.5,2,0.5,cbrt(arg(a)), "a") \
+/*4118*/ o(FFFF2,t12"cb_h"       ,           0.5,2,0.5,cbrt(hypot(a,b)), "a,b") \
+/*4119*/ o(FFFF1,t12"cb_h1x"     ,              -3,3,2,cbrt(hypot(1,a)), "a") \
+/*4120*/ o(FFFF1,t12"cb_h2x"     ,            -1,1,0.5,cbrt(hypot(2,a)), "a") \
+/*4121*/ o(FFFF1,t12"cb_hx1"     ,              -3,3,2,cbrt(hypot(a,1)), "a") \
+/*4122*/ o(FFFF1,t12"cb_hx2"     ,            -1,1,0.5,cbrt(hypot(a,2)), "a") \
+/*4123*/ o(FFFF1,t12"cb_i"       ,           0.5,2,0.5,cbrt(imag(a)), "a") \
+/*4124*/ o(FFFF2,t12"cb_iatd"    ,          0.5,1,0.25,cbrt(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4125*/ o(FFFF2,t12"cb_ih"      ,           0.5,2,0.5,cbrt(1/hypot(a,b)), "a,b") \
+/*4126*/ o(FFFF1,t12"cb_ih1x"    ,              -3,3,2,cbrt(1/hypot(1,a)), "a") \
+/*4127*/ o(FFFF1,t12"cb_ih2x"    ,            -1,1,0.5,cbrt(1/hypot(2,a)), "a") \
+/*4128*/ o(FFFF1,t12"cb_ihx1"    ,              -3,3,2,cbrt(1/hypot(a,1)), "a") \
+/*4129*/ o(FFFF1,t12"cb_ihx2"    ,            -1,1,0.5,cbrt(1/hypot(a,2)), "a") \
+/*4130*/ o(FFFF1,t12"cb_j"       ,              -3,3,2,cbrt(conj(a)), "a") \
+/*4131*/ o(FFFF1,t12"cb_l"       ,              -3,3,2,cbrt(log(a)), "a") \
+/*4132*/ o(FFFF1,t12"cb_l2"      ,              -3,3,2,cbrt(log2(a)), "a") \
+/*4133*/ o(FFFF1,t12"cb_lt"      ,              -3,3,2,cbrt(log10(a)), "a") \
+/*4134*/ o(FFFF1,t12"cb_o"       ,              -3,3,2,cbrt(cot(a)), "a") \
+/*4135*/ o(FFFF2,t12"cb_p"       ,              -3,3,2,cbrt(pow(a,b)), "a,b") \
+/*4136*/ o(FFFF2,t12"cb_po"      ,           0.5,2,0.5,cbrt(polar(a,b)), "a,b") \
+/*4137*/ o(FFFF1,t12"cb_r"       ,           0.5,2,0.5,cbrt(real(a)), "a") \
+/*4138*/ o(FFFF1,t12"cb_s"       ,              -3,3,2,cbrt(sin(a)), "a") \
+/*4139*/ o(FFFF1,t12"cb_sh"      ,              -3,3,2,cbrt(sinh(a)), "a") \
+/*4140*/ o(FFFF1,t12"cb_sq"      ,              -3,3,2,cbrt(sqrt(a)), "a") \
+/*4141*/ o(FFFF1,t12"cb_t"       ,              -3,3,2,cbrt(tan(a)), "a") \
+/*4142*/ o(FFFF1,t12"cb_th"      ,              -3,3,2,cbrt(tanh(a)), "a") \
+/*4143*/ o(FFFF1,t12"ch_ac"      ,              -3,3,2,cosh(acos(a)), "a") \
+/*4144*/ o(FFFF1,t12"ch_ach"     ,              -3,3,2,cosh(acosh(a)), "a") \
+/*4145*/ o(FFFF1,t12"ch_as"      ,              -3,3,2,cosh(asin(a)), "a") \
+/*4146*/ o(FFFF1,t12"ch_ash"     ,              -3,3,2,cosh(asinh(a)), "a") \
+/*4147*/ o(FFFF1,t12"ch_at"      ,              -3,3,2,cosh(atan(a)), "a") \
+/*4148*/ o(FFFF2,t12"ch_atd"     ,          0.5,1,0.25,cosh(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4149*/ o(FFFF1,t12"ch_atn"     ,              -2,2,2,cosh(atan(-abs(a))), "a") \
+/*4150*/ o(FFFF1,t12"ch_atp"     ,              -2,2,2,cosh(atan(abs(a))), "a") \
+/*4151*/ o(FFFF1,t12"ch_cb"      ,              -3,3,2,cosh(cbrt(a)), "a") \
+/*4152*/ o(FFFF1,t12"ch_g"       ,              -3,3,2,cosh(arg(a)), "a") \
+/*4153*/ o(FFFF2,t12"ch_h"       ,           0.5,2,0.5,cosh(hypot(a,b)), "a,b") \
+/*4154*/ o(FFFF1,t12"ch_h1x"     ,              -3,3,2,cosh(hypot(1,a)), "a") \
+/*4155*/ o(FFFF1,t12"ch_h2x"     ,            -1,1,0.5,cosh(hypot(2,a)), "a") \
+/*4156*/ o(FFFF1,t12"ch_hx1"     ,              -3,3,2,cosh(hypot(a,1)), "a") \
+/*4157*/ o(FFFF1,t12"ch_hx2"     ,            -1,1,0.5,cosh(hypot(a,2)), "a") \
+/*4158*/ o(FFFF1,t12"ch_i"       ,            -2,2,0.5,cosh(imag(a)), "a") \
+/*4159*/ o(FFFF2,t12"ch_iatd"    ,          0.5,1,0.25,cosh(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4160*/ o(FFFF2,t12"ch_ih"      ,           0.5,2,0.5,cosh(1/hypot(a,b)), "a,b") \
+/*4161*/ o(FFFF1,t12"ch_ih1x"    ,              -3,3,2,cosh(1/hypot(1,a)), "a") \
+/*4162*/ o(FFFF1,t12"ch_ih2x"    ,            -1,1,0.5,cosh(1/hypot(2,a)), "a") \
+/*4163*/ o(FFFF1,t12"ch_ihx1"    ,              -3,3,2,cosh(1/hypot(a,1)), "a") \
+/*4164*/ o(FFFF1,t12"ch_ihx2"    ,            -1,1,0.5,cosh(1/hypot(a,2)), "a") \
+/*4165*/ o(FFFF1,t12"ch_j"       ,            -2,2,0.5,cosh(conj(a)), "a") \
+/*4166*/ o(FFFF1,t12"ch_l"       ,              -3,3,2,cosh(log(a)), "a") \
+/*4167*/ o(FFFF1,t12"ch_l2"      ,              -3,3,2,cosh(log2(a)), "a") \
+/*4168*/ o(FFFF1,t12"ch_lt"      ,              -3,3,2,cosh(log10(a)), "a") \
+/*4169*/ o(FFFF2,t12"ch_po"      ,            -2,2,0.5,cosh(polar(a,b)), "a,b") \
+/*4170*/ o(FFFF1,t12"ch_r"       ,            -2,2,0.5,cosh(real(a)), "a") \
+/*4171*/ o(FFFF1,t12"ch_sq"      ,              -3,3,2,cosh(sqrt(a)), "a") \
+/*4172*/ o(FFFF1,t12"ch_t"       ,              -3,3,2,cosh(tan(a)), "a") \
+/*4173*/ o(FFFF1,t12"ch_th"      ,              -3,3,2,cosh(tanh(a)), "a") \
+/*4174*/ o(FFFF1,t12"e2_ac"      ,              -3,3,2,exp2(acos(a)), "a") \
+/*4175*/ o(FFFF1,t12"e2_ach"     ,              -3,3,2,exp2(acosh(a)), "a") \
+/*4176*/ o(FFFF1,t12"e2_as"      ,              -3,3,2,exp2(asin(a)), "a") \
+/*4177*/ o(FFFF1,t12"e2_ash"     ,              -3,3,2,exp2(asinh(a)), "a") \
+/*4178*/ o(FFFF1,t12"e2_at"      ,              -3,3,2,exp2(atan(a)), "a") \
+/*4179*/ o(FFFF2,t12"e2_atd"     ,          0.5,1,0.25,exp2(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4180*/ o(FFFF1,t12"e2_atn"     ,              -2,2,2,exp2(atan(-abs(a))), "a") \
+/*4181*/ o(FFFF1,t12"e2_atp"     ,              -2,2,2,exp2(atan(abs(a))), "a") \
+/*4182*/ o(FFFF1,t12"e2_cb"      ,              -3,3,2,exp2(cbrt(a)), "a") \
+/*4183*/ o(FFFF1,t12"e2_g"       ,              -3,3,2,exp2(arg(a)), "a") \
+/*4184*/ o(FFFF2,t12"e2_h"       ,           0.5,2,0.5,exp2(hypot(a,b)), "a,b") \
+/*4185*/ o(FFFF1,t12"e2_h1x"     ,              -3,3,2,exp2(hypot(1,a)), "a") \
+/*4186*/ o(FFFF1,t12"e2_h2x"     ,            -1,1,0.5,exp2(hypot(2,a)), "a") \
+/*4187*/ o(FFFF1,t12"e2_hx1"     ,              -3,3,2,exp2(hypot(a,1)), "a") \
+/*4188*/ o(FFFF1,t12"e2_hx2"     ,            -1,1,0.5,exp2(hypot(a,2)), "a") \
+/*4189*/ o(FFFF1,t12"e2_i"       ,            -2,2,0.5,exp2(imag(a)), "a") \
+/*4190*/ o(FFFF2,t12"e2_iatd"    ,          0.5,1,0.25,exp2(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4191*/ o(FFFF2,t12"e2_ih"      ,           0.5,2,0.5,exp2(1/hypot(a,b)), "a,b") \
+/*4192*/ o(FFFF1,t12"e2_ih1x"    ,              -3,3,2,exp2(1/hypot(1,a)), "a") \
+/*4193*/ o(FFFF1,t12"e2_ih2x"    ,            -1,1,0.5,exp2(1/hypot(2,a)), "a") \
+/*4194*/ o(FFFF1,t12"e2_ihx1"    ,              -3,3,2,exp2(1/hypot(a,1)), "a") \
+/*4195*/ o(FFFF1,t12"e2_ihx2"    ,            -1,1,0.5,exp2(1/hypot(a,2)), "a") \
+/*4196*/ o(FFFF1,t12"e2_j"       ,            -2,2,0.5,exp2(conj(a)), "a") \
+/*4197*/ o(FFFF1,t12"e2_l"       ,              -3,3,2,exp2(log(a)), "a") \
+/*4198*/ o(FFFF1,t12"e2_l2"      ,              -3,3,2,exp2(log2(a)), "a") \
+/*4199*/ o(FFFF1,t12"e2_lt"      ,              -3,3,2,exp2(log10(a)), "a") \
+/*4200*/ o(FFFF2,t12"e2_po"      ,            -2,2,0.5,exp2(polar(a,b)), "a,b") \
+/*4201*/ o(FFFF1,t12"e2_r"       ,            -2,2,0.5,exp2(real(a)), "a") \
+/*4202*/ o(FFFF1,t12"e2_sq"      ,              -3,3,2,exp2(sqrt(a)), "a") \
+/*4203*/ o(FFFF1,t12"e2_t"       ,              -3,3,2,exp2(tan(a)), "a") \
+/*4204*/ o(FFFF1,t12"e2_th"      ,              -3,3,2,exp2(tanh(a)), "a") \
+/*4205*/ o(FFFF1,t12"e_ac"       ,              -3,3,2,sec(acos(a)), "a") \
+/*4206*/ o(FFFF1,t12"e_ach"      ,              -3,3,2,sec(acosh(a)), "a") \
+/*4207*/ o(FFFF1,t12"e_as"       ,              -3,3,2,sec(asin(a)), "a") \
+/*4208*/ o(FFFF1,t12"e_ash"      ,              -3,3,2,sec(asinh(a)), "a") \
+/*4209*/ o(FFFF1,t12"e_at"       ,              -3,3,2,sec(atan(a)), "a") \
+/*4210*/ o(FFFF2,t12"e_atd"      ,          0.5,1,0.25,sec(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4211*/ o(FFFF1,t12"e_atn"      ,              -2,2,2,sec(atan(-abs(a))), "a") \
+/*4212*/ o(FFFF1,t12"e_atp"      ,              -2,2,2,sec(atan(abs(a))), "a") \
+/*4213*/ o(FFFF1,t12"e_cb"       ,              -3,3,2,sec(cbrt(a)), "a") \
+/*4214*/ o(FFFF1,t12"e_g"        ,              -3,3,2,sec(arg(a)), "a") \
+/*4215*/ o(FFFF2,t12"e_h"        ,           0.5,2,0.5,sec(hypot(a,b)), "a,b") \
+/*4216*/ o(FFFF1,t12"e_h1x"      ,              -3,3,2,sec(hypot(1,a)), "a") \
+/*4217*/ o(FFFF1,t12"e_h2x"      ,            -1,1,0.5,sec(hypot(2,a)), "a") \
+/*4218*/ o(FFFF1,t12"e_hx1"      ,              -3,3,2,sec(hypot(a,1)), "a") \
+/*4219*/ o(FFFF1,t12"e_hx2"      ,            -1,1,0.5,sec(hypot(a,2)), "a") \
+/*4220*/ o(FFFF1,t12"e_i"        ,            -2,2,0.5,sec(imag(a)), "a") \
+/*4221*/ o(FFFF2,t12"e_iatd"     ,          0.5,1,0.25,sec(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4222*/ o(FFFF2,t12"e_ih"       ,           0.5,2,0.5,sec(1/hypot(a,b)), "a,b") \
+/*4223*/ o(FFFF1,t12"e_ih1x"     ,              -3,3,2,sec(1/hypot(1,a)), "a") \
+/*4224*/ o(FFFF1,t12"e_ih2x"     ,            -1,1,0.5,sec(1/hypot(2,a)), "a") \
+/*4225*/ o(FFFF1,t12"e_ihx1"     ,              -3,3,2,sec(1/hypot(a,1)), "a") \
+/*4226*/ o(FFFF1,t12"e_ihx2"     ,            -1,1,0.5,sec(1/hypot(a,2)), "a") \
+/*4227*/ o(FFFF1,t12"e_j"        ,            -2,2,0.5,sec(conj(a)), "a") \
+/*4228*/ o(FFFF1,t12"e_l"        ,              -3,3,2,sec(log(a)), "a") \
+/*4229*/ o(FFFF1,t12"e_l2"       ,              -3,3,2,sec(log2(a)), "a") \
+/*4230*/ o(FFFF1,t12"e_lt"       ,              -3,3,2,sec(log10(a)), "a") \
+/*4231*/ o(FFFF2,t12"e_po"       ,            -2,2,0.5,sec(polar(a,b)), "a,b") \
+/*4232*/ o(FFFF1,t12"e_r"        ,            -2,2,0.5,sec(real(a)), "a") \
+/*4233*/ o(FFFF1,t12"e_sq"       ,              -3,3,2,sec(sqrt(a)), "a") \
+/*4234*/ o(FFFF1,t12"e_t"        ,              -3,3,2,sec(tan(a)), "a") \
+/*4235*/ o(FFFF1,t12"e_th"       ,              -3,3,2,sec(tanh(a)), "a") \
+/*4236*/ o(FFFF1,t12"ex_ac"      ,              -3,3,2,exp(acos(a)), "a") \
+/*4237*/ o(FFFF1,t12"ex_ach"     ,              -3,3,2,exp(acosh(a)), "a") \
+/*4238*/ o(FFFF1,t12"ex_as"      ,              -3,3,2,exp(asin(a)), "a") \
+/*4239*/ o(FFFF1,t12"ex_ash"     ,              -3,3,2,exp(asinh(a)), "a") \
+/*4240*/ o(FFFF1,t12"ex_at"      ,              -3,3,2,exp(atan(a)), "a") \
+/*4241*/ o(FFFF2,t12"ex_atd"     ,          0.5,1,0.25,exp(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4242*/ o(FFFF1,t12"ex_atn"     ,              -2,2,2,exp(atan(-abs(a))), "a") \
+/*4243*/ o(FFFF1,t12"ex_atp"     ,              -2,2,2,exp(atan(abs(a))), "a") \
+/*4244*/ o(FFFF1,t12"ex_cb"      ,              -3,3,2,exp(cbrt(a)), "a") \
+/*4245*/ o(FFFF1,t12"ex_g"       ,              -3,3,2,exp(arg(a)), "a") \
+/*4246*/ o(FFFF2,t12"ex_h"       ,           0.5,2,0.5,exp(hypot(a,b)), "a,b") \
+/*4247*/ o(FFFF1,t12"ex_h1x"     ,              -3,3,2,exp(hypot(1,a)), "a") \
+/*4248*/ o(FFFF1,t12"ex_h2x"     ,            -1,1,0.5,exp(hypot(2,a)), "a") \
+/*4249*/ o(FFFF1,t12"ex_hx1"     ,              -3,3,2,exp(hypot(a,1)), "a") \
+/*4250*/ o(FFFF1,t12"ex_hx2"     ,            -1,1,0.5,exp(hypot(a,2)), "a") \
+/*4251*/ o(FFFF1,t12"ex_i"       ,            -2,2,0.5,exp(imag(a)), "a") \
+/*4252*/ o(FFFF2,t12"ex_iatd"    ,          0.5,1,0.25,exp(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4253*/ o(FFFF2,t12"ex_ih"      ,           0.5,2,0.5,exp(1/hypot(a,b)), "a,b") \
+/*4254*/ o(FFFF1,t12"ex_ih1x"    ,              -3,3,2,exp(1/hypot(1,a)), "a") \
+/*4255*/ o(FFFF1,t12"ex_ih2x"    ,            -1,1,0.5,exp(1/hypot(2,a)), "a") \
+/*4256*/ o(FFFF1,t12"ex_ihx1"    ,              -3,3,2,exp(1/hypot(a,1)), "a") \
+/*4257*/ o(FFFF1,t12"ex_ihx2"    ,            -1,1,0.5,exp(1/hypot(a,2)), "a") \
+/*4258*/ o(FFFF1,t12"ex_j"       ,            -2,2,0.5,exp(conj(a)), "a") \
+/*4259*/ o(FFFF1,t12"ex_l"       ,              -3,3,2,exp(log(a)), "a") \
+/*4260*/ o(FFFF1,t12"ex_l2"      ,              -3,3,2,exp(log2(a)), "a") \
+/*4261*/ o(FFFF1,t12"ex_lt"      ,              -3,3,2,exp(log10(a)), "a") \
+/*4262*/ o(FFFF2,t12"ex_po"      ,            -2,2,0.5,exp(polar(a,b)), "a,b") \
+/*4263*/ o(FFFF1,t12"ex_r"       ,            -2,2,0.5,exp(real(a)), "a") \
+/*4264*/ o(FFFF1,t12"ex_sq"      ,              -3,3,2,exp(sqrt(a)), "a") \
+/*4265*/ o(FFFF1,t12"ex_t"       ,              -3,3,2,exp(tan(a)), "a") \
+/*4266*/ o(FFFF1,t12"ex_th"      ,              -3,3,2,exp(tanh(a)), "a") \
+/*4267*/ o(FFFF1,t12"g_a"        ,              -3,3,2,arg(csc(a)), "a") \
+/*4268*/ o(FFFF1,t12"g_ac"       ,              -3,3,2,arg(acos(a)), "a") \
+/*4269*/ o(FFFF1,t12"g_ach"      ,              -3,3,2,arg(acosh(a)), "a") \
+/*4270*/ o(FFFF1,t12"g_as"       ,              -3,3,2,arg(asin(a)), "a") \
+/*4271*/ o(FFFF1,t12"g_ash"      ,              -3,3,2,arg(asinh(a)), "a") \
+/*4272*/ o(FFFF1,t12"g_at"       ,              -3,3,2,arg(atan(a)), "a") \
+/*4273*/ o(FFFF2,t12"g_atd"      ,          0.5,1,0.25,arg(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4274*/ o(FFFF1,t12"g_ath"      ,       0.25,3.25,0.5,arg(atanh(a)), "a") \
+/*4275*/ o(FFFF1,t12"g_atp"      ,              -3,3,2,arg(atan(abs((a+-0.4)))), "a") \
+/*4276*/ o(FFFF1,t12"g_b"        ,              -3,3,2,arg(abs(a)), "a") \
+/*4277*/ o(FFFF1,t12"g_c"        ,            -1,1,0.5,arg(cos(a)), "a") \
+/*4278*/ o(FFFF1,t12"g_cb"       ,              -3,3,2,arg(cbrt(a)), "a") \
+/*4279*/ o(FFFF1,t12"g_ch"       ,            -1,1,0.5,arg(cosh(a)), "a") \
+/*4280*/ o(FFFF2,t12"g_chl"      ,            -2,2,0.5,arg(cosh(a!=b)), "a,b") \
+/*4281*/ o(FFFF2,t12"g_cl"       ,            -2,2,0.5,arg(cos(a!=b)), "a,b") \
+/*4282*/ o(FFFF1,t12"g_e"        ,            -1,1,0.5,arg(sec(a)), "a") \
+/*4283*/ o(FFFF1,t12"g_e2"       ,            -2,2,0.5,arg(exp2(a)), "a") \
+/*4284*/ o(FFFF2,t12"g_e2l"      ,            -2,2,0.5,arg(exp2(a!=b)), "a,b") \
+/*4285*/ o(FFFF2,t12"g_el"       ,            -2,2,0.5,arg(sec(a!=b)), "a,b") \
+/*4286*/ o(FFFF1,t12"g_ex"       ,            -2,2,0.5,arg(exp(a)), "a") \
+/*4287*/ o(FFFF2,t12"g_exl"      ,            -2,2,0.5,arg(exp(a!=b)), "a,b") \
+/*4288*/ o(FFFF1,t12"g_g"        ,           0.5,2,0.5,arg(arg(a)), "a") \
+/*4289*/ o(FFFF2,t12"g_h"        ,           0.5,2,0.5,arg(hypot(a,b)), "a,b") \
+/*4290*/ o(FFFF1,t12"g_h1x"      ,              -3,3,2,arg(hypot(1,a)), "a") \
+/*4291*/ o(FFFF1,t12"g_h2x"      ,            -1,1,0.5,arg(hypot(2,a)), "a") \
+/*4292*/ o(FFFF1,t12"g_hx1"      ,              -3,3,2,arg(hypot(a,1)), "a") \
+/*4293*/ o(FFFF1,t12"g_hx2"      ,            -1,1,0.5,arg(hypot(a,2)), "a") \
+/*4294*/ o(FFFF1,t12"g_i"        ,           0.5,2,0.5,arg(imag(a)), "a") \
+/*4295*/ o(FFFF2,t12"g_iatd"     ,          0.5,1,0.25,arg(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4296*/ o(FFFF2,t12"g_ih"       ,           0.5,2,0.5,arg(1/hypot(a,b)), "a,b") \
+/*4297*/ o(FFFF1,t12"g_ih1x"     ,              -3,3,2,arg(1/hypot(1,a)), "a") \
+/*4298*/ o(FFFF1,t12"g_ih2x"     ,            -1,1,0.5,arg(1/hypot(2,a)), "a") \
+/*4299*/ o(FFFF1,t12"g_ihx1"     ,              -3,3,2,arg(1/hypot(a,1)), "a") \
+/*4300*/ o(FFFF1,t12"g_ihx2"     ,            -1,1,0.5,arg(1/hypot(a,2)), "a") \
+/*4301*/ o(FFFF1,t12"g_j"        ,              -3,3,2,arg(conj(a)), "a") \
+/*4302*/ o(FFFF1,t12"g_l"        ,              -3,3,2,arg(log(a)), "a") \
+/*4303*/ o(FFFF1,t12"g_l2"       ,              -3,3,2,arg(log2(a)), "a") \
+/*4304*/ o(FFFF1,t12"g_lt"       ,              -3,3,2,arg(log10(a)), "a") \
+/*4305*/ o(FFFF1,t12"g_o"        ,              -3,3,2,arg(cot(a)), "a") \
+/*4306*/ o(FFFF2,t12"g_p"        ,              -3,3,2,arg(pow(a,b)), "a,b") \
+/*4307*/ o(FFFF2,t12"g_po"       ,              -3,3,2,arg(polar(a,b)), "a,b") \
+/*4308*/ o(FFFF1,t12"g_r"        ,           0.5,2,0.5,arg(real(a)), "a") \
+/*4309*/ o(FFFF1,t12"g_s"        ,              -3,3,2,arg(sin(a)), "a") \
+/*4310*/ o(FFFF1,t12"g_sh"       ,              -3,3,2,arg(sinh(a)), "a") \
+/*4311*/ o(FFFF1,t12"g_sq"       ,              -3,3,2,arg(sqrt(a)), "a") \
+/*4312*/ o(FFFF1,t12"g_t"        ,              -3,3,2,arg(tan(a)), "a") \
+/*4313*/ o(FFFF1,t12"g_th"       ,              -3,3,2,arg(tanh(a)), "a") \
+/*4314*/ o(FFFF1,t12"i_a"        ,              -3,3,2,imag(csc(a)), "a") \
+/*4315*/ o(FFFF1,t12"i_ac"       ,              -3,3,2,imag(acos(a)), "a") \
+/*4316*/ o(FFFF1,t12"i_ach"      ,              -3,3,2,imag(acosh(a)), "a") \
+/*4317*/ o(FFFF1,t12"i_as"       ,              -3,3,2,imag(asin(a)), "a") \
+/*4318*/ o(FFFF1,t12"i_ash"      ,              -3,3,2,imag(asinh(a)), "a") \
+/*4319*/ o(FFFF2,t12"i_ashl"     ,            -2,2,0.5,imag(asinh(a!=b)), "a,b") \
+/*4320*/ o(FFFF1,t12"i_at"       ,              -3,3,2,imag(atan(a)), "a") \
+/*4321*/ o(FFFF2,t12"i_atd"      ,          0.5,1,0.25,imag(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4322*/ o(FFFF1,t12"i_ath"      ,     -0.75,0.75,0.25,imag(atanh(a)), "a") \
+/*4323*/ o(FFFF2,t12"i_atl"      ,            -2,2,0.5,imag(atan(a!=b)), "a,b") \
+/*4324*/ o(FFFF1,t12"i_atn"      ,              -2,2,2,imag(atan(-abs(a))), "a") \
+/*4325*/ o(FFFF1,t12"i_atp"      ,              -2,2,2,imag(atan(abs(a))), "a") \
+/*4326*/ o(FFFF1,t12"i_b"        ,            -2,2,0.5,imag(abs(a)), "a") \
+/*4327*/ o(FFFF1,t12"i_c"        ,            -2,2,0.5,imag(cos(a)), "a") \
+/*4328*/ o(FFFF1,t12"i_cb"       ,              -3,3,2,imag(cbrt(a)), "a") \
+/*4329*/ o(FFFF1,t12"i_ch"       ,            -2,2,0.5,imag(cosh(a)), "a") \
+/*4330*/ o(FFFF2,t12"i_chl"      ,            -2,2,0.5,imag(cosh(a!=b)), "a,b") \
+/*4331*/ o(FFFF2,t12"i_cl"       ,            -2,2,0.5,imag(cos(a!=b)), "a,b") \
+/*4332*/ o(FFFF1,t12"i_e"        ,            -2,2,0.5,imag(sec(a)), "a") \
+/*4333*/ o(FFFF1,t12"i_e2"       ,            -2,2,0.5,imag(exp2(a)), "a") \
+/*4334*/ o(FFFF2,t12"i_e2l"      ,            -2,2,0.5,imag(exp2(a!=b)), "a,b") \
+/*4335*/ o(FFFF2,t12"i_el"       ,            -2,2,0.5,imag(sec(a!=b)), "a,b") \
+/*4336*/ o(FFFF2,t12"i_eq"       ,            -2,2,0.5,imag(a=b), "a,b") \
+/*4337*/ o(FFFF1,t12"i_ex"       ,            -2,2,0.5,imag(exp(a)), "a") \
+/*4338*/ o(FFFF2,t12"i_exl"      ,            -2,2,0.5,imag(exp(a!=b)), "a,b") \
+/*4339*/ o(FFFF1,t12"i_g"        ,              -3,3,2,imag(arg(a)), "a") \
+/*4340*/ o(FFFF2,t12"i_h"        ,           0.5,2,0.5,imag(hypot(a,b)), "a,b") \
+/*4341*/ o(FFFF1,t12"i_h1x"      ,              -3,3,2,imag(hypot(1,a)), "a") \
+/*4342*/ o(FFFF1,t12"i_h2x"      ,            -1,1,0.5,imag(hypot(2,a)), "a") \
+/*4343*/ o(FFFF1,t12"i_hx1"      ,              -3,3,2,imag(hypot(a,1)), "a") \
+/*4344*/ o(FFFF1,t12"i_hx2"      ,            -1,1,0.5,imag(hypot(a,2)), "a") \
+/*4345*/ o(FFFF1,t12"i_i"        ,            -2,2,0.5,imag(imag(a)), "a") \
+/*4346*/ o(FFFF2,t12"i_iatd"     ,          0.5,1,0.25,imag(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4347*/ o(FFFF2,t12"i_ih"       ,           0.5,2,0.5,imag(1/hypot(a,b)), "a,b") \
+/*4348*/ o(FFFF1,t12"i_ih1x"     ,              -3,3,2,imag(1/hypot(1,a)), "a") \
+/*4349*/ o(FFFF1,t12"i_ih2x"     ,            -1,1,0.5,imag(1/hypot(2,a)), "a") \
+/*4350*/ o(FFFF1,t12"i_ihx1"     ,              -3,3,2,imag(1/hypot(a,1)), "a") \
+/*4351*/ o(FFFF1,t12"i_ihx2"     ,            -1,1,0.5,imag(1/hypot(a,2)), "a") \
+/*4352*/ o(FFFF1,t12"i_j"        ,            -2,2,0.5,imag(conj(a)), "a") \
+/*4353*/ o(FFFF1,t12"i_l"        ,              -3,3,2,imag(log(a)), "a") \
+/*4354*/ o(FFFF1,t12"i_l2"       ,              -3,3,2,imag(log2(a)), "a") \
+/*4355*/ o(FFFF1,t12"i_lt"       ,              -3,3,2,imag(log10(a)), "a") \
+/*4356*/ o(FFFF2,t12"i_ne"       ,            -2,2,0.5,imag(a!=b), "a,b") \
+/*4357*/ o(FFFF1,t12"i_o"        ,              -3,3,2,imag(cot(a)), "a") \
+/*4358*/ o(FFFF2,t12"i_p"        ,              -3,3,2,imag(pow(a,b)), "a,b") \
+/*4359*/ o(FFFF2,t12"i_po"       ,            -2,2,0.5,imag(polar(a,b)), "a,b") \
+/*4360*/ o(FFFF1,t12"i_r"        ,            -2,2,0.5,imag(real(a)), "a") \
+/*4361*/ o(FFFF1,t12"i_s"        ,            -2,2,0.5,imag(sin(a)), "a") \
+/*4362*/ o(FFFF1,t12"i_sh"       ,            -2,2,0.5,imag(sinh(a)), "a") \
+/*4363*/ o(FFFF2,t12"i_shl"      ,            -2,2,0.5,imag(sinh(a!=b)), "a,b") \
+/*4364*/ o(FFFF2,t12"i_sl"       ,            -2,2,0.5,imag(sin(a!=b)), "a,b") \
+/*4365*/ o(FFFF1,t12"i_sq"       ,              -3,3,2,imag(sqrt(a)), "a") \
+/*4366*/ o(FFFF1,t12"i_t"        ,              -3,3,2,imag(tan(a)), "a") \
+/*4367*/ o(FFFF1,t12"i_th"       ,              -3,3,2,imag(tanh(a)), "a") \
+/*4368*/ o(FFFF1,t12"j_a"        ,              -3,3,2,conj(csc(a)), "a") \
+/*4369*/ o(FFFF1,t12"j_ac"       ,              -3,3,2,conj(acos(a)), "a") \
+/*4370*/ o(FFFF1,t12"j_ach"      ,              -3,3,2,conj(acosh(a)), "a") \
+/*4371*/ o(FFFF1,t12"j_as"       ,              -3,3,2,conj(asin(a)), "a") \
+/*4372*/ o(FFFF1,t12"j_ash"      ,              -3,3,2,conj(asinh(a)), "a") \
+/*4373*/ o(FFFF2,t12"j_ashl"     ,            -2,2,0.5,conj(asinh(a!=b)), "a,b") \
+/*4374*/ o(FFFF1,t12"j_at"       ,              -3,3,2,conj(atan(a)), "a") \
+/*4375*/ o(FFFF2,t12"j_atd"      ,          0.5,1,0.25,conj(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4376*/ o(FFFF1,t12"j_ath"      ,     -0.75,0.75,0.25,conj(atanh(a)), "a") \
+/*4377*/ o(FFFF2,t12"j_atl"      ,            -2,2,0.5,conj(atan(a!=b)), "a,b") \
+/*4378*/ o(FFFF1,t12"j_atn"      ,              -2,2,2,conj(atan(-abs(a))), "a") \
+/*4379*/ o(FFFF1,t12"j_atp"      ,              -2,2,2,conj(atan(abs(a))), "a") \
+/*4380*/ o(FFFF1,t12"j_b"        ,            -2,2,0.5,conj(abs(a)), "a") \
+/*4381*/ o(FFFF1,t12"j_c"        ,            -2,2,0.5,conj(cos(a)), "a") \
+/*4382*/ o(FFFF1,t12"j_cb"       ,              -3,3,2,conj(cbrt(a)), "a") \
+/*4383*/ o(FFFF1,t12"j_ch"       ,            -2,2,0.5,conj(cosh(a)), "a") \
+/*4384*/ o(FFFF2,t12"j_chl"      ,            -2,2,0.5,conj(cosh(a!=b)), "a,b") \
+/*4385*/ o(FFFF2,t12"j_cl"       ,            -2,2,0.5,conj(cos(a!=b)), "a,b") \
+/*4386*/ o(FFFF1,t12"j_e"        ,            -2,2,0.5,conj(sec(a)), "a") \
+/*4387*/ o(FFFF1,t12"j_e2"       ,            -2,2,0.5,conj(exp2(a)), "a") \
+/*4388*/ o(FFFF2,t12"j_e2l"      ,            -2,2,0.5,conj(exp2(a!=b)), "a,b") \
+/*4389*/ o(FFFF2,t12"j_el"       ,            -2,2,0.5,conj(sec(a!=b)), "a,b") \
+/*4390*/ o(FFFF2,t12"j_eq"       ,            -2,2,0.5,conj(a=b), "a,b") \
+/*4391*/ o(FFFF1,t12"j_ex"       ,            -2,2,0.5,conj(exp(a)), "a") \
+/*4392*/ o(FFFF2,t12"j_exl"      ,            -2,2,0.5,conj(exp(a!=b)), "a,b") \
+/*4393*/ o(FFFF1,t12"j_g"        ,              -3,3,2,conj(arg(a)), "a") \
+/*4394*/ o(FFFF2,t12"j_h"        ,           0.5,2,0.5,conj(hypot(a,b)), "a,b") \
+/*4395*/ o(FFFF1,t12"j_h1x"      ,              -3,3,2,conj(hypot(1,a)), "a") \
+/*4396*/ o(FFFF1,t12"j_h2x"      ,            -1,1,0.5,conj(hypot(2,a)), "a") \
+/*4397*/ o(FFFF1,t12"j_hx1"      ,              -3,3,2,conj(hypot(a,1)), "a") \
+/*4398*/ o(FFFF1,t12"j_hx2"      ,            -1,1,0.5,conj(hypot(a,2)), "a") \
+/*4399*/ o(FFFF1,t12"j_i"        ,            -2,2,0.5,conj(imag(a)), "a") \
+/*4400*/ o(FFFF2,t12"j_iatd"     ,          0.5,1,0.25,conj(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4401*/ o(FFFF2,t12"j_ih"       ,           0.5,2,0.5,conj(1/hypot(a,b)), "a,b") \
+/*4402*/ o(FFFF1,t12"j_ih1x"     ,              -3,3,2,conj(1/hypot(1,a)), "a") \
+/*4403*/ o(FFFF1,t12"j_ih2x"     ,            -1,1,0.5,conj(1/hypot(2,a)), "a") \
+/*4404*/ o(FFFF1,t12"j_ihx1"     ,              -3,3,2,conj(1/hypot(a,1)), "a") \
+/*4405*/ o(FFFF1,t12"j_ihx2"     ,            -1,1,0.5,conj(1/hypot(a,2)), "a") \
+/*4406*/ o(FFFF1,t12"j_j"        ,            -2,2,0.5,conj(conj(a)), "a") \
+/*4407*/ o(FFFF1,t12"j_l"        ,              -3,3,2,conj(log(a)), "a") \
+/*4408*/ o(FFFF1,t12"j_l2"       ,              -3,3,2,conj(log2(a)), "a") \
+/*4409*/ o(FFFF1,t12"j_lt"       ,              -3,3,2,conj(log10(a)), "a") \
+/*4410*/ o(FFFF2,t12"j_ne"       ,            -2,2,0.5,conj(a!=b), "a,b") \
+/*4411*/ o(FFFF1,t12"j_o"        ,              -3,3,2,conj(cot(a)), "a") \
+/*4412*/ o(FFFF2,t12"j_p"        ,              -3,3,2,conj(pow(a,b)), "a,b") \
+/*4413*/ o(FFFF2,t12"j_po"       ,            -2,2,0.5,conj(polar(a,b)), "a,b") \
+/*4414*/ o(FFFF1,t12"j_r"        ,            -2,2,0.5,conj(real(a)), "a") \
+/*4415*/ o(FFFF1,t12"j_s"        ,            -2,2,0.5,conj(sin(a)), "a") \
+/*4416*/ o(FFFF1,t12"j_sh"       ,            -2,2,0.5,conj(sinh(a)), "a") \
+/*4417*/ o(FFFF2,t12"j_shl"      ,            -2,2,0.5,conj(sinh(a!=b)), "a,b") \
+/*4418*/ o(FFFF2,t12"j_sl"       ,            -2,2,0.5,conj(sin(a!=b)), "a,b") \
+/*4419*/ o(FFFF1,t12"j_sq"       ,              -3,3,2,conj(sqrt(a)), "a") \
+/*4420*/ o(FFFF1,t12"j_t"        ,              -3,3,2,conj(tan(a)), "a") \
+/*4421*/ o(FFFF1,t12"j_th"       ,              -3,3,2,conj(tanh(a)), "a") \
+/*4422*/ o(FFFF1,t12"l2_a"       ,              -3,3,2,log2(csc(a)), "a") \
+/*4423*/ o(FFFF1,t12"l2_ac"      ,              -3,3,2,log2(acos(a)), "a") \
+/*4424*/ o(FFFF1,t12"l2_ach"     ,              -3,3,2,log2(acosh(a)), "a") \
+/*4425*/ o(FFFF1,t12"l2_as"      ,              -3,3,2,log2(asin(a)), "a") \
+/*4426*/ o(FFFF1,t12"l2_ash"     ,              -3,3,2,log2(asinh(a)), "a") \
+/*4427*/ o(FFFF1,t12"l2_at"      ,              -3,3,2,log2(atan(a)), "a") \
+/*4428*/ o(FFFF2,t12"l2_atd"     ,          0.5,1,0.25,log2(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4429*/ o(FFFF1,t12"l2_ath"     ,       0.25,3.25,0.5,log2(atanh(a)), "a") \
+/*4430*/ o(FFFF1,t12"l2_atp"     ,              -3,3,2,log2(atan(abs((a+-0.4)))), "a") \
+/*4431*/ o(FFFF1,t12"l2_cb"      ,              -3,3,2,log2(cbrt(a)), "a") \
+/*4432*/ o(FFFF1,t12"l2_ch"      ,            -1,1,0.5,log2(cosh(a)), "a") \
+/*4433*/ o(FFFF1,t12"l2_e2"      ,              -2,2,2,log2(exp2(a)), "a") \
+/*4434*/ o(FFFF1,t12"l2_g"       ,           0.5,2,0.5,log2(arg(a)), "a") \
+/*4435*/ o(FFFF2,t12"l2_h"       ,           0.5,2,0.5,log2(hypot(a,b)), "a,b") \
+/*4436*/ o(FFFF1,t12"l2_h1x"     ,              -3,3,2,log2(hypot(1,a)), "a") \
+/*4437*/ o(FFFF1,t12"l2_h2x"     ,            -1,1,0.5,log2(hypot(2,a)), "a") \
+/*4438*/ o(FFFF1,t12"l2_hx1"     ,              -3,3,2,log2(hypot(a,1)), "a") \
+/*4439*/ o(FFFF1,t12"l2_hx2"     ,            -1,1,0.5,log2(hypot(a,2)), "a") \
+/*4440*/ o(FFFF1,t12"l2_i"       ,           0.5,2,0.5,log2(imag(a)), "a") \
+/*4441*/ o(FFFF2,t12"l2_iatd"    ,          0.5,1,0.25,log2(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4442*/ o(FFFF2,t12"l2_ih"      ,           0.5,2,0.5,log2(1/hypot(a,b)), "a,b") \
+/*4443*/ o(FFFF1,t12"l2_ih1x"    ,              -3,3,2,log2(1/hypot(1,a)), "a") \
+/*4444*/ o(FFFF1,t12"l2_ih2x"    ,            -1,1,0.5,log2(1/hypot(2,a)), "a") \
+/*4445*/ o(FFFF1,t12"l2_ihx1"    ,              -3,3,2,log2(1/hypot(a,1)), "a") \
+/*4446*/ o(FFFF1,t12"l2_ihx2"    ,            -1,1,0.5,log2(1/hypot(a,2)), "a") \
+/*4447*/ o(FFFF1,t12"l2_j"       ,              -3,3,2,log2(conj(a)), "a") \
+/*4448*/ o(FFFF1,t12"l2_l"       ,              -3,3,2,log2(log(a)), "a") \
+/*4449*/ o(FFFF1,t12"l2_l2"      ,              -3,3,2,log2(log2(a)), "a") \
+/*4450*/ o(FFFF1,t12"l2_lt"      ,              -3,3,2,log2(log10(a)), "a") \
+/*4451*/ o(FFFF1,t12"l2_o"       ,              -3,3,2,log2(cot(a)), "a") \
+/*4452*/ o(FFFF2,t12"l2_p"       ,              -3,3,2,log2(pow(a,b)), "a,b") \
+/*4453*/ o(FFFF2,t12"l2_po"      ,           0.5,2,0.5,log2(polar(a,b)), "a,b") \
+/*4454*/ o(FFFF1,t12"l2_r"       ,           0.5,2,0.5,log2(real(a)), "a") \
+/*4455*/ o(FFFF1,t12"l2_s"       ,              -3,3,2,log2(sin(a)), "a") \
+/*4456*/ o(FFFF1,t12"l2_sh"      ,              -3,3,2,log2(sinh(a)), "a") \
+/*4457*/ o(FFFF1,t12"l2_sq"      ,              -3,3,2,log2(sqrt(a)), "a") \
+/*4458*/ o(FFFF1,t12"l2_t"       ,              -3,3,2,log2(tan(a)), "a") \
+/*4459*/ o(FFFF1,t12"l2_th"      ,              -3,3,2,log2(tanh(a)), "a") \
+/*4460*/ o(FFFF1,t12"l_a"        ,              -3,3,2,log(csc(a)), "a") \
+/*4461*/ o(FFFF1,t12"l_ac"       ,              -3,3,2,log(acos(a)), "a") \
+/*4462*/ o(FFFF1,t12"l_ach"      ,              -3,3,2,log(acosh(a)), "a") \
+/*4463*/ o(FFFF1,t12"l_as"       ,              -3,3,2,log(asin(a)), "a") \
+/*4464*/ o(FFFF1,t12"l_ash"      ,              -3,3,2,log(asinh(a)), "a") \
+/*4465*/ o(FFFF1,t12"l_at"       ,              -3,3,2,log(atan(a)), "a") \
+/*4466*/ o(FFFF2,t12"l_atd"      ,          0.5,1,0.25,log(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4467*/ o(FFFF1,t12"l_ath"      ,       0.25,3.25,0.5,log(atanh(a)), "a") \
+/*4468*/ o(FFFF1,t12"l_atp"      ,              -3,3,2,log(atan(abs((a+-0.4)))), "a") \
+/*4469*/ o(FFFF1,t12"l_cb"       ,              -3,3,2,log(cbrt(a)), "a") \
+/*4470*/ o(FFFF1,t12"l_ch"       ,            -1,1,0.5,log(cosh(a)), "a") \
+/*4471*/ o(FFFF1,t12"l_e2"       ,              -2,2,2,log(exp2(a)), "a") \
+/*4472*/ o(FFFF1,t12"l_g"        ,           0.5,2,0.5,log(arg(a)), "a") \
+/*4473*/ o(FFFF2,t12"l_h"        ,           0.5,2,0.5,log(hypot(a,b)), "a,b") \
+/*4474*/ o(FFFF1,t12"l_h1x"      ,              -3,3,2,log(hypot(1,a)), "a") \
+/*4475*/ o(FFFF1,t12"l_h2x"      ,            -1,1,0.5,log(hypot(2,a)), "a") \
+/*4476*/ o(FFFF1,t12"l_hx1"      ,              -3,3,2,log(hypot(a,1)), "a") \
+/*4477*/ o(FFFF1,t12"l_hx2"      ,            -1,1,0.5,log(hypot(a,2)), "a") \
+/*4478*/ o(FFFF1,t12"l_i"        ,           0.5,2,0.5,log(imag(a)), "a") \
+/*4479*/ o(FFFF2,t12"l_iatd"     ,          0.5,1,0.25,log(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4480*/ o(FFFF2,t12"l_ih"       ,           0.5,2,0.5,log(1/hypot(a,b)), "a,b") \
+/*4481*/ o(FFFF1,t12"l_ih1x"     ,              -3,3,2,log(1/hypot(1,a)), "a") \
+/*4482*/ o(FFFF1,t12"l_ih2x"     ,            -1,1,0.5,log(1/hypot(2,a)), "a") \
+/*4483*/ o(FFFF1,t12"l_ihx1"     ,              -3,3,2,log(1/hypot(a,1)), "a") \
+/*4484*/ o(FFFF1,t12"l_ihx2"     ,            -1,1,0.5,log(1/hypot(a,2)), "a") \
+/*4485*/ o(FFFF1,t12"l_j"        ,              -3,3,2,log(conj(a)), "a") \
+/*4486*/ o(FFFF1,t12"l_l"        ,              -3,3,2,log(log(a)), "a") \
+/*4487*/ o(FFFF1,t12"l_l2"       ,              -3,3,2,log(log2(a)), "a") \
+/*4488*/ o(FFFF1,t12"l_lt"       ,              -3,3,2,log(log10(a)), "a") \
+/*4489*/ o(FFFF1,t12"l_o"        ,              -3,3,2,log(cot(a)), "a") \
+/*4490*/ o(FFFF2,t12"l_p"        ,              -3,3,2,log(pow(a,b)), "a,b") \
+/*4491*/ o(FFFF2,t12"l_po"       ,           0.5,2,0.5,log(polar(a,b)), "a,b") \
+/*4492*/ o(FFFF1,t12"l_r"        ,           0.5,2,0.5,log(real(a)), "a") \
+/*4493*/ o(FFFF1,t12"l_s"        ,              -3,3,2,log(sin(a)), "a") \
+/*4494*/ o(FFFF1,t12"l_sh"       ,              -3,3,2,log(sinh(a)), "a") \
+/*4495*/ o(FFFF1,t12"l_sq"       ,              -3,3,2,log(sqrt(a)), "a") \
+/*4496*/ o(FFFF1,t12"l_t"        ,              -3,3,2,log(tan(a)), "a") \
+/*4497*/ o(FFFF1,t12"l_th"       ,              -3,3,2,log(tanh(a)), "a") \
+/*4498*/ o(FFFF1,t12"lt_a"       ,              -3,3,2,log10(csc(a)), "a") \
+/*4499*/ o(FFFF1,t12"lt_ac"      ,              -3,3,2,log10(acos(a)), "a") \
+/*4500*/ o(FFFF1,t12"lt_ach"     ,              -3,3,2,log10(acosh(a)), "a") \
+/*4501*/ o(FFFF1,t12"lt_as"      ,              -3,3,2,log10(asin(a)), "a") \
+/*4502*/ o(FFFF1,t12"lt_ash"     ,              -3,3,2,log10(asinh(a)), "a") \
+/*4503*/ o(FFFF1,t12"lt_at"      ,              -3,3,2,log10(atan(a)), "a") \
+/*4504*/ o(FFFF2,t12"lt_atd"     ,          0.5,1,0.25,log10(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4505*/ o(FFFF1,t12"lt_ath"     ,       0.25,3.25,0.5,log10(atanh(a)), "a") \
+/*4506*/ o(FFFF1,t12"lt_atp"     ,              -3,3,2,log10(atan(abs((a+-0.4)))), "a") \
+/*4507*/ o(FFFF1,t12"lt_cb"      ,              -3,3,2,log10(cbrt(a)), "a") \
+/*4508*/ o(FFFF1,t12"lt_ch"      ,            -1,1,0.5,log10(cosh(a)), "a") \
+/*4509*/ o(FFFF1,t12"lt_e2"      ,              -2,2,2,log10(exp2(a)), "a") \
+/*4510*/ o(FFFF1,t12"lt_g"       ,           0.5,2,0.5,log10(arg(a)), "a") \
+/*4511*/ o(FFFF2,t12"lt_h"       ,           0.5,2,0.5,log10(hypot(a,b)), "a,b") \
+/*4512*/ o(FFFF1,t12"lt_h1x"     ,              -3,3,2,log10(hypot(1,a)), "a") \
+/*4513*/ o(FFFF1,t12"lt_h2x"     ,            -1,1,0.5,log10(hypot(2,a)), "a") \
+/*4514*/ o(FFFF1,t12"lt_hx1"     ,              -3,3,2,log10(hypot(a,1)), "a") \
+/*4515*/ o(FFFF1,t12"lt_hx2"     ,            -1,1,0.5,log10(hypot(a,2)), "a") \
+/*4516*/ o(FFFF1,t12"lt_i"       ,           0.5,2,0.5,log10(imag(a)), "a") \
+/*4517*/ o(FFFF2,t12"lt_iatd"    ,          0.5,1,0.25,log10(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4518*/ o(FFFF2,t12"lt_ih"      ,           0.5,2,0.5,log10(1/hypot(a,b)), "a,b") \
+/*4519*/ o(FFFF1,t12"lt_ih1x"    ,              -3,3,2,log10(1/hypot(1,a)), "a") \
+/*4520*/ o(FFFF1,t12"lt_ih2x"    ,            -1,1,0.5,log10(1/hypot(2,a)), "a") \
+/*4521*/ o(FFFF1,t12"lt_ihx1"    ,              -3,3,2,log10(1/hypot(a,1)), "a") \
+/*4522*/ o(FFFF1,t12"lt_ihx2"    ,            -1,1,0.5,log10(1/hypot(a,2)), "a") \
+/*4523*/ o(FFFF1,t12"lt_j"       ,              -3,3,2,log10(conj(a)), "a") \
+/*4524*/ o(FFFF1,t12"lt_l"       ,              -3,3,2,log10(log(a)), "a") \
+/*4525*/ o(FFFF1,t12"lt_l2"      ,              -3,3,2,log10(log2(a)), "a") \
+/*4526*/ o(FFFF1,t12"lt_lt"      ,              -3,3,2,log10(log10(a)), "a") \
+/*4527*/ o(FFFF1,t12"lt_o"       ,              -3,3,2,log10(cot(a)), "a") \
+/*4528*/ o(FFFF2,t12"lt_p"       ,              -3,3,2,log10(pow(a,b)), "a,b") \
+/*4529*/ o(FFFF2,t12"lt_po"      ,           0.5,2,0.5,log10(polar(a,b)), "a,b") \
+/*4530*/ o(FFFF1,t12"lt_r"       ,           0.5,2,0.5,log10(real(a)), "a") \
+/*4531*/ o(FFFF1,t12"lt_s"       ,              -3,3,2,log10(sin(a)), "a") \
+/*4532*/ o(FFFF1,t12"lt_sh"      ,              -3,3,2,log10(sinh(a)), "a") \
+/*4533*/ o(FFFF1,t12"lt_sq"      ,              -3,3,2,log10(sqrt(a)), "a") \
+/*4534*/ o(FFFF1,t12"lt_t"       ,              -3,3,2,log10(tan(a)), "a") \
+/*4535*/ o(FFFF1,t12"lt_th"      ,              -3,3,2,log10(tanh(a)), "a") \
+/*4536*/ o(FFFF1,t12"o_ac"       ,              -3,3,2,cot(acos(a)), "a") \
+/*4537*/ o(FFFF1,t12"o_ach"      ,              -3,3,2,cot(acosh(a)), "a") \
+/*4538*/ o(FFFF1,t12"o_as"       ,              -3,3,2,cot(asin(a)), "a") \
+/*4539*/ o(FFFF2,t12"o_atd"      ,          0.5,1,0.25,cot(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4540*/ o(FFFF1,t12"o_ath"      ,       0.25,3.25,0.5,cot(atanh(a)), "a") \
+/*4541*/ o(FFFF1,t12"o_atn"      ,              -3,3,2,cot(atan(-abs((a+-0.4)))), "a") \
+/*4542*/ o(FFFF1,t12"o_atp"      ,              -3,3,2,cot(atan(abs((a+-0.4)))), "a") \
+/*4543*/ o(FFFF1,t12"o_cb"       ,              -3,3,2,cot(cbrt(a)), "a") \
+/*4544*/ o(FFFF1,t12"o_g"        ,              -3,3,2,cot(arg(a)), "a") \
+/*4545*/ o(FFFF2,t12"o_h"        ,           0.5,2,0.5,cot(hypot(a,b)), "a,b") \
+/*4546*/ o(FFFF1,t12"o_h1x"      ,              -3,3,2,cot(hypot(1,a)), "a") \
+/*4547*/ o(FFFF1,t12"o_h2x"      ,            -1,1,0.5,cot(hypot(2,a)), "a") \
+/*4548*/ o(FFFF1,t12"o_hx1"      ,              -3,3,2,cot(hypot(a,1)), "a") \
+/*4549*/ o(FFFF1,t12"o_hx2"      ,            -1,1,0.5,cot(hypot(a,2)), "a") \
+/*4550*/ o(FFFF1,t12"o_i"        ,              -3,3,2,cot(imag(a)), "a") \
+/*4551*/ o(FFFF2,t12"o_iatd"     ,          0.5,1,0.25,cot(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4552*/ o(FFFF2,t12"o_ih"       ,           0.5,2,0.5,cot(1/hypot(a,b)), "a,b") \
+/*4553*/ o(FFFF1,t12"o_ih1x"     ,              -3,3,2,cot(1/hypot(1,a)), "a") \
+/*4554*/ o(FFFF1,t12"o_ih2x"     ,            -1,1,0.5,cot(1/hypot(2,a)), "a") \
+/*4555*/ o(FFFF1,t12"o_ihx1"     ,              -3,3,2,cot(1/hypot(a,1)), "a") \
+/*4556*/ o(FFFF1,t12"o_ihx2"     ,            -1,1,0.5,cot(1/hypot(a,2)), "a") \
+/*4557*/ o(FFFF1,t12"o_j"        ,              -3,3,2,cot(conj(a)), "a") \
+/*4558*/ o(FFFF1,t12"o_l"        ,              -3,3,2,cot(log(a)), "a") \
+/*4559*/ o(FFFF1,t12"o_l2"       ,              -3,3,2,cot(log2(a)), "a") \
+/*4560*/ o(FFFF1,t12"o_lt"       ,              -3,3,2,cot(log10(a)), "a") \
+/*4561*/ o(FFFF2,t12"o_po"       ,              -3,3,2,cot(polar(a,b)), "a,b") \
+/*4562*/ o(FFFF1,t12"o_r"        ,              -3,3,2,cot(real(a)), "a") \
+/*4563*/ o(FFFF1,t12"o_sq"       ,              -3,3,2,cot(sqrt(a)), "a") \
+/*4564*/ o(FFFF1,t12"r_a"        ,              -3,3,2,real(csc(a)), "a") \
+/*4565*/ o(FFFF1,t12"r_ac"       ,              -3,3,2,real(acos(a)), "a") \
+/*4566*/ o(FFFF1,t12"r_ach"      ,              -3,3,2,real(acosh(a)), "a") \
+/*4567*/ o(FFFF1,t12"r_as"       ,              -3,3,2,real(asin(a)), "a") \
+/*4568*/ o(FFFF1,t12"r_ash"      ,              -3,3,2,real(asinh(a)), "a") \
+/*4569*/ o(FFFF2,t12"r_ashl"     ,            -2,2,0.5,real(asinh(a!=b)), "a,b") \
+/*4570*/ o(FFFF1,t12"r_at"       ,              -3,3,2,real(atan(a)), "a") \
+/*4571*/ o(FFFF2,t12"r_atd"      ,          0.5,1,0.25,real(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4572*/ o(FFFF1,t12"r_ath"      ,     -0.75,0.75,0.25,real(atanh(a)), "a") \
+/*4573*/ o(FFFF2,t12"r_atl"      ,            -2,2,0.5,real(atan(a!=b)), "a,b") \
+/*4574*/ o(FFFF1,t12"r_atn"      ,              -2,2,2,real(atan(-abs(a))), "a") \
+/*4575*/ o(FFFF1,t12"r_atp"      ,              -2,2,2,real(atan(abs(a))), "a") \
+/*4576*/ o(FFFF1,t12"r_b"        ,            -2,2,0.5,real(abs(a)), "a") \
+/*4577*/ o(FFFF1,t12"r_c"        ,            -2,2,0.5,real(cos(a)), "a") \
+/*4578*/ o(FFFF1,t12"r_cb"       ,              -3,3,2,real(cbrt(a)), "a") \
+/*4579*/ o(FFFF1,t12"r_ch"       ,            -2,2,0.5,real(cosh(a)), "a") \
+/*4580*/ o(FFFF2,t12"r_chl"      ,            -2,2,0.5,real(cosh(a!=b)), "a,b") \
+/*4581*/ o(FFFF2,t12"r_cl"       ,            -2,2,0.5,real(cos(a!=b)), "a,b") \
+/*4582*/ o(FFFF1,t12"r_e"        ,            -2,2,0.5,real(sec(a)), "a") \
+/*4583*/ o(FFFF1,t12"r_e2"       ,            -2,2,0.5,real(exp2(a)), "a") \
+/*4584*/ o(FFFF2,t12"r_e2l"      ,            -2,2,0.5,real(exp2(a!=b)), "a,b") \
+/*4585*/ o(FFFF2,t12"r_el"       ,            -2,2,0.5,real(sec(a!=b)), "a,b") \
+/*4586*/ o(FFFF2,t12"r_eq"       ,            -2,2,0.5,real(a=b), "a,b") \
+/*4587*/ o(FFFF1,t12"r_ex"       ,            -2,2,0.5,real(exp(a)), "a") \
+/*4588*/ o(FFFF2,t12"r_exl"      ,            -2,2,0.5,real(exp(a!=b)), "a,b") \
+/*4589*/ o(FFFF1,t12"r_g"        ,              -3,3,2,real(arg(a)), "a") \
+/*4590*/ o(FFFF2,t12"r_h"        ,           0.5,2,0.5,real(hypot(a,b)), "a,b") \
+/*4591*/ o(FFFF1,t12"r_h1x"      ,              -3,3,2,real(hypot(1,a)), "a") \
+/*4592*/ o(FFFF1,t12"r_h2x"      ,            -1,1,0.5,real(hypot(2,a)), "a") \
+/*4593*/ o(FFFF1,t12"r_hx1"      ,              -3,3,2,real(hypot(a,1)), "a") \
+/*4594*/ o(FFFF1,t12"r_hx2"      ,            -1,1,0.5,real(hypot(a,2)), "a") \
+/*4595*/ o(FFFF1,t12"r_i"        ,            -2,2,0.5,real(imag(a)), "a") \
+/*4596*/ o(FFFF2,t12"r_iatd"     ,          0.5,1,0.25,real(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4597*/ o(FFFF2,t12"r_ih"       ,           0.5,2,0.5,real(1/hypot(a,b)), "a,b") \
+/*4598*/ o(FFFF1,t12"r_ih1x"     ,              -3,3,2,real(1/hypot(1,a)), "a") \
+/*4599*/ o(FFFF1,t12"r_ih2x"     ,            -1,1,0.5,real(1/hypot(2,a)), "a") \
+/*4600*/ o(FFFF1,t12"r_ihx1"     ,              -3,3,2,real(1/hypot(a,1)), "a") \
+/*4601*/ o(FFFF1,t12"r_ihx2"     ,            -1,1,0.5,real(1/hypot(a,2)), "a") \
+/*4602*/ o(FFFF1,t12"r_j"        ,            -2,2,0.5,real(conj(a)), "a") \
+/*4603*/ o(FFFF1,t12"r_l"        ,              -3,3,2,real(log(a)), "a") \
+/*4604*/ o(FFFF1,t12"r_l2"       ,              -3,3,2,real(log2(a)), "a") \
+/*4605*/ o(FFFF1,t12"r_lt"       ,              -3,3,2,real(log10(a)), "a") \
+/*4606*/ o(FFFF2,t12"r_ne"       ,            -2,2,0.5,real(a!=b), "a,b") \
+/*4607*/ o(FFFF1,t12"r_o"        ,              -3,3,2,real(cot(a)), "a") \
+/*4608*/ o(FFFF2,t12"r_p"        ,              -3,3,2,real(pow(a,b)), "a,b") \
+/*4609*/ o(FFFF2,t12"r_po"       ,            -2,2,0.5,real(polar(a,b)), "a,b") \
+/*4610*/ o(FFFF1,t12"r_r"        ,            -2,2,0.5,real(real(a)), "a") \
+/*4611*/ o(FFFF1,t12"r_s"        ,            -2,2,0.5,real(sin(a)), "a") \
+/*4612*/ o(FFFF1,t12"r_sh"       ,            -2,2,0.5,real(sinh(a)), "a") \
+/*4613*/ o(FFFF2,t12"r_shl"      ,            -2,2,0.5,real(sinh(a!=b)), "a,b") \
+/*4614*/ o(FFFF2,t12"r_sl"       ,            -2,2,0.5,real(sin(a!=b)), "a,b") \
+/*4615*/ o(FFFF1,t12"r_sq"       ,              -3,3,2,real(sqrt(a)), "a") \
+/*4616*/ o(FFFF1,t12"r_t"        ,              -3,3,2,real(tan(a)), "a") \
+/*4617*/ o(FFFF1,t12"r_th"       ,              -3,3,2,real(tanh(a)), "a") \
+/*4618*/ o(FFFF1,t12"s_ac"       ,              -3,3,2,sin(acos(a)), "a") \
+/*4619*/ o(FFFF1,t12"s_ach"      ,              -3,3,2,sin(acosh(a)), "a") \
+/*4620*/ o(FFFF1,t12"s_as"       ,              -3,3,2,sin(asin(a)), "a") \
+/*4621*/ o(FFFF1,t12"s_ash"      ,              -3,3,2,sin(asinh(a)), "a") \
+/*4622*/ o(FFFF1,t12"s_at"       ,              -3,3,2,sin(atan(a)), "a") \
+/*4623*/ o(FFFF2,t12"s_atd"      ,          0.5,1,0.25,sin(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4624*/ o(FFFF1,t12"s_atn"      ,              -2,2,2,sin(atan(-abs(a))), "a") \
+/*4625*/ o(FFFF1,t12"s_atp"      ,              -2,2,2,sin(atan(abs(a))), "a") \
+/*4626*/ o(FFFF1,t12"s_cb"       ,              -3,3,2,sin(cbrt(a)), "a") \
+/*4627*/ o(FFFF1,t12"s_g"        ,              -3,3,2,sin(arg(a)), "a") \
+/*4628*/ o(FFFF2,t12"s_h"        ,           0.5,2,0.5,sin(hypot(a,b)), "a,b") \
+/*4629*/ o(FFFF1,t12"s_h1x"      ,              -3,3,2,sin(hypot(1,a)), "a") \
+/*4630*/ o(FFFF1,t12"s_h2x"      ,            -1,1,0.5,sin(hypot(2,a)), "a") \
+/*4631*/ o(FFFF1,t12"s_hx1"      ,              -3,3,2,sin(hypot(a,1)), "a") \
+/*4632*/ o(FFFF1,t12"s_hx2"      ,            -1,1,0.5,sin(hypot(a,2)), "a") \
+/*4633*/ o(FFFF1,t12"s_i"        ,            -2,2,0.5,sin(imag(a)), "a") \
+/*4634*/ o(FFFF2,t12"s_iatd"     ,          0.5,1,0.25,sin(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4635*/ o(FFFF2,t12"s_ih"       ,           0.5,2,0.5,sin(1/hypot(a,b)), "a,b") \
+/*4636*/ o(FFFF1,t12"s_ih1x"     ,              -3,3,2,sin(1/hypot(1,a)), "a") \
+/*4637*/ o(FFFF1,t12"s_ih2x"     ,            -1,1,0.5,sin(1/hypot(2,a)), "a") \
+/*4638*/ o(FFFF1,t12"s_ihx1"     ,              -3,3,2,sin(1/hypot(a,1)), "a") \
+/*4639*/ o(FFFF1,t12"s_ihx2"     ,            -1,1,0.5,sin(1/hypot(a,2)), "a") \
+/*4640*/ o(FFFF1,t12"s_j"        ,            -2,2,0.5,sin(conj(a)), "a") \
+/*4641*/ o(FFFF1,t12"s_l"        ,              -3,3,2,sin(log(a)), "a") \
+/*4642*/ o(FFFF1,t12"s_l2"       ,              -3,3,2,sin(log2(a)), "a") \
+/*4643*/ o(FFFF1,t12"s_lt"       ,              -3,3,2,sin(log10(a)), "a") \
+/*4644*/ o(FFFF2,t12"s_po"       ,            -2,2,0.5,sin(polar(a,b)), "a,b") \
+/*4645*/ o(FFFF1,t12"s_r"        ,            -2,2,0.5,sin(real(a)), "a") \
+/*4646*/ o(FFFF1,t12"s_sq"       ,              -3,3,2,sin(sqrt(a)), "a") \
+/*4647*/ o(FFFF1,t12"s_t"        ,              -3,3,2,sin(tan(a)), "a") \
+/*4648*/ o(FFFF1,t12"s_th"       ,              -3,3,2,sin(tanh(a)), "a") \
+/*4649*/ o(FFFF1,t12"sh_ac"      ,              -3,3,2,sinh(acos(a)), "a") \
+/*4650*/ o(FFFF1,t12"sh_ach"     ,              -3,3,2,sinh(acosh(a)), "a") \
+/*4651*/ o(FFFF1,t12"sh_as"      ,              -3,3,2,sinh(asin(a)), "a") \
+/*4652*/ o(FFFF1,t12"sh_ash"     ,              -3,3,2,sinh(asinh(a)), "a") \
+/*4653*/ o(FFFF1,t12"sh_at"      ,              -3,3,2,sinh(atan(a)), "a") \
+/*4654*/ o(FFFF2,t12"sh_atd"     ,          0.5,1,0.25,sinh(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4655*/ o(FFFF1,t12"sh_atn"     ,              -2,2,2,sinh(atan(-abs(a))), "a") \
+/*4656*/ o(FFFF1,t12"sh_atp"     ,              -2,2,2,sinh(atan(abs(a))), "a") \
+/*4657*/ o(FFFF1,t12"sh_cb"      ,              -3,3,2,sinh(cbrt(a)), "a") \
+/*4658*/ o(FFFF1,t12"sh_g"       ,              -3,3,2,sinh(arg(a)), "a") \
+/*4659*/ o(FFFF2,t12"sh_h"       ,           0.5,2,0.5,sinh(hypot(a,b)), "a,b") \
+/*4660*/ o(FFFF1,t12"sh_h1x"     ,              -3,3,2,sinh(hypot(1,a)), "a") \
+/*4661*/ o(FFFF1,t12"sh_h2x"     ,            -1,1,0.5,sinh(hypot(2,a)), "a") \
+/*4662*/ o(FFFF1,t12"sh_hx1"     ,              -3,3,2,sinh(hypot(a,1)), "a") \
+/*4663*/ o(FFFF1,t12"sh_hx2"     ,            -1,1,0.5,sinh(hypot(a,2)), "a") \
+/*4664*/ o(FFFF1,t12"sh_i"       ,            -2,2,0.5,sinh(imag(a)), "a") \
+/*4665*/ o(FFFF2,t12"sh_iatd"    ,          0.5,1,0.25,sinh(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4666*/ o(FFFF2,t12"sh_ih"      ,           0.5,2,0.5,sinh(1/hypot(a,b)), "a,b") \
+/*4667*/ o(FFFF1,t12"sh_ih1x"    ,              -3,3,2,sinh(1/hypot(1,a)), "a") \
+/*4668*/ o(FFFF1,t12"sh_ih2x"    ,            -1,1,0.5,sinh(1/hypot(2,a)), "a") \
+/*4669*/ o(FFFF1,t12"sh_ihx1"    ,              -3,3,2,sinh(1/hypot(a,1)), "a") \
+/*4670*/ o(FFFF1,t12"sh_ihx2"    ,            -1,1,0.5,sinh(1/hypot(a,2)), "a") \
+/*4671*/ o(FFFF1,t12"sh_j"       ,            -2,2,0.5,sinh(conj(a)), "a") \
+/*4672*/ o(FFFF1,t12"sh_l"       ,              -3,3,2,sinh(log(a)), "a") \
+/*4673*/ o(FFFF1,t12"sh_l2"      ,              -3,3,2,sinh(log2(a)), "a") \
+/*4674*/ o(FFFF1,t12"sh_lt"      ,              -3,3,2,sinh(log10(a)), "a") \
+/*4675*/ o(FFFF2,t12"sh_po"      ,            -2,2,0.5,sinh(polar(a,b)), "a,b") \
+/*4676*/ o(FFFF1,t12"sh_r"       ,            -2,2,0.5,sinh(real(a)), "a") \
+/*4677*/ o(FFFF1,t12"sh_sq"      ,              -3,3,2,sinh(sqrt(a)), "a") \
+/*4678*/ o(FFFF1,t12"sh_t"       ,              -3,3,2,sinh(tan(a)), "a") \
+/*4679*/ o(FFFF1,t12"sh_th"      ,              -3,3,2,sinh(tanh(a)), "a") \
+/*4680*/ o(FFFF1,t12"sq_a"       ,              -3,3,2,sqrt(csc(a)), "a") \
+/*4681*/ o(FFFF1,t12"sq_ac"      ,              -3,3,2,sqrt(acos(a)), "a") \
+/*4682*/ o(FFFF1,t12"sq_ach"     ,              -3,3,2,sqrt(acosh(a)), "a") \
+/*4683*/ o(FFFF1,t12"sq_as"      ,              -3,3,2,sqrt(asin(a)), "a") \
+/*4684*/ o(FFFF1,t12"sq_ash"     ,              -3,3,2,sqrt(asinh(a)), "a") \
+/*4685*/ o(FFFF1,t12"sq_at"      ,              -3,3,2,sqrt(atan(a)), "a") \
+/*4686*/ o(FFFF2,t12"sq_atd"     ,          0.5,1,0.25,sqrt(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4687*/ o(FFFF1,t12"sq_ath"     ,       0.25,3.25,0.5,sqrt(atanh(a)), "a") \
+/*4688*/ o(FFFF1,t12"sq_atp"     ,              -3,3,2,sqrt(atan(abs((a+-0.4)))), "a") \
+/*4689*/ o(FFFF1,t12"sq_b"       ,              -3,3,2,sqrt(abs(a)), "a") \
+/*4690*/ o(FFFF1,t12"sq_cb"      ,              -3,3,2,sqrt(cbrt(a)), "a") \
+/*4691*/ o(FFFF1,t12"sq_ch"      ,            -1,1,0.5,sqrt(cosh(a)), "a") \
+/*4692*/ o(FFFF1,t12"sq_e2"      ,              -2,2,2,sqrt(exp2(a)), "a") \
+/*4693*/ o(FFFF1,t12"sq_g"       ,           0.5,2,0.5,sqrt(arg(a)), "a") \
+/*4694*/ o(FFFF2,t12"sq_h"       ,           0.5,2,0.5,sqrt(hypot(a,b)), "a,b") \
+/*4695*/ o(FFFF1,t12"sq_h1x"     ,              -3,3,2,sqrt(hypot(1,a)), "a") \
+/*4696*/ o(FFFF1,t12"sq_h2x"     ,            -1,1,0.5,sqrt(hypot(2,a)), "a") \
+/*4697*/ o(FFFF1,t12"sq_hx1"     ,              -3,3,2,sqrt(hypot(a,1)), "a") \
+/*4698*/ o(FFFF1,t12"sq_hx2"     ,            -1,1,0.5,sqrt(hypot(a,2)), "a") \
+/*4699*/ o(FFFF1,t12"sq_i"       ,           0.5,2,0.5,sqrt(imag(a)), "a") \
+/*4700*/ o(FFFF2,t12"sq_iatd"    ,          0.5,1,0.25,sqrt(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4701*/ o(FFFF2,t12"sq_ih"      ,           0.5,2,0.5,sqrt(1/hypot(a,b)), "a,b") \
+/*4702*/ o(FFFF1,t12"sq_ih1x"    ,              -3,3,2,sqrt(1/hypot(1,a)), "a") \
+/*4703*/ o(FFFF1,t12"sq_ih2x"    ,            -1,1,0.5,sqrt(1/hypot(2,a)), "a") \
+/*4704*/ o(FFFF1,t12"sq_ihx1"    ,              -3,3,2,sqrt(1/hypot(a,1)), "a") \
+/*4705*/ o(FFFF1,t12"sq_ihx2"    ,            -1,1,0.5,sqrt(1/hypot(a,2)), "a") \
+/*4706*/ o(FFFF1,t12"sq_j"       ,              -3,3,2,sqrt(conj(a)), "a") \
+/*4707*/ o(FFFF1,t12"sq_l"       ,              -3,3,2,sqrt(log(a)), "a") \
+/*4708*/ o(FFFF1,t12"sq_l2"      ,              -3,3,2,sqrt(log2(a)), "a") \
+/*4709*/ o(FFFF1,t12"sq_lt"      ,              -3,3,2,sqrt(log10(a)), "a") \
+/*4710*/ o(FFFF1,t12"sq_o"       ,              -3,3,2,sqrt(cot(a)), "a") \
+/*4711*/ o(FFFF2,t12"sq_p"       ,              -3,3,2,sqrt(pow(a,b)), "a,b") \
+/*4712*/ o(FFFF2,t12"sq_po"      ,           0.5,2,0.5,sqrt(polar(a,b)), "a,b") \
+/*4713*/ o(FFFF1,t12"sq_r"       ,           0.5,2,0.5,sqrt(real(a)), "a") \
+/*4714*/ o(FFFF1,t12"sq_s"       ,              -3,3,2,sqrt(sin(a)), "a") \
+/*4715*/ o(FFFF1,t12"sq_sh"      ,              -3,3,2,sqrt(sinh(a)), "a") \
+/*4716*/ o(FFFF1,t12"sq_sq"      ,              -3,3,2,sqrt(sqrt(a)), "a") \
+/*4717*/ o(FFFF1,t12"sq_t"       ,              -3,3,2,sqrt(tan(a)), "a") \
+/*4718*/ o(FFFF1,t12"sq_th"      ,              -3,3,2,sqrt(tanh(a)), "a") \
+/*4719*/ o(FFFF1,t12"t_ac"       ,              -3,3,2,tan(acos(a)), "a") \
+/*4720*/ o(FFFF1,t12"t_ach"      ,              -3,3,2,tan(acosh(a)), "a") \
+/*4721*/ o(FFFF1,t12"t_as"       ,              -3,3,2,tan(asin(a)), "a") \
+/*4722*/ o(FFFF1,t12"t_ash"      ,              -3,3,2,tan(asinh(a)), "a") \
+/*4723*/ o(FFFF1,t12"t_at"       ,              -3,3,2,tan(atan(a)), "a") \
+/*4724*/ o(FFFF2,t12"t_atd"      ,          0.5,1,0.25,tan(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4725*/ o(FFFF1,t12"t_ath"      ,       0.25,3.25,0.5,tan(atanh(a)), "a") \
+/*4726*/ o(FFFF1,t12"t_atn"      ,              -3,3,2,tan(atan(-abs((a+-0.4)))), "a") \
+/*4727*/ o(FFFF1,t12"t_atp"      ,              -3,3,2,tan(atan(abs((a+-0.4)))), "a") \
+/*4728*/ o(FFFF1,t12"t_b"        ,              -3,3,2,tan(abs(a)), "a") \
+/*4729*/ o(FFFF1,t12"t_cb"       ,              -3,3,2,tan(cbrt(a)), "a") \
+/*4730*/ o(FFFF1,t12"t_g"        ,              -3,3,2,tan(arg(a)), "a") \
+/*4731*/ o(FFFF2,t12"t_h"        ,           0.5,2,0.5,tan(hypot(a,b)), "a,b") \
+/*4732*/ o(FFFF1,t12"t_h1x"      ,              -3,3,2,tan(hypot(1,a)), "a") \
+/*4733*/ o(FFFF1,t12"t_h2x"      ,            -1,1,0.5,tan(hypot(2,a)), "a") \
+/*4734*/ o(FFFF1,t12"t_hx1"      ,              -3,3,2,tan(hypot(a,1)), "a") \
+/*4735*/ o(FFFF1,t12"t_hx2"      ,            -1,1,0.5,tan(hypot(a,2)), "a") \
+/*4736*/ o(FFFF1,t12"t_i"        ,              -3,3,2,tan(imag(a)), "a") \
+/*4737*/ o(FFFF2,t12"t_iatd"     ,          0.5,1,0.25,tan(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4738*/ o(FFFF2,t12"t_ih"       ,           0.5,2,0.5,tan(1/hypot(a,b)), "a,b") \
+/*4739*/ o(FFFF1,t12"t_ih1x"     ,              -3,3,2,tan(1/hypot(1,a)), "a") \
+/*4740*/ o(FFFF1,t12"t_ih2x"     ,            -1,1,0.5,tan(1/hypot(2,a)), "a") \
+/*4741*/ o(FFFF1,t12"t_ihx1"     ,              -3,3,2,tan(1/hypot(a,1)), "a") \
+/*4742*/ o(FFFF1,t12"t_ihx2"     ,            -1,1,0.5,tan(1/hypot(a,2)), "a") \
+/*4743*/ o(FFFF1,t12"t_j"        ,              -3,3,2,tan(conj(a)), "a") \
+/*4744*/ o(FFFF1,t12"t_l"        ,              -3,3,2,tan(log(a)), "a") \
+/*4745*/ o(FFFF1,t12"t_l2"       ,              -3,3,2,tan(log2(a)), "a") \
+/*4746*/ o(FFFF1,t12"t_lt"       ,              -3,3,2,tan(log10(a)), "a") \
+/*4747*/ o(FFFF2,t12"t_po"       ,              -3,3,2,tan(polar(a,b)), "a,b") \
+/*4748*/ o(FFFF1,t12"t_r"        ,              -3,3,2,tan(real(a)), "a") \
+/*4749*/ o(FFFF1,t12"t_s"        ,              -3,3,2,tan(sin(a)), "a") \
+/*4750*/ o(FFFF1,t12"t_sh"       ,              -3,3,2,tan(sinh(a)), "a") \
+/*4751*/ o(FFFF1,t12"t_sq"       ,              -3,3,2,tan(sqrt(a)), "a") \
+/*4752*/ o(FFFF1,t12"t_t"        ,              -3,3,2,tan(tan(a)), "a") \
+/*4753*/ o(FFFF1,t12"t_th"       ,              -3,3,2,tan(tanh(a)), "a") \
+/*4754*/ o(FFFF1,t12"th_ac"      ,              -3,3,2,tanh(acos(a)), "a") \
+/*4755*/ o(FFFF1,t12"th_ach"     ,              -3,3,2,tanh(acosh(a)), "a") \
+/*4756*/ o(FFFF1,t12"th_as"      ,              -3,3,2,tanh(asin(a)), "a") \
+/*4757*/ o(FFFF1,t12"th_ash"     ,              -3,3,2,tanh(asinh(a)), "a") \
+/*4758*/ o(FFFF1,t12"th_at"      ,              -3,3,2,tanh(atan(a)), "a") \
+/*4759*/ o(FFFF2,t12"th_atd"     ,          0.5,1,0.25,tanh(atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4760*/ o(FFFF1,t12"th_ath"     ,       0.25,3.25,0.5,tanh(atanh(a)), "a") \
+/*4761*/ o(FFFF1,t12"th_atn"     ,              -3,3,2,tanh(atan(-abs((a+-0.4)))), "a") \
+/*4762*/ o(FFFF1,t12"th_atp"     ,              -3,3,2,tanh(atan(abs((a+-0.4)))), "a") \
+/*4763*/ o(FFFF1,t12"th_b"       ,              -3,3,2,tanh(abs(a)), "a") \
+/*4764*/ o(FFFF1,t12"th_cb"      ,              -3,3,2,tanh(cbrt(a)), "a") \
+/*4765*/ o(FFFF1,t12"th_g"       ,              -3,3,2,tanh(arg(a)), "a") \
+/*4766*/ o(FFFF2,t12"th_h"       ,           0.5,2,0.5,tanh(hypot(a,b)), "a,b") \
+/*4767*/ o(FFFF1,t12"th_h1x"     ,              -3,3,2,tanh(hypot(1,a)), "a") \
+/*4768*/ o(FFFF1,t12"th_h2x"     ,            -1,1,0.5,tanh(hypot(2,a)), "a") \
+/*4769*/ o(FFFF1,t12"th_hx1"     ,              -3,3,2,tanh(hypot(a,1)), "a") \
+/*4770*/ o(FFFF1,t12"th_hx2"     ,            -1,1,0.5,tanh(hypot(a,2)), "a") \
+/*4771*/ o(FFFF1,t12"th_i"       ,              -3,3,2,tanh(imag(a)), "a") \
+/*4772*/ o(FFFF2,t12"th_iatd"    ,          0.5,1,0.25,tanh(1/atan((a+-0.2)/(b+-0.2))), "a,b") \
+/*4773*/ o(FFFF2,t12"th_ih"      ,           0.5,2,0.5,tanh(1/hypot(a,b)), "a,b") \
+/*4774*/ o(FFFF1,t12"th_ih1x"    ,              -3,3,2,tanh(1/hypot(1,a)), "a") \
+/*4775*/ o(FFFF1,t12"th_ih2x"    ,            -1,1,0.5,tanh(1/hypot(2,a)), "a") \
+/*4776*/ o(FFFF1,t12"th_ihx1"    ,              -3,3,2,tanh(1/hypot(a,1)), "a") \
+/*4777*/ o(FFFF1,t12"th_ihx2"    ,            -1,1,0.5,tanh(1/hypot(a,2)), "a") \
+/*4778*/ o(FFFF1,t12"th_j"       ,              -3,3,2,tanh(conj(a)), "a") \
+/*4779*/ o(FFFF1,t12"th_l"       ,              -3,3,2,tanh(log(a)), "a") \
+/*4780*/ o(FFFF1,t12"th_l2"      ,              -3,3,2,tanh(log2(a)), "a") \
+/*4781*/ o(FFFF1,t12"th_lt"      ,              -3,3,2,tanh(log10(a)), "a") \
+/*4782*/ o(FFFF2,t12"th_po"      ,              -3,3,2,tanh(polar(a,b)), "a,b") \
+/*4783*/ o(FFFF1,t12"th_r"       ,              -3,3,2,tanh(real(a)), "a") \
+/*4784*/ o(FFFF1,t12"th_s"       ,              -3,3,2,tanh(sin(a)), "a") \
+/*4785*/ o(FFFF1,t12"th_sh"      ,              -3,3,2,tanh(sinh(a)), "a") \
+/*4786*/ o(FFFF1,t12"th_sq"      ,              -3,3,2,tanh(sqrt(a)), "a") \
+/*4787*/ o(FFFF1,t12"th_t"       ,              -3,3,2,tanh(tan(a)), "a") \
+/*4788*/ o(FFFF1,t12"th_th"      ,              -3,3,2,tanh(tanh(a)), "a") \
+/*4789*/ o(FFFF1,t12"z_ac"       ,              -3,3,2,acos(a), "a") \
+/*4790*/ o(FFFF1,t12"z_ach"      ,              -3,3,2,acosh(a), "a") \
+/*4791*/ o(FFFF1,t12"z_as"       ,              -3,3,2,asin(a), "a") \
+/*4792*/ o(FFFF1,t12"z_ash"      ,              -3,3,2,asinh(a), "a") \
+/*4793*/ o(FFFF1,t12"z_at"       ,              -3,3,2,atan(a), "a") \
+/*4794*/ o(FFFF2,t12"z_atd"      ,          0.5,1,0.25,atan((a+-0.2)/(b+-0.2)), "a,b") \
+/*4795*/ o(FFFF1,t12"z_atn"      ,              -2,2,2,atan(-abs(a)), "a") \
+/*4796*/ o(FFFF1,t12"z_atp"      ,              -2,2,2,atan(abs(a)), "a") \
+/*4797*/ o(FFFF1,t12"z_cb"       ,              -3,3,2,cbrt(a), "a") \
+/*4798*/ o(FFFF1,t12"z_g"        ,              -3,3,2,arg(a), "a") \
+/*4799*/ o(FFFF2,t12"z_h"        ,           0.5,2,0.5,hypot(a,b), "a,b") \
+/*4800*/ o(FFFF1,t12"z_h1x"      ,              -3,3,2,hypot(1,a), "a") \
+/*4801*/ o(FFFF1,t12"z_h2x"      ,            -1,1,0.5,hypot(2,a), "a") \
+/*4802*/ o(FFFF1,t12"z_hx1"      ,              -3,3,2,hypot(a,1), "a") \
+/*4803*/ o(FFFF1,t12"z_hx2"      ,            -1,1,0.5,hypot(a,2), "a") \
+/*4804*/ o(FFFF1,t12"z_i"        ,            -2,2,0.5,imag(a), "a") \
+/*4805*/ o(FFFF2,t12"z_iatd"     ,          0.5,1,0.25,1/atan((a+-0.2)/(b+-0.2)), "a,b") \
+/*4806*/ o(FFFF2,t12"z_ih"       ,           0.5,2,0.5,1/hypot(a,b), "a,b") \
+/*4807*/ o(FFFF1,t12"z_ih1x"     ,              -3,3,2,1/hypot(1,a), "a") \
+/*4808*/ o(FFFF1,t12"z_ih2x"     ,            -1,1,0.5,1/hypot(2,a), "a") \
+/*4809*/ o(FFFF1,t12"z_ihx1"     ,              -3,3,2,1/hypot(a,1), "a") \
+/*4810*/ o(FFFF1,t12"z_ihx2"     ,            -1,1,0.5,1/hypot(a,2), "a") \
+/*4811*/ o(FFFF1,t12"z_j"        ,            -2,2,0.5,conj(a), "a") \
+/*4812*/ o(FFFF1,t12"z_l"        ,              -3,3,2,log(a), "a") \
+/*4813*/ o(FFFF1,t12"z_l2"       ,              -3,3,2,log2(a), "a") \
+/*4814*/ o(FFFF1,t12"z_lt"       ,              -3,3,2,log10(a), "a") \
+/*4815*/ o(FFFF2,t12"z_p"        ,              -3,3,2,pow(a,b), "a,b") \
+/*4816*/ o(FFFF2,t12"z_po"       ,            -2,2,0.5,polar(a,b), "a,b") \
+/*4817*/ o(FFFF1,t12"z_r"        ,            -2,2,0.5,real(a), "a") \
+/*4818*/ o(FFFF1,t12"z_sq"       ,              -3,3,2,sqrt(a), "a") \
+/*4819*/ o(FFFF1,t12"z_t"        ,              -3,3,2,tan(a), "a") \
+/*4820*/ o(FFFF1,t12"z_th"       ,              -3,3,2,tanh(a), "a") \
+/*4821*/ o(FFFF1,t13"acos_1i"    ,              -3,3,2,acos(a*1i), "a") \
+/*4822*/ o(FFFF1,t13"acos_2"     ,              -3,3,2,acos(a*2), "a") \
+/*4823*/ o(FFFF1,t13"acos_3i"    ,              -3,3,2,acos(a*3i), "a") \
+/*4824*/ o(FFFF1,t13"acos_m1"    ,              -3,3,2,acos(a*-1), "a") \
+/*4825*/ o(FFFF1,t13"acos_m2"    ,              -3,3,2,acos(a*-2), "a") \
+/*4826*/ o(FFFF1,t13"acos_m3i"   ,              -3,3,2,acos(a*-3i), "a") \
+/*4827*/ o(FFFF1,t13"acos_mi"    ,              -3,3,2,acos(a*-1i), "a") \
+/*4828*/ o(FFFF1,t13"acosh_1i"   ,              -3,3,2,acosh(a*1i), "a") \
+/*4829*/ o(FFFF1,t13"acosh_2"    ,              -3,3,2,acosh(a*2), "a") \
+/*4830*/ o(FFFF1,t13"acosh_3i"   ,              -3,3,2,acosh(a*3i), "a") \
+/*4831*/ o(FFFF1,t13"acosh_m1"   ,              -3,3,2,acosh(a*-1), "a") \
+/*4832*/ o(FFFF1,t13"acosh_m2"   ,              -3,3,2,acosh(a*-2), "a") \
+/*4833*/ o(FFFF1,t13"acosh_m3i"  ,              -3,3,2,acosh(a*-3i), "a") \
+/*4834*/ o(FFFF1,t13"acosh_mi"   ,              -3,3,2,acosh(a*-1i), "a") \
+/*4835*/ o(FFFF1,t13"asin_1i"    ,              -3,3,2,asin(a*1i), "a") \
+/*4836*/ o(FFFF1,t13"asin_2"     ,              -3,3,2,asin(a*2), "a") \
+/*4837*/ o(FFFF1,t13"asin_3i"    ,              -3,3,2,asin(a*3i), "a") \
+/*4838*/ o(FFFF1,t13"asin_m1"    ,              -3,3,2,asin(a*-1), "a") \
+/*4839*/ o(FFFF1,t13"asin_m2"    ,              -3,3,2,asin(a*-2), "a") \
+/*4840*/ o(FFFF1,t13"asin_m3i"   ,              -3,3,2,asin(a*-3i), "a") \
+/*4841*/ o(FFFF1,t13"asin_mi"    ,              -3,3,2,asin(a*-1i), "a") \
+/*4842*/ o(FFFF1,t13"asinh_1i"   ,              -3,3,2,asinh(a*1i), "a") \
+/*4843*/ o(FFFF1,t13"asinh_2"    ,              -3,3,2,asinh(a*2), "a") \
+/*4844*/ o(FFFF1,t13"asinh_3i"   ,              -3,3,2,asinh(a*3i), "a") \
+/*4845*/ o(FFFF1,t13"asinh_m1"   ,              -3,3,2,asinh(a*-1), "a") \
+/*4846*/ o(FFFF1,t13"asinh_m2"   ,              -3,3,2,asinh(a*-2), "a") \
+/*4847*/ o(FFFF1,t13"asinh_m3i"  ,              -3,3,2,asinh(a*-3i), "a") \
+/*4848*/ o(FFFF1,t13"asinh_mi"   ,              -3,3,2,asinh(a*-1i), "a") \
+/*4849*/ o(FFFF1,t13"atan_1i"    ,              -3,3,2,atan(a*1i), "a") \
+/*4850*/ o(FFFF1,t13"atan_2"     ,              -3,3,2,atan(a*2), "a") \
+/*4851*/ o(FFFF1,t13"atan_3i"    ,              -3,3,2,atan(a*3i), "a") \
+/*4852*/ o(FFFF1,t13"atan_m1"    ,              -3,3,2,atan(a*-1), "a") \
+/*4853*/ o(FFFF1,t13"atan_m2"    ,              -3,3,2,atan(a*-2), "a") \
+/*4854*/ o(FFFF1,t13"atan_m3i"   ,              -3,3,2,atan(a*-3i), "a") \
+/*4855*/ o(FFFF1,t13"atan_mi"    ,              -3,3,2,atan(a*-1i), "a") \
+/*4856*/ o(FFFF1,t13"atanh_1i"   ,     -0.75,0.75,0.25,atanh(a*1i), "a") \
+/*4857*/ o(FFFF1,t13"atanh_2"    ,              -3,3,2,atanh(a*2), "a") \
+/*4858*/ o(FFFF1,t13"atanh_3i"   ,              -3,3,2,atanh(a*3i), "a") \
+/*4859*/ o(FFFF1,t13"atanh_m2"   ,              -3,3,2,atanh(a*-2), "a") \
+/*4860*/ o(FFFF1,t13"atanh_m3i"  ,              -3,3,2,atanh(a*-3i), "a") \
+/*4861*/ o(FFFF1,t13"atanh_mi"   ,     -0.75,0.75,0.25,atanh(a*-1i), "a") \
+/*4862*/ o(FFFF1,t13"cos_1i"     ,            -2,2,0.5,cos(a*1i), "a") \
+/*4863*/ o(FFFF1,t13"cos_3i"     ,            -2,2,0.5,cos(a*3i), "a") \
+/*4864*/ o(FFFF1,t13"cos_m3i"    ,            -2,2,0.5,cos(a*-3i), "a") \
+/*4865*/ o(FFFF1,t13"cos_mi"     ,            -2,2,0.5,cos(a*-1i), "a") \
+/*4866*/ o(FFFF1,t13"cosh_1i"    ,            -2,2,0.5,cosh(a*1i), "a") \
+/*4867*/ o(FFFF1,t13"cosh_3i"    ,            -2,2,0.5,cosh(a*3i), "a") \
+/*4868*/ o(FFFF1,t13"cosh_m3i"   ,            -2,2,0.5,cosh(a*-3i), "a") \
+/*4869*/ o(FFFF1,t13"cosh_mi"    ,            -2,2,0.5,cosh(a*-1i), "a") \
+/*4870*/ o(FFFF1,t13"cot_1i"     ,              -3,3,2,cot(a*1i), "a") \
+/*4871*/ o(FFFF1,t13"cot_3i"     ,              -3,3,2,cot(a*3i), "a") \
+/*4872*/ o(FFFF1,t13"cot_m3i"    ,              -3,3,2,cot(a*-3i), "a") \
+/*4873*/ o(FFFF1,t13"cot_mi"     ,              -3,3,2,cot(a*-1i), "a") \
+/*4874*/ o(FFFF1,t13"csc_1i"     ,              -3,3,2,csc(a*1i), "a") \
+/*4875*/ o(FFFF1,t13"csc_3i"     ,              -3,3,2,csc(a*3i), "a") \
+/*4876*/ o(FFFF1,t13"csc_m3i"    ,              -3,3,2,csc(a*-3i), "a") \
+/*4877*/ o(FFFF1,t13"csc_mi"     ,              -3,3,2,csc(a*-1i), "a") \
+/*4878*/ o(FFFF1,t13"sec_1i"     ,            -2,2,0.5,sec(a*1i), "a") \
+/*4879*/ o(FFFF1,t13"sec_3i"     ,            -2,2,0.5,sec(a*3i), "a") \
+/*4880*/ o(FFFF1,t13"sec_m3i"    ,            -2,2,0.5,sec(a*-3i), "a") \
+/*4881*/ o(FFFF1,t13"sec_mi"     ,            -2,2,0.5,sec(a*-1i), "a") \
+/*4882*/ o(FFFF1,t13"sin_1i"     ,            -2,2,0.5,sin(a*1i), "a") \
+/*4883*/ o(FFFF1,t13"sin_3i"     ,            -2,2,0.5,sin(a*3i), "a") \
+/*4884*/ o(FFFF1,t13"sin_m3i"    ,            -2,2,0.5,sin(a*-3i), "a") \
+/*4885*/ o(FFFF1,t13"sin_mi"     ,            -2,2,0.5,sin(a*-1i), "a") \
+/*4886*/ o(FFFF1,t13"sinh_1i"    ,            -2,2,0.5,sinh(a*1i), "a") \
+/*4887*/ o(FFFF1,t13"sinh_3i"    ,            -2,2,0.5,sinh(a*3i), "a") \
+/*4888*/ o(FFFF1,t13"sinh_m3i"   ,            -2,2,0.5,sinh(a*-3i), "a") \
+/*4889*/ o(FFFF1,t13"sinh_mi"    ,            -2,2,0.5,sinh(a*-1i), "a") \
+/*4890*/ o(FFFF1,t13"tan_1i"     ,              -3,3,2,tan(a*1i), "a") \
+/*4891*/ o(FFFF1,t13"tan_2"      ,              -3,3,2,tan(a*2), "a") \
+/*4892*/ o(FFFF1,t13"tan_3i"     ,              -3,3,2,tan(a*3i), "a") \
+/*4893*/ o(FFFF1,t13"tan_m1"     ,              -3,3,2,tan(a*-1), "a") \
+/*4894*/ o(FFFF1,t13"tan_m2"     ,              -3,3,2,tan(a*-2), "a") \
+/*4895*/ o(FFFF1,t13"tan_m3i"    ,              -3,3,2,tan(a*-3i), "a") \
+/*4896*/ o(FFFF1,t13"tan_mi"     ,              -3,3,2,tan(a*-1i), "a") \
+/*4897*/ o(FFFF1,t13"tanh_1i"    ,              -3,3,2,tanh(a*1i), "a") \
+/*4898*/ o(FFFF1,t13"tanh_2"     ,              -3,3,2,tanh(a*2), "a") \
+/*4899*/ o(FFFF1,t13"tanh_3i"    ,              -3,3,2,tanh(a*3i), "a") \
+/*4900*/ o(FFFF1,t13"tanh_m1"    ,              -3,3,2,tanh(a*-1), "a") \
+/*4901*/ o(FFFF1,t13"tanh_m2"    ,              -3,3,2,tanh(a*-2), "a") \
+/*4902*/ o(FFFF1,t13"tanh_m3i"   ,              -3,3,2,tanh(a*-3i), "a") \
+/*4903*/ o(FFFF1,t13"tanh_mi"    ,              -3,3,2,tanh(a*-1i), "a") \
+/*4904*/ o(FFFF1,t14"mmm/ac_ac"  ,              -3,3,2,acos(-a)-acos(-a), "a") \
+/*4905*/ o(FFFF1,t14"mmm/ac_ach" ,              -3,3,2,acos(-a)-acosh(-a), "a") \
+/*4906*/ o(FFFF1,t14"mmm/ac_as"  ,              -3,3,2,acos(-a)-asin(-a), "a") \
+/*4907*/ o(FFFF1,t14"mmm/ac_ash" ,              -3,3,2,acos(-a)-asinh(-a), "a") \
+/*4908*/ o(FFFF1,t14"mmm/ac_at"  ,              -3,3,2,acos(-a)-atan(-a), "a") \
+/*4909*/ o(FFFF1,t14"mmm/ac_c"   ,              -3,3,2,acos(-a)-cos(-a), "a") \
+/*4910*/ o(FFFF1,t14"mmm/ac_ch"  ,              -3,3,2,acos(-a)-cosh(-a), "a") \
+/*4911*/ o(FFFF1,t14"mmm/ac_ex"  ,              -3,3,2,acos(-a)-exp(-a), "a") \
+/*4912*/ o(FFFF1,t14"mmm/ac_l"   ,              -3,3,2,acos(-a)-log(-a), "a") \
+/*4913*/ o(FFFF1,t14"mmm/ac_s"   ,              -3,3,2,acos(-a)-sin(-a), "a") \
+/*4914*/ o(FFFF1,t14"mmm/ac_sh"  ,              -3,3,2,acos(-a)-sinh(-a), "a") \
+/*4915*/ o(FFFF1,t14"mmm/ac_t"   ,              -3,3,2,acos(-a)-tan(-a), "a") \
+/*4916*/ o(FFFF1,t14"mmm/ac_th"  ,              -3,3,2,acos(-a)-tanh(-a), "a") \
+/*4917*/ o(FFFF1,t14"mmm/ach_ac" ,              -3,3,2,acosh(-a)-acos(-a), "a") \
+/*4918*/ o(FFFF1,t14"mmm/ach_ach",              -3,3,2,acosh(-a)-acosh(-a), "a") \
+/*4919*/ o(FFFF1,t14"mmm/ach_as" ,              -3,3,2,acosh(-a)-asin(-a), "a") \
+/*4920*/ o(FFFF1,t14"mmm/ach_ash",    -0.75,-0.25,0.25,acosh(-a)-asinh(-a), "a") \
+/*4921*/ o(FFFF1,t14"mmm/ach_at" ,              -3,3,2,acosh(-a)-atan(-a), "a") \
+/*4922*/ o(FFFF1,t14"mmm/ach_ath",    -0.75,-0.25,0.25,acosh(-a)-atanh(-a), "a") \
+/*4923*/ o(FFFF1,t14"mmm/ach_c"  ,              -3,3,2,acosh(-a)-cos(-a), "a") \
+/*4924*/ o(FFFF1,t14"mmm/ach_ch" ,              -3,3,2,acosh(-a)-cosh(-a), "a") \
+/*4925*/ o(FFFF1,t14"mmm/ach_ex" ,              -3,3,2,acosh(-a)-exp(-a), "a") \
+/*4926*/ o(FFFF1,t14"mmm/ach_l"  ,              -3,3,2,acosh(-a)-log(-a), "a") \
+/*4927*/ o(FFFF1,t14"mmm/ach_s"  ,              -3,3,2,acosh(-a)-sin(-a), "a") \
+/*4928*/ o(FFFF1,t14"mmm/ach_sh" ,              -3,3,2,acosh(-a)-sinh(-a), "a") \
+/*4929*/ o(FFFF1,t14"mmm/ach_t"  ,              -3,3,2,acosh(-a)-tan(-a), "a") \
+/*4930*/ o(FFFF1,t14"mmm/ach_th" ,              -3,3,2,acosh(-a)-tanh(-a), "a") \
+/*4931*/ o(FFFF1,t14"mmm/as_ac"  ,              -3,3,2,asin(-a)-acos(-a), "a") \
+/*4932*/ o(FFFF1,t14"mmm/as_ach" ,              -3,3,2,asin(-a)-acosh(-a), "a") \
+/*4933*/ o(FFFF1,t14"mmm/as_as"  ,              -3,3,2,asin(-a)-asin(-a), "a") \
+/*4934*/ o(FFFF1,t14"mmm/as_ash" ,              -3,3,2,asin(-a)-asinh(-a), "a") \
+/*4935*/ o(FFFF1,t14"mmm/as_at"  ,              -3,3,2,asin(-a)-atan(-a), "a") \
+/*4936*/ o(FFFF1,t14"mmm/as_c"   ,              -3,3,2,asin(-a)-cos(-a), "a") \
+/*4937*/ o(FFFF1,t14"mmm/as_ch"  ,              -3,3,2,asin(-a)-cosh(-a), "a") \
+/*4938*/ o(FFFF1,t14"mmm/as_ex"  ,              -3,3,2,asin(-a)-exp(-a), "a") \
+/*4939*/ o(FFFF1,t14"mmm/as_l"   ,              -3,3,2,asin(-a)-log(-a), "a") \
+/*4940*/ o(FFFF1,t14"mmm/as_s"   ,              -3,3,2,asin(-a)-sin(-a), "a") \
+/*4941*/ o(FFFF1,t14"mmm/as_sh"  ,              -3,3,2,asin(-a)-sinh(-a), "a") \
+/*4942*/ o(FFFF1,t14"mmm/as_t"   ,              -3,3,2,asin(-a)-tan(-a), "a") \
+/*4943*/ o(FFFF1,t14"mmm/as_th"  ,              -3,3,2,asin(-a)-tanh(-a), "a") \
+/*4944*/ o(FFFF1,t14"mmm/ash_ac" ,              -3,3,2,asinh(-a)-acos(-a), "a") \
+/*4945*/ o(FFFF1,t14"mmm/ash_ach",    -0.75,-0.25,0.25,asinh(-a)-acosh(-a), "a") \
+/*4946*/ o(FFFF1,t14"mmm/ash_as" ,              -3,3,2,asinh(-a)-asin(-a), "a") \
+/*4947*/ o(FFFF1,t14"mmm/ash_ash",              -3,3,2,asinh(-a)-asinh(-a), "a") \
+/*4948*/ o(FFFF1,t14"mmm/ash_at" ,              -3,3,2,asinh(-a)-atan(-a), "a") \
+/*4949*/ o(FFFF1,t14"mmm/ash_c"  ,              -3,3,2,asinh(-a)-cos(-a), "a") \
+/*4950*/ o(FFFF1,t14"mmm/ash_ch" ,              -3,3,2,asinh(-a)-cosh(-a), "a") \
+/*4951*/ o(FFFF1,t14"mmm/ash_ex" ,              -3,3,2,asinh(-a)-exp(-a), "a") \
+/*4952*/ o(FFFF1,t14"mmm/ash_l"  ,              -3,3,2,asinh(-a)-log(-a), "a") \
+/*4953*/ o(FFFF1,t14"mmm/ash_s"  ,              -3,3,2,asinh(-a)-sin(-a), "a") \
+/*4954*/ o(FFFF1,t14"mmm/ash_sh" ,              -3,3,2,asinh(-a)-sinh(-a), "a") \
+/*4955*/ o(FFFF1,t14"mmm/ash_t"  ,              -3,3,2,asinh(-a)-tan(-a), "a") \
+/*4956*/ o(FFFF1,t14"mmm/ash_th" ,              -3,3,2,asinh(-a)-tanh(-a), "a") \
+/*4957*/ o(FFFF1,t14"mmm/at_ac"  ,              -3,3,2,atan(-a)-acos(-a), "a") \
+/*4958*/ o(FFFF1,t14"mmm/at_ach" ,              -3,3,2,atan(-a)-acosh(-a), "a") \
+/*4959*/ o(FFFF1,t14"mmm/at_as"  ,              -3,3,2,atan(-a)-asin(-a), "a") \
+/*4960*/ o(FFFF1,t14"mmm/at_ash" ,              -3,3,2,atan(-a)-asinh(-a), "a") \
+/*4961*/ o(FFFF1,t14"mmm/at_at"  ,              -3,3,2,atan(-a)-atan(-a), "a") \
+/*4962*/ o(FFFF1,t14"mmm/at_c"   ,              -3,3,2,atan(-a)-cos(-a), "a") \
+/*4963*/ o(FFFF1,t14"mmm/at_ch"  ,              -3,3,2,atan(-a)-cosh(-a), "a") \
+/*4964*/ o(FFFF1,t14"mmm/at_ex"  ,              -3,3,2,atan(-a)-exp(-a), "a") \
+/*4965*/ o(FFFF1,t14"mmm/at_l"   ,              -3,3,2,atan(-a)-log(-a), "a") \
+/*4966*/ o(FFFF1,t14"mmm/at_s"   ,              -3,3,2,atan(-a)-sin(-a), "a") \
+/*4967*/ o(FFFF1,t14"mmm/at_sh"  ,              -3,3,2,atan(-a)-sinh(-a), "a") \
+/*4968*/ o(FFFF1,t14"mmm/at_t"   ,              -3,3,2,atan(-a)-tan(-a), "a") \
+/*4969*/ o(FFFF1,t14"mmm/at_th"  ,              -3,3,2,atan(-a)-tanh(-a), "a") \
+/*4970*/ o(FFFF1,t14"mmm/ath_ach",    -0.75,-0.25,0.25,atanh(-a)-acosh(-a), "a") \
+/*4971*/ o(FFFF1,t14"mmm/ath_t"  ,    -0.75,-0.25,0.25,atanh(-a)-tan(-a), "a") \
+/*4972*/ o(FFFF1,t14"mmm/ath_th" ,    -0.75,-0.25,0.25,atanh(-a)-tanh(-a), "a") \
+/*4973*/ o(FFFF1,t14"mmm/c_ac"   ,              -3,3,2,cos(-a)-acos(-a), "a") \
+/*4974*/ o(FFFF1,t14"mmm/c_ach"  ,              -3,3,2,cos(-a)-acosh(-a), "a") \
+/*4975*/ o(FFFF1,t14"mmm/c_as"   ,              -3,3,2,cos(-a)-asin(-a), "a") \
+/*4976*/ o(FFFF1,t14"mmm/c_ash"  ,              -3,3,2,cos(-a)-asinh(-a), "a") \
+/*4977*/ o(FFFF1,t14"mmm/c_at"   ,              -3,3,2,cos(-a)-atan(-a), "a") \
+/*4978*/ o(FFFF1,t14"mmm/c_l"    ,              -3,3,2,cos(-a)-log(-a), "a") \
+/*4979*/ o(FFFF1,t14"mmm/c_t"    ,              -3,3,2,cos(-a)-tan(-a), "a") \
+/*4980*/ o(FFFF1,t14"mmm/c_th"   ,              -3,3,2,cos(-a)-tanh(-a), "a") \
+/*4981*/ o(FFFF1,t14"mmm/ch_ac"  ,              -3,3,2,cosh(-a)-acos(-a), "a") \
+/*4982*/ o(FFFF1,t14"mmm/ch_ach" ,              -3,3,2,cosh(-a)-acosh(-a), "a") \
+/*4983*/ o(FFFF1,t14"mmm/ch_as"  ,              -3,3,2,cosh(-a)-asin(-a), "a") \
+/*4984*/ o(FFFF1,t14"mmm/ch_ash" ,              -3,3,2,cosh(-a)-asinh(-a), "a") \
+/*4985*/ o(FFFF1,t14"mmm/ch_at"  ,              -3,3,2,cosh(-a)-atan(-a), "a") \
+/*4986*/ o(FFFF1,t14"mmm/ch_l"   ,              -3,3,2,cosh(-a)-log(-a), "a") \
+/*4987*/ o(FFFF1,t14"mmm/ch_t"   ,              -3,3,2,cosh(-a)-tan(-a), "a") \
+/*4988*/ o(FFFF1,t14"mmm/ch_th"  ,              -3,3,2,cosh(-a)-tanh(-a), "a") \
+/*4989*/ o(FFFF1,t14"mmm/ex_ac"  ,              -3,3,2,exp(-a)-acos(-a), "a") \
+/*4990*/ o(FFFF1,t14"mmm/ex_ach" ,              -3,3,2,exp(-a)-acosh(-a), "a") \
+/*4991*/ o(FFFF1,t14"mmm/ex_as"  ,              -3,3,2,exp(-a)-asin(-a), "a") \
+/*4992*/ o(FFFF1,t14"mmm/ex_ash" ,              -3,3,2,exp(-a)-asinh(-a), "a") \
+/*4993*/ o(FFFF1,t14"mmm/ex_at"  ,              -3,3,2,exp(-a)-atan(-a), "a") \
+/*4994*/ o(FFFF1,t14"mmm/ex_l"   ,              -3,3,2,exp(-a)-log(-a), "a") \
+/*4995*/ o(FFFF1,t14"mmm/ex_t"   ,              -3,3,2,exp(-a)-tan(-a), "a") \
+/*4996*/ o(FFFF1,t14"mmm/ex_th"  ,              -3,3,2,exp(-a)-tanh(-a), "a") \
+/*4997*/ o(FFFF1,t14"mmm/l_ac"   ,              -3,3,2,log(-a)-acos(-a), "a") \
+/*4998*/ o(FFFF1,t14"mmm/l_ach"  ,              -3,3,2,log(-a)-acosh(-a), "a") \
+/*4999*/ o(FFFF1,t14"mmm/l_as"   ,              -3,3,2,log(-a)-asin(-a), "a") \
+/*5000*/ o(FFFF1,t14"mmm/l_ash"  ,              -3,3,2,log(-a)-asinh(-a), "a") \
+/*5001*/ o(FFFF1,t14"mmm/l_at"   ,              -3,3,2,log(-a)-atan(-a), "a") \
+/*5002*/ o(FFFF1,t14"mmm/l_c"    ,              -3,3,2,log(-a)-cos(-a), "a") \
+/*5003*/ o(FFFF1,t14"mmm/l_ch"   ,              -3,3,2,log(-a)-cosh(-a), "a") \
+/*5004*/ o(FFFF1,t14"mmm/l_ex"   ,              -3,3,2,log(-a)-exp(-a), "a") \
+/*5005*/ o(FFFF1,t14"mmm/l_l"    ,              -3,3,2,log(-a)-log(-a), "a") \
+/*5006*/ o(FFFF1,t14"mmm/l_s"    ,              -3,3,2,log(-a)-sin(-a), "a") \
+/*5007*/ o(FFFF1,t14"mmm/l_sh"   ,              -3,3,2,log(-a)-sinh(-a), "a") \
+/*5008*/ o(FFFF1,t14"mmm/l_t"    ,              -3,3,2,log(-a)-tan(-a), "a") \
+/*5009*/ o(FFFF1,t14"mmm/l_th"   ,              -3,3,2,log(-a)-tanh(-a), "a") \
+/*5010*/ o(FFFF1,t14"mmm/s_ac"   ,              -3,3,2,sin(-a)-acos(-a), "a") \
+/*5011*/ o(FFFF1,t14"mmm/s_ach"  ,              -3,3,2,sin(-a)-acosh(-a), "a") \
+/*5012*/ o(FFFF1,t14"mmm/s_as"   ,              -3,3,2,sin(-a)-asin(-a), "a") \
+/*5013*/ o(FFFF1,t14"mmm/s_ash"  ,              -3,3,2,sin(-a)-asinh(-a), "a") \
+/*5014*/ o(FFFF1,t14"mmm/s_at"   ,              -3,3,2,sin(-a)-atan(-a), "a") \
+/*5015*/ o(FFFF1,t14"mmm/s_l"    ,              -3,3,2,sin(-a)-log(-a), "a") \
+/*5016*/ o(FFFF1,t14"mmm/s_t"    ,              -3,3,2,sin(-a)-tan(-a), "a") \
+/*5017*/ o(FFFF1,t14"mmm/s_th"   ,              -3,3,2,sin(-a)-tanh(-a), "a") \
+/*5018*/ o(FFFF1,t14"mmm/sh_ac"  ,              -3,3,2,sinh(-a)-acos(-a), "a") \
+/*5019*/ o(FFFF1,t14"mmm/sh_ach" ,              -3,3,2,sinh(-a)-acosh(-a), "a") \
+/*5020*/ o(FFFF1,t14"mmm/sh_as"  ,              -3,3,2,sinh(-a)-asin(-a), "a") \
+/*5021*/ o(FFFF1,t14"mmm/sh_ash" ,              -3,3,2,sinh(-a)-asinh(-a), "a") \
+/*5022*/ o(FFFF1,t14"mmm/sh_at"  ,              -3,3,2,sinh(-a)-atan(-a), "a") \
+/*5023*/ o(FFFF1,t14"mmm/sh_l"   ,              -3,3,2,sinh(-a)-log(-a), "a") \
+/*5024*/ o(FFFF1,t14"mmm/sh_t"   ,              -3,3,2,sinh(-a)-tan(-a), "a") \
+/*5025*/ o(FFFF1,t14"mmm/sh_th"  ,              -3,3,2,sinh(-a)-tanh(-a), "a") \
+/*5026*/ o(FFFF1,t14"mmm/t_ac"   ,              -3,3,2,tan(-a)-acos(-a), "a") \
+/*5027*/ o(FFFF1,t14"mmm/t_ach"  ,              -3,3,2,tan(-a)-acosh(-a), "a") \
+/*5028*/ o(FFFF1,t14"mmm/t_as"   ,              -3,3,2,tan(-a)-asin(-a), "a") \
+/*5029*/ o(FFFF1,t14"mmm/t_ash"  ,              -3,3,2,tan(-a)-asinh(-a), "a") \
+/*5030*/ o(FFFF1,t14"mmm/t_at"   ,              -3,3,2,tan(-a)-atan(-a), "a") \
+/*5031*/ o(FFFF1,t14"mmm/t_ath"  ,    -0.75,-0.25,0.25,tan(-a)-atanh(-a), "a") \
+/*5032*/ o(FFFF1,t14"mmm/t_c"    ,              -3,3,2,tan(-a)-cos(-a), "a") \
+/*5033*/ o(FFFF1,t14"mmm/t_ch"   ,              -3,3,2,tan(-a)-cosh(-a), "a") \
+/*5034*/ o(FFFF1,t14"mmm/t_ex"   ,              -3,3,2,tan(-a)-exp(-a), "a") \
+/*5035*/ o(FFFF1,t14"mmm/t_l"    ,              -3,3,2,tan(-a)-log(-a), "a") \
+/*5036*/ o(FFFF1,t14"mmm/t_s"    ,              -3,3,2,tan(-a)-sin(-a), "a") \
+/*5037*/ o(FFFF1,t14"mmm/t_sh"   ,              -3,3,2,tan(-a)-sinh(-a), "a") \
+/*5038*/ o(FFFF1,t14"mmm/t_t"    ,              -3,3,2,tan(-a)-tan(-a), "a") \
+/*5039*/ o(FFFF1,t14"mmm/t_th"   ,              -3,3,2,tan(-a)-tanh(-a), "a") \
+/*5040*/ o(FFFF1,t14"mmm/th_ac"  ,              -3,3,2,tanh(-a)-acos(-a), "a") \
+/*5041*/ o(FFFF1,t14"mmm/th_ach" ,              -3,3,2,tanh(-a)-acosh(-a), "a") \
+/*5042*/ o(FFFF1,t14"mmm/th_as"  ,              -3,3,2,tanh(-a)-asin(-a), "a") \
+/*5043*/ o(FFFF1,t14"mmm/th_ash" ,              -3,3,2,tanh(-a)-asinh(-a), "a") \
+/*5044*/ o(FFFF1,t14"mmm/th_at"  ,              -3,3,2,tanh(-a)-atan(-a), "a") \
+/*5045*/ o(FFFF1,t14"mmm/th_ath" ,    -0.75,-0.25,0.25,tanh(-a)-atanh(-a), "a") \
+/*5046*/ o(FFFF1,t14"mmm/th_c"   ,              -3,3,2,tanh(-a)-cos(-a), "a") \
+/*5047*/ o(FFFF1,t14"mmm/th_ch"  ,              -3,3,2,tanh(-a)-cosh(-a), "a") \
+/*5048*/ o(FFFF1,t14"mmm/th_ex"  ,              -3,3,2,tanh(-a)-exp(-a), "a") \
+/*5049*/ o(FFFF1,t14"mmm/th_l"   ,              -3,3,2,tanh(-a)-log(-a), "a") \
+/*5050*/ o(FFFF1,t14"mmm/th_s"   ,              -3,3,2,tanh(-a)-sin(-a), "a") \
+/*5051*/ o(FFFF1,t14"mmm/th_sh"  ,              -3,3,2,tanh(-a)-sinh(-a), "a") \
+/*5052*/ o(FFFF1,t14"mmm/th_t"   ,              -3,3,2,tanh(-a)-tan(-a), "a") \
+/*5053*/ o(FFFF1,t14"mmm/th_th"  ,              -3,3,2,tanh(-a)-tanh(-a), "a") \
+/*5054*/ o(FFFF1,t14"mmp/ac_ac"  ,              -3,3,2,acos(-a)-acos(a), "a") \
+/*5055*/ o(FFFF1,t14"mmp/ac_ach" ,              -3,3,2,acos(-a)-acosh(a), "a") \
+/*5056*/ o(FFFF1,t14"mmp/ac_as"  ,              -3,3,2,acos(-a)-asin(a), "a") \
+/*5057*/ o(FFFF1,t14"mmp/ac_ash" ,              -3,3,2,acos(-a)-asinh(a), "a") \
+/*5058*/ o(FFFF1,t14"mmp/ac_at"  ,              -3,3,2,acos(-a)-atan(a), "a") \
+/*5059*/ o(FFFF1,t14"mmp/ac_c"   ,              -3,3,2,acos(-a)-cos(a), "a") \
+/*5060*/ o(FFFF1,t14"mmp/ac_ch"  ,              -3,3,2,acos(-a)-cosh(a), "a") \
+/*5061*/ o(FFFF1,t14"mmp/ac_ex"  ,              -3,3,2,acos(-a)-exp(a), "a") \
+/*5062*/ o(FFFF1,t14"mmp/ac_l"   ,              -3,3,2,acos(-a)-log(a), "a") \
+/*5063*/ o(FFFF1,t14"mmp/ac_s"   ,              -3,3,2,acos(-a)-sin(a), "a") \
+/*5064*/ o(FFFF1,t14"mmp/ac_sh"  ,              -3,3,2,acos(-a)-sinh(a), "a") \
+/*5065*/ o(FFFF1,t14"mmp/ac_t"   ,              -3,3,2,acos(-a)-tan(a), "a") \
+/*5066*/ o(FFFF1,t14"mmp/ac_th"  ,              -3,3,2,acos(-a)-tanh(a), "a") \
+/*5067*/ o(FFFF1,t14"mmp/ach_ac" ,              -3,3,2,acosh(-a)-acos(a), "a") \
+/*5068*/ o(FFFF1,t14"mmp/ach_ach",              -3,3,2,acosh(-a)-acosh(a), "a") \
+/*5069*/ o(FFFF1,t14"mmp/ach_as" ,              -3,3,2,acosh(-a)-asin(a), "a") \
+/*5070*/ o(FFFF1,t14"mmp/ach_ash",              -3,3,2,acosh(-a)-asinh(a), "a") \
+/*5071*/ o(FFFF1,t14"mmp/ach_at" ,              -3,3,2,acosh(-a)-atan(a), "a") \
+/*5072*/ o(FFFF1,t14"mmp/ach_ath",    -0.75,-0.25,0.25,acosh(-a)-atanh(a), "a") \
+/*5073*/ o(FFFF1,t14"mmp/ach_c"  ,              -3,3,2,acosh(-a)-cos(a), "a") \
+/*5074*/ o(FFFF1,t14"mmp/ach_ch" ,              -3,3,2,acosh(-a)-cosh(a), "a") \
+/*5075*/ o(FFFF1,t14"mmp/ach_ex" ,              -3,3,2,acosh(-a)-exp(a), "a") \
+/*5076*/ o(FFFF1,t14"mmp/ach_l"  ,              -3,3,2,acosh(-a)-log(a), "a") \
+/*5077*/ o(FFFF1,t14"mmp/ach_s"  ,              -3,3,2,acosh(-a)-sin(a), "a") \
+/*5078*/ o(FFFF1,t14"mmp/ach_sh" ,              -3,3,2,acosh(-a)-sinh(a), "a") \
+/*5079*/ o(FFFF1,t14"mmp/ach_t"  ,              -3,3,2,acosh(-a)-tan(a), "a") \
+/*5080*/ o(FFFF1,t14"mmp/ach_th" ,              -3,3,2,acosh(-a)-tanh(a), "a") \
+/*5081*/ o(FFFF1,t14"mmp/as_ac"  ,              -3,3,2,asin(-a)-acos(a), "a") \
+/*5082*/ o(FFFF1,t14"mmp/as_ach" ,              -3,3,2,asin(-a)-acosh(a), "a") \
+/*5083*/ o(FFFF1,t14"mmp/as_as"  ,              -3,3,2,asin(-a)-asin(a), "a") \
+/*5084*/ o(FFFF1,t14"mmp/as_ash" ,              -3,3,2,asin(-a)-asinh(a), "a") \
+/*5085*/ o(FFFF1,t14"mmp/as_at"  ,              -3,3,2,asin(-a)-atan(a), "a") \
+/*5086*/ o(FFFF1,t14"mmp/as_c"   ,              -3,3,2,asin(-a)-cos(a), "a") \
+/*5087*/ o(FFFF1,t14"mmp/as_ch"  ,              -3,3,2,asin(-a)-cosh(a), "a") \
+/*5088*/ o(FFFF1,t14"mmp/as_ex"  ,              -3,3,2,asin(-a)-exp(a), "a") \
+/*5089*/ o(FFFF1,t14"mmp/as_l"   ,              -3,3,2,asin(-a)-log(a), "a") \
+/*5090*/ o(FFFF1,t14"mmp/as_s"   ,              -3,3,2,asin(-a)-sin(a), "a") \
+/*5091*/ o(FFFF1,t14"mmp/as_sh"  ,              -3,3,2,asin(-a)-sinh(a), "a") \
+/*5092*/ o(FFFF1,t14"mmp/as_t"   ,              -3,3,2,asin(-a)-tan(a), "a") \
+/*5093*/ o(FFFF1,t14"mmp/as_th"  ,              -3,3,2,asin(-a)-tanh(a), "a") \
+/*5094*/ o(FFFF1,t14"mmp/ash_ac" ,              -3,3,2,asinh(-a)-acos(a), "a") \
+/*5095*/ o(FFFF1,t14"mmp/ash_ach",              -3,3,2,asinh(-a)-acosh(a), "a") \
+/*5096*/ o(FFFF1,t14"mmp/ash_as" ,              -3,3,2,asinh(-a)-asin(a), "a") \
+/*5097*/ o(FFFF1,t14"mmp/ash_ash",              -3,3,2,asinh(-a)-asinh(a), "a") \
+/*5098*/ o(FFFF1,t14"mmp/ash_at" ,              -3,3,2,asinh(-a)-atan(a), "a") \
+/*5099*/ o(FFFF1,t14"mmp/ash_c"  ,              -3,3,2,asinh(-a)-cos(a), "a") \
+/*5100*/ o(FFFF1,t14"mmp/ash_ch" ,              -3,3,2,asinh(-a)-cosh(a), "a") \
+/*5101*/ o(FFFF1,t14"mmp/ash_ex" ,              -3,3,2,asinh(-a)-exp(a), "a") \
+/*5102*/ o(FFFF1,t14"mmp/ash_l"  ,              -3,3,2,asinh(-a)-log(a), "a") \
+/*5103*/ o(FFFF1,t14"mmp/ash_s"  ,              -3,3,2,asinh(-a)-sin(a), "a") \
+/*5104*/ o(FFFF1,t14"mmp/ash_sh" ,              -3,3,2,asinh(-a)-sinh(a), "a") \
+/*5105*/ o(FFFF1,t14"mmp/ash_t"  ,              -3,3,2,asinh(-a)-tan(a), "a") \
+/*5106*/ o(FFFF1,t14"mmp/ash_th" ,              -3,3,2,asinh(-a)-tanh(a), "a") \
+/*5107*/ o(FFFF1,t14"mmp/at_ac"  ,              -3,3,2,atan(-a)-acos(a), "a") \
+/*5108*/ o(FFFF1,t14"mmp/at_ach" ,              -3,3,2,atan(-a)-acosh(a), "a") \
+/*5109*/ o(FFFF1,t14"mmp/at_as"  ,              -3,3,2,atan(-a)-asin(a), "a") \
+/*5110*/ o(FFFF1,t14"mmp/at_ash" ,              -3,3,2,atan(-a)-asinh(a), "a") \
+/*5111*/ o(FFFF1,t14"mmp/at_at"  ,              -3,3,2,atan(-a)-atan(a), "a") \
+/*5112*/ o(FFFF1,t14"mmp/at_c"   ,              -3,3,2,atan(-a)-cos(a), "a") \
+/*5113*/ o(FFFF1,t14"mmp/at_ch"  ,              -3,3,2,atan(-a)-cosh(a), "a") \
+/*5114*/ o(FFFF1,t14"mmp/at_ex"  ,              -3,3,2,atan(-a)-exp(a), "a") \
+/*5115*/ o(FFFF1,t14"mmp/at_l"   ,              -3,3,2,atan(-a)-log(a), "a") \
+/*5116*/ o(FFFF1,t14"mmp/at_s"   ,              -3,3,2,atan(-a)-sin(a), "a") \
+/*5117*/ o(FFFF1,t14"mmp/at_sh"  ,              -3,3,2,atan(-a)-sinh(a), "a") \
+/*5118*/ o(FFFF1,t14"mmp/at_t"   ,              -3,3,2,atan(-a)-tan(a), "a") \
+/*5119*/ o(FFFF1,t14"mmp/at_th"  ,              -3,3,2,atan(-a)-tanh(a), "a") \
+/*5120*/ o(FFFF1,t14"mmp/ath_ach",    -0.75,-0.25,0.25,atanh(-a)-acosh(a), "a") \
+/*5121*/ o(FFFF1,t14"mmp/ath_l"  ,    -0.75,-0.25,0.25,atanh(-a)-log(a), "a") \
+/*5122*/ o(FFFF1,t14"mmp/ath_t"  ,    -0.75,-0.25,0.25,atanh(-a)-tan(a), "a") \
+/*5123*/ o(FFFF1,t14"mmp/ath_th" ,    -0.75,-0.25,0.25,atanh(-a)-tanh(a), "a") \
+/*5124*/ o(FFFF1,t14"mmp/c_ac"   ,              -3,3,2,cos(-a)-acos(a), "a") \
+/*5125*/ o(FFFF1,t14"mmp/c_ach"  ,              -3,3,2,cos(-a)-acosh(a), "a") \
+/*5126*/ o(FFFF1,t14"mmp/c_as"   ,              -3,3,2,cos(-a)-asin(a), "a") \
+/*5127*/ o(FFFF1,t14"mmp/c_ash"  ,              -3,3,2,cos(-a)-asinh(a), "a") \
+/*5128*/ o(FFFF1,t14"mmp/c_at"   ,              -3,3,2,cos(-a)-atan(a), "a") \
+/*5129*/ o(FFFF1,t14"mmp/c_l"    ,              -3,3,2,cos(-a)-log(a), "a") \
+/*5130*/ o(FFFF1,t14"mmp/c_t"    ,              -3,3,2,cos(-a)-tan(a), "a") \
+/*5131*/ o(FFFF1,t14"mmp/c_th"   ,              -3,3,2,cos(-a)-tanh(a), "a") \
+/*5132*/ o(FFFF1,t14"mmp/ch_ac"  ,              -3,3,2,cosh(-a)-acos(a), "a") \
+/*5133*/ o(FFFF1,t14"mmp/ch_ach" ,              -3,3,2,cosh(-a)-acosh(a), "a") \
+/*5134*/ o(FFFF1,t14"mmp/ch_as"  ,              -3,3,2,cosh(-a)-asin(a), "a") \
+/*5135*/ o(FFFF1,t14"mmp/ch_ash" ,              -3,3,2,cosh(-a)-asinh(a), "a") \
+/*5136*/ o(FFFF1,t14"mmp/ch_at"  ,              -3,3,2,cosh(-a)-atan(a), "a") \
+/*5137*/ o(FFFF1,t14"mmp/ch_l"   ,              -3,3,2,cosh(-a)-log(a), "a") \
+/*5138*/ o(FFFF1,t14"mmp/ch_t"   ,              -3,3,2,cosh(-a)-tan(a), "a") \
+/*5139*/ o(FFFF1,t14"mmp/ch_th"  ,              -3,3,2,cosh(-a)-tanh(a), "a") \
+/*5140*/ o(FFFF1,t14"mmp/ex_ac"  ,              -3,3,2,exp(-a)-acos(a), "a") \
+/*5141*/ o(FFFF1,t14"mmp/ex_ach" ,              -3,3,2,exp(-a)-acosh(a), "a") \
+/*5142*/ o(FFFF1,t14"mmp/ex_as"  ,              -3,3,2,exp(-a)-asin(a), "a") \
+/*5143*/ o(FFFF1,t14"mmp/ex_ash" ,              -3,3,2,exp(-a)-asinh(a), "a") \
+/*5144*/ o(FFFF1,t14"mmp/ex_at"  ,              -3,3,2,exp(-a)-atan(a), "a") \
+/*5145*/ o(FFFF1,t14"mmp/ex_l"   ,              -3,3,2,exp(-a)-log(a), "a") \
+/*5146*/ o(FFFF1,t14"mmp/ex_t"   ,              -3,3,2,exp(-a)-tan(a), "a") \
+/*5147*/ o(FFFF1,t14"mmp/ex_th"  ,              -3,3,2,exp(-a)-tanh(a), "a") \
+/*5148*/ o(FFFF1,t14"mmp/l_ac"   ,              -3,3,2,log(-a)-acos(a), "a") \
+/*5149*/ o(FFFF1,t14"mmp/l_ach"  ,              -3,3,2,log(-a)-acosh(a), "a") \
+/*5150*/ o(FFFF1,t14"mmp/l_as"   ,              -3,3,2,log(-a)-asin(a), "a") \
+/*5151*/ o(FFFF1,t14"mmp/l_ash"  ,              -3,3,2,log(-a)-asinh(a), "a") \
+/*5152*/ o(FFFF1,t14"mmp/l_at"   ,              -3,3,2,log(-a)-atan(a), "a") \
+/*5153*/ o(FFFF1,t14"mmp/l_c"    ,              -3,3,2,log(-a)-cos(a), "a") \
+/*5154*/ o(FFFF1,t14"mmp/l_ch"   ,              -3,3,2,log(-a)-cosh(a), "a") \
+/*5155*/ o(FFFF1,t14"mmp/l_ex"   ,              -3,3,2,log(-a)-exp(a), "a") \
+/*5156*/ o(FFFF1,t14"mmp/l_l"    ,              -3,3,2,log(-a)-log(a), "a") \
+/*5157*/ o(FFFF1,t14"mmp/l_s"    ,              -3,3,2,log(-a)-sin(a), "a") \
+/*5158*/ o(FFFF1,t14"mmp/l_sh"   ,              -3,3,2,log(-a)-sinh(a), "a") \
+/*5159*/ o(FFFF1,t14"mmp/l_t"    ,              -3,3,2,log(-a)-tan(a), "a") \
+/*5160*/ o(FFFF1,t14"mmp/l_th"   ,              -3,3,2,log(-a)-tanh(a), "a") \
+/*5161*/ o(FFFF1,t14"mmp/s_ac"   ,              -3,3,2,sin(-a)-acos(a), "a") \
+/*5162*/ o(FFFF1,t14"mmp/s_ach"  ,              -3,3,2,sin(-a)-acosh(a), "a") \
+/*5163*/ o(FFFF1,t14"mmp/s_as"   ,              -3,3,2,sin(-a)-asin(a), "a") \
+/*5164*/ o(FFFF1,t14"mmp/s_ash"  ,              -3,3,2,sin(-a)-asinh(a), "a") \
+/*5165*/ o(FFFF1,t14"mmp/s_at"   ,              -3,3,2,sin(-a)-atan(a), "a") \
+/*5166*/ o(FFFF1,t14"mmp/s_l"    ,              -3,3,2,sin(-a)-log(a), "a") \
+/*5167*/ o(FFFF1,t14"mmp/s_t"    ,              -3,3,2,sin(-a)-tan(a), "a") \
+/*5168*/ o(FFFF1,t14"mmp/s_th"   ,              -3,3,2,sin(-a)-tanh(a), "a") \
+/*5169*/ o(FFFF1,t14"mmp/sh_ac"  ,              -3,3,2,sinh(-a)-acos(a), "a") \
+/*5170*/ o(FFFF1,t14"mmp/sh_ach" ,              -3,3,2,sinh(-a)-acosh(a), "a") \
+/*5171*/ o(FFFF1,t14"mmp/sh_as"  ,              -3,3,2,sinh(-a)-asin(a), "a") \
+/*5172*/ o(FFFF1,t14"mmp/sh_ash" ,              -3,3,2,sinh(-a)-asinh(a), "a") \
+/*5173*/ o(FFFF1,t14"mmp/sh_at"  ,              -3,3,2,sinh(-a)-atan(a), "a") \
+/*5174*/ o(FFFF1,t14"mmp/sh_l"   ,              -3,3,2,sinh(-a)-log(a), "a") \
+/*5175*/ o(FFFF1,t14"mmp/sh_t"   ,              -3,3,2,sinh(-a)-tan(a), "a") \
+/*5176*/ o(FFFF1,t14"mmp/sh_th"  ,              -3,3,2,sinh(-a)-tanh(a), "a") \
+/*5177*/ o(FFFF1,t14"mmp/t_ac"   ,              -3,3,2,tan(-a)-acos(a), "a") \
+/*5178*/ o(FFFF1,t14"mmp/t_ach"  ,              -3,3,2,tan(-a)-acosh(a), "a") \
+/*5179*/ o(FFFF1,t14"mmp/t_as"   ,              -3,3,2,tan(-a)-asin(a), "a") \
+/*5180*/ o(FFFF1,t14"mmp/t_ash"  ,              -3,3,2,tan(-a)-asinh(a), "a") \
+/*5181*/ o(FFFF1,t14"mmp/t_at"   ,              -3,3,2,tan(-a)-atan(a), "a") \
+/*5182*/ o(FFFF1,t14"mmp/t_ath"  ,    -0.75,-0.25,0.25,tan(-a)-atanh(a), "a") \
+/*5183*/ o(FFFF1,t14"mmp/t_c"    ,              -3,3,2,tan(-a)-cos(a), "a") \
+/*5184*/ o(FFFF1,t14"mmp/t_ch"   ,              -3,3,2,tan(-a)-cosh(a), "a") \
+/*5185*/ o(FFFF1,t14"mmp/t_ex"   ,              -3,3,2,tan(-a)-exp(a), "a") \
+/*5186*/ o(FFFF1,t14"mmp/t_l"    ,              -3,3,2,tan(-a)-log(a), "a") \
+/*5187*/ o(FFFF1,t14"mmp/t_s"    ,              -3,3,2,tan(-a)-sin(a), "a") \
+/*5188*/ o(FFFF1,t14"mmp/t_sh"   ,              -3,3,2,tan(-a)-sinh(a), "a") \
+/*5189*/ o(FFFF1,t14"mmp/t_t"    ,              -3,3,2,tan(-a)-tan(a), "a") \
+/*5190*/ o(FFFF1,t14"mmp/t_th"   ,              -3,3,2,tan(-a)-tanh(a), "a") \
+/*5191*/ o(FFFF1,t14"mmp/th_ac"  ,              -3,3,2,tanh(-a)-acos(a), "a") \
+/*5192*/ o(FFFF1,t14"mmp/th_ach" ,              -3,3,2,tanh(-a)-acosh(a), "a") \
+/*5193*/ o(FFFF1,t14"mmp/th_as"  ,              -3,3,2,tanh(-a)-asin(a), "a") \
+/*5194*/ o(FFFF1,t14"mmp/th_ash" ,              -3,3,2,tanh(-a)-asinh(a), "a") \
+/*5195*/ o(FFFF1,t14"mmp/th_at"  ,              -3,3,2,tanh(-a)-atan(a), "a") \
+/*5196*/ o(FFFF1,t14"mmp/th_ath" ,    -0.75,-0.25,0.25,tanh(-a)-atanh(a), "a") \
+/*5197*/ o(FFFF1,t14"mmp/th_c"   ,              -3,3,2,tanh(-a)-cos(a), "a") \
+/*5198*/ o(FFFF1,t14"mmp/th_ch"  ,              -3,3,2,tanh(-a)-cosh(a), "a") \
+/*5199*/ o(FFFF1,t14"mmp/th_ex"  ,              -3,3,2,tanh(-a)-exp(a), "a") \
+/*5200*/ o(FFFF1,t14"mmp/th_l"   ,              -3,3,2,tanh(-a)-log(a), "a") \
+/*5201*/ o(FFFF1,t14"mmp/th_s"   ,              -3,3,2,tanh(-a)-sin(a), "a") \
+/*5202*/ o(FFFF1,t14"mmp/th_sh"  ,              -3,3,2,tanh(-a)-sinh(a), "a") \
+/*5203*/ o(FFFF1,t14"mmp/th_t"   ,              -3,3,2,tanh(-a)-tan(a), "a") \
+/*5204*/ o(FFFF1,t14"mmp/th_th"  ,              -3,3,2,tanh(-a)-tanh(a), "a") \
+/*5205*/ o(FFFF1,t14"mpm/ac_ac"  ,              -3,3,2,acos(a)-acos(-a), "a") \
+/*5206*/ o(FFFF1,t14"mpm/ac_ach" ,              -3,3,2,acos(a)-acosh(-a), "a") \
+/*5207*/ o(FFFF1,t14"mpm/ac_as"  ,              -3,3,2,acos(a)-asin(-a), "a") \
+/*5208*/ o(FFFF1,t14"mpm/ac_ash" ,              -3,3,2,acos(a)-asinh(-a), "a") \
+/*5209*/ o(FFFF1,t14"mpm/ac_at"  ,              -3,3,2,acos(a)-atan(-a), "a") \
+/*5210*/ o(FFFF1,t14"mpm/ac_c"   ,              -3,3,2,acos(a)-cos(-a), "a") \
+/*5211*/ o(FFFF1,t14"mpm/ac_ch"  ,              -3,3,2,acos(a)-cosh(-a), "a") \
+/*5212*/ o(FFFF1,t14"mpm/ac_ex"  ,              -3,3,2,acos(a)-exp(-a), "a") \
+/*5213*/ o(FFFF1,t14"mpm/ac_l"   ,              -3,3,2,acos(a)-log(-a), "a") \
+/*5214*/ o(FFFF1,t14"mpm/ac_s"   ,              -3,3,2,acos(a)-sin(-a), "a") \
+/*5215*/ o(FFFF1,t14"mpm/ac_sh"  ,              -3,3,2,acos(a)-sinh(-a), "a") \
+/*5216*/ o(FFFF1,t14"mpm/ac_t"   ,              -3,3,2,acos(a)-tan(-a), "a") \
+/*5217*/ o(FFFF1,t14"mpm/ac_th"  ,              -3,3,2,acos(a)-tanh(-a), "a") \
+/*5218*/ o(FFFF1,t14"mpm/ach_ac" ,              -3,3,2,acosh(a)-acos(-a), "a") \
+/*5219*/ o(FFFF1,t14"mpm/ach_ach",              -3,3,2,acosh(a)-acosh(-a), "a") \
+/*5220*/ o(FFFF1,t14"mpm/ach_as" ,              -3,3,2,acosh(a)-asin(-a), "a") \
+/*5221*/ o(FFFF1,t14"mpm/ach_ash",              -3,3,2,acosh(a)-asinh(-a), "a") \
+/*5222*/ o(FFFF1,t14"mpm/ach_at" ,              -3,3,2,acosh(a)-atan(-a), "a") \
+/*5223*/ o(FFFF1,t14"mpm/ach_ath",    -0.75,-0.25,0.25,acosh(a)-atanh(-a), "a") \
+/*5224*/ o(FFFF1,t14"mpm/ach_c"  ,              -3,3,2,acosh(a)-cos(-a), "a") \
+/*5225*/ o(FFFF1,t14"mpm/ach_ch" ,              -3,3,2,acosh(a)-cosh(-a), "a") \
+/*5226*/ o(FFFF1,t14"mpm/ach_ex" ,              -3,3,2,acosh(a)-exp(-a), "a") \
+/*5227*/ o(FFFF1,t14"mpm/ach_l"  ,              -3,3,2,acosh(a)-log(-a), "a") \
+/*5228*/ o(FFFF1,t14"mpm/ach_s"  ,              -3,3,2,acosh(a)-sin(-a), "a") \
+/*5229*/ o(FFFF1,t14"mpm/ach_sh" ,              -3,3,2,acosh(a)-sinh(-a), "a") \
+/*5230*/ o(FFFF1,t14"mpm/ach_t"  ,              -3,3,2,acosh(a)-tan(-a), "a") \
+/*5231*/ o(FFFF1,t14"mpm/ach_th" ,              -3,3,2,acosh(a)-tanh(-a), "a") \
+/*5232*/ o(FFFF1,t14"mpm/as_ac"  ,              -3,3,2,asin(a)-acos(-a), "a") \
+/*5233*/ o(FFFF1,t14"mpm/as_ach" ,              -3,3,2,asin(a)-acosh(-a), "a") \
+/*5234*/ o(FFFF1,t14"mpm/as_as"  ,              -3,3,2,asin(a)-asin(-a), "a") \
+/*5235*/ o(FFFF1,t14"mpm/as_ash" ,              -3,3,2,asin(a)-asinh(-a), "a") \
+/*5236*/ o(FFFF1,t14"mpm/as_at"  ,              -3,3,2,asin(a)-atan(-a), "a") \
+/*5237*/ o(FFFF1,t14"mpm/as_c"   ,              -3,3,2,asin(a)-cos(-a), "a") \
+/*5238*/ o(FFFF1,t14"mpm/as_ch"  ,              -3,3,2,asin(a)-cosh(-a), "a") \
+/*5239*/ o(FFFF1,t14"mpm/as_ex"  ,              -3,3,2,asin(a)-exp(-a), "a") \
+/*5240*/ o(FFFF1,t14"mpm/as_l"   ,              -3,3,2,asin(a)-log(-a), "a") \
+/*5241*/ o(FFFF1,t14"mpm/as_s"   ,              -3,3,2,asin(a)-sin(-a), "a") \
+/*5242*/ o(FFFF1,t14"mpm/as_sh"  ,              -3,3,2,asin(a)-sinh(-a), "a") \
+/*5243*/ o(FFFF1,t14"mpm/as_t"   ,              -3,3,2,asin(a)-tan(-a), "a") \
+/*5244*/ o(FFFF1,t14"mpm/as_th"  ,              -3,3,2,asin(a)-tanh(-a), "a") \
+/*5245*/ o(FFFF1,t14"mpm/ash_ac" ,              -3,3,2,asinh(a)-acos(-a), "a") \
+/*5246*/ o(FFFF1,t14"mpm/ash_ach",              -3,3,2,asinh(a)-acosh(-a), "a") \
+/*5247*/ o(FFFF1,t14"mpm/ash_as" ,              -3,3,2,asinh(a)-asin(-a), "a") \
+/*5248*/ o(FFFF1,t14"mpm/ash_ash",              -3,3,2,asinh(a)-asinh(-a), "a") \
+/*5249*/ o(FFFF1,t14"mpm/ash_at" ,              -3,3,2,asinh(a)-atan(-a), "a") \
+/*5250*/ o(FFFF1,t14"mpm/ash_c"  ,              -3,3,2,asinh(a)-cos(-a), "a") \
+/*5251*/ o(FFFF1,t14"mpm/ash_ch" ,              -3,3,2,asinh(a)-cosh(-a), "a") \
+/*5252*/ o(FFFF1,t14"mpm/ash_ex" ,              -3,3,2,asinh(a)-exp(-a), "a") \
+/*5253*/ o(FFFF1,t14"mpm/ash_l"  ,              -3,3,2,asinh(a)-log(-a), "a") \
+/*5254*/ o(FFFF1,t14"mpm/ash_s"  ,              -3,3,2,asinh(a)-sin(-a), "a") \
+/*5255*/ o(FFFF1,t14"mpm/ash_sh" ,              -3,3,2,asinh(a)-sinh(-a), "a") \
+/*5256*/ o(FFFF1,t14"mpm/ash_t"  ,              -3,3,2,asinh(a)-tan(-a), "a") \
+/*5257*/ o(FFFF1,t14"mpm/ash_th" ,              -3,3,2,asinh(a)-tanh(-a), "a") \
+/*5258*/ o(FFFF1,t14"mpm/at_ac"  ,              -3,3,2,atan(a)-acos(-a), "a") \
+/*5259*/ o(FFFF1,t14"mpm/at_ach" ,              -3,3,2,atan(a)-acosh(-a), "a") \
+/*5260*/ o(FFFF1,t14"mpm/at_as"  ,              -3,3,2,atan(a)-asin(-a), "a") \
+/*5261*/ o(FFFF1,t14"mpm/at_ash" ,              -3,3,2,atan(a)-asinh(-a), "a") \
+/*5262*/ o(FFFF1,t14"mpm/at_at"  ,              -3,3,2,atan(a)-atan(-a), "a") \
+/*5263*/ o(FFFF1,t14"mpm/at_c"   ,              -3,3,2,atan(a)-cos(-a), "a") \
+/*5264*/ o(FFFF1,t14"mpm/at_ch"  ,              -3,3,2,atan(a)-cosh(-a), "a") \
+/*5265*/ o(FFFF1,t14"mpm/at_ex"  ,              -3,3,2,atan(a)-exp(-a), "a") \
+/*5266*/ o(FFFF1,t14"mpm/at_l"   ,              -3,3,2,atan(a)-log(-a), "a") \
+/*5267*/ o(FFFF1,t14"mpm/at_s"   ,              -3,3,2,atan(a)-sin(-a), "a") \
+/*5268*/ o(FFFF1,t14"mpm/at_sh"  ,              -3,3,2,atan(a)-sinh(-a), "a") \
+/*5269*/ o(FFFF1,t14"mpm/at_t"   ,              -3,3,2,atan(a)-tan(-a), "a") \
+/*5270*/ o(FFFF1,t14"mpm/at_th"  ,              -3,3,2,atan(a)-tanh(-a), "a") \
+/*5271*/ o(FFFF1,t14"mpm/ath_ach",    -0.75,-0.25,0.25,atanh(a)-acosh(-a), "a") \
+/*5272*/ o(FFFF1,t14"mpm/ath_t"  ,    -0.75,-0.25,0.25,atanh(a)-tan(-a), "a") \
+/*5273*/ o(FFFF1,t14"mpm/ath_th" ,    -0.75,-0.25,0.25,atanh(a)-tanh(-a), "a") \
+/*5274*/ o(FFFF1,t14"mpm/c_ac"   ,              -3,3,2,cos(a)-acos(-a), "a") \
+/*5275*/ o(FFFF1,t14"mpm/c_ach"  ,              -3,3,2,cos(a)-acosh(-a), "a") \
+/*5276*/ o(FFFF1,t14"mpm/c_as"   ,              -3,3,2,cos(a)-asin(-a), "a") \
+/*5277*/ o(FFFF1,t14"mpm/c_ash"  ,              -3,3,2,cos(a)-asinh(-a), "a") \
+/*5278*/ o(FFFF1,t14"mpm/c_at"   ,              -3,3,2,cos(a)-atan(-a), "a") \
+/*5279*/ o(FFFF1,t14"mpm/c_l"    ,              -3,3,2,cos(a)-log(-a), "a") \
+/*5280*/ o(FFFF1,t14"mpm/c_t"    ,              -3,3,2,cos(a)-tan(-a), "a") \
+/*5281*/ o(FFFF1,t14"mpm/c_th"   ,              -3,3,2,cos(a)-tanh(-a), "a") \
+/*5282*/ o(FFFF1,t14"mpm/ch_ac"  ,              -3,3,2,cosh(a)-acos(-a), "a") \
+/*5283*/ o(FFFF1,t14"mpm/ch_ach" ,              -3,3,2,cosh(a)-acosh(-a), "a") \
+/*5284*/ o(FFFF1,t14"mpm/ch_as"  ,              -3,3,2,cosh(a)-asin(-a), "a") \
+/*5285*/ o(FFFF1,t14"mpm/ch_ash" ,              -3,3,2,cosh(a)-asinh(-a), "a") \
+/*5286*/ o(FFFF1,t14"mpm/ch_at"  ,              -3,3,2,cosh(a)-atan(-a), "a") \
+/*5287*/ o(FFFF1,t14"mpm/ch_l"   ,              -3,3,2,cosh(a)-log(-a), "a") \
+/*5288*/ o(FFFF1,t14"mpm/ch_t"   ,              -3,3,2,cosh(a)-tan(-a), "a") \
+/*5289*/ o(FFFF1,t14"mpm/ch_th"  ,              -3,3,2,cosh(a)-tanh(-a), "a") \
+/*5290*/ o(FFFF1,t14"mpm/ex_ac"  ,              -3,3,2,exp(a)-acos(-a), "a") \
+/*5291*/ o(FFFF1,t14"mpm/ex_ach" ,              -3,3,2,exp(a)-acosh(-a), "a") \
+/*5292*/ o(FFFF1,t14"mpm/ex_as"  ,              -3,3,2,exp(a)-asin(-a), "a") \
+/*5293*/ o(FFFF1,t14"mpm/ex_ash" ,              -3,3,2,exp(a)-asinh(-a), "a") \
+/*5294*/ o(FFFF1,t14"mpm/ex_at"  ,              -3,3,2,exp(a)-atan(-a), "a") \
+/*5295*/ o(FFFF1,t14"mpm/ex_l"   ,              -3,3,2,exp(a)-log(-a), "a") \
+/*5296*/ o(FFFF1,t14"mpm/ex_t"   ,              -3,3,2,exp(a)-tan(-a), "a") \
+/*5297*/ o(FFFF1,t14"mpm/ex_th"  ,              -3,3,2,exp(a)-tanh(-a), "a") \
+/*5298*/ o(FFFF1,t14"mpm/l_ac"   ,              -3,3,2,log(a)-acos(-a), "a") \
+/*5299*/ o(FFFF1,t14"mpm/l_ach"  ,              -3,3,2,log(a)-acosh(-a), "a") \
+/*5300*/ o(FFFF1,t14"mpm/l_as"   ,              -3,3,2,log(a)-asin(-a), "a") \
+/*5301*/ o(FFFF1,t14"mpm/l_ash"  ,              -3,3,2,log(a)-asinh(-a), "a") \
+/*5302*/ o(FFFF1,t14"mpm/l_at"   ,              -3,3,2,log(a)-atan(-a), "a") \
+/*5303*/ o(FFFF1,t14"mpm/l_ath"  ,    -0.75,-0.25,0.25,log(a)-atanh(-a), "a") \
+/*5304*/ o(FFFF1,t14"mpm/l_c"    ,              -3,3,2,log(a)-cos(-a), "a") \
+/*5305*/ o(FFFF1,t14"mpm/l_ch"   ,              -3,3,2,log(a)-cosh(-a), "a") \
+/*5306*/ o(FFFF1,t14"mpm/l_ex"   ,              -3,3,2,log(a)-exp(-a), "a") \
+/*5307*/ o(FFFF1,t14"mpm/l_l"    ,              -3,3,2,log(a)-log(-a), "a") \
+/*5308*/ o(FFFF1,t14"mpm/l_s"    ,              -3,3,2,log(a)-sin(-a), "a") \
+/*5309*/ o(FFFF1,t14"mpm/l_sh"   ,              -3,3,2,log(a)-sinh(-a), "a") \
+/*5310*/ o(FFFF1,t14"mpm/l_t"    ,              -3,3,2,log(a)-tan(-a), "a") \
+/*5311*/ o(FFFF1,t14"mpm/l_th"   ,              -3,3,2,log(a)-tanh(-a), "a") \
+/*5312*/ o(FFFF1,t14"mpm/s_ac"   ,              -3,3,2,sin(a)-acos(-a), "a") \
+/*5313*/ o(FFFF1,t14"mpm/s_ach"  ,              -3,3,2,sin(a)-acosh(-a), "a") \
+/*5314*/ o(FFFF1,t14"mpm/s_as"   ,              -3,3,2,sin(a)-asin(-a), "a") \
+/*5315*/ o(FFFF1,t14"mpm/s_ash"  ,              -3,3,2,sin(a)-asinh(-a), "a") \
+/*5316*/ o(FFFF1,t14"mpm/s_at"   ,              -3,3,2,sin(a)-atan(-a), "a") \
+/*5317*/ o(FFFF1,t14"mpm/s_l"    ,              -3,3,2,sin(a)-log(-a), "a") \
+/*5318*/ o(FFFF1,t14"mpm/s_t"    ,              -3,3,2,sin(a)-tan(-a), "a") \
+/*5319*/ o(FFFF1,t14"mpm/s_th"   ,              -3,3,2,sin(a)-tanh(-a), "a") \
+/*5320*/ o(FFFF1,t14"mpm/sh_ac"  ,              -3,3,2,sinh(a)-acos(-a), "a") \
+/*5321*/ o(FFFF1,t14"mpm/sh_ach" ,              -3,3,2,sinh(a)-acosh(-a), "a") \
+/*5322*/ o(FFFF1,t14"mpm/sh_as"  ,              -3,3,2,sinh(a)-asin(-a), "a") \
+/*5323*/ o(FFFF1,t14"mpm/sh_ash" ,              -3,3,2,sinh(a)-asinh(-a), "a") \
+/*5324*/ o(FFFF1,t14"mpm/sh_at"  ,              -3,3,2,sinh(a)-atan(-a), "a") \
+/*5325*/ o(FFFF1,t14"mpm/sh_l"   ,              -3,3,2,sinh(a)-log(-a), "a") \
+/*5326*/ o(FFFF1,t14"mpm/sh_t"   ,              -3,3,2,sinh(a)-tan(-a), "a") \
+/*5327*/ o(FFFF1,t14"mpm/sh_th"  ,              -3,3,2,sinh(a)-tanh(-a), "a") \
+/*5328*/ o(FFFF1,t14"mpm/t_ac"   ,              -3,3,2,tan(a)-acos(-a), "a") \
+/*5329*/ o(FFFF1,t14"mpm/t_ach"  ,              -3,3,2,tan(a)-acosh(-a), "a") \
+/*5330*/ o(FFFF1,t14"mpm/t_as"   ,              -3,3,2,tan(a)-asin(-a), "a") \
+/*5331*/ o(FFFF1,t14"mpm/t_ash"  ,              -3,3,2,tan(a)-asinh(-a), "a") \
+/*5332*/ o(FFFF1,t14"mpm/t_at"   ,              -3,3,2,tan(a)-atan(-a), "a") \
+/*5333*/ o(FFFF1,t14"mpm/t_ath"  ,    -0.75,-0.25,0.25,tan(a)-atanh(-a), "a") \
+/*5334*/ o(FFFF1,t14"mpm/t_c"    ,              -3,3,2,tan(a)-cos(-a), "a") \
+/*5335*/ o(FFFF1,t14"mpm/t_ch"   ,              -3,3,2,tan(a)-cosh(-a), "a") \
+/*5336*/ o(FFFF1,t14"mpm/t_ex"   ,              -3,3,2,tan(a)-exp(-a), "a") \
+/*5337*/ o(FFFF1,t14"mpm/t_l"    ,              -3,3,2,tan(a)-log(-a), "a") \
+/*5338*/ o(FFFF1,t14"mpm/t_s"    ,              -3,3,2,tan(a)-sin(-a), "a") \
+/*5339*/ o(FFFF1,t14"mpm/t_sh"   ,              -3,3,2,tan(a)-sinh(-a), "a") \
+/*5340*/ o(FFFF1,t14"mpm/t_t"    ,              -3,3,2,tan(a)-tan(-a), "a") \
+/*5341*/ o(FFFF1,t14"mpm/t_th"   ,              -3,3,2,tan(a)-tanh(-a), "a") \
+/*5342*/ o(FFFF1,t14"mpm/th_ac"  ,              -3,3,2,tanh(a)-acos(-a), "a") \
+/*5343*/ o(FFFF1,t14"mpm/th_ach" ,              -3,3,2,tanh(a)-acosh(-a), "a") \
+/*5344*/ o(FFFF1,t14"mpm/th_as"  ,              -3,3,2,tanh(a)-asin(-a), "a") \
+/*5345*/ o(FFFF1,t14"mpm/th_ash" ,              -3,3,2,tanh(a)-asinh(-a), "a") \
+/*5346*/ o(FFFF1,t14"mpm/th_at"  ,              -3,3,2,tanh(a)-atan(-a), "a") \
+/*5347*/ o(FFFF1,t14"mpm/th_ath" ,    -0.75,-0.25,0.25,tanh(a)-atanh(-a), "a") \
+/*5348*/ o(FFFF1,t14"mpm/th_c"   ,              -3,3,2,tanh(a)-cos(-a), "a") \
+/*5349*/ o(FFFF1,t14"mpm/th_ch"  ,              -3,3,2,tanh(a)-cosh(-a), "a") \
+/*5350*/ o(FFFF1,t14"mpm/th_ex"  ,              -3,3,2,tanh(a)-exp(-a), "a") \
+/*5351*/ o(FFFF1,t14"mpm/th_l"   ,              -3,3,2,tanh(a)-log(-a), "a") \
+/*5352*/ o(FFFF1,t14"mpm/th_s"   ,              -3,3,2,tanh(a)-sin(-a), "a") \
+/*5353*/ o(FFFF1,t14"mpm/th_sh"  ,              -3,3,2,tanh(a)-sinh(-a), "a") \
+/*5354*/ o(FFFF1,t14"mpm/th_t"   ,              -3,3,2,tanh(a)-tan(-a), "a") \
+/*5355*/ o(FFFF1,t14"mpm/th_th"  ,              -3,3,2,tanh(a)-tanh(-a), "a") \
+/*5356*/ o(FFFF1,t14"mpp/ac_ac"  ,              -3,3,2,acos(a)-acos(a), "a") \
+/*5357*/ o(FFFF1,t14"mpp/ac_ach" ,              -3,3,2,acos(a)-acosh(a), "a") \
+/*5358*/ o(FFFF1,t14"mpp/ac_as"  ,              -3,3,2,acos(a)-asin(a), "a") \
+/*5359*/ o(FFFF1,t14"mpp/ac_ash" ,              -3,3,2,acos(a)-asinh(a), "a") \
+/*5360*/ o(FFFF1,t14"mpp/ac_at"  ,              -3,3,2,acos(a)-atan(a), "a") \
+/*5361*/ o(FFFF1,t14"mpp/ac_c"   ,              -3,3,2,acos(a)-cos(a), "a") \
+/*5362*/ o(FFFF1,t14"mpp/ac_ch"  ,              -3,3,2,acos(a)-cosh(a), "a") \
+/*5363*/ o(FFFF1,t14"mpp/ac_ex"  ,              -3,3,2,acos(a)-exp(a), "a") \
+/*5364*/ o(FFFF1,t14"mpp/ac_l"   ,              -3,3,2,acos(a)-log(a), "a") \
+/*5365*/ o(FFFF1,t14"mpp/ac_s"   ,              -3,3,2,acos(a)-sin(a), "a") \
+/*5366*/ o(FFFF1,t14"mpp/ac_sh"  ,              -3,3,2,acos(a)-sinh(a), "a") \
+/*5367*/ o(FFFF1,t14"mpp/ac_t"   ,              -3,3,2,acos(a)-tan(a), "a") \
+/*5368*/ o(FFFF1,t14"mpp/ac_th"  ,              -3,3,2,acos(a)-tanh(a), "a") \
+/*5369*/ o(FFFF1,t14"mpp/ach_ac" ,              -3,3,2,acosh(a)-acos(a), "a") \
+/*5370*/ o(FFFF1,t14"mpp/ach_ach",              -3,3,2,acosh(a)-acosh(a), "a") \
+/*5371*/ o(FFFF1,t14"mpp/ach_as" ,              -3,3,2,acosh(a)-asin(a), "a") \
+/*5372*/ o(FFFF1,t14"mpp/ach_ash",     0.25,0.75,0.125,acosh(a)-asinh(a), "a") \
+/*5373*/ o(FFFF1,t14"mpp/ach_at" ,              -3,3,2,acosh(a)-atan(a), "a") \
+/*5374*/ o(FFFF1,t14"mpp/ach_ath",    -0.75,-0.25,0.25,acosh(a)-atanh(a), "a") \
+/*5375*/ o(FFFF1,t14"mpp/ach_c"  ,              -3,3,2,acosh(a)-cos(a), "a") \
+/*5376*/ o(FFFF1,t14"mpp/ach_ch" ,              -3,3,2,acosh(a)-cosh(a), "a") \
+/*5377*/ o(FFFF1,t14"mpp/ach_ex" ,              -3,3,2,acosh(a)-exp(a), "a") \
+/*5378*/ o(FFFF1,t14"mpp/ach_l"  ,              -3,3,2,acosh(a)-log(a), "a") \
+/*5379*/ o(FFFF1,t14"mpp/ach_s"  ,              -3,3,2,acosh(a)-sin(a), "a") \
+/*5380*/ o(FFFF1,t14"mpp/ach_sh" ,              -3,3,2,acosh(a)-sinh(a), "a") \
+/*5381*/ o(FFFF1,t14"mpp/ach_t"  ,              -3,3,2,acosh(a)-tan(a), "a") \
+/*5382*/ o(FFFF1,t14"mpp/ach_th" ,              -3,3,2,acosh(a)-tanh(a), "a") \
+/*5383*/ o(FFFF1,t14"mpp/as_ac"  ,              -3,3,2,asin(a)-acos(a), "a") \
+/*5384*/ o(FFFF1,t14"mpp/as_ach" ,              -3,3,2,asin(a)-acosh(a), "a") \
+/*5385*/ o(FFFF1,t14"mpp/as_as"  ,              -3,3,2,asin(a)-asin(a), "a") \
+/*5386*/ o(FFFF1,t14"mpp/as_ash" ,              -3,3,2,asin(a)-asinh(a), "a") \
+/*5387*/ o(FFFF1,t14"mpp/as_at"  ,              -3,3,2,asin(a)-atan(a), "a") \
+/*5388*/ o(FFFF1,t14"mpp/as_c"   ,              -3,3,2,asin(a)-cos(a), "a") \
+/*5389*/ o(FFFF1,t14"mpp/as_ch"  ,              -3,3,2,asin(a)-cosh(a), "a") \
+/*5390*/ o(FFFF1,t14"mpp/as_ex"  ,              -3,3,2,asin(a)-exp(a), "a") \
+/*5391*/ o(FFFF1,t14"mpp/as_l"   ,              -3,3,2,asin(a)-log(a), "a") \
+/*5392*/ o(FFFF1,t14"mpp/as_s"   ,              -3,3,2,asin(a)-sin(a), "a") \
+/*5393*/ o(FFFF1,t14"mpp/as_sh"  ,              -3,3,2,asin(a)-sinh(a), "a") \
+/*5394*/ o(FFFF1,t14"mpp/as_t"   ,              -3,3,2,asin(a)-tan(a), "a") \
+/*5395*/ o(FFFF1,t14"mpp/as_th"  ,              -3,3,2,asin(a)-tanh(a), "a") \
+/*5396*/ o(FFFF1,t14"mpp/ash_ac" ,              -3,3,2,asinh(a)-acos(a), "a") \
+/*5397*/ o(FFFF1,t14"mpp/ash_ach",     0.25,0.75,0.125,asinh(a)-acosh(a), "a") \
+/*5398*/ o(FFFF1,t14"mpp/ash_as" ,              -3,3,2,asinh(a)-asin(a), "a") \
+/*5399*/ o(FFFF1,t14"mpp/ash_ash",              -3,3,2,asinh(a)-asinh(a), "a") \
+/*5400*/ o(FFFF1,t14"mpp/ash_at" ,              -3,3,2,asinh(a)-atan(a), "a") \
+/*5401*/ o(FFFF1,t14"mpp/ash_c"  ,              -3,3,2,asinh(a)-cos(a), "a") \
+/*5402*/ o(FFFF1,t14"mpp/ash_ch" ,              -3,3,2,asinh(a)-cosh(a), "a") \
+/*5403*/ o(FFFF1,t14"mpp/ash_ex" ,              -3,3,2,asinh(a)-exp(a), "a") \
+/*5404*/ o(FFFF1,t14"mpp/ash_l"  ,              -3,3,2,asinh(a)-log(a), "a") \
+/*5405*/ o(FFFF1,t14"mpp/ash_s"  ,              -3,3,2,asinh(a)-sin(a), "a") \
+/*5406*/ o(FFFF1,t14"mpp/ash_sh" ,              -3,3,2,asinh(a)-sinh(a), "a") \
+/*5407*/ o(FFFF1,t14"mpp/ash_t"  ,              -3,3,2,asinh(a)-tan(a), "a") \
+/*5408*/ o(FFFF1,t14"mpp/ash_th" ,              -3,3,2,asinh(a)-tanh(a), "a") \
+/*5409*/ o(FFFF1,t14"mpp/at_ac"  ,              -3,3,2,atan(a)-acos(a), "a") \
+/*5410*/ o(FFFF1,t14"mpp/at_ach" ,              -3,3,2,atan(a)-acosh(a), "a") \
+/*5411*/ o(FFFF1,t14"mpp/at_as"  ,              -3,3,2,atan(a)-asin(a), "a") \
+/*5412*/ o(FFFF1,t14"mpp/at_ash" ,              -3,3,2,atan(a)-asinh(a), "a") \
+/*5413*/ o(FFFF1,t14"mpp/at_at"  ,              -3,3,2,atan(a)-atan(a), "a") \
+/*5414*/ o(FFFF1,t14"mpp/at_c"   ,              -3,3,2,atan(a)-cos(a), "a") \
+/*5415*/ o(FFFF1,t14"mpp/at_ch"  ,              -3,3,2,atan(a)-cosh(a), "a") \
+/*5416*/ o(FFFF1,t14"mpp/at_ex"  ,              -3,3,2,atan(a)-exp(a), "a") \
+/*5417*/ o(FFFF1,t14"mpp/at_l"   ,              -3,3,2,atan(a)-log(a), "a") \
+/*5418*/ o(FFFF1,t14"mpp/at_s"   ,              -3,3,2,atan(a)-sin(a), "a") \
+/*5419*/ o(FFFF1,t14"mpp/at_sh"  ,              -3,3,2,atan(a)-sinh(a), "a") \
+/*5420*/ o(FFFF1,t14"mpp/at_t"   ,              -3,3,2,atan(a)-tan(a), "a") \
+/*5421*/ o(FFFF1,t14"mpp/at_th"  ,              -3,3,2,atan(a)-tanh(a), "a") \
+/*5422*/ o(FFFF1,t14"mpp/ath_ach",    -0.75,-0.25,0.25,atanh(a)-acosh(a), "a") \
+/*5423*/ o(FFFF1,t14"mpp/ath_l"  ,    -0.75,-0.25,0.25,atanh(a)-log(a), "a") \
+/*5424*/ o(FFFF1,t14"mpp/ath_t"  ,    -0.75,-0.25,0.25,atanh(a)-tan(a), "a") \
+/*5425*/ o(FFFF1,t14"mpp/ath_th" ,    -0.75,-0.25,0.25,atanh(a)-tanh(a), "a") \
+/*5426*/ o(FFFF1,t14"mpp/c_ac"   ,              -3,3,2,cos(a)-acos(a), "a") \
+/*5427*/ o(FFFF1,t14"mpp/c_ach"  ,              -3,3,2,cos(a)-acosh(a), "a") \
+/*5428*/ o(FFFF1,t14"mpp/c_as"   ,              -3,3,2,cos(a)-asin(a), "a") \
+/*5429*/ o(FFFF1,t14"mpp/c_ash"  ,              -3,3,2,cos(a)-asinh(a), "a") \
+/*5430*/ o(FFFF1,t14"mpp/c_at"   ,              -3,3,2,cos(a)-atan(a), "a") \
+/*5431*/ o(FFFF1,t14"mpp/c_l"    ,              -3,3,2,cos(a)-log(a), "a") \
+/*5432*/ o(FFFF1,t14"mpp/c_t"    ,              -3,3,2,cos(a)-tan(a), "a") \
+/*5433*/ o(FFFF1,t14"mpp/c_th"   ,              -3,3,2,cos(a)-tanh(a), "a") \
+/*5434*/ o(FFFF1,t14"mpp/ch_ac"  ,              -3,3,2,cosh(a)-acos(a), "a") \
+/*5435*/ o(FFFF1,t14"mpp/ch_ach" ,              -3,3,2,cosh(a)-acosh(a), "a") \
+/*5436*/ o(FFFF1,t14"mpp/ch_as"  ,              -3,3,2,cosh(a)-asin(a), "a") \
+/*5437*/ o(FFFF1,t14"mpp/ch_ash" ,              -3,3,2,cosh(a)-asinh(a), "a") \
+/*5438*/ o(FFFF1,t14"mpp/ch_at"  ,              -3,3,2,cosh(a)-atan(a), "a") \
+/*5439*/ o(FFFF1,t14"mpp/ch_l"   ,              -3,3,2,cosh(a)-log(a), "a") \
+/*5440*/ o(FFFF1,t14"mpp/ch_t"   ,              -3,3,2,cosh(a)-tan(a), "a") \
+/*5441*/ o(FFFF1,t14"mpp/ch_th"  ,              -3,3,2,cosh(a)-tanh(a), "a") \
+/*5442*/ o(FFFF1,t14"mpp/ex_ac"  ,              -3,3,2,exp(a)-acos(a), "a") \
+/*5443*/ o(FFFF1,t14"mpp/ex_ach" ,              -3,3,2,exp(a)-acosh(a), "a") \
+/*5444*/ o(FFFF1,t14"mpp/ex_as"  ,              -3,3,2,exp(a)-asin(a), "a") \
+/*5445*/ o(FFFF1,t14"mpp/ex_ash" ,              -3,3,2,exp(a)-asinh(a), "a") \
+/*5446*/ o(FFFF1,t14"mpp/ex_at"  ,              -3,3,2,exp(a)-atan(a), "a") \
+/*5447*/ o(FFFF1,t14"mpp/ex_l"   ,              -3,3,2,exp(a)-log(a), "a") \
+/*5448*/ o(FFFF1,t14"mpp/ex_t"   ,              -3,3,2,exp(a)-tan(a), "a") \
+/*5449*/ o(FFFF1,t14"mpp/ex_th"  ,              -3,3,2,exp(a)-tanh(a), "a") \
+/*5450*/ o(FFFF1,t14"mpp/l_ac"   ,              -3,3,2,log(a)-acos(a), "a") \
+/*5451*/ o(FFFF1,t14"mpp/l_ach"  ,              -3,3,2,log(a)-acosh(a), "a") \
+/*5452*/ o(FFFF1,t14"mpp/l_as"   ,              -3,3,2,log(a)-asin(a), "a") \
+/*5453*/ o(FFFF1,t14"mpp/l_ash"  ,              -3,3,2,log(a)-asinh(a), "a") \
+/*5454*/ o(FFFF1,t14"mpp/l_at"   ,              -3,3,2,log(a)-atan(a), "a") \
+/*5455*/ o(FFFF1,t14"mpp/l_ath"  ,    -0.75,-0.25,0.25,log(a)-atanh(a), "a") \
+/*5456*/ o(FFFF1,t14"mpp/l_c"    ,              -3,3,2,log(a)-cos(a), "a") \
+/*5457*/ o(FFFF1,t14"mpp/l_ch"   ,              -3,3,2,log(a)-cosh(a), "a") \
+/*5458*/ o(FFFF1,t14"mpp/l_ex"   ,              -3,3,2,log(a)-exp(a), "a") \
+/*5459*/ o(FFFF1,t14"mpp/l_l"    ,              -3,3,2,log(a)-log(a), "a") \
+/*5460*/ o(FFFF1,t14"mpp/l_s"    ,              -3,3,2,log(a)-sin(a), "a") \
+/*5461*/ o(FFFF1,t14"mpp/l_sh"   ,              -3,3,2,log(a)-sinh(a), "a") \
+/*5462*/ o(FFFF1,t14"mpp/l_t"    ,              -3,3,2,log(a)-tan(a), "a") \
+/*5463*/ o(FFFF1,t14"mpp/l_th"   ,              -3,3,2,log(a)-tanh(a), "a") \
+/*5464*/ o(FFFF1,t14"mpp/s_ac"   ,              -3,3,2,sin(a)-acos(a), "a") \
+/*5465*/ o(FFFF1,t14"mpp/s_ach"  ,              -3,3,2,sin(a)-acosh(a), "a") \
+/*5466*/ o(FFFF1,t14"mpp/s_as"   ,              -3,3,2,sin(a)-asin(a), "a") \
+/*5467*/ o(FFFF1,t14"mpp/s_ash"  ,              -3,3,2,sin(a)-asinh(a), "a") \
+/*5468*/ o(FFFF1,t14"mpp/s_at"   ,              -3,3,2,sin(a)-atan(a), "a") \
+/*5469*/ o(FFFF1,t14"mpp/s_l"    ,              -3,3,2,sin(a)-log(a), "a") \
+/*5470*/ o(FFFF1,t14"mpp/s_t"    ,              -3,3,2,sin(a)-tan(a), "a") \
+/*5471*/ o(FFFF1,t14"mpp/s_th"   ,              -3,3,2,sin(a)-tanh(a), "a") \
+/*5472*/ o(FFFF1,t14"mpp/sh_ac"  ,              -3,3,2,sinh(a)-acos(a), "a") \
+/*5473*/ o(FFFF1,t14"mpp/sh_ach" ,              -3,3,2,sinh(a)-acosh(a), "a") \
+/*5474*/ o(FFFF1,t14"mpp/sh_as"  ,              -3,3,2,sinh(a)-asin(a), "a") \
+/*5475*/ o(FFFF1,t14"mpp/sh_ash" ,              -3,3,2,sinh(a)-asinh(a), "a") \
+/*5476*/ o(FFFF1,t14"mpp/sh_at"  ,              -3,3,2,sinh(a)-atan(a), "a") \
+/*5477*/ o(FFFF1,t14"mpp/sh_l"   ,              -3,3,2,sinh(a)-log(a), "a") \
+/*5478*/ o(FFFF1,t14"mpp/sh_t"   ,              -3,3,2,sinh(a)-tan(a), "a") \
+/*5479*/ o(FFFF1,t14"mpp/sh_th"  ,              -3,3,2,sinh(a)-tanh(a), "a") \
+/*5480*/ o(FFFF1,t14"mpp/t_ac"   ,              -3,3,2,tan(a)-acos(a), "a") \
+/*5481*/ o(FFFF1,t14"mpp/t_ach"  ,              -3,3,2,tan(a)-acosh(a), "a") \
+/*5482*/ o(FFFF1,t14"mpp/t_as"   ,              -3,3,2,tan(a)-asin(a), "a") \
+/*5483*/ o(FFFF1,t14"mpp/t_ash"  ,              -3,3,2,tan(a)-asinh(a), "a") \
+/*5484*/ o(FFFF1,t14"mpp/t_at"   ,              -3,3,2,tan(a)-atan(a), "a") \
+/*5485*/ o(FFFF1,t14"mpp/t_ath"  ,    -0.75,-0.25,0.25,tan(a)-atanh(a), "a") \
+/*5486*/ o(FFFF1,t14"mpp/t_c"    ,              -3,3,2,tan(a)-cos(a), "a") \
+/*5487*/ o(FFFF1,t14"mpp/t_ch"   ,              -3,3,2,tan(a)-cosh(a), "a") \
+/*5488*/ o(FFFF1,t14"mpp/t_ex"   ,              -3,3,2,tan(a)-exp(a), "a") \
+/*5489*/ o(FFFF1,t14"mpp/t_l"    ,              -3,3,2,tan(a)-log(a), "a") \
+/*5490*/ o(FFFF1,t14"mpp/t_s"    ,              -3,3,2,tan(a)-sin(a), "a") \
+/*5491*/ o(FFFF1,t14"mpp/t_sh"   ,              -3,3,2,tan(a)-sinh(a), "a") \
+/*5492*/ o(FFFF1,t14"mpp/t_t"    ,              -3,3,2,tan(a)-tan(a), "a") \
+/*5493*/ o(FFFF1,t14"mpp/t_th"   ,              -3,3,2,tan(a)-tanh(a), "a") \
+/*5494*/ o(FFFF1,t14"mpp/th_ac"  ,              -3,3,2,tanh(a)-acos(a), "a") \
+/*5495*/ o(FFFF1,t14"mpp/th_ach" ,              -3,3,2,tanh(a)-acosh(a), "a") \
+/*5496*/ o(FFFF1,t14"mpp/th_as"  ,              -3,3,2,tanh(a)-asin(a), "a") \
+/*5497*/ o(FFFF1,t14"mpp/th_ash" ,              -3,3,2,tanh(a)-asinh(a), "a") \
+/*5498*/ o(FFFF1,t14"mpp/th_at"  ,              -3,3,2,tanh(a)-atan(a), "a") \
+/*5499*/ o(FFFF1,t14"mpp/th_ath" ,    -0.75,-0.25,0.25,tanh(a)-atanh(a), "a") \
+/*5500*/ o(FFFF1,t14"mpp/th_c"   ,              -3,3,2,tanh(a)-cos(a), "a") \
+/*5501*/ o(FFFF1,t14"mpp/th_ch"  ,              -3,3,2,tanh(a)-cosh(a), "a") \
+/*5502*/ o(FFFF1,t14"mpp/th_ex"  ,              -3,3,2,tanh(a)-exp(a), "a") \
+/*5503*/ o(FFFF1,t14"mpp/th_l"   ,              -3,3,2,tanh(a)-log(a), "a") \
+/*5504*/ o(FFFF1,t14"mpp/th_s"   ,              -3,3,2,tanh(a)-sin(a), "a") \
+/*5505*/ o(FFFF1,t14"mpp/th_sh"  ,              -3,3,2,tanh(a)-sinh(a), "a") \
+/*5506*/ o(FFFF1,t14"mpp/th_t"   ,              -3,3,2,tanh(a)-tan(a), "a") \
+/*5507*/ o(FFFF1,t14"mpp/th_th"  ,              -3,3,2,tanh(a)-tanh(a), "a") \
+/*5508*/ o(FFFF1,t14"nmm/ac_ac"  ,              -3,3,2,-acos(-a)-acos(-a), "a") \
+/*5509*/ o(FFFF1,t14"nmm/ac_ach" ,              -3,3,2,-acos(-a)-acosh(-a), "a") \
+/*5510*/ o(FFFF1,t14"nmm/ac_ash" ,              -3,3,2,-acos(-a)-asinh(-a), "a") \
+/*5511*/ o(FFFF1,t14"nmm/ac_at"  ,              -3,3,2,-acos(-a)-atan(-a), "a") \
+/*5512*/ o(FFFF1,t14"nmm/ac_c"   ,              -3,3,2,-acos(-a)-cos(-a), "a") \
+/*5513*/ o(FFFF1,t14"nmm/ac_ch"  ,              -3,3,2,-acos(-a)-cosh(-a), "a") \
+/*5514*/ o(FFFF1,t14"nmm/ac_ex"  ,              -3,3,2,-acos(-a)-exp(-a), "a") \
+/*5515*/ o(FFFF1,t14"nmm/ac_l"   ,              -3,3,2,-acos(-a)-log(-a), "a") \
+/*5516*/ o(FFFF1,t14"nmm/ac_s"   ,              -3,3,2,-acos(-a)-sin(-a), "a") \
+/*5517*/ o(FFFF1,t14"nmm/ac_sh"  ,              -3,3,2,-acos(-a)-sinh(-a), "a") \
+/*5518*/ o(FFFF1,t14"nmm/ac_t"   ,              -3,3,2,-acos(-a)-tan(-a), "a") \
+/*5519*/ o(FFFF1,t14"nmm/ac_th"  ,              -3,3,2,-acos(-a)-tanh(-a), "a") \
+/*5520*/ o(FFFF1,t14"nmm/ach_ach",              -3,3,2,-acosh(-a)-acosh(-a), "a") \
+/*5521*/ o(FFFF1,t14"nmm/ach_as" ,              -3,3,2,-acosh(-a)-asin(-a), "a") \
+/*5522*/ o(FFFF1,t14"nmm/ach_ash",              -3,3,2,-acosh(-a)-asinh(-a), "a") \
+/*5523*/ o(FFFF1,t14"nmm/ach_at" ,              -3,3,2,-acosh(-a)-atan(-a), "a") \
+/*5524*/ o(FFFF1,t14"nmm/ach_ath",    -0.75,-0.25,0.25,-acosh(-a)-atanh(-a), "a") \
+/*5525*/ o(FFFF1,t14"nmm/ach_c"  ,              -3,3,2,-acosh(-a)-cos(-a), "a") \
+/*5526*/ o(FFFF1,t14"nmm/ach_ch" ,              -3,3,2,-acosh(-a)-cosh(-a), "a") \
+/*5527*/ o(FFFF1,t14"nmm/ach_ex" ,              -3,3,2,-acosh(-a)-exp(-a), "a") \
+/*5528*/ o(FFFF1,t14"nmm/ach_l"  ,              -3,3,2,-acosh(-a)-log(-a), "a") \
+/*5529*/ o(FFFF1,t14"nmm/ach_s"  ,              -3,3,2,-acosh(-a)-sin(-a), "a") \
+/*5530*/ o(FFFF1,t14"nmm/ach_sh" ,              -3,3,2,-acosh(-a)-sinh(-a), "a") \
+/*5531*/ o(FFFF1,t14"nmm/ach_t"  ,              -3,3,2,-acosh(-a)-tan(-a), "a") \
+/*5532*/ o(FFFF1,t14"nmm/ach_th" ,              -3,3,2,-acosh(-a)-tanh(-a), "a") \
+/*5533*/ o(FFFF1,t14"nmm/as_as"  ,              -3,3,2,-asin(-a)-asin(-a), "a") \
+/*5534*/ o(FFFF1,t14"nmm/as_ash" ,              -3,3,2,-asin(-a)-asinh(-a), "a") \
+/*5535*/ o(FFFF1,t14"nmm/as_at"  ,              -3,3,2,-asin(-a)-atan(-a), "a") \
+/*5536*/ o(FFFF1,t14"nmm/as_c"   ,              -3,3,2,-asin(-a)-cos(-a), "a") \
+/*5537*/ o(FFFF1,t14"nmm/as_ch"  ,              -3,3,2,-asin(-a)-cosh(-a), "a") \
+/*5538*/ o(FFFF1,t14"nmm/as_ex"  ,              -3,3,2,-asin(-a)-exp(-a), "a") \
+/*5539*/ o(FFFF1,t14"nmm/as_l"   ,              -3,3,2,-asin(-a)-log(-a), "a") \
+/*5540*/ o(FFFF1,t14"nmm/as_s"   ,              -3,3,2,-asin(-a)-sin(-a), "a") \
+/*5541*/ o(FFFF1,t14"nmm/as_sh"  ,              -3,3,2,-asin(-a)-sinh(-a), "a") \
+/*5542*/ o(FFFF1,t14"nmm/as_t"   ,              -3,3,2,-asin(-a)-tan(-a), "a") \
+/*5543*/ o(FFFF1,t14"nmm/as_th"  ,              -3,3,2,-asin(-a)-tanh(-a), "a") \
+/*5544*/ o(FFFF1,t14"nmm/ash_ash",              -3,3,2,-asinh(-a)-asinh(-a), "a") \
+/*5545*/ o(FFFF1,t14"nmm/ash_at" ,              -3,3,2,-asinh(-a)-atan(-a), "a") \
+/*5546*/ o(FFFF1,t14"nmm/ash_c"  ,              -3,3,2,-asinh(-a)-cos(-a), "a") \
+/*5547*/ o(FFFF1,t14"nmm/ash_ch" ,              -3,3,2,-asinh(-a)-cosh(-a), "a") \
+/*5548*/ o(FFFF1,t14"nmm/ash_ex" ,              -3,3,2,-asinh(-a)-exp(-a), "a") \
+/*5549*/ o(FFFF1,t14"nmm/ash_l"  ,              -3,3,2,-asinh(-a)-log(-a), "a") \
+/*5550*/ o(FFFF1,t14"nmm/ash_s"  ,              -3,3,2,-asinh(-a)-sin(-a), "a") \
+/*5551*/ o(FFFF1,t14"nmm/ash_sh" ,              -3,3,2,-asinh(-a)-sinh(-a), "a") \
+/*5552*/ o(FFFF1,t14"nmm/ash_t"  ,              -3,3,2,-asinh(-a)-tan(-a), "a") \
+/*5553*/ o(FFFF1,t14"nmm/ash_th" ,              -3,3,2,-asinh(-a)-tanh(-a), "a") \
+/*5554*/ o(FFFF1,t14"nmm/at_at"  ,              -3,3,2,-atan(-a)-atan(-a), "a") \
+/*5555*/ o(FFFF1,t14"nmm/at_c"   ,              -3,3,2,-atan(-a)-cos(-a), "a") \
+/*5556*/ o(FFFF1,t14"nmm/at_ch"  ,              -3,3,2,-atan(-a)-cosh(-a), "a") \
+/*5557*/ o(FFFF1,t14"nmm/at_ex"  ,              -3,3,2,-atan(-a)-exp(-a), "a") \
+/*5558*/ o(FFFF1,t14"nmm/at_l"   ,              -3,3,2,-atan(-a)-log(-a), "a") \
+/*5559*/ o(FFFF1,t14"nmm/at_s"   ,              -3,3,2,-atan(-a)-sin(-a), "a") \
+/*5560*/ o(FFFF1,t14"nmm/at_sh"  ,              -3,3,2,-atan(-a)-sinh(-a), "a") \
+/*5561*/ o(FFFF1,t14"nmm/at_t"   ,              -3,3,2,-atan(-a)-tan(-a), "a") \
+/*5562*/ o(FFFF1,t14"nmm/at_th"  ,              -3,3,2,-atan(-a)-tanh(-a), "a") \
+/*5563*/ o(FFFF1,t14"nmm/ath_t"  ,    -0.75,-0.25,0.25,-atanh(-a)-tan(-a), "a") \
+/*5564*/ o(FFFF1,t14"nmm/ath_th" ,    -0.75,-0.25,0.25,-atanh(-a)-tanh(-a), "a") \
+/*5565*/ o(FFFF1,t14"nmm/c_l"    ,              -3,3,2,-cos(-a)-log(-a), "a") \
+/*5566*/ o(FFFF1,t14"nmm/c_t"    ,              -3,3,2,-cos(-a)-tan(-a), "a") \
+/*5567*/ o(FFFF1,t14"nmm/c_th"   ,              -3,3,2,-cos(-a)-tanh(-a), "a") \
+/*5568*/ o(FFFF1,t14"nmm/ch_l"   ,              -3,3,2,-cosh(-a)-log(-a), "a") \
+/*5569*/ o(FFFF1,t14"nmm/ch_t"   ,              -3,3,2,-cosh(-a)-tan(-a), "a") \
+/*5570*/ o(FFFF1,t14"nmm/ch_th"  ,              -3,3,2,-cosh(-a)-tanh(-a), "a") \
+/*5571*/ o(FFFF1,t14"nmm/ex_l"   ,              -3,3,2,-exp(-a)-log(-a), "a") \
+/*5572*/ o(FFFF1,t14"nmm/ex_t"   ,              -3,3,2,-exp(-a)-tan(-a), "a") \
+/*5573*/ o(FFFF1,t14"nmm/ex_th"  ,              -3,3,2,-exp(-a)-tanh(-a), "a") \
+/*5574*/ o(FFFF1,t14"nmm/l_l"    ,              -3,3,2,-log(-a)-log(-a), "a") \
+/*5575*/ o(FFFF1,t14"nmm/l_s"    ,              -3,3,2,-log(-a)-sin(-a), "a") \
+/*5576*/ o(FFFF1,t14"nmm/l_sh"   ,              -3,3,2,-log(-a)-sinh(-a), "a") \
+/*5577*/ o(FFFF1,t14"nmm/l_t"    ,              -3,3,2,-log(-a)-tan(-a), "a") \
+/*5578*/ o(FFFF1,t14"nmm/l_th"   ,              -3,3,2,-log(-a)-tanh(-a), "a") \
+/*5579*/ o(FFFF1,t14"nmm/s_t"    ,              -3,3,2,-sin(-a)-tan(-a), "a") \
+/*5580*/ o(FFFF1,t14"nmm/s_th"   ,              -3,3,2,-sin(-a)-tanh(-a), "a") \
+/*5581*/ o(FFFF1,t14"nmm/sh_t"   ,              -3,3,2,-sinh(-a)-tan(-a), "a") \
+/*5582*/ o(FFFF1,t14"nmm/sh_th"  ,              -3,3,2,-sinh(-a)-tanh(-a), "a") \
+/*5583*/ o(FFFF1,t14"nmm/t_t"    ,              -3,3,2,-tan(-a)-tan(-a), "a") \
+/*5584*/ o(FFFF1,t14"nmm/t_th"   ,              -3,3,2,-tan(-a)-tanh(-a), "a") \
+/*5585*/ o(FFFF1,t14"nmm/th_th"  ,              -3,3,2,-tanh(-a)-tanh(-a), "a") \
+/*5586*/ o(FFFF1,t14"npm/ac_ach" ,              -3,3,2,-acos(a)-acosh(-a), "a") \
+/*5587*/ o(FFFF1,t14"npm/ac_as"  ,              -3,3,2,-acos(a)-asin(-a), "a") \
+/*5588*/ o(FFFF1,t14"npm/ac_ash" ,              -3,3,2,-acos(a)-asinh(-a), "a") \
+/*5589*/ o(FFFF1,t14"npm/ac_at"  ,              -3,3,2,-acos(a)-atan(-a), "a") \
+/*5590*/ o(FFFF1,t14"npm/ac_c"   ,              -3,3,2,-acos(a)-cos(-a), "a") \
+/*5591*/ o(FFFF1,t14"npm/ac_ch"  ,              -3,3,2,-acos(a)-cosh(-a), "a") \
+/*5592*/ o(FFFF1,t14"npm/ac_ex"  ,              -3,3,2,-acos(a)-exp(-a), "a") \
+/*5593*/ o(FFFF1,t14"npm/ac_l"   ,              -3,3,2,-acos(a)-log(-a), "a") \
+/*5594*/ o(FFFF1,t14"npm/ac_s"   ,              -3,3,2,-acos(a)-sin(-a), "a") \
+/*5595*/ o(FFFF1,t14"npm/ac_sh"  ,              -3,3,2,-acos(a)-sinh(-a), "a") \
+/*5596*/ o(FFFF1,t14"npm/ac_t"   ,              -3,3,2,-acos(a)-tan(-a), "a") \
+/*5597*/ o(FFFF1,t14"npm/ac_th"  ,              -3,3,2,-acos(a)-tanh(-a), "a") \
+/*5598*/ o(FFFF1,t14"npm/ach_ac" ,              -3,3,2,-acosh(a)-acos(-a), "a") \
+/*5599*/ o(FFFF1,t14"npm/ach_as" ,              -3,3,2,-acosh(a)-asin(-a), "a") \
+/*5600*/ o(FFFF1,t14"npm/ach_at" ,              -3,3,2,-acosh(a)-atan(-a), "a") \
+/*5601*/ o(FFFF1,t14"npm/ach_ath",    -0.75,-0.25,0.25,-acosh(a)-atanh(-a), "a") \
+/*5602*/ o(FFFF1,t14"npm/ach_c"  ,              -3,3,2,-acosh(a)-cos(-a), "a") \
+/*5603*/ o(FFFF1,t14"npm/ach_ch" ,              -3,3,2,-acosh(a)-cosh(-a), "a") \
+/*5604*/ o(FFFF1,t14"npm/ach_ex" ,              -3,3,2,-acosh(a)-exp(-a), "a") \
+/*5605*/ o(FFFF1,t14"npm/ach_l"  ,              -3,3,2,-acosh(a)-log(-a), "a") \
+/*5606*/ o(FFFF1,t14"npm/ach_s"  ,              -3,3,2,-acosh(a)-sin(-a), "a") \
+/*5607*/ o(FFFF1,t14"npm/ach_sh" ,              -3,3,2,-acosh(a)-sinh(-a), "a") \
+/*5608*/ o(FFFF1,t14"npm/ach_t"  ,              -3,3,2,-acosh(a)-tan(-a), "a") \
+/*5609*/ o(FFFF1,t14"npm/ach_th" ,              -3,3,2,-acosh(a)-tanh(-a), "a") \
+/*5610*/ o(FFFF1,t14"npm/as_ac"  ,              -3,3,2,-asin(a)-acos(-a), "a") \
+/*5611*/ o(FFFF1,t14"npm/as_ach" ,              -3,3,2,-asin(a)-acosh(-a), "a") \
+/*5612*/ o(FFFF1,t14"npm/as_ash" ,              -3,3,2,-asin(a)-asinh(-a), "a") \
+/*5613*/ o(FFFF1,t14"npm/as_at"  ,              -3,3,2,-asin(a)-atan(-a), "a") \
+/*5614*/ o(FFFF1,t14"npm/as_c"   ,              -3,3,2,-asin(a)-cos(-a), "a") \
+/*5615*/ o(FFFF1,t14"npm/as_ch"  ,              -3,3,2,-asin(a)-cosh(-a), "a") \
+/*5616*/ o(FFFF1,t14"npm/as_ex"  ,              -3,3,2,-asin(a)-exp(-a), "a") \
+/*5617*/ o(FFFF1,t14"npm/as_l"   ,              -3,3,2,-asin(a)-log(-a), "a") \
+/*5618*/ o(FFFF1,t14"npm/as_s"   ,              -3,3,2,-asin(a)-sin(-a), "a") \
+/*5619*/ o(FFFF1,t14"npm/as_sh"  ,              -3,3,2,-asin(a)-sinh(-a), "a") \
+/*5620*/ o(FFFF1,t14"npm/as_t"   ,              -3,3,2,-asin(a)-tan(-a), "a") \
+/*5621*/ o(FFFF1,t14"npm/as_th"  ,              -3,3,2,-asin(a)-tanh(-a), "a") \
+/*5622*/ o(FFFF1,t14"npm/ash_ac" ,              -3,3,2,-asinh(a)-acos(-a), "a") \
+/*5623*/ o(FFFF1,t14"npm/ash_as" ,              -3,3,2,-asinh(a)-asin(-a), "a") \
+/*5624*/ o(FFFF1,t14"npm/ash_at" ,              -3,3,2,-asinh(a)-atan(-a), "a") \
+/*5625*/ o(FFFF1,t14"npm/ash_c"  ,              -3,3,2,-asinh(a)-cos(-a), "a") \
+/*5626*/ o(FFFF1,t14"npm/ash_ch" ,              -3,3,2,-asinh(a)-cosh(-a), "a") \
+/*5627*/ o(FFFF1,t14"npm/ash_ex" ,              -3,3,2,-asinh(a)-exp(-a), "a") \
+/*5628*/ o(FFFF1,t14"npm/ash_l"  ,              -3,3,2,-asinh(a)-log(-a), "a") \
+/*5629*/ o(FFFF1,t14"npm/ash_s"  ,              -3,3,2,-asinh(a)-sin(-a), "a") \
+/*5630*/ o(FFFF1,t14"npm/ash_sh" ,              -3,3,2,-asinh(a)-sinh(-a), "a") \
+/*5631*/ o(FFFF1,t14"npm/ash_t"  ,              -3,3,2,-asinh(a)-tan(-a), "a") \
+/*5632*/ o(FFFF1,t14"npm/ash_th" ,              -3,3,2,-asinh(a)-tanh(-a), "a") \
+/*5633*/ o(FFFF1,t14"npm/at_ac"  ,              -3,3,2,-atan(a)-acos(-a), "a") \
+/*5634*/ o(FFFF1,t14"npm/at_ach" ,              -3,3,2,-atan(a)-acosh(-a), "a") \
+/*5635*/ o(FFFF1,t14"npm/at_as"  ,              -3,3,2,-atan(a)-asin(-a), "a") \
+/*5636*/ o(FFFF1,t14"npm/at_ash" ,              -3,3,2,-atan(a)-asinh(-a), "a") \
+/*5637*/ o(FFFF1,t14"npm/at_at"  ,              -3,3,2,-atan(a)-atan(-a), "a") \
+/*5638*/ o(FFFF1,t14"npm/at_c"   ,              -3,3,2,-atan(a)-cos(-a), "a") \
+/*5639*/ o(FFFF1,t14"npm/at_ch"  ,              -3,3,2,-atan(a)-cosh(-a), "a") \
+/*5640*/ o(FFFF1,t14"npm/at_ex"  ,              -3,3,2,-atan(a)-exp(-a), "a") \
+/*5641*/ o(FFFF1,t14"npm/at_l"   ,              -3,3,2,-atan(a)-log(-a), "a") \
+/*5642*/ o(FFFF1,t14"npm/at_s"   ,              -3,3,2,-atan(a)-sin(-a), "a") \
+/*5643*/ o(FFFF1,t14"npm/at_sh"  ,              -3,3,2,-atan(a)-sinh(-a), "a") \
+/*5644*/ o(FFFF1,t14"npm/at_t"   ,              -3,3,2,-atan(a)-tan(-a), "a") \
+/*5645*/ o(FFFF1,t14"npm/at_th"  ,              -3,3,2,-atan(a)-tanh(-a), "a") \
+/*5646*/ o(FFFF1,t14"npm/ath_ach",    -0.75,-0.25,0.25,-atanh(a)-acosh(-a), "a") \
+/*5647*/ o(FFFF1,t14"npm/ath_t"  ,    -0.75,-0.25,0.25,-atanh(a)-tan(-a), "a") \
+/*5648*/ o(FFFF1,t14"npm/ath_th" ,    -0.75,-0.25,0.25,-atanh(a)-tanh(-a), "a") \
+/*5649*/ o(FFFF1,t14"npm/c_ac"   ,              -3,3,2,-cos(a)-acos(-a), "a") \
+/*5650*/ o(FFFF1,t14"npm/c_ach"  ,              -3,3,2,-cos(a)-acosh(-a), "a") \
+/*5651*/ o(FFFF1,t14"npm/c_as"   ,              -3,3,2,-cos(a)-asin(-a), "a") \
+/*5652*/ o(FFFF1,t14"npm/c_ash"  ,              -3,3,2,-cos(a)-asinh(-a), "a") \
+/*5653*/ o(FFFF1,t14"npm/c_at"   ,              -3,3,2,-cos(a)-atan(-a), "a") \
+/*5654*/ o(FFFF1,t14"npm/c_l"    ,              -3,3,2,-cos(a)-log(-a), "a") \
+/*5655*/ o(FFFF1,t14"npm/c_t"    ,              -3,3,2,-cos(a)-tan(-a), "a") \
+/*5656*/ o(FFFF1,t14"npm/c_th"   ,              -3,3,2,-cos(a)-tanh(-a), "a") \
+/*5657*/ o(FFFF1,t14"npm/ch_ac"  ,              -3,3,2,-cosh(a)-acos(-a), "a") \
+/*5658*/ o(FFFF1,t14"npm/ch_ach" ,              -3,3,2,-cosh(a)-acosh(-a), "a") \
+/*5659*/ o(FFFF1,t14"npm/ch_as"  ,              -3,3,2,-cosh(a)-asin(-a), "a") \
+/*5660*/ o(FFFF1,t14"npm/ch_ash" ,              -3,3,2,-cosh(a)-asinh(-a), "a") \
+/*5661*/ o(FFFF1,t14"npm/ch_at"  ,              -3,3,2,-cosh(a)-atan(-a), "a") \
+/*5662*/ o(FFFF1,t14"npm/ch_l"   ,              -3,3,2,-cosh(a)-log(-a), "a") \
+/*5663*/ o(FFFF1,t14"npm/ch_t"   ,              -3,3,2,-cosh(a)-tan(-a), "a") \
+/*5664*/ o(FFFF1,t14"npm/ch_th"  ,              -3,3,2,-cosh(a)-tanh(-a), "a") \
+/*5665*/ o(FFFF1,t14"npm/ex_ac"  ,              -3,3,2,-exp(a)-acos(-a), "a") \
+/*5666*/ o(FFFF1,t14"npm/ex_ach" ,              -3,3,2,-exp(a)-acosh(-a), "a") \
+/*5667*/ o(FFFF1,t14"npm/ex_as"  ,              -3,3,2,-exp(a)-asin(-a), "a") \
+/*5668*/ o(FFFF1,t14"npm/ex_ash" ,              -3,3,2,-exp(a)-asinh(-a), "a") \
+/*5669*/ o(FFFF1,t14"npm/ex_at"  ,              -3,3,2,-exp(a)-atan(-a), "a") \
+/*5670*/ o(FFFF1,t14"npm/ex_l"   ,              -3,3,2,-exp(a)-log(-a), "a") \
+/*5671*/ o(FFFF1,t14"npm/ex_t"   ,              -3,3,2,-exp(a)-tan(-a), "a") \
+/*5672*/ o(FFFF1,t14"npm/ex_th"  ,              -3,3,2,-exp(a)-tanh(-a), "a") \
+/*5673*/ o(FFFF1,t14"npm/l_ac"   ,              -3,3,2,-log(a)-acos(-a), "a") \
+/*5674*/ o(FFFF1,t14"npm/l_ach"  ,              -3,3,2,-log(a)-acosh(-a), "a") \
+/*5675*/ o(FFFF1,t14"npm/l_as"   ,              -3,3,2,-log(a)-asin(-a), "a") \
+/*5676*/ o(FFFF1,t14"npm/l_ash"  ,              -3,3,2,-log(a)-asinh(-a), "a") \
+/*5677*/ o(FFFF1,t14"npm/l_at"   ,              -3,3,2,-log(a)-atan(-a), "a") \
+/*5678*/ o(FFFF1,t14"npm/l_ath"  ,    -0.75,-0.25,0.25,-log(a)-atanh(-a), "a") \
+/*5679*/ o(FFFF1,t14"npm/l_c"    ,              -3,3,2,-log(a)-cos(-a), "a") \
+/*5680*/ o(FFFF1,t14"npm/l_ch"   ,              -3,3,2,-log(a)-cosh(-a), "a") \
+/*5681*/ o(FFFF1,t14"npm/l_ex"   ,              -3,3,2,-log(a)-exp(-a), "a") \
+/*5682*/ o(FFFF1,t14"npm/l_l"    ,              -3,3,2,-log(a)-log(-a), "a") \
+/*5683*/ o(FFFF1,t14"npm/l_s"    ,              -3,3,2,-log(a)-sin(-a), "a") \
+/*5684*/ o(FFFF1,t14"npm/l_sh"   ,              -3,3,2,-log(a)-sinh(-a), "a") \
+/*5685*/ o(FFFF1,t14"npm/l_t"    ,              -3,3,2,-log(a)-tan(-a), "a") \
+/*5686*/ o(FFFF1,t14"npm/l_th"   ,              -3,3,2,-log(a)-tanh(-a), "a") \
+/*5687*/ o(FFFF1,t14"npm/s_ac"   ,              -3,3,2,-sin(a)-acos(-a), "a") \
+/*5688*/ o(FFFF1,t14"npm/s_ach"  ,              -3,3,2,-sin(a)-acosh(-a), "a") \
+/*5689*/ o(FFFF1,t14"npm/s_as"   ,              -3,3,2,-sin(a)-asin(-a), "a") \
+/*5690*/ o(FFFF1,t14"npm/s_ash"  ,              -3,3,2,-sin(a)-asinh(-a), "a") \
+/*5691*/ o(FFFF1,t14"npm/s_at"   ,              -3,3,2,-sin(a)-atan(-a), "a") \
+/*5692*/ o(FFFF1,t14"npm/s_l"    ,              -3,3,2,-sin(a)-log(-a), "a") \
+/*5693*/ o(FFFF1,t14"npm/s_t"    ,              -3,3,2,-sin(a)-tan(-a), "a") \
+/*5694*/ o(FFFF1,t14"npm/s_th"   ,              -3,3,2,-sin(a)-tanh(-a), "a") \
+/*5695*/ o(FFFF1,t14"npm/sh_ac"  ,              -3,3,2,-sinh(a)-acos(-a), "a") \
+/*5696*/ o(FFFF1,t14"npm/sh_ach" ,              -3,3,2,-sinh(a)-acosh(-a), "a") \
+/*5697*/ o(FFFF1,t14"npm/sh_as"  ,              -3,3,2,-sinh(a)-asin(-a), "a") \
+/*5698*/ o(FFFF1,t14"npm/sh_ash" ,              -3,3,2,-sinh(a)-asinh(-a), "a") \
+/*5699*/ o(FFFF1,t14"npm/sh_at"  ,              -3,3,2,-sinh(a)-atan(-a), "a") \
+/*5700*/ o(FFFF1,t14"npm/sh_l"   ,              -3,3,2,-sinh(a)-log(-a), "a") \
+/*5701*/ o(FFFF1,t14"npm/sh_t"   ,              -3,3,2,-sinh(a)-tan(-a), "a") \
+/*5702*/ o(FFFF1,t14"npm/sh_th"  ,              -3,3,2,-sinh(a)-tanh(-a), "a") \
+/*5703*/ o(FFFF1,t14"npm/t_ac"   ,              -3,3,2,-tan(a)-acos(-a), "a") \
+/*5704*/ o(FFFF1,t14"npm/t_ach"  ,              -3,3,2,-tan(a)-acosh(-a), "a") \
+/*5705*/ o(FFFF1,t14"npm/t_as"   ,              -3,3,2,-tan(a)-asin(-a), "a") \
+/*5706*/ o(FFFF1,t14"npm/t_ash"  ,              -3,3,2,-tan(a)-asinh(-a), "a") \
+/*5707*/ o(FFFF1,t14"npm/t_at"   ,              -3,3,2,-tan(a)-atan(-a), "a") \
+/*5708*/ o(FFFF1,t14"npm/t_ath"  ,    -0.75,-0.25,0.25,-tan(a)-atanh(-a), "a") \
+/*5709*/ o(FFFF1,t14"npm/t_c"    ,              -3,3,2,-tan(a)-cos(-a), "a") \
+/*5710*/ o(FFFF1,t14"npm/t_ch"   ,              -3,3,2,-tan(a)-cosh(-a), "a") \
+/*5711*/ o(FFFF1,t14"npm/t_ex"   ,              -3,3,2,-tan(a)-exp(-a), "a") \
+/*5712*/ o(FFFF1,t14"npm/t_l"    ,              -3,3,2,-tan(a)-log(-a), "a") \
+/*5713*/ o(FFFF1,t14"npm/t_s"    ,              -3,3,2,-tan(a)-sin(-a), "a") \
+/*5714*/ o(FFFF1,t14"npm/t_sh"   ,              -3,3,2,-tan(a)-sinh(-a), "a") \
+/*5715*/ o(FFFF1,t14"npm/t_t"    ,              -3,3,2,-tan(a)-tan(-a), "a") \
+/*5716*/ o(FFFF1,t14"npm/t_th"   ,              -3,3,2,-tan(a)-tanh(-a), "a") \
+/*5717*/ o(FFFF1,t14"npm/th_ac"  ,              -3,3,2,-tanh(a)-acos(-a), "a") \
+/*5718*/ o(FFFF1,t14"npm/th_ach" ,              -3,3,2,-tanh(a)-acosh(-a), "a") \
+/*5719*/ o(FFFF1,t14"npm/th_as"  ,              -3,3,2,-tanh(a)-asin(-a), "a") \
+/*5720*/ o(FFFF1,t14"npm/th_ash" ,              -3,3,2,-tanh(a)-asinh(-a), "a") \
+/*5721*/ o(FFFF1,t14"npm/th_at"  ,              -3,3,2,-tanh(a)-atan(-a), "a") \
+/*5722*/ o(FFFF1,t14"npm/th_ath" ,    -0.75,-0.25,0.25,-tanh(a)-atanh(-a), "a") \
+/*5723*/ o(FFFF1,t14"npm/th_c"   ,              -3,3,2,-tanh(a)-cos(-a), "a") \
+/*5724*/ o(FFFF1,t14"npm/th_ch"  ,              -3,3,2,-tanh(a)-cosh(-a), "a") \
+/*5725*/ o(FFFF1,t14"npm/th_ex"  ,              -3,3,2,-tanh(a)-exp(-a), "a") \
+/*5726*/ o(FFFF1,t14"npm/th_l"   ,              -3,3,2,-tanh(a)-log(-a), "a") \
+/*5727*/ o(FFFF1,t14"npm/th_s"   ,              -3,3,2,-tanh(a)-sin(-a), "a") \
+/*5728*/ o(FFFF1,t14"npm/th_sh"  ,              -3,3,2,-tanh(a)-sinh(-a), "a") \
+/*5729*/ o(FFFF1,t14"npm/th_t"   ,              -3,3,2,-tanh(a)-tan(-a), "a") \
+/*5730*/ o(FFFF1,t14"npm/th_th"  ,              -3,3,2,-tanh(a)-tanh(-a), "a") \
+/*5731*/ o(FFFF1,t14"npp/ac_ac"  ,              -3,3,2,-acos(a)-acos(a), "a") \
+/*5732*/ o(FFFF1,t14"npp/ac_ach" ,              -3,3,2,-acos(a)-acosh(a), "a") \
+/*5733*/ o(FFFF1,t14"npp/ac_ash" ,              -3,3,2,-acos(a)-asinh(a), "a") \
+/*5734*/ o(FFFF1,t14"npp/ac_at"  ,              -3,3,2,-acos(a)-atan(a), "a") \
+/*5735*/ o(FFFF1,t14"npp/ac_c"   ,              -3,3,2,-acos(a)-cos(a), "a") \
+/*5736*/ o(FFFF1,t14"npp/ac_ch"  ,              -3,3,2,-acos(a)-cosh(a), "a") \
+/*5737*/ o(FFFF1,t14"npp/ac_ex"  ,              -3,3,2,-acos(a)-exp(a), "a") \
+/*5738*/ o(FFFF1,t14"npp/ac_l"   ,              -3,3,2,-acos(a)-log(a), "a") \
+/*5739*/ o(FFFF1,t14"npp/ac_s"   ,              -3,3,2,-acos(a)-sin(a), "a") \
+/*5740*/ o(FFFF1,t14"npp/ac_sh"  ,              -3,3,2,-acos(a)-sinh(a), "a") \
+/*5741*/ o(FFFF1,t14"npp/ac_t"   ,              -3,3,2,-acos(a)-tan(a), "a") \
+/*5742*/ o(FFFF1,t14"npp/ac_th"  ,              -3,3,2,-acos(a)-tanh(a), "a") \
+/*5743*/ o(FFFF1,t14"npp/ach_ach",              -3,3,2,-acosh(a)-acosh(a), "a") \
+/*5744*/ o(FFFF1,t14"npp/ach_as" ,              -3,3,2,-acosh(a)-asin(a), "a") \
+/*5745*/ o(FFFF1,t14"npp/ach_ash",              -3,3,2,-acosh(a)-asinh(a), "a") \
+/*5746*/ o(FFFF1,t14"npp/ach_at" ,              -3,3,2,-acosh(a)-atan(a), "a") \
+/*5747*/ o(FFFF1,t14"npp/ach_ath",    -0.75,-0.25,0.25,-acosh(a)-atanh(a), "a") \
+/*5748*/ o(FFFF1,t14"npp/ach_c"  ,              -3,3,2,-acosh(a)-cos(a), "a") \
+/*5749*/ o(FFFF1,t14"npp/ach_ch" ,              -3,3,2,-acosh(a)-cosh(a), "a") \
+/*5750*/ o(FFFF1,t14"npp/ach_ex" ,              -3,3,2,-acosh(a)-exp(a), "a") \
+/*5751*/ o(FFFF1,t14"npp/ach_l"  ,              -3,3,2,-acosh(a)-log(a), "a") \
+/*5752*/ o(FFFF1,t14"npp/ach_s"  ,              -3,3,2,-acosh(a)-sin(a), "a") \
+/*5753*/ o(FFFF1,t14"npp/ach_sh" ,              -3,3,2,-acosh(a)-sinh(a), "a") \
+/*5754*/ o(FFFF1,t14"npp/ach_t"  ,              -3,3,2,-acosh(a)-tan(a), "a") \
+/*5755*/ o(FFFF1,t14"npp/ach_th" ,              -3,3,2,-acosh(a)-tanh(a), "a") \
+/*5756*/ o(FFFF1,t14"npp/as_as"  ,              -3,3,2,-asin(a)-asin(a), "a") \
+/*5757*/ o(FFFF1,t14"npp/as_ash" ,              -3,3,2,-asin(a)-asinh(a), "a") \
+/*5758*/ o(FFFF1,t14"npp/as_at"  ,              -3,3,2,-asin(a)-atan(a), "a") \
+/*5759*/ o(FFFF1,t14"npp/as_c"   ,              -3,3,2,-asin(a)-cos(a), "a") \
+/*5760*/ o(FFFF1,t14"npp/as_ch"  ,              -3,3,2,-asin(a)-cosh(a), "a") \
+/*5761*/ o(FFFF1,t14"npp/as_ex"  ,              -3,3,2,-asin(a)-exp(a), "a") \
+/*5762*/ o(FFFF1,t14"npp/as_l"   ,              -3,3,2,-asin(a)-log(a), "a") \
+/*5763*/ o(FFFF1,t14"npp/as_s"   ,              -3,3,2,-asin(a)-sin(a), "a") \
+/*5764*/ o(FFFF1,t14"npp/as_sh"  ,              -3,3,2,-asin(a)-sinh(a), "a") \
+/*5765*/ o(FFFF1,t14"npp/as_t"   ,              -3,3,2,-asin(a)-tan(a), "a") \
+/*5766*/ o(FFFF1,t14"npp/as_th"  ,              -3,3,2,-asin(a)-tanh(a), "a") \
+/*5767*/ o(FFFF1,t14"npp/ash_ash",              -3,3,2,-asinh(a)-asinh(a), "a") \
+/*5768*/ o(FFFF1,t14"npp/ash_at" ,              -3,3,2,-asinh(a)-atan(a), "a") \
+/*5769*/ o(FFFF1,t14"npp/ash_c"  ,              -3,3,2,-asinh(a)-cos(a), "a") \
+/*5770*/ o(FFFF1,t14"npp/ash_ch" ,              -3,3,2,-asinh(a)-cosh(a), "a") \
+/*5771*/ o(FFFF1,t14"npp/ash_ex" ,              -3,3,2,-asinh(a)-exp(a), "a") \
+/*5772*/ o(FFFF1,t14"npp/ash_l"  ,              -3,3,2,-asinh(a)-log(a), "a") \
+/*5773*/ o(FFFF1,t14"npp/ash_s"  ,              -3,3,2,-asinh(a)-sin(a), "a") \
+/*5774*/ o(FFFF1,t14"npp/ash_sh" ,              -3,3,2,-asinh(a)-sinh(a), "a") \
+/*5775*/ o(FFFF1,t14"npp/ash_t"  ,              -3,3,2,-asinh(a)-tan(a), "a") \
+/*5776*/ o(FFFF1,t14"npp/ash_th" ,              -3,3,2,-asinh(a)-tanh(a), "a") \
+/*5777*/ o(FFFF1,t14"npp/at_at"  ,              -3,3,2,-atan(a)-atan(a), "a") \
+/*5778*/ o(FFFF1,t14"npp/at_c"   ,              -3,3,2,-atan(a)-cos(a), "a") \
+/*5779*/ o(FFFF1,t14"npp/at_ch"  ,              -3,3,2,-atan(a)-cosh(a), "a") \
+/*5780*/ o(FFFF1,t14"npp/at_ex"  ,              -3,3,2,-atan(a)-exp(a), "a") \
+/*5781*/ o(FFFF1,t14"npp/at_l"   ,              -3,3,2,-atan(a)-log(a), "a") \
+/*5782*/ o(FFFF1,t14"npp/at_s"   ,              -3,3,2,-atan(a)-sin(a), "a") \
+/*5783*/ o(FFFF1,t14"npp/at_sh"  ,              -3,3,2,-atan(a)-sinh(a), "a") \
+/*5784*/ o(FFFF1,t14"npp/at_t"   ,              -3,3,2,-atan(a)-tan(a), "a") \
+/*5785*/ o(FFFF1,t14"npp/at_th"  ,              -3,3,2,-atan(a)-tanh(a), "a") \
+/*5786*/ o(FFFF1,t14"npp/ath_l"  ,    -0.75,-0.25,0.25,-atanh(a)-log(a), "a") \
+/*5787*/ o(FFFF1,t14"npp/ath_t"  ,    -0.75,-0.25,0.25,-atanh(a)-tan(a), "a") \
+/*5788*/ o(FFFF1,t14"npp/ath_th" ,    -0.75,-0.25,0.25,-atanh(a)-tanh(a), "a") \
+/*5789*/ o(FFFF1,t14"npp/c_l"    ,              -3,3,2,-cos(a)-log(a), "a") \
+/*5790*/ o(FFFF1,t14"npp/c_t"    ,              -3,3,2,-cos(a)-tan(a), "a") \
+/*5791*/ o(FFFF1,t14"npp/c_th"   ,              -3,3,2,-cos(a)-tanh(a), "a") \
+/*5792*/ o(FFFF1,t14"npp/ch_l"   ,              -3,3,2,-cosh(a)-log(a), "a") \
+/*5793*/ o(FFFF1,t14"npp/ch_t"   ,              -3,3,2,-cosh(a)-tan(a), "a") \
+/*5794*/ o(FFFF1,t14"npp/ch_th"  ,              -3,3,2,-cosh(a)-tanh(a), "a") \
+/*5795*/ o(FFFF1,t14"npp/ex_l"   ,              -3,3,2,-exp(a)-log(a), "a") \
+/*5796*/ o(FFFF1,t14"npp/ex_t"   ,              -3,3,2,-exp(a)-tan(a), "a") \
+/*5797*/ o(FFFF1,t14"npp/ex_th"  ,              -3,3,2,-exp(a)-tanh(a), "a") \
+/*5798*/ o(FFFF1,t14"npp/l_l"    ,              -3,3,2,-log(a)-log(a), "a") \
+/*5799*/ o(FFFF1,t14"npp/l_s"    ,              -3,3,2,-log(a)-sin(a), "a") \
+/*5800*/ o(FFFF1,t14"npp/l_sh"   ,              -3,3,2,-log(a)-sinh(a), "a") \
+/*5801*/ o(FFFF1,t14"npp/l_t"    ,              -3,3,2,-log(a)-tan(a), "a") \
+/*5802*/ o(FFFF1,t14"npp/l_th"   ,              -3,3,2,-log(a)-tanh(a), "a") \
+/*5803*/ o(FFFF1,t14"npp/s_t"    ,              -3,3,2,-sin(a)-tan(a), "a") \
+/*5804*/ o(FFFF1,t14"npp/s_th"   ,              -3,3,2,-sin(a)-tanh(a), "a") \
+/*5805*/ o(FFFF1,t14"npp/sh_t"   ,              -3,3,2,-sinh(a)-tan(a), "a") \
+/*5806*/ o(FFFF1,t14"npp/sh_th"  ,              -3,3,2,-sinh(a)-tanh(a), "a") \
+/*5807*/ o(FFFF1,t14"npp/t_t"    ,              -3,3,2,-tan(a)-tan(a), "a") \
+/*5808*/ o(FFFF1,t14"npp/t_th"   ,              -3,3,2,-tan(a)-tanh(a), "a") \
+/*5809*/ o(FFFF1,t14"npp/th_th"  ,              -3,3,2,-tanh(a)-tanh(a), "a") \
+/*5810*/ o(FFFF1,t14"pmm/ac_ac"  ,              -3,3,2,acos(-a)+acos(-a), "a") \
+/*5811*/ o(FFFF1,t14"pmm/ac_ach" ,              -3,3,2,acos(-a)+acosh(-a), "a") \
+/*5812*/ o(FFFF1,t14"pmm/ac_ash" ,              -3,3,2,acos(-a)+asinh(-a), "a") \
+/*5813*/ o(FFFF1,t14"pmm/ac_at"  ,              -3,3,2,acos(-a)+atan(-a), "a") \
+/*5814*/ o(FFFF1,t14"pmm/ac_c"   ,              -3,3,2,acos(-a)+cos(-a), "a") \
+/*5815*/ o(FFFF1,t14"pmm/ac_ch"  ,              -3,3,2,acos(-a)+cosh(-a), "a") \
+/*5816*/ o(FFFF1,t14"pmm/ac_ex"  ,              -3,3,2,acos(-a)+exp(-a), "a") \
+/*5817*/ o(FFFF1,t14"pmm/ac_l"   ,              -3,3,2,acos(-a)+log(-a), "a") \
+/*5818*/ o(FFFF1,t14"pmm/ac_s"   ,              -3,3,2,acos(-a)+sin(-a), "a") \
+/*5819*/ o(FFFF1,t14"pmm/ac_sh"  ,              -3,3,2,acos(-a)+sinh(-a), "a") \
+/*5820*/ o(FFFF1,t14"pmm/ac_t"   ,              -3,3,2,acos(-a)+tan(-a), "a") \
+/*5821*/ o(FFFF1,t14"pmm/ac_th"  ,              -3,3,2,acos(-a)+tanh(-a), "a") \
+/*5822*/ o(FFFF1,t14"pmm/ach_ach",              -3,3,2,acosh(-a)+acosh(-a), "a") \
+/*5823*/ o(FFFF1,t14"pmm/ach_as" ,              -3,3,2,acosh(-a)+asin(-a), "a") \
+/*5824*/ o(FFFF1,t14"pmm/ach_ash",              -3,3,2,acosh(-a)+asinh(-a), "a") \
+/*5825*/ o(FFFF1,t14"pmm/ach_at" ,              -3,3,2,acosh(-a)+atan(-a), "a") \
+/*5826*/ o(FFFF1,t14"pmm/ach_ath",    -0.75,-0.25,0.25,acosh(-a)+atanh(-a), "a") \
+/*5827*/ o(FFFF1,t14"pmm/ach_c"  ,              -3,3,2,acosh(-a)+cos(-a), "a") \
+/*5828*/ o(FFFF1,t14"pmm/ach_ch" ,              -3,3,2,acosh(-a)+cosh(-a), "a") \
+/*5829*/ o(FFFF1,t14"pmm/ach_ex" ,              -3,3,2,acosh(-a)+exp(-a), "a") \
+/*5830*/ o(FFFF1,t14"pmm/ach_l"  ,              -3,3,2,acosh(-a)+log(-a), "a") \
+/*5831*/ o(FFFF1,t14"pmm/ach_s"  ,              -3,3,2,acosh(-a)+sin(-a), "a") \
+/*5832*/ o(FFFF1,t14"pmm/ach_sh" ,              -3,3,2,acosh(-a)+sinh(-a), "a") \
+/*5833*/ o(FFFF1,t14"pmm/ach_t"  ,              -3,3,2,acosh(-a)+tan(-a), "a") \
+/*5834*/ o(FFFF1,t14"pmm/ach_th" ,              -3,3,2,acosh(-a)+tanh(-a), "a") \
+/*5835*/ o(FFFF1,t14"pmm/as_as"  ,              -3,3,2,asin(-a)+asin(-a), "a") \
+/*5836*/ o(FFFF1,t14"pmm/as_ash" ,              -3,3,2,asin(-a)+asinh(-a), "a") \
+/*5837*/ o(FFFF1,t14"pmm/as_at"  ,              -3,3,2,asin(-a)+atan(-a), "a") \
+/*5838*/ o(FFFF1,t14"pmm/as_c"   ,              -3,3,2,asin(-a)+cos(-a), "a") \
+/*5839*/ o(FFFF1,t14"pmm/as_ch"  ,              -3,3,2,asin(-a)+cosh(-a), "a") \
+/*5840*/ o(FFFF1,t14"pmm/as_ex"  ,              -3,3,2,asin(-a)+exp(-a), "a") \
+/*5841*/ o(FFFF1,t14"pmm/as_l"   ,              -3,3,2,asin(-a)+log(-a), "a") \
+/*5842*/ o(FFFF1,t14"pmm/as_s"   ,              -3,3,2,asin(-a)+sin(-a), "a") \
+/*5843*/ o(FFFF1,t14"pmm/as_sh"  ,              -3,3,2,asin(-a)+sinh(-a), "a") \
+/*5844*/ o(FFFF1,t14"pmm/as_t"   ,              -3,3,2,asin(-a)+tan(-a), "a") \
+/*5845*/ o(FFFF1,t14"pmm/as_th"  ,              -3,3,2,asin(-a)+tanh(-a), "a") \
+/*5846*/ o(FFFF1,t14"pmm/ash_ash",              -3,3,2,asinh(-a)+asinh(-a), "a") \
+/*5847*/ o(FFFF1,t14"pmm/ash_at" ,              -3,3,2,asinh(-a)+atan(-a), "a") \
+/*5848*/ o(FFFF1,t14"pmm/ash_c"  ,              -3,3,2,asinh(-a)+cos(-a), "a") \
+/*5849*/ o(FFFF1,t14"pmm/ash_ch" ,              -3,3,2,asinh(-a)+cosh(-a), "a") \
+/*5850*/ o(FFFF1,t14"pmm/ash_ex" ,              -3,3,2,asinh(-a)+exp(-a), "a") \
+/*5851*/ o(FFFF1,t14"pmm/ash_l"  ,              -3,3,2,asinh(-a)+log(-a), "a") \
+/*5852*/ o(FFFF1,t14"pmm/ash_s"  ,              -3,3,2,asinh(-a)+sin(-a), "a") \
+/*5853*/ o(FFFF1,t14"pmm/ash_sh" ,              -3,3,2,asinh(-a)+sinh(-a), "a") \
+/*5854*/ o(FFFF1,t14"pmm/ash_t"  ,              -3,3,2,asinh(-a)+tan(-a), "a") \
+/*5855*/ o(FFFF1,t14"pmm/ash_th" ,              -3,3,2,asinh(-a)+tanh(-a), "a") \
+/*5856*/ o(FFFF1,t14"pmm/at_at"  ,              -3,3,2,atan(-a)+atan(-a), "a") \
+/*5857*/ o(FFFF1,t14"pmm/at_c"   ,              -3,3,2,atan(-a)+cos(-a), "a") \
+/*5858*/ o(FFFF1,t14"pmm/at_ch"  ,              -3,3,2,atan(-a)+cosh(-a), "a") \
+/*5859*/ o(FFFF1,t14"pmm/at_ex"  ,              -3,3,2,atan(-a)+exp(-a), "a") \
+/*5860*/ o(FFFF1,t14"pmm/at_l"   ,              -3,3,2,atan(-a)+log(-a), "a") \
+/*5861*/ o(FFFF1,t14"pmm/at_s"   ,              -3,3,2,atan(-a)+sin(-a), "a") \
+/*5862*/ o(FFFF1,t14"pmm/at_sh"  ,              -3,3,2,atan(-a)+sinh(-a), "a") \
+/*5863*/ o(FFFF1,t14"pmm/at_t"   ,              -3,3,2,atan(-a)+tan(-a), "a") \
+/*5864*/ o(FFFF1,t14"pmm/at_th"  ,              -3,3,2,atan(-a)+tanh(-a), "a") \
+/*5865*/ o(FFFF1,t14"pmm/ath_t"  ,    -0.75,-0.25,0.25,atanh(-a)+tan(-a), "a") \
+/*5866*/ o(FFFF1,t14"pmm/ath_th" ,    -0.75,-0.25,0.25,atanh(-a)+tanh(-a), "a") \
+/*5867*/ o(FFFF1,t14"pmm/c_l"    ,              -3,3,2,cos(-a)+log(-a), "a") \
+/*5868*/ o(FFFF1,t14"pmm/c_t"    ,              -3,3,2,cos(-a)+tan(-a), "a") \
+/*5869*/ o(FFFF1,t14"pmm/c_th"   ,              -3,3,2,cos(-a)+tanh(-a), "a") \
+/*5870*/ o(FFFF1,t14"pmm/ch_l"   ,              -3,3,2,cosh(-a)+log(-a), "a") \
+/*5871*/ o(FFFF1,t14"pmm/ch_t"   ,              -3,3,2,cosh(-a)+tan(-a), "a") \
+/*5872*/ o(FFFF1,t14"pmm/ch_th"  ,              -3,3,2,cosh(-a)+tanh(-a), "a") \
+/*5873*/ o(FFFF1,t14"pmm/ex_l"   ,              -3,3,2,exp(-a)+log(-a), "a") \
+/*5874*/ o(FFFF1,t14"pmm/ex_t"   ,              -3,3,2,exp(-a)+tan(-a), "a") \
+/*5875*/ o(FFFF1,t14"pmm/ex_th"  ,              -3,3,2,exp(-a)+tanh(-a), "a") \
+/*5876*/ o(FFFF1,t14"pmm/l_l"    ,              -3,3,2,log(-a)+log(-a), "a") \
+/*5877*/ o(FFFF1,t14"pmm/l_s"    ,              -3,3,2,log(-a)+sin(-a), "a") \
+/*5878*/ o(FFFF1,t14"pmm/l_sh"   ,              -3,3,2,log(-a)+sinh(-a), "a") \
+/*5879*/ o(FFFF1,t14"pmm/l_t"    ,              -3,3,2,log(-a)+tan(-a), "a") \
+/*5880*/ o(FFFF1,t14"pmm/l_th"   ,              -3,3,2,log(-a)+tanh(-a), "a") \
+/*5881*/ o(FFFF1,t14"pmm/s_t"    ,              -3,3,2,sin(-a)+tan(-a), "a") \
+/*5882*/ o(FFFF1,t14"pmm/s_th"   ,              -3,3,2,sin(-a)+tanh(-a), "a") \
+/*5883*/ o(FFFF1,t14"pmm/sh_t"   ,              -3,3,2,sinh(-a)+tan(-a), "a") \
+/*5884*/ o(FFFF1,t14"pmm/sh_th"  ,              -3,3,2,sinh(-a)+tanh(-a), "a") \
+/*5885*/ o(FFFF1,t14"pmm/t_t"    ,              -3,3,2,tan(-a)+tan(-a), "a") \
+/*5886*/ o(FFFF1,t14"pmm/t_th"   ,              -3,3,2,tan(-a)+tanh(-a), "a") \
+/*5887*/ o(FFFF1,t14"pmm/th_th"  ,              -3,3,2,tanh(-a)+tanh(-a), "a") \
+/*5888*/ o(FFFF1,t14"ppm/ac_ach" ,              -3,3,2,acos(a)+acosh(-a), "a") \
+/*5889*/ o(FFFF1,t14"ppm/ac_as"  ,              -3,3,2,acos(a)+asin(-a), "a") \
+/*5890*/ o(FFFF1,t14"ppm/ac_ash" ,              -3,3,2,acos(a)+asinh(-a), "a") \
+/*5891*/ o(FFFF1,t14"ppm/ac_at"  ,              -3,3,2,acos(a)+atan(-a), "a") \
+/*5892*/ o(FFFF1,t14"ppm/ac_c"   ,              -3,3,2,acos(a)+cos(-a), "a") \
+/*5893*/ o(FFFF1,t14"ppm/ac_ch"  ,              -3,3,2,acos(a)+cosh(-a), "a") \
+/*5894*/ o(FFFF1,t14"ppm/ac_ex"  ,              -3,3,2,acos(a)+exp(-a), "a") \
+/*5895*/ o(FFFF1,t14"ppm/ac_l"   ,              -3,3,2,acos(a)+log(-a), "a") \
+/*5896*/ o(FFFF1,t14"ppm/ac_s"   ,              -3,3,2,acos(a)+sin(-a), "a") \
+/*5897*/ o(FFFF1,t14"ppm/ac_sh"  ,              -3,3,2,acos(a)+sinh(-a), "a") \
+/*5898*/ o(FFFF1,t14"ppm/ac_t"   ,              -3,3,2,acos(a)+tan(-a), "a") \
+/*5899*/ o(FFFF1,t14"ppm/ac_th"  ,              -3,3,2,acos(a)+tanh(-a), "a") \
+/*5900*/ o(FFFF1,t14"ppm/ach_ac" ,              -3,3,2,acosh(a)+acos(-a), "a") \
+/*5901*/ o(FFFF1,t14"ppm/ach_as" ,              -3,3,2,acosh(a)+asin(-a), "a") \
+/*5902*/ o(FFFF1,t14"ppm/ach_at" ,              -3,3,2,acosh(a)+atan(-a), "a") \
+/*5903*/ o(FFFF1,t14"ppm/ach_ath",    -0.75,-0.25,0.25,acosh(a)+atanh(-a), "a") \
+/*5904*/ o(FFFF1,t14"ppm/ach_c"  ,              -3,3,2,acosh(a)+cos(-a), "a") \
+/*5905*/ o(FFFF1,t14"ppm/ach_ch" ,              -3,3,2,acosh(a)+cosh(-a), "a") \
+/*5906*/ o(FFFF1,t14"ppm/ach_ex" ,              -3,3,2,acosh(a)+exp(-a), "a") \
+/*5907*/ o(FFFF1,t14"ppm/ach_l"  ,              -3,3,2,acosh(a)+log(-a), "a") \
+/*5908*/ o(FFFF1,t14"ppm/ach_s"  ,              -3,3,2,acosh(a)+sin(-a), "a") \
+/*5909*/ o(FFFF1,t14"ppm/ach_sh" ,              -3,3,2,acosh(a)+sinh(-a), "a") \
+/*5910*/ o(FFFF1,t14"ppm/ach_t"  ,              -3,3,2,acosh(a)+tan(-a), "a") \
+/*5911*/ o(FFFF1,t14"ppm/ach_th" ,              -3,3,2,acosh(a)+tanh(-a), "a") \
+/*5912*/ o(FFFF1,t14"ppm/as_ac"  ,              -3,3,2,asin(a)+acos(-a), "a") \
+/*5913*/ o(FFFF1,t14"ppm/as_ach" ,              -3,3,2,asin(a)+acosh(-a), "a") \
+/*5914*/ o(FFFF1,t14"ppm/as_ash" ,              -3,3,2,asin(a)+asinh(-a), "a") \
+/*5915*/ o(FFFF1,t14"ppm/as_at"  ,              -3,3,2,asin(a)+atan(-a), "a") \
+/*5916*/ o(FFFF1,t14"ppm/as_c"   ,              -3,3,2,asin(a)+cos(-a), "a") \
+/*5917*/ o(FFFF1,t14"ppm/as_ch"  ,              -3,3,2,asin(a)+cosh(-a), "a") \
+/*5918*/ o(FFFF1,t14"ppm/as_ex"  ,              -3,3,2,asin(a)+exp(-a), "a") \
+/*5919*/ o(FFFF1,t14"ppm/as_l"   ,              -3,3,2,asin(a)+log(-a), "a") \
+/*5920*/ o(FFFF1,t14"ppm/as_s"   ,              -3,3,2,asin(a)+sin(-a), "a") \
+/*5921*/ o(FFFF1,t14"ppm/as_sh"  ,              -3,3,2,asin(a)+sinh(-a), "a") \
+/*5922*/ o(FFFF1,t14"ppm/as_t"   ,              -3,3,2,asin(a)+tan(-a), "a") \
+/*5923*/ o(FFFF1,t14"ppm/as_th"  ,              -3,3,2,asin(a)+tanh(-a), "a") \
+/*5924*/ o(FFFF1,t14"ppm/ash_ac" ,              -3,3,2,asinh(a)+acos(-a), "a") \
+/*5925*/ o(FFFF1,t14"ppm/ash_as" ,              -3,3,2,asinh(a)+asin(-a), "a") \
+/*5926*/ o(FFFF1,t14"ppm/ash_at" ,              -3,3,2,asinh(a)+atan(-a), "a") \
+/*5927*/ o(FFFF1,t14"ppm/ash_c"  ,              -3,3,2,asinh(a)+cos(-a), "a") \
+/*5928*/ o(FFFF1,t14"ppm/ash_ch" ,              -3,3,2,asinh(a)+cosh(-a), "a") \
+/*5929*/ o(FFFF1,t14"ppm/ash_ex" ,              -3,3,2,asinh(a)+exp(-a), "a") \
+/*5930*/ o(FFFF1,t14"ppm/ash_l"  ,              -3,3,2,asinh(a)+log(-a), "a") \
+/*5931*/ o(FFFF1,t14"ppm/ash_s"  ,              -3,3,2,asinh(a)+sin(-a), "a") \
+/*5932*/ o(FFFF1,t14"ppm/ash_sh" ,              -3,3,2,asinh(a)+sinh(-a), "a") \
+/*5933*/ o(FFFF1,t14"ppm/ash_t"  ,              -3,3,2,asinh(a)+tan(-a), "a") \
+/*5934*/ o(FFFF1,t14"ppm/ash_th" ,              -3,3,2,asinh(a)+tanh(-a), "a") \
+/*5935*/ o(FFFF1,t14"ppm/at_ac"  ,              -3,3,2,atan(a)+acos(-a), "a") \
+/*5936*/ o(FFFF1,t14"ppm/at_ach" ,              -3,3,2,atan(a)+acosh(-a), "a") \
+/*5937*/ o(FFFF1,t14"ppm/at_as"  ,              -3,3,2,atan(a)+asin(-a), "a") \
+/*5938*/ o(FFFF1,t14"ppm/at_ash" ,              -3,3,2,atan(a)+asinh(-a), "a") \
+/*5939*/ o(FFFF1,t14"ppm/at_at"  ,              -3,3,2,atan(a)+atan(-a), "a") \
+/*5940*/ o(FFFF1,t14"ppm/at_c"   ,              -3,3,2,atan(a)+cos(-a), "a") \
+/*5941*/ o(FFFF1,t14"ppm/at_ch"  ,              -3,3,2,atan(a)+cosh(-a), "a") \
+/*5942*/ o(FFFF1,t14"ppm/at_ex"  ,              -3,3,2,atan(a)+exp(-a), "a") \
+/*5943*/ o(FFFF1,t14"ppm/at_l"   ,              -3,3,2,atan(a)+log(-a), "a") \
+/*5944*/ o(FFFF1,t14"ppm/at_s"   ,              -3,3,2,atan(a)+sin(-a), "a") \
+/*5945*/ o(FFFF1,t14"ppm/at_sh"  ,              -3,3,2,atan(a)+sinh(-a), "a") \
+/*5946*/ o(FFFF1,t14"ppm/at_t"   ,              -3,3,2,atan(a)+tan(-a), "a") \
+/*5947*/ o(FFFF1,t14"ppm/at_th"  ,              -3,3,2,atan(a)+tanh(-a), "a") \
+/*5948*/ o(FFFF1,t14"ppm/ath_ach",    -0.75,-0.25,0.25,atanh(a)+acosh(-a), "a") \
+/*5949*/ o(FFFF1,t14"ppm/ath_t"  ,    -0.75,-0.25,0.25,atanh(a)+tan(-a), "a") \
+/*5950*/ o(FFFF1,t14"ppm/ath_th" ,    -0.75,-0.25,0.25,atanh(a)+tanh(-a), "a") \
+/*5951*/ o(FFFF1,t14"ppm/c_ac"   ,              -3,3,2,cos(a)+acos(-a), "a") \
+/*5952*/ o(FFFF1,t14"ppm/c_ach"  ,              -3,3,2,cos(a)+acosh(-a), "a") \
+/*5953*/ o(FFFF1,t14"ppm/c_as"   ,              -3,3,2,cos(a)+asin(-a), "a") \
+/*5954*/ o(FFFF1,t14"ppm/c_ash"  ,              -3,3,2,cos(a)+asinh(-a), "a") \
+/*5955*/ o(FFFF1,t14"ppm/c_at"   ,              -3,3,2,cos(a)+atan(-a), "a") \
+/*5956*/ o(FFFF1,t14"ppm/c_l"    ,              -3,3,2,cos(a)+log(-a), "a") \
+/*5957*/ o(FFFF1,t14"ppm/c_t"    ,              -3,3,2,cos(a)+tan(-a), "a") \
+/*5958*/ o(FFFF1,t14"ppm/c_th"   ,              -3,3,2,cos(a)+tanh(-a), "a") \
+/*5959*/ o(FFFF1,t14"ppm/ch_ac"  ,              -3,3,2,cosh(a)+acos(-a), "a") \
+/*5960*/ o(FFFF1,t14"ppm/ch_ach" ,              -3,3,2,cosh(a)+acosh(-a), "a") \
+/*5961*/ o(FFFF1,t14"ppm/ch_as"  ,              -3,3,2,cosh(a)+asin(-a), "a") \
+/*5962*/ o(FFFF1,t14"ppm/ch_ash" ,              -3,3,2,cosh(a)+asinh(-a), "a") \
+/*5963*/ o(FFFF1,t14"ppm/ch_at"  ,              -3,3,2,cosh(a)+atan(-a), "a") \
+/*5964*/ o(FFFF1,t14"ppm/ch_l"   ,              -3,3,2,cosh(a)+log(-a), "a") \
+/*5965*/ o(FFFF1,t14"ppm/ch_t"   ,              -3,3,2,cosh(a)+tan(-a), "a") \
+/*5966*/ o(FFFF1,t14"ppm/ch_th"  ,              -3,3,2,cosh(a)+tanh(-a), "a") \
+/*5967*/ o(FFFF1,t14"ppm/ex_ac"  ,              -3,3,2,exp(a)+acos(-a), "a") \
+/*5968*/ o(FFFF1,t14"ppm/ex_ach" ,              -3,3,2,exp(a)+acosh(-a), "a") \
+/*5969*/ o(FFFF1,t14"ppm/ex_as"  ,              -3,3,2,exp(a)+asin(-a), "a") \
+/*5970*/ o(FFFF1,t14"ppm/ex_ash" ,              -3,3,2,exp(a)+asinh(-a), "a") \
+/*5971*/ o(FFFF1,t14"ppm/ex_at"  ,              -3,3,2,exp(a)+atan(-a), "a") \
+/*5972*/ o(FFFF1,t14"ppm/ex_l"   ,              -3,3,2,exp(a)+log(-a), "a") \
+/*5973*/ o(FFFF1,t14"ppm/ex_t"   ,              -3,3,2,exp(a)+tan(-a), "a") \
+/*5974*/ o(FFFF1,t14"ppm/ex_th"  ,              -3,3,2,exp(a)+tanh(-a), "a") \
+/*5975*/ o(FFFF1,t14"ppm/l_ac"   ,              -3,3,2,log(a)+acos(-a), "a") \
+/*5976*/ o(FFFF1,t14"ppm/l_ach"  ,              -3,3,2,log(a)+acosh(-a), "a") \
+/*5977*/ o(FFFF1,t14"ppm/l_as"   ,              -3,3,2,log(a)+asin(-a), "a") \
+/*5978*/ o(FFFF1,t14"ppm/l_ash"  ,              -3,3,2,log(a)+asinh(-a), "a") \
+/*5979*/ o(FFFF1,t14"ppm/l_at"   ,              -3,3,2,log(a)+atan(-a), "a") \
+/*5980*/ o(FFFF1,t14"ppm/l_ath"  ,    -0.75,-0.25,0.25,log(a)+atanh(-a), "a") \
+/*5981*/ o(FFFF1,t14"ppm/l_c"    ,              -3,3,2,log(a)+cos(-a), "a") \
+/*5982*/ o(FFFF1,t14"ppm/l_ch"   ,              -3,3,2,log(a)+cosh(-a), "a") \
+/*5983*/ o(FFFF1,t14"ppm/l_ex"   ,              -3,3,2,log(a)+exp(-a), "a") \
+/*5984*/ o(FFFF1,t14"ppm/l_l"    ,              -3,3,2,log(a)+log(-a), "a") \
+/*5985*/ o(FFFF1,t14"ppm/l_s"    ,              -3,3,2,log(a)+sin(-a), "a") \
+/*5986*/ o(FFFF1,t14"ppm/l_sh"   ,              -3,3,2,log(a)+sinh(-a), "a") \
+/*5987*/ o(FFFF1,t14"ppm/l_t"    ,              -3,3,2,log(a)+tan(-a), "a") \
+/*5988*/ o(FFFF1,t14"ppm/l_th"   ,              -3,3,2,log(a)+tanh(-a), "a") \
+/*5989*/ o(FFFF1,t14"ppm/s_ac"   ,              -3,3,2,sin(a)+acos(-a), "a") \
+/*5990*/ o(FFFF1,t14"ppm/s_ach"  ,              -3,3,2,sin(a)+acosh(-a), "a") \
+/*5991*/ o(FFFF1,t14"ppm/s_as"   ,              -3,3,2,sin(a)+asin(-a), "a") \
+/*5992*/ o(FFFF1,t14"ppm/s_ash"  ,              -3,3,2,sin(a)+asinh(-a), "a") \
+/*5993*/ o(FFFF1,t14"ppm/s_at"   ,              -3,3,2,sin(a)+atan(-a), "a") \
+/*5994*/ o(FFFF1,t14"ppm/s_l"    ,              -3,3,2,sin(a)+log(-a), "a") \
+/*5995*/ o(FFFF1,t14"ppm/s_t"    ,              -3,3,2,sin(a)+tan(-a), "a") \
+/*5996*/ o(FFFF1,t14"ppm/s_th"   ,              -3,3,2,sin(a)+tanh(-a), "a") \
+/*5997*/ o(FFFF1,t14"ppm/sh_ac"  ,              -3,3,2,sinh(a)+acos(-a), "a") \
+/*5998*/ o(FFFF1,t14"ppm/sh_ach" ,              -3,3,2,sinh(a)+acosh(-a), "a") \
+/*5999*/ o(FFFF1,t14"ppm/sh_as"  ,              -3,3,2,sinh(a)+asin(-a), "a") \
+/*6000*/ o(FFFF1,t14"ppm/sh_ash" ,              -3,3,2,sinh(a)+asinh(-a), "a") \
+/*6001*/ o(FFFF1,t14"ppm/sh_at"  ,              -3,3,2,sinh(a)+atan(-a), "a") \
+/*6002*/ o(FFFF1,t14"ppm/sh_l"   ,              -3,3,2,sinh(a)+log(-a), "a") \
+/*6003*/ o(FFFF1,t14"ppm/sh_t"   ,              -3,3,2,sinh(a)+tan(-a), "a") \
+/*6004*/ o(FFFF1,t14"ppm/sh_th"  ,              -3,3,2,sinh(a)+tanh(-a), "a") \
+/*6005*/ o(FFFF1,t14"ppm/t_ac"   ,              -3,3,2,tan(a)+acos(-a), "a") \
+/*6006*/ o(FFFF1,t14"ppm/t_ach"  ,              -3,3,2,tan(a)+acosh(-a), "a") \
+/*6007*/ o(FFFF1,t14"ppm/t_as"   ,              -3,3,2,tan(a)+asin(-a), "a") \
+/*6008*/ o(FFFF1,t14"ppm/t_ash"  ,              -3,3,2,tan(a)+asinh(-a), "a") \
+/*6009*/ o(FFFF1,t14"ppm/t_at"   ,              -3,3,2,tan(a)+atan(-a), "a") \
+/*6010*/ o(FFFF1,t14"ppm/t_ath"  ,    -0.75,-0.25,0.25,tan(a)+atanh(-a), "a") \
+/*6011*/ o(FFFF1,t14"ppm/t_c"    ,              -3,3,2,tan(a)+cos(-a), "a") \
+/*6012*/ o(FFFF1,t14"ppm/t_ch"   ,              -3,3,2,tan(a)+cosh(-a), "a") \
+/*6013*/ o(FFFF1,t14"ppm/t_ex"   ,              -3,3,2,tan(a)+exp(-a), "a") \
+/*6014*/ o(FFFF1,t14"ppm/t_l"    ,              -3,3,2,tan(a)+log(-a), "a") \
+/*6015*/ o(FFFF1,t14"ppm/t_s"    ,              -3,3,2,tan(a)+sin(-a), "a") \
+/*6016*/ o(FFFF1,t14"ppm/t_sh"   ,              -3,3,2,tan(a)+sinh(-a), "a") \
+/*6017*/ o(FFFF1,t14"ppm/t_t"    ,              -3,3,2,tan(a)+tan(-a), "a") \
+/*6018*/ o(FFFF1,t14"ppm/t_th"   ,              -3,3,2,tan(a)+tanh(-a), "a") \
+/*6019*/ o(FFFF1,t14"ppm/th_ac"  ,              -3,3,2,tanh(a)+acos(-a), "a") \
+/*6020*/ o(FFFF1,t14"ppm/th_ach" ,              -3,3,2,tanh(a)+acosh(-a), "a") \
+/*6021*/ o(FFFF1,t14"ppm/th_as"  ,              -3,3,2,tanh(a)+asin(-a), "a") \
+/*6022*/ o(FFFF1,t14"ppm/th_ash" ,              -3,3,2,tanh(a)+asinh(-a), "a") \
+/*6023*/ o(FFFF1,t14"ppm/th_at"  ,              -3,3,2,tanh(a)+atan(-a), "a") \
+/*6024*/ o(FFFF1,t14"ppm/th_ath" ,    -0.75,-0.25,0.25,tanh(a)+atanh(-a), "a") \
+/*6025*/ o(FFFF1,t14"ppm/th_c"   ,              -3,3,2,tanh(a)+cos(-a), "a") \
+/*6026*/ o(FFFF1,t14"ppm/th_ch"  ,              -3,3,2,tanh(a)+cosh(-a), "a") \
+/*6027*/ o(FFFF1,t14"ppm/th_ex"  ,              -3,3,2,tanh(a)+exp(-a), "a") \
+/*6028*/ o(FFFF1,t14"ppm/th_l"   ,              -3,3,2,tanh(a)+log(-a), "a") \
+/*6029*/ o(FFFF1,t14"ppm/th_s"   ,              -3,3,2,tanh(a)+sin(-a), "a") \
+/*6030*/ o(FFFF1,t14"ppm/th_sh"  ,              -3,3,2,tanh(a)+sinh(-a), "a") \
+/*6031*/ o(FFFF1,t14"ppm/th_t"   ,              -3,3,2,tanh(a)+tan(-a), "a") \
+/*6032*/ o(FFFF1,t14"ppm/th_th"  ,              -3,3,2,tanh(a)+tanh(-a), "a") \
+/*6033*/ o(FFFF1,t14"ppp/ac_ac"  ,              -3,3,2,acos(a)+acos(a), "a") \
+/*6034*/ o(FFFF1,t14"ppp/ac_ach" ,              -3,3,2,acos(a)+acosh(a), "a") \
+/*6035*/ o(FFFF1,t14"ppp/ac_ash" ,              -3,3,2,acos(a)+asinh(a), "a") \
+/*6036*/ o(FFFF1,t14"ppp/ac_at"  ,              -3,3,2,acos(a)+atan(a), "a") \
+/*6037*/ o(FFFF1,t14"ppp/ac_c"   ,              -3,3,2,acos(a)+cos(a), "a") \
+/*6038*/ o(FFFF1,t14"ppp/ac_ch"  ,              -3,3,2,acos(a)+cosh(a), "a") \
+/*6039*/ o(FFFF1,t14"ppp/ac_ex"  ,              -3,3,2,acos(a)+exp(a), "a") \
+/*6040*/ o(FFFF1,t14"ppp/ac_l"   ,              -3,3,2,acos(a)+log(a), "a") \
+/*6041*/ o(FFFF1,t14"ppp/ac_s"   ,              -3,3,2,acos(a)+sin(a), "a") \
+/*6042*/ o(FFFF1,t14"ppp/ac_sh"  ,              -3,3,2,acos(a)+sinh(a), "a") \
+/*6043*/ o(FFFF1,t14"ppp/ac_t"   ,              -3,3,2,acos(a)+tan(a), "a") \
+/*6044*/ o(FFFF1,t14"ppp/ac_th"  ,              -3,3,2,acos(a)+tanh(a), "a") \
+/*6045*/ o(FFFF1,t14"ppp/ach_ach",              -3,3,2,acosh(a)+acosh(a), "a") \
+/*6046*/ o(FFFF1,t14"ppp/ach_as" ,              -3,3,2,acosh(a)+asin(a), "a") \
+/*6047*/ o(FFFF1,t14"ppp/ach_ash",              -3,3,2,acosh(a)+asinh(a), "a") \
+/*6048*/ o(FFFF1,t14"ppp/ach_at" ,              -3,3,2,acosh(a)+atan(a), "a") \
+/*6049*/ o(FFFF1,t14"ppp/ach_ath",    -0.75,-0.25,0.25,acosh(a)+atanh(a), "a") \
+/*6050*/ o(FFFF1,t14"ppp/ach_c"  ,              -3,3,2,acosh(a)+cos(a), "a") \
+/*6051*/ o(FFFF1,t14"ppp/ach_ch" ,              -3,3,2,acosh(a)+cosh(a), "a") \
+/*6052*/ o(FFFF1,t14"ppp/ach_ex" ,              -3,3,2,acosh(a)+exp(a), "a") \
+/*6053*/ o(FFFF1,t14"ppp/ach_l"  ,              -3,3,2,acosh(a)+log(a), "a") \
+/*6054*/ o(FFFF1,t14"ppp/ach_s"  ,              -3,3,2,acosh(a)+sin(a), "a") \
+/*6055*/ o(FFFF1,t14"ppp/ach_sh" ,              -3,3,2,acosh(a)+sinh(a), "a") \
+/*6056*/ o(FFFF1,t14"ppp/ach_t"  ,              -3,3,2,acosh(a)+tan(a), "a") \
+/*6057*/ o(FFFF1,t14"ppp/ach_th" ,              -3,3,2,acosh(a)+tanh(a), "a") \
+/*6058*/ o(FFFF1,t14"ppp/as_as"  ,              -3,3,2,asin(a)+asin(a), "a") \
+/*6059*/ o(FFFF1,t14"ppp/as_ash" ,              -3,3,2,asin(a)+asinh(a), "a") \
+/*6060*/ o(FFFF1,t14"ppp/as_at"  ,              -3,3,2,asin(a)+atan(a), "a") \
+/*6061*/ o(FFFF1,t14"ppp/as_c"   ,              -3,3,2,asin(a)+cos(a), "a") \
+/*6062*/ o(FFFF1,t14"ppp/as_ch"  ,              -3,3,2,asin(a)+cosh(a), "a") \
+/*6063*/ o(FFFF1,t14"ppp/as_ex"  ,              -3,3,2,asin(a)+exp(a), "a") \
+/*6064*/ o(FFFF1,t14"ppp/as_l"   ,              -3,3,2,asin(a)+log(a), "a") \
+/*6065*/ o(FFFF1,t14"ppp/as_s"   ,              -3,3,2,asin(a)+sin(a), "a") \
+/*6066*/ o(FFFF1,t14"ppp/as_sh"  ,              -3,3,2,asin(a)+sinh(a), "a") \
+/*6067*/ o(FFFF1,t14"ppp/as_t"   ,              -3,3,2,asin(a)+tan(a), "a") \
+/*6068*/ o(FFFF1,t14"ppp/as_th"  ,              -3,3,2,asin(a)+tanh(a), "a") \
+/*6069*/ o(FFFF1,t14"ppp/ash_ash",              -3,3,2,asinh(a)+asinh(a), "a") \
+/*6070*/ o(FFFF1,t14"ppp/ash_at" ,              -3,3,2,asinh(a)+atan(a), "a") \
+/*6071*/ o(FFFF1,t14"ppp/ash_c"  ,              -3,3,2,asinh(a)+cos(a), "a") \
+/*6072*/ o(FFFF1,t14"ppp/ash_ch" ,              -3,3,2,asinh(a)+cosh(a), "a") \
+/*6073*/ o(FFFF1,t14"ppp/ash_ex" ,              -3,3,2,asinh(a)+exp(a), "a") \
+/*6074*/ o(FFFF1,t14"ppp/ash_l"  ,              -3,3,2,asinh(a)+log(a), "a") \
+/*6075*/ o(FFFF1,t14"ppp/ash_s"  ,              -3,3,2,asinh(a)+sin(a), "a") \
+/*6076*/ o(FFFF1,t14"ppp/ash_sh" ,              -3,3,2,asinh(a)+sinh(a), "a") \
+/*6077*/ o(FFFF1,t14"ppp/ash_t"  ,              -3,3,2,asinh(a)+tan(a), "a") \
+/*6078*/ o(FFFF1,t14"ppp/ash_th" ,              -3,3,2,asinh(a)+tanh(a), "a") \
+/*6079*/ o(FFFF1,t14"ppp/at_at"  ,              -3,3,2,atan(a)+atan(a), "a") \
+/*6080*/ o(FFFF1,t14"ppp/at_c"   ,              -3,3,2,atan(a)+cos(a), "a") \
+/*6081*/ o(FFFF1,t14"ppp/at_ch"  ,              -3,3,2,atan(a)+cosh(a), "a") \
+/*6082*/ o(FFFF1,t14"ppp/at_ex"  ,              -3,3,2,atan(a)+exp(a), "a") \
+/*6083*/ o(FFFF1,t14"ppp/at_l"   ,              -3,3,2,atan(a)+log(a), "a") \
+/*6084*/ o(FFFF1,t14"ppp/at_s"   ,              -3,3,2,atan(a)+sin(a), "a") \
+/*6085*/ o(FFFF1,t14"ppp/at_sh"  ,              -3,3,2,atan(a)+sinh(a), "a") \
+/*6086*/ o(FFFF1,t14"ppp/at_t"   ,              -3,3,2,atan(a)+tan(a), "a") \
+/*6087*/ o(FFFF1,t14"ppp/at_th"  ,              -3,3,2,atan(a)+tanh(a), "a") \
+/*6088*/ o(FFFF1,t14"ppp/ath_l"  ,    -0.75,-0.25,0.25,atanh(a)+log(a), "a") \
+/*6089*/ o(FFFF1,t14"ppp/ath_t"  ,    -0.75,-0.25,0.25,atanh(a)+tan(a), "a") \
+/*6090*/ o(FFFF1,t14"ppp/ath_th" ,    -0.75,-0.25,0.25,atanh(a)+tanh(a), "a") \
+/*6091*/ o(FFFF1,t14"ppp/c_l"    ,              -3,3,2,cos(a)+log(a), "a") \
+/*6092*/ o(FFFF1,t14"ppp/c_t"    ,              -3,3,2,cos(a)+tan(a), "a") \
+/*6093*/ o(FFFF1,t14"ppp/c_th"   ,              -3,3,2,cos(a)+tanh(a), "a") \
+/*6094*/ o(FFFF1,t14"ppp/ch_l"   ,              -3,3,2,cosh(a)+log(a), "a") \
+/*6095*/ o(FFFF1,t14"ppp/ch_t"   ,              -3,3,2,cosh(a)+tan(a), "a") \
+/*6096*/ o(FFFF1,t14"ppp/ch_th"  ,              -3,3,2,cosh(a)+tanh(a), "a") \
+/*6097*/ o(FFFF1,t14"ppp/ex_l"   ,              -3,3,2,exp(a)+log(a), "a") \
+/*6098*/ o(FFFF1,t14"ppp/ex_t"   ,              -3,3,2,exp(a)+tan(a), "a") \
+/*6099*/ o(FFFF1,t14"ppp/ex_th"  ,              -3,3,2,exp(a)+tanh(a), "a") \
+/*6100*/ o(FFFF1,t14"ppp/l_l"    ,              -3,3,2,log(a)+log(a), "a") \
+/*6101*/ o(FFFF1,t14"ppp/l_s"    ,              -3,3,2,log(a)+sin(a), "a") \
+/*6102*/ o(FFFF1,t14"ppp/l_sh"   ,              -3,3,2,log(a)+sinh(a), "a") \
+/*6103*/ o(FFFF1,t14"ppp/l_t"    ,              -3,3,2,log(a)+tan(a), "a") \
+/*6104*/ o(FFFF1,t14"ppp/l_th"   ,              -3,3,2,log(a)+tanh(a), "a") \
+/*6105*/ o(FFFF1,t14"ppp/s_t"    ,              -3,3,2,sin(a)+tan(a), "a") \
+/*6106*/ o(FFFF1,t14"ppp/s_th"   ,              -3,3,2,sin(a)+tanh(a), "a") \
+/*6107*/ o(FFFF1,t14"ppp/sh_t"   ,              -3,3,2,sinh(a)+tan(a), "a") \
+/*6108*/ o(FFFF1,t14"ppp/sh_th"  ,              -3,3,2,sinh(a)+tanh(a), "a") \
+/*6109*/ o(FFFF1,t14"ppp/t_t"    ,              -3,3,2,tan(a)+tan(a), "a") \
+/*6110*/ o(FFFF1,t14"ppp/t_th"   ,              -3,3,2,tan(a)+tanh(a), "a") \
+/*6111*/ o(FFFF1,t14"ppp/th_th"  ,              -3,3,2,tanh(a)+tanh(a), "a") \
+/*6112*/ o(FFFF1,t50"12"         ,            -2,2,0.1,sin(a+4i) + 3i*cos(a+3i), "a") \
+/*6113*/ o(FFFF1,t50"13"         ,            -2,2,0.1,log(a*a), "a") \
+/*end of list */
+FP_LIST_ALL_TESTS(o)
+#undef o
+#undef q
+};
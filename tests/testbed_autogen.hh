@@ -0,0 +1,172 @@
+
+#include <type_traits>
+#include "extrasrc/fpaux.hh"
+#include "tests/testbed_defs.hh"
+
+template<typename Value_t>
+struct fp_type_mask : public std::integral_constant<unsigned, 0
+    | (1*int((false
+#ifdef FP_TEST_WANT_DOUBLE_TYPE
+ || std::is_same<Value_t, double>::value
+#endif
+)))
+    | (2*int((false
+#ifdef FP_TEST_WANT_FLOAT_TYPE
+ || std::is_same<Value_t, float>::value
+#endif
+)))
+    | (4*int((false
+#ifdef FP_TEST_WANT_LONG_DOUBLE_TYPE
+ || std::is_same<Value_t, long double>::value
+#endif
+)))
+    | (8*int((false
+#ifdef FP_TEST_WANT_LONG_INT_TYPE
+ || std::is_same<Value_t, long>::value
+#endif
+)))
+    | (16*int((false
+#ifdef FP_TEST_WANT_GMP_INT_TYPE
+ || std::is_same<Value_t, GmpInt>::value
+#endif
+)))
+    | (32*int((false
+#ifdef FP_TEST_WANT_MPFR_FLOAT_TYPE
+ || std::is_same<Value_t, MpfrFloat>::value
+#endif
+)))
+    | (64*int((false
+#ifdef FP_TEST_WANT_COMPLEX_LONG_DOUBLE_TYPE
+ || std::is_same<Value_t, std::complex<long double>>::value
+#endif
+)))
+    | (128*int((false
+#ifdef FP_TEST_WANT_COMPLEX_FLOAT_TYPE
+ || std::is_same<Value_t, std::complex<float>>::value
+#endif
+)))
+    | (256*int((false
+#ifdef FP_TEST_WANT_COMPLEX_DOUBLE_TYPE
+ || std::is_same<Value_t, std::complex<double>>::value
+#endif
+)))> {};
+
+template<typename Value_t, unsigned n = fp_type_mask<Value_t>::value>
+struct const_container {};
+
+#if 0
+
+template<typename Value_t, unsigned type_mask = fp_type_mask<Value_t>::value>
+Value_t evaluate_test(unsigned which, const Value_t* vars);
+
+#else // No "if constexpr"
+
+template<typename Value_t, unsigned type_mask = fp_type_mask<Value_t>::value>
+struct evaluator { };
+
+template<typename Value_t> struct evaluator<Value_t,1>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,2>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,4>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,8>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,16>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,32>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,64>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,128>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+template<typename Value_t> struct evaluator<Value_t,256>
+    { static Value_t calc(unsigned which, const Value_t* vars); };
+
+
+template<typename Value_t>
+inline Value_t evaluate_test(unsigned which, const Value_t* vars)
+{
+    return evaluator<Value_t>::calc(which, vars);
+}
+#endif
+
+#ifdef FP_TEST_WANT_COMPLEX_LONG_DOUBLE_TYPE
+template<>
+struct RegressionTests<std::complex<long double>>
+{
+    static const unsigned short Tests[3377];
+};
+#endif /*FP_TEST_WANT_COMPLEX_LONG_DOUBLE_TYPE */
+
+#ifdef FP_TEST_WANT_FLOAT_TYPE
+template<>
+struct RegressionTests<float>
+{
+    static const unsigned short Tests[3594];
+};
+#endif /*FP_TEST_WANT_FLOAT_TYPE */
+
+#ifdef FP_TEST_WANT_COMPLEX_FLOAT_TYPE
+template<>
+struct RegressionTests<std::complex<float>>
+{
+    static const unsigned short Tests[3393];
+};
+#endif /*FP_TEST_WANT_COMPLEX_FLOAT_TYPE */
+
+#ifdef FP_TEST_WANT_GMP_INT_TYPE
+template<>
+struct RegressionTests<GmpInt>
+{
+    static const unsigned short Tests[238];
+};
+#endif /*FP_TEST_WANT_GMP_INT_TYPE */
+
+#ifdef FP_TEST_WANT_COMPLEX_DOUBLE_TYPE
+template<>
+struct RegressionTests<std::complex<double>>
+{
+    static const unsigned short Tests[3453];
+};
+#endif /*FP_TEST_WANT_COMPLEX_DOUBLE_TYPE */
+
+#ifdef FP_TEST_WANT_MPFR_FLOAT_TYPE
+template<>
+struct RegressionTests<MpfrFloat>
+{
+    static const unsigned short Tests[3362];
+};
+#endif /*FP_TEST_WANT_MPFR_FLOAT_TYPE */
+
+#ifdef FP_TEST_WANT_LONG_DOUBLE_TYPE
+template<>
+struct RegressionTests<long double>
+{
+    static const unsigned short Tests[3573];
+};
+#endif /*FP_TEST_WANT_LONG_DOUBLE_TYPE */
+
+#ifdef FP_TEST_WANT_DOUBLE_TYPE
+template<>
+struct RegressionTests<double>
+{
+    static const unsigned short Tests[3655];
+};
+#endif /*FP_TEST_WANT_DOUBLE_TYPE */
+
+#ifdef FP_TEST_WANT_LONG_INT_TYPE
+template<>
+struct RegressionTests<long>
+{
+    static const unsigned short Tests[340];
+};
+#endif /*FP_TEST_WANT_LONG_INT_TYPE */
@@ -0,0 +1,11 @@
+#define _(name,lit)
+#define o(name,lit) const Value_t name = static_cast<Value_t>(lit##l);
+#if(0||defined(FP_TEST_WANT_GMP_INT_TYPE))
+template<typename Value_t> struct const_container<Value_t,16>
+{
+    FP_LIST_ALL_CONST(_,_,_,_,o,_,_,_,_)
+};
+#endif
+#undef o
+#undef _
+
@@ -0,0 +1,11 @@
+#define _(name,lit)
+#define o(name,lit) const MpfrFloat name{#lit, nullptr};
+#if(0||defined(FP_TEST_WANT_MPFR_FLOAT_TYPE))
+template<typename Value_t> struct const_container<Value_t,32>
+{
+    FP_LIST_ALL_CONST(_,_,_,_,_,o,_,_,_)
+};
+#endif
+#undef o
+#undef _
+
@@ -0,0 +1,11 @@
+#define _(name,lit)
+#define o(name,lit) const Value_t name = static_cast<Value_t>(lit##l);
+#if(0||defined(FP_TEST_WANT_COMPLEX_DOUBLE_TYPE))
+template<typename Value_t> struct const_container<Value_t,256>
+{
+    FP_LIST_ALL_CONST(_,_,_,_,_,_,_,_,o)
+};
+#endif
+#undef o
+#undef _
+
@@ -0,0 +1,6254 @@
+#define  T418(_,__)_ !(!fp_and(vars[0],vars[1])) __
+#define   T83(_,__)_ !fp_equal(vars[0],vars[1]) __
+#define   T85(_,__)_ !fp_greater(vars[0],vars[1]) __
+#define   T84(_,__)_ !fp_greaterOrEq(vars[0],vars[1]) __
+#define   T87(_,__)_ !fp_less(vars[0],vars[1]) __
+#define   T86(_,__)_ !fp_lessOrEq(vars[0],vars[1]) __
+#define   T88(_,__)_ !fp_nequal(vars[0],vars[1]) __
+#define  T419(_,__)_ !fp_not(fp_acos(vars[0])) __
+#define   T27(_,__)_ !fp_truth(vars[0]*vars[0]) __
+#define T3638(_,__)_ (((vars[0]-vars[1])-(((vars[1])*c.l2)-c.l3))*c.l4)+fp_sin(vars[0])*fp_cos(vars[1])-fp_cos(vars[0])*fp_sin(vars[1]) __
+#define T3644(_,__)_ ((-vars[0])-vars[0])+vars[1]*c.l1+fp_log(fp_pow(c.l1_1,vars[2])) __
+#define  T142(_,__)_ ((-vars[0])-vars[1])+c.l5 __
+#define  T135(_,__)_ ((-vars[0])/vars[1])*c.l5 __
+#define  T144(_,__)_ ((c.l7-vars[1])+vars[0])+c.l5 __
+#define  T158(_,__)_ ((fp_truth(c.l1) ? c.lm5 : c.l0)*vars[1])+((fp_truth(c.l1) ? c.l5 : c.l0)*vars[0]) __
+#define  T537(_,__)_ ((vars[0]*c.l0_2)*c.l5)+vars[0] __
+#define  T141(_,__)_ ((vars[0]+c.l7)-vars[1])+c.l5 __
+#define  T540(_,__)_ (-(c.l5))+vars[0] __
+#define   T78(_,__)_ (-vars[0])*(-vars[0]) __
+#define   T75(_,__)_ (-vars[0])*c.l5 __
+#define   T93(_,__)_ (-vars[0])*vars[0] __
+#define  T124(_,__)_ (-vars[0])+Value_t(fp_abs(vars[1])) __
+#define  T119(_,__)_ (-vars[0])+c.l5 __
+#define  T125(_,__)_ (-vars[0])-Value_t(fp_abs(vars[1])) __
+#define   T74(_,__)_ (-vars[0])/c.l5 __
+#define  T134(_,__)_ (Value_t(fp_abs(vars[0]))/vars[1])*vars[0] __
+#define  T133(_,__)_ (Value_t(fp_abs(vars[0]))/vars[1])/vars[0] __
+#define T3650(_,__)_ (c.l3_5*c.l2) + c.l10*(vars[0]*c.l3) - (fp_sin(vars[1])*c.l2) + c.l100*((vars[0]*c.l2)-(vars[1]*c.l3))*c.l2 + c.l5_0/(c.l2*c.l2) + fp_pow(c.l1_1, vars[0]*c.l2) + fp_pow(c.l1_1*c.l2, vars[0]*c.l2) __
+#define   T66(_,__)_ (c.l5*c.l4)+vars[0] __
+#define  T140(_,__)_ (c.l5-vars[1])+vars[0] __
+#define  T139(_,__)_ (c.l5-vars[1])-vars[0] __
+#define   T46(_,__)_ (c.l5/c.l4)+vars[0] __
+#define  T136(_,__)_ (c.l5/vars[1])*vars[0] __
+#define  T143(_,__)_ (c.l7-Value_t(fp_abs(vars[0])))+c.l5 __
+#define  T137(_,__)_ (c.l7/vars[0])*c.l5 __
+#define  T157(_,__)_ (c.lm5)+((fp_truth(c.l1) ? c.l5 : c.l0)*vars[0]*vars[1]) __
+#define  T132(_,__)_ (fp_inv(Value_t(fp_abs(vars[1])))*c.l5)*vars[0] __
+#define  T131(_,__)_ (fp_inv(Value_t(fp_abs(vars[1])))*c.l5)/vars[0] __
+#define  T130(_,__)_ (fp_inv(Value_t(fp_abs(vars[1])))*vars[1])/vars[0] __
+#define T3585(_,__)_ (fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1))*(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1)) __
+#define T3581(_,__)_ (fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1))+(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1)) __
+#define  T331(_,__)_ (fp_min(vars[0],fp_min(c.l1,vars[0]))+fp_min(vars[0],c.l1))/c.l2+fp_min(vars[0],c.l1)*c.l3+fp_max(c.l0,fp_min(c.lm2,c.l0)) __
+#define T3588(_,__)_ (fp_truth(c.l1) ? vars[0] : vars[1])+(fp_truth(c.l0) ? vars[2] : vars[1]) __
+#define T3589(_,__)_ (fp_truth(fp_truth(vars[1]) ? c.l1 : vars[2]) ? vars[3] : vars[0])+(fp_truth(fp_truth(vars[0]) ? vars[3] : c.l0) ? vars[1] : vars[2]) __
+#define  T251(_,__)_ (fp_truth(vars[0]) ? c.l1 : c.l0)+c.l10*(fp_truth(vars[0]) ? c.l0 : c.l1)+c.l100*(fp_greater(vars[0],c.l0) ? c.l1 : c.l0)+c.l1000*(fp_greater(vars[0],c.l0) ? c.l0 : c.l1) __
+#define  T322(_,__)_ (fp_truth(vars[0]) ? vars[1]*c.l0 : vars[0]*c.l0)*c.l0 __
+#define  T272(_,__)_ (fp_truth(vars[2]) ? (fp_truth(vars[3]) ? vars[2] : vars[0]) : (fp_truth(vars[3]) ? vars[2] : vars[1]))+(fp_truth(vars[0]) ? (fp_truth(vars[1]) ? vars[3] : vars[2]) : (fp_truth(vars[1]) ? vars[0] : vars[2])) __
+#define  T405(_,__)_ (vars[0] < c.l0) ? fp_ceil(vars[0]) : fp_floor(vars[0]) __
+#define  T385(_,__)_ (vars[0] < c.l0) ? fp_ceil(vars[0]-c.l0_5) : fp_floor(vars[0]+c.l0_5) __
+#define   T20(_,__)_ (vars[0]!=c.l0) ? vars[1] : vars[2] __
+#define  T111(_,__)_ (vars[0]*c.l5)*vars[1] __
+#define  T112(_,__)_ (vars[0]*c.l5)/vars[1] __
+#define  T150(_,__)_ (vars[0]*c.l7)*c.l5 __
+#define  T538(_,__)_ (vars[0]*vars[1]+c.l1)+(fp_sin(vars[0])+fp_sin(vars[1]))*fp_log(vars[0])*vars[1]*vars[0]*c.l0 __
+#define  T122(_,__)_ (vars[0]+c.l5)+Value_t(fp_abs(vars[1])) __
+#define  T123(_,__)_ (vars[0]+c.l5)-Value_t(fp_abs(vars[1])) __
+#define  T146(_,__)_ (vars[0]+c.l7)*c.l5 __
+#define  T149(_,__)_ (vars[0]+c.l7)+c.l5 __
+#define  T491(_,__)_ (vars[0]+vars[0])*c.l0_5 __
+#define   T49(_,__)_ (vars[0]+vars[0])*c.l7 __
+#define T3663(_,__)_ (vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2])*(vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2])+c.l2*(vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2])-vars[0]*vars[1]*(vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2])+vars[0]*(vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[0]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]+vars[1]+vars[2]) __
+#define  T338(_,__)_ (vars[0]+vars[1])+c.l2*(vars[0]-vars[2])+c.l3*(vars[0]*vars[1])+c.l4*(vars[1]/vars[2])+c.l5*(vars[0]%vars[2])+c.l6*Value_t(vars[0]<vars[1])+c.l7*Value_t(vars[0]<=vars[2])+c.l8*Value_t(vars[0]>c.l2*vars[2])+c.l9*Value_t(vars[1]>=c.l3*vars[2])+c.l10*Value_t(vars[0]+vars[1]!=vars[2])+c.l11*(c.l100+vars[0])+c.l12*(c.l101-vars[1])+c.l13*(c.l102*vars[2])+c.l14*(c.l103/vars[0]) __
+#define  T349(_,__)_ (vars[0]-c.l0_25)/vars[1] __
+#define T3651(_,__)_ (vars[0]/(c.l2*fp_acos(c.l0)))*c.l180 __
+#define  T147(_,__)_ (vars[1]+(vars[0]*c.l7))*c.l5 __
+#define  T148(_,__)_ (vars[1]-(vars[0]*c.l7))*c.l5 __
+#define T3649(_,__)_ -(c.lm5)*-fp_pow(vars[0],-fp_pow(vars[1],c.lm2)) __
+#define  T323(_,__)_ -(fp_less(vars[0],c.l0) ? vars[0] : -vars[0])+-(fp_less(vars[0],c.l5) ? c.l2 : c.l3) __
+#define   T70(_,__)_ -(vars[0]*c.l5) __
+#define  T392(_,__)_ -c.l2+vars[0] __
+#define  T390(_,__)_ -c.l2_5+vars[0] __
+#define  T389(_,__)_ -c.l5+vars[0] __
+#define T2621(_,__)_ -fp_acos(-vars[0])-fp_acos(-vars[0]) __
+#define T5508(_,__)_ -fp_acos(-vars[0])-fp_acos(-vars[0]) __
+#define T5509(_,__)_ -fp_acos(-vars[0])-fp_acosh(-vars[0]) __
+#define T2622(_,__)_ -fp_acos(-vars[0])-fp_asin(-vars[0]) __
+#define T5510(_,__)_ -fp_acos(-vars[0])-fp_asinh(-vars[0]) __
+#define T2623(_,__)_ -fp_acos(-vars[0])-fp_asinh(-vars[0]) __
+#define T2624(_,__)_ -fp_acos(-vars[0])-fp_atan(-vars[0]) __
+#define T5511(_,__)_ -fp_acos(-vars[0])-fp_atan(-vars[0]) __
+#define T2625(_,__)_ -fp_acos(-vars[0])-fp_atanh(-vars[0]) __
+#define T2626(_,__)_ -fp_acos(-vars[0])-fp_cos(-vars[0]) __
+#define T5512(_,__)_ -fp_acos(-vars[0])-fp_cos(-vars[0]) __
+#define T5513(_,__)_ -fp_acos(-vars[0])-fp_cosh(-vars[0]) __
+#define T2627(_,__)_ -fp_acos(-vars[0])-fp_cosh(-vars[0]) __
+#define T2628(_,__)_ -fp_acos(-vars[0])-fp_exp(-vars[0]) __
+#define T5514(_,__)_ -fp_acos(-vars[0])-fp_exp(-vars[0]) __
+#define T5515(_,__)_ -fp_acos(-vars[0])-fp_log(-vars[0]) __
+#define T2629(_,__)_ -fp_acos(-vars[0])-fp_log(-vars[0]) __
+#define T2630(_,__)_ -fp_acos(-vars[0])-fp_sin(-vars[0]) __
+#define T5516(_,__)_ -fp_acos(-vars[0])-fp_sin(-vars[0]) __
+#define T2631(_,__)_ -fp_acos(-vars[0])-fp_sinh(-vars[0]) __
+#define T5517(_,__)_ -fp_acos(-vars[0])-fp_sinh(-vars[0]) __
+#define T2632(_,__)_ -fp_acos(-vars[0])-fp_tan(-vars[0]) __
+#define T5518(_,__)_ -fp_acos(-vars[0])-fp_tan(-vars[0]) __
+#define T2633(_,__)_ -fp_acos(-vars[0])-fp_tanh(-vars[0]) __
+#define T5519(_,__)_ -fp_acos(-vars[0])-fp_tanh(-vars[0]) __
+#define T2723(_,__)_ -fp_acos(vars[0])-fp_acos(-vars[0]) __
+#define T5731(_,__)_ -fp_acos(vars[0])-fp_acos(vars[0]) __
+#define T2909(_,__)_ -fp_acos(vars[0])-fp_acos(vars[0]) __
+#define T5586(_,__)_ -fp_acos(vars[0])-fp_acosh(-vars[0]) __
+#define T5732(_,__)_ -fp_acos(vars[0])-fp_acosh(vars[0]) __
+#define T2724(_,__)_ -fp_acos(vars[0])-fp_asin(-vars[0]) __
+#define T5587(_,__)_ -fp_acos(vars[0])-fp_asin(-vars[0]) __
+#define T2910(_,__)_ -fp_acos(vars[0])-fp_asin(vars[0]) __
+#define T5588(_,__)_ -fp_acos(vars[0])-fp_asinh(-vars[0]) __
+#define T2725(_,__)_ -fp_acos(vars[0])-fp_asinh(-vars[0]) __
+#define T2911(_,__)_ -fp_acos(vars[0])-fp_asinh(vars[0]) __
+#define T5733(_,__)_ -fp_acos(vars[0])-fp_asinh(vars[0]) __
+#define T2726(_,__)_ -fp_acos(vars[0])-fp_atan(-vars[0]) __
+#define T5589(_,__)_ -fp_acos(vars[0])-fp_atan(-vars[0]) __
+#define T2912(_,__)_ -fp_acos(vars[0])-fp_atan(vars[0]) __
+#define T5734(_,__)_ -fp_acos(vars[0])-fp_atan(vars[0]) __
+#define T2727(_,__)_ -fp_acos(vars[0])-fp_atanh(-vars[0]) __
+#define T2913(_,__)_ -fp_acos(vars[0])-fp_atanh(vars[0]) __
+#define T2728(_,__)_ -fp_acos(vars[0])-fp_cos(-vars[0]) __
+#define T5590(_,__)_ -fp_acos(vars[0])-fp_cos(-vars[0]) __
+#define T2914(_,__)_ -fp_acos(vars[0])-fp_cos(vars[0]) __
+#define T5735(_,__)_ -fp_acos(vars[0])-fp_cos(vars[0]) __
+#define T2729(_,__)_ -fp_acos(vars[0])-fp_cosh(-vars[0]) __
+#define T5591(_,__)_ -fp_acos(vars[0])-fp_cosh(-vars[0]) __
+#define T2915(_,__)_ -fp_acos(vars[0])-fp_cosh(vars[0]) __
+#define T5736(_,__)_ -fp_acos(vars[0])-fp_cosh(vars[0]) __
+#define T2730(_,__)_ -fp_acos(vars[0])-fp_exp(-vars[0]) __
+#define T5592(_,__)_ -fp_acos(vars[0])-fp_exp(-vars[0]) __
+#define T5737(_,__)_ -fp_acos(vars[0])-fp_exp(vars[0]) __
+#define T2916(_,__)_ -fp_acos(vars[0])-fp_exp(vars[0]) __
+#define T2731(_,__)_ -fp_acos(vars[0])-fp_log(-vars[0]) __
+#define T5593(_,__)_ -fp_acos(vars[0])-fp_log(-vars[0]) __
+#define T2917(_,__)_ -fp_acos(vars[0])-fp_log(vars[0]) __
+#define T5738(_,__)_ -fp_acos(vars[0])-fp_log(vars[0]) __
+#define T2732(_,__)_ -fp_acos(vars[0])-fp_sin(-vars[0]) __
+#define T5594(_,__)_ -fp_acos(vars[0])-fp_sin(-vars[0]) __
+#define T2918(_,__)_ -fp_acos(vars[0])-fp_sin(vars[0]) __
+#define T5739(_,__)_ -fp_acos(vars[0])-fp_sin(vars[0]) __
+#define T2733(_,__)_ -fp_acos(vars[0])-fp_sinh(-vars[0]) __
+#define T5595(_,__)_ -fp_acos(vars[0])-fp_sinh(-vars[0]) __
+#define T5740(_,__)_ -fp_acos(vars[0])-fp_sinh(vars[0]) __
+#define T2919(_,__)_ -fp_acos(vars[0])-fp_sinh(vars[0]) __
+#define T2734(_,__)_ -fp_acos(vars[0])-fp_tan(-vars[0]) __
+#define T5596(_,__)_ -fp_acos(vars[0])-fp_tan(-vars[0]) __
+#define T2920(_,__)_ -fp_acos(vars[0])-fp_tan(vars[0]) __
+#define T5741(_,__)_ -fp_acos(vars[0])-fp_tan(vars[0]) __
+#define T2735(_,__)_ -fp_acos(vars[0])-fp_tanh(-vars[0]) __
+#define T5597(_,__)_ -fp_acos(vars[0])-fp_tanh(-vars[0]) __
+#define T5742(_,__)_ -fp_acos(vars[0])-fp_tanh(vars[0]) __
+#define T2921(_,__)_ -fp_acos(vars[0])-fp_tanh(vars[0]) __
+#define T2634(_,__)_ -fp_acosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5520(_,__)_ -fp_acosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5521(_,__)_ -fp_acosh(-vars[0])-fp_asin(-vars[0]) __
+#define T2635(_,__)_ -fp_acosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5522(_,__)_ -fp_acosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2636(_,__)_ -fp_acosh(-vars[0])-fp_atan(-vars[0]) __
+#define T5523(_,__)_ -fp_acosh(-vars[0])-fp_atan(-vars[0]) __
+#define T5524(_,__)_ -fp_acosh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2637(_,__)_ -fp_acosh(-vars[0])-fp_cos(-vars[0]) __
+#define T5525(_,__)_ -fp_acosh(-vars[0])-fp_cos(-vars[0]) __
+#define T2638(_,__)_ -fp_acosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T5526(_,__)_ -fp_acosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2639(_,__)_ -fp_acosh(-vars[0])-fp_exp(-vars[0]) __
+#define T5527(_,__)_ -fp_acosh(-vars[0])-fp_exp(-vars[0]) __
+#define T5528(_,__)_ -fp_acosh(-vars[0])-fp_log(-vars[0]) __
+#define T2640(_,__)_ -fp_acosh(-vars[0])-fp_log(-vars[0]) __
+#define T2641(_,__)_ -fp_acosh(-vars[0])-fp_sin(-vars[0]) __
+#define T5529(_,__)_ -fp_acosh(-vars[0])-fp_sin(-vars[0]) __
+#define T2642(_,__)_ -fp_acosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5530(_,__)_ -fp_acosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5531(_,__)_ -fp_acosh(-vars[0])-fp_tan(-vars[0]) __
+#define T2643(_,__)_ -fp_acosh(-vars[0])-fp_tan(-vars[0]) __
+#define T5532(_,__)_ -fp_acosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2644(_,__)_ -fp_acosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5598(_,__)_ -fp_acosh(vars[0])-fp_acos(-vars[0]) __
+#define T5743(_,__)_ -fp_acosh(vars[0])-fp_acosh(vars[0]) __
+#define T2922(_,__)_ -fp_acosh(vars[0])-fp_acosh(vars[0]) __
+#define T5599(_,__)_ -fp_acosh(vars[0])-fp_asin(-vars[0]) __
+#define T5744(_,__)_ -fp_acosh(vars[0])-fp_asin(vars[0]) __
+#define T2736(_,__)_ -fp_acosh(vars[0])-fp_asinh(-vars[0]) __
+#define T2923(_,__)_ -fp_acosh(vars[0])-fp_asinh(vars[0]) __
+#define T5745(_,__)_ -fp_acosh(vars[0])-fp_asinh(vars[0]) __
+#define T5600(_,__)_ -fp_acosh(vars[0])-fp_atan(-vars[0]) __
+#define T2737(_,__)_ -fp_acosh(vars[0])-fp_atan(-vars[0]) __
+#define T2924(_,__)_ -fp_acosh(vars[0])-fp_atan(vars[0]) __
+#define T5746(_,__)_ -fp_acosh(vars[0])-fp_atan(vars[0]) __
+#define T5601(_,__)_ -fp_acosh(vars[0])-fp_atanh(-vars[0]) __
+#define T5747(_,__)_ -fp_acosh(vars[0])-fp_atanh(vars[0]) __
+#define T2738(_,__)_ -fp_acosh(vars[0])-fp_cos(-vars[0]) __
+#define T5602(_,__)_ -fp_acosh(vars[0])-fp_cos(-vars[0]) __
+#define T2925(_,__)_ -fp_acosh(vars[0])-fp_cos(vars[0]) __
+#define T5748(_,__)_ -fp_acosh(vars[0])-fp_cos(vars[0]) __
+#define T2739(_,__)_ -fp_acosh(vars[0])-fp_cosh(-vars[0]) __
+#define T5603(_,__)_ -fp_acosh(vars[0])-fp_cosh(-vars[0]) __
+#define T5749(_,__)_ -fp_acosh(vars[0])-fp_cosh(vars[0]) __
+#define T2926(_,__)_ -fp_acosh(vars[0])-fp_cosh(vars[0]) __
+#define T2740(_,__)_ -fp_acosh(vars[0])-fp_exp(-vars[0]) __
+#define T5604(_,__)_ -fp_acosh(vars[0])-fp_exp(-vars[0]) __
+#define T5750(_,__)_ -fp_acosh(vars[0])-fp_exp(vars[0]) __
+#define T2927(_,__)_ -fp_acosh(vars[0])-fp_exp(vars[0]) __
+#define T5605(_,__)_ -fp_acosh(vars[0])-fp_log(-vars[0]) __
+#define T2928(_,__)_ -fp_acosh(vars[0])-fp_log(vars[0]) __
+#define T5751(_,__)_ -fp_acosh(vars[0])-fp_log(vars[0]) __
+#define T2741(_,__)_ -fp_acosh(vars[0])-fp_sin(-vars[0]) __
+#define T5606(_,__)_ -fp_acosh(vars[0])-fp_sin(-vars[0]) __
+#define T2929(_,__)_ -fp_acosh(vars[0])-fp_sin(vars[0]) __
+#define T5752(_,__)_ -fp_acosh(vars[0])-fp_sin(vars[0]) __
+#define T2742(_,__)_ -fp_acosh(vars[0])-fp_sinh(-vars[0]) __
+#define T5607(_,__)_ -fp_acosh(vars[0])-fp_sinh(-vars[0]) __
+#define T2930(_,__)_ -fp_acosh(vars[0])-fp_sinh(vars[0]) __
+#define T5753(_,__)_ -fp_acosh(vars[0])-fp_sinh(vars[0]) __
+#define T5608(_,__)_ -fp_acosh(vars[0])-fp_tan(-vars[0]) __
+#define T2743(_,__)_ -fp_acosh(vars[0])-fp_tan(-vars[0]) __
+#define T2931(_,__)_ -fp_acosh(vars[0])-fp_tan(vars[0]) __
+#define T5754(_,__)_ -fp_acosh(vars[0])-fp_tan(vars[0]) __
+#define T2744(_,__)_ -fp_acosh(vars[0])-fp_tanh(-vars[0]) __
+#define T5609(_,__)_ -fp_acosh(vars[0])-fp_tanh(-vars[0]) __
+#define T5755(_,__)_ -fp_acosh(vars[0])-fp_tanh(vars[0]) __
+#define T2932(_,__)_ -fp_acosh(vars[0])-fp_tanh(vars[0]) __
+#define T2645(_,__)_ -fp_asin(-vars[0])-fp_asin(-vars[0]) __
+#define T5533(_,__)_ -fp_asin(-vars[0])-fp_asin(-vars[0]) __
+#define T2646(_,__)_ -fp_asin(-vars[0])-fp_asinh(-vars[0]) __
+#define T5534(_,__)_ -fp_asin(-vars[0])-fp_asinh(-vars[0]) __
+#define T2647(_,__)_ -fp_asin(-vars[0])-fp_atan(-vars[0]) __
+#define T5535(_,__)_ -fp_asin(-vars[0])-fp_atan(-vars[0]) __
+#define T2648(_,__)_ -fp_asin(-vars[0])-fp_atanh(-vars[0]) __
+#define T2649(_,__)_ -fp_asin(-vars[0])-fp_cos(-vars[0]) __
+#define T5536(_,__)_ -fp_asin(-vars[0])-fp_cos(-vars[0]) __
+#define T5537(_,__)_ -fp_asin(-vars[0])-fp_cosh(-vars[0]) __
+#define T2650(_,__)_ -fp_asin(-vars[0])-fp_cosh(-vars[0]) __
+#define T2651(_,__)_ -fp_asin(-vars[0])-fp_exp(-vars[0]) __
+#define T5538(_,__)_ -fp_asin(-vars[0])-fp_exp(-vars[0]) __
+#define T2652(_,__)_ -fp_asin(-vars[0])-fp_log(-vars[0]) __
+#define T5539(_,__)_ -fp_asin(-vars[0])-fp_log(-vars[0]) __
+#define T5540(_,__)_ -fp_asin(-vars[0])-fp_sin(-vars[0]) __
+#define T2653(_,__)_ -fp_asin(-vars[0])-fp_sin(-vars[0]) __
+#define T5541(_,__)_ -fp_asin(-vars[0])-fp_sinh(-vars[0]) __
+#define T2654(_,__)_ -fp_asin(-vars[0])-fp_sinh(-vars[0]) __
+#define T2655(_,__)_ -fp_asin(-vars[0])-fp_tan(-vars[0]) __
+#define T5542(_,__)_ -fp_asin(-vars[0])-fp_tan(-vars[0]) __
+#define T2656(_,__)_ -fp_asin(-vars[0])-fp_tanh(-vars[0]) __
+#define T5543(_,__)_ -fp_asin(-vars[0])-fp_tanh(-vars[0]) __
+#define T5610(_,__)_ -fp_asin(vars[0])-fp_acos(-vars[0]) __
+#define T2745(_,__)_ -fp_asin(vars[0])-fp_acos(-vars[0]) __
+#define T5611(_,__)_ -fp_asin(vars[0])-fp_acosh(-vars[0]) __
+#define T2746(_,__)_ -fp_asin(vars[0])-fp_asin(-vars[0]) __
+#define T5756(_,__)_ -fp_asin(vars[0])-fp_asin(vars[0]) __
+#define T2933(_,__)_ -fp_asin(vars[0])-fp_asin(vars[0]) __
+#define T2747(_,__)_ -fp_asin(vars[0])-fp_asinh(-vars[0]) __
+#define T5612(_,__)_ -fp_asin(vars[0])-fp_asinh(-vars[0]) __
+#define T2934(_,__)_ -fp_asin(vars[0])-fp_asinh(vars[0]) __
+#define T5757(_,__)_ -fp_asin(vars[0])-fp_asinh(vars[0]) __
+#define T2748(_,__)_ -fp_asin(vars[0])-fp_atan(-vars[0]) __
+#define T5613(_,__)_ -fp_asin(vars[0])-fp_atan(-vars[0]) __
+#define T5758(_,__)_ -fp_asin(vars[0])-fp_atan(vars[0]) __
+#define T2935(_,__)_ -fp_asin(vars[0])-fp_atan(vars[0]) __
+#define T2749(_,__)_ -fp_asin(vars[0])-fp_atanh(-vars[0]) __
+#define T2936(_,__)_ -fp_asin(vars[0])-fp_atanh(vars[0]) __
+#define T5614(_,__)_ -fp_asin(vars[0])-fp_cos(-vars[0]) __
+#define T2750(_,__)_ -fp_asin(vars[0])-fp_cos(-vars[0]) __
+#define T2937(_,__)_ -fp_asin(vars[0])-fp_cos(vars[0]) __
+#define T5759(_,__)_ -fp_asin(vars[0])-fp_cos(vars[0]) __
+#define T2751(_,__)_ -fp_asin(vars[0])-fp_cosh(-vars[0]) __
+#define T5615(_,__)_ -fp_asin(vars[0])-fp_cosh(-vars[0]) __
+#define T2938(_,__)_ -fp_asin(vars[0])-fp_cosh(vars[0]) __
+#define T5760(_,__)_ -fp_asin(vars[0])-fp_cosh(vars[0]) __
+#define T5616(_,__)_ -fp_asin(vars[0])-fp_exp(-vars[0]) __
+#define T2752(_,__)_ -fp_asin(vars[0])-fp_exp(-vars[0]) __
+#define T5761(_,__)_ -fp_asin(vars[0])-fp_exp(vars[0]) __
+#define T2939(_,__)_ -fp_asin(vars[0])-fp_exp(vars[0]) __
+#define T5617(_,__)_ -fp_asin(vars[0])-fp_log(-vars[0]) __
+#define T2753(_,__)_ -fp_asin(vars[0])-fp_log(-vars[0]) __
+#define T5762(_,__)_ -fp_asin(vars[0])-fp_log(vars[0]) __
+#define T2940(_,__)_ -fp_asin(vars[0])-fp_log(vars[0]) __
+#define T2754(_,__)_ -fp_asin(vars[0])-fp_sin(-vars[0]) __
+#define T5618(_,__)_ -fp_asin(vars[0])-fp_sin(-vars[0]) __
+#define T2941(_,__)_ -fp_asin(vars[0])-fp_sin(vars[0]) __
+#define T5763(_,__)_ -fp_asin(vars[0])-fp_sin(vars[0]) __
+#define T2755(_,__)_ -fp_asin(vars[0])-fp_sinh(-vars[0]) __
+#define T5619(_,__)_ -fp_asin(vars[0])-fp_sinh(-vars[0]) __
+#define T2942(_,__)_ -fp_asin(vars[0])-fp_sinh(vars[0]) __
+#define T5764(_,__)_ -fp_asin(vars[0])-fp_sinh(vars[0]) __
+#define T5620(_,__)_ -fp_asin(vars[0])-fp_tan(-vars[0]) __
+#define T2756(_,__)_ -fp_asin(vars[0])-fp_tan(-vars[0]) __
+#define T5765(_,__)_ -fp_asin(vars[0])-fp_tan(vars[0]) __
+#define T2943(_,__)_ -fp_asin(vars[0])-fp_tan(vars[0]) __
+#define T2757(_,__)_ -fp_asin(vars[0])-fp_tanh(-vars[0]) __
+#define T5621(_,__)_ -fp_asin(vars[0])-fp_tanh(-vars[0]) __
+#define T5766(_,__)_ -fp_asin(vars[0])-fp_tanh(vars[0]) __
+#define T2944(_,__)_ -fp_asin(vars[0])-fp_tanh(vars[0]) __
+#define T2657(_,__)_ -fp_asinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5544(_,__)_ -fp_asinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2658(_,__)_ -fp_asinh(-vars[0])-fp_atan(-vars[0]) __
+#define T5545(_,__)_ -fp_asinh(-vars[0])-fp_atan(-vars[0]) __
+#define T2659(_,__)_ -fp_asinh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2660(_,__)_ -fp_asinh(-vars[0])-fp_cos(-vars[0]) __
+#define T5546(_,__)_ -fp_asinh(-vars[0])-fp_cos(-vars[0]) __
+#define T2661(_,__)_ -fp_asinh(-vars[0])-fp_cosh(-vars[0]) __
+#define T5547(_,__)_ -fp_asinh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2662(_,__)_ -fp_asinh(-vars[0])-fp_exp(-vars[0]) __
+#define T5548(_,__)_ -fp_asinh(-vars[0])-fp_exp(-vars[0]) __
+#define T5549(_,__)_ -fp_asinh(-vars[0])-fp_log(-vars[0]) __
+#define T2663(_,__)_ -fp_asinh(-vars[0])-fp_log(-vars[0]) __
+#define T2664(_,__)_ -fp_asinh(-vars[0])-fp_sin(-vars[0]) __
+#define T5550(_,__)_ -fp_asinh(-vars[0])-fp_sin(-vars[0]) __
+#define T2665(_,__)_ -fp_asinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5551(_,__)_ -fp_asinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5552(_,__)_ -fp_asinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2666(_,__)_ -fp_asinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2667(_,__)_ -fp_asinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5553(_,__)_ -fp_asinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2758(_,__)_ -fp_asinh(vars[0])-fp_acos(-vars[0]) __
+#define T5622(_,__)_ -fp_asinh(vars[0])-fp_acos(-vars[0]) __
+#define T2759(_,__)_ -fp_asinh(vars[0])-fp_acosh(-vars[0]) __
+#define T5623(_,__)_ -fp_asinh(vars[0])-fp_asin(-vars[0]) __
+#define T2760(_,__)_ -fp_asinh(vars[0])-fp_asin(-vars[0]) __
+#define T2761(_,__)_ -fp_asinh(vars[0])-fp_asinh(-vars[0]) __
+#define T2945(_,__)_ -fp_asinh(vars[0])-fp_asinh(vars[0]) __
+#define T5767(_,__)_ -fp_asinh(vars[0])-fp_asinh(vars[0]) __
+#define T2762(_,__)_ -fp_asinh(vars[0])-fp_atan(-vars[0]) __
+#define T5624(_,__)_ -fp_asinh(vars[0])-fp_atan(-vars[0]) __
+#define T2946(_,__)_ -fp_asinh(vars[0])-fp_atan(vars[0]) __
+#define T5768(_,__)_ -fp_asinh(vars[0])-fp_atan(vars[0]) __
+#define T2763(_,__)_ -fp_asinh(vars[0])-fp_atanh(-vars[0]) __
+#define T2947(_,__)_ -fp_asinh(vars[0])-fp_atanh(vars[0]) __
+#define T2764(_,__)_ -fp_asinh(vars[0])-fp_cos(-vars[0]) __
+#define T5625(_,__)_ -fp_asinh(vars[0])-fp_cos(-vars[0]) __
+#define T5769(_,__)_ -fp_asinh(vars[0])-fp_cos(vars[0]) __
+#define T2948(_,__)_ -fp_asinh(vars[0])-fp_cos(vars[0]) __
+#define T5626(_,__)_ -fp_asinh(vars[0])-fp_cosh(-vars[0]) __
+#define T2765(_,__)_ -fp_asinh(vars[0])-fp_cosh(-vars[0]) __
+#define T2949(_,__)_ -fp_asinh(vars[0])-fp_cosh(vars[0]) __
+#define T5770(_,__)_ -fp_asinh(vars[0])-fp_cosh(vars[0]) __
+#define T2766(_,__)_ -fp_asinh(vars[0])-fp_exp(-vars[0]) __
+#define T5627(_,__)_ -fp_asinh(vars[0])-fp_exp(-vars[0]) __
+#define T5771(_,__)_ -fp_asinh(vars[0])-fp_exp(vars[0]) __
+#define T2950(_,__)_ -fp_asinh(vars[0])-fp_exp(vars[0]) __
+#define T2767(_,__)_ -fp_asinh(vars[0])-fp_log(-vars[0]) __
+#define T5628(_,__)_ -fp_asinh(vars[0])-fp_log(-vars[0]) __
+#define T5772(_,__)_ -fp_asinh(vars[0])-fp_log(vars[0]) __
+#define T2951(_,__)_ -fp_asinh(vars[0])-fp_log(vars[0]) __
+#define T5629(_,__)_ -fp_asinh(vars[0])-fp_sin(-vars[0]) __
+#define T2768(_,__)_ -fp_asinh(vars[0])-fp_sin(-vars[0]) __
+#define T5773(_,__)_ -fp_asinh(vars[0])-fp_sin(vars[0]) __
+#define T2952(_,__)_ -fp_asinh(vars[0])-fp_sin(vars[0]) __
+#define T2769(_,__)_ -fp_asinh(vars[0])-fp_sinh(-vars[0]) __
+#define T5630(_,__)_ -fp_asinh(vars[0])-fp_sinh(-vars[0]) __
+#define T2953(_,__)_ -fp_asinh(vars[0])-fp_sinh(vars[0]) __
+#define T5774(_,__)_ -fp_asinh(vars[0])-fp_sinh(vars[0]) __
+#define T2770(_,__)_ -fp_asinh(vars[0])-fp_tan(-vars[0]) __
+#define T5631(_,__)_ -fp_asinh(vars[0])-fp_tan(-vars[0]) __
+#define T2954(_,__)_ -fp_asinh(vars[0])-fp_tan(vars[0]) __
+#define T5775(_,__)_ -fp_asinh(vars[0])-fp_tan(vars[0]) __
+#define T2771(_,__)_ -fp_asinh(vars[0])-fp_tanh(-vars[0]) __
+#define T5632(_,__)_ -fp_asinh(vars[0])-fp_tanh(-vars[0]) __
+#define T2955(_,__)_ -fp_asinh(vars[0])-fp_tanh(vars[0]) __
+#define T5776(_,__)_ -fp_asinh(vars[0])-fp_tanh(vars[0]) __
+#define T5554(_,__)_ -fp_atan(-vars[0])-fp_atan(-vars[0]) __
+#define T2668(_,__)_ -fp_atan(-vars[0])-fp_atan(-vars[0]) __
+#define T2669(_,__)_ -fp_atan(-vars[0])-fp_atanh(-vars[0]) __
+#define T2670(_,__)_ -fp_atan(-vars[0])-fp_cos(-vars[0]) __
+#define T5555(_,__)_ -fp_atan(-vars[0])-fp_cos(-vars[0]) __
+#define T5556(_,__)_ -fp_atan(-vars[0])-fp_cosh(-vars[0]) __
+#define T2671(_,__)_ -fp_atan(-vars[0])-fp_cosh(-vars[0]) __
+#define T5557(_,__)_ -fp_atan(-vars[0])-fp_exp(-vars[0]) __
+#define T2672(_,__)_ -fp_atan(-vars[0])-fp_exp(-vars[0]) __
+#define T2673(_,__)_ -fp_atan(-vars[0])-fp_log(-vars[0]) __
+#define T5558(_,__)_ -fp_atan(-vars[0])-fp_log(-vars[0]) __
+#define T2674(_,__)_ -fp_atan(-vars[0])-fp_sin(-vars[0]) __
+#define T5559(_,__)_ -fp_atan(-vars[0])-fp_sin(-vars[0]) __
+#define T2675(_,__)_ -fp_atan(-vars[0])-fp_sinh(-vars[0]) __
+#define T5560(_,__)_ -fp_atan(-vars[0])-fp_sinh(-vars[0]) __
+#define T2676(_,__)_ -fp_atan(-vars[0])-fp_tan(-vars[0]) __
+#define T5561(_,__)_ -fp_atan(-vars[0])-fp_tan(-vars[0]) __
+#define T2677(_,__)_ -fp_atan(-vars[0])-fp_tanh(-vars[0]) __
+#define T5562(_,__)_ -fp_atan(-vars[0])-fp_tanh(-vars[0]) __
+#define T2772(_,__)_ -fp_atan(vars[0])-fp_acos(-vars[0]) __
+#define T5633(_,__)_ -fp_atan(vars[0])-fp_acos(-vars[0]) __
+#define T5634(_,__)_ -fp_atan(vars[0])-fp_acosh(-vars[0]) __
+#define T2773(_,__)_ -fp_atan(vars[0])-fp_acosh(-vars[0]) __
+#define T2774(_,__)_ -fp_atan(vars[0])-fp_asin(-vars[0]) __
+#define T5635(_,__)_ -fp_atan(vars[0])-fp_asin(-vars[0]) __
+#define T2775(_,__)_ -fp_atan(vars[0])-fp_asinh(-vars[0]) __
+#define T5636(_,__)_ -fp_atan(vars[0])-fp_asinh(-vars[0]) __
+#define T2776(_,__)_ -fp_atan(vars[0])-fp_atan(-vars[0]) __
+#define T5637(_,__)_ -fp_atan(vars[0])-fp_atan(-vars[0]) __
+#define T2956(_,__)_ -fp_atan(vars[0])-fp_atan(vars[0]) __
+#define T5777(_,__)_ -fp_atan(vars[0])-fp_atan(vars[0]) __
+#define T2777(_,__)_ -fp_atan(vars[0])-fp_atanh(-vars[0]) __
+#define T2957(_,__)_ -fp_atan(vars[0])-fp_atanh(vars[0]) __
+#define T2778(_,__)_ -fp_atan(vars[0])-fp_cos(-vars[0]) __
+#define T5638(_,__)_ -fp_atan(vars[0])-fp_cos(-vars[0]) __
+#define T5778(_,__)_ -fp_atan(vars[0])-fp_cos(vars[0]) __
+#define T2958(_,__)_ -fp_atan(vars[0])-fp_cos(vars[0]) __
+#define T5639(_,__)_ -fp_atan(vars[0])-fp_cosh(-vars[0]) __
+#define T2779(_,__)_ -fp_atan(vars[0])-fp_cosh(-vars[0]) __
+#define T5779(_,__)_ -fp_atan(vars[0])-fp_cosh(vars[0]) __
+#define T2959(_,__)_ -fp_atan(vars[0])-fp_cosh(vars[0]) __
+#define T2780(_,__)_ -fp_atan(vars[0])-fp_exp(-vars[0]) __
+#define T5640(_,__)_ -fp_atan(vars[0])-fp_exp(-vars[0]) __
+#define T5780(_,__)_ -fp_atan(vars[0])-fp_exp(vars[0]) __
+#define T2960(_,__)_ -fp_atan(vars[0])-fp_exp(vars[0]) __
+#define T5641(_,__)_ -fp_atan(vars[0])-fp_log(-vars[0]) __
+#define T2781(_,__)_ -fp_atan(vars[0])-fp_log(-vars[0]) __
+#define T2961(_,__)_ -fp_atan(vars[0])-fp_log(vars[0]) __
+#define T5781(_,__)_ -fp_atan(vars[0])-fp_log(vars[0]) __
+#define T2782(_,__)_ -fp_atan(vars[0])-fp_sin(-vars[0]) __
+#define T5642(_,__)_ -fp_atan(vars[0])-fp_sin(-vars[0]) __
+#define T2962(_,__)_ -fp_atan(vars[0])-fp_sin(vars[0]) __
+#define T5782(_,__)_ -fp_atan(vars[0])-fp_sin(vars[0]) __
+#define T2783(_,__)_ -fp_atan(vars[0])-fp_sinh(-vars[0]) __
+#define T5643(_,__)_ -fp_atan(vars[0])-fp_sinh(-vars[0]) __
+#define T5783(_,__)_ -fp_atan(vars[0])-fp_sinh(vars[0]) __
+#define T2963(_,__)_ -fp_atan(vars[0])-fp_sinh(vars[0]) __
+#define T2784(_,__)_ -fp_atan(vars[0])-fp_tan(-vars[0]) __
+#define T5644(_,__)_ -fp_atan(vars[0])-fp_tan(-vars[0]) __
+#define T2964(_,__)_ -fp_atan(vars[0])-fp_tan(vars[0]) __
+#define T5784(_,__)_ -fp_atan(vars[0])-fp_tan(vars[0]) __
+#define T5645(_,__)_ -fp_atan(vars[0])-fp_tanh(-vars[0]) __
+#define T2785(_,__)_ -fp_atan(vars[0])-fp_tanh(-vars[0]) __
+#define T2965(_,__)_ -fp_atan(vars[0])-fp_tanh(vars[0]) __
+#define T5785(_,__)_ -fp_atan(vars[0])-fp_tanh(vars[0]) __
+#define T2678(_,__)_ -fp_atanh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2679(_,__)_ -fp_atanh(-vars[0])-fp_cos(-vars[0]) __
+#define T2680(_,__)_ -fp_atanh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2681(_,__)_ -fp_atanh(-vars[0])-fp_exp(-vars[0]) __
+#define T2682(_,__)_ -fp_atanh(-vars[0])-fp_log(-vars[0]) __
+#define T2683(_,__)_ -fp_atanh(-vars[0])-fp_sin(-vars[0]) __
+#define T2684(_,__)_ -fp_atanh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2685(_,__)_ -fp_atanh(-vars[0])-fp_tan(-vars[0]) __
+#define T5563(_,__)_ -fp_atanh(-vars[0])-fp_tan(-vars[0]) __
+#define T5564(_,__)_ -fp_atanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2686(_,__)_ -fp_atanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2786(_,__)_ -fp_atanh(vars[0])-fp_acos(-vars[0]) __
+#define T5646(_,__)_ -fp_atanh(vars[0])-fp_acosh(-vars[0]) __
+#define T2787(_,__)_ -fp_atanh(vars[0])-fp_asin(-vars[0]) __
+#define T2788(_,__)_ -fp_atanh(vars[0])-fp_asinh(-vars[0]) __
+#define T2789(_,__)_ -fp_atanh(vars[0])-fp_atan(-vars[0]) __
+#define T2790(_,__)_ -fp_atanh(vars[0])-fp_atanh(-vars[0]) __
+#define T2966(_,__)_ -fp_atanh(vars[0])-fp_atanh(vars[0]) __
+#define T2791(_,__)_ -fp_atanh(vars[0])-fp_cos(-vars[0]) __
+#define T2967(_,__)_ -fp_atanh(vars[0])-fp_cos(vars[0]) __
+#define T2792(_,__)_ -fp_atanh(vars[0])-fp_cosh(-vars[0]) __
+#define T2968(_,__)_ -fp_atanh(vars[0])-fp_cosh(vars[0]) __
+#define T2793(_,__)_ -fp_atanh(vars[0])-fp_exp(-vars[0]) __
+#define T2969(_,__)_ -fp_atanh(vars[0])-fp_exp(vars[0]) __
+#define T2794(_,__)_ -fp_atanh(vars[0])-fp_log(-vars[0]) __
+#define T2970(_,__)_ -fp_atanh(vars[0])-fp_log(vars[0]) __
+#define T5786(_,__)_ -fp_atanh(vars[0])-fp_log(vars[0]) __
+#define T2795(_,__)_ -fp_atanh(vars[0])-fp_sin(-vars[0]) __
+#define T2971(_,__)_ -fp_atanh(vars[0])-fp_sin(vars[0]) __
+#define T2796(_,__)_ -fp_atanh(vars[0])-fp_sinh(-vars[0]) __
+#define T2972(_,__)_ -fp_atanh(vars[0])-fp_sinh(vars[0]) __
+#define T2797(_,__)_ -fp_atanh(vars[0])-fp_tan(-vars[0]) __
+#define T5647(_,__)_ -fp_atanh(vars[0])-fp_tan(-vars[0]) __
+#define T5787(_,__)_ -fp_atanh(vars[0])-fp_tan(vars[0]) __
+#define T2973(_,__)_ -fp_atanh(vars[0])-fp_tan(vars[0]) __
+#define T5648(_,__)_ -fp_atanh(vars[0])-fp_tanh(-vars[0]) __
+#define T2798(_,__)_ -fp_atanh(vars[0])-fp_tanh(-vars[0]) __
+#define T2974(_,__)_ -fp_atanh(vars[0])-fp_tanh(vars[0]) __
+#define T5788(_,__)_ -fp_atanh(vars[0])-fp_tanh(vars[0]) __
+#define  T541(_,__)_ -fp_ceil(vars[0]) __
+#define  T391(_,__)_ -fp_const_pi<Value_t>()+vars[0] __
+#define T2687(_,__)_ -fp_cos(-vars[0])-fp_cos(-vars[0]) __
+#define T2688(_,__)_ -fp_cos(-vars[0])-fp_cosh(-vars[0]) __
+#define T2689(_,__)_ -fp_cos(-vars[0])-fp_exp(-vars[0]) __
+#define T5565(_,__)_ -fp_cos(-vars[0])-fp_log(-vars[0]) __
+#define T2690(_,__)_ -fp_cos(-vars[0])-fp_log(-vars[0]) __
+#define T2691(_,__)_ -fp_cos(-vars[0])-fp_sin(-vars[0]) __
+#define T2692(_,__)_ -fp_cos(-vars[0])-fp_sinh(-vars[0]) __
+#define T2693(_,__)_ -fp_cos(-vars[0])-fp_tan(-vars[0]) __
+#define T5566(_,__)_ -fp_cos(-vars[0])-fp_tan(-vars[0]) __
+#define T2694(_,__)_ -fp_cos(-vars[0])-fp_tanh(-vars[0]) __
+#define T5567(_,__)_ -fp_cos(-vars[0])-fp_tanh(-vars[0]) __
+#define T5649(_,__)_ -fp_cos(vars[0])-fp_acos(-vars[0]) __
+#define T2799(_,__)_ -fp_cos(vars[0])-fp_acos(-vars[0]) __
+#define T2800(_,__)_ -fp_cos(vars[0])-fp_acosh(-vars[0]) __
+#define T5650(_,__)_ -fp_cos(vars[0])-fp_acosh(-vars[0]) __
+#define T5651(_,__)_ -fp_cos(vars[0])-fp_asin(-vars[0]) __
+#define T2801(_,__)_ -fp_cos(vars[0])-fp_asin(-vars[0]) __
+#define T2802(_,__)_ -fp_cos(vars[0])-fp_asinh(-vars[0]) __
+#define T5652(_,__)_ -fp_cos(vars[0])-fp_asinh(-vars[0]) __
+#define T5653(_,__)_ -fp_cos(vars[0])-fp_atan(-vars[0]) __
+#define T2803(_,__)_ -fp_cos(vars[0])-fp_atan(-vars[0]) __
+#define T2804(_,__)_ -fp_cos(vars[0])-fp_atanh(-vars[0]) __
+#define T2805(_,__)_ -fp_cos(vars[0])-fp_cos(-vars[0]) __
+#define T2975(_,__)_ -fp_cos(vars[0])-fp_cos(vars[0]) __
+#define T2806(_,__)_ -fp_cos(vars[0])-fp_cosh(-vars[0]) __
+#define T2976(_,__)_ -fp_cos(vars[0])-fp_cosh(vars[0]) __
+#define T2807(_,__)_ -fp_cos(vars[0])-fp_exp(-vars[0]) __
+#define T2977(_,__)_ -fp_cos(vars[0])-fp_exp(vars[0]) __
+#define T2808(_,__)_ -fp_cos(vars[0])-fp_log(-vars[0]) __
+#define T5654(_,__)_ -fp_cos(vars[0])-fp_log(-vars[0]) __
+#define T2978(_,__)_ -fp_cos(vars[0])-fp_log(vars[0]) __
+#define T5789(_,__)_ -fp_cos(vars[0])-fp_log(vars[0]) __
+#define T2809(_,__)_ -fp_cos(vars[0])-fp_sin(-vars[0]) __
+#define T2979(_,__)_ -fp_cos(vars[0])-fp_sin(vars[0]) __
+#define T2810(_,__)_ -fp_cos(vars[0])-fp_sinh(-vars[0]) __
+#define T2980(_,__)_ -fp_cos(vars[0])-fp_sinh(vars[0]) __
+#define T5655(_,__)_ -fp_cos(vars[0])-fp_tan(-vars[0]) __
+#define T2811(_,__)_ -fp_cos(vars[0])-fp_tan(-vars[0]) __
+#define T2981(_,__)_ -fp_cos(vars[0])-fp_tan(vars[0]) __
+#define T5790(_,__)_ -fp_cos(vars[0])-fp_tan(vars[0]) __
+#define T5656(_,__)_ -fp_cos(vars[0])-fp_tanh(-vars[0]) __
+#define T2812(_,__)_ -fp_cos(vars[0])-fp_tanh(-vars[0]) __
+#define T5791(_,__)_ -fp_cos(vars[0])-fp_tanh(vars[0]) __
+#define T2982(_,__)_ -fp_cos(vars[0])-fp_tanh(vars[0]) __
+#define T2695(_,__)_ -fp_cosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2696(_,__)_ -fp_cosh(-vars[0])-fp_exp(-vars[0]) __
+#define T2697(_,__)_ -fp_cosh(-vars[0])-fp_log(-vars[0]) __
+#define T5568(_,__)_ -fp_cosh(-vars[0])-fp_log(-vars[0]) __
+#define T2698(_,__)_ -fp_cosh(-vars[0])-fp_sin(-vars[0]) __
+#define T2699(_,__)_ -fp_cosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5569(_,__)_ -fp_cosh(-vars[0])-fp_tan(-vars[0]) __
+#define T2700(_,__)_ -fp_cosh(-vars[0])-fp_tan(-vars[0]) __
+#define T2701(_,__)_ -fp_cosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5570(_,__)_ -fp_cosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5657(_,__)_ -fp_cosh(vars[0])-fp_acos(-vars[0]) __
+#define T2813(_,__)_ -fp_cosh(vars[0])-fp_acos(-vars[0]) __
+#define T5658(_,__)_ -fp_cosh(vars[0])-fp_acosh(-vars[0]) __
+#define T2814(_,__)_ -fp_cosh(vars[0])-fp_acosh(-vars[0]) __
+#define T2815(_,__)_ -fp_cosh(vars[0])-fp_asin(-vars[0]) __
+#define T5659(_,__)_ -fp_cosh(vars[0])-fp_asin(-vars[0]) __
+#define T2816(_,__)_ -fp_cosh(vars[0])-fp_asinh(-vars[0]) __
+#define T5660(_,__)_ -fp_cosh(vars[0])-fp_asinh(-vars[0]) __
+#define T5661(_,__)_ -fp_cosh(vars[0])-fp_atan(-vars[0]) __
+#define T2817(_,__)_ -fp_cosh(vars[0])-fp_atan(-vars[0]) __
+#define T2818(_,__)_ -fp_cosh(vars[0])-fp_atanh(-vars[0]) __
+#define T2819(_,__)_ -fp_cosh(vars[0])-fp_cos(-vars[0]) __
+#define T2820(_,__)_ -fp_cosh(vars[0])-fp_cosh(-vars[0]) __
+#define T2983(_,__)_ -fp_cosh(vars[0])-fp_cosh(vars[0]) __
+#define T2821(_,__)_ -fp_cosh(vars[0])-fp_exp(-vars[0]) __
+#define T2984(_,__)_ -fp_cosh(vars[0])-fp_exp(vars[0]) __
+#define T2822(_,__)_ -fp_cosh(vars[0])-fp_log(-vars[0]) __
+#define T5662(_,__)_ -fp_cosh(vars[0])-fp_log(-vars[0]) __
+#define T2985(_,__)_ -fp_cosh(vars[0])-fp_log(vars[0]) __
+#define T5792(_,__)_ -fp_cosh(vars[0])-fp_log(vars[0]) __
+#define T2823(_,__)_ -fp_cosh(vars[0])-fp_sin(-vars[0]) __
+#define T2986(_,__)_ -fp_cosh(vars[0])-fp_sin(vars[0]) __
+#define T2824(_,__)_ -fp_cosh(vars[0])-fp_sinh(-vars[0]) __
+#define T2987(_,__)_ -fp_cosh(vars[0])-fp_sinh(vars[0]) __
+#define T5663(_,__)_ -fp_cosh(vars[0])-fp_tan(-vars[0]) __
+#define T2825(_,__)_ -fp_cosh(vars[0])-fp_tan(-vars[0]) __
+#define T2988(_,__)_ -fp_cosh(vars[0])-fp_tan(vars[0]) __
+#define T5793(_,__)_ -fp_cosh(vars[0])-fp_tan(vars[0]) __
+#define T2826(_,__)_ -fp_cosh(vars[0])-fp_tanh(-vars[0]) __
+#define T5664(_,__)_ -fp_cosh(vars[0])-fp_tanh(-vars[0]) __
+#define T2989(_,__)_ -fp_cosh(vars[0])-fp_tanh(vars[0]) __
+#define T5794(_,__)_ -fp_cosh(vars[0])-fp_tanh(vars[0]) __
+#define T2702(_,__)_ -fp_exp(-vars[0])-fp_exp(-vars[0]) __
+#define T2703(_,__)_ -fp_exp(-vars[0])-fp_log(-vars[0]) __
+#define T5571(_,__)_ -fp_exp(-vars[0])-fp_log(-vars[0]) __
+#define T2704(_,__)_ -fp_exp(-vars[0])-fp_sin(-vars[0]) __
+#define T2705(_,__)_ -fp_exp(-vars[0])-fp_sinh(-vars[0]) __
+#define T2706(_,__)_ -fp_exp(-vars[0])-fp_tan(-vars[0]) __
+#define T5572(_,__)_ -fp_exp(-vars[0])-fp_tan(-vars[0]) __
+#define T2707(_,__)_ -fp_exp(-vars[0])-fp_tanh(-vars[0]) __
+#define T5573(_,__)_ -fp_exp(-vars[0])-fp_tanh(-vars[0]) __
+#define T2827(_,__)_ -fp_exp(vars[0])-fp_acos(-vars[0]) __
+#define T5665(_,__)_ -fp_exp(vars[0])-fp_acos(-vars[0]) __
+#define T5666(_,__)_ -fp_exp(vars[0])-fp_acosh(-vars[0]) __
+#define T2828(_,__)_ -fp_exp(vars[0])-fp_acosh(-vars[0]) __
+#define T5667(_,__)_ -fp_exp(vars[0])-fp_asin(-vars[0]) __
+#define T2829(_,__)_ -fp_exp(vars[0])-fp_asin(-vars[0]) __
+#define T2830(_,__)_ -fp_exp(vars[0])-fp_asinh(-vars[0]) __
+#define T5668(_,__)_ -fp_exp(vars[0])-fp_asinh(-vars[0]) __
+#define T2831(_,__)_ -fp_exp(vars[0])-fp_atan(-vars[0]) __
+#define T5669(_,__)_ -fp_exp(vars[0])-fp_atan(-vars[0]) __
+#define T2832(_,__)_ -fp_exp(vars[0])-fp_atanh(-vars[0]) __
+#define T2833(_,__)_ -fp_exp(vars[0])-fp_cos(-vars[0]) __
+#define T2834(_,__)_ -fp_exp(vars[0])-fp_cosh(-vars[0]) __
+#define T2835(_,__)_ -fp_exp(vars[0])-fp_exp(-vars[0]) __
+#define T2990(_,__)_ -fp_exp(vars[0])-fp_exp(vars[0]) __
+#define T2836(_,__)_ -fp_exp(vars[0])-fp_log(-vars[0]) __
+#define T5670(_,__)_ -fp_exp(vars[0])-fp_log(-vars[0]) __
+#define T2991(_,__)_ -fp_exp(vars[0])-fp_log(vars[0]) __
+#define T5795(_,__)_ -fp_exp(vars[0])-fp_log(vars[0]) __
+#define T2837(_,__)_ -fp_exp(vars[0])-fp_sin(-vars[0]) __
+#define T2992(_,__)_ -fp_exp(vars[0])-fp_sin(vars[0]) __
+#define T2838(_,__)_ -fp_exp(vars[0])-fp_sinh(-vars[0]) __
+#define T2993(_,__)_ -fp_exp(vars[0])-fp_sinh(vars[0]) __
+#define T2839(_,__)_ -fp_exp(vars[0])-fp_tan(-vars[0]) __
+#define T5671(_,__)_ -fp_exp(vars[0])-fp_tan(-vars[0]) __
+#define T5796(_,__)_ -fp_exp(vars[0])-fp_tan(vars[0]) __
+#define T2994(_,__)_ -fp_exp(vars[0])-fp_tan(vars[0]) __
+#define T5672(_,__)_ -fp_exp(vars[0])-fp_tanh(-vars[0]) __
+#define T2840(_,__)_ -fp_exp(vars[0])-fp_tanh(-vars[0]) __
+#define T5797(_,__)_ -fp_exp(vars[0])-fp_tanh(vars[0]) __
+#define T2995(_,__)_ -fp_exp(vars[0])-fp_tanh(vars[0]) __
+#define  T544(_,__)_ -fp_floor(vars[0]) __
+#define T2708(_,__)_ -fp_log(-vars[0])-fp_log(-vars[0]) __
+#define T5574(_,__)_ -fp_log(-vars[0])-fp_log(-vars[0]) __
+#define T2709(_,__)_ -fp_log(-vars[0])-fp_sin(-vars[0]) __
+#define T5575(_,__)_ -fp_log(-vars[0])-fp_sin(-vars[0]) __
+#define T2710(_,__)_ -fp_log(-vars[0])-fp_sinh(-vars[0]) __
+#define T5576(_,__)_ -fp_log(-vars[0])-fp_sinh(-vars[0]) __
+#define T2711(_,__)_ -fp_log(-vars[0])-fp_tan(-vars[0]) __
+#define T5577(_,__)_ -fp_log(-vars[0])-fp_tan(-vars[0]) __
+#define T5578(_,__)_ -fp_log(-vars[0])-fp_tanh(-vars[0]) __
+#define T2712(_,__)_ -fp_log(-vars[0])-fp_tanh(-vars[0]) __
+#define T5673(_,__)_ -fp_log(vars[0])-fp_acos(-vars[0]) __
+#define T2841(_,__)_ -fp_log(vars[0])-fp_acos(-vars[0]) __
+#define T5674(_,__)_ -fp_log(vars[0])-fp_acosh(-vars[0]) __
+#define T2842(_,__)_ -fp_log(vars[0])-fp_asin(-vars[0]) __
+#define T5675(_,__)_ -fp_log(vars[0])-fp_asin(-vars[0]) __
+#define T2843(_,__)_ -fp_log(vars[0])-fp_asinh(-vars[0]) __
+#define T5676(_,__)_ -fp_log(vars[0])-fp_asinh(-vars[0]) __
+#define T2844(_,__)_ -fp_log(vars[0])-fp_atan(-vars[0]) __
+#define T5677(_,__)_ -fp_log(vars[0])-fp_atan(-vars[0]) __
+#define T5678(_,__)_ -fp_log(vars[0])-fp_atanh(-vars[0]) __
+#define T2845(_,__)_ -fp_log(vars[0])-fp_atanh(-vars[0]) __
+#define T2846(_,__)_ -fp_log(vars[0])-fp_cos(-vars[0]) __
+#define T5679(_,__)_ -fp_log(vars[0])-fp_cos(-vars[0]) __
+#define T5680(_,__)_ -fp_log(vars[0])-fp_cosh(-vars[0]) __
+#define T2847(_,__)_ -fp_log(vars[0])-fp_cosh(-vars[0]) __
+#define T2848(_,__)_ -fp_log(vars[0])-fp_exp(-vars[0]) __
+#define T5681(_,__)_ -fp_log(vars[0])-fp_exp(-vars[0]) __
+#define T5682(_,__)_ -fp_log(vars[0])-fp_log(-vars[0]) __
+#define T2996(_,__)_ -fp_log(vars[0])-fp_log(vars[0]) __
+#define T5798(_,__)_ -fp_log(vars[0])-fp_log(vars[0]) __
+#define T2849(_,__)_ -fp_log(vars[0])-fp_sin(-vars[0]) __
+#define T5683(_,__)_ -fp_log(vars[0])-fp_sin(-vars[0]) __
+#define T2997(_,__)_ -fp_log(vars[0])-fp_sin(vars[0]) __
+#define T5799(_,__)_ -fp_log(vars[0])-fp_sin(vars[0]) __
+#define T2850(_,__)_ -fp_log(vars[0])-fp_sinh(-vars[0]) __
+#define T5684(_,__)_ -fp_log(vars[0])-fp_sinh(-vars[0]) __
+#define T2998(_,__)_ -fp_log(vars[0])-fp_sinh(vars[0]) __
+#define T5800(_,__)_ -fp_log(vars[0])-fp_sinh(vars[0]) __
+#define T5685(_,__)_ -fp_log(vars[0])-fp_tan(-vars[0]) __
+#define T2851(_,__)_ -fp_log(vars[0])-fp_tan(-vars[0]) __
+#define T2999(_,__)_ -fp_log(vars[0])-fp_tan(vars[0]) __
+#define T5801(_,__)_ -fp_log(vars[0])-fp_tan(vars[0]) __
+#define T2852(_,__)_ -fp_log(vars[0])-fp_tanh(-vars[0]) __
+#define T5686(_,__)_ -fp_log(vars[0])-fp_tanh(-vars[0]) __
+#define T3000(_,__)_ -fp_log(vars[0])-fp_tanh(vars[0]) __
+#define T5802(_,__)_ -fp_log(vars[0])-fp_tanh(vars[0]) __
+#define T2713(_,__)_ -fp_sin(-vars[0])-fp_sin(-vars[0]) __
+#define T2714(_,__)_ -fp_sin(-vars[0])-fp_sinh(-vars[0]) __
+#define T2715(_,__)_ -fp_sin(-vars[0])-fp_tan(-vars[0]) __
+#define T5579(_,__)_ -fp_sin(-vars[0])-fp_tan(-vars[0]) __
+#define T5580(_,__)_ -fp_sin(-vars[0])-fp_tanh(-vars[0]) __
+#define T2716(_,__)_ -fp_sin(-vars[0])-fp_tanh(-vars[0]) __
+#define T2853(_,__)_ -fp_sin(vars[0])-fp_acos(-vars[0]) __
+#define T5687(_,__)_ -fp_sin(vars[0])-fp_acos(-vars[0]) __
+#define T5688(_,__)_ -fp_sin(vars[0])-fp_acosh(-vars[0]) __
+#define T2854(_,__)_ -fp_sin(vars[0])-fp_acosh(-vars[0]) __
+#define T2855(_,__)_ -fp_sin(vars[0])-fp_asin(-vars[0]) __
+#define T5689(_,__)_ -fp_sin(vars[0])-fp_asin(-vars[0]) __
+#define T5690(_,__)_ -fp_sin(vars[0])-fp_asinh(-vars[0]) __
+#define T2856(_,__)_ -fp_sin(vars[0])-fp_asinh(-vars[0]) __
+#define T5691(_,__)_ -fp_sin(vars[0])-fp_atan(-vars[0]) __
+#define T2857(_,__)_ -fp_sin(vars[0])-fp_atan(-vars[0]) __
+#define T2858(_,__)_ -fp_sin(vars[0])-fp_atanh(-vars[0]) __
+#define T2859(_,__)_ -fp_sin(vars[0])-fp_cos(-vars[0]) __
+#define T2860(_,__)_ -fp_sin(vars[0])-fp_cosh(-vars[0]) __
+#define T2861(_,__)_ -fp_sin(vars[0])-fp_exp(-vars[0]) __
+#define T2862(_,__)_ -fp_sin(vars[0])-fp_log(-vars[0]) __
+#define T5692(_,__)_ -fp_sin(vars[0])-fp_log(-vars[0]) __
+#define T2863(_,__)_ -fp_sin(vars[0])-fp_sin(-vars[0]) __
+#define T3001(_,__)_ -fp_sin(vars[0])-fp_sin(vars[0]) __
+#define T2864(_,__)_ -fp_sin(vars[0])-fp_sinh(-vars[0]) __
+#define T3002(_,__)_ -fp_sin(vars[0])-fp_sinh(vars[0]) __
+#define T5693(_,__)_ -fp_sin(vars[0])-fp_tan(-vars[0]) __
+#define T2865(_,__)_ -fp_sin(vars[0])-fp_tan(-vars[0]) __
+#define T3003(_,__)_ -fp_sin(vars[0])-fp_tan(vars[0]) __
+#define T5803(_,__)_ -fp_sin(vars[0])-fp_tan(vars[0]) __
+#define T5694(_,__)_ -fp_sin(vars[0])-fp_tanh(-vars[0]) __
+#define T2866(_,__)_ -fp_sin(vars[0])-fp_tanh(-vars[0]) __
+#define T3004(_,__)_ -fp_sin(vars[0])-fp_tanh(vars[0]) __
+#define T5804(_,__)_ -fp_sin(vars[0])-fp_tanh(vars[0]) __
+#define  T597(_,__)_ -fp_sin(vars[0]*c.l5) __
+#define T2717(_,__)_ -fp_sinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5581(_,__)_ -fp_sinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2718(_,__)_ -fp_sinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2719(_,__)_ -fp_sinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5582(_,__)_ -fp_sinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5695(_,__)_ -fp_sinh(vars[0])-fp_acos(-vars[0]) __
+#define T2867(_,__)_ -fp_sinh(vars[0])-fp_acos(-vars[0]) __
+#define T2868(_,__)_ -fp_sinh(vars[0])-fp_acosh(-vars[0]) __
+#define T5696(_,__)_ -fp_sinh(vars[0])-fp_acosh(-vars[0]) __
+#define T2869(_,__)_ -fp_sinh(vars[0])-fp_asin(-vars[0]) __
+#define T5697(_,__)_ -fp_sinh(vars[0])-fp_asin(-vars[0]) __
+#define T5698(_,__)_ -fp_sinh(vars[0])-fp_asinh(-vars[0]) __
+#define T2870(_,__)_ -fp_sinh(vars[0])-fp_asinh(-vars[0]) __
+#define T5699(_,__)_ -fp_sinh(vars[0])-fp_atan(-vars[0]) __
+#define T2871(_,__)_ -fp_sinh(vars[0])-fp_atan(-vars[0]) __
+#define T2872(_,__)_ -fp_sinh(vars[0])-fp_atanh(-vars[0]) __
+#define T2873(_,__)_ -fp_sinh(vars[0])-fp_cos(-vars[0]) __
+#define T2874(_,__)_ -fp_sinh(vars[0])-fp_cosh(-vars[0]) __
+#define T2875(_,__)_ -fp_sinh(vars[0])-fp_exp(-vars[0]) __
+#define T5700(_,__)_ -fp_sinh(vars[0])-fp_log(-vars[0]) __
+#define T2876(_,__)_ -fp_sinh(vars[0])-fp_log(-vars[0]) __
+#define T2877(_,__)_ -fp_sinh(vars[0])-fp_sin(-vars[0]) __
+#define T2878(_,__)_ -fp_sinh(vars[0])-fp_sinh(-vars[0]) __
+#define T3005(_,__)_ -fp_sinh(vars[0])-fp_sinh(vars[0]) __
+#define T2879(_,__)_ -fp_sinh(vars[0])-fp_tan(-vars[0]) __
+#define T5701(_,__)_ -fp_sinh(vars[0])-fp_tan(-vars[0]) __
+#define T3006(_,__)_ -fp_sinh(vars[0])-fp_tan(vars[0]) __
+#define T5805(_,__)_ -fp_sinh(vars[0])-fp_tan(vars[0]) __
+#define T2880(_,__)_ -fp_sinh(vars[0])-fp_tanh(-vars[0]) __
+#define T5702(_,__)_ -fp_sinh(vars[0])-fp_tanh(-vars[0]) __
+#define T5806(_,__)_ -fp_sinh(vars[0])-fp_tanh(vars[0]) __
+#define T3007(_,__)_ -fp_sinh(vars[0])-fp_tanh(vars[0]) __
+#define  T596(_,__)_ -fp_sinh(vars[0]*c.l5) __
+#define T2720(_,__)_ -fp_tan(-vars[0])-fp_tan(-vars[0]) __
+#define T5583(_,__)_ -fp_tan(-vars[0])-fp_tan(-vars[0]) __
+#define T2721(_,__)_ -fp_tan(-vars[0])-fp_tanh(-vars[0]) __
+#define T5584(_,__)_ -fp_tan(-vars[0])-fp_tanh(-vars[0]) __
+#define T5703(_,__)_ -fp_tan(vars[0])-fp_acos(-vars[0]) __
+#define T2881(_,__)_ -fp_tan(vars[0])-fp_acos(-vars[0]) __
+#define T2882(_,__)_ -fp_tan(vars[0])-fp_acosh(-vars[0]) __
+#define T5704(_,__)_ -fp_tan(vars[0])-fp_acosh(-vars[0]) __
+#define T5705(_,__)_ -fp_tan(vars[0])-fp_asin(-vars[0]) __
+#define T2883(_,__)_ -fp_tan(vars[0])-fp_asin(-vars[0]) __
+#define T2884(_,__)_ -fp_tan(vars[0])-fp_asinh(-vars[0]) __
+#define T5706(_,__)_ -fp_tan(vars[0])-fp_asinh(-vars[0]) __
+#define T2885(_,__)_ -fp_tan(vars[0])-fp_atan(-vars[0]) __
+#define T5707(_,__)_ -fp_tan(vars[0])-fp_atan(-vars[0]) __
+#define T5708(_,__)_ -fp_tan(vars[0])-fp_atanh(-vars[0]) __
+#define T2886(_,__)_ -fp_tan(vars[0])-fp_atanh(-vars[0]) __
+#define T2887(_,__)_ -fp_tan(vars[0])-fp_cos(-vars[0]) __
+#define T5709(_,__)_ -fp_tan(vars[0])-fp_cos(-vars[0]) __
+#define T2888(_,__)_ -fp_tan(vars[0])-fp_cosh(-vars[0]) __
+#define T5710(_,__)_ -fp_tan(vars[0])-fp_cosh(-vars[0]) __
+#define T2889(_,__)_ -fp_tan(vars[0])-fp_exp(-vars[0]) __
+#define T5711(_,__)_ -fp_tan(vars[0])-fp_exp(-vars[0]) __
+#define T2890(_,__)_ -fp_tan(vars[0])-fp_log(-vars[0]) __
+#define T5712(_,__)_ -fp_tan(vars[0])-fp_log(-vars[0]) __
+#define T2891(_,__)_ -fp_tan(vars[0])-fp_sin(-vars[0]) __
+#define T5713(_,__)_ -fp_tan(vars[0])-fp_sin(-vars[0]) __
+#define T2892(_,__)_ -fp_tan(vars[0])-fp_sinh(-vars[0]) __
+#define T5714(_,__)_ -fp_tan(vars[0])-fp_sinh(-vars[0]) __
+#define T2893(_,__)_ -fp_tan(vars[0])-fp_tan(-vars[0]) __
+#define T5715(_,__)_ -fp_tan(vars[0])-fp_tan(-vars[0]) __
+#define T3008(_,__)_ -fp_tan(vars[0])-fp_tan(vars[0]) __
+#define T5807(_,__)_ -fp_tan(vars[0])-fp_tan(vars[0]) __
+#define T2894(_,__)_ -fp_tan(vars[0])-fp_tanh(-vars[0]) __
+#define T5716(_,__)_ -fp_tan(vars[0])-fp_tanh(-vars[0]) __
+#define T3009(_,__)_ -fp_tan(vars[0])-fp_tanh(vars[0]) __
+#define T5808(_,__)_ -fp_tan(vars[0])-fp_tanh(vars[0]) __
+#define  T599(_,__)_ -fp_tan(vars[0]*c.l5) __
+#define T2722(_,__)_ -fp_tanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5585(_,__)_ -fp_tanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2895(_,__)_ -fp_tanh(vars[0])-fp_acos(-vars[0]) __
+#define T5717(_,__)_ -fp_tanh(vars[0])-fp_acos(-vars[0]) __
+#define T5718(_,__)_ -fp_tanh(vars[0])-fp_acosh(-vars[0]) __
+#define T2896(_,__)_ -fp_tanh(vars[0])-fp_acosh(-vars[0]) __
+#define T2897(_,__)_ -fp_tanh(vars[0])-fp_asin(-vars[0]) __
+#define T5719(_,__)_ -fp_tanh(vars[0])-fp_asin(-vars[0]) __
+#define T2898(_,__)_ -fp_tanh(vars[0])-fp_asinh(-vars[0]) __
+#define T5720(_,__)_ -fp_tanh(vars[0])-fp_asinh(-vars[0]) __
+#define T5721(_,__)_ -fp_tanh(vars[0])-fp_atan(-vars[0]) __
+#define T2899(_,__)_ -fp_tanh(vars[0])-fp_atan(-vars[0]) __
+#define T5722(_,__)_ -fp_tanh(vars[0])-fp_atanh(-vars[0]) __
+#define T2900(_,__)_ -fp_tanh(vars[0])-fp_atanh(-vars[0]) __
+#define T2901(_,__)_ -fp_tanh(vars[0])-fp_cos(-vars[0]) __
+#define T5723(_,__)_ -fp_tanh(vars[0])-fp_cos(-vars[0]) __
+#define T5724(_,__)_ -fp_tanh(vars[0])-fp_cosh(-vars[0]) __
+#define T2902(_,__)_ -fp_tanh(vars[0])-fp_cosh(-vars[0]) __
+#define T5725(_,__)_ -fp_tanh(vars[0])-fp_exp(-vars[0]) __
+#define T2903(_,__)_ -fp_tanh(vars[0])-fp_exp(-vars[0]) __
+#define T5726(_,__)_ -fp_tanh(vars[0])-fp_log(-vars[0]) __
+#define T2904(_,__)_ -fp_tanh(vars[0])-fp_log(-vars[0]) __
+#define T2905(_,__)_ -fp_tanh(vars[0])-fp_sin(-vars[0]) __
+#define T5727(_,__)_ -fp_tanh(vars[0])-fp_sin(-vars[0]) __
+#define T5728(_,__)_ -fp_tanh(vars[0])-fp_sinh(-vars[0]) __
+#define T2906(_,__)_ -fp_tanh(vars[0])-fp_sinh(-vars[0]) __
+#define T2907(_,__)_ -fp_tanh(vars[0])-fp_tan(-vars[0]) __
+#define T5729(_,__)_ -fp_tanh(vars[0])-fp_tan(-vars[0]) __
+#define T5730(_,__)_ -fp_tanh(vars[0])-fp_tanh(-vars[0]) __
+#define T2908(_,__)_ -fp_tanh(vars[0])-fp_tanh(-vars[0]) __
+#define T3010(_,__)_ -fp_tanh(vars[0])-fp_tanh(vars[0]) __
+#define T5809(_,__)_ -fp_tanh(vars[0])-fp_tanh(vars[0]) __
+#define  T598(_,__)_ -fp_tanh(vars[0]*c.l5) __
+#define   T14(_,__)_ -vars[0] __
+#define  T354(_,__)_ -vars[0] __
+#define T3730(_,__)_ MpfrFloat::abs(vars[0]) __
+#define T3733(_,__)_ MpfrFloat::acos(vars[0]) __
+#define T3731(_,__)_ MpfrFloat::acosh(vars[0]) __
+#define T3737(_,__)_ MpfrFloat::asin(vars[0]) __
+#define T3735(_,__)_ MpfrFloat::asinh(vars[0]) __
+#define T3742(_,__)_ MpfrFloat::atan(vars[0]) __
+#define T3771(_,__)_ MpfrFloat::atan2(vars[0]*c.l0,c.lm1) __
+#define T3739(_,__)_ MpfrFloat::atan2(vars[0],vars[1]) __
+#define T3741(_,__)_ MpfrFloat::atanh(vars[0]) __
+#define T3744(_,__)_ MpfrFloat::cbrt(vars[0]) __
+#define T3745(_,__)_ MpfrFloat::ceil(vars[0]) __
+#define T3749(_,__)_ MpfrFloat::cos(d2r(vars[0])) __
+#define T3748(_,__)_ MpfrFloat::cos(vars[0]) __
+#define T3747(_,__)_ MpfrFloat::cosh(d2r(vars[0])) __
+#define T3746(_,__)_ MpfrFloat::cosh(vars[0]) __
+#define T3751(_,__)_ MpfrFloat::exp(vars[0]) __
+#define T3768(_,__)_ MpfrFloat::exp(vars[0]*c.l0+c.l1) __
+#define T3750(_,__)_ MpfrFloat::exp2(vars[0]) __
+#define T3752(_,__)_ MpfrFloat::floor(vars[0]) __
+#define T3753(_,__)_ MpfrFloat::hypot(vars[0],vars[1]) __
+#define T3756(_,__)_ MpfrFloat::log(vars[0]) __
+#define T3770(_,__)_ MpfrFloat::log(vars[0]*c.l0+c.l10) __
+#define T3769(_,__)_ MpfrFloat::log(vars[0]*c.l0+c.l2) __
+#define T3755(_,__)_ MpfrFloat::log10(vars[0]) __
+#define T3754(_,__)_ MpfrFloat::log2(vars[0]) __
+#define T3757(_,__)_ MpfrFloat::pow(-vars[0]*c.l0_25,vars[1]) __
+#define T3758(_,__)_ MpfrFloat::pow(vars[0],vars[1]) __
+#define T3762(_,__)_ MpfrFloat::sin(d2r(vars[0])) __
+#define T3761(_,__)_ MpfrFloat::sin(vars[0]) __
+#define T3760(_,__)_ MpfrFloat::sinh(d2r(vars[0])) __
+#define T3759(_,__)_ MpfrFloat::sinh(vars[0]) __
+#define T3763(_,__)_ MpfrFloat::sqrt(vars[0]) __
+#define T3767(_,__)_ MpfrFloat::tan(d2r(vars[0])) __
+#define T3766(_,__)_ MpfrFloat::tan(vars[0]) __
+#define T3765(_,__)_ MpfrFloat::tanh(d2r(vars[0])) __
+#define T3764(_,__)_ MpfrFloat::tanh(vars[0]) __
+#define Tcustomtest_index(_,__)_ OptimizerTests::evaluateFunction(vars) __
+#define  T355(_,__)_ Value_t( fp_abs(vars[0]) < c.l0_5 ) __
+#define  T357(_,__)_ Value_t( fp_abs(vars[0]) < c.l0_5 ? fp_abs(vars[1]) >= c.l0_5 : c.l1 ) __
+#define  T356(_,__)_ Value_t( fp_abs(vars[0]) >= c.l0_5 ) __
+#define  T342(_,__)_ Value_t( fp_abs(vars[0]) >= c.l0_5 ? fp_abs(vars[1]) >= c.l0_5 : c.l0 ) __
+#define  T329(_,__)_ Value_t(!fp_nequal(vars[0],vars[1])&&fp_not(vars[0]))+Value_t(!(!(!fp_not(vars[1])))) __
+#define  T115(_,__)_ Value_t(fp_abs(vars[0]))*(Value_t(fp_abs(vars[1]))*c.l5) __
+#define   T30(_,__)_ Value_t(fp_abs(vars[0]))*Value_t(fp_abs(vars[0])) __
+#define  T294(_,__)_ Value_t(fp_abs(vars[0]))*Value_t(fp_abs(vars[1]))*vars[2] __
+#define  T116(_,__)_ Value_t(fp_abs(vars[0]))/(Value_t(fp_abs(vars[1]))*c.l5) __
+#define  T337(_,__)_ Value_t(fp_abs(vars[0]*vars[1]))<c.l20||(vars[0]+vars[1]>c.l30&&vars[2]>c.l5) ? fp_min(vars[0],c.l2*vars[1]) : fp_max(vars[1],vars[2]*c.l2) __
+#define  T117(_,__)_ Value_t(fp_abs(vars[1]))*(c.l5/vars[0]) __
+#define  T128(_,__)_ Value_t(fp_abs(vars[1]))+(c.l5-vars[0]) __
+#define  T129(_,__)_ Value_t(fp_abs(vars[1]))-(c.l5-vars[0]) __
+#define  T118(_,__)_ Value_t(fp_abs(vars[1]))/(c.l50/vars[0]) __
+#define   T33(_,__)_ Value_t(fp_and(c.l5,c.l3))+vars[0]+Value_t(fp_and(c.l5,c.l0))+Value_t(fp_and(c.l0,c.l5))+Value_t(fp_and(c.l0,c.l0)) __
+#define T3673(_,__)_ Value_t(fp_and(vars[0],vars[1]))+c.l4*Value_t(fp_or(fp_int(vars[0]/c.l10),fp_int(vars[1]/c.l10)))+c.l8*((-Value_t(fp_not(-Value_t(fp_not(-vars[0])))))+Value_t(fp_not(-Value_t(fp_not(-Value_t(fp_not(vars[1])))))))+c.l16*(-vars[0]+Value_t(fp_not(vars[1]))) __
+#define  T151(_,__)_ Value_t(fp_equal(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l1)))+Value_t(fp_equal((fp_truth(c.l1) ? c.l0 : c.l1),Value_t(fp_abs(vars[0])))) __
+#define   T24(_,__)_ Value_t(fp_equal(Value_t(fp_abs(vars[0])),c.l0))+Value_t(fp_equal(c.l0,Value_t(fp_abs(vars[0])))) __
+#define   T25(_,__)_ Value_t(fp_equal(Value_t(fp_abs(vars[0])),c.l0))+Value_t(fp_equal(c.l0,Value_t(fp_abs(vars[0])))) __
+#define   T40(_,__)_ Value_t(fp_equal(c.l5,c.l3))+vars[0]+Value_t(fp_equal(c.l4,c.l4)) __
+#define   T99(_,__)_ Value_t(fp_equal(vars[0]*vars[0],c.l0))+Value_t(fp_equal(c.l0,vars[0]*vars[0])) __
+#define  T100(_,__)_ Value_t(fp_equal(vars[0]*vars[0],c.l0))+Value_t(fp_equal(c.l0,vars[0]*vars[0])) __
+#define  T231(_,__)_ Value_t(fp_equal(vars[0],(fp_truth(c.l1) ? c.l0 : c.l0)))+Value_t(fp_equal((fp_truth(c.l1) ? c.l0 : c.l0),vars[0])) __
+#define   T54(_,__)_ Value_t(fp_equal(vars[0],c.l0))+Value_t(fp_equal(c.l0,vars[0])) __
+#define T3637(_,__)_ Value_t(fp_equal(vars[0],vars[1])&&fp_equal(vars[1],vars[0]))+c.l1+c.l2-c.l3_1*c.l4e2/c.l_5+vars[0]*vars[0]+vars[1]*vars[1]+vars[2]*vars[2]+Value_t(fp_and(vars[0],vars[0]))+Value_t(fp_or(vars[1],vars[1])) __
+#define  T241(_,__)_ Value_t(fp_greater(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l0)))+c.l2*Value_t(fp_less((fp_truth(c.l1) ? c.l0 : c.l0),Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_less(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l0)))+c.l8*Value_t(fp_greater((fp_truth(c.l1) ? c.l0 : c.l0),Value_t(fp_abs(vars[0])))) __
+#define  T242(_,__)_ Value_t(fp_greater(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)))+c.l2*Value_t(fp_less((fp_truth(c.l1) ? c.l1 : c.l1),Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_less(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)))+c.l8*Value_t(fp_greater((fp_truth(c.l1) ? c.l1 : c.l1),Value_t(fp_abs(vars[0])))) __
+#define   T58(_,__)_ Value_t(fp_greater(Value_t(fp_abs(vars[0])),c.l0))+c.l2*Value_t(fp_less(c.l0,Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_less(Value_t(fp_abs(vars[0])),c.l0))+c.l8*Value_t(fp_greater(c.l0,Value_t(fp_abs(vars[0])))) __
+#define   T59(_,__)_ Value_t(fp_greater(Value_t(fp_abs(vars[0])),c.l1))+c.l2*Value_t(fp_less(c.l1,Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_less(Value_t(fp_abs(vars[0])),c.l1))+c.l8*Value_t(fp_greater(c.l1,Value_t(fp_abs(vars[0])))) __
+#define   T42(_,__)_ Value_t(fp_greater(c.l5,c.l3))+vars[0]+Value_t(fp_greater(c.l4,c.l8)) __
+#define  T513(_,__)_ Value_t(fp_greater(fp_acos(vars[0]),c.l0))+c.l2*Value_t(fp_less(c.l0,fp_acos(vars[0])))+c.l4*Value_t(fp_less(fp_acos(vars[0]),c.l0))+c.l8*Value_t(fp_greater(c.l0,fp_acos(vars[0]))) __
+#define  T515(_,__)_ Value_t(fp_greater(fp_acos(vars[0]),c.l1))+c.l2*Value_t(fp_less(c.l1,fp_acos(vars[0])))+c.l4*Value_t(fp_less(fp_acos(vars[0]),c.l1))+c.l8*Value_t(fp_greater(c.l1,fp_acos(vars[0]))) __
+#define  T512(_,__)_ Value_t(fp_greater(fp_sin(vars[0]),c.l0))+c.l2*Value_t(fp_less(c.l0,fp_sin(vars[0])))+c.l4*Value_t(fp_less(fp_sin(vars[0]),c.l0))+c.l8*Value_t(fp_greater(c.l0,fp_sin(vars[0]))) __
+#define  T514(_,__)_ Value_t(fp_greater(fp_sin(vars[0]),c.l1))+c.l2*Value_t(fp_less(c.l1,fp_sin(vars[0])))+c.l4*Value_t(fp_less(fp_sin(vars[0]),c.l1))+c.l8*Value_t(fp_greater(c.l1,fp_sin(vars[0]))) __
+#define  T233(_,__)_ Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l0)))+c.l2*Value_t(fp_lessOrEq((fp_truth(c.l1) ? c.l0 : c.l0),Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_lessOrEq(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l0)))+c.l8*Value_t(fp_greaterOrEq((fp_truth(c.l1) ? c.l0 : c.l0),Value_t(fp_abs(vars[0])))) __
+#define  T234(_,__)_ Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)))+c.l2*Value_t(fp_lessOrEq((fp_truth(c.l1) ? c.l1 : c.l1),Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_lessOrEq(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)))+c.l8*Value_t(fp_greaterOrEq((fp_truth(c.l1) ? c.l1 : c.l1),Value_t(fp_abs(vars[0])))) __
+#define   T56(_,__)_ Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),c.l0))+c.l2*Value_t(fp_lessOrEq(c.l0,Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_lessOrEq(Value_t(fp_abs(vars[0])),c.l0))+c.l8*Value_t(fp_greaterOrEq(c.l0,Value_t(fp_abs(vars[0])))) __
+#define   T57(_,__)_ Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),c.l1))+c.l2*Value_t(fp_lessOrEq(c.l1,Value_t(fp_abs(vars[0]))))+c.l4*Value_t(fp_lessOrEq(Value_t(fp_abs(vars[0])),c.l1))+c.l8*Value_t(fp_greaterOrEq(c.l1,Value_t(fp_abs(vars[0])))) __
+#define   T41(_,__)_ Value_t(fp_greaterOrEq(c.l5,c.l3))+vars[0]+Value_t(fp_greaterOrEq(c.l4,c.l8)) __
+#define  T508(_,__)_ Value_t(fp_greaterOrEq(fp_acos(vars[0]),c.l0))+c.l2*Value_t(fp_lessOrEq(c.l0,fp_acos(vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_acos(vars[0]),c.l0))+c.l8*Value_t(fp_greaterOrEq(c.l0,fp_acos(vars[0]))) __
+#define  T510(_,__)_ Value_t(fp_greaterOrEq(fp_acos(vars[0]),c.l1))+c.l2*Value_t(fp_lessOrEq(c.l1,fp_acos(vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_acos(vars[0]),c.l1))+c.l8*Value_t(fp_greaterOrEq(c.l1,fp_acos(vars[0]))) __
+#define  T507(_,__)_ Value_t(fp_greaterOrEq(fp_sin(vars[0]),c.l0))+c.l2*Value_t(fp_lessOrEq(c.l0,fp_sin(vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_sin(vars[0]),c.l0))+c.l8*Value_t(fp_greaterOrEq(c.l0,fp_sin(vars[0]))) __
+#define  T509(_,__)_ Value_t(fp_greaterOrEq(fp_sin(vars[0]),c.l1))+c.l2*Value_t(fp_lessOrEq(c.l1,fp_sin(vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_sin(vars[0]),c.l1))+c.l8*Value_t(fp_greaterOrEq(c.l1,fp_sin(vars[0]))) __
+#define  T145(_,__)_ Value_t(fp_less((c.l5*vars[1]+Value_t(fp_abs(vars[0]))),c.l0))*c.l1+Value_t(fp_less(Value_t(fp_abs(vars[1])),c.l0))*c.l2 __
+#define  T335(_,__)_ Value_t(fp_less(-vars[0],c.l3))+Value_t(fp_greater(vars[0]*c.lm1,c.l5))+Value_t(fp_less(vars[0]*c.lm3,c.l10))+Value_t(fp_less(vars[0]*c.lm3,vars[1]*c.l7))+Value_t(fp_less(vars[0]*c.l4,vars[1]*c.l7))+Value_t(fp_less(vars[0]*c.l6,vars[1]*c.lm3))+Value_t(fp_less(-vars[0],c.l11))+Value_t(fp_less(c.l5,-vars[1])) __
+#define   T44(_,__)_ Value_t(fp_less(c.l5,c.l3))+vars[0] __
+#define   T43(_,__)_ Value_t(fp_less(c.l5,c.l3))+vars[0]+Value_t(fp_less(c.l4,c.l8)) __
+#define T3677(_,__)_ Value_t(fp_less(fp_cos(vars[0]),fp_sin(vars[0])))+(fp_cos(vars[0])-fp_sin(vars[0]))+userDefFuncSub<Value_t>((uparam[0]=(fp_sinh(vars[0])-fp_cosh(vars[0])), uparam[1]=(fp_sinh(vars[0])/fp_cosh(vars[0])), uparam+0))+fp_sqrt(fp_pow(fp_cos(vars[0]),c.l2)+fp_pow(fp_sin(vars[0]),c.l2)) __
+#define T3675(_,__)_ Value_t(fp_less(fp_pow(vars[0],c.l1_2),c.l0))+Value_t(fp_less(fp_pow(vars[1],c.l2_5),c.l0))+c.l2*Value_t(fp_less(vars[0]*vars[0],c.l0))+c.l3*Value_t(fp_less(fp_pow(vars[1],c.l3),c.l0))+c.l4*Value_t(fp_less(fp_pow(vars[0],c.l4),c.l0)) __
+#define T3674(_,__)_ Value_t(fp_less(vars[0],vars[1]))+Value_t(fp_lessOrEq(vars[0],vars[1]))+Value_t(fp_greater(vars[0],vars[1]))+Value_t(fp_greaterOrEq(vars[0],vars[1]))+Value_t(fp_equal(vars[0],vars[1]))+Value_t(fp_nequal(vars[0],vars[1]))+Value_t(fp_and(vars[0],vars[1]))+Value_t(fp_or(vars[0],vars[1]))+Value_t(fp_not(vars[0]))+Value_t(fp_truth(vars[0]))+Value_t(!(fp_less(vars[0],vars[1])&&fp_less(vars[0],c.l3)))+Value_t(!fp_greater(vars[0],vars[1])||fp_greater(vars[0],c.l3)) __
+#define  T328(_,__)_ Value_t(fp_less(vars[0],vars[1]))+c.l10*Value_t(fp_lessOrEq(vars[0],vars[1]))+c.l100*Value_t(fp_greater(vars[0],vars[1]))+c.l1000*Value_t(fp_greaterOrEq(vars[0],vars[1]))+c.l10000*Value_t(fp_equal(vars[0],vars[1]))+c.l100000*Value_t(fp_nequal(vars[0],vars[1]))+Value_t(fp_and(vars[0],vars[1]))*c.l2+Value_t(fp_or(vars[0],vars[1]))*c.l20+Value_t(fp_not(vars[0]))*c.l200+Value_t(fp_truth(vars[0]))*c.l2000+c.l4*Value_t(!(fp_less(vars[0],vars[1])&&fp_less(vars[0],c.l3)))+c.l40*Value_t(!fp_greater(vars[0],vars[1])||fp_greater(vars[0],c.l3)) __
+#define  T334(_,__)_ Value_t(fp_less(vars[0],vars[1])||fp_less(vars[1],vars[0]))+c.l2*Value_t(fp_less(vars[0],vars[1])&&fp_less(vars[1],vars[0]))+c.l4*Value_t(fp_lessOrEq(vars[0],vars[1])&&fp_lessOrEq(vars[1],vars[0]))+c.l8*Value_t(fp_less(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]))+c.l16*Value_t(fp_less(vars[0],vars[1])||fp_nequal(vars[0],vars[1]))+c.l32*Value_t(fp_lessOrEq(vars[0],vars[1])&&fp_greaterOrEq(vars[0],vars[1]))+c.l64*Value_t(fp_lessOrEq(vars[0],vars[1])||fp_greaterOrEq(vars[0],vars[1]))+c.l128*Value_t(fp_nequal(vars[0],vars[1])&&fp_equal(vars[0],vars[1]))+c.l256*Value_t(fp_nequal(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]))+c.l512*Value_t(fp_lessOrEq(vars[0],vars[1])&&fp_equal(vars[0],vars[1])) __
+#define  T152(_,__)_ Value_t(fp_nequal(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l0 : c.l1)))+Value_t(fp_nequal((fp_truth(c.l1) ? c.l0 : c.l1),Value_t(fp_abs(vars[0])))) __
+#define   T45(_,__)_ Value_t(fp_nequal(c.l5,c.l3))+vars[0]+Value_t(fp_nequal(c.l4,c.l4)) __
+#define  T299(_,__)_ Value_t(fp_nequal(vars[0],(fp_truth(c.l1) ? c.l0 : c.l0)))+Value_t(fp_nequal((fp_truth(c.l1) ? c.l0 : c.l0),vars[0])) __
+#define   T80(_,__)_ Value_t(fp_nequal(vars[0],c.l0))+Value_t(fp_nequal(c.l0,vars[0])) __
+#define   T82(_,__)_ Value_t(fp_not(c.l3))+vars[0] __
+#define T3597(_,__)_ Value_t(fp_not(vars[0]))*Value_t(fp_not(vars[1])) __
+#define T3599(_,__)_ Value_t(fp_not(vars[0]))*Value_t(fp_not(vars[1]))*Value_t(fp_not(vars[2])) __
+#define T3598(_,__)_ Value_t(fp_not(vars[0]))*Value_t(fp_not(vars[1]))*vars[2] __
+#define   T92(_,__)_ Value_t(fp_or(c.l5,c.l3))+vars[0]+Value_t(fp_or(c.l5,c.l0))+Value_t(fp_or(c.l0,c.l5))+Value_t(fp_or(c.l0,c.l0)) __
+#define T3595(_,__)_ Value_t(fp_truth(vars[0]))*Value_t(fp_less(vars[1],c.l0)) __
+#define T3592(_,__)_ Value_t(fp_truth(vars[0]))*Value_t(fp_truth(vars[1])) __
+#define T3594(_,__)_ Value_t(fp_truth(vars[0]))*Value_t(fp_truth(vars[1]))*Value_t(fp_truth(vars[2])) __
+#define T3593(_,__)_ Value_t(fp_truth(vars[0]))*Value_t(fp_truth(vars[1]))*vars[2] __
+#define  T310(_,__)_ Value_t(fp_truth(vars[0]))+(fp_truth(vars[1]) ? c.l1 : c.l0) __
+#define   T16(_,__)_ Value_t(vars[0]!=c.l0) __
+#define T3782(_,__)_ Value_t(vars[0].real()*std::cos(vars[1].real()), vars[0].real()*std::sin(vars[1].real())) __
+#define   T15(_,__)_ Value_t(vars[0]==c.l0) __
+#define  T319(_,__)_ [&]{ Value_t a = vars[0]; return a*c.l0; }() __
+#define T3617(_,__)_ [&]{ Value_t pi = fp_const_pi<Value_t>(), y = vars[0]*pi, p23 = pi*c.l2/c.l3, p52 = pi*c.l5/c.l2, p62 = pi*c.l6/c.l2, p72 = pi*c.l7/c.l2; return fp_cos(y+pi)+fp_cos(y+p23)+fp_cos(y+p52)+fp_cos(y+p62)+fp_cos(y+p72)+fp_sin(y+pi)+fp_sin(y+p23)+fp_sin(y+p52)+fp_sin(y+p62)+fp_sin(y+p72)+fp_cos(y-pi)+fp_cos(y-p23)+fp_cos(y-p52)+fp_cos(y-p62)+fp_cos(y-p72)+fp_sin(y-pi)+fp_sin(y-p23)+fp_sin(y-p52)+fp_sin(y-p62)+fp_sin(y-p72); }() __
+#define  T489(_,__)_ [&]{ Value_t pi = fp_const_pi<Value_t>(); return (c.l180/pi)*vars[1]+vars[0]*(c.l180/pi)+(vars[1]*(c.l180/pi))*c.l4; }() __
+#define  T559(_,__)_ [&]{ Value_t pi = fp_const_pi<Value_t>(); return (pi/c.l180)*vars[1]+vars[0]*(pi/c.l180)+(vars[0]*(pi/c.l180))*c.l4; }() __
+#define T3647(_,__)_ [&]{ Value_t pi = fp_const_pi<Value_t>(); return vars[0]*pi+fp_sin(c.l2*pi)+fp_const_preciseDouble<Value_t>(CONST); }() __
+#define T3658(_,__)_ [&]{ Value_t pi = fp_const_pi<Value_t>(); return vars[0]+vars[1]/vars[1]-fp_min(c.l3,c.l4)-vars[0]-fp_max(c.l4,c.l3)+fp_max(c.l3,c.l4)-fp_min(c.l4,c.l3)+c.l0+(vars[2]*c.l1)+(vars[0]-c.l2+c.l2)+(vars[0]*c.l0_5*c.l2)+vars[1]*c.l0+fp_min(fp_min(fp_min(c.l4_0,vars[0]),c.l1_0),fp_min(vars[0],fp_min(fp_min(vars[1],c.l4_0),vars[2])))+fp_max(fp_max(fp_max(c.l4_0,vars[0]),c.l1_0),fp_max(vars[0],fp_max(fp_max(vars[1],c.l4_0),vars[2])))+(fp_abs(c.l1)+fp_acos(c.l1_0)+fp_asin(c.l1_0)+fp_atan(c.l1_0)+fp_ceil(c.l1_1)+fp_cos(c.l0_0)+fp_cosh(c.l0_0)+fp_floor(c.l1_1)+fp_log(c.l1_0)+fp_sin(c.l0_0)+fp_sinh(c.l0_0)+fp_tan(c.l1_0)+fp_tanh(c.l1_0)+fp_atan2(c.l1_0,c.l1_0))+(vars[0]-(vars[1]-vars[2]))+(vars[0]+vars[1])+(vars[0]*vars[1])+fp_max(vars[0],fp_max(vars[0],fp_max(vars[0],fp_max(vars[0],vars[0]))))*c.lm1_0+(vars[2]-vars[2])+fp_inv(fp_sin(vars[0]/c.l5))+fp_inv(fp_cos(vars[1]/c.l5))+fp_inv(fp_tan(vars[2]/c.l5))+fp_log10(fp_inv(fp_tan(vars[2]/c.l5))+fp_inv(fp_sin(vars[1]/c.l5))+fp_inv(fp_cos(vars[0]/c.l5)))+fp_log(c.l30+vars[0])*fp_log(c.l40+vars[1])/fp_log(c.l50+vars[2])+fp_sin(vars[0]/(c.l180/pi))+fp_asin(vars[0]/c.l10)*(c.l180/pi)+fp_floor(-vars[0])+fp_inv(fp_ceil(vars[0]))+fp_sqrt(c.l5*c.l0_2)+(-vars[0]+-vars[0]+-vars[0]+-vars[0]+-vars[0]+-vars[0]); }() __
+#define  T216(_,__)_ c.l0x0001*(fp_less(vars[0],vars[1]) ? vars[0] : vars[1])+c.l0x0002*(fp_lessOrEq(vars[0],vars[1]) ? vars[0] : vars[1])+c.l0x0004*(fp_greater(vars[0],vars[1]) ? vars[0] : vars[1])+c.l0x0008*(fp_greaterOrEq(vars[0],vars[1]) ? vars[0] : vars[1])+c.l0x0010*(fp_nequal(vars[0],vars[1]) ? vars[0] : vars[1])+c.l0x0020*(fp_equal(vars[0],vars[1]) ? vars[0] : vars[1]) __
+#define  T217(_,__)_ c.l0x0001*(fp_less(vars[0],vars[1]) ? vars[1] : vars[0])+c.l0x0002*(fp_lessOrEq(vars[0],vars[1]) ? vars[1] : vars[0])+c.l0x0004*(fp_greater(vars[0],vars[1]) ? vars[1] : vars[0])+c.l0x0008*(fp_greaterOrEq(vars[0],vars[1]) ? vars[1] : vars[0])+c.l0x0010*(fp_nequal(vars[0],vars[1]) ? vars[1] : vars[0])+c.l0x0020*(fp_equal(vars[0],vars[1]) ? vars[1] : vars[0]) __
+#define  T214(_,__)_ c.l0x0001*Value_t(fp_less(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))))+c.l0x0002*Value_t(fp_lessOrEq(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))))+c.l0x0004*Value_t(fp_greater(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))))+c.l0x0008*Value_t(fp_greaterOrEq(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))))+c.l0x0010*Value_t(fp_nequal(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))))+c.l0x0020*Value_t(fp_equal(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0]))))) __
+#define  T221(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]*c.l4),(vars[1]+c.l6)))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]*c.l4),(vars[1]+c.l6)))+c.l0x0004*Value_t(fp_greater((vars[0]*c.l4),(vars[1]+c.l6)))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]*c.l4),(vars[1]+c.l6)))+c.l0x0010*Value_t(fp_nequal((vars[0]*c.l4),(vars[1]+c.l6)))+c.l0x0020*Value_t(fp_equal((vars[0]*c.l4),(vars[1]+c.l6))) __
+#define  T219(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]*c.l4*vars[1]),c.l6))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]*c.l4*vars[1]),c.l6))+c.l0x0004*Value_t(fp_greater((vars[0]*c.l4*vars[1]),c.l6))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]*c.l4*vars[1]),c.l6))+c.l0x0010*Value_t(fp_nequal((vars[0]*c.l4*vars[1]),c.l6))+c.l0x0020*Value_t(fp_equal((vars[0]*c.l4*vars[1]),c.l6)) __
+#define  T220(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]*c.lm4),(vars[1]+c.l6)))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]*c.lm4),(vars[1]+c.l6)))+c.l0x0004*Value_t(fp_greater((vars[0]*c.lm4),(vars[1]+c.l6)))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]*c.lm4),(vars[1]+c.l6)))+c.l0x0010*Value_t(fp_nequal((vars[0]*c.lm4),(vars[1]+c.l6)))+c.l0x0020*Value_t(fp_equal((vars[0]*c.lm4),(vars[1]+c.l6))) __
+#define  T218(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]*c.lm4*vars[1]),c.l6))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]*c.lm4*vars[1]),c.l6))+c.l0x0004*Value_t(fp_greater((vars[0]*c.lm4*vars[1]),c.l6))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]*c.lm4*vars[1]),c.l6))+c.l0x0010*Value_t(fp_nequal((vars[0]*c.lm4*vars[1]),c.l6))+c.l0x0020*Value_t(fp_equal((vars[0]*c.lm4*vars[1]),c.l6)) __
+#define  T215(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]+c.l4),(vars[1]+c.l6)))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]+c.l4),(vars[1]+c.l6)))+c.l0x0004*Value_t(fp_greater((vars[0]+c.l4),(vars[1]+c.l6)))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]+c.l4),(vars[1]+c.l6)))+c.l0x0010*Value_t(fp_nequal((vars[0]+c.l4),(vars[1]+c.l6)))+c.l0x0020*Value_t(fp_equal((vars[0]+c.l4),(vars[1]+c.l6))) __
+#define  T213(_,__)_ c.l0x0001*Value_t(fp_less((vars[0]+c.l4+vars[1]),c.l6))+c.l0x0002*Value_t(fp_lessOrEq((vars[0]+c.l4+vars[1]),c.l6))+c.l0x0004*Value_t(fp_greater((vars[0]+c.l4+vars[1]),c.l6))+c.l0x0008*Value_t(fp_greaterOrEq((vars[0]+c.l4+vars[1]),c.l6))+c.l0x0010*Value_t(fp_nequal((vars[0]+c.l4+vars[1]),c.l6))+c.l0x0020*Value_t(fp_equal((vars[0]+c.l4+vars[1]),c.l6)) __
+#define T3456(_,__)_ c.l0x0001*Value_t(fp_less(c.l5_0625,fp_pow(c.l1_5,vars[0])))+c.l0x0002*Value_t(fp_lessOrEq(c.l5_0625,fp_pow(c.l1_5,vars[0])))+c.l0x0004*Value_t(fp_greater(c.l5_0625,fp_pow(c.l1_5,vars[0])))+c.l0x0008*Value_t(fp_greaterOrEq(c.l5_0625,fp_pow(c.l1_5,vars[0])))+c.l0x0010*Value_t(fp_nequal(c.l5_0625,fp_pow(c.l1_5,vars[0])))+c.l0x0020*Value_t(fp_equal(c.l5_0625,fp_pow(c.l1_5,vars[0]))) __
+#define T3457(_,__)_ c.l0x0001*Value_t(fp_less(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])))+c.l0x0002*Value_t(fp_lessOrEq(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])))+c.l0x0004*Value_t(fp_greater(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])))+c.l0x0008*Value_t(fp_greaterOrEq(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])))+c.l0x0010*Value_t(fp_nequal(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])))+c.l0x0020*Value_t(fp_equal(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1]))) __
+#define T3455(_,__)_ c.l0x0001*Value_t(fp_less(fp_pow(vars[0],c.l2),c.l25))+c.l0x0002*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l2),c.l25))+c.l0x0004*Value_t(fp_greater(fp_pow(vars[0],c.l2),c.l25))+c.l0x0008*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l2),c.l25))+c.l0x0010*Value_t(fp_nequal(fp_pow(vars[0],c.l2),c.l25))+c.l0x0020*Value_t(fp_equal(fp_pow(vars[0],c.l2),c.l25)) __
+#define T3454(_,__)_ c.l0x0001*Value_t(fp_less(fp_pow(vars[0],c.l3),c.lm125))+c.l0x0002*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l3),c.lm125))+c.l0x0004*Value_t(fp_greater(fp_pow(vars[0],c.l3),c.lm125))+c.l0x0008*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l3),c.lm125))+c.l0x0010*Value_t(fp_nequal(fp_pow(vars[0],c.l3),c.lm125))+c.l0x0020*Value_t(fp_equal(fp_pow(vars[0],c.l3),c.lm125)) __
+#define T3453(_,__)_ c.l0x0001*Value_t(fp_less(fp_pow(vars[0],c.lm2),c.l0_0625))+c.l0x0002*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm2),c.l0_0625))+c.l0x0004*Value_t(fp_greater(fp_pow(vars[0],c.lm2),c.l0_0625))+c.l0x0008*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm2),c.l0_0625))+c.l0x0010*Value_t(fp_nequal(fp_pow(vars[0],c.lm2),c.l0_0625))+c.l0x0020*Value_t(fp_equal(fp_pow(vars[0],c.lm2),c.l0_0625)) __
+#define T3452(_,__)_ c.l0x0001*Value_t(fp_less(fp_pow(vars[0],c.lm3),c.lm0_015625))+c.l0x0002*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm3),c.lm0_015625))+c.l0x0004*Value_t(fp_greater(fp_pow(vars[0],c.lm3),c.lm0_015625))+c.l0x0008*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm3),c.lm0_015625))+c.l0x0010*Value_t(fp_nequal(fp_pow(vars[0],c.lm3),c.lm0_015625))+c.l0x0020*Value_t(fp_equal(fp_pow(vars[0],c.lm3),c.lm0_015625)) __
+#define  T224(_,__)_ c.l1 __
+#define  T226(_,__)_ c.l1 __
+#define  T225(_,__)_ c.l1 __
+#define  T223(_,__)_ c.l1 __
+#define  T228(_,__)_ c.l1 __
+#define  T222(_,__)_ c.l1 __
+#define T3458(_,__)_ c.l1 __
+#define  T227(_,__)_ c.l1 __
+#define  T229(_,__)_ c.l1 __
+#define  T230(_,__)_ c.l1 __
+#define  T271(_,__)_ c.l1*(c.l5+(fp_less(vars[0],c.l0) ? -vars[0] : vars[0]))+c.l10*(c.l5+(fp_lessOrEq(vars[0],c.l0) ? -vars[0] : vars[0]))+c.l100*(c.l5+(fp_greater(vars[0],c.l0) ? -vars[0] : vars[0]))+c.l1000*(c.l5+(fp_greaterOrEq(vars[0],c.l0) ? -vars[0] : vars[0]))+c.l10000*(c.l5+(fp_less(vars[0],c.l0) ? vars[0] : -vars[0]))+c.l100000*(c.l5+(fp_lessOrEq(vars[0],c.l0) ? vars[0] : -vars[0]))+c.l1000000*(c.l5+(fp_greater(vars[0],c.l0) ? vars[0] : -vars[0]))+c.l10000000*(c.l5+(fp_greaterOrEq(vars[0],c.l0) ? vars[0] : -vars[0])) __
+#define   T37(_,__)_ c.l1*Value_t(fp_equal((-vars[0]),c.l4))+c.l2*Value_t(fp_less((-vars[0]),c.l4))+c.l4*Value_t(fp_lessOrEq((-vars[0]),c.l4))+c.l8*Value_t(fp_greater((-vars[0]),c.l4))+c.l16*Value_t(fp_greaterOrEq((-vars[0]),c.l4))+c.l32*Value_t(fp_nequal((-vars[0]),c.l4)) __
+#define   T34(_,__)_ c.l1*Value_t(fp_equal((c.l1-vars[0]+vars[0]+c.l5),c.l4))+c.l2*Value_t(fp_less((c.l1-vars[0]+vars[0]+c.l5),c.l4))+c.l4*Value_t(fp_lessOrEq((c.l1-vars[0]+vars[0]+c.l5),c.l4))+c.l8*Value_t(fp_greater((c.l1-vars[0]+vars[0]+c.l5),c.l4))+c.l16*Value_t(fp_greaterOrEq((c.l1-vars[0]+vars[0]+c.l5),c.l4))+c.l32*Value_t(fp_nequal((c.l1-vars[0]+vars[0]+c.l5),c.l4)) __
+#define   T38(_,__)_ c.l1*Value_t(fp_equal((vars[0]*vars[0]),c.l16))+c.l2*Value_t(fp_less((vars[0]*vars[0]),c.l16))+c.l4*Value_t(fp_lessOrEq((vars[0]*vars[0]),c.l16))+c.l8*Value_t(fp_greater((vars[0]*vars[0]),c.l16))+c.l16*Value_t(fp_greaterOrEq((vars[0]*vars[0]),c.l16))+c.l32*Value_t(fp_nequal((vars[0]*vars[0]),c.l16)) __
+#define   T39(_,__)_ c.l1*Value_t(fp_equal((vars[0]*vars[0]),c.lm16))+c.l2*Value_t(fp_less((vars[0]*vars[0]),c.lm16))+c.l4*Value_t(fp_lessOrEq((vars[0]*vars[0]),c.lm16))+c.l8*Value_t(fp_greater((vars[0]*vars[0]),c.lm16))+c.lm16*Value_t(fp_greaterOrEq((vars[0]*vars[0]),c.lm16))+c.l32*Value_t(fp_nequal((vars[0]*vars[0]),c.lm16)) __
+#define   T35(_,__)_ c.l1*Value_t(fp_equal((vars[0]/c.l2*vars[0]*c.l5),c.l4))+c.l2*Value_t(fp_less((vars[0]/c.l2*vars[0]*c.l5),c.l4))+c.l4*Value_t(fp_lessOrEq((vars[0]/c.l2*vars[0]*c.l5),c.l4))+c.l8*Value_t(fp_greater((vars[0]/c.l2*vars[0]*c.l5),c.l4))+c.l16*Value_t(fp_greaterOrEq((vars[0]/c.l2*vars[0]*c.l5),c.l4))+c.l32*Value_t(fp_nequal((vars[0]/c.l2*vars[0]*c.l5),c.l4)) __
+#define   T36(_,__)_ c.l1*Value_t(fp_equal((vars[0]/c.l2*vars[0]*c.lm5),c.l4))+c.l2*Value_t(fp_less((vars[0]/c.l2*vars[0]*c.lm5),c.l4))+c.l4*Value_t(fp_lessOrEq((vars[0]/c.l2*vars[0]*c.lm5),c.l4))+c.l8*Value_t(fp_greater((vars[0]/c.l2*vars[0]*c.lm5),c.l4))+c.l16*Value_t(fp_greaterOrEq((vars[0]/c.l2*vars[0]*c.lm5),c.l4))+c.l32*Value_t(fp_nequal((vars[0]/c.l2*vars[0]*c.lm5),c.l4)) __
+#define  T446(_,__)_ c.l1*Value_t(fp_equal(fp_acos(vars[0]),c.l2))+c.l2*Value_t(fp_less(fp_acos(vars[0]),c.l2))+c.l4*Value_t(fp_lessOrEq(fp_acos(vars[0]),c.l2))+c.l8*Value_t(fp_greater(fp_acos(vars[0]),c.l2))+c.l16*Value_t(fp_greaterOrEq(fp_acos(vars[0]),c.l2))+c.l32*Value_t(fp_nequal(fp_acos(vars[0]),c.l2)) __
+#define  T445(_,__)_ c.l1*Value_t(fp_equal(fp_acos(vars[0]),fp_acos(c.l0_75)))+c.l2*Value_t(fp_less(fp_acos(vars[0]),fp_acos(c.l0_75)))+c.l4*Value_t(fp_lessOrEq(fp_acos(vars[0]),fp_acos(c.l0_75)))+c.l8*Value_t(fp_greater(fp_acos(vars[0]),fp_acos(c.l0_75)))+c.l16*Value_t(fp_greaterOrEq(fp_acos(vars[0]),fp_acos(c.l0_75)))+c.l32*Value_t(fp_nequal(fp_acos(vars[0]),fp_acos(c.l0_75))) __
+#define  T448(_,__)_ c.l1*Value_t(fp_equal(fp_asin(vars[0]),c.l2))+c.l2*Value_t(fp_less(fp_asin(vars[0]),c.l2))+c.l4*Value_t(fp_lessOrEq(fp_asin(vars[0]),c.l2))+c.l8*Value_t(fp_greater(fp_asin(vars[0]),c.l2))+c.l16*Value_t(fp_greaterOrEq(fp_asin(vars[0]),c.l2))+c.l32*Value_t(fp_nequal(fp_asin(vars[0]),c.l2)) __
+#define  T447(_,__)_ c.l1*Value_t(fp_equal(fp_asin(vars[0]),fp_asin(c.l0_75)))+c.l2*Value_t(fp_less(fp_asin(vars[0]),fp_asin(c.l0_75)))+c.l4*Value_t(fp_lessOrEq(fp_asin(vars[0]),fp_asin(c.l0_75)))+c.l8*Value_t(fp_greater(fp_asin(vars[0]),fp_asin(c.l0_75)))+c.l16*Value_t(fp_greaterOrEq(fp_asin(vars[0]),fp_asin(c.l0_75)))+c.l32*Value_t(fp_nequal(fp_asin(vars[0]),fp_asin(c.l0_75))) __
+#define  T449(_,__)_ c.l1*Value_t(fp_equal(fp_atan(vars[0]),fp_atan(c.l2)))+c.l2*Value_t(fp_less(fp_atan(vars[0]),fp_atan(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_atan(vars[0]),fp_atan(c.l2)))+c.l8*Value_t(fp_greater(fp_atan(vars[0]),fp_atan(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_atan(vars[0]),fp_atan(c.l2)))+c.l32*Value_t(fp_nequal(fp_atan(vars[0]),fp_atan(c.l2))) __
+#define  T453(_,__)_ c.l1*Value_t(fp_equal(fp_exp(vars[0]),c.lm4))+c.l2*Value_t(fp_less(fp_exp(vars[0]),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_exp(vars[0]),c.lm4))+c.l8*Value_t(fp_greater(fp_exp(vars[0]),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_exp(vars[0]),c.lm4))+c.l32*Value_t(fp_nequal(fp_exp(vars[0]),c.lm4)) __
+#define  T450(_,__)_ c.l1*Value_t(fp_equal(fp_exp(vars[0]),fp_exp(c.l2)))+c.l2*Value_t(fp_less(fp_exp(vars[0]),fp_exp(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_exp(vars[0]),fp_exp(c.l2)))+c.l8*Value_t(fp_greater(fp_exp(vars[0]),fp_exp(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_exp(vars[0]),fp_exp(c.l2)))+c.l32*Value_t(fp_nequal(fp_exp(vars[0]),fp_exp(c.l2))) __
+#define  T452(_,__)_ c.l1*Value_t(fp_equal(fp_exp2(vars[0]),c.lm4))+c.l2*Value_t(fp_less(fp_exp2(vars[0]),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_exp2(vars[0]),c.lm4))+c.l8*Value_t(fp_greater(fp_exp2(vars[0]),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_exp2(vars[0]),c.lm4))+c.l32*Value_t(fp_nequal(fp_exp2(vars[0]),c.lm4)) __
+#define  T451(_,__)_ c.l1*Value_t(fp_equal(fp_exp2(vars[0]),fp_exp2(c.l2)))+c.l2*Value_t(fp_less(fp_exp2(vars[0]),fp_exp2(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_exp2(vars[0]),fp_exp2(c.l2)))+c.l8*Value_t(fp_greater(fp_exp2(vars[0]),fp_exp2(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_exp2(vars[0]),fp_exp2(c.l2)))+c.l32*Value_t(fp_nequal(fp_exp2(vars[0]),fp_exp2(c.l2))) __
+#define  T464(_,__)_ c.l1*Value_t(fp_equal(fp_log(Value_t(fp_abs(vars[0]))),c.lm2))+c.l2*Value_t(fp_less(fp_log(Value_t(fp_abs(vars[0]))),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log(Value_t(fp_abs(vars[0]))),c.lm2))+c.l8*Value_t(fp_greater(fp_log(Value_t(fp_abs(vars[0]))),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log(Value_t(fp_abs(vars[0]))),c.lm2))+c.l32*Value_t(fp_nequal(fp_log(Value_t(fp_abs(vars[0]))),c.lm2)) __
+#define  T465(_,__)_ c.l1*Value_t(fp_equal(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2)))+c.l2*Value_t(fp_less(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2)))+c.l8*Value_t(fp_greater(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2)))+c.l32*Value_t(fp_nequal(fp_log(Value_t(fp_abs(vars[0]))),fp_log(c.l2))) __
+#define  T462(_,__)_ c.l1*Value_t(fp_equal(fp_log(vars[0]),c.lm2))+c.l2*Value_t(fp_less(fp_log(vars[0]),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log(vars[0]),c.lm2))+c.l8*Value_t(fp_greater(fp_log(vars[0]),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log(vars[0]),c.lm2))+c.l32*Value_t(fp_nequal(fp_log(vars[0]),c.lm2)) __
+#define  T463(_,__)_ c.l1*Value_t(fp_equal(fp_log(vars[0]),fp_log(c.l2)))+c.l2*Value_t(fp_less(fp_log(vars[0]),fp_log(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_log(vars[0]),fp_log(c.l2)))+c.l8*Value_t(fp_greater(fp_log(vars[0]),fp_log(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_log(vars[0]),fp_log(c.l2)))+c.l32*Value_t(fp_nequal(fp_log(vars[0]),fp_log(c.l2))) __
+#define  T460(_,__)_ c.l1*Value_t(fp_equal(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2))+c.l2*Value_t(fp_less(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2))+c.l8*Value_t(fp_greater(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2))+c.l32*Value_t(fp_nequal(fp_log10(Value_t(fp_abs(vars[0]))),c.lm2)) __
+#define  T461(_,__)_ c.l1*Value_t(fp_equal(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1)))+c.l2*Value_t(fp_less(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1)))+c.l4*Value_t(fp_lessOrEq(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1)))+c.l8*Value_t(fp_greater(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1)))+c.l16*Value_t(fp_greaterOrEq(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1)))+c.l32*Value_t(fp_nequal(fp_log10(Value_t(fp_abs(vars[0]))),fp_log10(c.l1))) __
+#define  T458(_,__)_ c.l1*Value_t(fp_equal(fp_log10(vars[0]),c.lm2))+c.l2*Value_t(fp_less(fp_log10(vars[0]),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log10(vars[0]),c.lm2))+c.l8*Value_t(fp_greater(fp_log10(vars[0]),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log10(vars[0]),c.lm2))+c.l32*Value_t(fp_nequal(fp_log10(vars[0]),c.lm2)) __
+#define  T459(_,__)_ c.l1*Value_t(fp_equal(fp_log10(vars[0]),fp_log10(c.l2)))+c.l2*Value_t(fp_less(fp_log10(vars[0]),fp_log10(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_log10(vars[0]),fp_log10(c.l2)))+c.l8*Value_t(fp_greater(fp_log10(vars[0]),fp_log10(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_log10(vars[0]),fp_log10(c.l2)))+c.l32*Value_t(fp_nequal(fp_log10(vars[0]),fp_log10(c.l2))) __
+#define  T456(_,__)_ c.l1*Value_t(fp_equal(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2))+c.l2*Value_t(fp_less(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2))+c.l8*Value_t(fp_greater(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2))+c.l32*Value_t(fp_nequal(fp_log2(Value_t(fp_abs(vars[0]))),c.lm2)) __
+#define  T457(_,__)_ c.l1*Value_t(fp_equal(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2)))+c.l2*Value_t(fp_less(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2)))+c.l8*Value_t(fp_greater(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2)))+c.l32*Value_t(fp_nequal(fp_log2(Value_t(fp_abs(vars[0]))),fp_log2(c.l2))) __
+#define  T454(_,__)_ c.l1*Value_t(fp_equal(fp_log2(vars[0]),c.lm2))+c.l2*Value_t(fp_less(fp_log2(vars[0]),c.lm2))+c.l4*Value_t(fp_lessOrEq(fp_log2(vars[0]),c.lm2))+c.l8*Value_t(fp_greater(fp_log2(vars[0]),c.lm2))+c.l16*Value_t(fp_greaterOrEq(fp_log2(vars[0]),c.lm2))+c.l32*Value_t(fp_nequal(fp_log2(vars[0]),c.lm2)) __
+#define  T455(_,__)_ c.l1*Value_t(fp_equal(fp_log2(vars[0]),fp_log2(c.l2)))+c.l2*Value_t(fp_less(fp_log2(vars[0]),fp_log2(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_log2(vars[0]),fp_log2(c.l2)))+c.l8*Value_t(fp_greater(fp_log2(vars[0]),fp_log2(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_log2(vars[0]),fp_log2(c.l2)))+c.l32*Value_t(fp_nequal(fp_log2(vars[0]),fp_log2(c.l2))) __
+#define  T469(_,__)_ c.l1*Value_t(fp_equal(fp_pow((c.lm2_051),vars[0]),c.l4))+c.l2*Value_t(fp_less(fp_pow((c.lm2_051),vars[0]),c.l4))+c.l4*Value_t(fp_lessOrEq(fp_pow((c.lm2_051),vars[0]),c.l4))+c.l8*Value_t(fp_greater(fp_pow((c.lm2_051),vars[0]),c.l4))+c.l16*Value_t(fp_greaterOrEq(fp_pow((c.lm2_051),vars[0]),c.l4))+c.l32*Value_t(fp_nequal(fp_pow((c.lm2_051),vars[0]),c.l4)) __
+#define  T468(_,__)_ c.l1*Value_t(fp_equal(fp_pow((c.lm2_051),vars[0]),c.lm4))+c.l2*Value_t(fp_less(fp_pow((c.lm2_051),vars[0]),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_pow((c.lm2_051),vars[0]),c.lm4))+c.l8*Value_t(fp_greater(fp_pow((c.lm2_051),vars[0]),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_pow((c.lm2_051),vars[0]),c.lm4))+c.l32*Value_t(fp_nequal(fp_pow((c.lm2_051),vars[0]),c.lm4)) __
+#define  T466(_,__)_ c.l1*Value_t(fp_equal(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0])))+c.l2*Value_t(fp_less(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0])))+c.l8*Value_t(fp_greater(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0])))+c.l16*Value_t(fp_greaterOrEq(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0])))+c.l32*Value_t(fp_nequal(fp_pow((c.lm2_051),vars[0]),fp_pow((c.lm1_061),vars[0]))) __
+#define  T467(_,__)_ c.l1*Value_t(fp_equal(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l2*Value_t(fp_less(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l4*Value_t(fp_lessOrEq(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l8*Value_t(fp_greater(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l16*Value_t(fp_greaterOrEq(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l32*Value_t(fp_nequal(fp_pow((c.lm2_051),vars[0]),fp_pow(c.l1_061,(vars[0]/c.l3)))) __
+#define  T470(_,__)_ c.l1*Value_t(fp_equal(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0])))+c.l2*Value_t(fp_less(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0])))+c.l4*Value_t(fp_lessOrEq(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0])))+c.l8*Value_t(fp_greater(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0])))+c.l16*Value_t(fp_greaterOrEq(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0])))+c.l32*Value_t(fp_nequal(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow((c.lm1_061),vars[0]))) __
+#define  T471(_,__)_ c.l1*Value_t(fp_equal(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l2*Value_t(fp_less(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l4*Value_t(fp_lessOrEq(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l8*Value_t(fp_greater(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l16*Value_t(fp_greaterOrEq(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3))))+c.l32*Value_t(fp_nequal(fp_pow(c.l2_051,(vars[0]/c.l3)),fp_pow(c.l1_061,(vars[0]/c.l3)))) __
+#define  T473(_,__)_ c.l1*Value_t(fp_equal(fp_pow(c.l2_051,vars[0]),c.l4))+c.l2*Value_t(fp_less(fp_pow(c.l2_051,vars[0]),c.l4))+c.l4*Value_t(fp_lessOrEq(fp_pow(c.l2_051,vars[0]),c.l4))+c.l8*Value_t(fp_greater(fp_pow(c.l2_051,vars[0]),c.l4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(c.l2_051,vars[0]),c.l4))+c.l32*Value_t(fp_nequal(fp_pow(c.l2_051,vars[0]),c.l4)) __
+#define  T472(_,__)_ c.l1*Value_t(fp_equal(fp_pow(c.l2_051,vars[0]),c.lm4))+c.l2*Value_t(fp_less(fp_pow(c.l2_051,vars[0]),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_pow(c.l2_051,vars[0]),c.lm4))+c.l8*Value_t(fp_greater(fp_pow(c.l2_051,vars[0]),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(c.l2_051,vars[0]),c.lm4))+c.l32*Value_t(fp_nequal(fp_pow(c.l2_051,vars[0]),c.lm4)) __
+#define  T481(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.l5_1),c.l4))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.l5_1),c.l4))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l5_1),c.l4))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.l5_1),c.l4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l5_1),c.l4))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.l5_1),c.l4)) __
+#define  T480(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.l5_1),c.lm4))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.l5_1),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l5_1),c.lm4))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.l5_1),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l5_1),c.lm4))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.l5_1),c.lm4)) __
+#define  T479(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1)))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1)))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1)))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1)))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1)))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.l6_1))) __
+#define  T478(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1)))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1)))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1)))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1)))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1)))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.l5_1),fp_pow(vars[0],c.lm6_1))) __
+#define  T477(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.lm5_1),c.l4))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.lm5_1),c.l4))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm5_1),c.l4))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.lm5_1),c.l4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm5_1),c.l4))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.lm5_1),c.l4)) __
+#define  T476(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.lm5_1),c.lm4))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.lm5_1),c.lm4))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm5_1),c.lm4))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.lm5_1),c.lm4))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm5_1),c.lm4))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.lm5_1),c.lm4)) __
+#define  T475(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1)))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1)))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1)))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1)))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1)))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.l6_1))) __
+#define  T474(_,__)_ c.l1*Value_t(fp_equal(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1)))+c.l2*Value_t(fp_less(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1)))+c.l4*Value_t(fp_lessOrEq(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1)))+c.l8*Value_t(fp_greater(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1)))+c.l16*Value_t(fp_greaterOrEq(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1)))+c.l32*Value_t(fp_nequal(fp_pow(vars[0],c.lm5_1),fp_pow(vars[0],c.lm6_1))) __
+#define  T482(_,__)_ c.l1*Value_t(fp_equal(fp_sinh(vars[0]),fp_sinh(c.l2)))+c.l2*Value_t(fp_less(fp_sinh(vars[0]),fp_sinh(c.l2)))+c.l4*Value_t(fp_lessOrEq(fp_sinh(vars[0]),fp_sinh(c.l2)))+c.l8*Value_t(fp_greater(fp_sinh(vars[0]),fp_sinh(c.l2)))+c.l16*Value_t(fp_greaterOrEq(fp_sinh(vars[0]),fp_sinh(c.l2)))+c.l32*Value_t(fp_nequal(fp_sinh(vars[0]),fp_sinh(c.l2))) __
+#define  T484(_,__)_ c.l1*Value_t(fp_equal(fp_tanh(vars[0]),c.l2))+c.l2*Value_t(fp_less(fp_tanh(vars[0]),c.l2))+c.l4*Value_t(fp_lessOrEq(fp_tanh(vars[0]),c.l2))+c.l8*Value_t(fp_greater(fp_tanh(vars[0]),c.l2))+c.l16*Value_t(fp_greaterOrEq(fp_tanh(vars[0]),c.l2))+c.l32*Value_t(fp_nequal(fp_tanh(vars[0]),c.l2)) __
+#define  T483(_,__)_ c.l1*Value_t(fp_equal(fp_tanh(vars[0]),fp_tanh(c.l0_75)))+c.l2*Value_t(fp_less(fp_tanh(vars[0]),fp_tanh(c.l0_75)))+c.l4*Value_t(fp_lessOrEq(fp_tanh(vars[0]),fp_tanh(c.l0_75)))+c.l8*Value_t(fp_greater(fp_tanh(vars[0]),fp_tanh(c.l0_75)))+c.l16*Value_t(fp_greaterOrEq(fp_tanh(vars[0]),fp_tanh(c.l0_75)))+c.l32*Value_t(fp_nequal(fp_tanh(vars[0]),fp_tanh(c.l0_75))) __
+#define  T336(_,__)_ c.l1+c.l2+c.l3-c.l4*c.l5*c.l6/c.l3+c.l10/c.l2-c.l9%c.l2+(vars[0]+vars[1]-c.l11*vars[0]+vars[2]/c.l10+vars[0]/(vars[2]+c.l31)) __
+#define T3643(_,__)_ c.l1+fp_sin(fp_cos(fp_max(c.l1+c.l2+c.l3+c.l4+c.l5,vars[0]+vars[1]+vars[2])))+c.l2 __
+#define T3615(_,__)_ c.l1-fp_pow(fp_cos(vars[0]),c.l2) __
+#define T3616(_,__)_ c.l1-fp_pow(fp_sin(vars[0]),c.l2) __
+#define  T351(_,__)_ c.l1/vars[0] __
+#define   T11(_,__)_ c.l1/vars[0] __
+#define T3669(_,__)_ c.l1_25*(fp_exp(vars[0])+fp_exp(-vars[0]))+c.l1_5*(fp_exp(vars[1])-fp_exp(-vars[1]))+c.l1_75*((fp_exp(-vars[0])+fp_exp(vars[0]))/c.l2)+c.l2_0*((fp_exp(-vars[0])-fp_exp(vars[0]))/c.l2)+c.l2_25*(fp_cosh(vars[1])+fp_sinh(vars[1])) __
+#define T3642(_,__)_ c.l1_5+vars[0]*vars[1]-c.l2+c.l4/c.l8+vars[2]+vars[2]+vars[2]+vars[2]+vars[0]/(vars[1]*vars[2]) __
+#define T3636(_,__)_ c.l2*vars[0]+fp_sin(vars[0])/c.l_5+c.l2-fp_sin(vars[0])*fp_sin(vars[0]) __
+#define  T156(_,__)_ c.l5*((fp_truth(c.l1) ? c.l4 : c.l0)*vars[1]+vars[0]) __
+#define  T155(_,__)_ c.l5*((fp_truth(c.l1) ? c.l4 : c.l0)+vars[0]+vars[1]) __
+#define  T109(_,__)_ c.l5*vars[0] __
+#define  T325(_,__)_ c.l5*vars[0]*vars[1]+(c.lm5)*vars[2] __
+#define  T120(_,__)_ c.l5+(vars[0]*vars[1]) __
+#define   T31(_,__)_ c.l5+c.l3+vars[0] __
+#define T3660(_,__)_ c.l5+c.l7_5*c.l8/c.l3-fp_pow(c.l2,c.l4)*c.l2+fp_mod(c.l7,c.l2)+c.l4+vars[0] __
+#define  T121(_,__)_ c.l5-(vars[0]*vars[1]) __
+#define  T101(_,__)_ c.l5-c.l3+vars[0] __
+#define  T110(_,__)_ c.l5/vars[0] __
+#define  T379(_,__)_ d2r(vars[1])+d2r(vars[2])+d2r(vars[3])+d2r(vars[0]) __
+#define   T72(_,__)_ fp_abs(-vars[0]) __
+#define  T927(_,__)_ fp_abs(Value_t(fp_abs(vars[0]))) __
+#define T4050(_,__)_ fp_abs(Value_t(fp_arg(vars[0]))) __
+#define  T938(_,__)_ fp_abs(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4056(_,__)_ fp_abs(Value_t(fp_imag(vars[0]))) __
+#define T3468(_,__)_ fp_abs(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3469(_,__)_ fp_abs(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3470(_,__)_ fp_abs(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3471(_,__)_ fp_abs(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define  T956(_,__)_ fp_abs(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4069(_,__)_ fp_abs(Value_t(fp_real(vars[0]))) __
+#define   T23(_,__)_ fp_abs(c.lm3)+vars[0] __
+#define T3679(_,__)_ fp_abs(c.lm4+fp_sin(vars[0])) __
+#define  T916(_,__)_ fp_abs(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4041(_,__)_ fp_abs(fp_acos(vars[0])) __
+#define  T416(_,__)_ fp_abs(fp_acos(vars[0])) __
+#define  T914(_,__)_ fp_abs(fp_acos(vars[0])) __
+#define T4042(_,__)_ fp_abs(fp_acosh(vars[0])) __
+#define  T915(_,__)_ fp_abs(fp_acosh(vars[0]+c.l0_6)) __
+#define  T920(_,__)_ fp_abs(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T917(_,__)_ fp_abs(fp_asin(vars[0])) __
+#define T4043(_,__)_ fp_abs(fp_asin(vars[0])) __
+#define  T919(_,__)_ fp_abs(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T918(_,__)_ fp_abs(fp_asinh(vars[0])) __
+#define T4044(_,__)_ fp_abs(fp_asinh(vars[0])) __
+#define T4046(_,__)_ fp_abs(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T925(_,__)_ fp_abs(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4047(_,__)_ fp_abs(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T926(_,__)_ fp_abs(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4048(_,__)_ fp_abs(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T924(_,__)_ fp_abs(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T921(_,__)_ fp_abs(fp_atan(vars[0])) __
+#define T4045(_,__)_ fp_abs(fp_atan(vars[0])) __
+#define  T922(_,__)_ fp_abs(fp_atan(vars[0]/vars[1])) __
+#define  T912(_,__)_ fp_abs(fp_atan2(vars[0],vars[1])) __
+#define  T923(_,__)_ fp_abs(fp_atanh(vars[0])) __
+#define  T930(_,__)_ fp_abs(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T929(_,__)_ fp_abs(fp_cbrt(vars[0])) __
+#define T4049(_,__)_ fp_abs(fp_cbrt(vars[0])) __
+#define T4063(_,__)_ fp_abs(fp_conj(vars[0])) __
+#define  T933(_,__)_ fp_abs(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T928(_,__)_ fp_abs(fp_cos(vars[0])) __
+#define  T932(_,__)_ fp_abs(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T931(_,__)_ fp_abs(fp_cosh(vars[0])) __
+#define  T940(_,__)_ fp_abs(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T939(_,__)_ fp_abs(fp_exp(vars[0])) __
+#define  T935(_,__)_ fp_abs(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T934(_,__)_ fp_abs(fp_exp2(vars[0])) __
+#define T3668(_,__)_ fp_abs(fp_floor(fp_acos(vars[0])+c.l4))+c.l1_1*fp_abs(fp_floor(fp_acos(vars[1])+c.l1_5))+Value_t(fp_less(fp_acos(vars[0]),(fp_acos(vars[1])-c.l10)))+c.l1_2*fp_max(c.lm4,fp_acos(vars[0]))+c.l1_3*fp_min(c.l9,fp_acos(vars[0])-c.l9) __
+#define T4052(_,__)_ fp_abs(fp_hypot(c.l1,vars[0])) __
+#define  T941(_,__)_ fp_abs(fp_hypot(c.l1,vars[0])) __
+#define T4053(_,__)_ fp_abs(fp_hypot(c.l2,vars[0])) __
+#define  T942(_,__)_ fp_abs(fp_hypot(c.l2,vars[0])) __
+#define T4054(_,__)_ fp_abs(fp_hypot(vars[0],c.l1)) __
+#define  T944(_,__)_ fp_abs(fp_hypot(vars[0],c.l1)) __
+#define T4055(_,__)_ fp_abs(fp_hypot(vars[0],c.l2)) __
+#define  T945(_,__)_ fp_abs(fp_hypot(vars[0],c.l2)) __
+#define T4051(_,__)_ fp_abs(fp_hypot(vars[0],vars[1])) __
+#define  T943(_,__)_ fp_abs(fp_hypot(vars[0],vars[1])) __
+#define T4057(_,__)_ fp_abs(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T947(_,__)_ fp_abs(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define  T946(_,__)_ fp_abs(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define  T937(_,__)_ fp_abs(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T936(_,__)_ fp_abs(fp_inv(fp_cos(vars[0]))) __
+#define  T948(_,__)_ fp_abs(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4059(_,__)_ fp_abs(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define  T949(_,__)_ fp_abs(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4060(_,__)_ fp_abs(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4061(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define  T951(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4062(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T952(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T950(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4058(_,__)_ fp_abs(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T567(_,__)_ fp_abs(fp_inv(fp_pow(vars[0],c.l2))) __
+#define  T913(_,__)_ fp_abs(fp_inv(fp_sin(vars[0]))) __
+#define  T957(_,__)_ fp_abs(fp_inv(fp_tan(vars[0]))) __
+#define T3467(_,__)_ fp_abs(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define  T954(_,__)_ fp_abs(fp_log(vars[0])) __
+#define T4064(_,__)_ fp_abs(fp_log(vars[0])) __
+#define  T955(_,__)_ fp_abs(fp_log10(vars[0])) __
+#define T4066(_,__)_ fp_abs(fp_log10(vars[0])) __
+#define  T953(_,__)_ fp_abs(fp_log2(vars[0])) __
+#define T4065(_,__)_ fp_abs(fp_log2(vars[0])) __
+#define T4068(_,__)_ fp_abs(fp_polar(vars[0],vars[1])) __
+#define T4067(_,__)_ fp_abs(fp_pow(vars[0],vars[1])) __
+#define  T958(_,__)_ fp_abs(fp_pow(vars[0],vars[1])) __
+#define  T962(_,__)_ fp_abs(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T959(_,__)_ fp_abs(fp_sin(vars[0])) __
+#define  T961(_,__)_ fp_abs(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T960(_,__)_ fp_abs(fp_sinh(vars[0])) __
+#define  T964(_,__)_ fp_abs(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4070(_,__)_ fp_abs(fp_sqrt(vars[0])) __
+#define  T963(_,__)_ fp_abs(fp_sqrt(vars[0])) __
+#define  T968(_,__)_ fp_abs(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4071(_,__)_ fp_abs(fp_tan(vars[0])) __
+#define  T965(_,__)_ fp_abs(fp_tan(vars[0])) __
+#define  T967(_,__)_ fp_abs(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4072(_,__)_ fp_abs(fp_tanh(vars[0])) __
+#define  T966(_,__)_ fp_abs(fp_tanh(vars[0])) __
+#define T1782(_,__)_ fp_abs(vars[0]) __
+#define T3654(_,__)_ fp_abs(vars[0])+fp_acos(vars[0])+fp_asin(vars[0])+fp_atan(vars[0])+fp_atan2(vars[0],vars[1])+fp_ceil(vars[0])+fp_cos(vars[0])+fp_cosh(vars[0])+fp_inv(fp_tan(vars[0]))+fp_inv(fp_sin(vars[0]))+fp_pow(vars[0],vars[1]) __
+#define T3011(_,__)_ fp_acos(-vars[0])+fp_acos(-vars[0]) __
+#define T5810(_,__)_ fp_acos(-vars[0])+fp_acos(-vars[0]) __
+#define T5811(_,__)_ fp_acos(-vars[0])+fp_acosh(-vars[0]) __
+#define T3012(_,__)_ fp_acos(-vars[0])+fp_asin(-vars[0]) __
+#define T5812(_,__)_ fp_acos(-vars[0])+fp_asinh(-vars[0]) __
+#define T3013(_,__)_ fp_acos(-vars[0])+fp_asinh(-vars[0]) __
+#define T3014(_,__)_ fp_acos(-vars[0])+fp_atan(-vars[0]) __
+#define T5813(_,__)_ fp_acos(-vars[0])+fp_atan(-vars[0]) __
+#define T3015(_,__)_ fp_acos(-vars[0])+fp_atanh(-vars[0]) __
+#define T5814(_,__)_ fp_acos(-vars[0])+fp_cos(-vars[0]) __
+#define T3016(_,__)_ fp_acos(-vars[0])+fp_cos(-vars[0]) __
+#define T3017(_,__)_ fp_acos(-vars[0])+fp_cosh(-vars[0]) __
+#define T5815(_,__)_ fp_acos(-vars[0])+fp_cosh(-vars[0]) __
+#define T3018(_,__)_ fp_acos(-vars[0])+fp_exp(-vars[0]) __
+#define T5816(_,__)_ fp_acos(-vars[0])+fp_exp(-vars[0]) __
+#define T3019(_,__)_ fp_acos(-vars[0])+fp_log(-vars[0]) __
+#define T5817(_,__)_ fp_acos(-vars[0])+fp_log(-vars[0]) __
+#define T5818(_,__)_ fp_acos(-vars[0])+fp_sin(-vars[0]) __
+#define T3020(_,__)_ fp_acos(-vars[0])+fp_sin(-vars[0]) __
+#define T3021(_,__)_ fp_acos(-vars[0])+fp_sinh(-vars[0]) __
+#define T5819(_,__)_ fp_acos(-vars[0])+fp_sinh(-vars[0]) __
+#define T3022(_,__)_ fp_acos(-vars[0])+fp_tan(-vars[0]) __
+#define T5820(_,__)_ fp_acos(-vars[0])+fp_tan(-vars[0]) __
+#define T5821(_,__)_ fp_acos(-vars[0])+fp_tanh(-vars[0]) __
+#define T3023(_,__)_ fp_acos(-vars[0])+fp_tanh(-vars[0]) __
+#define T4904(_,__)_ fp_acos(-vars[0])-fp_acos(-vars[0]) __
+#define T1869(_,__)_ fp_acos(-vars[0])-fp_acos(-vars[0]) __
+#define T2059(_,__)_ fp_acos(-vars[0])-fp_acos(vars[0]) __
+#define T5054(_,__)_ fp_acos(-vars[0])-fp_acos(vars[0]) __
+#define T4905(_,__)_ fp_acos(-vars[0])-fp_acosh(-vars[0]) __
+#define T5055(_,__)_ fp_acos(-vars[0])-fp_acosh(vars[0]) __
+#define T4906(_,__)_ fp_acos(-vars[0])-fp_asin(-vars[0]) __
+#define T1870(_,__)_ fp_acos(-vars[0])-fp_asin(-vars[0]) __
+#define T2060(_,__)_ fp_acos(-vars[0])-fp_asin(vars[0]) __
+#define T5056(_,__)_ fp_acos(-vars[0])-fp_asin(vars[0]) __
+#define T1871(_,__)_ fp_acos(-vars[0])-fp_asinh(-vars[0]) __
+#define T4907(_,__)_ fp_acos(-vars[0])-fp_asinh(-vars[0]) __
+#define T2061(_,__)_ fp_acos(-vars[0])-fp_asinh(vars[0]) __
+#define T5057(_,__)_ fp_acos(-vars[0])-fp_asinh(vars[0]) __
+#define T1872(_,__)_ fp_acos(-vars[0])-fp_atan(-vars[0]) __
+#define T4908(_,__)_ fp_acos(-vars[0])-fp_atan(-vars[0]) __
+#define T2062(_,__)_ fp_acos(-vars[0])-fp_atan(vars[0]) __
+#define T5058(_,__)_ fp_acos(-vars[0])-fp_atan(vars[0]) __
+#define T1873(_,__)_ fp_acos(-vars[0])-fp_atanh(-vars[0]) __
+#define T2063(_,__)_ fp_acos(-vars[0])-fp_atanh(vars[0]) __
+#define T4909(_,__)_ fp_acos(-vars[0])-fp_cos(-vars[0]) __
+#define T1874(_,__)_ fp_acos(-vars[0])-fp_cos(-vars[0]) __
+#define T2064(_,__)_ fp_acos(-vars[0])-fp_cos(vars[0]) __
+#define T5059(_,__)_ fp_acos(-vars[0])-fp_cos(vars[0]) __
+#define T4910(_,__)_ fp_acos(-vars[0])-fp_cosh(-vars[0]) __
+#define T1875(_,__)_ fp_acos(-vars[0])-fp_cosh(-vars[0]) __
+#define T2065(_,__)_ fp_acos(-vars[0])-fp_cosh(vars[0]) __
+#define T5060(_,__)_ fp_acos(-vars[0])-fp_cosh(vars[0]) __
+#define T1876(_,__)_ fp_acos(-vars[0])-fp_exp(-vars[0]) __
+#define T4911(_,__)_ fp_acos(-vars[0])-fp_exp(-vars[0]) __
+#define T2066(_,__)_ fp_acos(-vars[0])-fp_exp(vars[0]) __
+#define T5061(_,__)_ fp_acos(-vars[0])-fp_exp(vars[0]) __
+#define T1877(_,__)_ fp_acos(-vars[0])-fp_log(-vars[0]) __
+#define T4912(_,__)_ fp_acos(-vars[0])-fp_log(-vars[0]) __
+#define T5062(_,__)_ fp_acos(-vars[0])-fp_log(vars[0]) __
+#define T2067(_,__)_ fp_acos(-vars[0])-fp_log(vars[0]) __
+#define T4913(_,__)_ fp_acos(-vars[0])-fp_sin(-vars[0]) __
+#define T1878(_,__)_ fp_acos(-vars[0])-fp_sin(-vars[0]) __
+#define T5063(_,__)_ fp_acos(-vars[0])-fp_sin(vars[0]) __
+#define T2068(_,__)_ fp_acos(-vars[0])-fp_sin(vars[0]) __
+#define T1879(_,__)_ fp_acos(-vars[0])-fp_sinh(-vars[0]) __
+#define T4914(_,__)_ fp_acos(-vars[0])-fp_sinh(-vars[0]) __
+#define T5064(_,__)_ fp_acos(-vars[0])-fp_sinh(vars[0]) __
+#define T2069(_,__)_ fp_acos(-vars[0])-fp_sinh(vars[0]) __
+#define T1880(_,__)_ fp_acos(-vars[0])-fp_tan(-vars[0]) __
+#define T4915(_,__)_ fp_acos(-vars[0])-fp_tan(-vars[0]) __
+#define T2070(_,__)_ fp_acos(-vars[0])-fp_tan(vars[0]) __
+#define T5065(_,__)_ fp_acos(-vars[0])-fp_tan(vars[0]) __
+#define T1881(_,__)_ fp_acos(-vars[0])-fp_tanh(-vars[0]) __
+#define T4916(_,__)_ fp_acos(-vars[0])-fp_tanh(-vars[0]) __
+#define T5066(_,__)_ fp_acos(-vars[0])-fp_tanh(vars[0]) __
+#define T2071(_,__)_ fp_acos(-vars[0])-fp_tanh(vars[0]) __
+#define  T661(_,__)_ fp_acos(Value_t(fp_abs(vars[0]))) __
+#define T3822(_,__)_ fp_acos(Value_t(fp_abs(vars[0]))) __
+#define T3829(_,__)_ fp_acos(Value_t(fp_arg(vars[0]+c.l0_6))) __
+#define  T667(_,__)_ fp_acos(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T3835(_,__)_ fp_acos(Value_t(fp_imag(vars[0]))) __
+#define T3473(_,__)_ fp_acos(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3474(_,__)_ fp_acos(Value_t(fp_less(vars[0],vars[1]))*c.l0_1) __
+#define T3475(_,__)_ fp_acos(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.l0_2) __
+#define T3476(_,__)_ fp_acos(Value_t(fp_less(vars[0],vars[1]))+c.lm0_9) __
+#define T1771(_,__)_ fp_acos(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define  T679(_,__)_ fp_acos(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T3849(_,__)_ fp_acos(Value_t(fp_real(vars[0]))) __
+#define  T422(_,__)_ fp_acos(c.l0_7)+vars[0] __
+#define T3815(_,__)_ fp_acos(fp_acos(vars[0])) __
+#define  T650(_,__)_ fp_acos(fp_acos(vars[0]+c.l0_8)) __
+#define T3816(_,__)_ fp_acos(fp_acosh(vars[0])) __
+#define  T651(_,__)_ fp_acos(fp_acosh(vars[0]+c.l1_2)) __
+#define T3817(_,__)_ fp_acos(fp_asin(vars[0])) __
+#define  T652(_,__)_ fp_acos(fp_asin(vars[0])) __
+#define  T654(_,__)_ fp_acos(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3818(_,__)_ fp_acos(fp_asinh(vars[0])) __
+#define  T653(_,__)_ fp_acos(fp_asinh(vars[0])) __
+#define  T656(_,__)_ fp_acos(fp_atan((vars[0]+c.l0_4)/(vars[1]+c.l0_4))) __
+#define T3820(_,__)_ fp_acos(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T659(_,__)_ fp_acos(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T660(_,__)_ fp_acos(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T658(_,__)_ fp_acos(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T655(_,__)_ fp_acos(fp_atan(vars[0])) __
+#define T3819(_,__)_ fp_acos(fp_atan(vars[0])) __
+#define  T649(_,__)_ fp_acos(fp_atan2((vars[0]+c.l0_4),(vars[1]+c.l0_4))) __
+#define T3821(_,__)_ fp_acos(fp_atanh(vars[0])) __
+#define  T657(_,__)_ fp_acos(fp_atanh(vars[0])) __
+#define  T664(_,__)_ fp_acos(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3824(_,__)_ fp_acos(fp_cbrt(vars[0])) __
+#define  T663(_,__)_ fp_acos(fp_cbrt(vars[0])) __
+#define T3842(_,__)_ fp_acos(fp_conj(vars[0])) __
+#define  T665(_,__)_ fp_acos(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T662(_,__)_ fp_acos(fp_cos(vars[0])) __
+#define T3823(_,__)_ fp_acos(fp_cos(vars[0])) __
+#define T3825(_,__)_ fp_acos(fp_cosh(vars[0])) __
+#define T3828(_,__)_ fp_acos(fp_exp(vars[0])) __
+#define  T668(_,__)_ fp_acos(fp_exp(vars[0]+c.lm0_2)) __
+#define T3827(_,__)_ fp_acos(fp_exp2(vars[0])) __
+#define  T666(_,__)_ fp_acos(fp_exp2(vars[0]+c.lm0_2)) __
+#define T3830(_,__)_ fp_acos(fp_hypot((vars[0]+c.lm0_2),(vars[1]+c.lm0_2))) __
+#define T3831(_,__)_ fp_acos(fp_hypot(c.l1,vars[0])) __
+#define T3832(_,__)_ fp_acos(fp_hypot(c.l2,vars[0])) __
+#define T3833(_,__)_ fp_acos(fp_hypot(vars[0],c.l1)) __
+#define T3834(_,__)_ fp_acos(fp_hypot(vars[0],c.l2)) __
+#define  T669(_,__)_ fp_acos(fp_hypot(vars[0],vars[1])) __
+#define T3836(_,__)_ fp_acos(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T670(_,__)_ fp_acos(fp_inv(fp_atan2((vars[0]+c.lm0_2),(vars[1]+c.lm0_2)))) __
+#define T3826(_,__)_ fp_acos(fp_inv(fp_cos(vars[0]))) __
+#define  T671(_,__)_ fp_acos(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3838(_,__)_ fp_acos(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3839(_,__)_ fp_acos(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T672(_,__)_ fp_acos(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T674(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3840(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3841(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T675(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T673(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T3837(_,__)_ fp_acos(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T3814(_,__)_ fp_acos(fp_inv(fp_sin(vars[0]))) __
+#define T3846(_,__)_ fp_acos(fp_inv(fp_tan(vars[0]))) __
+#define  T680(_,__)_ fp_acos(fp_inv(fp_tan(vars[0]+c.l0_4))) __
+#define T3472(_,__)_ fp_acos(fp_less(vars[0],vars[1]) ? c.l0_1 : c.l1) __
+#define  T677(_,__)_ fp_acos(fp_log(vars[0])) __
+#define T3843(_,__)_ fp_acos(fp_log(vars[0])) __
+#define  T678(_,__)_ fp_acos(fp_log10(vars[0])) __
+#define T3845(_,__)_ fp_acos(fp_log10(vars[0])) __
+#define  T676(_,__)_ fp_acos(fp_log2(vars[0])) __
+#define T3844(_,__)_ fp_acos(fp_log2(vars[0])) __
+#define T3848(_,__)_ fp_acos(fp_polar(vars[0],vars[1])) __
+#define T3847(_,__)_ fp_acos(fp_pow(vars[0],vars[1])) __
+#define  T681(_,__)_ fp_acos(fp_pow(vars[0],vars[1])) __
+#define  T684(_,__)_ fp_acos(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T682(_,__)_ fp_acos(fp_sin(vars[0])) __
+#define T3850(_,__)_ fp_acos(fp_sinh(vars[0])) __
+#define  T683(_,__)_ fp_acos(fp_sinh(vars[0])) __
+#define  T686(_,__)_ fp_acos(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T685(_,__)_ fp_acos(fp_sqrt(vars[0])) __
+#define T3851(_,__)_ fp_acos(fp_sqrt(vars[0])) __
+#define T3852(_,__)_ fp_acos(fp_tan(vars[0])) __
+#define  T687(_,__)_ fp_acos(fp_tan(vars[0])) __
+#define  T689(_,__)_ fp_acos(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T688(_,__)_ fp_acos(fp_tanh(vars[0])) __
+#define T3853(_,__)_ fp_acos(fp_tanh(vars[0])) __
+#define T1769(_,__)_ fp_acos(vars[0]) __
+#define T4789(_,__)_ fp_acos(vars[0]) __
+#define T3113(_,__)_ fp_acos(vars[0])+fp_acos(-vars[0]) __
+#define T6033(_,__)_ fp_acos(vars[0])+fp_acos(vars[0]) __
+#define T3299(_,__)_ fp_acos(vars[0])+fp_acos(vars[0]) __
+#define T5888(_,__)_ fp_acos(vars[0])+fp_acosh(-vars[0]) __
+#define T6034(_,__)_ fp_acos(vars[0])+fp_acosh(vars[0]) __
+#define T5889(_,__)_ fp_acos(vars[0])+fp_asin(-vars[0]) __
+#define T3114(_,__)_ fp_acos(vars[0])+fp_asin(-vars[0]) __
+#define T3300(_,__)_ fp_acos(vars[0])+fp_asin(vars[0]) __
+#define T5890(_,__)_ fp_acos(vars[0])+fp_asinh(-vars[0]) __
+#define T3115(_,__)_ fp_acos(vars[0])+fp_asinh(-vars[0]) __
+#define T6035(_,__)_ fp_acos(vars[0])+fp_asinh(vars[0]) __
+#define T3301(_,__)_ fp_acos(vars[0])+fp_asinh(vars[0]) __
+#define T3116(_,__)_ fp_acos(vars[0])+fp_atan(-vars[0]) __
+#define T5891(_,__)_ fp_acos(vars[0])+fp_atan(-vars[0]) __
+#define T3302(_,__)_ fp_acos(vars[0])+fp_atan(vars[0]) __
+#define T6036(_,__)_ fp_acos(vars[0])+fp_atan(vars[0]) __
+#define T3117(_,__)_ fp_acos(vars[0])+fp_atanh(-vars[0]) __
+#define T3303(_,__)_ fp_acos(vars[0])+fp_atanh(vars[0]) __
+#define T5892(_,__)_ fp_acos(vars[0])+fp_cos(-vars[0]) __
+#define T3118(_,__)_ fp_acos(vars[0])+fp_cos(-vars[0]) __
+#define T6037(_,__)_ fp_acos(vars[0])+fp_cos(vars[0]) __
+#define T3304(_,__)_ fp_acos(vars[0])+fp_cos(vars[0]) __
+#define T5893(_,__)_ fp_acos(vars[0])+fp_cosh(-vars[0]) __
+#define T3119(_,__)_ fp_acos(vars[0])+fp_cosh(-vars[0]) __
+#define T6038(_,__)_ fp_acos(vars[0])+fp_cosh(vars[0]) __
+#define T3305(_,__)_ fp_acos(vars[0])+fp_cosh(vars[0]) __
+#define T5894(_,__)_ fp_acos(vars[0])+fp_exp(-vars[0]) __
+#define T3120(_,__)_ fp_acos(vars[0])+fp_exp(-vars[0]) __
+#define T6039(_,__)_ fp_acos(vars[0])+fp_exp(vars[0]) __
+#define T3306(_,__)_ fp_acos(vars[0])+fp_exp(vars[0]) __
+#define T3121(_,__)_ fp_acos(vars[0])+fp_log(-vars[0]) __
+#define T5895(_,__)_ fp_acos(vars[0])+fp_log(-vars[0]) __
+#define T6040(_,__)_ fp_acos(vars[0])+fp_log(vars[0]) __
+#define T3307(_,__)_ fp_acos(vars[0])+fp_log(vars[0]) __
+#define T5896(_,__)_ fp_acos(vars[0])+fp_sin(-vars[0]) __
+#define T3122(_,__)_ fp_acos(vars[0])+fp_sin(-vars[0]) __
+#define T6041(_,__)_ fp_acos(vars[0])+fp_sin(vars[0]) __
+#define T3308(_,__)_ fp_acos(vars[0])+fp_sin(vars[0]) __
+#define T3123(_,__)_ fp_acos(vars[0])+fp_sinh(-vars[0]) __
+#define T5897(_,__)_ fp_acos(vars[0])+fp_sinh(-vars[0]) __
+#define T6042(_,__)_ fp_acos(vars[0])+fp_sinh(vars[0]) __
+#define T3309(_,__)_ fp_acos(vars[0])+fp_sinh(vars[0]) __
+#define T3124(_,__)_ fp_acos(vars[0])+fp_tan(-vars[0]) __
+#define T5898(_,__)_ fp_acos(vars[0])+fp_tan(-vars[0]) __
+#define T6043(_,__)_ fp_acos(vars[0])+fp_tan(vars[0]) __
+#define T3310(_,__)_ fp_acos(vars[0])+fp_tan(vars[0]) __
+#define T5899(_,__)_ fp_acos(vars[0])+fp_tanh(-vars[0]) __
+#define T3125(_,__)_ fp_acos(vars[0])+fp_tanh(-vars[0]) __
+#define T6044(_,__)_ fp_acos(vars[0])+fp_tanh(vars[0]) __
+#define T3311(_,__)_ fp_acos(vars[0])+fp_tanh(vars[0]) __
+#define T5205(_,__)_ fp_acos(vars[0])-fp_acos(-vars[0]) __
+#define T2245(_,__)_ fp_acos(vars[0])-fp_acos(-vars[0]) __
+#define T5356(_,__)_ fp_acos(vars[0])-fp_acos(vars[0]) __
+#define T2431(_,__)_ fp_acos(vars[0])-fp_acos(vars[0]) __
+#define T5206(_,__)_ fp_acos(vars[0])-fp_acosh(-vars[0]) __
+#define T5357(_,__)_ fp_acos(vars[0])-fp_acosh(vars[0]) __
+#define T5207(_,__)_ fp_acos(vars[0])-fp_asin(-vars[0]) __
+#define T2246(_,__)_ fp_acos(vars[0])-fp_asin(-vars[0]) __
+#define T2432(_,__)_ fp_acos(vars[0])-fp_asin(vars[0]) __
+#define T5358(_,__)_ fp_acos(vars[0])-fp_asin(vars[0]) __
+#define T5208(_,__)_ fp_acos(vars[0])-fp_asinh(-vars[0]) __
+#define T2247(_,__)_ fp_acos(vars[0])-fp_asinh(-vars[0]) __
+#define T2433(_,__)_ fp_acos(vars[0])-fp_asinh(vars[0]) __
+#define T5359(_,__)_ fp_acos(vars[0])-fp_asinh(vars[0]) __
+#define T2248(_,__)_ fp_acos(vars[0])-fp_atan(-vars[0]) __
+#define T5209(_,__)_ fp_acos(vars[0])-fp_atan(-vars[0]) __
+#define T2434(_,__)_ fp_acos(vars[0])-fp_atan(vars[0]) __
+#define T5360(_,__)_ fp_acos(vars[0])-fp_atan(vars[0]) __
+#define T2249(_,__)_ fp_acos(vars[0])-fp_atanh(-vars[0]) __
+#define T2435(_,__)_ fp_acos(vars[0])-fp_atanh(vars[0]) __
+#define T5210(_,__)_ fp_acos(vars[0])-fp_cos(-vars[0]) __
+#define T2250(_,__)_ fp_acos(vars[0])-fp_cos(-vars[0]) __
+#define T5361(_,__)_ fp_acos(vars[0])-fp_cos(vars[0]) __
+#define T2436(_,__)_ fp_acos(vars[0])-fp_cos(vars[0]) __
+#define T2251(_,__)_ fp_acos(vars[0])-fp_cosh(-vars[0]) __
+#define T5211(_,__)_ fp_acos(vars[0])-fp_cosh(-vars[0]) __
+#define T2437(_,__)_ fp_acos(vars[0])-fp_cosh(vars[0]) __
+#define T5362(_,__)_ fp_acos(vars[0])-fp_cosh(vars[0]) __
+#define T2252(_,__)_ fp_acos(vars[0])-fp_exp(-vars[0]) __
+#define T5212(_,__)_ fp_acos(vars[0])-fp_exp(-vars[0]) __
+#define T2438(_,__)_ fp_acos(vars[0])-fp_exp(vars[0]) __
+#define T5363(_,__)_ fp_acos(vars[0])-fp_exp(vars[0]) __
+#define T2253(_,__)_ fp_acos(vars[0])-fp_log(-vars[0]) __
+#define T5213(_,__)_ fp_acos(vars[0])-fp_log(-vars[0]) __
+#define T2439(_,__)_ fp_acos(vars[0])-fp_log(vars[0]) __
+#define T5364(_,__)_ fp_acos(vars[0])-fp_log(vars[0]) __
+#define T5214(_,__)_ fp_acos(vars[0])-fp_sin(-vars[0]) __
+#define T2254(_,__)_ fp_acos(vars[0])-fp_sin(-vars[0]) __
+#define T2440(_,__)_ fp_acos(vars[0])-fp_sin(vars[0]) __
+#define T5365(_,__)_ fp_acos(vars[0])-fp_sin(vars[0]) __
+#define T2255(_,__)_ fp_acos(vars[0])-fp_sinh(-vars[0]) __
+#define T5215(_,__)_ fp_acos(vars[0])-fp_sinh(-vars[0]) __
+#define T5366(_,__)_ fp_acos(vars[0])-fp_sinh(vars[0]) __
+#define T2441(_,__)_ fp_acos(vars[0])-fp_sinh(vars[0]) __
+#define T5216(_,__)_ fp_acos(vars[0])-fp_tan(-vars[0]) __
+#define T2256(_,__)_ fp_acos(vars[0])-fp_tan(-vars[0]) __
+#define T5367(_,__)_ fp_acos(vars[0])-fp_tan(vars[0]) __
+#define T2442(_,__)_ fp_acos(vars[0])-fp_tan(vars[0]) __
+#define T2257(_,__)_ fp_acos(vars[0])-fp_tanh(-vars[0]) __
+#define T5217(_,__)_ fp_acos(vars[0])-fp_tanh(-vars[0]) __
+#define T2443(_,__)_ fp_acos(vars[0])-fp_tanh(vars[0]) __
+#define T5368(_,__)_ fp_acos(vars[0])-fp_tanh(vars[0]) __
+#define T4821(_,__)_ fp_acos(vars[0]*(c.l1*c.i)) __
+#define T4823(_,__)_ fp_acos(vars[0]*(c.l3*c.i)) __
+#define T4827(_,__)_ fp_acos(vars[0]*-(c.l1*c.i)) __
+#define T4826(_,__)_ fp_acos(vars[0]*-(c.l3*c.i)) __
+#define T1824(_,__)_ fp_acos(vars[0]*c.l2) __
+#define T4822(_,__)_ fp_acos(vars[0]*c.l2) __
+#define T1825(_,__)_ fp_acos(vars[0]*c.lm1) __
+#define T4824(_,__)_ fp_acos(vars[0]*c.lm1) __
+#define T4825(_,__)_ fp_acos(vars[0]*c.lm2) __
+#define T1826(_,__)_ fp_acos(vars[0]*c.lm2) __
+#define T5822(_,__)_ fp_acosh(-vars[0])+fp_acosh(-vars[0]) __
+#define T3024(_,__)_ fp_acosh(-vars[0])+fp_acosh(-vars[0]) __
+#define T5823(_,__)_ fp_acosh(-vars[0])+fp_asin(-vars[0]) __
+#define T3025(_,__)_ fp_acosh(-vars[0])+fp_asinh(-vars[0]) __
+#define T5824(_,__)_ fp_acosh(-vars[0])+fp_asinh(-vars[0]) __
+#define T5825(_,__)_ fp_acosh(-vars[0])+fp_atan(-vars[0]) __
+#define T3026(_,__)_ fp_acosh(-vars[0])+fp_atan(-vars[0]) __
+#define T5826(_,__)_ fp_acosh(-vars[0])+fp_atanh(-vars[0]) __
+#define T5827(_,__)_ fp_acosh(-vars[0])+fp_cos(-vars[0]) __
+#define T3027(_,__)_ fp_acosh(-vars[0])+fp_cos(-vars[0]) __
+#define T3028(_,__)_ fp_acosh(-vars[0])+fp_cosh(-vars[0]) __
+#define T5828(_,__)_ fp_acosh(-vars[0])+fp_cosh(-vars[0]) __
+#define T5829(_,__)_ fp_acosh(-vars[0])+fp_exp(-vars[0]) __
+#define T3029(_,__)_ fp_acosh(-vars[0])+fp_exp(-vars[0]) __
+#define T3030(_,__)_ fp_acosh(-vars[0])+fp_log(-vars[0]) __
+#define T5830(_,__)_ fp_acosh(-vars[0])+fp_log(-vars[0]) __
+#define T3031(_,__)_ fp_acosh(-vars[0])+fp_sin(-vars[0]) __
+#define T5831(_,__)_ fp_acosh(-vars[0])+fp_sin(-vars[0]) __
+#define T5832(_,__)_ fp_acosh(-vars[0])+fp_sinh(-vars[0]) __
+#define T3032(_,__)_ fp_acosh(-vars[0])+fp_sinh(-vars[0]) __
+#define T3033(_,__)_ fp_acosh(-vars[0])+fp_tan(-vars[0]) __
+#define T5833(_,__)_ fp_acosh(-vars[0])+fp_tan(-vars[0]) __
+#define T3034(_,__)_ fp_acosh(-vars[0])+fp_tanh(-vars[0]) __
+#define T5834(_,__)_ fp_acosh(-vars[0])+fp_tanh(-vars[0]) __
+#define T4917(_,__)_ fp_acosh(-vars[0])-fp_acos(-vars[0]) __
+#define T5067(_,__)_ fp_acosh(-vars[0])-fp_acos(vars[0]) __
+#define T1882(_,__)_ fp_acosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T4918(_,__)_ fp_acosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5068(_,__)_ fp_acosh(-vars[0])-fp_acosh(vars[0]) __
+#define T4919(_,__)_ fp_acosh(-vars[0])-fp_asin(-vars[0]) __
+#define T5069(_,__)_ fp_acosh(-vars[0])-fp_asin(vars[0]) __
+#define T4920(_,__)_ fp_acosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T1883(_,__)_ fp_acosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5070(_,__)_ fp_acosh(-vars[0])-fp_asinh(vars[0]) __
+#define T2072(_,__)_ fp_acosh(-vars[0])-fp_asinh(vars[0]) __
+#define T4921(_,__)_ fp_acosh(-vars[0])-fp_atan(-vars[0]) __
+#define T1884(_,__)_ fp_acosh(-vars[0])-fp_atan(-vars[0]) __
+#define T5071(_,__)_ fp_acosh(-vars[0])-fp_atan(vars[0]) __
+#define T2073(_,__)_ fp_acosh(-vars[0])-fp_atan(vars[0]) __
+#define T4922(_,__)_ fp_acosh(-vars[0])-fp_atanh(-vars[0]) __
+#define T5072(_,__)_ fp_acosh(-vars[0])-fp_atanh(vars[0]) __
+#define T1885(_,__)_ fp_acosh(-vars[0])-fp_cos(-vars[0]) __
+#define T4923(_,__)_ fp_acosh(-vars[0])-fp_cos(-vars[0]) __
+#define T2074(_,__)_ fp_acosh(-vars[0])-fp_cos(vars[0]) __
+#define T5073(_,__)_ fp_acosh(-vars[0])-fp_cos(vars[0]) __
+#define T1886(_,__)_ fp_acosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T4924(_,__)_ fp_acosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T5074(_,__)_ fp_acosh(-vars[0])-fp_cosh(vars[0]) __
+#define T2075(_,__)_ fp_acosh(-vars[0])-fp_cosh(vars[0]) __
+#define T4925(_,__)_ fp_acosh(-vars[0])-fp_exp(-vars[0]) __
+#define T1887(_,__)_ fp_acosh(-vars[0])-fp_exp(-vars[0]) __
+#define T5075(_,__)_ fp_acosh(-vars[0])-fp_exp(vars[0]) __
+#define T2076(_,__)_ fp_acosh(-vars[0])-fp_exp(vars[0]) __
+#define T4926(_,__)_ fp_acosh(-vars[0])-fp_log(-vars[0]) __
+#define T1888(_,__)_ fp_acosh(-vars[0])-fp_log(-vars[0]) __
+#define T5076(_,__)_ fp_acosh(-vars[0])-fp_log(vars[0]) __
+#define T1889(_,__)_ fp_acosh(-vars[0])-fp_sin(-vars[0]) __
+#define T4927(_,__)_ fp_acosh(-vars[0])-fp_sin(-vars[0]) __
+#define T2077(_,__)_ fp_acosh(-vars[0])-fp_sin(vars[0]) __
+#define T5077(_,__)_ fp_acosh(-vars[0])-fp_sin(vars[0]) __
+#define T4928(_,__)_ fp_acosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T1890(_,__)_ fp_acosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5078(_,__)_ fp_acosh(-vars[0])-fp_sinh(vars[0]) __
+#define T2078(_,__)_ fp_acosh(-vars[0])-fp_sinh(vars[0]) __
+#define T4929(_,__)_ fp_acosh(-vars[0])-fp_tan(-vars[0]) __
+#define T1891(_,__)_ fp_acosh(-vars[0])-fp_tan(-vars[0]) __
+#define T2079(_,__)_ fp_acosh(-vars[0])-fp_tan(vars[0]) __
+#define T5079(_,__)_ fp_acosh(-vars[0])-fp_tan(vars[0]) __
+#define T1892(_,__)_ fp_acosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T4930(_,__)_ fp_acosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5080(_,__)_ fp_acosh(-vars[0])-fp_tanh(vars[0]) __
+#define T2080(_,__)_ fp_acosh(-vars[0])-fp_tanh(vars[0]) __
+#define  T696(_,__)_ fp_acosh(Value_t(fp_abs(vars[0]))) __
+#define T3867(_,__)_ fp_acosh(Value_t(fp_arg(vars[0]+c.lm0_6))) __
+#define T3478(_,__)_ fp_acosh(Value_t(fp_less(vars[0],vars[1]))+c.l1_4) __
+#define T3885(_,__)_ fp_acosh(Value_t(fp_real(vars[0]+c.l0_6))) __
+#define  T424(_,__)_ fp_acosh(c.l1_1)+vars[0] __
+#define T3855(_,__)_ fp_acosh(fp_acos(vars[0])) __
+#define  T691(_,__)_ fp_acosh(fp_acos(vars[0])) __
+#define T3856(_,__)_ fp_acosh(fp_acosh(vars[0])) __
+#define  T692(_,__)_ fp_acosh(fp_acosh(vars[0]+c.l1_2)) __
+#define T3857(_,__)_ fp_acosh(fp_asin(vars[0])) __
+#define T3858(_,__)_ fp_acosh(fp_asinh(vars[0])) __
+#define  T693(_,__)_ fp_acosh(fp_asinh(vars[0]+c.l0_8)) __
+#define  T695(_,__)_ fp_acosh(fp_atan(Value_t(fp_abs(vars[0]+c.l1_2)))) __
+#define T3859(_,__)_ fp_acosh(fp_atan(vars[0])) __
+#define  T694(_,__)_ fp_acosh(fp_atan(vars[0]+c.l1_2)) __
+#define T3860(_,__)_ fp_acosh(fp_atanh(vars[0])) __
+#define T3862(_,__)_ fp_acosh(fp_cbrt(vars[0])) __
+#define  T697(_,__)_ fp_acosh(fp_cbrt(vars[0]+c.l0_6)) __
+#define T3878(_,__)_ fp_acosh(fp_conj(vars[0])) __
+#define T3861(_,__)_ fp_acosh(fp_cos(vars[0])) __
+#define  T699(_,__)_ fp_acosh(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T698(_,__)_ fp_acosh(fp_cosh(vars[0])) __
+#define T3863(_,__)_ fp_acosh(fp_cosh(vars[0])) __
+#define  T705(_,__)_ fp_acosh(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T704(_,__)_ fp_acosh(fp_exp(vars[0])) __
+#define T3866(_,__)_ fp_acosh(fp_exp(vars[0])) __
+#define  T701(_,__)_ fp_acosh(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T700(_,__)_ fp_acosh(fp_exp2(vars[0])) __
+#define T3865(_,__)_ fp_acosh(fp_exp2(vars[0])) __
+#define T3868(_,__)_ fp_acosh(fp_hypot((vars[0]+c.lm0_2),(vars[1]+c.lm0_2))) __
+#define T3869(_,__)_ fp_acosh(fp_hypot(c.l1,vars[0])) __
+#define  T706(_,__)_ fp_acosh(fp_hypot(c.l1,vars[0])) __
+#define  T707(_,__)_ fp_acosh(fp_hypot(c.l2,vars[0])) __
+#define T3870(_,__)_ fp_acosh(fp_hypot(c.l2,vars[0])) __
+#define  T709(_,__)_ fp_acosh(fp_hypot(vars[0],c.l1)) __
+#define T3871(_,__)_ fp_acosh(fp_hypot(vars[0],c.l1)) __
+#define T3872(_,__)_ fp_acosh(fp_hypot(vars[0],c.l2)) __
+#define  T710(_,__)_ fp_acosh(fp_hypot(vars[0],c.l2)) __
+#define  T708(_,__)_ fp_acosh(fp_hypot(vars[0],vars[1])) __
+#define  T712(_,__)_ fp_acosh(fp_inv(fp_atan((vars[0]+c.l0_4)/(vars[1]+c.l0_4)))) __
+#define  T711(_,__)_ fp_acosh(fp_inv(fp_atan2((vars[0]+c.l0_4),(vars[1]+c.l0_4)))) __
+#define  T703(_,__)_ fp_acosh(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T702(_,__)_ fp_acosh(fp_inv(fp_cos(vars[0]))) __
+#define T3864(_,__)_ fp_acosh(fp_inv(fp_cos(vars[0]))) __
+#define  T713(_,__)_ fp_acosh(fp_inv(fp_hypot((vars[0]+c.lm0_2),(vars[1]+c.lm0_2)))) __
+#define T3874(_,__)_ fp_acosh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3875(_,__)_ fp_acosh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T3876(_,__)_ fp_acosh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3877(_,__)_ fp_acosh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T3873(_,__)_ fp_acosh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T690(_,__)_ fp_acosh(fp_inv(fp_sin(vars[0]))) __
+#define T3854(_,__)_ fp_acosh(fp_inv(fp_sin(vars[0]))) __
+#define  T716(_,__)_ fp_acosh(fp_inv(fp_tan(vars[0]))) __
+#define T3882(_,__)_ fp_acosh(fp_inv(fp_tan(vars[0]))) __
+#define T3477(_,__)_ fp_acosh(fp_less(vars[0],vars[1]) ? c.l1 : c.l1_4) __
+#define T3879(_,__)_ fp_acosh(fp_log(vars[0])) __
+#define  T715(_,__)_ fp_acosh(fp_log(vars[0]+c.l2_4)) __
+#define T3881(_,__)_ fp_acosh(fp_log10(vars[0])) __
+#define T3880(_,__)_ fp_acosh(fp_log2(vars[0])) __
+#define  T714(_,__)_ fp_acosh(fp_log2(vars[0]+c.l1_6)) __
+#define T3884(_,__)_ fp_acosh(fp_polar(vars[0],vars[1])) __
+#define  T717(_,__)_ fp_acosh(fp_pow((vars[0]+c.l0_6),(vars[1]+c.l0_6))) __
+#define T3883(_,__)_ fp_acosh(fp_pow(vars[0],vars[1])) __
+#define T3886(_,__)_ fp_acosh(fp_sin(vars[0])) __
+#define T3887(_,__)_ fp_acosh(fp_sinh(vars[0])) __
+#define  T718(_,__)_ fp_acosh(fp_sinh(vars[0]+c.l0_4)) __
+#define T3888(_,__)_ fp_acosh(fp_sqrt(vars[0])) __
+#define  T719(_,__)_ fp_acosh(fp_sqrt(vars[0]+c.l0_6)) __
+#define T3889(_,__)_ fp_acosh(fp_tan(vars[0])) __
+#define  T720(_,__)_ fp_acosh(fp_tan(vars[0]+c.l0_4)) __
+#define T3890(_,__)_ fp_acosh(fp_tanh(vars[0])) __
+#define T4790(_,__)_ fp_acosh(vars[0]) __
+#define T5900(_,__)_ fp_acosh(vars[0])+fp_acos(-vars[0]) __
+#define T6045(_,__)_ fp_acosh(vars[0])+fp_acosh(vars[0]) __
+#define T3312(_,__)_ fp_acosh(vars[0])+fp_acosh(vars[0]) __
+#define T5901(_,__)_ fp_acosh(vars[0])+fp_asin(-vars[0]) __
+#define T6046(_,__)_ fp_acosh(vars[0])+fp_asin(vars[0]) __
+#define T3126(_,__)_ fp_acosh(vars[0])+fp_asinh(-vars[0]) __
+#define T6047(_,__)_ fp_acosh(vars[0])+fp_asinh(vars[0]) __
+#define T3313(_,__)_ fp_acosh(vars[0])+fp_asinh(vars[0]) __
+#define T5902(_,__)_ fp_acosh(vars[0])+fp_atan(-vars[0]) __
+#define T3127(_,__)_ fp_acosh(vars[0])+fp_atan(-vars[0]) __
+#define T6048(_,__)_ fp_acosh(vars[0])+fp_atan(vars[0]) __
+#define T3314(_,__)_ fp_acosh(vars[0])+fp_atan(vars[0]) __
+#define T5903(_,__)_ fp_acosh(vars[0])+fp_atanh(-vars[0]) __
+#define T6049(_,__)_ fp_acosh(vars[0])+fp_atanh(vars[0]) __
+#define T5904(_,__)_ fp_acosh(vars[0])+fp_cos(-vars[0]) __
+#define T3128(_,__)_ fp_acosh(vars[0])+fp_cos(-vars[0]) __
+#define T6050(_,__)_ fp_acosh(vars[0])+fp_cos(vars[0]) __
+#define T3315(_,__)_ fp_acosh(vars[0])+fp_cos(vars[0]) __
+#define T3129(_,__)_ fp_acosh(vars[0])+fp_cosh(-vars[0]) __
+#define T5905(_,__)_ fp_acosh(vars[0])+fp_cosh(-vars[0]) __
+#define T3316(_,__)_ fp_acosh(vars[0])+fp_cosh(vars[0]) __
+#define T6051(_,__)_ fp_acosh(vars[0])+fp_cosh(vars[0]) __
+#define T5906(_,__)_ fp_acosh(vars[0])+fp_exp(-vars[0]) __
+#define T3130(_,__)_ fp_acosh(vars[0])+fp_exp(-vars[0]) __
+#define T3317(_,__)_ fp_acosh(vars[0])+fp_exp(vars[0]) __
+#define T6052(_,__)_ fp_acosh(vars[0])+fp_exp(vars[0]) __
+#define T5907(_,__)_ fp_acosh(vars[0])+fp_log(-vars[0]) __
+#define T6053(_,__)_ fp_acosh(vars[0])+fp_log(vars[0]) __
+#define T3318(_,__)_ fp_acosh(vars[0])+fp_log(vars[0]) __
+#define T3131(_,__)_ fp_acosh(vars[0])+fp_sin(-vars[0]) __
+#define T5908(_,__)_ fp_acosh(vars[0])+fp_sin(-vars[0]) __
+#define T3319(_,__)_ fp_acosh(vars[0])+fp_sin(vars[0]) __
+#define T6054(_,__)_ fp_acosh(vars[0])+fp_sin(vars[0]) __
+#define T5909(_,__)_ fp_acosh(vars[0])+fp_sinh(-vars[0]) __
+#define T3132(_,__)_ fp_acosh(vars[0])+fp_sinh(-vars[0]) __
+#define T6055(_,__)_ fp_acosh(vars[0])+fp_sinh(vars[0]) __
+#define T3320(_,__)_ fp_acosh(vars[0])+fp_sinh(vars[0]) __
+#define T5910(_,__)_ fp_acosh(vars[0])+fp_tan(-vars[0]) __
+#define T3133(_,__)_ fp_acosh(vars[0])+fp_tan(-vars[0]) __
+#define T6056(_,__)_ fp_acosh(vars[0])+fp_tan(vars[0]) __
+#define T3321(_,__)_ fp_acosh(vars[0])+fp_tan(vars[0]) __
+#define T3134(_,__)_ fp_acosh(vars[0])+fp_tanh(-vars[0]) __
+#define T5911(_,__)_ fp_acosh(vars[0])+fp_tanh(-vars[0]) __
+#define T6057(_,__)_ fp_acosh(vars[0])+fp_tanh(vars[0]) __
+#define T3322(_,__)_ fp_acosh(vars[0])+fp_tanh(vars[0]) __
+#define T5218(_,__)_ fp_acosh(vars[0])-fp_acos(-vars[0]) __
+#define T5369(_,__)_ fp_acosh(vars[0])-fp_acos(vars[0]) __
+#define T5219(_,__)_ fp_acosh(vars[0])-fp_acosh(-vars[0]) __
+#define T2444(_,__)_ fp_acosh(vars[0])-fp_acosh(vars[0]) __
+#define T5370(_,__)_ fp_acosh(vars[0])-fp_acosh(vars[0]) __
+#define T5220(_,__)_ fp_acosh(vars[0])-fp_asin(-vars[0]) __
+#define T5371(_,__)_ fp_acosh(vars[0])-fp_asin(vars[0]) __
+#define T2258(_,__)_ fp_acosh(vars[0])-fp_asinh(-vars[0]) __
+#define T5221(_,__)_ fp_acosh(vars[0])-fp_asinh(-vars[0]) __
+#define T2445(_,__)_ fp_acosh(vars[0])-fp_asinh(vars[0]) __
+#define T5372(_,__)_ fp_acosh(vars[0])-fp_asinh(vars[0]) __
+#define T2259(_,__)_ fp_acosh(vars[0])-fp_atan(-vars[0]) __
+#define T5222(_,__)_ fp_acosh(vars[0])-fp_atan(-vars[0]) __
+#define T5373(_,__)_ fp_acosh(vars[0])-fp_atan(vars[0]) __
+#define T2446(_,__)_ fp_acosh(vars[0])-fp_atan(vars[0]) __
+#define T5223(_,__)_ fp_acosh(vars[0])-fp_atanh(-vars[0]) __
+#define T5374(_,__)_ fp_acosh(vars[0])-fp_atanh(vars[0]) __
+#define T2260(_,__)_ fp_acosh(vars[0])-fp_cos(-vars[0]) __
+#define T5224(_,__)_ fp_acosh(vars[0])-fp_cos(-vars[0]) __
+#define T5375(_,__)_ fp_acosh(vars[0])-fp_cos(vars[0]) __
+#define T2447(_,__)_ fp_acosh(vars[0])-fp_cos(vars[0]) __
+#define T5225(_,__)_ fp_acosh(vars[0])-fp_cosh(-vars[0]) __
+#define T2261(_,__)_ fp_acosh(vars[0])-fp_cosh(-vars[0]) __
+#define T5376(_,__)_ fp_acosh(vars[0])-fp_cosh(vars[0]) __
+#define T2448(_,__)_ fp_acosh(vars[0])-fp_cosh(vars[0]) __
+#define T2262(_,__)_ fp_acosh(vars[0])-fp_exp(-vars[0]) __
+#define T5226(_,__)_ fp_acosh(vars[0])-fp_exp(-vars[0]) __
+#define T2449(_,__)_ fp_acosh(vars[0])-fp_exp(vars[0]) __
+#define T5377(_,__)_ fp_acosh(vars[0])-fp_exp(vars[0]) __
+#define T5227(_,__)_ fp_acosh(vars[0])-fp_log(-vars[0]) __
+#define T2450(_,__)_ fp_acosh(vars[0])-fp_log(vars[0]) __
+#define T5378(_,__)_ fp_acosh(vars[0])-fp_log(vars[0]) __
+#define T2263(_,__)_ fp_acosh(vars[0])-fp_sin(-vars[0]) __
+#define T5228(_,__)_ fp_acosh(vars[0])-fp_sin(-vars[0]) __
+#define T5379(_,__)_ fp_acosh(vars[0])-fp_sin(vars[0]) __
+#define T2451(_,__)_ fp_acosh(vars[0])-fp_sin(vars[0]) __
+#define T2264(_,__)_ fp_acosh(vars[0])-fp_sinh(-vars[0]) __
+#define T5229(_,__)_ fp_acosh(vars[0])-fp_sinh(-vars[0]) __
+#define T2452(_,__)_ fp_acosh(vars[0])-fp_sinh(vars[0]) __
+#define T5380(_,__)_ fp_acosh(vars[0])-fp_sinh(vars[0]) __
+#define T2265(_,__)_ fp_acosh(vars[0])-fp_tan(-vars[0]) __
+#define T5230(_,__)_ fp_acosh(vars[0])-fp_tan(-vars[0]) __
+#define T5381(_,__)_ fp_acosh(vars[0])-fp_tan(vars[0]) __
+#define T2453(_,__)_ fp_acosh(vars[0])-fp_tan(vars[0]) __
+#define T2266(_,__)_ fp_acosh(vars[0])-fp_tanh(-vars[0]) __
+#define T5231(_,__)_ fp_acosh(vars[0])-fp_tanh(-vars[0]) __
+#define T2454(_,__)_ fp_acosh(vars[0])-fp_tanh(vars[0]) __
+#define T5382(_,__)_ fp_acosh(vars[0])-fp_tanh(vars[0]) __
+#define T4828(_,__)_ fp_acosh(vars[0]*(c.l1*c.i)) __
+#define T4830(_,__)_ fp_acosh(vars[0]*(c.l3*c.i)) __
+#define T4834(_,__)_ fp_acosh(vars[0]*-(c.l1*c.i)) __
+#define T4833(_,__)_ fp_acosh(vars[0]*-(c.l3*c.i)) __
+#define T1827(_,__)_ fp_acosh(vars[0]*c.l2) __
+#define T4829(_,__)_ fp_acosh(vars[0]*c.l2) __
+#define T1828(_,__)_ fp_acosh(vars[0]*c.lm1) __
+#define T4831(_,__)_ fp_acosh(vars[0]*c.lm1) __
+#define T4832(_,__)_ fp_acosh(vars[0]*c.lm2) __
+#define T1829(_,__)_ fp_acosh(vars[0]*c.lm2) __
+#define T1770(_,__)_ fp_acosh(vars[0]+c.l0_6) __
+#define T3582(_,__)_ fp_and((fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1)),(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1))) __
+#define  T277(_,__)_ fp_and((vars[0]*Value_t(fp_abs(vars[1]))),(vars[1]+c.l2)) __
+#define  T278(_,__)_ fp_and((vars[0]*vars[1]*c.lm5),(vars[1]+c.l2)) __
+#define  T276(_,__)_ fp_and((vars[0]+c.l2),Value_t(fp_abs(vars[0])))&&fp_truth(vars[1]+c.l2) __
+#define T4276(_,__)_ fp_arg(Value_t(fp_abs(vars[0]))) __
+#define T4288(_,__)_ fp_arg(Value_t(fp_arg(vars[0]))) __
+#define T4294(_,__)_ fp_arg(Value_t(fp_imag(vars[0]))) __
+#define T4308(_,__)_ fp_arg(Value_t(fp_real(vars[0]))) __
+#define T4268(_,__)_ fp_arg(fp_acos(vars[0])) __
+#define T4269(_,__)_ fp_arg(fp_acosh(vars[0])) __
+#define T4270(_,__)_ fp_arg(fp_asin(vars[0])) __
+#define T4271(_,__)_ fp_arg(fp_asinh(vars[0])) __
+#define T4273(_,__)_ fp_arg(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4275(_,__)_ fp_arg(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T4272(_,__)_ fp_arg(fp_atan(vars[0])) __
+#define T4274(_,__)_ fp_arg(fp_atanh(vars[0])) __
+#define T4278(_,__)_ fp_arg(fp_cbrt(vars[0])) __
+#define T4301(_,__)_ fp_arg(fp_conj(vars[0])) __
+#define T4281(_,__)_ fp_arg(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4277(_,__)_ fp_arg(fp_cos(vars[0])) __
+#define T4280(_,__)_ fp_arg(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4279(_,__)_ fp_arg(fp_cosh(vars[0])) __
+#define T4287(_,__)_ fp_arg(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4286(_,__)_ fp_arg(fp_exp(vars[0])) __
+#define T4284(_,__)_ fp_arg(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4283(_,__)_ fp_arg(fp_exp2(vars[0])) __
+#define T4290(_,__)_ fp_arg(fp_hypot(c.l1,vars[0])) __
+#define T4291(_,__)_ fp_arg(fp_hypot(c.l2,vars[0])) __
+#define T4292(_,__)_ fp_arg(fp_hypot(vars[0],c.l1)) __
+#define T4293(_,__)_ fp_arg(fp_hypot(vars[0],c.l2)) __
+#define T4289(_,__)_ fp_arg(fp_hypot(vars[0],vars[1])) __
+#define T4295(_,__)_ fp_arg(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T4285(_,__)_ fp_arg(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4282(_,__)_ fp_arg(fp_inv(fp_cos(vars[0]))) __
+#define T4297(_,__)_ fp_arg(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4298(_,__)_ fp_arg(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4299(_,__)_ fp_arg(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4300(_,__)_ fp_arg(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4296(_,__)_ fp_arg(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4267(_,__)_ fp_arg(fp_inv(fp_sin(vars[0]))) __
+#define T4305(_,__)_ fp_arg(fp_inv(fp_tan(vars[0]))) __
+#define T4302(_,__)_ fp_arg(fp_log(vars[0])) __
+#define T4304(_,__)_ fp_arg(fp_log10(vars[0])) __
+#define T4303(_,__)_ fp_arg(fp_log2(vars[0])) __
+#define T4307(_,__)_ fp_arg(fp_polar(vars[0],vars[1])) __
+#define T4306(_,__)_ fp_arg(fp_pow(vars[0],vars[1])) __
+#define T4309(_,__)_ fp_arg(fp_sin(vars[0])) __
+#define T4310(_,__)_ fp_arg(fp_sinh(vars[0])) __
+#define T4311(_,__)_ fp_arg(fp_sqrt(vars[0])) __
+#define T4312(_,__)_ fp_arg(fp_tan(vars[0])) __
+#define T4313(_,__)_ fp_arg(fp_tanh(vars[0])) __
+#define T4798(_,__)_ fp_arg(vars[0]) __
+#define T5835(_,__)_ fp_asin(-vars[0])+fp_asin(-vars[0]) __
+#define T3035(_,__)_ fp_asin(-vars[0])+fp_asin(-vars[0]) __
+#define T3036(_,__)_ fp_asin(-vars[0])+fp_asinh(-vars[0]) __
+#define T5836(_,__)_ fp_asin(-vars[0])+fp_asinh(-vars[0]) __
+#define T3037(_,__)_ fp_asin(-vars[0])+fp_atan(-vars[0]) __
+#define T5837(_,__)_ fp_asin(-vars[0])+fp_atan(-vars[0]) __
+#define T3038(_,__)_ fp_asin(-vars[0])+fp_atanh(-vars[0]) __
+#define T5838(_,__)_ fp_asin(-vars[0])+fp_cos(-vars[0]) __
+#define T3039(_,__)_ fp_asin(-vars[0])+fp_cos(-vars[0]) __
+#define T3040(_,__)_ fp_asin(-vars[0])+fp_cosh(-vars[0]) __
+#define T5839(_,__)_ fp_asin(-vars[0])+fp_cosh(-vars[0]) __
+#define T5840(_,__)_ fp_asin(-vars[0])+fp_exp(-vars[0]) __
+#define T3041(_,__)_ fp_asin(-vars[0])+fp_exp(-vars[0]) __
+#define T5841(_,__)_ fp_asin(-vars[0])+fp_log(-vars[0]) __
+#define T3042(_,__)_ fp_asin(-vars[0])+fp_log(-vars[0]) __
+#define T3043(_,__)_ fp_asin(-vars[0])+fp_sin(-vars[0]) __
+#define T5842(_,__)_ fp_asin(-vars[0])+fp_sin(-vars[0]) __
+#define T5843(_,__)_ fp_asin(-vars[0])+fp_sinh(-vars[0]) __
+#define T3044(_,__)_ fp_asin(-vars[0])+fp_sinh(-vars[0]) __
+#define T3045(_,__)_ fp_asin(-vars[0])+fp_tan(-vars[0]) __
+#define T5844(_,__)_ fp_asin(-vars[0])+fp_tan(-vars[0]) __
+#define T5845(_,__)_ fp_asin(-vars[0])+fp_tanh(-vars[0]) __
+#define T3046(_,__)_ fp_asin(-vars[0])+fp_tanh(-vars[0]) __
+#define T4931(_,__)_ fp_asin(-vars[0])-fp_acos(-vars[0]) __
+#define T1893(_,__)_ fp_asin(-vars[0])-fp_acos(-vars[0]) __
+#define T2081(_,__)_ fp_asin(-vars[0])-fp_acos(vars[0]) __
+#define T5081(_,__)_ fp_asin(-vars[0])-fp_acos(vars[0]) __
+#define T4932(_,__)_ fp_asin(-vars[0])-fp_acosh(-vars[0]) __
+#define T5082(_,__)_ fp_asin(-vars[0])-fp_acosh(vars[0]) __
+#define T4933(_,__)_ fp_asin(-vars[0])-fp_asin(-vars[0]) __
+#define T1894(_,__)_ fp_asin(-vars[0])-fp_asin(-vars[0]) __
+#define T2082(_,__)_ fp_asin(-vars[0])-fp_asin(vars[0]) __
+#define T5083(_,__)_ fp_asin(-vars[0])-fp_asin(vars[0]) __
+#define T1895(_,__)_ fp_asin(-vars[0])-fp_asinh(-vars[0]) __
+#define T4934(_,__)_ fp_asin(-vars[0])-fp_asinh(-vars[0]) __
+#define T5084(_,__)_ fp_asin(-vars[0])-fp_asinh(vars[0]) __
+#define T2083(_,__)_ fp_asin(-vars[0])-fp_asinh(vars[0]) __
+#define T1896(_,__)_ fp_asin(-vars[0])-fp_atan(-vars[0]) __
+#define T4935(_,__)_ fp_asin(-vars[0])-fp_atan(-vars[0]) __
+#define T2084(_,__)_ fp_asin(-vars[0])-fp_atan(vars[0]) __
+#define T5085(_,__)_ fp_asin(-vars[0])-fp_atan(vars[0]) __
+#define T1897(_,__)_ fp_asin(-vars[0])-fp_atanh(-vars[0]) __
+#define T2085(_,__)_ fp_asin(-vars[0])-fp_atanh(vars[0]) __
+#define T4936(_,__)_ fp_asin(-vars[0])-fp_cos(-vars[0]) __
+#define T1898(_,__)_ fp_asin(-vars[0])-fp_cos(-vars[0]) __
+#define T2086(_,__)_ fp_asin(-vars[0])-fp_cos(vars[0]) __
+#define T5086(_,__)_ fp_asin(-vars[0])-fp_cos(vars[0]) __
+#define T4937(_,__)_ fp_asin(-vars[0])-fp_cosh(-vars[0]) __
+#define T1899(_,__)_ fp_asin(-vars[0])-fp_cosh(-vars[0]) __
+#define T2087(_,__)_ fp_asin(-vars[0])-fp_cosh(vars[0]) __
+#define T5087(_,__)_ fp_asin(-vars[0])-fp_cosh(vars[0]) __
+#define T1900(_,__)_ fp_asin(-vars[0])-fp_exp(-vars[0]) __
+#define T4938(_,__)_ fp_asin(-vars[0])-fp_exp(-vars[0]) __
+#define T5088(_,__)_ fp_asin(-vars[0])-fp_exp(vars[0]) __
+#define T2088(_,__)_ fp_asin(-vars[0])-fp_exp(vars[0]) __
+#define T1901(_,__)_ fp_asin(-vars[0])-fp_log(-vars[0]) __
+#define T4939(_,__)_ fp_asin(-vars[0])-fp_log(-vars[0]) __
+#define T2089(_,__)_ fp_asin(-vars[0])-fp_log(vars[0]) __
+#define T5089(_,__)_ fp_asin(-vars[0])-fp_log(vars[0]) __
+#define T4940(_,__)_ fp_asin(-vars[0])-fp_sin(-vars[0]) __
+#define T1902(_,__)_ fp_asin(-vars[0])-fp_sin(-vars[0]) __
+#define T2090(_,__)_ fp_asin(-vars[0])-fp_sin(vars[0]) __
+#define T5090(_,__)_ fp_asin(-vars[0])-fp_sin(vars[0]) __
+#define T4941(_,__)_ fp_asin(-vars[0])-fp_sinh(-vars[0]) __
+#define T1903(_,__)_ fp_asin(-vars[0])-fp_sinh(-vars[0]) __
+#define T5091(_,__)_ fp_asin(-vars[0])-fp_sinh(vars[0]) __
+#define T2091(_,__)_ fp_asin(-vars[0])-fp_sinh(vars[0]) __
+#define T1904(_,__)_ fp_asin(-vars[0])-fp_tan(-vars[0]) __
+#define T4942(_,__)_ fp_asin(-vars[0])-fp_tan(-vars[0]) __
+#define T5092(_,__)_ fp_asin(-vars[0])-fp_tan(vars[0]) __
+#define T2092(_,__)_ fp_asin(-vars[0])-fp_tan(vars[0]) __
+#define T4943(_,__)_ fp_asin(-vars[0])-fp_tanh(-vars[0]) __
+#define T1905(_,__)_ fp_asin(-vars[0])-fp_tanh(-vars[0]) __
+#define T2093(_,__)_ fp_asin(-vars[0])-fp_tanh(vars[0]) __
+#define T5093(_,__)_ fp_asin(-vars[0])-fp_tanh(vars[0]) __
+#define  T733(_,__)_ fp_asin(Value_t(fp_abs(vars[0]))) __
+#define T3899(_,__)_ fp_asin(Value_t(fp_abs(vars[0]))) __
+#define T3906(_,__)_ fp_asin(Value_t(fp_arg(vars[0]+c.l0_6))) __
+#define  T739(_,__)_ fp_asin(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T3912(_,__)_ fp_asin(Value_t(fp_imag(vars[0]))) __
+#define T3480(_,__)_ fp_asin(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3481(_,__)_ fp_asin(Value_t(fp_less(vars[0],vars[1]))*c.l0_5) __
+#define T3482(_,__)_ fp_asin(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.l0_1) __
+#define T3483(_,__)_ fp_asin(Value_t(fp_less(vars[0],vars[1]))+c.l0) __
+#define  T751(_,__)_ fp_asin(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1775(_,__)_ fp_asin(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T3926(_,__)_ fp_asin(Value_t(fp_real(vars[0]))) __
+#define  T430(_,__)_ fp_asin(c.l0_7)+vars[0] __
+#define T3892(_,__)_ fp_asin(fp_acos(vars[0])) __
+#define  T722(_,__)_ fp_asin(fp_acos(vars[0]+c.l0_8)) __
+#define T3893(_,__)_ fp_asin(fp_acosh(vars[0])) __
+#define  T723(_,__)_ fp_asin(fp_acosh(vars[0]+c.l1_2)) __
+#define T3894(_,__)_ fp_asin(fp_asin(vars[0])) __
+#define  T724(_,__)_ fp_asin(fp_asin(vars[0])) __
+#define  T726(_,__)_ fp_asin(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3895(_,__)_ fp_asin(fp_asinh(vars[0])) __
+#define  T725(_,__)_ fp_asin(fp_asinh(vars[0])) __
+#define  T728(_,__)_ fp_asin(fp_atan((vars[0]+c.l0_4)/(vars[1]+c.l0_4))) __
+#define T3897(_,__)_ fp_asin(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T731(_,__)_ fp_asin(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T732(_,__)_ fp_asin(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T730(_,__)_ fp_asin(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T727(_,__)_ fp_asin(fp_atan(vars[0])) __
+#define T3896(_,__)_ fp_asin(fp_atan(vars[0])) __
+#define  T721(_,__)_ fp_asin(fp_atan2((vars[0]+c.l0_4),(vars[1]+c.l0_4))) __
+#define  T729(_,__)_ fp_asin(fp_atanh(vars[0])) __
+#define T3898(_,__)_ fp_asin(fp_atanh(vars[0])) __
+#define  T736(_,__)_ fp_asin(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T735(_,__)_ fp_asin(fp_cbrt(vars[0])) __
+#define T3901(_,__)_ fp_asin(fp_cbrt(vars[0])) __
+#define T3919(_,__)_ fp_asin(fp_conj(vars[0])) __
+#define  T737(_,__)_ fp_asin(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3900(_,__)_ fp_asin(fp_cos(vars[0])) __
+#define  T734(_,__)_ fp_asin(fp_cos(vars[0])) __
+#define T3902(_,__)_ fp_asin(fp_cosh(vars[0])) __
+#define T3905(_,__)_ fp_asin(fp_exp(vars[0])) __
+#define  T740(_,__)_ fp_asin(fp_exp(vars[0]+c.lm0_2)) __
+#define T3904(_,__)_ fp_asin(fp_exp2(vars[0])) __
+#define  T738(_,__)_ fp_asin(fp_exp2(vars[0]+c.lm0_2)) __
+#define T3907(_,__)_ fp_asin(fp_hypot((vars[0]+c.lm0_2),(vars[1]+c.lm0_2))) __
+#define T3908(_,__)_ fp_asin(fp_hypot(c.l1,vars[0])) __
+#define T3909(_,__)_ fp_asin(fp_hypot(c.l2,vars[0])) __
+#define T3910(_,__)_ fp_asin(fp_hypot(vars[0],c.l1)) __
+#define T3911(_,__)_ fp_asin(fp_hypot(vars[0],c.l2)) __
+#define  T741(_,__)_ fp_asin(fp_hypot(vars[0],vars[1])) __
+#define T3913(_,__)_ fp_asin(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T742(_,__)_ fp_asin(fp_inv(fp_atan2((vars[0]+c.lm0_2),(vars[1]+c.lm0_2)))) __
+#define T3903(_,__)_ fp_asin(fp_inv(fp_cos(vars[0]))) __
+#define  T743(_,__)_ fp_asin(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3915(_,__)_ fp_asin(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define  T744(_,__)_ fp_asin(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T3916(_,__)_ fp_asin(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T746(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3917(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define  T747(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T3918(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T3914(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T745(_,__)_ fp_asin(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T3891(_,__)_ fp_asin(fp_inv(fp_sin(vars[0]))) __
+#define T3923(_,__)_ fp_asin(fp_inv(fp_tan(vars[0]))) __
+#define  T752(_,__)_ fp_asin(fp_inv(fp_tan(vars[0]+c.l0_4))) __
+#define T3479(_,__)_ fp_asin(fp_less(vars[0],vars[1]) ? c.lm0_3 : c.lm0_7) __
+#define T3920(_,__)_ fp_asin(fp_log(vars[0])) __
+#define  T749(_,__)_ fp_asin(fp_log(vars[0])) __
+#define T3922(_,__)_ fp_asin(fp_log10(vars[0])) __
+#define  T750(_,__)_ fp_asin(fp_log10(vars[0])) __
+#define  T748(_,__)_ fp_asin(fp_log2(vars[0])) __
+#define T3921(_,__)_ fp_asin(fp_log2(vars[0])) __
+#define T3925(_,__)_ fp_asin(fp_polar(vars[0],vars[1])) __
+#define T3924(_,__)_ fp_asin(fp_pow(vars[0],vars[1])) __
+#define  T753(_,__)_ fp_asin(fp_pow(vars[0],vars[1])) __
+#define  T756(_,__)_ fp_asin(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T754(_,__)_ fp_asin(fp_sin(vars[0])) __
+#define  T755(_,__)_ fp_asin(fp_sinh(vars[0])) __
+#define T3927(_,__)_ fp_asin(fp_sinh(vars[0])) __
+#define  T758(_,__)_ fp_asin(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3928(_,__)_ fp_asin(fp_sqrt(vars[0])) __
+#define  T757(_,__)_ fp_asin(fp_sqrt(vars[0])) __
+#define T3929(_,__)_ fp_asin(fp_tan(vars[0])) __
+#define  T759(_,__)_ fp_asin(fp_tan(vars[0])) __
+#define  T761(_,__)_ fp_asin(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3930(_,__)_ fp_asin(fp_tanh(vars[0])) __
+#define  T760(_,__)_ fp_asin(fp_tanh(vars[0])) __
+#define T4791(_,__)_ fp_asin(vars[0]) __
+#define T1772(_,__)_ fp_asin(vars[0]) __
+#define T5912(_,__)_ fp_asin(vars[0])+fp_acos(-vars[0]) __
+#define T3135(_,__)_ fp_asin(vars[0])+fp_acos(-vars[0]) __
+#define T5913(_,__)_ fp_asin(vars[0])+fp_acosh(-vars[0]) __
+#define T3136(_,__)_ fp_asin(vars[0])+fp_asin(-vars[0]) __
+#define T6058(_,__)_ fp_asin(vars[0])+fp_asin(vars[0]) __
+#define T3323(_,__)_ fp_asin(vars[0])+fp_asin(vars[0]) __
+#define T3137(_,__)_ fp_asin(vars[0])+fp_asinh(-vars[0]) __
+#define T5914(_,__)_ fp_asin(vars[0])+fp_asinh(-vars[0]) __
+#define T6059(_,__)_ fp_asin(vars[0])+fp_asinh(vars[0]) __
+#define T3324(_,__)_ fp_asin(vars[0])+fp_asinh(vars[0]) __
+#define T5915(_,__)_ fp_asin(vars[0])+fp_atan(-vars[0]) __
+#define T3138(_,__)_ fp_asin(vars[0])+fp_atan(-vars[0]) __
+#define T3325(_,__)_ fp_asin(vars[0])+fp_atan(vars[0]) __
+#define T6060(_,__)_ fp_asin(vars[0])+fp_atan(vars[0]) __
+#define T3139(_,__)_ fp_asin(vars[0])+fp_atanh(-vars[0]) __
+#define T3326(_,__)_ fp_asin(vars[0])+fp_atanh(vars[0]) __
+#define T3140(_,__)_ fp_asin(vars[0])+fp_cos(-vars[0]) __
+#define T5916(_,__)_ fp_asin(vars[0])+fp_cos(-vars[0]) __
+#define T6061(_,__)_ fp_asin(vars[0])+fp_cos(vars[0]) __
+#define T3327(_,__)_ fp_asin(vars[0])+fp_cos(vars[0]) __
+#define T5917(_,__)_ fp_asin(vars[0])+fp_cosh(-vars[0]) __
+#define T3141(_,__)_ fp_asin(vars[0])+fp_cosh(-vars[0]) __
+#define T3328(_,__)_ fp_asin(vars[0])+fp_cosh(vars[0]) __
+#define T6062(_,__)_ fp_asin(vars[0])+fp_cosh(vars[0]) __
+#define T3142(_,__)_ fp_asin(vars[0])+fp_exp(-vars[0]) __
+#define T5918(_,__)_ fp_asin(vars[0])+fp_exp(-vars[0]) __
+#define T6063(_,__)_ fp_asin(vars[0])+fp_exp(vars[0]) __
+#define T3329(_,__)_ fp_asin(vars[0])+fp_exp(vars[0]) __
+#define T5919(_,__)_ fp_asin(vars[0])+fp_log(-vars[0]) __
+#define T3143(_,__)_ fp_asin(vars[0])+fp_log(-vars[0]) __
+#define T6064(_,__)_ fp_asin(vars[0])+fp_log(vars[0]) __
+#define T3330(_,__)_ fp_asin(vars[0])+fp_log(vars[0]) __
+#define T3144(_,__)_ fp_asin(vars[0])+fp_sin(-vars[0]) __
+#define T5920(_,__)_ fp_asin(vars[0])+fp_sin(-vars[0]) __
+#define T6065(_,__)_ fp_asin(vars[0])+fp_sin(vars[0]) __
+#define T3331(_,__)_ fp_asin(vars[0])+fp_sin(vars[0]) __
+#define T5921(_,__)_ fp_asin(vars[0])+fp_sinh(-vars[0]) __
+#define T3145(_,__)_ fp_asin(vars[0])+fp_sinh(-vars[0]) __
+#define T3332(_,__)_ fp_asin(vars[0])+fp_sinh(vars[0]) __
+#define T6066(_,__)_ fp_asin(vars[0])+fp_sinh(vars[0]) __
+#define T5922(_,__)_ fp_asin(vars[0])+fp_tan(-vars[0]) __
+#define T3146(_,__)_ fp_asin(vars[0])+fp_tan(-vars[0]) __
+#define T3333(_,__)_ fp_asin(vars[0])+fp_tan(vars[0]) __
+#define T6067(_,__)_ fp_asin(vars[0])+fp_tan(vars[0]) __
+#define T3147(_,__)_ fp_asin(vars[0])+fp_tanh(-vars[0]) __
+#define T5923(_,__)_ fp_asin(vars[0])+fp_tanh(-vars[0]) __
+#define T6068(_,__)_ fp_asin(vars[0])+fp_tanh(vars[0]) __
+#define T3334(_,__)_ fp_asin(vars[0])+fp_tanh(vars[0]) __
+#define T5232(_,__)_ fp_asin(vars[0])-fp_acos(-vars[0]) __
+#define T2267(_,__)_ fp_asin(vars[0])-fp_acos(-vars[0]) __
+#define T5383(_,__)_ fp_asin(vars[0])-fp_acos(vars[0]) __
+#define T2455(_,__)_ fp_asin(vars[0])-fp_acos(vars[0]) __
+#define T5233(_,__)_ fp_asin(vars[0])-fp_acosh(-vars[0]) __
+#define T5384(_,__)_ fp_asin(vars[0])-fp_acosh(vars[0]) __
+#define T2268(_,__)_ fp_asin(vars[0])-fp_asin(-vars[0]) __
+#define T5234(_,__)_ fp_asin(vars[0])-fp_asin(-vars[0]) __
+#define T5385(_,__)_ fp_asin(vars[0])-fp_asin(vars[0]) __
+#define T2456(_,__)_ fp_asin(vars[0])-fp_asin(vars[0]) __
+#define T2269(_,__)_ fp_asin(vars[0])-fp_asinh(-vars[0]) __
+#define T5235(_,__)_ fp_asin(vars[0])-fp_asinh(-vars[0]) __
+#define T5386(_,__)_ fp_asin(vars[0])-fp_asinh(vars[0]) __
+#define T2457(_,__)_ fp_asin(vars[0])-fp_asinh(vars[0]) __
+#define T2270(_,__)_ fp_asin(vars[0])-fp_atan(-vars[0]) __
+#define T5236(_,__)_ fp_asin(vars[0])-fp_atan(-vars[0]) __
+#define T2458(_,__)_ fp_asin(vars[0])-fp_atan(vars[0]) __
+#define T5387(_,__)_ fp_asin(vars[0])-fp_atan(vars[0]) __
+#define T2271(_,__)_ fp_asin(vars[0])-fp_atanh(-vars[0]) __
+#define T2459(_,__)_ fp_asin(vars[0])-fp_atanh(vars[0]) __
+#define T2272(_,__)_ fp_asin(vars[0])-fp_cos(-vars[0]) __
+#define T5237(_,__)_ fp_asin(vars[0])-fp_cos(-vars[0]) __
+#define T5388(_,__)_ fp_asin(vars[0])-fp_cos(vars[0]) __
+#define T2460(_,__)_ fp_asin(vars[0])-fp_cos(vars[0]) __
+#define T2273(_,__)_ fp_asin(vars[0])-fp_cosh(-vars[0]) __
+#define T5238(_,__)_ fp_asin(vars[0])-fp_cosh(-vars[0]) __
+#define T2461(_,__)_ fp_asin(vars[0])-fp_cosh(vars[0]) __
+#define T5389(_,__)_ fp_asin(vars[0])-fp_cosh(vars[0]) __
+#define T2274(_,__)_ fp_asin(vars[0])-fp_exp(-vars[0]) __
+#define T5239(_,__)_ fp_asin(vars[0])-fp_exp(-vars[0]) __
+#define T5390(_,__)_ fp_asin(vars[0])-fp_exp(vars[0]) __
+#define T2462(_,__)_ fp_asin(vars[0])-fp_exp(vars[0]) __
+#define T2275(_,__)_ fp_asin(vars[0])-fp_log(-vars[0]) __
+#define T5240(_,__)_ fp_asin(vars[0])-fp_log(-vars[0]) __
+#define T2463(_,__)_ fp_asin(vars[0])-fp_log(vars[0]) __
+#define T5391(_,__)_ fp_asin(vars[0])-fp_log(vars[0]) __
+#define T2276(_,__)_ fp_asin(vars[0])-fp_sin(-vars[0]) __
+#define T5241(_,__)_ fp_asin(vars[0])-fp_sin(-vars[0]) __
+#define T2464(_,__)_ fp_asin(vars[0])-fp_sin(vars[0]) __
+#define T5392(_,__)_ fp_asin(vars[0])-fp_sin(vars[0]) __
+#define T2277(_,__)_ fp_asin(vars[0])-fp_sinh(-vars[0]) __
+#define T5242(_,__)_ fp_asin(vars[0])-fp_sinh(-vars[0]) __
+#define T2465(_,__)_ fp_asin(vars[0])-fp_sinh(vars[0]) __
+#define T5393(_,__)_ fp_asin(vars[0])-fp_sinh(vars[0]) __
+#define T5243(_,__)_ fp_asin(vars[0])-fp_tan(-vars[0]) __
+#define T2278(_,__)_ fp_asin(vars[0])-fp_tan(-vars[0]) __
+#define T2466(_,__)_ fp_asin(vars[0])-fp_tan(vars[0]) __
+#define T5394(_,__)_ fp_asin(vars[0])-fp_tan(vars[0]) __
+#define T2279(_,__)_ fp_asin(vars[0])-fp_tanh(-vars[0]) __
+#define T5244(_,__)_ fp_asin(vars[0])-fp_tanh(-vars[0]) __
+#define T2467(_,__)_ fp_asin(vars[0])-fp_tanh(vars[0]) __
+#define T5395(_,__)_ fp_asin(vars[0])-fp_tanh(vars[0]) __
+#define T4835(_,__)_ fp_asin(vars[0]*(c.l1*c.i)) __
+#define T4837(_,__)_ fp_asin(vars[0]*(c.l3*c.i)) __
+#define T4841(_,__)_ fp_asin(vars[0]*-(c.l1*c.i)) __
+#define T4840(_,__)_ fp_asin(vars[0]*-(c.l3*c.i)) __
+#define T1830(_,__)_ fp_asin(vars[0]*c.l2) __
+#define T4836(_,__)_ fp_asin(vars[0]*c.l2) __
+#define T4838(_,__)_ fp_asin(vars[0]*c.lm1) __
+#define T1831(_,__)_ fp_asin(vars[0]*c.lm1) __
+#define T4839(_,__)_ fp_asin(vars[0]*c.lm2) __
+#define T1832(_,__)_ fp_asin(vars[0]*c.lm2) __
+#define T3047(_,__)_ fp_asinh(-vars[0])+fp_asinh(-vars[0]) __
+#define T5846(_,__)_ fp_asinh(-vars[0])+fp_asinh(-vars[0]) __
+#define T3048(_,__)_ fp_asinh(-vars[0])+fp_atan(-vars[0]) __
+#define T5847(_,__)_ fp_asinh(-vars[0])+fp_atan(-vars[0]) __
+#define T3049(_,__)_ fp_asinh(-vars[0])+fp_atanh(-vars[0]) __
+#define T5848(_,__)_ fp_asinh(-vars[0])+fp_cos(-vars[0]) __
+#define T3050(_,__)_ fp_asinh(-vars[0])+fp_cos(-vars[0]) __
+#define T3051(_,__)_ fp_asinh(-vars[0])+fp_cosh(-vars[0]) __
+#define T5849(_,__)_ fp_asinh(-vars[0])+fp_cosh(-vars[0]) __
+#define T5850(_,__)_ fp_asinh(-vars[0])+fp_exp(-vars[0]) __
+#define T3052(_,__)_ fp_asinh(-vars[0])+fp_exp(-vars[0]) __
+#define T5851(_,__)_ fp_asinh(-vars[0])+fp_log(-vars[0]) __
+#define T3053(_,__)_ fp_asinh(-vars[0])+fp_log(-vars[0]) __
+#define T5852(_,__)_ fp_asinh(-vars[0])+fp_sin(-vars[0]) __
+#define T3054(_,__)_ fp_asinh(-vars[0])+fp_sin(-vars[0]) __
+#define T5853(_,__)_ fp_asinh(-vars[0])+fp_sinh(-vars[0]) __
+#define T3055(_,__)_ fp_asinh(-vars[0])+fp_sinh(-vars[0]) __
+#define T5854(_,__)_ fp_asinh(-vars[0])+fp_tan(-vars[0]) __
+#define T3056(_,__)_ fp_asinh(-vars[0])+fp_tan(-vars[0]) __
+#define T5855(_,__)_ fp_asinh(-vars[0])+fp_tanh(-vars[0]) __
+#define T3057(_,__)_ fp_asinh(-vars[0])+fp_tanh(-vars[0]) __
+#define T1906(_,__)_ fp_asinh(-vars[0])-fp_acos(-vars[0]) __
+#define T4944(_,__)_ fp_asinh(-vars[0])-fp_acos(-vars[0]) __
+#define T2094(_,__)_ fp_asinh(-vars[0])-fp_acos(vars[0]) __
+#define T5094(_,__)_ fp_asinh(-vars[0])-fp_acos(vars[0]) __
+#define T1907(_,__)_ fp_asinh(-vars[0])-fp_acosh(-vars[0]) __
+#define T4945(_,__)_ fp_asinh(-vars[0])-fp_acosh(-vars[0]) __
+#define T2095(_,__)_ fp_asinh(-vars[0])-fp_acosh(vars[0]) __
+#define T5095(_,__)_ fp_asinh(-vars[0])-fp_acosh(vars[0]) __
+#define T1908(_,__)_ fp_asinh(-vars[0])-fp_asin(-vars[0]) __
+#define T4946(_,__)_ fp_asinh(-vars[0])-fp_asin(-vars[0]) __
+#define T5096(_,__)_ fp_asinh(-vars[0])-fp_asin(vars[0]) __
+#define T2096(_,__)_ fp_asinh(-vars[0])-fp_asin(vars[0]) __
+#define T1909(_,__)_ fp_asinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T4947(_,__)_ fp_asinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5097(_,__)_ fp_asinh(-vars[0])-fp_asinh(vars[0]) __
+#define T2097(_,__)_ fp_asinh(-vars[0])-fp_asinh(vars[0]) __
+#define T1910(_,__)_ fp_asinh(-vars[0])-fp_atan(-vars[0]) __
+#define T4948(_,__)_ fp_asinh(-vars[0])-fp_atan(-vars[0]) __
+#define T5098(_,__)_ fp_asinh(-vars[0])-fp_atan(vars[0]) __
+#define T2098(_,__)_ fp_asinh(-vars[0])-fp_atan(vars[0]) __
+#define T1911(_,__)_ fp_asinh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2099(_,__)_ fp_asinh(-vars[0])-fp_atanh(vars[0]) __
+#define T1912(_,__)_ fp_asinh(-vars[0])-fp_cos(-vars[0]) __
+#define T4949(_,__)_ fp_asinh(-vars[0])-fp_cos(-vars[0]) __
+#define T2100(_,__)_ fp_asinh(-vars[0])-fp_cos(vars[0]) __
+#define T5099(_,__)_ fp_asinh(-vars[0])-fp_cos(vars[0]) __
+#define T4950(_,__)_ fp_asinh(-vars[0])-fp_cosh(-vars[0]) __
+#define T1913(_,__)_ fp_asinh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2101(_,__)_ fp_asinh(-vars[0])-fp_cosh(vars[0]) __
+#define T5100(_,__)_ fp_asinh(-vars[0])-fp_cosh(vars[0]) __
+#define T1914(_,__)_ fp_asinh(-vars[0])-fp_exp(-vars[0]) __
+#define T4951(_,__)_ fp_asinh(-vars[0])-fp_exp(-vars[0]) __
+#define T2102(_,__)_ fp_asinh(-vars[0])-fp_exp(vars[0]) __
+#define T5101(_,__)_ fp_asinh(-vars[0])-fp_exp(vars[0]) __
+#define T4952(_,__)_ fp_asinh(-vars[0])-fp_log(-vars[0]) __
+#define T1915(_,__)_ fp_asinh(-vars[0])-fp_log(-vars[0]) __
+#define T5102(_,__)_ fp_asinh(-vars[0])-fp_log(vars[0]) __
+#define T2103(_,__)_ fp_asinh(-vars[0])-fp_log(vars[0]) __
+#define T4953(_,__)_ fp_asinh(-vars[0])-fp_sin(-vars[0]) __
+#define T1916(_,__)_ fp_asinh(-vars[0])-fp_sin(-vars[0]) __
+#define T5103(_,__)_ fp_asinh(-vars[0])-fp_sin(vars[0]) __
+#define T2104(_,__)_ fp_asinh(-vars[0])-fp_sin(vars[0]) __
+#define T1917(_,__)_ fp_asinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T4954(_,__)_ fp_asinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2105(_,__)_ fp_asinh(-vars[0])-fp_sinh(vars[0]) __
+#define T5104(_,__)_ fp_asinh(-vars[0])-fp_sinh(vars[0]) __
+#define T1918(_,__)_ fp_asinh(-vars[0])-fp_tan(-vars[0]) __
+#define T4955(_,__)_ fp_asinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2106(_,__)_ fp_asinh(-vars[0])-fp_tan(vars[0]) __
+#define T5105(_,__)_ fp_asinh(-vars[0])-fp_tan(vars[0]) __
+#define T1919(_,__)_ fp_asinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T4956(_,__)_ fp_asinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T2107(_,__)_ fp_asinh(-vars[0])-fp_tanh(vars[0]) __
+#define T5106(_,__)_ fp_asinh(-vars[0])-fp_tanh(vars[0]) __
+#define  T777(_,__)_ fp_asinh(Value_t(fp_abs(vars[0]))) __
+#define T3941(_,__)_ fp_asinh(Value_t(fp_arg(vars[0]))) __
+#define  T788(_,__)_ fp_asinh(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T3947(_,__)_ fp_asinh(Value_t(fp_imag(vars[0]))) __
+#define T3485(_,__)_ fp_asinh(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3486(_,__)_ fp_asinh(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3487(_,__)_ fp_asinh(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3488(_,__)_ fp_asinh(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define  T806(_,__)_ fp_asinh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1774(_,__)_ fp_asinh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T3959(_,__)_ fp_asinh(Value_t(fp_real(vars[0]))) __
+#define  T432(_,__)_ fp_asinh(c.l1_1)+vars[0] __
+#define  T766(_,__)_ fp_asinh(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T764(_,__)_ fp_asinh(fp_acos(vars[0])) __
+#define T3931(_,__)_ fp_asinh(fp_acos(vars[0])) __
+#define T3932(_,__)_ fp_asinh(fp_acosh(vars[0])) __
+#define  T765(_,__)_ fp_asinh(fp_acosh(vars[0]+c.l0_6)) __
+#define  T770(_,__)_ fp_asinh(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T767(_,__)_ fp_asinh(fp_asin(vars[0])) __
+#define T3933(_,__)_ fp_asinh(fp_asin(vars[0])) __
+#define  T769(_,__)_ fp_asinh(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3934(_,__)_ fp_asinh(fp_asinh(vars[0])) __
+#define  T768(_,__)_ fp_asinh(fp_asinh(vars[0])) __
+#define T3936(_,__)_ fp_asinh(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T3938(_,__)_ fp_asinh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T775(_,__)_ fp_asinh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T3939(_,__)_ fp_asinh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T776(_,__)_ fp_asinh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T774(_,__)_ fp_asinh(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T771(_,__)_ fp_asinh(fp_atan(vars[0])) __
+#define T3935(_,__)_ fp_asinh(fp_atan(vars[0])) __
+#define  T772(_,__)_ fp_asinh(fp_atan(vars[0]/vars[1])) __
+#define  T762(_,__)_ fp_asinh(fp_atan2(vars[0],vars[1])) __
+#define  T773(_,__)_ fp_asinh(fp_atanh(vars[0])) __
+#define T3937(_,__)_ fp_asinh(fp_atanh(vars[0])) __
+#define  T780(_,__)_ fp_asinh(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T779(_,__)_ fp_asinh(fp_cbrt(vars[0])) __
+#define T3940(_,__)_ fp_asinh(fp_cbrt(vars[0])) __
+#define T3954(_,__)_ fp_asinh(fp_conj(vars[0])) __
+#define  T783(_,__)_ fp_asinh(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T778(_,__)_ fp_asinh(fp_cos(vars[0])) __
+#define  T782(_,__)_ fp_asinh(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T781(_,__)_ fp_asinh(fp_cosh(vars[0])) __
+#define  T790(_,__)_ fp_asinh(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T789(_,__)_ fp_asinh(fp_exp(vars[0])) __
+#define  T785(_,__)_ fp_asinh(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T784(_,__)_ fp_asinh(fp_exp2(vars[0])) __
+#define T3942(_,__)_ fp_asinh(fp_hypot((vars[0]+c.lm0_2),(vars[1]+c.lm0_2))) __
+#define T3943(_,__)_ fp_asinh(fp_hypot(c.l1,vars[0])) __
+#define  T791(_,__)_ fp_asinh(fp_hypot(c.l1,vars[0])) __
+#define T3944(_,__)_ fp_asinh(fp_hypot(c.l2,vars[0])) __
+#define  T792(_,__)_ fp_asinh(fp_hypot(c.l2,vars[0])) __
+#define  T794(_,__)_ fp_asinh(fp_hypot(vars[0],c.l1)) __
+#define T3945(_,__)_ fp_asinh(fp_hypot(vars[0],c.l1)) __
+#define  T795(_,__)_ fp_asinh(fp_hypot(vars[0],c.l2)) __
+#define T3946(_,__)_ fp_asinh(fp_hypot(vars[0],c.l2)) __
+#define  T793(_,__)_ fp_asinh(fp_hypot(vars[0],vars[1])) __
+#define T3948(_,__)_ fp_asinh(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T797(_,__)_ fp_asinh(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define  T796(_,__)_ fp_asinh(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define  T787(_,__)_ fp_asinh(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T786(_,__)_ fp_asinh(fp_inv(fp_cos(vars[0]))) __
+#define T3950(_,__)_ fp_asinh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define  T798(_,__)_ fp_asinh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define  T799(_,__)_ fp_asinh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T3951(_,__)_ fp_asinh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T801(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3952(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3953(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T802(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T800(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T3949(_,__)_ fp_asinh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T763(_,__)_ fp_asinh(fp_inv(fp_sin(vars[0]))) __
+#define  T807(_,__)_ fp_asinh(fp_inv(fp_tan(vars[0]))) __
+#define T3484(_,__)_ fp_asinh(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define  T804(_,__)_ fp_asinh(fp_log(vars[0])) __
+#define T3955(_,__)_ fp_asinh(fp_log(vars[0])) __
+#define  T805(_,__)_ fp_asinh(fp_log10(vars[0])) __
+#define T3957(_,__)_ fp_asinh(fp_log10(vars[0])) __
+#define T3956(_,__)_ fp_asinh(fp_log2(vars[0])) __
+#define  T803(_,__)_ fp_asinh(fp_log2(vars[0])) __
+#define T3958(_,__)_ fp_asinh(fp_polar(vars[0],vars[1])) __
+#define  T808(_,__)_ fp_asinh(fp_pow(vars[0],vars[1])) __
+#define  T812(_,__)_ fp_asinh(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3960(_,__)_ fp_asinh(fp_sin(vars[0])) __
+#define  T809(_,__)_ fp_asinh(fp_sin(vars[0])) __
+#define  T811(_,__)_ fp_asinh(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T810(_,__)_ fp_asinh(fp_sinh(vars[0])) __
+#define  T814(_,__)_ fp_asinh(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T813(_,__)_ fp_asinh(fp_sqrt(vars[0])) __
+#define T3961(_,__)_ fp_asinh(fp_sqrt(vars[0])) __
+#define  T818(_,__)_ fp_asinh(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T815(_,__)_ fp_asinh(fp_tan(vars[0])) __
+#define T3962(_,__)_ fp_asinh(fp_tan(vars[0])) __
+#define  T817(_,__)_ fp_asinh(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T816(_,__)_ fp_asinh(fp_tanh(vars[0])) __
+#define T3963(_,__)_ fp_asinh(fp_tanh(vars[0])) __
+#define T1773(_,__)_ fp_asinh(vars[0]) __
+#define T4792(_,__)_ fp_asinh(vars[0]) __
+#define T3661(_,__)_ fp_asinh(vars[0])+c.l1_5*fp_acosh(vars[1]+c.l3)+c.l2_5*fp_atanh(vars[2]) __
+#define T5924(_,__)_ fp_asinh(vars[0])+fp_acos(-vars[0]) __
+#define T3148(_,__)_ fp_asinh(vars[0])+fp_acos(-vars[0]) __
+#define T3149(_,__)_ fp_asinh(vars[0])+fp_acosh(-vars[0]) __
+#define T5925(_,__)_ fp_asinh(vars[0])+fp_asin(-vars[0]) __
+#define T3150(_,__)_ fp_asinh(vars[0])+fp_asin(-vars[0]) __
+#define T3151(_,__)_ fp_asinh(vars[0])+fp_asinh(-vars[0]) __
+#define T6069(_,__)_ fp_asinh(vars[0])+fp_asinh(vars[0]) __
+#define T3335(_,__)_ fp_asinh(vars[0])+fp_asinh(vars[0]) __
+#define T5926(_,__)_ fp_asinh(vars[0])+fp_atan(-vars[0]) __
+#define T3152(_,__)_ fp_asinh(vars[0])+fp_atan(-vars[0]) __
+#define T3336(_,__)_ fp_asinh(vars[0])+fp_atan(vars[0]) __
+#define T6070(_,__)_ fp_asinh(vars[0])+fp_atan(vars[0]) __
+#define T3153(_,__)_ fp_asinh(vars[0])+fp_atanh(-vars[0]) __
+#define T3337(_,__)_ fp_asinh(vars[0])+fp_atanh(vars[0]) __
+#define T3154(_,__)_ fp_asinh(vars[0])+fp_cos(-vars[0]) __
+#define T5927(_,__)_ fp_asinh(vars[0])+fp_cos(-vars[0]) __
+#define T3338(_,__)_ fp_asinh(vars[0])+fp_cos(vars[0]) __
+#define T6071(_,__)_ fp_asinh(vars[0])+fp_cos(vars[0]) __
+#define T3155(_,__)_ fp_asinh(vars[0])+fp_cosh(-vars[0]) __
+#define T5928(_,__)_ fp_asinh(vars[0])+fp_cosh(-vars[0]) __
+#define T6072(_,__)_ fp_asinh(vars[0])+fp_cosh(vars[0]) __
+#define T3339(_,__)_ fp_asinh(vars[0])+fp_cosh(vars[0]) __
+#define T3156(_,__)_ fp_asinh(vars[0])+fp_exp(-vars[0]) __
+#define T5929(_,__)_ fp_asinh(vars[0])+fp_exp(-vars[0]) __
+#define T3340(_,__)_ fp_asinh(vars[0])+fp_exp(vars[0]) __
+#define T6073(_,__)_ fp_asinh(vars[0])+fp_exp(vars[0]) __
+#define T5930(_,__)_ fp_asinh(vars[0])+fp_log(-vars[0]) __
+#define T3157(_,__)_ fp_asinh(vars[0])+fp_log(-vars[0]) __
+#define T6074(_,__)_ fp_asinh(vars[0])+fp_log(vars[0]) __
+#define T3341(_,__)_ fp_asinh(vars[0])+fp_log(vars[0]) __
+#define T5931(_,__)_ fp_asinh(vars[0])+fp_sin(-vars[0]) __
+#define T3158(_,__)_ fp_asinh(vars[0])+fp_sin(-vars[0]) __
+#define T3342(_,__)_ fp_asinh(vars[0])+fp_sin(vars[0]) __
+#define T6075(_,__)_ fp_asinh(vars[0])+fp_sin(vars[0]) __
+#define T5932(_,__)_ fp_asinh(vars[0])+fp_sinh(-vars[0]) __
+#define T3159(_,__)_ fp_asinh(vars[0])+fp_sinh(-vars[0]) __
+#define T6076(_,__)_ fp_asinh(vars[0])+fp_sinh(vars[0]) __
+#define T3343(_,__)_ fp_asinh(vars[0])+fp_sinh(vars[0]) __
+#define T5933(_,__)_ fp_asinh(vars[0])+fp_tan(-vars[0]) __
+#define T3160(_,__)_ fp_asinh(vars[0])+fp_tan(-vars[0]) __
+#define T6077(_,__)_ fp_asinh(vars[0])+fp_tan(vars[0]) __
+#define T3344(_,__)_ fp_asinh(vars[0])+fp_tan(vars[0]) __
+#define T5934(_,__)_ fp_asinh(vars[0])+fp_tanh(-vars[0]) __
+#define T3161(_,__)_ fp_asinh(vars[0])+fp_tanh(-vars[0]) __
+#define T3345(_,__)_ fp_asinh(vars[0])+fp_tanh(vars[0]) __
+#define T6078(_,__)_ fp_asinh(vars[0])+fp_tanh(vars[0]) __
+#define T2280(_,__)_ fp_asinh(vars[0])-fp_acos(-vars[0]) __
+#define T5245(_,__)_ fp_asinh(vars[0])-fp_acos(-vars[0]) __
+#define T2468(_,__)_ fp_asinh(vars[0])-fp_acos(vars[0]) __
+#define T5396(_,__)_ fp_asinh(vars[0])-fp_acos(vars[0]) __
+#define T2281(_,__)_ fp_asinh(vars[0])-fp_acosh(-vars[0]) __
+#define T5246(_,__)_ fp_asinh(vars[0])-fp_acosh(-vars[0]) __
+#define T2469(_,__)_ fp_asinh(vars[0])-fp_acosh(vars[0]) __
+#define T5397(_,__)_ fp_asinh(vars[0])-fp_acosh(vars[0]) __
+#define T5247(_,__)_ fp_asinh(vars[0])-fp_asin(-vars[0]) __
+#define T2282(_,__)_ fp_asinh(vars[0])-fp_asin(-vars[0]) __
+#define T5398(_,__)_ fp_asinh(vars[0])-fp_asin(vars[0]) __
+#define T2470(_,__)_ fp_asinh(vars[0])-fp_asin(vars[0]) __
+#define T5248(_,__)_ fp_asinh(vars[0])-fp_asinh(-vars[0]) __
+#define T2283(_,__)_ fp_asinh(vars[0])-fp_asinh(-vars[0]) __
+#define T5399(_,__)_ fp_asinh(vars[0])-fp_asinh(vars[0]) __
+#define T2471(_,__)_ fp_asinh(vars[0])-fp_asinh(vars[0]) __
+#define T2284(_,__)_ fp_asinh(vars[0])-fp_atan(-vars[0]) __
+#define T5249(_,__)_ fp_asinh(vars[0])-fp_atan(-vars[0]) __
+#define T5400(_,__)_ fp_asinh(vars[0])-fp_atan(vars[0]) __
+#define T2472(_,__)_ fp_asinh(vars[0])-fp_atan(vars[0]) __
+#define T2285(_,__)_ fp_asinh(vars[0])-fp_atanh(-vars[0]) __
+#define T2473(_,__)_ fp_asinh(vars[0])-fp_atanh(vars[0]) __
+#define T2286(_,__)_ fp_asinh(vars[0])-fp_cos(-vars[0]) __
+#define T5250(_,__)_ fp_asinh(vars[0])-fp_cos(-vars[0]) __
+#define T5401(_,__)_ fp_asinh(vars[0])-fp_cos(vars[0]) __
+#define T2474(_,__)_ fp_asinh(vars[0])-fp_cos(vars[0]) __
+#define T2287(_,__)_ fp_asinh(vars[0])-fp_cosh(-vars[0]) __
+#define T5251(_,__)_ fp_asinh(vars[0])-fp_cosh(-vars[0]) __
+#define T2475(_,__)_ fp_asinh(vars[0])-fp_cosh(vars[0]) __
+#define T5402(_,__)_ fp_asinh(vars[0])-fp_cosh(vars[0]) __
+#define T2288(_,__)_ fp_asinh(vars[0])-fp_exp(-vars[0]) __
+#define T5252(_,__)_ fp_asinh(vars[0])-fp_exp(-vars[0]) __
+#define T5403(_,__)_ fp_asinh(vars[0])-fp_exp(vars[0]) __
+#define T2476(_,__)_ fp_asinh(vars[0])-fp_exp(vars[0]) __
+#define T2289(_,__)_ fp_asinh(vars[0])-fp_log(-vars[0]) __
+#define T5253(_,__)_ fp_asinh(vars[0])-fp_log(-vars[0]) __
+#define T5404(_,__)_ fp_asinh(vars[0])-fp_log(vars[0]) __
+#define T2477(_,__)_ fp_asinh(vars[0])-fp_log(vars[0]) __
+#define T2290(_,__)_ fp_asinh(vars[0])-fp_sin(-vars[0]) __
+#define T5254(_,__)_ fp_asinh(vars[0])-fp_sin(-vars[0]) __
+#define T2478(_,__)_ fp_asinh(vars[0])-fp_sin(vars[0]) __
+#define T5405(_,__)_ fp_asinh(vars[0])-fp_sin(vars[0]) __
+#define T5255(_,__)_ fp_asinh(vars[0])-fp_sinh(-vars[0]) __
+#define T2291(_,__)_ fp_asinh(vars[0])-fp_sinh(-vars[0]) __
+#define T2479(_,__)_ fp_asinh(vars[0])-fp_sinh(vars[0]) __
+#define T5406(_,__)_ fp_asinh(vars[0])-fp_sinh(vars[0]) __
+#define T2292(_,__)_ fp_asinh(vars[0])-fp_tan(-vars[0]) __
+#define T5256(_,__)_ fp_asinh(vars[0])-fp_tan(-vars[0]) __
+#define T5407(_,__)_ fp_asinh(vars[0])-fp_tan(vars[0]) __
+#define T2480(_,__)_ fp_asinh(vars[0])-fp_tan(vars[0]) __
+#define T5257(_,__)_ fp_asinh(vars[0])-fp_tanh(-vars[0]) __
+#define T2293(_,__)_ fp_asinh(vars[0])-fp_tanh(-vars[0]) __
+#define T2481(_,__)_ fp_asinh(vars[0])-fp_tanh(vars[0]) __
+#define T5408(_,__)_ fp_asinh(vars[0])-fp_tanh(vars[0]) __
+#define T4842(_,__)_ fp_asinh(vars[0]*(c.l1*c.i)) __
+#define T4844(_,__)_ fp_asinh(vars[0]*(c.l3*c.i)) __
+#define T4848(_,__)_ fp_asinh(vars[0]*-(c.l1*c.i)) __
+#define T4847(_,__)_ fp_asinh(vars[0]*-(c.l3*c.i)) __
+#define T1833(_,__)_ fp_asinh(vars[0]*c.l2) __
+#define T4843(_,__)_ fp_asinh(vars[0]*c.l2) __
+#define T1834(_,__)_ fp_asinh(vars[0]*c.lm1) __
+#define T4845(_,__)_ fp_asinh(vars[0]*c.lm1) __
+#define T4846(_,__)_ fp_asinh(vars[0]*c.lm2) __
+#define T1835(_,__)_ fp_asinh(vars[0]*c.lm2) __
+#define T4794(_,__)_ fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)) __
+#define T3058(_,__)_ fp_atan(-vars[0])+fp_atan(-vars[0]) __
+#define T5856(_,__)_ fp_atan(-vars[0])+fp_atan(-vars[0]) __
+#define T3059(_,__)_ fp_atan(-vars[0])+fp_atanh(-vars[0]) __
+#define T3060(_,__)_ fp_atan(-vars[0])+fp_cos(-vars[0]) __
+#define T5857(_,__)_ fp_atan(-vars[0])+fp_cos(-vars[0]) __
+#define T3061(_,__)_ fp_atan(-vars[0])+fp_cosh(-vars[0]) __
+#define T5858(_,__)_ fp_atan(-vars[0])+fp_cosh(-vars[0]) __
+#define T3062(_,__)_ fp_atan(-vars[0])+fp_exp(-vars[0]) __
+#define T5859(_,__)_ fp_atan(-vars[0])+fp_exp(-vars[0]) __
+#define T3063(_,__)_ fp_atan(-vars[0])+fp_log(-vars[0]) __
+#define T5860(_,__)_ fp_atan(-vars[0])+fp_log(-vars[0]) __
+#define T5861(_,__)_ fp_atan(-vars[0])+fp_sin(-vars[0]) __
+#define T3064(_,__)_ fp_atan(-vars[0])+fp_sin(-vars[0]) __
+#define T5862(_,__)_ fp_atan(-vars[0])+fp_sinh(-vars[0]) __
+#define T3065(_,__)_ fp_atan(-vars[0])+fp_sinh(-vars[0]) __
+#define T5863(_,__)_ fp_atan(-vars[0])+fp_tan(-vars[0]) __
+#define T3066(_,__)_ fp_atan(-vars[0])+fp_tan(-vars[0]) __
+#define T3067(_,__)_ fp_atan(-vars[0])+fp_tanh(-vars[0]) __
+#define T5864(_,__)_ fp_atan(-vars[0])+fp_tanh(-vars[0]) __
+#define T1920(_,__)_ fp_atan(-vars[0])-fp_acos(-vars[0]) __
+#define T4957(_,__)_ fp_atan(-vars[0])-fp_acos(-vars[0]) __
+#define T2108(_,__)_ fp_atan(-vars[0])-fp_acos(vars[0]) __
+#define T5107(_,__)_ fp_atan(-vars[0])-fp_acos(vars[0]) __
+#define T1921(_,__)_ fp_atan(-vars[0])-fp_acosh(-vars[0]) __
+#define T4958(_,__)_ fp_atan(-vars[0])-fp_acosh(-vars[0]) __
+#define T2109(_,__)_ fp_atan(-vars[0])-fp_acosh(vars[0]) __
+#define T5108(_,__)_ fp_atan(-vars[0])-fp_acosh(vars[0]) __
+#define T4959(_,__)_ fp_atan(-vars[0])-fp_asin(-vars[0]) __
+#define T1922(_,__)_ fp_atan(-vars[0])-fp_asin(-vars[0]) __
+#define T2110(_,__)_ fp_atan(-vars[0])-fp_asin(vars[0]) __
+#define T5109(_,__)_ fp_atan(-vars[0])-fp_asin(vars[0]) __
+#define T1923(_,__)_ fp_atan(-vars[0])-fp_asinh(-vars[0]) __
+#define T4960(_,__)_ fp_atan(-vars[0])-fp_asinh(-vars[0]) __
+#define T2111(_,__)_ fp_atan(-vars[0])-fp_asinh(vars[0]) __
+#define T5110(_,__)_ fp_atan(-vars[0])-fp_asinh(vars[0]) __
+#define T1924(_,__)_ fp_atan(-vars[0])-fp_atan(-vars[0]) __
+#define T4961(_,__)_ fp_atan(-vars[0])-fp_atan(-vars[0]) __
+#define T5111(_,__)_ fp_atan(-vars[0])-fp_atan(vars[0]) __
+#define T2112(_,__)_ fp_atan(-vars[0])-fp_atan(vars[0]) __
+#define T1925(_,__)_ fp_atan(-vars[0])-fp_atanh(-vars[0]) __
+#define T2113(_,__)_ fp_atan(-vars[0])-fp_atanh(vars[0]) __
+#define T1926(_,__)_ fp_atan(-vars[0])-fp_cos(-vars[0]) __
+#define T4962(_,__)_ fp_atan(-vars[0])-fp_cos(-vars[0]) __
+#define T2114(_,__)_ fp_atan(-vars[0])-fp_cos(vars[0]) __
+#define T5112(_,__)_ fp_atan(-vars[0])-fp_cos(vars[0]) __
+#define T1927(_,__)_ fp_atan(-vars[0])-fp_cosh(-vars[0]) __
+#define T4963(_,__)_ fp_atan(-vars[0])-fp_cosh(-vars[0]) __
+#define T2115(_,__)_ fp_atan(-vars[0])-fp_cosh(vars[0]) __
+#define T5113(_,__)_ fp_atan(-vars[0])-fp_cosh(vars[0]) __
+#define T1928(_,__)_ fp_atan(-vars[0])-fp_exp(-vars[0]) __
+#define T4964(_,__)_ fp_atan(-vars[0])-fp_exp(-vars[0]) __
+#define T5114(_,__)_ fp_atan(-vars[0])-fp_exp(vars[0]) __
+#define T2116(_,__)_ fp_atan(-vars[0])-fp_exp(vars[0]) __
+#define T4965(_,__)_ fp_atan(-vars[0])-fp_log(-vars[0]) __
+#define T1929(_,__)_ fp_atan(-vars[0])-fp_log(-vars[0]) __
+#define T2117(_,__)_ fp_atan(-vars[0])-fp_log(vars[0]) __
+#define T5115(_,__)_ fp_atan(-vars[0])-fp_log(vars[0]) __
+#define T1930(_,__)_ fp_atan(-vars[0])-fp_sin(-vars[0]) __
+#define T4966(_,__)_ fp_atan(-vars[0])-fp_sin(-vars[0]) __
+#define T5116(_,__)_ fp_atan(-vars[0])-fp_sin(vars[0]) __
+#define T2118(_,__)_ fp_atan(-vars[0])-fp_sin(vars[0]) __
+#define T1931(_,__)_ fp_atan(-vars[0])-fp_sinh(-vars[0]) __
+#define T4967(_,__)_ fp_atan(-vars[0])-fp_sinh(-vars[0]) __
+#define T2119(_,__)_ fp_atan(-vars[0])-fp_sinh(vars[0]) __
+#define T5117(_,__)_ fp_atan(-vars[0])-fp_sinh(vars[0]) __
+#define T1932(_,__)_ fp_atan(-vars[0])-fp_tan(-vars[0]) __
+#define T4968(_,__)_ fp_atan(-vars[0])-fp_tan(-vars[0]) __
+#define T2120(_,__)_ fp_atan(-vars[0])-fp_tan(vars[0]) __
+#define T5118(_,__)_ fp_atan(-vars[0])-fp_tan(vars[0]) __
+#define T1933(_,__)_ fp_atan(-vars[0])-fp_tanh(-vars[0]) __
+#define T4969(_,__)_ fp_atan(-vars[0])-fp_tanh(-vars[0]) __
+#define T2121(_,__)_ fp_atan(-vars[0])-fp_tanh(vars[0]) __
+#define T5119(_,__)_ fp_atan(-vars[0])-fp_tanh(vars[0]) __
+#define T4795(_,__)_ fp_atan(Value_t(-fp_abs(vars[0]))) __
+#define T1780(_,__)_ fp_atan(Value_t(-fp_abs(vars[0]))) __
+#define T1781(_,__)_ fp_atan(Value_t(fp_abs(vars[0]))) __
+#define T4796(_,__)_ fp_atan(Value_t(fp_abs(vars[0]))) __
+#define  T834(_,__)_ fp_atan(Value_t(fp_abs(vars[0]))) __
+#define T3971(_,__)_ fp_atan(Value_t(fp_abs(vars[0]))) __
+#define T3978(_,__)_ fp_atan(Value_t(fp_arg(vars[0]+c.l1))) __
+#define  T845(_,__)_ fp_atan(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T3984(_,__)_ fp_atan(Value_t(fp_imag(vars[0]))) __
+#define T3490(_,__)_ fp_atan(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3491(_,__)_ fp_atan(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3492(_,__)_ fp_atan(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3493(_,__)_ fp_atan(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1779(_,__)_ fp_atan(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define  T863(_,__)_ fp_atan(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T3997(_,__)_ fp_atan(Value_t(fp_real(vars[0]))) __
+#define  T436(_,__)_ fp_atan(c.l1_1)+vars[0] __
+#define  T823(_,__)_ fp_atan(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T821(_,__)_ fp_atan(fp_acos(vars[0])) __
+#define T3964(_,__)_ fp_atan(fp_acos(vars[0])) __
+#define T3965(_,__)_ fp_atan(fp_acosh(vars[0])) __
+#define  T822(_,__)_ fp_atan(fp_acosh(vars[0]+c.l0_6)) __
+#define  T827(_,__)_ fp_atan(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T824(_,__)_ fp_atan(fp_asin(vars[0])) __
+#define T3966(_,__)_ fp_atan(fp_asin(vars[0])) __
+#define  T826(_,__)_ fp_atan(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3967(_,__)_ fp_atan(fp_asinh(vars[0])) __
+#define  T825(_,__)_ fp_atan(fp_asinh(vars[0])) __
+#define T3969(_,__)_ fp_atan(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T832(_,__)_ fp_atan(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T833(_,__)_ fp_atan(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T831(_,__)_ fp_atan(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T828(_,__)_ fp_atan(fp_atan(vars[0])) __
+#define T3968(_,__)_ fp_atan(fp_atan(vars[0])) __
+#define  T829(_,__)_ fp_atan(fp_atan(vars[0]/vars[1])) __
+#define  T819(_,__)_ fp_atan(fp_atan2(vars[0],vars[1])) __
+#define  T830(_,__)_ fp_atan(fp_atanh(vars[0])) __
+#define T3970(_,__)_ fp_atan(fp_atanh(vars[0])) __
+#define  T837(_,__)_ fp_atan(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T836(_,__)_ fp_atan(fp_cbrt(vars[0])) __
+#define T3973(_,__)_ fp_atan(fp_cbrt(vars[0])) __
+#define T3991(_,__)_ fp_atan(fp_conj(vars[0])) __
+#define  T840(_,__)_ fp_atan(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T835(_,__)_ fp_atan(fp_cos(vars[0])) __
+#define T3972(_,__)_ fp_atan(fp_cos(vars[0])) __
+#define  T839(_,__)_ fp_atan(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3974(_,__)_ fp_atan(fp_cosh(vars[0])) __
+#define  T838(_,__)_ fp_atan(fp_cosh(vars[0])) __
+#define  T847(_,__)_ fp_atan(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T846(_,__)_ fp_atan(fp_exp(vars[0])) __
+#define T3977(_,__)_ fp_atan(fp_exp(vars[0])) __
+#define  T842(_,__)_ fp_atan(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3976(_,__)_ fp_atan(fp_exp2(vars[0])) __
+#define  T841(_,__)_ fp_atan(fp_exp2(vars[0])) __
+#define  T848(_,__)_ fp_atan(fp_hypot(c.l1,vars[0])) __
+#define T3980(_,__)_ fp_atan(fp_hypot(c.l1,vars[0])) __
+#define T3981(_,__)_ fp_atan(fp_hypot(c.l2,vars[0])) __
+#define  T849(_,__)_ fp_atan(fp_hypot(c.l2,vars[0])) __
+#define  T851(_,__)_ fp_atan(fp_hypot(vars[0],c.l1)) __
+#define T3982(_,__)_ fp_atan(fp_hypot(vars[0],c.l1)) __
+#define  T852(_,__)_ fp_atan(fp_hypot(vars[0],c.l2)) __
+#define T3983(_,__)_ fp_atan(fp_hypot(vars[0],c.l2)) __
+#define  T850(_,__)_ fp_atan(fp_hypot(vars[0],vars[1])) __
+#define T3979(_,__)_ fp_atan(fp_hypot(vars[0],vars[1])) __
+#define T3985(_,__)_ fp_atan(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T854(_,__)_ fp_atan(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define  T853(_,__)_ fp_atan(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define  T844(_,__)_ fp_atan(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T843(_,__)_ fp_atan(fp_inv(fp_cos(vars[0]))) __
+#define T3975(_,__)_ fp_atan(fp_inv(fp_cos(vars[0]))) __
+#define  T855(_,__)_ fp_atan(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3987(_,__)_ fp_atan(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T3988(_,__)_ fp_atan(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T856(_,__)_ fp_atan(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T3989(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define  T858(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T3990(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T859(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T857(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T3986(_,__)_ fp_atan(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T820(_,__)_ fp_atan(fp_inv(fp_sin(vars[0]))) __
+#define  T864(_,__)_ fp_atan(fp_inv(fp_tan(vars[0]))) __
+#define T3489(_,__)_ fp_atan(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T3992(_,__)_ fp_atan(fp_log(vars[0])) __
+#define  T861(_,__)_ fp_atan(fp_log(vars[0])) __
+#define  T862(_,__)_ fp_atan(fp_log10(vars[0])) __
+#define T3994(_,__)_ fp_atan(fp_log10(vars[0])) __
+#define T3993(_,__)_ fp_atan(fp_log2(vars[0])) __
+#define  T860(_,__)_ fp_atan(fp_log2(vars[0])) __
+#define T3996(_,__)_ fp_atan(fp_polar(vars[0],vars[1])) __
+#define T3995(_,__)_ fp_atan(fp_pow(vars[0],vars[1])) __
+#define  T865(_,__)_ fp_atan(fp_pow(vars[0],vars[1])) __
+#define  T869(_,__)_ fp_atan(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T866(_,__)_ fp_atan(fp_sin(vars[0])) __
+#define T3998(_,__)_ fp_atan(fp_sin(vars[0])) __
+#define  T868(_,__)_ fp_atan(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T867(_,__)_ fp_atan(fp_sinh(vars[0])) __
+#define T3999(_,__)_ fp_atan(fp_sinh(vars[0])) __
+#define  T871(_,__)_ fp_atan(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T870(_,__)_ fp_atan(fp_sqrt(vars[0])) __
+#define T4000(_,__)_ fp_atan(fp_sqrt(vars[0])) __
+#define  T875(_,__)_ fp_atan(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4001(_,__)_ fp_atan(fp_tan(vars[0])) __
+#define  T872(_,__)_ fp_atan(fp_tan(vars[0])) __
+#define  T874(_,__)_ fp_atan(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4002(_,__)_ fp_atan(fp_tanh(vars[0])) __
+#define  T873(_,__)_ fp_atan(fp_tanh(vars[0])) __
+#define T1776(_,__)_ fp_atan(vars[0]) __
+#define T4793(_,__)_ fp_atan(vars[0]) __
+#define T3162(_,__)_ fp_atan(vars[0])+fp_acos(-vars[0]) __
+#define T5935(_,__)_ fp_atan(vars[0])+fp_acos(-vars[0]) __
+#define T5936(_,__)_ fp_atan(vars[0])+fp_acosh(-vars[0]) __
+#define T3163(_,__)_ fp_atan(vars[0])+fp_acosh(-vars[0]) __
+#define T5937(_,__)_ fp_atan(vars[0])+fp_asin(-vars[0]) __
+#define T3164(_,__)_ fp_atan(vars[0])+fp_asin(-vars[0]) __
+#define T3165(_,__)_ fp_atan(vars[0])+fp_asinh(-vars[0]) __
+#define T5938(_,__)_ fp_atan(vars[0])+fp_asinh(-vars[0]) __
+#define T5939(_,__)_ fp_atan(vars[0])+fp_atan(-vars[0]) __
+#define T3166(_,__)_ fp_atan(vars[0])+fp_atan(-vars[0]) __
+#define T3346(_,__)_ fp_atan(vars[0])+fp_atan(vars[0]) __
+#define T6079(_,__)_ fp_atan(vars[0])+fp_atan(vars[0]) __
+#define T3167(_,__)_ fp_atan(vars[0])+fp_atanh(-vars[0]) __
+#define T3347(_,__)_ fp_atan(vars[0])+fp_atanh(vars[0]) __
+#define T3168(_,__)_ fp_atan(vars[0])+fp_cos(-vars[0]) __
+#define T5940(_,__)_ fp_atan(vars[0])+fp_cos(-vars[0]) __
+#define T3348(_,__)_ fp_atan(vars[0])+fp_cos(vars[0]) __
+#define T6080(_,__)_ fp_atan(vars[0])+fp_cos(vars[0]) __
+#define T3169(_,__)_ fp_atan(vars[0])+fp_cosh(-vars[0]) __
+#define T5941(_,__)_ fp_atan(vars[0])+fp_cosh(-vars[0]) __
+#define T6081(_,__)_ fp_atan(vars[0])+fp_cosh(vars[0]) __
+#define T3349(_,__)_ fp_atan(vars[0])+fp_cosh(vars[0]) __
+#define T5942(_,__)_ fp_atan(vars[0])+fp_exp(-vars[0]) __
+#define T3170(_,__)_ fp_atan(vars[0])+fp_exp(-vars[0]) __
+#define T3350(_,__)_ fp_atan(vars[0])+fp_exp(vars[0]) __
+#define T6082(_,__)_ fp_atan(vars[0])+fp_exp(vars[0]) __
+#define T3171(_,__)_ fp_atan(vars[0])+fp_log(-vars[0]) __
+#define T5943(_,__)_ fp_atan(vars[0])+fp_log(-vars[0]) __
+#define T6083(_,__)_ fp_atan(vars[0])+fp_log(vars[0]) __
+#define T3351(_,__)_ fp_atan(vars[0])+fp_log(vars[0]) __
+#define T3172(_,__)_ fp_atan(vars[0])+fp_sin(-vars[0]) __
+#define T5944(_,__)_ fp_atan(vars[0])+fp_sin(-vars[0]) __
+#define T6084(_,__)_ fp_atan(vars[0])+fp_sin(vars[0]) __
+#define T3352(_,__)_ fp_atan(vars[0])+fp_sin(vars[0]) __
+#define T5945(_,__)_ fp_atan(vars[0])+fp_sinh(-vars[0]) __
+#define T3173(_,__)_ fp_atan(vars[0])+fp_sinh(-vars[0]) __
+#define T6085(_,__)_ fp_atan(vars[0])+fp_sinh(vars[0]) __
+#define T3353(_,__)_ fp_atan(vars[0])+fp_sinh(vars[0]) __
+#define T5946(_,__)_ fp_atan(vars[0])+fp_tan(-vars[0]) __
+#define T3174(_,__)_ fp_atan(vars[0])+fp_tan(-vars[0]) __
+#define T6086(_,__)_ fp_atan(vars[0])+fp_tan(vars[0]) __
+#define T3354(_,__)_ fp_atan(vars[0])+fp_tan(vars[0]) __
+#define T5947(_,__)_ fp_atan(vars[0])+fp_tanh(-vars[0]) __
+#define T3175(_,__)_ fp_atan(vars[0])+fp_tanh(-vars[0]) __
+#define T6087(_,__)_ fp_atan(vars[0])+fp_tanh(vars[0]) __
+#define T3355(_,__)_ fp_atan(vars[0])+fp_tanh(vars[0]) __
+#define T2294(_,__)_ fp_atan(vars[0])-fp_acos(-vars[0]) __
+#define T5258(_,__)_ fp_atan(vars[0])-fp_acos(-vars[0]) __
+#define T2482(_,__)_ fp_atan(vars[0])-fp_acos(vars[0]) __
+#define T5409(_,__)_ fp_atan(vars[0])-fp_acos(vars[0]) __
+#define T2295(_,__)_ fp_atan(vars[0])-fp_acosh(-vars[0]) __
+#define T5259(_,__)_ fp_atan(vars[0])-fp_acosh(-vars[0]) __
+#define T2483(_,__)_ fp_atan(vars[0])-fp_acosh(vars[0]) __
+#define T5410(_,__)_ fp_atan(vars[0])-fp_acosh(vars[0]) __
+#define T5260(_,__)_ fp_atan(vars[0])-fp_asin(-vars[0]) __
+#define T2296(_,__)_ fp_atan(vars[0])-fp_asin(-vars[0]) __
+#define T2484(_,__)_ fp_atan(vars[0])-fp_asin(vars[0]) __
+#define T5411(_,__)_ fp_atan(vars[0])-fp_asin(vars[0]) __
+#define T5261(_,__)_ fp_atan(vars[0])-fp_asinh(-vars[0]) __
+#define T2297(_,__)_ fp_atan(vars[0])-fp_asinh(-vars[0]) __
+#define T5412(_,__)_ fp_atan(vars[0])-fp_asinh(vars[0]) __
+#define T2485(_,__)_ fp_atan(vars[0])-fp_asinh(vars[0]) __
+#define T2298(_,__)_ fp_atan(vars[0])-fp_atan(-vars[0]) __
+#define T5262(_,__)_ fp_atan(vars[0])-fp_atan(-vars[0]) __
+#define T2486(_,__)_ fp_atan(vars[0])-fp_atan(vars[0]) __
+#define T5413(_,__)_ fp_atan(vars[0])-fp_atan(vars[0]) __
+#define T2299(_,__)_ fp_atan(vars[0])-fp_atanh(-vars[0]) __
+#define T2487(_,__)_ fp_atan(vars[0])-fp_atanh(vars[0]) __
+#define T2300(_,__)_ fp_atan(vars[0])-fp_cos(-vars[0]) __
+#define T5263(_,__)_ fp_atan(vars[0])-fp_cos(-vars[0]) __
+#define T5414(_,__)_ fp_atan(vars[0])-fp_cos(vars[0]) __
+#define T2488(_,__)_ fp_atan(vars[0])-fp_cos(vars[0]) __
+#define T5264(_,__)_ fp_atan(vars[0])-fp_cosh(-vars[0]) __
+#define T2301(_,__)_ fp_atan(vars[0])-fp_cosh(-vars[0]) __
+#define T2489(_,__)_ fp_atan(vars[0])-fp_cosh(vars[0]) __
+#define T5415(_,__)_ fp_atan(vars[0])-fp_cosh(vars[0]) __
+#define T5265(_,__)_ fp_atan(vars[0])-fp_exp(-vars[0]) __
+#define T2302(_,__)_ fp_atan(vars[0])-fp_exp(-vars[0]) __
+#define T2490(_,__)_ fp_atan(vars[0])-fp_exp(vars[0]) __
+#define T5416(_,__)_ fp_atan(vars[0])-fp_exp(vars[0]) __
+#define T2303(_,__)_ fp_atan(vars[0])-fp_log(-vars[0]) __
+#define T5266(_,__)_ fp_atan(vars[0])-fp_log(-vars[0]) __
+#define T2491(_,__)_ fp_atan(vars[0])-fp_log(vars[0]) __
+#define T5417(_,__)_ fp_atan(vars[0])-fp_log(vars[0]) __
+#define T5267(_,__)_ fp_atan(vars[0])-fp_sin(-vars[0]) __
+#define T2304(_,__)_ fp_atan(vars[0])-fp_sin(-vars[0]) __
+#define T2492(_,__)_ fp_atan(vars[0])-fp_sin(vars[0]) __
+#define T5418(_,__)_ fp_atan(vars[0])-fp_sin(vars[0]) __
+#define T5268(_,__)_ fp_atan(vars[0])-fp_sinh(-vars[0]) __
+#define T2305(_,__)_ fp_atan(vars[0])-fp_sinh(-vars[0]) __
+#define T5419(_,__)_ fp_atan(vars[0])-fp_sinh(vars[0]) __
+#define T2493(_,__)_ fp_atan(vars[0])-fp_sinh(vars[0]) __
+#define T2306(_,__)_ fp_atan(vars[0])-fp_tan(-vars[0]) __
+#define T5269(_,__)_ fp_atan(vars[0])-fp_tan(-vars[0]) __
+#define T5420(_,__)_ fp_atan(vars[0])-fp_tan(vars[0]) __
+#define T2494(_,__)_ fp_atan(vars[0])-fp_tan(vars[0]) __
+#define T2307(_,__)_ fp_atan(vars[0])-fp_tanh(-vars[0]) __
+#define T5270(_,__)_ fp_atan(vars[0])-fp_tanh(-vars[0]) __
+#define T2495(_,__)_ fp_atan(vars[0])-fp_tanh(vars[0]) __
+#define T5421(_,__)_ fp_atan(vars[0])-fp_tanh(vars[0]) __
+#define T4849(_,__)_ fp_atan(vars[0]*(c.l1*c.i)) __
+#define T4851(_,__)_ fp_atan(vars[0]*(c.l3*c.i)) __
+#define T4855(_,__)_ fp_atan(vars[0]*-(c.l1*c.i)) __
+#define T4854(_,__)_ fp_atan(vars[0]*-(c.l3*c.i)) __
+#define T4850(_,__)_ fp_atan(vars[0]*c.l2) __
+#define T1836(_,__)_ fp_atan(vars[0]*c.l2) __
+#define T1837(_,__)_ fp_atan(vars[0]*c.lm1) __
+#define T4852(_,__)_ fp_atan(vars[0]*c.lm1) __
+#define T1838(_,__)_ fp_atan(vars[0]*c.lm2) __
+#define T4853(_,__)_ fp_atan(vars[0]*c.lm2) __
+#define T1777(_,__)_ fp_atan(vars[0]/vars[1]) __
+#define T3627(_,__)_ fp_atan2(-vars[0],-vars[1])+c.l10*fp_atan2(-vars[0],vars[1])+c.l20*fp_atan2(vars[0],-vars[1])+c.l30*fp_atan2(vars[0],vars[1]) __
+#define T3671(_,__)_ fp_atan2(c.l0,vars[0])+fp_pow((c.lm4*(vars[0]-c.l100)),c.l3_3) __
+#define  T437(_,__)_ fp_atan2(c.l5,c.l4)+vars[0] __
+#define T1767(_,__)_ fp_atan2(vars[0],vars[1]) __
+#define T3641(_,__)_ fp_atan2(vars[0],vars[1])+fp_max(vars[0],vars[1]) __
+#define T3068(_,__)_ fp_atanh(-vars[0])+fp_atanh(-vars[0]) __
+#define T3069(_,__)_ fp_atanh(-vars[0])+fp_cos(-vars[0]) __
+#define T3070(_,__)_ fp_atanh(-vars[0])+fp_cosh(-vars[0]) __
+#define T3071(_,__)_ fp_atanh(-vars[0])+fp_exp(-vars[0]) __
+#define T3072(_,__)_ fp_atanh(-vars[0])+fp_log(-vars[0]) __
+#define T3073(_,__)_ fp_atanh(-vars[0])+fp_sin(-vars[0]) __
+#define T3074(_,__)_ fp_atanh(-vars[0])+fp_sinh(-vars[0]) __
+#define T3075(_,__)_ fp_atanh(-vars[0])+fp_tan(-vars[0]) __
+#define T5865(_,__)_ fp_atanh(-vars[0])+fp_tan(-vars[0]) __
+#define T3076(_,__)_ fp_atanh(-vars[0])+fp_tanh(-vars[0]) __
+#define T5866(_,__)_ fp_atanh(-vars[0])+fp_tanh(-vars[0]) __
+#define T1934(_,__)_ fp_atanh(-vars[0])-fp_acos(-vars[0]) __
+#define T2122(_,__)_ fp_atanh(-vars[0])-fp_acos(vars[0]) __
+#define T4970(_,__)_ fp_atanh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5120(_,__)_ fp_atanh(-vars[0])-fp_acosh(vars[0]) __
+#define T1935(_,__)_ fp_atanh(-vars[0])-fp_asin(-vars[0]) __
+#define T2123(_,__)_ fp_atanh(-vars[0])-fp_asin(vars[0]) __
+#define T1936(_,__)_ fp_atanh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2124(_,__)_ fp_atanh(-vars[0])-fp_asinh(vars[0]) __
+#define T1937(_,__)_ fp_atanh(-vars[0])-fp_atan(-vars[0]) __
+#define T2125(_,__)_ fp_atanh(-vars[0])-fp_atan(vars[0]) __
+#define T1938(_,__)_ fp_atanh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2126(_,__)_ fp_atanh(-vars[0])-fp_atanh(vars[0]) __
+#define T1939(_,__)_ fp_atanh(-vars[0])-fp_cos(-vars[0]) __
+#define T2127(_,__)_ fp_atanh(-vars[0])-fp_cos(vars[0]) __
+#define T1940(_,__)_ fp_atanh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2128(_,__)_ fp_atanh(-vars[0])-fp_cosh(vars[0]) __
+#define T1941(_,__)_ fp_atanh(-vars[0])-fp_exp(-vars[0]) __
+#define T2129(_,__)_ fp_atanh(-vars[0])-fp_exp(vars[0]) __
+#define T1942(_,__)_ fp_atanh(-vars[0])-fp_log(-vars[0]) __
+#define T5121(_,__)_ fp_atanh(-vars[0])-fp_log(vars[0]) __
+#define T2130(_,__)_ fp_atanh(-vars[0])-fp_log(vars[0]) __
+#define T1943(_,__)_ fp_atanh(-vars[0])-fp_sin(-vars[0]) __
+#define T2131(_,__)_ fp_atanh(-vars[0])-fp_sin(vars[0]) __
+#define T1944(_,__)_ fp_atanh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2132(_,__)_ fp_atanh(-vars[0])-fp_sinh(vars[0]) __
+#define T1945(_,__)_ fp_atanh(-vars[0])-fp_tan(-vars[0]) __
+#define T4971(_,__)_ fp_atanh(-vars[0])-fp_tan(-vars[0]) __
+#define T2133(_,__)_ fp_atanh(-vars[0])-fp_tan(vars[0]) __
+#define T5122(_,__)_ fp_atanh(-vars[0])-fp_tan(vars[0]) __
+#define T1946(_,__)_ fp_atanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T4972(_,__)_ fp_atanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5123(_,__)_ fp_atanh(-vars[0])-fp_tanh(vars[0]) __
+#define T2134(_,__)_ fp_atanh(-vars[0])-fp_tanh(vars[0]) __
+#define  T888(_,__)_ fp_atanh(Value_t(fp_abs(vars[0]))) __
+#define T4011(_,__)_ fp_atanh(Value_t(fp_abs(vars[0]))) __
+#define T4017(_,__)_ fp_atanh(Value_t(fp_arg(vars[0]+c.l0_2))) __
+#define T4023(_,__)_ fp_atanh(Value_t(fp_imag(vars[0]))) __
+#define T3495(_,__)_ fp_atanh(Value_t(fp_less(vars[0],vars[1]))*c.l0_8) __
+#define T3496(_,__)_ fp_atanh(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.l0_4) __
+#define T3497(_,__)_ fp_atanh(Value_t(fp_less(vars[0],vars[1]))+c.lm0_4) __
+#define T4035(_,__)_ fp_atanh(Value_t(fp_real(vars[0]))) __
+#define  T441(_,__)_ fp_atanh(c.l0_7)+vars[0] __
+#define T4004(_,__)_ fp_atanh(fp_acos(vars[0])) __
+#define  T877(_,__)_ fp_atanh(fp_acos(vars[0]+c.l0_8)) __
+#define T4005(_,__)_ fp_atanh(fp_acosh(vars[0])) __
+#define  T878(_,__)_ fp_atanh(fp_acosh(vars[0]+c.l1_2)) __
+#define  T879(_,__)_ fp_atanh(fp_asin(vars[0])) __
+#define T4006(_,__)_ fp_atanh(fp_asin(vars[0])) __
+#define  T881(_,__)_ fp_atanh(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4007(_,__)_ fp_atanh(fp_asinh(vars[0])) __
+#define  T880(_,__)_ fp_atanh(fp_asinh(vars[0])) __
+#define  T883(_,__)_ fp_atanh(fp_atan((vars[0]+c.l0_4)/(vars[1]+c.l0_4))) __
+#define T4009(_,__)_ fp_atanh(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T886(_,__)_ fp_atanh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define  T887(_,__)_ fp_atanh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T885(_,__)_ fp_atanh(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4008(_,__)_ fp_atanh(fp_atan(vars[0])) __
+#define  T882(_,__)_ fp_atanh(fp_atan(vars[0])) __
+#define  T876(_,__)_ fp_atanh(fp_atan2((vars[0]+c.l0_4),(vars[1]+c.l0_4))) __
+#define T4010(_,__)_ fp_atanh(fp_atanh(vars[0])) __
+#define  T884(_,__)_ fp_atanh(fp_atanh(vars[0])) __
+#define  T890(_,__)_ fp_atanh(fp_cbrt(vars[0])) __
+#define T4012(_,__)_ fp_atanh(fp_cbrt(vars[0])) __
+#define T4028(_,__)_ fp_atanh(fp_conj(vars[0])) __
+#define  T889(_,__)_ fp_atanh(fp_cos(vars[0])) __
+#define T4013(_,__)_ fp_atanh(fp_cosh(vars[0])) __
+#define T4016(_,__)_ fp_atanh(fp_exp(vars[0])) __
+#define  T892(_,__)_ fp_atanh(fp_exp(vars[0]+c.lm0_2)) __
+#define T4015(_,__)_ fp_atanh(fp_exp2(vars[0])) __
+#define  T891(_,__)_ fp_atanh(fp_exp2(vars[0]+c.lm0_2)) __
+#define T4019(_,__)_ fp_atanh(fp_hypot(c.l1,vars[0])) __
+#define T4020(_,__)_ fp_atanh(fp_hypot(c.l2,vars[0])) __
+#define T4021(_,__)_ fp_atanh(fp_hypot(vars[0],c.l1)) __
+#define T4022(_,__)_ fp_atanh(fp_hypot(vars[0],c.l2)) __
+#define  T893(_,__)_ fp_atanh(fp_hypot(vars[0],vars[1])) __
+#define T4018(_,__)_ fp_atanh(fp_hypot(vars[0],vars[1])) __
+#define T4024(_,__)_ fp_atanh(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T894(_,__)_ fp_atanh(fp_inv(fp_atan2((vars[0]+c.lm0_2),(vars[1]+c.lm0_2)))) __
+#define T4014(_,__)_ fp_atanh(fp_inv(fp_cos(vars[0]))) __
+#define  T895(_,__)_ fp_atanh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4026(_,__)_ fp_atanh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T896(_,__)_ fp_atanh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define  T898(_,__)_ fp_atanh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define  T899(_,__)_ fp_atanh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4027(_,__)_ fp_atanh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define  T897(_,__)_ fp_atanh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4025(_,__)_ fp_atanh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4003(_,__)_ fp_atanh(fp_inv(fp_sin(vars[0]))) __
+#define T4032(_,__)_ fp_atanh(fp_inv(fp_tan(vars[0]))) __
+#define  T903(_,__)_ fp_atanh(fp_inv(fp_tan(vars[0]+c.l0_4))) __
+#define T3494(_,__)_ fp_atanh(fp_less(vars[0],vars[1]) ? c.lm0_3 : c.l0_7) __
+#define T4029(_,__)_ fp_atanh(fp_log(vars[0])) __
+#define  T901(_,__)_ fp_atanh(fp_log(vars[0])) __
+#define T4031(_,__)_ fp_atanh(fp_log10(vars[0])) __
+#define  T902(_,__)_ fp_atanh(fp_log10(vars[0])) __
+#define T4030(_,__)_ fp_atanh(fp_log2(vars[0])) __
+#define  T900(_,__)_ fp_atanh(fp_log2(vars[0]+c.l0_2)) __
+#define T4034(_,__)_ fp_atanh(fp_polar(vars[0],vars[1])) __
+#define T4033(_,__)_ fp_atanh(fp_pow(vars[0],vars[1])) __
+#define  T904(_,__)_ fp_atanh(fp_pow(vars[0],vars[1])) __
+#define  T907(_,__)_ fp_atanh(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4036(_,__)_ fp_atanh(fp_sin(vars[0])) __
+#define  T905(_,__)_ fp_atanh(fp_sin(vars[0])) __
+#define  T906(_,__)_ fp_atanh(fp_sinh(vars[0])) __
+#define T4037(_,__)_ fp_atanh(fp_sinh(vars[0])) __
+#define T4038(_,__)_ fp_atanh(fp_sqrt(vars[0])) __
+#define  T908(_,__)_ fp_atanh(fp_sqrt(vars[0])) __
+#define  T909(_,__)_ fp_atanh(fp_tan(vars[0])) __
+#define T4039(_,__)_ fp_atanh(fp_tan(vars[0])) __
+#define  T911(_,__)_ fp_atanh(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4040(_,__)_ fp_atanh(fp_tanh(vars[0])) __
+#define  T910(_,__)_ fp_atanh(fp_tanh(vars[0])) __
+#define T1778(_,__)_ fp_atanh(vars[0]) __
+#define T3176(_,__)_ fp_atanh(vars[0])+fp_acos(-vars[0]) __
+#define T5948(_,__)_ fp_atanh(vars[0])+fp_acosh(-vars[0]) __
+#define T3177(_,__)_ fp_atanh(vars[0])+fp_asin(-vars[0]) __
+#define T3178(_,__)_ fp_atanh(vars[0])+fp_asinh(-vars[0]) __
+#define T3179(_,__)_ fp_atanh(vars[0])+fp_atan(-vars[0]) __
+#define T3180(_,__)_ fp_atanh(vars[0])+fp_atanh(-vars[0]) __
+#define T3356(_,__)_ fp_atanh(vars[0])+fp_atanh(vars[0]) __
+#define T3181(_,__)_ fp_atanh(vars[0])+fp_cos(-vars[0]) __
+#define T3357(_,__)_ fp_atanh(vars[0])+fp_cos(vars[0]) __
+#define T3182(_,__)_ fp_atanh(vars[0])+fp_cosh(-vars[0]) __
+#define T3358(_,__)_ fp_atanh(vars[0])+fp_cosh(vars[0]) __
+#define T3183(_,__)_ fp_atanh(vars[0])+fp_exp(-vars[0]) __
+#define T3359(_,__)_ fp_atanh(vars[0])+fp_exp(vars[0]) __
+#define T3184(_,__)_ fp_atanh(vars[0])+fp_log(-vars[0]) __
+#define T6088(_,__)_ fp_atanh(vars[0])+fp_log(vars[0]) __
+#define T3360(_,__)_ fp_atanh(vars[0])+fp_log(vars[0]) __
+#define T3185(_,__)_ fp_atanh(vars[0])+fp_sin(-vars[0]) __
+#define T3361(_,__)_ fp_atanh(vars[0])+fp_sin(vars[0]) __
+#define T3186(_,__)_ fp_atanh(vars[0])+fp_sinh(-vars[0]) __
+#define T3362(_,__)_ fp_atanh(vars[0])+fp_sinh(vars[0]) __
+#define T5949(_,__)_ fp_atanh(vars[0])+fp_tan(-vars[0]) __
+#define T3187(_,__)_ fp_atanh(vars[0])+fp_tan(-vars[0]) __
+#define T6089(_,__)_ fp_atanh(vars[0])+fp_tan(vars[0]) __
+#define T3363(_,__)_ fp_atanh(vars[0])+fp_tan(vars[0]) __
+#define T3188(_,__)_ fp_atanh(vars[0])+fp_tanh(-vars[0]) __
+#define T5950(_,__)_ fp_atanh(vars[0])+fp_tanh(-vars[0]) __
+#define T6090(_,__)_ fp_atanh(vars[0])+fp_tanh(vars[0]) __
+#define T3364(_,__)_ fp_atanh(vars[0])+fp_tanh(vars[0]) __
+#define T2308(_,__)_ fp_atanh(vars[0])-fp_acos(-vars[0]) __
+#define T2496(_,__)_ fp_atanh(vars[0])-fp_acos(vars[0]) __
+#define T5271(_,__)_ fp_atanh(vars[0])-fp_acosh(-vars[0]) __
+#define T5422(_,__)_ fp_atanh(vars[0])-fp_acosh(vars[0]) __
+#define T2309(_,__)_ fp_atanh(vars[0])-fp_asin(-vars[0]) __
+#define T2497(_,__)_ fp_atanh(vars[0])-fp_asin(vars[0]) __
+#define T2310(_,__)_ fp_atanh(vars[0])-fp_asinh(-vars[0]) __
+#define T2498(_,__)_ fp_atanh(vars[0])-fp_asinh(vars[0]) __
+#define T2311(_,__)_ fp_atanh(vars[0])-fp_atan(-vars[0]) __
+#define T2499(_,__)_ fp_atanh(vars[0])-fp_atan(vars[0]) __
+#define T2312(_,__)_ fp_atanh(vars[0])-fp_atanh(-vars[0]) __
+#define T2500(_,__)_ fp_atanh(vars[0])-fp_atanh(vars[0]) __
+#define T2313(_,__)_ fp_atanh(vars[0])-fp_cos(-vars[0]) __
+#define T2501(_,__)_ fp_atanh(vars[0])-fp_cos(vars[0]) __
+#define T2314(_,__)_ fp_atanh(vars[0])-fp_cosh(-vars[0]) __
+#define T2502(_,__)_ fp_atanh(vars[0])-fp_cosh(vars[0]) __
+#define T2315(_,__)_ fp_atanh(vars[0])-fp_exp(-vars[0]) __
+#define T2503(_,__)_ fp_atanh(vars[0])-fp_exp(vars[0]) __
+#define T2316(_,__)_ fp_atanh(vars[0])-fp_log(-vars[0]) __
+#define T2504(_,__)_ fp_atanh(vars[0])-fp_log(vars[0]) __
+#define T5423(_,__)_ fp_atanh(vars[0])-fp_log(vars[0]) __
+#define T2317(_,__)_ fp_atanh(vars[0])-fp_sin(-vars[0]) __
+#define T2505(_,__)_ fp_atanh(vars[0])-fp_sin(vars[0]) __
+#define T2318(_,__)_ fp_atanh(vars[0])-fp_sinh(-vars[0]) __
+#define T2506(_,__)_ fp_atanh(vars[0])-fp_sinh(vars[0]) __
+#define T2319(_,__)_ fp_atanh(vars[0])-fp_tan(-vars[0]) __
+#define T5272(_,__)_ fp_atanh(vars[0])-fp_tan(-vars[0]) __
+#define T2507(_,__)_ fp_atanh(vars[0])-fp_tan(vars[0]) __
+#define T5424(_,__)_ fp_atanh(vars[0])-fp_tan(vars[0]) __
+#define T2320(_,__)_ fp_atanh(vars[0])-fp_tanh(-vars[0]) __
+#define T5273(_,__)_ fp_atanh(vars[0])-fp_tanh(-vars[0]) __
+#define T5425(_,__)_ fp_atanh(vars[0])-fp_tanh(vars[0]) __
+#define T2508(_,__)_ fp_atanh(vars[0])-fp_tanh(vars[0]) __
+#define T4856(_,__)_ fp_atanh(vars[0]*(c.l1*c.i)) __
+#define T4858(_,__)_ fp_atanh(vars[0]*(c.l3*c.i)) __
+#define T4861(_,__)_ fp_atanh(vars[0]*-(c.l1*c.i)) __
+#define T4860(_,__)_ fp_atanh(vars[0]*-(c.l3*c.i)) __
+#define T1839(_,__)_ fp_atanh(vars[0]*c.l2) __
+#define T4857(_,__)_ fp_atanh(vars[0]*c.l2) __
+#define T1840(_,__)_ fp_atanh(vars[0]*c.lm1) __
+#define T1841(_,__)_ fp_atanh(vars[0]*c.lm2) __
+#define T4859(_,__)_ fp_atanh(vars[0]*c.lm2) __
+#define T1040(_,__)_ fp_cbrt(Value_t(fp_abs(vars[0]))) __
+#define T4113(_,__)_ fp_cbrt(Value_t(fp_abs(vars[0]))) __
+#define T4117(_,__)_ fp_cbrt(Value_t(fp_arg(vars[0]))) __
+#define T1051(_,__)_ fp_cbrt(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4123(_,__)_ fp_cbrt(Value_t(fp_imag(vars[0]))) __
+#define T3504(_,__)_ fp_cbrt(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3505(_,__)_ fp_cbrt(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3506(_,__)_ fp_cbrt(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3507(_,__)_ fp_cbrt(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1785(_,__)_ fp_cbrt(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1069(_,__)_ fp_cbrt(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4137(_,__)_ fp_cbrt(Value_t(fp_real(vars[0]))) __
+#define  T442(_,__)_ fp_cbrt(c.l1_1)+vars[0] __
+#define T1030(_,__)_ fp_cbrt(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4105(_,__)_ fp_cbrt(fp_acos(vars[0])) __
+#define T1028(_,__)_ fp_cbrt(fp_acos(vars[0])) __
+#define T4106(_,__)_ fp_cbrt(fp_acosh(vars[0])) __
+#define T1029(_,__)_ fp_cbrt(fp_acosh(vars[0]+c.l0_6)) __
+#define T1034(_,__)_ fp_cbrt(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1031(_,__)_ fp_cbrt(fp_asin(vars[0])) __
+#define T4107(_,__)_ fp_cbrt(fp_asin(vars[0])) __
+#define T1033(_,__)_ fp_cbrt(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1032(_,__)_ fp_cbrt(fp_asinh(vars[0])) __
+#define T4108(_,__)_ fp_cbrt(fp_asinh(vars[0])) __
+#define T4110(_,__)_ fp_cbrt(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1039(_,__)_ fp_cbrt(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4112(_,__)_ fp_cbrt(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T1038(_,__)_ fp_cbrt(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1035(_,__)_ fp_cbrt(fp_atan(vars[0])) __
+#define T4109(_,__)_ fp_cbrt(fp_atan(vars[0])) __
+#define T1036(_,__)_ fp_cbrt(fp_atan(vars[0]/vars[1])) __
+#define T1026(_,__)_ fp_cbrt(fp_atan2(vars[0],vars[1])) __
+#define T4111(_,__)_ fp_cbrt(fp_atanh(vars[0])) __
+#define T1037(_,__)_ fp_cbrt(fp_atanh(vars[0])) __
+#define T1043(_,__)_ fp_cbrt(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4114(_,__)_ fp_cbrt(fp_cbrt(vars[0])) __
+#define T1042(_,__)_ fp_cbrt(fp_cbrt(vars[0])) __
+#define T4130(_,__)_ fp_cbrt(fp_conj(vars[0])) __
+#define T1046(_,__)_ fp_cbrt(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1041(_,__)_ fp_cbrt(fp_cos(vars[0])) __
+#define T1045(_,__)_ fp_cbrt(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1044(_,__)_ fp_cbrt(fp_cosh(vars[0])) __
+#define T4115(_,__)_ fp_cbrt(fp_cosh(vars[0])) __
+#define T1053(_,__)_ fp_cbrt(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1052(_,__)_ fp_cbrt(fp_exp(vars[0])) __
+#define T1048(_,__)_ fp_cbrt(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1047(_,__)_ fp_cbrt(fp_exp2(vars[0])) __
+#define T4116(_,__)_ fp_cbrt(fp_exp2(vars[0])) __
+#define T4119(_,__)_ fp_cbrt(fp_hypot(c.l1,vars[0])) __
+#define T1054(_,__)_ fp_cbrt(fp_hypot(c.l1,vars[0])) __
+#define T4120(_,__)_ fp_cbrt(fp_hypot(c.l2,vars[0])) __
+#define T1055(_,__)_ fp_cbrt(fp_hypot(c.l2,vars[0])) __
+#define T4121(_,__)_ fp_cbrt(fp_hypot(vars[0],c.l1)) __
+#define T1057(_,__)_ fp_cbrt(fp_hypot(vars[0],c.l1)) __
+#define T4122(_,__)_ fp_cbrt(fp_hypot(vars[0],c.l2)) __
+#define T1058(_,__)_ fp_cbrt(fp_hypot(vars[0],c.l2)) __
+#define T1056(_,__)_ fp_cbrt(fp_hypot(vars[0],vars[1])) __
+#define T4118(_,__)_ fp_cbrt(fp_hypot(vars[0],vars[1])) __
+#define T4124(_,__)_ fp_cbrt(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1060(_,__)_ fp_cbrt(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1059(_,__)_ fp_cbrt(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1050(_,__)_ fp_cbrt(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1049(_,__)_ fp_cbrt(fp_inv(fp_cos(vars[0]))) __
+#define T1061(_,__)_ fp_cbrt(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4126(_,__)_ fp_cbrt(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4127(_,__)_ fp_cbrt(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1062(_,__)_ fp_cbrt(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4128(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1064(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4129(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1065(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4125(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1063(_,__)_ fp_cbrt(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4104(_,__)_ fp_cbrt(fp_inv(fp_sin(vars[0]))) __
+#define T1027(_,__)_ fp_cbrt(fp_inv(fp_sin(vars[0]))) __
+#define T4134(_,__)_ fp_cbrt(fp_inv(fp_tan(vars[0]))) __
+#define T1070(_,__)_ fp_cbrt(fp_inv(fp_tan(vars[0]))) __
+#define T3503(_,__)_ fp_cbrt(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T4131(_,__)_ fp_cbrt(fp_log(vars[0])) __
+#define T1067(_,__)_ fp_cbrt(fp_log(vars[0]+c.l0_6)) __
+#define T4133(_,__)_ fp_cbrt(fp_log10(vars[0])) __
+#define T1068(_,__)_ fp_cbrt(fp_log10(vars[0]+c.l0_6)) __
+#define T4132(_,__)_ fp_cbrt(fp_log2(vars[0])) __
+#define T1066(_,__)_ fp_cbrt(fp_log2(vars[0]+c.l0_6)) __
+#define T4136(_,__)_ fp_cbrt(fp_polar(vars[0],vars[1])) __
+#define T4135(_,__)_ fp_cbrt(fp_pow(vars[0],vars[1])) __
+#define T1071(_,__)_ fp_cbrt(fp_pow(vars[0],vars[1])) __
+#define T1075(_,__)_ fp_cbrt(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4138(_,__)_ fp_cbrt(fp_sin(vars[0])) __
+#define T1072(_,__)_ fp_cbrt(fp_sin(vars[0])) __
+#define T1074(_,__)_ fp_cbrt(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4139(_,__)_ fp_cbrt(fp_sinh(vars[0])) __
+#define T1073(_,__)_ fp_cbrt(fp_sinh(vars[0])) __
+#define T1077(_,__)_ fp_cbrt(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4140(_,__)_ fp_cbrt(fp_sqrt(vars[0])) __
+#define T1076(_,__)_ fp_cbrt(fp_sqrt(vars[0])) __
+#define T1081(_,__)_ fp_cbrt(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4141(_,__)_ fp_cbrt(fp_tan(vars[0])) __
+#define T1078(_,__)_ fp_cbrt(fp_tan(vars[0])) __
+#define T1080(_,__)_ fp_cbrt(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4142(_,__)_ fp_cbrt(fp_tanh(vars[0])) __
+#define T1079(_,__)_ fp_cbrt(fp_tanh(vars[0])) __
+#define T1784(_,__)_ fp_cbrt(vars[0]) __
+#define T4797(_,__)_ fp_cbrt(vars[0]) __
+#define  T444(_,__)_ fp_ceil(-vars[0]) __
+#define  T519(_,__)_ fp_ceil(Value_t(fp_greater(vars[0],c.l4))) __
+#define T3514(_,__)_ fp_ceil(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3515(_,__)_ fp_ceil(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3516(_,__)_ fp_ceil(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3517(_,__)_ fp_ceil(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define  T443(_,__)_ fp_ceil(c.l1_1)+vars[0] __
+#define T3513(_,__)_ fp_ceil(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T3600(_,__)_ fp_ceil(vars[0]*(Value_t(fp_abs(vars[0]))-Value_t(fp_abs(vars[0]))-c.l1)) __
+#define T3690(_,__)_ fp_ceil(vars[0]+-(Value_t(fp_abs(vars[1]))+c.l1)) __
+#define T3681(_,__)_ fp_ceil(vars[0]+Value_t(fp_abs(fp_ceil(vars[1])))) __
+#define T3682(_,__)_ fp_ceil(vars[0]+Value_t(fp_abs(fp_floor(vars[1])))) __
+#define T3683(_,__)_ fp_ceil(vars[0]+Value_t(fp_abs(fp_int(vars[1])))) __
+#define T3685(_,__)_ fp_ceil(vars[0]+Value_t(fp_abs(fp_trunc(vars[1])))) __
+#define T3684(_,__)_ fp_ceil(vars[0]+Value_t(fp_abs(vars[1]))) __
+#define T3689(_,__)_ fp_ceil(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3691(_,__)_ fp_ceil(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3686(_,__)_ fp_ceil(vars[0]+fp_ceil(vars[1])) __
+#define T3687(_,__)_ fp_ceil(vars[0]+fp_floor(vars[1])) __
+#define T3688(_,__)_ fp_ceil(vars[0]+fp_int(vars[1])) __
+#define T3692(_,__)_ fp_ceil(vars[0]+fp_trunc(vars[1])) __
+#define T4380(_,__)_ fp_conj(Value_t(fp_abs(vars[0]))) __
+#define T4393(_,__)_ fp_conj(Value_t(fp_arg(vars[0]))) __
+#define T4390(_,__)_ fp_conj(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4399(_,__)_ fp_conj(Value_t(fp_imag(vars[0]))) __
+#define T4410(_,__)_ fp_conj(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4414(_,__)_ fp_conj(Value_t(fp_real(vars[0]))) __
+#define T4369(_,__)_ fp_conj(fp_acos(vars[0])) __
+#define T4370(_,__)_ fp_conj(fp_acosh(vars[0])) __
+#define T4371(_,__)_ fp_conj(fp_asin(vars[0])) __
+#define T4373(_,__)_ fp_conj(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4372(_,__)_ fp_conj(fp_asinh(vars[0])) __
+#define T4375(_,__)_ fp_conj(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4378(_,__)_ fp_conj(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4379(_,__)_ fp_conj(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4377(_,__)_ fp_conj(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4374(_,__)_ fp_conj(fp_atan(vars[0])) __
+#define T4376(_,__)_ fp_conj(fp_atanh(vars[0])) __
+#define T4382(_,__)_ fp_conj(fp_cbrt(vars[0])) __
+#define T4406(_,__)_ fp_conj(fp_conj(vars[0])) __
+#define T4385(_,__)_ fp_conj(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4381(_,__)_ fp_conj(fp_cos(vars[0])) __
+#define T4384(_,__)_ fp_conj(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4383(_,__)_ fp_conj(fp_cosh(vars[0])) __
+#define T4392(_,__)_ fp_conj(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4391(_,__)_ fp_conj(fp_exp(vars[0])) __
+#define T4388(_,__)_ fp_conj(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4387(_,__)_ fp_conj(fp_exp2(vars[0])) __
+#define T4395(_,__)_ fp_conj(fp_hypot(c.l1,vars[0])) __
+#define T4396(_,__)_ fp_conj(fp_hypot(c.l2,vars[0])) __
+#define T4397(_,__)_ fp_conj(fp_hypot(vars[0],c.l1)) __
+#define T4398(_,__)_ fp_conj(fp_hypot(vars[0],c.l2)) __
+#define T4394(_,__)_ fp_conj(fp_hypot(vars[0],vars[1])) __
+#define T4400(_,__)_ fp_conj(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T4389(_,__)_ fp_conj(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4386(_,__)_ fp_conj(fp_inv(fp_cos(vars[0]))) __
+#define T4402(_,__)_ fp_conj(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4403(_,__)_ fp_conj(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4404(_,__)_ fp_conj(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4405(_,__)_ fp_conj(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4401(_,__)_ fp_conj(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4368(_,__)_ fp_conj(fp_inv(fp_sin(vars[0]))) __
+#define T4411(_,__)_ fp_conj(fp_inv(fp_tan(vars[0]))) __
+#define T4407(_,__)_ fp_conj(fp_log(vars[0])) __
+#define T4409(_,__)_ fp_conj(fp_log10(vars[0])) __
+#define T4408(_,__)_ fp_conj(fp_log2(vars[0])) __
+#define T4413(_,__)_ fp_conj(fp_polar(vars[0],vars[1])) __
+#define T4412(_,__)_ fp_conj(fp_pow(vars[0],vars[1])) __
+#define T4418(_,__)_ fp_conj(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4415(_,__)_ fp_conj(fp_sin(vars[0])) __
+#define T4417(_,__)_ fp_conj(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4416(_,__)_ fp_conj(fp_sinh(vars[0])) __
+#define T4419(_,__)_ fp_conj(fp_sqrt(vars[0])) __
+#define T4420(_,__)_ fp_conj(fp_tan(vars[0])) __
+#define T4421(_,__)_ fp_conj(fp_tanh(vars[0])) __
+#define T4811(_,__)_ fp_conj(vars[0]) __
+#define  T560(_,__)_ fp_cos((vars[0]*fp_const_pi<Value_t>()/c.l180)*c.l4) __
+#define  T542(_,__)_ fp_cos(-vars[0]) __
+#define T3077(_,__)_ fp_cos(-vars[0])+fp_cos(-vars[0]) __
+#define T3078(_,__)_ fp_cos(-vars[0])+fp_cosh(-vars[0]) __
+#define T3079(_,__)_ fp_cos(-vars[0])+fp_exp(-vars[0]) __
+#define T3080(_,__)_ fp_cos(-vars[0])+fp_log(-vars[0]) __
+#define T5867(_,__)_ fp_cos(-vars[0])+fp_log(-vars[0]) __
+#define T3081(_,__)_ fp_cos(-vars[0])+fp_sin(-vars[0]) __
+#define T3082(_,__)_ fp_cos(-vars[0])+fp_sinh(-vars[0]) __
+#define T5868(_,__)_ fp_cos(-vars[0])+fp_tan(-vars[0]) __
+#define T3083(_,__)_ fp_cos(-vars[0])+fp_tan(-vars[0]) __
+#define T3084(_,__)_ fp_cos(-vars[0])+fp_tanh(-vars[0]) __
+#define T5869(_,__)_ fp_cos(-vars[0])+fp_tanh(-vars[0]) __
+#define T1947(_,__)_ fp_cos(-vars[0])-fp_acos(-vars[0]) __
+#define T4973(_,__)_ fp_cos(-vars[0])-fp_acos(-vars[0]) __
+#define T2135(_,__)_ fp_cos(-vars[0])-fp_acos(vars[0]) __
+#define T5124(_,__)_ fp_cos(-vars[0])-fp_acos(vars[0]) __
+#define T4974(_,__)_ fp_cos(-vars[0])-fp_acosh(-vars[0]) __
+#define T1948(_,__)_ fp_cos(-vars[0])-fp_acosh(-vars[0]) __
+#define T5125(_,__)_ fp_cos(-vars[0])-fp_acosh(vars[0]) __
+#define T2136(_,__)_ fp_cos(-vars[0])-fp_acosh(vars[0]) __
+#define T4975(_,__)_ fp_cos(-vars[0])-fp_asin(-vars[0]) __
+#define T1949(_,__)_ fp_cos(-vars[0])-fp_asin(-vars[0]) __
+#define T5126(_,__)_ fp_cos(-vars[0])-fp_asin(vars[0]) __
+#define T2137(_,__)_ fp_cos(-vars[0])-fp_asin(vars[0]) __
+#define T1950(_,__)_ fp_cos(-vars[0])-fp_asinh(-vars[0]) __
+#define T4976(_,__)_ fp_cos(-vars[0])-fp_asinh(-vars[0]) __
+#define T2138(_,__)_ fp_cos(-vars[0])-fp_asinh(vars[0]) __
+#define T5127(_,__)_ fp_cos(-vars[0])-fp_asinh(vars[0]) __
+#define T1951(_,__)_ fp_cos(-vars[0])-fp_atan(-vars[0]) __
+#define T4977(_,__)_ fp_cos(-vars[0])-fp_atan(-vars[0]) __
+#define T2139(_,__)_ fp_cos(-vars[0])-fp_atan(vars[0]) __
+#define T5128(_,__)_ fp_cos(-vars[0])-fp_atan(vars[0]) __
+#define T1952(_,__)_ fp_cos(-vars[0])-fp_atanh(-vars[0]) __
+#define T2140(_,__)_ fp_cos(-vars[0])-fp_atanh(vars[0]) __
+#define T1953(_,__)_ fp_cos(-vars[0])-fp_cos(-vars[0]) __
+#define T2141(_,__)_ fp_cos(-vars[0])-fp_cos(vars[0]) __
+#define T1954(_,__)_ fp_cos(-vars[0])-fp_cosh(-vars[0]) __
+#define T2142(_,__)_ fp_cos(-vars[0])-fp_cosh(vars[0]) __
+#define T1955(_,__)_ fp_cos(-vars[0])-fp_exp(-vars[0]) __
+#define T2143(_,__)_ fp_cos(-vars[0])-fp_exp(vars[0]) __
+#define T4978(_,__)_ fp_cos(-vars[0])-fp_log(-vars[0]) __
+#define T1956(_,__)_ fp_cos(-vars[0])-fp_log(-vars[0]) __
+#define T2144(_,__)_ fp_cos(-vars[0])-fp_log(vars[0]) __
+#define T5129(_,__)_ fp_cos(-vars[0])-fp_log(vars[0]) __
+#define T1957(_,__)_ fp_cos(-vars[0])-fp_sin(-vars[0]) __
+#define T2145(_,__)_ fp_cos(-vars[0])-fp_sin(vars[0]) __
+#define T1958(_,__)_ fp_cos(-vars[0])-fp_sinh(-vars[0]) __
+#define T2146(_,__)_ fp_cos(-vars[0])-fp_sinh(vars[0]) __
+#define T1959(_,__)_ fp_cos(-vars[0])-fp_tan(-vars[0]) __
+#define T4979(_,__)_ fp_cos(-vars[0])-fp_tan(-vars[0]) __
+#define T2147(_,__)_ fp_cos(-vars[0])-fp_tan(vars[0]) __
+#define T5130(_,__)_ fp_cos(-vars[0])-fp_tan(vars[0]) __
+#define T1960(_,__)_ fp_cos(-vars[0])-fp_tanh(-vars[0]) __
+#define T4980(_,__)_ fp_cos(-vars[0])-fp_tanh(-vars[0]) __
+#define T2148(_,__)_ fp_cos(-vars[0])-fp_tanh(vars[0]) __
+#define T5131(_,__)_ fp_cos(-vars[0])-fp_tanh(vars[0]) __
+#define  T412(_,__)_ fp_cos(Value_t(fp_abs(vars[0]))) __
+#define  T984(_,__)_ fp_cos(Value_t(fp_abs(vars[0]))) __
+#define T4082(_,__)_ fp_cos(Value_t(fp_arg(vars[0]))) __
+#define  T995(_,__)_ fp_cos(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4088(_,__)_ fp_cos(Value_t(fp_imag(vars[0]))) __
+#define T3499(_,__)_ fp_cos(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3500(_,__)_ fp_cos(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3501(_,__)_ fp_cos(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3502(_,__)_ fp_cos(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1788(_,__)_ fp_cos(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1013(_,__)_ fp_cos(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4100(_,__)_ fp_cos(Value_t(fp_real(vars[0]))) __
+#define  T485(_,__)_ fp_cos(c.l1_1)+vars[0] __
+#define  T486(_,__)_ fp_cos(d2r(c.l1_1))+vars[0] __
+#define  T595(_,__)_ fp_cos(d2r(vars[0]*c.l5)) __
+#define  T973(_,__)_ fp_cos(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T971(_,__)_ fp_cos(fp_acos(vars[0])) __
+#define T4073(_,__)_ fp_cos(fp_acos(vars[0])) __
+#define T3403(_,__)_ fp_cos(fp_acos(vars[0])) __
+#define T4074(_,__)_ fp_cos(fp_acosh(vars[0])) __
+#define  T972(_,__)_ fp_cos(fp_acosh(vars[0]+c.l0_6)) __
+#define  T977(_,__)_ fp_cos(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4075(_,__)_ fp_cos(fp_asin(vars[0])) __
+#define  T974(_,__)_ fp_cos(fp_asin(vars[0])) __
+#define  T976(_,__)_ fp_cos(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4076(_,__)_ fp_cos(fp_asinh(vars[0])) __
+#define  T975(_,__)_ fp_cos(fp_asinh(vars[0])) __
+#define T4078(_,__)_ fp_cos(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define  T982(_,__)_ fp_cos(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4079(_,__)_ fp_cos(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4080(_,__)_ fp_cos(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T983(_,__)_ fp_cos(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define  T981(_,__)_ fp_cos(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T978(_,__)_ fp_cos(fp_atan(vars[0])) __
+#define T4077(_,__)_ fp_cos(fp_atan(vars[0])) __
+#define  T979(_,__)_ fp_cos(fp_atan(vars[0]/vars[1])) __
+#define  T969(_,__)_ fp_cos(fp_atan2(vars[0],vars[1])) __
+#define  T980(_,__)_ fp_cos(fp_atanh(vars[0])) __
+#define  T987(_,__)_ fp_cos(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T986(_,__)_ fp_cos(fp_cbrt(vars[0])) __
+#define T4081(_,__)_ fp_cos(fp_cbrt(vars[0])) __
+#define T4095(_,__)_ fp_cos(fp_conj(vars[0])) __
+#define  T990(_,__)_ fp_cos(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T985(_,__)_ fp_cos(fp_cos(vars[0])) __
+#define  T989(_,__)_ fp_cos(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T988(_,__)_ fp_cos(fp_cosh(vars[0])) __
+#define  T997(_,__)_ fp_cos(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T996(_,__)_ fp_cos(fp_exp(vars[0])) __
+#define  T992(_,__)_ fp_cos(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T991(_,__)_ fp_cos(fp_exp2(vars[0])) __
+#define  T998(_,__)_ fp_cos(fp_hypot(c.l1,vars[0])) __
+#define T4084(_,__)_ fp_cos(fp_hypot(c.l1,vars[0])) __
+#define T4085(_,__)_ fp_cos(fp_hypot(c.l2,vars[0])) __
+#define  T999(_,__)_ fp_cos(fp_hypot(c.l2,vars[0])) __
+#define T1001(_,__)_ fp_cos(fp_hypot(vars[0],c.l1)) __
+#define T4086(_,__)_ fp_cos(fp_hypot(vars[0],c.l1)) __
+#define T1002(_,__)_ fp_cos(fp_hypot(vars[0],c.l2)) __
+#define T4087(_,__)_ fp_cos(fp_hypot(vars[0],c.l2)) __
+#define T4083(_,__)_ fp_cos(fp_hypot(vars[0],vars[1])) __
+#define T1000(_,__)_ fp_cos(fp_hypot(vars[0],vars[1])) __
+#define T4089(_,__)_ fp_cos(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1004(_,__)_ fp_cos(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1003(_,__)_ fp_cos(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define  T994(_,__)_ fp_cos(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T993(_,__)_ fp_cos(fp_inv(fp_cos(vars[0]))) __
+#define T4091(_,__)_ fp_cos(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1005(_,__)_ fp_cos(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1006(_,__)_ fp_cos(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4092(_,__)_ fp_cos(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4093(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1008(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1009(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4094(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4090(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1007(_,__)_ fp_cos(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T970(_,__)_ fp_cos(fp_inv(fp_sin(vars[0]))) __
+#define T1014(_,__)_ fp_cos(fp_inv(fp_tan(vars[0]))) __
+#define T3498(_,__)_ fp_cos(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T4096(_,__)_ fp_cos(fp_log(vars[0])) __
+#define T1011(_,__)_ fp_cos(fp_log(vars[0])) __
+#define T4098(_,__)_ fp_cos(fp_log10(vars[0])) __
+#define T1012(_,__)_ fp_cos(fp_log10(vars[0])) __
+#define T1010(_,__)_ fp_cos(fp_log2(vars[0])) __
+#define T4097(_,__)_ fp_cos(fp_log2(vars[0])) __
+#define T4099(_,__)_ fp_cos(fp_polar(vars[0],vars[1])) __
+#define T1015(_,__)_ fp_cos(fp_pow(vars[0],vars[1])) __
+#define T1019(_,__)_ fp_cos(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1016(_,__)_ fp_cos(fp_sin(vars[0])) __
+#define T1018(_,__)_ fp_cos(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1017(_,__)_ fp_cos(fp_sinh(vars[0])) __
+#define T1021(_,__)_ fp_cos(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3401(_,__)_ fp_cos(fp_sqrt(fp_cbrt(fp_pow(vars[0],c.l6))))+fp_sqrt(fp_cbrt(fp_pow(vars[0],c.l6))) __
+#define T1020(_,__)_ fp_cos(fp_sqrt(vars[0])) __
+#define T4101(_,__)_ fp_cos(fp_sqrt(vars[0])) __
+#define T1025(_,__)_ fp_cos(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4102(_,__)_ fp_cos(fp_tan(vars[0])) __
+#define T1022(_,__)_ fp_cos(fp_tan(vars[0])) __
+#define T1024(_,__)_ fp_cos(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1023(_,__)_ fp_cos(fp_tanh(vars[0])) __
+#define T4103(_,__)_ fp_cos(fp_tanh(vars[0])) __
+#define T1783(_,__)_ fp_cos(vars[0]) __
+#define T3640(_,__)_ fp_cos(vars[0])*fp_sin(c.l1-vars[0])*(c.l1-fp_cos(vars[0]/c.l2)*fp_sin(vars[0]*c.l5)) __
+#define T5951(_,__)_ fp_cos(vars[0])+fp_acos(-vars[0]) __
+#define T3189(_,__)_ fp_cos(vars[0])+fp_acos(-vars[0]) __
+#define T5952(_,__)_ fp_cos(vars[0])+fp_acosh(-vars[0]) __
+#define T3190(_,__)_ fp_cos(vars[0])+fp_acosh(-vars[0]) __
+#define T3191(_,__)_ fp_cos(vars[0])+fp_asin(-vars[0]) __
+#define T5953(_,__)_ fp_cos(vars[0])+fp_asin(-vars[0]) __
+#define T5954(_,__)_ fp_cos(vars[0])+fp_asinh(-vars[0]) __
+#define T3192(_,__)_ fp_cos(vars[0])+fp_asinh(-vars[0]) __
+#define T3193(_,__)_ fp_cos(vars[0])+fp_atan(-vars[0]) __
+#define T5955(_,__)_ fp_cos(vars[0])+fp_atan(-vars[0]) __
+#define T3194(_,__)_ fp_cos(vars[0])+fp_atanh(-vars[0]) __
+#define T3195(_,__)_ fp_cos(vars[0])+fp_cos(-vars[0]) __
+#define T3365(_,__)_ fp_cos(vars[0])+fp_cos(vars[0]) __
+#define T3196(_,__)_ fp_cos(vars[0])+fp_cosh(-vars[0]) __
+#define T3366(_,__)_ fp_cos(vars[0])+fp_cosh(vars[0]) __
+#define T3197(_,__)_ fp_cos(vars[0])+fp_exp(-vars[0]) __
+#define T3367(_,__)_ fp_cos(vars[0])+fp_exp(vars[0]) __
+#define  T570(_,__)_ fp_cos(vars[0])+fp_inv(fp_cos(vars[0])) __
+#define T3198(_,__)_ fp_cos(vars[0])+fp_log(-vars[0]) __
+#define T5956(_,__)_ fp_cos(vars[0])+fp_log(-vars[0]) __
+#define T6091(_,__)_ fp_cos(vars[0])+fp_log(vars[0]) __
+#define T3368(_,__)_ fp_cos(vars[0])+fp_log(vars[0]) __
+#define T3199(_,__)_ fp_cos(vars[0])+fp_sin(-vars[0]) __
+#define T3369(_,__)_ fp_cos(vars[0])+fp_sin(vars[0]) __
+#define T3200(_,__)_ fp_cos(vars[0])+fp_sinh(-vars[0]) __
+#define T3370(_,__)_ fp_cos(vars[0])+fp_sinh(vars[0]) __
+#define T3201(_,__)_ fp_cos(vars[0])+fp_tan(-vars[0]) __
+#define T5957(_,__)_ fp_cos(vars[0])+fp_tan(-vars[0]) __
+#define T6092(_,__)_ fp_cos(vars[0])+fp_tan(vars[0]) __
+#define T3371(_,__)_ fp_cos(vars[0])+fp_tan(vars[0]) __
+#define T3202(_,__)_ fp_cos(vars[0])+fp_tanh(-vars[0]) __
+#define T5958(_,__)_ fp_cos(vars[0])+fp_tanh(-vars[0]) __
+#define T6093(_,__)_ fp_cos(vars[0])+fp_tanh(vars[0]) __
+#define T3372(_,__)_ fp_cos(vars[0])+fp_tanh(vars[0]) __
+#define T5274(_,__)_ fp_cos(vars[0])-fp_acos(-vars[0]) __
+#define T2321(_,__)_ fp_cos(vars[0])-fp_acos(-vars[0]) __
+#define T2509(_,__)_ fp_cos(vars[0])-fp_acos(vars[0]) __
+#define T5426(_,__)_ fp_cos(vars[0])-fp_acos(vars[0]) __
+#define T2322(_,__)_ fp_cos(vars[0])-fp_acosh(-vars[0]) __
+#define T5275(_,__)_ fp_cos(vars[0])-fp_acosh(-vars[0]) __
+#define T5427(_,__)_ fp_cos(vars[0])-fp_acosh(vars[0]) __
+#define T2510(_,__)_ fp_cos(vars[0])-fp_acosh(vars[0]) __
+#define T5276(_,__)_ fp_cos(vars[0])-fp_asin(-vars[0]) __
+#define T2323(_,__)_ fp_cos(vars[0])-fp_asin(-vars[0]) __
+#define T5428(_,__)_ fp_cos(vars[0])-fp_asin(vars[0]) __
+#define T2511(_,__)_ fp_cos(vars[0])-fp_asin(vars[0]) __
+#define T5277(_,__)_ fp_cos(vars[0])-fp_asinh(-vars[0]) __
+#define T2324(_,__)_ fp_cos(vars[0])-fp_asinh(-vars[0]) __
+#define T5429(_,__)_ fp_cos(vars[0])-fp_asinh(vars[0]) __
+#define T2512(_,__)_ fp_cos(vars[0])-fp_asinh(vars[0]) __
+#define T5278(_,__)_ fp_cos(vars[0])-fp_atan(-vars[0]) __
+#define T2325(_,__)_ fp_cos(vars[0])-fp_atan(-vars[0]) __
+#define T2513(_,__)_ fp_cos(vars[0])-fp_atan(vars[0]) __
+#define T5430(_,__)_ fp_cos(vars[0])-fp_atan(vars[0]) __
+#define T2326(_,__)_ fp_cos(vars[0])-fp_atanh(-vars[0]) __
+#define T2514(_,__)_ fp_cos(vars[0])-fp_atanh(vars[0]) __
+#define T2327(_,__)_ fp_cos(vars[0])-fp_cos(-vars[0]) __
+#define T2515(_,__)_ fp_cos(vars[0])-fp_cos(vars[0]) __
+#define T2328(_,__)_ fp_cos(vars[0])-fp_cosh(-vars[0]) __
+#define T2516(_,__)_ fp_cos(vars[0])-fp_cosh(vars[0]) __
+#define T2329(_,__)_ fp_cos(vars[0])-fp_exp(-vars[0]) __
+#define T2517(_,__)_ fp_cos(vars[0])-fp_exp(vars[0]) __
+#define T2330(_,__)_ fp_cos(vars[0])-fp_log(-vars[0]) __
+#define T5279(_,__)_ fp_cos(vars[0])-fp_log(-vars[0]) __
+#define T2518(_,__)_ fp_cos(vars[0])-fp_log(vars[0]) __
+#define T5431(_,__)_ fp_cos(vars[0])-fp_log(vars[0]) __
+#define T2331(_,__)_ fp_cos(vars[0])-fp_sin(-vars[0]) __
+#define T2519(_,__)_ fp_cos(vars[0])-fp_sin(vars[0]) __
+#define T2332(_,__)_ fp_cos(vars[0])-fp_sinh(-vars[0]) __
+#define T2520(_,__)_ fp_cos(vars[0])-fp_sinh(vars[0]) __
+#define T2333(_,__)_ fp_cos(vars[0])-fp_tan(-vars[0]) __
+#define T5280(_,__)_ fp_cos(vars[0])-fp_tan(-vars[0]) __
+#define T5432(_,__)_ fp_cos(vars[0])-fp_tan(vars[0]) __
+#define T2521(_,__)_ fp_cos(vars[0])-fp_tan(vars[0]) __
+#define T5281(_,__)_ fp_cos(vars[0])-fp_tanh(-vars[0]) __
+#define T2334(_,__)_ fp_cos(vars[0])-fp_tanh(-vars[0]) __
+#define T5433(_,__)_ fp_cos(vars[0])-fp_tanh(vars[0]) __
+#define T2522(_,__)_ fp_cos(vars[0])-fp_tanh(vars[0]) __
+#define T4862(_,__)_ fp_cos(vars[0]*(c.l1*c.i)) __
+#define T4863(_,__)_ fp_cos(vars[0]*(c.l3*c.i)) __
+#define T3601(_,__)_ fp_cos(vars[0]*(fp_truth(c.l1) ? c.lm1 : c.l0)) __
+#define T4865(_,__)_ fp_cos(vars[0]*-(c.l1*c.i)) __
+#define T4864(_,__)_ fp_cos(vars[0]*-(c.l3*c.i)) __
+#define T1842(_,__)_ fp_cos(vars[0]*c.l2) __
+#define T1843(_,__)_ fp_cos(vars[0]*c.lm1) __
+#define T1844(_,__)_ fp_cos(vars[0]*c.lm2) __
+#define  T543(_,__)_ fp_cosh(-vars[0]) __
+#define T3085(_,__)_ fp_cosh(-vars[0])+fp_cosh(-vars[0]) __
+#define T3086(_,__)_ fp_cosh(-vars[0])+fp_exp(-vars[0]) __
+#define T3087(_,__)_ fp_cosh(-vars[0])+fp_log(-vars[0]) __
+#define T5870(_,__)_ fp_cosh(-vars[0])+fp_log(-vars[0]) __
+#define T3088(_,__)_ fp_cosh(-vars[0])+fp_sin(-vars[0]) __
+#define T3089(_,__)_ fp_cosh(-vars[0])+fp_sinh(-vars[0]) __
+#define T5871(_,__)_ fp_cosh(-vars[0])+fp_tan(-vars[0]) __
+#define T3090(_,__)_ fp_cosh(-vars[0])+fp_tan(-vars[0]) __
+#define T5872(_,__)_ fp_cosh(-vars[0])+fp_tanh(-vars[0]) __
+#define T3091(_,__)_ fp_cosh(-vars[0])+fp_tanh(-vars[0]) __
+#define T1961(_,__)_ fp_cosh(-vars[0])-fp_acos(-vars[0]) __
+#define T4981(_,__)_ fp_cosh(-vars[0])-fp_acos(-vars[0]) __
+#define T5132(_,__)_ fp_cosh(-vars[0])-fp_acos(vars[0]) __
+#define T2149(_,__)_ fp_cosh(-vars[0])-fp_acos(vars[0]) __
+#define T4982(_,__)_ fp_cosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T1962(_,__)_ fp_cosh(-vars[0])-fp_acosh(-vars[0]) __
+#define T2150(_,__)_ fp_cosh(-vars[0])-fp_acosh(vars[0]) __
+#define T5133(_,__)_ fp_cosh(-vars[0])-fp_acosh(vars[0]) __
+#define T4983(_,__)_ fp_cosh(-vars[0])-fp_asin(-vars[0]) __
+#define T1963(_,__)_ fp_cosh(-vars[0])-fp_asin(-vars[0]) __
+#define T2151(_,__)_ fp_cosh(-vars[0])-fp_asin(vars[0]) __
+#define T5134(_,__)_ fp_cosh(-vars[0])-fp_asin(vars[0]) __
+#define T1964(_,__)_ fp_cosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T4984(_,__)_ fp_cosh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2152(_,__)_ fp_cosh(-vars[0])-fp_asinh(vars[0]) __
+#define T5135(_,__)_ fp_cosh(-vars[0])-fp_asinh(vars[0]) __
+#define T4985(_,__)_ fp_cosh(-vars[0])-fp_atan(-vars[0]) __
+#define T1965(_,__)_ fp_cosh(-vars[0])-fp_atan(-vars[0]) __
+#define T2153(_,__)_ fp_cosh(-vars[0])-fp_atan(vars[0]) __
+#define T5136(_,__)_ fp_cosh(-vars[0])-fp_atan(vars[0]) __
+#define T1966(_,__)_ fp_cosh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2154(_,__)_ fp_cosh(-vars[0])-fp_atanh(vars[0]) __
+#define T1967(_,__)_ fp_cosh(-vars[0])-fp_cos(-vars[0]) __
+#define T2155(_,__)_ fp_cosh(-vars[0])-fp_cos(vars[0]) __
+#define T1968(_,__)_ fp_cosh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2156(_,__)_ fp_cosh(-vars[0])-fp_cosh(vars[0]) __
+#define T1969(_,__)_ fp_cosh(-vars[0])-fp_exp(-vars[0]) __
+#define T2157(_,__)_ fp_cosh(-vars[0])-fp_exp(vars[0]) __
+#define T1970(_,__)_ fp_cosh(-vars[0])-fp_log(-vars[0]) __
+#define T4986(_,__)_ fp_cosh(-vars[0])-fp_log(-vars[0]) __
+#define T2158(_,__)_ fp_cosh(-vars[0])-fp_log(vars[0]) __
+#define T5137(_,__)_ fp_cosh(-vars[0])-fp_log(vars[0]) __
+#define T1971(_,__)_ fp_cosh(-vars[0])-fp_sin(-vars[0]) __
+#define T2159(_,__)_ fp_cosh(-vars[0])-fp_sin(vars[0]) __
+#define T1972(_,__)_ fp_cosh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2160(_,__)_ fp_cosh(-vars[0])-fp_sinh(vars[0]) __
+#define T4987(_,__)_ fp_cosh(-vars[0])-fp_tan(-vars[0]) __
+#define T1973(_,__)_ fp_cosh(-vars[0])-fp_tan(-vars[0]) __
+#define T5138(_,__)_ fp_cosh(-vars[0])-fp_tan(vars[0]) __
+#define T2161(_,__)_ fp_cosh(-vars[0])-fp_tan(vars[0]) __
+#define T1974(_,__)_ fp_cosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T4988(_,__)_ fp_cosh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5139(_,__)_ fp_cosh(-vars[0])-fp_tanh(vars[0]) __
+#define T2162(_,__)_ fp_cosh(-vars[0])-fp_tanh(vars[0]) __
+#define  T413(_,__)_ fp_cosh(Value_t(fp_abs(vars[0]))) __
+#define T1097(_,__)_ fp_cosh(Value_t(fp_abs(vars[0]))) __
+#define T4152(_,__)_ fp_cosh(Value_t(fp_arg(vars[0]))) __
+#define T1108(_,__)_ fp_cosh(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4158(_,__)_ fp_cosh(Value_t(fp_imag(vars[0]))) __
+#define T3509(_,__)_ fp_cosh(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3510(_,__)_ fp_cosh(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3511(_,__)_ fp_cosh(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3512(_,__)_ fp_cosh(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1787(_,__)_ fp_cosh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1126(_,__)_ fp_cosh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4170(_,__)_ fp_cosh(Value_t(fp_real(vars[0]))) __
+#define  T487(_,__)_ fp_cosh(c.l1_1)+vars[0] __
+#define  T488(_,__)_ fp_cosh(d2r(c.l1_1))+vars[0] __
+#define T1086(_,__)_ fp_cosh(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4143(_,__)_ fp_cosh(fp_acos(vars[0])) __
+#define T1084(_,__)_ fp_cosh(fp_acos(vars[0])) __
+#define T4144(_,__)_ fp_cosh(fp_acosh(vars[0])) __
+#define  T426(_,__)_ fp_cosh(fp_acosh(vars[0])) __
+#define T1085(_,__)_ fp_cosh(fp_acosh(vars[0]+c.l0_6)) __
+#define T1090(_,__)_ fp_cosh(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4145(_,__)_ fp_cosh(fp_asin(vars[0])) __
+#define T1087(_,__)_ fp_cosh(fp_asin(vars[0])) __
+#define T1089(_,__)_ fp_cosh(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4146(_,__)_ fp_cosh(fp_asinh(vars[0])) __
+#define T3632(_,__)_ fp_cosh(fp_asinh(vars[0])) __
+#define  T434(_,__)_ fp_cosh(fp_asinh(vars[0])) __
+#define T1088(_,__)_ fp_cosh(fp_asinh(vars[0])) __
+#define T4148(_,__)_ fp_cosh(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1095(_,__)_ fp_cosh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4149(_,__)_ fp_cosh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4150(_,__)_ fp_cosh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1096(_,__)_ fp_cosh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1094(_,__)_ fp_cosh(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4147(_,__)_ fp_cosh(fp_atan(vars[0])) __
+#define T1091(_,__)_ fp_cosh(fp_atan(vars[0])) __
+#define T1092(_,__)_ fp_cosh(fp_atan(vars[0]/vars[1])) __
+#define T1082(_,__)_ fp_cosh(fp_atan2(vars[0],vars[1])) __
+#define T1093(_,__)_ fp_cosh(fp_atanh(vars[0])) __
+#define T1100(_,__)_ fp_cosh(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1099(_,__)_ fp_cosh(fp_cbrt(vars[0])) __
+#define T4151(_,__)_ fp_cosh(fp_cbrt(vars[0])) __
+#define T4165(_,__)_ fp_cosh(fp_conj(vars[0])) __
+#define T1103(_,__)_ fp_cosh(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1098(_,__)_ fp_cosh(fp_cos(vars[0])) __
+#define T1102(_,__)_ fp_cosh(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1101(_,__)_ fp_cosh(fp_cosh(vars[0])) __
+#define T1110(_,__)_ fp_cosh(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1109(_,__)_ fp_cosh(fp_exp(vars[0])) __
+#define T1105(_,__)_ fp_cosh(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1104(_,__)_ fp_cosh(fp_exp2(vars[0])) __
+#define T4154(_,__)_ fp_cosh(fp_hypot(c.l1,vars[0])) __
+#define T1111(_,__)_ fp_cosh(fp_hypot(c.l1,vars[0])) __
+#define T4155(_,__)_ fp_cosh(fp_hypot(c.l2,vars[0])) __
+#define T1112(_,__)_ fp_cosh(fp_hypot(c.l2,vars[0])) __
+#define T1114(_,__)_ fp_cosh(fp_hypot(vars[0],c.l1)) __
+#define T4156(_,__)_ fp_cosh(fp_hypot(vars[0],c.l1)) __
+#define T1115(_,__)_ fp_cosh(fp_hypot(vars[0],c.l2)) __
+#define T4157(_,__)_ fp_cosh(fp_hypot(vars[0],c.l2)) __
+#define T1113(_,__)_ fp_cosh(fp_hypot(vars[0],vars[1])) __
+#define T4153(_,__)_ fp_cosh(fp_hypot(vars[0],vars[1])) __
+#define T4159(_,__)_ fp_cosh(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1117(_,__)_ fp_cosh(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1116(_,__)_ fp_cosh(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1107(_,__)_ fp_cosh(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1106(_,__)_ fp_cosh(fp_inv(fp_cos(vars[0]))) __
+#define T4161(_,__)_ fp_cosh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1118(_,__)_ fp_cosh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4162(_,__)_ fp_cosh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1119(_,__)_ fp_cosh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4163(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1121(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1122(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4164(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1120(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4160(_,__)_ fp_cosh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1083(_,__)_ fp_cosh(fp_inv(fp_sin(vars[0]))) __
+#define T1127(_,__)_ fp_cosh(fp_inv(fp_tan(vars[0]))) __
+#define T3508(_,__)_ fp_cosh(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T1124(_,__)_ fp_cosh(fp_log(vars[0])) __
+#define T4166(_,__)_ fp_cosh(fp_log(vars[0])) __
+#define T4168(_,__)_ fp_cosh(fp_log10(vars[0])) __
+#define T1125(_,__)_ fp_cosh(fp_log10(vars[0])) __
+#define T1123(_,__)_ fp_cosh(fp_log2(vars[0])) __
+#define T4167(_,__)_ fp_cosh(fp_log2(vars[0])) __
+#define T4169(_,__)_ fp_cosh(fp_polar(vars[0],vars[1])) __
+#define T3633(_,__)_ fp_cosh(fp_pow(vars[0],c.l2))+fp_tanh(fp_pow(vars[1],c.l2)) __
+#define T1128(_,__)_ fp_cosh(fp_pow(vars[0],vars[1])) __
+#define T1132(_,__)_ fp_cosh(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1129(_,__)_ fp_cosh(fp_sin(vars[0])) __
+#define T1131(_,__)_ fp_cosh(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1130(_,__)_ fp_cosh(fp_sinh(vars[0])) __
+#define T1134(_,__)_ fp_cosh(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3402(_,__)_ fp_cosh(fp_sqrt(fp_cbrt(fp_pow(vars[0],c.l6))))+fp_sqrt(fp_cbrt(fp_pow(vars[0],c.l6))) __
+#define T4171(_,__)_ fp_cosh(fp_sqrt(vars[0])) __
+#define T1133(_,__)_ fp_cosh(fp_sqrt(vars[0])) __
+#define T1138(_,__)_ fp_cosh(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1135(_,__)_ fp_cosh(fp_tan(vars[0])) __
+#define T4172(_,__)_ fp_cosh(fp_tan(vars[0])) __
+#define T1137(_,__)_ fp_cosh(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4173(_,__)_ fp_cosh(fp_tanh(vars[0])) __
+#define T1136(_,__)_ fp_cosh(fp_tanh(vars[0])) __
+#define T3414(_,__)_ fp_cosh(fp_truth(c.l1) ? fp_asinh(vars[0]) : c.l0) __
+#define T1786(_,__)_ fp_cosh(vars[0]) __
+#define T5959(_,__)_ fp_cosh(vars[0])+fp_acos(-vars[0]) __
+#define T3203(_,__)_ fp_cosh(vars[0])+fp_acos(-vars[0]) __
+#define T3204(_,__)_ fp_cosh(vars[0])+fp_acosh(-vars[0]) __
+#define T5960(_,__)_ fp_cosh(vars[0])+fp_acosh(-vars[0]) __
+#define T3205(_,__)_ fp_cosh(vars[0])+fp_asin(-vars[0]) __
+#define T5961(_,__)_ fp_cosh(vars[0])+fp_asin(-vars[0]) __
+#define T5962(_,__)_ fp_cosh(vars[0])+fp_asinh(-vars[0]) __
+#define T3206(_,__)_ fp_cosh(vars[0])+fp_asinh(-vars[0]) __
+#define T5963(_,__)_ fp_cosh(vars[0])+fp_atan(-vars[0]) __
+#define T3207(_,__)_ fp_cosh(vars[0])+fp_atan(-vars[0]) __
+#define T3208(_,__)_ fp_cosh(vars[0])+fp_atanh(-vars[0]) __
+#define T3209(_,__)_ fp_cosh(vars[0])+fp_cos(-vars[0]) __
+#define T3210(_,__)_ fp_cosh(vars[0])+fp_cosh(-vars[0]) __
+#define T3373(_,__)_ fp_cosh(vars[0])+fp_cosh(vars[0]) __
+#define T3211(_,__)_ fp_cosh(vars[0])+fp_exp(-vars[0]) __
+#define T3374(_,__)_ fp_cosh(vars[0])+fp_exp(vars[0]) __
+#define T5964(_,__)_ fp_cosh(vars[0])+fp_log(-vars[0]) __
+#define T3212(_,__)_ fp_cosh(vars[0])+fp_log(-vars[0]) __
+#define T3375(_,__)_ fp_cosh(vars[0])+fp_log(vars[0]) __
+#define T6094(_,__)_ fp_cosh(vars[0])+fp_log(vars[0]) __
+#define T3213(_,__)_ fp_cosh(vars[0])+fp_sin(-vars[0]) __
+#define T3376(_,__)_ fp_cosh(vars[0])+fp_sin(vars[0]) __
+#define T3214(_,__)_ fp_cosh(vars[0])+fp_sinh(-vars[0]) __
+#define T3377(_,__)_ fp_cosh(vars[0])+fp_sinh(vars[0]) __
+#define T3215(_,__)_ fp_cosh(vars[0])+fp_tan(-vars[0]) __
+#define T5965(_,__)_ fp_cosh(vars[0])+fp_tan(-vars[0]) __
+#define T6095(_,__)_ fp_cosh(vars[0])+fp_tan(vars[0]) __
+#define T3378(_,__)_ fp_cosh(vars[0])+fp_tan(vars[0]) __
+#define T5966(_,__)_ fp_cosh(vars[0])+fp_tanh(-vars[0]) __
+#define T3216(_,__)_ fp_cosh(vars[0])+fp_tanh(-vars[0]) __
+#define T6096(_,__)_ fp_cosh(vars[0])+fp_tanh(vars[0]) __
+#define T3379(_,__)_ fp_cosh(vars[0])+fp_tanh(vars[0]) __
+#define T2335(_,__)_ fp_cosh(vars[0])-fp_acos(-vars[0]) __
+#define T5282(_,__)_ fp_cosh(vars[0])-fp_acos(-vars[0]) __
+#define T2523(_,__)_ fp_cosh(vars[0])-fp_acos(vars[0]) __
+#define T5434(_,__)_ fp_cosh(vars[0])-fp_acos(vars[0]) __
+#define T2336(_,__)_ fp_cosh(vars[0])-fp_acosh(-vars[0]) __
+#define T5283(_,__)_ fp_cosh(vars[0])-fp_acosh(-vars[0]) __
+#define T2524(_,__)_ fp_cosh(vars[0])-fp_acosh(vars[0]) __
+#define T5435(_,__)_ fp_cosh(vars[0])-fp_acosh(vars[0]) __
+#define T5284(_,__)_ fp_cosh(vars[0])-fp_asin(-vars[0]) __
+#define T2337(_,__)_ fp_cosh(vars[0])-fp_asin(-vars[0]) __
+#define T2525(_,__)_ fp_cosh(vars[0])-fp_asin(vars[0]) __
+#define T5436(_,__)_ fp_cosh(vars[0])-fp_asin(vars[0]) __
+#define T5285(_,__)_ fp_cosh(vars[0])-fp_asinh(-vars[0]) __
+#define T2338(_,__)_ fp_cosh(vars[0])-fp_asinh(-vars[0]) __
+#define T2526(_,__)_ fp_cosh(vars[0])-fp_asinh(vars[0]) __
+#define T5437(_,__)_ fp_cosh(vars[0])-fp_asinh(vars[0]) __
+#define T2339(_,__)_ fp_cosh(vars[0])-fp_atan(-vars[0]) __
+#define T5286(_,__)_ fp_cosh(vars[0])-fp_atan(-vars[0]) __
+#define T2527(_,__)_ fp_cosh(vars[0])-fp_atan(vars[0]) __
+#define T5438(_,__)_ fp_cosh(vars[0])-fp_atan(vars[0]) __
+#define T2340(_,__)_ fp_cosh(vars[0])-fp_atanh(-vars[0]) __
+#define T2528(_,__)_ fp_cosh(vars[0])-fp_atanh(vars[0]) __
+#define T2341(_,__)_ fp_cosh(vars[0])-fp_cos(-vars[0]) __
+#define T2529(_,__)_ fp_cosh(vars[0])-fp_cos(vars[0]) __
+#define T2342(_,__)_ fp_cosh(vars[0])-fp_cosh(-vars[0]) __
+#define T2530(_,__)_ fp_cosh(vars[0])-fp_cosh(vars[0]) __
+#define T2343(_,__)_ fp_cosh(vars[0])-fp_exp(-vars[0]) __
+#define T2531(_,__)_ fp_cosh(vars[0])-fp_exp(vars[0]) __
+#define T5287(_,__)_ fp_cosh(vars[0])-fp_log(-vars[0]) __
+#define T2344(_,__)_ fp_cosh(vars[0])-fp_log(-vars[0]) __
+#define T5439(_,__)_ fp_cosh(vars[0])-fp_log(vars[0]) __
+#define T2532(_,__)_ fp_cosh(vars[0])-fp_log(vars[0]) __
+#define T2345(_,__)_ fp_cosh(vars[0])-fp_sin(-vars[0]) __
+#define T2533(_,__)_ fp_cosh(vars[0])-fp_sin(vars[0]) __
+#define T2346(_,__)_ fp_cosh(vars[0])-fp_sinh(-vars[0]) __
+#define T2534(_,__)_ fp_cosh(vars[0])-fp_sinh(vars[0]) __
+#define T2347(_,__)_ fp_cosh(vars[0])-fp_tan(-vars[0]) __
+#define T5288(_,__)_ fp_cosh(vars[0])-fp_tan(-vars[0]) __
+#define T5440(_,__)_ fp_cosh(vars[0])-fp_tan(vars[0]) __
+#define T2535(_,__)_ fp_cosh(vars[0])-fp_tan(vars[0]) __
+#define T2348(_,__)_ fp_cosh(vars[0])-fp_tanh(-vars[0]) __
+#define T5289(_,__)_ fp_cosh(vars[0])-fp_tanh(-vars[0]) __
+#define T2536(_,__)_ fp_cosh(vars[0])-fp_tanh(vars[0]) __
+#define T5441(_,__)_ fp_cosh(vars[0])-fp_tanh(vars[0]) __
+#define T4866(_,__)_ fp_cosh(vars[0]*(c.l1*c.i)) __
+#define T4867(_,__)_ fp_cosh(vars[0]*(c.l3*c.i)) __
+#define T3602(_,__)_ fp_cosh(vars[0]*(fp_truth(c.l1) ? c.lm1 : c.l0)) __
+#define T4869(_,__)_ fp_cosh(vars[0]*-(c.l1*c.i)) __
+#define T4868(_,__)_ fp_cosh(vars[0]*-(c.l3*c.i)) __
+#define T1845(_,__)_ fp_cosh(vars[0]*c.l2) __
+#define T1846(_,__)_ fp_cosh(vars[0]*c.lm1) __
+#define T1847(_,__)_ fp_cosh(vars[0]*c.lm2) __
+#define  T160(_,__)_ fp_equal(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T167(_,__)_ fp_equal((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T165(_,__)_ fp_equal((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T166(_,__)_ fp_equal((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T164(_,__)_ fp_equal((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T161(_,__)_ fp_equal((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T159(_,__)_ fp_equal((vars[0]+c.l4+vars[1]),c.l6) __
+#define  T232(_,__)_ fp_equal(Value_t(fp_not(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)) __
+#define   T55(_,__)_ fp_equal(Value_t(fp_not(vars[0])),c.l1) __
+#define T3420(_,__)_ fp_equal(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3421(_,__)_ fp_equal(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3419(_,__)_ fp_equal(fp_pow(vars[0],c.l2),c.l25) __
+#define T3418(_,__)_ fp_equal(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3417(_,__)_ fp_equal(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3416(_,__)_ fp_equal(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T1793(_,__)_ fp_equal(vars[0],vars[1]) __
+#define  T304(_,__)_ fp_equal(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T162(_,__)_ fp_equal(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T163(_,__)_ fp_equal(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define T3092(_,__)_ fp_exp(-vars[0])+fp_exp(-vars[0]) __
+#define T5873(_,__)_ fp_exp(-vars[0])+fp_log(-vars[0]) __
+#define T3093(_,__)_ fp_exp(-vars[0])+fp_log(-vars[0]) __
+#define T3094(_,__)_ fp_exp(-vars[0])+fp_sin(-vars[0]) __
+#define T3095(_,__)_ fp_exp(-vars[0])+fp_sinh(-vars[0]) __
+#define T5874(_,__)_ fp_exp(-vars[0])+fp_tan(-vars[0]) __
+#define T3096(_,__)_ fp_exp(-vars[0])+fp_tan(-vars[0]) __
+#define T5875(_,__)_ fp_exp(-vars[0])+fp_tanh(-vars[0]) __
+#define T3097(_,__)_ fp_exp(-vars[0])+fp_tanh(-vars[0]) __
+#define T1975(_,__)_ fp_exp(-vars[0])-fp_acos(-vars[0]) __
+#define T4989(_,__)_ fp_exp(-vars[0])-fp_acos(-vars[0]) __
+#define T2163(_,__)_ fp_exp(-vars[0])-fp_acos(vars[0]) __
+#define T5140(_,__)_ fp_exp(-vars[0])-fp_acos(vars[0]) __
+#define T1976(_,__)_ fp_exp(-vars[0])-fp_acosh(-vars[0]) __
+#define T4990(_,__)_ fp_exp(-vars[0])-fp_acosh(-vars[0]) __
+#define T5141(_,__)_ fp_exp(-vars[0])-fp_acosh(vars[0]) __
+#define T2164(_,__)_ fp_exp(-vars[0])-fp_acosh(vars[0]) __
+#define T4991(_,__)_ fp_exp(-vars[0])-fp_asin(-vars[0]) __
+#define T1977(_,__)_ fp_exp(-vars[0])-fp_asin(-vars[0]) __
+#define T5142(_,__)_ fp_exp(-vars[0])-fp_asin(vars[0]) __
+#define T2165(_,__)_ fp_exp(-vars[0])-fp_asin(vars[0]) __
+#define T1978(_,__)_ fp_exp(-vars[0])-fp_asinh(-vars[0]) __
+#define T4992(_,__)_ fp_exp(-vars[0])-fp_asinh(-vars[0]) __
+#define T2166(_,__)_ fp_exp(-vars[0])-fp_asinh(vars[0]) __
+#define T5143(_,__)_ fp_exp(-vars[0])-fp_asinh(vars[0]) __
+#define T1979(_,__)_ fp_exp(-vars[0])-fp_atan(-vars[0]) __
+#define T4993(_,__)_ fp_exp(-vars[0])-fp_atan(-vars[0]) __
+#define T2167(_,__)_ fp_exp(-vars[0])-fp_atan(vars[0]) __
+#define T5144(_,__)_ fp_exp(-vars[0])-fp_atan(vars[0]) __
+#define T1980(_,__)_ fp_exp(-vars[0])-fp_atanh(-vars[0]) __
+#define T2168(_,__)_ fp_exp(-vars[0])-fp_atanh(vars[0]) __
+#define T1981(_,__)_ fp_exp(-vars[0])-fp_cos(-vars[0]) __
+#define T2169(_,__)_ fp_exp(-vars[0])-fp_cos(vars[0]) __
+#define T1982(_,__)_ fp_exp(-vars[0])-fp_cosh(-vars[0]) __
+#define T2170(_,__)_ fp_exp(-vars[0])-fp_cosh(vars[0]) __
+#define T1983(_,__)_ fp_exp(-vars[0])-fp_exp(-vars[0]) __
+#define T2171(_,__)_ fp_exp(-vars[0])-fp_exp(vars[0]) __
+#define T1984(_,__)_ fp_exp(-vars[0])-fp_log(-vars[0]) __
+#define T4994(_,__)_ fp_exp(-vars[0])-fp_log(-vars[0]) __
+#define T2172(_,__)_ fp_exp(-vars[0])-fp_log(vars[0]) __
+#define T5145(_,__)_ fp_exp(-vars[0])-fp_log(vars[0]) __
+#define T1985(_,__)_ fp_exp(-vars[0])-fp_sin(-vars[0]) __
+#define T2173(_,__)_ fp_exp(-vars[0])-fp_sin(vars[0]) __
+#define T1986(_,__)_ fp_exp(-vars[0])-fp_sinh(-vars[0]) __
+#define T2174(_,__)_ fp_exp(-vars[0])-fp_sinh(vars[0]) __
+#define T1987(_,__)_ fp_exp(-vars[0])-fp_tan(-vars[0]) __
+#define T4995(_,__)_ fp_exp(-vars[0])-fp_tan(-vars[0]) __
+#define T2175(_,__)_ fp_exp(-vars[0])-fp_tan(vars[0]) __
+#define T5146(_,__)_ fp_exp(-vars[0])-fp_tan(vars[0]) __
+#define T1988(_,__)_ fp_exp(-vars[0])-fp_tanh(-vars[0]) __
+#define T4996(_,__)_ fp_exp(-vars[0])-fp_tanh(-vars[0]) __
+#define T5147(_,__)_ fp_exp(-vars[0])-fp_tanh(vars[0]) __
+#define T2176(_,__)_ fp_exp(-vars[0])-fp_tanh(vars[0]) __
+#define T1266(_,__)_ fp_exp(Value_t(fp_abs(vars[0]))) __
+#define T4245(_,__)_ fp_exp(Value_t(fp_arg(vars[0]))) __
+#define T1277(_,__)_ fp_exp(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4251(_,__)_ fp_exp(Value_t(fp_imag(vars[0]))) __
+#define T3529(_,__)_ fp_exp(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3530(_,__)_ fp_exp(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3531(_,__)_ fp_exp(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3532(_,__)_ fp_exp(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1795(_,__)_ fp_exp(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1295(_,__)_ fp_exp(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4263(_,__)_ fp_exp(Value_t(fp_real(vars[0]))) __
+#define  T495(_,__)_ fp_exp(c.l1_1)+vars[0] __
+#define T1255(_,__)_ fp_exp(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4236(_,__)_ fp_exp(fp_acos(vars[0])) __
+#define T1253(_,__)_ fp_exp(fp_acos(vars[0])) __
+#define T4237(_,__)_ fp_exp(fp_acosh(vars[0])) __
+#define T1254(_,__)_ fp_exp(fp_acosh(vars[0]+c.l0_6)) __
+#define T1259(_,__)_ fp_exp(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1256(_,__)_ fp_exp(fp_asin(vars[0])) __
+#define T4238(_,__)_ fp_exp(fp_asin(vars[0])) __
+#define T1258(_,__)_ fp_exp(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1257(_,__)_ fp_exp(fp_asinh(vars[0])) __
+#define T4239(_,__)_ fp_exp(fp_asinh(vars[0])) __
+#define T4241(_,__)_ fp_exp(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4242(_,__)_ fp_exp(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T1264(_,__)_ fp_exp(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4243(_,__)_ fp_exp(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1265(_,__)_ fp_exp(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1263(_,__)_ fp_exp(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1260(_,__)_ fp_exp(fp_atan(vars[0])) __
+#define T4240(_,__)_ fp_exp(fp_atan(vars[0])) __
+#define T1261(_,__)_ fp_exp(fp_atan(vars[0]/vars[1])) __
+#define T1251(_,__)_ fp_exp(fp_atan2(vars[0],vars[1])) __
+#define T1262(_,__)_ fp_exp(fp_atanh(vars[0])) __
+#define T1269(_,__)_ fp_exp(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1268(_,__)_ fp_exp(fp_cbrt(vars[0])) __
+#define T4244(_,__)_ fp_exp(fp_cbrt(vars[0])) __
+#define T4258(_,__)_ fp_exp(fp_conj(vars[0])) __
+#define T1272(_,__)_ fp_exp(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1267(_,__)_ fp_exp(fp_cos(vars[0])) __
+#define T1271(_,__)_ fp_exp(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1270(_,__)_ fp_exp(fp_cosh(vars[0])) __
+#define T1279(_,__)_ fp_exp(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1278(_,__)_ fp_exp(fp_exp(vars[0])) __
+#define T1274(_,__)_ fp_exp(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1273(_,__)_ fp_exp(fp_exp2(vars[0])) __
+#define T1280(_,__)_ fp_exp(fp_hypot(c.l1,vars[0])) __
+#define T4247(_,__)_ fp_exp(fp_hypot(c.l1,vars[0])) __
+#define T4248(_,__)_ fp_exp(fp_hypot(c.l2,vars[0])) __
+#define T1281(_,__)_ fp_exp(fp_hypot(c.l2,vars[0])) __
+#define T4249(_,__)_ fp_exp(fp_hypot(vars[0],c.l1)) __
+#define T1283(_,__)_ fp_exp(fp_hypot(vars[0],c.l1)) __
+#define T4250(_,__)_ fp_exp(fp_hypot(vars[0],c.l2)) __
+#define T1284(_,__)_ fp_exp(fp_hypot(vars[0],c.l2)) __
+#define T1282(_,__)_ fp_exp(fp_hypot(vars[0],vars[1])) __
+#define T4246(_,__)_ fp_exp(fp_hypot(vars[0],vars[1])) __
+#define T4252(_,__)_ fp_exp(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1286(_,__)_ fp_exp(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1285(_,__)_ fp_exp(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1276(_,__)_ fp_exp(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1275(_,__)_ fp_exp(fp_inv(fp_cos(vars[0]))) __
+#define T4254(_,__)_ fp_exp(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1287(_,__)_ fp_exp(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1288(_,__)_ fp_exp(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4255(_,__)_ fp_exp(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4256(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1290(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1291(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4257(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4253(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1289(_,__)_ fp_exp(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1252(_,__)_ fp_exp(fp_inv(fp_sin(vars[0]))) __
+#define T1296(_,__)_ fp_exp(fp_inv(fp_tan(vars[0]))) __
+#define T3528(_,__)_ fp_exp(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define  T532(_,__)_ fp_exp(fp_log(fp_acos(vars[0]))) __
+#define T1293(_,__)_ fp_exp(fp_log(vars[0])) __
+#define  T531(_,__)_ fp_exp(fp_log(vars[0])) __
+#define T4259(_,__)_ fp_exp(fp_log(vars[0])) __
+#define T4261(_,__)_ fp_exp(fp_log10(vars[0])) __
+#define T1294(_,__)_ fp_exp(fp_log10(vars[0])) __
+#define T4260(_,__)_ fp_exp(fp_log2(vars[0])) __
+#define  T528(_,__)_ fp_exp(fp_log2(vars[0])) __
+#define T1292(_,__)_ fp_exp(fp_log2(vars[0])) __
+#define T4262(_,__)_ fp_exp(fp_polar(vars[0],vars[1])) __
+#define T1297(_,__)_ fp_exp(fp_pow(vars[0],vars[1])) __
+#define T1301(_,__)_ fp_exp(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1298(_,__)_ fp_exp(fp_sin(vars[0])) __
+#define T1300(_,__)_ fp_exp(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1299(_,__)_ fp_exp(fp_sinh(vars[0])) __
+#define T1303(_,__)_ fp_exp(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1302(_,__)_ fp_exp(fp_sqrt(vars[0])) __
+#define T4264(_,__)_ fp_exp(fp_sqrt(vars[0])) __
+#define T1307(_,__)_ fp_exp(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4265(_,__)_ fp_exp(fp_tan(vars[0])) __
+#define T1304(_,__)_ fp_exp(fp_tan(vars[0])) __
+#define T1306(_,__)_ fp_exp(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4266(_,__)_ fp_exp(fp_tanh(vars[0])) __
+#define T1305(_,__)_ fp_exp(fp_tanh(vars[0])) __
+#define T1794(_,__)_ fp_exp(vars[0]) __
+#define T3461(_,__)_ fp_exp(vars[0])*fp_exp(vars[1]+vars[2]) __
+#define T5967(_,__)_ fp_exp(vars[0])+fp_acos(-vars[0]) __
+#define T3217(_,__)_ fp_exp(vars[0])+fp_acos(-vars[0]) __
+#define T3218(_,__)_ fp_exp(vars[0])+fp_acosh(-vars[0]) __
+#define T5968(_,__)_ fp_exp(vars[0])+fp_acosh(-vars[0]) __
+#define T3219(_,__)_ fp_exp(vars[0])+fp_asin(-vars[0]) __
+#define T5969(_,__)_ fp_exp(vars[0])+fp_asin(-vars[0]) __
+#define T3220(_,__)_ fp_exp(vars[0])+fp_asinh(-vars[0]) __
+#define T5970(_,__)_ fp_exp(vars[0])+fp_asinh(-vars[0]) __
+#define T5971(_,__)_ fp_exp(vars[0])+fp_atan(-vars[0]) __
+#define T3221(_,__)_ fp_exp(vars[0])+fp_atan(-vars[0]) __
+#define T3222(_,__)_ fp_exp(vars[0])+fp_atanh(-vars[0]) __
+#define T3223(_,__)_ fp_exp(vars[0])+fp_cos(-vars[0]) __
+#define T3224(_,__)_ fp_exp(vars[0])+fp_cosh(-vars[0]) __
+#define T3225(_,__)_ fp_exp(vars[0])+fp_exp(-vars[0]) __
+#define T3380(_,__)_ fp_exp(vars[0])+fp_exp(vars[0]) __
+#define T3655(_,__)_ fp_exp(vars[0])+fp_floor(vars[0])+fp_int(vars[0])+fp_log(vars[0])+fp_log10(vars[0])+fp_max(vars[0],vars[1])+fp_min(vars[0],vars[1])+fp_inv(fp_cos(vars[0]))+fp_sin(vars[0])+fp_sinh(vars[0])+fp_sqrt(vars[0])+fp_tan(vars[0])+fp_tanh(vars[0])+fp_ceil(vars[1])+fp_trunc(vars[1]) __
+#define T5972(_,__)_ fp_exp(vars[0])+fp_log(-vars[0]) __
+#define T3226(_,__)_ fp_exp(vars[0])+fp_log(-vars[0]) __
+#define T3381(_,__)_ fp_exp(vars[0])+fp_log(vars[0]) __
+#define T6097(_,__)_ fp_exp(vars[0])+fp_log(vars[0]) __
+#define T3227(_,__)_ fp_exp(vars[0])+fp_sin(-vars[0]) __
+#define T3382(_,__)_ fp_exp(vars[0])+fp_sin(vars[0]) __
+#define T3228(_,__)_ fp_exp(vars[0])+fp_sinh(-vars[0]) __
+#define T3383(_,__)_ fp_exp(vars[0])+fp_sinh(vars[0]) __
+#define T5973(_,__)_ fp_exp(vars[0])+fp_tan(-vars[0]) __
+#define T3229(_,__)_ fp_exp(vars[0])+fp_tan(-vars[0]) __
+#define T6098(_,__)_ fp_exp(vars[0])+fp_tan(vars[0]) __
+#define T3384(_,__)_ fp_exp(vars[0])+fp_tan(vars[0]) __
+#define T5974(_,__)_ fp_exp(vars[0])+fp_tanh(-vars[0]) __
+#define T3230(_,__)_ fp_exp(vars[0])+fp_tanh(-vars[0]) __
+#define T6099(_,__)_ fp_exp(vars[0])+fp_tanh(vars[0]) __
+#define T3385(_,__)_ fp_exp(vars[0])+fp_tanh(vars[0]) __
+#define T2349(_,__)_ fp_exp(vars[0])-fp_acos(-vars[0]) __
+#define T5290(_,__)_ fp_exp(vars[0])-fp_acos(-vars[0]) __
+#define T5442(_,__)_ fp_exp(vars[0])-fp_acos(vars[0]) __
+#define T2537(_,__)_ fp_exp(vars[0])-fp_acos(vars[0]) __
+#define T2350(_,__)_ fp_exp(vars[0])-fp_acosh(-vars[0]) __
+#define T5291(_,__)_ fp_exp(vars[0])-fp_acosh(-vars[0]) __
+#define T5443(_,__)_ fp_exp(vars[0])-fp_acosh(vars[0]) __
+#define T2538(_,__)_ fp_exp(vars[0])-fp_acosh(vars[0]) __
+#define T2351(_,__)_ fp_exp(vars[0])-fp_asin(-vars[0]) __
+#define T5292(_,__)_ fp_exp(vars[0])-fp_asin(-vars[0]) __
+#define T2539(_,__)_ fp_exp(vars[0])-fp_asin(vars[0]) __
+#define T5444(_,__)_ fp_exp(vars[0])-fp_asin(vars[0]) __
+#define T5293(_,__)_ fp_exp(vars[0])-fp_asinh(-vars[0]) __
+#define T2352(_,__)_ fp_exp(vars[0])-fp_asinh(-vars[0]) __
+#define T5445(_,__)_ fp_exp(vars[0])-fp_asinh(vars[0]) __
+#define T2540(_,__)_ fp_exp(vars[0])-fp_asinh(vars[0]) __
+#define T2353(_,__)_ fp_exp(vars[0])-fp_atan(-vars[0]) __
+#define T5294(_,__)_ fp_exp(vars[0])-fp_atan(-vars[0]) __
+#define T2541(_,__)_ fp_exp(vars[0])-fp_atan(vars[0]) __
+#define T5446(_,__)_ fp_exp(vars[0])-fp_atan(vars[0]) __
+#define T2354(_,__)_ fp_exp(vars[0])-fp_atanh(-vars[0]) __
+#define T2542(_,__)_ fp_exp(vars[0])-fp_atanh(vars[0]) __
+#define T2355(_,__)_ fp_exp(vars[0])-fp_cos(-vars[0]) __
+#define T2543(_,__)_ fp_exp(vars[0])-fp_cos(vars[0]) __
+#define T2356(_,__)_ fp_exp(vars[0])-fp_cosh(-vars[0]) __
+#define T2544(_,__)_ fp_exp(vars[0])-fp_cosh(vars[0]) __
+#define T2357(_,__)_ fp_exp(vars[0])-fp_exp(-vars[0]) __
+#define T2545(_,__)_ fp_exp(vars[0])-fp_exp(vars[0]) __
+#define T2358(_,__)_ fp_exp(vars[0])-fp_log(-vars[0]) __
+#define T5295(_,__)_ fp_exp(vars[0])-fp_log(-vars[0]) __
+#define T2546(_,__)_ fp_exp(vars[0])-fp_log(vars[0]) __
+#define T5447(_,__)_ fp_exp(vars[0])-fp_log(vars[0]) __
+#define T2359(_,__)_ fp_exp(vars[0])-fp_sin(-vars[0]) __
+#define T2547(_,__)_ fp_exp(vars[0])-fp_sin(vars[0]) __
+#define T2360(_,__)_ fp_exp(vars[0])-fp_sinh(-vars[0]) __
+#define T2548(_,__)_ fp_exp(vars[0])-fp_sinh(vars[0]) __
+#define T2361(_,__)_ fp_exp(vars[0])-fp_tan(-vars[0]) __
+#define T5296(_,__)_ fp_exp(vars[0])-fp_tan(-vars[0]) __
+#define T2549(_,__)_ fp_exp(vars[0])-fp_tan(vars[0]) __
+#define T5448(_,__)_ fp_exp(vars[0])-fp_tan(vars[0]) __
+#define T5297(_,__)_ fp_exp(vars[0])-fp_tanh(-vars[0]) __
+#define T2362(_,__)_ fp_exp(vars[0])-fp_tanh(-vars[0]) __
+#define T5449(_,__)_ fp_exp(vars[0])-fp_tanh(vars[0]) __
+#define T2550(_,__)_ fp_exp(vars[0])-fp_tanh(vars[0]) __
+#define T3460(_,__)_ fp_exp(vars[0]*c.l2+vars[1]*c.l3) __
+#define  T428(_,__)_ fp_exp(vars[0]+c.l4) __
+#define T3462(_,__)_ fp_exp(vars[0]+vars[1]*vars[2]) __
+#define T3629(_,__)_ fp_exp(vars[0]/c.l5ep25) __
+#define T1154(_,__)_ fp_exp2(Value_t(fp_abs(vars[0]))) __
+#define T4183(_,__)_ fp_exp2(Value_t(fp_arg(vars[0]))) __
+#define T1165(_,__)_ fp_exp2(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4189(_,__)_ fp_exp2(Value_t(fp_imag(vars[0]))) __
+#define T3519(_,__)_ fp_exp2(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3520(_,__)_ fp_exp2(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3521(_,__)_ fp_exp2(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3522(_,__)_ fp_exp2(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1790(_,__)_ fp_exp2(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1183(_,__)_ fp_exp2(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4201(_,__)_ fp_exp2(Value_t(fp_real(vars[0]))) __
+#define  T496(_,__)_ fp_exp2(c.l1_1)+vars[0] __
+#define T1143(_,__)_ fp_exp2(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1141(_,__)_ fp_exp2(fp_acos(vars[0])) __
+#define T4174(_,__)_ fp_exp2(fp_acos(vars[0])) __
+#define T4175(_,__)_ fp_exp2(fp_acosh(vars[0])) __
+#define T1142(_,__)_ fp_exp2(fp_acosh(vars[0]+c.l0_6)) __
+#define T1147(_,__)_ fp_exp2(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4176(_,__)_ fp_exp2(fp_asin(vars[0])) __
+#define T1144(_,__)_ fp_exp2(fp_asin(vars[0])) __
+#define T1146(_,__)_ fp_exp2(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4177(_,__)_ fp_exp2(fp_asinh(vars[0])) __
+#define T1145(_,__)_ fp_exp2(fp_asinh(vars[0])) __
+#define T4179(_,__)_ fp_exp2(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4180(_,__)_ fp_exp2(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T1152(_,__)_ fp_exp2(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4181(_,__)_ fp_exp2(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1153(_,__)_ fp_exp2(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1151(_,__)_ fp_exp2(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1148(_,__)_ fp_exp2(fp_atan(vars[0])) __
+#define T4178(_,__)_ fp_exp2(fp_atan(vars[0])) __
+#define T1149(_,__)_ fp_exp2(fp_atan(vars[0]/vars[1])) __
+#define T1139(_,__)_ fp_exp2(fp_atan2(vars[0],vars[1])) __
+#define T1150(_,__)_ fp_exp2(fp_atanh(vars[0])) __
+#define T1157(_,__)_ fp_exp2(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4182(_,__)_ fp_exp2(fp_cbrt(vars[0])) __
+#define T1156(_,__)_ fp_exp2(fp_cbrt(vars[0])) __
+#define T4196(_,__)_ fp_exp2(fp_conj(vars[0])) __
+#define T1160(_,__)_ fp_exp2(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1155(_,__)_ fp_exp2(fp_cos(vars[0])) __
+#define T1159(_,__)_ fp_exp2(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1158(_,__)_ fp_exp2(fp_cosh(vars[0])) __
+#define T1167(_,__)_ fp_exp2(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1166(_,__)_ fp_exp2(fp_exp(vars[0])) __
+#define T1162(_,__)_ fp_exp2(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1161(_,__)_ fp_exp2(fp_exp2(vars[0])) __
+#define T4185(_,__)_ fp_exp2(fp_hypot(c.l1,vars[0])) __
+#define T1168(_,__)_ fp_exp2(fp_hypot(c.l1,vars[0])) __
+#define T1169(_,__)_ fp_exp2(fp_hypot(c.l2,vars[0])) __
+#define T4186(_,__)_ fp_exp2(fp_hypot(c.l2,vars[0])) __
+#define T1171(_,__)_ fp_exp2(fp_hypot(vars[0],c.l1)) __
+#define T4187(_,__)_ fp_exp2(fp_hypot(vars[0],c.l1)) __
+#define T4188(_,__)_ fp_exp2(fp_hypot(vars[0],c.l2)) __
+#define T1172(_,__)_ fp_exp2(fp_hypot(vars[0],c.l2)) __
+#define T1170(_,__)_ fp_exp2(fp_hypot(vars[0],vars[1])) __
+#define T4184(_,__)_ fp_exp2(fp_hypot(vars[0],vars[1])) __
+#define T4190(_,__)_ fp_exp2(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1174(_,__)_ fp_exp2(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1173(_,__)_ fp_exp2(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1164(_,__)_ fp_exp2(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1163(_,__)_ fp_exp2(fp_inv(fp_cos(vars[0]))) __
+#define T1175(_,__)_ fp_exp2(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4192(_,__)_ fp_exp2(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1176(_,__)_ fp_exp2(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4193(_,__)_ fp_exp2(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4194(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1178(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1179(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4195(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1177(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4191(_,__)_ fp_exp2(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1140(_,__)_ fp_exp2(fp_inv(fp_sin(vars[0]))) __
+#define T1184(_,__)_ fp_exp2(fp_inv(fp_tan(vars[0]))) __
+#define T3518(_,__)_ fp_exp2(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T1181(_,__)_ fp_exp2(fp_log(vars[0])) __
+#define T4197(_,__)_ fp_exp2(fp_log(vars[0])) __
+#define T4199(_,__)_ fp_exp2(fp_log10(vars[0])) __
+#define T1182(_,__)_ fp_exp2(fp_log10(vars[0])) __
+#define  T529(_,__)_ fp_exp2(fp_log2(fp_acos(vars[0]))) __
+#define T1180(_,__)_ fp_exp2(fp_log2(vars[0])) __
+#define T4198(_,__)_ fp_exp2(fp_log2(vars[0])) __
+#define T4200(_,__)_ fp_exp2(fp_polar(vars[0],vars[1])) __
+#define T1185(_,__)_ fp_exp2(fp_pow(vars[0],vars[1])) __
+#define T1189(_,__)_ fp_exp2(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1186(_,__)_ fp_exp2(fp_sin(vars[0])) __
+#define T1188(_,__)_ fp_exp2(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1187(_,__)_ fp_exp2(fp_sinh(vars[0])) __
+#define T1191(_,__)_ fp_exp2(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1190(_,__)_ fp_exp2(fp_sqrt(vars[0])) __
+#define T4202(_,__)_ fp_exp2(fp_sqrt(vars[0])) __
+#define T1195(_,__)_ fp_exp2(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1192(_,__)_ fp_exp2(fp_tan(vars[0])) __
+#define T4203(_,__)_ fp_exp2(fp_tan(vars[0])) __
+#define T1194(_,__)_ fp_exp2(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1193(_,__)_ fp_exp2(fp_tanh(vars[0])) __
+#define T4204(_,__)_ fp_exp2(fp_tanh(vars[0])) __
+#define T1789(_,__)_ fp_exp2(vars[0]) __
+#define  T429(_,__)_ fp_exp2(vars[0]+c.l4) __
+#define  T506(_,__)_ fp_floor(-vars[0]) __
+#define  T520(_,__)_ fp_floor(Value_t(fp_greater(vars[0],c.l4))) __
+#define T3534(_,__)_ fp_floor(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3535(_,__)_ fp_floor(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3536(_,__)_ fp_floor(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3537(_,__)_ fp_floor(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define  T505(_,__)_ fp_floor(c.l1_1)+vars[0] __
+#define T3533(_,__)_ fp_floor(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T3603(_,__)_ fp_floor(vars[0]*(Value_t(fp_abs(vars[0]))-Value_t(fp_abs(vars[0]))-c.l1)) __
+#define T3702(_,__)_ fp_floor(vars[0]+-(Value_t(fp_abs(vars[1]))+c.l1)) __
+#define T3693(_,__)_ fp_floor(vars[0]+Value_t(fp_abs(fp_ceil(vars[1])))) __
+#define T3694(_,__)_ fp_floor(vars[0]+Value_t(fp_abs(fp_floor(vars[1])))) __
+#define T3695(_,__)_ fp_floor(vars[0]+Value_t(fp_abs(fp_int(vars[1])))) __
+#define T3697(_,__)_ fp_floor(vars[0]+Value_t(fp_abs(fp_trunc(vars[1])))) __
+#define T3696(_,__)_ fp_floor(vars[0]+Value_t(fp_abs(vars[1]))) __
+#define T3701(_,__)_ fp_floor(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3703(_,__)_ fp_floor(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3698(_,__)_ fp_floor(vars[0]+fp_ceil(vars[1])) __
+#define T3699(_,__)_ fp_floor(vars[0]+fp_floor(vars[1])) __
+#define T3700(_,__)_ fp_floor(vars[0]+fp_int(vars[1])) __
+#define T3704(_,__)_ fp_floor(vars[0]+fp_trunc(vars[1])) __
+#define  T178(_,__)_ fp_greater(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T185(_,__)_ fp_greater((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T183(_,__)_ fp_greater((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T184(_,__)_ fp_greater((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T182(_,__)_ fp_greater((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T179(_,__)_ fp_greater((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T177(_,__)_ fp_greater((vars[0]+c.l4+vars[1]),c.l6) __
+#define T3432(_,__)_ fp_greater(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3433(_,__)_ fp_greater(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3431(_,__)_ fp_greater(fp_pow(vars[0],c.l2),c.l25) __
+#define T3430(_,__)_ fp_greater(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3429(_,__)_ fp_greater(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3428(_,__)_ fp_greater(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T3622(_,__)_ fp_greater(vars[0],c.l0) ? fp_ceil(vars[0]) : fp_floor(vars[0]) __
+#define T3618(_,__)_ fp_greater(vars[0],c.l0) ? fp_floor(vars[0]) : fp_ceil(vars[0]) __
+#define  T318(_,__)_ fp_greater(vars[0],c.l7)&&fp_less(vars[0],c.l2) __
+#define  T516(_,__)_ fp_greater(vars[0],c.lm0_5) __
+#define T3774(_,__)_ fp_greater(vars[0],vars[1]) __
+#define  T306(_,__)_ fp_greater(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T180(_,__)_ fp_greater(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T181(_,__)_ fp_greater(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define  T243(_,__)_ fp_greater(vars[0],vars[1])&&fp_equal(vars[0],vars[1]) __
+#define  T244(_,__)_ fp_greater(vars[0],vars[1])&&fp_greaterOrEq(vars[0],vars[1]) __
+#define  T245(_,__)_ fp_greater(vars[0],vars[1])&&fp_lessOrEq(vars[0],vars[1]) __
+#define  T246(_,__)_ fp_greater(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]) __
+#define  T247(_,__)_ fp_greater(vars[0],vars[1])||fp_equal(vars[0],vars[1]) __
+#define  T248(_,__)_ fp_greater(vars[0],vars[1])||fp_greaterOrEq(vars[0],vars[1]) __
+#define  T249(_,__)_ fp_greater(vars[0],vars[1])||fp_lessOrEq(vars[0],vars[1]) __
+#define  T250(_,__)_ fp_greater(vars[0],vars[1])||fp_nequal(vars[0],vars[1]) __
+#define  T169(_,__)_ fp_greaterOrEq(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T176(_,__)_ fp_greaterOrEq((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T174(_,__)_ fp_greaterOrEq((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T175(_,__)_ fp_greaterOrEq((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T173(_,__)_ fp_greaterOrEq((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T170(_,__)_ fp_greaterOrEq((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T168(_,__)_ fp_greaterOrEq((vars[0]+c.l4+vars[1]),c.l6) __
+#define T3426(_,__)_ fp_greaterOrEq(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3427(_,__)_ fp_greaterOrEq(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3425(_,__)_ fp_greaterOrEq(fp_pow(vars[0],c.l2),c.l25) __
+#define T3424(_,__)_ fp_greaterOrEq(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3423(_,__)_ fp_greaterOrEq(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3422(_,__)_ fp_greaterOrEq(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T3463(_,__)_ fp_greaterOrEq(vars[0],(fp_truth(c.l1) ? c.l0_5 : c.l0)) __
+#define T3623(_,__)_ fp_greaterOrEq(vars[0],c.l0) ? fp_ceil(vars[0]) : fp_floor(vars[0]) __
+#define T3619(_,__)_ fp_greaterOrEq(vars[0],c.l0) ? fp_floor(vars[0]) : fp_ceil(vars[0]) __
+#define  T511(_,__)_ fp_greaterOrEq(vars[0],c.l0_5) __
+#define T3773(_,__)_ fp_greaterOrEq(vars[0],vars[1]) __
+#define  T305(_,__)_ fp_greaterOrEq(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T171(_,__)_ fp_greaterOrEq(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T172(_,__)_ fp_greaterOrEq(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define  T235(_,__)_ fp_greaterOrEq(vars[0],vars[1])&&fp_equal(vars[0],vars[1]) __
+#define  T236(_,__)_ fp_greaterOrEq(vars[0],vars[1])&&fp_lessOrEq(vars[0],vars[1]) __
+#define  T237(_,__)_ fp_greaterOrEq(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]) __
+#define  T238(_,__)_ fp_greaterOrEq(vars[0],vars[1])||fp_equal(vars[0],vars[1]) __
+#define  T239(_,__)_ fp_greaterOrEq(vars[0],vars[1])||fp_lessOrEq(vars[0],vars[1]) __
+#define  T240(_,__)_ fp_greaterOrEq(vars[0],vars[1])||fp_nequal(vars[0],vars[1]) __
+#define T1796(_,__)_ fp_hypot(c.l1,vars[0]) __
+#define T4800(_,__)_ fp_hypot(c.l1,vars[0]) __
+#define T1797(_,__)_ fp_hypot(c.l2,vars[0]) __
+#define T4801(_,__)_ fp_hypot(c.l2,vars[0]) __
+#define  T517(_,__)_ fp_hypot(c.l5,c.l4)+vars[0] __
+#define T1799(_,__)_ fp_hypot(vars[0],c.l1) __
+#define T4802(_,__)_ fp_hypot(vars[0],c.l1) __
+#define T1800(_,__)_ fp_hypot(vars[0],c.l2) __
+#define T4803(_,__)_ fp_hypot(vars[0],c.l2) __
+#define T1798(_,__)_ fp_hypot(vars[0],vars[1]) __
+#define T4799(_,__)_ fp_hypot(vars[0],vars[1]) __
+#define T4326(_,__)_ fp_imag(Value_t(fp_abs(vars[0]))) __
+#define T4339(_,__)_ fp_imag(Value_t(fp_arg(vars[0]))) __
+#define T4336(_,__)_ fp_imag(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4345(_,__)_ fp_imag(Value_t(fp_imag(vars[0]))) __
+#define T4356(_,__)_ fp_imag(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4360(_,__)_ fp_imag(Value_t(fp_real(vars[0]))) __
+#define T4315(_,__)_ fp_imag(fp_acos(vars[0])) __
+#define T4316(_,__)_ fp_imag(fp_acosh(vars[0])) __
+#define T4317(_,__)_ fp_imag(fp_asin(vars[0])) __
+#define T4319(_,__)_ fp_imag(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4318(_,__)_ fp_imag(fp_asinh(vars[0])) __
+#define T4321(_,__)_ fp_imag(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4324(_,__)_ fp_imag(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4325(_,__)_ fp_imag(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4323(_,__)_ fp_imag(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4320(_,__)_ fp_imag(fp_atan(vars[0])) __
+#define T4322(_,__)_ fp_imag(fp_atanh(vars[0])) __
+#define T4328(_,__)_ fp_imag(fp_cbrt(vars[0])) __
+#define T4352(_,__)_ fp_imag(fp_conj(vars[0])) __
+#define T4331(_,__)_ fp_imag(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4327(_,__)_ fp_imag(fp_cos(vars[0])) __
+#define T4330(_,__)_ fp_imag(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4329(_,__)_ fp_imag(fp_cosh(vars[0])) __
+#define T4338(_,__)_ fp_imag(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4337(_,__)_ fp_imag(fp_exp(vars[0])) __
+#define T4334(_,__)_ fp_imag(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4333(_,__)_ fp_imag(fp_exp2(vars[0])) __
+#define T4341(_,__)_ fp_imag(fp_hypot(c.l1,vars[0])) __
+#define T4342(_,__)_ fp_imag(fp_hypot(c.l2,vars[0])) __
+#define T4343(_,__)_ fp_imag(fp_hypot(vars[0],c.l1)) __
+#define T4344(_,__)_ fp_imag(fp_hypot(vars[0],c.l2)) __
+#define T4340(_,__)_ fp_imag(fp_hypot(vars[0],vars[1])) __
+#define T4346(_,__)_ fp_imag(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T4335(_,__)_ fp_imag(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4332(_,__)_ fp_imag(fp_inv(fp_cos(vars[0]))) __
+#define T4348(_,__)_ fp_imag(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4349(_,__)_ fp_imag(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4350(_,__)_ fp_imag(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4351(_,__)_ fp_imag(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4347(_,__)_ fp_imag(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4314(_,__)_ fp_imag(fp_inv(fp_sin(vars[0]))) __
+#define T4357(_,__)_ fp_imag(fp_inv(fp_tan(vars[0]))) __
+#define T4353(_,__)_ fp_imag(fp_log(vars[0])) __
+#define T4355(_,__)_ fp_imag(fp_log10(vars[0])) __
+#define T4354(_,__)_ fp_imag(fp_log2(vars[0])) __
+#define T4359(_,__)_ fp_imag(fp_polar(vars[0],vars[1])) __
+#define T4358(_,__)_ fp_imag(fp_pow(vars[0],vars[1])) __
+#define T4364(_,__)_ fp_imag(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4361(_,__)_ fp_imag(fp_sin(vars[0])) __
+#define T4363(_,__)_ fp_imag(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4362(_,__)_ fp_imag(fp_sinh(vars[0])) __
+#define T4365(_,__)_ fp_imag(fp_sqrt(vars[0])) __
+#define T4366(_,__)_ fp_imag(fp_tan(vars[0])) __
+#define T4367(_,__)_ fp_imag(fp_tanh(vars[0])) __
+#define T4804(_,__)_ fp_imag(vars[0]) __
+#define  T521(_,__)_ fp_int(Value_t(fp_greater(vars[0],c.l4))) __
+#define T3539(_,__)_ fp_int(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3540(_,__)_ fp_int(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3541(_,__)_ fp_int(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3542(_,__)_ fp_int(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T3634(_,__)_ fp_int(c.l0_5+vars[0])+c.l10*fp_trunc(c.l0_5+vars[1]) __
+#define T3538(_,__)_ fp_int(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T3714(_,__)_ fp_int(vars[0]+-(Value_t(fp_abs(vars[1]))+c.l1)) __
+#define T3705(_,__)_ fp_int(vars[0]+Value_t(fp_abs(fp_ceil(vars[1])))) __
+#define T3706(_,__)_ fp_int(vars[0]+Value_t(fp_abs(fp_floor(vars[1])))) __
+#define T3707(_,__)_ fp_int(vars[0]+Value_t(fp_abs(fp_int(vars[1])))) __
+#define T3709(_,__)_ fp_int(vars[0]+Value_t(fp_abs(fp_trunc(vars[1])))) __
+#define T3708(_,__)_ fp_int(vars[0]+Value_t(fp_abs(vars[1]))) __
+#define T3713(_,__)_ fp_int(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3715(_,__)_ fp_int(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3710(_,__)_ fp_int(vars[0]+fp_ceil(vars[1])) __
+#define T3711(_,__)_ fp_int(vars[0]+fp_floor(vars[1])) __
+#define T3712(_,__)_ fp_int(vars[0]+fp_int(vars[1])) __
+#define T3716(_,__)_ fp_int(vars[0]+fp_trunc(vars[1])) __
+#define T4805(_,__)_ fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1802(_,__)_ fp_inv(fp_atan(vars[0]/vars[1])) __
+#define T1801(_,__)_ fp_inv(fp_atan2(vars[0],vars[1])) __
+#define T1209(_,__)_ fp_inv(fp_cos(Value_t(fp_abs(vars[0])))) __
+#define T4214(_,__)_ fp_inv(fp_cos(Value_t(fp_arg(vars[0])))) __
+#define T1220(_,__)_ fp_inv(fp_cos(Value_t(fp_equal(vars[0],vars[1])))) __
+#define T4220(_,__)_ fp_inv(fp_cos(Value_t(fp_imag(vars[0])))) __
+#define T3524(_,__)_ fp_inv(fp_cos(Value_t(fp_less(vars[0],vars[1])))) __
+#define T3525(_,__)_ fp_inv(fp_cos(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1)) __
+#define T3526(_,__)_ fp_inv(fp_cos(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1)) __
+#define T3527(_,__)_ fp_inv(fp_cos(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1)) __
+#define T1792(_,__)_ fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1238(_,__)_ fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4232(_,__)_ fp_inv(fp_cos(Value_t(fp_real(vars[0])))) __
+#define T4205(_,__)_ fp_inv(fp_cos(fp_acos(vars[0]))) __
+#define T1198(_,__)_ fp_inv(fp_cos(fp_acos(vars[0]))) __
+#define T4206(_,__)_ fp_inv(fp_cos(fp_acosh(vars[0]))) __
+#define T1199(_,__)_ fp_inv(fp_cos(fp_acosh(vars[0]+c.l0_6))) __
+#define T4207(_,__)_ fp_inv(fp_cos(fp_asin(vars[0]))) __
+#define T1200(_,__)_ fp_inv(fp_cos(fp_asin(vars[0]))) __
+#define T1202(_,__)_ fp_inv(fp_cos(fp_asinh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1201(_,__)_ fp_inv(fp_cos(fp_asinh(vars[0]))) __
+#define T4208(_,__)_ fp_inv(fp_cos(fp_asinh(vars[0]))) __
+#define T4210(_,__)_ fp_inv(fp_cos(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1207(_,__)_ fp_inv(fp_cos(fp_atan(Value_t(-fp_abs(vars[0]))))) __
+#define T4211(_,__)_ fp_inv(fp_cos(fp_atan(Value_t(-fp_abs(vars[0]))))) __
+#define T1208(_,__)_ fp_inv(fp_cos(fp_atan(Value_t(fp_abs(vars[0]))))) __
+#define T4212(_,__)_ fp_inv(fp_cos(fp_atan(Value_t(fp_abs(vars[0]))))) __
+#define T1206(_,__)_ fp_inv(fp_cos(fp_atan(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4209(_,__)_ fp_inv(fp_cos(fp_atan(vars[0]))) __
+#define T1203(_,__)_ fp_inv(fp_cos(fp_atan(vars[0]))) __
+#define T1204(_,__)_ fp_inv(fp_cos(fp_atan(vars[0]/vars[1]))) __
+#define T1196(_,__)_ fp_inv(fp_cos(fp_atan2(vars[0],vars[1]))) __
+#define T1205(_,__)_ fp_inv(fp_cos(fp_atanh(vars[0]))) __
+#define T1212(_,__)_ fp_inv(fp_cos(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4213(_,__)_ fp_inv(fp_cos(fp_cbrt(vars[0]))) __
+#define T1211(_,__)_ fp_inv(fp_cos(fp_cbrt(vars[0]))) __
+#define T4227(_,__)_ fp_inv(fp_cos(fp_conj(vars[0]))) __
+#define T1215(_,__)_ fp_inv(fp_cos(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1210(_,__)_ fp_inv(fp_cos(fp_cos(vars[0]))) __
+#define T1214(_,__)_ fp_inv(fp_cos(fp_cosh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1213(_,__)_ fp_inv(fp_cos(fp_cosh(vars[0]))) __
+#define T1222(_,__)_ fp_inv(fp_cos(fp_exp(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1221(_,__)_ fp_inv(fp_cos(fp_exp(vars[0]))) __
+#define T1217(_,__)_ fp_inv(fp_cos(fp_exp2(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1216(_,__)_ fp_inv(fp_cos(fp_exp2(vars[0]))) __
+#define T4216(_,__)_ fp_inv(fp_cos(fp_hypot(c.l1,vars[0]))) __
+#define T1223(_,__)_ fp_inv(fp_cos(fp_hypot(c.l1,vars[0]))) __
+#define T1224(_,__)_ fp_inv(fp_cos(fp_hypot(c.l2,vars[0]))) __
+#define T4217(_,__)_ fp_inv(fp_cos(fp_hypot(c.l2,vars[0]))) __
+#define T4218(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],c.l1))) __
+#define T1226(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],c.l1))) __
+#define T1227(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],c.l2))) __
+#define T4219(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],c.l2))) __
+#define T1225(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],vars[1]))) __
+#define T4215(_,__)_ fp_inv(fp_cos(fp_hypot(vars[0],vars[1]))) __
+#define T4221(_,__)_ fp_inv(fp_cos(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))))) __
+#define T1229(_,__)_ fp_inv(fp_cos(fp_inv(fp_atan(vars[0]/vars[1])))) __
+#define T1228(_,__)_ fp_inv(fp_cos(fp_inv(fp_atan2(vars[0],vars[1])))) __
+#define T1219(_,__)_ fp_inv(fp_cos(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))))) __
+#define T1218(_,__)_ fp_inv(fp_cos(fp_inv(fp_cos(vars[0])))) __
+#define T1230(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define T4223(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define T4224(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define T1231(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define T1233(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define T4225(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define T1234(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T4226(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T4222(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define T1232(_,__)_ fp_inv(fp_cos(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define T1197(_,__)_ fp_inv(fp_cos(fp_inv(fp_sin(vars[0])))) __
+#define T1239(_,__)_ fp_inv(fp_cos(fp_inv(fp_tan(vars[0])))) __
+#define T3523(_,__)_ fp_inv(fp_cos(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2)) __
+#define T1236(_,__)_ fp_inv(fp_cos(fp_log(vars[0]))) __
+#define T4228(_,__)_ fp_inv(fp_cos(fp_log(vars[0]))) __
+#define T4230(_,__)_ fp_inv(fp_cos(fp_log10(vars[0]))) __
+#define T1237(_,__)_ fp_inv(fp_cos(fp_log10(vars[0]))) __
+#define T4229(_,__)_ fp_inv(fp_cos(fp_log2(vars[0]))) __
+#define T1235(_,__)_ fp_inv(fp_cos(fp_log2(vars[0]))) __
+#define T4231(_,__)_ fp_inv(fp_cos(fp_polar(vars[0],vars[1]))) __
+#define T1240(_,__)_ fp_inv(fp_cos(fp_pow(vars[0],vars[1]))) __
+#define T1244(_,__)_ fp_inv(fp_cos(fp_sin(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1241(_,__)_ fp_inv(fp_cos(fp_sin(vars[0]))) __
+#define T1243(_,__)_ fp_inv(fp_cos(fp_sinh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1242(_,__)_ fp_inv(fp_cos(fp_sinh(vars[0]))) __
+#define T1246(_,__)_ fp_inv(fp_cos(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4233(_,__)_ fp_inv(fp_cos(fp_sqrt(vars[0]))) __
+#define T1245(_,__)_ fp_inv(fp_cos(fp_sqrt(vars[0]))) __
+#define T1250(_,__)_ fp_inv(fp_cos(fp_tan(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1247(_,__)_ fp_inv(fp_cos(fp_tan(vars[0]))) __
+#define T4234(_,__)_ fp_inv(fp_cos(fp_tan(vars[0]))) __
+#define T1249(_,__)_ fp_inv(fp_cos(fp_tanh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4235(_,__)_ fp_inv(fp_cos(fp_tanh(vars[0]))) __
+#define T1248(_,__)_ fp_inv(fp_cos(fp_tanh(vars[0]))) __
+#define T1791(_,__)_ fp_inv(fp_cos(vars[0])) __
+#define  T571(_,__)_ fp_inv(fp_cos(vars[0]))+fp_cos(vars[0]) __
+#define T4878(_,__)_ fp_inv(fp_cos(vars[0]*(c.l1*c.i))) __
+#define T4879(_,__)_ fp_inv(fp_cos(vars[0]*(c.l3*c.i))) __
+#define T4881(_,__)_ fp_inv(fp_cos(vars[0]*-(c.l1*c.i))) __
+#define T4880(_,__)_ fp_inv(fp_cos(vars[0]*-(c.l3*c.i))) __
+#define T1854(_,__)_ fp_inv(fp_cos(vars[0]*c.l2)) __
+#define T1855(_,__)_ fp_inv(fp_cos(vars[0]*c.lm1)) __
+#define T1856(_,__)_ fp_inv(fp_cos(vars[0]*c.lm2)) __
+#define T4807(_,__)_ fp_inv(fp_hypot(c.l1,vars[0])) __
+#define T1803(_,__)_ fp_inv(fp_hypot(c.l1,vars[0])) __
+#define T4808(_,__)_ fp_inv(fp_hypot(c.l2,vars[0])) __
+#define T1804(_,__)_ fp_inv(fp_hypot(c.l2,vars[0])) __
+#define T4809(_,__)_ fp_inv(fp_hypot(vars[0],c.l1)) __
+#define T1806(_,__)_ fp_inv(fp_hypot(vars[0],c.l1)) __
+#define T1807(_,__)_ fp_inv(fp_hypot(vars[0],c.l2)) __
+#define T4810(_,__)_ fp_inv(fp_hypot(vars[0],c.l2)) __
+#define T4806(_,__)_ fp_inv(fp_hypot(vars[0],vars[1])) __
+#define T1805(_,__)_ fp_inv(fp_hypot(vars[0],vars[1])) __
+#define  T563(_,__)_ fp_inv(fp_inv(fp_sqrt(vars[0]))) __
+#define  T524(_,__)_ fp_inv(fp_inv(vars[0])) __
+#define T3645(_,__)_ fp_inv(fp_log(fp_pow(c.l10,((c.l3-c.l2)/fp_log(vars[0]))))) __
+#define  T553(_,__)_ fp_inv(fp_pow(vars[0],vars[1])) __
+#define  T615(_,__)_ fp_inv(fp_sin(Value_t(fp_abs(vars[0])))) __
+#define T3794(_,__)_ fp_inv(fp_sin(Value_t(fp_arg(vars[0])))) __
+#define T3800(_,__)_ fp_inv(fp_sin(Value_t(fp_imag(vars[0])))) __
+#define T3466(_,__)_ fp_inv(fp_sin(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1)) __
+#define T3812(_,__)_ fp_inv(fp_sin(Value_t(fp_real(vars[0])))) __
+#define T3786(_,__)_ fp_inv(fp_sin(fp_acos(vars[0]))) __
+#define  T606(_,__)_ fp_inv(fp_sin(fp_acos(vars[0]))) __
+#define T3787(_,__)_ fp_inv(fp_sin(fp_acosh(vars[0]))) __
+#define  T607(_,__)_ fp_inv(fp_sin(fp_acosh(vars[0]+c.l0_6))) __
+#define T3788(_,__)_ fp_inv(fp_sin(fp_asin(vars[0]))) __
+#define  T608(_,__)_ fp_inv(fp_sin(fp_asin(vars[0]))) __
+#define  T609(_,__)_ fp_inv(fp_sin(fp_asinh(vars[0]))) __
+#define T3789(_,__)_ fp_inv(fp_sin(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define  T613(_,__)_ fp_inv(fp_sin(fp_atan(Value_t(-fp_abs(vars[0]))))) __
+#define T3791(_,__)_ fp_inv(fp_sin(fp_atan(Value_t(-fp_abs(vars[0]+c.lm0_4))))) __
+#define  T614(_,__)_ fp_inv(fp_sin(fp_atan(Value_t(fp_abs(vars[0]))))) __
+#define T3792(_,__)_ fp_inv(fp_sin(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4))))) __
+#define  T610(_,__)_ fp_inv(fp_sin(fp_atan(vars[0]))) __
+#define  T611(_,__)_ fp_inv(fp_sin(fp_atan(vars[0]/vars[1]))) __
+#define  T604(_,__)_ fp_inv(fp_sin(fp_atan2(vars[0],vars[1]))) __
+#define T3790(_,__)_ fp_inv(fp_sin(fp_atanh(vars[0]))) __
+#define  T612(_,__)_ fp_inv(fp_sin(fp_atanh(vars[0]))) __
+#define  T617(_,__)_ fp_inv(fp_sin(fp_cbrt(vars[0]))) __
+#define T3793(_,__)_ fp_inv(fp_sin(fp_cbrt(vars[0]))) __
+#define T3807(_,__)_ fp_inv(fp_sin(fp_conj(vars[0]))) __
+#define  T620(_,__)_ fp_inv(fp_sin(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T616(_,__)_ fp_inv(fp_sin(fp_cos(vars[0]))) __
+#define  T619(_,__)_ fp_inv(fp_sin(fp_cosh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T618(_,__)_ fp_inv(fp_sin(fp_cosh(vars[0]))) __
+#define  T626(_,__)_ fp_inv(fp_sin(fp_exp(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T625(_,__)_ fp_inv(fp_sin(fp_exp(vars[0]))) __
+#define  T622(_,__)_ fp_inv(fp_sin(fp_exp2(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define  T621(_,__)_ fp_inv(fp_sin(fp_exp2(vars[0]))) __
+#define T3796(_,__)_ fp_inv(fp_sin(fp_hypot(c.l1,vars[0]))) __
+#define  T627(_,__)_ fp_inv(fp_sin(fp_hypot(c.l1,vars[0]))) __
+#define T3797(_,__)_ fp_inv(fp_sin(fp_hypot(c.l2,vars[0]))) __
+#define  T628(_,__)_ fp_inv(fp_sin(fp_hypot(c.l2,vars[0]))) __
+#define T3798(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],c.l1))) __
+#define  T630(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],c.l1))) __
+#define T3799(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],c.l2))) __
+#define  T631(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],c.l2))) __
+#define T3795(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],vars[1]))) __
+#define  T629(_,__)_ fp_inv(fp_sin(fp_hypot(vars[0],vars[1]))) __
+#define T3801(_,__)_ fp_inv(fp_sin(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))))) __
+#define  T633(_,__)_ fp_inv(fp_sin(fp_inv(fp_atan(vars[0]/vars[1])))) __
+#define  T632(_,__)_ fp_inv(fp_sin(fp_inv(fp_atan2(vars[0],vars[1])))) __
+#define  T624(_,__)_ fp_inv(fp_sin(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))))) __
+#define  T623(_,__)_ fp_inv(fp_sin(fp_inv(fp_cos(vars[0])))) __
+#define T3803(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define  T634(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define T3804(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define  T635(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define T3805(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define  T637(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define  T638(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T3806(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T3802(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define  T636(_,__)_ fp_inv(fp_sin(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define  T605(_,__)_ fp_inv(fp_sin(fp_inv(fp_sin(vars[0])))) __
+#define  T642(_,__)_ fp_inv(fp_sin(fp_inv(fp_tan(vars[0])))) __
+#define T3465(_,__)_ fp_inv(fp_sin(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2)) __
+#define  T640(_,__)_ fp_inv(fp_sin(fp_log(vars[0]))) __
+#define T3808(_,__)_ fp_inv(fp_sin(fp_log(vars[0]))) __
+#define T3810(_,__)_ fp_inv(fp_sin(fp_log10(vars[0]))) __
+#define  T641(_,__)_ fp_inv(fp_sin(fp_log10(vars[0]))) __
+#define T3809(_,__)_ fp_inv(fp_sin(fp_log2(vars[0]))) __
+#define  T639(_,__)_ fp_inv(fp_sin(fp_log2(vars[0]))) __
+#define T3811(_,__)_ fp_inv(fp_sin(fp_polar(vars[0],vars[1]))) __
+#define  T643(_,__)_ fp_inv(fp_sin(fp_pow(vars[0],vars[1]))) __
+#define  T644(_,__)_ fp_inv(fp_sin(fp_sin(vars[0]))) __
+#define  T645(_,__)_ fp_inv(fp_sin(fp_sinh(vars[0]))) __
+#define T3813(_,__)_ fp_inv(fp_sin(fp_sqrt(vars[0]))) __
+#define  T646(_,__)_ fp_inv(fp_sin(fp_sqrt(vars[0]))) __
+#define  T647(_,__)_ fp_inv(fp_sin(fp_tan(vars[0]))) __
+#define  T648(_,__)_ fp_inv(fp_sin(fp_tanh(vars[0]))) __
+#define T1768(_,__)_ fp_inv(fp_sin(vars[0])) __
+#define  T574(_,__)_ fp_inv(fp_sin(vars[0]))+fp_sin(vars[0]) __
+#define T4874(_,__)_ fp_inv(fp_sin(vars[0]*(c.l1*c.i))) __
+#define T4875(_,__)_ fp_inv(fp_sin(vars[0]*(c.l3*c.i))) __
+#define T4877(_,__)_ fp_inv(fp_sin(vars[0]*-(c.l1*c.i))) __
+#define T4876(_,__)_ fp_inv(fp_sin(vars[0]*-(c.l3*c.i))) __
+#define T1851(_,__)_ fp_inv(fp_sin(vars[0]*c.l2)) __
+#define T1852(_,__)_ fp_inv(fp_sin(vars[0]*c.lm1)) __
+#define T1853(_,__)_ fp_inv(fp_sin(vars[0]*c.lm2)) __
+#define  T564(_,__)_ fp_inv(fp_sqrt(fp_inv(vars[0]))) __
+#define  T561(_,__)_ fp_inv(fp_sqrt(vars[0])) __
+#define T1451(_,__)_ fp_inv(fp_tan(Value_t(fp_abs(vars[0])))) __
+#define T4544(_,__)_ fp_inv(fp_tan(Value_t(fp_arg(vars[0])))) __
+#define T4550(_,__)_ fp_inv(fp_tan(Value_t(fp_imag(vars[0])))) __
+#define T3550(_,__)_ fp_inv(fp_tan(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1)) __
+#define T4562(_,__)_ fp_inv(fp_tan(Value_t(fp_real(vars[0])))) __
+#define T1442(_,__)_ fp_inv(fp_tan(fp_acos(vars[0]))) __
+#define T4536(_,__)_ fp_inv(fp_tan(fp_acos(vars[0]))) __
+#define T4537(_,__)_ fp_inv(fp_tan(fp_acosh(vars[0]))) __
+#define T1443(_,__)_ fp_inv(fp_tan(fp_acosh(vars[0]+c.l0_6))) __
+#define T1444(_,__)_ fp_inv(fp_tan(fp_asin(vars[0]))) __
+#define T4538(_,__)_ fp_inv(fp_tan(fp_asin(vars[0]))) __
+#define T1445(_,__)_ fp_inv(fp_tan(fp_asinh(vars[0]))) __
+#define T4539(_,__)_ fp_inv(fp_tan(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1449(_,__)_ fp_inv(fp_tan(fp_atan(Value_t(-fp_abs(vars[0]))))) __
+#define T4541(_,__)_ fp_inv(fp_tan(fp_atan(Value_t(-fp_abs(vars[0]+c.lm0_4))))) __
+#define T1450(_,__)_ fp_inv(fp_tan(fp_atan(Value_t(fp_abs(vars[0]))))) __
+#define T4542(_,__)_ fp_inv(fp_tan(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4))))) __
+#define T1446(_,__)_ fp_inv(fp_tan(fp_atan(vars[0]))) __
+#define T1447(_,__)_ fp_inv(fp_tan(fp_atan(vars[0]/vars[1]))) __
+#define T1440(_,__)_ fp_inv(fp_tan(fp_atan2(vars[0],vars[1]))) __
+#define T4540(_,__)_ fp_inv(fp_tan(fp_atanh(vars[0]))) __
+#define T1448(_,__)_ fp_inv(fp_tan(fp_atanh(vars[0]))) __
+#define T4543(_,__)_ fp_inv(fp_tan(fp_cbrt(vars[0]))) __
+#define T1453(_,__)_ fp_inv(fp_tan(fp_cbrt(vars[0]))) __
+#define T4557(_,__)_ fp_inv(fp_tan(fp_conj(vars[0]))) __
+#define T1456(_,__)_ fp_inv(fp_tan(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1452(_,__)_ fp_inv(fp_tan(fp_cos(vars[0]))) __
+#define T1455(_,__)_ fp_inv(fp_tan(fp_cosh(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1454(_,__)_ fp_inv(fp_tan(fp_cosh(vars[0]))) __
+#define T1462(_,__)_ fp_inv(fp_tan(fp_exp(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1461(_,__)_ fp_inv(fp_tan(fp_exp(vars[0]))) __
+#define T1458(_,__)_ fp_inv(fp_tan(fp_exp2(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1457(_,__)_ fp_inv(fp_tan(fp_exp2(vars[0]))) __
+#define T4546(_,__)_ fp_inv(fp_tan(fp_hypot(c.l1,vars[0]))) __
+#define T1463(_,__)_ fp_inv(fp_tan(fp_hypot(c.l1,vars[0]))) __
+#define T1464(_,__)_ fp_inv(fp_tan(fp_hypot(c.l2,vars[0]))) __
+#define T4547(_,__)_ fp_inv(fp_tan(fp_hypot(c.l2,vars[0]))) __
+#define T4548(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],c.l1))) __
+#define T1466(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],c.l1))) __
+#define T4549(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],c.l2))) __
+#define T1467(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],c.l2))) __
+#define T1465(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],vars[1]))) __
+#define T4545(_,__)_ fp_inv(fp_tan(fp_hypot(vars[0],vars[1]))) __
+#define T4551(_,__)_ fp_inv(fp_tan(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))))) __
+#define T1469(_,__)_ fp_inv(fp_tan(fp_inv(fp_atan(vars[0]/vars[1])))) __
+#define T1468(_,__)_ fp_inv(fp_tan(fp_inv(fp_atan2(vars[0],vars[1])))) __
+#define T1460(_,__)_ fp_inv(fp_tan(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))))) __
+#define T1459(_,__)_ fp_inv(fp_tan(fp_inv(fp_cos(vars[0])))) __
+#define T4553(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define T1470(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(c.l1,vars[0])))) __
+#define T1471(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define T4554(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(c.l2,vars[0])))) __
+#define T4555(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define T1473(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],c.l1)))) __
+#define T1474(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T4556(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],c.l2)))) __
+#define T1472(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define T4552(_,__)_ fp_inv(fp_tan(fp_inv(fp_hypot(vars[0],vars[1])))) __
+#define T1441(_,__)_ fp_inv(fp_tan(fp_inv(fp_sin(vars[0])))) __
+#define T1478(_,__)_ fp_inv(fp_tan(fp_inv(fp_tan(vars[0])))) __
+#define T3549(_,__)_ fp_inv(fp_tan(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2)) __
+#define T4558(_,__)_ fp_inv(fp_tan(fp_log(vars[0]))) __
+#define T1476(_,__)_ fp_inv(fp_tan(fp_log(vars[0]))) __
+#define T1477(_,__)_ fp_inv(fp_tan(fp_log10(vars[0]))) __
+#define T4560(_,__)_ fp_inv(fp_tan(fp_log10(vars[0]))) __
+#define T4559(_,__)_ fp_inv(fp_tan(fp_log2(vars[0]))) __
+#define T1475(_,__)_ fp_inv(fp_tan(fp_log2(vars[0]))) __
+#define T4561(_,__)_ fp_inv(fp_tan(fp_polar(vars[0],vars[1]))) __
+#define T1479(_,__)_ fp_inv(fp_tan(fp_pow(vars[0],vars[1]))) __
+#define T1480(_,__)_ fp_inv(fp_tan(fp_sin(vars[0]))) __
+#define T1481(_,__)_ fp_inv(fp_tan(fp_sinh(vars[0]))) __
+#define T4563(_,__)_ fp_inv(fp_tan(fp_sqrt(vars[0]))) __
+#define T1482(_,__)_ fp_inv(fp_tan(fp_sqrt(vars[0]))) __
+#define T1483(_,__)_ fp_inv(fp_tan(fp_tan(vars[0]))) __
+#define T1484(_,__)_ fp_inv(fp_tan(fp_tanh(vars[0]))) __
+#define T1812(_,__)_ fp_inv(fp_tan(vars[0])) __
+#define  T577(_,__)_ fp_inv(fp_tan(vars[0]))+fp_tan(vars[0]) __
+#define T4870(_,__)_ fp_inv(fp_tan(vars[0]*(c.l1*c.i))) __
+#define T4871(_,__)_ fp_inv(fp_tan(vars[0]*(c.l3*c.i))) __
+#define T4873(_,__)_ fp_inv(fp_tan(vars[0]*-(c.l1*c.i))) __
+#define T4872(_,__)_ fp_inv(fp_tan(vars[0]*-(c.l3*c.i))) __
+#define T1848(_,__)_ fp_inv(fp_tan(vars[0]*c.l2)) __
+#define T1849(_,__)_ fp_inv(fp_tan(vars[0]*c.lm1)) __
+#define T1850(_,__)_ fp_inv(fp_tan(vars[0]*c.lm2)) __
+#define  T108(_,__)_ fp_inv(vars[0])*c.l5 __
+#define  T113(_,__)_ fp_inv(vars[0])*vars[1] __
+#define  T114(_,__)_ fp_inv(vars[0])/vars[1] __
+#define T3459(_,__)_ fp_inv(vars[0]/vars[1]) __
+#define  T196(_,__)_ fp_less(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T203(_,__)_ fp_less((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T201(_,__)_ fp_less((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T202(_,__)_ fp_less((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T200(_,__)_ fp_less((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T197(_,__)_ fp_less((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T195(_,__)_ fp_less((vars[0]+c.l4+vars[1]),c.l6) __
+#define T3444(_,__)_ fp_less(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3628(_,__)_ fp_less(fp_inv(fp_abs(vars[0])),c.l1) __
+#define T3445(_,__)_ fp_less(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3443(_,__)_ fp_less(fp_pow(vars[0],c.l2),c.l25) __
+#define T3442(_,__)_ fp_less(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3441(_,__)_ fp_less(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3440(_,__)_ fp_less(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T3591(_,__)_ fp_less(vars[0],(fp_truth(c.l1) ? c.l0_5 : c.l0)) __
+#define  T326(_,__)_ fp_less(vars[0],c.l0) ? (fp_less(vars[1],c.l0) ? vars[0]+vars[1] : vars[0]-vars[1]) : (fp_greater(vars[1],c.l0) ? vars[0]*vars[1] : vars[0]+c.l2*vars[1]) __
+#define T3620(_,__)_ fp_less(vars[0],c.l0) ? fp_ceil(vars[0]) : fp_floor(vars[0]) __
+#define T3624(_,__)_ fp_less(vars[0],c.l0) ? fp_floor(vars[0]) : fp_ceil(vars[0]) __
+#define  T536(_,__)_ fp_less(vars[0],c.l0_5) __
+#define T3776(_,__)_ fp_less(vars[0],vars[1]) __
+#define  T308(_,__)_ fp_less(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T198(_,__)_ fp_less(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T199(_,__)_ fp_less(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define  T284(_,__)_ fp_less(vars[0],vars[1])&&fp_equal(vars[0],vars[1]) __
+#define  T286(_,__)_ fp_less(vars[0],vars[1])&&fp_greater(vars[0],vars[1]) __
+#define  T285(_,__)_ fp_less(vars[0],vars[1])&&fp_greaterOrEq(vars[0],vars[1]) __
+#define  T287(_,__)_ fp_less(vars[0],vars[1])&&fp_lessOrEq(vars[0],vars[1]) __
+#define  T288(_,__)_ fp_less(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]) __
+#define  T289(_,__)_ fp_less(vars[0],vars[1])||fp_equal(vars[0],vars[1]) __
+#define  T291(_,__)_ fp_less(vars[0],vars[1])||fp_greater(vars[0],vars[1]) __
+#define  T290(_,__)_ fp_less(vars[0],vars[1])||fp_greaterOrEq(vars[0],vars[1]) __
+#define  T292(_,__)_ fp_less(vars[0],vars[1])||fp_lessOrEq(vars[0],vars[1]) __
+#define  T293(_,__)_ fp_less(vars[0],vars[1])||fp_nequal(vars[0],vars[1]) __
+#define  T187(_,__)_ fp_lessOrEq(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T194(_,__)_ fp_lessOrEq((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T192(_,__)_ fp_lessOrEq((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T193(_,__)_ fp_lessOrEq((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T191(_,__)_ fp_lessOrEq((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T188(_,__)_ fp_lessOrEq((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T186(_,__)_ fp_lessOrEq((vars[0]+c.l4+vars[1]),c.l6) __
+#define T3438(_,__)_ fp_lessOrEq(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3439(_,__)_ fp_lessOrEq(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3437(_,__)_ fp_lessOrEq(fp_pow(vars[0],c.l2),c.l25) __
+#define T3436(_,__)_ fp_lessOrEq(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3435(_,__)_ fp_lessOrEq(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3434(_,__)_ fp_lessOrEq(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T3621(_,__)_ fp_lessOrEq(vars[0],c.l0) ? fp_ceil(vars[0]) : fp_floor(vars[0]) __
+#define T3625(_,__)_ fp_lessOrEq(vars[0],c.l0) ? fp_floor(vars[0]) : fp_ceil(vars[0]) __
+#define  T525(_,__)_ fp_lessOrEq(vars[0],c.lm0_5) __
+#define T3775(_,__)_ fp_lessOrEq(vars[0],vars[1]) __
+#define  T307(_,__)_ fp_lessOrEq(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T189(_,__)_ fp_lessOrEq(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T190(_,__)_ fp_lessOrEq(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define  T280(_,__)_ fp_lessOrEq(vars[0],vars[1])&&fp_equal(vars[0],vars[1]) __
+#define  T281(_,__)_ fp_lessOrEq(vars[0],vars[1])&&fp_nequal(vars[0],vars[1]) __
+#define  T282(_,__)_ fp_lessOrEq(vars[0],vars[1])||fp_equal(vars[0],vars[1]) __
+#define  T283(_,__)_ fp_lessOrEq(vars[0],vars[1])||fp_nequal(vars[0],vars[1]) __
+#define T3596(_,__)_ fp_log((fp_truth(c.l1) ? c.l5 : c.l0)*vars[0]*vars[1]) __
+#define T3631(_,__)_ fp_log(-vars[0]) __
+#define T3098(_,__)_ fp_log(-vars[0])+fp_log(-vars[0]) __
+#define T5876(_,__)_ fp_log(-vars[0])+fp_log(-vars[0]) __
+#define T5877(_,__)_ fp_log(-vars[0])+fp_sin(-vars[0]) __
+#define T3099(_,__)_ fp_log(-vars[0])+fp_sin(-vars[0]) __
+#define T3100(_,__)_ fp_log(-vars[0])+fp_sinh(-vars[0]) __
+#define T5878(_,__)_ fp_log(-vars[0])+fp_sinh(-vars[0]) __
+#define T3101(_,__)_ fp_log(-vars[0])+fp_tan(-vars[0]) __
+#define T5879(_,__)_ fp_log(-vars[0])+fp_tan(-vars[0]) __
+#define T5880(_,__)_ fp_log(-vars[0])+fp_tanh(-vars[0]) __
+#define T3102(_,__)_ fp_log(-vars[0])+fp_tanh(-vars[0]) __
+#define T1989(_,__)_ fp_log(-vars[0])-fp_acos(-vars[0]) __
+#define T4997(_,__)_ fp_log(-vars[0])-fp_acos(-vars[0]) __
+#define T2177(_,__)_ fp_log(-vars[0])-fp_acos(vars[0]) __
+#define T5148(_,__)_ fp_log(-vars[0])-fp_acos(vars[0]) __
+#define T1990(_,__)_ fp_log(-vars[0])-fp_acosh(-vars[0]) __
+#define T4998(_,__)_ fp_log(-vars[0])-fp_acosh(-vars[0]) __
+#define T5149(_,__)_ fp_log(-vars[0])-fp_acosh(vars[0]) __
+#define T1991(_,__)_ fp_log(-vars[0])-fp_asin(-vars[0]) __
+#define T4999(_,__)_ fp_log(-vars[0])-fp_asin(-vars[0]) __
+#define T2178(_,__)_ fp_log(-vars[0])-fp_asin(vars[0]) __
+#define T5150(_,__)_ fp_log(-vars[0])-fp_asin(vars[0]) __
+#define T5000(_,__)_ fp_log(-vars[0])-fp_asinh(-vars[0]) __
+#define T1992(_,__)_ fp_log(-vars[0])-fp_asinh(-vars[0]) __
+#define T2179(_,__)_ fp_log(-vars[0])-fp_asinh(vars[0]) __
+#define T5151(_,__)_ fp_log(-vars[0])-fp_asinh(vars[0]) __
+#define T1993(_,__)_ fp_log(-vars[0])-fp_atan(-vars[0]) __
+#define T5001(_,__)_ fp_log(-vars[0])-fp_atan(-vars[0]) __
+#define T5152(_,__)_ fp_log(-vars[0])-fp_atan(vars[0]) __
+#define T2180(_,__)_ fp_log(-vars[0])-fp_atan(vars[0]) __
+#define T1994(_,__)_ fp_log(-vars[0])-fp_atanh(-vars[0]) __
+#define T2181(_,__)_ fp_log(-vars[0])-fp_atanh(vars[0]) __
+#define T5002(_,__)_ fp_log(-vars[0])-fp_cos(-vars[0]) __
+#define T1995(_,__)_ fp_log(-vars[0])-fp_cos(-vars[0]) __
+#define T5153(_,__)_ fp_log(-vars[0])-fp_cos(vars[0]) __
+#define T2182(_,__)_ fp_log(-vars[0])-fp_cos(vars[0]) __
+#define T5003(_,__)_ fp_log(-vars[0])-fp_cosh(-vars[0]) __
+#define T1996(_,__)_ fp_log(-vars[0])-fp_cosh(-vars[0]) __
+#define T5154(_,__)_ fp_log(-vars[0])-fp_cosh(vars[0]) __
+#define T2183(_,__)_ fp_log(-vars[0])-fp_cosh(vars[0]) __
+#define T1997(_,__)_ fp_log(-vars[0])-fp_exp(-vars[0]) __
+#define T5004(_,__)_ fp_log(-vars[0])-fp_exp(-vars[0]) __
+#define T5155(_,__)_ fp_log(-vars[0])-fp_exp(vars[0]) __
+#define T2184(_,__)_ fp_log(-vars[0])-fp_exp(vars[0]) __
+#define T5005(_,__)_ fp_log(-vars[0])-fp_log(-vars[0]) __
+#define T1998(_,__)_ fp_log(-vars[0])-fp_log(-vars[0]) __
+#define T5156(_,__)_ fp_log(-vars[0])-fp_log(vars[0]) __
+#define T1999(_,__)_ fp_log(-vars[0])-fp_sin(-vars[0]) __
+#define T5006(_,__)_ fp_log(-vars[0])-fp_sin(-vars[0]) __
+#define T2185(_,__)_ fp_log(-vars[0])-fp_sin(vars[0]) __
+#define T5157(_,__)_ fp_log(-vars[0])-fp_sin(vars[0]) __
+#define T5007(_,__)_ fp_log(-vars[0])-fp_sinh(-vars[0]) __
+#define T2000(_,__)_ fp_log(-vars[0])-fp_sinh(-vars[0]) __
+#define T2186(_,__)_ fp_log(-vars[0])-fp_sinh(vars[0]) __
+#define T5158(_,__)_ fp_log(-vars[0])-fp_sinh(vars[0]) __
+#define T2001(_,__)_ fp_log(-vars[0])-fp_tan(-vars[0]) __
+#define T5008(_,__)_ fp_log(-vars[0])-fp_tan(-vars[0]) __
+#define T5159(_,__)_ fp_log(-vars[0])-fp_tan(vars[0]) __
+#define T2187(_,__)_ fp_log(-vars[0])-fp_tan(vars[0]) __
+#define T5009(_,__)_ fp_log(-vars[0])-fp_tanh(-vars[0]) __
+#define T2002(_,__)_ fp_log(-vars[0])-fp_tanh(-vars[0]) __
+#define T2188(_,__)_ fp_log(-vars[0])-fp_tanh(vars[0]) __
+#define T5160(_,__)_ fp_log(-vars[0])-fp_tanh(vars[0]) __
+#define T1362(_,__)_ fp_log(Value_t(fp_abs(vars[0]))) __
+#define T4472(_,__)_ fp_log(Value_t(fp_arg(vars[0]))) __
+#define T4478(_,__)_ fp_log(Value_t(fp_imag(vars[0]))) __
+#define T3546(_,__)_ fp_log(Value_t(fp_less(vars[0],vars[1]))+c.l0_8) __
+#define T4492(_,__)_ fp_log(Value_t(fp_real(vars[0]))) __
+#define  T526(_,__)_ fp_log(c.l1_1)+vars[0] __
+#define T4461(_,__)_ fp_log(fp_acos(vars[0])) __
+#define T1354(_,__)_ fp_log(fp_acos(vars[0])) __
+#define T4462(_,__)_ fp_log(fp_acosh(vars[0])) __
+#define T1355(_,__)_ fp_log(fp_acosh(vars[0]+c.l0_6)) __
+#define T1356(_,__)_ fp_log(fp_asin(vars[0])) __
+#define T4463(_,__)_ fp_log(fp_asin(vars[0])) __
+#define T4464(_,__)_ fp_log(fp_asinh(vars[0])) __
+#define T1357(_,__)_ fp_log(fp_asinh(vars[0])) __
+#define T4466(_,__)_ fp_log(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1361(_,__)_ fp_log(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4468(_,__)_ fp_log(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T4465(_,__)_ fp_log(fp_atan(vars[0])) __
+#define T1358(_,__)_ fp_log(fp_atan(vars[0])) __
+#define T1359(_,__)_ fp_log(fp_atan(vars[0]/vars[1])) __
+#define T1352(_,__)_ fp_log(fp_atan2(vars[0],vars[1])) __
+#define T1360(_,__)_ fp_log(fp_atanh(vars[0])) __
+#define T4467(_,__)_ fp_log(fp_atanh(vars[0])) __
+#define T1364(_,__)_ fp_log(fp_cbrt(vars[0])) __
+#define T4469(_,__)_ fp_log(fp_cbrt(vars[0])) __
+#define T4485(_,__)_ fp_log(fp_conj(vars[0])) __
+#define T1367(_,__)_ fp_log(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1363(_,__)_ fp_log(fp_cos(vars[0])) __
+#define T1366(_,__)_ fp_log(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1365(_,__)_ fp_log(fp_cosh(vars[0])) __
+#define T4470(_,__)_ fp_log(fp_cosh(vars[0])) __
+#define T1373(_,__)_ fp_log(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T501(_,__)_ fp_log(fp_exp(vars[0])) __
+#define T1372(_,__)_ fp_log(fp_exp(vars[0])) __
+#define T1369(_,__)_ fp_log(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1368(_,__)_ fp_log(fp_exp2(vars[0])) __
+#define T4471(_,__)_ fp_log(fp_exp2(vars[0])) __
+#define T4474(_,__)_ fp_log(fp_hypot(c.l1,vars[0])) __
+#define T1374(_,__)_ fp_log(fp_hypot(c.l1,vars[0])) __
+#define T4475(_,__)_ fp_log(fp_hypot(c.l2,vars[0])) __
+#define T1375(_,__)_ fp_log(fp_hypot(c.l2,vars[0])) __
+#define T4476(_,__)_ fp_log(fp_hypot(vars[0],c.l1)) __
+#define T1377(_,__)_ fp_log(fp_hypot(vars[0],c.l1)) __
+#define T4477(_,__)_ fp_log(fp_hypot(vars[0],c.l2)) __
+#define T1378(_,__)_ fp_log(fp_hypot(vars[0],c.l2)) __
+#define T4473(_,__)_ fp_log(fp_hypot(vars[0],vars[1])) __
+#define T1376(_,__)_ fp_log(fp_hypot(vars[0],vars[1])) __
+#define T4479(_,__)_ fp_log(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1380(_,__)_ fp_log(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1379(_,__)_ fp_log(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1371(_,__)_ fp_log(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1370(_,__)_ fp_log(fp_inv(fp_cos(vars[0]))) __
+#define T1381(_,__)_ fp_log(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4481(_,__)_ fp_log(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1382(_,__)_ fp_log(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4482(_,__)_ fp_log(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1384(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4483(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4484(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1385(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1383(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4480(_,__)_ fp_log(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1353(_,__)_ fp_log(fp_inv(fp_sin(vars[0]))) __
+#define T4460(_,__)_ fp_log(fp_inv(fp_sin(vars[0]))) __
+#define T4489(_,__)_ fp_log(fp_inv(fp_tan(vars[0]))) __
+#define T1389(_,__)_ fp_log(fp_inv(fp_tan(vars[0]))) __
+#define T3545(_,__)_ fp_log(fp_less(vars[0],vars[1]) ? c.l1_1 : c.l0_9) __
+#define T4486(_,__)_ fp_log(fp_log(vars[0])) __
+#define T1387(_,__)_ fp_log(fp_log(vars[0]+c.l0_6)) __
+#define T4488(_,__)_ fp_log(fp_log10(vars[0])) __
+#define T1388(_,__)_ fp_log(fp_log10(vars[0]+c.l0_6)) __
+#define T4487(_,__)_ fp_log(fp_log2(vars[0])) __
+#define T1386(_,__)_ fp_log(fp_log2(vars[0]+c.l0_6)) __
+#define T4491(_,__)_ fp_log(fp_polar(vars[0],vars[1])) __
+#define  T533(_,__)_ fp_log(fp_pow(c.l1_1,vars[0])*c.l4_1) __
+#define  T581(_,__)_ fp_log(fp_pow(vars[0],c.l2)) __
+#define T1390(_,__)_ fp_log(fp_pow(vars[0],vars[1])) __
+#define T4490(_,__)_ fp_log(fp_pow(vars[0],vars[1])) __
+#define T1391(_,__)_ fp_log(fp_sin(vars[0])) __
+#define T4493(_,__)_ fp_log(fp_sin(vars[0])) __
+#define T1392(_,__)_ fp_log(fp_sinh(vars[0])) __
+#define T4494(_,__)_ fp_log(fp_sinh(vars[0])) __
+#define T4495(_,__)_ fp_log(fp_sqrt(vars[0])) __
+#define T1393(_,__)_ fp_log(fp_sqrt(vars[0])) __
+#define T1394(_,__)_ fp_log(fp_tan(vars[0])) __
+#define T4496(_,__)_ fp_log(fp_tan(vars[0])) __
+#define T4497(_,__)_ fp_log(fp_tanh(vars[0])) __
+#define T1395(_,__)_ fp_log(fp_tanh(vars[0])) __
+#define T1809(_,__)_ fp_log(vars[0]) __
+#define T4812(_,__)_ fp_log(vars[0]) __
+#define T3231(_,__)_ fp_log(vars[0])+fp_acos(-vars[0]) __
+#define T5975(_,__)_ fp_log(vars[0])+fp_acos(-vars[0]) __
+#define T5976(_,__)_ fp_log(vars[0])+fp_acosh(-vars[0]) __
+#define T5977(_,__)_ fp_log(vars[0])+fp_asin(-vars[0]) __
+#define T3232(_,__)_ fp_log(vars[0])+fp_asin(-vars[0]) __
+#define T3233(_,__)_ fp_log(vars[0])+fp_asinh(-vars[0]) __
+#define T5978(_,__)_ fp_log(vars[0])+fp_asinh(-vars[0]) __
+#define T5979(_,__)_ fp_log(vars[0])+fp_atan(-vars[0]) __
+#define T3234(_,__)_ fp_log(vars[0])+fp_atan(-vars[0]) __
+#define T5980(_,__)_ fp_log(vars[0])+fp_atanh(-vars[0]) __
+#define T3235(_,__)_ fp_log(vars[0])+fp_atanh(-vars[0]) __
+#define T3236(_,__)_ fp_log(vars[0])+fp_cos(-vars[0]) __
+#define T5981(_,__)_ fp_log(vars[0])+fp_cos(-vars[0]) __
+#define T5982(_,__)_ fp_log(vars[0])+fp_cosh(-vars[0]) __
+#define T3237(_,__)_ fp_log(vars[0])+fp_cosh(-vars[0]) __
+#define T3238(_,__)_ fp_log(vars[0])+fp_exp(-vars[0]) __
+#define T5983(_,__)_ fp_log(vars[0])+fp_exp(-vars[0]) __
+#define T5984(_,__)_ fp_log(vars[0])+fp_log(-vars[0]) __
+#define T6100(_,__)_ fp_log(vars[0])+fp_log(vars[0]) __
+#define T3386(_,__)_ fp_log(vars[0])+fp_log(vars[0]) __
+#define T3412(_,__)_ fp_log(vars[0])+fp_log(vars[1]) __
+#define T5985(_,__)_ fp_log(vars[0])+fp_sin(-vars[0]) __
+#define T3239(_,__)_ fp_log(vars[0])+fp_sin(-vars[0]) __
+#define T6101(_,__)_ fp_log(vars[0])+fp_sin(vars[0]) __
+#define T3387(_,__)_ fp_log(vars[0])+fp_sin(vars[0]) __
+#define T5986(_,__)_ fp_log(vars[0])+fp_sinh(-vars[0]) __
+#define T3240(_,__)_ fp_log(vars[0])+fp_sinh(-vars[0]) __
+#define T3388(_,__)_ fp_log(vars[0])+fp_sinh(vars[0]) __
+#define T6102(_,__)_ fp_log(vars[0])+fp_sinh(vars[0]) __
+#define T5987(_,__)_ fp_log(vars[0])+fp_tan(-vars[0]) __
+#define T3241(_,__)_ fp_log(vars[0])+fp_tan(-vars[0]) __
+#define T6103(_,__)_ fp_log(vars[0])+fp_tan(vars[0]) __
+#define T3389(_,__)_ fp_log(vars[0])+fp_tan(vars[0]) __
+#define T5988(_,__)_ fp_log(vars[0])+fp_tanh(-vars[0]) __
+#define T3242(_,__)_ fp_log(vars[0])+fp_tanh(-vars[0]) __
+#define T6104(_,__)_ fp_log(vars[0])+fp_tanh(vars[0]) __
+#define T3390(_,__)_ fp_log(vars[0])+fp_tanh(vars[0]) __
+#define T2363(_,__)_ fp_log(vars[0])-fp_acos(-vars[0]) __
+#define T5298(_,__)_ fp_log(vars[0])-fp_acos(-vars[0]) __
+#define T2551(_,__)_ fp_log(vars[0])-fp_acos(vars[0]) __
+#define T5450(_,__)_ fp_log(vars[0])-fp_acos(vars[0]) __
+#define T5299(_,__)_ fp_log(vars[0])-fp_acosh(-vars[0]) __
+#define T2552(_,__)_ fp_log(vars[0])-fp_acosh(vars[0]) __
+#define T5451(_,__)_ fp_log(vars[0])-fp_acosh(vars[0]) __
+#define T2364(_,__)_ fp_log(vars[0])-fp_asin(-vars[0]) __
+#define T5300(_,__)_ fp_log(vars[0])-fp_asin(-vars[0]) __
+#define T2553(_,__)_ fp_log(vars[0])-fp_asin(vars[0]) __
+#define T5452(_,__)_ fp_log(vars[0])-fp_asin(vars[0]) __
+#define T2365(_,__)_ fp_log(vars[0])-fp_asinh(-vars[0]) __
+#define T5301(_,__)_ fp_log(vars[0])-fp_asinh(-vars[0]) __
+#define T5453(_,__)_ fp_log(vars[0])-fp_asinh(vars[0]) __
+#define T2554(_,__)_ fp_log(vars[0])-fp_asinh(vars[0]) __
+#define T2366(_,__)_ fp_log(vars[0])-fp_atan(-vars[0]) __
+#define T5302(_,__)_ fp_log(vars[0])-fp_atan(-vars[0]) __
+#define T5454(_,__)_ fp_log(vars[0])-fp_atan(vars[0]) __
+#define T2555(_,__)_ fp_log(vars[0])-fp_atan(vars[0]) __
+#define T5303(_,__)_ fp_log(vars[0])-fp_atanh(-vars[0]) __
+#define T2367(_,__)_ fp_log(vars[0])-fp_atanh(-vars[0]) __
+#define T5455(_,__)_ fp_log(vars[0])-fp_atanh(vars[0]) __
+#define T2556(_,__)_ fp_log(vars[0])-fp_atanh(vars[0]) __
+#define T2368(_,__)_ fp_log(vars[0])-fp_cos(-vars[0]) __
+#define T5304(_,__)_ fp_log(vars[0])-fp_cos(-vars[0]) __
+#define T2557(_,__)_ fp_log(vars[0])-fp_cos(vars[0]) __
+#define T5456(_,__)_ fp_log(vars[0])-fp_cos(vars[0]) __
+#define T5305(_,__)_ fp_log(vars[0])-fp_cosh(-vars[0]) __
+#define T2369(_,__)_ fp_log(vars[0])-fp_cosh(-vars[0]) __
+#define T5457(_,__)_ fp_log(vars[0])-fp_cosh(vars[0]) __
+#define T2558(_,__)_ fp_log(vars[0])-fp_cosh(vars[0]) __
+#define T2370(_,__)_ fp_log(vars[0])-fp_exp(-vars[0]) __
+#define T5306(_,__)_ fp_log(vars[0])-fp_exp(-vars[0]) __
+#define T2559(_,__)_ fp_log(vars[0])-fp_exp(vars[0]) __
+#define T5458(_,__)_ fp_log(vars[0])-fp_exp(vars[0]) __
+#define T5307(_,__)_ fp_log(vars[0])-fp_log(-vars[0]) __
+#define T2560(_,__)_ fp_log(vars[0])-fp_log(vars[0]) __
+#define T5459(_,__)_ fp_log(vars[0])-fp_log(vars[0]) __
+#define T2371(_,__)_ fp_log(vars[0])-fp_sin(-vars[0]) __
+#define T5308(_,__)_ fp_log(vars[0])-fp_sin(-vars[0]) __
+#define T5460(_,__)_ fp_log(vars[0])-fp_sin(vars[0]) __
+#define T2561(_,__)_ fp_log(vars[0])-fp_sin(vars[0]) __
+#define T5309(_,__)_ fp_log(vars[0])-fp_sinh(-vars[0]) __
+#define T2372(_,__)_ fp_log(vars[0])-fp_sinh(-vars[0]) __
+#define T5461(_,__)_ fp_log(vars[0])-fp_sinh(vars[0]) __
+#define T2562(_,__)_ fp_log(vars[0])-fp_sinh(vars[0]) __
+#define T5310(_,__)_ fp_log(vars[0])-fp_tan(-vars[0]) __
+#define T2373(_,__)_ fp_log(vars[0])-fp_tan(-vars[0]) __
+#define T2563(_,__)_ fp_log(vars[0])-fp_tan(vars[0]) __
+#define T5462(_,__)_ fp_log(vars[0])-fp_tan(vars[0]) __
+#define T5311(_,__)_ fp_log(vars[0])-fp_tanh(-vars[0]) __
+#define T2374(_,__)_ fp_log(vars[0])-fp_tanh(-vars[0]) __
+#define T5463(_,__)_ fp_log(vars[0])-fp_tanh(vars[0]) __
+#define T2564(_,__)_ fp_log(vars[0])-fp_tanh(vars[0]) __
+#define T6113(_,__)_ fp_log(vars[0]*vars[0]) __
+#define T3665(_,__)_ fp_log(vars[0]*vars[0])+fp_abs(fp_exp(fp_abs(vars[0])+c.l1)) __
+#define T1406(_,__)_ fp_log10(Value_t(fp_abs(vars[0]))) __
+#define T4510(_,__)_ fp_log10(Value_t(fp_arg(vars[0]))) __
+#define T4516(_,__)_ fp_log10(Value_t(fp_imag(vars[0]))) __
+#define T3548(_,__)_ fp_log10(Value_t(fp_less(vars[0],vars[1]))+c.l1_4) __
+#define T4530(_,__)_ fp_log10(Value_t(fp_real(vars[0]))) __
+#define  T530(_,__)_ fp_log10(c.l1_1)+vars[0] __
+#define T1398(_,__)_ fp_log10(fp_acos(vars[0])) __
+#define T4499(_,__)_ fp_log10(fp_acos(vars[0])) __
+#define T4500(_,__)_ fp_log10(fp_acosh(vars[0])) __
+#define T1399(_,__)_ fp_log10(fp_acosh(vars[0]+c.l0_6)) __
+#define T1400(_,__)_ fp_log10(fp_asin(vars[0])) __
+#define T4501(_,__)_ fp_log10(fp_asin(vars[0])) __
+#define T1401(_,__)_ fp_log10(fp_asinh(vars[0])) __
+#define T4502(_,__)_ fp_log10(fp_asinh(vars[0])) __
+#define T4504(_,__)_ fp_log10(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1405(_,__)_ fp_log10(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4506(_,__)_ fp_log10(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T4503(_,__)_ fp_log10(fp_atan(vars[0])) __
+#define T1402(_,__)_ fp_log10(fp_atan(vars[0])) __
+#define T1403(_,__)_ fp_log10(fp_atan(vars[0]/vars[1])) __
+#define T1396(_,__)_ fp_log10(fp_atan2(vars[0],vars[1])) __
+#define T1404(_,__)_ fp_log10(fp_atanh(vars[0])) __
+#define T4505(_,__)_ fp_log10(fp_atanh(vars[0])) __
+#define T1408(_,__)_ fp_log10(fp_cbrt(vars[0])) __
+#define T4507(_,__)_ fp_log10(fp_cbrt(vars[0])) __
+#define T4523(_,__)_ fp_log10(fp_conj(vars[0])) __
+#define T1411(_,__)_ fp_log10(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1407(_,__)_ fp_log10(fp_cos(vars[0])) __
+#define T1410(_,__)_ fp_log10(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1409(_,__)_ fp_log10(fp_cosh(vars[0])) __
+#define T4508(_,__)_ fp_log10(fp_cosh(vars[0])) __
+#define T1417(_,__)_ fp_log10(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T503(_,__)_ fp_log10(fp_exp(vars[0])) __
+#define T1416(_,__)_ fp_log10(fp_exp(vars[0])) __
+#define T1413(_,__)_ fp_log10(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1412(_,__)_ fp_log10(fp_exp2(vars[0])) __
+#define T4509(_,__)_ fp_log10(fp_exp2(vars[0])) __
+#define T4512(_,__)_ fp_log10(fp_hypot(c.l1,vars[0])) __
+#define T1418(_,__)_ fp_log10(fp_hypot(c.l1,vars[0])) __
+#define T1419(_,__)_ fp_log10(fp_hypot(c.l2,vars[0])) __
+#define T4513(_,__)_ fp_log10(fp_hypot(c.l2,vars[0])) __
+#define T4514(_,__)_ fp_log10(fp_hypot(vars[0],c.l1)) __
+#define T1421(_,__)_ fp_log10(fp_hypot(vars[0],c.l1)) __
+#define T4515(_,__)_ fp_log10(fp_hypot(vars[0],c.l2)) __
+#define T1422(_,__)_ fp_log10(fp_hypot(vars[0],c.l2)) __
+#define T1420(_,__)_ fp_log10(fp_hypot(vars[0],vars[1])) __
+#define T4511(_,__)_ fp_log10(fp_hypot(vars[0],vars[1])) __
+#define T4517(_,__)_ fp_log10(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1424(_,__)_ fp_log10(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1423(_,__)_ fp_log10(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1415(_,__)_ fp_log10(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1414(_,__)_ fp_log10(fp_inv(fp_cos(vars[0]))) __
+#define T1425(_,__)_ fp_log10(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4519(_,__)_ fp_log10(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1426(_,__)_ fp_log10(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4520(_,__)_ fp_log10(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1428(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4521(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1429(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4522(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4518(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1427(_,__)_ fp_log10(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1397(_,__)_ fp_log10(fp_inv(fp_sin(vars[0]))) __
+#define T4498(_,__)_ fp_log10(fp_inv(fp_sin(vars[0]))) __
+#define T4527(_,__)_ fp_log10(fp_inv(fp_tan(vars[0]))) __
+#define T1433(_,__)_ fp_log10(fp_inv(fp_tan(vars[0]))) __
+#define T3547(_,__)_ fp_log10(fp_less(vars[0],vars[1]) ? c.l0_7 : c.l0_1) __
+#define T4524(_,__)_ fp_log10(fp_log(vars[0])) __
+#define T1431(_,__)_ fp_log10(fp_log(vars[0]+c.l0_6)) __
+#define T4526(_,__)_ fp_log10(fp_log10(vars[0])) __
+#define T1432(_,__)_ fp_log10(fp_log10(vars[0]+c.l0_6)) __
+#define T4525(_,__)_ fp_log10(fp_log2(vars[0])) __
+#define T1430(_,__)_ fp_log10(fp_log2(vars[0]+c.l0_6)) __
+#define T4529(_,__)_ fp_log10(fp_polar(vars[0],vars[1])) __
+#define  T535(_,__)_ fp_log10(fp_pow(c.l1_1,vars[0])*c.l4_1) __
+#define  T583(_,__)_ fp_log10(fp_pow(vars[0],c.l2)) __
+#define T1434(_,__)_ fp_log10(fp_pow(vars[0],vars[1])) __
+#define T4528(_,__)_ fp_log10(fp_pow(vars[0],vars[1])) __
+#define T4531(_,__)_ fp_log10(fp_sin(vars[0])) __
+#define T1435(_,__)_ fp_log10(fp_sin(vars[0])) __
+#define T1436(_,__)_ fp_log10(fp_sinh(vars[0])) __
+#define T4532(_,__)_ fp_log10(fp_sinh(vars[0])) __
+#define T1437(_,__)_ fp_log10(fp_sqrt(vars[0])) __
+#define T4533(_,__)_ fp_log10(fp_sqrt(vars[0])) __
+#define T4534(_,__)_ fp_log10(fp_tan(vars[0])) __
+#define T1438(_,__)_ fp_log10(fp_tan(vars[0])) __
+#define T4535(_,__)_ fp_log10(fp_tanh(vars[0])) __
+#define T1439(_,__)_ fp_log10(fp_tanh(vars[0])) __
+#define T1810(_,__)_ fp_log10(vars[0]) __
+#define T4814(_,__)_ fp_log10(vars[0]) __
+#define T1318(_,__)_ fp_log2(Value_t(fp_abs(vars[0]))) __
+#define T4434(_,__)_ fp_log2(Value_t(fp_arg(vars[0]))) __
+#define T4440(_,__)_ fp_log2(Value_t(fp_imag(vars[0]))) __
+#define T3544(_,__)_ fp_log2(Value_t(fp_less(vars[0],vars[1]))+c.l0_2) __
+#define T4454(_,__)_ fp_log2(Value_t(fp_real(vars[0]))) __
+#define  T527(_,__)_ fp_log2(c.l1_1)+vars[0] __
+#define T1310(_,__)_ fp_log2(fp_acos(vars[0])) __
+#define T4423(_,__)_ fp_log2(fp_acos(vars[0])) __
+#define T4424(_,__)_ fp_log2(fp_acosh(vars[0])) __
+#define T1311(_,__)_ fp_log2(fp_acosh(vars[0]+c.l0_6)) __
+#define T4425(_,__)_ fp_log2(fp_asin(vars[0])) __
+#define T1312(_,__)_ fp_log2(fp_asin(vars[0])) __
+#define T1313(_,__)_ fp_log2(fp_asinh(vars[0])) __
+#define T4426(_,__)_ fp_log2(fp_asinh(vars[0])) __
+#define T4428(_,__)_ fp_log2(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1317(_,__)_ fp_log2(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4430(_,__)_ fp_log2(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T1314(_,__)_ fp_log2(fp_atan(vars[0])) __
+#define T4427(_,__)_ fp_log2(fp_atan(vars[0])) __
+#define T1315(_,__)_ fp_log2(fp_atan(vars[0]/vars[1])) __
+#define T1308(_,__)_ fp_log2(fp_atan2(vars[0],vars[1])) __
+#define T1316(_,__)_ fp_log2(fp_atanh(vars[0])) __
+#define T4429(_,__)_ fp_log2(fp_atanh(vars[0])) __
+#define T4431(_,__)_ fp_log2(fp_cbrt(vars[0])) __
+#define T1320(_,__)_ fp_log2(fp_cbrt(vars[0])) __
+#define T4447(_,__)_ fp_log2(fp_conj(vars[0])) __
+#define T1323(_,__)_ fp_log2(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1319(_,__)_ fp_log2(fp_cos(vars[0])) __
+#define T1322(_,__)_ fp_log2(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4432(_,__)_ fp_log2(fp_cosh(vars[0])) __
+#define T1321(_,__)_ fp_log2(fp_cosh(vars[0])) __
+#define T1329(_,__)_ fp_log2(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1328(_,__)_ fp_log2(fp_exp(vars[0])) __
+#define  T502(_,__)_ fp_log2(fp_exp(vars[0])) __
+#define T1325(_,__)_ fp_log2(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define  T498(_,__)_ fp_log2(fp_exp2(vars[0])) __
+#define T1324(_,__)_ fp_log2(fp_exp2(vars[0])) __
+#define T4433(_,__)_ fp_log2(fp_exp2(vars[0])) __
+#define T4436(_,__)_ fp_log2(fp_hypot(c.l1,vars[0])) __
+#define T1330(_,__)_ fp_log2(fp_hypot(c.l1,vars[0])) __
+#define T4437(_,__)_ fp_log2(fp_hypot(c.l2,vars[0])) __
+#define T1331(_,__)_ fp_log2(fp_hypot(c.l2,vars[0])) __
+#define T1333(_,__)_ fp_log2(fp_hypot(vars[0],c.l1)) __
+#define T4438(_,__)_ fp_log2(fp_hypot(vars[0],c.l1)) __
+#define T4439(_,__)_ fp_log2(fp_hypot(vars[0],c.l2)) __
+#define T1334(_,__)_ fp_log2(fp_hypot(vars[0],c.l2)) __
+#define T4435(_,__)_ fp_log2(fp_hypot(vars[0],vars[1])) __
+#define T1332(_,__)_ fp_log2(fp_hypot(vars[0],vars[1])) __
+#define T4441(_,__)_ fp_log2(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1336(_,__)_ fp_log2(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1335(_,__)_ fp_log2(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1327(_,__)_ fp_log2(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1326(_,__)_ fp_log2(fp_inv(fp_cos(vars[0]))) __
+#define T4443(_,__)_ fp_log2(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1337(_,__)_ fp_log2(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4444(_,__)_ fp_log2(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1338(_,__)_ fp_log2(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4445(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1340(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4446(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1341(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1339(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4442(_,__)_ fp_log2(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4422(_,__)_ fp_log2(fp_inv(fp_sin(vars[0]))) __
+#define T1309(_,__)_ fp_log2(fp_inv(fp_sin(vars[0]))) __
+#define T1345(_,__)_ fp_log2(fp_inv(fp_tan(vars[0]))) __
+#define T4451(_,__)_ fp_log2(fp_inv(fp_tan(vars[0]))) __
+#define T3543(_,__)_ fp_log2(fp_less(vars[0],vars[1]) ? c.l1_1 : c.l1_1) __
+#define T4448(_,__)_ fp_log2(fp_log(vars[0])) __
+#define T1343(_,__)_ fp_log2(fp_log(vars[0]+c.l0_6)) __
+#define T4450(_,__)_ fp_log2(fp_log10(vars[0])) __
+#define T1344(_,__)_ fp_log2(fp_log10(vars[0]+c.l0_6)) __
+#define T4449(_,__)_ fp_log2(fp_log2(vars[0])) __
+#define T1342(_,__)_ fp_log2(fp_log2(vars[0]+c.l0_6)) __
+#define T4453(_,__)_ fp_log2(fp_polar(vars[0],vars[1])) __
+#define  T534(_,__)_ fp_log2(fp_pow(c.l1_1,vars[0])*c.l4_1) __
+#define  T582(_,__)_ fp_log2(fp_pow(vars[0],c.l2)) __
+#define T4452(_,__)_ fp_log2(fp_pow(vars[0],vars[1])) __
+#define T1346(_,__)_ fp_log2(fp_pow(vars[0],vars[1])) __
+#define T1347(_,__)_ fp_log2(fp_sin(vars[0])) __
+#define T4455(_,__)_ fp_log2(fp_sin(vars[0])) __
+#define T1348(_,__)_ fp_log2(fp_sinh(vars[0])) __
+#define T4456(_,__)_ fp_log2(fp_sinh(vars[0])) __
+#define T1349(_,__)_ fp_log2(fp_sqrt(vars[0])) __
+#define T4457(_,__)_ fp_log2(fp_sqrt(vars[0])) __
+#define T1350(_,__)_ fp_log2(fp_tan(vars[0])) __
+#define T4458(_,__)_ fp_log2(fp_tan(vars[0])) __
+#define T1351(_,__)_ fp_log2(fp_tanh(vars[0])) __
+#define T4459(_,__)_ fp_log2(fp_tanh(vars[0])) __
+#define T1808(_,__)_ fp_log2(vars[0]) __
+#define T4813(_,__)_ fp_log2(vars[0]) __
+#define T3583(_,__)_ fp_max((fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1)),(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1))) __
+#define   T63(_,__)_ fp_max(c.l5,c.l4)+vars[0] __
+#define  T295(_,__)_ fp_max(vars[2],fp_min(vars[0],fp_max(fp_max(vars[2],vars[1]),vars[0])))+c.l10*fp_min(vars[2],fp_max(vars[0],fp_min(vars[1],vars[0])))+c.l100*fp_min(fp_max(vars[0],vars[1]),fp_min(vars[1],vars[2]))+c.l1000*fp_max(fp_min(vars[0],vars[1]),fp_max(vars[1],vars[2])) __
+#define T3584(_,__)_ fp_min((fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1)),(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1))) __
+#define   T64(_,__)_ fp_min(c.l4,c.l5)+vars[0] __
+#define  T314(_,__)_ fp_min(vars[0],fp_min(c.l1,vars[0])) __
+#define T3676(_,__)_ fp_mod(c.l1_75e21,vars[0]) __
+#define   T65(_,__)_ fp_mod(c.l5,c.l4)+vars[0] __
+#define  T205(_,__)_ fp_nequal(((vars[0]*c.l5/c.l2)+vars[0]*vars[0]-c.l2),((vars[0]*c.l5/c.l2)+Value_t(fp_abs(vars[0])))) __
+#define  T212(_,__)_ fp_nequal((vars[0]*c.l4),(vars[1]+c.l6)) __
+#define  T210(_,__)_ fp_nequal((vars[0]*c.l4*vars[1]),c.l6) __
+#define  T211(_,__)_ fp_nequal((vars[0]*c.lm4),(vars[1]+c.l6)) __
+#define  T209(_,__)_ fp_nequal((vars[0]*c.lm4*vars[1]),c.l6) __
+#define  T206(_,__)_ fp_nequal((vars[0]+c.l4),(vars[1]+c.l6)) __
+#define  T204(_,__)_ fp_nequal((vars[0]+c.l4+vars[1]),c.l6) __
+#define  T300(_,__)_ fp_nequal(Value_t(fp_not(vars[0])),(fp_truth(c.l1) ? c.l1 : c.l1)) __
+#define   T81(_,__)_ fp_nequal(Value_t(fp_not(vars[0])),c.l1) __
+#define T3450(_,__)_ fp_nequal(c.l5_0625,fp_pow(c.l1_5,vars[0])) __
+#define T3451(_,__)_ fp_nequal(fp_pow(c.l2,vars[0]),fp_pow(c.lm4,vars[1])) __
+#define T3449(_,__)_ fp_nequal(fp_pow(vars[0],c.l2),c.l25) __
+#define T3448(_,__)_ fp_nequal(fp_pow(vars[0],c.l3),c.lm125) __
+#define T3447(_,__)_ fp_nequal(fp_pow(vars[0],c.lm2),c.l0_0625) __
+#define T3446(_,__)_ fp_nequal(fp_pow(vars[0],c.lm3),c.lm0_015625) __
+#define T1811(_,__)_ fp_nequal(vars[0],vars[1]) __
+#define  T309(_,__)_ fp_nequal(vars[0],vars[1]) ? c.l0 : c.l1 __
+#define  T207(_,__)_ fp_nequal(vars[0],vars[1]) ? vars[0] : vars[1] __
+#define  T208(_,__)_ fp_nequal(vars[0],vars[1]) ? vars[1] : vars[0] __
+#define   T77(_,__)_ fp_not(-vars[0]) __
+#define   T26(_,__)_ fp_not(fp_abs(vars[0])) __
+#define  T417(_,__)_ fp_not(fp_acos(vars[0])) __
+#define T3606(_,__)_ fp_not(fp_sin(vars[0])+c.l1_2) __
+#define T3587(_,__)_ fp_not(fp_sin(vars[0])+c.l1_2) ? vars[1] : vars[2] __
+#define   T90(_,__)_ fp_not(vars[0]) __
+#define T3590(_,__)_ fp_not(vars[0]) ? vars[1] : vars[2] __
+#define   T91(_,__)_ fp_not(vars[0])&&fp_not(vars[0]) __
+#define  T301(_,__)_ fp_not(vars[0])&&fp_not(vars[1]) __
+#define  T303(_,__)_ fp_not(vars[0])&&fp_not(vars[1])&&fp_not(vars[2]) __
+#define  T302(_,__)_ fp_not(vars[0])&&fp_not(vars[1])&&fp_truth(vars[2]) __
+#define  T296(_,__)_ fp_not(vars[0])||fp_not(vars[1]) __
+#define  T298(_,__)_ fp_not(vars[0])||fp_not(vars[1])||fp_not(vars[2]) __
+#define  T297(_,__)_ fp_not(vars[0])||fp_not(vars[1])||fp_truth(vars[2]) __
+#define  T311(_,__)_ fp_not(vars[0]+(fp_truth(c.l1) ? c.l4 : c.l4)) __
+#define  T104(_,__)_ fp_not(vars[0]+c.l4) __
+#define T3586(_,__)_ fp_or((fp_less(vars[0],c.l4) ? fp_sin(vars[1]) : fp_cos(vars[1]+c.l1)),(fp_less(vars[0],c.l4) ? fp_cos(vars[1]) : fp_sin(vars[1]+c.l1))) __
+#define  T324(_,__)_ fp_or(userDefFuncSqr<Value_t>((uparam[0]=(vars[0]), uparam+0)),userDefFuncSub<Value_t>((uparam[1]=(vars[0]), uparam[2]=(vars[1]), uparam+1)))||fp_truth(userDefFuncValue<Value_t>((uparam[3]=(Value_t()), uparam+3))) __
+#define T4816(_,__)_ fp_polar(vars[0],vars[1]) __
+#define T3613(_,__)_ fp_pow(((c.lm1_1)*vars[0]*vars[1]),c.l2_1) __
+#define T3612(_,__)_ fp_pow(((c.lm5_1)*vars[0]),(c.lm7_1)) __
+#define T3611(_,__)_ fp_pow(((c.lm5_1)*vars[0]*vars[1]),(c.l4)) __
+#define T3610(_,__)_ fp_pow(((c.lm5_1)*vars[0]*vars[1]),(c.lm8)) __
+#define T3614(_,__)_ fp_pow((c.l1_1*vars[0]*vars[1]),c.l2_1) __
+#define  T415(_,__)_ fp_pow((fp_abs(vars[0])*vars[1]),c.l1506) __
+#define  T550(_,__)_ fp_pow(c.l1_1,c.l7_1)+vars[0] __
+#define T3609(_,__)_ fp_pow(c.l3,fp_log(vars[0]))+fp_pow(c.l5,fp_log(vars[0])*fp_sin(vars[0])) __
+#define T3608(_,__)_ fp_pow(c.l5,fp_log(vars[0])+c.l1) __
+#define  T549(_,__)_ fp_pow(c.lm0_25,c.l4)+vars[0] __
+#define  T414(_,__)_ fp_pow(fp_abs(vars[0]),c.l1506) __
+#define  T504(_,__)_ fp_pow(fp_exp(vars[0]),c.l1506) __
+#define  T499(_,__)_ fp_pow(fp_exp2(vars[0]),c.l1506) __
+#define  T565(_,__)_ fp_pow(fp_inv(fp_sqrt(vars[0])),c.l2) __
+#define  T558(_,__)_ fp_pow(fp_pow(vars[0],c.l1_7),c.l1506) __
+#define  T588(_,__)_ fp_pow(fp_pow(vars[0],c.l2),c.l2402) __
+#define  T589(_,__)_ fp_pow(fp_pow(vars[0],c.l2),c.l3_5) __
+#define T3667(_,__)_ fp_pow(fp_pow(vars[0],c.l2),fp_inv(c.l7))+c.l1_1*fp_pow(fp_pow(vars[0],c.l4),fp_inv(c.l5))+c.l1_2*fp_pow(fp_pow(vars[0],c.l6),fp_inv(c.l3)) __
+#define T3666(_,__)_ fp_pow(fp_pow(vars[0],c.l2),fp_inv(c.l8))+c.l1_1*fp_pow(fp_pow(vars[0],c.l3),fp_inv(c.l7))+c.l1_2*fp_pow(fp_pow(vars[0],c.l4),fp_inv(c.l6))+c.l1_3*fp_pow(fp_pow(vars[0],c.l5),fp_inv(c.l5))+c.l1_4*fp_pow(fp_pow(vars[0],c.l6),fp_inv(c.l6))+c.l1_5*fp_pow(fp_pow(vars[0],c.l7),fp_inv(c.l4))+c.l1_6*fp_pow(fp_pow(vars[0],c.l8),fp_inv(c.l3))+c.l1_7*fp_pow(fp_pow(vars[0],c.l9),fp_inv(c.l2))+c.l1_8*fp_sqrt(fp_pow(fp_abs(-fp_sqrt(vars[0])),c.l3)) __
+#define  T603(_,__)_ fp_pow(fp_pow(vars[0],c.l38_5),c.l5) __
+#define  T421(_,__)_ fp_pow(fp_pow(vars[0],c.l4),c.l1_5) __
+#define  T420(_,__)_ fp_pow(fp_pow(vars[0],c.lm4),c.l1_5) __
+#define T3413(_,__)_ fp_pow(fp_sin(vars[0]),c.l2)+fp_pow(fp_cos(vars[0]),c.l2) __
+#define  T587(_,__)_ fp_pow(fp_sqrt(fp_acos(vars[0])),c.l2) __
+#define  T586(_,__)_ fp_pow(fp_sqrt(vars[0]),c.l2) __
+#define  T557(_,__)_ fp_pow(vars[0],(c.l1_0/c.l3_0)) __
+#define  T556(_,__)_ fp_pow(vars[0],(c.lm1_0/c.l3_0)) __
+#define  T552(_,__)_ fp_pow(vars[0],c.l0_5) __
+#define T3646(_,__)_ fp_pow(vars[0],c.l3)*fp_pow(vars[0],c.l4)+fp_pow(vars[1],c.l3)*fp_pow(vars[1],c.l5) __
+#define  T554(_,__)_ fp_pow(vars[0],c.lm0_5) __
+#define  T555(_,__)_ fp_pow(vars[0],c.lm1_0) __
+#define T3652(_,__)_ fp_pow(vars[0],fp_pow(vars[1],vars[2]))+fp_pow(vars[0],c.lm2)*(-fp_pow(vars[1],c.l2))+(-fp_pow(vars[1],-vars[2])) __
+#define T4815(_,__)_ fp_pow(vars[0],vars[1]) __
+#define T1813(_,__)_ fp_pow(vars[0],vars[1]) __
+#define T3639(_,__)_ fp_pow(vars[0],vars[1]) __
+#define T3648(_,__)_ fp_pow(vars[0],vars[1])/fp_log(vars[1])+fp_log(vars[0])/fp_log(vars[1])+fp_log(fp_pow(vars[0],vars[1])) __
+#define T4576(_,__)_ fp_real(Value_t(fp_abs(vars[0]))) __
+#define T4589(_,__)_ fp_real(Value_t(fp_arg(vars[0]))) __
+#define T4586(_,__)_ fp_real(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4595(_,__)_ fp_real(Value_t(fp_imag(vars[0]))) __
+#define T4606(_,__)_ fp_real(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4610(_,__)_ fp_real(Value_t(fp_real(vars[0]))) __
+#define T4565(_,__)_ fp_real(fp_acos(vars[0])) __
+#define T4566(_,__)_ fp_real(fp_acosh(vars[0])) __
+#define T4567(_,__)_ fp_real(fp_asin(vars[0])) __
+#define T4569(_,__)_ fp_real(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4568(_,__)_ fp_real(fp_asinh(vars[0])) __
+#define T4571(_,__)_ fp_real(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4574(_,__)_ fp_real(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4575(_,__)_ fp_real(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4573(_,__)_ fp_real(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4570(_,__)_ fp_real(fp_atan(vars[0])) __
+#define T4572(_,__)_ fp_real(fp_atanh(vars[0])) __
+#define T4578(_,__)_ fp_real(fp_cbrt(vars[0])) __
+#define T4602(_,__)_ fp_real(fp_conj(vars[0])) __
+#define T4581(_,__)_ fp_real(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4577(_,__)_ fp_real(fp_cos(vars[0])) __
+#define T4580(_,__)_ fp_real(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4579(_,__)_ fp_real(fp_cosh(vars[0])) __
+#define T4588(_,__)_ fp_real(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4587(_,__)_ fp_real(fp_exp(vars[0])) __
+#define T4584(_,__)_ fp_real(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4583(_,__)_ fp_real(fp_exp2(vars[0])) __
+#define T4591(_,__)_ fp_real(fp_hypot(c.l1,vars[0])) __
+#define T4592(_,__)_ fp_real(fp_hypot(c.l2,vars[0])) __
+#define T4593(_,__)_ fp_real(fp_hypot(vars[0],c.l1)) __
+#define T4594(_,__)_ fp_real(fp_hypot(vars[0],c.l2)) __
+#define T4590(_,__)_ fp_real(fp_hypot(vars[0],vars[1])) __
+#define T4596(_,__)_ fp_real(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T4585(_,__)_ fp_real(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T4582(_,__)_ fp_real(fp_inv(fp_cos(vars[0]))) __
+#define T4598(_,__)_ fp_real(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4599(_,__)_ fp_real(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4600(_,__)_ fp_real(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4601(_,__)_ fp_real(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4597(_,__)_ fp_real(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4564(_,__)_ fp_real(fp_inv(fp_sin(vars[0]))) __
+#define T4607(_,__)_ fp_real(fp_inv(fp_tan(vars[0]))) __
+#define T4603(_,__)_ fp_real(fp_log(vars[0])) __
+#define T4605(_,__)_ fp_real(fp_log10(vars[0])) __
+#define T4604(_,__)_ fp_real(fp_log2(vars[0])) __
+#define T4609(_,__)_ fp_real(fp_polar(vars[0],vars[1])) __
+#define T4608(_,__)_ fp_real(fp_pow(vars[0],vars[1])) __
+#define T4614(_,__)_ fp_real(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4611(_,__)_ fp_real(fp_sin(vars[0])) __
+#define T4613(_,__)_ fp_real(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4612(_,__)_ fp_real(fp_sinh(vars[0])) __
+#define T4615(_,__)_ fp_real(fp_sqrt(vars[0])) __
+#define T4616(_,__)_ fp_real(fp_tan(vars[0])) __
+#define T4617(_,__)_ fp_real(fp_tanh(vars[0])) __
+#define T4817(_,__)_ fp_real(vars[0]) __
+#define  T545(_,__)_ fp_sin(-vars[0]) __
+#define T3103(_,__)_ fp_sin(-vars[0])+fp_sin(-vars[0]) __
+#define T3104(_,__)_ fp_sin(-vars[0])+fp_sinh(-vars[0]) __
+#define T3105(_,__)_ fp_sin(-vars[0])+fp_tan(-vars[0]) __
+#define T5881(_,__)_ fp_sin(-vars[0])+fp_tan(-vars[0]) __
+#define T5882(_,__)_ fp_sin(-vars[0])+fp_tanh(-vars[0]) __
+#define T3106(_,__)_ fp_sin(-vars[0])+fp_tanh(-vars[0]) __
+#define T5010(_,__)_ fp_sin(-vars[0])-fp_acos(-vars[0]) __
+#define T2003(_,__)_ fp_sin(-vars[0])-fp_acos(-vars[0]) __
+#define T5161(_,__)_ fp_sin(-vars[0])-fp_acos(vars[0]) __
+#define T2189(_,__)_ fp_sin(-vars[0])-fp_acos(vars[0]) __
+#define T2004(_,__)_ fp_sin(-vars[0])-fp_acosh(-vars[0]) __
+#define T5011(_,__)_ fp_sin(-vars[0])-fp_acosh(-vars[0]) __
+#define T2190(_,__)_ fp_sin(-vars[0])-fp_acosh(vars[0]) __
+#define T5162(_,__)_ fp_sin(-vars[0])-fp_acosh(vars[0]) __
+#define T2005(_,__)_ fp_sin(-vars[0])-fp_asin(-vars[0]) __
+#define T5012(_,__)_ fp_sin(-vars[0])-fp_asin(-vars[0]) __
+#define T5163(_,__)_ fp_sin(-vars[0])-fp_asin(vars[0]) __
+#define T2191(_,__)_ fp_sin(-vars[0])-fp_asin(vars[0]) __
+#define T2006(_,__)_ fp_sin(-vars[0])-fp_asinh(-vars[0]) __
+#define T5013(_,__)_ fp_sin(-vars[0])-fp_asinh(-vars[0]) __
+#define T5164(_,__)_ fp_sin(-vars[0])-fp_asinh(vars[0]) __
+#define T2192(_,__)_ fp_sin(-vars[0])-fp_asinh(vars[0]) __
+#define T5014(_,__)_ fp_sin(-vars[0])-fp_atan(-vars[0]) __
+#define T2007(_,__)_ fp_sin(-vars[0])-fp_atan(-vars[0]) __
+#define T2193(_,__)_ fp_sin(-vars[0])-fp_atan(vars[0]) __
+#define T5165(_,__)_ fp_sin(-vars[0])-fp_atan(vars[0]) __
+#define T2008(_,__)_ fp_sin(-vars[0])-fp_atanh(-vars[0]) __
+#define T2194(_,__)_ fp_sin(-vars[0])-fp_atanh(vars[0]) __
+#define T2009(_,__)_ fp_sin(-vars[0])-fp_cos(-vars[0]) __
+#define T2195(_,__)_ fp_sin(-vars[0])-fp_cos(vars[0]) __
+#define T2010(_,__)_ fp_sin(-vars[0])-fp_cosh(-vars[0]) __
+#define T2196(_,__)_ fp_sin(-vars[0])-fp_cosh(vars[0]) __
+#define T2011(_,__)_ fp_sin(-vars[0])-fp_exp(-vars[0]) __
+#define T2197(_,__)_ fp_sin(-vars[0])-fp_exp(vars[0]) __
+#define T5015(_,__)_ fp_sin(-vars[0])-fp_log(-vars[0]) __
+#define T2012(_,__)_ fp_sin(-vars[0])-fp_log(-vars[0]) __
+#define T2198(_,__)_ fp_sin(-vars[0])-fp_log(vars[0]) __
+#define T5166(_,__)_ fp_sin(-vars[0])-fp_log(vars[0]) __
+#define T2013(_,__)_ fp_sin(-vars[0])-fp_sin(-vars[0]) __
+#define T2199(_,__)_ fp_sin(-vars[0])-fp_sin(vars[0]) __
+#define T2014(_,__)_ fp_sin(-vars[0])-fp_sinh(-vars[0]) __
+#define T2200(_,__)_ fp_sin(-vars[0])-fp_sinh(vars[0]) __
+#define T5016(_,__)_ fp_sin(-vars[0])-fp_tan(-vars[0]) __
+#define T2015(_,__)_ fp_sin(-vars[0])-fp_tan(-vars[0]) __
+#define T5167(_,__)_ fp_sin(-vars[0])-fp_tan(vars[0]) __
+#define T2201(_,__)_ fp_sin(-vars[0])-fp_tan(vars[0]) __
+#define T5017(_,__)_ fp_sin(-vars[0])-fp_tanh(-vars[0]) __
+#define T2016(_,__)_ fp_sin(-vars[0])-fp_tanh(-vars[0]) __
+#define T5168(_,__)_ fp_sin(-vars[0])-fp_tanh(vars[0]) __
+#define T2202(_,__)_ fp_sin(-vars[0])-fp_tanh(vars[0]) __
+#define T1500(_,__)_ fp_sin(Value_t(fp_abs(vars[0]))) __
+#define T4627(_,__)_ fp_sin(Value_t(fp_arg(vars[0]))) __
+#define T1511(_,__)_ fp_sin(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4633(_,__)_ fp_sin(Value_t(fp_imag(vars[0]))) __
+#define T3552(_,__)_ fp_sin(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3553(_,__)_ fp_sin(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3554(_,__)_ fp_sin(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3555(_,__)_ fp_sin(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1817(_,__)_ fp_sin(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1529(_,__)_ fp_sin(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4645(_,__)_ fp_sin(Value_t(fp_real(vars[0]))) __
+#define  T568(_,__)_ fp_sin(c.l1_1)+vars[0] __
+#define  T569(_,__)_ fp_sin(d2r(c.l1_1))+vars[0] __
+#define T3653(_,__)_ fp_sin(d2r(vars[0]))+fp_cos(d2r(vars[0]*c.l1_5))+r2d(fp_asin(vars[0]/c.l110))+r2d(fp_acos(vars[0]/c.l120)) __
+#define T1489(_,__)_ fp_sin(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4618(_,__)_ fp_sin(fp_acos(vars[0])) __
+#define T1487(_,__)_ fp_sin(fp_acos(vars[0])) __
+#define T4619(_,__)_ fp_sin(fp_acosh(vars[0])) __
+#define T1488(_,__)_ fp_sin(fp_acosh(vars[0]+c.l0_6)) __
+#define T1493(_,__)_ fp_sin(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4620(_,__)_ fp_sin(fp_asin(vars[0])) __
+#define T1490(_,__)_ fp_sin(fp_asin(vars[0])) __
+#define T3415(_,__)_ fp_sin(fp_asin(vars[0])) __
+#define T1492(_,__)_ fp_sin(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4621(_,__)_ fp_sin(fp_asinh(vars[0])) __
+#define T1491(_,__)_ fp_sin(fp_asinh(vars[0])) __
+#define T4623(_,__)_ fp_sin(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4624(_,__)_ fp_sin(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T1498(_,__)_ fp_sin(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T1499(_,__)_ fp_sin(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4625(_,__)_ fp_sin(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1497(_,__)_ fp_sin(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4622(_,__)_ fp_sin(fp_atan(vars[0])) __
+#define T1494(_,__)_ fp_sin(fp_atan(vars[0])) __
+#define T1495(_,__)_ fp_sin(fp_atan(vars[0]/vars[1])) __
+#define T1485(_,__)_ fp_sin(fp_atan2(vars[0],vars[1])) __
+#define T1496(_,__)_ fp_sin(fp_atanh(vars[0])) __
+#define T1503(_,__)_ fp_sin(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4626(_,__)_ fp_sin(fp_cbrt(vars[0])) __
+#define T1502(_,__)_ fp_sin(fp_cbrt(vars[0])) __
+#define T4640(_,__)_ fp_sin(fp_conj(vars[0])) __
+#define T1506(_,__)_ fp_sin(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1501(_,__)_ fp_sin(fp_cos(vars[0])) __
+#define T1505(_,__)_ fp_sin(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1504(_,__)_ fp_sin(fp_cosh(vars[0])) __
+#define T1513(_,__)_ fp_sin(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1512(_,__)_ fp_sin(fp_exp(vars[0])) __
+#define T1508(_,__)_ fp_sin(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1507(_,__)_ fp_sin(fp_exp2(vars[0])) __
+#define T4629(_,__)_ fp_sin(fp_hypot(c.l1,vars[0])) __
+#define T1514(_,__)_ fp_sin(fp_hypot(c.l1,vars[0])) __
+#define T1515(_,__)_ fp_sin(fp_hypot(c.l2,vars[0])) __
+#define T4630(_,__)_ fp_sin(fp_hypot(c.l2,vars[0])) __
+#define T1517(_,__)_ fp_sin(fp_hypot(vars[0],c.l1)) __
+#define T4631(_,__)_ fp_sin(fp_hypot(vars[0],c.l1)) __
+#define T4632(_,__)_ fp_sin(fp_hypot(vars[0],c.l2)) __
+#define T1518(_,__)_ fp_sin(fp_hypot(vars[0],c.l2)) __
+#define T1516(_,__)_ fp_sin(fp_hypot(vars[0],vars[1])) __
+#define T4628(_,__)_ fp_sin(fp_hypot(vars[0],vars[1])) __
+#define T4634(_,__)_ fp_sin(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1520(_,__)_ fp_sin(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1519(_,__)_ fp_sin(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1510(_,__)_ fp_sin(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1509(_,__)_ fp_sin(fp_inv(fp_cos(vars[0]))) __
+#define T4636(_,__)_ fp_sin(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1521(_,__)_ fp_sin(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4637(_,__)_ fp_sin(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1522(_,__)_ fp_sin(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1524(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4638(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1525(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4639(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1523(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4635(_,__)_ fp_sin(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1486(_,__)_ fp_sin(fp_inv(fp_sin(vars[0]))) __
+#define T1530(_,__)_ fp_sin(fp_inv(fp_tan(vars[0]))) __
+#define T3551(_,__)_ fp_sin(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T4641(_,__)_ fp_sin(fp_log(vars[0])) __
+#define T1527(_,__)_ fp_sin(fp_log(vars[0])) __
+#define T1528(_,__)_ fp_sin(fp_log10(vars[0])) __
+#define T4643(_,__)_ fp_sin(fp_log10(vars[0])) __
+#define T4642(_,__)_ fp_sin(fp_log2(vars[0])) __
+#define T1526(_,__)_ fp_sin(fp_log2(vars[0])) __
+#define T4644(_,__)_ fp_sin(fp_polar(vars[0],vars[1])) __
+#define T1531(_,__)_ fp_sin(fp_pow(vars[0],vars[1])) __
+#define T1535(_,__)_ fp_sin(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1532(_,__)_ fp_sin(fp_sin(vars[0])) __
+#define T1534(_,__)_ fp_sin(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1533(_,__)_ fp_sin(fp_sinh(vars[0])) __
+#define T1537(_,__)_ fp_sin(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T3659(_,__)_ fp_sin(fp_sqrt(c.l10-vars[0]*vars[0]+vars[1]*vars[1]))+fp_cos(fp_sqrt(c.l15-vars[0]*vars[0]-vars[1]*vars[1]))+fp_sin(vars[0]*vars[0]+vars[1]*vars[1]) __
+#define T4646(_,__)_ fp_sin(fp_sqrt(vars[0])) __
+#define T1536(_,__)_ fp_sin(fp_sqrt(vars[0])) __
+#define T1541(_,__)_ fp_sin(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1538(_,__)_ fp_sin(fp_tan(vars[0])) __
+#define T4647(_,__)_ fp_sin(fp_tan(vars[0])) __
+#define T1540(_,__)_ fp_sin(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1539(_,__)_ fp_sin(fp_tanh(vars[0])) __
+#define T4648(_,__)_ fp_sin(fp_tanh(vars[0])) __
+#define T1814(_,__)_ fp_sin(vars[0]) __
+#define T3407(_,__)_ fp_sin(vars[0])*c.l2_7+fp_cos(vars[0]) __
+#define T3408(_,__)_ fp_sin(vars[0])*c.l5_1+fp_cos(vars[0])*c.l2_7 __
+#define T3409(_,__)_ fp_sin(vars[0])*c.l5_1+fp_cos(vars[0])*c.lm2_7 __
+#define T3410(_,__)_ fp_sin(vars[0])*c.lm5_1+fp_cos(vars[0])*c.l2_7 __
+#define T3411(_,__)_ fp_sin(vars[0])*c.lm5_1+fp_cos(vars[0])*c.lm2_7 __
+#define T5989(_,__)_ fp_sin(vars[0])+fp_acos(-vars[0]) __
+#define T3243(_,__)_ fp_sin(vars[0])+fp_acos(-vars[0]) __
+#define T5990(_,__)_ fp_sin(vars[0])+fp_acosh(-vars[0]) __
+#define T3244(_,__)_ fp_sin(vars[0])+fp_acosh(-vars[0]) __
+#define T3245(_,__)_ fp_sin(vars[0])+fp_asin(-vars[0]) __
+#define T5991(_,__)_ fp_sin(vars[0])+fp_asin(-vars[0]) __
+#define T5992(_,__)_ fp_sin(vars[0])+fp_asinh(-vars[0]) __
+#define T3246(_,__)_ fp_sin(vars[0])+fp_asinh(-vars[0]) __
+#define T5993(_,__)_ fp_sin(vars[0])+fp_atan(-vars[0]) __
+#define T3247(_,__)_ fp_sin(vars[0])+fp_atan(-vars[0]) __
+#define T3248(_,__)_ fp_sin(vars[0])+fp_atanh(-vars[0]) __
+#define T3249(_,__)_ fp_sin(vars[0])+fp_cos(-vars[0]) __
+#define T3405(_,__)_ fp_sin(vars[0])+fp_cos(vars[0]) __
+#define  T572(_,__)_ fp_sin(vars[0])+fp_cos(vars[0]) __
+#define T3406(_,__)_ fp_sin(vars[0])+fp_cos(vars[0])*c.l2_7 __
+#define T3250(_,__)_ fp_sin(vars[0])+fp_cosh(-vars[0]) __
+#define T3251(_,__)_ fp_sin(vars[0])+fp_exp(-vars[0]) __
+#define  T573(_,__)_ fp_sin(vars[0])+fp_inv(fp_cos(vars[0])) __
+#define  T575(_,__)_ fp_sin(vars[0])+fp_inv(fp_sin(vars[0])) __
+#define T3252(_,__)_ fp_sin(vars[0])+fp_log(-vars[0]) __
+#define T5994(_,__)_ fp_sin(vars[0])+fp_log(-vars[0]) __
+#define T3253(_,__)_ fp_sin(vars[0])+fp_sin(-vars[0]) __
+#define T3391(_,__)_ fp_sin(vars[0])+fp_sin(vars[0]) __
+#define T3254(_,__)_ fp_sin(vars[0])+fp_sinh(-vars[0]) __
+#define T3392(_,__)_ fp_sin(vars[0])+fp_sinh(vars[0]) __
+#define T3255(_,__)_ fp_sin(vars[0])+fp_tan(-vars[0]) __
+#define T5995(_,__)_ fp_sin(vars[0])+fp_tan(-vars[0]) __
+#define T6105(_,__)_ fp_sin(vars[0])+fp_tan(vars[0]) __
+#define T3393(_,__)_ fp_sin(vars[0])+fp_tan(vars[0]) __
+#define T5996(_,__)_ fp_sin(vars[0])+fp_tanh(-vars[0]) __
+#define T3256(_,__)_ fp_sin(vars[0])+fp_tanh(-vars[0]) __
+#define T6106(_,__)_ fp_sin(vars[0])+fp_tanh(vars[0]) __
+#define T3394(_,__)_ fp_sin(vars[0])+fp_tanh(vars[0]) __
+#define T2375(_,__)_ fp_sin(vars[0])-fp_acos(-vars[0]) __
+#define T5312(_,__)_ fp_sin(vars[0])-fp_acos(-vars[0]) __
+#define T5464(_,__)_ fp_sin(vars[0])-fp_acos(vars[0]) __
+#define T2565(_,__)_ fp_sin(vars[0])-fp_acos(vars[0]) __
+#define T2376(_,__)_ fp_sin(vars[0])-fp_acosh(-vars[0]) __
+#define T5313(_,__)_ fp_sin(vars[0])-fp_acosh(-vars[0]) __
+#define T5465(_,__)_ fp_sin(vars[0])-fp_acosh(vars[0]) __
+#define T2566(_,__)_ fp_sin(vars[0])-fp_acosh(vars[0]) __
+#define T5314(_,__)_ fp_sin(vars[0])-fp_asin(-vars[0]) __
+#define T2377(_,__)_ fp_sin(vars[0])-fp_asin(-vars[0]) __
+#define T2567(_,__)_ fp_sin(vars[0])-fp_asin(vars[0]) __
+#define T5466(_,__)_ fp_sin(vars[0])-fp_asin(vars[0]) __
+#define T2378(_,__)_ fp_sin(vars[0])-fp_asinh(-vars[0]) __
+#define T5315(_,__)_ fp_sin(vars[0])-fp_asinh(-vars[0]) __
+#define T5467(_,__)_ fp_sin(vars[0])-fp_asinh(vars[0]) __
+#define T2568(_,__)_ fp_sin(vars[0])-fp_asinh(vars[0]) __
+#define T5316(_,__)_ fp_sin(vars[0])-fp_atan(-vars[0]) __
+#define T2379(_,__)_ fp_sin(vars[0])-fp_atan(-vars[0]) __
+#define T2569(_,__)_ fp_sin(vars[0])-fp_atan(vars[0]) __
+#define T5468(_,__)_ fp_sin(vars[0])-fp_atan(vars[0]) __
+#define T2380(_,__)_ fp_sin(vars[0])-fp_atanh(-vars[0]) __
+#define T2570(_,__)_ fp_sin(vars[0])-fp_atanh(vars[0]) __
+#define T2381(_,__)_ fp_sin(vars[0])-fp_cos(-vars[0]) __
+#define T2571(_,__)_ fp_sin(vars[0])-fp_cos(vars[0]) __
+#define T2382(_,__)_ fp_sin(vars[0])-fp_cosh(-vars[0]) __
+#define T2572(_,__)_ fp_sin(vars[0])-fp_cosh(vars[0]) __
+#define T2383(_,__)_ fp_sin(vars[0])-fp_exp(-vars[0]) __
+#define T2573(_,__)_ fp_sin(vars[0])-fp_exp(vars[0]) __
+#define T2384(_,__)_ fp_sin(vars[0])-fp_log(-vars[0]) __
+#define T5317(_,__)_ fp_sin(vars[0])-fp_log(-vars[0]) __
+#define T2574(_,__)_ fp_sin(vars[0])-fp_log(vars[0]) __
+#define T5469(_,__)_ fp_sin(vars[0])-fp_log(vars[0]) __
+#define T2385(_,__)_ fp_sin(vars[0])-fp_sin(-vars[0]) __
+#define T2575(_,__)_ fp_sin(vars[0])-fp_sin(vars[0]) __
+#define T2386(_,__)_ fp_sin(vars[0])-fp_sinh(-vars[0]) __
+#define T2576(_,__)_ fp_sin(vars[0])-fp_sinh(vars[0]) __
+#define T5318(_,__)_ fp_sin(vars[0])-fp_tan(-vars[0]) __
+#define T2387(_,__)_ fp_sin(vars[0])-fp_tan(-vars[0]) __
+#define T5470(_,__)_ fp_sin(vars[0])-fp_tan(vars[0]) __
+#define T2577(_,__)_ fp_sin(vars[0])-fp_tan(vars[0]) __
+#define T2388(_,__)_ fp_sin(vars[0])-fp_tanh(-vars[0]) __
+#define T5319(_,__)_ fp_sin(vars[0])-fp_tanh(-vars[0]) __
+#define T2578(_,__)_ fp_sin(vars[0])-fp_tanh(vars[0]) __
+#define T5471(_,__)_ fp_sin(vars[0])-fp_tanh(vars[0]) __
+#define  T576(_,__)_ fp_sin(vars[0])/fp_cos(vars[0]) __
+#define T4882(_,__)_ fp_sin(vars[0]*(c.l1*c.i)) __
+#define T4883(_,__)_ fp_sin(vars[0]*(c.l3*c.i)) __
+#define T3604(_,__)_ fp_sin(vars[0]*(fp_truth(c.l1) ? c.lm1 : c.l0)) __
+#define T4885(_,__)_ fp_sin(vars[0]*-(c.l1*c.i)) __
+#define T4884(_,__)_ fp_sin(vars[0]*-(c.l3*c.i)) __
+#define T1857(_,__)_ fp_sin(vars[0]*c.l2) __
+#define T1858(_,__)_ fp_sin(vars[0]*c.lm1) __
+#define T1859(_,__)_ fp_sin(vars[0]*c.lm2) __
+#define T6112(_,__)_ fp_sin(vars[0]+(c.l4*c.i))+(c.l3*c.i)*fp_cos(vars[0]+(c.l3*c.i)) __
+#define T3662(_,__)_ fp_sin(vars[0]+fp_cos(vars[1]*c.l1_5))-fp_cos(vars[0]+fp_sin(vars[1]*c.l1_5))+vars[2]*vars[2]*vars[2]*fp_sin(vars[2]*vars[2]*vars[2]-vars[0]*vars[0]-vars[1]*vars[1])-fp_cos(vars[1]*c.l1_5)*fp_sin(vars[0]+fp_cos(vars[1]*c.l1_5))+vars[0]*vars[1]*vars[2]+vars[0]*vars[1]*c.l2_5+vars[0]*vars[1]*vars[2]*fp_cos(vars[0])+vars[0]*vars[1]*fp_cos(vars[0])+vars[0]*vars[2]*fp_cos(vars[0])+vars[1]*vars[2]*c.l2_5+(vars[0]*vars[1]*vars[2]*fp_cos(vars[0])-vars[0]*vars[1]*vars[2]-vars[1]*fp_cos(vars[0])-vars[0]*vars[2]*vars[1]+vars[0]*vars[1]+vars[0]*vars[2]-fp_cos(vars[0])*vars[0]) __
+#define T3670(_,__)_ fp_sinh((fp_log(vars[0])/c.l5+c.l1)*c.l5)+c.l1_2*fp_cosh((fp_log(vars[0])/fp_log(c.l2)+c.l1)*fp_log(c.l2))+Value_t(!(fp_truth(vars[0])||fp_not(vars[0]/c.l4))) __
+#define  T546(_,__)_ fp_sinh(-vars[0]) __
+#define T3107(_,__)_ fp_sinh(-vars[0])+fp_sinh(-vars[0]) __
+#define T3108(_,__)_ fp_sinh(-vars[0])+fp_tan(-vars[0]) __
+#define T5883(_,__)_ fp_sinh(-vars[0])+fp_tan(-vars[0]) __
+#define T5884(_,__)_ fp_sinh(-vars[0])+fp_tanh(-vars[0]) __
+#define T3109(_,__)_ fp_sinh(-vars[0])+fp_tanh(-vars[0]) __
+#define T2017(_,__)_ fp_sinh(-vars[0])-fp_acos(-vars[0]) __
+#define T5018(_,__)_ fp_sinh(-vars[0])-fp_acos(-vars[0]) __
+#define T5169(_,__)_ fp_sinh(-vars[0])-fp_acos(vars[0]) __
+#define T2203(_,__)_ fp_sinh(-vars[0])-fp_acos(vars[0]) __
+#define T2018(_,__)_ fp_sinh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5019(_,__)_ fp_sinh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5170(_,__)_ fp_sinh(-vars[0])-fp_acosh(vars[0]) __
+#define T2204(_,__)_ fp_sinh(-vars[0])-fp_acosh(vars[0]) __
+#define T2019(_,__)_ fp_sinh(-vars[0])-fp_asin(-vars[0]) __
+#define T5020(_,__)_ fp_sinh(-vars[0])-fp_asin(-vars[0]) __
+#define T5171(_,__)_ fp_sinh(-vars[0])-fp_asin(vars[0]) __
+#define T2205(_,__)_ fp_sinh(-vars[0])-fp_asin(vars[0]) __
+#define T5021(_,__)_ fp_sinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2020(_,__)_ fp_sinh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5172(_,__)_ fp_sinh(-vars[0])-fp_asinh(vars[0]) __
+#define T2206(_,__)_ fp_sinh(-vars[0])-fp_asinh(vars[0]) __
+#define T5022(_,__)_ fp_sinh(-vars[0])-fp_atan(-vars[0]) __
+#define T2021(_,__)_ fp_sinh(-vars[0])-fp_atan(-vars[0]) __
+#define T2207(_,__)_ fp_sinh(-vars[0])-fp_atan(vars[0]) __
+#define T5173(_,__)_ fp_sinh(-vars[0])-fp_atan(vars[0]) __
+#define T2022(_,__)_ fp_sinh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2208(_,__)_ fp_sinh(-vars[0])-fp_atanh(vars[0]) __
+#define T2023(_,__)_ fp_sinh(-vars[0])-fp_cos(-vars[0]) __
+#define T2209(_,__)_ fp_sinh(-vars[0])-fp_cos(vars[0]) __
+#define T2024(_,__)_ fp_sinh(-vars[0])-fp_cosh(-vars[0]) __
+#define T2210(_,__)_ fp_sinh(-vars[0])-fp_cosh(vars[0]) __
+#define T2025(_,__)_ fp_sinh(-vars[0])-fp_exp(-vars[0]) __
+#define T2211(_,__)_ fp_sinh(-vars[0])-fp_exp(vars[0]) __
+#define T2026(_,__)_ fp_sinh(-vars[0])-fp_log(-vars[0]) __
+#define T5023(_,__)_ fp_sinh(-vars[0])-fp_log(-vars[0]) __
+#define T5174(_,__)_ fp_sinh(-vars[0])-fp_log(vars[0]) __
+#define T2212(_,__)_ fp_sinh(-vars[0])-fp_log(vars[0]) __
+#define T2027(_,__)_ fp_sinh(-vars[0])-fp_sin(-vars[0]) __
+#define T2213(_,__)_ fp_sinh(-vars[0])-fp_sin(vars[0]) __
+#define T2028(_,__)_ fp_sinh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2214(_,__)_ fp_sinh(-vars[0])-fp_sinh(vars[0]) __
+#define T5024(_,__)_ fp_sinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2029(_,__)_ fp_sinh(-vars[0])-fp_tan(-vars[0]) __
+#define T2215(_,__)_ fp_sinh(-vars[0])-fp_tan(vars[0]) __
+#define T5175(_,__)_ fp_sinh(-vars[0])-fp_tan(vars[0]) __
+#define T2030(_,__)_ fp_sinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5025(_,__)_ fp_sinh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5176(_,__)_ fp_sinh(-vars[0])-fp_tanh(vars[0]) __
+#define T2216(_,__)_ fp_sinh(-vars[0])-fp_tanh(vars[0]) __
+#define T1557(_,__)_ fp_sinh(Value_t(fp_abs(vars[0]))) __
+#define T4658(_,__)_ fp_sinh(Value_t(fp_arg(vars[0]))) __
+#define T1568(_,__)_ fp_sinh(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4664(_,__)_ fp_sinh(Value_t(fp_imag(vars[0]))) __
+#define T3557(_,__)_ fp_sinh(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3558(_,__)_ fp_sinh(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3559(_,__)_ fp_sinh(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3560(_,__)_ fp_sinh(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1816(_,__)_ fp_sinh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1586(_,__)_ fp_sinh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4676(_,__)_ fp_sinh(Value_t(fp_real(vars[0]))) __
+#define  T579(_,__)_ fp_sinh(c.l1_1)+vars[0] __
+#define  T580(_,__)_ fp_sinh(d2r(c.l1_1))+vars[0] __
+#define T1546(_,__)_ fp_sinh(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4649(_,__)_ fp_sinh(fp_acos(vars[0])) __
+#define T1544(_,__)_ fp_sinh(fp_acos(vars[0])) __
+#define T4650(_,__)_ fp_sinh(fp_acosh(vars[0])) __
+#define  T427(_,__)_ fp_sinh(fp_acosh(vars[0])) __
+#define T1545(_,__)_ fp_sinh(fp_acosh(vars[0]+c.l0_6)) __
+#define T1550(_,__)_ fp_sinh(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4651(_,__)_ fp_sinh(fp_asin(vars[0])) __
+#define T1547(_,__)_ fp_sinh(fp_asin(vars[0])) __
+#define T1549(_,__)_ fp_sinh(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4652(_,__)_ fp_sinh(fp_asinh(vars[0])) __
+#define T1548(_,__)_ fp_sinh(fp_asinh(vars[0])) __
+#define  T435(_,__)_ fp_sinh(fp_asinh(vars[0])) __
+#define T4654(_,__)_ fp_sinh(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T4655(_,__)_ fp_sinh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T1555(_,__)_ fp_sinh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4656(_,__)_ fp_sinh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1556(_,__)_ fp_sinh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T1554(_,__)_ fp_sinh(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1551(_,__)_ fp_sinh(fp_atan(vars[0])) __
+#define T4653(_,__)_ fp_sinh(fp_atan(vars[0])) __
+#define T1552(_,__)_ fp_sinh(fp_atan(vars[0]/vars[1])) __
+#define T1542(_,__)_ fp_sinh(fp_atan2(vars[0],vars[1])) __
+#define T1553(_,__)_ fp_sinh(fp_atanh(vars[0])) __
+#define T1560(_,__)_ fp_sinh(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4657(_,__)_ fp_sinh(fp_cbrt(vars[0])) __
+#define T1559(_,__)_ fp_sinh(fp_cbrt(vars[0])) __
+#define T4671(_,__)_ fp_sinh(fp_conj(vars[0])) __
+#define T1563(_,__)_ fp_sinh(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1558(_,__)_ fp_sinh(fp_cos(vars[0])) __
+#define T1562(_,__)_ fp_sinh(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1561(_,__)_ fp_sinh(fp_cosh(vars[0])) __
+#define T1570(_,__)_ fp_sinh(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1569(_,__)_ fp_sinh(fp_exp(vars[0])) __
+#define T1565(_,__)_ fp_sinh(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1564(_,__)_ fp_sinh(fp_exp2(vars[0])) __
+#define T1571(_,__)_ fp_sinh(fp_hypot(c.l1,vars[0])) __
+#define T4660(_,__)_ fp_sinh(fp_hypot(c.l1,vars[0])) __
+#define T4661(_,__)_ fp_sinh(fp_hypot(c.l2,vars[0])) __
+#define T1572(_,__)_ fp_sinh(fp_hypot(c.l2,vars[0])) __
+#define T1574(_,__)_ fp_sinh(fp_hypot(vars[0],c.l1)) __
+#define T4662(_,__)_ fp_sinh(fp_hypot(vars[0],c.l1)) __
+#define T4663(_,__)_ fp_sinh(fp_hypot(vars[0],c.l2)) __
+#define T1575(_,__)_ fp_sinh(fp_hypot(vars[0],c.l2)) __
+#define T4659(_,__)_ fp_sinh(fp_hypot(vars[0],vars[1])) __
+#define T1573(_,__)_ fp_sinh(fp_hypot(vars[0],vars[1])) __
+#define T4665(_,__)_ fp_sinh(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1577(_,__)_ fp_sinh(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1576(_,__)_ fp_sinh(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1567(_,__)_ fp_sinh(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1566(_,__)_ fp_sinh(fp_inv(fp_cos(vars[0]))) __
+#define T1578(_,__)_ fp_sinh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4667(_,__)_ fp_sinh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1579(_,__)_ fp_sinh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4668(_,__)_ fp_sinh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1581(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4669(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1582(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4670(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4666(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1580(_,__)_ fp_sinh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1543(_,__)_ fp_sinh(fp_inv(fp_sin(vars[0]))) __
+#define T1587(_,__)_ fp_sinh(fp_inv(fp_tan(vars[0]))) __
+#define T3556(_,__)_ fp_sinh(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T1584(_,__)_ fp_sinh(fp_log(vars[0])) __
+#define T4672(_,__)_ fp_sinh(fp_log(vars[0])) __
+#define T1585(_,__)_ fp_sinh(fp_log10(vars[0])) __
+#define T4674(_,__)_ fp_sinh(fp_log10(vars[0])) __
+#define T4673(_,__)_ fp_sinh(fp_log2(vars[0])) __
+#define T1583(_,__)_ fp_sinh(fp_log2(vars[0])) __
+#define T4675(_,__)_ fp_sinh(fp_polar(vars[0],vars[1])) __
+#define T1588(_,__)_ fp_sinh(fp_pow(vars[0],vars[1])) __
+#define T1592(_,__)_ fp_sinh(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1589(_,__)_ fp_sinh(fp_sin(vars[0])) __
+#define T1591(_,__)_ fp_sinh(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1590(_,__)_ fp_sinh(fp_sinh(vars[0])) __
+#define T1594(_,__)_ fp_sinh(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1593(_,__)_ fp_sinh(fp_sqrt(vars[0])) __
+#define T4677(_,__)_ fp_sinh(fp_sqrt(vars[0])) __
+#define T1598(_,__)_ fp_sinh(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4678(_,__)_ fp_sinh(fp_tan(vars[0])) __
+#define T1595(_,__)_ fp_sinh(fp_tan(vars[0])) __
+#define T1597(_,__)_ fp_sinh(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1596(_,__)_ fp_sinh(fp_tanh(vars[0])) __
+#define T4679(_,__)_ fp_sinh(fp_tanh(vars[0])) __
+#define T3404(_,__)_ fp_sinh(fp_truth(c.l1) ? fp_acosh(vars[0]) : c.l0) __
+#define T1815(_,__)_ fp_sinh(vars[0]) __
+#define T5997(_,__)_ fp_sinh(vars[0])+fp_acos(-vars[0]) __
+#define T3257(_,__)_ fp_sinh(vars[0])+fp_acos(-vars[0]) __
+#define T3258(_,__)_ fp_sinh(vars[0])+fp_acosh(-vars[0]) __
+#define T5998(_,__)_ fp_sinh(vars[0])+fp_acosh(-vars[0]) __
+#define T3259(_,__)_ fp_sinh(vars[0])+fp_asin(-vars[0]) __
+#define T5999(_,__)_ fp_sinh(vars[0])+fp_asin(-vars[0]) __
+#define T6000(_,__)_ fp_sinh(vars[0])+fp_asinh(-vars[0]) __
+#define T3260(_,__)_ fp_sinh(vars[0])+fp_asinh(-vars[0]) __
+#define T3261(_,__)_ fp_sinh(vars[0])+fp_atan(-vars[0]) __
+#define T6001(_,__)_ fp_sinh(vars[0])+fp_atan(-vars[0]) __
+#define T3262(_,__)_ fp_sinh(vars[0])+fp_atanh(-vars[0]) __
+#define T3263(_,__)_ fp_sinh(vars[0])+fp_cos(-vars[0]) __
+#define T3264(_,__)_ fp_sinh(vars[0])+fp_cosh(-vars[0]) __
+#define T3265(_,__)_ fp_sinh(vars[0])+fp_exp(-vars[0]) __
+#define T6002(_,__)_ fp_sinh(vars[0])+fp_log(-vars[0]) __
+#define T3266(_,__)_ fp_sinh(vars[0])+fp_log(-vars[0]) __
+#define T3267(_,__)_ fp_sinh(vars[0])+fp_sin(-vars[0]) __
+#define T3268(_,__)_ fp_sinh(vars[0])+fp_sinh(-vars[0]) __
+#define T3395(_,__)_ fp_sinh(vars[0])+fp_sinh(vars[0]) __
+#define T6003(_,__)_ fp_sinh(vars[0])+fp_tan(-vars[0]) __
+#define T3269(_,__)_ fp_sinh(vars[0])+fp_tan(-vars[0]) __
+#define T6107(_,__)_ fp_sinh(vars[0])+fp_tan(vars[0]) __
+#define T3396(_,__)_ fp_sinh(vars[0])+fp_tan(vars[0]) __
+#define T3270(_,__)_ fp_sinh(vars[0])+fp_tanh(-vars[0]) __
+#define T6004(_,__)_ fp_sinh(vars[0])+fp_tanh(-vars[0]) __
+#define T3397(_,__)_ fp_sinh(vars[0])+fp_tanh(vars[0]) __
+#define T6108(_,__)_ fp_sinh(vars[0])+fp_tanh(vars[0]) __
+#define T5320(_,__)_ fp_sinh(vars[0])-fp_acos(-vars[0]) __
+#define T2389(_,__)_ fp_sinh(vars[0])-fp_acos(-vars[0]) __
+#define T2579(_,__)_ fp_sinh(vars[0])-fp_acos(vars[0]) __
+#define T5472(_,__)_ fp_sinh(vars[0])-fp_acos(vars[0]) __
+#define T5321(_,__)_ fp_sinh(vars[0])-fp_acosh(-vars[0]) __
+#define T2390(_,__)_ fp_sinh(vars[0])-fp_acosh(-vars[0]) __
+#define T5473(_,__)_ fp_sinh(vars[0])-fp_acosh(vars[0]) __
+#define T2580(_,__)_ fp_sinh(vars[0])-fp_acosh(vars[0]) __
+#define T2391(_,__)_ fp_sinh(vars[0])-fp_asin(-vars[0]) __
+#define T5322(_,__)_ fp_sinh(vars[0])-fp_asin(-vars[0]) __
+#define T2581(_,__)_ fp_sinh(vars[0])-fp_asin(vars[0]) __
+#define T5474(_,__)_ fp_sinh(vars[0])-fp_asin(vars[0]) __
+#define T2392(_,__)_ fp_sinh(vars[0])-fp_asinh(-vars[0]) __
+#define T5323(_,__)_ fp_sinh(vars[0])-fp_asinh(-vars[0]) __
+#define T2582(_,__)_ fp_sinh(vars[0])-fp_asinh(vars[0]) __
+#define T5475(_,__)_ fp_sinh(vars[0])-fp_asinh(vars[0]) __
+#define T2393(_,__)_ fp_sinh(vars[0])-fp_atan(-vars[0]) __
+#define T5324(_,__)_ fp_sinh(vars[0])-fp_atan(-vars[0]) __
+#define T2583(_,__)_ fp_sinh(vars[0])-fp_atan(vars[0]) __
+#define T5476(_,__)_ fp_sinh(vars[0])-fp_atan(vars[0]) __
+#define T2394(_,__)_ fp_sinh(vars[0])-fp_atanh(-vars[0]) __
+#define T2584(_,__)_ fp_sinh(vars[0])-fp_atanh(vars[0]) __
+#define T2395(_,__)_ fp_sinh(vars[0])-fp_cos(-vars[0]) __
+#define T2585(_,__)_ fp_sinh(vars[0])-fp_cos(vars[0]) __
+#define T2396(_,__)_ fp_sinh(vars[0])-fp_cosh(-vars[0]) __
+#define T2586(_,__)_ fp_sinh(vars[0])-fp_cosh(vars[0]) __
+#define T2397(_,__)_ fp_sinh(vars[0])-fp_exp(-vars[0]) __
+#define T2587(_,__)_ fp_sinh(vars[0])-fp_exp(vars[0]) __
+#define T5325(_,__)_ fp_sinh(vars[0])-fp_log(-vars[0]) __
+#define T2398(_,__)_ fp_sinh(vars[0])-fp_log(-vars[0]) __
+#define T2588(_,__)_ fp_sinh(vars[0])-fp_log(vars[0]) __
+#define T5477(_,__)_ fp_sinh(vars[0])-fp_log(vars[0]) __
+#define T2399(_,__)_ fp_sinh(vars[0])-fp_sin(-vars[0]) __
+#define T2589(_,__)_ fp_sinh(vars[0])-fp_sin(vars[0]) __
+#define T2400(_,__)_ fp_sinh(vars[0])-fp_sinh(-vars[0]) __
+#define T2590(_,__)_ fp_sinh(vars[0])-fp_sinh(vars[0]) __
+#define T2401(_,__)_ fp_sinh(vars[0])-fp_tan(-vars[0]) __
+#define T5326(_,__)_ fp_sinh(vars[0])-fp_tan(-vars[0]) __
+#define T2591(_,__)_ fp_sinh(vars[0])-fp_tan(vars[0]) __
+#define T5478(_,__)_ fp_sinh(vars[0])-fp_tan(vars[0]) __
+#define T5327(_,__)_ fp_sinh(vars[0])-fp_tanh(-vars[0]) __
+#define T2402(_,__)_ fp_sinh(vars[0])-fp_tanh(-vars[0]) __
+#define T5479(_,__)_ fp_sinh(vars[0])-fp_tanh(vars[0]) __
+#define T2592(_,__)_ fp_sinh(vars[0])-fp_tanh(vars[0]) __
+#define T4886(_,__)_ fp_sinh(vars[0]*(c.l1*c.i)) __
+#define T4887(_,__)_ fp_sinh(vars[0]*(c.l3*c.i)) __
+#define T3605(_,__)_ fp_sinh(vars[0]*(fp_truth(c.l1) ? c.lm1 : c.l0)) __
+#define T4889(_,__)_ fp_sinh(vars[0]*-(c.l1*c.i)) __
+#define T4888(_,__)_ fp_sinh(vars[0]*-(c.l3*c.i)) __
+#define T1860(_,__)_ fp_sinh(vars[0]*c.l2) __
+#define T1861(_,__)_ fp_sinh(vars[0]*c.lm1) __
+#define T1862(_,__)_ fp_sinh(vars[0]*c.lm2) __
+#define T1613(_,__)_ fp_sqrt(Value_t(fp_abs(vars[0]))) __
+#define T4689(_,__)_ fp_sqrt(Value_t(fp_abs(vars[0]))) __
+#define T4693(_,__)_ fp_sqrt(Value_t(fp_arg(vars[0]))) __
+#define T1624(_,__)_ fp_sqrt(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4699(_,__)_ fp_sqrt(Value_t(fp_imag(vars[0]))) __
+#define T3562(_,__)_ fp_sqrt(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3563(_,__)_ fp_sqrt(Value_t(fp_less(vars[0],vars[1]))*c.l0_3) __
+#define T3564(_,__)_ fp_sqrt(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.l0) __
+#define T3565(_,__)_ fp_sqrt(Value_t(fp_less(vars[0],vars[1]))+c.l0_1) __
+#define T1819(_,__)_ fp_sqrt(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1642(_,__)_ fp_sqrt(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4713(_,__)_ fp_sqrt(Value_t(fp_real(vars[0]))) __
+#define  T585(_,__)_ fp_sqrt(c.l1_1)+vars[0] __
+#define T1603(_,__)_ fp_sqrt(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4681(_,__)_ fp_sqrt(fp_acos(vars[0])) __
+#define T1601(_,__)_ fp_sqrt(fp_acos(vars[0])) __
+#define T4682(_,__)_ fp_sqrt(fp_acosh(vars[0])) __
+#define T1602(_,__)_ fp_sqrt(fp_acosh(vars[0]+c.l0_6)) __
+#define T1607(_,__)_ fp_sqrt(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1604(_,__)_ fp_sqrt(fp_asin(vars[0])) __
+#define T4683(_,__)_ fp_sqrt(fp_asin(vars[0])) __
+#define T1606(_,__)_ fp_sqrt(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1605(_,__)_ fp_sqrt(fp_asinh(vars[0])) __
+#define T4684(_,__)_ fp_sqrt(fp_asinh(vars[0])) __
+#define T4686(_,__)_ fp_sqrt(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1612(_,__)_ fp_sqrt(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4688(_,__)_ fp_sqrt(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T1611(_,__)_ fp_sqrt(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4685(_,__)_ fp_sqrt(fp_atan(vars[0])) __
+#define T1608(_,__)_ fp_sqrt(fp_atan(vars[0])) __
+#define T1609(_,__)_ fp_sqrt(fp_atan(vars[0]/vars[1])) __
+#define T1599(_,__)_ fp_sqrt(fp_atan2(vars[0],vars[1])) __
+#define T1610(_,__)_ fp_sqrt(fp_atanh(vars[0])) __
+#define T4687(_,__)_ fp_sqrt(fp_atanh(vars[0])) __
+#define T1616(_,__)_ fp_sqrt(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4690(_,__)_ fp_sqrt(fp_cbrt(vars[0])) __
+#define T1615(_,__)_ fp_sqrt(fp_cbrt(vars[0])) __
+#define T4706(_,__)_ fp_sqrt(fp_conj(vars[0])) __
+#define T1619(_,__)_ fp_sqrt(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1614(_,__)_ fp_sqrt(fp_cos(vars[0])) __
+#define T1618(_,__)_ fp_sqrt(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1617(_,__)_ fp_sqrt(fp_cosh(vars[0])) __
+#define T4691(_,__)_ fp_sqrt(fp_cosh(vars[0])) __
+#define T1626(_,__)_ fp_sqrt(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1625(_,__)_ fp_sqrt(fp_exp(vars[0])) __
+#define T1621(_,__)_ fp_sqrt(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4692(_,__)_ fp_sqrt(fp_exp2(vars[0])) __
+#define T1620(_,__)_ fp_sqrt(fp_exp2(vars[0])) __
+#define T1627(_,__)_ fp_sqrt(fp_hypot(c.l1,vars[0])) __
+#define T4695(_,__)_ fp_sqrt(fp_hypot(c.l1,vars[0])) __
+#define T1628(_,__)_ fp_sqrt(fp_hypot(c.l2,vars[0])) __
+#define T4696(_,__)_ fp_sqrt(fp_hypot(c.l2,vars[0])) __
+#define T1630(_,__)_ fp_sqrt(fp_hypot(vars[0],c.l1)) __
+#define T4697(_,__)_ fp_sqrt(fp_hypot(vars[0],c.l1)) __
+#define T4698(_,__)_ fp_sqrt(fp_hypot(vars[0],c.l2)) __
+#define T1631(_,__)_ fp_sqrt(fp_hypot(vars[0],c.l2)) __
+#define T1629(_,__)_ fp_sqrt(fp_hypot(vars[0],vars[1])) __
+#define T4694(_,__)_ fp_sqrt(fp_hypot(vars[0],vars[1])) __
+#define T4700(_,__)_ fp_sqrt(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1633(_,__)_ fp_sqrt(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1632(_,__)_ fp_sqrt(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1623(_,__)_ fp_sqrt(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1622(_,__)_ fp_sqrt(fp_inv(fp_cos(vars[0]))) __
+#define T1634(_,__)_ fp_sqrt(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4702(_,__)_ fp_sqrt(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T4703(_,__)_ fp_sqrt(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1635(_,__)_ fp_sqrt(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4704(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1637(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4705(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1638(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4701(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1636(_,__)_ fp_sqrt(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define  T566(_,__)_ fp_sqrt(fp_inv(fp_pow(vars[0],c.l2))) __
+#define T1600(_,__)_ fp_sqrt(fp_inv(fp_sin(vars[0]))) __
+#define T4680(_,__)_ fp_sqrt(fp_inv(fp_sin(vars[0]))) __
+#define T4710(_,__)_ fp_sqrt(fp_inv(fp_tan(vars[0]))) __
+#define T1643(_,__)_ fp_sqrt(fp_inv(fp_tan(vars[0]))) __
+#define  T562(_,__)_ fp_sqrt(fp_inv(vars[0])) __
+#define T3561(_,__)_ fp_sqrt(fp_less(vars[0],vars[1]) ? c.l1_2 : c.l0_3) __
+#define T4707(_,__)_ fp_sqrt(fp_log(vars[0])) __
+#define T1640(_,__)_ fp_sqrt(fp_log(vars[0]+c.l0_6)) __
+#define T4709(_,__)_ fp_sqrt(fp_log10(vars[0])) __
+#define T1641(_,__)_ fp_sqrt(fp_log10(vars[0]+c.l0_6)) __
+#define T4708(_,__)_ fp_sqrt(fp_log2(vars[0])) __
+#define T1639(_,__)_ fp_sqrt(fp_log2(vars[0]+c.l0_6)) __
+#define T4712(_,__)_ fp_sqrt(fp_polar(vars[0],vars[1])) __
+#define  T600(_,__)_ fp_sqrt(fp_pow(fp_log(vars[0]),c.l2)+fp_pow(fp_log2(vars[0]),c.l2)) __
+#define  T601(_,__)_ fp_sqrt(fp_pow(fp_log(vars[0]),c.l2)+vars[1]*vars[1]) __
+#define  T584(_,__)_ fp_sqrt(fp_pow(vars[0],c.l2)) __
+#define T1644(_,__)_ fp_sqrt(fp_pow(vars[0],vars[1])) __
+#define T4711(_,__)_ fp_sqrt(fp_pow(vars[0],vars[1])) __
+#define T1648(_,__)_ fp_sqrt(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1645(_,__)_ fp_sqrt(fp_sin(vars[0])) __
+#define T4714(_,__)_ fp_sqrt(fp_sin(vars[0])) __
+#define T1647(_,__)_ fp_sqrt(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1646(_,__)_ fp_sqrt(fp_sinh(vars[0])) __
+#define T4715(_,__)_ fp_sqrt(fp_sinh(vars[0])) __
+#define T1650(_,__)_ fp_sqrt(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1649(_,__)_ fp_sqrt(fp_sqrt(vars[0])) __
+#define T4716(_,__)_ fp_sqrt(fp_sqrt(vars[0])) __
+#define T1654(_,__)_ fp_sqrt(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1651(_,__)_ fp_sqrt(fp_tan(vars[0])) __
+#define T4717(_,__)_ fp_sqrt(fp_tan(vars[0])) __
+#define T1653(_,__)_ fp_sqrt(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4718(_,__)_ fp_sqrt(fp_tanh(vars[0])) __
+#define T1652(_,__)_ fp_sqrt(fp_tanh(vars[0])) __
+#define T4818(_,__)_ fp_sqrt(vars[0]) __
+#define T1818(_,__)_ fp_sqrt(vars[0]) __
+#define T3630(_,__)_ fp_sqrt(vars[0]*vars[0])+c.l1_5*fp_pow((vars[1]*vars[1]),c.l_25)+fp_hypot(vars[0],vars[1]) __
+#define  T547(_,__)_ fp_tan(-vars[0]) __
+#define T3110(_,__)_ fp_tan(-vars[0])+fp_tan(-vars[0]) __
+#define T5885(_,__)_ fp_tan(-vars[0])+fp_tan(-vars[0]) __
+#define T5886(_,__)_ fp_tan(-vars[0])+fp_tanh(-vars[0]) __
+#define T3111(_,__)_ fp_tan(-vars[0])+fp_tanh(-vars[0]) __
+#define T2031(_,__)_ fp_tan(-vars[0])-fp_acos(-vars[0]) __
+#define T5026(_,__)_ fp_tan(-vars[0])-fp_acos(-vars[0]) __
+#define T2217(_,__)_ fp_tan(-vars[0])-fp_acos(vars[0]) __
+#define T5177(_,__)_ fp_tan(-vars[0])-fp_acos(vars[0]) __
+#define T2032(_,__)_ fp_tan(-vars[0])-fp_acosh(-vars[0]) __
+#define T5027(_,__)_ fp_tan(-vars[0])-fp_acosh(-vars[0]) __
+#define T2218(_,__)_ fp_tan(-vars[0])-fp_acosh(vars[0]) __
+#define T5178(_,__)_ fp_tan(-vars[0])-fp_acosh(vars[0]) __
+#define T2033(_,__)_ fp_tan(-vars[0])-fp_asin(-vars[0]) __
+#define T5028(_,__)_ fp_tan(-vars[0])-fp_asin(-vars[0]) __
+#define T2219(_,__)_ fp_tan(-vars[0])-fp_asin(vars[0]) __
+#define T5179(_,__)_ fp_tan(-vars[0])-fp_asin(vars[0]) __
+#define T2034(_,__)_ fp_tan(-vars[0])-fp_asinh(-vars[0]) __
+#define T5029(_,__)_ fp_tan(-vars[0])-fp_asinh(-vars[0]) __
+#define T2220(_,__)_ fp_tan(-vars[0])-fp_asinh(vars[0]) __
+#define T5180(_,__)_ fp_tan(-vars[0])-fp_asinh(vars[0]) __
+#define T2035(_,__)_ fp_tan(-vars[0])-fp_atan(-vars[0]) __
+#define T5030(_,__)_ fp_tan(-vars[0])-fp_atan(-vars[0]) __
+#define T2221(_,__)_ fp_tan(-vars[0])-fp_atan(vars[0]) __
+#define T5181(_,__)_ fp_tan(-vars[0])-fp_atan(vars[0]) __
+#define T2036(_,__)_ fp_tan(-vars[0])-fp_atanh(-vars[0]) __
+#define T5031(_,__)_ fp_tan(-vars[0])-fp_atanh(-vars[0]) __
+#define T2222(_,__)_ fp_tan(-vars[0])-fp_atanh(vars[0]) __
+#define T5182(_,__)_ fp_tan(-vars[0])-fp_atanh(vars[0]) __
+#define T2037(_,__)_ fp_tan(-vars[0])-fp_cos(-vars[0]) __
+#define T5032(_,__)_ fp_tan(-vars[0])-fp_cos(-vars[0]) __
+#define T2223(_,__)_ fp_tan(-vars[0])-fp_cos(vars[0]) __
+#define T5183(_,__)_ fp_tan(-vars[0])-fp_cos(vars[0]) __
+#define T2038(_,__)_ fp_tan(-vars[0])-fp_cosh(-vars[0]) __
+#define T5033(_,__)_ fp_tan(-vars[0])-fp_cosh(-vars[0]) __
+#define T5184(_,__)_ fp_tan(-vars[0])-fp_cosh(vars[0]) __
+#define T2224(_,__)_ fp_tan(-vars[0])-fp_cosh(vars[0]) __
+#define T2039(_,__)_ fp_tan(-vars[0])-fp_exp(-vars[0]) __
+#define T5034(_,__)_ fp_tan(-vars[0])-fp_exp(-vars[0]) __
+#define T2225(_,__)_ fp_tan(-vars[0])-fp_exp(vars[0]) __
+#define T5185(_,__)_ fp_tan(-vars[0])-fp_exp(vars[0]) __
+#define T2040(_,__)_ fp_tan(-vars[0])-fp_log(-vars[0]) __
+#define T5035(_,__)_ fp_tan(-vars[0])-fp_log(-vars[0]) __
+#define T2226(_,__)_ fp_tan(-vars[0])-fp_log(vars[0]) __
+#define T5186(_,__)_ fp_tan(-vars[0])-fp_log(vars[0]) __
+#define T5036(_,__)_ fp_tan(-vars[0])-fp_sin(-vars[0]) __
+#define T2041(_,__)_ fp_tan(-vars[0])-fp_sin(-vars[0]) __
+#define T2227(_,__)_ fp_tan(-vars[0])-fp_sin(vars[0]) __
+#define T5187(_,__)_ fp_tan(-vars[0])-fp_sin(vars[0]) __
+#define T5037(_,__)_ fp_tan(-vars[0])-fp_sinh(-vars[0]) __
+#define T2042(_,__)_ fp_tan(-vars[0])-fp_sinh(-vars[0]) __
+#define T5188(_,__)_ fp_tan(-vars[0])-fp_sinh(vars[0]) __
+#define T2228(_,__)_ fp_tan(-vars[0])-fp_sinh(vars[0]) __
+#define T2043(_,__)_ fp_tan(-vars[0])-fp_tan(-vars[0]) __
+#define T5038(_,__)_ fp_tan(-vars[0])-fp_tan(-vars[0]) __
+#define T5189(_,__)_ fp_tan(-vars[0])-fp_tan(vars[0]) __
+#define T2229(_,__)_ fp_tan(-vars[0])-fp_tan(vars[0]) __
+#define T2044(_,__)_ fp_tan(-vars[0])-fp_tanh(-vars[0]) __
+#define T5039(_,__)_ fp_tan(-vars[0])-fp_tanh(-vars[0]) __
+#define T2230(_,__)_ fp_tan(-vars[0])-fp_tanh(vars[0]) __
+#define T5190(_,__)_ fp_tan(-vars[0])-fp_tanh(vars[0]) __
+#define T4728(_,__)_ fp_tan(Value_t(fp_abs(vars[0]))) __
+#define T1668(_,__)_ fp_tan(Value_t(fp_abs(vars[0]))) __
+#define T4730(_,__)_ fp_tan(Value_t(fp_arg(vars[0]))) __
+#define T1679(_,__)_ fp_tan(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4736(_,__)_ fp_tan(Value_t(fp_imag(vars[0]))) __
+#define T3567(_,__)_ fp_tan(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3568(_,__)_ fp_tan(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3569(_,__)_ fp_tan(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3570(_,__)_ fp_tan(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1697(_,__)_ fp_tan(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1823(_,__)_ fp_tan(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4748(_,__)_ fp_tan(Value_t(fp_real(vars[0]))) __
+#define  T590(_,__)_ fp_tan(c.l1_1)+vars[0] __
+#define  T591(_,__)_ fp_tan(d2r(c.l1_1))+vars[0] __
+#define T4719(_,__)_ fp_tan(fp_acos(vars[0])) __
+#define T1657(_,__)_ fp_tan(fp_acos(vars[0])) __
+#define T4720(_,__)_ fp_tan(fp_acosh(vars[0])) __
+#define T1658(_,__)_ fp_tan(fp_acosh(vars[0]+c.l0_6)) __
+#define T1659(_,__)_ fp_tan(fp_asin(vars[0])) __
+#define T4721(_,__)_ fp_tan(fp_asin(vars[0])) __
+#define T1661(_,__)_ fp_tan(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4722(_,__)_ fp_tan(fp_asinh(vars[0])) __
+#define T1660(_,__)_ fp_tan(fp_asinh(vars[0])) __
+#define T4724(_,__)_ fp_tan(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1666(_,__)_ fp_tan(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4726(_,__)_ fp_tan(fp_atan(Value_t(-fp_abs(vars[0]+c.lm0_4)))) __
+#define T1667(_,__)_ fp_tan(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4727(_,__)_ fp_tan(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T1665(_,__)_ fp_tan(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1662(_,__)_ fp_tan(fp_atan(vars[0])) __
+#define T4723(_,__)_ fp_tan(fp_atan(vars[0])) __
+#define T1663(_,__)_ fp_tan(fp_atan(vars[0]/vars[1])) __
+#define  T439(_,__)_ fp_tan(fp_atan2(vars[0],vars[1])) __
+#define T1655(_,__)_ fp_tan(fp_atan2(vars[0],vars[1])) __
+#define T4725(_,__)_ fp_tan(fp_atanh(vars[0])) __
+#define T1664(_,__)_ fp_tan(fp_atanh(vars[0])) __
+#define T1671(_,__)_ fp_tan(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4729(_,__)_ fp_tan(fp_cbrt(vars[0])) __
+#define T1670(_,__)_ fp_tan(fp_cbrt(vars[0])) __
+#define T4743(_,__)_ fp_tan(fp_conj(vars[0])) __
+#define T1674(_,__)_ fp_tan(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1669(_,__)_ fp_tan(fp_cos(vars[0])) __
+#define T1673(_,__)_ fp_tan(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1672(_,__)_ fp_tan(fp_cosh(vars[0])) __
+#define T1681(_,__)_ fp_tan(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1680(_,__)_ fp_tan(fp_exp(vars[0])) __
+#define T1676(_,__)_ fp_tan(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1675(_,__)_ fp_tan(fp_exp2(vars[0])) __
+#define T1682(_,__)_ fp_tan(fp_hypot(c.l1,vars[0])) __
+#define T4732(_,__)_ fp_tan(fp_hypot(c.l1,vars[0])) __
+#define T1683(_,__)_ fp_tan(fp_hypot(c.l2,vars[0])) __
+#define T4733(_,__)_ fp_tan(fp_hypot(c.l2,vars[0])) __
+#define T1685(_,__)_ fp_tan(fp_hypot(vars[0],c.l1)) __
+#define T4734(_,__)_ fp_tan(fp_hypot(vars[0],c.l1)) __
+#define T4735(_,__)_ fp_tan(fp_hypot(vars[0],c.l2)) __
+#define T1686(_,__)_ fp_tan(fp_hypot(vars[0],c.l2)) __
+#define T4731(_,__)_ fp_tan(fp_hypot(vars[0],vars[1])) __
+#define T1684(_,__)_ fp_tan(fp_hypot(vars[0],vars[1])) __
+#define T4737(_,__)_ fp_tan(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1688(_,__)_ fp_tan(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1687(_,__)_ fp_tan(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1678(_,__)_ fp_tan(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1677(_,__)_ fp_tan(fp_inv(fp_cos(vars[0]))) __
+#define T4739(_,__)_ fp_tan(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1689(_,__)_ fp_tan(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1690(_,__)_ fp_tan(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4740(_,__)_ fp_tan(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1692(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4741(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1693(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4742(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1691(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4738(_,__)_ fp_tan(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1656(_,__)_ fp_tan(fp_inv(fp_sin(vars[0]))) __
+#define T1698(_,__)_ fp_tan(fp_inv(fp_tan(vars[0]))) __
+#define T3566(_,__)_ fp_tan(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T4744(_,__)_ fp_tan(fp_log(vars[0])) __
+#define T1695(_,__)_ fp_tan(fp_log(vars[0])) __
+#define T4746(_,__)_ fp_tan(fp_log10(vars[0])) __
+#define T1696(_,__)_ fp_tan(fp_log10(vars[0])) __
+#define T1694(_,__)_ fp_tan(fp_log2(vars[0])) __
+#define T4745(_,__)_ fp_tan(fp_log2(vars[0])) __
+#define T4747(_,__)_ fp_tan(fp_polar(vars[0],vars[1])) __
+#define T1699(_,__)_ fp_tan(fp_pow(vars[0],vars[1])) __
+#define T1703(_,__)_ fp_tan(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1700(_,__)_ fp_tan(fp_sin(vars[0])) __
+#define T4749(_,__)_ fp_tan(fp_sin(vars[0])) __
+#define T1702(_,__)_ fp_tan(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1701(_,__)_ fp_tan(fp_sinh(vars[0])) __
+#define T4750(_,__)_ fp_tan(fp_sinh(vars[0])) __
+#define T1705(_,__)_ fp_tan(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4751(_,__)_ fp_tan(fp_sqrt(vars[0])) __
+#define T1704(_,__)_ fp_tan(fp_sqrt(vars[0])) __
+#define T1709(_,__)_ fp_tan(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4752(_,__)_ fp_tan(fp_tan(vars[0])) __
+#define T1706(_,__)_ fp_tan(fp_tan(vars[0])) __
+#define T1708(_,__)_ fp_tan(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1707(_,__)_ fp_tan(fp_tanh(vars[0])) __
+#define T4753(_,__)_ fp_tan(fp_tanh(vars[0])) __
+#define T1820(_,__)_ fp_tan(vars[0]) __
+#define T4819(_,__)_ fp_tan(vars[0]) __
+#define T6005(_,__)_ fp_tan(vars[0])+fp_acos(-vars[0]) __
+#define T3271(_,__)_ fp_tan(vars[0])+fp_acos(-vars[0]) __
+#define T6006(_,__)_ fp_tan(vars[0])+fp_acosh(-vars[0]) __
+#define T3272(_,__)_ fp_tan(vars[0])+fp_acosh(-vars[0]) __
+#define T6007(_,__)_ fp_tan(vars[0])+fp_asin(-vars[0]) __
+#define T3273(_,__)_ fp_tan(vars[0])+fp_asin(-vars[0]) __
+#define T6008(_,__)_ fp_tan(vars[0])+fp_asinh(-vars[0]) __
+#define T3274(_,__)_ fp_tan(vars[0])+fp_asinh(-vars[0]) __
+#define T3275(_,__)_ fp_tan(vars[0])+fp_atan(-vars[0]) __
+#define T6009(_,__)_ fp_tan(vars[0])+fp_atan(-vars[0]) __
+#define T3276(_,__)_ fp_tan(vars[0])+fp_atanh(-vars[0]) __
+#define T6010(_,__)_ fp_tan(vars[0])+fp_atanh(-vars[0]) __
+#define T3277(_,__)_ fp_tan(vars[0])+fp_cos(-vars[0]) __
+#define T6011(_,__)_ fp_tan(vars[0])+fp_cos(-vars[0]) __
+#define T6012(_,__)_ fp_tan(vars[0])+fp_cosh(-vars[0]) __
+#define T3278(_,__)_ fp_tan(vars[0])+fp_cosh(-vars[0]) __
+#define T3279(_,__)_ fp_tan(vars[0])+fp_exp(-vars[0]) __
+#define T6013(_,__)_ fp_tan(vars[0])+fp_exp(-vars[0]) __
+#define  T578(_,__)_ fp_tan(vars[0])+fp_inv(fp_tan(vars[0])) __
+#define T3280(_,__)_ fp_tan(vars[0])+fp_log(-vars[0]) __
+#define T6014(_,__)_ fp_tan(vars[0])+fp_log(-vars[0]) __
+#define T3281(_,__)_ fp_tan(vars[0])+fp_sin(-vars[0]) __
+#define T6015(_,__)_ fp_tan(vars[0])+fp_sin(-vars[0]) __
+#define T6016(_,__)_ fp_tan(vars[0])+fp_sinh(-vars[0]) __
+#define T3282(_,__)_ fp_tan(vars[0])+fp_sinh(-vars[0]) __
+#define T6017(_,__)_ fp_tan(vars[0])+fp_tan(-vars[0]) __
+#define T3283(_,__)_ fp_tan(vars[0])+fp_tan(-vars[0]) __
+#define T3398(_,__)_ fp_tan(vars[0])+fp_tan(vars[0]) __
+#define T6109(_,__)_ fp_tan(vars[0])+fp_tan(vars[0]) __
+#define T6018(_,__)_ fp_tan(vars[0])+fp_tanh(-vars[0]) __
+#define T3284(_,__)_ fp_tan(vars[0])+fp_tanh(-vars[0]) __
+#define T6110(_,__)_ fp_tan(vars[0])+fp_tanh(vars[0]) __
+#define T3399(_,__)_ fp_tan(vars[0])+fp_tanh(vars[0]) __
+#define T2403(_,__)_ fp_tan(vars[0])-fp_acos(-vars[0]) __
+#define T5328(_,__)_ fp_tan(vars[0])-fp_acos(-vars[0]) __
+#define T2593(_,__)_ fp_tan(vars[0])-fp_acos(vars[0]) __
+#define T5480(_,__)_ fp_tan(vars[0])-fp_acos(vars[0]) __
+#define T5329(_,__)_ fp_tan(vars[0])-fp_acosh(-vars[0]) __
+#define T2404(_,__)_ fp_tan(vars[0])-fp_acosh(-vars[0]) __
+#define T2594(_,__)_ fp_tan(vars[0])-fp_acosh(vars[0]) __
+#define T5481(_,__)_ fp_tan(vars[0])-fp_acosh(vars[0]) __
+#define T2405(_,__)_ fp_tan(vars[0])-fp_asin(-vars[0]) __
+#define T5330(_,__)_ fp_tan(vars[0])-fp_asin(-vars[0]) __
+#define T2595(_,__)_ fp_tan(vars[0])-fp_asin(vars[0]) __
+#define T5482(_,__)_ fp_tan(vars[0])-fp_asin(vars[0]) __
+#define T2406(_,__)_ fp_tan(vars[0])-fp_asinh(-vars[0]) __
+#define T5331(_,__)_ fp_tan(vars[0])-fp_asinh(-vars[0]) __
+#define T2596(_,__)_ fp_tan(vars[0])-fp_asinh(vars[0]) __
+#define T5483(_,__)_ fp_tan(vars[0])-fp_asinh(vars[0]) __
+#define T2407(_,__)_ fp_tan(vars[0])-fp_atan(-vars[0]) __
+#define T5332(_,__)_ fp_tan(vars[0])-fp_atan(-vars[0]) __
+#define T2597(_,__)_ fp_tan(vars[0])-fp_atan(vars[0]) __
+#define T5484(_,__)_ fp_tan(vars[0])-fp_atan(vars[0]) __
+#define T2408(_,__)_ fp_tan(vars[0])-fp_atanh(-vars[0]) __
+#define T5333(_,__)_ fp_tan(vars[0])-fp_atanh(-vars[0]) __
+#define T5485(_,__)_ fp_tan(vars[0])-fp_atanh(vars[0]) __
+#define T2598(_,__)_ fp_tan(vars[0])-fp_atanh(vars[0]) __
+#define T2409(_,__)_ fp_tan(vars[0])-fp_cos(-vars[0]) __
+#define T5334(_,__)_ fp_tan(vars[0])-fp_cos(-vars[0]) __
+#define T5486(_,__)_ fp_tan(vars[0])-fp_cos(vars[0]) __
+#define T2599(_,__)_ fp_tan(vars[0])-fp_cos(vars[0]) __
+#define T2410(_,__)_ fp_tan(vars[0])-fp_cosh(-vars[0]) __
+#define T5335(_,__)_ fp_tan(vars[0])-fp_cosh(-vars[0]) __
+#define T2600(_,__)_ fp_tan(vars[0])-fp_cosh(vars[0]) __
+#define T5487(_,__)_ fp_tan(vars[0])-fp_cosh(vars[0]) __
+#define T2411(_,__)_ fp_tan(vars[0])-fp_exp(-vars[0]) __
+#define T5336(_,__)_ fp_tan(vars[0])-fp_exp(-vars[0]) __
+#define T5488(_,__)_ fp_tan(vars[0])-fp_exp(vars[0]) __
+#define T2601(_,__)_ fp_tan(vars[0])-fp_exp(vars[0]) __
+#define T5337(_,__)_ fp_tan(vars[0])-fp_log(-vars[0]) __
+#define T2412(_,__)_ fp_tan(vars[0])-fp_log(-vars[0]) __
+#define T2602(_,__)_ fp_tan(vars[0])-fp_log(vars[0]) __
+#define T5489(_,__)_ fp_tan(vars[0])-fp_log(vars[0]) __
+#define T5338(_,__)_ fp_tan(vars[0])-fp_sin(-vars[0]) __
+#define T2413(_,__)_ fp_tan(vars[0])-fp_sin(-vars[0]) __
+#define T5490(_,__)_ fp_tan(vars[0])-fp_sin(vars[0]) __
+#define T2603(_,__)_ fp_tan(vars[0])-fp_sin(vars[0]) __
+#define T2414(_,__)_ fp_tan(vars[0])-fp_sinh(-vars[0]) __
+#define T5339(_,__)_ fp_tan(vars[0])-fp_sinh(-vars[0]) __
+#define T2604(_,__)_ fp_tan(vars[0])-fp_sinh(vars[0]) __
+#define T5491(_,__)_ fp_tan(vars[0])-fp_sinh(vars[0]) __
+#define T2415(_,__)_ fp_tan(vars[0])-fp_tan(-vars[0]) __
+#define T5340(_,__)_ fp_tan(vars[0])-fp_tan(-vars[0]) __
+#define T5492(_,__)_ fp_tan(vars[0])-fp_tan(vars[0]) __
+#define T2605(_,__)_ fp_tan(vars[0])-fp_tan(vars[0]) __
+#define T5341(_,__)_ fp_tan(vars[0])-fp_tanh(-vars[0]) __
+#define T2416(_,__)_ fp_tan(vars[0])-fp_tanh(-vars[0]) __
+#define T2606(_,__)_ fp_tan(vars[0])-fp_tanh(vars[0]) __
+#define T5493(_,__)_ fp_tan(vars[0])-fp_tanh(vars[0]) __
+#define T4890(_,__)_ fp_tan(vars[0]*(c.l1*c.i)) __
+#define T4892(_,__)_ fp_tan(vars[0]*(c.l3*c.i)) __
+#define T4896(_,__)_ fp_tan(vars[0]*-(c.l1*c.i)) __
+#define T4895(_,__)_ fp_tan(vars[0]*-(c.l3*c.i)) __
+#define T4891(_,__)_ fp_tan(vars[0]*c.l2) __
+#define T1863(_,__)_ fp_tan(vars[0]*c.l2) __
+#define T1864(_,__)_ fp_tan(vars[0]*c.lm1) __
+#define T4893(_,__)_ fp_tan(vars[0]*c.lm1) __
+#define T1865(_,__)_ fp_tan(vars[0]*c.lm2) __
+#define T4894(_,__)_ fp_tan(vars[0]*c.lm2) __
+#define  T548(_,__)_ fp_tanh(-vars[0]) __
+#define T3112(_,__)_ fp_tanh(-vars[0])+fp_tanh(-vars[0]) __
+#define T5887(_,__)_ fp_tanh(-vars[0])+fp_tanh(-vars[0]) __
+#define T2045(_,__)_ fp_tanh(-vars[0])-fp_acos(-vars[0]) __
+#define T5040(_,__)_ fp_tanh(-vars[0])-fp_acos(-vars[0]) __
+#define T5191(_,__)_ fp_tanh(-vars[0])-fp_acos(vars[0]) __
+#define T2231(_,__)_ fp_tanh(-vars[0])-fp_acos(vars[0]) __
+#define T2046(_,__)_ fp_tanh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5041(_,__)_ fp_tanh(-vars[0])-fp_acosh(-vars[0]) __
+#define T5192(_,__)_ fp_tanh(-vars[0])-fp_acosh(vars[0]) __
+#define T2232(_,__)_ fp_tanh(-vars[0])-fp_acosh(vars[0]) __
+#define T2047(_,__)_ fp_tanh(-vars[0])-fp_asin(-vars[0]) __
+#define T5042(_,__)_ fp_tanh(-vars[0])-fp_asin(-vars[0]) __
+#define T2233(_,__)_ fp_tanh(-vars[0])-fp_asin(vars[0]) __
+#define T5193(_,__)_ fp_tanh(-vars[0])-fp_asin(vars[0]) __
+#define T2048(_,__)_ fp_tanh(-vars[0])-fp_asinh(-vars[0]) __
+#define T5043(_,__)_ fp_tanh(-vars[0])-fp_asinh(-vars[0]) __
+#define T2234(_,__)_ fp_tanh(-vars[0])-fp_asinh(vars[0]) __
+#define T5194(_,__)_ fp_tanh(-vars[0])-fp_asinh(vars[0]) __
+#define T2049(_,__)_ fp_tanh(-vars[0])-fp_atan(-vars[0]) __
+#define T5044(_,__)_ fp_tanh(-vars[0])-fp_atan(-vars[0]) __
+#define T2235(_,__)_ fp_tanh(-vars[0])-fp_atan(vars[0]) __
+#define T5195(_,__)_ fp_tanh(-vars[0])-fp_atan(vars[0]) __
+#define T2050(_,__)_ fp_tanh(-vars[0])-fp_atanh(-vars[0]) __
+#define T5045(_,__)_ fp_tanh(-vars[0])-fp_atanh(-vars[0]) __
+#define T2236(_,__)_ fp_tanh(-vars[0])-fp_atanh(vars[0]) __
+#define T5196(_,__)_ fp_tanh(-vars[0])-fp_atanh(vars[0]) __
+#define T2051(_,__)_ fp_tanh(-vars[0])-fp_cos(-vars[0]) __
+#define T5046(_,__)_ fp_tanh(-vars[0])-fp_cos(-vars[0]) __
+#define T2237(_,__)_ fp_tanh(-vars[0])-fp_cos(vars[0]) __
+#define T5197(_,__)_ fp_tanh(-vars[0])-fp_cos(vars[0]) __
+#define T2052(_,__)_ fp_tanh(-vars[0])-fp_cosh(-vars[0]) __
+#define T5047(_,__)_ fp_tanh(-vars[0])-fp_cosh(-vars[0]) __
+#define T5198(_,__)_ fp_tanh(-vars[0])-fp_cosh(vars[0]) __
+#define T2238(_,__)_ fp_tanh(-vars[0])-fp_cosh(vars[0]) __
+#define T5048(_,__)_ fp_tanh(-vars[0])-fp_exp(-vars[0]) __
+#define T2053(_,__)_ fp_tanh(-vars[0])-fp_exp(-vars[0]) __
+#define T2239(_,__)_ fp_tanh(-vars[0])-fp_exp(vars[0]) __
+#define T5199(_,__)_ fp_tanh(-vars[0])-fp_exp(vars[0]) __
+#define T5049(_,__)_ fp_tanh(-vars[0])-fp_log(-vars[0]) __
+#define T2054(_,__)_ fp_tanh(-vars[0])-fp_log(-vars[0]) __
+#define T5200(_,__)_ fp_tanh(-vars[0])-fp_log(vars[0]) __
+#define T2240(_,__)_ fp_tanh(-vars[0])-fp_log(vars[0]) __
+#define T2055(_,__)_ fp_tanh(-vars[0])-fp_sin(-vars[0]) __
+#define T5050(_,__)_ fp_tanh(-vars[0])-fp_sin(-vars[0]) __
+#define T5201(_,__)_ fp_tanh(-vars[0])-fp_sin(vars[0]) __
+#define T2241(_,__)_ fp_tanh(-vars[0])-fp_sin(vars[0]) __
+#define T2056(_,__)_ fp_tanh(-vars[0])-fp_sinh(-vars[0]) __
+#define T5051(_,__)_ fp_tanh(-vars[0])-fp_sinh(-vars[0]) __
+#define T2242(_,__)_ fp_tanh(-vars[0])-fp_sinh(vars[0]) __
+#define T5202(_,__)_ fp_tanh(-vars[0])-fp_sinh(vars[0]) __
+#define T2057(_,__)_ fp_tanh(-vars[0])-fp_tan(-vars[0]) __
+#define T5052(_,__)_ fp_tanh(-vars[0])-fp_tan(-vars[0]) __
+#define T5203(_,__)_ fp_tanh(-vars[0])-fp_tan(vars[0]) __
+#define T2243(_,__)_ fp_tanh(-vars[0])-fp_tan(vars[0]) __
+#define T2058(_,__)_ fp_tanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5053(_,__)_ fp_tanh(-vars[0])-fp_tanh(-vars[0]) __
+#define T5204(_,__)_ fp_tanh(-vars[0])-fp_tanh(vars[0]) __
+#define T2244(_,__)_ fp_tanh(-vars[0])-fp_tanh(vars[0]) __
+#define T1725(_,__)_ fp_tanh(Value_t(fp_abs(vars[0]))) __
+#define T4763(_,__)_ fp_tanh(Value_t(fp_abs(vars[0]))) __
+#define T4765(_,__)_ fp_tanh(Value_t(fp_arg(vars[0]))) __
+#define T1736(_,__)_ fp_tanh(Value_t(fp_equal(vars[0],vars[1]))) __
+#define T4771(_,__)_ fp_tanh(Value_t(fp_imag(vars[0]))) __
+#define T3572(_,__)_ fp_tanh(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3573(_,__)_ fp_tanh(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3574(_,__)_ fp_tanh(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3575(_,__)_ fp_tanh(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define T1822(_,__)_ fp_tanh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T1754(_,__)_ fp_tanh(Value_t(fp_nequal(vars[0],vars[1]))) __
+#define T4783(_,__)_ fp_tanh(Value_t(fp_real(vars[0]))) __
+#define  T592(_,__)_ fp_tanh(c.l1_1)+vars[0] __
+#define  T593(_,__)_ fp_tanh(d2r(c.l1_1))+vars[0] __
+#define T1714(_,__)_ fp_tanh(fp_acos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4754(_,__)_ fp_tanh(fp_acos(vars[0])) __
+#define T1712(_,__)_ fp_tanh(fp_acos(vars[0])) __
+#define T4755(_,__)_ fp_tanh(fp_acosh(vars[0])) __
+#define T1713(_,__)_ fp_tanh(fp_acosh(vars[0]+c.l0_6)) __
+#define T1718(_,__)_ fp_tanh(fp_asin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4756(_,__)_ fp_tanh(fp_asin(vars[0])) __
+#define T1715(_,__)_ fp_tanh(fp_asin(vars[0])) __
+#define T1717(_,__)_ fp_tanh(fp_asinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1716(_,__)_ fp_tanh(fp_asinh(vars[0])) __
+#define T4757(_,__)_ fp_tanh(fp_asinh(vars[0])) __
+#define T4759(_,__)_ fp_tanh(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2))) __
+#define T1723(_,__)_ fp_tanh(fp_atan(Value_t(-fp_abs(vars[0])))) __
+#define T4761(_,__)_ fp_tanh(fp_atan(Value_t(-fp_abs(vars[0]+c.lm0_4)))) __
+#define T1724(_,__)_ fp_tanh(fp_atan(Value_t(fp_abs(vars[0])))) __
+#define T4762(_,__)_ fp_tanh(fp_atan(Value_t(fp_abs(vars[0]+c.lm0_4)))) __
+#define T1722(_,__)_ fp_tanh(fp_atan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1719(_,__)_ fp_tanh(fp_atan(vars[0])) __
+#define T4758(_,__)_ fp_tanh(fp_atan(vars[0])) __
+#define T1720(_,__)_ fp_tanh(fp_atan(vars[0]/vars[1])) __
+#define T1710(_,__)_ fp_tanh(fp_atan2(vars[0],vars[1])) __
+#define T4760(_,__)_ fp_tanh(fp_atanh(vars[0])) __
+#define T1721(_,__)_ fp_tanh(fp_atanh(vars[0])) __
+#define T1728(_,__)_ fp_tanh(fp_cbrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4764(_,__)_ fp_tanh(fp_cbrt(vars[0])) __
+#define T1727(_,__)_ fp_tanh(fp_cbrt(vars[0])) __
+#define T4778(_,__)_ fp_tanh(fp_conj(vars[0])) __
+#define T1731(_,__)_ fp_tanh(fp_cos(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1726(_,__)_ fp_tanh(fp_cos(vars[0])) __
+#define T1730(_,__)_ fp_tanh(fp_cosh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1729(_,__)_ fp_tanh(fp_cosh(vars[0])) __
+#define T1738(_,__)_ fp_tanh(fp_exp(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1737(_,__)_ fp_tanh(fp_exp(vars[0])) __
+#define T1733(_,__)_ fp_tanh(fp_exp2(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1732(_,__)_ fp_tanh(fp_exp2(vars[0])) __
+#define T4767(_,__)_ fp_tanh(fp_hypot(c.l1,vars[0])) __
+#define T1739(_,__)_ fp_tanh(fp_hypot(c.l1,vars[0])) __
+#define T1740(_,__)_ fp_tanh(fp_hypot(c.l2,vars[0])) __
+#define T4768(_,__)_ fp_tanh(fp_hypot(c.l2,vars[0])) __
+#define T4769(_,__)_ fp_tanh(fp_hypot(vars[0],c.l1)) __
+#define T1742(_,__)_ fp_tanh(fp_hypot(vars[0],c.l1)) __
+#define T1743(_,__)_ fp_tanh(fp_hypot(vars[0],c.l2)) __
+#define T4770(_,__)_ fp_tanh(fp_hypot(vars[0],c.l2)) __
+#define T1741(_,__)_ fp_tanh(fp_hypot(vars[0],vars[1])) __
+#define T4766(_,__)_ fp_tanh(fp_hypot(vars[0],vars[1])) __
+#define T4772(_,__)_ fp_tanh(fp_inv(fp_atan((vars[0]+c.lm0_2)/(vars[1]+c.lm0_2)))) __
+#define T1745(_,__)_ fp_tanh(fp_inv(fp_atan(vars[0]/vars[1]))) __
+#define T1744(_,__)_ fp_tanh(fp_inv(fp_atan2(vars[0],vars[1]))) __
+#define T1735(_,__)_ fp_tanh(fp_inv(fp_cos(Value_t(fp_nequal(vars[0],vars[1]))))) __
+#define T1734(_,__)_ fp_tanh(fp_inv(fp_cos(vars[0]))) __
+#define T4774(_,__)_ fp_tanh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1746(_,__)_ fp_tanh(fp_inv(fp_hypot(c.l1,vars[0]))) __
+#define T1747(_,__)_ fp_tanh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T4775(_,__)_ fp_tanh(fp_inv(fp_hypot(c.l2,vars[0]))) __
+#define T1749(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T4776(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],c.l1))) __
+#define T1750(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T4777(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],c.l2))) __
+#define T1748(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T4773(_,__)_ fp_tanh(fp_inv(fp_hypot(vars[0],vars[1]))) __
+#define T1711(_,__)_ fp_tanh(fp_inv(fp_sin(vars[0]))) __
+#define T1755(_,__)_ fp_tanh(fp_inv(fp_tan(vars[0]))) __
+#define T3571(_,__)_ fp_tanh(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T1752(_,__)_ fp_tanh(fp_log(vars[0])) __
+#define T4779(_,__)_ fp_tanh(fp_log(vars[0])) __
+#define T1753(_,__)_ fp_tanh(fp_log10(vars[0])) __
+#define T4781(_,__)_ fp_tanh(fp_log10(vars[0])) __
+#define T1751(_,__)_ fp_tanh(fp_log2(vars[0])) __
+#define T4780(_,__)_ fp_tanh(fp_log2(vars[0])) __
+#define T4782(_,__)_ fp_tanh(fp_polar(vars[0],vars[1])) __
+#define T1756(_,__)_ fp_tanh(fp_pow(vars[0],vars[1])) __
+#define T1760(_,__)_ fp_tanh(fp_sin(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1757(_,__)_ fp_tanh(fp_sin(vars[0])) __
+#define T4784(_,__)_ fp_tanh(fp_sin(vars[0])) __
+#define T1759(_,__)_ fp_tanh(fp_sinh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4785(_,__)_ fp_tanh(fp_sinh(vars[0])) __
+#define T1758(_,__)_ fp_tanh(fp_sinh(vars[0])) __
+#define T1762(_,__)_ fp_tanh(fp_sqrt(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4786(_,__)_ fp_tanh(fp_sqrt(vars[0])) __
+#define T1761(_,__)_ fp_tanh(fp_sqrt(vars[0])) __
+#define T1766(_,__)_ fp_tanh(fp_tan(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T1763(_,__)_ fp_tanh(fp_tan(vars[0])) __
+#define T4787(_,__)_ fp_tanh(fp_tan(vars[0])) __
+#define T1765(_,__)_ fp_tanh(fp_tanh(Value_t(fp_nequal(vars[0],vars[1])))) __
+#define T4788(_,__)_ fp_tanh(fp_tanh(vars[0])) __
+#define T1764(_,__)_ fp_tanh(fp_tanh(vars[0])) __
+#define T1821(_,__)_ fp_tanh(vars[0]) __
+#define T4820(_,__)_ fp_tanh(vars[0]) __
+#define T3285(_,__)_ fp_tanh(vars[0])+fp_acos(-vars[0]) __
+#define T6019(_,__)_ fp_tanh(vars[0])+fp_acos(-vars[0]) __
+#define T3286(_,__)_ fp_tanh(vars[0])+fp_acosh(-vars[0]) __
+#define T6020(_,__)_ fp_tanh(vars[0])+fp_acosh(-vars[0]) __
+#define T6021(_,__)_ fp_tanh(vars[0])+fp_asin(-vars[0]) __
+#define T3287(_,__)_ fp_tanh(vars[0])+fp_asin(-vars[0]) __
+#define T6022(_,__)_ fp_tanh(vars[0])+fp_asinh(-vars[0]) __
+#define T3288(_,__)_ fp_tanh(vars[0])+fp_asinh(-vars[0]) __
+#define T3289(_,__)_ fp_tanh(vars[0])+fp_atan(-vars[0]) __
+#define T6023(_,__)_ fp_tanh(vars[0])+fp_atan(-vars[0]) __
+#define T3290(_,__)_ fp_tanh(vars[0])+fp_atanh(-vars[0]) __
+#define T6024(_,__)_ fp_tanh(vars[0])+fp_atanh(-vars[0]) __
+#define T6025(_,__)_ fp_tanh(vars[0])+fp_cos(-vars[0]) __
+#define T3291(_,__)_ fp_tanh(vars[0])+fp_cos(-vars[0]) __
+#define T6026(_,__)_ fp_tanh(vars[0])+fp_cosh(-vars[0]) __
+#define T3292(_,__)_ fp_tanh(vars[0])+fp_cosh(-vars[0]) __
+#define T6027(_,__)_ fp_tanh(vars[0])+fp_exp(-vars[0]) __
+#define T3293(_,__)_ fp_tanh(vars[0])+fp_exp(-vars[0]) __
+#define T6028(_,__)_ fp_tanh(vars[0])+fp_log(-vars[0]) __
+#define T3294(_,__)_ fp_tanh(vars[0])+fp_log(-vars[0]) __
+#define T6029(_,__)_ fp_tanh(vars[0])+fp_sin(-vars[0]) __
+#define T3295(_,__)_ fp_tanh(vars[0])+fp_sin(-vars[0]) __
+#define T6030(_,__)_ fp_tanh(vars[0])+fp_sinh(-vars[0]) __
+#define T3296(_,__)_ fp_tanh(vars[0])+fp_sinh(-vars[0]) __
+#define T6031(_,__)_ fp_tanh(vars[0])+fp_tan(-vars[0]) __
+#define T3297(_,__)_ fp_tanh(vars[0])+fp_tan(-vars[0]) __
+#define T6032(_,__)_ fp_tanh(vars[0])+fp_tanh(-vars[0]) __
+#define T3298(_,__)_ fp_tanh(vars[0])+fp_tanh(-vars[0]) __
+#define T6111(_,__)_ fp_tanh(vars[0])+fp_tanh(vars[0]) __
+#define T3400(_,__)_ fp_tanh(vars[0])+fp_tanh(vars[0]) __
+#define T5342(_,__)_ fp_tanh(vars[0])-fp_acos(-vars[0]) __
+#define T2417(_,__)_ fp_tanh(vars[0])-fp_acos(-vars[0]) __
+#define T5494(_,__)_ fp_tanh(vars[0])-fp_acos(vars[0]) __
+#define T2607(_,__)_ fp_tanh(vars[0])-fp_acos(vars[0]) __
+#define T2418(_,__)_ fp_tanh(vars[0])-fp_acosh(-vars[0]) __
+#define T5343(_,__)_ fp_tanh(vars[0])-fp_acosh(-vars[0]) __
+#define T2608(_,__)_ fp_tanh(vars[0])-fp_acosh(vars[0]) __
+#define T5495(_,__)_ fp_tanh(vars[0])-fp_acosh(vars[0]) __
+#define T5344(_,__)_ fp_tanh(vars[0])-fp_asin(-vars[0]) __
+#define T2419(_,__)_ fp_tanh(vars[0])-fp_asin(-vars[0]) __
+#define T5496(_,__)_ fp_tanh(vars[0])-fp_asin(vars[0]) __
+#define T2609(_,__)_ fp_tanh(vars[0])-fp_asin(vars[0]) __
+#define T2420(_,__)_ fp_tanh(vars[0])-fp_asinh(-vars[0]) __
+#define T5345(_,__)_ fp_tanh(vars[0])-fp_asinh(-vars[0]) __
+#define T5497(_,__)_ fp_tanh(vars[0])-fp_asinh(vars[0]) __
+#define T2610(_,__)_ fp_tanh(vars[0])-fp_asinh(vars[0]) __
+#define T2421(_,__)_ fp_tanh(vars[0])-fp_atan(-vars[0]) __
+#define T5346(_,__)_ fp_tanh(vars[0])-fp_atan(-vars[0]) __
+#define T2611(_,__)_ fp_tanh(vars[0])-fp_atan(vars[0]) __
+#define T5498(_,__)_ fp_tanh(vars[0])-fp_atan(vars[0]) __
+#define T5347(_,__)_ fp_tanh(vars[0])-fp_atanh(-vars[0]) __
+#define T2422(_,__)_ fp_tanh(vars[0])-fp_atanh(-vars[0]) __
+#define T5499(_,__)_ fp_tanh(vars[0])-fp_atanh(vars[0]) __
+#define T2612(_,__)_ fp_tanh(vars[0])-fp_atanh(vars[0]) __
+#define T2423(_,__)_ fp_tanh(vars[0])-fp_cos(-vars[0]) __
+#define T5348(_,__)_ fp_tanh(vars[0])-fp_cos(-vars[0]) __
+#define T2613(_,__)_ fp_tanh(vars[0])-fp_cos(vars[0]) __
+#define T5500(_,__)_ fp_tanh(vars[0])-fp_cos(vars[0]) __
+#define T2424(_,__)_ fp_tanh(vars[0])-fp_cosh(-vars[0]) __
+#define T5349(_,__)_ fp_tanh(vars[0])-fp_cosh(-vars[0]) __
+#define T5501(_,__)_ fp_tanh(vars[0])-fp_cosh(vars[0]) __
+#define T2614(_,__)_ fp_tanh(vars[0])-fp_cosh(vars[0]) __
+#define T2425(_,__)_ fp_tanh(vars[0])-fp_exp(-vars[0]) __
+#define T5350(_,__)_ fp_tanh(vars[0])-fp_exp(-vars[0]) __
+#define T5502(_,__)_ fp_tanh(vars[0])-fp_exp(vars[0]) __
+#define T2615(_,__)_ fp_tanh(vars[0])-fp_exp(vars[0]) __
+#define T2426(_,__)_ fp_tanh(vars[0])-fp_log(-vars[0]) __
+#define T5351(_,__)_ fp_tanh(vars[0])-fp_log(-vars[0]) __
+#define T2616(_,__)_ fp_tanh(vars[0])-fp_log(vars[0]) __
+#define T5503(_,__)_ fp_tanh(vars[0])-fp_log(vars[0]) __
+#define T2427(_,__)_ fp_tanh(vars[0])-fp_sin(-vars[0]) __
+#define T5352(_,__)_ fp_tanh(vars[0])-fp_sin(-vars[0]) __
+#define T2617(_,__)_ fp_tanh(vars[0])-fp_sin(vars[0]) __
+#define T5504(_,__)_ fp_tanh(vars[0])-fp_sin(vars[0]) __
+#define T2428(_,__)_ fp_tanh(vars[0])-fp_sinh(-vars[0]) __
+#define T5353(_,__)_ fp_tanh(vars[0])-fp_sinh(-vars[0]) __
+#define T5505(_,__)_ fp_tanh(vars[0])-fp_sinh(vars[0]) __
+#define T2618(_,__)_ fp_tanh(vars[0])-fp_sinh(vars[0]) __
+#define T2429(_,__)_ fp_tanh(vars[0])-fp_tan(-vars[0]) __
+#define T5354(_,__)_ fp_tanh(vars[0])-fp_tan(-vars[0]) __
+#define T2619(_,__)_ fp_tanh(vars[0])-fp_tan(vars[0]) __
+#define T5506(_,__)_ fp_tanh(vars[0])-fp_tan(vars[0]) __
+#define T2430(_,__)_ fp_tanh(vars[0])-fp_tanh(-vars[0]) __
+#define T5355(_,__)_ fp_tanh(vars[0])-fp_tanh(-vars[0]) __
+#define T2620(_,__)_ fp_tanh(vars[0])-fp_tanh(vars[0]) __
+#define T5507(_,__)_ fp_tanh(vars[0])-fp_tanh(vars[0]) __
+#define T4897(_,__)_ fp_tanh(vars[0]*(c.l1*c.i)) __
+#define T4899(_,__)_ fp_tanh(vars[0]*(c.l3*c.i)) __
+#define T4903(_,__)_ fp_tanh(vars[0]*-(c.l1*c.i)) __
+#define T4902(_,__)_ fp_tanh(vars[0]*-(c.l3*c.i)) __
+#define T1866(_,__)_ fp_tanh(vars[0]*c.l2) __
+#define T4898(_,__)_ fp_tanh(vars[0]*c.l2) __
+#define T4900(_,__)_ fp_tanh(vars[0]*c.lm1) __
+#define T1867(_,__)_ fp_tanh(vars[0]*c.lm1) __
+#define T4901(_,__)_ fp_tanh(vars[0]*c.lm2) __
+#define T1868(_,__)_ fp_tanh(vars[0]*c.lm2) __
+#define  T522(_,__)_ fp_trunc(Value_t(fp_greater(vars[0],c.l4))) __
+#define T3577(_,__)_ fp_trunc(Value_t(fp_less(vars[0],vars[1]))) __
+#define T3578(_,__)_ fp_trunc(Value_t(fp_less(vars[0],vars[1]))*c.lm1_1) __
+#define T3579(_,__)_ fp_trunc(Value_t(fp_less(vars[0],vars[1]))*vars[0]*vars[1]*c.lm1_1) __
+#define T3580(_,__)_ fp_trunc(Value_t(fp_less(vars[0],vars[1]))+c.lm1_1) __
+#define  T594(_,__)_ fp_trunc(c.l1_1)+vars[0] __
+#define T3576(_,__)_ fp_trunc(fp_less(vars[0],vars[1]) ? c.lm1_1 : c.l1_2) __
+#define T3726(_,__)_ fp_trunc(vars[0]+-(Value_t(fp_abs(vars[1]))+c.l1)) __
+#define T3717(_,__)_ fp_trunc(vars[0]+Value_t(fp_abs(fp_ceil(vars[1])))) __
+#define T3718(_,__)_ fp_trunc(vars[0]+Value_t(fp_abs(fp_floor(vars[1])))) __
+#define T3719(_,__)_ fp_trunc(vars[0]+Value_t(fp_abs(fp_int(vars[1])))) __
+#define T3721(_,__)_ fp_trunc(vars[0]+Value_t(fp_abs(fp_trunc(vars[1])))) __
+#define T3720(_,__)_ fp_trunc(vars[0]+Value_t(fp_abs(vars[1]))) __
+#define T3727(_,__)_ fp_trunc(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3725(_,__)_ fp_trunc(vars[0]+Value_t(fp_less(vars[0],vars[1]))) __
+#define T3722(_,__)_ fp_trunc(vars[0]+fp_ceil(vars[1])) __
+#define T3723(_,__)_ fp_trunc(vars[0]+fp_floor(vars[1])) __
+#define T3724(_,__)_ fp_trunc(vars[0]+fp_int(vars[1])) __
+#define T3728(_,__)_ fp_trunc(vars[0]+fp_trunc(vars[1])) __
+#define T3607(_,__)_ fp_truth(fp_sin(vars[0])+c.l1_2) __
+#define   T89(_,__)_ fp_truth(vars[0]) __
+#define  T257(_,__)_ fp_truth(vars[0]) ? Value_t(fp_and(vars[1],vars[2])) : vars[2] __
+#define  T266(_,__)_ fp_truth(vars[0]) ? Value_t(fp_or(vars[1],vars[2])) : vars[2] __
+#define  T252(_,__)_ fp_truth(vars[0]) ? fp_abs(vars[0]+c.l2) : fp_abs(vars[1]+c.l5) __
+#define  T256(_,__)_ fp_truth(vars[0]) ? fp_and(vars[1],vars[2]) : fp_less(vars[1],c.l1) __
+#define  T258(_,__)_ fp_truth(vars[0]) ? fp_less(vars[1],c.l1) : fp_and(vars[1],vars[2]) __
+#define  T267(_,__)_ fp_truth(vars[0]) ? fp_less(vars[1],c.l1) : fp_or(vars[1],vars[2]) __
+#define  T261(_,__)_ fp_truth(vars[0]) ? fp_min(vars[1],c.l2) : fp_min(vars[1],c.l5) __
+#define  T265(_,__)_ fp_truth(vars[0]) ? fp_or(vars[1],vars[2]) : fp_less(vars[1],c.l1) __
+#define T3464(_,__)_ fp_truth(vars[0]) ? fp_sin(vars[1]) : fp_sin(vars[0]) __
+#define  T275(_,__)_ fp_truth(vars[0]) ? vars[1] : vars[1] __
+#define  T264(_,__)_ fp_truth(vars[0]) ? vars[1] : vars[1]*c.l2 __
+#define  T255(_,__)_ fp_truth(vars[0]) ? vars[1] : vars[1]+c.l2 __
+#define  T263(_,__)_ fp_truth(vars[0]) ? vars[1]*c.l2 : vars[1] __
+#define  T262(_,__)_ fp_truth(vars[0]) ? vars[1]*c.l2 : vars[1]*c.l5 __
+#define  T254(_,__)_ fp_truth(vars[0]) ? vars[1]+c.l2 : vars[1] __
+#define  T253(_,__)_ fp_truth(vars[0]) ? vars[1]+c.l2 : vars[1]+c.l5 __
+#define  T260(_,__)_ fp_truth(vars[0]) ? vars[1]/vars[0] : vars[1]/c.l2 __
+#define  T259(_,__)_ fp_truth(vars[0]) ? vars[2] : Value_t(fp_and(vars[1],vars[2])) __
+#define  T268(_,__)_ fp_truth(vars[0]) ? vars[2] : Value_t(fp_or(vars[1],vars[2])) __
+#define  T312(_,__)_ fp_truth(vars[0]+(fp_truth(c.l1) ? c.l4 : c.l4)) __
+#define  T279(_,__)_ fp_truth(vars[0]+c.l2)&&fp_truth(vars[0])&&fp_truth(vars[1]+c.l2) __
+#define  T105(_,__)_ fp_truth(vars[0]+c.l4) __
+#define  T273(_,__)_ fp_truth(vars[2]) ? (fp_truth(vars[3]) ? vars[0] : vars[1]) : (fp_truth(vars[1]) ? vars[0] : vars[1]) __
+#define  T274(_,__)_ fp_truth(vars[2]) ? (fp_truth(vars[3]) ? vars[0] : vars[1]) : (fp_truth(vars[1]) ? vars[1] : vars[0]) __
+#define T3734(_,__)_ r2d(MpfrFloat::acos(vars[0])) __
+#define T3732(_,__)_ r2d(MpfrFloat::acosh(vars[0])) __
+#define T3738(_,__)_ r2d(MpfrFloat::asin(vars[0])) __
+#define T3736(_,__)_ r2d(MpfrFloat::asinh(vars[0])) __
+#define T3743(_,__)_ r2d(MpfrFloat::atan(vars[0])) __
+#define T3740(_,__)_ r2d(MpfrFloat::atan2(vars[0],vars[1])) __
+#define  T423(_,__)_ r2d(fp_acos(c.l0_7))+vars[0] __
+#define  T490(_,__)_ r2d(fp_acos(vars[0]))*c.l2 __
+#define  T425(_,__)_ r2d(fp_acosh(c.l1_1))+vars[0] __
+#define  T431(_,__)_ r2d(fp_asin(c.l0_7))+vars[0] __
+#define  T433(_,__)_ r2d(fp_asinh(c.l1_1))+vars[0] __
+#define  T440(_,__)_ r2d(fp_atan(c.l1_1))+vars[0] __
+#define  T438(_,__)_ r2d(fp_atan2(c.l5,c.l4))+vars[0] __
+#define  T361(_,__)_ r2d(std::acos(vars[0])) __
+#define  T365(_,__)_ r2d(std::asin(vars[0])) __
+#define  T371(_,__)_ r2d(std::atan(vars[0])) __
+#define  T370(_,__)_ r2d(std::atan2(vars[0],vars[1])) __
+#define  T363(_,__)_ r2d(std::log(vars[0] + std::sqrt(vars[0]*vars[0] - c.l1))) __
+#define  T367(_,__)_ r2d(std::log(vars[0] + std::sqrt(vars[0]*vars[0]+c.l1))) __
+#define  T395(_,__)_ r2d(vars[1])+r2d(vars[2])+r2d(vars[3])+r2d(vars[0]) __
+#define  T359(_,__)_ std::abs(vars[0]) __
+#define  T384(_,__)_ std::abs(vars[0]) >= c.l0_5 ? vars[1] : vars[2] __
+#define  T360(_,__)_ std::acos(vars[0]) __
+#define T3778(_,__)_ std::arg(vars[0]) __
+#define  T364(_,__)_ std::asin(vars[0]) __
+#define  T368(_,__)_ std::atan(vars[0]) __
+#define  T411(_,__)_ std::atan2(vars[0]*c.l0,c.lm1) __
+#define  T369(_,__)_ std::atan2(vars[0],vars[1]) __
+#define  T374(_,__)_ std::ceil(vars[0]) __
+#define T3779(_,__)_ std::conj(vars[0]) __
+#define  T376(_,__)_ std::cos(d2r(vars[0])) __
+#define  T375(_,__)_ std::cos(vars[0]) __
+#define  T378(_,__)_ std::cosh(d2r(vars[0])) __
+#define  T377(_,__)_ std::cosh(vars[0]) __
+#define  T380(_,__)_ std::exp(vars[0]) __
+#define  T409(_,__)_ std::exp(vars[0]*c.l0+c.l1) __
+#define  T381(_,__)_ std::exp(vars[0]*fp_const_log2<Value_t>()) __
+#define  T382(_,__)_ std::floor(vars[0]) __
+#define  T352(_,__)_ std::fmod(vars[0],vars[1]) __
+#define  T372(_,__)_ std::log( (c.l1+vars[0]) / (c.l1-vars[0]) ) * c.l0_5 __
+#define  T362(_,__)_ std::log(vars[0] + std::sqrt(vars[0]*vars[0] - c.l1)) __
+#define  T366(_,__)_ std::log(vars[0] + std::sqrt(vars[0]*vars[0]+c.l1)) __
+#define T3781(_,__)_ std::log(vars[0]) __
+#define  T386(_,__)_ std::log(vars[0]) __
+#define  T388(_,__)_ std::log(vars[0]) / std::log(c.l10) __
+#define  T387(_,__)_ std::log(vars[0]) / std::log(c.l2) __
+#define  T410(_,__)_ std::log(vars[0]*c.l0+c.l10) __
+#define T3772(_,__)_ std::log(vars[0]*c.l0+c.l2) __
+#define  T393(_,__)_ std::pow(-vars[0]*c.l0_25,vars[1]) __
+#define  T394(_,__)_ std::pow(vars[0],vars[1]) __
+#define  T397(_,__)_ std::sin(d2r(vars[0])) __
+#define  T396(_,__)_ std::sin(vars[0]) __
+#define  T399(_,__)_ std::sinh(d2r(vars[0])) __
+#define  T398(_,__)_ std::sinh(vars[0]) __
+#define T3784(_,__)_ std::sqrt(vars[0]) __
+#define  T400(_,__)_ std::sqrt(vars[0]) __
+#define  T383(_,__)_ std::sqrt(vars[0]*vars[0] + vars[1]*vars[1]) __
+#define  T402(_,__)_ std::tan(d2r(vars[0])) __
+#define  T401(_,__)_ std::tan(vars[0]) __
+#define  T404(_,__)_ std::tanh(d2r(vars[0])) __
+#define  T403(_,__)_ std::tanh(vars[0]) __
+#define  T327(_,__)_ userDefFuncSqr<Value_t>((uparam[0]=(vars[0]), uparam+0))+userDefFuncSub<Value_t>((uparam[1]=(vars[0]), uparam[2]=(vars[1]), uparam+1))+userDefFuncSqr<Value_t>((uparam[3]=(vars[1]), uparam+3))+userDefFuncSub<Value_t>((uparam[4]=(vars[1]+c.l1), uparam[5]=(vars[0]-c.l2), uparam+4))-c.l1 __
+#define  T330(_,__)_ userDefFuncSqr<Value_t>((uparam[0]=(vars[0]), uparam+0))+userDefFuncValue<Value_t>((uparam[1]=(Value_t()), uparam+1))-c.l5 __
+#define  T153(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l4 : c.l0)))), uparam[1]=(Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),((fp_truth(c.l1) ? c.l1 : c.l0)-c.l1)))), uparam+0)) __
+#define   T28(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),c.l4))), uparam[1]=(Value_t(fp_greaterOrEq(Value_t(fp_abs(vars[0])),c.l0))), uparam+0)) __
+#define  T154(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_less(Value_t(fp_abs(vars[0])),(fp_truth(c.l1) ? c.l4 : c.l0)))), uparam[1]=(Value_t(fp_less(Value_t(fp_abs(vars[0])),((fp_truth(c.l1) ? c.l1 : c.l0)-c.l1)))), uparam+0)) __
+#define   T62(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_less(Value_t(fp_abs(vars[0])),c.l0))), uparam[1]=(Value_t(fp_less(vars[0],c.l0))), uparam+0)) __
+#define   T29(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_less(Value_t(fp_abs(vars[0])),c.l4))), uparam[1]=(Value_t(fp_less(Value_t(fp_abs(vars[0])),c.l0))), uparam+0)) __
+#define  T315(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_not(vars[0])&&fp_truth(vars[0]))), uparam[1]=(Value_t(fp_not(vars[0])||fp_truth(vars[0]))), uparam+0)) __
+#define  T317(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_not(vars[0]+c.l4))), uparam[1]=(Value_t(fp_truth(vars[0]+c.l3))), uparam+0)) __
+#define  T316(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(Value_t(fp_not(vars[0]-vars[1]))), uparam[1]=(Value_t(fp_truth(vars[0]-vars[1]))), uparam+0)) __
+#define   T52(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(fp_min(fp_min(vars[1],vars[0]),vars[0])), uparam[1]=(fp_max(fp_max(vars[1],vars[0]),vars[0])), uparam+0)) __
+#define   T50(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(fp_min(vars[0],vars[0])), uparam[1]=(fp_max(vars[0],vars[0])), uparam+0)) __
+#define  T602(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(fp_sin(vars[0])), uparam[1]=(fp_sin(vars[0])), uparam+0)) __
+#define T3626(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(fp_sin(vars[0])+fp_inv(fp_sin(vars[0]))), uparam[1]=(fp_cos(vars[0])), uparam+0)) __
+#define  T106(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(vars[0]), uparam[1]=(vars[0]), uparam+0)) __
+#define  T321(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(vars[0]), uparam[1]=(vars[1]), uparam+0))*c.l0 __
+#define  T320(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(vars[0]), uparam[1]=(vars[1]), uparam+0))*c.l0 __
+#define   T51(_,__)_ userDefFuncSub<Value_t>((uparam[0]=(vars[0]+fp_min(vars[0],vars[0])), uparam[1]=(vars[0]+fp_max(vars[0],vars[0])), uparam+0)) __
+#define  T407(_,__)_ userDefFuncValue<Value_t>((uparam[0]=(Value_t()), uparam+0))+vars[0]*c.l5+userDefFuncSqr<Value_t>((uparam[1]=(vars[1]), uparam+1))+c.l8*userDefFuncSub<Value_t>((uparam[2]=(vars[1]), uparam[3]=(vars[2]), uparam+2))+c.l77*userDefFuncSqr<Value_t>((uparam[4]=(vars[3]), uparam+4))+c.l30*userDefFuncSub<Value_t>((uparam[5]=(vars[1]), uparam[6]=(vars[2]), uparam+5)) __
+#define  T408(_,__)_ userDefFuncValue<Value_t>((uparam[0]=(Value_t()), uparam+0))+vars[0]*c.l5+userDefFuncSqr<Value_t>((uparam[1]=(vars[1]), uparam+1))+c.l8*userDefFuncSub<Value_t>((uparam[2]=(vars[1]), uparam[3]=(vars[2]), uparam+2))+c.l77*userDefFuncSqr<Value_t>((uparam[4]=(vars[3]), uparam+4))+c.l30*userDefFuncSub<Value_t>((uparam[5]=(vars[1]), uparam[6]=(vars[2]), uparam+5)) __
+#define   T76(_,__)_ vars[0] __
+#define    T2(_,__)_ vars[0] != c.l0 ? vars[1] != c.l0 : c.l0 __
+#define   T17(_,__)_ vars[0] == c.l0 ? vars[1] != c.l0 : c.l1 __
+#define    T8(_,__)_ vars[0]!=vars[1] __
+#define  T348(_,__)_ vars[0]!=vars[1] __
+#define   T12(_,__)_ vars[0]%(vars[1]+c.l3) __
+#define T3729(_,__)_ vars[0]%vars[1] __
+#define   T94(_,__)_ vars[0]*(-vars[0]) __
+#define   T13(_,__)_ vars[0]*(vars[1]+c.l4) __
+#define   T67(_,__)_ vars[0]*c.l1+vars[0] __
+#define  T270(_,__)_ vars[0]*c.l10*(fp_less(vars[0],c.l4) ? c.l3 : c.l4) __
+#define   T68(_,__)_ vars[0]*c.l2 __
+#define T3664(_,__)_ vars[0]*c.l3+vars[0]*vars[1]+vars[0]*vars[2]+vars[0]*fp_sin(vars[1]*vars[2])-(fp_sin(vars[0])+fp_cos(vars[1]))*c.l4+(fp_sin(vars[0])+fp_cos(vars[1]))*vars[0]+(fp_sin(vars[0])+fp_cos(vars[1]))*vars[1]+(fp_sin(vars[0])+fp_cos(vars[1]))*vars[2] __
+#define T3635(_,__)_ vars[0]*c.l4/c.l2 + (c.l1+(c.l2+c.l3)) + vars[0]*vars[0]+vars[0]+c.l1+c.l2+c.l3*c.l4+c.l5*c.l6*c.l7-c.l8*c.l9 __
+#define  T539(_,__)_ vars[0]*c.lm1 __
+#define  T494(_,__)_ vars[0]*fp_pow(vars[0],c.l3) __
+#define   T95(_,__)_ vars[0]*vars[0] __
+#define T3678(_,__)_ vars[0]*vars[0]+vars[1] + (vars[2]-vars[0]*vars[0]) + (vars[0]*vars[0]-vars[1]*vars[1]) + (vars[0]*vars[0]+vars[1]*vars[1]+vars[2]) + vars[0]*vars[1] + (vars[0]<vars[1] ? c.l1 : c.l2) + (vars[0]<vars[2] ? vars[1]*vars[1]-vars[0] : vars[0]*vars[0]+vars[2]) + vars[0]*vars[1]*vars[2] + (vars[0]*vars[1])*(vars[0]*vars[1]) __
+#define  T353(_,__)_ vars[0]*vars[1] __
+#define   T10(_,__)_ vars[0]*vars[1]*vars[0]*vars[0]/(vars[2]+c.l3)*(vars[0]+c.l4) __
+#define  T350(_,__)_ vars[0]*vars[1]*vars[0]*vars[0]/vars[2]*(vars[0]-c.l0_25) __
+#define T3777(_,__)_ vars[0]*vars[1]*vars[0]*vars[0]/vars[2]*(vars[0]-c.l0_25) __
+#define   T73(_,__)_ vars[0]+(-vars[1]) __
+#define T3672(_,__)_ vars[0]+(c.l1_0+c.l2_0+c.l3_0+c.l4_0-c.l5_0-c.l6_0-c.l7_0-c.l8_0)/c.l3_0+c.l4_0*(c.l1_0+fp_sin(c.l2_0)+fp_cos(c.l4_0*c.l5_0+c.l6_0)/c.l2_0)+fp_cos(c.l0_5)*fp_tan(c.l0_6+c.l0_2)-c.l1_1/fp_log(c.l2_1)*fp_sqrt(c.l3_3)+fp_pow(c.l2,c.l3) __
+#define   T53(_,__)_ vars[0]+(vars[0]*c.l4) __
+#define  T103(_,__)_ vars[0]+(vars[0]-vars[0])+vars[0]+(c.l1-vars[0]+vars[0]) __
+#define   T32(_,__)_ vars[0]+c.l0+vars[0] __
+#define T3785(_,__)_ vars[0]+c.l1 __
+#define  T269(_,__)_ vars[0]+c.l10+(fp_less(vars[0],c.l4) ? c.l3 : c.l4) __
+#define  T313(_,__)_ vars[0]+fp_max(c.l0,fp_min(c.lm2,c.l0)) __
+#define  T518(_,__)_ vars[0]+userDefFuncSub<Value_t>((uparam[0]=(userDefFuncSub<Value_t>((uparam[1]=(userDefFuncSub<Value_t>((uparam[2]=(userDefFuncSub<Value_t>((uparam[3]=(userDefFuncSub<Value_t>((uparam[4]=(fp_int(c.l1_1)), uparam[5]=(fp_int(c.l1_6)), uparam+4))), uparam[6]=(fp_int(c.l1_5)), uparam+3))), uparam[7]=(fp_int(c.lm1_1)), uparam+2))), uparam[8]=(fp_int(c.lm1_6)), uparam+1))), uparam[9]=(fp_int(c.lm1_5)), uparam+0)) __
+#define   T48(_,__)_ vars[0]+vars[0]/vars[0]+vars[0] __
+#define  T340(_,__)_ vars[0]+vars[1] __
+#define    T0(_,__)_ vars[0]+vars[1] __
+#define    T1(_,__)_ vars[0]+vars[1]+vars[0]+vars[0]-vars[2]+vars[0] __
+#define  T341(_,__)_ vars[0]+vars[1]+vars[0]+vars[0]-vars[2]+vars[0] __
+#define   T79(_,__)_ vars[0]-(-vars[1]) __
+#define T3657(_,__)_ vars[0]-(vars[1]*(vars[1]*(vars[1]*c.lm1))*c.l1)+fp_log(vars[0]*fp_pow(fp_exp(c.l1_0),vars[1]))-fp_log(fp_pow(vars[0],vars[1]))+fp_pow(fp_exp(c.l1_0),fp_log(vars[0]+c.l6))+fp_pow(c.l10,(fp_log(vars[0]+c.l6)/fp_log(vars[1]+c.l6)*fp_log(vars[2]+c.l6)/fp_log(c.l10)))-fp_pow(fp_exp(c.l1_0),(fp_log(vars[0]+c.l6)*vars[1]))-fp_pow(c.l5,(fp_log(vars[0]+c.l7)/fp_log(c.l5)))+fp_pow((vars[0]*vars[2]+c.l17),c.l3)*fp_pow((vars[0]*vars[2]+c.l17),c.l2)/fp_pow((vars[0]*vars[2]+c.l17),c.l4) __
+#define  T102(_,__)_ vars[0]-c.l0+vars[0] __
+#define   T60(_,__)_ vars[0]-c.l5 __
+#define  T358(_,__)_ vars[0]-vars[1] __
+#define   T18(_,__)_ vars[0]-vars[1] __
+#define  T332(_,__)_ vars[0]-vars[1]*c.l1 __
+#define T3656(_,__)_ vars[0]-vars[1]*c.l1+fp_mod(vars[0],vars[1])+vars[0]/fp_pow(vars[1],c.l1_1)+fp_pow(c.l2,c.l3)+fp_mod(c.l5,c.l3)+fp_pow(vars[0],fp_pow(vars[1],c.l0))+fp_pow(vars[0],c.l0_5) __
+#define  T333(_,__)_ vars[0]-vars[1]+vars[2]*vars[0] __
+#define T3780(_,__)_ vars[0].imag() __
+#define T3783(_,__)_ vars[0].real() __
+#define    T9(_,__)_ vars[0]/(vars[1]+c.l3) __
+#define   T47(_,__)_ vars[0]/c.l1+vars[0] __
+#define   T71(_,__)_ vars[0]/c.l4+vars[0] __
+#define  T500(_,__)_ vars[0]/fp_exp(vars[1]) __
+#define  T497(_,__)_ vars[0]/fp_exp2(vars[1]) __
+#define  T551(_,__)_ vars[0]/fp_pow(vars[0],vars[1]) __
+#define T3680(_,__)_ vars[0]/fp_sin(vars[1])+vars[0]/fp_cos(vars[1])+vars[0]/fp_tan(vars[1])+vars[0]/fp_inv(fp_sin(vars[1]))+vars[0]/fp_inv(fp_cos(vars[1]))+vars[0]/fp_inv(fp_tan(vars[1]))+fp_inv(fp_sin(vars[1]))+fp_inv(fp_cos(vars[1]))+fp_inv(fp_tan(vars[1]))+fp_inv(fp_inv(fp_sin(vars[1])))+fp_inv(fp_inv(fp_cos(vars[1])))+fp_inv(fp_inv(fp_tan(vars[1]))) __
+#define    T6(_,__)_ vars[0]<=vars[1] __
+#define  T346(_,__)_ vars[0]<=vars[1] __
+#define  T373(_,__)_ vars[0]<c.l0 ? -std::exp(std::log(-vars[0]) / c.l3) : (vars[0]>c.l0 ? std::exp(std::log(vars[0]) / c.l3) : c.l0) __
+#define   T19(_,__)_ vars[0]<c.l0 ? -vars[0] : vars[0] __
+#define  T406(_,__)_ vars[0]<c.l0 ? std::ceil(vars[0]) : std::floor(vars[0]) __
+#define  T347(_,__)_ vars[0]<vars[1] __
+#define    T7(_,__)_ vars[0]<vars[1] __
+#define   T22(_,__)_ vars[0]<vars[1] ? vars[0] : vars[1] __
+#define    T3(_,__)_ vars[0]==vars[1] __
+#define  T343(_,__)_ vars[0]==vars[1] __
+#define  T344(_,__)_ vars[0]>=vars[1] __
+#define    T4(_,__)_ vars[0]>=vars[1] __
+#define    T5(_,__)_ vars[0]>vars[1] __
+#define  T345(_,__)_ vars[0]>vars[1] __
+#define   T21(_,__)_ vars[0]>vars[1] ? vars[0] : vars[1] __
+#define  T138(_,__)_ vars[1]*(c.l7/-vars[0]) __
+#define   T69(_,__)_ vars[1]*(vars[0]*c.l2)*c.l2+(vars[1]*c.l2)*c.l2 __
+#define  T493(_,__)_ vars[1]*(vars[0]+vars[0])*c.l0_5 __
+#define  T492(_,__)_ vars[1]*(vars[0]+vars[0])*c.l7 __
+#define   T96(_,__)_ vars[1]*-vars[0]*vars[0] __
+#define  T107(_,__)_ vars[1]*fp_abs(vars[0])*fp_abs(vars[0]) __
+#define   T61(_,__)_ vars[1]*fp_inv(vars[0]) __
+#define   T97(_,__)_ vars[1]*vars[0]*-vars[0] __
+#define   T98(_,__)_ vars[1]*vars[0]*vars[0] __
+#define  T126(_,__)_ vars[1]+(Value_t(fp_abs(vars[0]))+c.l5) __
+#define  T127(_,__)_ vars[1]-(Value_t(fp_abs(vars[0]))+c.l5) __
+#define  T523(_,__)_ vars[1]/fp_inv(vars[0]) __
+#define  T339(_,__)_ vars[2]+vars[3]*vars[1]-vars[0] __
+
+    #define Zl Value_t{}
+    #define FP_LIST_ALL_CONST(o1,o2,o4,o8,o16,o32,o64,o128,o256) \
+ o1(   lm0_9,   -0.9) o2(   lm0_9,   -0.9) o4(   lm0_9,   -0.9) \
+ o1(    lm16,    -16) o2(    lm16,    -16) o4(    lm16,    -16) o8(    lm16,    -16) \
+ o1(     lm8,     -8) o2(     lm8,     -8) o4(     lm8,     -8) o32(     lm8,     -8) o64(     lm8,     -8) o128(     lm8,     -8) o256(     lm8,     -8) \
+ o1(      l0,      0) o2(      l0,      0) o4(      l0,      0) o8(      l0,      0) o16(      l0,      0) o32(      l0,      0) o64(      l0,      0) o128(      l0,      0) o256(      l0,      0) \
+ o8(     l14,     14) o16(     l14,     14) \
+ o1(   lm0_3,   -0.3) o2(   lm0_3,   -0.3) o4(   lm0_3,   -0.3) \
+ o1(    l0_5,    0.5) o2(    l0_5,    0.5) o4(    l0_5,    0.5) o32(    l0_5,    0.5) o64(    l0_5,    0.5) o128(    l0_5,    0.5) o256(    l0_5,    0.5) \
+ o1(   lm5_1,   -5.1) o2(   lm5_1,   -5.1) o4(   lm5_1,   -5.1) o32(   lm5_1,   -5.1) o64(   lm5_1,   -5.1) o128(   lm5_1,   -5.1) o256(   lm5_1,   -5.1) \
+ o1(  l1_061,  1.061) o2(  l1_061,  1.061) o4(  l1_061,  1.061) \
+ o1(   l2000,   2000) o2(   l2000,   2000) o4(   l2000,   2000) o8(   l2000,   2000) o16(   l2000,   2000) o32(   l2000,   2000) \
+ o1(  l10000,  10000) o2(  l10000,  10000) o4(  l10000,  10000) o8(  l10000,  10000) o16(  l10000,  10000) o32(  l10000,  10000) o64(  l10000,  10000) o128(  l10000,  10000) o256(  l10000,  10000) \
+ o1(   lm0_2,   -0.2) o2(   lm0_2,   -0.2) o4(   lm0_2,   -0.2) o32(   lm0_2,   -0.2) o64(   lm0_2,   -0.2) o128(   lm0_2,   -0.2) o256(   lm0_2,   -0.2) \
+ o1(      l4,      4) o2(      l4,      4) o4(      l4,      4) o8(      l4,      4) o16(      l4,      4) o32(      l4,      4) o64(      l4,      4) o128(      l4,      4) o256(      l4,      4) \
+ o1(     l15,     15) o4(     l15,     15) o32(     l15,     15) \
+ o1(     l40,     40) o2(     l40,     40) o4(     l40,     40) o8(     l40,     40) o16(     l40,     40) o32(     l40,     40) \
+ o1(    l1_0,    1.0) o2(    l1_0,    1.0) o4(    l1_0,    1.0) o32(    l1_0,    1.0) \
+ o1(   lm7_1,   -7.1) o2(   lm7_1,   -7.1) o4(   lm7_1,   -7.1) o32(   lm7_1,   -7.1) o64(   lm7_1,   -7.1) o128(   lm7_1,   -7.1) o256(   lm7_1,   -7.1) \
+ o1(  l5ep25,  5e+25) o2(  l5ep25,  5e+25) o4(  l5ep25,  5e+25) \
+ o1(      l1,      1) o2(      l1,      1) o4(      l1,      1) o8(      l1,      1) o16(      l1,      1) o32(      l1,      1) o64(      l1,      1) o128(      l1,      1) o256(      l1,      1) \
+ o1(     l17,     17) o4(     l17,     17) o32(     l17,     17) \
+ o8(    l103,    103) o16(    l103,    103) \
+ o1(    l1_5,    1.5) o2(    l1_5,    1.5) o4(    l1_5,    1.5) o32(    l1_5,    1.5) o64(    l1_5,    1.5) o128(    l1_5,    1.5) o256(    l1_5,    1.5) \
+ o1(   lm0_5,   -0.5) o2(   lm0_5,   -0.5) o4(   lm0_5,   -0.5) o32(   lm0_5,   -0.5) \
+ o1(   lm1_1,   -1.1) o2(   lm1_1,   -1.1) o4(   lm1_1,   -1.1) o32(   lm1_1,   -1.1) o64(   lm1_1,   -1.1) o128(   lm1_1,   -1.1) o256(   lm1_1,   -1.1) \
+ o1(     l_5,     .5) o2(     l_5,     .5) o4(     l_5,     .5) o32(     l_5,     .5) \
+ o1( l100000, 100000) o2( l100000, 100000) o4( l100000, 100000) o8( l100000, 100000) o16( l100000, 100000) o32( l100000, 100000) o64( l100000, 100000) o128( l100000, 100000) o256( l100000, 100000) \
+ o1(    l1_1,    1.1) o2(    l1_1,    1.1) o4(    l1_1,    1.1) o32(    l1_1,    1.1) o64(    l1_1,    1.1) o128(    l1_1,    1.1) o256(    l1_1,    1.1) \
+ o1(    l4e2,    4e2) o2(    l4e2,    4e2) o4(    l4e2,    4e2) o32(    l4e2,    4e2) \
+ o1(      l5,      5) o2(      l5,      5) o4(      l5,      5) o8(      l5,      5) o16(      l5,      5) o32(      l5,      5) o64(      l5,      5) o128(      l5,      5) o256(      l5,      5) \
+ o1(     lm5,     -5) o2(     lm5,     -5) o4(     lm5,     -5) o8(     lm5,     -5) o16(     lm5,     -5) o32(     lm5,     -5) o64(     lm5,     -5) o128(     lm5,     -5) o256(     lm5,     -5) \
+ o1(     l64,     64) o2(     l64,     64) o4(     l64,     64) o8(     l64,     64) o16(     l64,     64) o32(     l64,     64) \
+ o1(     l10,     10) o2(     l10,     10) o4(     l10,     10) o8(     l10,     10) o16(     l10,     10) o32(     l10,     10) o64(     l10,     10) o128(     l10,     10) o256(     l10,     10) \
+ o1(   lm0_4,   -0.4) o2(   lm0_4,   -0.4) o4(   lm0_4,   -0.4) o64(   lm0_4,   -0.4) o128(   lm0_4,   -0.4) o256(   lm0_4,   -0.4) \
+ o8(     l31,     31) o16(     l31,     31) \
+ o1(    l3_5,    3.5) o4(    l3_5,    3.5) o32(    l3_5,    3.5) \
+ o1(   l1000,   1000) o2(   l1000,   1000) o4(   l1000,   1000) o8(   l1000,   1000) o16(   l1000,   1000) o32(   l1000,   1000) o64(   l1000,   1000) o128(   l1000,   1000) o256(   l1000,   1000) \
+ o1(    l2_5,    2.5) o2(    l2_5,    2.5) o4(    l2_5,    2.5) o32(    l2_5,    2.5) \
+ o1(     lm1,     -1) o2(     lm1,     -1) o4(     lm1,     -1) o8(     lm1,     -1) o16(     lm1,     -1) o32(     lm1,     -1) o64(     lm1,     -1) o128(     lm1,     -1) o256(     lm1,     -1) \
+ o1(     l30,     30) o2(     l30,     30) o4(     l30,     30) o8(     l30,     30) o16(     l30,     30) o32(     l30,     30) \
+ o1(    l5_1,    5.1) o2(    l5_1,    5.1) o4(    l5_1,    5.1) o32(    l5_1,    5.1) o64(    l5_1,    5.1) o128(    l5_1,    5.1) o256(    l5_1,    5.1) \
+ o1(l10000000,10000000) o2(l10000000,10000000) o4(l10000000,10000000) o8(l10000000,10000000) o16(l10000000,10000000) o32(l10000000,10000000) o64(l10000000,10000000) o128(l10000000,10000000) o256(l10000000,10000000) \
+ o1(    l0_4,    0.4) o2(    l0_4,    0.4) o4(    l0_4,    0.4) o32(    l0_4,    0.4) \
+ o1(    l5_0,    5.0) o2(    l5_0,    5.0) o4(    l5_0,    5.0) o32(    l5_0,    5.0) \
+ o1(   lm2_7,   -2.7) o2(   lm2_7,   -2.7) o4(   lm2_7,   -2.7) o32(   lm2_7,   -2.7) o64(   lm2_7,   -2.7) o128(   lm2_7,   -2.7) o256(   lm2_7,   -2.7) \
+ o1(     l11,     11) o2(     l11,     11) o4(     l11,     11) o8(     l11,     11) o16(     l11,     11) o32(     l11,     11) \
+ o8(     l12,     12) o16(     l12,     12) \
+ o8(     l13,     13) o16(     l13,     13) \
+ o1(     lm4,     -4) o2(     lm4,     -4) o4(     lm4,     -4) o8(     lm4,     -4) o16(     lm4,     -4) o32(     lm4,     -4) o64(     lm4,     -4) o128(     lm4,     -4) o256(     lm4,     -4) \
+ o1( l5_0625, 5.0625) o2( l5_0625, 5.0625) o4( l5_0625, 5.0625) o32( l5_0625, 5.0625) o64( l5_0625, 5.0625) o128( l5_0625, 5.0625) o256( l5_0625, 5.0625) \
+ o1(    l0_0,    0.0) o2(    l0_0,    0.0) o4(    l0_0,    0.0) o32(    l0_0,    0.0) \
+ o1(      l2,      2) o2(      l2,      2) o4(      l2,      2) o8(      l2,      2) o16(      l2,      2) o32(      l2,      2) o64(      l2,      2) o128(      l2,      2) o256(      l2,      2) \
+ o1(      l3,      3) o2(      l3,      3) o4(      l3,      3) o8(      l3,      3) o16(      l3,      3) o32(      l3,      3) o64(      l3,      3) o128(      l3,      3) o256(      l3,      3) \
+ o1(     l25,     25) o2(     l25,     25) o4(     l25,     25) o32(     l25,     25) o64(     l25,     25) o128(     l25,     25) o256(     l25,     25) \
+ o1(      l9,      9) o2(      l9,      9) o4(      l9,      9) o8(      l9,      9) o16(      l9,      9) o32(      l9,      9) \
+ o1(   l38_5,   38.5) \
+ o1(     l77,     77) o2(     l77,     77) o4(     l77,     77) o32(     l77,     77) \
+ o1(     l20,     20) o2(     l20,     20) o4(     l20,     20) o8(     l20,     20) o16(     l20,     20) o32(     l20,     20) \
+ o1(      l6,      6) o2(      l6,      6) o4(      l6,      6) o8(      l6,      6) o16(      l6,      6) o32(      l6,      6) o64(      l6,      6) o128(      l6,      6) o256(      l6,      6) \
+ o8(    l102,    102) o16(    l102,    102) \
+ o1(    l1_7,    1.7) o2(    l1_7,    1.7) o4(    l1_7,    1.7) o32(    l1_7,    1.7) \
+ o1(    l256,    256) o2(    l256,    256) o4(    l256,    256) o8(    l256,    256) o16(    l256,    256) o32(    l256,    256) \
+ o1(    l512,    512) o2(    l512,    512) o4(    l512,    512) o8(    l512,    512) o16(    l512,    512) o32(    l512,    512) \
+ o1(     lm2,     -2) o2(     lm2,     -2) o4(     lm2,     -2) o8(     lm2,     -2) o16(     lm2,     -2) o32(     lm2,     -2) o64(     lm2,     -2) o128(     lm2,     -2) o256(     lm2,     -2) \
+ o1(      l7,      7) o2(      l7,      7) o4(      l7,      7) o8(      l7,      7) o16(      l7,      7) o32(      l7,      7) o64(      l7,      7) o128(      l7,      7) o256(      l7,      7) \
+ o1(    l200,    200) o2(    l200,    200) o4(    l200,    200) o8(    l200,    200) o16(    l200,    200) o32(    l200,    200) \
+ o1(   l1_25,   1.25) o2(   l1_25,   1.25) o4(   l1_25,   1.25) o32(   l1_25,   1.25) \
+ o1(    l7_1,    7.1) o2(    l7_1,    7.1) o4(    l7_1,    7.1) o32(    l7_1,    7.1) \
+ o1(    l0_2,    0.2) o2(    l0_2,    0.2) o4(    l0_2,    0.2) o32(    l0_2,    0.2) o64(    l0_2,    0.2) o128(    l0_2,    0.2) o256(    l0_2,    0.2) \
+ o64(   lm0_6,   -0.6) o128(   lm0_6,   -0.6) o256(   lm0_6,   -0.6) \
+ o1(    l128,    128) o2(    l128,    128) o4(    l128,    128) o8(    l128,    128) o16(    l128,    128) o32(    l128,    128) \
+ o1(    l100,    100) o2(    l100,    100) o4(    l100,    100) o8(    l100,    100) o16(    l100,    100) o32(    l100,    100) o64(    l100,    100) o128(    l100,    100) o256(    l100,    100) \
+ o1(    l3_3,    3.3) o2(    l3_3,    3.3) o4(    l3_3,    3.3) o32(    l3_3,    3.3) \
+ o1(    l1_4,    1.4) o2(    l1_4,    1.4) o4(    l1_4,    1.4) o32(    l1_4,    1.4) \
+ o1(   l2_25,   2.25) o2(   l2_25,   2.25) o4(   l2_25,   2.25) o32(   l2_25,   2.25) \
+ o1(    l1_2,    1.2) o2(    l1_2,    1.2) o4(    l1_2,    1.2) o32(    l1_2,    1.2) o64(    l1_2,    1.2) o128(    l1_2,    1.2) o256(    l1_2,    1.2) \
+ o1(    l0_7,    0.7) o2(    l0_7,    0.7) o4(    l0_7,    0.7) o32(    l0_7,    0.7) \
+ o1(   l0_25,   0.25) o2(   l0_25,   0.25) o4(   l0_25,   0.25) o32(   l0_25,   0.25) o64(   l0_25,   0.25) o128(   l0_25,   0.25) o256(   l0_25,   0.25) \
+ o1(   lm0_7,   -0.7) o2(   lm0_7,   -0.7) o4(   lm0_7,   -0.7) \
+ o1(    l0_3,    0.3) o2(    l0_3,    0.3) o4(    l0_3,    0.3) \
+ o1( l0x0010, 0x0010) o2( l0x0010, 0x0010) o4( l0x0010, 0x0010) o8( l0x0010, 0x0010) o16( l0x0010, 0x0010) o32( l0x0010, 0x0010) o64( l0x0010, 0x0010) o128( l0x0010, 0x0010) o256( l0x0010, 0x0010) \
+ o1( l0x0002, 0x0002) o2( l0x0002, 0x0002) o4( l0x0002, 0x0002) o8( l0x0002, 0x0002) o16( l0x0002, 0x0002) o32( l0x0002, 0x0002) o64( l0x0002, 0x0002) o128( l0x0002, 0x0002) o256( l0x0002, 0x0002) \
+ o1( l0x0020, 0x0020) o2( l0x0020, 0x0020) o4( l0x0020, 0x0020) o8( l0x0020, 0x0020) o16( l0x0020, 0x0020) o32( l0x0020, 0x0020) o64( l0x0020, 0x0020) o128( l0x0020, 0x0020) o256( l0x0020, 0x0020) \
+ o1(    l2_4,    2.4) o2(    l2_4,    2.4) o4(    l2_4,    2.4) o32(    l2_4,    2.4) \
+ o1( l0x0004, 0x0004) o2( l0x0004, 0x0004) o4( l0x0004, 0x0004) o8( l0x0004, 0x0004) o16( l0x0004, 0x0004) o32( l0x0004, 0x0004) o64( l0x0004, 0x0004) o128( l0x0004, 0x0004) o256( l0x0004, 0x0004) \
+ o1(  l2_051,  2.051) o2(  l2_051,  2.051) o4(  l2_051,  2.051) \
+ o1(      l8,      8) o2(      l8,      8) o4(      l8,      8) o8(      l8,      8) o16(      l8,      8) o32(      l8,      8) o64(      l8,      8) o128(      l8,      8) o256(      l8,      8) \
+ o1(   lm125,   -125) o2(   lm125,   -125) o4(   lm125,   -125) o32(   lm125,   -125) o64(   lm125,   -125) o128(   lm125,   -125) o256(   lm125,   -125) \
+ o1( l0_0625, 0.0625) o2( l0_0625, 0.0625) o4( l0_0625, 0.0625) o32( l0_0625, 0.0625) o64( l0_0625, 0.0625) o128( l0_0625, 0.0625) o256( l0_0625, 0.0625) \
+ o1(lm0_015625,-0.015625) o2(lm0_015625,-0.015625) o4(lm0_015625,-0.015625) o32(lm0_015625,-0.015625) o64(lm0_015625,-0.015625) o128(lm0_015625,-0.015625) o256(lm0_015625,-0.015625) \
+ o1(    l2_7,    2.7) o2(    l2_7,    2.7) o4(    l2_7,    2.7) o32(    l2_7,    2.7) o64(    l2_7,    2.7) o128(    l2_7,    2.7) o256(    l2_7,    2.7) \
+ o1(    l_25,    .25) o2(    l_25,    .25) o4(    l_25,    .25) o32(    l_25,    .25) \
+ o1(    l0_8,    0.8) o2(    l0_8,    0.8) o4(    l0_8,    0.8) o32(    l0_8,    0.8) \
+ o1(l1000000,1000000) o2(l1000000,1000000) o4(l1000000,1000000) o8(l1000000,1000000) o16(l1000000,1000000) o32(l1000000,1000000) o64(l1000000,1000000) o128(l1000000,1000000) o256(l1000000,1000000) \
+ o1(     l50,     50) o2(     l50,     50) o4(     l50,     50) o8(     l50,     50) o32(     l50,     50) o256(     l50,     50) \
+ o1(    l3_1,    3.1) o2(    l3_1,    3.1) o4(    l3_1,    3.1) o32(    l3_1,    3.1) \
+ o1(   l1506,   1506) o2(   l1506,   1506) o4(   l1506,   1506) \
+ o1(     l32,     32) o2(     l32,     32) o4(     l32,     32) o8(     l32,     32) o16(     l32,     32) o32(     l32,     32) \
+ o1(    l180,    180) o2(    l180,    180) o4(    l180,    180) o32(    l180,    180) \
+ o1(   lm1_0,   -1.0) o2(   lm1_0,   -1.0) o4(   lm1_0,   -1.0) o32(   lm1_0,   -1.0) \
+ o1(    l8_0,    8.0) o2(    l8_0,    8.0) o4(    l8_0,    8.0) o32(    l8_0,    8.0) \
+ o1(    l0_9,    0.9) o2(    l0_9,    0.9) o4(    l0_9,    0.9) \
+ o1(    l4_0,    4.0) o2(    l4_0,    4.0) o4(    l4_0,    4.0) o32(    l4_0,    4.0) \
+ o1(   lm1_6,   -1.6) o2(   lm1_6,   -1.6) o4(   lm1_6,   -1.6) o32(   lm1_6,   -1.6) \
+ o1(   lm6_1,   -6.1) o2(   lm6_1,   -6.1) o4(   lm6_1,   -6.1) \
+ o1(   l0_75,   0.75) o2(   l0_75,   0.75) o4(   l0_75,   0.75) \
+ o1( l0x0001, 0x0001) o2( l0x0001, 0x0001) o4( l0x0001, 0x0001) o8( l0x0001, 0x0001) o16( l0x0001, 0x0001) o32( l0x0001, 0x0001) o64( l0x0001, 0x0001) o128( l0x0001, 0x0001) o256( l0x0001, 0x0001) \
+ o1(    l1_8,    1.8) o2(    l1_8,    1.8) o4(    l1_8,    1.8) o32(    l1_8,    1.8) \
+ o1(    l2_1,    2.1) o2(    l2_1,    2.1) o4(    l2_1,    2.1) o32(    l2_1,    2.1) o64(    l2_1,    2.1) o128(    l2_1,    2.1) o256(    l2_1,    2.1) \
+ o1(    l1_6,    1.6) o2(    l1_6,    1.6) o4(    l1_6,    1.6) o32(    l1_6,    1.6) \
+ o1(    l120,    120) o2(    l120,    120) o4(    l120,    120) o32(    l120,    120) \
+ o1(l1_75e21,1.75e21) o2(l1_75e21,1.75e21) o4(l1_75e21,1.75e21) o32(l1_75e21,1.75e21) \
+ o1(    l7_5,    7.5) o2(    l7_5,    7.5) o4(    l7_5,    7.5) o32(    l7_5,    7.5) \
+ o1( lm2_051, -2.051) o2( lm2_051, -2.051) o4( lm2_051, -2.051) \
+ o1(    l0_1,    0.1) o2(    l0_1,    0.1) o4(    l0_1,    0.1) \
+ o1(    l4_1,    4.1) o2(    l4_1,    4.1) o4(    l4_1,    4.1) \
+ o1(    l6_1,    6.1) o2(    l6_1,    6.1) o4(    l6_1,    6.1) \
+ o1(    l2_0,    2.0) o2(    l2_0,    2.0) o4(    l2_0,    2.0) o32(    l2_0,    2.0) \
+ o1(    l3_0,    3.0) o2(    l3_0,    3.0) o4(    l3_0,    3.0) o32(    l3_0,    3.0) \
+ o1( l0x0008, 0x0008) o2( l0x0008, 0x0008) o4( l0x0008, 0x0008) o8( l0x0008, 0x0008) o16( l0x0008, 0x0008) o32( l0x0008, 0x0008) o64( l0x0008, 0x0008) o128( l0x0008, 0x0008) o256( l0x0008, 0x0008) \
+ o1(   l1_75,   1.75) o2(   l1_75,   1.75) o4(   l1_75,   1.75) o32(   l1_75,   1.75) \
+ o1(     lm3,     -3) o2(     lm3,     -3) o4(     lm3,     -3) o8(     lm3,     -3) o16(     lm3,     -3) o32(     lm3,     -3) o64(     lm3,     -3) o128(     lm3,     -3) o256(     lm3,     -3) \
+ o8(    l101,    101) o16(    l101,    101) \
+ o1(    l6_0,    6.0) o2(    l6_0,    6.0) o4(    l6_0,    6.0) o32(    l6_0,    6.0) \
+ o1(    l0_6,    0.6) o2(    l0_6,    0.6) o4(    l0_6,    0.6) o32(    l0_6,    0.6) o64(    l0_6,    0.6) o128(    l0_6,    0.6) o256(    l0_6,    0.6) \
+ o1(    l1_3,    1.3) o2(    l1_3,    1.3) o4(    l1_3,    1.3) o32(    l1_3,    1.3) \
+ o1(    l7_0,    7.0) o2(    l7_0,    7.0) o4(    l7_0,    7.0) o32(    l7_0,    7.0) \
+ o1(     l16,     16) o2(     l16,     16) o4(     l16,     16) o8(     l16,     16) o16(     l16,     16) o32(     l16,     16) \
+ o1(  lm0_25,  -0.25) o2(  lm0_25,  -0.25) o4(  lm0_25,  -0.25) o32(  lm0_25,  -0.25) \
+ o1(   lm1_5,   -1.5) o2(   lm1_5,   -1.5) o4(   lm1_5,   -1.5) o32(   lm1_5,   -1.5) \
+ o1( lm1_061, -1.061) o2( lm1_061, -1.061) o4( lm1_061, -1.061) \
+ o1(   l2402,   2402) \
+ o1(    l110,    110) o2(    l110,    110) o4(    l110,    110) o32(    l110,    110) \
+ o64(i, Value_t(0,1)+Z) \
+ o128(i, Value_t(0,1)+Z) \
+ o256(i, Value_t(0,1)+Z) \
+/* end of list */
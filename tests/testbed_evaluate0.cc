@@ -0,0 +1,674 @@
+#pragma GCC optimize   ("O0,no-ipa-pta,no-ivopts")
+
+#include "testbed_autogen.hh"
+#include "testbed_cpptest.hh"
+#include "testbed_const1.hh"
+#include "testbed_const2.hh"
+#include "testbed_const3.hh"
+#include "testbed_const4.hh"
+#include "testbed_const5.hh"
+#include "testbed_const6.hh"
+#include "testbed_const7.hh"
+#include "testbed_const8.hh"
+#include "testbed_const9.hh"
+
+#if 0
+template<typename Value_t, unsigned type_mask>
+Value_t evaluate_test(unsigned which, const Value_t* vars)
+{
+    static const_container<Value_t> c;
+
+    [[maybe_unused]] static thread_local Value_t uparam[10];
+
+    using namespace FUNCTIONPARSERTYPES;
+    switch(which)
+    {
+        #define M(n,m) T##n(case n:if constexpr(type_mask&m)return,;else break;)
+M(540,1)  M(567,1)  M(504,1)  M(499,1)  M(558,1)  M(588,1)  M(589,1)  M(603,1)  M(421,1)  M(420,1)  
+M(539,1)  M(406,1)  M(325,11) M(62,11)  M(58,15)  M(59,15)  M(56,15)  M(57,15)  M(37,15)  M(34,15)  
+M(38,15)  M(39,15)  M(35,15)  M(36,15)  M(55,15)  M(81,15)  M(103,15) M(3772,2) M(20,24)  M(338,24) 
+M(14,24)  M(337,24) M(16,24)  M(15,24)  M(336,24) M(11,24)  M(260,24) M(2,24)   M(17,24)  M(8,24)   
+M(12,24)  M(13,24)  M(10,24)  M(1,24)   M(0,24)   M(18,24)  M(9,24)   M(6,24)   M(19,24)  M(7,24)   
+M(3,24)   M(4,24)   M(5,24)   M(28,25)  M(29,25)  M(317,25) M(563,257)M(564,257)M(561,257)M(565,257)
+M(566,257)M(562,257)M(584,263)M(142,265)M(135,265)M(144,265)M(141,265)M(124,265)M(119,265)M(125,265)
+M(134,265)M(133,265)M(140,265)M(139,265)M(136,265)M(143,265)M(137,265)M(132,265)M(131,265)M(130,265)
+M(111,265)M(112,265)M(150,265)M(122,265)M(123,265)M(146,265)M(149,265)M(147,265)M(148,265)M(115,265)
+M(116,265)M(117,265)M(128,265)M(129,265)M(118,265)M(151,265)M(145,265)M(152,265)M(109,265)M(120,265)
+M(121,265)M(110,265)M(108,265)M(113,265)M(114,265)M(73,265) M(79,265) M(138,265)M(126,265)M(127,265)
+M(153,281)M(154,281)M(537,3)  M(538,3)  M(597,3)  M(596,3)  M(599,3)  M(598,3)  M(3627,3) M(542,3)  
+M(412,3)  M(543,3)  M(413,3)  M(532,3)  M(529,3)  M(516,3)  M(511,3)  M(3634,3) M(536,3)  M(525,3)  
+M(587,3)  M(586,3)  M(545,3)  M(546,3)  M(547,3)  M(548,3)  M(104,31) M(105,31) M(52,31)  M(50,31)  
+M(51,31)  M(78,319) M(72,319) M(68,319) M(95,319) M(3730,32)M(3733,32)M(3731,32)M(3737,32)M(3735,32)
+M(3742,32)M(3771,32)M(3739,32)M(3741,32)M(3744,32)M(3745,32)M(3749,32)M(3748,32)M(3747,32)M(3746,32)
+M(3751,32)M(3768,32)M(3750,32)M(3752,32)M(3753,32)M(3756,32)M(3770,32)M(3769,32)M(3755,32)M(3754,32)
+M(3757,32)M(3758,32)M(3762,32)M(3761,32)M(3760,32)M(3759,32)M(3763,32)M(3767,32)M(3766,32)M(3765,32)
+M(3764,32)M(3734,32)M(3732,32)M(3738,32)M(3736,32)M(3743,32)M(3740,32)M(3729,32)M(3650,37)M(3663,37)
+M(3661,37)M(3665,37)M(3659,37)M(3662,37)M(3664,37)M(3657,37)M(3784,384)M(3463,387)M(3591,387)M(418,39) 
+M(419,39) M(3638,39)M(3644,39)M(405,39) M(385,39) M(491,39) M(3651,39)M(3649,39)M(392,39) M(390,39) 
+M(2621,39)M(2622,39)M(2623,39)M(2624,39)M(2626,39)M(2627,39)M(2628,39)M(2629,39)M(2630,39)M(2631,39)
+M(2632,39)M(2633,39)M(2723,39)M(2909,39)M(2724,39)M(2910,39)M(2725,39)M(2911,39)M(2726,39)M(2912,39)
+M(2728,39)M(2914,39)M(2729,39)M(2915,39)M(2730,39)M(2916,39)M(2731,39)M(2917,39)M(2732,39)M(2918,39)
+M(2733,39)M(2919,39)M(2734,39)M(2920,39)M(2735,39)M(2921,39)M(2634,39)M(2635,39)M(2636,39)M(2637,39)
+M(2638,39)M(2639,39)M(2640,39)M(2641,39)M(2642,39)M(2643,39)M(2644,39)M(2922,39)M(2736,39)M(2923,39)
+M(2737,39)M(2924,39)M(2738,39)M(2925,39)M(2739,39)M(2926,39)M(2740,39)M(2927,39)M(2928,39)M(2741,39)
+M(2929,39)M(2742,39)M(2930,39)M(2743,39)M(2931,39)M(2744,39)M(2932,39)M(2645,39)M(2646,39)M(2647,39)
+M(2649,39)M(2650,39)M(2651,39)M(2652,39)M(2653,39)M(2654,39)M(2655,39)M(2656,39)M(2745,39)M(2746,39)
+M(2933,39)M(2747,39)M(2934,39)M(2748,39)M(2935,39)M(2750,39)M(2937,39)M(2751,39)M(2938,39)M(2752,39)
+M(2939,39)M(2753,39)M(2940,39)M(2754,39)M(2941,39)M(2755,39)M(2942,39)M(2756,39)M(2943,39)M(2757,39)
+M(2944,39)M(2657,39)M(2658,39)M(2660,39)M(2661,39)M(2662,39)M(2663,39)M(2664,39)M(2665,39)M(2666,39)
+M(2667,39)M(2758,39)M(2759,39)M(2760,39)M(2761,39)M(2945,39)M(2762,39)M(2946,39)M(2764,39)M(2948,39)
+M(2765,39)M(2949,39)M(2766,39)M(2950,39)M(2767,39)M(2951,39)M(2768,39)M(2952,39)M(2769,39)M(2953,39)
+M(2770,39)M(2954,39)M(2771,39)M(2955,39)M(2668,39)M(2670,39)M(2671,39)M(2672,39)M(2673,39)M(2674,39)
+M(2675,39)M(2676,39)M(2677,39)M(2772,39)M(2773,39)M(2774,39)M(2775,39)M(2776,39)M(2956,39)M(2778,39)
+M(2958,39)M(2779,39)M(2959,39)M(2780,39)M(2960,39)M(2781,39)M(2961,39)M(2782,39)M(2962,39)M(2783,39)
+M(2963,39)M(2784,39)M(2964,39)M(2785,39)M(2965,39)M(2685,39)M(2686,39)M(2970,39)M(2797,39)M(2973,39)
+M(2798,39)M(2974,39)M(541,39) M(391,39) M(2690,39)M(2693,39)M(2694,39)M(2799,39)M(2800,39)M(2801,39)
+M(2802,39)M(2803,39)M(2808,39)M(2978,39)M(2811,39)M(2981,39)M(2812,39)M(2982,39)M(2697,39)M(2700,39)
+M(2701,39)M(2813,39)M(2814,39)M(2815,39)M(2816,39)M(2817,39)M(2822,39)M(2985,39)M(2825,39)M(2988,39)
+M(2826,39)M(2989,39)M(2703,39)M(2706,39)M(2707,39)M(2827,39)M(2828,39)M(2829,39)M(2830,39)M(2831,39)
+M(2836,39)M(2991,39)M(2839,39)M(2994,39)M(2840,39)M(2995,39)M(544,39) M(2708,39)M(2709,39)M(2710,39)
+M(2711,39)M(2712,39)M(2841,39)M(2842,39)M(2843,39)M(2844,39)M(2845,39)M(2846,39)M(2847,39)M(2848,39)
+M(2996,39)M(2849,39)M(2997,39)M(2850,39)M(2998,39)M(2851,39)M(2999,39)M(2852,39)M(3000,39)M(2715,39)
+M(2716,39)M(2853,39)M(2854,39)M(2855,39)M(2856,39)M(2857,39)M(2862,39)M(2865,39)M(3003,39)M(2866,39)
+M(3004,39)M(2718,39)M(2719,39)M(2867,39)M(2868,39)M(2869,39)M(2870,39)M(2871,39)M(2876,39)M(2879,39)
+M(3006,39)M(2880,39)M(3007,39)M(2720,39)M(2721,39)M(2881,39)M(2882,39)M(2883,39)M(2884,39)M(2885,39)
+M(2886,39)M(2887,39)M(2888,39)M(2889,39)M(2890,39)M(2891,39)M(2892,39)M(2893,39)M(3008,39)M(2894,39)
+M(3009,39)M(2722,39)M(2895,39)M(2896,39)M(2897,39)M(2898,39)M(2899,39)M(2900,39)M(2901,39)M(2902,39)
+M(2903,39)M(2904,39)M(2905,39)M(2906,39)M(2907,39)M(2908,39)M(3010,39)M(3673,39)M(3637,39)M(3677,39)
+M(3675,39)M(3674,39)M(489,39) M(559,39) M(3647,39)M(3658,39)M(3643,39)M(3669,39)M(3642,39)M(3636,39)
+M(3660,39)M(379,39) M(3679,39)M(916,39) M(416,39) M(914,39) M(915,39) M(920,39) M(917,39) M(918,39) 
+M(925,39) M(926,39) M(921,39) M(922,39) M(912,39) M(930,39) M(929,39) M(3668,39)M(941,39) M(942,39) 
+M(944,39) M(945,39) M(943,39) M(947,39) M(946,39) M(948,39) M(949,39) M(951,39) M(952,39) M(950,39) 
+M(954,39) M(955,39) M(953,39) M(958,39) M(964,39) M(963,39) M(968,39) M(965,39) M(967,39) M(966,39) 
+M(3654,39)M(3011,39)M(3012,39)M(3013,39)M(3014,39)M(3016,39)M(3017,39)M(3018,39)M(3019,39)M(3020,39)
+M(3021,39)M(3022,39)M(3023,39)M(1869,39)M(2059,39)M(1870,39)M(2060,39)M(1871,39)M(2061,39)M(1872,39)
+M(2062,39)M(1874,39)M(2064,39)M(1875,39)M(2065,39)M(1876,39)M(2066,39)M(1877,39)M(2067,39)M(1878,39)
+M(2068,39)M(1879,39)M(2069,39)M(1880,39)M(2070,39)M(1881,39)M(2071,39)M(661,39) M(667,39) M(1771,39)
+M(679,39) M(422,39) M(650,39) M(651,39) M(652,39) M(653,39) M(656,39) M(659,39) M(660,39) M(655,39) 
+M(649,39) M(657,39) M(664,39) M(663,39) M(665,39) M(662,39) M(668,39) M(666,39) M(669,39) M(670,39) 
+M(671,39) M(672,39) M(674,39) M(675,39) M(673,39) M(680,39) M(677,39) M(678,39) M(676,39) M(681,39) 
+M(683,39) M(686,39) M(685,39) M(687,39) M(689,39) M(688,39) M(3113,39)M(3299,39)M(3114,39)M(3300,39)
+M(3115,39)M(3301,39)M(3116,39)M(3302,39)M(3118,39)M(3304,39)M(3119,39)M(3305,39)M(3120,39)M(3306,39)
+M(3121,39)M(3307,39)M(3122,39)M(3308,39)M(3123,39)M(3309,39)M(3124,39)M(3310,39)M(3125,39)M(3311,39)
+M(2245,39)M(2431,39)M(2246,39)M(2432,39)M(2247,39)M(2433,39)M(2248,39)M(2434,39)M(2250,39)M(2436,39)
+M(2251,39)M(2437,39)M(2252,39)M(2438,39)M(2253,39)M(2439,39)M(2254,39)M(2440,39)M(2255,39)M(2441,39)
+M(2256,39)M(2442,39)M(2257,39)M(2443,39)M(1769,39)M(1824,39)M(1825,39)M(1826,39)M(3024,39)M(3025,39)
+M(3026,39)M(3027,39)M(3028,39)M(3029,39)M(3030,39)M(3031,39)M(3032,39)M(3033,39)M(3034,39)M(1882,39)
+M(1883,39)M(2072,39)M(1884,39)M(2073,39)M(1885,39)M(2074,39)M(1886,39)M(2075,39)M(1887,39)M(2076,39)
+M(1888,39)M(1889,39)M(2077,39)M(1890,39)M(2078,39)M(1891,39)M(2079,39)M(1892,39)M(2080,39)M(424,39) 
+M(691,39) M(692,39) M(693,39) M(695,39) M(694,39) M(697,39) M(699,39) M(698,39) M(705,39) M(704,39) 
+M(701,39) M(700,39) M(706,39) M(707,39) M(709,39) M(710,39) M(708,39) M(712,39) M(711,39) M(703,39) 
+M(702,39) M(713,39) M(690,39) M(716,39) M(715,39) M(714,39) M(717,39) M(718,39) M(719,39) M(720,39) 
+M(3312,39)M(3126,39)M(3313,39)M(3127,39)M(3314,39)M(3128,39)M(3315,39)M(3129,39)M(3316,39)M(3130,39)
+M(3317,39)M(3318,39)M(3131,39)M(3319,39)M(3132,39)M(3320,39)M(3133,39)M(3321,39)M(3134,39)M(3322,39)
+M(2444,39)M(2258,39)M(2445,39)M(2259,39)M(2446,39)M(2260,39)M(2447,39)M(2261,39)M(2448,39)M(2262,39)
+M(2449,39)M(2450,39)M(2263,39)M(2451,39)M(2264,39)M(2452,39)M(2265,39)M(2453,39)M(2266,39)M(2454,39)
+M(1827,39)M(1828,39)M(1829,39)M(1770,39)M(3035,39)M(3036,39)M(3037,39)M(3039,39)M(3040,39)M(3041,39)
+M(3042,39)M(3043,39)M(3044,39)M(3045,39)M(3046,39)M(1893,39)M(2081,39)M(1894,39)M(2082,39)M(1895,39)
+M(2083,39)M(1896,39)M(2084,39)M(1898,39)M(2086,39)M(1899,39)M(2087,39)M(1900,39)M(2088,39)M(1901,39)
+M(2089,39)M(1902,39)M(2090,39)M(1903,39)M(2091,39)M(1904,39)M(2092,39)M(1905,39)M(2093,39)M(733,39) 
+M(739,39) M(751,39) M(1775,39)M(430,39) M(722,39) M(723,39) M(724,39) M(725,39) M(728,39) M(731,39) 
+M(732,39) M(727,39) M(721,39) M(729,39) M(736,39) M(735,39) M(737,39) M(734,39) M(740,39) M(738,39) 
+M(741,39) M(742,39) M(743,39) M(744,39) M(746,39) M(747,39) M(745,39) M(752,39) M(749,39) M(750,39) 
+M(748,39) M(753,39) M(755,39) M(758,39) M(757,39) M(759,39) M(761,39) M(760,39) M(3135,39)M(3136,39)
+M(3323,39)M(3137,39)M(3324,39)M(3138,39)M(3325,39)M(3140,39)M(3327,39)M(3141,39)M(3328,39)M(3142,39)
+M(3329,39)M(3143,39)M(3330,39)M(3144,39)M(3331,39)M(3145,39)M(3332,39)M(3146,39)M(3333,39)M(3147,39)
+M(3334,39)M(2267,39)M(2455,39)M(2268,39)M(2456,39)M(2269,39)M(2457,39)M(2270,39)M(2458,39)M(2272,39)
+M(2460,39)M(2273,39)M(2461,39)M(2274,39)M(2462,39)M(2275,39)M(2463,39)M(2276,39)M(2464,39)M(2277,39)
+M(2465,39)M(2278,39)M(2466,39)M(2279,39)M(2467,39)M(1772,39)M(1830,39)M(1831,39)M(1832,39)M(3047,39)
+M(3048,39)M(3050,39)M(3051,39)M(3052,39)M(3053,39)M(3054,39)M(3055,39)M(3056,39)M(3057,39)M(1906,39)
+M(2094,39)M(1907,39)M(2095,39)M(1908,39)M(2096,39)M(1909,39)M(2097,39)M(1910,39)M(2098,39)M(1912,39)
+M(2100,39)M(1913,39)M(2101,39)M(1914,39)M(2102,39)M(1915,39)M(2103,39)M(1916,39)M(2104,39)M(1917,39)
+M(2105,39)M(1918,39)M(2106,39)M(1919,39)M(2107,39)M(432,39) M(766,39) M(764,39) M(765,39) M(770,39) 
+M(767,39) M(768,39) M(775,39) M(776,39) M(771,39) M(772,39) M(762,39) M(773,39) M(780,39) M(779,39) 
+M(791,39) M(792,39) M(794,39) M(795,39) M(793,39) M(797,39) M(796,39) M(798,39) M(799,39) M(801,39) 
+M(802,39) M(800,39) M(804,39) M(805,39) M(803,39) M(809,39) M(814,39) M(813,39) M(818,39) M(815,39) 
+M(817,39) M(816,39) M(3148,39)M(3149,39)M(3150,39)M(3151,39)M(3335,39)M(3152,39)M(3336,39)M(3154,39)
+M(3338,39)M(3155,39)M(3339,39)M(3156,39)M(3340,39)M(3157,39)M(3341,39)M(3158,39)M(3342,39)M(3159,39)
+M(3343,39)M(3160,39)M(3344,39)M(3161,39)M(3345,39)M(2280,39)M(2468,39)M(2281,39)M(2469,39)M(2282,39)
+M(2470,39)M(2283,39)M(2471,39)M(2284,39)M(2472,39)M(2286,39)M(2474,39)M(2287,39)M(2475,39)M(2288,39)
+M(2476,39)M(2289,39)M(2477,39)M(2290,39)M(2478,39)M(2291,39)M(2479,39)M(2292,39)M(2480,39)M(2293,39)
+M(2481,39)M(1773,39)M(1833,39)M(1834,39)M(1835,39)M(3058,39)M(3060,39)M(3061,39)M(3062,39)M(3063,39)
+M(3064,39)M(3065,39)M(3066,39)M(3067,39)M(1920,39)M(2108,39)M(1921,39)M(2109,39)M(1922,39)M(2110,39)
+M(1923,39)M(2111,39)M(1924,39)M(2112,39)M(1926,39)M(2114,39)M(1927,39)M(2115,39)M(1928,39)M(2116,39)
+M(1929,39)M(2117,39)M(1930,39)M(2118,39)M(1931,39)M(2119,39)M(1932,39)M(2120,39)M(1933,39)M(2121,39)
+M(1780,39)M(1781,39)M(834,39) M(436,39) M(823,39) M(821,39) M(822,39) M(827,39) M(824,39) M(826,39) 
+M(825,39) M(832,39) M(833,39) M(828,39) M(829,39) M(819,39) M(830,39) M(837,39) M(836,39) M(840,39) 
+M(835,39) M(838,39) M(846,39) M(841,39) M(848,39) M(849,39) M(851,39) M(852,39) M(850,39) M(854,39) 
+M(853,39) M(844,39) M(843,39) M(855,39) M(856,39) M(858,39) M(859,39) M(857,39) M(861,39) M(862,39) 
+M(860,39) M(865,39) M(866,39) M(868,39) M(867,39) M(871,39) M(870,39) M(875,39) M(872,39) M(874,39) 
+M(873,39) M(3162,39)M(3163,39)M(3164,39)M(3165,39)M(3166,39)M(3346,39)M(3168,39)M(3348,39)M(3169,39)
+M(3349,39)M(3170,39)M(3350,39)M(3171,39)M(3351,39)M(3172,39)M(3352,39)M(3173,39)M(3353,39)M(3174,39)
+M(3354,39)M(3175,39)M(3355,39)M(2294,39)M(2482,39)M(2295,39)M(2483,39)M(2296,39)M(2484,39)M(2297,39)
+M(2485,39)M(2298,39)M(2486,39)M(2300,39)M(2488,39)M(2301,39)M(2489,39)M(2302,39)M(2490,39)M(2303,39)
+M(2491,39)M(2304,39)M(2492,39)M(2305,39)M(2493,39)M(2306,39)M(2494,39)M(2307,39)M(2495,39)M(1776,39)
+M(1836,39)M(1837,39)M(1838,39)M(1777,39)M(3671,39)M(437,39) M(3641,39)M(1767,39)M(3075,39)M(3076,39)
+M(2130,39)M(1945,39)M(2133,39)M(1946,39)M(2134,39)M(888,39) M(441,39) M(877,39) M(878,39) M(879,39) 
+M(880,39) M(883,39) M(886,39) M(887,39) M(882,39) M(876,39) M(884,39) M(890,39) M(892,39) M(891,39) 
+M(893,39) M(894,39) M(896,39) M(899,39) M(897,39) M(903,39) M(901,39) M(902,39) M(900,39) M(904,39) 
+M(905,39) M(906,39) M(908,39) M(909,39) M(911,39) M(910,39) M(3360,39)M(3187,39)M(3363,39)M(3188,39)
+M(3364,39)M(2504,39)M(2319,39)M(2507,39)M(2320,39)M(2508,39)M(1839,39)M(1841,39)M(1040,39)M(1051,39)
+M(1785,39)M(1069,39)M(442,39) M(1030,39)M(1028,39)M(1029,39)M(1034,39)M(1031,39)M(1033,39)M(1032,39)
+M(1039,39)M(1038,39)M(1035,39)M(1036,39)M(1026,39)M(1037,39)M(1043,39)M(1042,39)M(1044,39)M(1047,39)
+M(1054,39)M(1055,39)M(1057,39)M(1058,39)M(1056,39)M(1060,39)M(1059,39)M(1061,39)M(1062,39)M(1064,39)
+M(1065,39)M(1063,39)M(1027,39)M(1070,39)M(1067,39)M(1068,39)M(1066,39)M(1071,39)M(1075,39)M(1072,39)
+M(1074,39)M(1073,39)M(1077,39)M(1076,39)M(1081,39)M(1078,39)M(1080,39)M(1079,39)M(1784,39)M(444,39) 
+M(519,39) M(443,39) M(560,39) M(3080,39)M(3083,39)M(3084,39)M(1947,39)M(2135,39)M(1948,39)M(2136,39)
+M(1949,39)M(2137,39)M(1950,39)M(2138,39)M(1951,39)M(2139,39)M(1956,39)M(2144,39)M(1959,39)M(2147,39)
+M(1960,39)M(2148,39)M(485,39) M(486,39) M(595,39) M(973,39) M(971,39) M(972,39) M(977,39) M(974,39) 
+M(975,39) M(982,39) M(983,39) M(978,39) M(979,39) M(969,39) M(987,39) M(986,39) M(998,39) M(999,39) 
+M(1001,39)M(1002,39)M(1000,39)M(1004,39)M(1003,39)M(1005,39)M(1006,39)M(1008,39)M(1009,39)M(1007,39)
+M(1011,39)M(1012,39)M(1010,39)M(1021,39)M(3401,39)M(1020,39)M(1025,39)M(1022,39)M(1024,39)M(1023,39)
+M(3640,39)M(3189,39)M(3190,39)M(3191,39)M(3192,39)M(3193,39)M(3198,39)M(3368,39)M(3201,39)M(3371,39)
+M(3202,39)M(3372,39)M(2321,39)M(2509,39)M(2322,39)M(2510,39)M(2323,39)M(2511,39)M(2324,39)M(2512,39)
+M(2325,39)M(2513,39)M(2330,39)M(2518,39)M(2333,39)M(2521,39)M(2334,39)M(2522,39)M(3087,39)M(3090,39)
+M(3091,39)M(1961,39)M(2149,39)M(1962,39)M(2150,39)M(1963,39)M(2151,39)M(1964,39)M(2152,39)M(1965,39)
+M(2153,39)M(1970,39)M(2158,39)M(1973,39)M(2161,39)M(1974,39)M(2162,39)M(487,39) M(488,39) M(1086,39)
+M(1084,39)M(426,39) M(1085,39)M(1090,39)M(1087,39)M(3632,39)M(434,39) M(1088,39)M(1095,39)M(1096,39)
+M(1091,39)M(1092,39)M(1082,39)M(1100,39)M(1099,39)M(1111,39)M(1112,39)M(1114,39)M(1115,39)M(1113,39)
+M(1117,39)M(1116,39)M(1118,39)M(1119,39)M(1121,39)M(1122,39)M(1120,39)M(1124,39)M(1125,39)M(1123,39)
+M(3633,39)M(1134,39)M(3402,39)M(1133,39)M(1138,39)M(1135,39)M(1137,39)M(1136,39)M(3203,39)M(3204,39)
+M(3205,39)M(3206,39)M(3207,39)M(3212,39)M(3375,39)M(3215,39)M(3378,39)M(3216,39)M(3379,39)M(2335,39)
+M(2523,39)M(2336,39)M(2524,39)M(2337,39)M(2525,39)M(2338,39)M(2526,39)M(2339,39)M(2527,39)M(2344,39)
+M(2532,39)M(2347,39)M(2535,39)M(2348,39)M(2536,39)M(3093,39)M(3096,39)M(3097,39)M(1975,39)M(2163,39)
+M(1976,39)M(2164,39)M(1977,39)M(2165,39)M(1978,39)M(2166,39)M(1979,39)M(2167,39)M(1984,39)M(2172,39)
+M(1987,39)M(2175,39)M(1988,39)M(2176,39)M(495,39) M(1255,39)M(1253,39)M(1254,39)M(1259,39)M(1256,39)
+M(1257,39)M(1264,39)M(1265,39)M(1260,39)M(1261,39)M(1251,39)M(1269,39)M(1268,39)M(1280,39)M(1281,39)
+M(1283,39)M(1284,39)M(1282,39)M(1286,39)M(1285,39)M(1287,39)M(1288,39)M(1290,39)M(1291,39)M(1289,39)
+M(1293,39)M(531,39) M(1294,39)M(528,39) M(1292,39)M(1303,39)M(1302,39)M(1307,39)M(1304,39)M(1306,39)
+M(1305,39)M(3217,39)M(3218,39)M(3219,39)M(3220,39)M(3221,39)M(3655,39)M(3226,39)M(3381,39)M(3229,39)
+M(3384,39)M(3230,39)M(3385,39)M(2349,39)M(2537,39)M(2350,39)M(2538,39)M(2351,39)M(2539,39)M(2352,39)
+M(2540,39)M(2353,39)M(2541,39)M(2358,39)M(2546,39)M(2361,39)M(2549,39)M(2362,39)M(2550,39)M(428,39) 
+M(496,39) M(1143,39)M(1141,39)M(1142,39)M(1147,39)M(1144,39)M(1145,39)M(1152,39)M(1153,39)M(1148,39)
+M(1149,39)M(1139,39)M(1157,39)M(1156,39)M(1168,39)M(1169,39)M(1171,39)M(1172,39)M(1170,39)M(1174,39)
+M(1173,39)M(1175,39)M(1176,39)M(1178,39)M(1179,39)M(1177,39)M(1181,39)M(1182,39)M(1180,39)M(1191,39)
+M(1190,39)M(1195,39)M(1192,39)M(1194,39)M(1193,39)M(429,39) M(506,39) M(520,39) M(505,39) M(1796,39)
+M(1797,39)M(517,39) M(1799,39)M(1800,39)M(1798,39)M(521,39) M(1802,39)M(1801,39)M(1198,39)M(1199,39)
+M(1200,39)M(1201,39)M(1207,39)M(1208,39)M(1203,39)M(1204,39)M(1196,39)M(1212,39)M(1211,39)M(1223,39)
+M(1224,39)M(1226,39)M(1227,39)M(1225,39)M(1229,39)M(1228,39)M(1230,39)M(1231,39)M(1233,39)M(1234,39)
+M(1232,39)M(1236,39)M(1237,39)M(1235,39)M(1246,39)M(1245,39)M(1250,39)M(1247,39)M(1249,39)M(1248,39)
+M(1803,39)M(1804,39)M(1806,39)M(1807,39)M(1805,39)M(524,39) M(3645,39)M(553,39) M(606,39) M(607,39) 
+M(608,39) M(613,39) M(614,39) M(611,39) M(604,39) M(612,39) M(617,39) M(627,39) M(628,39) M(630,39) 
+M(631,39) M(629,39) M(633,39) M(632,39) M(634,39) M(635,39) M(637,39) M(638,39) M(636,39) M(640,39) 
+M(641,39) M(639,39) M(646,39) M(1442,39)M(1443,39)M(1444,39)M(1449,39)M(1450,39)M(1447,39)M(1440,39)
+M(1448,39)M(1453,39)M(1463,39)M(1464,39)M(1466,39)M(1467,39)M(1465,39)M(1469,39)M(1468,39)M(1470,39)
+M(1471,39)M(1473,39)M(1474,39)M(1472,39)M(1476,39)M(1477,39)M(1475,39)M(1482,39)M(3098,39)M(3099,39)
+M(3100,39)M(3101,39)M(3102,39)M(1989,39)M(2177,39)M(1990,39)M(1991,39)M(2178,39)M(1992,39)M(2179,39)
+M(1993,39)M(2180,39)M(1995,39)M(2182,39)M(1996,39)M(2183,39)M(1997,39)M(2184,39)M(1998,39)M(1999,39)
+M(2185,39)M(2000,39)M(2186,39)M(2001,39)M(2187,39)M(2002,39)M(2188,39)M(3631,39)M(526,39) M(1354,39)
+M(1355,39)M(1356,39)M(1357,39)M(1361,39)M(1358,39)M(1359,39)M(1352,39)M(1360,39)M(1364,39)M(1365,39)
+M(501,39) M(1368,39)M(1374,39)M(1375,39)M(1377,39)M(1378,39)M(1376,39)M(1380,39)M(1379,39)M(1381,39)
+M(1382,39)M(1384,39)M(1385,39)M(1383,39)M(1353,39)M(1389,39)M(1387,39)M(1388,39)M(1386,39)M(581,39) 
+M(1390,39)M(1391,39)M(1392,39)M(1393,39)M(1394,39)M(1395,39)M(3231,39)M(3232,39)M(3233,39)M(3234,39)
+M(3235,39)M(3236,39)M(3237,39)M(3238,39)M(3386,39)M(3239,39)M(3387,39)M(3240,39)M(3388,39)M(3241,39)
+M(3389,39)M(3242,39)M(3390,39)M(2363,39)M(2551,39)M(2552,39)M(2364,39)M(2553,39)M(2365,39)M(2554,39)
+M(2366,39)M(2555,39)M(2367,39)M(2556,39)M(2368,39)M(2557,39)M(2369,39)M(2558,39)M(2370,39)M(2559,39)
+M(2560,39)M(2371,39)M(2561,39)M(2372,39)M(2562,39)M(2373,39)M(2563,39)M(2374,39)M(2564,39)M(1809,39)
+M(530,39) M(1398,39)M(1399,39)M(1400,39)M(1401,39)M(1405,39)M(1402,39)M(1403,39)M(1396,39)M(1404,39)
+M(1408,39)M(1409,39)M(503,39) M(1412,39)M(1418,39)M(1419,39)M(1421,39)M(1422,39)M(1420,39)M(1424,39)
+M(1423,39)M(1425,39)M(1426,39)M(1428,39)M(1429,39)M(1427,39)M(1397,39)M(1433,39)M(1431,39)M(1432,39)
+M(1430,39)M(583,39) M(1434,39)M(1435,39)M(1436,39)M(1437,39)M(1438,39)M(1439,39)M(1810,39)M(527,39) 
+M(1310,39)M(1311,39)M(1312,39)M(1313,39)M(1317,39)M(1314,39)M(1315,39)M(1308,39)M(1316,39)M(1320,39)
+M(1321,39)M(502,39) M(498,39) M(1324,39)M(1330,39)M(1331,39)M(1333,39)M(1334,39)M(1332,39)M(1336,39)
+M(1335,39)M(1337,39)M(1338,39)M(1340,39)M(1341,39)M(1339,39)M(1309,39)M(1345,39)M(1343,39)M(1344,39)
+M(1342,39)M(582,39) M(1346,39)M(1347,39)M(1348,39)M(1349,39)M(1350,39)M(1351,39)M(1808,39)M(3676,39)
+M(417,39) M(550,39) M(549,39) M(3667,39)M(3666,39)M(557,39) M(556,39) M(552,39) M(3646,39)M(554,39) 
+M(555,39) M(3652,39)M(3648,39)M(1813,39)M(3639,39)M(3105,39)M(3106,39)M(2003,39)M(2189,39)M(2004,39)
+M(2190,39)M(2005,39)M(2191,39)M(2006,39)M(2192,39)M(2007,39)M(2193,39)M(2012,39)M(2198,39)M(2015,39)
+M(2201,39)M(2016,39)M(2202,39)M(568,39) M(569,39) M(3653,39)M(1489,39)M(1487,39)M(1488,39)M(1493,39)
+M(1490,39)M(1491,39)M(1498,39)M(1499,39)M(1494,39)M(1495,39)M(1485,39)M(1503,39)M(1502,39)M(1514,39)
+M(1515,39)M(1517,39)M(1518,39)M(1516,39)M(1520,39)M(1519,39)M(1521,39)M(1522,39)M(1524,39)M(1525,39)
+M(1523,39)M(1527,39)M(1528,39)M(1526,39)M(1537,39)M(1536,39)M(1541,39)M(1538,39)M(1540,39)M(1539,39)
+M(3243,39)M(3244,39)M(3245,39)M(3246,39)M(3247,39)M(3252,39)M(3255,39)M(3393,39)M(3256,39)M(3394,39)
+M(2375,39)M(2565,39)M(2376,39)M(2566,39)M(2377,39)M(2567,39)M(2378,39)M(2568,39)M(2379,39)M(2569,39)
+M(2384,39)M(2574,39)M(2387,39)M(2577,39)M(2388,39)M(2578,39)M(3670,39)M(3108,39)M(3109,39)M(2017,39)
+M(2203,39)M(2018,39)M(2204,39)M(2019,39)M(2205,39)M(2020,39)M(2206,39)M(2021,39)M(2207,39)M(2026,39)
+M(2212,39)M(2029,39)M(2215,39)M(2030,39)M(2216,39)M(579,39) M(580,39) M(1546,39)M(1544,39)M(427,39) 
+M(1545,39)M(1550,39)M(1547,39)M(1548,39)M(435,39) M(1555,39)M(1556,39)M(1551,39)M(1552,39)M(1542,39)
+M(1560,39)M(1559,39)M(1571,39)M(1572,39)M(1574,39)M(1575,39)M(1573,39)M(1577,39)M(1576,39)M(1578,39)
+M(1579,39)M(1581,39)M(1582,39)M(1580,39)M(1584,39)M(1585,39)M(1583,39)M(1594,39)M(1593,39)M(1598,39)
+M(1595,39)M(1597,39)M(1596,39)M(3257,39)M(3258,39)M(3259,39)M(3260,39)M(3261,39)M(3266,39)M(3269,39)
+M(3396,39)M(3270,39)M(3397,39)M(2389,39)M(2579,39)M(2390,39)M(2580,39)M(2391,39)M(2581,39)M(2392,39)
+M(2582,39)M(2393,39)M(2583,39)M(2398,39)M(2588,39)M(2401,39)M(2591,39)M(2402,39)M(2592,39)M(1613,39)
+M(1624,39)M(1819,39)M(1642,39)M(585,39) M(1603,39)M(1601,39)M(1602,39)M(1607,39)M(1604,39)M(1606,39)
+M(1605,39)M(1612,39)M(1611,39)M(1608,39)M(1609,39)M(1599,39)M(1610,39)M(1616,39)M(1615,39)M(1617,39)
+M(1620,39)M(1627,39)M(1628,39)M(1630,39)M(1631,39)M(1629,39)M(1633,39)M(1632,39)M(1634,39)M(1635,39)
+M(1637,39)M(1638,39)M(1636,39)M(1600,39)M(1643,39)M(1640,39)M(1641,39)M(1639,39)M(1644,39)M(1648,39)
+M(1645,39)M(1647,39)M(1646,39)M(1650,39)M(1649,39)M(1654,39)M(1651,39)M(1653,39)M(1652,39)M(1818,39)
+M(3630,39)M(3110,39)M(3111,39)M(2031,39)M(2217,39)M(2032,39)M(2218,39)M(2033,39)M(2219,39)M(2034,39)
+M(2220,39)M(2035,39)M(2221,39)M(2036,39)M(2222,39)M(2037,39)M(2223,39)M(2038,39)M(2224,39)M(2039,39)
+M(2225,39)M(2040,39)M(2226,39)M(2041,39)M(2227,39)M(2042,39)M(2228,39)M(2043,39)M(2229,39)M(2044,39)
+M(2230,39)M(1668,39)M(1679,39)M(1697,39)M(1823,39)M(590,39) M(591,39) M(1657,39)M(1658,39)M(1659,39)
+M(1661,39)M(1660,39)M(1666,39)M(1667,39)M(1665,39)M(1662,39)M(1663,39)M(439,39) M(1655,39)M(1664,39)
+M(1671,39)M(1670,39)M(1682,39)M(1683,39)M(1685,39)M(1686,39)M(1684,39)M(1688,39)M(1687,39)M(1689,39)
+M(1690,39)M(1692,39)M(1693,39)M(1691,39)M(1695,39)M(1696,39)M(1694,39)M(1703,39)M(1700,39)M(1702,39)
+M(1701,39)M(1705,39)M(1704,39)M(1709,39)M(1706,39)M(1708,39)M(1707,39)M(3271,39)M(3272,39)M(3273,39)
+M(3274,39)M(3275,39)M(3276,39)M(3277,39)M(3278,39)M(3279,39)M(3280,39)M(3281,39)M(3282,39)M(3283,39)
+M(3398,39)M(3284,39)M(3399,39)M(2403,39)M(2593,39)M(2404,39)M(2594,39)M(2405,39)M(2595,39)M(2406,39)
+M(2596,39)M(2407,39)M(2597,39)M(2408,39)M(2598,39)M(2409,39)M(2599,39)M(2410,39)M(2600,39)M(2411,39)
+M(2601,39)M(2412,39)M(2602,39)M(2413,39)M(2603,39)M(2414,39)M(2604,39)M(2415,39)M(2605,39)M(2416,39)
+M(2606,39)M(1820,39)M(1863,39)M(1864,39)M(1865,39)M(3112,39)M(2045,39)M(2231,39)M(2046,39)M(2232,39)
+M(2047,39)M(2233,39)M(2048,39)M(2234,39)M(2049,39)M(2235,39)M(2050,39)M(2236,39)M(2051,39)M(2237,39)
+M(2052,39)M(2238,39)M(2053,39)M(2239,39)M(2054,39)M(2240,39)M(2055,39)M(2241,39)M(2056,39)M(2242,39)
+M(2057,39)M(2243,39)M(2058,39)M(2244,39)M(1725,39)M(1736,39)M(1822,39)M(1754,39)M(592,39) M(593,39) 
+M(1714,39)M(1712,39)M(1713,39)M(1718,39)M(1715,39)M(1717,39)M(1716,39)M(1723,39)M(1724,39)M(1722,39)
+M(1719,39)M(1720,39)M(1710,39)M(1721,39)M(1728,39)M(1727,39)M(1739,39)M(1740,39)M(1742,39)M(1743,39)
+M(1741,39)M(1745,39)M(1744,39)M(1746,39)M(1747,39)M(1749,39)M(1750,39)M(1748,39)M(1752,39)M(1753,39)
+M(1751,39)M(1760,39)M(1757,39)M(1759,39)M(1758,39)M(1762,39)M(1761,39)M(1766,39)M(1763,39)M(1765,39)
+M(1764,39)M(3285,39)M(3286,39)M(3287,39)M(3288,39)M(3289,39)M(3290,39)M(3291,39)M(3292,39)M(3293,39)
+M(3294,39)M(3295,39)M(3296,39)M(3297,39)M(3298,39)M(3400,39)M(2417,39)M(2607,39)M(2418,39)M(2608,39)
+M(2419,39)M(2609,39)M(2420,39)M(2610,39)M(2421,39)M(2611,39)M(2422,39)M(2612,39)M(2423,39)M(2613,39)
+M(2424,39)M(2614,39)M(2425,39)M(2615,39)M(2426,39)M(2616,39)M(2427,39)M(2617,39)M(2428,39)M(2618,39)
+M(2429,39)M(2619,39)M(2430,39)M(2620,39)M(1821,39)M(1866,39)M(1867,39)M(1868,39)M(522,39) M(594,39) 
+M(423,39) M(490,39) M(425,39) M(431,39) M(433,39) M(440,39) M(438,39) M(395,39) M(602,39) M(3626,39)
+M(407,39) M(408,39) M(3635,39)M(494,39) M(3678,39)M(350,39) M(3672,39)M(518,39) M(3656,39)M(500,39) 
+M(497,39) M(551,39) M(346,39) M(347,39) M(344,39) M(345,39) M(493,39) M(492,39) M(523,39) M(3680,4) 
+M(3459,419)M(3455,423)M(3454,423)M(3431,423)M(3430,423)M(3425,423)M(3424,423)M(3443,423)M(3442,423)M(3437,423)
+M(3436,423)M(3449,423)M(3448,423)M(customtest_index,4294967295)M(5508,448)M(5509,448)M(5510,448)M(5511,448)M(5512,448)M(5513,448)
+M(5514,448)M(5515,448)M(5516,448)M(5517,448)M(5518,448)M(5519,448)M(5731,448)M(5586,448)M(5732,448)M(5587,448)
+M(5588,448)M(5733,448)M(5589,448)M(5734,448)M(5590,448)M(5735,448)M(5591,448)M(5736,448)M(5592,448)M(5737,448)
+M(5593,448)M(5738,448)M(5594,448)M(5739,448)M(5595,448)M(5740,448)M(5596,448)M(5741,448)M(5597,448)M(5742,448)
+M(5520,448)M(5521,448)M(5522,448)M(5523,448)M(5524,448)M(5525,448)M(5526,448)M(5527,448)M(5528,448)M(5529,448)
+M(5530,448)M(5531,448)M(5532,448)M(5598,448)M(5743,448)M(5599,448)M(5744,448)M(5745,448)M(5600,448)M(5746,448)
+M(5601,448)M(5747,448)M(5602,448)M(5748,448)M(5603,448)M(5749,448)M(5604,448)M(5750,448)M(5605,448)M(5751,448)
+M(5606,448)M(5752,448)M(5607,448)M(5753,448)M(5608,448)M(5754,448)M(5609,448)M(5755,448)M(5533,448)M(5534,448)
+M(5535,448)M(5536,448)M(5537,448)M(5538,448)M(5539,448)M(5540,448)M(5541,448)M(5542,448)M(5543,448)M(5610,448)
+M(5611,448)M(5756,448)M(5612,448)M(5757,448)M(5613,448)M(5758,448)M(5614,448)M(5759,448)M(5615,448)M(5760,448)
+M(5616,448)M(5761,448)M(5617,448)M(5762,448)M(5618,448)M(5763,448)M(5619,448)M(5764,448)M(5620,448)M(5765,448)
+M(5621,448)M(5766,448)M(5544,448)M(5545,448)M(5546,448)M(5547,448)M(5548,448)M(5549,448)M(5550,448)M(5551,448)
+M(5552,448)M(5553,448)M(5622,448)M(5623,448)M(5767,448)M(5624,448)M(5768,448)M(5625,448)M(5769,448)M(5626,448)
+M(5770,448)M(5627,448)M(5771,448)M(5628,448)M(5772,448)M(5629,448)M(5773,448)M(5630,448)M(5774,448)M(5631,448)
+M(5775,448)M(5632,448)M(5776,448)M(5554,448)M(5555,448)M(5556,448)M(5557,448)M(5558,448)M(5559,448)M(5560,448)
+M(5561,448)M(5562,448)M(5633,448)M(5634,448)M(5635,448)M(5636,448)M(5637,448)M(5777,448)M(5638,448)M(5778,448)
+M(5639,448)M(5779,448)M(5640,448)M(5780,448)M(5641,448)M(5781,448)M(5642,448)M(5782,448)M(5643,448)M(5783,448)
+M(5644,448)M(5784,448)M(5645,448)M(5785,448)M(5563,448)M(5564,448)M(5646,448)M(5786,448)M(5647,448)M(5787,448)
+M(5648,448)M(5788,448)M(5565,448)M(5566,448)M(5567,448)M(5649,448)M(5650,448)M(5651,448)M(5652,448)M(5653,448)
+M(5654,448)M(5789,448)M(5655,448)M(5790,448)M(5656,448)M(5791,448)M(5568,448)M(5569,448)M(5570,448)M(5657,448)
+M(5658,448)M(5659,448)M(5660,448)M(5661,448)M(5662,448)M(5792,448)M(5663,448)M(5793,448)M(5664,448)M(5794,448)
+M(5571,448)M(5572,448)M(5573,448)M(5665,448)M(5666,448)M(5667,448)M(5668,448)M(5669,448)M(5670,448)M(5795,448)
+M(5671,448)M(5796,448)M(5672,448)M(5797,448)M(5574,448)M(5575,448)M(5576,448)M(5577,448)M(5578,448)M(5673,448)
+M(5674,448)M(5675,448)M(5676,448)M(5677,448)M(5678,448)M(5679,448)M(5680,448)M(5681,448)M(5682,448)M(5798,448)
+M(5683,448)M(5799,448)M(5684,448)M(5800,448)M(5685,448)M(5801,448)M(5686,448)M(5802,448)M(5579,448)M(5580,448)
+M(5687,448)M(5688,448)M(5689,448)M(5690,448)M(5691,448)M(5692,448)M(5693,448)M(5803,448)M(5694,448)M(5804,448)
+M(5581,448)M(5582,448)M(5695,448)M(5696,448)M(5697,448)M(5698,448)M(5699,448)M(5700,448)M(5701,448)M(5805,448)
+M(5702,448)M(5806,448)M(5583,448)M(5584,448)M(5703,448)M(5704,448)M(5705,448)M(5706,448)M(5707,448)M(5708,448)
+M(5709,448)M(5710,448)M(5711,448)M(5712,448)M(5713,448)M(5714,448)M(5715,448)M(5807,448)M(5716,448)M(5808,448)
+M(5585,448)M(5717,448)M(5718,448)M(5719,448)M(5720,448)M(5721,448)M(5722,448)M(5723,448)M(5724,448)M(5725,448)
+M(5726,448)M(5727,448)M(5728,448)M(5729,448)M(5730,448)M(5809,448)M(3782,448)M(4050,448)M(4056,448)M(4069,448)
+M(4041,448)M(4042,448)M(4043,448)M(4044,448)M(4046,448)M(4047,448)M(4048,448)M(4045,448)M(4049,448)M(4063,448)
+M(4052,448)M(4053,448)M(4054,448)M(4055,448)M(4051,448)M(4057,448)M(4059,448)M(4060,448)M(4061,448)M(4062,448)
+M(4058,448)M(4064,448)M(4066,448)M(4065,448)M(4068,448)M(4067,448)M(4070,448)M(4071,448)M(4072,448)M(5810,448)
+M(5811,448)M(5812,448)M(5813,448)M(5814,448)M(5815,448)M(5816,448)M(5817,448)M(5818,448)M(5819,448)M(5820,448)
+M(5821,448)M(4904,448)M(5054,448)M(4905,448)M(5055,448)M(4906,448)M(5056,448)M(4907,448)M(5057,448)M(4908,448)
+M(5058,448)M(4909,448)M(5059,448)M(4910,448)M(5060,448)M(4911,448)M(5061,448)M(4912,448)M(5062,448)M(4913,448)
+M(5063,448)M(4914,448)M(5064,448)M(4915,448)M(5065,448)M(4916,448)M(5066,448)M(3822,448)M(3829,448)M(3835,448)
+M(3849,448)M(3815,448)M(3816,448)M(3817,448)M(3818,448)M(3820,448)M(3819,448)M(3821,448)M(3824,448)M(3842,448)
+M(3823,448)M(3825,448)M(3828,448)M(3827,448)M(3830,448)M(3831,448)M(3832,448)M(3833,448)M(3834,448)M(3836,448)
+M(3826,448)M(3838,448)M(3839,448)M(3840,448)M(3841,448)M(3837,448)M(3814,448)M(3846,448)M(3843,448)M(3845,448)
+M(3844,448)M(3848,448)M(3847,448)M(3850,448)M(3851,448)M(3852,448)M(3853,448)M(6033,448)M(5888,448)M(6034,448)
+M(5889,448)M(5890,448)M(6035,448)M(5891,448)M(6036,448)M(5892,448)M(6037,448)M(5893,448)M(6038,448)M(5894,448)
+M(6039,448)M(5895,448)M(6040,448)M(5896,448)M(6041,448)M(5897,448)M(6042,448)M(5898,448)M(6043,448)M(5899,448)
+M(6044,448)M(5205,448)M(5356,448)M(5206,448)M(5357,448)M(5207,448)M(5358,448)M(5208,448)M(5359,448)M(5209,448)
+M(5360,448)M(5210,448)M(5361,448)M(5211,448)M(5362,448)M(5212,448)M(5363,448)M(5213,448)M(5364,448)M(5214,448)
+M(5365,448)M(5215,448)M(5366,448)M(5216,448)M(5367,448)M(5217,448)M(5368,448)M(4789,448)M(4821,448)M(4823,448)
+M(4827,448)M(4826,448)M(4822,448)M(4824,448)M(4825,448)M(5822,448)M(5823,448)M(5824,448)M(5825,448)M(5826,448)
+M(5827,448)M(5828,448)M(5829,448)M(5830,448)M(5831,448)M(5832,448)M(5833,448)M(5834,448)M(4917,448)M(5067,448)
+M(4918,448)M(5068,448)M(4919,448)M(5069,448)M(4920,448)M(5070,448)M(4921,448)M(5071,448)M(4922,448)M(5072,448)
+M(4923,448)M(5073,448)M(4924,448)M(5074,448)M(4925,448)M(5075,448)M(4926,448)M(5076,448)M(4927,448)M(5077,448)
+M(4928,448)M(5078,448)M(4929,448)M(5079,448)M(4930,448)M(5080,448)M(3867,448)M(3885,448)M(3855,448)M(3856,448)
+M(3857,448)M(3858,448)M(3859,448)M(3860,448)M(3862,448)M(3878,448)M(3861,448)M(3863,448)M(3866,448)M(3865,448)
+M(3868,448)M(3869,448)M(3870,448)M(3871,448)M(3872,448)M(3864,448)M(3874,448)M(3875,448)M(3876,448)M(3877,448)
+M(3873,448)M(3854,448)M(3882,448)M(3879,448)M(3881,448)M(3880,448)M(3884,448)M(3883,448)M(3886,448)M(3887,448)
+M(3888,448)M(3889,448)M(3890,448)M(5900,448)M(6045,448)M(5901,448)M(6046,448)M(6047,448)M(5902,448)M(6048,448)
+M(5903,448)M(6049,448)M(5904,448)M(6050,448)M(5905,448)M(6051,448)M(5906,448)M(6052,448)M(5907,448)M(6053,448)
+M(5908,448)M(6054,448)M(5909,448)M(6055,448)M(5910,448)M(6056,448)M(5911,448)M(6057,448)M(5218,448)M(5369,448)
+M(5219,448)M(5370,448)M(5220,448)M(5371,448)M(5221,448)M(5372,448)M(5222,448)M(5373,448)M(5223,448)M(5374,448)
+M(5224,448)M(5375,448)M(5225,448)M(5376,448)M(5226,448)M(5377,448)M(5227,448)M(5378,448)M(5228,448)M(5379,448)
+M(5229,448)M(5380,448)M(5230,448)M(5381,448)M(5231,448)M(5382,448)M(4790,448)M(4828,448)M(4830,448)M(4834,448)
+M(4833,448)M(4829,448)M(4831,448)M(4832,448)M(4276,448)M(4288,448)M(4294,448)M(4308,448)M(4268,448)M(4269,448)
+M(4270,448)M(4271,448)M(4273,448)M(4275,448)M(4272,448)M(4274,448)M(4278,448)M(4301,448)M(4281,448)M(4277,448)
+M(4280,448)M(4279,448)M(4287,448)M(4286,448)M(4284,448)M(4283,448)M(4290,448)M(4291,448)M(4292,448)M(4293,448)
+M(4289,448)M(4295,448)M(4285,448)M(4282,448)M(4297,448)M(4298,448)M(4299,448)M(4300,448)M(4296,448)M(4267,448)
+M(4305,448)M(4302,448)M(4304,448)M(4303,448)M(4307,448)M(4306,448)M(4309,448)M(4310,448)M(4311,448)M(4312,448)
+M(4313,448)M(4798,448)M(5835,448)M(5836,448)M(5837,448)M(5838,448)M(5839,448)M(5840,448)M(5841,448)M(5842,448)
+M(5843,448)M(5844,448)M(5845,448)M(4931,448)M(5081,448)M(4932,448)M(5082,448)M(4933,448)M(5083,448)M(4934,448)
+M(5084,448)M(4935,448)M(5085,448)M(4936,448)M(5086,448)M(4937,448)M(5087,448)M(4938,448)M(5088,448)M(4939,448)
+M(5089,448)M(4940,448)M(5090,448)M(4941,448)M(5091,448)M(4942,448)M(5092,448)M(4943,448)M(5093,448)M(3899,448)
+M(3906,448)M(3912,448)M(3926,448)M(3892,448)M(3893,448)M(3894,448)M(3895,448)M(3897,448)M(3896,448)M(3898,448)
+M(3901,448)M(3919,448)M(3900,448)M(3902,448)M(3905,448)M(3904,448)M(3907,448)M(3908,448)M(3909,448)M(3910,448)
+M(3911,448)M(3913,448)M(3903,448)M(3915,448)M(3916,448)M(3917,448)M(3918,448)M(3914,448)M(3891,448)M(3923,448)
+M(3920,448)M(3922,448)M(3921,448)M(3925,448)M(3924,448)M(3927,448)M(3928,448)M(3929,448)M(3930,448)M(5912,448)
+M(5913,448)M(6058,448)M(5914,448)M(6059,448)M(5915,448)M(6060,448)M(5916,448)M(6061,448)M(5917,448)M(6062,448)
+M(5918,448)M(6063,448)M(5919,448)M(6064,448)M(5920,448)M(6065,448)M(5921,448)M(6066,448)M(5922,448)M(6067,448)
+M(5923,448)M(6068,448)M(5232,448)M(5383,448)M(5233,448)M(5384,448)M(5234,448)M(5385,448)M(5235,448)M(5386,448)
+M(5236,448)M(5387,448)M(5237,448)M(5388,448)M(5238,448)M(5389,448)M(5239,448)M(5390,448)M(5240,448)M(5391,448)
+M(5241,448)M(5392,448)M(5242,448)M(5393,448)M(5243,448)M(5394,448)M(5244,448)M(5395,448)M(4791,448)M(4835,448)
+M(4837,448)M(4841,448)M(4840,448)M(4836,448)M(4838,448)M(4839,448)M(5846,448)M(5847,448)M(5848,448)M(5849,448)
+M(5850,448)M(5851,448)M(5852,448)M(5853,448)M(5854,448)M(5855,448)M(4944,448)M(5094,448)M(4945,448)M(5095,448)
+M(4946,448)M(5096,448)M(4947,448)M(5097,448)M(4948,448)M(5098,448)M(4949,448)M(5099,448)M(4950,448)M(5100,448)
+M(4951,448)M(5101,448)M(4952,448)M(5102,448)M(4953,448)M(5103,448)M(4954,448)M(5104,448)M(4955,448)M(5105,448)
+M(4956,448)M(5106,448)M(3941,448)M(3947,448)M(3959,448)M(3931,448)M(3932,448)M(3933,448)M(3934,448)M(3936,448)
+M(3938,448)M(3939,448)M(3935,448)M(3937,448)M(3940,448)M(3954,448)M(3942,448)M(3943,448)M(3944,448)M(3945,448)
+M(3946,448)M(3948,448)M(3950,448)M(3951,448)M(3952,448)M(3953,448)M(3949,448)M(3955,448)M(3957,448)M(3956,448)
+M(3958,448)M(3960,448)M(3961,448)M(3962,448)M(3963,448)M(5924,448)M(5925,448)M(6069,448)M(5926,448)M(6070,448)
+M(5927,448)M(6071,448)M(5928,448)M(6072,448)M(5929,448)M(6073,448)M(5930,448)M(6074,448)M(5931,448)M(6075,448)
+M(5932,448)M(6076,448)M(5933,448)M(6077,448)M(5934,448)M(6078,448)M(5245,448)M(5396,448)M(5246,448)M(5397,448)
+M(5247,448)M(5398,448)M(5248,448)M(5399,448)M(5249,448)M(5400,448)M(5250,448)M(5401,448)M(5251,448)M(5402,448)
+M(5252,448)M(5403,448)M(5253,448)M(5404,448)M(5254,448)M(5405,448)M(5255,448)M(5406,448)M(5256,448)M(5407,448)
+M(5257,448)M(5408,448)M(4792,448)M(4842,448)M(4844,448)M(4848,448)M(4847,448)M(4843,448)M(4845,448)M(4846,448)
+M(4794,448)M(5856,448)M(5857,448)M(5858,448)M(5859,448)M(5860,448)M(5861,448)M(5862,448)M(5863,448)M(5864,448)
+M(4957,448)M(5107,448)M(4958,448)M(5108,448)M(4959,448)M(5109,448)M(4960,448)M(5110,448)M(4961,448)M(5111,448)
+M(4962,448)M(5112,448)M(4963,448)M(5113,448)M(4964,448)M(5114,448)M(4965,448)M(5115,448)M(4966,448)M(5116,448)
+M(4967,448)M(5117,448)M(4968,448)M(5118,448)M(4969,448)M(5119,448)M(4795,448)M(4796,448)M(3971,448)M(3978,448)
+M(3984,448)M(3997,448)M(3964,448)M(3965,448)M(3966,448)M(3967,448)M(3969,448)M(3968,448)M(3970,448)M(3973,448)
+M(3991,448)M(3972,448)M(3974,448)M(3977,448)M(3976,448)M(3980,448)M(3981,448)M(3982,448)M(3983,448)M(3979,448)
+M(3985,448)M(3975,448)M(3987,448)M(3988,448)M(3989,448)M(3990,448)M(3986,448)M(3992,448)M(3994,448)M(3993,448)
+M(3996,448)M(3995,448)M(3998,448)M(3999,448)M(4000,448)M(4001,448)M(4002,448)M(5935,448)M(5936,448)M(5937,448)
+M(5938,448)M(5939,448)M(6079,448)M(5940,448)M(6080,448)M(5941,448)M(6081,448)M(5942,448)M(6082,448)M(5943,448)
+M(6083,448)M(5944,448)M(6084,448)M(5945,448)M(6085,448)M(5946,448)M(6086,448)M(5947,448)M(6087,448)M(5258,448)
+M(5409,448)M(5259,448)M(5410,448)M(5260,448)M(5411,448)M(5261,448)M(5412,448)M(5262,448)M(5413,448)M(5263,448)
+M(5414,448)M(5264,448)M(5415,448)M(5265,448)M(5416,448)M(5266,448)M(5417,448)M(5267,448)M(5418,448)M(5268,448)
+M(5419,448)M(5269,448)M(5420,448)M(5270,448)M(5421,448)M(4793,448)M(4849,448)M(4851,448)M(4855,448)M(4854,448)
+M(4850,448)M(4852,448)M(4853,448)M(5865,448)M(5866,448)M(4970,448)M(5120,448)M(5121,448)M(4971,448)M(5122,448)
+M(4972,448)M(5123,448)M(4011,448)M(4017,448)M(4023,448)M(4035,448)M(4004,448)M(4005,448)M(4006,448)M(4007,448)
+M(4009,448)M(4008,448)M(4010,448)M(4012,448)M(4028,448)M(4013,448)M(4016,448)M(4015,448)M(4019,448)M(4020,448)
+M(4021,448)M(4022,448)M(4018,448)M(4024,448)M(4014,448)M(4026,448)M(4027,448)M(4025,448)M(4003,448)M(4032,448)
+M(4029,448)M(4031,448)M(4030,448)M(4034,448)M(4033,448)M(4036,448)M(4037,448)M(4038,448)M(4039,448)M(4040,448)
+M(5948,448)M(6088,448)M(5949,448)M(6089,448)M(5950,448)M(6090,448)M(5271,448)M(5422,448)M(5423,448)M(5272,448)
+M(5424,448)M(5273,448)M(5425,448)M(4856,448)M(4858,448)M(4861,448)M(4860,448)M(4857,448)M(4859,448)M(4113,448)
+M(4117,448)M(4123,448)M(4137,448)M(4105,448)M(4106,448)M(4107,448)M(4108,448)M(4110,448)M(4112,448)M(4109,448)
+M(4111,448)M(4114,448)M(4130,448)M(4115,448)M(4116,448)M(4119,448)M(4120,448)M(4121,448)M(4122,448)M(4118,448)
+M(4124,448)M(4126,448)M(4127,448)M(4128,448)M(4129,448)M(4125,448)M(4104,448)M(4134,448)M(4131,448)M(4133,448)
+M(4132,448)M(4136,448)M(4135,448)M(4138,448)M(4139,448)M(4140,448)M(4141,448)M(4142,448)M(4797,448)M(4380,448)
+M(4393,448)M(4390,448)M(4399,448)M(4410,448)M(4414,448)M(4369,448)M(4370,448)M(4371,448)M(4373,448)M(4372,448)
+M(4375,448)M(4378,448)M(4379,448)M(4377,448)M(4374,448)M(4376,448)M(4382,448)M(4406,448)M(4385,448)M(4381,448)
+M(4384,448)M(4383,448)M(4392,448)M(4391,448)M(4388,448)M(4387,448)M(4395,448)M(4396,448)M(4397,448)M(4398,448)
+M(4394,448)M(4400,448)M(4389,448)M(4386,448)M(4402,448)M(4403,448)M(4404,448)M(4405,448)M(4401,448)M(4368,448)
+M(4411,448)M(4407,448)M(4409,448)M(4408,448)M(4413,448)M(4412,448)M(4418,448)M(4415,448)M(4417,448)M(4416,448)
+M(4419,448)M(4420,448)M(4421,448)M(4811,448)M(5867,448)M(5868,448)M(5869,448)M(4973,448)M(5124,448)M(4974,448)
+M(5125,448)M(4975,448)M(5126,448)M(4976,448)M(5127,448)M(4977,448)M(5128,448)M(4978,448)M(5129,448)M(4979,448)
+M(5130,448)M(4980,448)M(5131,448)M(4082,448)M(4088,448)M(4100,448)M(4073,448)M(4074,448)M(4075,448)M(4076,448)
+M(4078,448)M(4079,448)M(4080,448)M(4077,448)M(4081,448)M(4095,448)M(4084,448)M(4085,448)M(4086,448)M(4087,448)
+M(4083,448)M(4089,448)M(4091,448)M(4092,448)M(4093,448)M(4094,448)M(4090,448)M(4096,448)M(4098,448)M(4097,448)
+M(4099,448)M(4101,448)M(4102,448)M(4103,448)M(5951,448)M(5952,448)M(5953,448)M(5954,448)M(5955,448)M(5956,448)
+M(6091,448)M(5957,448)M(6092,448)M(5958,448)M(6093,448)M(5274,448)M(5426,448)M(5275,448)M(5427,448)M(5276,448)
+M(5428,448)M(5277,448)M(5429,448)M(5278,448)M(5430,448)M(5279,448)M(5431,448)M(5280,448)M(5432,448)M(5281,448)
+M(5433,448)M(4862,448)M(4863,448)M(4865,448)M(4864,448)M(5870,448)M(5871,448)M(5872,448)M(4981,448)M(5132,448)
+M(4982,448)M(5133,448)M(4983,448)M(5134,448)M(4984,448)M(5135,448)M(4985,448)M(5136,448)M(4986,448)M(5137,448)
+M(4987,448)M(5138,448)M(4988,448)M(5139,448)M(4152,448)M(4158,448)M(4170,448)M(4143,448)M(4144,448)M(4145,448)
+M(4146,448)M(4148,448)M(4149,448)M(4150,448)M(4147,448)M(4151,448)M(4165,448)M(4154,448)M(4155,448)M(4156,448)
+M(4157,448)M(4153,448)M(4159,448)M(4161,448)M(4162,448)M(4163,448)M(4164,448)M(4160,448)M(4166,448)M(4168,448)
+M(4167,448)M(4169,448)M(4171,448)M(4172,448)M(4173,448)M(5959,448)M(5960,448)M(5961,448)M(5962,448)M(5963,448)
+M(5964,448)M(6094,448)M(5965,448)M(6095,448)M(5966,448)M(6096,448)M(5282,448)M(5434,448)M(5283,448)M(5435,448)
+M(5284,448)M(5436,448)M(5285,448)M(5437,448)M(5286,448)M(5438,448)M(5287,448)M(5439,448)M(5288,448)M(5440,448)
+M(5289,448)M(5441,448)M(4866,448)M(4867,448)M(4869,448)M(4868,448)M(5873,448)M(5874,448)M(5875,448)M(4989,448)
+M(5140,448)M(4990,448)M(5141,448)M(4991,448)M(5142,448)M(4992,448)M(5143,448)M(4993,448)M(5144,448)M(4994,448)
+M(5145,448)M(4995,448)M(5146,448)M(4996,448)M(5147,448)M(4245,448)M(4251,448)M(4263,448)M(4236,448)M(4237,448)
+M(4238,448)M(4239,448)M(4241,448)M(4242,448)M(4243,448)M(4240,448)M(4244,448)M(4258,448)M(4247,448)M(4248,448)
+M(4249,448)M(4250,448)M(4246,448)M(4252,448)M(4254,448)M(4255,448)M(4256,448)M(4257,448)M(4253,448)M(4259,448)
+M(4261,448)M(4260,448)M(4262,448)M(4264,448)M(4265,448)M(4266,448)M(5967,448)M(5968,448)M(5969,448)M(5970,448)
+M(5971,448)M(5972,448)M(6097,448)M(5973,448)M(6098,448)M(5974,448)M(6099,448)M(5290,448)M(5442,448)M(5291,448)
+M(5443,448)M(5292,448)M(5444,448)M(5293,448)M(5445,448)M(5294,448)M(5446,448)M(5295,448)M(5447,448)M(5296,448)
+M(5448,448)M(5297,448)M(5449,448)M(4183,448)M(4189,448)M(4201,448)M(4174,448)M(4175,448)M(4176,448)M(4177,448)
+M(4179,448)M(4180,448)M(4181,448)M(4178,448)M(4182,448)M(4196,448)M(4185,448)M(4186,448)M(4187,448)M(4188,448)
+M(4184,448)M(4190,448)M(4192,448)M(4193,448)M(4194,448)M(4195,448)M(4191,448)M(4197,448)M(4199,448)M(4198,448)
+M(4200,448)M(4202,448)M(4203,448)M(4204,448)M(3774,448)M(3773,448)M(4800,448)M(4801,448)M(4802,448)M(4803,448)
+M(4799,448)M(4326,448)M(4339,448)M(4336,448)M(4345,448)M(4356,448)M(4360,448)M(4315,448)M(4316,448)M(4317,448)
+M(4319,448)M(4318,448)M(4321,448)M(4324,448)M(4325,448)M(4323,448)M(4320,448)M(4322,448)M(4328,448)M(4352,448)
+M(4331,448)M(4327,448)M(4330,448)M(4329,448)M(4338,448)M(4337,448)M(4334,448)M(4333,448)M(4341,448)M(4342,448)
+M(4343,448)M(4344,448)M(4340,448)M(4346,448)M(4335,448)M(4332,448)M(4348,448)M(4349,448)M(4350,448)M(4351,448)
+M(4347,448)M(4314,448)M(4357,448)M(4353,448)M(4355,448)M(4354,448)M(4359,448)M(4358,448)M(4364,448)M(4361,448)
+M(4363,448)M(4362,448)M(4365,448)M(4366,448)M(4367,448)M(4804,448)M(4805,448)M(4214,448)M(4220,448)M(4232,448)
+M(4205,448)M(4206,448)M(4207,448)M(4208,448)M(4210,448)M(4211,448)M(4212,448)M(4209,448)M(4213,448)M(4227,448)
+M(4216,448)M(4217,448)M(4218,448)M(4219,448)M(4215,448)M(4221,448)M(4223,448)M(4224,448)M(4225,448)M(4226,448)
+M(4222,448)M(4228,448)M(4230,448)M(4229,448)M(4231,448)M(4233,448)M(4234,448)M(4235,448)M(4878,448)M(4879,448)
+M(4881,448)M(4880,448)M(4807,448)M(4808,448)M(4809,448)M(4810,448)M(4806,448)M(3794,448)M(3800,448)M(3812,448)
+M(3786,448)M(3787,448)M(3788,448)M(3789,448)M(3791,448)M(3792,448)M(3790,448)M(3793,448)M(3807,448)M(3796,448)
+M(3797,448)M(3798,448)M(3799,448)M(3795,448)M(3801,448)M(3803,448)M(3804,448)M(3805,448)M(3806,448)M(3802,448)
+M(3808,448)M(3810,448)M(3809,448)M(3811,448)M(3813,448)M(4874,448)M(4875,448)M(4877,448)M(4876,448)M(4544,448)
+M(4550,448)M(4562,448)M(4536,448)M(4537,448)M(4538,448)M(4539,448)M(4541,448)M(4542,448)M(4540,448)M(4543,448)
+M(4557,448)M(4546,448)M(4547,448)M(4548,448)M(4549,448)M(4545,448)M(4551,448)M(4553,448)M(4554,448)M(4555,448)
+M(4556,448)M(4552,448)M(4558,448)M(4560,448)M(4559,448)M(4561,448)M(4563,448)M(4870,448)M(4871,448)M(4873,448)
+M(4872,448)M(3776,448)M(3775,448)M(5876,448)M(5877,448)M(5878,448)M(5879,448)M(5880,448)M(4997,448)M(5148,448)
+M(4998,448)M(5149,448)M(4999,448)M(5150,448)M(5000,448)M(5151,448)M(5001,448)M(5152,448)M(5002,448)M(5153,448)
+M(5003,448)M(5154,448)M(5004,448)M(5155,448)M(5005,448)M(5156,448)M(5006,448)M(5157,448)M(5007,448)M(5158,448)
+M(5008,448)M(5159,448)M(5009,448)M(5160,448)M(4472,448)M(4478,448)M(4492,448)M(4461,448)M(4462,448)M(4463,448)
+M(4464,448)M(4466,448)M(4468,448)M(4465,448)M(4467,448)M(4469,448)M(4485,448)M(4470,448)M(4471,448)M(4474,448)
+M(4475,448)M(4476,448)M(4477,448)M(4473,448)M(4479,448)M(4481,448)M(4482,448)M(4483,448)M(4484,448)M(4480,448)
+M(4460,448)M(4489,448)M(4486,448)M(4488,448)M(4487,448)M(4491,448)M(4490,448)M(4493,448)M(4494,448)M(4495,448)
+M(4496,448)M(4497,448)M(5975,448)M(5976,448)M(5977,448)M(5978,448)M(5979,448)M(5980,448)M(5981,448)M(5982,448)
+M(5983,448)M(5984,448)M(6100,448)M(5985,448)M(6101,448)M(5986,448)M(6102,448)M(5987,448)M(6103,448)M(5988,448)
+M(6104,448)M(5298,448)M(5450,448)M(5299,448)M(5451,448)M(5300,448)M(5452,448)M(5301,448)M(5453,448)M(5302,448)
+M(5454,448)M(5303,448)M(5455,448)M(5304,448)M(5456,448)M(5305,448)M(5457,448)M(5306,448)M(5458,448)M(5307,448)
+M(5459,448)M(5308,448)M(5460,448)M(5309,448)M(5461,448)M(5310,448)M(5462,448)M(5311,448)M(5463,448)M(4812,448)
+M(6113,448)M(4510,448)M(4516,448)M(4530,448)M(4499,448)M(4500,448)M(4501,448)M(4502,448)M(4504,448)M(4506,448)
+M(4503,448)M(4505,448)M(4507,448)M(4523,448)M(4508,448)M(4509,448)M(4512,448)M(4513,448)M(4514,448)M(4515,448)
+M(4511,448)M(4517,448)M(4519,448)M(4520,448)M(4521,448)M(4522,448)M(4518,448)M(4498,448)M(4527,448)M(4524,448)
+M(4526,448)M(4525,448)M(4529,448)M(4528,448)M(4531,448)M(4532,448)M(4533,448)M(4534,448)M(4535,448)M(4814,448)
+M(4434,448)M(4440,448)M(4454,448)M(4423,448)M(4424,448)M(4425,448)M(4426,448)M(4428,448)M(4430,448)M(4427,448)
+M(4429,448)M(4431,448)M(4447,448)M(4432,448)M(4433,448)M(4436,448)M(4437,448)M(4438,448)M(4439,448)M(4435,448)
+M(4441,448)M(4443,448)M(4444,448)M(4445,448)M(4446,448)M(4442,448)M(4422,448)M(4451,448)M(4448,448)M(4450,448)
+M(4449,448)M(4453,448)M(4452,448)M(4455,448)M(4456,448)M(4457,448)M(4458,448)M(4459,448)M(4813,448)M(4816,448)
+M(4815,448)M(4576,448)M(4589,448)M(4586,448)M(4595,448)M(4606,448)M(4610,448)M(4565,448)M(4566,448)M(4567,448)
+M(4569,448)M(4568,448)M(4571,448)M(4574,448)M(4575,448)M(4573,448)M(4570,448)M(4572,448)M(4578,448)M(4602,448)
+M(4581,448)M(4577,448)M(4580,448)M(4579,448)M(4588,448)M(4587,448)M(4584,448)M(4583,448)M(4591,448)M(4592,448)
+M(4593,448)M(4594,448)M(4590,448)M(4596,448)M(4585,448)M(4582,448)M(4598,448)M(4599,448)M(4600,448)M(4601,448)
+M(4597,448)M(4564,448)M(4607,448)M(4603,448)M(4605,448)M(4604,448)M(4609,448)M(4608,448)M(4614,448)M(4611,448)
+M(4613,448)M(4612,448)M(4615,448)M(4616,448)M(4617,448)M(4817,448)M(5881,448)M(5882,448)M(5010,448)M(5161,448)
+M(5011,448)M(5162,448)M(5012,448)M(5163,448)M(5013,448)M(5164,448)M(5014,448)M(5165,448)M(5015,448)M(5166,448)
+M(5016,448)M(5167,448)M(5017,448)M(5168,448)M(4627,448)M(4633,448)M(4645,448)M(4618,448)M(4619,448)M(4620,448)
+M(4621,448)M(4623,448)M(4624,448)M(4625,448)M(4622,448)M(4626,448)M(4640,448)M(4629,448)M(4630,448)M(4631,448)
+M(4632,448)M(4628,448)M(4634,448)M(4636,448)M(4637,448)M(4638,448)M(4639,448)M(4635,448)M(4641,448)M(4643,448)
+M(4642,448)M(4644,448)M(4646,448)M(4647,448)M(4648,448)M(5989,448)M(5990,448)M(5991,448)M(5992,448)M(5993,448)
+M(5994,448)M(5995,448)M(6105,448)M(5996,448)M(6106,448)M(5312,448)M(5464,448)M(5313,448)M(5465,448)M(5314,448)
+M(5466,448)M(5315,448)M(5467,448)M(5316,448)M(5468,448)M(5317,448)M(5469,448)M(5318,448)M(5470,448)M(5319,448)
+M(5471,448)M(4882,448)M(4883,448)M(4885,448)M(4884,448)M(6112,448)M(5883,448)M(5884,448)M(5018,448)M(5169,448)
+M(5019,448)M(5170,448)M(5020,448)M(5171,448)M(5021,448)M(5172,448)M(5022,448)M(5173,448)M(5023,448)M(5174,448)
+M(5024,448)M(5175,448)M(5025,448)M(5176,448)M(4658,448)M(4664,448)M(4676,448)M(4649,448)M(4650,448)M(4651,448)
+M(4652,448)M(4654,448)M(4655,448)M(4656,448)M(4653,448)M(4657,448)M(4671,448)M(4660,448)M(4661,448)M(4662,448)
+M(4663,448)M(4659,448)M(4665,448)M(4667,448)M(4668,448)M(4669,448)M(4670,448)M(4666,448)M(4672,448)M(4674,448)
+M(4673,448)M(4675,448)M(4677,448)M(4678,448)M(4679,448)M(5997,448)M(5998,448)M(5999,448)M(6000,448)M(6001,448)
+M(6002,448)M(6003,448)M(6107,448)M(6004,448)M(6108,448)M(5320,448)M(5472,448)M(5321,448)M(5473,448)M(5322,448)
+M(5474,448)M(5323,448)M(5475,448)M(5324,448)M(5476,448)M(5325,448)M(5477,448)M(5326,448)M(5478,448)M(5327,448)
+M(5479,448)M(4886,448)M(4887,448)M(4889,448)M(4888,448)M(4689,448)M(4693,448)M(4699,448)M(4713,448)M(4681,448)
+M(4682,448)M(4683,448)M(4684,448)M(4686,448)M(4688,448)M(4685,448)M(4687,448)M(4690,448)M(4706,448)M(4691,448)
+M(4692,448)M(4695,448)M(4696,448)M(4697,448)M(4698,448)M(4694,448)M(4700,448)M(4702,448)M(4703,448)M(4704,448)
+M(4705,448)M(4701,448)M(4680,448)M(4710,448)M(4707,448)M(4709,448)M(4708,448)M(4712,448)M(4711,448)M(4714,448)
+M(4715,448)M(4716,448)M(4717,448)M(4718,448)M(4818,448)M(5885,448)M(5886,448)M(5026,448)M(5177,448)M(5027,448)
+M(5178,448)M(5028,448)M(5179,448)M(5029,448)M(5180,448)M(5030,448)M(5181,448)M(5031,448)M(5182,448)M(5032,448)
+M(5183,448)M(5033,448)M(5184,448)M(5034,448)M(5185,448)M(5035,448)M(5186,448)M(5036,448)M(5187,448)M(5037,448)
+M(5188,448)M(5038,448)M(5189,448)M(5039,448)M(5190,448)M(4728,448)M(4730,448)M(4736,448)M(4748,448)M(4719,448)
+M(4720,448)M(4721,448)M(4722,448)M(4724,448)M(4726,448)M(4727,448)M(4723,448)M(4725,448)M(4729,448)M(4743,448)
+M(4732,448)M(4733,448)M(4734,448)M(4735,448)M(4731,448)M(4737,448)M(4739,448)M(4740,448)M(4741,448)M(4742,448)
+M(4738,448)M(4744,448)M(4746,448)M(4745,448)M(4747,448)M(4749,448)M(4750,448)M(4751,448)M(4752,448)M(4753,448)
+M(6005,448)M(6006,448)M(6007,448)M(6008,448)M(6009,448)M(6010,448)M(6011,448)M(6012,448)M(6013,448)M(6014,448)
+M(6015,448)M(6016,448)M(6017,448)M(6109,448)M(6018,448)M(6110,448)M(5328,448)M(5480,448)M(5329,448)M(5481,448)
+M(5330,448)M(5482,448)M(5331,448)M(5483,448)M(5332,448)M(5484,448)M(5333,448)M(5485,448)M(5334,448)M(5486,448)
+M(5335,448)M(5487,448)M(5336,448)M(5488,448)M(5337,448)M(5489,448)M(5338,448)M(5490,448)M(5339,448)M(5491,448)
+M(5340,448)M(5492,448)M(5341,448)M(5493,448)M(4819,448)M(4890,448)M(4892,448)M(4896,448)M(4895,448)M(4891,448)
+M(4893,448)M(4894,448)M(5887,448)M(5040,448)M(5191,448)M(5041,448)M(5192,448)M(5042,448)M(5193,448)M(5043,448)
+M(5194,448)M(5044,448)M(5195,448)M(5045,448)M(5196,448)M(5046,448)M(5197,448)M(5047,448)M(5198,448)M(5048,448)
+M(5199,448)M(5049,448)M(5200,448)M(5050,448)M(5201,448)M(5051,448)M(5202,448)M(5052,448)M(5203,448)M(5053,448)
+M(5204,448)M(4763,448)M(4765,448)M(4771,448)M(4783,448)M(4754,448)M(4755,448)M(4756,448)M(4757,448)M(4759,448)
+M(4761,448)M(4762,448)M(4758,448)M(4760,448)M(4764,448)M(4778,448)M(4767,448)M(4768,448)M(4769,448)M(4770,448)
+M(4766,448)M(4772,448)M(4774,448)M(4775,448)M(4776,448)M(4777,448)M(4773,448)M(4779,448)M(4781,448)M(4780,448)
+M(4782,448)M(4784,448)M(4785,448)M(4786,448)M(4787,448)M(4788,448)M(6019,448)M(6020,448)M(6021,448)M(6022,448)
+M(6023,448)M(6024,448)M(6025,448)M(6026,448)M(6027,448)M(6028,448)M(6029,448)M(6030,448)M(6031,448)M(6032,448)
+M(6111,448)M(5342,448)M(5494,448)M(5343,448)M(5495,448)M(5344,448)M(5496,448)M(5345,448)M(5497,448)M(5346,448)
+M(5498,448)M(5347,448)M(5499,448)M(5348,448)M(5500,448)M(5349,448)M(5501,448)M(5350,448)M(5502,448)M(5351,448)
+M(5503,448)M(5352,448)M(5504,448)M(5353,448)M(5505,448)M(5354,448)M(5506,448)M(5355,448)M(5507,448)M(4820,448)
+M(4897,448)M(4899,448)M(4903,448)M(4902,448)M(4898,448)M(4900,448)M(4901,448)M(3778,448)M(3779,448)M(3781,448)
+M(3777,448)M(3785,448)M(3780,448)M(3783,448)M(359,455)M(376,455)M(375,455)M(378,455)M(377,455)M(396,455)
+M(401,455)M(231,463)M(241,463)M(242,463)M(233,463)M(234,463)M(299,463)M(232,463)M(300,463)M(311,479)
+M(312,479)M(3690,486)M(3681,486)M(3682,486)M(3683,486)M(3685,486)M(3684,486)M(3689,486)M(3691,486)M(3686,486)
+M(3687,486)M(3688,486)M(3692,486)M(3702,486)M(3693,486)M(3694,486)M(3695,486)M(3697,486)M(3696,486)M(3701,486)
+M(3703,486)M(3698,486)M(3699,486)M(3700,486)M(3704,486)M(3714,486)M(3705,486)M(3706,486)M(3707,486)M(3709,486)
+M(3708,486)M(3713,486)M(3715,486)M(3710,486)M(3711,486)M(3712,486)M(3716,486)M(3726,486)M(3717,486)M(3718,486)
+M(3719,486)M(3721,486)M(3720,486)M(3727,486)M(3725,486)M(3722,486)M(3723,486)M(3724,486)M(3728,486)M(3585,487)
+M(3581,487)M(3588,487)M(3589,487)M(349,487)M(389,487)M(2625,487)M(2727,487)M(2913,487)M(2648,487)M(2749,487)
+M(2936,487)M(2659,487)M(2763,487)M(2947,487)M(2669,487)M(2777,487)M(2957,487)M(2678,487)M(2679,487)M(2680,487)
+M(2681,487)M(2682,487)M(2683,487)M(2684,487)M(2786,487)M(2787,487)M(2788,487)M(2789,487)M(2790,487)M(2966,487)
+M(2791,487)M(2967,487)M(2792,487)M(2968,487)M(2793,487)M(2969,487)M(2794,487)M(2795,487)M(2971,487)M(2796,487)
+M(2972,487)M(2687,487)M(2688,487)M(2689,487)M(2691,487)M(2692,487)M(2804,487)M(2805,487)M(2975,487)M(2806,487)
+M(2976,487)M(2807,487)M(2977,487)M(2809,487)M(2979,487)M(2810,487)M(2980,487)M(2695,487)M(2696,487)M(2698,487)
+M(2699,487)M(2818,487)M(2819,487)M(2820,487)M(2983,487)M(2821,487)M(2984,487)M(2823,487)M(2986,487)M(2824,487)
+M(2987,487)M(2702,487)M(2704,487)M(2705,487)M(2832,487)M(2833,487)M(2834,487)M(2835,487)M(2990,487)M(2837,487)
+M(2992,487)M(2838,487)M(2993,487)M(2713,487)M(2714,487)M(2858,487)M(2859,487)M(2860,487)M(2861,487)M(2863,487)
+M(3001,487)M(2864,487)M(3002,487)M(2717,487)M(2872,487)M(2873,487)M(2874,487)M(2875,487)M(2877,487)M(2878,487)
+M(3005,487)M(354,487)M(355,487)M(357,487)M(356,487)M(342,487)M(3599,487)M(3598,487)M(3597,487)M(3595,487)
+M(3594,487)M(3593,487)M(3592,487)M(3617,487)M(3456,487)M(3457,487)M(3453,487)M(3452,487)M(3615,487)M(3616,487)
+M(351,487)M(3458,487)M(927,487)M(938,487)M(956,487)M(919,487)M(924,487)M(923,487)M(933,487)M(928,487)
+M(932,487)M(931,487)M(940,487)M(939,487)M(935,487)M(934,487)M(937,487)M(936,487)M(913,487)M(957,487)
+M(962,487)M(959,487)M(961,487)M(960,487)M(1782,487)M(3015,487)M(1873,487)M(2063,487)M(654,487)M(658,487)
+M(684,487)M(682,487)M(3117,487)M(3303,487)M(2249,487)M(2435,487)M(696,487)M(3582,487)M(3038,487)M(1897,487)
+M(2085,487)M(726,487)M(730,487)M(756,487)M(754,487)M(3139,487)M(3326,487)M(2271,487)M(2459,487)M(3049,487)
+M(1911,487)M(2099,487)M(777,487)M(788,487)M(806,487)M(1774,487)M(769,487)M(774,487)M(783,487)M(778,487)
+M(782,487)M(781,487)M(790,487)M(789,487)M(785,487)M(784,487)M(787,487)M(786,487)M(763,487)M(807,487)
+M(808,487)M(812,487)M(811,487)M(810,487)M(3153,487)M(3337,487)M(2285,487)M(2473,487)M(3059,487)M(1925,487)
+M(2113,487)M(845,487)M(1779,487)M(863,487)M(831,487)M(839,487)M(847,487)M(842,487)M(820,487)M(864,487)
+M(869,487)M(3167,487)M(3347,487)M(2299,487)M(2487,487)M(3068,487)M(3069,487)M(3070,487)M(3071,487)M(3072,487)
+M(3073,487)M(3074,487)M(1934,487)M(2122,487)M(1935,487)M(2123,487)M(1936,487)M(2124,487)M(1937,487)M(2125,487)
+M(1938,487)M(2126,487)M(1939,487)M(2127,487)M(1940,487)M(2128,487)M(1941,487)M(2129,487)M(1942,487)M(1943,487)
+M(2131,487)M(1944,487)M(2132,487)M(881,487)M(885,487)M(889,487)M(895,487)M(898,487)M(907,487)M(3176,487)
+M(3177,487)M(3178,487)M(3179,487)M(3180,487)M(3356,487)M(3181,487)M(3357,487)M(3182,487)M(3358,487)M(3183,487)
+M(3359,487)M(3184,487)M(3185,487)M(3361,487)M(3186,487)M(3362,487)M(2308,487)M(2496,487)M(2309,487)M(2497,487)
+M(2310,487)M(2498,487)M(2311,487)M(2499,487)M(2312,487)M(2500,487)M(2313,487)M(2501,487)M(2314,487)M(2502,487)
+M(2315,487)M(2503,487)M(2316,487)M(2317,487)M(2505,487)M(2318,487)M(2506,487)M(1778,487)M(1840,487)M(1046,487)
+M(1041,487)M(1045,487)M(1053,487)M(1052,487)M(1048,487)M(1050,487)M(1049,487)M(3600,487)M(3077,487)M(3078,487)
+M(3079,487)M(3081,487)M(3082,487)M(1952,487)M(2140,487)M(1953,487)M(2141,487)M(1954,487)M(2142,487)M(1955,487)
+M(2143,487)M(1957,487)M(2145,487)M(1958,487)M(2146,487)M(984,487)M(995,487)M(1788,487)M(1013,487)M(3403,487)
+M(976,487)M(981,487)M(980,487)M(990,487)M(985,487)M(989,487)M(988,487)M(997,487)M(996,487)M(992,487)
+M(991,487)M(994,487)M(993,487)M(970,487)M(1014,487)M(1015,487)M(1019,487)M(1016,487)M(1018,487)M(1017,487)
+M(3194,487)M(3195,487)M(3365,487)M(3196,487)M(3366,487)M(3197,487)M(3367,487)M(3199,487)M(3369,487)M(3200,487)
+M(3370,487)M(2326,487)M(2514,487)M(2327,487)M(2515,487)M(2328,487)M(2516,487)M(2329,487)M(2517,487)M(2331,487)
+M(2519,487)M(2332,487)M(2520,487)M(1783,487)M(3601,487)M(1842,487)M(1843,487)M(1844,487)M(3085,487)M(3086,487)
+M(3088,487)M(3089,487)M(1966,487)M(2154,487)M(1967,487)M(2155,487)M(1968,487)M(2156,487)M(1969,487)M(2157,487)
+M(1971,487)M(2159,487)M(1972,487)M(2160,487)M(1097,487)M(1108,487)M(1787,487)M(1126,487)M(1089,487)M(1094,487)
+M(1093,487)M(1103,487)M(1098,487)M(1102,487)M(1101,487)M(1110,487)M(1109,487)M(1105,487)M(1104,487)M(1107,487)
+M(1106,487)M(1083,487)M(1127,487)M(1128,487)M(1132,487)M(1129,487)M(1131,487)M(1130,487)M(3414,487)M(3208,487)
+M(3209,487)M(3210,487)M(3373,487)M(3211,487)M(3374,487)M(3213,487)M(3376,487)M(3214,487)M(3377,487)M(2340,487)
+M(2528,487)M(2341,487)M(2529,487)M(2342,487)M(2530,487)M(2343,487)M(2531,487)M(2345,487)M(2533,487)M(2346,487)
+M(2534,487)M(1786,487)M(3602,487)M(1845,487)M(1846,487)M(1847,487)M(3420,487)M(3421,487)M(3419,487)M(3418,487)
+M(3417,487)M(3416,487)M(1793,487)M(3092,487)M(3094,487)M(3095,487)M(1980,487)M(2168,487)M(1981,487)M(2169,487)
+M(1982,487)M(2170,487)M(1983,487)M(2171,487)M(1985,487)M(2173,487)M(1986,487)M(2174,487)M(1266,487)M(1277,487)
+M(1795,487)M(1295,487)M(1258,487)M(1263,487)M(1262,487)M(1272,487)M(1267,487)M(1271,487)M(1270,487)M(1279,487)
+M(1278,487)M(1274,487)M(1273,487)M(1276,487)M(1275,487)M(1252,487)M(1296,487)M(1297,487)M(1301,487)M(1298,487)
+M(1300,487)M(1299,487)M(3461,487)M(3222,487)M(3223,487)M(3224,487)M(3225,487)M(3380,487)M(3227,487)M(3382,487)
+M(3228,487)M(3383,487)M(2354,487)M(2542,487)M(2355,487)M(2543,487)M(2356,487)M(2544,487)M(2357,487)M(2545,487)
+M(2359,487)M(2547,487)M(2360,487)M(2548,487)M(1794,487)M(3460,487)M(3462,487)M(1154,487)M(1165,487)M(1790,487)
+M(1183,487)M(1146,487)M(1151,487)M(1150,487)M(1160,487)M(1155,487)M(1159,487)M(1158,487)M(1167,487)M(1166,487)
+M(1162,487)M(1161,487)M(1164,487)M(1163,487)M(1140,487)M(1184,487)M(1185,487)M(1189,487)M(1186,487)M(1188,487)
+M(1187,487)M(1789,487)M(3603,487)M(3432,487)M(3433,487)M(3429,487)M(3428,487)M(3622,487)M(3618,487)M(3426,487)
+M(3427,487)M(3423,487)M(3422,487)M(3623,487)M(3619,487)M(1209,487)M(1220,487)M(1792,487)M(1238,487)M(1202,487)
+M(1206,487)M(1205,487)M(1215,487)M(1210,487)M(1214,487)M(1213,487)M(1222,487)M(1221,487)M(1217,487)M(1216,487)
+M(1219,487)M(1218,487)M(1197,487)M(1239,487)M(1240,487)M(1244,487)M(1241,487)M(1243,487)M(1242,487)M(1791,487)
+M(1854,487)M(1855,487)M(1856,487)M(615,487)M(609,487)M(610,487)M(620,487)M(616,487)M(619,487)M(618,487)
+M(626,487)M(625,487)M(622,487)M(621,487)M(624,487)M(623,487)M(605,487)M(642,487)M(643,487)M(644,487)
+M(645,487)M(647,487)M(648,487)M(1768,487)M(1851,487)M(1852,487)M(1853,487)M(1451,487)M(1445,487)M(1446,487)
+M(1456,487)M(1452,487)M(1455,487)M(1454,487)M(1462,487)M(1461,487)M(1458,487)M(1457,487)M(1460,487)M(1459,487)
+M(1441,487)M(1478,487)M(1479,487)M(1480,487)M(1481,487)M(1483,487)M(1484,487)M(1812,487)M(1848,487)M(1849,487)
+M(1850,487)M(3444,487)M(3445,487)M(3441,487)M(3440,487)M(3620,487)M(3624,487)M(3438,487)M(3439,487)M(3435,487)
+M(3434,487)M(3621,487)M(3625,487)M(3596,487)M(1994,487)M(2181,487)M(1362,487)M(1367,487)M(1363,487)M(1366,487)
+M(1373,487)M(1372,487)M(1369,487)M(1371,487)M(1370,487)M(3412,487)M(1406,487)M(1411,487)M(1407,487)M(1410,487)
+M(1417,487)M(1416,487)M(1413,487)M(1415,487)M(1414,487)M(1318,487)M(1323,487)M(1319,487)M(1322,487)M(1329,487)
+M(1328,487)M(1325,487)M(1327,487)M(1326,487)M(3583,487)M(3584,487)M(3450,487)M(3451,487)M(3447,487)M(3446,487)
+M(1811,487)M(3587,487)M(3606,487)M(3590,487)M(3586,487)M(3613,487)M(3612,487)M(3611,487)M(3610,487)M(3614,487)
+M(3609,487)M(3608,487)M(3413,487)M(3103,487)M(3104,487)M(2008,487)M(2194,487)M(2009,487)M(2195,487)M(2010,487)
+M(2196,487)M(2011,487)M(2197,487)M(2013,487)M(2199,487)M(2014,487)M(2200,487)M(1500,487)M(1511,487)M(1817,487)
+M(1529,487)M(3415,487)M(1492,487)M(1497,487)M(1496,487)M(1506,487)M(1501,487)M(1505,487)M(1504,487)M(1513,487)
+M(1512,487)M(1508,487)M(1507,487)M(1510,487)M(1509,487)M(1486,487)M(1530,487)M(1531,487)M(1535,487)M(1532,487)
+M(1534,487)M(1533,487)M(3407,487)M(3408,487)M(3409,487)M(3410,487)M(3411,487)M(3248,487)M(3249,487)M(3406,487)
+M(3405,487)M(3250,487)M(3251,487)M(3253,487)M(3391,487)M(3254,487)M(3392,487)M(2380,487)M(2570,487)M(2381,487)
+M(2571,487)M(2382,487)M(2572,487)M(2383,487)M(2573,487)M(2385,487)M(2575,487)M(2386,487)M(2576,487)M(1814,487)
+M(3604,487)M(1857,487)M(1858,487)M(1859,487)M(3107,487)M(2022,487)M(2208,487)M(2023,487)M(2209,487)M(2024,487)
+M(2210,487)M(2025,487)M(2211,487)M(2027,487)M(2213,487)M(2028,487)M(2214,487)M(1557,487)M(1568,487)M(1816,487)
+M(1586,487)M(1549,487)M(1554,487)M(1553,487)M(1563,487)M(1558,487)M(1562,487)M(1561,487)M(1570,487)M(1569,487)
+M(1565,487)M(1564,487)M(1567,487)M(1566,487)M(1543,487)M(1587,487)M(1588,487)M(1592,487)M(1589,487)M(1591,487)
+M(1590,487)M(3404,487)M(3262,487)M(3263,487)M(3264,487)M(3265,487)M(3267,487)M(3268,487)M(3395,487)M(2394,487)
+M(2584,487)M(2395,487)M(2585,487)M(2396,487)M(2586,487)M(2397,487)M(2587,487)M(2399,487)M(2589,487)M(2400,487)
+M(2590,487)M(1815,487)M(3605,487)M(1860,487)M(1861,487)M(1862,487)M(1619,487)M(1614,487)M(1618,487)M(1626,487)
+M(1625,487)M(1621,487)M(1623,487)M(1622,487)M(1674,487)M(1669,487)M(1673,487)M(1672,487)M(1681,487)M(1680,487)
+M(1676,487)M(1675,487)M(1678,487)M(1677,487)M(1656,487)M(1698,487)M(1699,487)M(1731,487)M(1726,487)M(1730,487)
+M(1729,487)M(1738,487)M(1737,487)M(1733,487)M(1732,487)M(1735,487)M(1734,487)M(1711,487)M(1755,487)M(1756,487)
+M(3607,487)M(3464,487)M(348,487)M(353,487)M(341,487)M(340,487)M(358,487)M(343,487)M(158,511)M(157,511)
+M(251,511)M(272,511)M(30,511) M(294,511)M(310,511)M(216,511)M(217,511)M(214,511)M(221,511)M(219,511)
+M(220,511)M(218,511)M(215,511)M(213,511)M(271,511)M(224,511)M(225,511)M(223,511)M(228,511)M(222,511)
+M(229,511)M(230,511)M(156,511)M(155,511)M(277,511)M(278,511)M(276,511)M(160,511)M(167,511)M(165,511)
+M(166,511)M(164,511)M(161,511)M(159,511)M(304,511)M(162,511)M(163,511)M(178,511)M(185,511)M(183,511)
+M(184,511)M(182,511)M(179,511)M(177,511)M(180,511)M(181,511)M(169,511)M(176,511)M(174,511)M(175,511)
+M(173,511)M(170,511)M(168,511)M(171,511)M(172,511)M(196,511)M(203,511)M(201,511)M(202,511)M(200,511)
+M(197,511)M(195,511)M(198,511)M(199,511)M(187,511)M(194,511)M(192,511)M(193,511)M(191,511)M(188,511)
+M(186,511)M(189,511)M(190,511)M(295,511)M(205,511)M(212,511)M(210,511)M(211,511)M(209,511)M(206,511)
+M(204,511)M(309,511)M(207,511)M(208,511)M(303,511)M(302,511)M(301,511)M(296,511)M(298,511)M(297,511)
+M(257,511)M(266,511)M(252,511)M(256,511)M(258,511)M(267,511)M(265,511)M(264,511)M(255,511)M(275,511)
+M(262,511)M(263,511)M(253,511)M(254,511)M(259,511)M(268,511)M(279,511)M(273,511)M(274,511)M(270,511)
+M(269,511)M(83,63)  M(85,63)  M(84,63)  M(87,63)  M(86,63)  M(88,63)  M(27,63)  M(93,63)  M(74,63)  
+M(331,63) M(49,63)  M(323,63) M(329,63) M(54,63)  M(335,63) M(328,63) M(334,63) M(80,63)  M(226,63) 
+M(227,63) M(23,63)  M(306,63) M(243,63) M(244,63) M(245,63) M(246,63) M(247,63) M(248,63) M(249,63) 
+M(250,63) M(305,63) M(235,63) M(236,63) M(237,63) M(238,63) M(239,63) M(240,63) M(326,63) M(308,63) 
+M(284,63) M(286,63) M(285,63) M(287,63) M(288,63) M(289,63) M(291,63) M(290,63) M(292,63) M(293,63) 
+M(307,63) M(280,63) M(281,63) M(282,63) M(283,63) M(63,63)  M(64,63)  M(314,63) M(77,63)  M(26,63)  
+M(91,63)  M(90,63)  M(324,63) M(261,63) M(89,63)  M(327,63) M(330,63) M(315,63) M(316,63) M(106,63) 
+M(94,63)  M(53,63)  M(313,63) M(332,63) M(333,63) M(76,63)  M(22,63)  M(21,63)  M(69,63)  M(96,63)  
+M(107,63) M(61,63)  M(97,63)  M(98,63)  M(339,63) M(513,7)  M(515,7)  M(512,7)  M(514,7)  M(508,7)  
+M(510,7)  M(507,7)  M(509,7)  M(446,7)  M(445,7)  M(448,7)  M(447,7)  M(449,7)  M(453,7)  M(450,7)  
+M(452,7)  M(451,7)  M(464,7)  M(465,7)  M(462,7)  M(463,7)  M(460,7)  M(461,7)  M(458,7)  M(459,7)  
+M(456,7)  M(457,7)  M(454,7)  M(455,7)  M(469,7)  M(468,7)  M(466,7)  M(467,7)  M(470,7)  M(471,7)  
+M(473,7)  M(472,7)  M(481,7)  M(480,7)  M(479,7)  M(478,7)  M(477,7)  M(476,7)  M(475,7)  M(474,7)  
+M(482,7)  M(484,7)  M(483,7)  M(3468,7) M(3469,7) M(3470,7) M(3471,7) M(3467,7) M(3473,7) M(3474,7) 
+M(3475,7) M(3476,7) M(3472,7) M(3478,7) M(3477,7) M(3480,7) M(3481,7) M(3482,7) M(3483,7) M(3479,7) 
+M(3485,7) M(3486,7) M(3487,7) M(3488,7) M(3484,7) M(3490,7) M(3491,7) M(3492,7) M(3493,7) M(3489,7) 
+M(3495,7) M(3496,7) M(3497,7) M(3494,7) M(3504,7) M(3505,7) M(3506,7) M(3507,7) M(3503,7) M(3514,7) 
+M(3515,7) M(3516,7) M(3517,7) M(3513,7) M(3499,7) M(3500,7) M(3501,7) M(3502,7) M(3498,7) M(570,7)  
+M(3509,7) M(3510,7) M(3511,7) M(3512,7) M(3508,7) M(3529,7) M(3530,7) M(3531,7) M(3532,7) M(3528,7) 
+M(3629,7) M(3519,7) M(3520,7) M(3521,7) M(3522,7) M(3518,7) M(3534,7) M(3535,7) M(3536,7) M(3537,7) 
+M(3533,7) M(3539,7) M(3540,7) M(3541,7) M(3542,7) M(3538,7) M(3524,7) M(3525,7) M(3526,7) M(3527,7) 
+M(3523,7) M(571,7)  M(3466,7) M(3465,7) M(574,7)  M(3550,7) M(3549,7) M(577,7)  M(3628,7) M(3546,7) 
+M(3545,7) M(533,7)  M(3548,7) M(3547,7) M(535,7)  M(3544,7) M(3543,7) M(534,7)  M(415,7)  M(414,7)  
+M(3552,7) M(3553,7) M(3554,7) M(3555,7) M(3551,7) M(572,7)  M(573,7)  M(575,7)  M(576,7)  M(3557,7) 
+M(3558,7) M(3559,7) M(3560,7) M(3556,7) M(3562,7) M(3563,7) M(3564,7) M(3565,7) M(3561,7) M(600,7)  
+M(601,7)  M(3567,7) M(3568,7) M(3569,7) M(3570,7) M(3566,7) M(578,7)  M(3572,7) M(3573,7) M(3574,7) 
+M(3575,7) M(3571,7) M(3577,7) M(3578,7) M(3579,7) M(3580,7) M(3576,7) M(361,7)  M(365,7)  M(371,7)  
+M(370,7)  M(363,7)  M(367,7)  M(384,7)  M(360,7)  M(364,7)  M(368,7)  M(411,7)  M(369,7)  M(374,7)  
+M(380,7)  M(409,7)  M(381,7)  M(382,7)  M(352,7)  M(372,7)  M(362,7)  M(366,7)  M(388,7)  M(387,7)  
+M(386,7)  M(410,7)  M(393,7)  M(394,7)  M(397,7)  M(399,7)  M(398,7)  M(400,7)  M(383,7)  M(402,7)  
+M(404,7)  M(403,7)  M(373,7)  M(75,9)   M(66,9)   M(46,9)   M(322,9)  M(70,9)   M(33,9)   M(24,9)   
+M(25,9)   M(40,9)   M(99,9)   M(100,9)  M(42,9)   M(41,9)   M(43,9)   M(44,9)   M(45,9)   M(82,9)   
+M(92,9)   M(319,9)  M(31,9)   M(101,9)  M(318,9)  M(65,9)   M(321,9)  M(320,9)  M(67,9)   M(32,9)   
+M(48,9)   M(102,9)  M(60,9)   M(47,9)   M(71,9)   
+        #undef M
+default: break;
+    }
+    unreachable_helper();
+    return Value_t{};
+
+}
+#ifdef FP_TEST_WANT_DOUBLE_TYPE
+  template double evaluate_test<double>(unsigned,const double *);
+#endif
+#ifdef FP_TEST_WANT_FLOAT_TYPE
+  template float evaluate_test<float>(unsigned,const float *);
+#endif
+#ifdef FP_TEST_WANT_LONG_DOUBLE_TYPE
+  template long double evaluate_test<long double>(unsigned,const long double *);
+#endif
+#ifdef FP_TEST_WANT_LONG_INT_TYPE
+  template long evaluate_test<long>(unsigned,const long *);
+#endif
+#ifdef FP_TEST_WANT_GMP_INT_TYPE
+  template GmpInt evaluate_test<GmpInt>(unsigned,const GmpInt *);
+#endif
+#ifdef FP_TEST_WANT_MPFR_FLOAT_TYPE
+  template MpfrFloat evaluate_test<MpfrFloat>(unsigned,const MpfrFloat *);
+#endif
+#ifdef FP_TEST_WANT_COMPLEX_LONG_DOUBLE_TYPE
+  template std::complex<long double> evaluate_test<std::complex<long double>>(unsigned,const std::complex<long double> *);
+#endif
+#ifdef FP_TEST_WANT_COMPLEX_FLOAT_TYPE
+  template std::complex<float> evaluate_test<std::complex<float>>(unsigned,const std::complex<float> *);
+#endif
+#ifdef FP_TEST_WANT_COMPLEX_DOUBLE_TYPE
+  template std::complex<double> evaluate_test<std::complex<double>>(unsigned,const std::complex<double> *);
+#endif
+
+#endif
@@ -0,0 +1,268 @@
+
+#include "testbed_autogen.hh"
+#include "testbed_cpptest.hh"
+#include "testbed_const2.hh"
+
+#if !(0) // No "if constexpr"
+#define M(n) T##n(case n:return,;)
+#if(0||defined(FP_TEST_WANT_FLOAT_TYPE))
+template<typename Value_t>
+Value_t evaluator<Value_t,2>::calc(unsigned which, const Value_t* vars)
+{
+    static const_container<Value_t> c;
+
+    [[maybe_unused]] static thread_local Value_t uparam[10];
+
+    using namespace FUNCTIONPARSERTYPES;
+    switch(which) {
+M(418) M(83)  M(85)  M(84)  
+M(87)  M(86)  M(88)  M(419) M(27)  M(3638)M(3644)M(158) M(537) M(78)  M(93)  M(74)  M(157) M(3585)M(3581)
+M(331) M(3588)M(3589)M(251) M(272) M(405) M(385) M(538) M(491) M(49)  M(349) M(3651)M(3649)M(323) M(392) 
+M(390) M(389) M(2621)M(2622)M(2623)M(2624)M(2625)M(2626)M(2627)M(2628)M(2629)M(2630)M(2631)M(2632)M(2633)
+M(2723)M(2909)M(2724)M(2910)M(2725)M(2911)M(2726)M(2912)M(2727)M(2913)M(2728)M(2914)M(2729)M(2915)M(2730)
+M(2916)M(2731)M(2917)M(2732)M(2918)M(2733)M(2919)M(2734)M(2920)M(2735)M(2921)M(2634)M(2635)M(2636)M(2637)
+M(2638)M(2639)M(2640)M(2641)M(2642)M(2643)M(2644)M(2922)M(2736)M(2923)M(2737)M(2924)M(2738)M(2925)M(2739)
+M(2926)M(2740)M(2927)M(2928)M(2741)M(2929)M(2742)M(2930)M(2743)M(2931)M(2744)M(2932)M(2645)M(2646)M(2647)
+M(2648)M(2649)M(2650)M(2651)M(2652)M(2653)M(2654)M(2655)M(2656)M(2745)M(2746)M(2933)M(2747)M(2934)M(2748)
+M(2935)M(2749)M(2936)M(2750)M(2937)M(2751)M(2938)M(2752)M(2939)M(2753)M(2940)M(2754)M(2941)M(2755)M(2942)
+M(2756)M(2943)M(2757)M(2944)M(2657)M(2658)M(2659)M(2660)M(2661)M(2662)M(2663)M(2664)M(2665)M(2666)M(2667)
+M(2758)M(2759)M(2760)M(2761)M(2945)M(2762)M(2946)M(2763)M(2947)M(2764)M(2948)M(2765)M(2949)M(2766)M(2950)
+M(2767)M(2951)M(2768)M(2952)M(2769)M(2953)M(2770)M(2954)M(2771)M(2955)M(2668)M(2669)M(2670)M(2671)M(2672)
+M(2673)M(2674)M(2675)M(2676)M(2677)M(2772)M(2773)M(2774)M(2775)M(2776)M(2956)M(2777)M(2957)M(2778)M(2958)
+M(2779)M(2959)M(2780)M(2960)M(2781)M(2961)M(2782)M(2962)M(2783)M(2963)M(2784)M(2964)M(2785)M(2965)M(2678)
+M(2679)M(2680)M(2681)M(2682)M(2683)M(2684)M(2685)M(2686)M(2786)M(2787)M(2788)M(2789)M(2790)M(2966)M(2791)
+M(2967)M(2792)M(2968)M(2793)M(2969)M(2794)M(2970)M(2795)M(2971)M(2796)M(2972)M(2797)M(2973)M(2798)M(2974)
+M(541) M(391) M(2687)M(2688)M(2689)M(2690)M(2691)M(2692)M(2693)M(2694)M(2799)M(2800)M(2801)M(2802)M(2803)
+M(2804)M(2805)M(2975)M(2806)M(2976)M(2807)M(2977)M(2808)M(2978)M(2809)M(2979)M(2810)M(2980)M(2811)M(2981)
+M(2812)M(2982)M(2695)M(2696)M(2697)M(2698)M(2699)M(2700)M(2701)M(2813)M(2814)M(2815)M(2816)M(2817)M(2818)
+M(2819)M(2820)M(2983)M(2821)M(2984)M(2822)M(2985)M(2823)M(2986)M(2824)M(2987)M(2825)M(2988)M(2826)M(2989)
+M(2702)M(2703)M(2704)M(2705)M(2706)M(2707)M(2827)M(2828)M(2829)M(2830)M(2831)M(2832)M(2833)M(2834)M(2835)
+M(2990)M(2836)M(2991)M(2837)M(2992)M(2838)M(2993)M(2839)M(2994)M(2840)M(2995)M(544) M(2708)M(2709)M(2710)
+M(2711)M(2712)M(2841)M(2842)M(2843)M(2844)M(2845)M(2846)M(2847)M(2848)M(2996)M(2849)M(2997)M(2850)M(2998)
+M(2851)M(2999)M(2852)M(3000)M(2713)M(2714)M(2715)M(2716)M(2853)M(2854)M(2855)M(2856)M(2857)M(2858)M(2859)
+M(2860)M(2861)M(2862)M(2863)M(3001)M(2864)M(3002)M(2865)M(3003)M(2866)M(3004)M(597) M(2717)M(2718)M(2719)
+M(2867)M(2868)M(2869)M(2870)M(2871)M(2872)M(2873)M(2874)M(2875)M(2876)M(2877)M(2878)M(3005)M(2879)M(3006)
+M(2880)M(3007)M(596) M(2720)M(2721)M(2881)M(2882)M(2883)M(2884)M(2885)M(2886)M(2887)M(2888)M(2889)M(2890)
+M(2891)M(2892)M(2893)M(3008)M(2894)M(3009)M(599) M(2722)M(2895)M(2896)M(2897)M(2898)M(2899)M(2900)M(2901)
+M(2902)M(2903)M(2904)M(2905)M(2906)M(2907)M(2908)M(3010)M(598) M(354) M(customtest_index)M(355) M(357) M(356) M(342) 
+M(329) M(30)  M(294) M(3673)M(231) M(54)  M(3637)M(241) M(242) M(58)  M(59)  M(513) M(515) M(512) M(514) 
+M(233) M(234) M(56)  M(57)  M(508) M(510) M(507) M(509) M(335) M(3677)M(3675)M(3674)M(328) M(334) M(299) 
+M(80)  M(3597)M(3599)M(3598)M(3595)M(3592)M(3594)M(3593)M(310) M(3617)M(489) M(559) M(3647)M(3658)M(216) 
+M(217) M(214) M(221) M(219) M(220) M(218) M(215) M(213) M(3456)M(3457)M(3455)M(3454)M(3453)M(3452)M(224) 
+M(226) M(225) M(223) M(228) M(222) M(3458)M(227) M(229) M(230) M(271) M(37)  M(34)  M(38)  M(39)  M(35)  
+M(36)  M(446) M(445) M(448) M(447) M(449) M(453) M(450) M(452) M(451) M(464) M(465) M(462) M(463) M(460) 
+M(461) M(458) M(459) M(456) M(457) M(454) M(455) M(469) M(468) M(466) M(467) M(470) M(471) M(473) M(472) 
+M(481) M(480) M(479) M(478) M(477) M(476) M(475) M(474) M(482) M(484) M(483) M(3643)M(3615)M(3616)M(351) 
+M(3669)M(3642)M(3636)M(156) M(155) M(325) M(3660)M(379) M(72)  M(927) M(938) M(3468)M(3469)M(3470)M(3471)
+M(956) M(23)  M(3679)M(916) M(416) M(914) M(915) M(920) M(917) M(919) M(918) M(925) M(926) M(924) M(921) 
+M(922) M(912) M(923) M(930) M(929) M(933) M(928) M(932) M(931) M(940) M(939) M(935) M(934) M(3668)M(941) 
+M(942) M(944) M(945) M(943) M(947) M(946) M(937) M(936) M(948) M(949) M(951) M(952) M(950) M(913) M(957) 
+M(3467)M(954) M(955) M(953) M(958) M(962) M(959) M(961) M(960) M(964) M(963) M(968) M(965) M(967) M(966) 
+M(1782)M(3654)M(3011)M(3012)M(3013)M(3014)M(3015)M(3016)M(3017)M(3018)M(3019)M(3020)M(3021)M(3022)M(3023)
+M(1869)M(2059)M(1870)M(2060)M(1871)M(2061)M(1872)M(2062)M(1873)M(2063)M(1874)M(2064)M(1875)M(2065)M(1876)
+M(2066)M(1877)M(2067)M(1878)M(2068)M(1879)M(2069)M(1880)M(2070)M(1881)M(2071)M(661) M(667) M(3473)M(3474)
+M(3475)M(3476)M(1771)M(679) M(422) M(650) M(651) M(652) M(654) M(653) M(656) M(659) M(660) M(658) M(655) 
+M(649) M(657) M(664) M(663) M(665) M(662) M(668) M(666) M(669) M(670) M(671) M(672) M(674) M(675) M(673) 
+M(680) M(3472)M(677) M(678) M(676) M(681) M(684) M(682) M(683) M(686) M(685) M(687) M(689) M(688) M(1769)
+M(3113)M(3299)M(3114)M(3300)M(3115)M(3301)M(3116)M(3302)M(3117)M(3303)M(3118)M(3304)M(3119)M(3305)M(3120)
+M(3306)M(3121)M(3307)M(3122)M(3308)M(3123)M(3309)M(3124)M(3310)M(3125)M(3311)M(2245)M(2431)M(2246)M(2432)
+M(2247)M(2433)M(2248)M(2434)M(2249)M(2435)M(2250)M(2436)M(2251)M(2437)M(2252)M(2438)M(2253)M(2439)M(2254)
+M(2440)M(2255)M(2441)M(2256)M(2442)M(2257)M(2443)M(1824)M(1825)M(1826)M(3024)M(3025)M(3026)M(3027)M(3028)
+M(3029)M(3030)M(3031)M(3032)M(3033)M(3034)M(1882)M(1883)M(2072)M(1884)M(2073)M(1885)M(2074)M(1886)M(2075)
+M(1887)M(2076)M(1888)M(1889)M(2077)M(1890)M(2078)M(1891)M(2079)M(1892)M(2080)M(696) M(3478)M(424) M(691) 
+M(692) M(693) M(695) M(694) M(697) M(699) M(698) M(705) M(704) M(701) M(700) M(706) M(707) M(709) M(710) 
+M(708) M(712) M(711) M(703) M(702) M(713) M(690) M(716) M(3477)M(715) M(714) M(717) M(718) M(719) M(720) 
+M(3312)M(3126)M(3313)M(3127)M(3314)M(3128)M(3315)M(3129)M(3316)M(3130)M(3317)M(3318)M(3131)M(3319)M(3132)
+M(3320)M(3133)M(3321)M(3134)M(3322)M(2444)M(2258)M(2445)M(2259)M(2446)M(2260)M(2447)M(2261)M(2448)M(2262)
+M(2449)M(2450)M(2263)M(2451)M(2264)M(2452)M(2265)M(2453)M(2266)M(2454)M(1827)M(1828)M(1829)M(1770)M(3582)
+M(277) M(278) M(276) M(3035)M(3036)M(3037)M(3038)M(3039)M(3040)M(3041)M(3042)M(3043)M(3044)M(3045)M(3046)
+M(1893)M(2081)M(1894)M(2082)M(1895)M(2083)M(1896)M(2084)M(1897)M(2085)M(1898)M(2086)M(1899)M(2087)M(1900)
+M(2088)M(1901)M(2089)M(1902)M(2090)M(1903)M(2091)M(1904)M(2092)M(1905)M(2093)M(733) M(739) M(3480)M(3481)
+M(3482)M(3483)M(751) M(1775)M(430) M(722) M(723) M(724) M(726) M(725) M(728) M(731) M(732) M(730) M(727) 
+M(721) M(729) M(736) M(735) M(737) M(734) M(740) M(738) M(741) M(742) M(743) M(744) M(746) M(747) M(745) 
+M(752) M(3479)M(749) M(750) M(748) M(753) M(756) M(754) M(755) M(758) M(757) M(759) M(761) M(760) M(1772)
+M(3135)M(3136)M(3323)M(3137)M(3324)M(3138)M(3325)M(3139)M(3326)M(3140)M(3327)M(3141)M(3328)M(3142)M(3329)
+M(3143)M(3330)M(3144)M(3331)M(3145)M(3332)M(3146)M(3333)M(3147)M(3334)M(2267)M(2455)M(2268)M(2456)M(2269)
+M(2457)M(2270)M(2458)M(2271)M(2459)M(2272)M(2460)M(2273)M(2461)M(2274)M(2462)M(2275)M(2463)M(2276)M(2464)
+M(2277)M(2465)M(2278)M(2466)M(2279)M(2467)M(1830)M(1831)M(1832)M(3047)M(3048)M(3049)M(3050)M(3051)M(3052)
+M(3053)M(3054)M(3055)M(3056)M(3057)M(1906)M(2094)M(1907)M(2095)M(1908)M(2096)M(1909)M(2097)M(1910)M(2098)
+M(1911)M(2099)M(1912)M(2100)M(1913)M(2101)M(1914)M(2102)M(1915)M(2103)M(1916)M(2104)M(1917)M(2105)M(1918)
+M(2106)M(1919)M(2107)M(777) M(788) M(3485)M(3486)M(3487)M(3488)M(806) M(1774)M(432) M(766) M(764) M(765) 
+M(770) M(767) M(769) M(768) M(775) M(776) M(774) M(771) M(772) M(762) M(773) M(780) M(779) M(783) M(778) 
+M(782) M(781) M(790) M(789) M(785) M(784) M(791) M(792) M(794) M(795) M(793) M(797) M(796) M(787) M(786) 
+M(798) M(799) M(801) M(802) M(800) M(763) M(807) M(3484)M(804) M(805) M(803) M(808) M(812) M(809) M(811) 
+M(810) M(814) M(813) M(818) M(815) M(817) M(816) M(1773)M(3148)M(3149)M(3150)M(3151)M(3335)M(3152)M(3336)
+M(3153)M(3337)M(3154)M(3338)M(3155)M(3339)M(3156)M(3340)M(3157)M(3341)M(3158)M(3342)M(3159)M(3343)M(3160)
+M(3344)M(3161)M(3345)M(2280)M(2468)M(2281)M(2469)M(2282)M(2470)M(2283)M(2471)M(2284)M(2472)M(2285)M(2473)
+M(2286)M(2474)M(2287)M(2475)M(2288)M(2476)M(2289)M(2477)M(2290)M(2478)M(2291)M(2479)M(2292)M(2480)M(2293)
+M(2481)M(1833)M(1834)M(1835)M(3058)M(3059)M(3060)M(3061)M(3062)M(3063)M(3064)M(3065)M(3066)M(3067)M(1920)
+M(2108)M(1921)M(2109)M(1922)M(2110)M(1923)M(2111)M(1924)M(2112)M(1925)M(2113)M(1926)M(2114)M(1927)M(2115)
+M(1928)M(2116)M(1929)M(2117)M(1930)M(2118)M(1931)M(2119)M(1932)M(2120)M(1933)M(2121)M(1780)M(1781)M(834) 
+M(845) M(3490)M(3491)M(3492)M(3493)M(1779)M(863) M(436) M(823) M(821) M(822) M(827) M(824) M(826) M(825) 
+M(832) M(833) M(831) M(828) M(829) M(819) M(830) M(837) M(836) M(840) M(835) M(839) M(838) M(847) M(846) 
+M(842) M(841) M(848) M(849) M(851) M(852) M(850) M(854) M(853) M(844) M(843) M(855) M(856) M(858) M(859) 
+M(857) M(820) M(864) M(3489)M(861) M(862) M(860) M(865) M(869) M(866) M(868) M(867) M(871) M(870) M(875) 
+M(872) M(874) M(873) M(1776)M(3162)M(3163)M(3164)M(3165)M(3166)M(3346)M(3167)M(3347)M(3168)M(3348)M(3169)
+M(3349)M(3170)M(3350)M(3171)M(3351)M(3172)M(3352)M(3173)M(3353)M(3174)M(3354)M(3175)M(3355)M(2294)M(2482)
+M(2295)M(2483)M(2296)M(2484)M(2297)M(2485)M(2298)M(2486)M(2299)M(2487)M(2300)M(2488)M(2301)M(2489)M(2302)
+M(2490)M(2303)M(2491)M(2304)M(2492)M(2305)M(2493)M(2306)M(2494)M(2307)M(2495)M(1836)M(1837)M(1838)M(1777)
+M(3627)M(3671)M(437) M(1767)M(3641)M(3068)M(3069)M(3070)M(3071)M(3072)M(3073)M(3074)M(3075)M(3076)M(1934)
+M(2122)M(1935)M(2123)M(1936)M(2124)M(1937)M(2125)M(1938)M(2126)M(1939)M(2127)M(1940)M(2128)M(1941)M(2129)
+M(1942)M(2130)M(1943)M(2131)M(1944)M(2132)M(1945)M(2133)M(1946)M(2134)M(888) M(3495)M(3496)M(3497)M(441) 
+M(877) M(878) M(879) M(881) M(880) M(883) M(886) M(887) M(885) M(882) M(876) M(884) M(890) M(889) M(892) 
+M(891) M(893) M(894) M(895) M(896) M(898) M(899) M(897) M(903) M(3494)M(901) M(902) M(900) M(904) M(907) 
+M(905) M(906) M(908) M(909) M(911) M(910) M(1778)M(3176)M(3177)M(3178)M(3179)M(3180)M(3356)M(3181)M(3357)
+M(3182)M(3358)M(3183)M(3359)M(3184)M(3360)M(3185)M(3361)M(3186)M(3362)M(3187)M(3363)M(3188)M(3364)M(2308)
+M(2496)M(2309)M(2497)M(2310)M(2498)M(2311)M(2499)M(2312)M(2500)M(2313)M(2501)M(2314)M(2502)M(2315)M(2503)
+M(2316)M(2504)M(2317)M(2505)M(2318)M(2506)M(2319)M(2507)M(2320)M(2508)M(1839)M(1840)M(1841)M(1040)M(1051)
+M(3504)M(3505)M(3506)M(3507)M(1785)M(1069)M(442) M(1030)M(1028)M(1029)M(1034)M(1031)M(1033)M(1032)M(1039)
+M(1038)M(1035)M(1036)M(1026)M(1037)M(1043)M(1042)M(1046)M(1041)M(1045)M(1044)M(1053)M(1052)M(1048)M(1047)
+M(1054)M(1055)M(1057)M(1058)M(1056)M(1060)M(1059)M(1050)M(1049)M(1061)M(1062)M(1064)M(1065)M(1063)M(1027)
+M(1070)M(3503)M(1067)M(1068)M(1066)M(1071)M(1075)M(1072)M(1074)M(1073)M(1077)M(1076)M(1081)M(1078)M(1080)
+M(1079)M(1784)M(444) M(519) M(3514)M(3515)M(3516)M(3517)M(443) M(3513)M(3600)M(3690)M(3681)M(3682)M(3683)
+M(3685)M(3684)M(3689)M(3691)M(3686)M(3687)M(3688)M(3692)M(560) M(542) M(3077)M(3078)M(3079)M(3080)M(3081)
+M(3082)M(3083)M(3084)M(1947)M(2135)M(1948)M(2136)M(1949)M(2137)M(1950)M(2138)M(1951)M(2139)M(1952)M(2140)
+M(1953)M(2141)M(1954)M(2142)M(1955)M(2143)M(1956)M(2144)M(1957)M(2145)M(1958)M(2146)M(1959)M(2147)M(1960)
+M(2148)M(412) M(984) M(995) M(3499)M(3500)M(3501)M(3502)M(1788)M(1013)M(485) M(486) M(595) M(973) M(971) 
+M(3403)M(972) M(977) M(974) M(976) M(975) M(982) M(983) M(981) M(978) M(979) M(969) M(980) M(987) M(986) 
+M(990) M(985) M(989) M(988) M(997) M(996) M(992) M(991) M(998) M(999) M(1001)M(1002)M(1000)M(1004)M(1003)
+M(994) M(993) M(1005)M(1006)M(1008)M(1009)M(1007)M(970) M(1014)M(3498)M(1011)M(1012)M(1010)M(1015)M(1019)
+M(1016)M(1018)M(1017)M(1021)M(3401)M(1020)M(1025)M(1022)M(1024)M(1023)M(1783)M(3640)M(3189)M(3190)M(3191)
+M(3192)M(3193)M(3194)M(3195)M(3365)M(3196)M(3366)M(3197)M(3367)M(570) M(3198)M(3368)M(3199)M(3369)M(3200)
+M(3370)M(3201)M(3371)M(3202)M(3372)M(2321)M(2509)M(2322)M(2510)M(2323)M(2511)M(2324)M(2512)M(2325)M(2513)
+M(2326)M(2514)M(2327)M(2515)M(2328)M(2516)M(2329)M(2517)M(2330)M(2518)M(2331)M(2519)M(2332)M(2520)M(2333)
+M(2521)M(2334)M(2522)M(3601)M(1842)M(1843)M(1844)M(543) M(3085)M(3086)M(3087)M(3088)M(3089)M(3090)M(3091)
+M(1961)M(2149)M(1962)M(2150)M(1963)M(2151)M(1964)M(2152)M(1965)M(2153)M(1966)M(2154)M(1967)M(2155)M(1968)
+M(2156)M(1969)M(2157)M(1970)M(2158)M(1971)M(2159)M(1972)M(2160)M(1973)M(2161)M(1974)M(2162)M(413) M(1097)
+M(1108)M(3509)M(3510)M(3511)M(3512)M(1787)M(1126)M(487) M(488) M(1086)M(1084)M(426) M(1085)M(1090)M(1087)
+M(1089)M(3632)M(434) M(1088)M(1095)M(1096)M(1094)M(1091)M(1092)M(1082)M(1093)M(1100)M(1099)M(1103)M(1098)
+M(1102)M(1101)M(1110)M(1109)M(1105)M(1104)M(1111)M(1112)M(1114)M(1115)M(1113)M(1117)M(1116)M(1107)M(1106)
+M(1118)M(1119)M(1121)M(1122)M(1120)M(1083)M(1127)M(3508)M(1124)M(1125)M(1123)M(3633)M(1128)M(1132)M(1129)
+M(1131)M(1130)M(1134)M(3402)M(1133)M(1138)M(1135)M(1137)M(1136)M(3414)M(1786)M(3203)M(3204)M(3205)M(3206)
+M(3207)M(3208)M(3209)M(3210)M(3373)M(3211)M(3374)M(3212)M(3375)M(3213)M(3376)M(3214)M(3377)M(3215)M(3378)
+M(3216)M(3379)M(2335)M(2523)M(2336)M(2524)M(2337)M(2525)M(2338)M(2526)M(2339)M(2527)M(2340)M(2528)M(2341)
+M(2529)M(2342)M(2530)M(2343)M(2531)M(2344)M(2532)M(2345)M(2533)M(2346)M(2534)M(2347)M(2535)M(2348)M(2536)
+M(3602)M(1845)M(1846)M(1847)M(160) M(167) M(165) M(166) M(164) M(161) M(159) M(232) M(55)  M(3420)M(3421)
+M(3419)M(3418)M(3417)M(3416)M(1793)M(304) M(162) M(163) M(3092)M(3093)M(3094)M(3095)M(3096)M(3097)M(1975)
+M(2163)M(1976)M(2164)M(1977)M(2165)M(1978)M(2166)M(1979)M(2167)M(1980)M(2168)M(1981)M(2169)M(1982)M(2170)
+M(1983)M(2171)M(1984)M(2172)M(1985)M(2173)M(1986)M(2174)M(1987)M(2175)M(1988)M(2176)M(1266)M(1277)M(3529)
+M(3530)M(3531)M(3532)M(1795)M(1295)M(495) M(1255)M(1253)M(1254)M(1259)M(1256)M(1258)M(1257)M(1264)M(1265)
+M(1263)M(1260)M(1261)M(1251)M(1262)M(1269)M(1268)M(1272)M(1267)M(1271)M(1270)M(1279)M(1278)M(1274)M(1273)
+M(1280)M(1281)M(1283)M(1284)M(1282)M(1286)M(1285)M(1276)M(1275)M(1287)M(1288)M(1290)M(1291)M(1289)M(1252)
+M(1296)M(3528)M(532) M(1293)M(531) M(1294)M(528) M(1292)M(1297)M(1301)M(1298)M(1300)M(1299)M(1303)M(1302)
+M(1307)M(1304)M(1306)M(1305)M(1794)M(3461)M(3217)M(3218)M(3219)M(3220)M(3221)M(3222)M(3223)M(3224)M(3225)
+M(3380)M(3655)M(3226)M(3381)M(3227)M(3382)M(3228)M(3383)M(3229)M(3384)M(3230)M(3385)M(2349)M(2537)M(2350)
+M(2538)M(2351)M(2539)M(2352)M(2540)M(2353)M(2541)M(2354)M(2542)M(2355)M(2543)M(2356)M(2544)M(2357)M(2545)
+M(2358)M(2546)M(2359)M(2547)M(2360)M(2548)M(2361)M(2549)M(2362)M(2550)M(3460)M(428) M(3462)M(3629)M(1154)
+M(1165)M(3519)M(3520)M(3521)M(3522)M(1790)M(1183)M(496) M(1143)M(1141)M(1142)M(1147)M(1144)M(1146)M(1145)
+M(1152)M(1153)M(1151)M(1148)M(1149)M(1139)M(1150)M(1157)M(1156)M(1160)M(1155)M(1159)M(1158)M(1167)M(1166)
+M(1162)M(1161)M(1168)M(1169)M(1171)M(1172)M(1170)M(1174)M(1173)M(1164)M(1163)M(1175)M(1176)M(1178)M(1179)
+M(1177)M(1140)M(1184)M(3518)M(1181)M(1182)M(529) M(1180)M(1185)M(1189)M(1186)M(1188)M(1187)M(1191)M(1190)
+M(1195)M(1192)M(1194)M(1193)M(1789)M(429) M(506) M(520) M(3534)M(3535)M(3536)M(3537)M(505) M(3533)M(3603)
+M(3702)M(3693)M(3694)M(3695)M(3697)M(3696)M(3701)M(3703)M(3698)M(3699)M(3700)M(3704)M(178) M(185) M(183) 
+M(184) M(182) M(179) M(177) M(3432)M(3433)M(3431)M(3430)M(3429)M(3428)M(3622)M(3618)M(516) M(306) M(180) 
+M(181) M(243) M(244) M(245) M(246) M(247) M(248) M(249) M(250) M(169) M(176) M(174) M(175) M(173) M(170) 
+M(168) M(3426)M(3427)M(3425)M(3424)M(3423)M(3422)M(3463)M(3623)M(3619)M(511) M(305) M(171) M(172) M(235) 
+M(236) M(237) M(238) M(239) M(240) M(1796)M(1797)M(517) M(1799)M(1800)M(1798)M(521) M(3539)M(3540)M(3541)
+M(3542)M(3634)M(3538)M(3714)M(3705)M(3706)M(3707)M(3709)M(3708)M(3713)M(3715)M(3710)M(3711)M(3712)M(3716)
+M(1802)M(1801)M(1209)M(1220)M(3524)M(3525)M(3526)M(3527)M(1792)M(1238)M(1198)M(1199)M(1200)M(1202)M(1201)
+M(1207)M(1208)M(1206)M(1203)M(1204)M(1196)M(1205)M(1212)M(1211)M(1215)M(1210)M(1214)M(1213)M(1222)M(1221)
+M(1217)M(1216)M(1223)M(1224)M(1226)M(1227)M(1225)M(1229)M(1228)M(1219)M(1218)M(1230)M(1231)M(1233)M(1234)
+M(1232)M(1197)M(1239)M(3523)M(1236)M(1237)M(1235)M(1240)M(1244)M(1241)M(1243)M(1242)M(1246)M(1245)M(1250)
+M(1247)M(1249)M(1248)M(1791)M(571) M(1854)M(1855)M(1856)M(1803)M(1804)M(1806)M(1807)M(1805)M(524) M(3645)
+M(553) M(615) M(3466)M(606) M(607) M(608) M(609) M(613) M(614) M(610) M(611) M(604) M(612) M(617) M(620) 
+M(616) M(619) M(618) M(626) M(625) M(622) M(621) M(627) M(628) M(630) M(631) M(629) M(633) M(632) M(624) 
+M(623) M(634) M(635) M(637) M(638) M(636) M(605) M(642) M(3465)M(640) M(641) M(639) M(643) M(644) M(645) 
+M(646) M(647) M(648) M(1768)M(574) M(1851)M(1852)M(1853)M(1451)M(3550)M(1442)M(1443)M(1444)M(1445)M(1449)
+M(1450)M(1446)M(1447)M(1440)M(1448)M(1453)M(1456)M(1452)M(1455)M(1454)M(1462)M(1461)M(1458)M(1457)M(1463)
+M(1464)M(1466)M(1467)M(1465)M(1469)M(1468)M(1460)M(1459)M(1470)M(1471)M(1473)M(1474)M(1472)M(1441)M(1478)
+M(3549)M(1476)M(1477)M(1475)M(1479)M(1480)M(1481)M(1482)M(1483)M(1484)M(1812)M(577) M(1848)M(1849)M(1850)
+M(3459)M(196) M(203) M(201) M(202) M(200) M(197) M(195) M(3444)M(3628)M(3445)M(3443)M(3442)M(3441)M(3440)
+M(3591)M(326) M(3620)M(3624)M(536) M(308) M(198) M(199) M(284) M(286) M(285) M(287) M(288) M(289) M(291) 
+M(290) M(292) M(293) M(187) M(194) M(192) M(193) M(191) M(188) M(186) M(3438)M(3439)M(3437)M(3436)M(3435)
+M(3434)M(3621)M(3625)M(525) M(307) M(189) M(190) M(280) M(281) M(282) M(283) M(3596)M(3631)M(3098)M(3099)
+M(3100)M(3101)M(3102)M(1989)M(2177)M(1990)M(1991)M(2178)M(1992)M(2179)M(1993)M(2180)M(1994)M(2181)M(1995)
+M(2182)M(1996)M(2183)M(1997)M(2184)M(1998)M(1999)M(2185)M(2000)M(2186)M(2001)M(2187)M(2002)M(2188)M(1362)
+M(3546)M(526) M(1354)M(1355)M(1356)M(1357)M(1361)M(1358)M(1359)M(1352)M(1360)M(1364)M(1367)M(1363)M(1366)
+M(1365)M(1373)M(501) M(1372)M(1369)M(1368)M(1374)M(1375)M(1377)M(1378)M(1376)M(1380)M(1379)M(1371)M(1370)
+M(1381)M(1382)M(1384)M(1385)M(1383)M(1353)M(1389)M(3545)M(1387)M(1388)M(1386)M(533) M(581) M(1390)M(1391)
+M(1392)M(1393)M(1394)M(1395)M(1809)M(3231)M(3232)M(3233)M(3234)M(3235)M(3236)M(3237)M(3238)M(3386)M(3412)
+M(3239)M(3387)M(3240)M(3388)M(3241)M(3389)M(3242)M(3390)M(2363)M(2551)M(2552)M(2364)M(2553)M(2365)M(2554)
+M(2366)M(2555)M(2367)M(2556)M(2368)M(2557)M(2369)M(2558)M(2370)M(2559)M(2560)M(2371)M(2561)M(2372)M(2562)
+M(2373)M(2563)M(2374)M(2564)M(1406)M(3548)M(530) M(1398)M(1399)M(1400)M(1401)M(1405)M(1402)M(1403)M(1396)
+M(1404)M(1408)M(1411)M(1407)M(1410)M(1409)M(1417)M(503) M(1416)M(1413)M(1412)M(1418)M(1419)M(1421)M(1422)
+M(1420)M(1424)M(1423)M(1415)M(1414)M(1425)M(1426)M(1428)M(1429)M(1427)M(1397)M(1433)M(3547)M(1431)M(1432)
+M(1430)M(535) M(583) M(1434)M(1435)M(1436)M(1437)M(1438)M(1439)M(1810)M(1318)M(3544)M(527) M(1310)M(1311)
+M(1312)M(1313)M(1317)M(1314)M(1315)M(1308)M(1316)M(1320)M(1323)M(1319)M(1322)M(1321)M(1329)M(1328)M(502) 
+M(1325)M(498) M(1324)M(1330)M(1331)M(1333)M(1334)M(1332)M(1336)M(1335)M(1327)M(1326)M(1337)M(1338)M(1340)
+M(1341)M(1339)M(1309)M(1345)M(3543)M(1343)M(1344)M(1342)M(534) M(582) M(1346)M(1347)M(1348)M(1349)M(1350)
+M(1351)M(1808)M(3583)M(63)  M(295) M(3584)M(64)  M(314) M(3676)M(205) M(212) M(210) M(211) M(209) M(206) 
+M(204) M(300) M(81)  M(3450)M(3451)M(3449)M(3448)M(3447)M(3446)M(1811)M(309) M(207) M(208) M(77)  M(26)  
+M(417) M(3606)M(3587)M(90)  M(3590)M(91)  M(301) M(303) M(302) M(296) M(298) M(297) M(311) M(104) M(3586)
+M(324) M(3613)M(3612)M(3611)M(3610)M(3614)M(415) M(550) M(3609)M(3608)M(549) M(414) M(3667)M(3666)M(3413)
+M(587) M(586) M(557) M(556) M(552) M(3646)M(554) M(555) M(3652)M(1813)M(3639)M(3648)M(545) M(3103)M(3104)
+M(3105)M(3106)M(2003)M(2189)M(2004)M(2190)M(2005)M(2191)M(2006)M(2192)M(2007)M(2193)M(2008)M(2194)M(2009)
+M(2195)M(2010)M(2196)M(2011)M(2197)M(2012)M(2198)M(2013)M(2199)M(2014)M(2200)M(2015)M(2201)M(2016)M(2202)
+M(1500)M(1511)M(3552)M(3553)M(3554)M(3555)M(1817)M(1529)M(568) M(569) M(3653)M(1489)M(1487)M(1488)M(1493)
+M(1490)M(3415)M(1492)M(1491)M(1498)M(1499)M(1497)M(1494)M(1495)M(1485)M(1496)M(1503)M(1502)M(1506)M(1501)
+M(1505)M(1504)M(1513)M(1512)M(1508)M(1507)M(1514)M(1515)M(1517)M(1518)M(1516)M(1520)M(1519)M(1510)M(1509)
+M(1521)M(1522)M(1524)M(1525)M(1523)M(1486)M(1530)M(3551)M(1527)M(1528)M(1526)M(1531)M(1535)M(1532)M(1534)
+M(1533)M(1537)M(1536)M(1541)M(1538)M(1540)M(1539)M(1814)M(3407)M(3408)M(3409)M(3410)M(3411)M(3243)M(3244)
+M(3245)M(3246)M(3247)M(3248)M(3249)M(3405)M(572) M(3406)M(3250)M(3251)M(573) M(575) M(3252)M(3253)M(3391)
+M(3254)M(3392)M(3255)M(3393)M(3256)M(3394)M(2375)M(2565)M(2376)M(2566)M(2377)M(2567)M(2378)M(2568)M(2379)
+M(2569)M(2380)M(2570)M(2381)M(2571)M(2382)M(2572)M(2383)M(2573)M(2384)M(2574)M(2385)M(2575)M(2386)M(2576)
+M(2387)M(2577)M(2388)M(2578)M(576) M(3604)M(1857)M(1858)M(1859)M(3670)M(546) M(3107)M(3108)M(3109)M(2017)
+M(2203)M(2018)M(2204)M(2019)M(2205)M(2020)M(2206)M(2021)M(2207)M(2022)M(2208)M(2023)M(2209)M(2024)M(2210)
+M(2025)M(2211)M(2026)M(2212)M(2027)M(2213)M(2028)M(2214)M(2029)M(2215)M(2030)M(2216)M(1557)M(1568)M(3557)
+M(3558)M(3559)M(3560)M(1816)M(1586)M(579) M(580) M(1546)M(1544)M(427) M(1545)M(1550)M(1547)M(1549)M(1548)
+M(435) M(1555)M(1556)M(1554)M(1551)M(1552)M(1542)M(1553)M(1560)M(1559)M(1563)M(1558)M(1562)M(1561)M(1570)
+M(1569)M(1565)M(1564)M(1571)M(1572)M(1574)M(1575)M(1573)M(1577)M(1576)M(1567)M(1566)M(1578)M(1579)M(1581)
+M(1582)M(1580)M(1543)M(1587)M(3556)M(1584)M(1585)M(1583)M(1588)M(1592)M(1589)M(1591)M(1590)M(1594)M(1593)
+M(1598)M(1595)M(1597)M(1596)M(3404)M(1815)M(3257)M(3258)M(3259)M(3260)M(3261)M(3262)M(3263)M(3264)M(3265)
+M(3266)M(3267)M(3268)M(3395)M(3269)M(3396)M(3270)M(3397)M(2389)M(2579)M(2390)M(2580)M(2391)M(2581)M(2392)
+M(2582)M(2393)M(2583)M(2394)M(2584)M(2395)M(2585)M(2396)M(2586)M(2397)M(2587)M(2398)M(2588)M(2399)M(2589)
+M(2400)M(2590)M(2401)M(2591)M(2402)M(2592)M(3605)M(1860)M(1861)M(1862)M(1613)M(1624)M(3562)M(3563)M(3564)
+M(3565)M(1819)M(1642)M(585) M(1603)M(1601)M(1602)M(1607)M(1604)M(1606)M(1605)M(1612)M(1611)M(1608)M(1609)
+M(1599)M(1610)M(1616)M(1615)M(1619)M(1614)M(1618)M(1617)M(1626)M(1625)M(1621)M(1620)M(1627)M(1628)M(1630)
+M(1631)M(1629)M(1633)M(1632)M(1623)M(1622)M(1634)M(1635)M(1637)M(1638)M(1636)M(1600)M(1643)M(3561)M(1640)
+M(1641)M(1639)M(600) M(601) M(584) M(1644)M(1648)M(1645)M(1647)M(1646)M(1650)M(1649)M(1654)M(1651)M(1653)
+M(1652)M(1818)M(3630)M(547) M(3110)M(3111)M(2031)M(2217)M(2032)M(2218)M(2033)M(2219)M(2034)M(2220)M(2035)
+M(2221)M(2036)M(2222)M(2037)M(2223)M(2038)M(2224)M(2039)M(2225)M(2040)M(2226)M(2041)M(2227)M(2042)M(2228)
+M(2043)M(2229)M(2044)M(2230)M(1668)M(1679)M(3567)M(3568)M(3569)M(3570)M(1697)M(1823)M(590) M(591) M(1657)
+M(1658)M(1659)M(1661)M(1660)M(1666)M(1667)M(1665)M(1662)M(1663)M(439) M(1655)M(1664)M(1671)M(1670)M(1674)
+M(1669)M(1673)M(1672)M(1681)M(1680)M(1676)M(1675)M(1682)M(1683)M(1685)M(1686)M(1684)M(1688)M(1687)M(1678)
+M(1677)M(1689)M(1690)M(1692)M(1693)M(1691)M(1656)M(1698)M(3566)M(1695)M(1696)M(1694)M(1699)M(1703)M(1700)
+M(1702)M(1701)M(1705)M(1704)M(1709)M(1706)M(1708)M(1707)M(1820)M(3271)M(3272)M(3273)M(3274)M(3275)M(3276)
+M(3277)M(3278)M(3279)M(578) M(3280)M(3281)M(3282)M(3283)M(3398)M(3284)M(3399)M(2403)M(2593)M(2404)M(2594)
+M(2405)M(2595)M(2406)M(2596)M(2407)M(2597)M(2408)M(2598)M(2409)M(2599)M(2410)M(2600)M(2411)M(2601)M(2412)
+M(2602)M(2413)M(2603)M(2414)M(2604)M(2415)M(2605)M(2416)M(2606)M(1863)M(1864)M(1865)M(548) M(3112)M(2045)
+M(2231)M(2046)M(2232)M(2047)M(2233)M(2048)M(2234)M(2049)M(2235)M(2050)M(2236)M(2051)M(2237)M(2052)M(2238)
+M(2053)M(2239)M(2054)M(2240)M(2055)M(2241)M(2056)M(2242)M(2057)M(2243)M(2058)M(2244)M(1725)M(1736)M(3572)
+M(3573)M(3574)M(3575)M(1822)M(1754)M(592) M(593) M(1714)M(1712)M(1713)M(1718)M(1715)M(1717)M(1716)M(1723)
+M(1724)M(1722)M(1719)M(1720)M(1710)M(1721)M(1728)M(1727)M(1731)M(1726)M(1730)M(1729)M(1738)M(1737)M(1733)
+M(1732)M(1739)M(1740)M(1742)M(1743)M(1741)M(1745)M(1744)M(1735)M(1734)M(1746)M(1747)M(1749)M(1750)M(1748)
+M(1711)M(1755)M(3571)M(1752)M(1753)M(1751)M(1756)M(1760)M(1757)M(1759)M(1758)M(1762)M(1761)M(1766)M(1763)
+M(1765)M(1764)M(1821)M(3285)M(3286)M(3287)M(3288)M(3289)M(3290)M(3291)M(3292)M(3293)M(3294)M(3295)M(3296)
+M(3297)M(3298)M(3400)M(2417)M(2607)M(2418)M(2608)M(2419)M(2609)M(2420)M(2610)M(2421)M(2611)M(2422)M(2612)
+M(2423)M(2613)M(2424)M(2614)M(2425)M(2615)M(2426)M(2616)M(2427)M(2617)M(2428)M(2618)M(2429)M(2619)M(2430)
+M(2620)M(1866)M(1867)M(1868)M(522) M(3577)M(3578)M(3579)M(3580)M(594) M(3576)M(3726)M(3717)M(3718)M(3719)
+M(3721)M(3720)M(3727)M(3725)M(3722)M(3723)M(3724)M(3728)M(3607)M(89)  M(257) M(266) M(252) M(256) M(258) 
+M(267) M(261) M(265) M(3464)M(275) M(264) M(255) M(263) M(262) M(254) M(253) M(259) M(268) M(312) M(279) 
+M(105) M(273) M(274) M(423) M(490) M(425) M(431) M(433) M(440) M(438) M(361) M(365) M(371) M(370) M(363) 
+M(367) M(395) M(359) M(384) M(360) M(364) M(368) M(411) M(369) M(374) M(376) M(375) M(378) M(377) M(380) 
+M(409) M(381) M(382) M(352) M(372) M(362) M(366) M(386) M(388) M(387) M(410) M(3772)M(393) M(394) M(397) 
+M(396) M(399) M(398) M(400) M(383) M(402) M(401) M(404) M(403) M(327) M(330) M(62)  M(315) M(316) M(52)  
+M(50)  M(602) M(3626)M(106) M(51)  M(407) M(408) M(76)  M(348) M(94)  M(270) M(68)  M(3635)M(494) M(95)  
+M(3678)M(353) M(350) M(3672)M(53)  M(103) M(269) M(313) M(518) M(340) M(341) M(358) M(332) M(3656)M(333) 
+M(500) M(497) M(551) M(346) M(373) M(347) M(22)  M(343) M(344) M(345) M(21)  M(69)  M(493) M(492) M(96)  
+M(107) M(61)  M(97)  M(98)  M(523) M(339) 
+default: break;
+}
+    unreachable_helper();
+    return Value_t{};
+}
+#undef M
+template float evaluator<float,2>::calc(unsigned,const float *);
+
+#endif
+#endif
@@ -0,0 +1,44 @@
+
+#include "testbed_autogen.hh"
+#include "testbed_cpptest.hh"
+#include "testbed_const5.hh"
+
+#if !(0) // No "if constexpr"
+#define M(n) T##n(case n:return,;)
+#if(0||defined(FP_TEST_WANT_GMP_INT_TYPE))
+template<typename Value_t>
+Value_t evaluator<Value_t,16>::calc(unsigned which, const Value_t* vars)
+{
+    static const_container<Value_t> c;
+
+    [[maybe_unused]] static thread_local Value_t uparam[10];
+
+    using namespace FUNCTIONPARSERTYPES;
+    switch(which) {
+M(83)  M(85)  M(84)  M(87)  M(86)  M(88)  M(27)  M(158) M(78)  
+M(93)  M(74)  M(157) M(331) M(251) M(272) M(20)  M(49)  M(338) M(323) M(14)  M(customtest_index)M(329) M(30)  M(294) 
+M(337) M(54)  M(335) M(328) M(334) M(80)  M(310) M(16)  M(15)  M(216) M(217) M(214) M(221) M(219) M(220) 
+M(218) M(215) M(213) M(224) M(226) M(225) M(223) M(228) M(222) M(227) M(229) M(230) M(271) M(336) M(11)  
+M(156) M(155) M(72)  M(23)  M(277) M(278) M(276) M(160) M(167) M(165) M(166) M(164) M(161) M(159) M(304) 
+M(162) M(163) M(178) M(185) M(183) M(184) M(182) M(179) M(177) M(306) M(180) M(181) M(243) M(244) M(245) 
+M(246) M(247) M(248) M(249) M(250) M(169) M(176) M(174) M(175) M(173) M(170) M(168) M(305) M(171) M(172) 
+M(235) M(236) M(237) M(238) M(239) M(240) M(196) M(203) M(201) M(202) M(200) M(197) M(195) M(326) M(308) 
+M(198) M(199) M(284) M(286) M(285) M(287) M(288) M(289) M(291) M(290) M(292) M(293) M(187) M(194) M(192) 
+M(193) M(191) M(188) M(186) M(307) M(189) M(190) M(280) M(281) M(282) M(283) M(63)  M(295) M(64)  M(314) 
+M(205) M(212) M(210) M(211) M(209) M(206) M(204) M(309) M(207) M(208) M(77)  M(26)  M(90)  M(91)  M(301) 
+M(303) M(302) M(296) M(298) M(297) M(311) M(104) M(324) M(89)  M(257) M(266) M(252) M(256) M(258) M(267) 
+M(261) M(265) M(275) M(264) M(255) M(263) M(262) M(254) M(253) M(260) M(259) M(268) M(312) M(279) M(105) 
+M(273) M(274) M(327) M(330) M(153) M(28)  M(154) M(29)  M(315) M(317) M(316) M(52)  M(50)  M(106) M(51)  
+M(76)  M(2)   M(17)  M(8)   M(12)  M(94)  M(13)  M(270) M(68)  M(95)  M(10)  M(53)  M(269) M(313) M(0)   
+M(1)   M(18)  M(332) M(333) M(9)   M(6)   M(19)  M(7)   M(22)  M(3)   M(4)   M(5)   M(21)  M(69)  M(96)  
+M(107) M(61)  M(97)  M(98)  M(339) 
+default: break;
+}
+    unreachable_helper();
+    return Value_t{};
+}
+#undef M
+template GmpInt evaluator<GmpInt,16>::calc(unsigned,const GmpInt *);
+
+#endif
+#endif
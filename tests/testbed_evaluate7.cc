@@ -0,0 +1,253 @@
+
+#include "testbed_autogen.hh"
+#include "testbed_cpptest.hh"
+#include "testbed_const7.hh"
+
+#if !(0) // No "if constexpr"
+#define M(n) T##n(case n:return,;)
+#if(0||defined(FP_TEST_WANT_COMPLEX_LONG_DOUBLE_TYPE))
+template<typename Value_t>
+Value_t evaluator<Value_t,64>::calc(unsigned which, const Value_t* vars)
+{
+    static const_container<Value_t> c;
+
+    [[maybe_unused]] static thread_local Value_t uparam[10];
+
+    using namespace FUNCTIONPARSERTYPES;
+    switch(which) {
+M(158) M(157) M(3585)M(3581)M(3588)M(3589)M(251) 
+M(272) M(349) M(389) M(5508)M(5509)M(5510)M(5511)M(2625)M(5512)M(5513)M(5514)M(5515)M(5516)M(5517)M(5518)
+M(5519)M(5731)M(5586)M(5732)M(5587)M(5588)M(5733)M(5589)M(5734)M(2727)M(2913)M(5590)M(5735)M(5591)M(5736)
+M(5592)M(5737)M(5593)M(5738)M(5594)M(5739)M(5595)M(5740)M(5596)M(5741)M(5597)M(5742)M(5520)M(5521)M(5522)
+M(5523)M(5524)M(5525)M(5526)M(5527)M(5528)M(5529)M(5530)M(5531)M(5532)M(5598)M(5743)M(5599)M(5744)M(5745)
+M(5600)M(5746)M(5601)M(5747)M(5602)M(5748)M(5603)M(5749)M(5604)M(5750)M(5605)M(5751)M(5606)M(5752)M(5607)
+M(5753)M(5608)M(5754)M(5609)M(5755)M(5533)M(5534)M(5535)M(2648)M(5536)M(5537)M(5538)M(5539)M(5540)M(5541)
+M(5542)M(5543)M(5610)M(5611)M(5756)M(5612)M(5757)M(5613)M(5758)M(2749)M(2936)M(5614)M(5759)M(5615)M(5760)
+M(5616)M(5761)M(5617)M(5762)M(5618)M(5763)M(5619)M(5764)M(5620)M(5765)M(5621)M(5766)M(5544)M(5545)M(2659)
+M(5546)M(5547)M(5548)M(5549)M(5550)M(5551)M(5552)M(5553)M(5622)M(5623)M(5767)M(5624)M(5768)M(2763)M(2947)
+M(5625)M(5769)M(5626)M(5770)M(5627)M(5771)M(5628)M(5772)M(5629)M(5773)M(5630)M(5774)M(5631)M(5775)M(5632)
+M(5776)M(5554)M(2669)M(5555)M(5556)M(5557)M(5558)M(5559)M(5560)M(5561)M(5562)M(5633)M(5634)M(5635)M(5636)
+M(5637)M(5777)M(2777)M(2957)M(5638)M(5778)M(5639)M(5779)M(5640)M(5780)M(5641)M(5781)M(5642)M(5782)M(5643)
+M(5783)M(5644)M(5784)M(5645)M(5785)M(2678)M(2679)M(2680)M(2681)M(2682)M(2683)M(2684)M(5563)M(5564)M(2786)
+M(5646)M(2787)M(2788)M(2789)M(2790)M(2966)M(2791)M(2967)M(2792)M(2968)M(2793)M(2969)M(2794)M(5786)M(2795)
+M(2971)M(2796)M(2972)M(5647)M(5787)M(5648)M(5788)M(2687)M(2688)M(2689)M(5565)M(2691)M(2692)M(5566)M(5567)
+M(5649)M(5650)M(5651)M(5652)M(5653)M(2804)M(2805)M(2975)M(2806)M(2976)M(2807)M(2977)M(5654)M(5789)M(2809)
+M(2979)M(2810)M(2980)M(5655)M(5790)M(5656)M(5791)M(2695)M(2696)M(5568)M(2698)M(2699)M(5569)M(5570)M(5657)
+M(5658)M(5659)M(5660)M(5661)M(2818)M(2819)M(2820)M(2983)M(2821)M(2984)M(5662)M(5792)M(2823)M(2986)M(2824)
+M(2987)M(5663)M(5793)M(5664)M(5794)M(2702)M(5571)M(2704)M(2705)M(5572)M(5573)M(5665)M(5666)M(5667)M(5668)
+M(5669)M(2832)M(2833)M(2834)M(2835)M(2990)M(5670)M(5795)M(2837)M(2992)M(2838)M(2993)M(5671)M(5796)M(5672)
+M(5797)M(5574)M(5575)M(5576)M(5577)M(5578)M(5673)M(5674)M(5675)M(5676)M(5677)M(5678)M(5679)M(5680)M(5681)
+M(5682)M(5798)M(5683)M(5799)M(5684)M(5800)M(5685)M(5801)M(5686)M(5802)M(2713)M(2714)M(5579)M(5580)M(5687)
+M(5688)M(5689)M(5690)M(5691)M(2858)M(2859)M(2860)M(2861)M(5692)M(2863)M(3001)M(2864)M(3002)M(5693)M(5803)
+M(5694)M(5804)M(2717)M(5581)M(5582)M(5695)M(5696)M(5697)M(5698)M(5699)M(2872)M(2873)M(2874)M(2875)M(5700)
+M(2877)M(2878)M(3005)M(5701)M(5805)M(5702)M(5806)M(5583)M(5584)M(5703)M(5704)M(5705)M(5706)M(5707)M(5708)
+M(5709)M(5710)M(5711)M(5712)M(5713)M(5714)M(5715)M(5807)M(5716)M(5808)M(5585)M(5717)M(5718)M(5719)M(5720)
+M(5721)M(5722)M(5723)M(5724)M(5725)M(5726)M(5727)M(5728)M(5729)M(5730)M(5809)M(354) M(customtest_index)M(355) M(357) 
+M(356) M(342) M(30)  M(294) M(231) M(241) M(242) M(233) M(234) M(299) M(3597)M(3599)M(3598)M(3595)M(3592)
+M(3594)M(3593)M(310) M(3782)M(3617)M(216) M(217) M(214) M(221) M(219) M(220) M(218) M(215) M(213) M(3456)
+M(3457)M(3453)M(3452)M(224) M(225) M(223) M(228) M(222) M(3458)M(229) M(230) M(271) M(3615)M(3616)M(351) 
+M(156) M(155) M(927) M(4050)M(938) M(4056)M(956) M(4069)M(4041)M(4042)M(4043)M(919) M(4044)M(4046)M(4047)
+M(4048)M(924) M(4045)M(923) M(4049)M(4063)M(933) M(928) M(932) M(931) M(940) M(939) M(935) M(934) M(4052)
+M(4053)M(4054)M(4055)M(4051)M(4057)M(937) M(936) M(4059)M(4060)M(4061)M(4062)M(4058)M(913) M(957) M(4064)
+M(4066)M(4065)M(4068)M(4067)M(962) M(959) M(961) M(960) M(4070)M(4071)M(4072)M(1782)M(5810)M(5811)M(5812)
+M(5813)M(3015)M(5814)M(5815)M(5816)M(5817)M(5818)M(5819)M(5820)M(5821)M(4904)M(5054)M(4905)M(5055)M(4906)
+M(5056)M(4907)M(5057)M(4908)M(5058)M(1873)M(2063)M(4909)M(5059)M(4910)M(5060)M(4911)M(5061)M(4912)M(5062)
+M(4913)M(5063)M(4914)M(5064)M(4915)M(5065)M(4916)M(5066)M(3822)M(3829)M(3835)M(3849)M(3815)M(3816)M(3817)
+M(654) M(3818)M(3820)M(658) M(3819)M(3821)M(3824)M(3842)M(3823)M(3825)M(3828)M(3827)M(3830)M(3831)M(3832)
+M(3833)M(3834)M(3836)M(3826)M(3838)M(3839)M(3840)M(3841)M(3837)M(3814)M(3846)M(3843)M(3845)M(3844)M(3848)
+M(3847)M(684) M(682) M(3850)M(3851)M(3852)M(3853)M(4789)M(6033)M(5888)M(6034)M(5889)M(5890)M(6035)M(5891)
+M(6036)M(3117)M(3303)M(5892)M(6037)M(5893)M(6038)M(5894)M(6039)M(5895)M(6040)M(5896)M(6041)M(5897)M(6042)
+M(5898)M(6043)M(5899)M(6044)M(5205)M(5356)M(5206)M(5357)M(5207)M(5358)M(5208)M(5359)M(5209)M(5360)M(2249)
+M(2435)M(5210)M(5361)M(5211)M(5362)M(5212)M(5363)M(5213)M(5364)M(5214)M(5365)M(5215)M(5366)M(5216)M(5367)
+M(5217)M(5368)M(4821)M(4823)M(4827)M(4826)M(4822)M(4824)M(4825)M(5822)M(5823)M(5824)M(5825)M(5826)M(5827)
+M(5828)M(5829)M(5830)M(5831)M(5832)M(5833)M(5834)M(4917)M(5067)M(4918)M(5068)M(4919)M(5069)M(4920)M(5070)
+M(4921)M(5071)M(4922)M(5072)M(4923)M(5073)M(4924)M(5074)M(4925)M(5075)M(4926)M(5076)M(4927)M(5077)M(4928)
+M(5078)M(4929)M(5079)M(4930)M(5080)M(696) M(3867)M(3885)M(3855)M(3856)M(3857)M(3858)M(3859)M(3860)M(3862)
+M(3878)M(3861)M(3863)M(3866)M(3865)M(3868)M(3869)M(3870)M(3871)M(3872)M(3864)M(3874)M(3875)M(3876)M(3877)
+M(3873)M(3854)M(3882)M(3879)M(3881)M(3880)M(3884)M(3883)M(3886)M(3887)M(3888)M(3889)M(3890)M(4790)M(5900)
+M(6045)M(5901)M(6046)M(6047)M(5902)M(6048)M(5903)M(6049)M(5904)M(6050)M(5905)M(6051)M(5906)M(6052)M(5907)
+M(6053)M(5908)M(6054)M(5909)M(6055)M(5910)M(6056)M(5911)M(6057)M(5218)M(5369)M(5219)M(5370)M(5220)M(5371)
+M(5221)M(5372)M(5222)M(5373)M(5223)M(5374)M(5224)M(5375)M(5225)M(5376)M(5226)M(5377)M(5227)M(5378)M(5228)
+M(5379)M(5229)M(5380)M(5230)M(5381)M(5231)M(5382)M(4828)M(4830)M(4834)M(4833)M(4829)M(4831)M(4832)M(3582)
+M(277) M(278) M(276) M(4276)M(4288)M(4294)M(4308)M(4268)M(4269)M(4270)M(4271)M(4273)M(4275)M(4272)M(4274)
+M(4278)M(4301)M(4281)M(4277)M(4280)M(4279)M(4287)M(4286)M(4284)M(4283)M(4290)M(4291)M(4292)M(4293)M(4289)
+M(4295)M(4285)M(4282)M(4297)M(4298)M(4299)M(4300)M(4296)M(4267)M(4305)M(4302)M(4304)M(4303)M(4307)M(4306)
+M(4309)M(4310)M(4311)M(4312)M(4313)M(4798)M(5835)M(5836)M(5837)M(3038)M(5838)M(5839)M(5840)M(5841)M(5842)
+M(5843)M(5844)M(5845)M(4931)M(5081)M(4932)M(5082)M(4933)M(5083)M(4934)M(5084)M(4935)M(5085)M(1897)M(2085)
+M(4936)M(5086)M(4937)M(5087)M(4938)M(5088)M(4939)M(5089)M(4940)M(5090)M(4941)M(5091)M(4942)M(5092)M(4943)
+M(5093)M(3899)M(3906)M(3912)M(3926)M(3892)M(3893)M(3894)M(726) M(3895)M(3897)M(730) M(3896)M(3898)M(3901)
+M(3919)M(3900)M(3902)M(3905)M(3904)M(3907)M(3908)M(3909)M(3910)M(3911)M(3913)M(3903)M(3915)M(3916)M(3917)
+M(3918)M(3914)M(3891)M(3923)M(3920)M(3922)M(3921)M(3925)M(3924)M(756) M(754) M(3927)M(3928)M(3929)M(3930)
+M(4791)M(5912)M(5913)M(6058)M(5914)M(6059)M(5915)M(6060)M(3139)M(3326)M(5916)M(6061)M(5917)M(6062)M(5918)
+M(6063)M(5919)M(6064)M(5920)M(6065)M(5921)M(6066)M(5922)M(6067)M(5923)M(6068)M(5232)M(5383)M(5233)M(5384)
+M(5234)M(5385)M(5235)M(5386)M(5236)M(5387)M(2271)M(2459)M(5237)M(5388)M(5238)M(5389)M(5239)M(5390)M(5240)
+M(5391)M(5241)M(5392)M(5242)M(5393)M(5243)M(5394)M(5244)M(5395)M(4835)M(4837)M(4841)M(4840)M(4836)M(4838)
+M(4839)M(5846)M(5847)M(3049)M(5848)M(5849)M(5850)M(5851)M(5852)M(5853)M(5854)M(5855)M(4944)M(5094)M(4945)
+M(5095)M(4946)M(5096)M(4947)M(5097)M(4948)M(5098)M(1911)M(2099)M(4949)M(5099)M(4950)M(5100)M(4951)M(5101)
+M(4952)M(5102)M(4953)M(5103)M(4954)M(5104)M(4955)M(5105)M(4956)M(5106)M(777) M(3941)M(788) M(3947)M(806) 
+M(1774)M(3959)M(3931)M(3932)M(3933)M(769) M(3934)M(3936)M(3938)M(3939)M(774) M(3935)M(3937)M(3940)M(3954)
+M(783) M(778) M(782) M(781) M(790) M(789) M(785) M(784) M(3942)M(3943)M(3944)M(3945)M(3946)M(3948)M(787) 
+M(786) M(3950)M(3951)M(3952)M(3953)M(3949)M(763) M(807) M(3955)M(3957)M(3956)M(3958)M(808) M(812) M(3960)
+M(811) M(810) M(3961)M(3962)M(3963)M(4792)M(5924)M(5925)M(6069)M(5926)M(6070)M(3153)M(3337)M(5927)M(6071)
+M(5928)M(6072)M(5929)M(6073)M(5930)M(6074)M(5931)M(6075)M(5932)M(6076)M(5933)M(6077)M(5934)M(6078)M(5245)
+M(5396)M(5246)M(5397)M(5247)M(5398)M(5248)M(5399)M(5249)M(5400)M(2285)M(2473)M(5250)M(5401)M(5251)M(5402)
+M(5252)M(5403)M(5253)M(5404)M(5254)M(5405)M(5255)M(5406)M(5256)M(5407)M(5257)M(5408)M(4842)M(4844)M(4848)
+M(4847)M(4843)M(4845)M(4846)M(4794)M(5856)M(3059)M(5857)M(5858)M(5859)M(5860)M(5861)M(5862)M(5863)M(5864)
+M(4957)M(5107)M(4958)M(5108)M(4959)M(5109)M(4960)M(5110)M(4961)M(5111)M(1925)M(2113)M(4962)M(5112)M(4963)
+M(5113)M(4964)M(5114)M(4965)M(5115)M(4966)M(5116)M(4967)M(5117)M(4968)M(5118)M(4969)M(5119)M(4795)M(4796)
+M(3971)M(3978)M(845) M(3984)M(1779)M(863) M(3997)M(3964)M(3965)M(3966)M(3967)M(3969)M(831) M(3968)M(3970)
+M(3973)M(3991)M(3972)M(839) M(3974)M(847) M(3977)M(842) M(3976)M(3980)M(3981)M(3982)M(3983)M(3979)M(3985)
+M(3975)M(3987)M(3988)M(3989)M(3990)M(3986)M(820) M(864) M(3992)M(3994)M(3993)M(3996)M(3995)M(869) M(3998)
+M(3999)M(4000)M(4001)M(4002)M(4793)M(5935)M(5936)M(5937)M(5938)M(5939)M(6079)M(3167)M(3347)M(5940)M(6080)
+M(5941)M(6081)M(5942)M(6082)M(5943)M(6083)M(5944)M(6084)M(5945)M(6085)M(5946)M(6086)M(5947)M(6087)M(5258)
+M(5409)M(5259)M(5410)M(5260)M(5411)M(5261)M(5412)M(5262)M(5413)M(2299)M(2487)M(5263)M(5414)M(5264)M(5415)
+M(5265)M(5416)M(5266)M(5417)M(5267)M(5418)M(5268)M(5419)M(5269)M(5420)M(5270)M(5421)M(4849)M(4851)M(4855)
+M(4854)M(4850)M(4852)M(4853)M(3068)M(3069)M(3070)M(3071)M(3072)M(3073)M(3074)M(5865)M(5866)M(1934)M(2122)
+M(4970)M(5120)M(1935)M(2123)M(1936)M(2124)M(1937)M(2125)M(1938)M(2126)M(1939)M(2127)M(1940)M(2128)M(1941)
+M(2129)M(1942)M(5121)M(1943)M(2131)M(1944)M(2132)M(4971)M(5122)M(4972)M(5123)M(4011)M(4017)M(4023)M(4035)
+M(4004)M(4005)M(4006)M(881) M(4007)M(4009)M(885) M(4008)M(4010)M(4012)M(4028)M(889) M(4013)M(4016)M(4015)
+M(4019)M(4020)M(4021)M(4022)M(4018)M(4024)M(4014)M(895) M(4026)M(898) M(4027)M(4025)M(4003)M(4032)M(4029)
+M(4031)M(4030)M(4034)M(4033)M(907) M(4036)M(4037)M(4038)M(4039)M(4040)M(1778)M(3176)M(5948)M(3177)M(3178)
+M(3179)M(3180)M(3356)M(3181)M(3357)M(3182)M(3358)M(3183)M(3359)M(3184)M(6088)M(3185)M(3361)M(3186)M(3362)
+M(5949)M(6089)M(5950)M(6090)M(2308)M(2496)M(5271)M(5422)M(2309)M(2497)M(2310)M(2498)M(2311)M(2499)M(2312)
+M(2500)M(2313)M(2501)M(2314)M(2502)M(2315)M(2503)M(2316)M(5423)M(2317)M(2505)M(2318)M(2506)M(5272)M(5424)
+M(5273)M(5425)M(4856)M(4858)M(4861)M(4860)M(4857)M(1840)M(4859)M(4113)M(4117)M(4123)M(4137)M(4105)M(4106)
+M(4107)M(4108)M(4110)M(4112)M(4109)M(4111)M(4114)M(4130)M(1046)M(1041)M(1045)M(4115)M(1053)M(1052)M(1048)
+M(4116)M(4119)M(4120)M(4121)M(4122)M(4118)M(4124)M(1050)M(1049)M(4126)M(4127)M(4128)M(4129)M(4125)M(4104)
+M(4134)M(4131)M(4133)M(4132)M(4136)M(4135)M(4138)M(4139)M(4140)M(4141)M(4142)M(4797)M(3600)M(3690)M(3681)
+M(3682)M(3683)M(3685)M(3684)M(3689)M(3691)M(3686)M(3687)M(3688)M(3692)M(4380)M(4393)M(4390)M(4399)M(4410)
+M(4414)M(4369)M(4370)M(4371)M(4373)M(4372)M(4375)M(4378)M(4379)M(4377)M(4374)M(4376)M(4382)M(4406)M(4385)
+M(4381)M(4384)M(4383)M(4392)M(4391)M(4388)M(4387)M(4395)M(4396)M(4397)M(4398)M(4394)M(4400)M(4389)M(4386)
+M(4402)M(4403)M(4404)M(4405)M(4401)M(4368)M(4411)M(4407)M(4409)M(4408)M(4413)M(4412)M(4418)M(4415)M(4417)
+M(4416)M(4419)M(4420)M(4421)M(4811)M(3077)M(3078)M(3079)M(5867)M(3081)M(3082)M(5868)M(5869)M(4973)M(5124)
+M(4974)M(5125)M(4975)M(5126)M(4976)M(5127)M(4977)M(5128)M(1952)M(2140)M(1953)M(2141)M(1954)M(2142)M(1955)
+M(2143)M(4978)M(5129)M(1957)M(2145)M(1958)M(2146)M(4979)M(5130)M(4980)M(5131)M(984) M(4082)M(995) M(4088)
+M(1788)M(1013)M(4100)M(4073)M(3403)M(4074)M(4075)M(976) M(4076)M(4078)M(4079)M(4080)M(981) M(4077)M(980) 
+M(4081)M(4095)M(990) M(985) M(989) M(988) M(997) M(996) M(992) M(991) M(4084)M(4085)M(4086)M(4087)M(4083)
+M(4089)M(994) M(993) M(4091)M(4092)M(4093)M(4094)M(4090)M(970) M(1014)M(4096)M(4098)M(4097)M(4099)M(1015)
+M(1019)M(1016)M(1018)M(1017)M(4101)M(4102)M(4103)M(1783)M(5951)M(5952)M(5953)M(5954)M(5955)M(3194)M(3195)
+M(3365)M(3196)M(3366)M(3197)M(3367)M(5956)M(6091)M(3199)M(3369)M(3200)M(3370)M(5957)M(6092)M(5958)M(6093)
+M(5274)M(5426)M(5275)M(5427)M(5276)M(5428)M(5277)M(5429)M(5278)M(5430)M(2326)M(2514)M(2327)M(2515)M(2328)
+M(2516)M(2329)M(2517)M(5279)M(5431)M(2331)M(2519)M(2332)M(2520)M(5280)M(5432)M(5281)M(5433)M(4862)M(4863)
+M(3601)M(4865)M(4864)M(1842)M(1843)M(1844)M(3085)M(3086)M(5870)M(3088)M(3089)M(5871)M(5872)M(4981)M(5132)
+M(4982)M(5133)M(4983)M(5134)M(4984)M(5135)M(4985)M(5136)M(1966)M(2154)M(1967)M(2155)M(1968)M(2156)M(1969)
+M(2157)M(4986)M(5137)M(1971)M(2159)M(1972)M(2160)M(4987)M(5138)M(4988)M(5139)M(1097)M(4152)M(1108)M(4158)
+M(1787)M(1126)M(4170)M(4143)M(4144)M(4145)M(1089)M(4146)M(4148)M(4149)M(4150)M(1094)M(4147)M(1093)M(4151)
+M(4165)M(1103)M(1098)M(1102)M(1101)M(1110)M(1109)M(1105)M(1104)M(4154)M(4155)M(4156)M(4157)M(4153)M(4159)
+M(1107)M(1106)M(4161)M(4162)M(4163)M(4164)M(4160)M(1083)M(1127)M(4166)M(4168)M(4167)M(4169)M(1128)M(1132)
+M(1129)M(1131)M(1130)M(4171)M(4172)M(4173)M(3414)M(1786)M(5959)M(5960)M(5961)M(5962)M(5963)M(3208)M(3209)
+M(3210)M(3373)M(3211)M(3374)M(5964)M(6094)M(3213)M(3376)M(3214)M(3377)M(5965)M(6095)M(5966)M(6096)M(5282)
+M(5434)M(5283)M(5435)M(5284)M(5436)M(5285)M(5437)M(5286)M(5438)M(2340)M(2528)M(2341)M(2529)M(2342)M(2530)
+M(2343)M(2531)M(5287)M(5439)M(2345)M(2533)M(2346)M(2534)M(5288)M(5440)M(5289)M(5441)M(4866)M(4867)M(3602)
+M(4869)M(4868)M(1845)M(1846)M(1847)M(160) M(167) M(165) M(166) M(164) M(161) M(159) M(232) M(3420)M(3421)
+M(3419)M(3418)M(3417)M(3416)M(1793)M(304) M(162) M(163) M(3092)M(5873)M(3094)M(3095)M(5874)M(5875)M(4989)
+M(5140)M(4990)M(5141)M(4991)M(5142)M(4992)M(5143)M(4993)M(5144)M(1980)M(2168)M(1981)M(2169)M(1982)M(2170)
+M(1983)M(2171)M(4994)M(5145)M(1985)M(2173)M(1986)M(2174)M(4995)M(5146)M(4996)M(5147)M(1266)M(4245)M(1277)
+M(4251)M(1795)M(1295)M(4263)M(4236)M(4237)M(4238)M(1258)M(4239)M(4241)M(4242)M(4243)M(1263)M(4240)M(1262)
+M(4244)M(4258)M(1272)M(1267)M(1271)M(1270)M(1279)M(1278)M(1274)M(1273)M(4247)M(4248)M(4249)M(4250)M(4246)
+M(4252)M(1276)M(1275)M(4254)M(4255)M(4256)M(4257)M(4253)M(1252)M(1296)M(4259)M(4261)M(4260)M(4262)M(1297)
+M(1301)M(1298)M(1300)M(1299)M(4264)M(4265)M(4266)M(1794)M(3461)M(5967)M(5968)M(5969)M(5970)M(5971)M(3222)
+M(3223)M(3224)M(3225)M(3380)M(5972)M(6097)M(3227)M(3382)M(3228)M(3383)M(5973)M(6098)M(5974)M(6099)M(5290)
+M(5442)M(5291)M(5443)M(5292)M(5444)M(5293)M(5445)M(5294)M(5446)M(2354)M(2542)M(2355)M(2543)M(2356)M(2544)
+M(2357)M(2545)M(5295)M(5447)M(2359)M(2547)M(2360)M(2548)M(5296)M(5448)M(5297)M(5449)M(3460)M(3462)M(1154)
+M(4183)M(1165)M(4189)M(1790)M(1183)M(4201)M(4174)M(4175)M(4176)M(1146)M(4177)M(4179)M(4180)M(4181)M(1151)
+M(4178)M(1150)M(4182)M(4196)M(1160)M(1155)M(1159)M(1158)M(1167)M(1166)M(1162)M(1161)M(4185)M(4186)M(4187)
+M(4188)M(4184)M(4190)M(1164)M(1163)M(4192)M(4193)M(4194)M(4195)M(4191)M(1140)M(1184)M(4197)M(4199)M(4198)
+M(4200)M(1185)M(1189)M(1186)M(1188)M(1187)M(4202)M(4203)M(4204)M(1789)M(3603)M(3702)M(3693)M(3694)M(3695)
+M(3697)M(3696)M(3701)M(3703)M(3698)M(3699)M(3700)M(3704)M(178) M(185) M(183) M(184) M(182) M(179) M(177) 
+M(3432)M(3433)M(3429)M(3428)M(3622)M(3618)M(3774)M(180) M(181) M(169) M(176) M(174) M(175) M(173) M(170) 
+M(168) M(3426)M(3427)M(3423)M(3422)M(3623)M(3619)M(3773)M(171) M(172) M(4800)M(4801)M(4802)M(4803)M(4799)
+M(4326)M(4339)M(4336)M(4345)M(4356)M(4360)M(4315)M(4316)M(4317)M(4319)M(4318)M(4321)M(4324)M(4325)M(4323)
+M(4320)M(4322)M(4328)M(4352)M(4331)M(4327)M(4330)M(4329)M(4338)M(4337)M(4334)M(4333)M(4341)M(4342)M(4343)
+M(4344)M(4340)M(4346)M(4335)M(4332)M(4348)M(4349)M(4350)M(4351)M(4347)M(4314)M(4357)M(4353)M(4355)M(4354)
+M(4359)M(4358)M(4364)M(4361)M(4363)M(4362)M(4365)M(4366)M(4367)M(4804)M(3714)M(3705)M(3706)M(3707)M(3709)
+M(3708)M(3713)M(3715)M(3710)M(3711)M(3712)M(3716)M(4805)M(1209)M(4214)M(1220)M(4220)M(1792)M(1238)M(4232)
+M(4205)M(4206)M(4207)M(1202)M(4208)M(4210)M(4211)M(4212)M(1206)M(4209)M(1205)M(4213)M(4227)M(1215)M(1210)
+M(1214)M(1213)M(1222)M(1221)M(1217)M(1216)M(4216)M(4217)M(4218)M(4219)M(4215)M(4221)M(1219)M(1218)M(4223)
+M(4224)M(4225)M(4226)M(4222)M(1197)M(1239)M(4228)M(4230)M(4229)M(4231)M(1240)M(1244)M(1241)M(1243)M(1242)
+M(4233)M(4234)M(4235)M(1791)M(4878)M(4879)M(4881)M(4880)M(1854)M(1855)M(1856)M(4807)M(4808)M(4809)M(4810)
+M(4806)M(615) M(3794)M(3800)M(3812)M(3786)M(3787)M(3788)M(609) M(3789)M(3791)M(3792)M(610) M(3790)M(3793)
+M(3807)M(620) M(616) M(619) M(618) M(626) M(625) M(622) M(621) M(3796)M(3797)M(3798)M(3799)M(3795)M(3801)
+M(624) M(623) M(3803)M(3804)M(3805)M(3806)M(3802)M(605) M(642) M(3808)M(3810)M(3809)M(3811)M(643) M(644) 
+M(645) M(3813)M(647) M(648) M(1768)M(4874)M(4875)M(4877)M(4876)M(1851)M(1852)M(1853)M(1451)M(4544)M(4550)
+M(4562)M(4536)M(4537)M(4538)M(1445)M(4539)M(4541)M(4542)M(1446)M(4540)M(4543)M(4557)M(1456)M(1452)M(1455)
+M(1454)M(1462)M(1461)M(1458)M(1457)M(4546)M(4547)M(4548)M(4549)M(4545)M(4551)M(1460)M(1459)M(4553)M(4554)
+M(4555)M(4556)M(4552)M(1441)M(1478)M(4558)M(4560)M(4559)M(4561)M(1479)M(1480)M(1481)M(4563)M(1483)M(1484)
+M(1812)M(4870)M(4871)M(4873)M(4872)M(1848)M(1849)M(1850)M(196) M(203) M(201) M(202) M(200) M(197) M(195) 
+M(3444)M(3445)M(3441)M(3440)M(3620)M(3624)M(3776)M(198) M(199) M(187) M(194) M(192) M(193) M(191) M(188) 
+M(186) M(3438)M(3439)M(3435)M(3434)M(3621)M(3625)M(3775)M(189) M(190) M(3596)M(5876)M(5877)M(5878)M(5879)
+M(5880)M(4997)M(5148)M(4998)M(5149)M(4999)M(5150)M(5000)M(5151)M(5001)M(5152)M(1994)M(2181)M(5002)M(5153)
+M(5003)M(5154)M(5004)M(5155)M(5005)M(5156)M(5006)M(5157)M(5007)M(5158)M(5008)M(5159)M(5009)M(5160)M(1362)
+M(4472)M(4478)M(4492)M(4461)M(4462)M(4463)M(4464)M(4466)M(4468)M(4465)M(4467)M(4469)M(4485)M(1367)M(1363)
+M(1366)M(4470)M(1373)M(1372)M(1369)M(4471)M(4474)M(4475)M(4476)M(4477)M(4473)M(4479)M(1371)M(1370)M(4481)
+M(4482)M(4483)M(4484)M(4480)M(4460)M(4489)M(4486)M(4488)M(4487)M(4491)M(4490)M(4493)M(4494)M(4495)M(4496)
+M(4497)M(4812)M(5975)M(5976)M(5977)M(5978)M(5979)M(5980)M(5981)M(5982)M(5983)M(5984)M(6100)M(3412)M(5985)
+M(6101)M(5986)M(6102)M(5987)M(6103)M(5988)M(6104)M(5298)M(5450)M(5299)M(5451)M(5300)M(5452)M(5301)M(5453)
+M(5302)M(5454)M(5303)M(5455)M(5304)M(5456)M(5305)M(5457)M(5306)M(5458)M(5307)M(5459)M(5308)M(5460)M(5309)
+M(5461)M(5310)M(5462)M(5311)M(5463)M(6113)M(1406)M(4510)M(4516)M(4530)M(4499)M(4500)M(4501)M(4502)M(4504)
+M(4506)M(4503)M(4505)M(4507)M(4523)M(1411)M(1407)M(1410)M(4508)M(1417)M(1416)M(1413)M(4509)M(4512)M(4513)
+M(4514)M(4515)M(4511)M(4517)M(1415)M(1414)M(4519)M(4520)M(4521)M(4522)M(4518)M(4498)M(4527)M(4524)M(4526)
+M(4525)M(4529)M(4528)M(4531)M(4532)M(4533)M(4534)M(4535)M(4814)M(1318)M(4434)M(4440)M(4454)M(4423)M(4424)
+M(4425)M(4426)M(4428)M(4430)M(4427)M(4429)M(4431)M(4447)M(1323)M(1319)M(1322)M(4432)M(1329)M(1328)M(1325)
+M(4433)M(4436)M(4437)M(4438)M(4439)M(4435)M(4441)M(1327)M(1326)M(4443)M(4444)M(4445)M(4446)M(4442)M(4422)
+M(4451)M(4448)M(4450)M(4449)M(4453)M(4452)M(4455)M(4456)M(4457)M(4458)M(4459)M(4813)M(3583)M(295) M(3584)
+M(205) M(212) M(210) M(211) M(209) M(206) M(204) M(300) M(3450)M(3451)M(3447)M(3446)M(1811)M(309) M(207) 
+M(208) M(3606)M(3587)M(3590)M(301) M(303) M(302) M(296) M(298) M(297) M(311) M(3586)M(4816)M(3613)M(3612)
+M(3611)M(3610)M(3614)M(3609)M(3608)M(3413)M(4815)M(4576)M(4589)M(4586)M(4595)M(4606)M(4610)M(4565)M(4566)
+M(4567)M(4569)M(4568)M(4571)M(4574)M(4575)M(4573)M(4570)M(4572)M(4578)M(4602)M(4581)M(4577)M(4580)M(4579)
+M(4588)M(4587)M(4584)M(4583)M(4591)M(4592)M(4593)M(4594)M(4590)M(4596)M(4585)M(4582)M(4598)M(4599)M(4600)
+M(4601)M(4597)M(4564)M(4607)M(4603)M(4605)M(4604)M(4609)M(4608)M(4614)M(4611)M(4613)M(4612)M(4615)M(4616)
+M(4617)M(4817)M(3103)M(3104)M(5881)M(5882)M(5010)M(5161)M(5011)M(5162)M(5012)M(5163)M(5013)M(5164)M(5014)
+M(5165)M(2008)M(2194)M(2009)M(2195)M(2010)M(2196)M(2011)M(2197)M(5015)M(5166)M(2013)M(2199)M(2014)M(2200)
+M(5016)M(5167)M(5017)M(5168)M(1500)M(4627)M(1511)M(4633)M(1817)M(1529)M(4645)M(4618)M(4619)M(4620)M(3415)
+M(1492)M(4621)M(4623)M(4624)M(4625)M(1497)M(4622)M(1496)M(4626)M(4640)M(1506)M(1501)M(1505)M(1504)M(1513)
+M(1512)M(1508)M(1507)M(4629)M(4630)M(4631)M(4632)M(4628)M(4634)M(1510)M(1509)M(4636)M(4637)M(4638)M(4639)
+M(4635)M(1486)M(1530)M(4641)M(4643)M(4642)M(4644)M(1531)M(1535)M(1532)M(1534)M(1533)M(4646)M(4647)M(4648)
+M(1814)M(3407)M(3408)M(3409)M(3410)M(3411)M(5989)M(5990)M(5991)M(5992)M(5993)M(3248)M(3249)M(3405)M(3406)
+M(3250)M(3251)M(5994)M(3253)M(3391)M(3254)M(3392)M(5995)M(6105)M(5996)M(6106)M(5312)M(5464)M(5313)M(5465)
+M(5314)M(5466)M(5315)M(5467)M(5316)M(5468)M(2380)M(2570)M(2381)M(2571)M(2382)M(2572)M(2383)M(2573)M(5317)
+M(5469)M(2385)M(2575)M(2386)M(2576)M(5318)M(5470)M(5319)M(5471)M(4882)M(4883)M(3604)M(4885)M(4884)M(1857)
+M(1858)M(1859)M(6112)M(3107)M(5883)M(5884)M(5018)M(5169)M(5019)M(5170)M(5020)M(5171)M(5021)M(5172)M(5022)
+M(5173)M(2022)M(2208)M(2023)M(2209)M(2024)M(2210)M(2025)M(2211)M(5023)M(5174)M(2027)M(2213)M(2028)M(2214)
+M(5024)M(5175)M(5025)M(5176)M(1557)M(4658)M(1568)M(4664)M(1816)M(1586)M(4676)M(4649)M(4650)M(4651)M(1549)
+M(4652)M(4654)M(4655)M(4656)M(1554)M(4653)M(1553)M(4657)M(4671)M(1563)M(1558)M(1562)M(1561)M(1570)M(1569)
+M(1565)M(1564)M(4660)M(4661)M(4662)M(4663)M(4659)M(4665)M(1567)M(1566)M(4667)M(4668)M(4669)M(4670)M(4666)
+M(1543)M(1587)M(4672)M(4674)M(4673)M(4675)M(1588)M(1592)M(1589)M(1591)M(1590)M(4677)M(4678)M(4679)M(3404)
+M(1815)M(5997)M(5998)M(5999)M(6000)M(6001)M(3262)M(3263)M(3264)M(3265)M(6002)M(3267)M(3268)M(3395)M(6003)
+M(6107)M(6004)M(6108)M(5320)M(5472)M(5321)M(5473)M(5322)M(5474)M(5323)M(5475)M(5324)M(5476)M(2394)M(2584)
+M(2395)M(2585)M(2396)M(2586)M(2397)M(2587)M(5325)M(5477)M(2399)M(2589)M(2400)M(2590)M(5326)M(5478)M(5327)
+M(5479)M(4886)M(4887)M(3605)M(4889)M(4888)M(1860)M(1861)M(1862)M(4689)M(4693)M(4699)M(4713)M(4681)M(4682)
+M(4683)M(4684)M(4686)M(4688)M(4685)M(4687)M(4690)M(4706)M(1619)M(1614)M(1618)M(4691)M(1626)M(1625)M(1621)
+M(4692)M(4695)M(4696)M(4697)M(4698)M(4694)M(4700)M(1623)M(1622)M(4702)M(4703)M(4704)M(4705)M(4701)M(4680)
+M(4710)M(4707)M(4709)M(4708)M(4712)M(4711)M(4714)M(4715)M(4716)M(4717)M(4718)M(4818)M(5885)M(5886)M(5026)
+M(5177)M(5027)M(5178)M(5028)M(5179)M(5029)M(5180)M(5030)M(5181)M(5031)M(5182)M(5032)M(5183)M(5033)M(5184)
+M(5034)M(5185)M(5035)M(5186)M(5036)M(5187)M(5037)M(5188)M(5038)M(5189)M(5039)M(5190)M(4728)M(4730)M(4736)
+M(4748)M(4719)M(4720)M(4721)M(4722)M(4724)M(4726)M(4727)M(4723)M(4725)M(4729)M(4743)M(1674)M(1669)M(1673)
+M(1672)M(1681)M(1680)M(1676)M(1675)M(4732)M(4733)M(4734)M(4735)M(4731)M(4737)M(1678)M(1677)M(4739)M(4740)
+M(4741)M(4742)M(4738)M(1656)M(1698)M(4744)M(4746)M(4745)M(4747)M(1699)M(4749)M(4750)M(4751)M(4752)M(4753)
+M(4819)M(6005)M(6006)M(6007)M(6008)M(6009)M(6010)M(6011)M(6012)M(6013)M(6014)M(6015)M(6016)M(6017)M(6109)
+M(6018)M(6110)M(5328)M(5480)M(5329)M(5481)M(5330)M(5482)M(5331)M(5483)M(5332)M(5484)M(5333)M(5485)M(5334)
+M(5486)M(5335)M(5487)M(5336)M(5488)M(5337)M(5489)M(5338)M(5490)M(5339)M(5491)M(5340)M(5492)M(5341)M(5493)
+M(4890)M(4892)M(4896)M(4895)M(4891)M(4893)M(4894)M(5887)M(5040)M(5191)M(5041)M(5192)M(5042)M(5193)M(5043)
+M(5194)M(5044)M(5195)M(5045)M(5196)M(5046)M(5197)M(5047)M(5198)M(5048)M(5199)M(5049)M(5200)M(5050)M(5201)
+M(5051)M(5202)M(5052)M(5203)M(5053)M(5204)M(4763)M(4765)M(4771)M(4783)M(4754)M(4755)M(4756)M(4757)M(4759)
+M(4761)M(4762)M(4758)M(4760)M(4764)M(4778)M(1731)M(1726)M(1730)M(1729)M(1738)M(1737)M(1733)M(1732)M(4767)
+M(4768)M(4769)M(4770)M(4766)M(4772)M(1735)M(1734)M(4774)M(4775)M(4776)M(4777)M(4773)M(1711)M(1755)M(4779)
+M(4781)M(4780)M(4782)M(1756)M(4784)M(4785)M(4786)M(4787)M(4788)M(4820)M(6019)M(6020)M(6021)M(6022)M(6023)
+M(6024)M(6025)M(6026)M(6027)M(6028)M(6029)M(6030)M(6031)M(6032)M(6111)M(5342)M(5494)M(5343)M(5495)M(5344)
+M(5496)M(5345)M(5497)M(5346)M(5498)M(5347)M(5499)M(5348)M(5500)M(5349)M(5501)M(5350)M(5502)M(5351)M(5503)
+M(5352)M(5504)M(5353)M(5505)M(5354)M(5506)M(5355)M(5507)M(4897)M(4899)M(4903)M(4902)M(4898)M(4900)M(4901)
+M(3726)M(3717)M(3718)M(3719)M(3721)M(3720)M(3727)M(3725)M(3722)M(3723)M(3724)M(3728)M(3607)M(257) M(266) 
+M(252) M(256) M(258) M(267) M(265) M(3464)M(275) M(264) M(255) M(263) M(262) M(254) M(253) M(259) M(268) 
+M(312) M(279) M(273) M(274) M(359) M(3778)M(3779)M(376) M(375) M(378) M(377) M(3781)M(396) M(401) M(348) 
+M(270) M(353) M(3777)M(3785)M(269) M(340) M(341) M(358) M(3780)M(3783)M(343) 
+default: break;
+}
+    unreachable_helper();
+    return Value_t{};
+}
+#undef M
+template std::complex<long double> evaluator<std::complex<long double>,64>::calc(unsigned,const std::complex<long double> *);
+
+#endif
+#endif
@@ -0,0 +1,18 @@
+#include "testbed_autogen.hh"
+
+#ifdef FP_TEST_WANT_GMP_INT_TYPE
+const unsigned short RegressionTests<GmpInt>::Tests[] =
+        {    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,  17,  18,
+            19,  20,  21,  22,  23,  26,  27,  28,  29,  30,  49,  50,  51,  52,  53,  54,  61,  63,  64,
+            68,  69,  72,  74,  76,  77,  78,  80,  83,  84,  85,  86,  87,  88,  89,  90,  91,  93,  94,
+            95,  96,  97,  98, 104, 105, 106, 107, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+           164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+           183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+           202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+           221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 235, 236, 237, 238, 239, 240, 243, 244, 245,
+           246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264,
+           265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+           284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 301, 302, 303, 304,
+           305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 323, 324, 326, 327, 328, 329,
+           330, 331, 332, 333, 334, 335, 336, 337, 338, 339,};
+#endif /*FP_TEST_WANT_GMP_INT_TYPE */
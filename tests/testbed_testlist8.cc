@@ -0,0 +1,184 @@
+#include "testbed_autogen.hh"
+
+#ifdef FP_TEST_WANT_COMPLEX_FLOAT_TYPE
+const unsigned short RegressionTests<std::complex<float>>::Tests[] =
+        {  340, 341, 342, 343,3773,3774,3775,3776, 348, 349,3777, 351, 353, 354, 355, 356, 357, 358, 359,
+          3778,3779, 375, 376, 377, 378,3780,3781, 389,3782,3783, 396,3784, 401,3785,  30, 605,3786,3787,
+          3788, 609, 610,3789,3790,3791,3792, 615, 616,3793, 618, 619, 620, 621, 622, 623, 624, 625, 626,
+          3794,3795,3796,3797,3798,3799,3800,3801,3802,3803,3804,3805,3806,3807,3808,3809,3810, 642, 643,
+          3811,3812, 644, 645,3813, 647, 648,3814,3815,3816,3817,3818, 654,3819,3820,3821, 658,3822,3823,
+          3824,3825,3826,3827,3828,3829,3830,3831,3832,3833,3834,3835,3836,3837,3838,3839,3840,3841,3842,
+          3843,3844,3845,3846,3847,3848,3849, 682,3850, 684,3851,3852,3853,3854,3855,3856,3857,3858,3859,
+          3860, 696,3861,3862,3863,3864,3865,3866,3867,3868,3869,3870,3871,3872,3873,3874,3875,3876,3877,
+          3878,3879,3880,3881,3882,3883,3884,3885,3886,3887,3888,3889,3890,3891,3892,3893,3894,3895, 726,
+          3896,3897,3898, 730,3899,3900,3901,3902,3903,3904,3905,3906,3907,3908,3909,3910,3911,3912,3913,
+          3914,3915,3916,3917,3918,3919,3920,3921,3922,3923,3924,3925,3926, 754,3927, 756,3928,3929,3930,
+           763,3931,3932,3933,3934, 769,3935,3936,3937, 774,3938,3939, 777, 778,3940, 781, 782, 783, 784,
+           785, 786, 787, 788, 789, 790,3941,3942,3943,3944,3945,3946,3947,3948,3949,3950,3951,3952,3953,
+          3954,3955,3956,3957, 806, 807, 808,3958,3959,3960, 810, 811, 812,3961,3962,3963, 820,3964,3965,
+          3966,3967,3968,3969,3970, 831,3971,3972,3973,3974, 839,3975,3976, 842, 845,3977, 847,3978,3979,
+          3980,3981,3982,3983,3984,3985,3986,3987,3988,3989,3990,3991,3992,3993,3994, 863, 864,3995,3996,
+          3997,3998,3999, 869,4000,4001,4002,4003,4004,4005,4006,4007, 881,4008,4009,4010, 885,4011, 889,
+          4012,4013,4014,4015,4016,4017,4018,4019,4020,4021,4022,4023,4024,4025, 895,4026, 898,4027,4028,
+          4029,4030,4031,4032,4033,4034,4035,4036,4037, 907,4038,4039,4040, 913,4041,4042,4043,4044, 919,
+          4045,4046, 923, 924,4047,4048, 927, 928,4049, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940,
+          4050,4051,4052,4053,4054,4055,4056,4057,4058,4059,4060,4061,4062,4063,4064,4065,4066, 956, 957,
+          4067,4068,4069, 959, 960, 961, 962,4070,4071,4072, 970,4073,4074,4075,4076, 976,4077,4078, 980,
+           981,4079,4080, 984, 985,4081, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997,4082,4083,4084,
+          4085,4086,4087,4088,4089,4090,4091,4092,4093,4094,4095,4096,4097,4098,1013,1014,1015,4099,4100,
+          1016,1017,1018,1019,4101,4102,4103,4104,4105,4106,4107,4108,4109,4110,4111,4112,4113,1041,4114,
+          4115,1045,1046,4116,1048,1049,1050,1052,1053,4117,4118,4119,4120,4121,4122,4123,4124,4125,4126,
+          4127,4128,4129,4130,4131,4132,4133,4134,4135,4136,4137,4138,4139,4140,4141,4142,1083,4143,4144,
+          4145,4146,1089,4147,4148,1093,1094,4149,4150,1097,1098,4151,1101,1102,1103,1104,1105,1106,1107,
+          1108,1109,1110,4152,4153,4154,4155,4156,4157,4158,4159,4160,4161,4162,4163,4164,4165,4166,4167,
+          4168,1126,1127,1128,4169,4170,1129,1130,1131,1132,4171,4172,4173,1140,4174,4175,4176,4177,1146,
+          4178,4179,1150,1151,4180,4181,1154,1155,4182,1158,1159,1160,1161,1162,1163,1164,1165,1166,1167,
+          4183,4184,4185,4186,4187,4188,4189,4190,4191,4192,4193,4194,4195,4196,4197,4198,4199,1183,1184,
+          1185,4200,4201,1186,1187,1188,1189,4202,4203,4204,1197,4205,4206,4207,4208,1202,4209,4210,1205,
+          1206,4211,4212,1209,1210,4213,1213,1214,1215,1216,1217,1218,1219,1220,1221,1222,4214,4215,4216,
+          4217,4218,4219,4220,4221,4222,4223,4224,4225,4226,4227,4228,4229,4230,1238,1239,1240,4231,4232,
+          1241,1242,1243,1244,4233,4234,4235,1252,4236,4237,4238,4239,1258,4240,4241,1262,1263,4242,4243,
+          1266,1267,4244,1270,1271,1272,1273,1274,1275,1276,1277,1278,1279,4245,4246,4247,4248,4249,4250,
+          4251,4252,4253,4254,4255,4256,4257,4258,4259,4260,4261,1295,1296,1297,4262,4263,1298,1299,1300,
+          1301,4264,4265,4266,4267,4268,4269,4270,4271,4272,4273,4274,4275,4276,4277,4278,4279,4280,4281,
+          4282,4283,4284,4285,4286,4287,4288,4289,4290,4291,4292,4293,4294,4295,4296,4297,4298,4299,4300,
+          4301,4302,4303,4304,4305,4306,4307,4308,4309,4310,4311,4312,4313,4314,4315,4316,4317,4318,4319,
+          4320,4321,4322,4323,4324,4325,4326,4327,4328,4329,4330,4331,4332,4333,4334,4335,4336,4337,4338,
+          4339,4340,4341,4342,4343,4344,4345,4346,4347,4348,4349,4350,4351,4352,4353,4354,4355,4356,4357,
+          4358,4359,4360,4361,4362,4363,4364,4365,4366,4367,4368,4369,4370,4371,4372,4373,4374,4375,4376,
+          4377,4378,4379,4380,4381,4382,4383,4384,4385,4386,4387,4388,4389,4390,4391,4392,4393,4394,4395,
+          4396,4397,4398,4399,4400,4401,4402,4403,4404,4405,4406,4407,4408,4409,4410,4411,4412,4413,4414,
+          4415,4416,4417,4418,4419,4420,4421,4422,4423,4424,4425,4426,4427,4428,4429,4430,1318,1319,4431,
+          4432,1322,1323,4433,1325,1326,1327,1328,1329,4434,4435,4436,4437,4438,4439,4440,4441,4442,4443,
+          4444,4445,4446,4447,4448,4449,4450,4451,4452,4453,4454,4455,4456,4457,4458,4459,4460,4461,4462,
+          4463,4464,4465,4466,4467,4468,1362,1363,4469,4470,1366,1367,4471,1369,1370,1371,1372,1373,4472,
+          4473,4474,4475,4476,4477,4478,4479,4480,4481,4482,4483,4484,4485,4486,4487,4488,4489,4490,4491,
+          4492,4493,4494,4495,4496,4497,4498,4499,4500,4501,4502,4503,4504,4505,4506,1406,1407,4507,4508,
+          1410,1411,4509,1413,1414,1415,1416,1417,4510,4511,4512,4513,4514,4515,4516,4517,4518,4519,4520,
+          4521,4522,4523,4524,4525,4526,4527,4528,4529,4530,4531,4532,4533,4534,4535,1441,4536,4537,4538,
+          1445,1446,4539,4540,4541,4542,1451,1452,4543,1454,1455,1456,1457,1458,1459,1460,1461,1462,4544,
+          4545,4546,4547,4548,4549,4550,4551,4552,4553,4554,4555,4556,4557,4558,4559,4560,1478,1479,4561,
+          4562,1480,1481,4563,1483,1484,4564,4565,4566,4567,4568,4569,4570,4571,4572,4573,4574,4575,4576,
+          4577,4578,4579,4580,4581,4582,4583,4584,4585,4586,4587,4588,4589,4590,4591,4592,4593,4594,4595,
+          4596,4597,4598,4599,4600,4601,4602,4603,4604,4605,4606,4607,4608,4609,4610,4611,4612,4613,4614,
+          4615,4616,4617,1486,4618,4619,4620,4621,1492,4622,4623,1496,1497,4624,4625,1500,1501,4626,1504,
+          1505,1506,1507,1508,1509,1510,1511,1512,1513,4627,4628,4629,4630,4631,4632,4633,4634,4635,4636,
+          4637,4638,4639,4640,4641,4642,4643,1529,1530,1531,4644,4645,1532,1533,1534,1535,4646,4647,4648,
+          1543,4649,4650,4651,4652,1549,4653,4654,1553,1554,4655,4656,1557,1558,4657,1561,1562,1563,1564,
+          1565,1566,1567,1568,1569,1570,4658,4659,4660,4661,4662,4663,4664,4665,4666,4667,4668,4669,4670,
+          4671,4672,4673,4674,1586,1587,1588,4675,4676,1589,1590,1591,1592,4677,4678,4679,4680,4681,4682,
+          4683,4684,4685,4686,4687,4688,4689,1614,4690,4691,1618,1619,4692,1621,1622,1623,1625,1626,4693,
+          4694,4695,4696,4697,4698,4699,4700,4701,4702,4703,4704,4705,4706,4707,4708,4709,4710,4711,4712,
+          4713,4714,4715,4716,4717,4718,1656,4719,4720,4721,4722,4723,4724,4725,4726,4727,4728,1669,4729,
+          1672,1673,1674,1675,1676,1677,1678,1680,1681,4730,4731,4732,4733,4734,4735,4736,4737,4738,4739,
+          4740,4741,4742,4743,4744,4745,4746,1698,1699,4747,4748,4749,4750,4751,4752,4753,1711,4754,4755,
+          4756,4757,4758,4759,4760,4761,4762,4763,1726,4764,1729,1730,1731,1732,1733,1734,1735,1737,1738,
+          4765,4766,4767,4768,4769,4770,4771,4772,4773,4774,4775,4776,4777,4778,4779,4780,4781,1755,1756,
+          4782,4783,4784,4785,4786,4787,4788,1768,4789,4790,4791,4792,1774,4793,4794,1778,1779,4795,4796,
+          1782,1783,4797,1786,1787,1788,1789,1790,1791,1792,1793,1794,1795,4798,4799,4800,4801,4802,4803,
+          4804,4805,4806,4807,4808,4809,4810,4811,4812,4813,4814,1811,1812,4815,4816,4817,1814,1815,1816,
+          1817,4818,4819,4820,4821,4822,4823,4824,4825,4826,4827,4828,4829,4830,4831,4832,4833,4834,4835,
+          4836,4837,4838,4839,4840,4841,4842,4843,4844,4845,4846,4847,4848,4849,4850,4851,4852,4853,4854,
+          4855,4856,4857,4858,1840,4859,4860,4861,4862,1842,4863,1843,1844,4864,4865,4866,1845,4867,1846,
+          1847,4868,4869,4870,1848,4871,1849,1850,4872,4873,4874,1851,4875,1852,1853,4876,4877,4878,1854,
+          4879,1855,1856,4880,4881,4882,1857,4883,1858,1859,4884,4885,4886,1860,4887,1861,1862,4888,4889,
+          4890,4891,4892,4893,4894,4895,4896,4897,4898,4899,4900,4901,4902,4903,4904,4905,4906,4907,4908,
+          1873,4909,4910,4911,4912,4913,4914,4915,4916,4917,4918,4919,4920,4921,4922,4923,4924,4925,4926,
+          4927,4928,4929,4930,4931,4932,4933,4934,4935,1897,4936,4937,4938,4939,4940,4941,4942,4943,4944,
+          4945,4946,4947,4948,1911,4949,4950,4951,4952,4953,4954,4955,4956,4957,4958,4959,4960,4961,1925,
+          4962,4963,4964,4965,4966,4967,4968,4969,1934,4970,1935,1936,1937,1938,1939,1940,1941,1942,1943,
+          1944,4971,4972,4973,4974,4975,4976,4977,1952,1953,1954,1955,4978,1957,1958,4979,4980,4981,4982,
+          4983,4984,4985,1966,1967,1968,1969,4986,1971,1972,4987,4988,4989,4990,4991,4992,4993,1980,1981,
+          1982,1983,4994,1985,1986,4995,4996,4997,4998,4999,5000,5001,1994,5002,5003,5004,5005,5006,5007,
+          5008,5009,5010,5011,5012,5013,5014,2008,2009,2010,2011,5015,2013,2014,5016,5017,5018,5019,5020,
+          5021,5022,2022,2023,2024,2025,5023,2027,2028,5024,5025,5026,5027,5028,5029,5030,5031,5032,5033,
+          5034,5035,5036,5037,5038,5039,5040,5041,5042,5043,5044,5045,5046,5047,5048,5049,5050,5051,5052,
+          5053,5054,5055,5056,5057,5058,2063,5059,5060,5061,5062,5063,5064,5065,5066,5067,5068,5069,5070,
+          5071,5072,5073,5074,5075,5076,5077,5078,5079,5080,5081,5082,5083,5084,5085,2085,5086,5087,5088,
+          5089,5090,5091,5092,5093,5094,5095,5096,5097,5098,2099,5099,5100,5101,5102,5103,5104,5105,5106,
+          5107,5108,5109,5110,5111,2113,5112,5113,5114,5115,5116,5117,5118,5119,2122,5120,2123,2124,2125,
+          2126,2127,2128,2129,5121,2131,2132,5122,5123,5124,5125,5126,5127,5128,2140,2141,2142,2143,5129,
+          2145,2146,5130,5131,5132,5133,5134,5135,5136,2154,2155,2156,2157,5137,2159,2160,5138,5139,5140,
+          5141,5142,5143,5144,2168,2169,2170,2171,5145,2173,2174,5146,5147,5148,5149,5150,5151,5152,2181,
+          5153,5154,5155,5156,5157,5158,5159,5160,5161,5162,5163,5164,5165,2194,2195,2196,2197,5166,2199,
+          2200,5167,5168,5169,5170,5171,5172,5173,2208,2209,2210,2211,5174,2213,2214,5175,5176,5177,5178,
+          5179,5180,5181,5182,5183,5184,5185,5186,5187,5188,5189,5190,5191,5192,5193,5194,5195,5196,5197,
+          5198,5199,5200,5201,5202,5203,5204,5205,5206,5207,5208,5209,2249,5210,5211,5212,5213,5214,5215,
+          5216,5217,5218,5219,5220,5221,5222,5223,5224,5225,5226,5227,5228,5229,5230,5231,5232,5233,5234,
+          5235,5236,2271,5237,5238,5239,5240,5241,5242,5243,5244,5245,5246,5247,5248,5249,2285,5250,5251,
+          5252,5253,5254,5255,5256,5257,5258,5259,5260,5261,5262,2299,5263,5264,5265,5266,5267,5268,5269,
+          5270,2308,5271,2309,2310,2311,2312,2313,2314,2315,2316,2317,2318,5272,5273,5274,5275,5276,5277,
+          5278,2326,2327,2328,2329,5279,2331,2332,5280,5281,5282,5283,5284,5285,5286,2340,2341,2342,2343,
+          5287,2345,2346,5288,5289,5290,5291,5292,5293,5294,2354,2355,2356,2357,5295,2359,2360,5296,5297,
+          5298,5299,5300,5301,5302,5303,5304,5305,5306,5307,5308,5309,5310,5311,5312,5313,5314,5315,5316,
+          2380,2381,2382,2383,5317,2385,2386,5318,5319,5320,5321,5322,5323,5324,2394,2395,2396,2397,5325,
+          2399,2400,5326,5327,5328,5329,5330,5331,5332,5333,5334,5335,5336,5337,5338,5339,5340,5341,5342,
+          5343,5344,5345,5346,5347,5348,5349,5350,5351,5352,5353,5354,5355,5356,5357,5358,5359,5360,2435,
+          5361,5362,5363,5364,5365,5366,5367,5368,5369,5370,5371,5372,5373,5374,5375,5376,5377,5378,5379,
+          5380,5381,5382,5383,5384,5385,5386,5387,2459,5388,5389,5390,5391,5392,5393,5394,5395,5396,5397,
+          5398,5399,5400,2473,5401,5402,5403,5404,5405,5406,5407,5408,5409,5410,5411,5412,5413,2487,5414,
+          5415,5416,5417,5418,5419,5420,5421,2496,5422,2497,2498,2499,2500,2501,2502,2503,5423,2505,2506,
+          5424,5425,5426,5427,5428,5429,5430,2514,2515,2516,2517,5431,2519,2520,5432,5433,5434,5435,5436,
+          5437,5438,2528,2529,2530,2531,5439,2533,2534,5440,5441,5442,5443,5444,5445,5446,2542,2543,2544,
+          2545,5447,2547,2548,5448,5449,5450,5451,5452,5453,5454,5455,5456,5457,5458,5459,5460,5461,5462,
+          5463,5464,5465,5466,5467,5468,2570,2571,2572,2573,5469,2575,2576,5470,5471,5472,5473,5474,5475,
+          5476,2584,2585,2586,2587,5477,2589,2590,5478,5479,5480,5481,5482,5483,5484,5485,5486,5487,5488,
+          5489,5490,5491,5492,5493,5494,5495,5496,5497,5498,5499,5500,5501,5502,5503,5504,5505,5506,5507,
+          5508,5509,5510,5511,2625,5512,5513,5514,5515,5516,5517,5518,5519,5520,5521,5522,5523,5524,5525,
+          5526,5527,5528,5529,5530,5531,5532,5533,5534,5535,2648,5536,5537,5538,5539,5540,5541,5542,5543,
+          5544,5545,2659,5546,5547,5548,5549,5550,5551,5552,5553,5554,2669,5555,5556,5557,5558,5559,5560,
+          5561,5562,2678,2679,2680,2681,2682,2683,2684,5563,5564,2687,2688,2689,5565,2691,2692,5566,5567,
+          2695,2696,5568,2698,2699,5569,5570,2702,5571,2704,2705,5572,5573,5574,5575,5576,5577,5578,2713,
+          2714,5579,5580,2717,5581,5582,5583,5584,5585,5586,5587,5588,5589,2727,5590,5591,5592,5593,5594,
+          5595,5596,5597,5598,5599,5600,5601,5602,5603,5604,5605,5606,5607,5608,5609,5610,5611,5612,5613,
+          2749,5614,5615,5616,5617,5618,5619,5620,5621,5622,5623,5624,2763,5625,5626,5627,5628,5629,5630,
+          5631,5632,5633,5634,5635,5636,5637,2777,5638,5639,5640,5641,5642,5643,5644,5645,2786,5646,2787,
+          2788,2789,2790,2791,2792,2793,2794,2795,2796,5647,5648,5649,5650,5651,5652,5653,2804,2805,2806,
+          2807,5654,2809,2810,5655,5656,5657,5658,5659,5660,5661,2818,2819,2820,2821,5662,2823,2824,5663,
+          5664,5665,5666,5667,5668,5669,2832,2833,2834,2835,5670,2837,2838,5671,5672,5673,5674,5675,5676,
+          5677,5678,5679,5680,5681,5682,5683,5684,5685,5686,5687,5688,5689,5690,5691,2858,2859,2860,2861,
+          5692,2863,2864,5693,5694,5695,5696,5697,5698,5699,2872,2873,2874,2875,5700,2877,2878,5701,5702,
+          5703,5704,5705,5706,5707,5708,5709,5710,5711,5712,5713,5714,5715,5716,5717,5718,5719,5720,5721,
+          5722,5723,5724,5725,5726,5727,5728,5729,5730,5731,5732,5733,5734,2913,5735,5736,5737,5738,5739,
+          5740,5741,5742,5743,5744,5745,5746,5747,5748,5749,5750,5751,5752,5753,5754,5755,5756,5757,5758,
+          2936,5759,5760,5761,5762,5763,5764,5765,5766,5767,5768,2947,5769,5770,5771,5772,5773,5774,5775,
+          5776,5777,2957,5778,5779,5780,5781,5782,5783,5784,5785,2966,2967,2968,2969,5786,2971,2972,5787,
+          5788,2975,2976,2977,5789,2979,2980,5790,5791,2983,2984,5792,2986,2987,5793,5794,2990,5795,2992,
+          2993,5796,5797,5798,5799,5800,5801,5802,3001,3002,5803,5804,3005,5805,5806,5807,5808,5809,5810,
+          5811,5812,5813,3015,5814,5815,5816,5817,5818,5819,5820,5821,5822,5823,5824,5825,5826,5827,5828,
+          5829,5830,5831,5832,5833,5834,5835,5836,5837,3038,5838,5839,5840,5841,5842,5843,5844,5845,5846,
+          5847,3049,5848,5849,5850,5851,5852,5853,5854,5855,5856,3059,5857,5858,5859,5860,5861,5862,5863,
+          5864,3068,3069,3070,3071,3072,3073,3074,5865,5866,3077,3078,3079,5867,3081,3082,5868,5869,3085,
+          3086,5870,3088,3089,5871,5872,3092,5873,3094,3095,5874,5875,5876,5877,5878,5879,5880,3103,3104,
+          5881,5882,3107,5883,5884,5885,5886,5887,5888,5889,5890,5891,3117,5892,5893,5894,5895,5896,5897,
+          5898,5899,5900,5901,5902,5903,5904,5905,5906,5907,5908,5909,5910,5911,5912,5913,5914,5915,3139,
+          5916,5917,5918,5919,5920,5921,5922,5923,5924,5925,5926,3153,5927,5928,5929,5930,5931,5932,5933,
+          5934,5935,5936,5937,5938,5939,3167,5940,5941,5942,5943,5944,5945,5946,5947,3176,5948,3177,3178,
+          3179,3180,3181,3182,3183,3184,3185,3186,5949,5950,5951,5952,5953,5954,5955,3194,3195,3196,3197,
+          5956,3199,3200,5957,5958,5959,5960,5961,5962,5963,3208,3209,3210,3211,5964,3213,3214,5965,5966,
+          5967,5968,5969,5970,5971,3222,3223,3224,3225,5972,3227,3228,5973,5974,5975,5976,5977,5978,5979,
+          5980,5981,5982,5983,5984,5985,5986,5987,5988,5989,5990,5991,5992,5993,3248,3249,3250,3251,5994,
+          3253,3254,5995,5996,5997,5998,5999,6000,6001,3262,3263,3264,3265,6002,3267,3268,6003,6004,6005,
+          6006,6007,6008,6009,6010,6011,6012,6013,6014,6015,6016,6017,6018,6019,6020,6021,6022,6023,6024,
+          6025,6026,6027,6028,6029,6030,6031,6032,6033,6034,6035,6036,3303,6037,6038,6039,6040,6041,6042,
+          6043,6044,6045,6046,6047,6048,6049,6050,6051,6052,6053,6054,6055,6056,6057,6058,6059,6060,3326,
+          6061,6062,6063,6064,6065,6066,6067,6068,6069,6070,3337,6071,6072,6073,6074,6075,6076,6077,6078,
+          6079,3347,6080,6081,6082,6083,6084,6085,6086,6087,3356,3357,3358,3359,6088,3361,3362,6089,6090,
+          3365,3366,3367,6091,3369,3370,6092,6093,3373,3374,6094,3376,3377,6095,6096,3380,6097,3382,3383,
+          6098,6099,6100,6101,6102,6103,6104,3391,3392,6105,6106,3395,6107,6108,6109,6110,6111,3403,3404,
+          3405,3406,3407,3408,3409,3410,3411, 155,3412, 156, 157, 158,3413,3414,3415, 159, 160, 161, 162,
+           163, 164, 165, 166, 167,3416,3417,3418,3419,3420,3421, 168, 169, 170, 171, 172, 173, 174, 175,
+           176,3422,3423,3424,3425,3426,3427, 177, 178, 179, 180, 181, 182, 183, 184, 185,3428,3429,3430,
+          3431,3432,3433, 186, 187, 188, 189, 190, 191, 192, 193, 194,3434,3435,3436,3437,3438,3439, 195,
+           196, 197, 198, 199, 200, 201, 202, 203,3440,3441,3442,3443,3444,3445, 204, 205, 206, 207, 208,
+           209, 210, 211, 212,3446,3447,3448,3449,3450,3451, 213, 214, 215, 216, 217, 218, 219, 220, 221,
+          3452,3453,3454,3455,3456,3457, 222, 223, 224, 225,3458, 228, 229, 230,3459, 231, 232,3460,3461,
+          3462, 233, 234,3463, 241, 242, 251, 252, 253, 254, 255, 256, 257, 258, 259, 262, 263, 264, 265,
+           266, 267, 268,3464,3581, 269,3582,3583,3584,3585, 270,3586, 271,3587,3588,3589, 272, 273, 274,
+           275,3590, 276, 277, 278, 279,3591, 294, 295,3592,3593,3594,3595,3596,3597,3598,3599, 296, 297,
+           298,3600,3601,3602,3603,3604,3605, 299, 300, 301, 302, 303, 304, 309, 310,3606,3607,3608,3609,
+          3610,3611,3612,3613,3614,3681,3682,3683,3684,3685,3686,3687,3688,3689,3690,3691,3692,3693,3694,
+          3695,3696,3697,3698,3699,3700,3701,3702,3703,3704,3705,3706,3707,3708,3709,3710,3711,3712,3713,
+          3714,3715,3716,3717,3718,3719,3720,3721,3722,3723,3724,3725,3726,3727,3728,3615,3616,3617,3618,
+          3619,3620,3621,3622,3623,3624,3625, 311, 312,6112,6113,};
+#endif /*FP_TEST_WANT_COMPLEX_FLOAT_TYPE */
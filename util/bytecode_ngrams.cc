@@ -0,0 +1,413 @@
+/*==========================================================================
+  bytecode_ngrams
+  ---------------
+  Collects the frequencies of opcode sequences in the bytecode of a corpus
+  of functions, for deciding which sequences are worth fusing into a single
+  opcode. The functions are read from the F= lines of test files like the
+  ones under tests/ (the T=, R= and C= lines are ignored).
+
+  The pairs of opcodes are fused into superinstructions of the threaded
+  interpreter, which are listed in FP_LIST_THREADED_SUPERINSTRUCTIONS in
+  extrasrc/fptypes.hh. The tool tells how many dispatches the listed ones
+  remove from the corpus, marks them among the most frequent pairs, and
+  prints the list entry for each frequent pair which could be added. The
+  code of a new superinstruction goes into EvalThreaded() in fparser.cc,
+  next to the existing ones.
+
+  Optimized functions are run as register code instead, where the pushes
+  of variables and immediates take no instructions. With -registers, the
+  sequences are collected from the register code, counting only those in
+  which each instruction uses the result of the previous one. Their
+  fusion is made by FuseProducts() in fpoptimizer/makeregistercode.cc.
+
+  Usage: bytecode_ngrams [-noopt] [-registers] [-n <length>] [-top <count>]
+                         <files...>
+============================================================================*/
+
+#include "fparser.hh"
+#include "extrasrc/fptypes.hh"
+#include "fpoptimizer/opcodename.hh"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace FUNCTIONPARSERTYPES;
+
+    // Gives access to the bytecode of the parsed function.
+    class ProfiledParser: public FunctionParser
+    {
+     public:
+        const std::vector<unsigned>& byteCode()
+        {
+            return getParserData()->mByteCode;
+        }
+
+#ifdef FP_SUPPORT_OPTIMIZER
+        const std::vector<RegisterInstruction>& registerCode()
+        {
+            return getParserData()->mRegisterCode;
+        }
+#endif
+    };
+
+    struct TestFunction
+    {
+        std::string function, variables;
+        bool useDegrees;
+    };
+
+    /* Reads the function of a test file, joining the lines continued with
+       a backslash. Returns false if the file has no F= line.
+    */
+    bool readTestFile(const char* fileName, TestFunction& test)
+    {
+        std::ifstream file(fileName);
+        if(!file) return false;
+
+        test = TestFunction();
+        test.useDegrees = false;
+        bool hasFunction = false;
+        std::string line;
+        while(std::getline(file, line))
+        {
+            while(!line.empty() && line[line.size()-1] == '\\')
+            {
+                line.erase(line.size()-1);
+                std::string continuation;
+                if(!std::getline(file, continuation)) break;
+                line += continuation;
+            }
+
+            const std::size_t equals = line.find('=');
+            if(equals == line.npos) continue;
+            std::size_t valueBegin = equals + 1;
+            while(valueBegin < line.size() && line[valueBegin] == ' ')
+                ++valueBegin;
+            const std::string key = line.substr(0, equals);
+            const std::string value = line.substr(valueBegin);
+
+            if(key == "F") { test.function = value; hasFunction = true; }
+            else if(key == "V") test.variables = value;
+            else if(key == "DEG") test.useDegrees = true;
+        }
+        return hasFunction;
+    }
+
+    /* Splits the bytecode into the names of its opcodes, leaving out the
+       operands. Every push of a variable is called "var". A sequence never
+       continues past a jump or into the target of a jump, because it
+       couldn't be fused into one opcode there; an empty name is put in
+       between instead.
+    */
+    std::vector<std::string> opcodeNames(const std::vector<unsigned>& byteCode)
+    {
+        std::set<unsigned> jumpTargets;
+        for(unsigned IP = 0; IP < byteCode.size(); ++IP)
+        {
+            switch(byteCode[IP])
+            {
+              case cIf: case cAbsIf: case cJump:
+                  jumpTargets.insert(byteCode[IP+1] + 1);
+                  IP += 2;
+                  break;
+              case cFCall: case cPCall: case cFetch:
+                  IP += 1;
+                  break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov:
+                  IP += 2;
+                  break;
+#endif
+              default: break;
+            }
+        }
+
+        std::vector<std::string> names;
+        for(unsigned IP = 0; IP < byteCode.size(); ++IP)
+        {
+            if(jumpTargets.count(IP)) names.push_back("");
+
+            const unsigned opcode = byteCode[IP];
+            if(opcode >= VarBegin)
+            {
+                names.push_back("var");
+                continue;
+            }
+            names.push_back(FP_GetOpcodeName(OPCODE(opcode)));
+
+            switch(opcode)
+            {
+              case cIf: case cAbsIf: case cJump:
+                  names.push_back("");
+                  IP += 2;
+                  break;
+              case cFCall: case cPCall: case cFetch:
+                  IP += 1;
+                  break;
+#ifdef FP_SUPPORT_OPTIMIZER
+              case cPopNMov:
+                  IP += 2;
+                  break;
+#endif
+              default: break;
+            }
+        }
+        return names;
+    }
+
+#ifdef FP_SUPPORT_OPTIMIZER
+    /* Like opcodeNames(), for the register code. A sequence is also broken
+       where an instruction doesn't read the result of the one before it,
+       because the two couldn't be fused then.
+    */
+    std::vector<std::string> registerOpcodeNames
+    (const std::vector<RegisterInstruction>& code)
+    {
+        std::set<unsigned> jumpTargets;
+        for(std::size_t IP = 0; IP < code.size(); ++IP)
+        {
+            if(code[IP].opcode == cIf || code[IP].opcode == cAbsIf)
+                jumpTargets.insert(code[IP].b);
+            else if(code[IP].opcode == cJump)
+                jumpTargets.insert(code[IP].a);
+        }
+
+        std::vector<std::string> names;
+        for(std::size_t IP = 0; IP < code.size(); ++IP)
+        {
+            const RegisterInstruction& in = code[IP];
+            if(IP > 0)
+            {
+                const unsigned previous = code[IP-1].result;
+                const bool readsPrevious =
+                    in.opcode != cJump && in.opcode != cFCall &&
+                    in.opcode != cPCall &&
+                    (in.a == previous || in.b == previous ||
+                     in.c == previous || in.d == previous);
+                if(jumpTargets.count(unsigned(IP)) || !readsPrevious)
+                    names.push_back("");
+            }
+            names.push_back(FP_GetOpcodeName(OPCODE(in.opcode)));
+            if(in.opcode == cIf || in.opcode == cAbsIf || in.opcode == cJump)
+                names.push_back("");
+        }
+        return names;
+    }
+#endif
+
+    std::string opcodeName(unsigned opcode)
+    {
+        return opcode >= VarBegin ? "var" : FP_GetOpcodeName(OPCODE(opcode));
+    }
+
+    typedef std::set<std::pair<std::string, std::string> > OpcodePairs;
+
+    OpcodePairs superinstructions()
+    {
+        OpcodePairs pairs;
+#define o(name, first, second) \
+        pairs.insert(std::make_pair(opcodeName(first), opcodeName(second)));
+        FP_LIST_THREADED_SUPERINSTRUCTIONS(o)
+#undef o
+        return pairs;
+    }
+
+    // The number of dispatches the threaded interpreter makes for the
+    // opcodes, with the superinstructions and without them.
+    void countDispatches(const std::vector<std::string>& names,
+                         const OpcodePairs& pairs,
+                         unsigned& fusedAmount, unsigned& unfusedAmount)
+    {
+        for(std::size_t i = 0; i < names.size(); ++i)
+        {
+            if(names[i].empty()) continue;
+            ++fusedAmount;
+            ++unfusedAmount;
+            if(i + 1 < names.size() &&
+               pairs.count(std::make_pair(names[i], names[i+1])))
+            {
+                ++unfusedAmount;
+                ++i;
+            }
+        }
+    }
+
+    // Opcodes with operands in the bytecode can't be in a superinstruction.
+    bool canBePaired(const std::string& name)
+    {
+        return name != "cIf" && name != "cAbsIf" && name != "cJump"
+            && name != "cFCall" && name != "cPCall" && name != "cFetch"
+            && name != "cPopNMov";
+    }
+
+    /* Writes the entry of FP_LIST_THREADED_SUPERINSTRUCTIONS for the pair,
+       such as o(immedAdd, cImmed, cAdd).
+    */
+    std::string superinstructionEntry(const std::string& first,
+                                      const std::string& second)
+    {
+        const std::string names[2] = { first, second };
+        std::string label, opcodes;
+        for(unsigned i = 0; i < 2; ++i)
+        {
+            std::string part = names[i] == "var" ? "variable" :
+                names[i].substr(1);
+            part[0] = char(i == 0 ? std::tolower(part[0]) :
+                           std::toupper(part[0]));
+            label += part;
+            opcodes += ", ";
+            opcodes += names[i] == "var" ? "VarBegin" : names[i];
+        }
+        return "o(" + label + opcodes + ")";
+    }
+
+    int printHelp(const char* programName)
+    {
+        std::cout <<
+            "Usage: " << programName <<
+            " [<options>] <test files...>\n"
+            "Prints the most frequent opcode sequences in the bytecode of "
+            "the functions\nin the given test files.\n\n"
+            "Options:\n"
+            "  -noopt       Don't call Optimize() before collecting.\n"
+            "  -registers   Collect from the register code made by "
+            "Optimize().\n"
+            "  -n <length>  Longest sequence to collect (default 4).\n"
+            "  -top <count> Sequences to print of each length (default 20).\n";
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool optimize = true, registers = false;
+    unsigned maxLength = 4, topCount = 20;
+    std::vector<const char*> fileNames;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "-noopt") == 0)
+            optimize = false;
+        else if(std::strcmp(argv[i], "-registers") == 0)
+            registers = true;
+        else if(std::strcmp(argv[i], "-n") == 0 && i+1 < argc)
+            maxLength = unsigned(std::atoi(argv[++i]));
+        else if(std::strcmp(argv[i], "-top") == 0 && i+1 < argc)
+            topCount = unsigned(std::atoi(argv[++i]));
+        else if(argv[i][0] == '-')
+            return printHelp(argv[0]);
+        else
+            fileNames.push_back(argv[i]);
+    }
+    if(fileNames.empty() || maxLength < 2 || (registers && !optimize))
+        return printHelp(argv[0]);
+#ifndef FP_SUPPORT_OPTIMIZER
+    if(registers)
+    {
+        std::cerr << "The register code needs the optimizer.\n";
+        return 1;
+    }
+#endif
+
+    // counts[n-2] holds the counts of the sequences of length n.
+    std::vector<std::map<std::vector<std::string>, unsigned> >
+        counts(maxLength - 1);
+    unsigned functionAmount = 0, failedAmount = 0, opcodeAmount = 0;
+    unsigned fusedDispatches = 0, unfusedDispatches = 0;
+    const OpcodePairs fusedPairs = superinstructions();
+
+    for(std::size_t fileIndex = 0; fileIndex < fileNames.size(); ++fileIndex)
+    {
+        TestFunction test;
+        if(!readTestFile(fileNames[fileIndex], test)) continue;
+
+        ProfiledParser fp;
+        if(fp.Parse(test.function, test.variables, test.useDegrees) >= 0)
+        {
+            ++failedAmount;
+            continue;
+        }
+        if(optimize) fp.Optimize();
+        ++functionAmount;
+
+        std::vector<std::string> names;
+#ifdef FP_SUPPORT_OPTIMIZER
+        if(registers)
+            names = registerOpcodeNames(fp.registerCode());
+        else
+#endif
+        {
+            names = opcodeNames(fp.byteCode());
+            countDispatches(names, fusedPairs,
+                            fusedDispatches, unfusedDispatches);
+        }
+        for(std::size_t begin = 0; begin < names.size(); ++begin)
+        {
+            if(names[begin].empty()) continue;
+            ++opcodeAmount;
+            std::vector<std::string> sequence(1, names[begin]);
+            for(std::size_t end = begin + 1;
+                end < names.size() && sequence.size() < maxLength &&
+                    !names[end].empty();
+                ++end)
+            {
+                sequence.push_back(names[end]);
+                ++counts[sequence.size() - 2][sequence];
+            }
+        }
+    }
+
+    std::cout << "Functions: " << functionAmount
+              << " (" << failedAmount << " failed to parse), "
+              << (registers ? "register instructions: " : "opcodes: ")
+              << opcodeAmount << "\n";
+    if(!registers)
+        std::cout << "Threaded interpreter dispatches: " << fusedDispatches
+                  << " (" << unfusedDispatches
+                  << " without superinstructions)\n";
+
+    for(unsigned length = 2; length <= maxLength; ++length)
+    {
+        typedef std::pair<unsigned, std::vector<std::string> > Entry;
+        std::vector<Entry> sorted;
+        const std::map<std::vector<std::string>, unsigned>& lengthCounts =
+            counts[length - 2];
+        for(std::map<std::vector<std::string>, unsigned>::const_iterator
+                i = lengthCounts.begin(); i != lengthCounts.end(); ++i)
+            sorted.push_back(Entry(i->second, i->first));
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const Entry& a, const Entry& b)
+                         { return a.first > b.first; });
+
+        std::cout << "\nSequences of " << length << " opcodes:\n";
+        for(std::size_t i = 0; i < sorted.size() && i < topCount; ++i)
+        {
+            std::cout << std::setw(8) << sorted[i].first << "  ";
+            const std::vector<std::string>& sequence = sorted[i].second;
+            for(std::size_t j = 0; j < sequence.size(); ++j)
+                std::cout << (j ? " " : "") << sequence[j];
+            if(length == 2 && !registers)
+            {
+                if(fusedPairs.count(std::make_pair(sequence[0], sequence[1])))
+                    std::cout << "  (superinstruction)";
+                else if(canBePaired(sequence[0]) && canBePaired(sequence[1]))
+                    std::cout << "\n          add: "
+                              << superinstructionEntry(sequence[0],
+                                                       sequence[1]);
+            }
+            std::cout << "\n";
+        }
+    }
+    return 0;
+}
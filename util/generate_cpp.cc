@@ -0,0 +1,122 @@
+/*==========================================================================
+  generate_cpp
+  ------------
+  Writes a standalone C++ function which calculates the given function,
+  for compiling ahead of time instead of parsing and evaluating it at
+  runtime. The function is optimized first unless -noopt is given, and the
+  code is generated with FunctionParserBase::GenerateCppSource().
+
+  If the variables are not given, they are deduced from the function and
+  listed in the comment at the beginning of the output. The generated
+  function takes them as an array in that order.
+
+  Usage: generate_cpp [<options>] <function> [<variables>]
+============================================================================*/
+
+#include "fparser.hh"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template<typename Value_t>
+    int generate(const std::string& function, std::string variables,
+                 bool useDegrees, bool optimize, const char* funcName)
+    {
+        FunctionParserBase<Value_t> fp;
+        if(variables.empty())
+        {
+            std::vector<std::string> deducedVariables;
+            if(fp.ParseAndDeduceVariables(function, deducedVariables,
+                                          useDegrees) >= 0)
+            {
+                std::cerr << "Parse error: " << fp.ErrorMsg() << "\n";
+                return 1;
+            }
+            for(std::size_t i = 0; i < deducedVariables.size(); ++i)
+                variables += (i ? "," : "") + deducedVariables[i];
+        }
+        if(fp.Parse(function, variables, useDegrees) >= 0)
+        {
+            std::cerr << "Parse error: " << fp.ErrorMsg() << "\n";
+            return 1;
+        }
+        if(optimize) fp.Optimize();
+
+        if(!fp.GenerateCppSource(std::cout, funcName))
+        {
+            std::cerr << "The function can't be converted to C++.\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    int printHelp(const char* programName)
+    {
+        std::cout <<
+            "Usage: " << programName <<
+            " [<options>] <function> [<variables>]\n"
+            "Prints a C++ function which calculates the given function.\n\n"
+            "Options:\n"
+            "  -f           Generate the function for float.\n"
+            "  -ld          Generate the function for long double.\n"
+            "  -deg         Use degrees for trigonometry.\n"
+            "  -noopt       Don't call Optimize() before generating.\n"
+            "  -name <name> Name of the generated function (default f).\n";
+        return 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    enum { type_double, type_float, type_long_double } type = type_double;
+    bool useDegrees = false, optimize = true;
+    const char* funcName = "f";
+    std::vector<const char*> arguments;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "-f") == 0)
+            type = type_float;
+        else if(std::strcmp(argv[i], "-ld") == 0)
+            type = type_long_double;
+        else if(std::strcmp(argv[i], "-deg") == 0)
+            useDegrees = true;
+        else if(std::strcmp(argv[i], "-noopt") == 0)
+            optimize = false;
+        else if(std::strcmp(argv[i], "-name") == 0 && i+1 < argc)
+            funcName = argv[++i];
+        else if(std::strcmp(argv[i], "-h") == 0 ||
+                std::strcmp(argv[i], "--help") == 0)
+            return printHelp(argv[0]);
+        else
+            arguments.push_back(argv[i]);
+    }
+    if(arguments.empty() || arguments.size() > 2) return printHelp(argv[0]);
+
+    const std::string function = arguments[0];
+    const std::string variables = arguments.size() > 1 ? arguments[1] : "";
+
+    switch(type)
+    {
+      case type_double:
+          return generate<double>(function, variables, useDegrees, optimize,
+                                  funcName);
+#ifdef FP_SUPPORT_FLOAT_TYPE
+      case type_float:
+          return generate<float>(function, variables, useDegrees, optimize,
+                                 funcName);
+#endif
+#ifdef FP_SUPPORT_LONG_DOUBLE_TYPE
+      case type_long_double:
+          return generate<long double>(function, variables, useDegrees,
+                                       optimize, funcName);
+#endif
+      default:
+          std::cerr << "The type is not supported in this build.\n";
+          return 1;
+    }
+}
@@ -9,7 +9,6 @@
 
 static const char* const kVersionNumber = "1.1.0";
 
-//#define TEST_JIT
 //#define MEASURE_PARSING_SPEED_ONLY
 
 #include "fparser.hh"
@@ -22,9 +21,15 @@ static const char* const kVersionNumber = "1.1.0";
 #include <cmath>
 #include <sstream>
 #include <cstring>
+#include <vector>
 
 #include <sys/time.h>
 
+#ifdef FP_SPEEDTEST_GENERATED
+// Written by "speedtest -gencpp", see the speedtest_generated target
+#include "util/speedtest_generated.hh"
+#endif
+
 #define N(v) static_cast<Value_t>(v)
 #define P(v) FUNCTIONPARSERTYPES::fp_const_preciseDouble<Value_t>(v)
 
@@ -186,6 +191,61 @@ namespace
         return data.function_mpfr(values);
     }
 
+    /* The test functions compiled from the C++ source generated by
+       GenerateCppSource(), when built as speedtest_generated. */
+    template<typename Value_t>
+    struct GeneratedFunctions
+    {
+        typedef Value_t (*Function)(const Value_t*);
+        static Function get(unsigned) { return 0; }
+    };
+
+#ifdef FP_SPEEDTEST_GENERATED
+#define CreateGeneratedFunctions(suffix, type) \
+    template<> \
+    struct GeneratedFunctions<type> \
+    { \
+        typedef type (*Function)(const type*); \
+        static Function get(unsigned index) \
+        { return generatedFunctions_##suffix[index]; } \
+    };
+
+    CreateGeneratedFunctions(d, double)
+#ifdef FP_SUPPORT_FLOAT_TYPE
+    CreateGeneratedFunctions(f, float)
+#endif
+#ifdef FP_SUPPORT_LONG_DOUBLE_TYPE
+    CreateGeneratedFunctions(ld, long double)
+#endif
+#undef CreateGeneratedFunctions
+#endif
+
+    /* Prints the optimized test functions as C++ source, followed by an
+       array of pointers to them (0 for those which couldn't be generated).
+    */
+    template<typename Value_t>
+    void printGeneratedFunctions(const char* typeName, const char* suffix)
+    {
+        std::ostringstream pointers;
+        for(unsigned i = 0; i < FunctionsAmount; ++i)
+        {
+            FunctionParserBase<Value_t> fp;
+            fp.Parse(funcData[i].funcStr, funcData[i].paramStr);
+            fp.Optimize();
+
+            std::ostringstream name;
+            name << "generated" << i << '_' << suffix;
+            if(fp.GenerateCppSource(std::cout, name.str().c_str()))
+                pointers << "    " << name.str() << ",\n";
+            else
+                pointers << "    0,\n";
+            std::cout << "\n";
+        }
+        std::cout << typeName << " (*const generatedFunctions_" << suffix
+                  << "[])(const " << typeName << "*) =\n{\n"
+                  << pointers.str() << "};\n\n";
+    }
+
     std::string beautify(int value)
     {
         std::ostringstream os;
@@ -320,18 +380,36 @@ int run(const unsigned ParseLoops,
             fp2.Eval(values);
         tester.Report("Optimized", "evals");
 
+        // Measure evaluation speed, optimized, without threaded code
+        // -----------------------------------------------------------
+        tester.Start(EvalLoops);
+        while(tester.Loop())
+            fp2.EvalWithoutThreadedCode(values);
+        tester.Report("Optimized, switch dispatch", "evals");
 
-#ifdef TEST_JIT
-        // Measure evaluation speed, jit-compiled
-        // --------------------------------------
-        const unsigned JitLoops = 50000000;
-        fp2.CreateJIT();
+        // Measure batch evaluation speed, optimized
+        // -----------------------------------------
+        const unsigned BatchRows = 1000;
+        std::vector<Value_t> batchValues, batchResults(BatchRows);
+        for(unsigned row = 0; row < BatchRows; ++row)
+            batchValues.insert(batchValues.end(), values, values + 2);
 
-        tester.Start(JitLoops);
+        tester.Start(EvalLoops / BatchRows);
         while(tester.Loop())
-            fp2.Eval(values);
-        tester.Report("JIT-compiled", "evals");
-#endif
+            fp2.EvalBatch(batchValues.data(), 2, BatchRows,
+                          batchResults.data());
+        tester.Report("Optimized batch of 1000", "batches");
+
+
+        // Measure evaluation speed, jit-compiled (where supported)
+        // ---------------------------------------------------------
+        if(fp2.CreateJIT())
+        {
+            tester.Start(EvalLoops);
+            while(tester.Loop())
+                fp2.Eval(values);
+            tester.Report("JIT-compiled", "evals");
+        }
 
 
         // Measure optimization speed
@@ -354,6 +432,16 @@ int run(const unsigned ParseLoops,
                 callFunc(funcData[i], values);
 
             tester.Report("C++ function time", "evals");
+
+            const typename GeneratedFunctions<Value_t>::Function generated =
+                GeneratedFunctions<Value_t>::get(i);
+            if(generated)
+            {
+                tester.Start(FuncLoops);
+                while(tester.Loop())
+                    generated(values);
+                tester.Report("Generated C++ time", "evals");
+            }
         }
 #endif
 
@@ -374,6 +462,18 @@ int main(int argc, char* argv[])
         else if(std::strcmp(argv[i], "-f") == 0) parserType = FP_F;
         else if(std::strcmp(argv[i], "-ld") == 0) parserType = FP_LD;
         else if(std::strcmp(argv[i], "-mpfr") == 0) parserType = FP_MPFR;
+        else if(std::strcmp(argv[i], "-gencpp") == 0)
+        {
+            std::cout << "// Generated by " << argv[0] << " -gencpp\n\n";
+            printGeneratedFunctions<double>("double", "d");
+#ifdef FP_SUPPORT_FLOAT_TYPE
+            printGeneratedFunctions<float>("float", "f");
+#endif
+#ifdef FP_SUPPORT_LONG_DOUBLE_TYPE
+            printGeneratedFunctions<long double>("long double", "ld");
+#endif
+            return 0;
+        }
         else if(std::strcmp(argv[i], "--help") == 0
              || std::strcmp(argv[i], "-help") == 0
              || std::strcmp(argv[i], "-h") == 0
@@ -387,6 +487,8 @@ int main(int argc, char* argv[])
                 "    -ld               Test long double datatype\n"
                 "    -mpfr             Test MPFR datatype\n"
                 "    -html             Print output in html format\n"
+                "    -gencpp           Print the test functions as C++ source\n"
+                "                      (used for building speedtest_generated)\n"
                 "    -h, --help        This help\n"
                 "\n";
             return 0;